@@ -26,6 +26,7 @@
 #include <aws/acm/model/RequestCertificateResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -178,6 +179,33 @@ namespace Model
          */
         virtual void DeleteCertificateAsync(const Model::DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes an ACM Certificate and its associated private key. If this action
+         * succeeds, the certificate no longer appears in the list of ACM Certificates that
+         * can be displayed by calling the <a>ListCertificates</a> action or be retrieved
+         * by calling the <a>GetCertificate</a> action. The certificate will not be
+         * available for use by other AWS services.</p> <note>You cannot delete an ACM
+         * Certificate that is being used by another AWS service. To delete a certificate
+         * that is in use, the certificate association must first be removed. </note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteCertificateOutcome> DeleteCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteCertificateOutcome>([this, request](const std::function<void(Model::DeleteCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteCertificateAsync(request, [complete](const ACMClient*, const Model::DeleteCertificateRequest&, const Model::DeleteCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of the fields contained in the specified ACM Certificate. For
          * example, this action returns the certificate status, a flag that indicates
@@ -209,6 +237,31 @@ namespace Model
          */
         virtual void DescribeCertificateAsync(const Model::DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of the fields contained in the specified ACM Certificate. For
+         * example, this action returns the certificate status, a flag that indicates
+         * whether the certificate is associated with any other AWS service, and the date
+         * at which the certificate request was created. The ACM Certificate is specified
+         * on input by its Amazon Resource Name (ARN). </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCertificateOutcome> DescribeCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCertificateOutcome>([this, request](const std::function<void(Model::DescribeCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCertificateAsync(request, [complete](const ACMClient*, const Model::DescribeCertificateRequest&, const Model::DescribeCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Retrieves an ACM Certificate and certificate chain for the certificate
          * specified by an ARN. The chain is an ordered list of certificates that contains
@@ -246,6 +299,33 @@ namespace Model
          */
         virtual void GetCertificateAsync(const Model::GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Retrieves an ACM Certificate and certificate chain for the certificate
+         * specified by an ARN. The chain is an ordered list of certificates that contains
+         * the root certificate, intermediate certificates of subordinate CAs, and the ACM
+         * Certificate. The certificate and certificate chain are base64 encoded. If you
+         * want to decode the certificate chain to see the individual certificate fields,
+         * you can use OpenSSL. </p> <note> Currently, ACM Certificates can be used only
+         * with Elastic Load Balancing and Amazon CloudFront. </note>
+         *
+         * Returns an awaitable that starts the operation the way GetCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetCertificateOutcome> GetCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetCertificateOutcome>([this, request](const std::function<void(Model::GetCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetCertificateAsync(request, [complete](const ACMClient*, const Model::GetCertificateRequest&, const Model::GetCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Retrieves a list of the ACM Certificate ARNs, and the domain name for each
          * ARN, owned by the calling account. You can filter the list based on the
@@ -283,6 +363,33 @@ namespace Model
          */
         virtual void ListCertificatesAsync(const Model::ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Retrieves a list of the ACM Certificate ARNs, and the domain name for each
+         * ARN, owned by the calling account. You can filter the list based on the
+         * <code>CertificateStatuses</code> parameter, and you can display up to
+         * <code>MaxItems</code> certificates at one time. If you have more than
+         * <code>MaxItems</code> certificates, use the <code>NextToken</code> marker from
+         * the response object in your next call to the <code>ListCertificates</code>
+         * action to retrieve the next set of certificate ARNs. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListCertificatesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListCertificatesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListCertificatesOutcome> ListCertificatesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListCertificatesOutcome>([this, request](const std::function<void(Model::ListCertificatesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListCertificatesAsync(request, [complete](const ACMClient*, const Model::ListCertificatesRequest&, const Model::ListCertificatesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListCertificatesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Requests an ACM Certificate for use with other AWS services. To request an
          * ACM Certificate, you must specify the fully qualified domain name (FQDN) for
@@ -323,6 +430,34 @@ namespace Model
          */
         virtual void RequestCertificateAsync(const Model::RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Requests an ACM Certificate for use with other AWS services. To request an
+         * ACM Certificate, you must specify the fully qualified domain name (FQDN) for
+         * your site. You can also specify additional FQDNs if users can reach your site by
+         * using other names. For each domain name you specify, email is sent to the domain
+         * owner to request approval to issue the certificate. After receiving approval
+         * from the domain owner, the ACM Certificate is issued. For more information, see
+         * the <a href="http://docs.aws.amazon.com/acm/latest/userguide/overview.html"> AWS
+         * Certificate Manager User Guide </a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way RequestCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RequestCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::RequestCertificateOutcome> RequestCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RequestCertificateOutcome>([this, request](const std::function<void(Model::RequestCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RequestCertificateAsync(request, [complete](const ACMClient*, const Model::RequestCertificateRequest&, const Model::RequestCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RequestCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Resends the email that requests domain ownership validation. The domain
          * owner or an authorized representative must approve the ACM Certificate before it
@@ -366,6 +501,35 @@ namespace Model
          */
         virtual void ResendValidationEmailAsync(const Model::ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Resends the email that requests domain ownership validation. The domain
+         * owner or an authorized representative must approve the ACM Certificate before it
+         * can be issued. The certificate can be approved by clicking a link in the mail to
+         * navigate to the Amazon certificate approval website and then clicking <b>I
+         * Approve</b>. However, the validation email can be blocked by spam filters.
+         * Therefore, if you do not receive the original mail, you can request that the
+         * mail be resent within 72 hours of requesting the ACM Certificate. If more than
+         * 72 hours have elapsed since your original request or since your last attempt to
+         * resend validation mail, you must request a new certificate. </p>
+         *
+         * Returns an awaitable that starts the operation the way ResendValidationEmailAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResendValidationEmailRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResendValidationEmailOutcome> ResendValidationEmailAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResendValidationEmailOutcome>([this, request](const std::function<void(Model::ResendValidationEmailOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResendValidationEmailAsync(request, [complete](const ACMClient*, const Model::ResendValidationEmailRequest&, const Model::ResendValidationEmailOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResendValidationEmailOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
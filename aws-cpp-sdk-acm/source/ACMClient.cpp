@@ -100,7 +100,7 @@ DeleteCertificateOutcome ACMClient::DeleteCertificate(const DeleteCertificateReq
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeleteCertificate");
   if(outcome.IsSuccess())
   {
     return DeleteCertificateOutcome(NoResult());
@@ -113,17 +113,42 @@ DeleteCertificateOutcome ACMClient::DeleteCertificate(const DeleteCertificateReq
 
 DeleteCertificateOutcomeCallable ACMClient::DeleteCertificateCallable(const DeleteCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::DeleteCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteCertificateOutcome > rejected;
+    rejected.set_value(DeleteCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void ACMClient::DeleteCertificateAsync(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::DeleteCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&ACMClient::DeleteCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void ACMClient::DeleteCertificateAsyncHelper(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  auto sharedRequest = Aws::MakeShared<DeleteCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeleteCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeCertificateOutcome ACMClient::DescribeCertificate(const DescribeCertificateRequest& request) const
@@ -131,7 +156,7 @@ DescribeCertificateOutcome ACMClient::DescribeCertificate(const DescribeCertific
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeCertificate");
   if(outcome.IsSuccess())
   {
     return DescribeCertificateOutcome(DescribeCertificateResult(outcome.GetResult()));
@@ -144,17 +169,42 @@ DescribeCertificateOutcome ACMClient::DescribeCertificate(const DescribeCertific
 
 DescribeCertificateOutcomeCallable ACMClient::DescribeCertificateCallable(const DescribeCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::DescribeCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeCertificateOutcome > rejected;
+    rejected.set_value(DescribeCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void ACMClient::DescribeCertificateAsync(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::DescribeCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&ACMClient::DescribeCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void ACMClient::DescribeCertificateAsyncHelper(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  auto sharedRequest = Aws::MakeShared<DescribeCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeCertificateOutcome(DescribeCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetCertificateOutcome ACMClient::GetCertificate(const GetCertificateRequest& request) const
@@ -162,7 +212,7 @@ GetCertificateOutcome ACMClient::GetCertificate(const GetCertificateRequest& req
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "GetCertificate");
   if(outcome.IsSuccess())
   {
     return GetCertificateOutcome(GetCertificateResult(outcome.GetResult()));
@@ -175,17 +225,42 @@ GetCertificateOutcome ACMClient::GetCertificate(const GetCertificateRequest& req
 
 GetCertificateOutcomeCallable ACMClient::GetCertificateCallable(const GetCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::GetCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetCertificateOutcome > rejected;
+    rejected.set_value(GetCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void ACMClient::GetCertificateAsync(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::GetCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&ACMClient::GetCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void ACMClient::GetCertificateAsyncHelper(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  auto sharedRequest = Aws::MakeShared<GetCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "GetCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCertificateOutcome(GetCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListCertificatesOutcome ACMClient::ListCertificates(const ListCertificatesRequest& request) const
@@ -193,7 +268,7 @@ ListCertificatesOutcome ACMClient::ListCertificates(const ListCertificatesReques
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ListCertificates");
   if(outcome.IsSuccess())
   {
     return ListCertificatesOutcome(ListCertificatesResult(outcome.GetResult()));
@@ -206,17 +281,42 @@ ListCertificatesOutcome ACMClient::ListCertificates(const ListCertificatesReques
 
 ListCertificatesOutcomeCallable ACMClient::ListCertificatesCallable(const ListCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::ListCertificates, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListCertificatesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCertificates( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListCertificatesOutcome > rejected;
+    rejected.set_value(ListCertificatesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void ACMClient::ListCertificatesAsync(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::ListCertificatesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&ACMClient::ListCertificatesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListCertificatesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void ACMClient::ListCertificatesAsyncHelper(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListCertificates(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  auto sharedRequest = Aws::MakeShared<ListCertificatesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ListCertificates", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListCertificatesOutcome(ListCertificatesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListCertificatesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 RequestCertificateOutcome ACMClient::RequestCertificate(const RequestCertificateRequest& request) const
@@ -224,7 +324,7 @@ RequestCertificateOutcome ACMClient::RequestCertificate(const RequestCertificate
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "RequestCertificate");
   if(outcome.IsSuccess())
   {
     return RequestCertificateOutcome(RequestCertificateResult(outcome.GetResult()));
@@ -237,17 +337,42 @@ RequestCertificateOutcome ACMClient::RequestCertificate(const RequestCertificate
 
 RequestCertificateOutcomeCallable ACMClient::RequestCertificateCallable(const RequestCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::RequestCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< RequestCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RequestCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< RequestCertificateOutcome > rejected;
+    rejected.set_value(RequestCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void ACMClient::RequestCertificateAsync(const RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::RequestCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&ACMClient::RequestCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, RequestCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void ACMClient::RequestCertificateAsyncHelper(const RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, RequestCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  auto sharedRequest = Aws::MakeShared<RequestCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "RequestCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RequestCertificateOutcome(RequestCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RequestCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ResendValidationEmailOutcome ACMClient::ResendValidationEmail(const ResendValidationEmailRequest& request) const
@@ -255,7 +380,7 @@ ResendValidationEmailOutcome ACMClient::ResendValidationEmail(const ResendValida
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ResendValidationEmail");
   if(outcome.IsSuccess())
   {
     return ResendValidationEmailOutcome(NoResult());
@@ -268,16 +393,41 @@ ResendValidationEmailOutcome ACMClient::ResendValidationEmail(const ResendValida
 
 ResendValidationEmailOutcomeCallable ACMClient::ResendValidationEmailCallable(const ResendValidationEmailRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::ResendValidationEmail, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ResendValidationEmailOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ResendValidationEmail( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ResendValidationEmailOutcome > rejected;
+    rejected.set_value(ResendValidationEmailOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void ACMClient::ResendValidationEmailAsync(const ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::ResendValidationEmailAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&ACMClient::ResendValidationEmailAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ResendValidationEmailOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void ACMClient::ResendValidationEmailAsyncHelper(const ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ResendValidationEmail(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  auto sharedRequest = Aws::MakeShared<ResendValidationEmailRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ResendValidationEmail", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ResendValidationEmailOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ResendValidationEmailOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
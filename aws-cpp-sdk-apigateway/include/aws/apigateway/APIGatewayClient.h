@@ -81,6 +81,7 @@
 #include <aws/apigateway/model/UpdateStageResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -485,6 +486,27 @@ namespace Model
          */
         virtual void CreateApiKeyAsync(const Model::CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way CreateApiKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateApiKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateApiKeyOutcome> CreateApiKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateApiKeyOutcome>([this, request](const std::function<void(Model::CreateApiKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateApiKeyAsync(request, [complete](const APIGatewayClient*, const Model::CreateApiKeyRequest&, const Model::CreateApiKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateApiKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -504,6 +526,27 @@ namespace Model
          */
         virtual void CreateAuthorizerAsync(const Model::CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way CreateAuthorizerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAuthorizerRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAuthorizerOutcome> CreateAuthorizerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAuthorizerOutcome>([this, request](const std::function<void(Model::CreateAuthorizerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAuthorizerAsync(request, [complete](const APIGatewayClient*, const Model::CreateAuthorizerRequest&, const Model::CreateAuthorizerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAuthorizerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new <a>BasePathMapping</a> resource.</p>
          */
@@ -523,6 +566,27 @@ namespace Model
          */
         virtual void CreateBasePathMappingAsync(const Model::CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new <a>BasePathMapping</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateBasePathMappingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateBasePathMappingRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateBasePathMappingOutcome> CreateBasePathMappingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateBasePathMappingOutcome>([this, request](const std::function<void(Model::CreateBasePathMappingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateBasePathMappingAsync(request, [complete](const APIGatewayClient*, const Model::CreateBasePathMappingRequest&, const Model::CreateBasePathMappingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateBasePathMappingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a <a>Deployment</a> resource, which makes a specified <a>RestApi</a>
          * callable over the internet.</p>
@@ -545,6 +609,28 @@ namespace Model
          */
         virtual void CreateDeploymentAsync(const Model::CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a <a>Deployment</a> resource, which makes a specified <a>RestApi</a>
+         * callable over the internet.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDeploymentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDeploymentRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDeploymentOutcome>([this, request](const std::function<void(Model::CreateDeploymentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDeploymentAsync(request, [complete](const APIGatewayClient*, const Model::CreateDeploymentRequest&, const Model::CreateDeploymentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDeploymentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new domain name.</p>
          */
@@ -564,6 +650,27 @@ namespace Model
          */
         virtual void CreateDomainNameAsync(const Model::CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new domain name.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDomainNameAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDomainNameRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDomainNameOutcome> CreateDomainNameAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDomainNameOutcome>([this, request](const std::function<void(Model::CreateDomainNameOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDomainNameAsync(request, [complete](const APIGatewayClient*, const Model::CreateDomainNameRequest&, const Model::CreateDomainNameOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDomainNameOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds a new <a>Model</a> resource to an existing <a>RestApi</a> resource.</p>
          */
@@ -583,6 +690,27 @@ namespace Model
          */
         virtual void CreateModelAsync(const Model::CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds a new <a>Model</a> resource to an existing <a>RestApi</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateModelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateModelRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateModelOutcome> CreateModelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateModelOutcome>([this, request](const std::function<void(Model::CreateModelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateModelAsync(request, [complete](const APIGatewayClient*, const Model::CreateModelRequest&, const Model::CreateModelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateModelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a <a>Resource</a> resource.</p>
          */
@@ -602,6 +730,27 @@ namespace Model
          */
         virtual void CreateResourceAsync(const Model::CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a <a>Resource</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateResourceOutcome> CreateResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateResourceOutcome>([this, request](const std::function<void(Model::CreateResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateResourceAsync(request, [complete](const APIGatewayClient*, const Model::CreateResourceRequest&, const Model::CreateResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new <a>RestApi</a> resource.</p>
          */
@@ -621,6 +770,27 @@ namespace Model
          */
         virtual void CreateRestApiAsync(const Model::CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new <a>RestApi</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateRestApiAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateRestApiRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateRestApiOutcome> CreateRestApiAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateRestApiOutcome>([this, request](const std::function<void(Model::CreateRestApiOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateRestApiAsync(request, [complete](const APIGatewayClient*, const Model::CreateRestApiRequest&, const Model::CreateRestApiOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateRestApiOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new <a>Stage</a> resource that references a pre-existing
          * <a>Deployment</a> for the API. </p>
@@ -643,6 +813,28 @@ namespace Model
          */
         virtual void CreateStageAsync(const Model::CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new <a>Stage</a> resource that references a pre-existing
+         * <a>Deployment</a> for the API. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateStageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateStageRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateStageOutcome> CreateStageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateStageOutcome>([this, request](const std::function<void(Model::CreateStageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateStageAsync(request, [complete](const APIGatewayClient*, const Model::CreateStageRequest&, const Model::CreateStageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateStageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the <a>ApiKey</a> resource.</p>
          */
@@ -662,6 +854,27 @@ namespace Model
          */
         virtual void DeleteApiKeyAsync(const Model::DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the <a>ApiKey</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteApiKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteApiKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteApiKeyOutcome> DeleteApiKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteApiKeyOutcome>([this, request](const std::function<void(Model::DeleteApiKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteApiKeyAsync(request, [complete](const APIGatewayClient*, const Model::DeleteApiKeyRequest&, const Model::DeleteApiKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteApiKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an existing <a>Authorizer</a> resource.</p>
          */
@@ -681,6 +894,27 @@ namespace Model
          */
         virtual void DeleteAuthorizerAsync(const Model::DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an existing <a>Authorizer</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAuthorizerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAuthorizerRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAuthorizerOutcome> DeleteAuthorizerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAuthorizerOutcome>([this, request](const std::function<void(Model::DeleteAuthorizerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAuthorizerAsync(request, [complete](const APIGatewayClient*, const Model::DeleteAuthorizerRequest&, const Model::DeleteAuthorizerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAuthorizerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the <a>BasePathMapping</a> resource.</p>
          */
@@ -700,6 +934,27 @@ namespace Model
          */
         virtual void DeleteBasePathMappingAsync(const Model::DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the <a>BasePathMapping</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteBasePathMappingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBasePathMappingRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBasePathMappingOutcome> DeleteBasePathMappingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBasePathMappingOutcome>([this, request](const std::function<void(Model::DeleteBasePathMappingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBasePathMappingAsync(request, [complete](const APIGatewayClient*, const Model::DeleteBasePathMappingRequest&, const Model::DeleteBasePathMappingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBasePathMappingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -719,6 +974,27 @@ namespace Model
          */
         virtual void DeleteClientCertificateAsync(const Model::DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way DeleteClientCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteClientCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteClientCertificateOutcome> DeleteClientCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteClientCertificateOutcome>([this, request](const std::function<void(Model::DeleteClientCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteClientCertificateAsync(request, [complete](const APIGatewayClient*, const Model::DeleteClientCertificateRequest&, const Model::DeleteClientCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteClientCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a <a>Deployment</a> resource. Deleting a deployment will only succeed
          * if there are no <a>Stage</a> resources associated with it.</p>
@@ -741,6 +1017,28 @@ namespace Model
          */
         virtual void DeleteDeploymentAsync(const Model::DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a <a>Deployment</a> resource. Deleting a deployment will only succeed
+         * if there are no <a>Stage</a> resources associated with it.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDeploymentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDeploymentRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDeploymentOutcome> DeleteDeploymentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDeploymentOutcome>([this, request](const std::function<void(Model::DeleteDeploymentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDeploymentAsync(request, [complete](const APIGatewayClient*, const Model::DeleteDeploymentRequest&, const Model::DeleteDeploymentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDeploymentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the <a>DomainName</a> resource.</p>
          */
@@ -760,6 +1058,27 @@ namespace Model
          */
         virtual void DeleteDomainNameAsync(const Model::DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the <a>DomainName</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDomainNameAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDomainNameRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDomainNameOutcome> DeleteDomainNameAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDomainNameOutcome>([this, request](const std::function<void(Model::DeleteDomainNameOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDomainNameAsync(request, [complete](const APIGatewayClient*, const Model::DeleteDomainNameRequest&, const Model::DeleteDomainNameOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDomainNameOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents a delete integration.</p>
          */
@@ -779,6 +1098,27 @@ namespace Model
          */
         virtual void DeleteIntegrationAsync(const Model::DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents a delete integration.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteIntegrationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteIntegrationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteIntegrationOutcome> DeleteIntegrationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteIntegrationOutcome>([this, request](const std::function<void(Model::DeleteIntegrationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteIntegrationAsync(request, [complete](const APIGatewayClient*, const Model::DeleteIntegrationRequest&, const Model::DeleteIntegrationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteIntegrationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents a delete integration response.</p>
          */
@@ -798,6 +1138,27 @@ namespace Model
          */
         virtual void DeleteIntegrationResponseAsync(const Model::DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents a delete integration response.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteIntegrationResponseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteIntegrationResponseRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteIntegrationResponseOutcome> DeleteIntegrationResponseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteIntegrationResponseOutcome>([this, request](const std::function<void(Model::DeleteIntegrationResponseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteIntegrationResponseAsync(request, [complete](const APIGatewayClient*, const Model::DeleteIntegrationResponseRequest&, const Model::DeleteIntegrationResponseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteIntegrationResponseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an existing <a>Method</a> resource.</p>
          */
@@ -817,6 +1178,27 @@ namespace Model
          */
         virtual void DeleteMethodAsync(const Model::DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an existing <a>Method</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteMethodAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteMethodRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteMethodOutcome> DeleteMethodAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteMethodOutcome>([this, request](const std::function<void(Model::DeleteMethodOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteMethodAsync(request, [complete](const APIGatewayClient*, const Model::DeleteMethodRequest&, const Model::DeleteMethodOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteMethodOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an existing <a>MethodResponse</a> resource.</p>
          */
@@ -836,6 +1218,27 @@ namespace Model
          */
         virtual void DeleteMethodResponseAsync(const Model::DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an existing <a>MethodResponse</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteMethodResponseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteMethodResponseRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteMethodResponseOutcome> DeleteMethodResponseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteMethodResponseOutcome>([this, request](const std::function<void(Model::DeleteMethodResponseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteMethodResponseAsync(request, [complete](const APIGatewayClient*, const Model::DeleteMethodResponseRequest&, const Model::DeleteMethodResponseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteMethodResponseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a model.</p>
          */
@@ -855,6 +1258,27 @@ namespace Model
          */
         virtual void DeleteModelAsync(const Model::DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a model.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteModelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteModelRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteModelOutcome> DeleteModelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteModelOutcome>([this, request](const std::function<void(Model::DeleteModelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteModelAsync(request, [complete](const APIGatewayClient*, const Model::DeleteModelRequest&, const Model::DeleteModelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteModelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a <a>Resource</a> resource.</p>
          */
@@ -874,6 +1298,27 @@ namespace Model
          */
         virtual void DeleteResourceAsync(const Model::DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a <a>Resource</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteResourceOutcome> DeleteResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteResourceOutcome>([this, request](const std::function<void(Model::DeleteResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteResourceAsync(request, [complete](const APIGatewayClient*, const Model::DeleteResourceRequest&, const Model::DeleteResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified API.</p>
          */
@@ -893,6 +1338,27 @@ namespace Model
          */
         virtual void DeleteRestApiAsync(const Model::DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified API.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRestApiAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRestApiRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRestApiOutcome> DeleteRestApiAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRestApiOutcome>([this, request](const std::function<void(Model::DeleteRestApiOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRestApiAsync(request, [complete](const APIGatewayClient*, const Model::DeleteRestApiRequest&, const Model::DeleteRestApiOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRestApiOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a <a>Stage</a> resource.</p>
          */
@@ -912,6 +1378,27 @@ namespace Model
          */
         virtual void DeleteStageAsync(const Model::DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a <a>Stage</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteStageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteStageRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteStageOutcome> DeleteStageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteStageOutcome>([this, request](const std::function<void(Model::DeleteStageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteStageAsync(request, [complete](const APIGatewayClient*, const Model::DeleteStageRequest&, const Model::DeleteStageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteStageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Flushes all authorizer cache entries on a stage.</p>
          */
@@ -931,6 +1418,27 @@ namespace Model
          */
         virtual void FlushStageAuthorizersCacheAsync(const Model::FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Flushes all authorizer cache entries on a stage.</p>
+         *
+         * Returns an awaitable that starts the operation the way FlushStageAuthorizersCacheAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::FlushStageAuthorizersCacheRequest>
+        Aws::Utils::Threading::Awaitable<Model::FlushStageAuthorizersCacheOutcome> FlushStageAuthorizersCacheAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::FlushStageAuthorizersCacheOutcome>([this, request](const std::function<void(Model::FlushStageAuthorizersCacheOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->FlushStageAuthorizersCacheAsync(request, [complete](const APIGatewayClient*, const Model::FlushStageAuthorizersCacheRequest&, const Model::FlushStageAuthorizersCacheOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::FlushStageAuthorizersCacheOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Flushes a stage's cache.</p>
          */
@@ -950,6 +1458,27 @@ namespace Model
          */
         virtual void FlushStageCacheAsync(const Model::FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Flushes a stage's cache.</p>
+         *
+         * Returns an awaitable that starts the operation the way FlushStageCacheAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::FlushStageCacheRequest>
+        Aws::Utils::Threading::Awaitable<Model::FlushStageCacheOutcome> FlushStageCacheAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::FlushStageCacheOutcome>([this, request](const std::function<void(Model::FlushStageCacheOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->FlushStageCacheAsync(request, [complete](const APIGatewayClient*, const Model::FlushStageCacheRequest&, const Model::FlushStageCacheOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::FlushStageCacheOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -969,6 +1498,27 @@ namespace Model
          */
         virtual void GenerateClientCertificateAsync(const Model::GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way GenerateClientCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GenerateClientCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::GenerateClientCertificateOutcome> GenerateClientCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GenerateClientCertificateOutcome>([this, request](const std::function<void(Model::GenerateClientCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GenerateClientCertificateAsync(request, [complete](const APIGatewayClient*, const Model::GenerateClientCertificateRequest&, const Model::GenerateClientCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GenerateClientCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the current <a>Account</a> resource.</p>
          */
@@ -988,6 +1538,27 @@ namespace Model
          */
         virtual void GetAccountAsync(const Model::GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the current <a>Account</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetAccountAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAccountRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAccountOutcome> GetAccountAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAccountOutcome>([this, request](const std::function<void(Model::GetAccountOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAccountAsync(request, [complete](const APIGatewayClient*, const Model::GetAccountRequest&, const Model::GetAccountOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAccountOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the current <a>ApiKey</a> resource.</p>
          */
@@ -1007,6 +1578,27 @@ namespace Model
          */
         virtual void GetApiKeyAsync(const Model::GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the current <a>ApiKey</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetApiKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetApiKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetApiKeyOutcome> GetApiKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetApiKeyOutcome>([this, request](const std::function<void(Model::GetApiKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetApiKeyAsync(request, [complete](const APIGatewayClient*, const Model::GetApiKeyRequest&, const Model::GetApiKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetApiKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the current <a>ApiKeys</a> resource.</p>
          */
@@ -1026,6 +1618,27 @@ namespace Model
          */
         virtual void GetApiKeysAsync(const Model::GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the current <a>ApiKeys</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetApiKeysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetApiKeysRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetApiKeysOutcome> GetApiKeysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetApiKeysOutcome>([this, request](const std::function<void(Model::GetApiKeysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetApiKeysAsync(request, [complete](const APIGatewayClient*, const Model::GetApiKeysRequest&, const Model::GetApiKeysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetApiKeysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describe an existing <a>Authorizer</a> resource.</p>
          */
@@ -1045,6 +1658,27 @@ namespace Model
          */
         virtual void GetAuthorizerAsync(const Model::GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describe an existing <a>Authorizer</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetAuthorizerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAuthorizerRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAuthorizerOutcome> GetAuthorizerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAuthorizerOutcome>([this, request](const std::function<void(Model::GetAuthorizerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAuthorizerAsync(request, [complete](const APIGatewayClient*, const Model::GetAuthorizerRequest&, const Model::GetAuthorizerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAuthorizerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describe an existing <a>Authorizers</a> resource.</p>
          */
@@ -1064,6 +1698,27 @@ namespace Model
          */
         virtual void GetAuthorizersAsync(const Model::GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describe an existing <a>Authorizers</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetAuthorizersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAuthorizersRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAuthorizersOutcome> GetAuthorizersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAuthorizersOutcome>([this, request](const std::function<void(Model::GetAuthorizersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAuthorizersAsync(request, [complete](const APIGatewayClient*, const Model::GetAuthorizersRequest&, const Model::GetAuthorizersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAuthorizersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describe a <a>BasePathMapping</a> resource.</p>
          */
@@ -1083,6 +1738,27 @@ namespace Model
          */
         virtual void GetBasePathMappingAsync(const Model::GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describe a <a>BasePathMapping</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetBasePathMappingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBasePathMappingRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBasePathMappingOutcome> GetBasePathMappingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBasePathMappingOutcome>([this, request](const std::function<void(Model::GetBasePathMappingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBasePathMappingAsync(request, [complete](const APIGatewayClient*, const Model::GetBasePathMappingRequest&, const Model::GetBasePathMappingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBasePathMappingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents a collection of <a>BasePathMapping</a> resources.</p>
          */
@@ -1102,6 +1778,27 @@ namespace Model
          */
         virtual void GetBasePathMappingsAsync(const Model::GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents a collection of <a>BasePathMapping</a> resources.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetBasePathMappingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBasePathMappingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBasePathMappingsOutcome> GetBasePathMappingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBasePathMappingsOutcome>([this, request](const std::function<void(Model::GetBasePathMappingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBasePathMappingsAsync(request, [complete](const APIGatewayClient*, const Model::GetBasePathMappingsRequest&, const Model::GetBasePathMappingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBasePathMappingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -1121,6 +1818,27 @@ namespace Model
          */
         virtual void GetClientCertificateAsync(const Model::GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way GetClientCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetClientCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetClientCertificateOutcome> GetClientCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetClientCertificateOutcome>([this, request](const std::function<void(Model::GetClientCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetClientCertificateAsync(request, [complete](const APIGatewayClient*, const Model::GetClientCertificateRequest&, const Model::GetClientCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetClientCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -1140,6 +1858,27 @@ namespace Model
          */
         virtual void GetClientCertificatesAsync(const Model::GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way GetClientCertificatesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetClientCertificatesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetClientCertificatesOutcome> GetClientCertificatesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetClientCertificatesOutcome>([this, request](const std::function<void(Model::GetClientCertificatesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetClientCertificatesAsync(request, [complete](const APIGatewayClient*, const Model::GetClientCertificatesRequest&, const Model::GetClientCertificatesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetClientCertificatesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a <a>Deployment</a> resource.</p>
          */
@@ -1159,6 +1898,27 @@ namespace Model
          */
         virtual void GetDeploymentAsync(const Model::GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a <a>Deployment</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDeploymentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDeploymentRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDeploymentOutcome> GetDeploymentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDeploymentOutcome>([this, request](const std::function<void(Model::GetDeploymentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDeploymentAsync(request, [complete](const APIGatewayClient*, const Model::GetDeploymentRequest&, const Model::GetDeploymentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDeploymentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a <a>Deployments</a> collection.</p>
          */
@@ -1178,6 +1938,27 @@ namespace Model
          */
         virtual void GetDeploymentsAsync(const Model::GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a <a>Deployments</a> collection.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDeploymentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDeploymentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDeploymentsOutcome> GetDeploymentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDeploymentsOutcome>([this, request](const std::function<void(Model::GetDeploymentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDeploymentsAsync(request, [complete](const APIGatewayClient*, const Model::GetDeploymentsRequest&, const Model::GetDeploymentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDeploymentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents a domain name that is contained in a simpler, more intuitive URL
          * that can be called.</p>
@@ -1200,6 +1981,28 @@ namespace Model
          */
         virtual void GetDomainNameAsync(const Model::GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents a domain name that is contained in a simpler, more intuitive URL
+         * that can be called.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDomainNameAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDomainNameRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDomainNameOutcome> GetDomainNameAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDomainNameOutcome>([this, request](const std::function<void(Model::GetDomainNameOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDomainNameAsync(request, [complete](const APIGatewayClient*, const Model::GetDomainNameRequest&, const Model::GetDomainNameOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDomainNameOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents a collection of <a>DomainName</a> resources.</p>
          */
@@ -1219,6 +2022,27 @@ namespace Model
          */
         virtual void GetDomainNamesAsync(const Model::GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents a collection of <a>DomainName</a> resources.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDomainNamesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDomainNamesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDomainNamesOutcome> GetDomainNamesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDomainNamesOutcome>([this, request](const std::function<void(Model::GetDomainNamesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDomainNamesAsync(request, [complete](const APIGatewayClient*, const Model::GetDomainNamesRequest&, const Model::GetDomainNamesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDomainNamesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -1238,6 +2062,27 @@ namespace Model
          */
         virtual void GetExportAsync(const Model::GetExportRequest& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way GetExportAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetExportRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetExportOutcome> GetExportAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetExportOutcome>([this, request](const std::function<void(Model::GetExportOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetExportAsync(request, [complete](const APIGatewayClient*, const Model::GetExportRequest&, const Model::GetExportOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetExportOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents a get integration.</p>
          */
@@ -1257,6 +2102,27 @@ namespace Model
          */
         virtual void GetIntegrationAsync(const Model::GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents a get integration.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIntegrationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIntegrationRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIntegrationOutcome> GetIntegrationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIntegrationOutcome>([this, request](const std::function<void(Model::GetIntegrationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIntegrationAsync(request, [complete](const APIGatewayClient*, const Model::GetIntegrationRequest&, const Model::GetIntegrationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIntegrationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents a get integration response.</p>
          */
@@ -1276,6 +2142,27 @@ namespace Model
          */
         virtual void GetIntegrationResponseAsync(const Model::GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents a get integration response.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIntegrationResponseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIntegrationResponseRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIntegrationResponseOutcome> GetIntegrationResponseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIntegrationResponseOutcome>([this, request](const std::function<void(Model::GetIntegrationResponseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIntegrationResponseAsync(request, [complete](const APIGatewayClient*, const Model::GetIntegrationResponseRequest&, const Model::GetIntegrationResponseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIntegrationResponseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describe an existing <a>Method</a> resource.</p>
          */
@@ -1295,6 +2182,27 @@ namespace Model
          */
         virtual void GetMethodAsync(const Model::GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describe an existing <a>Method</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetMethodAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetMethodRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetMethodOutcome> GetMethodAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetMethodOutcome>([this, request](const std::function<void(Model::GetMethodOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetMethodAsync(request, [complete](const APIGatewayClient*, const Model::GetMethodRequest&, const Model::GetMethodOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetMethodOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes a <a>MethodResponse</a> resource.</p>
          */
@@ -1314,6 +2222,27 @@ namespace Model
          */
         virtual void GetMethodResponseAsync(const Model::GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes a <a>MethodResponse</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetMethodResponseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetMethodResponseRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetMethodResponseOutcome> GetMethodResponseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetMethodResponseOutcome>([this, request](const std::function<void(Model::GetMethodResponseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetMethodResponseAsync(request, [complete](const APIGatewayClient*, const Model::GetMethodResponseRequest&, const Model::GetMethodResponseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetMethodResponseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes an existing model defined for a <a>RestApi</a> resource.</p>
          */
@@ -1333,6 +2262,27 @@ namespace Model
          */
         virtual void GetModelAsync(const Model::GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes an existing model defined for a <a>RestApi</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetModelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetModelRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetModelOutcome> GetModelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetModelOutcome>([this, request](const std::function<void(Model::GetModelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetModelAsync(request, [complete](const APIGatewayClient*, const Model::GetModelRequest&, const Model::GetModelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetModelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Generates a sample mapping template that can be used to transform a payload
          * into the structure of a model.</p>
@@ -1355,6 +2305,28 @@ namespace Model
          */
         virtual void GetModelTemplateAsync(const Model::GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Generates a sample mapping template that can be used to transform a payload
+         * into the structure of a model.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetModelTemplateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetModelTemplateRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetModelTemplateOutcome> GetModelTemplateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetModelTemplateOutcome>([this, request](const std::function<void(Model::GetModelTemplateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetModelTemplateAsync(request, [complete](const APIGatewayClient*, const Model::GetModelTemplateRequest&, const Model::GetModelTemplateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetModelTemplateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes existing <a>Models</a> defined for a <a>RestApi</a> resource.</p>
          */
@@ -1374,6 +2346,27 @@ namespace Model
          */
         virtual void GetModelsAsync(const Model::GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes existing <a>Models</a> defined for a <a>RestApi</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetModelsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetModelsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetModelsOutcome> GetModelsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetModelsOutcome>([this, request](const std::function<void(Model::GetModelsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetModelsAsync(request, [complete](const APIGatewayClient*, const Model::GetModelsRequest&, const Model::GetModelsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetModelsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists information about a resource.</p>
          */
@@ -1393,6 +2386,27 @@ namespace Model
          */
         virtual void GetResourceAsync(const Model::GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists information about a resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetResourceOutcome> GetResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetResourceOutcome>([this, request](const std::function<void(Model::GetResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetResourceAsync(request, [complete](const APIGatewayClient*, const Model::GetResourceRequest&, const Model::GetResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists information about a collection of <a>Resource</a> resources.</p>
          */
@@ -1412,6 +2426,27 @@ namespace Model
          */
         virtual void GetResourcesAsync(const Model::GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists information about a collection of <a>Resource</a> resources.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetResourcesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetResourcesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetResourcesOutcome> GetResourcesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetResourcesOutcome>([this, request](const std::function<void(Model::GetResourcesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetResourcesAsync(request, [complete](const APIGatewayClient*, const Model::GetResourcesRequest&, const Model::GetResourcesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetResourcesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the <a>RestApi</a> resource in the collection.</p>
          */
@@ -1431,6 +2466,27 @@ namespace Model
          */
         virtual void GetRestApiAsync(const Model::GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the <a>RestApi</a> resource in the collection.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetRestApiAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetRestApiRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetRestApiOutcome> GetRestApiAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetRestApiOutcome>([this, request](const std::function<void(Model::GetRestApiOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetRestApiAsync(request, [complete](const APIGatewayClient*, const Model::GetRestApiRequest&, const Model::GetRestApiOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetRestApiOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the <a>RestApis</a> resources for your collection.</p>
          */
@@ -1450,6 +2506,27 @@ namespace Model
          */
         virtual void GetRestApisAsync(const Model::GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the <a>RestApis</a> resources for your collection.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetRestApisAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetRestApisRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetRestApisOutcome> GetRestApisAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetRestApisOutcome>([this, request](const std::function<void(Model::GetRestApisOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetRestApisAsync(request, [complete](const APIGatewayClient*, const Model::GetRestApisRequest&, const Model::GetRestApisOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetRestApisOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -1469,6 +2546,27 @@ namespace Model
          */
         virtual void GetSdkAsync(const Model::GetSdkRequest& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way GetSdkAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetSdkRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetSdkOutcome> GetSdkAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetSdkOutcome>([this, request](const std::function<void(Model::GetSdkOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetSdkAsync(request, [complete](const APIGatewayClient*, const Model::GetSdkRequest&, const Model::GetSdkOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetSdkOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a <a>Stage</a> resource.</p>
          */
@@ -1488,6 +2586,27 @@ namespace Model
          */
         virtual void GetStageAsync(const Model::GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a <a>Stage</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetStageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetStageRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetStageOutcome> GetStageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetStageOutcome>([this, request](const std::function<void(Model::GetStageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetStageAsync(request, [complete](const APIGatewayClient*, const Model::GetStageRequest&, const Model::GetStageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetStageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about one or more <a>Stage</a> resources.</p>
          */
@@ -1507,6 +2626,27 @@ namespace Model
          */
         virtual void GetStagesAsync(const Model::GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about one or more <a>Stage</a> resources.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetStagesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetStagesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetStagesOutcome> GetStagesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetStagesOutcome>([this, request](const std::function<void(Model::GetStagesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetStagesAsync(request, [complete](const APIGatewayClient*, const Model::GetStagesRequest&, const Model::GetStagesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetStagesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents a put integration.</p>
          */
@@ -1526,6 +2666,27 @@ namespace Model
          */
         virtual void PutIntegrationAsync(const Model::PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents a put integration.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutIntegrationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutIntegrationRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutIntegrationOutcome> PutIntegrationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutIntegrationOutcome>([this, request](const std::function<void(Model::PutIntegrationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutIntegrationAsync(request, [complete](const APIGatewayClient*, const Model::PutIntegrationRequest&, const Model::PutIntegrationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutIntegrationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents a put integration.</p>
          */
@@ -1545,6 +2706,27 @@ namespace Model
          */
         virtual void PutIntegrationResponseAsync(const Model::PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents a put integration.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutIntegrationResponseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutIntegrationResponseRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutIntegrationResponseOutcome> PutIntegrationResponseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutIntegrationResponseOutcome>([this, request](const std::function<void(Model::PutIntegrationResponseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutIntegrationResponseAsync(request, [complete](const APIGatewayClient*, const Model::PutIntegrationResponseRequest&, const Model::PutIntegrationResponseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutIntegrationResponseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Add a method to an existing <a>Resource</a> resource.</p>
          */
@@ -1564,6 +2746,27 @@ namespace Model
          */
         virtual void PutMethodAsync(const Model::PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Add a method to an existing <a>Resource</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutMethodAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutMethodRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutMethodOutcome> PutMethodAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutMethodOutcome>([this, request](const std::function<void(Model::PutMethodOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutMethodAsync(request, [complete](const APIGatewayClient*, const Model::PutMethodRequest&, const Model::PutMethodOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutMethodOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds a <a>MethodResponse</a> to an existing <a>Method</a> resource.</p>
          */
@@ -1583,6 +2786,27 @@ namespace Model
          */
         virtual void PutMethodResponseAsync(const Model::PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds a <a>MethodResponse</a> to an existing <a>Method</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutMethodResponseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutMethodResponseRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutMethodResponseOutcome> PutMethodResponseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutMethodResponseOutcome>([this, request](const std::function<void(Model::PutMethodResponseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutMethodResponseAsync(request, [complete](const APIGatewayClient*, const Model::PutMethodResponseRequest&, const Model::PutMethodResponseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutMethodResponseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -1602,6 +2826,27 @@ namespace Model
          */
         virtual void TestInvokeAuthorizerAsync(const Model::TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way TestInvokeAuthorizerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TestInvokeAuthorizerRequest>
+        Aws::Utils::Threading::Awaitable<Model::TestInvokeAuthorizerOutcome> TestInvokeAuthorizerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TestInvokeAuthorizerOutcome>([this, request](const std::function<void(Model::TestInvokeAuthorizerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TestInvokeAuthorizerAsync(request, [complete](const APIGatewayClient*, const Model::TestInvokeAuthorizerRequest&, const Model::TestInvokeAuthorizerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TestInvokeAuthorizerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -1621,6 +2866,27 @@ namespace Model
          */
         virtual void TestInvokeMethodAsync(const Model::TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way TestInvokeMethodAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TestInvokeMethodRequest>
+        Aws::Utils::Threading::Awaitable<Model::TestInvokeMethodOutcome> TestInvokeMethodAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TestInvokeMethodOutcome>([this, request](const std::function<void(Model::TestInvokeMethodOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TestInvokeMethodAsync(request, [complete](const APIGatewayClient*, const Model::TestInvokeMethodRequest&, const Model::TestInvokeMethodOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TestInvokeMethodOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes information about the current <a>Account</a> resource.</p>
          */
@@ -1640,6 +2906,27 @@ namespace Model
          */
         virtual void UpdateAccountAsync(const Model::UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes information about the current <a>Account</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAccountAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAccountRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAccountOutcome> UpdateAccountAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAccountOutcome>([this, request](const std::function<void(Model::UpdateAccountOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAccountAsync(request, [complete](const APIGatewayClient*, const Model::UpdateAccountRequest&, const Model::UpdateAccountOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAccountOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes information about an <a>ApiKey</a> resource.</p>
          */
@@ -1659,6 +2946,27 @@ namespace Model
          */
         virtual void UpdateApiKeyAsync(const Model::UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes information about an <a>ApiKey</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateApiKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateApiKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateApiKeyOutcome> UpdateApiKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateApiKeyOutcome>([this, request](const std::function<void(Model::UpdateApiKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateApiKeyAsync(request, [complete](const APIGatewayClient*, const Model::UpdateApiKeyRequest&, const Model::UpdateApiKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateApiKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates an existing <a>Authorizer</a> resource.</p>
          */
@@ -1678,6 +2986,27 @@ namespace Model
          */
         virtual void UpdateAuthorizerAsync(const Model::UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates an existing <a>Authorizer</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAuthorizerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAuthorizerRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAuthorizerOutcome> UpdateAuthorizerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAuthorizerOutcome>([this, request](const std::function<void(Model::UpdateAuthorizerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAuthorizerAsync(request, [complete](const APIGatewayClient*, const Model::UpdateAuthorizerRequest&, const Model::UpdateAuthorizerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAuthorizerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes information about the <a>BasePathMapping</a> resource.</p>
          */
@@ -1697,6 +3026,27 @@ namespace Model
          */
         virtual void UpdateBasePathMappingAsync(const Model::UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes information about the <a>BasePathMapping</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateBasePathMappingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateBasePathMappingRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateBasePathMappingOutcome> UpdateBasePathMappingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateBasePathMappingOutcome>([this, request](const std::function<void(Model::UpdateBasePathMappingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateBasePathMappingAsync(request, [complete](const APIGatewayClient*, const Model::UpdateBasePathMappingRequest&, const Model::UpdateBasePathMappingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateBasePathMappingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -1716,6 +3066,27 @@ namespace Model
          */
         virtual void UpdateClientCertificateAsync(const Model::UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way UpdateClientCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateClientCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateClientCertificateOutcome> UpdateClientCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateClientCertificateOutcome>([this, request](const std::function<void(Model::UpdateClientCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateClientCertificateAsync(request, [complete](const APIGatewayClient*, const Model::UpdateClientCertificateRequest&, const Model::UpdateClientCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateClientCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes information about a <a>Deployment</a> resource.</p>
          */
@@ -1735,6 +3106,27 @@ namespace Model
          */
         virtual void UpdateDeploymentAsync(const Model::UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes information about a <a>Deployment</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateDeploymentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDeploymentRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDeploymentOutcome> UpdateDeploymentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDeploymentOutcome>([this, request](const std::function<void(Model::UpdateDeploymentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDeploymentAsync(request, [complete](const APIGatewayClient*, const Model::UpdateDeploymentRequest&, const Model::UpdateDeploymentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDeploymentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes information about the <a>DomainName</a> resource.</p>
          */
@@ -1754,6 +3146,27 @@ namespace Model
          */
         virtual void UpdateDomainNameAsync(const Model::UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes information about the <a>DomainName</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateDomainNameAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDomainNameRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDomainNameOutcome> UpdateDomainNameAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDomainNameOutcome>([this, request](const std::function<void(Model::UpdateDomainNameOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDomainNameAsync(request, [complete](const APIGatewayClient*, const Model::UpdateDomainNameRequest&, const Model::UpdateDomainNameOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDomainNameOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents an update integration.</p>
          */
@@ -1773,6 +3186,27 @@ namespace Model
          */
         virtual void UpdateIntegrationAsync(const Model::UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents an update integration.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateIntegrationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateIntegrationRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateIntegrationOutcome> UpdateIntegrationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateIntegrationOutcome>([this, request](const std::function<void(Model::UpdateIntegrationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateIntegrationAsync(request, [complete](const APIGatewayClient*, const Model::UpdateIntegrationRequest&, const Model::UpdateIntegrationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateIntegrationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents an update integration response.</p>
          */
@@ -1792,6 +3226,27 @@ namespace Model
          */
         virtual void UpdateIntegrationResponseAsync(const Model::UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents an update integration response.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateIntegrationResponseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateIntegrationResponseRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateIntegrationResponseOutcome> UpdateIntegrationResponseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateIntegrationResponseOutcome>([this, request](const std::function<void(Model::UpdateIntegrationResponseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateIntegrationResponseAsync(request, [complete](const APIGatewayClient*, const Model::UpdateIntegrationResponseRequest&, const Model::UpdateIntegrationResponseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateIntegrationResponseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates an existing <a>Method</a> resource.</p>
          */
@@ -1811,6 +3266,27 @@ namespace Model
          */
         virtual void UpdateMethodAsync(const Model::UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates an existing <a>Method</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateMethodAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateMethodRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateMethodOutcome> UpdateMethodAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateMethodOutcome>([this, request](const std::function<void(Model::UpdateMethodOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateMethodAsync(request, [complete](const APIGatewayClient*, const Model::UpdateMethodRequest&, const Model::UpdateMethodOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateMethodOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates an existing <a>MethodResponse</a> resource.</p>
          */
@@ -1830,6 +3306,27 @@ namespace Model
          */
         virtual void UpdateMethodResponseAsync(const Model::UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates an existing <a>MethodResponse</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateMethodResponseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateMethodResponseRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateMethodResponseOutcome> UpdateMethodResponseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateMethodResponseOutcome>([this, request](const std::function<void(Model::UpdateMethodResponseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateMethodResponseAsync(request, [complete](const APIGatewayClient*, const Model::UpdateMethodResponseRequest&, const Model::UpdateMethodResponseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateMethodResponseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes information about a model.</p>
          */
@@ -1849,6 +3346,27 @@ namespace Model
          */
         virtual void UpdateModelAsync(const Model::UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes information about a model.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateModelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateModelRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateModelOutcome> UpdateModelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateModelOutcome>([this, request](const std::function<void(Model::UpdateModelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateModelAsync(request, [complete](const APIGatewayClient*, const Model::UpdateModelRequest&, const Model::UpdateModelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateModelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes information about a <a>Resource</a> resource.</p>
          */
@@ -1868,6 +3386,27 @@ namespace Model
          */
         virtual void UpdateResourceAsync(const Model::UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes information about a <a>Resource</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateResourceOutcome> UpdateResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateResourceOutcome>([this, request](const std::function<void(Model::UpdateResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateResourceAsync(request, [complete](const APIGatewayClient*, const Model::UpdateResourceRequest&, const Model::UpdateResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes information about the specified API.</p>
          */
@@ -1887,6 +3426,27 @@ namespace Model
          */
         virtual void UpdateRestApiAsync(const Model::UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes information about the specified API.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateRestApiAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateRestApiRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateRestApiOutcome> UpdateRestApiAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateRestApiOutcome>([this, request](const std::function<void(Model::UpdateRestApiOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateRestApiAsync(request, [complete](const APIGatewayClient*, const Model::UpdateRestApiRequest&, const Model::UpdateRestApiOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateRestApiOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes information about a <a>Stage</a> resource.</p>
          */
@@ -1906,6 +3466,27 @@ namespace Model
          */
         virtual void UpdateStageAsync(const Model::UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes information about a <a>Stage</a> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateStageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateStageRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateStageOutcome> UpdateStageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateStageOutcome>([this, request](const std::function<void(Model::UpdateStageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateStageAsync(request, [complete](const APIGatewayClient*, const Model::UpdateStageRequest&, const Model::UpdateStageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateStageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -169,7 +169,7 @@ CreateApiKeyOutcome APIGatewayClient::CreateApiKey(const CreateApiKeyRequest& re
   Aws::StringStream ss;
   ss << m_uri << "/apikeys";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateApiKey");
   if(outcome.IsSuccess())
   {
     return CreateApiKeyOutcome(CreateApiKeyResult(outcome.GetResult()));
@@ -182,17 +182,42 @@ CreateApiKeyOutcome APIGatewayClient::CreateApiKey(const CreateApiKeyRequest& re
 
 CreateApiKeyOutcomeCallable APIGatewayClient::CreateApiKeyCallable(const CreateApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateApiKey, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateApiKeyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateApiKey( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateApiKeyOutcome > rejected;
+    rejected.set_value(CreateApiKeyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateApiKeyAsync(const CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateApiKeyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::CreateApiKeyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateApiKeyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::CreateApiKeyAsyncHelper(const CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateApiKey(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/apikeys";
+
+  auto sharedRequest = Aws::MakeShared<CreateApiKeyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateApiKey", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateApiKeyOutcome(CreateApiKeyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateApiKeyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateAuthorizerOutcome APIGatewayClient::CreateAuthorizer(const CreateAuthorizerRequest& request) const
@@ -202,7 +227,7 @@ CreateAuthorizerOutcome APIGatewayClient::CreateAuthorizer(const CreateAuthorize
   ss << request.GetRestApiId();
   ss << "/authorizers";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateAuthorizer");
   if(outcome.IsSuccess())
   {
     return CreateAuthorizerOutcome(CreateAuthorizerResult(outcome.GetResult()));
@@ -215,17 +240,44 @@ CreateAuthorizerOutcome APIGatewayClient::CreateAuthorizer(const CreateAuthorize
 
 CreateAuthorizerOutcomeCallable APIGatewayClient::CreateAuthorizerCallable(const CreateAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateAuthorizer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateAuthorizerOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateAuthorizer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateAuthorizerOutcome > rejected;
+    rejected.set_value(CreateAuthorizerOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateAuthorizerAsync(const CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateAuthorizerAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::CreateAuthorizerAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateAuthorizerOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::CreateAuthorizerAsyncHelper(const CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateAuthorizer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers";
+
+  auto sharedRequest = Aws::MakeShared<CreateAuthorizerRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateAuthorizer", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateAuthorizerOutcome(CreateAuthorizerResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateAuthorizerOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateBasePathMappingOutcome APIGatewayClient::CreateBasePathMapping(const CreateBasePathMappingRequest& request) const
@@ -235,7 +287,7 @@ CreateBasePathMappingOutcome APIGatewayClient::CreateBasePathMapping(const Creat
   ss << request.GetDomainName();
   ss << "/basepathmappings";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateBasePathMapping");
   if(outcome.IsSuccess())
   {
     return CreateBasePathMappingOutcome(CreateBasePathMappingResult(outcome.GetResult()));
@@ -248,17 +300,44 @@ CreateBasePathMappingOutcome APIGatewayClient::CreateBasePathMapping(const Creat
 
 CreateBasePathMappingOutcomeCallable APIGatewayClient::CreateBasePathMappingCallable(const CreateBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateBasePathMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateBasePathMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateBasePathMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateBasePathMappingOutcome > rejected;
+    rejected.set_value(CreateBasePathMappingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateBasePathMappingAsync(const CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateBasePathMappingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::CreateBasePathMappingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateBasePathMappingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::CreateBasePathMappingAsyncHelper(const CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateBasePathMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  ss << "/basepathmappings";
+
+  auto sharedRequest = Aws::MakeShared<CreateBasePathMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateBasePathMapping", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateBasePathMappingOutcome(CreateBasePathMappingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateBasePathMappingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateDeploymentOutcome APIGatewayClient::CreateDeployment(const CreateDeploymentRequest& request) const
@@ -268,7 +347,7 @@ CreateDeploymentOutcome APIGatewayClient::CreateDeployment(const CreateDeploymen
   ss << request.GetRestApiId();
   ss << "/deployments";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateDeployment");
   if(outcome.IsSuccess())
   {
     return CreateDeploymentOutcome(CreateDeploymentResult(outcome.GetResult()));
@@ -281,17 +360,44 @@ CreateDeploymentOutcome APIGatewayClient::CreateDeployment(const CreateDeploymen
 
 CreateDeploymentOutcomeCallable APIGatewayClient::CreateDeploymentCallable(const CreateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateDeployment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateDeploymentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDeployment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateDeploymentOutcome > rejected;
+    rejected.set_value(CreateDeploymentOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateDeploymentAsync(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateDeploymentAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::CreateDeploymentAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateDeploymentOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::CreateDeploymentAsyncHelper(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateDeployment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/deployments";
+
+  auto sharedRequest = Aws::MakeShared<CreateDeploymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateDeployment", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateDeploymentOutcome(CreateDeploymentResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateDeploymentOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateDomainNameOutcome APIGatewayClient::CreateDomainName(const CreateDomainNameRequest& request) const
@@ -299,7 +405,7 @@ CreateDomainNameOutcome APIGatewayClient::CreateDomainName(const CreateDomainNam
   Aws::StringStream ss;
   ss << m_uri << "/domainnames";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateDomainName");
   if(outcome.IsSuccess())
   {
     return CreateDomainNameOutcome(CreateDomainNameResult(outcome.GetResult()));
@@ -312,17 +418,42 @@ CreateDomainNameOutcome APIGatewayClient::CreateDomainName(const CreateDomainNam
 
 CreateDomainNameOutcomeCallable APIGatewayClient::CreateDomainNameCallable(const CreateDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateDomainName, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateDomainNameOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDomainName( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateDomainNameOutcome > rejected;
+    rejected.set_value(CreateDomainNameOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateDomainNameAsync(const CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateDomainNameAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::CreateDomainNameAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateDomainNameOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::CreateDomainNameAsyncHelper(const CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateDomainName(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames";
+
+  auto sharedRequest = Aws::MakeShared<CreateDomainNameRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateDomainName", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateDomainNameOutcome(CreateDomainNameResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateDomainNameOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateModelOutcome APIGatewayClient::CreateModel(const CreateModelRequest& request) const
@@ -332,7 +463,7 @@ CreateModelOutcome APIGatewayClient::CreateModel(const CreateModelRequest& reque
   ss << request.GetRestApiId();
   ss << "/models";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateModel");
   if(outcome.IsSuccess())
   {
     return CreateModelOutcome(CreateModelResult(outcome.GetResult()));
@@ -345,17 +476,44 @@ CreateModelOutcome APIGatewayClient::CreateModel(const CreateModelRequest& reque
 
 CreateModelOutcomeCallable APIGatewayClient::CreateModelCallable(const CreateModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateModel, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateModelOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateModel( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateModelOutcome > rejected;
+    rejected.set_value(CreateModelOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateModelAsync(const CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateModelAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::CreateModelAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateModelOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::CreateModelAsyncHelper(const CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateModel(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models";
+
+  auto sharedRequest = Aws::MakeShared<CreateModelRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateModel", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateModelOutcome(CreateModelResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateModelOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateResourceOutcome APIGatewayClient::CreateResource(const CreateResourceRequest& request) const
@@ -366,7 +524,7 @@ CreateResourceOutcome APIGatewayClient::CreateResource(const CreateResourceReque
   ss << "/resources/";
   ss << request.GetParentId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateResource");
   if(outcome.IsSuccess())
   {
     return CreateResourceOutcome(CreateResourceResult(outcome.GetResult()));
@@ -379,17 +537,45 @@ CreateResourceOutcome APIGatewayClient::CreateResource(const CreateResourceReque
 
 CreateResourceOutcomeCallable APIGatewayClient::CreateResourceCallable(const CreateResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateResourceOutcome > rejected;
+    rejected.set_value(CreateResourceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateResourceAsync(const CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateResourceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::CreateResourceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateResourceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::CreateResourceAsyncHelper(const CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetParentId();
+
+  auto sharedRequest = Aws::MakeShared<CreateResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateResource", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateResourceOutcome(CreateResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateResourceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateRestApiOutcome APIGatewayClient::CreateRestApi(const CreateRestApiRequest& request) const
@@ -397,7 +583,7 @@ CreateRestApiOutcome APIGatewayClient::CreateRestApi(const CreateRestApiRequest&
   Aws::StringStream ss;
   ss << m_uri << "/restapis";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateRestApi");
   if(outcome.IsSuccess())
   {
     return CreateRestApiOutcome(CreateRestApiResult(outcome.GetResult()));
@@ -410,17 +596,42 @@ CreateRestApiOutcome APIGatewayClient::CreateRestApi(const CreateRestApiRequest&
 
 CreateRestApiOutcomeCallable APIGatewayClient::CreateRestApiCallable(const CreateRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateRestApi, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateRestApiOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateRestApi( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateRestApiOutcome > rejected;
+    rejected.set_value(CreateRestApiOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateRestApiAsync(const CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateRestApiAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::CreateRestApiAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateRestApiOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::CreateRestApiAsyncHelper(const CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateRestApi(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis";
+
+  auto sharedRequest = Aws::MakeShared<CreateRestApiRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateRestApi", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateRestApiOutcome(CreateRestApiResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateRestApiOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateStageOutcome APIGatewayClient::CreateStage(const CreateStageRequest& request) const
@@ -430,7 +641,7 @@ CreateStageOutcome APIGatewayClient::CreateStage(const CreateStageRequest& reque
   ss << request.GetRestApiId();
   ss << "/stages";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateStage");
   if(outcome.IsSuccess())
   {
     return CreateStageOutcome(CreateStageResult(outcome.GetResult()));
@@ -443,17 +654,44 @@ CreateStageOutcome APIGatewayClient::CreateStage(const CreateStageRequest& reque
 
 CreateStageOutcomeCallable APIGatewayClient::CreateStageCallable(const CreateStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateStage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateStageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateStage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateStageOutcome > rejected;
+    rejected.set_value(CreateStageOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::CreateStageAsync(const CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateStageAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::CreateStageAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateStageOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::CreateStageAsyncHelper(const CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateStage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages";
+
+  auto sharedRequest = Aws::MakeShared<CreateStageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateStage", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateStageOutcome(CreateStageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateStageOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteApiKeyOutcome APIGatewayClient::DeleteApiKey(const DeleteApiKeyRequest& request) const
@@ -462,7 +700,7 @@ DeleteApiKeyOutcome APIGatewayClient::DeleteApiKey(const DeleteApiKeyRequest& re
   ss << m_uri << "/apikeys/";
   ss << request.GetApiKey();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteApiKey");
   if(outcome.IsSuccess())
   {
     return DeleteApiKeyOutcome(NoResult());
@@ -475,17 +713,43 @@ DeleteApiKeyOutcome APIGatewayClient::DeleteApiKey(const DeleteApiKeyRequest& re
 
 DeleteApiKeyOutcomeCallable APIGatewayClient::DeleteApiKeyCallable(const DeleteApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteApiKey, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteApiKeyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteApiKey( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteApiKeyOutcome > rejected;
+    rejected.set_value(DeleteApiKeyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteApiKeyAsync(const DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteApiKeyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteApiKeyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteApiKeyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteApiKeyAsyncHelper(const DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteApiKey(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/apikeys/";
+  ss << request.GetApiKey();
+
+  auto sharedRequest = Aws::MakeShared<DeleteApiKeyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteApiKey", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteApiKeyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteApiKeyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteAuthorizerOutcome APIGatewayClient::DeleteAuthorizer(const DeleteAuthorizerRequest& request) const
@@ -496,7 +760,7 @@ DeleteAuthorizerOutcome APIGatewayClient::DeleteAuthorizer(const DeleteAuthorize
   ss << "/authorizers/";
   ss << request.GetAuthorizerId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteAuthorizer");
   if(outcome.IsSuccess())
   {
     return DeleteAuthorizerOutcome(NoResult());
@@ -509,17 +773,45 @@ DeleteAuthorizerOutcome APIGatewayClient::DeleteAuthorizer(const DeleteAuthorize
 
 DeleteAuthorizerOutcomeCallable APIGatewayClient::DeleteAuthorizerCallable(const DeleteAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteAuthorizer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteAuthorizerOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteAuthorizer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteAuthorizerOutcome > rejected;
+    rejected.set_value(DeleteAuthorizerOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteAuthorizerAsync(const DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteAuthorizerAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteAuthorizerAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteAuthorizerOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteAuthorizerAsyncHelper(const DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteAuthorizer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers/";
+  ss << request.GetAuthorizerId();
+
+  auto sharedRequest = Aws::MakeShared<DeleteAuthorizerRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteAuthorizer", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteAuthorizerOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteAuthorizerOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteBasePathMappingOutcome APIGatewayClient::DeleteBasePathMapping(const DeleteBasePathMappingRequest& request) const
@@ -530,7 +822,7 @@ DeleteBasePathMappingOutcome APIGatewayClient::DeleteBasePathMapping(const Delet
   ss << "/basepathmappings/";
   ss << request.GetBasePath();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteBasePathMapping");
   if(outcome.IsSuccess())
   {
     return DeleteBasePathMappingOutcome(NoResult());
@@ -543,17 +835,45 @@ DeleteBasePathMappingOutcome APIGatewayClient::DeleteBasePathMapping(const Delet
 
 DeleteBasePathMappingOutcomeCallable APIGatewayClient::DeleteBasePathMappingCallable(const DeleteBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteBasePathMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteBasePathMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBasePathMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteBasePathMappingOutcome > rejected;
+    rejected.set_value(DeleteBasePathMappingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteBasePathMappingAsync(const DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteBasePathMappingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteBasePathMappingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteBasePathMappingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteBasePathMappingAsyncHelper(const DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBasePathMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  ss << "/basepathmappings/";
+  ss << request.GetBasePath();
+
+  auto sharedRequest = Aws::MakeShared<DeleteBasePathMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteBasePathMapping", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBasePathMappingOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBasePathMappingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteClientCertificateOutcome APIGatewayClient::DeleteClientCertificate(const DeleteClientCertificateRequest& request) const
@@ -562,7 +882,7 @@ DeleteClientCertificateOutcome APIGatewayClient::DeleteClientCertificate(const D
   ss << m_uri << "/clientcertificates/";
   ss << request.GetClientCertificateId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteClientCertificate");
   if(outcome.IsSuccess())
   {
     return DeleteClientCertificateOutcome(NoResult());
@@ -575,17 +895,43 @@ DeleteClientCertificateOutcome APIGatewayClient::DeleteClientCertificate(const D
 
 DeleteClientCertificateOutcomeCallable APIGatewayClient::DeleteClientCertificateCallable(const DeleteClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteClientCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteClientCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteClientCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteClientCertificateOutcome > rejected;
+    rejected.set_value(DeleteClientCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteClientCertificateAsync(const DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteClientCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteClientCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteClientCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteClientCertificateAsyncHelper(const DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteClientCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/clientcertificates/";
+  ss << request.GetClientCertificateId();
+
+  auto sharedRequest = Aws::MakeShared<DeleteClientCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteClientCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteClientCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteClientCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteDeploymentOutcome APIGatewayClient::DeleteDeployment(const DeleteDeploymentRequest& request) const
@@ -596,7 +942,7 @@ DeleteDeploymentOutcome APIGatewayClient::DeleteDeployment(const DeleteDeploymen
   ss << "/deployments/";
   ss << request.GetDeploymentId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteDeployment");
   if(outcome.IsSuccess())
   {
     return DeleteDeploymentOutcome(NoResult());
@@ -609,17 +955,45 @@ DeleteDeploymentOutcome APIGatewayClient::DeleteDeployment(const DeleteDeploymen
 
 DeleteDeploymentOutcomeCallable APIGatewayClient::DeleteDeploymentCallable(const DeleteDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteDeployment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteDeploymentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDeployment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteDeploymentOutcome > rejected;
+    rejected.set_value(DeleteDeploymentOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteDeploymentAsync(const DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteDeploymentAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteDeploymentAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteDeploymentOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteDeploymentAsyncHelper(const DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteDeployment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/deployments/";
+  ss << request.GetDeploymentId();
+
+  auto sharedRequest = Aws::MakeShared<DeleteDeploymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteDeployment", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDeploymentOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDeploymentOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteDomainNameOutcome APIGatewayClient::DeleteDomainName(const DeleteDomainNameRequest& request) const
@@ -628,7 +1002,7 @@ DeleteDomainNameOutcome APIGatewayClient::DeleteDomainName(const DeleteDomainNam
   ss << m_uri << "/domainnames/";
   ss << request.GetDomainName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteDomainName");
   if(outcome.IsSuccess())
   {
     return DeleteDomainNameOutcome(NoResult());
@@ -641,17 +1015,43 @@ DeleteDomainNameOutcome APIGatewayClient::DeleteDomainName(const DeleteDomainNam
 
 DeleteDomainNameOutcomeCallable APIGatewayClient::DeleteDomainNameCallable(const DeleteDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteDomainName, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteDomainNameOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDomainName( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteDomainNameOutcome > rejected;
+    rejected.set_value(DeleteDomainNameOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteDomainNameAsync(const DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteDomainNameAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteDomainNameAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteDomainNameOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteDomainNameAsyncHelper(const DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteDomainName(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+
+  auto sharedRequest = Aws::MakeShared<DeleteDomainNameRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteDomainName", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDomainNameOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDomainNameOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteIntegrationOutcome APIGatewayClient::DeleteIntegration(const DeleteIntegrationRequest& request) const
@@ -665,7 +1065,7 @@ DeleteIntegrationOutcome APIGatewayClient::DeleteIntegration(const DeleteIntegra
   ss << request.GetHttpMethod();
   ss << "/integration";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteIntegration");
   if(outcome.IsSuccess())
   {
     return DeleteIntegrationOutcome(NoResult());
@@ -678,17 +1078,48 @@ DeleteIntegrationOutcome APIGatewayClient::DeleteIntegration(const DeleteIntegra
 
 DeleteIntegrationOutcomeCallable APIGatewayClient::DeleteIntegrationCallable(const DeleteIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteIntegration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteIntegrationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteIntegration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteIntegrationOutcome > rejected;
+    rejected.set_value(DeleteIntegrationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteIntegrationAsync(const DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteIntegrationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteIntegrationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteIntegrationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteIntegrationAsyncHelper(const DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteIntegration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration";
+
+  auto sharedRequest = Aws::MakeShared<DeleteIntegrationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteIntegration", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteIntegrationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteIntegrationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteIntegrationResponseOutcome APIGatewayClient::DeleteIntegrationResponse(const DeleteIntegrationResponseRequest& request) const
@@ -703,7 +1134,7 @@ DeleteIntegrationResponseOutcome APIGatewayClient::DeleteIntegrationResponse(con
   ss << "/integration/responses/";
   ss << request.GetStatusCode();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteIntegrationResponse");
   if(outcome.IsSuccess())
   {
     return DeleteIntegrationResponseOutcome(NoResult());
@@ -716,17 +1147,49 @@ DeleteIntegrationResponseOutcome APIGatewayClient::DeleteIntegrationResponse(con
 
 DeleteIntegrationResponseOutcomeCallable APIGatewayClient::DeleteIntegrationResponseCallable(const DeleteIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteIntegrationResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteIntegrationResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteIntegrationResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteIntegrationResponseOutcome > rejected;
+    rejected.set_value(DeleteIntegrationResponseOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteIntegrationResponseAsync(const DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteIntegrationResponseAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteIntegrationResponseAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteIntegrationResponseOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteIntegrationResponseAsyncHelper(const DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteIntegrationResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration/responses/";
+  ss << request.GetStatusCode();
+
+  auto sharedRequest = Aws::MakeShared<DeleteIntegrationResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteIntegrationResponse", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteIntegrationResponseOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteIntegrationResponseOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteMethodOutcome APIGatewayClient::DeleteMethod(const DeleteMethodRequest& request) const
@@ -739,7 +1202,7 @@ DeleteMethodOutcome APIGatewayClient::DeleteMethod(const DeleteMethodRequest& re
   ss << "/methods/";
   ss << request.GetHttpMethod();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteMethod");
   if(outcome.IsSuccess())
   {
     return DeleteMethodOutcome(NoResult());
@@ -752,17 +1215,47 @@ DeleteMethodOutcome APIGatewayClient::DeleteMethod(const DeleteMethodRequest& re
 
 DeleteMethodOutcomeCallable APIGatewayClient::DeleteMethodCallable(const DeleteMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteMethod, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteMethodOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteMethod( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteMethodOutcome > rejected;
+    rejected.set_value(DeleteMethodOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteMethodAsync(const DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteMethodAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteMethodAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteMethodOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteMethodAsyncHelper(const DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteMethod(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+
+  auto sharedRequest = Aws::MakeShared<DeleteMethodRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteMethod", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteMethodOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteMethodOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteMethodResponseOutcome APIGatewayClient::DeleteMethodResponse(const DeleteMethodResponseRequest& request) const
@@ -777,7 +1270,7 @@ DeleteMethodResponseOutcome APIGatewayClient::DeleteMethodResponse(const DeleteM
   ss << "/responses/";
   ss << request.GetStatusCode();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteMethodResponse");
   if(outcome.IsSuccess())
   {
     return DeleteMethodResponseOutcome(NoResult());
@@ -790,17 +1283,49 @@ DeleteMethodResponseOutcome APIGatewayClient::DeleteMethodResponse(const DeleteM
 
 DeleteMethodResponseOutcomeCallable APIGatewayClient::DeleteMethodResponseCallable(const DeleteMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteMethodResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteMethodResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteMethodResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteMethodResponseOutcome > rejected;
+    rejected.set_value(DeleteMethodResponseOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteMethodResponseAsync(const DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteMethodResponseAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteMethodResponseAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteMethodResponseOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteMethodResponseAsyncHelper(const DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteMethodResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/responses/";
+  ss << request.GetStatusCode();
+
+  auto sharedRequest = Aws::MakeShared<DeleteMethodResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteMethodResponse", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteMethodResponseOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteMethodResponseOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteModelOutcome APIGatewayClient::DeleteModel(const DeleteModelRequest& request) const
@@ -811,7 +1336,7 @@ DeleteModelOutcome APIGatewayClient::DeleteModel(const DeleteModelRequest& reque
   ss << "/models/";
   ss << request.GetModelName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteModel");
   if(outcome.IsSuccess())
   {
     return DeleteModelOutcome(NoResult());
@@ -824,17 +1349,45 @@ DeleteModelOutcome APIGatewayClient::DeleteModel(const DeleteModelRequest& reque
 
 DeleteModelOutcomeCallable APIGatewayClient::DeleteModelCallable(const DeleteModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteModel, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteModelOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteModel( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteModelOutcome > rejected;
+    rejected.set_value(DeleteModelOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteModelAsync(const DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteModelAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteModelAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteModelOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteModelAsyncHelper(const DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteModel(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models/";
+  ss << request.GetModelName();
+
+  auto sharedRequest = Aws::MakeShared<DeleteModelRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteModel", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteModelOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteModelOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteResourceOutcome APIGatewayClient::DeleteResource(const DeleteResourceRequest& request) const
@@ -845,7 +1398,7 @@ DeleteResourceOutcome APIGatewayClient::DeleteResource(const DeleteResourceReque
   ss << "/resources/";
   ss << request.GetResourceId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteResource");
   if(outcome.IsSuccess())
   {
     return DeleteResourceOutcome(NoResult());
@@ -858,17 +1411,45 @@ DeleteResourceOutcome APIGatewayClient::DeleteResource(const DeleteResourceReque
 
 DeleteResourceOutcomeCallable APIGatewayClient::DeleteResourceCallable(const DeleteResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteResourceOutcome > rejected;
+    rejected.set_value(DeleteResourceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteResourceAsync(const DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteResourceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteResourceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteResourceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteResourceAsyncHelper(const DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+
+  auto sharedRequest = Aws::MakeShared<DeleteResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteResource", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteResourceOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteResourceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteRestApiOutcome APIGatewayClient::DeleteRestApi(const DeleteRestApiRequest& request) const
@@ -877,7 +1458,7 @@ DeleteRestApiOutcome APIGatewayClient::DeleteRestApi(const DeleteRestApiRequest&
   ss << m_uri << "/restapis/";
   ss << request.GetRestApiId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteRestApi");
   if(outcome.IsSuccess())
   {
     return DeleteRestApiOutcome(NoResult());
@@ -890,17 +1471,43 @@ DeleteRestApiOutcome APIGatewayClient::DeleteRestApi(const DeleteRestApiRequest&
 
 DeleteRestApiOutcomeCallable APIGatewayClient::DeleteRestApiCallable(const DeleteRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteRestApi, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteRestApiOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteRestApi( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteRestApiOutcome > rejected;
+    rejected.set_value(DeleteRestApiOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteRestApiAsync(const DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteRestApiAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteRestApiAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteRestApiOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteRestApiAsyncHelper(const DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteRestApi(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+
+  auto sharedRequest = Aws::MakeShared<DeleteRestApiRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteRestApi", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteRestApiOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteRestApiOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteStageOutcome APIGatewayClient::DeleteStage(const DeleteStageRequest& request) const
@@ -911,7 +1518,7 @@ DeleteStageOutcome APIGatewayClient::DeleteStage(const DeleteStageRequest& reque
   ss << "/stages/";
   ss << request.GetStageName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteStage");
   if(outcome.IsSuccess())
   {
     return DeleteStageOutcome(NoResult());
@@ -924,17 +1531,45 @@ DeleteStageOutcome APIGatewayClient::DeleteStage(const DeleteStageRequest& reque
 
 DeleteStageOutcomeCallable APIGatewayClient::DeleteStageCallable(const DeleteStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteStage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteStageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteStage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteStageOutcome > rejected;
+    rejected.set_value(DeleteStageOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::DeleteStageAsync(const DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteStageAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::DeleteStageAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteStageOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::DeleteStageAsyncHelper(const DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteStage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+
+  auto sharedRequest = Aws::MakeShared<DeleteStageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteStage", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteStageOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteStageOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 FlushStageAuthorizersCacheOutcome APIGatewayClient::FlushStageAuthorizersCache(const FlushStageAuthorizersCacheRequest& request) const
@@ -946,7 +1581,7 @@ FlushStageAuthorizersCacheOutcome APIGatewayClient::FlushStageAuthorizersCache(c
   ss << request.GetStageName();
   ss << "/cache/authorizers";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "FlushStageAuthorizersCache");
   if(outcome.IsSuccess())
   {
     return FlushStageAuthorizersCacheOutcome(NoResult());
@@ -959,17 +1594,46 @@ FlushStageAuthorizersCacheOutcome APIGatewayClient::FlushStageAuthorizersCache(c
 
 FlushStageAuthorizersCacheOutcomeCallable APIGatewayClient::FlushStageAuthorizersCacheCallable(const FlushStageAuthorizersCacheRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::FlushStageAuthorizersCache, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< FlushStageAuthorizersCacheOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->FlushStageAuthorizersCache( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< FlushStageAuthorizersCacheOutcome > rejected;
+    rejected.set_value(FlushStageAuthorizersCacheOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::FlushStageAuthorizersCacheAsync(const FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, FlushStageAuthorizersCacheOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper(const FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, FlushStageAuthorizersCache(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+  ss << "/cache/authorizers";
+
+  auto sharedRequest = Aws::MakeShared<FlushStageAuthorizersCacheRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "FlushStageAuthorizersCache", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, FlushStageAuthorizersCacheOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, FlushStageAuthorizersCacheOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 FlushStageCacheOutcome APIGatewayClient::FlushStageCache(const FlushStageCacheRequest& request) const
@@ -981,7 +1645,7 @@ FlushStageCacheOutcome APIGatewayClient::FlushStageCache(const FlushStageCacheRe
   ss << request.GetStageName();
   ss << "/cache/data";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "FlushStageCache");
   if(outcome.IsSuccess())
   {
     return FlushStageCacheOutcome(NoResult());
@@ -994,17 +1658,46 @@ FlushStageCacheOutcome APIGatewayClient::FlushStageCache(const FlushStageCacheRe
 
 FlushStageCacheOutcomeCallable APIGatewayClient::FlushStageCacheCallable(const FlushStageCacheRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::FlushStageCache, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< FlushStageCacheOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->FlushStageCache( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< FlushStageCacheOutcome > rejected;
+    rejected.set_value(FlushStageCacheOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::FlushStageCacheAsync(const FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::FlushStageCacheAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::FlushStageCacheAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, FlushStageCacheOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::FlushStageCacheAsyncHelper(const FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, FlushStageCache(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+  ss << "/cache/data";
+
+  auto sharedRequest = Aws::MakeShared<FlushStageCacheRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "FlushStageCache", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, FlushStageCacheOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, FlushStageCacheOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GenerateClientCertificateOutcome APIGatewayClient::GenerateClientCertificate(const GenerateClientCertificateRequest& request) const
@@ -1012,7 +1705,7 @@ GenerateClientCertificateOutcome APIGatewayClient::GenerateClientCertificate(con
   Aws::StringStream ss;
   ss << m_uri << "/clientcertificates";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "GenerateClientCertificate");
   if(outcome.IsSuccess())
   {
     return GenerateClientCertificateOutcome(GenerateClientCertificateResult(outcome.GetResult()));
@@ -1025,17 +1718,42 @@ GenerateClientCertificateOutcome APIGatewayClient::GenerateClientCertificate(con
 
 GenerateClientCertificateOutcomeCallable APIGatewayClient::GenerateClientCertificateCallable(const GenerateClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GenerateClientCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GenerateClientCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GenerateClientCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GenerateClientCertificateOutcome > rejected;
+    rejected.set_value(GenerateClientCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GenerateClientCertificateAsync(const GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GenerateClientCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GenerateClientCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GenerateClientCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GenerateClientCertificateAsyncHelper(const GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GenerateClientCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/clientcertificates";
+
+  auto sharedRequest = Aws::MakeShared<GenerateClientCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "GenerateClientCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GenerateClientCertificateOutcome(GenerateClientCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GenerateClientCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetAccountOutcome APIGatewayClient::GetAccount(const GetAccountRequest& request) const
@@ -1043,7 +1761,7 @@ GetAccountOutcome APIGatewayClient::GetAccount(const GetAccountRequest& request)
   Aws::StringStream ss;
   ss << m_uri << "/account";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetAccount");
   if(outcome.IsSuccess())
   {
     return GetAccountOutcome(GetAccountResult(outcome.GetResult()));
@@ -1056,17 +1774,42 @@ GetAccountOutcome APIGatewayClient::GetAccount(const GetAccountRequest& request)
 
 GetAccountOutcomeCallable APIGatewayClient::GetAccountCallable(const GetAccountRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetAccount, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetAccountOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetAccount( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetAccountOutcome > rejected;
+    rejected.set_value(GetAccountOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetAccountAsync(const GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetAccountAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetAccountAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetAccountOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetAccountAsyncHelper(const GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetAccount(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/account";
+
+  auto sharedRequest = Aws::MakeShared<GetAccountRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetAccount", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetAccountOutcome(GetAccountResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetAccountOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetApiKeyOutcome APIGatewayClient::GetApiKey(const GetApiKeyRequest& request) const
@@ -1075,7 +1818,7 @@ GetApiKeyOutcome APIGatewayClient::GetApiKey(const GetApiKeyRequest& request) co
   ss << m_uri << "/apikeys/";
   ss << request.GetApiKey();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetApiKey");
   if(outcome.IsSuccess())
   {
     return GetApiKeyOutcome(GetApiKeyResult(outcome.GetResult()));
@@ -1088,17 +1831,43 @@ GetApiKeyOutcome APIGatewayClient::GetApiKey(const GetApiKeyRequest& request) co
 
 GetApiKeyOutcomeCallable APIGatewayClient::GetApiKeyCallable(const GetApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetApiKey, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetApiKeyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetApiKey( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetApiKeyOutcome > rejected;
+    rejected.set_value(GetApiKeyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetApiKeyAsync(const GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetApiKeyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetApiKeyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetApiKeyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetApiKeyAsyncHelper(const GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetApiKey(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/apikeys/";
+  ss << request.GetApiKey();
+
+  auto sharedRequest = Aws::MakeShared<GetApiKeyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetApiKey", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetApiKeyOutcome(GetApiKeyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetApiKeyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetApiKeysOutcome APIGatewayClient::GetApiKeys(const GetApiKeysRequest& request) const
@@ -1106,7 +1875,7 @@ GetApiKeysOutcome APIGatewayClient::GetApiKeys(const GetApiKeysRequest& request)
   Aws::StringStream ss;
   ss << m_uri << "/apikeys";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetApiKeys");
   if(outcome.IsSuccess())
   {
     return GetApiKeysOutcome(GetApiKeysResult(outcome.GetResult()));
@@ -1119,17 +1888,42 @@ GetApiKeysOutcome APIGatewayClient::GetApiKeys(const GetApiKeysRequest& request)
 
 GetApiKeysOutcomeCallable APIGatewayClient::GetApiKeysCallable(const GetApiKeysRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetApiKeys, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetApiKeysOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetApiKeys( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetApiKeysOutcome > rejected;
+    rejected.set_value(GetApiKeysOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetApiKeysAsync(const GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetApiKeysAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetApiKeysAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetApiKeysOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetApiKeysAsyncHelper(const GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetApiKeys(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/apikeys";
+
+  auto sharedRequest = Aws::MakeShared<GetApiKeysRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetApiKeys", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetApiKeysOutcome(GetApiKeysResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetApiKeysOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetAuthorizerOutcome APIGatewayClient::GetAuthorizer(const GetAuthorizerRequest& request) const
@@ -1140,7 +1934,7 @@ GetAuthorizerOutcome APIGatewayClient::GetAuthorizer(const GetAuthorizerRequest&
   ss << "/authorizers/";
   ss << request.GetAuthorizerId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetAuthorizer");
   if(outcome.IsSuccess())
   {
     return GetAuthorizerOutcome(GetAuthorizerResult(outcome.GetResult()));
@@ -1153,17 +1947,45 @@ GetAuthorizerOutcome APIGatewayClient::GetAuthorizer(const GetAuthorizerRequest&
 
 GetAuthorizerOutcomeCallable APIGatewayClient::GetAuthorizerCallable(const GetAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetAuthorizer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetAuthorizerOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetAuthorizer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetAuthorizerOutcome > rejected;
+    rejected.set_value(GetAuthorizerOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetAuthorizerAsync(const GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetAuthorizerAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetAuthorizerAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetAuthorizerOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetAuthorizerAsyncHelper(const GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetAuthorizer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers/";
+  ss << request.GetAuthorizerId();
+
+  auto sharedRequest = Aws::MakeShared<GetAuthorizerRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetAuthorizer", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetAuthorizerOutcome(GetAuthorizerResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetAuthorizerOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetAuthorizersOutcome APIGatewayClient::GetAuthorizers(const GetAuthorizersRequest& request) const
@@ -1173,7 +1995,7 @@ GetAuthorizersOutcome APIGatewayClient::GetAuthorizers(const GetAuthorizersReque
   ss << request.GetRestApiId();
   ss << "/authorizers";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetAuthorizers");
   if(outcome.IsSuccess())
   {
     return GetAuthorizersOutcome(GetAuthorizersResult(outcome.GetResult()));
@@ -1186,17 +2008,44 @@ GetAuthorizersOutcome APIGatewayClient::GetAuthorizers(const GetAuthorizersReque
 
 GetAuthorizersOutcomeCallable APIGatewayClient::GetAuthorizersCallable(const GetAuthorizersRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetAuthorizers, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetAuthorizersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetAuthorizers( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetAuthorizersOutcome > rejected;
+    rejected.set_value(GetAuthorizersOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetAuthorizersAsync(const GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetAuthorizersAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetAuthorizersAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetAuthorizersOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetAuthorizersAsyncHelper(const GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetAuthorizers(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers";
+
+  auto sharedRequest = Aws::MakeShared<GetAuthorizersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetAuthorizers", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetAuthorizersOutcome(GetAuthorizersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetAuthorizersOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBasePathMappingOutcome APIGatewayClient::GetBasePathMapping(const GetBasePathMappingRequest& request) const
@@ -1207,7 +2056,7 @@ GetBasePathMappingOutcome APIGatewayClient::GetBasePathMapping(const GetBasePath
   ss << "/basepathmappings/";
   ss << request.GetBasePath();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBasePathMapping");
   if(outcome.IsSuccess())
   {
     return GetBasePathMappingOutcome(GetBasePathMappingResult(outcome.GetResult()));
@@ -1220,17 +2069,45 @@ GetBasePathMappingOutcome APIGatewayClient::GetBasePathMapping(const GetBasePath
 
 GetBasePathMappingOutcomeCallable APIGatewayClient::GetBasePathMappingCallable(const GetBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetBasePathMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBasePathMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBasePathMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBasePathMappingOutcome > rejected;
+    rejected.set_value(GetBasePathMappingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetBasePathMappingAsync(const GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetBasePathMappingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetBasePathMappingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBasePathMappingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetBasePathMappingAsyncHelper(const GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBasePathMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  ss << "/basepathmappings/";
+  ss << request.GetBasePath();
+
+  auto sharedRequest = Aws::MakeShared<GetBasePathMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBasePathMapping", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBasePathMappingOutcome(GetBasePathMappingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBasePathMappingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBasePathMappingsOutcome APIGatewayClient::GetBasePathMappings(const GetBasePathMappingsRequest& request) const
@@ -1240,7 +2117,7 @@ GetBasePathMappingsOutcome APIGatewayClient::GetBasePathMappings(const GetBasePa
   ss << request.GetDomainName();
   ss << "/basepathmappings";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBasePathMappings");
   if(outcome.IsSuccess())
   {
     return GetBasePathMappingsOutcome(GetBasePathMappingsResult(outcome.GetResult()));
@@ -1253,17 +2130,44 @@ GetBasePathMappingsOutcome APIGatewayClient::GetBasePathMappings(const GetBasePa
 
 GetBasePathMappingsOutcomeCallable APIGatewayClient::GetBasePathMappingsCallable(const GetBasePathMappingsRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetBasePathMappings, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBasePathMappingsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBasePathMappings( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBasePathMappingsOutcome > rejected;
+    rejected.set_value(GetBasePathMappingsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetBasePathMappingsAsync(const GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetBasePathMappingsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetBasePathMappingsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBasePathMappingsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetBasePathMappingsAsyncHelper(const GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBasePathMappings(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  ss << "/basepathmappings";
+
+  auto sharedRequest = Aws::MakeShared<GetBasePathMappingsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBasePathMappings", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBasePathMappingsOutcome(GetBasePathMappingsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBasePathMappingsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetClientCertificateOutcome APIGatewayClient::GetClientCertificate(const GetClientCertificateRequest& request) const
@@ -1272,7 +2176,7 @@ GetClientCertificateOutcome APIGatewayClient::GetClientCertificate(const GetClie
   ss << m_uri << "/clientcertificates/";
   ss << request.GetClientCertificateId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetClientCertificate");
   if(outcome.IsSuccess())
   {
     return GetClientCertificateOutcome(GetClientCertificateResult(outcome.GetResult()));
@@ -1285,17 +2189,43 @@ GetClientCertificateOutcome APIGatewayClient::GetClientCertificate(const GetClie
 
 GetClientCertificateOutcomeCallable APIGatewayClient::GetClientCertificateCallable(const GetClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetClientCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetClientCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetClientCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetClientCertificateOutcome > rejected;
+    rejected.set_value(GetClientCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetClientCertificateAsync(const GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetClientCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetClientCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetClientCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetClientCertificateAsyncHelper(const GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetClientCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/clientcertificates/";
+  ss << request.GetClientCertificateId();
+
+  auto sharedRequest = Aws::MakeShared<GetClientCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetClientCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetClientCertificateOutcome(GetClientCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetClientCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetClientCertificatesOutcome APIGatewayClient::GetClientCertificates(const GetClientCertificatesRequest& request) const
@@ -1303,7 +2233,7 @@ GetClientCertificatesOutcome APIGatewayClient::GetClientCertificates(const GetCl
   Aws::StringStream ss;
   ss << m_uri << "/clientcertificates";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetClientCertificates");
   if(outcome.IsSuccess())
   {
     return GetClientCertificatesOutcome(GetClientCertificatesResult(outcome.GetResult()));
@@ -1316,17 +2246,42 @@ GetClientCertificatesOutcome APIGatewayClient::GetClientCertificates(const GetCl
 
 GetClientCertificatesOutcomeCallable APIGatewayClient::GetClientCertificatesCallable(const GetClientCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetClientCertificates, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetClientCertificatesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetClientCertificates( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetClientCertificatesOutcome > rejected;
+    rejected.set_value(GetClientCertificatesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetClientCertificatesAsync(const GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetClientCertificatesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetClientCertificatesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetClientCertificatesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetClientCertificatesAsyncHelper(const GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetClientCertificates(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/clientcertificates";
+
+  auto sharedRequest = Aws::MakeShared<GetClientCertificatesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetClientCertificates", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetClientCertificatesOutcome(GetClientCertificatesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetClientCertificatesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetDeploymentOutcome APIGatewayClient::GetDeployment(const GetDeploymentRequest& request) const
@@ -1337,7 +2292,7 @@ GetDeploymentOutcome APIGatewayClient::GetDeployment(const GetDeploymentRequest&
   ss << "/deployments/";
   ss << request.GetDeploymentId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetDeployment");
   if(outcome.IsSuccess())
   {
     return GetDeploymentOutcome(GetDeploymentResult(outcome.GetResult()));
@@ -1350,17 +2305,45 @@ GetDeploymentOutcome APIGatewayClient::GetDeployment(const GetDeploymentRequest&
 
 GetDeploymentOutcomeCallable APIGatewayClient::GetDeploymentCallable(const GetDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDeployment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDeploymentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDeployment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetDeploymentOutcome > rejected;
+    rejected.set_value(GetDeploymentOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetDeploymentAsync(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDeploymentAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetDeploymentAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetDeploymentOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetDeploymentAsyncHelper(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetDeployment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/deployments/";
+  ss << request.GetDeploymentId();
+
+  auto sharedRequest = Aws::MakeShared<GetDeploymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetDeployment", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDeploymentOutcome(GetDeploymentResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDeploymentOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetDeploymentsOutcome APIGatewayClient::GetDeployments(const GetDeploymentsRequest& request) const
@@ -1370,7 +2353,7 @@ GetDeploymentsOutcome APIGatewayClient::GetDeployments(const GetDeploymentsReque
   ss << request.GetRestApiId();
   ss << "/deployments";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetDeployments");
   if(outcome.IsSuccess())
   {
     return GetDeploymentsOutcome(GetDeploymentsResult(outcome.GetResult()));
@@ -1383,17 +2366,44 @@ GetDeploymentsOutcome APIGatewayClient::GetDeployments(const GetDeploymentsReque
 
 GetDeploymentsOutcomeCallable APIGatewayClient::GetDeploymentsCallable(const GetDeploymentsRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDeployments, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDeploymentsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDeployments( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetDeploymentsOutcome > rejected;
+    rejected.set_value(GetDeploymentsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetDeploymentsAsync(const GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDeploymentsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetDeploymentsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetDeploymentsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetDeploymentsAsyncHelper(const GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetDeployments(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/deployments";
+
+  auto sharedRequest = Aws::MakeShared<GetDeploymentsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetDeployments", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDeploymentsOutcome(GetDeploymentsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDeploymentsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetDomainNameOutcome APIGatewayClient::GetDomainName(const GetDomainNameRequest& request) const
@@ -1402,7 +2412,7 @@ GetDomainNameOutcome APIGatewayClient::GetDomainName(const GetDomainNameRequest&
   ss << m_uri << "/domainnames/";
   ss << request.GetDomainName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetDomainName");
   if(outcome.IsSuccess())
   {
     return GetDomainNameOutcome(GetDomainNameResult(outcome.GetResult()));
@@ -1415,17 +2425,43 @@ GetDomainNameOutcome APIGatewayClient::GetDomainName(const GetDomainNameRequest&
 
 GetDomainNameOutcomeCallable APIGatewayClient::GetDomainNameCallable(const GetDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDomainName, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDomainNameOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDomainName( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetDomainNameOutcome > rejected;
+    rejected.set_value(GetDomainNameOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetDomainNameAsync(const GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDomainNameAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetDomainNameAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetDomainNameOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetDomainNameAsyncHelper(const GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetDomainName(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+
+  auto sharedRequest = Aws::MakeShared<GetDomainNameRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetDomainName", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDomainNameOutcome(GetDomainNameResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDomainNameOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetDomainNamesOutcome APIGatewayClient::GetDomainNames(const GetDomainNamesRequest& request) const
@@ -1433,7 +2469,7 @@ GetDomainNamesOutcome APIGatewayClient::GetDomainNames(const GetDomainNamesReque
   Aws::StringStream ss;
   ss << m_uri << "/domainnames";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetDomainNames");
   if(outcome.IsSuccess())
   {
     return GetDomainNamesOutcome(GetDomainNamesResult(outcome.GetResult()));
@@ -1446,17 +2482,42 @@ GetDomainNamesOutcome APIGatewayClient::GetDomainNames(const GetDomainNamesReque
 
 GetDomainNamesOutcomeCallable APIGatewayClient::GetDomainNamesCallable(const GetDomainNamesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDomainNames, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDomainNamesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDomainNames( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetDomainNamesOutcome > rejected;
+    rejected.set_value(GetDomainNamesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetDomainNamesAsync(const GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDomainNamesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetDomainNamesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetDomainNamesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetDomainNamesAsyncHelper(const GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetDomainNames(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames";
+
+  auto sharedRequest = Aws::MakeShared<GetDomainNamesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetDomainNames", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDomainNamesOutcome(GetDomainNamesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDomainNamesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetExportOutcome APIGatewayClient::GetExport(const GetExportRequest& request) const
@@ -1469,7 +2530,7 @@ GetExportOutcome APIGatewayClient::GetExport(const GetExportRequest& request) co
   ss << "/exports/";
   ss << request.GetExportType();
 
-  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET, "GetExport");
   if(outcome.IsSuccess())
   {
     return GetExportOutcome(GetExportResult(outcome.GetResultWithOwnership()));
@@ -1482,17 +2543,47 @@ GetExportOutcome APIGatewayClient::GetExport(const GetExportRequest& request) co
 
 GetExportOutcomeCallable APIGatewayClient::GetExportCallable(const GetExportRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetExport, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetExportOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetExport( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetExportOutcome > rejected;
+    rejected.set_value(GetExportOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetExportAsync(const GetExportRequest& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetExportAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetExportAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetExportOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetExportAsyncHelper(const GetExportRequest& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetExport(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+  ss << "/exports/";
+  ss << request.GetExportType();
+
+  auto sharedRequest = Aws::MakeShared<GetExportRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetExport", [this, sharedRequest, handler, context](StreamOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetExportOutcome(GetExportResult(outcome.GetResultWithOwnership())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetExportOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetIntegrationOutcome APIGatewayClient::GetIntegration(const GetIntegrationRequest& request) const
@@ -1506,7 +2597,7 @@ GetIntegrationOutcome APIGatewayClient::GetIntegration(const GetIntegrationReque
   ss << request.GetHttpMethod();
   ss << "/integration";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetIntegration");
   if(outcome.IsSuccess())
   {
     return GetIntegrationOutcome(GetIntegrationResult(outcome.GetResult()));
@@ -1519,17 +2610,48 @@ GetIntegrationOutcome APIGatewayClient::GetIntegration(const GetIntegrationReque
 
 GetIntegrationOutcomeCallable APIGatewayClient::GetIntegrationCallable(const GetIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetIntegration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetIntegrationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetIntegration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetIntegrationOutcome > rejected;
+    rejected.set_value(GetIntegrationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetIntegrationAsync(const GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetIntegrationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetIntegrationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetIntegrationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetIntegrationAsyncHelper(const GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetIntegration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration";
+
+  auto sharedRequest = Aws::MakeShared<GetIntegrationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetIntegration", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetIntegrationOutcome(GetIntegrationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetIntegrationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetIntegrationResponseOutcome APIGatewayClient::GetIntegrationResponse(const GetIntegrationResponseRequest& request) const
@@ -1544,7 +2666,7 @@ GetIntegrationResponseOutcome APIGatewayClient::GetIntegrationResponse(const Get
   ss << "/integration/responses/";
   ss << request.GetStatusCode();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetIntegrationResponse");
   if(outcome.IsSuccess())
   {
     return GetIntegrationResponseOutcome(GetIntegrationResponseResult(outcome.GetResult()));
@@ -1557,17 +2679,49 @@ GetIntegrationResponseOutcome APIGatewayClient::GetIntegrationResponse(const Get
 
 GetIntegrationResponseOutcomeCallable APIGatewayClient::GetIntegrationResponseCallable(const GetIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetIntegrationResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetIntegrationResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetIntegrationResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetIntegrationResponseOutcome > rejected;
+    rejected.set_value(GetIntegrationResponseOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetIntegrationResponseAsync(const GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetIntegrationResponseAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetIntegrationResponseAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetIntegrationResponseOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetIntegrationResponseAsyncHelper(const GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetIntegrationResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration/responses/";
+  ss << request.GetStatusCode();
+
+  auto sharedRequest = Aws::MakeShared<GetIntegrationResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetIntegrationResponse", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetIntegrationResponseOutcome(GetIntegrationResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetIntegrationResponseOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetMethodOutcome APIGatewayClient::GetMethod(const GetMethodRequest& request) const
@@ -1580,7 +2734,7 @@ GetMethodOutcome APIGatewayClient::GetMethod(const GetMethodRequest& request) co
   ss << "/methods/";
   ss << request.GetHttpMethod();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetMethod");
   if(outcome.IsSuccess())
   {
     return GetMethodOutcome(GetMethodResult(outcome.GetResult()));
@@ -1593,17 +2747,47 @@ GetMethodOutcome APIGatewayClient::GetMethod(const GetMethodRequest& request) co
 
 GetMethodOutcomeCallable APIGatewayClient::GetMethodCallable(const GetMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetMethod, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetMethodOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetMethod( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetMethodOutcome > rejected;
+    rejected.set_value(GetMethodOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetMethodAsync(const GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetMethodAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetMethodAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetMethodOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetMethodAsyncHelper(const GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetMethod(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+
+  auto sharedRequest = Aws::MakeShared<GetMethodRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetMethod", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetMethodOutcome(GetMethodResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetMethodOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetMethodResponseOutcome APIGatewayClient::GetMethodResponse(const GetMethodResponseRequest& request) const
@@ -1618,7 +2802,7 @@ GetMethodResponseOutcome APIGatewayClient::GetMethodResponse(const GetMethodResp
   ss << "/responses/";
   ss << request.GetStatusCode();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetMethodResponse");
   if(outcome.IsSuccess())
   {
     return GetMethodResponseOutcome(GetMethodResponseResult(outcome.GetResult()));
@@ -1631,17 +2815,49 @@ GetMethodResponseOutcome APIGatewayClient::GetMethodResponse(const GetMethodResp
 
 GetMethodResponseOutcomeCallable APIGatewayClient::GetMethodResponseCallable(const GetMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetMethodResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetMethodResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetMethodResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetMethodResponseOutcome > rejected;
+    rejected.set_value(GetMethodResponseOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetMethodResponseAsync(const GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetMethodResponseAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetMethodResponseAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetMethodResponseOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetMethodResponseAsyncHelper(const GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetMethodResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/responses/";
+  ss << request.GetStatusCode();
+
+  auto sharedRequest = Aws::MakeShared<GetMethodResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetMethodResponse", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetMethodResponseOutcome(GetMethodResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetMethodResponseOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetModelOutcome APIGatewayClient::GetModel(const GetModelRequest& request) const
@@ -1652,7 +2868,7 @@ GetModelOutcome APIGatewayClient::GetModel(const GetModelRequest& request) const
   ss << "/models/";
   ss << request.GetModelName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetModel");
   if(outcome.IsSuccess())
   {
     return GetModelOutcome(GetModelResult(outcome.GetResult()));
@@ -1665,17 +2881,45 @@ GetModelOutcome APIGatewayClient::GetModel(const GetModelRequest& request) const
 
 GetModelOutcomeCallable APIGatewayClient::GetModelCallable(const GetModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetModel, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetModelOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetModel( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetModelOutcome > rejected;
+    rejected.set_value(GetModelOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetModelAsync(const GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetModelAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetModelAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetModelOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetModelAsyncHelper(const GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetModel(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models/";
+  ss << request.GetModelName();
+
+  auto sharedRequest = Aws::MakeShared<GetModelRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetModel", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetModelOutcome(GetModelResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetModelOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetModelTemplateOutcome APIGatewayClient::GetModelTemplate(const GetModelTemplateRequest& request) const
@@ -1687,7 +2931,7 @@ GetModelTemplateOutcome APIGatewayClient::GetModelTemplate(const GetModelTemplat
   ss << request.GetModelName();
   ss << "/default_template";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetModelTemplate");
   if(outcome.IsSuccess())
   {
     return GetModelTemplateOutcome(GetModelTemplateResult(outcome.GetResult()));
@@ -1700,17 +2944,46 @@ GetModelTemplateOutcome APIGatewayClient::GetModelTemplate(const GetModelTemplat
 
 GetModelTemplateOutcomeCallable APIGatewayClient::GetModelTemplateCallable(const GetModelTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetModelTemplate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetModelTemplateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetModelTemplate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetModelTemplateOutcome > rejected;
+    rejected.set_value(GetModelTemplateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetModelTemplateAsync(const GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetModelTemplateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetModelTemplateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetModelTemplateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetModelTemplateAsyncHelper(const GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetModelTemplate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models/";
+  ss << request.GetModelName();
+  ss << "/default_template";
+
+  auto sharedRequest = Aws::MakeShared<GetModelTemplateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetModelTemplate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetModelTemplateOutcome(GetModelTemplateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetModelTemplateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetModelsOutcome APIGatewayClient::GetModels(const GetModelsRequest& request) const
@@ -1720,7 +2993,7 @@ GetModelsOutcome APIGatewayClient::GetModels(const GetModelsRequest& request) co
   ss << request.GetRestApiId();
   ss << "/models";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetModels");
   if(outcome.IsSuccess())
   {
     return GetModelsOutcome(GetModelsResult(outcome.GetResult()));
@@ -1733,17 +3006,44 @@ GetModelsOutcome APIGatewayClient::GetModels(const GetModelsRequest& request) co
 
 GetModelsOutcomeCallable APIGatewayClient::GetModelsCallable(const GetModelsRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetModels, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetModelsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetModels( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetModelsOutcome > rejected;
+    rejected.set_value(GetModelsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetModelsAsync(const GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetModelsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetModelsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetModelsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetModelsAsyncHelper(const GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetModels(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models";
+
+  auto sharedRequest = Aws::MakeShared<GetModelsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetModels", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetModelsOutcome(GetModelsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetModelsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetResourceOutcome APIGatewayClient::GetResource(const GetResourceRequest& request) const
@@ -1754,7 +3054,7 @@ GetResourceOutcome APIGatewayClient::GetResource(const GetResourceRequest& reque
   ss << "/resources/";
   ss << request.GetResourceId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetResource");
   if(outcome.IsSuccess())
   {
     return GetResourceOutcome(GetResourceResult(outcome.GetResult()));
@@ -1767,17 +3067,45 @@ GetResourceOutcome APIGatewayClient::GetResource(const GetResourceRequest& reque
 
 GetResourceOutcomeCallable APIGatewayClient::GetResourceCallable(const GetResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetResourceOutcome > rejected;
+    rejected.set_value(GetResourceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetResourceAsync(const GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetResourceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetResourceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetResourceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetResourceAsyncHelper(const GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+
+  auto sharedRequest = Aws::MakeShared<GetResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetResource", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetResourceOutcome(GetResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetResourceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetResourcesOutcome APIGatewayClient::GetResources(const GetResourcesRequest& request) const
@@ -1787,7 +3115,7 @@ GetResourcesOutcome APIGatewayClient::GetResources(const GetResourcesRequest& re
   ss << request.GetRestApiId();
   ss << "/resources";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetResources");
   if(outcome.IsSuccess())
   {
     return GetResourcesOutcome(GetResourcesResult(outcome.GetResult()));
@@ -1800,17 +3128,44 @@ GetResourcesOutcome APIGatewayClient::GetResources(const GetResourcesRequest& re
 
 GetResourcesOutcomeCallable APIGatewayClient::GetResourcesCallable(const GetResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetResources, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetResourcesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetResources( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetResourcesOutcome > rejected;
+    rejected.set_value(GetResourcesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetResourcesAsync(const GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetResourcesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetResourcesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetResourcesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetResourcesAsyncHelper(const GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetResources(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources";
+
+  auto sharedRequest = Aws::MakeShared<GetResourcesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetResources", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetResourcesOutcome(GetResourcesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetResourcesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetRestApiOutcome APIGatewayClient::GetRestApi(const GetRestApiRequest& request) const
@@ -1819,7 +3174,7 @@ GetRestApiOutcome APIGatewayClient::GetRestApi(const GetRestApiRequest& request)
   ss << m_uri << "/restapis/";
   ss << request.GetRestApiId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetRestApi");
   if(outcome.IsSuccess())
   {
     return GetRestApiOutcome(GetRestApiResult(outcome.GetResult()));
@@ -1832,17 +3187,43 @@ GetRestApiOutcome APIGatewayClient::GetRestApi(const GetRestApiRequest& request)
 
 GetRestApiOutcomeCallable APIGatewayClient::GetRestApiCallable(const GetRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetRestApi, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetRestApiOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetRestApi( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetRestApiOutcome > rejected;
+    rejected.set_value(GetRestApiOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetRestApiAsync(const GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetRestApiAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetRestApiAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetRestApiOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetRestApiAsyncHelper(const GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetRestApi(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+
+  auto sharedRequest = Aws::MakeShared<GetRestApiRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetRestApi", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetRestApiOutcome(GetRestApiResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetRestApiOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetRestApisOutcome APIGatewayClient::GetRestApis(const GetRestApisRequest& request) const
@@ -1850,7 +3231,7 @@ GetRestApisOutcome APIGatewayClient::GetRestApis(const GetRestApisRequest& reque
   Aws::StringStream ss;
   ss << m_uri << "/restapis";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetRestApis");
   if(outcome.IsSuccess())
   {
     return GetRestApisOutcome(GetRestApisResult(outcome.GetResult()));
@@ -1863,17 +3244,42 @@ GetRestApisOutcome APIGatewayClient::GetRestApis(const GetRestApisRequest& reque
 
 GetRestApisOutcomeCallable APIGatewayClient::GetRestApisCallable(const GetRestApisRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetRestApis, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetRestApisOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetRestApis( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetRestApisOutcome > rejected;
+    rejected.set_value(GetRestApisOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetRestApisAsync(const GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetRestApisAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetRestApisAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetRestApisOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetRestApisAsyncHelper(const GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetRestApis(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis";
+
+  auto sharedRequest = Aws::MakeShared<GetRestApisRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetRestApis", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetRestApisOutcome(GetRestApisResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetRestApisOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetSdkOutcome APIGatewayClient::GetSdk(const GetSdkRequest& request) const
@@ -1886,7 +3292,7 @@ GetSdkOutcome APIGatewayClient::GetSdk(const GetSdkRequest& request) const
   ss << "/sdks/";
   ss << request.GetSdkType();
 
-  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET, "GetSdk");
   if(outcome.IsSuccess())
   {
     return GetSdkOutcome(GetSdkResult(outcome.GetResultWithOwnership()));
@@ -1899,17 +3305,47 @@ GetSdkOutcome APIGatewayClient::GetSdk(const GetSdkRequest& request) const
 
 GetSdkOutcomeCallable APIGatewayClient::GetSdkCallable(const GetSdkRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetSdk, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetSdkOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetSdk( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetSdkOutcome > rejected;
+    rejected.set_value(GetSdkOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetSdkAsync(const GetSdkRequest& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetSdkAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetSdkAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetSdkOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetSdkAsyncHelper(const GetSdkRequest& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetSdk(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+  ss << "/sdks/";
+  ss << request.GetSdkType();
+
+  auto sharedRequest = Aws::MakeShared<GetSdkRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetSdk", [this, sharedRequest, handler, context](StreamOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetSdkOutcome(GetSdkResult(outcome.GetResultWithOwnership())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetSdkOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetStageOutcome APIGatewayClient::GetStage(const GetStageRequest& request) const
@@ -1920,7 +3356,7 @@ GetStageOutcome APIGatewayClient::GetStage(const GetStageRequest& request) const
   ss << "/stages/";
   ss << request.GetStageName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetStage");
   if(outcome.IsSuccess())
   {
     return GetStageOutcome(GetStageResult(outcome.GetResult()));
@@ -1933,17 +3369,45 @@ GetStageOutcome APIGatewayClient::GetStage(const GetStageRequest& request) const
 
 GetStageOutcomeCallable APIGatewayClient::GetStageCallable(const GetStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetStage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetStageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetStageOutcome > rejected;
+    rejected.set_value(GetStageOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetStageAsync(const GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetStageAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetStageAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetStageOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetStageAsyncHelper(const GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetStage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+
+  auto sharedRequest = Aws::MakeShared<GetStageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetStage", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStageOutcome(GetStageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStageOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetStagesOutcome APIGatewayClient::GetStages(const GetStagesRequest& request) const
@@ -1953,7 +3417,7 @@ GetStagesOutcome APIGatewayClient::GetStages(const GetStagesRequest& request) co
   ss << request.GetRestApiId();
   ss << "/stages";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetStages");
   if(outcome.IsSuccess())
   {
     return GetStagesOutcome(GetStagesResult(outcome.GetResult()));
@@ -1966,17 +3430,44 @@ GetStagesOutcome APIGatewayClient::GetStages(const GetStagesRequest& request) co
 
 GetStagesOutcomeCallable APIGatewayClient::GetStagesCallable(const GetStagesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetStages, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetStagesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStages( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetStagesOutcome > rejected;
+    rejected.set_value(GetStagesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::GetStagesAsync(const GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetStagesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::GetStagesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetStagesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::GetStagesAsyncHelper(const GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetStages(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages";
+
+  auto sharedRequest = Aws::MakeShared<GetStagesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetStages", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStagesOutcome(GetStagesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStagesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutIntegrationOutcome APIGatewayClient::PutIntegration(const PutIntegrationRequest& request) const
@@ -1990,7 +3481,7 @@ PutIntegrationOutcome APIGatewayClient::PutIntegration(const PutIntegrationReque
   ss << request.GetHttpMethod();
   ss << "/integration";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutIntegration");
   if(outcome.IsSuccess())
   {
     return PutIntegrationOutcome(PutIntegrationResult(outcome.GetResult()));
@@ -2003,17 +3494,48 @@ PutIntegrationOutcome APIGatewayClient::PutIntegration(const PutIntegrationReque
 
 PutIntegrationOutcomeCallable APIGatewayClient::PutIntegrationCallable(const PutIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutIntegration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutIntegrationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutIntegration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutIntegrationOutcome > rejected;
+    rejected.set_value(PutIntegrationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::PutIntegrationAsync(const PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutIntegrationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::PutIntegrationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutIntegrationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::PutIntegrationAsyncHelper(const PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutIntegration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration";
+
+  auto sharedRequest = Aws::MakeShared<PutIntegrationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutIntegration", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutIntegrationOutcome(PutIntegrationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutIntegrationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutIntegrationResponseOutcome APIGatewayClient::PutIntegrationResponse(const PutIntegrationResponseRequest& request) const
@@ -2028,7 +3550,7 @@ PutIntegrationResponseOutcome APIGatewayClient::PutIntegrationResponse(const Put
   ss << "/integration/responses/";
   ss << request.GetStatusCode();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutIntegrationResponse");
   if(outcome.IsSuccess())
   {
     return PutIntegrationResponseOutcome(PutIntegrationResponseResult(outcome.GetResult()));
@@ -2041,17 +3563,49 @@ PutIntegrationResponseOutcome APIGatewayClient::PutIntegrationResponse(const Put
 
 PutIntegrationResponseOutcomeCallable APIGatewayClient::PutIntegrationResponseCallable(const PutIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutIntegrationResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutIntegrationResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutIntegrationResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutIntegrationResponseOutcome > rejected;
+    rejected.set_value(PutIntegrationResponseOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::PutIntegrationResponseAsync(const PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutIntegrationResponseAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::PutIntegrationResponseAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutIntegrationResponseOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::PutIntegrationResponseAsyncHelper(const PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutIntegrationResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration/responses/";
+  ss << request.GetStatusCode();
+
+  auto sharedRequest = Aws::MakeShared<PutIntegrationResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutIntegrationResponse", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutIntegrationResponseOutcome(PutIntegrationResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutIntegrationResponseOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutMethodOutcome APIGatewayClient::PutMethod(const PutMethodRequest& request) const
@@ -2064,7 +3618,7 @@ PutMethodOutcome APIGatewayClient::PutMethod(const PutMethodRequest& request) co
   ss << "/methods/";
   ss << request.GetHttpMethod();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutMethod");
   if(outcome.IsSuccess())
   {
     return PutMethodOutcome(PutMethodResult(outcome.GetResult()));
@@ -2077,17 +3631,47 @@ PutMethodOutcome APIGatewayClient::PutMethod(const PutMethodRequest& request) co
 
 PutMethodOutcomeCallable APIGatewayClient::PutMethodCallable(const PutMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutMethod, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutMethodOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutMethod( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutMethodOutcome > rejected;
+    rejected.set_value(PutMethodOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::PutMethodAsync(const PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutMethodAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::PutMethodAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutMethodOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::PutMethodAsyncHelper(const PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutMethod(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+
+  auto sharedRequest = Aws::MakeShared<PutMethodRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutMethod", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutMethodOutcome(PutMethodResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutMethodOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutMethodResponseOutcome APIGatewayClient::PutMethodResponse(const PutMethodResponseRequest& request) const
@@ -2102,7 +3686,7 @@ PutMethodResponseOutcome APIGatewayClient::PutMethodResponse(const PutMethodResp
   ss << "/responses/";
   ss << request.GetStatusCode();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutMethodResponse");
   if(outcome.IsSuccess())
   {
     return PutMethodResponseOutcome(PutMethodResponseResult(outcome.GetResult()));
@@ -2115,17 +3699,49 @@ PutMethodResponseOutcome APIGatewayClient::PutMethodResponse(const PutMethodResp
 
 PutMethodResponseOutcomeCallable APIGatewayClient::PutMethodResponseCallable(const PutMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutMethodResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutMethodResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutMethodResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutMethodResponseOutcome > rejected;
+    rejected.set_value(PutMethodResponseOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::PutMethodResponseAsync(const PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutMethodResponseAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::PutMethodResponseAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutMethodResponseOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::PutMethodResponseAsyncHelper(const PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutMethodResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/responses/";
+  ss << request.GetStatusCode();
+
+  auto sharedRequest = Aws::MakeShared<PutMethodResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutMethodResponse", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutMethodResponseOutcome(PutMethodResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutMethodResponseOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 TestInvokeAuthorizerOutcome APIGatewayClient::TestInvokeAuthorizer(const TestInvokeAuthorizerRequest& request) const
@@ -2136,7 +3752,7 @@ TestInvokeAuthorizerOutcome APIGatewayClient::TestInvokeAuthorizer(const TestInv
   ss << "/authorizers/";
   ss << request.GetAuthorizerId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "TestInvokeAuthorizer");
   if(outcome.IsSuccess())
   {
     return TestInvokeAuthorizerOutcome(TestInvokeAuthorizerResult(outcome.GetResult()));
@@ -2149,17 +3765,45 @@ TestInvokeAuthorizerOutcome APIGatewayClient::TestInvokeAuthorizer(const TestInv
 
 TestInvokeAuthorizerOutcomeCallable APIGatewayClient::TestInvokeAuthorizerCallable(const TestInvokeAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::TestInvokeAuthorizer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< TestInvokeAuthorizerOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TestInvokeAuthorizer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< TestInvokeAuthorizerOutcome > rejected;
+    rejected.set_value(TestInvokeAuthorizerOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::TestInvokeAuthorizerAsync(const TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::TestInvokeAuthorizerAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::TestInvokeAuthorizerAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, TestInvokeAuthorizerOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::TestInvokeAuthorizerAsyncHelper(const TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, TestInvokeAuthorizer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers/";
+  ss << request.GetAuthorizerId();
+
+  auto sharedRequest = Aws::MakeShared<TestInvokeAuthorizerRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "TestInvokeAuthorizer", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TestInvokeAuthorizerOutcome(TestInvokeAuthorizerResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TestInvokeAuthorizerOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 TestInvokeMethodOutcome APIGatewayClient::TestInvokeMethod(const TestInvokeMethodRequest& request) const
@@ -2172,7 +3816,7 @@ TestInvokeMethodOutcome APIGatewayClient::TestInvokeMethod(const TestInvokeMetho
   ss << "/methods/";
   ss << request.GetHttpMethod();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "TestInvokeMethod");
   if(outcome.IsSuccess())
   {
     return TestInvokeMethodOutcome(TestInvokeMethodResult(outcome.GetResult()));
@@ -2185,17 +3829,47 @@ TestInvokeMethodOutcome APIGatewayClient::TestInvokeMethod(const TestInvokeMetho
 
 TestInvokeMethodOutcomeCallable APIGatewayClient::TestInvokeMethodCallable(const TestInvokeMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::TestInvokeMethod, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< TestInvokeMethodOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TestInvokeMethod( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< TestInvokeMethodOutcome > rejected;
+    rejected.set_value(TestInvokeMethodOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::TestInvokeMethodAsync(const TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::TestInvokeMethodAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::TestInvokeMethodAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, TestInvokeMethodOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::TestInvokeMethodAsyncHelper(const TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, TestInvokeMethod(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+
+  auto sharedRequest = Aws::MakeShared<TestInvokeMethodRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "TestInvokeMethod", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TestInvokeMethodOutcome(TestInvokeMethodResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TestInvokeMethodOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateAccountOutcome APIGatewayClient::UpdateAccount(const UpdateAccountRequest& request) const
@@ -2203,7 +3877,7 @@ UpdateAccountOutcome APIGatewayClient::UpdateAccount(const UpdateAccountRequest&
   Aws::StringStream ss;
   ss << m_uri << "/account";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateAccount");
   if(outcome.IsSuccess())
   {
     return UpdateAccountOutcome(UpdateAccountResult(outcome.GetResult()));
@@ -2216,17 +3890,42 @@ UpdateAccountOutcome APIGatewayClient::UpdateAccount(const UpdateAccountRequest&
 
 UpdateAccountOutcomeCallable APIGatewayClient::UpdateAccountCallable(const UpdateAccountRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateAccount, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateAccountOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateAccount( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateAccountOutcome > rejected;
+    rejected.set_value(UpdateAccountOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateAccountAsync(const UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateAccountAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateAccountAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateAccountOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateAccountAsyncHelper(const UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateAccount(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/account";
+
+  auto sharedRequest = Aws::MakeShared<UpdateAccountRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateAccount", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateAccountOutcome(UpdateAccountResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateAccountOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateApiKeyOutcome APIGatewayClient::UpdateApiKey(const UpdateApiKeyRequest& request) const
@@ -2235,7 +3934,7 @@ UpdateApiKeyOutcome APIGatewayClient::UpdateApiKey(const UpdateApiKeyRequest& re
   ss << m_uri << "/apikeys/";
   ss << request.GetApiKey();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateApiKey");
   if(outcome.IsSuccess())
   {
     return UpdateApiKeyOutcome(UpdateApiKeyResult(outcome.GetResult()));
@@ -2248,17 +3947,43 @@ UpdateApiKeyOutcome APIGatewayClient::UpdateApiKey(const UpdateApiKeyRequest& re
 
 UpdateApiKeyOutcomeCallable APIGatewayClient::UpdateApiKeyCallable(const UpdateApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateApiKey, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateApiKeyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateApiKey( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateApiKeyOutcome > rejected;
+    rejected.set_value(UpdateApiKeyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateApiKeyAsync(const UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateApiKeyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateApiKeyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateApiKeyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateApiKeyAsyncHelper(const UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateApiKey(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/apikeys/";
+  ss << request.GetApiKey();
+
+  auto sharedRequest = Aws::MakeShared<UpdateApiKeyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateApiKey", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateApiKeyOutcome(UpdateApiKeyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateApiKeyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateAuthorizerOutcome APIGatewayClient::UpdateAuthorizer(const UpdateAuthorizerRequest& request) const
@@ -2269,7 +3994,7 @@ UpdateAuthorizerOutcome APIGatewayClient::UpdateAuthorizer(const UpdateAuthorize
   ss << "/authorizers/";
   ss << request.GetAuthorizerId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateAuthorizer");
   if(outcome.IsSuccess())
   {
     return UpdateAuthorizerOutcome(UpdateAuthorizerResult(outcome.GetResult()));
@@ -2282,17 +4007,45 @@ UpdateAuthorizerOutcome APIGatewayClient::UpdateAuthorizer(const UpdateAuthorize
 
 UpdateAuthorizerOutcomeCallable APIGatewayClient::UpdateAuthorizerCallable(const UpdateAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateAuthorizer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateAuthorizerOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateAuthorizer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateAuthorizerOutcome > rejected;
+    rejected.set_value(UpdateAuthorizerOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateAuthorizerAsync(const UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateAuthorizerAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateAuthorizerAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateAuthorizerOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateAuthorizerAsyncHelper(const UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateAuthorizer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/authorizers/";
+  ss << request.GetAuthorizerId();
+
+  auto sharedRequest = Aws::MakeShared<UpdateAuthorizerRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateAuthorizer", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateAuthorizerOutcome(UpdateAuthorizerResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateAuthorizerOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateBasePathMappingOutcome APIGatewayClient::UpdateBasePathMapping(const UpdateBasePathMappingRequest& request) const
@@ -2303,7 +4056,7 @@ UpdateBasePathMappingOutcome APIGatewayClient::UpdateBasePathMapping(const Updat
   ss << "/basepathmappings/";
   ss << request.GetBasePath();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateBasePathMapping");
   if(outcome.IsSuccess())
   {
     return UpdateBasePathMappingOutcome(UpdateBasePathMappingResult(outcome.GetResult()));
@@ -2316,17 +4069,45 @@ UpdateBasePathMappingOutcome APIGatewayClient::UpdateBasePathMapping(const Updat
 
 UpdateBasePathMappingOutcomeCallable APIGatewayClient::UpdateBasePathMappingCallable(const UpdateBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateBasePathMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateBasePathMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateBasePathMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateBasePathMappingOutcome > rejected;
+    rejected.set_value(UpdateBasePathMappingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateBasePathMappingAsync(const UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateBasePathMappingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateBasePathMappingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateBasePathMappingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateBasePathMappingAsyncHelper(const UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateBasePathMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+  ss << "/basepathmappings/";
+  ss << request.GetBasePath();
+
+  auto sharedRequest = Aws::MakeShared<UpdateBasePathMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateBasePathMapping", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateBasePathMappingOutcome(UpdateBasePathMappingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateBasePathMappingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateClientCertificateOutcome APIGatewayClient::UpdateClientCertificate(const UpdateClientCertificateRequest& request) const
@@ -2335,7 +4116,7 @@ UpdateClientCertificateOutcome APIGatewayClient::UpdateClientCertificate(const U
   ss << m_uri << "/clientcertificates/";
   ss << request.GetClientCertificateId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateClientCertificate");
   if(outcome.IsSuccess())
   {
     return UpdateClientCertificateOutcome(UpdateClientCertificateResult(outcome.GetResult()));
@@ -2348,17 +4129,43 @@ UpdateClientCertificateOutcome APIGatewayClient::UpdateClientCertificate(const U
 
 UpdateClientCertificateOutcomeCallable APIGatewayClient::UpdateClientCertificateCallable(const UpdateClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateClientCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateClientCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateClientCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateClientCertificateOutcome > rejected;
+    rejected.set_value(UpdateClientCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateClientCertificateAsync(const UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateClientCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateClientCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateClientCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateClientCertificateAsyncHelper(const UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateClientCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/clientcertificates/";
+  ss << request.GetClientCertificateId();
+
+  auto sharedRequest = Aws::MakeShared<UpdateClientCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateClientCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateClientCertificateOutcome(UpdateClientCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateClientCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateDeploymentOutcome APIGatewayClient::UpdateDeployment(const UpdateDeploymentRequest& request) const
@@ -2369,7 +4176,7 @@ UpdateDeploymentOutcome APIGatewayClient::UpdateDeployment(const UpdateDeploymen
   ss << "/deployments/";
   ss << request.GetDeploymentId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateDeployment");
   if(outcome.IsSuccess())
   {
     return UpdateDeploymentOutcome(UpdateDeploymentResult(outcome.GetResult()));
@@ -2382,17 +4189,45 @@ UpdateDeploymentOutcome APIGatewayClient::UpdateDeployment(const UpdateDeploymen
 
 UpdateDeploymentOutcomeCallable APIGatewayClient::UpdateDeploymentCallable(const UpdateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateDeployment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateDeploymentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateDeployment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateDeploymentOutcome > rejected;
+    rejected.set_value(UpdateDeploymentOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateDeploymentAsync(const UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateDeploymentAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateDeploymentAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateDeploymentOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateDeploymentAsyncHelper(const UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateDeployment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/deployments/";
+  ss << request.GetDeploymentId();
+
+  auto sharedRequest = Aws::MakeShared<UpdateDeploymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateDeployment", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateDeploymentOutcome(UpdateDeploymentResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateDeploymentOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateDomainNameOutcome APIGatewayClient::UpdateDomainName(const UpdateDomainNameRequest& request) const
@@ -2401,7 +4236,7 @@ UpdateDomainNameOutcome APIGatewayClient::UpdateDomainName(const UpdateDomainNam
   ss << m_uri << "/domainnames/";
   ss << request.GetDomainName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateDomainName");
   if(outcome.IsSuccess())
   {
     return UpdateDomainNameOutcome(UpdateDomainNameResult(outcome.GetResult()));
@@ -2414,17 +4249,43 @@ UpdateDomainNameOutcome APIGatewayClient::UpdateDomainName(const UpdateDomainNam
 
 UpdateDomainNameOutcomeCallable APIGatewayClient::UpdateDomainNameCallable(const UpdateDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateDomainName, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateDomainNameOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateDomainName( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateDomainNameOutcome > rejected;
+    rejected.set_value(UpdateDomainNameOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateDomainNameAsync(const UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateDomainNameAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateDomainNameAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateDomainNameOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateDomainNameAsyncHelper(const UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateDomainName(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/domainnames/";
+  ss << request.GetDomainName();
+
+  auto sharedRequest = Aws::MakeShared<UpdateDomainNameRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateDomainName", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateDomainNameOutcome(UpdateDomainNameResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateDomainNameOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateIntegrationOutcome APIGatewayClient::UpdateIntegration(const UpdateIntegrationRequest& request) const
@@ -2438,7 +4299,7 @@ UpdateIntegrationOutcome APIGatewayClient::UpdateIntegration(const UpdateIntegra
   ss << request.GetHttpMethod();
   ss << "/integration";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateIntegration");
   if(outcome.IsSuccess())
   {
     return UpdateIntegrationOutcome(UpdateIntegrationResult(outcome.GetResult()));
@@ -2451,17 +4312,48 @@ UpdateIntegrationOutcome APIGatewayClient::UpdateIntegration(const UpdateIntegra
 
 UpdateIntegrationOutcomeCallable APIGatewayClient::UpdateIntegrationCallable(const UpdateIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateIntegration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateIntegrationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateIntegration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateIntegrationOutcome > rejected;
+    rejected.set_value(UpdateIntegrationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateIntegrationAsync(const UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateIntegrationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateIntegrationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateIntegrationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateIntegrationAsyncHelper(const UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateIntegration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration";
+
+  auto sharedRequest = Aws::MakeShared<UpdateIntegrationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateIntegration", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateIntegrationOutcome(UpdateIntegrationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateIntegrationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateIntegrationResponseOutcome APIGatewayClient::UpdateIntegrationResponse(const UpdateIntegrationResponseRequest& request) const
@@ -2476,7 +4368,7 @@ UpdateIntegrationResponseOutcome APIGatewayClient::UpdateIntegrationResponse(con
   ss << "/integration/responses/";
   ss << request.GetStatusCode();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateIntegrationResponse");
   if(outcome.IsSuccess())
   {
     return UpdateIntegrationResponseOutcome(UpdateIntegrationResponseResult(outcome.GetResult()));
@@ -2489,17 +4381,49 @@ UpdateIntegrationResponseOutcome APIGatewayClient::UpdateIntegrationResponse(con
 
 UpdateIntegrationResponseOutcomeCallable APIGatewayClient::UpdateIntegrationResponseCallable(const UpdateIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateIntegrationResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateIntegrationResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateIntegrationResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateIntegrationResponseOutcome > rejected;
+    rejected.set_value(UpdateIntegrationResponseOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateIntegrationResponseAsync(const UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateIntegrationResponseAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateIntegrationResponseAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateIntegrationResponseOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateIntegrationResponseAsyncHelper(const UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateIntegrationResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/integration/responses/";
+  ss << request.GetStatusCode();
+
+  auto sharedRequest = Aws::MakeShared<UpdateIntegrationResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateIntegrationResponse", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateIntegrationResponseOutcome(UpdateIntegrationResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateIntegrationResponseOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateMethodOutcome APIGatewayClient::UpdateMethod(const UpdateMethodRequest& request) const
@@ -2512,7 +4436,7 @@ UpdateMethodOutcome APIGatewayClient::UpdateMethod(const UpdateMethodRequest& re
   ss << "/methods/";
   ss << request.GetHttpMethod();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateMethod");
   if(outcome.IsSuccess())
   {
     return UpdateMethodOutcome(UpdateMethodResult(outcome.GetResult()));
@@ -2525,17 +4449,47 @@ UpdateMethodOutcome APIGatewayClient::UpdateMethod(const UpdateMethodRequest& re
 
 UpdateMethodOutcomeCallable APIGatewayClient::UpdateMethodCallable(const UpdateMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateMethod, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateMethodOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateMethod( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateMethodOutcome > rejected;
+    rejected.set_value(UpdateMethodOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateMethodAsync(const UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateMethodAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateMethodAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateMethodOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateMethodAsyncHelper(const UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateMethod(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+
+  auto sharedRequest = Aws::MakeShared<UpdateMethodRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateMethod", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateMethodOutcome(UpdateMethodResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateMethodOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateMethodResponseOutcome APIGatewayClient::UpdateMethodResponse(const UpdateMethodResponseRequest& request) const
@@ -2550,7 +4504,7 @@ UpdateMethodResponseOutcome APIGatewayClient::UpdateMethodResponse(const UpdateM
   ss << "/responses/";
   ss << request.GetStatusCode();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateMethodResponse");
   if(outcome.IsSuccess())
   {
     return UpdateMethodResponseOutcome(UpdateMethodResponseResult(outcome.GetResult()));
@@ -2563,17 +4517,49 @@ UpdateMethodResponseOutcome APIGatewayClient::UpdateMethodResponse(const UpdateM
 
 UpdateMethodResponseOutcomeCallable APIGatewayClient::UpdateMethodResponseCallable(const UpdateMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateMethodResponse, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateMethodResponseOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateMethodResponse( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateMethodResponseOutcome > rejected;
+    rejected.set_value(UpdateMethodResponseOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateMethodResponseAsync(const UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateMethodResponseAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateMethodResponseAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateMethodResponseOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateMethodResponseAsyncHelper(const UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateMethodResponse(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+  ss << "/methods/";
+  ss << request.GetHttpMethod();
+  ss << "/responses/";
+  ss << request.GetStatusCode();
+
+  auto sharedRequest = Aws::MakeShared<UpdateMethodResponseRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateMethodResponse", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateMethodResponseOutcome(UpdateMethodResponseResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateMethodResponseOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateModelOutcome APIGatewayClient::UpdateModel(const UpdateModelRequest& request) const
@@ -2584,7 +4570,7 @@ UpdateModelOutcome APIGatewayClient::UpdateModel(const UpdateModelRequest& reque
   ss << "/models/";
   ss << request.GetModelName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateModel");
   if(outcome.IsSuccess())
   {
     return UpdateModelOutcome(UpdateModelResult(outcome.GetResult()));
@@ -2597,17 +4583,45 @@ UpdateModelOutcome APIGatewayClient::UpdateModel(const UpdateModelRequest& reque
 
 UpdateModelOutcomeCallable APIGatewayClient::UpdateModelCallable(const UpdateModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateModel, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateModelOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateModel( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateModelOutcome > rejected;
+    rejected.set_value(UpdateModelOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateModelAsync(const UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateModelAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateModelAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateModelOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateModelAsyncHelper(const UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateModel(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/models/";
+  ss << request.GetModelName();
+
+  auto sharedRequest = Aws::MakeShared<UpdateModelRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateModel", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateModelOutcome(UpdateModelResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateModelOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateResourceOutcome APIGatewayClient::UpdateResource(const UpdateResourceRequest& request) const
@@ -2618,7 +4632,7 @@ UpdateResourceOutcome APIGatewayClient::UpdateResource(const UpdateResourceReque
   ss << "/resources/";
   ss << request.GetResourceId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateResource");
   if(outcome.IsSuccess())
   {
     return UpdateResourceOutcome(UpdateResourceResult(outcome.GetResult()));
@@ -2631,17 +4645,45 @@ UpdateResourceOutcome APIGatewayClient::UpdateResource(const UpdateResourceReque
 
 UpdateResourceOutcomeCallable APIGatewayClient::UpdateResourceCallable(const UpdateResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateResourceOutcome > rejected;
+    rejected.set_value(UpdateResourceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateResourceAsync(const UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateResourceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateResourceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateResourceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateResourceAsyncHelper(const UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/resources/";
+  ss << request.GetResourceId();
+
+  auto sharedRequest = Aws::MakeShared<UpdateResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateResource", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateResourceOutcome(UpdateResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateResourceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateRestApiOutcome APIGatewayClient::UpdateRestApi(const UpdateRestApiRequest& request) const
@@ -2650,7 +4692,7 @@ UpdateRestApiOutcome APIGatewayClient::UpdateRestApi(const UpdateRestApiRequest&
   ss << m_uri << "/restapis/";
   ss << request.GetRestApiId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateRestApi");
   if(outcome.IsSuccess())
   {
     return UpdateRestApiOutcome(UpdateRestApiResult(outcome.GetResult()));
@@ -2663,17 +4705,43 @@ UpdateRestApiOutcome APIGatewayClient::UpdateRestApi(const UpdateRestApiRequest&
 
 UpdateRestApiOutcomeCallable APIGatewayClient::UpdateRestApiCallable(const UpdateRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateRestApi, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateRestApiOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateRestApi( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateRestApiOutcome > rejected;
+    rejected.set_value(UpdateRestApiOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateRestApiAsync(const UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateRestApiAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateRestApiAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateRestApiOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateRestApiAsyncHelper(const UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateRestApi(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+
+  auto sharedRequest = Aws::MakeShared<UpdateRestApiRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateRestApi", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateRestApiOutcome(UpdateRestApiResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateRestApiOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateStageOutcome APIGatewayClient::UpdateStage(const UpdateStageRequest& request) const
@@ -2684,7 +4752,7 @@ UpdateStageOutcome APIGatewayClient::UpdateStage(const UpdateStageRequest& reque
   ss << "/stages/";
   ss << request.GetStageName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateStage");
   if(outcome.IsSuccess())
   {
     return UpdateStageOutcome(UpdateStageResult(outcome.GetResult()));
@@ -2697,16 +4765,44 @@ UpdateStageOutcome APIGatewayClient::UpdateStage(const UpdateStageRequest& reque
 
 UpdateStageOutcomeCallable APIGatewayClient::UpdateStageCallable(const UpdateStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateStage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateStageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateStage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateStageOutcome > rejected;
+    rejected.set_value(UpdateStageOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void APIGatewayClient::UpdateStageAsync(const UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateStageAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&APIGatewayClient::UpdateStageAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateStageOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void APIGatewayClient::UpdateStageAsyncHelper(const UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateStage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/restapis/";
+  ss << request.GetRestApiId();
+  ss << "/stages/";
+  ss << request.GetStageName();
+
+  auto sharedRequest = Aws::MakeShared<UpdateStageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateStage", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateStageOutcome(UpdateStageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateStageOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
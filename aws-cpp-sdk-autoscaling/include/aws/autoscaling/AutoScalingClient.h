@@ -51,6 +51,7 @@
 #include <aws/autoscaling/model/TerminateInstanceInAutoScalingGroupResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -371,6 +372,34 @@ namespace Model
          */
         virtual void AttachInstancesAsync(const Model::AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches one or more EC2 instances to the specified Auto Scaling group.</p>
+         * <p>When you attach instances, Auto Scaling increases the desired capacity of the
+         * group by the number of instances being attached. If the number of instances
+         * being attached plus the desired capacity of the group exceeds the maximum size
+         * of the group, the operation fails.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/attach-instance-asg.html">Attach
+         * EC2 Instances to Your Auto Scaling Group</a> in the <i>Auto Scaling Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachInstancesOutcome> AttachInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachInstancesOutcome>([this, request](const std::function<void(Model::AttachInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachInstancesAsync(request, [complete](const AutoScalingClient*, const Model::AttachInstancesRequest&, const Model::AttachInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches one or more load balancers to the specified Auto Scaling group.</p>
          * <p>To describe the load balancers for an Auto Scaling group, use
@@ -408,6 +437,33 @@ namespace Model
          */
         virtual void AttachLoadBalancersAsync(const Model::AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches one or more load balancers to the specified Auto Scaling group.</p>
+         * <p>To describe the load balancers for an Auto Scaling group, use
+         * <a>DescribeLoadBalancers</a>. To detach the load balancer from the Auto Scaling
+         * group, use <a>DetachLoadBalancers</a>.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/attach-load-balancer-asg.html">Attach
+         * a Load Balancer to Your Auto Scaling Group</a> in the <i>Auto Scaling Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachLoadBalancersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachLoadBalancersRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachLoadBalancersOutcome> AttachLoadBalancersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachLoadBalancersOutcome>([this, request](const std::function<void(Model::AttachLoadBalancersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachLoadBalancersAsync(request, [complete](const AutoScalingClient*, const Model::AttachLoadBalancersRequest&, const Model::AttachLoadBalancersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachLoadBalancersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Completes the lifecycle action for the specified token or instance with the
          * specified result.</p> <p>This step is a part of the procedure for adding a
@@ -466,6 +522,40 @@ namespace Model
          */
         virtual void CompleteLifecycleActionAsync(const Model::CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Completes the lifecycle action for the specified token or instance with the
+         * specified result.</p> <p>This step is a part of the procedure for adding a
+         * lifecycle hook to an Auto Scaling group:</p> <ol> <li>(Optional) Create a Lambda
+         * function and a rule that allows CloudWatch Events to invoke your Lambda function
+         * when Auto Scaling launches or terminates instances.</li> <li>(Optional) Create a
+         * notification target and an IAM role. The target can be either an Amazon SQS
+         * queue or an Amazon SNS topic. The role allows Auto Scaling to publish lifecycle
+         * notifications to the target.</li> <li>Create the lifecycle hook. Specify whether
+         * the hook is used when the instances launch or terminate.</li> <li>If you need
+         * more time, record the lifecycle action heartbeat to keep the instance in a
+         * pending state.</li> <li><b>If you finish before the timeout period ends,
+         * complete the lifecycle action.</b></li> </ol> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/AutoScalingGroupLifecycle.html">Auto
+         * Scaling Lifecycle</a> in the <i>Auto Scaling Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CompleteLifecycleActionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CompleteLifecycleActionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CompleteLifecycleActionOutcome> CompleteLifecycleActionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CompleteLifecycleActionOutcome>([this, request](const std::function<void(Model::CompleteLifecycleActionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CompleteLifecycleActionAsync(request, [complete](const AutoScalingClient*, const Model::CompleteLifecycleActionRequest&, const Model::CompleteLifecycleActionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CompleteLifecycleActionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an Auto Scaling group with the specified name and attributes.</p>
          * <p>If you exceed your maximum limit of Auto Scaling groups, which by default is
@@ -500,6 +590,32 @@ namespace Model
          */
         virtual void CreateAutoScalingGroupAsync(const Model::CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an Auto Scaling group with the specified name and attributes.</p>
+         * <p>If you exceed your maximum limit of Auto Scaling groups, which by default is
+         * 20 per region, the call fails. For information about viewing and updating this
+         * limit, see <a>DescribeAccountLimits</a>.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/AutoScalingGroup.html">Auto
+         * Scaling Groups</a> in the <i>Auto Scaling Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateAutoScalingGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAutoScalingGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAutoScalingGroupOutcome> CreateAutoScalingGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAutoScalingGroupOutcome>([this, request](const std::function<void(Model::CreateAutoScalingGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAutoScalingGroupAsync(request, [complete](const AutoScalingClient*, const Model::CreateAutoScalingGroupRequest&, const Model::CreateAutoScalingGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAutoScalingGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a launch configuration.</p> <p>If you exceed your maximum limit of
          * launch configurations, which by default is 100 per region, the call fails. For
@@ -534,6 +650,32 @@ namespace Model
          */
         virtual void CreateLaunchConfigurationAsync(const Model::CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a launch configuration.</p> <p>If you exceed your maximum limit of
+         * launch configurations, which by default is 100 per region, the call fails. For
+         * information about viewing and updating this limit, see
+         * <a>DescribeAccountLimits</a>.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/LaunchConfiguration.html">Launch
+         * Configurations</a> in the <i>Auto Scaling Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateLaunchConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateLaunchConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateLaunchConfigurationOutcome> CreateLaunchConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateLaunchConfigurationOutcome>([this, request](const std::function<void(Model::CreateLaunchConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateLaunchConfigurationAsync(request, [complete](const AutoScalingClient*, const Model::CreateLaunchConfigurationRequest&, const Model::CreateLaunchConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateLaunchConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates or updates tags for the specified Auto Scaling group.</p> <p>When you
          * specify a tag with a key that already exists, the operation overwrites the
@@ -571,6 +713,33 @@ namespace Model
          */
         virtual void CreateOrUpdateTagsAsync(const Model::CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates or updates tags for the specified Auto Scaling group.</p> <p>When you
+         * specify a tag with a key that already exists, the operation overwrites the
+         * previous tag definition, and you do not get an error message.</p> <p>For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/ASTagging.html">Tagging
+         * Auto Scaling Groups and Instances</a> in the <i>Auto Scaling Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateOrUpdateTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateOrUpdateTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateOrUpdateTagsOutcome> CreateOrUpdateTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateOrUpdateTagsOutcome>([this, request](const std::function<void(Model::CreateOrUpdateTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateOrUpdateTagsAsync(request, [complete](const AutoScalingClient*, const Model::CreateOrUpdateTagsRequest&, const Model::CreateOrUpdateTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateOrUpdateTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified Auto Scaling group.</p> <p>If the group has instances
          * or scaling activities in progress, you must specify the option to force the
@@ -617,6 +786,36 @@ namespace Model
          */
         virtual void DeleteAutoScalingGroupAsync(const Model::DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified Auto Scaling group.</p> <p>If the group has instances
+         * or scaling activities in progress, you must specify the option to force the
+         * deletion in order for it to succeed.</p> <p>If the group has policies, deleting
+         * the group deletes the policies, the underlying alarm actions, and any alarm that
+         * no longer has an associated action.</p> <p>To remove instances from the Auto
+         * Scaling group before deleting it, call <a>DetachInstances</a> with the list of
+         * instances and the option to decrement the desired capacity so that Auto Scaling
+         * does not launch replacement instances.</p> <p>To terminate all instances before
+         * deleting the Auto Scaling group, call <a>UpdateAutoScalingGroup</a> and set the
+         * minimum size and desired capacity of the Auto Scaling group to zero.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAutoScalingGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAutoScalingGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAutoScalingGroupOutcome> DeleteAutoScalingGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAutoScalingGroupOutcome>([this, request](const std::function<void(Model::DeleteAutoScalingGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAutoScalingGroupAsync(request, [complete](const AutoScalingClient*, const Model::DeleteAutoScalingGroupRequest&, const Model::DeleteAutoScalingGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAutoScalingGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified launch configuration.</p> <p>The launch configuration
          * must not be attached to an Auto Scaling group. When this call completes, the
@@ -642,6 +841,29 @@ namespace Model
          */
         virtual void DeleteLaunchConfigurationAsync(const Model::DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified launch configuration.</p> <p>The launch configuration
+         * must not be attached to an Auto Scaling group. When this call completes, the
+         * launch configuration is no longer available for use.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteLaunchConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteLaunchConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteLaunchConfigurationOutcome> DeleteLaunchConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteLaunchConfigurationOutcome>([this, request](const std::function<void(Model::DeleteLaunchConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteLaunchConfigurationAsync(request, [complete](const AutoScalingClient*, const Model::DeleteLaunchConfigurationRequest&, const Model::DeleteLaunchConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteLaunchConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified lifecycle hook.</p> <p>If there are any outstanding
          * lifecycle actions, they are completed first (<code>ABANDON</code> for launching
@@ -667,6 +889,29 @@ namespace Model
          */
         virtual void DeleteLifecycleHookAsync(const Model::DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified lifecycle hook.</p> <p>If there are any outstanding
+         * lifecycle actions, they are completed first (<code>ABANDON</code> for launching
+         * instances, <code>CONTINUE</code> for terminating instances).</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteLifecycleHookAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteLifecycleHookRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteLifecycleHookOutcome> DeleteLifecycleHookAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteLifecycleHookOutcome>([this, request](const std::function<void(Model::DeleteLifecycleHookOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteLifecycleHookAsync(request, [complete](const AutoScalingClient*, const Model::DeleteLifecycleHookRequest&, const Model::DeleteLifecycleHookOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteLifecycleHookOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified notification.</p>
          */
@@ -686,6 +931,27 @@ namespace Model
          */
         virtual void DeleteNotificationConfigurationAsync(const Model::DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified notification.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteNotificationConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteNotificationConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteNotificationConfigurationOutcome> DeleteNotificationConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteNotificationConfigurationOutcome>([this, request](const std::function<void(Model::DeleteNotificationConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteNotificationConfigurationAsync(request, [complete](const AutoScalingClient*, const Model::DeleteNotificationConfigurationRequest&, const Model::DeleteNotificationConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteNotificationConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified Auto Scaling policy.</p> <p>Deleting a policy deletes
          * the underlying alarm action, but does not delete the alarm, even if it no longer
@@ -711,6 +977,29 @@ namespace Model
          */
         virtual void DeletePolicyAsync(const Model::DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified Auto Scaling policy.</p> <p>Deleting a policy deletes
+         * the underlying alarm action, but does not delete the alarm, even if it no longer
+         * has an associated action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeletePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeletePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeletePolicyOutcome> DeletePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeletePolicyOutcome>([this, request](const std::function<void(Model::DeletePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeletePolicyAsync(request, [complete](const AutoScalingClient*, const Model::DeletePolicyRequest&, const Model::DeletePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeletePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified scheduled action.</p>
          */
@@ -730,6 +1019,27 @@ namespace Model
          */
         virtual void DeleteScheduledActionAsync(const Model::DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified scheduled action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteScheduledActionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteScheduledActionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteScheduledActionOutcome> DeleteScheduledActionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteScheduledActionOutcome>([this, request](const std::function<void(Model::DeleteScheduledActionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteScheduledActionAsync(request, [complete](const AutoScalingClient*, const Model::DeleteScheduledActionRequest&, const Model::DeleteScheduledActionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteScheduledActionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified tags.</p>
          */
@@ -749,6 +1059,27 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified tags.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTagsOutcome>([this, request](const std::function<void(Model::DeleteTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTagsAsync(request, [complete](const AutoScalingClient*, const Model::DeleteTagsRequest&, const Model::DeleteTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the current Auto Scaling resource limits for your AWS account.</p>
          * <p>For information about requesting an increase in these limits, see <a
@@ -777,6 +1108,30 @@ namespace Model
          */
         virtual void DescribeAccountLimitsAsync(const Model::DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the current Auto Scaling resource limits for your AWS account.</p>
+         * <p>For information about requesting an increase in these limits, see <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/aws_service_limits.html">AWS
+         * Service Limits</a> in the <i>Amazon Web Services General Reference</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAccountLimitsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAccountLimitsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAccountLimitsOutcome> DescribeAccountLimitsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAccountLimitsOutcome>([this, request](const std::function<void(Model::DescribeAccountLimitsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAccountLimitsAsync(request, [complete](const AutoScalingClient*, const Model::DescribeAccountLimitsRequest&, const Model::DescribeAccountLimitsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAccountLimitsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the policy adjustment types for use with
          * <a>PutScalingPolicy</a>.</p>
@@ -799,6 +1154,28 @@ namespace Model
          */
         virtual void DescribeAdjustmentTypesAsync(const Model::DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the policy adjustment types for use with
+         * <a>PutScalingPolicy</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAdjustmentTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAdjustmentTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAdjustmentTypesOutcome> DescribeAdjustmentTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAdjustmentTypesOutcome>([this, request](const std::function<void(Model::DescribeAdjustmentTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAdjustmentTypesAsync(request, [complete](const AutoScalingClient*, const Model::DescribeAdjustmentTypesRequest&, const Model::DescribeAdjustmentTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAdjustmentTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more Auto Scaling groups. If a list of names is not
          * provided, the call describes all Auto Scaling groups.</p>
@@ -821,6 +1198,28 @@ namespace Model
          */
         virtual void DescribeAutoScalingGroupsAsync(const Model::DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more Auto Scaling groups. If a list of names is not
+         * provided, the call describes all Auto Scaling groups.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAutoScalingGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAutoScalingGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAutoScalingGroupsOutcome> DescribeAutoScalingGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAutoScalingGroupsOutcome>([this, request](const std::function<void(Model::DescribeAutoScalingGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAutoScalingGroupsAsync(request, [complete](const AutoScalingClient*, const Model::DescribeAutoScalingGroupsRequest&, const Model::DescribeAutoScalingGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAutoScalingGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more Auto Scaling instances. If a list is not provided, the
          * call describes all instances.</p>
@@ -843,6 +1242,28 @@ namespace Model
          */
         virtual void DescribeAutoScalingInstancesAsync(const Model::DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more Auto Scaling instances. If a list is not provided, the
+         * call describes all instances.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAutoScalingInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAutoScalingInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAutoScalingInstancesOutcome> DescribeAutoScalingInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAutoScalingInstancesOutcome>([this, request](const std::function<void(Model::DescribeAutoScalingInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAutoScalingInstancesAsync(request, [complete](const AutoScalingClient*, const Model::DescribeAutoScalingInstancesRequest&, const Model::DescribeAutoScalingInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAutoScalingInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the notification types that are supported by Auto Scaling.</p>
          */
@@ -862,6 +1283,27 @@ namespace Model
          */
         virtual void DescribeAutoScalingNotificationTypesAsync(const Model::DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the notification types that are supported by Auto Scaling.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAutoScalingNotificationTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAutoScalingNotificationTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAutoScalingNotificationTypesOutcome> DescribeAutoScalingNotificationTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAutoScalingNotificationTypesOutcome>([this, request](const std::function<void(Model::DescribeAutoScalingNotificationTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAutoScalingNotificationTypesAsync(request, [complete](const AutoScalingClient*, const Model::DescribeAutoScalingNotificationTypesRequest&, const Model::DescribeAutoScalingNotificationTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAutoScalingNotificationTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more launch configurations. If you omit the list of names,
          * then the call describes all launch configurations.</p>
@@ -884,6 +1326,28 @@ namespace Model
          */
         virtual void DescribeLaunchConfigurationsAsync(const Model::DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more launch configurations. If you omit the list of names,
+         * then the call describes all launch configurations.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLaunchConfigurationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLaunchConfigurationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLaunchConfigurationsOutcome> DescribeLaunchConfigurationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLaunchConfigurationsOutcome>([this, request](const std::function<void(Model::DescribeLaunchConfigurationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLaunchConfigurationsAsync(request, [complete](const AutoScalingClient*, const Model::DescribeLaunchConfigurationsRequest&, const Model::DescribeLaunchConfigurationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLaunchConfigurationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the available types of lifecycle hooks.</p>
          */
@@ -903,6 +1367,27 @@ namespace Model
          */
         virtual void DescribeLifecycleHookTypesAsync(const Model::DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the available types of lifecycle hooks.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLifecycleHookTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLifecycleHookTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLifecycleHookTypesOutcome> DescribeLifecycleHookTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLifecycleHookTypesOutcome>([this, request](const std::function<void(Model::DescribeLifecycleHookTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLifecycleHookTypesAsync(request, [complete](const AutoScalingClient*, const Model::DescribeLifecycleHookTypesRequest&, const Model::DescribeLifecycleHookTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLifecycleHookTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the lifecycle hooks for the specified Auto Scaling group.</p>
          */
@@ -922,6 +1407,27 @@ namespace Model
          */
         virtual void DescribeLifecycleHooksAsync(const Model::DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the lifecycle hooks for the specified Auto Scaling group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLifecycleHooksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLifecycleHooksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLifecycleHooksOutcome> DescribeLifecycleHooksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLifecycleHooksOutcome>([this, request](const std::function<void(Model::DescribeLifecycleHooksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLifecycleHooksAsync(request, [complete](const AutoScalingClient*, const Model::DescribeLifecycleHooksRequest&, const Model::DescribeLifecycleHooksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLifecycleHooksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the load balancers for the specified Auto Scaling group.</p>
          */
@@ -941,6 +1447,27 @@ namespace Model
          */
         virtual void DescribeLoadBalancersAsync(const Model::DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the load balancers for the specified Auto Scaling group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLoadBalancersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLoadBalancersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLoadBalancersOutcome>([this, request](const std::function<void(Model::DescribeLoadBalancersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLoadBalancersAsync(request, [complete](const AutoScalingClient*, const Model::DescribeLoadBalancersRequest&, const Model::DescribeLoadBalancersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLoadBalancersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the available CloudWatch metrics for Auto Scaling.</p> <p>Note that
          * the <code>GroupStandbyInstances</code> metric is not returned by default. You
@@ -969,6 +1496,30 @@ namespace Model
          */
         virtual void DescribeMetricCollectionTypesAsync(const Model::DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the available CloudWatch metrics for Auto Scaling.</p> <p>Note that
+         * the <code>GroupStandbyInstances</code> metric is not returned by default. You
+         * must explicitly request this metric when calling
+         * <a>EnableMetricsCollection</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeMetricCollectionTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeMetricCollectionTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeMetricCollectionTypesOutcome> DescribeMetricCollectionTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeMetricCollectionTypesOutcome>([this, request](const std::function<void(Model::DescribeMetricCollectionTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeMetricCollectionTypesAsync(request, [complete](const AutoScalingClient*, const Model::DescribeMetricCollectionTypesRequest&, const Model::DescribeMetricCollectionTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeMetricCollectionTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the notification actions associated with the specified Auto Scaling
          * group.</p>
@@ -991,6 +1542,28 @@ namespace Model
          */
         virtual void DescribeNotificationConfigurationsAsync(const Model::DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the notification actions associated with the specified Auto Scaling
+         * group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeNotificationConfigurationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeNotificationConfigurationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeNotificationConfigurationsOutcome> DescribeNotificationConfigurationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeNotificationConfigurationsOutcome>([this, request](const std::function<void(Model::DescribeNotificationConfigurationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeNotificationConfigurationsAsync(request, [complete](const AutoScalingClient*, const Model::DescribeNotificationConfigurationsRequest&, const Model::DescribeNotificationConfigurationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeNotificationConfigurationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the policies for the specified Auto Scaling group.</p>
          */
@@ -1010,6 +1583,27 @@ namespace Model
          */
         virtual void DescribePoliciesAsync(const Model::DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the policies for the specified Auto Scaling group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribePoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribePoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribePoliciesOutcome> DescribePoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribePoliciesOutcome>([this, request](const std::function<void(Model::DescribePoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribePoliciesAsync(request, [complete](const AutoScalingClient*, const Model::DescribePoliciesRequest&, const Model::DescribePoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribePoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more scaling activities for the specified Auto Scaling
          * group. If you omit the <code>ActivityIds</code>, the call returns all activities
@@ -1038,6 +1632,30 @@ namespace Model
          */
         virtual void DescribeScalingActivitiesAsync(const Model::DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more scaling activities for the specified Auto Scaling
+         * group. If you omit the <code>ActivityIds</code>, the call returns all activities
+         * from the past six weeks. Activities are sorted by the start time. Activities
+         * still in progress appear first on the list.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeScalingActivitiesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeScalingActivitiesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeScalingActivitiesOutcome> DescribeScalingActivitiesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeScalingActivitiesOutcome>([this, request](const std::function<void(Model::DescribeScalingActivitiesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeScalingActivitiesAsync(request, [complete](const AutoScalingClient*, const Model::DescribeScalingActivitiesRequest&, const Model::DescribeScalingActivitiesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeScalingActivitiesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the scaling process types for use with <a>ResumeProcesses</a> and
          * <a>SuspendProcesses</a>.</p>
@@ -1060,6 +1678,28 @@ namespace Model
          */
         virtual void DescribeScalingProcessTypesAsync(const Model::DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the scaling process types for use with <a>ResumeProcesses</a> and
+         * <a>SuspendProcesses</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeScalingProcessTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeScalingProcessTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeScalingProcessTypesOutcome> DescribeScalingProcessTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeScalingProcessTypesOutcome>([this, request](const std::function<void(Model::DescribeScalingProcessTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeScalingProcessTypesAsync(request, [complete](const AutoScalingClient*, const Model::DescribeScalingProcessTypesRequest&, const Model::DescribeScalingProcessTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeScalingProcessTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the actions scheduled for your Auto Scaling group that haven't run.
          * To describe the actions that have already run, use
@@ -1085,6 +1725,29 @@ namespace Model
          */
         virtual void DescribeScheduledActionsAsync(const Model::DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the actions scheduled for your Auto Scaling group that haven't run.
+         * To describe the actions that have already run, use
+         * <a>DescribeScalingActivities</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeScheduledActionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeScheduledActionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeScheduledActionsOutcome> DescribeScheduledActionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeScheduledActionsOutcome>([this, request](const std::function<void(Model::DescribeScheduledActionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeScheduledActionsAsync(request, [complete](const AutoScalingClient*, const Model::DescribeScheduledActionsRequest&, const Model::DescribeScheduledActionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeScheduledActionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified tags.</p> <p>You can use filters to limit the
          * results. For example, you can query for the tags for a specific Auto Scaling
@@ -1122,6 +1785,33 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified tags.</p> <p>You can use filters to limit the
+         * results. For example, you can query for the tags for a specific Auto Scaling
+         * group. You can specify multiple values for a filter. A tag must match at least
+         * one of the specified values for it to be included in the results.</p> <p>You can
+         * also specify multiple filters. The result includes information for a particular
+         * tag only if it matches all the filters. If there's no match, no special message
+         * is returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTagsOutcome>([this, request](const std::function<void(Model::DescribeTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTagsAsync(request, [complete](const AutoScalingClient*, const Model::DescribeTagsRequest&, const Model::DescribeTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the termination policies supported by Auto Scaling.</p>
          */
@@ -1141,6 +1831,27 @@ namespace Model
          */
         virtual void DescribeTerminationPolicyTypesAsync(const Model::DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the termination policies supported by Auto Scaling.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTerminationPolicyTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTerminationPolicyTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTerminationPolicyTypesOutcome> DescribeTerminationPolicyTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTerminationPolicyTypesOutcome>([this, request](const std::function<void(Model::DescribeTerminationPolicyTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTerminationPolicyTypesAsync(request, [complete](const AutoScalingClient*, const Model::DescribeTerminationPolicyTypesRequest&, const Model::DescribeTerminationPolicyTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTerminationPolicyTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes one or more instances from the specified Auto Scaling group.</p>
          * <p>After the instances are detached, you can manage them independently from the
@@ -1181,6 +1892,34 @@ namespace Model
          */
         virtual void DetachInstancesAsync(const Model::DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes one or more instances from the specified Auto Scaling group.</p>
+         * <p>After the instances are detached, you can manage them independently from the
+         * rest of the Auto Scaling group.</p> <p>If you do not specify the option to
+         * decrement the desired capacity, Auto Scaling launches instances to replace the
+         * ones that are detached.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/detach-instance-asg.html">Detach
+         * EC2 Instances from Your Auto Scaling Group</a> in the <i>Auto Scaling Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachInstancesOutcome> DetachInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachInstancesOutcome>([this, request](const std::function<void(Model::DetachInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachInstancesAsync(request, [complete](const AutoScalingClient*, const Model::DetachInstancesRequest&, const Model::DetachInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes one or more load balancers from the specified Auto Scaling group.</p>
          * <p>When you detach a load balancer, it enters the <code>Removing</code> state
@@ -1212,6 +1951,31 @@ namespace Model
          */
         virtual void DetachLoadBalancersAsync(const Model::DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes one or more load balancers from the specified Auto Scaling group.</p>
+         * <p>When you detach a load balancer, it enters the <code>Removing</code> state
+         * while deregistering the instances in the group. When all instances are
+         * deregistered, then you can no longer describe the load balancer using
+         * <a>DescribeLoadBalancers</a>. Note that the instances remain running.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachLoadBalancersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachLoadBalancersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachLoadBalancersOutcome> DetachLoadBalancersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachLoadBalancersOutcome>([this, request](const std::function<void(Model::DetachLoadBalancersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachLoadBalancersAsync(request, [complete](const AutoScalingClient*, const Model::DetachLoadBalancersRequest&, const Model::DetachLoadBalancersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachLoadBalancersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables monitoring of the specified metrics for the specified Auto Scaling
          * group.</p>
@@ -1234,6 +1998,28 @@ namespace Model
          */
         virtual void DisableMetricsCollectionAsync(const Model::DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables monitoring of the specified metrics for the specified Auto Scaling
+         * group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableMetricsCollectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableMetricsCollectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableMetricsCollectionOutcome> DisableMetricsCollectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableMetricsCollectionOutcome>([this, request](const std::function<void(Model::DisableMetricsCollectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableMetricsCollectionAsync(request, [complete](const AutoScalingClient*, const Model::DisableMetricsCollectionRequest&, const Model::DisableMetricsCollectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableMetricsCollectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables monitoring of the specified metrics for the specified Auto Scaling
          * group.</p> <p>You can only enable metrics collection if
@@ -1262,6 +2048,30 @@ namespace Model
          */
         virtual void EnableMetricsCollectionAsync(const Model::EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables monitoring of the specified metrics for the specified Auto Scaling
+         * group.</p> <p>You can only enable metrics collection if
+         * <code>InstanceMonitoring</code> in the launch configuration for the group is set
+         * to <code>True</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableMetricsCollectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableMetricsCollectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableMetricsCollectionOutcome> EnableMetricsCollectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableMetricsCollectionOutcome>([this, request](const std::function<void(Model::EnableMetricsCollectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableMetricsCollectionAsync(request, [complete](const AutoScalingClient*, const Model::EnableMetricsCollectionRequest&, const Model::EnableMetricsCollectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableMetricsCollectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Moves the specified instances into <code>Standby</code> mode.</p> <p>For more
          * information, see <a
@@ -1290,6 +2100,30 @@ namespace Model
          */
         virtual void EnterStandbyAsync(const Model::EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Moves the specified instances into <code>Standby</code> mode.</p> <p>For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/AutoScalingGroupLifecycle.html">Auto
+         * Scaling Lifecycle</a> in the <i>Auto Scaling Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnterStandbyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnterStandbyRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnterStandbyOutcome> EnterStandbyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnterStandbyOutcome>([this, request](const std::function<void(Model::EnterStandbyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnterStandbyAsync(request, [complete](const AutoScalingClient*, const Model::EnterStandbyRequest&, const Model::EnterStandbyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnterStandbyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Executes the specified policy.</p>
          */
@@ -1309,6 +2143,27 @@ namespace Model
          */
         virtual void ExecutePolicyAsync(const Model::ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Executes the specified policy.</p>
+         *
+         * Returns an awaitable that starts the operation the way ExecutePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ExecutePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::ExecutePolicyOutcome> ExecutePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ExecutePolicyOutcome>([this, request](const std::function<void(Model::ExecutePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ExecutePolicyAsync(request, [complete](const AutoScalingClient*, const Model::ExecutePolicyRequest&, const Model::ExecutePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ExecutePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Moves the specified instances out of <code>Standby</code> mode.</p> <p>For
          * more information, see <a
@@ -1337,6 +2192,30 @@ namespace Model
          */
         virtual void ExitStandbyAsync(const Model::ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Moves the specified instances out of <code>Standby</code> mode.</p> <p>For
+         * more information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/AutoScalingGroupLifecycle.html">Auto
+         * Scaling Lifecycle</a> in the <i>Auto Scaling Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ExitStandbyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ExitStandbyRequest>
+        Aws::Utils::Threading::Awaitable<Model::ExitStandbyOutcome> ExitStandbyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ExitStandbyOutcome>([this, request](const std::function<void(Model::ExitStandbyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ExitStandbyAsync(request, [complete](const AutoScalingClient*, const Model::ExitStandbyRequest&, const Model::ExitStandbyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ExitStandbyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates or updates a lifecycle hook for the specified Auto Scaling Group.</p>
          * <p>A lifecycle hook tells Auto Scaling that you want to perform an action on an
@@ -1416,6 +2295,47 @@ namespace Model
          */
         virtual void PutLifecycleHookAsync(const Model::PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates or updates a lifecycle hook for the specified Auto Scaling Group.</p>
+         * <p>A lifecycle hook tells Auto Scaling that you want to perform an action on an
+         * instance that is not actively in service; for example, either when the instance
+         * launches or before the instance terminates.</p> <p>This step is a part of the
+         * procedure for adding a lifecycle hook to an Auto Scaling group:</p> <ol>
+         * <li>(Optional) Create a Lambda function and a rule that allows CloudWatch Events
+         * to invoke your Lambda function when Auto Scaling launches or terminates
+         * instances.</li> <li>(Optional) Create a notification target and an IAM role. The
+         * target can be either an Amazon SQS queue or an Amazon SNS topic. The role allows
+         * Auto Scaling to publish lifecycle notifications to the target.</li>
+         * <li><b>Create the lifecycle hook. Specify whether the hook is used when the
+         * instances launch or terminate.</b></li> <li>If you need more time, record the
+         * lifecycle action heartbeat to keep the instance in a pending state.</li> <li>If
+         * you finish before the timeout period ends, complete the lifecycle action.</li>
+         * </ol> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/AutoScalingGroupLifecycle.html">Auto
+         * Scaling Lifecycle</a> in the <i>Auto Scaling Developer Guide</i>.</p> <p>If you
+         * exceed your maximum limit of lifecycle hooks, which by default is 50 per region,
+         * the call fails. For information about updating this limit, see <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/aws_service_limits.html">AWS
+         * Service Limits</a> in the <i>Amazon Web Services General Reference</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutLifecycleHookAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutLifecycleHookRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutLifecycleHookOutcome> PutLifecycleHookAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutLifecycleHookOutcome>([this, request](const std::function<void(Model::PutLifecycleHookOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutLifecycleHookAsync(request, [complete](const AutoScalingClient*, const Model::PutLifecycleHookRequest&, const Model::PutLifecycleHookOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutLifecycleHookOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Configures an Auto Scaling group to send notifications when specified events
          * take place. Subscribers to this topic can have messages for events delivered to
@@ -1456,6 +2376,34 @@ namespace Model
          */
         virtual void PutNotificationConfigurationAsync(const Model::PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Configures an Auto Scaling group to send notifications when specified events
+         * take place. Subscribers to this topic can have messages for events delivered to
+         * an endpoint such as a web server or email address. </p> <p>For more information
+         * see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/ASGettingNotifications.html">Getting
+         * Notifications When Your Auto Scaling Group Changes</a> in the <i>Auto Scaling
+         * Developer Guide</i>.</p> <p>This configuration overwrites an existing
+         * configuration.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutNotificationConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutNotificationConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutNotificationConfigurationOutcome> PutNotificationConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutNotificationConfigurationOutcome>([this, request](const std::function<void(Model::PutNotificationConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutNotificationConfigurationAsync(request, [complete](const AutoScalingClient*, const Model::PutNotificationConfigurationRequest&, const Model::PutNotificationConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutNotificationConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates or updates a policy for an Auto Scaling group. To update an existing
          * policy, use the existing policy name and set the parameters you want to change.
@@ -1496,6 +2444,34 @@ namespace Model
          */
         virtual void PutScalingPolicyAsync(const Model::PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates or updates a policy for an Auto Scaling group. To update an existing
+         * policy, use the existing policy name and set the parameters you want to change.
+         * Any existing parameter not changed in an update to an existing policy is not
+         * changed in this update request.</p> <p>If you exceed your maximum limit of step
+         * adjustments, which by default is 20 per region, the call fails. For information
+         * about updating this limit, see <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/aws_service_limits.html">AWS
+         * Service Limits</a> in the <i>Amazon Web Services General Reference</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutScalingPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutScalingPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutScalingPolicyOutcome> PutScalingPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutScalingPolicyOutcome>([this, request](const std::function<void(Model::PutScalingPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutScalingPolicyAsync(request, [complete](const AutoScalingClient*, const Model::PutScalingPolicyRequest&, const Model::PutScalingPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutScalingPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates or updates a scheduled scaling action for an Auto Scaling group.
          * When updating a scheduled scaling action, if you leave a parameter unspecified,
@@ -1530,6 +2506,32 @@ namespace Model
          */
         virtual void PutScheduledUpdateGroupActionAsync(const Model::PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates or updates a scheduled scaling action for an Auto Scaling group.
+         * When updating a scheduled scaling action, if you leave a parameter unspecified,
+         * the corresponding value remains unchanged in the affected Auto Scaling group.
+         * </p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/schedule_time.html">Scheduled
+         * Scaling</a> in the <i>Auto Scaling Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutScheduledUpdateGroupActionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutScheduledUpdateGroupActionRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutScheduledUpdateGroupActionOutcome> PutScheduledUpdateGroupActionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutScheduledUpdateGroupActionOutcome>([this, request](const std::function<void(Model::PutScheduledUpdateGroupActionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutScheduledUpdateGroupActionAsync(request, [complete](const AutoScalingClient*, const Model::PutScheduledUpdateGroupActionRequest&, const Model::PutScheduledUpdateGroupActionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutScheduledUpdateGroupActionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Records a heartbeat for the lifecycle action associated with the specified
          * token or instance. This extends the timeout by the length of time defined using
@@ -1594,6 +2596,42 @@ namespace Model
          */
         virtual void RecordLifecycleActionHeartbeatAsync(const Model::RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Records a heartbeat for the lifecycle action associated with the specified
+         * token or instance. This extends the timeout by the length of time defined using
+         * <a>PutLifecycleHook</a>.</p> <p>This step is a part of the procedure for adding
+         * a lifecycle hook to an Auto Scaling group:</p> <ol> <li>(Optional) Create a
+         * Lambda function and a rule that allows CloudWatch Events to invoke your Lambda
+         * function when Auto Scaling launches or terminates instances.</li> <li>(Optional)
+         * Create a notification target and an IAM role. The target can be either an Amazon
+         * SQS queue or an Amazon SNS topic. The role allows Auto Scaling to publish
+         * lifecycle notifications to the target.</li> <li>Create the lifecycle hook.
+         * Specify whether the hook is used when the instances launch or terminate.</li>
+         * <li><b>If you need more time, record the lifecycle action heartbeat to keep the
+         * instance in a pending state.</b></li> <li>If you finish before the timeout
+         * period ends, complete the lifecycle action.</li> </ol> <p>For more information,
+         * see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/AutoScalingGroupLifecycle.html">Auto
+         * Scaling Lifecycle</a> in the <i>Auto Scaling Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RecordLifecycleActionHeartbeatAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RecordLifecycleActionHeartbeatRequest>
+        Aws::Utils::Threading::Awaitable<Model::RecordLifecycleActionHeartbeatOutcome> RecordLifecycleActionHeartbeatAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RecordLifecycleActionHeartbeatOutcome>([this, request](const std::function<void(Model::RecordLifecycleActionHeartbeatOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RecordLifecycleActionHeartbeatAsync(request, [complete](const AutoScalingClient*, const Model::RecordLifecycleActionHeartbeatRequest&, const Model::RecordLifecycleActionHeartbeatOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RecordLifecycleActionHeartbeatOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Resumes the specified suspended Auto Scaling processes, or all suspended
          * process, for the specified Auto Scaling group.</p> <p>For more information, see
@@ -1628,6 +2666,32 @@ namespace Model
          */
         virtual void ResumeProcessesAsync(const Model::ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Resumes the specified suspended Auto Scaling processes, or all suspended
+         * process, for the specified Auto Scaling group.</p> <p>For more information, see
+         * <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/US_SuspendResume.html">Suspending
+         * and Resuming Auto Scaling Processes</a> in the <i>Auto Scaling Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ResumeProcessesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResumeProcessesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResumeProcessesOutcome> ResumeProcessesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResumeProcessesOutcome>([this, request](const std::function<void(Model::ResumeProcessesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResumeProcessesAsync(request, [complete](const AutoScalingClient*, const Model::ResumeProcessesRequest&, const Model::ResumeProcessesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResumeProcessesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the size of the specified Auto Scaling group.</p> <p>For more
          * information about desired capacity, see <a
@@ -1656,6 +2720,30 @@ namespace Model
          */
         virtual void SetDesiredCapacityAsync(const Model::SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the size of the specified Auto Scaling group.</p> <p>For more
+         * information about desired capacity, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/WhatIsAutoScaling.html">What
+         * Is Auto Scaling?</a> in the <i>Auto Scaling Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetDesiredCapacityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetDesiredCapacityRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetDesiredCapacityOutcome> SetDesiredCapacityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetDesiredCapacityOutcome>([this, request](const std::function<void(Model::SetDesiredCapacityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetDesiredCapacityAsync(request, [complete](const AutoScalingClient*, const Model::SetDesiredCapacityRequest&, const Model::SetDesiredCapacityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetDesiredCapacityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the health status of the specified instance.</p> <p>For more
          * information, see <a
@@ -1684,6 +2772,30 @@ namespace Model
          */
         virtual void SetInstanceHealthAsync(const Model::SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the health status of the specified instance.</p> <p>For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/healthcheck.html">Health
+         * Checks</a> in the <i>Auto Scaling Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetInstanceHealthAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetInstanceHealthRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetInstanceHealthOutcome> SetInstanceHealthAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetInstanceHealthOutcome>([this, request](const std::function<void(Model::SetInstanceHealthOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetInstanceHealthAsync(request, [complete](const AutoScalingClient*, const Model::SetInstanceHealthRequest&, const Model::SetInstanceHealthOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetInstanceHealthOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the instance protection settings of the specified instances.</p>
          * <p>For more information, see <a
@@ -1712,6 +2824,30 @@ namespace Model
          */
         virtual void SetInstanceProtectionAsync(const Model::SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the instance protection settings of the specified instances.</p>
+         * <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/AutoScalingBehavior.InstanceTermination.html#instance-protection">Instance
+         * Protection</a> in the <i>Auto Scaling Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetInstanceProtectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetInstanceProtectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetInstanceProtectionOutcome> SetInstanceProtectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetInstanceProtectionOutcome>([this, request](const std::function<void(Model::SetInstanceProtectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetInstanceProtectionAsync(request, [complete](const AutoScalingClient*, const Model::SetInstanceProtectionRequest&, const Model::SetInstanceProtectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetInstanceProtectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Suspends the specified Auto Scaling processes, or all processes, for the
          * specified Auto Scaling group.</p> <p>Note that if you suspend either the
@@ -1755,6 +2891,35 @@ namespace Model
          */
         virtual void SuspendProcessesAsync(const Model::SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Suspends the specified Auto Scaling processes, or all processes, for the
+         * specified Auto Scaling group.</p> <p>Note that if you suspend either the
+         * <code>Launch</code> or <code>Terminate</code> process types, it can prevent
+         * other process types from functioning properly.</p> <p>To resume processes that
+         * have been suspended, use <a>ResumeProcesses</a>.</p> <p>For more information,
+         * see <a
+         * href="http://docs.aws.amazon.com/AutoScaling/latest/DeveloperGuide/US_SuspendResume.html">Suspending
+         * and Resuming Auto Scaling Processes</a> in the <i>Auto Scaling Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SuspendProcessesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SuspendProcessesRequest>
+        Aws::Utils::Threading::Awaitable<Model::SuspendProcessesOutcome> SuspendProcessesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SuspendProcessesOutcome>([this, request](const std::function<void(Model::SuspendProcessesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SuspendProcessesAsync(request, [complete](const AutoScalingClient*, const Model::SuspendProcessesRequest&, const Model::SuspendProcessesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SuspendProcessesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Terminates the specified instance and optionally adjusts the desired group
          * size.</p> <p>This call simply makes a termination request. The instance is not
@@ -1780,6 +2945,29 @@ namespace Model
          */
         virtual void TerminateInstanceInAutoScalingGroupAsync(const Model::TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Terminates the specified instance and optionally adjusts the desired group
+         * size.</p> <p>This call simply makes a termination request. The instance is not
+         * terminated immediately.</p>
+         *
+         * Returns an awaitable that starts the operation the way TerminateInstanceInAutoScalingGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TerminateInstanceInAutoScalingGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::TerminateInstanceInAutoScalingGroupOutcome> TerminateInstanceInAutoScalingGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TerminateInstanceInAutoScalingGroupOutcome>([this, request](const std::function<void(Model::TerminateInstanceInAutoScalingGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TerminateInstanceInAutoScalingGroupAsync(request, [complete](const AutoScalingClient*, const Model::TerminateInstanceInAutoScalingGroupRequest&, const Model::TerminateInstanceInAutoScalingGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TerminateInstanceInAutoScalingGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the configuration for the specified Auto Scaling group.</p> <p>To
          * update an Auto Scaling group with a launch configuration with
@@ -1853,6 +3041,45 @@ namespace Model
          */
         virtual void UpdateAutoScalingGroupAsync(const Model::UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the configuration for the specified Auto Scaling group.</p> <p>To
+         * update an Auto Scaling group with a launch configuration with
+         * <code>InstanceMonitoring</code> set to <code>False</code>, you must first
+         * disable the collection of group metrics. Otherwise, you will get an error. If
+         * you have previously enabled the collection of group metrics, you can disable it
+         * using <a>DisableMetricsCollection</a>.</p> <p>The new settings are registered
+         * upon the completion of this call. Any launch configuration settings take effect
+         * on any triggers after this call returns. Scaling activities that are currently
+         * in progress aren't affected.</p> <p>Note the following:</p> <ul> <li> <p>If you
+         * specify a new value for <code>MinSize</code> without specifying a value for
+         * <code>DesiredCapacity</code>, and the new <code>MinSize</code> is larger than
+         * the current size of the group, we implicitly call <a>SetDesiredCapacity</a> to
+         * set the size of the group to the new value of <code>MinSize</code>.</p> </li>
+         * <li> <p>If you specify a new value for <code>MaxSize</code> without specifying a
+         * value for <code>DesiredCapacity</code>, and the new <code>MaxSize</code> is
+         * smaller than the current size of the group, we implicitly call
+         * <a>SetDesiredCapacity</a> to set the size of the group to the new value of
+         * <code>MaxSize</code>.</p> </li> <li> <p>All other optional parameters are left
+         * unchanged if not specified.</p> </li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAutoScalingGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAutoScalingGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAutoScalingGroupOutcome> UpdateAutoScalingGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAutoScalingGroupOutcome>([this, request](const std::function<void(Model::UpdateAutoScalingGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAutoScalingGroupAsync(request, [complete](const AutoScalingClient*, const Model::UpdateAutoScalingGroupRequest&, const Model::UpdateAutoScalingGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAutoScalingGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -143,7 +143,7 @@ AttachInstancesOutcome AutoScalingClient::AttachInstances(const AttachInstancesR
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "AttachInstances");
   if(outcome.IsSuccess())
   {
     return AttachInstancesOutcome(NoResult());
@@ -156,24 +156,48 @@ AttachInstancesOutcome AutoScalingClient::AttachInstances(const AttachInstancesR
 
 AttachInstancesOutcomeCallable AutoScalingClient::AttachInstancesCallable(const AttachInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::AttachInstances, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AttachInstancesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AttachInstances( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< AttachInstancesOutcome > rejected;
+    rejected.set_value(AttachInstancesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::AttachInstancesAsync(const AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::AttachInstancesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::AttachInstancesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, AttachInstancesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::AttachInstancesAsyncHelper(const AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, AttachInstances(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<AttachInstancesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "AttachInstances", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AttachInstancesOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AttachInstancesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 AttachLoadBalancersOutcome AutoScalingClient::AttachLoadBalancers(const AttachLoadBalancersRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "AttachLoadBalancers");
   if(outcome.IsSuccess())
   {
     return AttachLoadBalancersOutcome(AttachLoadBalancersResult(outcome.GetResult()));
@@ -186,24 +210,48 @@ AttachLoadBalancersOutcome AutoScalingClient::AttachLoadBalancers(const AttachLo
 
 AttachLoadBalancersOutcomeCallable AutoScalingClient::AttachLoadBalancersCallable(const AttachLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::AttachLoadBalancers, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AttachLoadBalancersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AttachLoadBalancers( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< AttachLoadBalancersOutcome > rejected;
+    rejected.set_value(AttachLoadBalancersOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::AttachLoadBalancersAsync(const AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::AttachLoadBalancersAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::AttachLoadBalancersAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, AttachLoadBalancersOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::AttachLoadBalancersAsyncHelper(const AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, AttachLoadBalancers(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<AttachLoadBalancersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "AttachLoadBalancers", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AttachLoadBalancersOutcome(AttachLoadBalancersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AttachLoadBalancersOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CompleteLifecycleActionOutcome AutoScalingClient::CompleteLifecycleAction(const CompleteLifecycleActionRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CompleteLifecycleAction");
   if(outcome.IsSuccess())
   {
     return CompleteLifecycleActionOutcome(CompleteLifecycleActionResult(outcome.GetResult()));
@@ -216,24 +264,48 @@ CompleteLifecycleActionOutcome AutoScalingClient::CompleteLifecycleAction(const
 
 CompleteLifecycleActionOutcomeCallable AutoScalingClient::CompleteLifecycleActionCallable(const CompleteLifecycleActionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CompleteLifecycleAction, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CompleteLifecycleActionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CompleteLifecycleAction( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CompleteLifecycleActionOutcome > rejected;
+    rejected.set_value(CompleteLifecycleActionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::CompleteLifecycleActionAsync(const CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CompleteLifecycleActionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::CompleteLifecycleActionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CompleteLifecycleActionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::CompleteLifecycleActionAsyncHelper(const CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CompleteLifecycleAction(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CompleteLifecycleActionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CompleteLifecycleAction", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CompleteLifecycleActionOutcome(CompleteLifecycleActionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CompleteLifecycleActionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateAutoScalingGroupOutcome AutoScalingClient::CreateAutoScalingGroup(const CreateAutoScalingGroupRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateAutoScalingGroup");
   if(outcome.IsSuccess())
   {
     return CreateAutoScalingGroupOutcome(NoResult());
@@ -246,24 +318,48 @@ CreateAutoScalingGroupOutcome AutoScalingClient::CreateAutoScalingGroup(const Cr
 
 CreateAutoScalingGroupOutcomeCallable AutoScalingClient::CreateAutoScalingGroupCallable(const CreateAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CreateAutoScalingGroup, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateAutoScalingGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateAutoScalingGroup( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateAutoScalingGroupOutcome > rejected;
+    rejected.set_value(CreateAutoScalingGroupOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::CreateAutoScalingGroupAsync(const CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CreateAutoScalingGroupAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::CreateAutoScalingGroupAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateAutoScalingGroupOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::CreateAutoScalingGroupAsyncHelper(const CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateAutoScalingGroup(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CreateAutoScalingGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateAutoScalingGroup", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateAutoScalingGroupOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateAutoScalingGroupOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateLaunchConfigurationOutcome AutoScalingClient::CreateLaunchConfiguration(const CreateLaunchConfigurationRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateLaunchConfiguration");
   if(outcome.IsSuccess())
   {
     return CreateLaunchConfigurationOutcome(NoResult());
@@ -276,24 +372,48 @@ CreateLaunchConfigurationOutcome AutoScalingClient::CreateLaunchConfiguration(co
 
 CreateLaunchConfigurationOutcomeCallable AutoScalingClient::CreateLaunchConfigurationCallable(const CreateLaunchConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CreateLaunchConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateLaunchConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateLaunchConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateLaunchConfigurationOutcome > rejected;
+    rejected.set_value(CreateLaunchConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::CreateLaunchConfigurationAsync(const CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CreateLaunchConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::CreateLaunchConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateLaunchConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::CreateLaunchConfigurationAsyncHelper(const CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateLaunchConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CreateLaunchConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateLaunchConfiguration", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateLaunchConfigurationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateLaunchConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateOrUpdateTagsOutcome AutoScalingClient::CreateOrUpdateTags(const CreateOrUpdateTagsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateOrUpdateTags");
   if(outcome.IsSuccess())
   {
     return CreateOrUpdateTagsOutcome(NoResult());
@@ -306,24 +426,48 @@ CreateOrUpdateTagsOutcome AutoScalingClient::CreateOrUpdateTags(const CreateOrUp
 
 CreateOrUpdateTagsOutcomeCallable AutoScalingClient::CreateOrUpdateTagsCallable(const CreateOrUpdateTagsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CreateOrUpdateTags, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateOrUpdateTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateOrUpdateTags( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateOrUpdateTagsOutcome > rejected;
+    rejected.set_value(CreateOrUpdateTagsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::CreateOrUpdateTagsAsync(const CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CreateOrUpdateTagsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::CreateOrUpdateTagsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateOrUpdateTagsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::CreateOrUpdateTagsAsyncHelper(const CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateOrUpdateTags(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CreateOrUpdateTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateOrUpdateTags", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateOrUpdateTagsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateOrUpdateTagsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteAutoScalingGroupOutcome AutoScalingClient::DeleteAutoScalingGroup(const DeleteAutoScalingGroupRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeleteAutoScalingGroup");
   if(outcome.IsSuccess())
   {
     return DeleteAutoScalingGroupOutcome(NoResult());
@@ -336,24 +480,48 @@ DeleteAutoScalingGroupOutcome AutoScalingClient::DeleteAutoScalingGroup(const De
 
 DeleteAutoScalingGroupOutcomeCallable AutoScalingClient::DeleteAutoScalingGroupCallable(const DeleteAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteAutoScalingGroup, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteAutoScalingGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteAutoScalingGroup( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteAutoScalingGroupOutcome > rejected;
+    rejected.set_value(DeleteAutoScalingGroupOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteAutoScalingGroupAsync(const DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteAutoScalingGroupAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DeleteAutoScalingGroupAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteAutoScalingGroupOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DeleteAutoScalingGroupAsyncHelper(const DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteAutoScalingGroup(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteAutoScalingGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeleteAutoScalingGroup", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteAutoScalingGroupOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteAutoScalingGroupOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteLaunchConfigurationOutcome AutoScalingClient::DeleteLaunchConfiguration(const DeleteLaunchConfigurationRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeleteLaunchConfiguration");
   if(outcome.IsSuccess())
   {
     return DeleteLaunchConfigurationOutcome(NoResult());
@@ -366,24 +534,48 @@ DeleteLaunchConfigurationOutcome AutoScalingClient::DeleteLaunchConfiguration(co
 
 DeleteLaunchConfigurationOutcomeCallable AutoScalingClient::DeleteLaunchConfigurationCallable(const DeleteLaunchConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteLaunchConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteLaunchConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteLaunchConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteLaunchConfigurationOutcome > rejected;
+    rejected.set_value(DeleteLaunchConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteLaunchConfigurationAsync(const DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteLaunchConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DeleteLaunchConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteLaunchConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DeleteLaunchConfigurationAsyncHelper(const DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteLaunchConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteLaunchConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeleteLaunchConfiguration", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteLaunchConfigurationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteLaunchConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteLifecycleHookOutcome AutoScalingClient::DeleteLifecycleHook(const DeleteLifecycleHookRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeleteLifecycleHook");
   if(outcome.IsSuccess())
   {
     return DeleteLifecycleHookOutcome(DeleteLifecycleHookResult(outcome.GetResult()));
@@ -396,24 +588,48 @@ DeleteLifecycleHookOutcome AutoScalingClient::DeleteLifecycleHook(const DeleteLi
 
 DeleteLifecycleHookOutcomeCallable AutoScalingClient::DeleteLifecycleHookCallable(const DeleteLifecycleHookRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteLifecycleHook, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteLifecycleHookOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteLifecycleHook( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteLifecycleHookOutcome > rejected;
+    rejected.set_value(DeleteLifecycleHookOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteLifecycleHookAsync(const DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteLifecycleHookAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DeleteLifecycleHookAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteLifecycleHookOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DeleteLifecycleHookAsyncHelper(const DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteLifecycleHook(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteLifecycleHookRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeleteLifecycleHook", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteLifecycleHookOutcome(DeleteLifecycleHookResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteLifecycleHookOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteNotificationConfigurationOutcome AutoScalingClient::DeleteNotificationConfiguration(const DeleteNotificationConfigurationRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeleteNotificationConfiguration");
   if(outcome.IsSuccess())
   {
     return DeleteNotificationConfigurationOutcome(NoResult());
@@ -426,24 +642,48 @@ DeleteNotificationConfigurationOutcome AutoScalingClient::DeleteNotificationConf
 
 DeleteNotificationConfigurationOutcomeCallable AutoScalingClient::DeleteNotificationConfigurationCallable(const DeleteNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteNotificationConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteNotificationConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteNotificationConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteNotificationConfigurationOutcome > rejected;
+    rejected.set_value(DeleteNotificationConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteNotificationConfigurationAsync(const DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteNotificationConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DeleteNotificationConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteNotificationConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DeleteNotificationConfigurationAsyncHelper(const DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteNotificationConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteNotificationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeleteNotificationConfiguration", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteNotificationConfigurationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteNotificationConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeletePolicyOutcome AutoScalingClient::DeletePolicy(const DeletePolicyRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeletePolicy");
   if(outcome.IsSuccess())
   {
     return DeletePolicyOutcome(NoResult());
@@ -456,24 +696,48 @@ DeletePolicyOutcome AutoScalingClient::DeletePolicy(const DeletePolicyRequest& r
 
 DeletePolicyOutcomeCallable AutoScalingClient::DeletePolicyCallable(const DeletePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeletePolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeletePolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeletePolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeletePolicyOutcome > rejected;
+    rejected.set_value(DeletePolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeletePolicyAsync(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeletePolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DeletePolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeletePolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DeletePolicyAsyncHelper(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeletePolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeletePolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeletePolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeletePolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeletePolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteScheduledActionOutcome AutoScalingClient::DeleteScheduledAction(const DeleteScheduledActionRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeleteScheduledAction");
   if(outcome.IsSuccess())
   {
     return DeleteScheduledActionOutcome(NoResult());
@@ -486,24 +750,48 @@ DeleteScheduledActionOutcome AutoScalingClient::DeleteScheduledAction(const Dele
 
 DeleteScheduledActionOutcomeCallable AutoScalingClient::DeleteScheduledActionCallable(const DeleteScheduledActionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteScheduledAction, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteScheduledActionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteScheduledAction( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteScheduledActionOutcome > rejected;
+    rejected.set_value(DeleteScheduledActionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteScheduledActionAsync(const DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteScheduledActionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DeleteScheduledActionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteScheduledActionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DeleteScheduledActionAsyncHelper(const DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteScheduledAction(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteScheduledActionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeleteScheduledAction", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteScheduledActionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteScheduledActionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteTagsOutcome AutoScalingClient::DeleteTags(const DeleteTagsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeleteTags");
   if(outcome.IsSuccess())
   {
     return DeleteTagsOutcome(NoResult());
@@ -516,24 +804,48 @@ DeleteTagsOutcome AutoScalingClient::DeleteTags(const DeleteTagsRequest& request
 
 DeleteTagsOutcomeCallable AutoScalingClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteTags, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteTags( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteTagsOutcome > rejected;
+    rejected.set_value(DeleteTagsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteTagsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DeleteTagsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteTagsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteTags(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeleteTags", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteTagsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteTagsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeAccountLimitsOutcome AutoScalingClient::DescribeAccountLimits(const DescribeAccountLimitsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeAccountLimits");
   if(outcome.IsSuccess())
   {
     return DescribeAccountLimitsOutcome(DescribeAccountLimitsResult(outcome.GetResult()));
@@ -546,24 +858,48 @@ DescribeAccountLimitsOutcome AutoScalingClient::DescribeAccountLimits(const Desc
 
 DescribeAccountLimitsOutcomeCallable AutoScalingClient::DescribeAccountLimitsCallable(const DescribeAccountLimitsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAccountLimits, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAccountLimitsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAccountLimits( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeAccountLimitsOutcome > rejected;
+    rejected.set_value(DescribeAccountLimitsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeAccountLimitsAsync(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAccountLimitsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeAccountLimitsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeAccountLimitsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeAccountLimitsAsyncHelper(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeAccountLimits(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAccountLimitsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeAccountLimits", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAccountLimitsOutcome(DescribeAccountLimitsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAccountLimitsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeAdjustmentTypesOutcome AutoScalingClient::DescribeAdjustmentTypes(const DescribeAdjustmentTypesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeAdjustmentTypes");
   if(outcome.IsSuccess())
   {
     return DescribeAdjustmentTypesOutcome(DescribeAdjustmentTypesResult(outcome.GetResult()));
@@ -576,24 +912,48 @@ DescribeAdjustmentTypesOutcome AutoScalingClient::DescribeAdjustmentTypes(const
 
 DescribeAdjustmentTypesOutcomeCallable AutoScalingClient::DescribeAdjustmentTypesCallable(const DescribeAdjustmentTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAdjustmentTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAdjustmentTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAdjustmentTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeAdjustmentTypesOutcome > rejected;
+    rejected.set_value(DescribeAdjustmentTypesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeAdjustmentTypesAsync(const DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAdjustmentTypesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeAdjustmentTypesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeAdjustmentTypesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeAdjustmentTypesAsyncHelper(const DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeAdjustmentTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAdjustmentTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeAdjustmentTypes", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAdjustmentTypesOutcome(DescribeAdjustmentTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAdjustmentTypesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeAutoScalingGroupsOutcome AutoScalingClient::DescribeAutoScalingGroups(const DescribeAutoScalingGroupsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeAutoScalingGroups");
   if(outcome.IsSuccess())
   {
     return DescribeAutoScalingGroupsOutcome(DescribeAutoScalingGroupsResult(outcome.GetResult()));
@@ -606,24 +966,48 @@ DescribeAutoScalingGroupsOutcome AutoScalingClient::DescribeAutoScalingGroups(co
 
 DescribeAutoScalingGroupsOutcomeCallable AutoScalingClient::DescribeAutoScalingGroupsCallable(const DescribeAutoScalingGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAutoScalingGroups, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAutoScalingGroupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAutoScalingGroups( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeAutoScalingGroupsOutcome > rejected;
+    rejected.set_value(DescribeAutoScalingGroupsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeAutoScalingGroupsAsync(const DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeAutoScalingGroupsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper(const DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeAutoScalingGroups(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAutoScalingGroupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeAutoScalingGroups", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingGroupsOutcome(DescribeAutoScalingGroupsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingGroupsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeAutoScalingInstancesOutcome AutoScalingClient::DescribeAutoScalingInstances(const DescribeAutoScalingInstancesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeAutoScalingInstances");
   if(outcome.IsSuccess())
   {
     return DescribeAutoScalingInstancesOutcome(DescribeAutoScalingInstancesResult(outcome.GetResult()));
@@ -636,24 +1020,48 @@ DescribeAutoScalingInstancesOutcome AutoScalingClient::DescribeAutoScalingInstan
 
 DescribeAutoScalingInstancesOutcomeCallable AutoScalingClient::DescribeAutoScalingInstancesCallable(const DescribeAutoScalingInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAutoScalingInstances, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAutoScalingInstancesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAutoScalingInstances( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeAutoScalingInstancesOutcome > rejected;
+    rejected.set_value(DescribeAutoScalingInstancesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeAutoScalingInstancesAsync(const DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeAutoScalingInstancesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper(const DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeAutoScalingInstances(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAutoScalingInstancesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeAutoScalingInstances", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingInstancesOutcome(DescribeAutoScalingInstancesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingInstancesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeAutoScalingNotificationTypesOutcome AutoScalingClient::DescribeAutoScalingNotificationTypes(const DescribeAutoScalingNotificationTypesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeAutoScalingNotificationTypes");
   if(outcome.IsSuccess())
   {
     return DescribeAutoScalingNotificationTypesOutcome(DescribeAutoScalingNotificationTypesResult(outcome.GetResult()));
@@ -666,24 +1074,48 @@ DescribeAutoScalingNotificationTypesOutcome AutoScalingClient::DescribeAutoScali
 
 DescribeAutoScalingNotificationTypesOutcomeCallable AutoScalingClient::DescribeAutoScalingNotificationTypesCallable(const DescribeAutoScalingNotificationTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAutoScalingNotificationTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAutoScalingNotificationTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAutoScalingNotificationTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeAutoScalingNotificationTypesOutcome > rejected;
+    rejected.set_value(DescribeAutoScalingNotificationTypesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeAutoScalingNotificationTypesAsync(const DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeAutoScalingNotificationTypesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper(const DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeAutoScalingNotificationTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAutoScalingNotificationTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeAutoScalingNotificationTypes", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingNotificationTypesOutcome(DescribeAutoScalingNotificationTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAutoScalingNotificationTypesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeLaunchConfigurationsOutcome AutoScalingClient::DescribeLaunchConfigurations(const DescribeLaunchConfigurationsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeLaunchConfigurations");
   if(outcome.IsSuccess())
   {
     return DescribeLaunchConfigurationsOutcome(DescribeLaunchConfigurationsResult(outcome.GetResult()));
@@ -696,24 +1128,48 @@ DescribeLaunchConfigurationsOutcome AutoScalingClient::DescribeLaunchConfigurati
 
 DescribeLaunchConfigurationsOutcomeCallable AutoScalingClient::DescribeLaunchConfigurationsCallable(const DescribeLaunchConfigurationsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLaunchConfigurations, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeLaunchConfigurationsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeLaunchConfigurations( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeLaunchConfigurationsOutcome > rejected;
+    rejected.set_value(DescribeLaunchConfigurationsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeLaunchConfigurationsAsync(const DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeLaunchConfigurationsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper(const DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeLaunchConfigurations(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeLaunchConfigurationsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeLaunchConfigurations", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeLaunchConfigurationsOutcome(DescribeLaunchConfigurationsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeLaunchConfigurationsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeLifecycleHookTypesOutcome AutoScalingClient::DescribeLifecycleHookTypes(const DescribeLifecycleHookTypesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeLifecycleHookTypes");
   if(outcome.IsSuccess())
   {
     return DescribeLifecycleHookTypesOutcome(DescribeLifecycleHookTypesResult(outcome.GetResult()));
@@ -726,24 +1182,48 @@ DescribeLifecycleHookTypesOutcome AutoScalingClient::DescribeLifecycleHookTypes(
 
 DescribeLifecycleHookTypesOutcomeCallable AutoScalingClient::DescribeLifecycleHookTypesCallable(const DescribeLifecycleHookTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLifecycleHookTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeLifecycleHookTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeLifecycleHookTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeLifecycleHookTypesOutcome > rejected;
+    rejected.set_value(DescribeLifecycleHookTypesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeLifecycleHookTypesAsync(const DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeLifecycleHookTypesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper(const DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeLifecycleHookTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeLifecycleHookTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeLifecycleHookTypes", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeLifecycleHookTypesOutcome(DescribeLifecycleHookTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeLifecycleHookTypesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeLifecycleHooksOutcome AutoScalingClient::DescribeLifecycleHooks(const DescribeLifecycleHooksRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeLifecycleHooks");
   if(outcome.IsSuccess())
   {
     return DescribeLifecycleHooksOutcome(DescribeLifecycleHooksResult(outcome.GetResult()));
@@ -756,24 +1236,48 @@ DescribeLifecycleHooksOutcome AutoScalingClient::DescribeLifecycleHooks(const De
 
 DescribeLifecycleHooksOutcomeCallable AutoScalingClient::DescribeLifecycleHooksCallable(const DescribeLifecycleHooksRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLifecycleHooks, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeLifecycleHooksOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeLifecycleHooks( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeLifecycleHooksOutcome > rejected;
+    rejected.set_value(DescribeLifecycleHooksOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeLifecycleHooksAsync(const DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLifecycleHooksAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeLifecycleHooksAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeLifecycleHooksOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeLifecycleHooksAsyncHelper(const DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeLifecycleHooks(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeLifecycleHooksRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeLifecycleHooks", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeLifecycleHooksOutcome(DescribeLifecycleHooksResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeLifecycleHooksOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeLoadBalancersOutcome AutoScalingClient::DescribeLoadBalancers(const DescribeLoadBalancersRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeLoadBalancers");
   if(outcome.IsSuccess())
   {
     return DescribeLoadBalancersOutcome(DescribeLoadBalancersResult(outcome.GetResult()));
@@ -786,24 +1290,48 @@ DescribeLoadBalancersOutcome AutoScalingClient::DescribeLoadBalancers(const Desc
 
 DescribeLoadBalancersOutcomeCallable AutoScalingClient::DescribeLoadBalancersCallable(const DescribeLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLoadBalancers, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeLoadBalancersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeLoadBalancers( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeLoadBalancersOutcome > rejected;
+    rejected.set_value(DescribeLoadBalancersOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeLoadBalancersAsync(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLoadBalancersAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeLoadBalancersAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeLoadBalancersOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeLoadBalancersAsyncHelper(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeLoadBalancers(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeLoadBalancersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeLoadBalancers", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeLoadBalancersOutcome(DescribeLoadBalancersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeLoadBalancersOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeMetricCollectionTypesOutcome AutoScalingClient::DescribeMetricCollectionTypes(const DescribeMetricCollectionTypesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeMetricCollectionTypes");
   if(outcome.IsSuccess())
   {
     return DescribeMetricCollectionTypesOutcome(DescribeMetricCollectionTypesResult(outcome.GetResult()));
@@ -816,24 +1344,48 @@ DescribeMetricCollectionTypesOutcome AutoScalingClient::DescribeMetricCollection
 
 DescribeMetricCollectionTypesOutcomeCallable AutoScalingClient::DescribeMetricCollectionTypesCallable(const DescribeMetricCollectionTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeMetricCollectionTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeMetricCollectionTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeMetricCollectionTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeMetricCollectionTypesOutcome > rejected;
+    rejected.set_value(DescribeMetricCollectionTypesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeMetricCollectionTypesAsync(const DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeMetricCollectionTypesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper(const DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeMetricCollectionTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeMetricCollectionTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeMetricCollectionTypes", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeMetricCollectionTypesOutcome(DescribeMetricCollectionTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeMetricCollectionTypesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeNotificationConfigurationsOutcome AutoScalingClient::DescribeNotificationConfigurations(const DescribeNotificationConfigurationsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeNotificationConfigurations");
   if(outcome.IsSuccess())
   {
     return DescribeNotificationConfigurationsOutcome(DescribeNotificationConfigurationsResult(outcome.GetResult()));
@@ -846,24 +1398,48 @@ DescribeNotificationConfigurationsOutcome AutoScalingClient::DescribeNotificatio
 
 DescribeNotificationConfigurationsOutcomeCallable AutoScalingClient::DescribeNotificationConfigurationsCallable(const DescribeNotificationConfigurationsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeNotificationConfigurations, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeNotificationConfigurationsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeNotificationConfigurations( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeNotificationConfigurationsOutcome > rejected;
+    rejected.set_value(DescribeNotificationConfigurationsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeNotificationConfigurationsAsync(const DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeNotificationConfigurationsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper(const DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeNotificationConfigurations(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeNotificationConfigurationsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeNotificationConfigurations", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeNotificationConfigurationsOutcome(DescribeNotificationConfigurationsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeNotificationConfigurationsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribePoliciesOutcome AutoScalingClient::DescribePolicies(const DescribePoliciesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribePolicies");
   if(outcome.IsSuccess())
   {
     return DescribePoliciesOutcome(DescribePoliciesResult(outcome.GetResult()));
@@ -876,24 +1452,48 @@ DescribePoliciesOutcome AutoScalingClient::DescribePolicies(const DescribePolici
 
 DescribePoliciesOutcomeCallable AutoScalingClient::DescribePoliciesCallable(const DescribePoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribePolicies, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribePoliciesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribePolicies( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribePoliciesOutcome > rejected;
+    rejected.set_value(DescribePoliciesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribePoliciesAsync(const DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribePoliciesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribePoliciesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribePoliciesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribePoliciesAsyncHelper(const DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribePolicies(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribePoliciesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribePolicies", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribePoliciesOutcome(DescribePoliciesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribePoliciesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeScalingActivitiesOutcome AutoScalingClient::DescribeScalingActivities(const DescribeScalingActivitiesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeScalingActivities");
   if(outcome.IsSuccess())
   {
     return DescribeScalingActivitiesOutcome(DescribeScalingActivitiesResult(outcome.GetResult()));
@@ -906,24 +1506,48 @@ DescribeScalingActivitiesOutcome AutoScalingClient::DescribeScalingActivities(co
 
 DescribeScalingActivitiesOutcomeCallable AutoScalingClient::DescribeScalingActivitiesCallable(const DescribeScalingActivitiesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeScalingActivities, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeScalingActivitiesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeScalingActivities( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeScalingActivitiesOutcome > rejected;
+    rejected.set_value(DescribeScalingActivitiesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeScalingActivitiesAsync(const DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeScalingActivitiesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeScalingActivitiesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeScalingActivitiesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeScalingActivitiesAsyncHelper(const DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeScalingActivities(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeScalingActivitiesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeScalingActivities", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeScalingActivitiesOutcome(DescribeScalingActivitiesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeScalingActivitiesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeScalingProcessTypesOutcome AutoScalingClient::DescribeScalingProcessTypes(const DescribeScalingProcessTypesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeScalingProcessTypes");
   if(outcome.IsSuccess())
   {
     return DescribeScalingProcessTypesOutcome(DescribeScalingProcessTypesResult(outcome.GetResult()));
@@ -936,24 +1560,48 @@ DescribeScalingProcessTypesOutcome AutoScalingClient::DescribeScalingProcessType
 
 DescribeScalingProcessTypesOutcomeCallable AutoScalingClient::DescribeScalingProcessTypesCallable(const DescribeScalingProcessTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeScalingProcessTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeScalingProcessTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeScalingProcessTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeScalingProcessTypesOutcome > rejected;
+    rejected.set_value(DescribeScalingProcessTypesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeScalingProcessTypesAsync(const DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeScalingProcessTypesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeScalingProcessTypesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeScalingProcessTypesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeScalingProcessTypesAsyncHelper(const DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeScalingProcessTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeScalingProcessTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeScalingProcessTypes", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeScalingProcessTypesOutcome(DescribeScalingProcessTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeScalingProcessTypesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeScheduledActionsOutcome AutoScalingClient::DescribeScheduledActions(const DescribeScheduledActionsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeScheduledActions");
   if(outcome.IsSuccess())
   {
     return DescribeScheduledActionsOutcome(DescribeScheduledActionsResult(outcome.GetResult()));
@@ -966,24 +1614,48 @@ DescribeScheduledActionsOutcome AutoScalingClient::DescribeScheduledActions(cons
 
 DescribeScheduledActionsOutcomeCallable AutoScalingClient::DescribeScheduledActionsCallable(const DescribeScheduledActionsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeScheduledActions, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeScheduledActionsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeScheduledActions( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeScheduledActionsOutcome > rejected;
+    rejected.set_value(DescribeScheduledActionsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeScheduledActionsAsync(const DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeScheduledActionsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeScheduledActionsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeScheduledActionsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeScheduledActionsAsyncHelper(const DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeScheduledActions(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeScheduledActionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeScheduledActions", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeScheduledActionsOutcome(DescribeScheduledActionsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeScheduledActionsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeTagsOutcome AutoScalingClient::DescribeTags(const DescribeTagsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeTags");
   if(outcome.IsSuccess())
   {
     return DescribeTagsOutcome(DescribeTagsResult(outcome.GetResult()));
@@ -996,24 +1668,48 @@ DescribeTagsOutcome AutoScalingClient::DescribeTags(const DescribeTagsRequest& r
 
 DescribeTagsOutcomeCallable AutoScalingClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeTags, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTags( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeTagsOutcome > rejected;
+    rejected.set_value(DescribeTagsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeTagsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeTagsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeTagsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeTags(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeTags", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeTagsOutcome(DescribeTagsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeTagsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeTerminationPolicyTypesOutcome AutoScalingClient::DescribeTerminationPolicyTypes(const DescribeTerminationPolicyTypesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeTerminationPolicyTypes");
   if(outcome.IsSuccess())
   {
     return DescribeTerminationPolicyTypesOutcome(DescribeTerminationPolicyTypesResult(outcome.GetResult()));
@@ -1026,24 +1722,48 @@ DescribeTerminationPolicyTypesOutcome AutoScalingClient::DescribeTerminationPoli
 
 DescribeTerminationPolicyTypesOutcomeCallable AutoScalingClient::DescribeTerminationPolicyTypesCallable(const DescribeTerminationPolicyTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeTerminationPolicyTypes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeTerminationPolicyTypesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTerminationPolicyTypes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeTerminationPolicyTypesOutcome > rejected;
+    rejected.set_value(DescribeTerminationPolicyTypesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DescribeTerminationPolicyTypesAsync(const DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeTerminationPolicyTypesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper(const DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeTerminationPolicyTypes(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeTerminationPolicyTypesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeTerminationPolicyTypes", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeTerminationPolicyTypesOutcome(DescribeTerminationPolicyTypesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeTerminationPolicyTypesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DetachInstancesOutcome AutoScalingClient::DetachInstances(const DetachInstancesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DetachInstances");
   if(outcome.IsSuccess())
   {
     return DetachInstancesOutcome(DetachInstancesResult(outcome.GetResult()));
@@ -1056,24 +1776,48 @@ DetachInstancesOutcome AutoScalingClient::DetachInstances(const DetachInstancesR
 
 DetachInstancesOutcomeCallable AutoScalingClient::DetachInstancesCallable(const DetachInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DetachInstances, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DetachInstancesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DetachInstances( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DetachInstancesOutcome > rejected;
+    rejected.set_value(DetachInstancesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DetachInstancesAsync(const DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DetachInstancesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DetachInstancesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DetachInstancesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DetachInstancesAsyncHelper(const DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DetachInstances(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DetachInstancesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DetachInstances", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DetachInstancesOutcome(DetachInstancesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DetachInstancesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DetachLoadBalancersOutcome AutoScalingClient::DetachLoadBalancers(const DetachLoadBalancersRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DetachLoadBalancers");
   if(outcome.IsSuccess())
   {
     return DetachLoadBalancersOutcome(DetachLoadBalancersResult(outcome.GetResult()));
@@ -1086,24 +1830,48 @@ DetachLoadBalancersOutcome AutoScalingClient::DetachLoadBalancers(const DetachLo
 
 DetachLoadBalancersOutcomeCallable AutoScalingClient::DetachLoadBalancersCallable(const DetachLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DetachLoadBalancers, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DetachLoadBalancersOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DetachLoadBalancers( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DetachLoadBalancersOutcome > rejected;
+    rejected.set_value(DetachLoadBalancersOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DetachLoadBalancersAsync(const DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DetachLoadBalancersAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DetachLoadBalancersAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DetachLoadBalancersOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DetachLoadBalancersAsyncHelper(const DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DetachLoadBalancers(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DetachLoadBalancersRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DetachLoadBalancers", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DetachLoadBalancersOutcome(DetachLoadBalancersResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DetachLoadBalancersOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DisableMetricsCollectionOutcome AutoScalingClient::DisableMetricsCollection(const DisableMetricsCollectionRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DisableMetricsCollection");
   if(outcome.IsSuccess())
   {
     return DisableMetricsCollectionOutcome(NoResult());
@@ -1116,24 +1884,48 @@ DisableMetricsCollectionOutcome AutoScalingClient::DisableMetricsCollection(cons
 
 DisableMetricsCollectionOutcomeCallable AutoScalingClient::DisableMetricsCollectionCallable(const DisableMetricsCollectionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DisableMetricsCollection, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DisableMetricsCollectionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisableMetricsCollection( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DisableMetricsCollectionOutcome > rejected;
+    rejected.set_value(DisableMetricsCollectionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::DisableMetricsCollectionAsync(const DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DisableMetricsCollectionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::DisableMetricsCollectionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DisableMetricsCollectionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::DisableMetricsCollectionAsyncHelper(const DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DisableMetricsCollection(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DisableMetricsCollectionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DisableMetricsCollection", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisableMetricsCollectionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisableMetricsCollectionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 EnableMetricsCollectionOutcome AutoScalingClient::EnableMetricsCollection(const EnableMetricsCollectionRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "EnableMetricsCollection");
   if(outcome.IsSuccess())
   {
     return EnableMetricsCollectionOutcome(NoResult());
@@ -1146,24 +1938,48 @@ EnableMetricsCollectionOutcome AutoScalingClient::EnableMetricsCollection(const
 
 EnableMetricsCollectionOutcomeCallable AutoScalingClient::EnableMetricsCollectionCallable(const EnableMetricsCollectionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::EnableMetricsCollection, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< EnableMetricsCollectionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->EnableMetricsCollection( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< EnableMetricsCollectionOutcome > rejected;
+    rejected.set_value(EnableMetricsCollectionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::EnableMetricsCollectionAsync(const EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::EnableMetricsCollectionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::EnableMetricsCollectionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, EnableMetricsCollectionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::EnableMetricsCollectionAsyncHelper(const EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, EnableMetricsCollection(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<EnableMetricsCollectionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "EnableMetricsCollection", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, EnableMetricsCollectionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, EnableMetricsCollectionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 EnterStandbyOutcome AutoScalingClient::EnterStandby(const EnterStandbyRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "EnterStandby");
   if(outcome.IsSuccess())
   {
     return EnterStandbyOutcome(EnterStandbyResult(outcome.GetResult()));
@@ -1176,24 +1992,48 @@ EnterStandbyOutcome AutoScalingClient::EnterStandby(const EnterStandbyRequest& r
 
 EnterStandbyOutcomeCallable AutoScalingClient::EnterStandbyCallable(const EnterStandbyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::EnterStandby, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< EnterStandbyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->EnterStandby( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< EnterStandbyOutcome > rejected;
+    rejected.set_value(EnterStandbyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::EnterStandbyAsync(const EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::EnterStandbyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::EnterStandbyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, EnterStandbyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::EnterStandbyAsyncHelper(const EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, EnterStandby(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<EnterStandbyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "EnterStandby", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, EnterStandbyOutcome(EnterStandbyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, EnterStandbyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ExecutePolicyOutcome AutoScalingClient::ExecutePolicy(const ExecutePolicyRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ExecutePolicy");
   if(outcome.IsSuccess())
   {
     return ExecutePolicyOutcome(NoResult());
@@ -1206,24 +2046,48 @@ ExecutePolicyOutcome AutoScalingClient::ExecutePolicy(const ExecutePolicyRequest
 
 ExecutePolicyOutcomeCallable AutoScalingClient::ExecutePolicyCallable(const ExecutePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::ExecutePolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ExecutePolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ExecutePolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ExecutePolicyOutcome > rejected;
+    rejected.set_value(ExecutePolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::ExecutePolicyAsync(const ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::ExecutePolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::ExecutePolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ExecutePolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::ExecutePolicyAsyncHelper(const ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ExecutePolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ExecutePolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ExecutePolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ExecutePolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ExecutePolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ExitStandbyOutcome AutoScalingClient::ExitStandby(const ExitStandbyRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ExitStandby");
   if(outcome.IsSuccess())
   {
     return ExitStandbyOutcome(ExitStandbyResult(outcome.GetResult()));
@@ -1236,24 +2100,48 @@ ExitStandbyOutcome AutoScalingClient::ExitStandby(const ExitStandbyRequest& requ
 
 ExitStandbyOutcomeCallable AutoScalingClient::ExitStandbyCallable(const ExitStandbyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::ExitStandby, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ExitStandbyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ExitStandby( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ExitStandbyOutcome > rejected;
+    rejected.set_value(ExitStandbyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::ExitStandbyAsync(const ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::ExitStandbyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::ExitStandbyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ExitStandbyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::ExitStandbyAsyncHelper(const ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ExitStandby(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ExitStandbyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ExitStandby", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ExitStandbyOutcome(ExitStandbyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ExitStandbyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutLifecycleHookOutcome AutoScalingClient::PutLifecycleHook(const PutLifecycleHookRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "PutLifecycleHook");
   if(outcome.IsSuccess())
   {
     return PutLifecycleHookOutcome(PutLifecycleHookResult(outcome.GetResult()));
@@ -1266,24 +2154,48 @@ PutLifecycleHookOutcome AutoScalingClient::PutLifecycleHook(const PutLifecycleHo
 
 PutLifecycleHookOutcomeCallable AutoScalingClient::PutLifecycleHookCallable(const PutLifecycleHookRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutLifecycleHook, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutLifecycleHookOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutLifecycleHook( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutLifecycleHookOutcome > rejected;
+    rejected.set_value(PutLifecycleHookOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::PutLifecycleHookAsync(const PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutLifecycleHookAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::PutLifecycleHookAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutLifecycleHookOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::PutLifecycleHookAsyncHelper(const PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutLifecycleHook(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<PutLifecycleHookRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "PutLifecycleHook", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutLifecycleHookOutcome(PutLifecycleHookResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutLifecycleHookOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutNotificationConfigurationOutcome AutoScalingClient::PutNotificationConfiguration(const PutNotificationConfigurationRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "PutNotificationConfiguration");
   if(outcome.IsSuccess())
   {
     return PutNotificationConfigurationOutcome(NoResult());
@@ -1296,24 +2208,48 @@ PutNotificationConfigurationOutcome AutoScalingClient::PutNotificationConfigurat
 
 PutNotificationConfigurationOutcomeCallable AutoScalingClient::PutNotificationConfigurationCallable(const PutNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutNotificationConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutNotificationConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutNotificationConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutNotificationConfigurationOutcome > rejected;
+    rejected.set_value(PutNotificationConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::PutNotificationConfigurationAsync(const PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutNotificationConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::PutNotificationConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutNotificationConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::PutNotificationConfigurationAsyncHelper(const PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutNotificationConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<PutNotificationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "PutNotificationConfiguration", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutNotificationConfigurationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutNotificationConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutScalingPolicyOutcome AutoScalingClient::PutScalingPolicy(const PutScalingPolicyRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "PutScalingPolicy");
   if(outcome.IsSuccess())
   {
     return PutScalingPolicyOutcome(PutScalingPolicyResult(outcome.GetResult()));
@@ -1326,24 +2262,48 @@ PutScalingPolicyOutcome AutoScalingClient::PutScalingPolicy(const PutScalingPoli
 
 PutScalingPolicyOutcomeCallable AutoScalingClient::PutScalingPolicyCallable(const PutScalingPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutScalingPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutScalingPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutScalingPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutScalingPolicyOutcome > rejected;
+    rejected.set_value(PutScalingPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::PutScalingPolicyAsync(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutScalingPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::PutScalingPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutScalingPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::PutScalingPolicyAsyncHelper(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutScalingPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<PutScalingPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "PutScalingPolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutScalingPolicyOutcome(PutScalingPolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutScalingPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutScheduledUpdateGroupActionOutcome AutoScalingClient::PutScheduledUpdateGroupAction(const PutScheduledUpdateGroupActionRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "PutScheduledUpdateGroupAction");
   if(outcome.IsSuccess())
   {
     return PutScheduledUpdateGroupActionOutcome(NoResult());
@@ -1356,24 +2316,48 @@ PutScheduledUpdateGroupActionOutcome AutoScalingClient::PutScheduledUpdateGroupA
 
 PutScheduledUpdateGroupActionOutcomeCallable AutoScalingClient::PutScheduledUpdateGroupActionCallable(const PutScheduledUpdateGroupActionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutScheduledUpdateGroupAction, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutScheduledUpdateGroupActionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutScheduledUpdateGroupAction( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutScheduledUpdateGroupActionOutcome > rejected;
+    rejected.set_value(PutScheduledUpdateGroupActionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::PutScheduledUpdateGroupActionAsync(const PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutScheduledUpdateGroupActionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper(const PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutScheduledUpdateGroupAction(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<PutScheduledUpdateGroupActionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "PutScheduledUpdateGroupAction", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutScheduledUpdateGroupActionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutScheduledUpdateGroupActionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 RecordLifecycleActionHeartbeatOutcome AutoScalingClient::RecordLifecycleActionHeartbeat(const RecordLifecycleActionHeartbeatRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "RecordLifecycleActionHeartbeat");
   if(outcome.IsSuccess())
   {
     return RecordLifecycleActionHeartbeatOutcome(RecordLifecycleActionHeartbeatResult(outcome.GetResult()));
@@ -1386,24 +2370,48 @@ RecordLifecycleActionHeartbeatOutcome AutoScalingClient::RecordLifecycleActionHe
 
 RecordLifecycleActionHeartbeatOutcomeCallable AutoScalingClient::RecordLifecycleActionHeartbeatCallable(const RecordLifecycleActionHeartbeatRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::RecordLifecycleActionHeartbeat, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< RecordLifecycleActionHeartbeatOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RecordLifecycleActionHeartbeat( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< RecordLifecycleActionHeartbeatOutcome > rejected;
+    rejected.set_value(RecordLifecycleActionHeartbeatOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::RecordLifecycleActionHeartbeatAsync(const RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, RecordLifecycleActionHeartbeatOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper(const RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, RecordLifecycleActionHeartbeat(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<RecordLifecycleActionHeartbeatRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "RecordLifecycleActionHeartbeat", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RecordLifecycleActionHeartbeatOutcome(RecordLifecycleActionHeartbeatResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RecordLifecycleActionHeartbeatOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ResumeProcessesOutcome AutoScalingClient::ResumeProcesses(const ResumeProcessesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ResumeProcesses");
   if(outcome.IsSuccess())
   {
     return ResumeProcessesOutcome(NoResult());
@@ -1416,24 +2424,48 @@ ResumeProcessesOutcome AutoScalingClient::ResumeProcesses(const ResumeProcessesR
 
 ResumeProcessesOutcomeCallable AutoScalingClient::ResumeProcessesCallable(const ResumeProcessesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::ResumeProcesses, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ResumeProcessesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ResumeProcesses( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ResumeProcessesOutcome > rejected;
+    rejected.set_value(ResumeProcessesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::ResumeProcessesAsync(const ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::ResumeProcessesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::ResumeProcessesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ResumeProcessesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::ResumeProcessesAsyncHelper(const ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ResumeProcesses(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ResumeProcessesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ResumeProcesses", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ResumeProcessesOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ResumeProcessesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SetDesiredCapacityOutcome AutoScalingClient::SetDesiredCapacity(const SetDesiredCapacityRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "SetDesiredCapacity");
   if(outcome.IsSuccess())
   {
     return SetDesiredCapacityOutcome(NoResult());
@@ -1446,24 +2478,48 @@ SetDesiredCapacityOutcome AutoScalingClient::SetDesiredCapacity(const SetDesired
 
 SetDesiredCapacityOutcomeCallable AutoScalingClient::SetDesiredCapacityCallable(const SetDesiredCapacityRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SetDesiredCapacity, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetDesiredCapacityOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetDesiredCapacity( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SetDesiredCapacityOutcome > rejected;
+    rejected.set_value(SetDesiredCapacityOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::SetDesiredCapacityAsync(const SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SetDesiredCapacityAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::SetDesiredCapacityAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SetDesiredCapacityOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::SetDesiredCapacityAsyncHelper(const SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SetDesiredCapacity(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SetDesiredCapacityRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "SetDesiredCapacity", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetDesiredCapacityOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetDesiredCapacityOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SetInstanceHealthOutcome AutoScalingClient::SetInstanceHealth(const SetInstanceHealthRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "SetInstanceHealth");
   if(outcome.IsSuccess())
   {
     return SetInstanceHealthOutcome(NoResult());
@@ -1476,24 +2532,48 @@ SetInstanceHealthOutcome AutoScalingClient::SetInstanceHealth(const SetInstanceH
 
 SetInstanceHealthOutcomeCallable AutoScalingClient::SetInstanceHealthCallable(const SetInstanceHealthRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SetInstanceHealth, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetInstanceHealthOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetInstanceHealth( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SetInstanceHealthOutcome > rejected;
+    rejected.set_value(SetInstanceHealthOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::SetInstanceHealthAsync(const SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SetInstanceHealthAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::SetInstanceHealthAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SetInstanceHealthOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::SetInstanceHealthAsyncHelper(const SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SetInstanceHealth(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SetInstanceHealthRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "SetInstanceHealth", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetInstanceHealthOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetInstanceHealthOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SetInstanceProtectionOutcome AutoScalingClient::SetInstanceProtection(const SetInstanceProtectionRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "SetInstanceProtection");
   if(outcome.IsSuccess())
   {
     return SetInstanceProtectionOutcome(SetInstanceProtectionResult(outcome.GetResult()));
@@ -1506,24 +2586,48 @@ SetInstanceProtectionOutcome AutoScalingClient::SetInstanceProtection(const SetI
 
 SetInstanceProtectionOutcomeCallable AutoScalingClient::SetInstanceProtectionCallable(const SetInstanceProtectionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SetInstanceProtection, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetInstanceProtectionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetInstanceProtection( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SetInstanceProtectionOutcome > rejected;
+    rejected.set_value(SetInstanceProtectionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::SetInstanceProtectionAsync(const SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SetInstanceProtectionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::SetInstanceProtectionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SetInstanceProtectionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::SetInstanceProtectionAsyncHelper(const SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SetInstanceProtection(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SetInstanceProtectionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "SetInstanceProtection", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetInstanceProtectionOutcome(SetInstanceProtectionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetInstanceProtectionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SuspendProcessesOutcome AutoScalingClient::SuspendProcesses(const SuspendProcessesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "SuspendProcesses");
   if(outcome.IsSuccess())
   {
     return SuspendProcessesOutcome(NoResult());
@@ -1536,24 +2640,48 @@ SuspendProcessesOutcome AutoScalingClient::SuspendProcesses(const SuspendProcess
 
 SuspendProcessesOutcomeCallable AutoScalingClient::SuspendProcessesCallable(const SuspendProcessesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SuspendProcesses, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SuspendProcessesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SuspendProcesses( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SuspendProcessesOutcome > rejected;
+    rejected.set_value(SuspendProcessesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::SuspendProcessesAsync(const SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SuspendProcessesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::SuspendProcessesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SuspendProcessesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::SuspendProcessesAsyncHelper(const SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SuspendProcesses(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SuspendProcessesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "SuspendProcesses", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SuspendProcessesOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SuspendProcessesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 TerminateInstanceInAutoScalingGroupOutcome AutoScalingClient::TerminateInstanceInAutoScalingGroup(const TerminateInstanceInAutoScalingGroupRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "TerminateInstanceInAutoScalingGroup");
   if(outcome.IsSuccess())
   {
     return TerminateInstanceInAutoScalingGroupOutcome(TerminateInstanceInAutoScalingGroupResult(outcome.GetResult()));
@@ -1566,24 +2694,48 @@ TerminateInstanceInAutoScalingGroupOutcome AutoScalingClient::TerminateInstanceI
 
 TerminateInstanceInAutoScalingGroupOutcomeCallable AutoScalingClient::TerminateInstanceInAutoScalingGroupCallable(const TerminateInstanceInAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::TerminateInstanceInAutoScalingGroup, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< TerminateInstanceInAutoScalingGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TerminateInstanceInAutoScalingGroup( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< TerminateInstanceInAutoScalingGroupOutcome > rejected;
+    rejected.set_value(TerminateInstanceInAutoScalingGroupOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsync(const TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, TerminateInstanceInAutoScalingGroupOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper(const TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, TerminateInstanceInAutoScalingGroup(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<TerminateInstanceInAutoScalingGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "TerminateInstanceInAutoScalingGroup", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TerminateInstanceInAutoScalingGroupOutcome(TerminateInstanceInAutoScalingGroupResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TerminateInstanceInAutoScalingGroupOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateAutoScalingGroupOutcome AutoScalingClient::UpdateAutoScalingGroup(const UpdateAutoScalingGroupRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "UpdateAutoScalingGroup");
   if(outcome.IsSuccess())
   {
     return UpdateAutoScalingGroupOutcome(NoResult());
@@ -1596,16 +2748,40 @@ UpdateAutoScalingGroupOutcome AutoScalingClient::UpdateAutoScalingGroup(const Up
 
 UpdateAutoScalingGroupOutcomeCallable AutoScalingClient::UpdateAutoScalingGroupCallable(const UpdateAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::UpdateAutoScalingGroup, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateAutoScalingGroupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateAutoScalingGroup( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateAutoScalingGroupOutcome > rejected;
+    rejected.set_value(UpdateAutoScalingGroupOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void AutoScalingClient::UpdateAutoScalingGroupAsync(const UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::UpdateAutoScalingGroupAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&AutoScalingClient::UpdateAutoScalingGroupAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateAutoScalingGroupOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void AutoScalingClient::UpdateAutoScalingGroupAsyncHelper(const UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateAutoScalingGroup(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<UpdateAutoScalingGroupRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "UpdateAutoScalingGroup", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateAutoScalingGroupOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateAutoScalingGroupOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
@@ -37,6 +37,7 @@
 #include <aws/cloudformation/model/ValidateTemplateResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -237,6 +238,30 @@ namespace Model
          */
         virtual void CancelUpdateStackAsync(const Model::CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels an update on the specified stack. If the call completes successfully,
+         * the stack rolls back the update and reverts to the previous stack
+         * configuration.</p> <note>You can cancel only stacks that are in the
+         * UPDATE_IN_PROGRESS state.</note>
+         *
+         * Returns an awaitable that starts the operation the way CancelUpdateStackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelUpdateStackRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelUpdateStackOutcome> CancelUpdateStackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelUpdateStackOutcome>([this, request](const std::function<void(Model::CancelUpdateStackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelUpdateStackAsync(request, [complete](const CloudFormationClient*, const Model::CancelUpdateStackRequest&, const Model::CancelUpdateStackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelUpdateStackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>For a specified stack that is in the <code>UPDATE_ROLLBACK_FAILED</code>
          * state, continues rolling it back to the <code>UPDATE_ROLLBACK_COMPLETE</code>
@@ -292,6 +317,39 @@ namespace Model
          */
         virtual void ContinueUpdateRollbackAsync(const Model::ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>For a specified stack that is in the <code>UPDATE_ROLLBACK_FAILED</code>
+         * state, continues rolling it back to the <code>UPDATE_ROLLBACK_COMPLETE</code>
+         * state. Depending on the cause of the failure, you can manually <a
+         * href="http://docs.aws.amazon.com/AWSCloudFormation/latest/UserGuide/troubleshooting.html#troubleshooting-errors-update-rollback-failed">
+         * fix the error</a> and continue the rollback. By continuing the rollback, you can
+         * return your stack to a working state (the <code>UPDATE_ROLLBACK_COMPLETE</code>
+         * state), and then try to update the stack again.</p> <p>A stack goes into the
+         * <code>UPDATE_ROLLBACK_FAILED</code> state when AWS CloudFormation cannot roll
+         * back all changes after a failed stack update. For example, you might have a
+         * stack that is rolling back to an old database instance that was deleted outside
+         * of AWS CloudFormation. Because AWS CloudFormation doesn't know the database was
+         * deleted, it assumes that the database instance still exists and attempts to roll
+         * back to it, causing the update rollback to fail.</p>
+         *
+         * Returns an awaitable that starts the operation the way ContinueUpdateRollbackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ContinueUpdateRollbackRequest>
+        Aws::Utils::Threading::Awaitable<Model::ContinueUpdateRollbackOutcome> ContinueUpdateRollbackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ContinueUpdateRollbackOutcome>([this, request](const std::function<void(Model::ContinueUpdateRollbackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ContinueUpdateRollbackAsync(request, [complete](const CloudFormationClient*, const Model::ContinueUpdateRollbackRequest&, const Model::ContinueUpdateRollbackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ContinueUpdateRollbackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a stack as specified in the template. After the call completes
          * successfully, the stack creation starts. You can check the status of the stack
@@ -317,6 +375,29 @@ namespace Model
          */
         virtual void CreateStackAsync(const Model::CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a stack as specified in the template. After the call completes
+         * successfully, the stack creation starts. You can check the status of the stack
+         * via the <a>DescribeStacks</a> API.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateStackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateStackRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateStackOutcome> CreateStackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateStackOutcome>([this, request](const std::function<void(Model::CreateStackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateStackAsync(request, [complete](const CloudFormationClient*, const Model::CreateStackRequest&, const Model::CreateStackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateStackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a specified stack. Once the call completes successfully, stack
          * deletion starts. Deleted stacks do not show up in the <a>DescribeStacks</a> API
@@ -342,6 +423,29 @@ namespace Model
          */
         virtual void DeleteStackAsync(const Model::DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a specified stack. Once the call completes successfully, stack
+         * deletion starts. Deleted stacks do not show up in the <a>DescribeStacks</a> API
+         * if the deletion has been completed successfully.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteStackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteStackRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteStackOutcome> DeleteStackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteStackOutcome>([this, request](const std::function<void(Model::DeleteStackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteStackAsync(request, [complete](const CloudFormationClient*, const Model::DeleteStackRequest&, const Model::DeleteStackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteStackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves your account's AWS CloudFormation limits, such as the maximum
          * number of stacks that you can create in your account.</p>
@@ -364,6 +468,28 @@ namespace Model
          */
         virtual void DescribeAccountLimitsAsync(const Model::DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves your account's AWS CloudFormation limits, such as the maximum
+         * number of stacks that you can create in your account.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAccountLimitsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAccountLimitsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAccountLimitsOutcome> DescribeAccountLimitsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAccountLimitsOutcome>([this, request](const std::function<void(Model::DescribeAccountLimitsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAccountLimitsAsync(request, [complete](const CloudFormationClient*, const Model::DescribeAccountLimitsRequest&, const Model::DescribeAccountLimitsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAccountLimitsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns all stack related events for a specified stack. For more information
          * about a stack's event history, go to <a
@@ -398,6 +524,32 @@ namespace Model
          */
         virtual void DescribeStackEventsAsync(const Model::DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns all stack related events for a specified stack. For more information
+         * about a stack's event history, go to <a
+         * href="http://docs.aws.amazon.com/AWSCloudFormation/latest/UserGuide/concept-stack.html">Stacks</a>
+         * in the AWS CloudFormation User Guide.</p> <note>You can list events for stacks
+         * that have failed to create or have been deleted by specifying the unique stack
+         * identifier (stack ID).</note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeStackEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeStackEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeStackEventsOutcome> DescribeStackEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeStackEventsOutcome>([this, request](const std::function<void(Model::DescribeStackEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeStackEventsAsync(request, [complete](const CloudFormationClient*, const Model::DescribeStackEventsRequest&, const Model::DescribeStackEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeStackEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a description of the specified resource in the specified stack.</p>
          * <p>For deleted stacks, DescribeStackResource returns resource information for up
@@ -423,6 +575,29 @@ namespace Model
          */
         virtual void DescribeStackResourceAsync(const Model::DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a description of the specified resource in the specified stack.</p>
+         * <p>For deleted stacks, DescribeStackResource returns resource information for up
+         * to 90 days after the stack has been deleted.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeStackResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeStackResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeStackResourceOutcome> DescribeStackResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeStackResourceOutcome>([this, request](const std::function<void(Model::DescribeStackResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeStackResourceAsync(request, [complete](const CloudFormationClient*, const Model::DescribeStackResourceRequest&, const Model::DescribeStackResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeStackResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns AWS resource descriptions for running and deleted stacks. If
          * <code>StackName</code> is specified, all the associated resources that are part
@@ -490,6 +665,43 @@ namespace Model
          */
         virtual void DescribeStackResourcesAsync(const Model::DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns AWS resource descriptions for running and deleted stacks. If
+         * <code>StackName</code> is specified, all the associated resources that are part
+         * of the stack are returned. If <code>PhysicalResourceId</code> is specified, the
+         * associated resources of the stack that the resource belongs to are returned.</p>
+         * <note>Only the first 100 resources will be returned. If your stack has more
+         * resources than this, you should use <code>ListStackResources</code>
+         * instead.</note> <p>For deleted stacks, <code>DescribeStackResources</code>
+         * returns resource information for up to 90 days after the stack has been
+         * deleted.</p> <p>You must specify either <code>StackName</code> or
+         * <code>PhysicalResourceId</code>, but not both. In addition, you can specify
+         * <code>LogicalResourceId</code> to filter the returned result. For more
+         * information about resources, the <code>LogicalResourceId</code> and
+         * <code>PhysicalResourceId</code>, go to the <a
+         * href="http://docs.aws.amazon.com/AWSCloudFormation/latest/UserGuide/">AWS
+         * CloudFormation User Guide</a>.</p> <note>A <code>ValidationError</code> is
+         * returned if you specify both <code>StackName</code> and
+         * <code>PhysicalResourceId</code> in the same request.</note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeStackResourcesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeStackResourcesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeStackResourcesOutcome> DescribeStackResourcesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeStackResourcesOutcome>([this, request](const std::function<void(Model::DescribeStackResourcesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeStackResourcesAsync(request, [complete](const CloudFormationClient*, const Model::DescribeStackResourcesRequest&, const Model::DescribeStackResourcesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeStackResourcesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the description for the specified stack; if no stack name was
          * specified, then it returns the description for all the stacks created.</p>
@@ -512,6 +724,28 @@ namespace Model
          */
         virtual void DescribeStacksAsync(const Model::DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the description for the specified stack; if no stack name was
+         * specified, then it returns the description for all the stacks created.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeStacksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeStacksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeStacksOutcome> DescribeStacksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeStacksOutcome>([this, request](const std::function<void(Model::DescribeStacksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeStacksAsync(request, [complete](const CloudFormationClient*, const Model::DescribeStacksRequest&, const Model::DescribeStacksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeStacksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the estimated monthly cost of a template. The return value is an AWS
          * Simple Monthly Calculator URL with a query string that describes the resources
@@ -537,6 +771,29 @@ namespace Model
          */
         virtual void EstimateTemplateCostAsync(const Model::EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the estimated monthly cost of a template. The return value is an AWS
+         * Simple Monthly Calculator URL with a query string that describes the resources
+         * required to run the template.</p>
+         *
+         * Returns an awaitable that starts the operation the way EstimateTemplateCostAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EstimateTemplateCostRequest>
+        Aws::Utils::Threading::Awaitable<Model::EstimateTemplateCostOutcome> EstimateTemplateCostAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EstimateTemplateCostOutcome>([this, request](const std::function<void(Model::EstimateTemplateCostOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EstimateTemplateCostAsync(request, [complete](const CloudFormationClient*, const Model::EstimateTemplateCostRequest&, const Model::EstimateTemplateCostOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EstimateTemplateCostOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the stack policy for a specified stack. If a stack doesn't have a
          * policy, a null value is returned.</p>
@@ -559,6 +816,28 @@ namespace Model
          */
         virtual void GetStackPolicyAsync(const Model::GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the stack policy for a specified stack. If a stack doesn't have a
+         * policy, a null value is returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetStackPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetStackPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetStackPolicyOutcome> GetStackPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetStackPolicyOutcome>([this, request](const std::function<void(Model::GetStackPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetStackPolicyAsync(request, [complete](const CloudFormationClient*, const Model::GetStackPolicyRequest&, const Model::GetStackPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetStackPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the template body for a specified stack. You can get the template for
          * running or deleted stacks.</p> <p>For deleted stacks, GetTemplate returns the
@@ -587,6 +866,30 @@ namespace Model
          */
         virtual void GetTemplateAsync(const Model::GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the template body for a specified stack. You can get the template for
+         * running or deleted stacks.</p> <p>For deleted stacks, GetTemplate returns the
+         * template for up to 90 days after the stack has been deleted.</p> <note> If the
+         * template does not exist, a <code>ValidationError</code> is returned. </note>
+         *
+         * Returns an awaitable that starts the operation the way GetTemplateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetTemplateRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetTemplateOutcome> GetTemplateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetTemplateOutcome>([this, request](const std::function<void(Model::GetTemplateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetTemplateAsync(request, [complete](const CloudFormationClient*, const Model::GetTemplateRequest&, const Model::GetTemplateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetTemplateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about a new or existing template. The
          * <code>GetTemplateSummary</code> action is useful for viewing parameter
@@ -630,6 +933,35 @@ namespace Model
          */
         virtual void GetTemplateSummaryAsync(const Model::GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about a new or existing template. The
+         * <code>GetTemplateSummary</code> action is useful for viewing parameter
+         * information, such as default parameter values and parameter types, before you
+         * create or update a stack.</p> <p>You can use the <code>GetTemplateSummary</code>
+         * action when you submit a template, or you can get template information for a
+         * running or deleted stack.</p> <p>For deleted stacks,
+         * <code>GetTemplateSummary</code> returns the template information for up to 90
+         * days after the stack has been deleted. If the template does not exist, a
+         * <code>ValidationError</code> is returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetTemplateSummaryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetTemplateSummaryRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetTemplateSummaryOutcome> GetTemplateSummaryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetTemplateSummaryOutcome>([this, request](const std::function<void(Model::GetTemplateSummaryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetTemplateSummaryAsync(request, [complete](const CloudFormationClient*, const Model::GetTemplateSummaryRequest&, const Model::GetTemplateSummaryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetTemplateSummaryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns descriptions of all resources of the specified stack.</p> <p>For
          * deleted stacks, ListStackResources returns resource information for up to 90
@@ -655,6 +987,29 @@ namespace Model
          */
         virtual void ListStackResourcesAsync(const Model::ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns descriptions of all resources of the specified stack.</p> <p>For
+         * deleted stacks, ListStackResources returns resource information for up to 90
+         * days after the stack has been deleted.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListStackResourcesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListStackResourcesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListStackResourcesOutcome> ListStackResourcesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListStackResourcesOutcome>([this, request](const std::function<void(Model::ListStackResourcesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListStackResourcesAsync(request, [complete](const CloudFormationClient*, const Model::ListStackResourcesRequest&, const Model::ListStackResourcesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListStackResourcesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the summary information for stacks whose status matches the specified
          * StackStatusFilter. Summary information for stacks that have been deleted is kept
@@ -686,6 +1041,31 @@ namespace Model
          */
         virtual void ListStacksAsync(const Model::ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the summary information for stacks whose status matches the specified
+         * StackStatusFilter. Summary information for stacks that have been deleted is kept
+         * for 90 days after the stack is deleted. If no StackStatusFilter is specified,
+         * summary information for all stacks is returned (including existing stacks and
+         * stacks that have been deleted).</p>
+         *
+         * Returns an awaitable that starts the operation the way ListStacksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListStacksRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListStacksOutcome> ListStacksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListStacksOutcome>([this, request](const std::function<void(Model::ListStacksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListStacksAsync(request, [complete](const CloudFormationClient*, const Model::ListStacksRequest&, const Model::ListStacksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListStacksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets a stack policy for a specified stack.</p>
          */
@@ -705,6 +1085,27 @@ namespace Model
          */
         virtual void SetStackPolicyAsync(const Model::SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets a stack policy for a specified stack.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetStackPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetStackPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetStackPolicyOutcome> SetStackPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetStackPolicyOutcome>([this, request](const std::function<void(Model::SetStackPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetStackPolicyAsync(request, [complete](const CloudFormationClient*, const Model::SetStackPolicyRequest&, const Model::SetStackPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetStackPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sends a signal to the specified resource with a success or failure status.
          * You can use the SignalResource API in conjunction with a creation policy or
@@ -739,6 +1140,32 @@ namespace Model
          */
         virtual void SignalResourceAsync(const Model::SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sends a signal to the specified resource with a success or failure status.
+         * You can use the SignalResource API in conjunction with a creation policy or
+         * update policy. AWS CloudFormation doesn't proceed with a stack creation or
+         * update until resources receive the required number of signals or the timeout
+         * period is exceeded. The SignalResource API is useful in cases where you want to
+         * send signals from anywhere other than an Amazon EC2 instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way SignalResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SignalResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::SignalResourceOutcome> SignalResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SignalResourceOutcome>([this, request](const std::function<void(Model::SignalResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SignalResourceAsync(request, [complete](const CloudFormationClient*, const Model::SignalResourceRequest&, const Model::SignalResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SignalResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a stack as specified in the template. After the call completes
          * successfully, the stack update starts. You can check the status of the stack via
@@ -779,6 +1206,34 @@ namespace Model
          */
         virtual void UpdateStackAsync(const Model::UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a stack as specified in the template. After the call completes
+         * successfully, the stack update starts. You can check the status of the stack via
+         * the <a>DescribeStacks</a> action.</p> <p>To get a copy of the template for an
+         * existing stack, you can use the <a>GetTemplate</a> action.</p> <p>For more
+         * information about creating an update template, updating a stack, and monitoring
+         * the progress of the update, see <a
+         * href="http://docs.aws.amazon.com/AWSCloudFormation/latest/UserGuide/using-cfn-updating-stacks.html">Updating
+         * a Stack</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateStackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateStackRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateStackOutcome> UpdateStackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateStackOutcome>([this, request](const std::function<void(Model::UpdateStackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateStackAsync(request, [complete](const CloudFormationClient*, const Model::UpdateStackRequest&, const Model::UpdateStackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateStackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Validates a specified template.</p>
          */
@@ -798,6 +1253,27 @@ namespace Model
          */
         virtual void ValidateTemplateAsync(const Model::ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Validates a specified template.</p>
+         *
+         * Returns an awaitable that starts the operation the way ValidateTemplateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ValidateTemplateRequest>
+        Aws::Utils::Threading::Awaitable<Model::ValidateTemplateOutcome> ValidateTemplateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ValidateTemplateOutcome>([this, request](const std::function<void(Model::ValidateTemplateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ValidateTemplateAsync(request, [complete](const CloudFormationClient*, const Model::ValidateTemplateRequest&, const Model::ValidateTemplateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ValidateTemplateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -113,7 +113,7 @@ CancelUpdateStackOutcome CloudFormationClient::CancelUpdateStack(const CancelUpd
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CancelUpdateStack");
   if(outcome.IsSuccess())
   {
     return CancelUpdateStackOutcome(NoResult());
@@ -126,24 +126,48 @@ CancelUpdateStackOutcome CloudFormationClient::CancelUpdateStack(const CancelUpd
 
 CancelUpdateStackOutcomeCallable CloudFormationClient::CancelUpdateStackCallable(const CancelUpdateStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::CancelUpdateStack, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CancelUpdateStackOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CancelUpdateStack( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CancelUpdateStackOutcome > rejected;
+    rejected.set_value(CancelUpdateStackOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::CancelUpdateStackAsync(const CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::CancelUpdateStackAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::CancelUpdateStackAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CancelUpdateStackOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::CancelUpdateStackAsyncHelper(const CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CancelUpdateStack(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CancelUpdateStackRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CancelUpdateStack", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CancelUpdateStackOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CancelUpdateStackOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ContinueUpdateRollbackOutcome CloudFormationClient::ContinueUpdateRollback(const ContinueUpdateRollbackRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ContinueUpdateRollback");
   if(outcome.IsSuccess())
   {
     return ContinueUpdateRollbackOutcome(ContinueUpdateRollbackResult(outcome.GetResult()));
@@ -156,24 +180,48 @@ ContinueUpdateRollbackOutcome CloudFormationClient::ContinueUpdateRollback(const
 
 ContinueUpdateRollbackOutcomeCallable CloudFormationClient::ContinueUpdateRollbackCallable(const ContinueUpdateRollbackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ContinueUpdateRollback, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ContinueUpdateRollbackOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ContinueUpdateRollback( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ContinueUpdateRollbackOutcome > rejected;
+    rejected.set_value(ContinueUpdateRollbackOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::ContinueUpdateRollbackAsync(const ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ContinueUpdateRollbackAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::ContinueUpdateRollbackAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ContinueUpdateRollbackOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::ContinueUpdateRollbackAsyncHelper(const ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ContinueUpdateRollback(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ContinueUpdateRollbackRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ContinueUpdateRollback", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ContinueUpdateRollbackOutcome(ContinueUpdateRollbackResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ContinueUpdateRollbackOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateStackOutcome CloudFormationClient::CreateStack(const CreateStackRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateStack");
   if(outcome.IsSuccess())
   {
     return CreateStackOutcome(CreateStackResult(outcome.GetResult()));
@@ -186,24 +234,48 @@ CreateStackOutcome CloudFormationClient::CreateStack(const CreateStackRequest& r
 
 CreateStackOutcomeCallable CloudFormationClient::CreateStackCallable(const CreateStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::CreateStack, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateStackOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateStack( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateStackOutcome > rejected;
+    rejected.set_value(CreateStackOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::CreateStackAsync(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::CreateStackAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::CreateStackAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateStackOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::CreateStackAsyncHelper(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateStack(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<CreateStackRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateStack", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateStackOutcome(CreateStackResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateStackOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteStackOutcome CloudFormationClient::DeleteStack(const DeleteStackRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeleteStack");
   if(outcome.IsSuccess())
   {
     return DeleteStackOutcome(NoResult());
@@ -216,24 +288,48 @@ DeleteStackOutcome CloudFormationClient::DeleteStack(const DeleteStackRequest& r
 
 DeleteStackOutcomeCallable CloudFormationClient::DeleteStackCallable(const DeleteStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DeleteStack, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteStackOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteStack( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteStackOutcome > rejected;
+    rejected.set_value(DeleteStackOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DeleteStackAsync(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DeleteStackAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::DeleteStackAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteStackOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::DeleteStackAsyncHelper(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteStack(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DeleteStackRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeleteStack", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteStackOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteStackOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeAccountLimitsOutcome CloudFormationClient::DescribeAccountLimits(const DescribeAccountLimitsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeAccountLimits");
   if(outcome.IsSuccess())
   {
     return DescribeAccountLimitsOutcome(DescribeAccountLimitsResult(outcome.GetResult()));
@@ -246,24 +342,48 @@ DescribeAccountLimitsOutcome CloudFormationClient::DescribeAccountLimits(const D
 
 DescribeAccountLimitsOutcomeCallable CloudFormationClient::DescribeAccountLimitsCallable(const DescribeAccountLimitsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeAccountLimits, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeAccountLimitsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeAccountLimits( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeAccountLimitsOutcome > rejected;
+    rejected.set_value(DescribeAccountLimitsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DescribeAccountLimitsAsync(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeAccountLimitsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::DescribeAccountLimitsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeAccountLimitsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::DescribeAccountLimitsAsyncHelper(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeAccountLimits(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeAccountLimitsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeAccountLimits", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeAccountLimitsOutcome(DescribeAccountLimitsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeAccountLimitsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeStackEventsOutcome CloudFormationClient::DescribeStackEvents(const DescribeStackEventsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeStackEvents");
   if(outcome.IsSuccess())
   {
     return DescribeStackEventsOutcome(DescribeStackEventsResult(outcome.GetResult()));
@@ -276,24 +396,48 @@ DescribeStackEventsOutcome CloudFormationClient::DescribeStackEvents(const Descr
 
 DescribeStackEventsOutcomeCallable CloudFormationClient::DescribeStackEventsCallable(const DescribeStackEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStackEvents, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeStackEventsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeStackEvents( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeStackEventsOutcome > rejected;
+    rejected.set_value(DescribeStackEventsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DescribeStackEventsAsync(const DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStackEventsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::DescribeStackEventsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeStackEventsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::DescribeStackEventsAsyncHelper(const DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeStackEvents(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeStackEventsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeStackEvents", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeStackEventsOutcome(DescribeStackEventsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeStackEventsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeStackResourceOutcome CloudFormationClient::DescribeStackResource(const DescribeStackResourceRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeStackResource");
   if(outcome.IsSuccess())
   {
     return DescribeStackResourceOutcome(DescribeStackResourceResult(outcome.GetResult()));
@@ -306,24 +450,48 @@ DescribeStackResourceOutcome CloudFormationClient::DescribeStackResource(const D
 
 DescribeStackResourceOutcomeCallable CloudFormationClient::DescribeStackResourceCallable(const DescribeStackResourceRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStackResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeStackResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeStackResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeStackResourceOutcome > rejected;
+    rejected.set_value(DescribeStackResourceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DescribeStackResourceAsync(const DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStackResourceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::DescribeStackResourceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeStackResourceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::DescribeStackResourceAsyncHelper(const DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeStackResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeStackResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeStackResource", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeStackResourceOutcome(DescribeStackResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeStackResourceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeStackResourcesOutcome CloudFormationClient::DescribeStackResources(const DescribeStackResourcesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeStackResources");
   if(outcome.IsSuccess())
   {
     return DescribeStackResourcesOutcome(DescribeStackResourcesResult(outcome.GetResult()));
@@ -336,24 +504,48 @@ DescribeStackResourcesOutcome CloudFormationClient::DescribeStackResources(const
 
 DescribeStackResourcesOutcomeCallable CloudFormationClient::DescribeStackResourcesCallable(const DescribeStackResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStackResources, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeStackResourcesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeStackResources( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeStackResourcesOutcome > rejected;
+    rejected.set_value(DescribeStackResourcesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DescribeStackResourcesAsync(const DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStackResourcesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::DescribeStackResourcesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeStackResourcesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::DescribeStackResourcesAsyncHelper(const DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeStackResources(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeStackResourcesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeStackResources", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeStackResourcesOutcome(DescribeStackResourcesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeStackResourcesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeStacksOutcome CloudFormationClient::DescribeStacks(const DescribeStacksRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DescribeStacks");
   if(outcome.IsSuccess())
   {
     return DescribeStacksOutcome(DescribeStacksResult(outcome.GetResult()));
@@ -366,24 +558,48 @@ DescribeStacksOutcome CloudFormationClient::DescribeStacks(const DescribeStacksR
 
 DescribeStacksOutcomeCallable CloudFormationClient::DescribeStacksCallable(const DescribeStacksRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStacks, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeStacksOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeStacks( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeStacksOutcome > rejected;
+    rejected.set_value(DescribeStacksOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::DescribeStacksAsync(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStacksAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::DescribeStacksAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeStacksOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::DescribeStacksAsyncHelper(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeStacks(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<DescribeStacksRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DescribeStacks", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeStacksOutcome(DescribeStacksResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeStacksOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 EstimateTemplateCostOutcome CloudFormationClient::EstimateTemplateCost(const EstimateTemplateCostRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "EstimateTemplateCost");
   if(outcome.IsSuccess())
   {
     return EstimateTemplateCostOutcome(EstimateTemplateCostResult(outcome.GetResult()));
@@ -396,24 +612,48 @@ EstimateTemplateCostOutcome CloudFormationClient::EstimateTemplateCost(const Est
 
 EstimateTemplateCostOutcomeCallable CloudFormationClient::EstimateTemplateCostCallable(const EstimateTemplateCostRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::EstimateTemplateCost, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< EstimateTemplateCostOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->EstimateTemplateCost( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< EstimateTemplateCostOutcome > rejected;
+    rejected.set_value(EstimateTemplateCostOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::EstimateTemplateCostAsync(const EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::EstimateTemplateCostAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::EstimateTemplateCostAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, EstimateTemplateCostOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::EstimateTemplateCostAsyncHelper(const EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, EstimateTemplateCost(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<EstimateTemplateCostRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "EstimateTemplateCost", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, EstimateTemplateCostOutcome(EstimateTemplateCostResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, EstimateTemplateCostOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetStackPolicyOutcome CloudFormationClient::GetStackPolicy(const GetStackPolicyRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "GetStackPolicy");
   if(outcome.IsSuccess())
   {
     return GetStackPolicyOutcome(GetStackPolicyResult(outcome.GetResult()));
@@ -426,24 +666,48 @@ GetStackPolicyOutcome CloudFormationClient::GetStackPolicy(const GetStackPolicyR
 
 GetStackPolicyOutcomeCallable CloudFormationClient::GetStackPolicyCallable(const GetStackPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::GetStackPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetStackPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStackPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetStackPolicyOutcome > rejected;
+    rejected.set_value(GetStackPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::GetStackPolicyAsync(const GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::GetStackPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::GetStackPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetStackPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::GetStackPolicyAsyncHelper(const GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetStackPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<GetStackPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "GetStackPolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStackPolicyOutcome(GetStackPolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStackPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetTemplateOutcome CloudFormationClient::GetTemplate(const GetTemplateRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "GetTemplate");
   if(outcome.IsSuccess())
   {
     return GetTemplateOutcome(GetTemplateResult(outcome.GetResult()));
@@ -456,24 +720,48 @@ GetTemplateOutcome CloudFormationClient::GetTemplate(const GetTemplateRequest& r
 
 GetTemplateOutcomeCallable CloudFormationClient::GetTemplateCallable(const GetTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::GetTemplate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetTemplateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetTemplate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetTemplateOutcome > rejected;
+    rejected.set_value(GetTemplateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::GetTemplateAsync(const GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::GetTemplateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::GetTemplateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetTemplateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::GetTemplateAsyncHelper(const GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetTemplate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<GetTemplateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "GetTemplate", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetTemplateOutcome(GetTemplateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetTemplateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetTemplateSummaryOutcome CloudFormationClient::GetTemplateSummary(const GetTemplateSummaryRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "GetTemplateSummary");
   if(outcome.IsSuccess())
   {
     return GetTemplateSummaryOutcome(GetTemplateSummaryResult(outcome.GetResult()));
@@ -486,24 +774,48 @@ GetTemplateSummaryOutcome CloudFormationClient::GetTemplateSummary(const GetTemp
 
 GetTemplateSummaryOutcomeCallable CloudFormationClient::GetTemplateSummaryCallable(const GetTemplateSummaryRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::GetTemplateSummary, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetTemplateSummaryOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetTemplateSummary( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetTemplateSummaryOutcome > rejected;
+    rejected.set_value(GetTemplateSummaryOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::GetTemplateSummaryAsync(const GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::GetTemplateSummaryAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::GetTemplateSummaryAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetTemplateSummaryOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::GetTemplateSummaryAsyncHelper(const GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetTemplateSummary(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<GetTemplateSummaryRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "GetTemplateSummary", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetTemplateSummaryOutcome(GetTemplateSummaryResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetTemplateSummaryOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListStackResourcesOutcome CloudFormationClient::ListStackResources(const ListStackResourcesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ListStackResources");
   if(outcome.IsSuccess())
   {
     return ListStackResourcesOutcome(ListStackResourcesResult(outcome.GetResult()));
@@ -516,24 +828,48 @@ ListStackResourcesOutcome CloudFormationClient::ListStackResources(const ListSta
 
 ListStackResourcesOutcomeCallable CloudFormationClient::ListStackResourcesCallable(const ListStackResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ListStackResources, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListStackResourcesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListStackResources( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListStackResourcesOutcome > rejected;
+    rejected.set_value(ListStackResourcesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::ListStackResourcesAsync(const ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ListStackResourcesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::ListStackResourcesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListStackResourcesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::ListStackResourcesAsyncHelper(const ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListStackResources(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ListStackResourcesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ListStackResources", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListStackResourcesOutcome(ListStackResourcesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListStackResourcesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListStacksOutcome CloudFormationClient::ListStacks(const ListStacksRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ListStacks");
   if(outcome.IsSuccess())
   {
     return ListStacksOutcome(ListStacksResult(outcome.GetResult()));
@@ -546,24 +882,48 @@ ListStacksOutcome CloudFormationClient::ListStacks(const ListStacksRequest& requ
 
 ListStacksOutcomeCallable CloudFormationClient::ListStacksCallable(const ListStacksRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ListStacks, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListStacksOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListStacks( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListStacksOutcome > rejected;
+    rejected.set_value(ListStacksOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::ListStacksAsync(const ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ListStacksAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::ListStacksAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListStacksOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::ListStacksAsyncHelper(const ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListStacks(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ListStacksRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ListStacks", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListStacksOutcome(ListStacksResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListStacksOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SetStackPolicyOutcome CloudFormationClient::SetStackPolicy(const SetStackPolicyRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "SetStackPolicy");
   if(outcome.IsSuccess())
   {
     return SetStackPolicyOutcome(NoResult());
@@ -576,24 +936,48 @@ SetStackPolicyOutcome CloudFormationClient::SetStackPolicy(const SetStackPolicyR
 
 SetStackPolicyOutcomeCallable CloudFormationClient::SetStackPolicyCallable(const SetStackPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::SetStackPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetStackPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetStackPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SetStackPolicyOutcome > rejected;
+    rejected.set_value(SetStackPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::SetStackPolicyAsync(const SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::SetStackPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::SetStackPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SetStackPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::SetStackPolicyAsyncHelper(const SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SetStackPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SetStackPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "SetStackPolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetStackPolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetStackPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SignalResourceOutcome CloudFormationClient::SignalResource(const SignalResourceRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "SignalResource");
   if(outcome.IsSuccess())
   {
     return SignalResourceOutcome(NoResult());
@@ -606,24 +990,48 @@ SignalResourceOutcome CloudFormationClient::SignalResource(const SignalResourceR
 
 SignalResourceOutcomeCallable CloudFormationClient::SignalResourceCallable(const SignalResourceRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::SignalResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SignalResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SignalResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SignalResourceOutcome > rejected;
+    rejected.set_value(SignalResourceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::SignalResourceAsync(const SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::SignalResourceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::SignalResourceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SignalResourceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::SignalResourceAsyncHelper(const SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SignalResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<SignalResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "SignalResource", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SignalResourceOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SignalResourceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateStackOutcome CloudFormationClient::UpdateStack(const UpdateStackRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "UpdateStack");
   if(outcome.IsSuccess())
   {
     return UpdateStackOutcome(UpdateStackResult(outcome.GetResult()));
@@ -636,24 +1044,48 @@ UpdateStackOutcome CloudFormationClient::UpdateStack(const UpdateStackRequest& r
 
 UpdateStackOutcomeCallable CloudFormationClient::UpdateStackCallable(const UpdateStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::UpdateStack, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateStackOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateStack( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateStackOutcome > rejected;
+    rejected.set_value(UpdateStackOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::UpdateStackAsync(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::UpdateStackAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::UpdateStackAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateStackOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::UpdateStackAsyncHelper(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateStack(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<UpdateStackRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "UpdateStack", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateStackOutcome(UpdateStackResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateStackOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ValidateTemplateOutcome CloudFormationClient::ValidateTemplate(const ValidateTemplateRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ValidateTemplate");
   if(outcome.IsSuccess())
   {
     return ValidateTemplateOutcome(ValidateTemplateResult(outcome.GetResult()));
@@ -666,16 +1098,40 @@ ValidateTemplateOutcome CloudFormationClient::ValidateTemplate(const ValidateTem
 
 ValidateTemplateOutcomeCallable CloudFormationClient::ValidateTemplateCallable(const ValidateTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ValidateTemplate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ValidateTemplateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ValidateTemplate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ValidateTemplateOutcome > rejected;
+    rejected.set_value(ValidateTemplateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFormationClient::ValidateTemplateAsync(const ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ValidateTemplateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFormationClient::ValidateTemplateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ValidateTemplateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFormationClient::ValidateTemplateAsyncHelper(const ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ValidateTemplate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  auto sharedRequest = Aws::MakeShared<ValidateTemplateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ValidateTemplate", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ValidateTemplateOutcome(ValidateTemplateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ValidateTemplateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
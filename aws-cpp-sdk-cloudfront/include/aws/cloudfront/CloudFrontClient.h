@@ -41,6 +41,7 @@
 #include <aws/cloudfront/model/UpdateStreamingDistribution2016_01_28Result.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -226,6 +227,27 @@ namespace Model
          */
         virtual void CreateCloudFrontOriginAccessIdentity2016_01_28Async(const Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Create a new origin access identity.
+         *
+         * Returns an awaitable that starts the operation the way CreateCloudFrontOriginAccessIdentity2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::CreateCloudFrontOriginAccessIdentity2016_01_28Outcome> CreateCloudFrontOriginAccessIdentity2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateCloudFrontOriginAccessIdentity2016_01_28Outcome>([this, request](const std::function<void(Model::CreateCloudFrontOriginAccessIdentity2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateCloudFrontOriginAccessIdentity2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request&, const Model::CreateCloudFrontOriginAccessIdentity2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateCloudFrontOriginAccessIdentity2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Create a new distribution.
          */
@@ -245,6 +267,27 @@ namespace Model
          */
         virtual void CreateDistribution2016_01_28Async(const Model::CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Create a new distribution.
+         *
+         * Returns an awaitable that starts the operation the way CreateDistribution2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDistribution2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::CreateDistribution2016_01_28Outcome> CreateDistribution2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDistribution2016_01_28Outcome>([this, request](const std::function<void(Model::CreateDistribution2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDistribution2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::CreateDistribution2016_01_28Request&, const Model::CreateDistribution2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDistribution2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Create a new invalidation.
          */
@@ -264,6 +307,27 @@ namespace Model
          */
         virtual void CreateInvalidation2016_01_28Async(const Model::CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Create a new invalidation.
+         *
+         * Returns an awaitable that starts the operation the way CreateInvalidation2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateInvalidation2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::CreateInvalidation2016_01_28Outcome> CreateInvalidation2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateInvalidation2016_01_28Outcome>([this, request](const std::function<void(Model::CreateInvalidation2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateInvalidation2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::CreateInvalidation2016_01_28Request&, const Model::CreateInvalidation2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateInvalidation2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Create a new streaming distribution.
          */
@@ -283,6 +347,27 @@ namespace Model
          */
         virtual void CreateStreamingDistribution2016_01_28Async(const Model::CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Create a new streaming distribution.
+         *
+         * Returns an awaitable that starts the operation the way CreateStreamingDistribution2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateStreamingDistribution2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::CreateStreamingDistribution2016_01_28Outcome> CreateStreamingDistribution2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateStreamingDistribution2016_01_28Outcome>([this, request](const std::function<void(Model::CreateStreamingDistribution2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateStreamingDistribution2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::CreateStreamingDistribution2016_01_28Request&, const Model::CreateStreamingDistribution2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateStreamingDistribution2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Delete an origin access identity.
          */
@@ -302,6 +387,27 @@ namespace Model
          */
         virtual void DeleteCloudFrontOriginAccessIdentity2016_01_28Async(const Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Delete an origin access identity.
+         *
+         * Returns an awaitable that starts the operation the way DeleteCloudFrontOriginAccessIdentity2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome> DeleteCloudFrontOriginAccessIdentity2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome>([this, request](const std::function<void(Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteCloudFrontOriginAccessIdentity2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request&, const Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Delete a distribution.
          */
@@ -321,6 +427,27 @@ namespace Model
          */
         virtual void DeleteDistribution2016_01_28Async(const Model::DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Delete a distribution.
+         *
+         * Returns an awaitable that starts the operation the way DeleteDistribution2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDistribution2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDistribution2016_01_28Outcome> DeleteDistribution2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDistribution2016_01_28Outcome>([this, request](const std::function<void(Model::DeleteDistribution2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDistribution2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::DeleteDistribution2016_01_28Request&, const Model::DeleteDistribution2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDistribution2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Delete a streaming distribution.
          */
@@ -340,6 +467,27 @@ namespace Model
          */
         virtual void DeleteStreamingDistribution2016_01_28Async(const Model::DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Delete a streaming distribution.
+         *
+         * Returns an awaitable that starts the operation the way DeleteStreamingDistribution2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteStreamingDistribution2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::DeleteStreamingDistribution2016_01_28Outcome> DeleteStreamingDistribution2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteStreamingDistribution2016_01_28Outcome>([this, request](const std::function<void(Model::DeleteStreamingDistribution2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteStreamingDistribution2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::DeleteStreamingDistribution2016_01_28Request&, const Model::DeleteStreamingDistribution2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteStreamingDistribution2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Get the information about an origin access identity.
          */
@@ -359,6 +507,27 @@ namespace Model
          */
         virtual void GetCloudFrontOriginAccessIdentity2016_01_28Async(const Model::GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Get the information about an origin access identity.
+         *
+         * Returns an awaitable that starts the operation the way GetCloudFrontOriginAccessIdentity2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetCloudFrontOriginAccessIdentity2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::GetCloudFrontOriginAccessIdentity2016_01_28Outcome> GetCloudFrontOriginAccessIdentity2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetCloudFrontOriginAccessIdentity2016_01_28Outcome>([this, request](const std::function<void(Model::GetCloudFrontOriginAccessIdentity2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetCloudFrontOriginAccessIdentity2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::GetCloudFrontOriginAccessIdentity2016_01_28Request&, const Model::GetCloudFrontOriginAccessIdentity2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetCloudFrontOriginAccessIdentity2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Get the configuration information about an origin access identity.
          */
@@ -378,6 +547,27 @@ namespace Model
          */
         virtual void GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(const Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Get the configuration information about an origin access identity.
+         *
+         * Returns an awaitable that starts the operation the way GetCloudFrontOriginAccessIdentityConfig2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome> GetCloudFrontOriginAccessIdentityConfig2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome>([this, request](const std::function<void(Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&, const Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Get the information about a distribution.
          */
@@ -397,6 +587,27 @@ namespace Model
          */
         virtual void GetDistribution2016_01_28Async(const Model::GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Get the information about a distribution.
+         *
+         * Returns an awaitable that starts the operation the way GetDistribution2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDistribution2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::GetDistribution2016_01_28Outcome> GetDistribution2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDistribution2016_01_28Outcome>([this, request](const std::function<void(Model::GetDistribution2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDistribution2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::GetDistribution2016_01_28Request&, const Model::GetDistribution2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDistribution2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Get the configuration information about a distribution.
          */
@@ -416,6 +627,27 @@ namespace Model
          */
         virtual void GetDistributionConfig2016_01_28Async(const Model::GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Get the configuration information about a distribution.
+         *
+         * Returns an awaitable that starts the operation the way GetDistributionConfig2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDistributionConfig2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::GetDistributionConfig2016_01_28Outcome> GetDistributionConfig2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDistributionConfig2016_01_28Outcome>([this, request](const std::function<void(Model::GetDistributionConfig2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDistributionConfig2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::GetDistributionConfig2016_01_28Request&, const Model::GetDistributionConfig2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDistributionConfig2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Get the information about an invalidation.
          */
@@ -435,6 +667,27 @@ namespace Model
          */
         virtual void GetInvalidation2016_01_28Async(const Model::GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Get the information about an invalidation.
+         *
+         * Returns an awaitable that starts the operation the way GetInvalidation2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetInvalidation2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::GetInvalidation2016_01_28Outcome> GetInvalidation2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetInvalidation2016_01_28Outcome>([this, request](const std::function<void(Model::GetInvalidation2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetInvalidation2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::GetInvalidation2016_01_28Request&, const Model::GetInvalidation2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetInvalidation2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Get the information about a streaming distribution.
          */
@@ -454,6 +707,27 @@ namespace Model
          */
         virtual void GetStreamingDistribution2016_01_28Async(const Model::GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Get the information about a streaming distribution.
+         *
+         * Returns an awaitable that starts the operation the way GetStreamingDistribution2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetStreamingDistribution2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::GetStreamingDistribution2016_01_28Outcome> GetStreamingDistribution2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetStreamingDistribution2016_01_28Outcome>([this, request](const std::function<void(Model::GetStreamingDistribution2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetStreamingDistribution2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::GetStreamingDistribution2016_01_28Request&, const Model::GetStreamingDistribution2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetStreamingDistribution2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Get the configuration information about a streaming distribution.
          */
@@ -473,6 +747,27 @@ namespace Model
          */
         virtual void GetStreamingDistributionConfig2016_01_28Async(const Model::GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Get the configuration information about a streaming distribution.
+         *
+         * Returns an awaitable that starts the operation the way GetStreamingDistributionConfig2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetStreamingDistributionConfig2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::GetStreamingDistributionConfig2016_01_28Outcome> GetStreamingDistributionConfig2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetStreamingDistributionConfig2016_01_28Outcome>([this, request](const std::function<void(Model::GetStreamingDistributionConfig2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetStreamingDistributionConfig2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::GetStreamingDistributionConfig2016_01_28Request&, const Model::GetStreamingDistributionConfig2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetStreamingDistributionConfig2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * List origin access identities.
          */
@@ -492,6 +787,27 @@ namespace Model
          */
         virtual void ListCloudFrontOriginAccessIdentities2016_01_28Async(const Model::ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * List origin access identities.
+         *
+         * Returns an awaitable that starts the operation the way ListCloudFrontOriginAccessIdentities2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListCloudFrontOriginAccessIdentities2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::ListCloudFrontOriginAccessIdentities2016_01_28Outcome> ListCloudFrontOriginAccessIdentities2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListCloudFrontOriginAccessIdentities2016_01_28Outcome>([this, request](const std::function<void(Model::ListCloudFrontOriginAccessIdentities2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListCloudFrontOriginAccessIdentities2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::ListCloudFrontOriginAccessIdentities2016_01_28Request&, const Model::ListCloudFrontOriginAccessIdentities2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListCloudFrontOriginAccessIdentities2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * List distributions.
          */
@@ -511,6 +827,27 @@ namespace Model
          */
         virtual void ListDistributions2016_01_28Async(const Model::ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * List distributions.
+         *
+         * Returns an awaitable that starts the operation the way ListDistributions2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDistributions2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::ListDistributions2016_01_28Outcome> ListDistributions2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDistributions2016_01_28Outcome>([this, request](const std::function<void(Model::ListDistributions2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDistributions2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::ListDistributions2016_01_28Request&, const Model::ListDistributions2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDistributions2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * List the distributions that are associated with a specified AWS WAF web ACL.
          */
@@ -530,6 +867,27 @@ namespace Model
          */
         virtual void ListDistributionsByWebACLId2016_01_28Async(const Model::ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * List the distributions that are associated with a specified AWS WAF web ACL.
+         *
+         * Returns an awaitable that starts the operation the way ListDistributionsByWebACLId2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDistributionsByWebACLId2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::ListDistributionsByWebACLId2016_01_28Outcome> ListDistributionsByWebACLId2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDistributionsByWebACLId2016_01_28Outcome>([this, request](const std::function<void(Model::ListDistributionsByWebACLId2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDistributionsByWebACLId2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::ListDistributionsByWebACLId2016_01_28Request&, const Model::ListDistributionsByWebACLId2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDistributionsByWebACLId2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * List invalidation batches.
          */
@@ -549,6 +907,27 @@ namespace Model
          */
         virtual void ListInvalidations2016_01_28Async(const Model::ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * List invalidation batches.
+         *
+         * Returns an awaitable that starts the operation the way ListInvalidations2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListInvalidations2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::ListInvalidations2016_01_28Outcome> ListInvalidations2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListInvalidations2016_01_28Outcome>([this, request](const std::function<void(Model::ListInvalidations2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListInvalidations2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::ListInvalidations2016_01_28Request&, const Model::ListInvalidations2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListInvalidations2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * List streaming distributions.
          */
@@ -568,6 +947,27 @@ namespace Model
          */
         virtual void ListStreamingDistributions2016_01_28Async(const Model::ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * List streaming distributions.
+         *
+         * Returns an awaitable that starts the operation the way ListStreamingDistributions2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListStreamingDistributions2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::ListStreamingDistributions2016_01_28Outcome> ListStreamingDistributions2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListStreamingDistributions2016_01_28Outcome>([this, request](const std::function<void(Model::ListStreamingDistributions2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListStreamingDistributions2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::ListStreamingDistributions2016_01_28Request&, const Model::ListStreamingDistributions2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListStreamingDistributions2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Update an origin access identity.
          */
@@ -587,6 +987,27 @@ namespace Model
          */
         virtual void UpdateCloudFrontOriginAccessIdentity2016_01_28Async(const Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Update an origin access identity.
+         *
+         * Returns an awaitable that starts the operation the way UpdateCloudFrontOriginAccessIdentity2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome> UpdateCloudFrontOriginAccessIdentity2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome>([this, request](const std::function<void(Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateCloudFrontOriginAccessIdentity2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request&, const Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Update a distribution.
          */
@@ -606,6 +1027,27 @@ namespace Model
          */
         virtual void UpdateDistribution2016_01_28Async(const Model::UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Update a distribution.
+         *
+         * Returns an awaitable that starts the operation the way UpdateDistribution2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDistribution2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDistribution2016_01_28Outcome> UpdateDistribution2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDistribution2016_01_28Outcome>([this, request](const std::function<void(Model::UpdateDistribution2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDistribution2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::UpdateDistribution2016_01_28Request&, const Model::UpdateDistribution2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDistribution2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Update a streaming distribution.
          */
@@ -625,6 +1067,27 @@ namespace Model
          */
         virtual void UpdateStreamingDistribution2016_01_28Async(const Model::UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Update a streaming distribution.
+         *
+         * Returns an awaitable that starts the operation the way UpdateStreamingDistribution2016_01_28Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateStreamingDistribution2016_01_28Request>
+        Aws::Utils::Threading::Awaitable<Model::UpdateStreamingDistribution2016_01_28Outcome> UpdateStreamingDistribution2016_01_28Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateStreamingDistribution2016_01_28Outcome>([this, request](const std::function<void(Model::UpdateStreamingDistribution2016_01_28Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateStreamingDistribution2016_01_28Async(request, [complete](const CloudFrontClient*, const Model::UpdateStreamingDistribution2016_01_28Request&, const Model::UpdateStreamingDistribution2016_01_28Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateStreamingDistribution2016_01_28Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
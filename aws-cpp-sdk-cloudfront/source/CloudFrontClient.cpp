@@ -116,7 +116,7 @@ CreateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::CreateCl
 {
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateCloudFrontOriginAccessIdentity2016_01_28");
   if(outcome.IsSuccess())
   {
     return CreateCloudFrontOriginAccessIdentity2016_01_28Outcome(CreateCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult()));
@@ -129,24 +129,48 @@ CreateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::CreateCl
 
 CreateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Callable(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateCloudFrontOriginAccessIdentity2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateCloudFrontOriginAccessIdentity2016_01_28Outcome > rejected;
+    rejected.set_value(CreateCloudFrontOriginAccessIdentity2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Async(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateCloudFrontOriginAccessIdentity2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateCloudFrontOriginAccessIdentity2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront";
+  auto sharedRequest = Aws::MakeShared<CreateCloudFrontOriginAccessIdentity2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateCloudFrontOriginAccessIdentity2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateCloudFrontOriginAccessIdentity2016_01_28Outcome(CreateCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateCloudFrontOriginAccessIdentity2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateDistribution2016_01_28Outcome CloudFrontClient::CreateDistribution2016_01_28(const CreateDistribution2016_01_28Request& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/distribution";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateDistribution2016_01_28");
   if(outcome.IsSuccess())
   {
     return CreateDistribution2016_01_28Outcome(CreateDistribution2016_01_28Result(outcome.GetResult()));
@@ -159,17 +183,41 @@ CreateDistribution2016_01_28Outcome CloudFrontClient::CreateDistribution2016_01_
 
 CreateDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateDistribution2016_01_28Callable(const CreateDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateDistribution2016_01_28Outcome > rejected;
+    rejected.set_value(CreateDistribution2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::CreateDistribution2016_01_28Async(const CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::CreateDistribution2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateDistribution2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::CreateDistribution2016_01_28AsyncHelper(const CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution";
+  auto sharedRequest = Aws::MakeShared<CreateDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateDistribution2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateDistribution2016_01_28Outcome(CreateDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateInvalidation2016_01_28Outcome CloudFrontClient::CreateInvalidation2016_01_28(const CreateInvalidation2016_01_28Request& request) const
@@ -178,7 +226,7 @@ CreateInvalidation2016_01_28Outcome CloudFrontClient::CreateInvalidation2016_01_
   ss << m_uri << "/2016-01-28/distribution/";
   ss << request.GetDistributionId();
   ss << "/invalidation";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateInvalidation2016_01_28");
   if(outcome.IsSuccess())
   {
     return CreateInvalidation2016_01_28Outcome(CreateInvalidation2016_01_28Result(outcome.GetResult()));
@@ -191,24 +239,50 @@ CreateInvalidation2016_01_28Outcome CloudFrontClient::CreateInvalidation2016_01_
 
 CreateInvalidation2016_01_28OutcomeCallable CloudFrontClient::CreateInvalidation2016_01_28Callable(const CreateInvalidation2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateInvalidation2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateInvalidation2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateInvalidation2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateInvalidation2016_01_28Outcome > rejected;
+    rejected.set_value(CreateInvalidation2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::CreateInvalidation2016_01_28Async(const CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateInvalidation2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper(const CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateInvalidation2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetDistributionId();
+  ss << "/invalidation";
+  auto sharedRequest = Aws::MakeShared<CreateInvalidation2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateInvalidation2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateInvalidation2016_01_28Outcome(CreateInvalidation2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateInvalidation2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateStreamingDistribution2016_01_28Outcome CloudFrontClient::CreateStreamingDistribution2016_01_28(const CreateStreamingDistribution2016_01_28Request& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/streaming-distribution";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateStreamingDistribution2016_01_28");
   if(outcome.IsSuccess())
   {
     return CreateStreamingDistribution2016_01_28Outcome(CreateStreamingDistribution2016_01_28Result(outcome.GetResult()));
@@ -221,17 +295,41 @@ CreateStreamingDistribution2016_01_28Outcome CloudFrontClient::CreateStreamingDi
 
 CreateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateStreamingDistribution2016_01_28Callable(const CreateStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateStreamingDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateStreamingDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateStreamingDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateStreamingDistribution2016_01_28Outcome > rejected;
+    rejected.set_value(CreateStreamingDistribution2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::CreateStreamingDistribution2016_01_28Async(const CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateStreamingDistribution2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper(const CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateStreamingDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution";
+  auto sharedRequest = Aws::MakeShared<CreateStreamingDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateStreamingDistribution2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateStreamingDistribution2016_01_28Outcome(CreateStreamingDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateStreamingDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request) const
@@ -239,7 +337,7 @@ DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::DeleteCl
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteCloudFrontOriginAccessIdentity2016_01_28");
   if(outcome.IsSuccess())
   {
     return DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome(NoResult());
@@ -252,17 +350,42 @@ DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::DeleteCl
 
 DeleteCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Callable(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome > rejected;
+    rejected.set_value(DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Async(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteCloudFrontOriginAccessIdentity2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<DeleteCloudFrontOriginAccessIdentity2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteCloudFrontOriginAccessIdentity2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteDistribution2016_01_28Outcome CloudFrontClient::DeleteDistribution2016_01_28(const DeleteDistribution2016_01_28Request& request) const
@@ -270,7 +393,7 @@ DeleteDistribution2016_01_28Outcome CloudFrontClient::DeleteDistribution2016_01_
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/distribution/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteDistribution2016_01_28");
   if(outcome.IsSuccess())
   {
     return DeleteDistribution2016_01_28Outcome(NoResult());
@@ -283,17 +406,42 @@ DeleteDistribution2016_01_28Outcome CloudFrontClient::DeleteDistribution2016_01_
 
 DeleteDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteDistribution2016_01_28Callable(const DeleteDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::DeleteDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteDistribution2016_01_28Outcome > rejected;
+    rejected.set_value(DeleteDistribution2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::DeleteDistribution2016_01_28Async(const DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteDistribution2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper(const DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<DeleteDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteDistribution2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDistribution2016_01_28Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteStreamingDistribution2016_01_28Outcome CloudFrontClient::DeleteStreamingDistribution2016_01_28(const DeleteStreamingDistribution2016_01_28Request& request) const
@@ -301,7 +449,7 @@ DeleteStreamingDistribution2016_01_28Outcome CloudFrontClient::DeleteStreamingDi
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/streaming-distribution/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteStreamingDistribution2016_01_28");
   if(outcome.IsSuccess())
   {
     return DeleteStreamingDistribution2016_01_28Outcome(NoResult());
@@ -314,17 +462,42 @@ DeleteStreamingDistribution2016_01_28Outcome CloudFrontClient::DeleteStreamingDi
 
 DeleteStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteStreamingDistribution2016_01_28Callable(const DeleteStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::DeleteStreamingDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteStreamingDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteStreamingDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteStreamingDistribution2016_01_28Outcome > rejected;
+    rejected.set_value(DeleteStreamingDistribution2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::DeleteStreamingDistribution2016_01_28Async(const DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteStreamingDistribution2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper(const DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteStreamingDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<DeleteStreamingDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteStreamingDistribution2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteStreamingDistribution2016_01_28Outcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteStreamingDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request) const
@@ -332,7 +505,7 @@ GetCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::GetCloudFro
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetCloudFrontOriginAccessIdentity2016_01_28");
   if(outcome.IsSuccess())
   {
     return GetCloudFrontOriginAccessIdentity2016_01_28Outcome(GetCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult()));
@@ -345,17 +518,42 @@ GetCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::GetCloudFro
 
 GetCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Callable(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetCloudFrontOriginAccessIdentity2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetCloudFrontOriginAccessIdentity2016_01_28Outcome > rejected;
+    rejected.set_value(GetCloudFrontOriginAccessIdentity2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Async(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetCloudFrontOriginAccessIdentity2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetCloudFrontOriginAccessIdentity2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetCloudFrontOriginAccessIdentity2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetCloudFrontOriginAccessIdentity2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentity2016_01_28Outcome(GetCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentity2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request) const
@@ -364,7 +562,7 @@ GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome CloudFrontClient::GetCl
   ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
   ss << request.GetId();
   ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetCloudFrontOriginAccessIdentityConfig2016_01_28");
   if(outcome.IsSuccess())
   {
     return GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome(GetCloudFrontOriginAccessIdentityConfig2016_01_28Result(outcome.GetResult()));
@@ -377,17 +575,43 @@ GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome CloudFrontClient::GetCl
 
 GetCloudFrontOriginAccessIdentityConfig2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCloudFrontOriginAccessIdentityConfig2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome > rejected;
+    rejected.set_value(GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetCloudFrontOriginAccessIdentityConfig2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<GetCloudFrontOriginAccessIdentityConfig2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetCloudFrontOriginAccessIdentityConfig2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome(GetCloudFrontOriginAccessIdentityConfig2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetDistribution2016_01_28Outcome CloudFrontClient::GetDistribution2016_01_28(const GetDistribution2016_01_28Request& request) const
@@ -395,7 +619,7 @@ GetDistribution2016_01_28Outcome CloudFrontClient::GetDistribution2016_01_28(con
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/distribution/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetDistribution2016_01_28");
   if(outcome.IsSuccess())
   {
     return GetDistribution2016_01_28Outcome(GetDistribution2016_01_28Result(outcome.GetResult()));
@@ -408,17 +632,42 @@ GetDistribution2016_01_28Outcome CloudFrontClient::GetDistribution2016_01_28(con
 
 GetDistribution2016_01_28OutcomeCallable CloudFrontClient::GetDistribution2016_01_28Callable(const GetDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetDistribution2016_01_28Outcome > rejected;
+    rejected.set_value(GetDistribution2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetDistribution2016_01_28Async(const GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::GetDistribution2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetDistribution2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::GetDistribution2016_01_28AsyncHelper(const GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetDistribution2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDistribution2016_01_28Outcome(GetDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetDistributionConfig2016_01_28Outcome CloudFrontClient::GetDistributionConfig2016_01_28(const GetDistributionConfig2016_01_28Request& request) const
@@ -427,7 +676,7 @@ GetDistributionConfig2016_01_28Outcome CloudFrontClient::GetDistributionConfig20
   ss << m_uri << "/2016-01-28/distribution/";
   ss << request.GetId();
   ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetDistributionConfig2016_01_28");
   if(outcome.IsSuccess())
   {
     return GetDistributionConfig2016_01_28Outcome(GetDistributionConfig2016_01_28Result(outcome.GetResult()));
@@ -440,17 +689,43 @@ GetDistributionConfig2016_01_28Outcome CloudFrontClient::GetDistributionConfig20
 
 GetDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetDistributionConfig2016_01_28Callable(const GetDistributionConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetDistributionConfig2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetDistributionConfig2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDistributionConfig2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetDistributionConfig2016_01_28Outcome > rejected;
+    rejected.set_value(GetDistributionConfig2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetDistributionConfig2016_01_28Async(const GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetDistributionConfig2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper(const GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetDistributionConfig2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<GetDistributionConfig2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetDistributionConfig2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetDistributionConfig2016_01_28Outcome(GetDistributionConfig2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetDistributionConfig2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetInvalidation2016_01_28Outcome CloudFrontClient::GetInvalidation2016_01_28(const GetInvalidation2016_01_28Request& request) const
@@ -460,7 +735,7 @@ GetInvalidation2016_01_28Outcome CloudFrontClient::GetInvalidation2016_01_28(con
   ss << request.GetDistributionId();
   ss << "/invalidation/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetInvalidation2016_01_28");
   if(outcome.IsSuccess())
   {
     return GetInvalidation2016_01_28Outcome(GetInvalidation2016_01_28Result(outcome.GetResult()));
@@ -473,17 +748,44 @@ GetInvalidation2016_01_28Outcome CloudFrontClient::GetInvalidation2016_01_28(con
 
 GetInvalidation2016_01_28OutcomeCallable CloudFrontClient::GetInvalidation2016_01_28Callable(const GetInvalidation2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetInvalidation2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetInvalidation2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetInvalidation2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetInvalidation2016_01_28Outcome > rejected;
+    rejected.set_value(GetInvalidation2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetInvalidation2016_01_28Async(const GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetInvalidation2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::GetInvalidation2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetInvalidation2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::GetInvalidation2016_01_28AsyncHelper(const GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetInvalidation2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetDistributionId();
+  ss << "/invalidation/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetInvalidation2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetInvalidation2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetInvalidation2016_01_28Outcome(GetInvalidation2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetInvalidation2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetStreamingDistribution2016_01_28Outcome CloudFrontClient::GetStreamingDistribution2016_01_28(const GetStreamingDistribution2016_01_28Request& request) const
@@ -491,7 +793,7 @@ GetStreamingDistribution2016_01_28Outcome CloudFrontClient::GetStreamingDistribu
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/streaming-distribution/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetStreamingDistribution2016_01_28");
   if(outcome.IsSuccess())
   {
     return GetStreamingDistribution2016_01_28Outcome(GetStreamingDistribution2016_01_28Result(outcome.GetResult()));
@@ -504,17 +806,42 @@ GetStreamingDistribution2016_01_28Outcome CloudFrontClient::GetStreamingDistribu
 
 GetStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistribution2016_01_28Callable(const GetStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetStreamingDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetStreamingDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStreamingDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetStreamingDistribution2016_01_28Outcome > rejected;
+    rejected.set_value(GetStreamingDistribution2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetStreamingDistribution2016_01_28Async(const GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetStreamingDistribution2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper(const GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetStreamingDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetStreamingDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetStreamingDistribution2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStreamingDistribution2016_01_28Outcome(GetStreamingDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStreamingDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetStreamingDistributionConfig2016_01_28Outcome CloudFrontClient::GetStreamingDistributionConfig2016_01_28(const GetStreamingDistributionConfig2016_01_28Request& request) const
@@ -523,7 +850,7 @@ GetStreamingDistributionConfig2016_01_28Outcome CloudFrontClient::GetStreamingDi
   ss << m_uri << "/2016-01-28/streaming-distribution/";
   ss << request.GetId();
   ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetStreamingDistributionConfig2016_01_28");
   if(outcome.IsSuccess())
   {
     return GetStreamingDistributionConfig2016_01_28Outcome(GetStreamingDistributionConfig2016_01_28Result(outcome.GetResult()));
@@ -536,24 +863,50 @@ GetStreamingDistributionConfig2016_01_28Outcome CloudFrontClient::GetStreamingDi
 
 GetStreamingDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistributionConfig2016_01_28Callable(const GetStreamingDistributionConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetStreamingDistributionConfig2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetStreamingDistributionConfig2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStreamingDistributionConfig2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetStreamingDistributionConfig2016_01_28Outcome > rejected;
+    rejected.set_value(GetStreamingDistributionConfig2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::GetStreamingDistributionConfig2016_01_28Async(const GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetStreamingDistributionConfig2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper(const GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetStreamingDistributionConfig2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<GetStreamingDistributionConfig2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetStreamingDistributionConfig2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetStreamingDistributionConfig2016_01_28Outcome(GetStreamingDistributionConfig2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetStreamingDistributionConfig2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListCloudFrontOriginAccessIdentities2016_01_28Outcome CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListCloudFrontOriginAccessIdentities2016_01_28");
   if(outcome.IsSuccess())
   {
     return ListCloudFrontOriginAccessIdentities2016_01_28Outcome(ListCloudFrontOriginAccessIdentities2016_01_28Result(outcome.GetResult()));
@@ -566,24 +919,48 @@ ListCloudFrontOriginAccessIdentities2016_01_28Outcome CloudFrontClient::ListClou
 
 ListCloudFrontOriginAccessIdentities2016_01_28OutcomeCallable CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Callable(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListCloudFrontOriginAccessIdentities2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCloudFrontOriginAccessIdentities2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListCloudFrontOriginAccessIdentities2016_01_28Outcome > rejected;
+    rejected.set_value(ListCloudFrontOriginAccessIdentities2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Async(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListCloudFrontOriginAccessIdentities2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListCloudFrontOriginAccessIdentities2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront";
+  auto sharedRequest = Aws::MakeShared<ListCloudFrontOriginAccessIdentities2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListCloudFrontOriginAccessIdentities2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListCloudFrontOriginAccessIdentities2016_01_28Outcome(ListCloudFrontOriginAccessIdentities2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListCloudFrontOriginAccessIdentities2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListDistributions2016_01_28Outcome CloudFrontClient::ListDistributions2016_01_28(const ListDistributions2016_01_28Request& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/distribution";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListDistributions2016_01_28");
   if(outcome.IsSuccess())
   {
     return ListDistributions2016_01_28Outcome(ListDistributions2016_01_28Result(outcome.GetResult()));
@@ -596,17 +973,41 @@ ListDistributions2016_01_28Outcome CloudFrontClient::ListDistributions2016_01_28
 
 ListDistributions2016_01_28OutcomeCallable CloudFrontClient::ListDistributions2016_01_28Callable(const ListDistributions2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListDistributions2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListDistributions2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDistributions2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListDistributions2016_01_28Outcome > rejected;
+    rejected.set_value(ListDistributions2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::ListDistributions2016_01_28Async(const ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListDistributions2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::ListDistributions2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListDistributions2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::ListDistributions2016_01_28AsyncHelper(const ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListDistributions2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution";
+  auto sharedRequest = Aws::MakeShared<ListDistributions2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListDistributions2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDistributions2016_01_28Outcome(ListDistributions2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDistributions2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListDistributionsByWebACLId2016_01_28Outcome CloudFrontClient::ListDistributionsByWebACLId2016_01_28(const ListDistributionsByWebACLId2016_01_28Request& request) const
@@ -614,7 +1015,7 @@ ListDistributionsByWebACLId2016_01_28Outcome CloudFrontClient::ListDistributions
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/distributionsByWebACLId/";
   ss << request.GetWebACLId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListDistributionsByWebACLId2016_01_28");
   if(outcome.IsSuccess())
   {
     return ListDistributionsByWebACLId2016_01_28Outcome(ListDistributionsByWebACLId2016_01_28Result(outcome.GetResult()));
@@ -627,17 +1028,42 @@ ListDistributionsByWebACLId2016_01_28Outcome CloudFrontClient::ListDistributions
 
 ListDistributionsByWebACLId2016_01_28OutcomeCallable CloudFrontClient::ListDistributionsByWebACLId2016_01_28Callable(const ListDistributionsByWebACLId2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListDistributionsByWebACLId2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListDistributionsByWebACLId2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDistributionsByWebACLId2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListDistributionsByWebACLId2016_01_28Outcome > rejected;
+    rejected.set_value(ListDistributionsByWebACLId2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::ListDistributionsByWebACLId2016_01_28Async(const ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListDistributionsByWebACLId2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper(const ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListDistributionsByWebACLId2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distributionsByWebACLId/";
+  ss << request.GetWebACLId();
+  auto sharedRequest = Aws::MakeShared<ListDistributionsByWebACLId2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListDistributionsByWebACLId2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDistributionsByWebACLId2016_01_28Outcome(ListDistributionsByWebACLId2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDistributionsByWebACLId2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListInvalidations2016_01_28Outcome CloudFrontClient::ListInvalidations2016_01_28(const ListInvalidations2016_01_28Request& request) const
@@ -646,7 +1072,7 @@ ListInvalidations2016_01_28Outcome CloudFrontClient::ListInvalidations2016_01_28
   ss << m_uri << "/2016-01-28/distribution/";
   ss << request.GetDistributionId();
   ss << "/invalidation";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListInvalidations2016_01_28");
   if(outcome.IsSuccess())
   {
     return ListInvalidations2016_01_28Outcome(ListInvalidations2016_01_28Result(outcome.GetResult()));
@@ -659,24 +1085,50 @@ ListInvalidations2016_01_28Outcome CloudFrontClient::ListInvalidations2016_01_28
 
 ListInvalidations2016_01_28OutcomeCallable CloudFrontClient::ListInvalidations2016_01_28Callable(const ListInvalidations2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListInvalidations2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListInvalidations2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListInvalidations2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListInvalidations2016_01_28Outcome > rejected;
+    rejected.set_value(ListInvalidations2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::ListInvalidations2016_01_28Async(const ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListInvalidations2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::ListInvalidations2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListInvalidations2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::ListInvalidations2016_01_28AsyncHelper(const ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListInvalidations2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetDistributionId();
+  ss << "/invalidation";
+  auto sharedRequest = Aws::MakeShared<ListInvalidations2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListInvalidations2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListInvalidations2016_01_28Outcome(ListInvalidations2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListInvalidations2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListStreamingDistributions2016_01_28Outcome CloudFrontClient::ListStreamingDistributions2016_01_28(const ListStreamingDistributions2016_01_28Request& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2016-01-28/streaming-distribution";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListStreamingDistributions2016_01_28");
   if(outcome.IsSuccess())
   {
     return ListStreamingDistributions2016_01_28Outcome(ListStreamingDistributions2016_01_28Result(outcome.GetResult()));
@@ -689,17 +1141,41 @@ ListStreamingDistributions2016_01_28Outcome CloudFrontClient::ListStreamingDistr
 
 ListStreamingDistributions2016_01_28OutcomeCallable CloudFrontClient::ListStreamingDistributions2016_01_28Callable(const ListStreamingDistributions2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListStreamingDistributions2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListStreamingDistributions2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListStreamingDistributions2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListStreamingDistributions2016_01_28Outcome > rejected;
+    rejected.set_value(ListStreamingDistributions2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::ListStreamingDistributions2016_01_28Async(const ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListStreamingDistributions2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper(const ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListStreamingDistributions2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution";
+  auto sharedRequest = Aws::MakeShared<ListStreamingDistributions2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListStreamingDistributions2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListStreamingDistributions2016_01_28Outcome(ListStreamingDistributions2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListStreamingDistributions2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
@@ -708,7 +1184,7 @@ UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::UpdateCl
   ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
   ss << request.GetId();
   ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "UpdateCloudFrontOriginAccessIdentity2016_01_28");
   if(outcome.IsSuccess())
   {
     return UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome(UpdateCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult()));
@@ -721,17 +1197,43 @@ UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::UpdateCl
 
 UpdateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Callable(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome > rejected;
+    rejected.set_value(UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Async(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateCloudFrontOriginAccessIdentity2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<UpdateCloudFrontOriginAccessIdentity2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "UpdateCloudFrontOriginAccessIdentity2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome(UpdateCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateDistribution2016_01_28Outcome CloudFrontClient::UpdateDistribution2016_01_28(const UpdateDistribution2016_01_28Request& request) const
@@ -740,7 +1242,7 @@ UpdateDistribution2016_01_28Outcome CloudFrontClient::UpdateDistribution2016_01_
   ss << m_uri << "/2016-01-28/distribution/";
   ss << request.GetId();
   ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "UpdateDistribution2016_01_28");
   if(outcome.IsSuccess())
   {
     return UpdateDistribution2016_01_28Outcome(UpdateDistribution2016_01_28Result(outcome.GetResult()));
@@ -753,17 +1255,43 @@ UpdateDistribution2016_01_28Outcome CloudFrontClient::UpdateDistribution2016_01_
 
 UpdateDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateDistribution2016_01_28Callable(const UpdateDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::UpdateDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateDistribution2016_01_28Outcome > rejected;
+    rejected.set_value(UpdateDistribution2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::UpdateDistribution2016_01_28Async(const UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateDistribution2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper(const UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<UpdateDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "UpdateDistribution2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateDistribution2016_01_28Outcome(UpdateDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateStreamingDistribution2016_01_28Outcome CloudFrontClient::UpdateStreamingDistribution2016_01_28(const UpdateStreamingDistribution2016_01_28Request& request) const
@@ -772,7 +1300,7 @@ UpdateStreamingDistribution2016_01_28Outcome CloudFrontClient::UpdateStreamingDi
   ss << m_uri << "/2016-01-28/streaming-distribution/";
   ss << request.GetId();
   ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "UpdateStreamingDistribution2016_01_28");
   if(outcome.IsSuccess())
   {
     return UpdateStreamingDistribution2016_01_28Outcome(UpdateStreamingDistribution2016_01_28Result(outcome.GetResult()));
@@ -785,16 +1313,42 @@ UpdateStreamingDistribution2016_01_28Outcome CloudFrontClient::UpdateStreamingDi
 
 UpdateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateStreamingDistribution2016_01_28Callable(const UpdateStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::UpdateStreamingDistribution2016_01_28, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateStreamingDistribution2016_01_28Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateStreamingDistribution2016_01_28( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateStreamingDistribution2016_01_28Outcome > rejected;
+    rejected.set_value(UpdateStreamingDistribution2016_01_28Outcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudFrontClient::UpdateStreamingDistribution2016_01_28Async(const UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateStreamingDistribution2016_01_28Outcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper(const UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateStreamingDistribution2016_01_28(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2016-01-28/streaming-distribution/";
+  ss << request.GetId();
+  ss << "/config";
+  auto sharedRequest = Aws::MakeShared<UpdateStreamingDistribution2016_01_28Request>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "UpdateStreamingDistribution2016_01_28", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateStreamingDistribution2016_01_28Outcome(UpdateStreamingDistribution2016_01_28Result(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateStreamingDistribution2016_01_28Outcome(outcome.GetError()), context);
+    }
+  });
 }
 
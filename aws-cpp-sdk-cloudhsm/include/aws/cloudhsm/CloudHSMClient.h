@@ -41,6 +41,7 @@
 #include <aws/cloudhsm/model/ModifyLunaClientResult.h>
 #include <aws/cloudhsm/model/RemoveTagsFromResourceResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -224,6 +225,28 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds or overwrites one or more tags for the specified resource.</p> <p>Each
+         * tag consists of a key and a value. Tag keys must be unique per resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsToResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsToResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsToResourceOutcome>([this, request](const std::function<void(Model::AddTagsToResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsToResourceAsync(request, [complete](const CloudHSMClient*, const Model::AddTagsToResourceRequest&, const Model::AddTagsToResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsToResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a high-availability partition group. A high-availability partition
          * group is a group of partitions that spans multiple physical HSMs.</p>
@@ -246,6 +269,28 @@ namespace Model
          */
         virtual void CreateHapgAsync(const Model::CreateHapgRequest& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a high-availability partition group. A high-availability partition
+         * group is a group of partitions that spans multiple physical HSMs.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateHapgAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateHapgRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateHapgOutcome> CreateHapgAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateHapgOutcome>([this, request](const std::function<void(Model::CreateHapgOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateHapgAsync(request, [complete](const CloudHSMClient*, const Model::CreateHapgRequest&, const Model::CreateHapgOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateHapgOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an uninitialized HSM instance.</p> <p>There is an upfront fee charged
          * for each HSM instance that you create with the <a>CreateHsm</a> operation. If
@@ -292,6 +337,36 @@ namespace Model
          */
         virtual void CreateHsmAsync(const Model::CreateHsmRequest& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an uninitialized HSM instance.</p> <p>There is an upfront fee charged
+         * for each HSM instance that you create with the <a>CreateHsm</a> operation. If
+         * you accidentally provision an HSM and want to request a refund, delete the
+         * instance using the <a>DeleteHsm</a> operation, go to the <a
+         * href="https://console.aws.amazon.com/support/home#/">AWS Support Center</a>,
+         * create a new case, and select <b>Account and Billing Support</b>.</p>
+         * <important> <p>It can take up to 20 minutes to create and provision an HSM. You
+         * can monitor the status of the HSM with the <a>DescribeHsm</a> operation. The HSM
+         * is ready to be initialized when the status changes to <code>RUNNING</code>.</p>
+         * </important>
+         *
+         * Returns an awaitable that starts the operation the way CreateHsmAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateHsmRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateHsmOutcome> CreateHsmAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateHsmOutcome>([this, request](const std::function<void(Model::CreateHsmOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateHsmAsync(request, [complete](const CloudHSMClient*, const Model::CreateHsmRequest&, const Model::CreateHsmOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateHsmOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an HSM client.</p>
          */
@@ -311,6 +386,27 @@ namespace Model
          */
         virtual void CreateLunaClientAsync(const Model::CreateLunaClientRequest& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an HSM client.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateLunaClientAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateLunaClientRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateLunaClientOutcome> CreateLunaClientAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateLunaClientOutcome>([this, request](const std::function<void(Model::CreateLunaClientOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateLunaClientAsync(request, [complete](const CloudHSMClient*, const Model::CreateLunaClientRequest&, const Model::CreateLunaClientOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateLunaClientOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a high-availability partition group.</p>
          */
@@ -330,6 +426,27 @@ namespace Model
          */
         virtual void DeleteHapgAsync(const Model::DeleteHapgRequest& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a high-availability partition group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteHapgAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteHapgRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteHapgOutcome> DeleteHapgAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteHapgOutcome>([this, request](const std::function<void(Model::DeleteHapgOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteHapgAsync(request, [complete](const CloudHSMClient*, const Model::DeleteHapgRequest&, const Model::DeleteHapgOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteHapgOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an HSM. After completion, this operation cannot be undone and your
          * key material cannot be recovered.</p>
@@ -352,6 +469,28 @@ namespace Model
          */
         virtual void DeleteHsmAsync(const Model::DeleteHsmRequest& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an HSM. After completion, this operation cannot be undone and your
+         * key material cannot be recovered.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteHsmAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteHsmRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteHsmOutcome> DeleteHsmAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteHsmOutcome>([this, request](const std::function<void(Model::DeleteHsmOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteHsmAsync(request, [complete](const CloudHSMClient*, const Model::DeleteHsmRequest&, const Model::DeleteHsmOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteHsmOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a client.</p>
          */
@@ -371,6 +510,27 @@ namespace Model
          */
         virtual void DeleteLunaClientAsync(const Model::DeleteLunaClientRequest& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a client.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteLunaClientAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteLunaClientRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteLunaClientOutcome> DeleteLunaClientAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteLunaClientOutcome>([this, request](const std::function<void(Model::DeleteLunaClientOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteLunaClientAsync(request, [complete](const CloudHSMClient*, const Model::DeleteLunaClientRequest&, const Model::DeleteLunaClientOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteLunaClientOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about a high-availability partition group.</p>
          */
@@ -390,6 +550,27 @@ namespace Model
          */
         virtual void DescribeHapgAsync(const Model::DescribeHapgRequest& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about a high-availability partition group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeHapgAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeHapgRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeHapgOutcome> DescribeHapgAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeHapgOutcome>([this, request](const std::function<void(Model::DescribeHapgOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeHapgAsync(request, [complete](const CloudHSMClient*, const Model::DescribeHapgRequest&, const Model::DescribeHapgOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeHapgOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about an HSM. You can identify the HSM by its ARN or
          * its serial number.</p>
@@ -412,6 +593,28 @@ namespace Model
          */
         virtual void DescribeHsmAsync(const Model::DescribeHsmRequest& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about an HSM. You can identify the HSM by its ARN or
+         * its serial number.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeHsmAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeHsmRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeHsmOutcome> DescribeHsmAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeHsmOutcome>([this, request](const std::function<void(Model::DescribeHsmOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeHsmAsync(request, [complete](const CloudHSMClient*, const Model::DescribeHsmRequest&, const Model::DescribeHsmOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeHsmOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about an HSM client.</p>
          */
@@ -431,6 +634,27 @@ namespace Model
          */
         virtual void DescribeLunaClientAsync(const Model::DescribeLunaClientRequest& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about an HSM client.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLunaClientAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLunaClientRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLunaClientOutcome> DescribeLunaClientAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLunaClientOutcome>([this, request](const std::function<void(Model::DescribeLunaClientOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLunaClientAsync(request, [complete](const CloudHSMClient*, const Model::DescribeLunaClientRequest&, const Model::DescribeLunaClientOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLunaClientOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the configuration files necessary to connect to all high availability
          * partition groups the client is associated with.</p>
@@ -453,6 +677,28 @@ namespace Model
          */
         virtual void GetConfigAsync(const Model::GetConfigRequest& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the configuration files necessary to connect to all high availability
+         * partition groups the client is associated with.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetConfigAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetConfigRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetConfigOutcome> GetConfigAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetConfigOutcome>([this, request](const std::function<void(Model::GetConfigOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetConfigAsync(request, [complete](const CloudHSMClient*, const Model::GetConfigRequest&, const Model::GetConfigOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetConfigOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the Availability Zones that have available AWS CloudHSM capacity.</p>
          */
@@ -472,6 +718,27 @@ namespace Model
          */
         virtual void ListAvailableZonesAsync(const Model::ListAvailableZonesRequest& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the Availability Zones that have available AWS CloudHSM capacity.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListAvailableZonesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAvailableZonesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAvailableZonesOutcome> ListAvailableZonesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAvailableZonesOutcome>([this, request](const std::function<void(Model::ListAvailableZonesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAvailableZonesAsync(request, [complete](const CloudHSMClient*, const Model::ListAvailableZonesRequest&, const Model::ListAvailableZonesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAvailableZonesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the high-availability partition groups for the account.</p> <p>This
          * operation supports pagination with the use of the <i>NextToken</i> member. If
@@ -503,6 +770,31 @@ namespace Model
          */
         virtual void ListHapgsAsync(const Model::ListHapgsRequest& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the high-availability partition groups for the account.</p> <p>This
+         * operation supports pagination with the use of the <i>NextToken</i> member. If
+         * more results are available, the <i>NextToken</i> member of the response contains
+         * a token that you pass in the next call to <a>ListHapgs</a> to retrieve the next
+         * set of items.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListHapgsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListHapgsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListHapgsOutcome> ListHapgsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListHapgsOutcome>([this, request](const std::function<void(Model::ListHapgsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListHapgsAsync(request, [complete](const CloudHSMClient*, const Model::ListHapgsRequest&, const Model::ListHapgsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListHapgsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the identifiers of all of the HSMs provisioned for the current
          * customer.</p> <p>This operation supports pagination with the use of the
@@ -534,6 +826,31 @@ namespace Model
          */
         virtual void ListHsmsAsync(const Model::ListHsmsRequest& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the identifiers of all of the HSMs provisioned for the current
+         * customer.</p> <p>This operation supports pagination with the use of the
+         * <i>NextToken</i> member. If more results are available, the <i>NextToken</i>
+         * member of the response contains a token that you pass in the next call to
+         * <a>ListHsms</a> to retrieve the next set of items.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListHsmsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListHsmsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListHsmsOutcome> ListHsmsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListHsmsOutcome>([this, request](const std::function<void(Model::ListHsmsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListHsmsAsync(request, [complete](const CloudHSMClient*, const Model::ListHsmsRequest&, const Model::ListHsmsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListHsmsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all of the clients.</p> <p>This operation supports pagination with the
          * use of the <i>NextToken</i> member. If more results are available, the
@@ -562,6 +879,30 @@ namespace Model
          */
         virtual void ListLunaClientsAsync(const Model::ListLunaClientsRequest& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all of the clients.</p> <p>This operation supports pagination with the
+         * use of the <i>NextToken</i> member. If more results are available, the
+         * <i>NextToken</i> member of the response contains a token that you pass in the
+         * next call to <a>ListLunaClients</a> to retrieve the next set of items.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListLunaClientsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListLunaClientsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListLunaClientsOutcome> ListLunaClientsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListLunaClientsOutcome>([this, request](const std::function<void(Model::ListLunaClientsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListLunaClientsAsync(request, [complete](const CloudHSMClient*, const Model::ListLunaClientsRequest&, const Model::ListLunaClientsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListLunaClientsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of all tags for the specified resource.</p>
          */
@@ -581,6 +922,27 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of all tags for the specified resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTagsForResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsForResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome>([this, request](const std::function<void(Model::ListTagsForResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsForResourceAsync(request, [complete](const CloudHSMClient*, const Model::ListTagsForResourceRequest&, const Model::ListTagsForResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsForResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies an existing high-availability partition group.</p>
          */
@@ -600,6 +962,27 @@ namespace Model
          */
         virtual void ModifyHapgAsync(const Model::ModifyHapgRequest& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies an existing high-availability partition group.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyHapgAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyHapgRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyHapgOutcome> ModifyHapgAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyHapgOutcome>([this, request](const std::function<void(Model::ModifyHapgOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyHapgAsync(request, [complete](const CloudHSMClient*, const Model::ModifyHapgRequest&, const Model::ModifyHapgOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyHapgOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies an HSM.</p> <important> <p>This operation can result in the HSM
          * being offline for up to 15 minutes while the AWS CloudHSM service is
@@ -631,6 +1014,31 @@ namespace Model
          */
         virtual void ModifyHsmAsync(const Model::ModifyHsmRequest& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies an HSM.</p> <important> <p>This operation can result in the HSM
+         * being offline for up to 15 minutes while the AWS CloudHSM service is
+         * reconfigured. If you are modifying a production HSM, you should ensure that your
+         * AWS CloudHSM service is configured for high availability, and consider executing
+         * this operation during a maintenance window.</p> </important>
+         *
+         * Returns an awaitable that starts the operation the way ModifyHsmAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyHsmRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyHsmOutcome> ModifyHsmAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyHsmOutcome>([this, request](const std::function<void(Model::ModifyHsmOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyHsmAsync(request, [complete](const CloudHSMClient*, const Model::ModifyHsmRequest&, const Model::ModifyHsmOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyHsmOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the certificate used by the client.</p> <p>This action can
          * potentially start a workflow to install the new certificate on the client's
@@ -656,6 +1064,29 @@ namespace Model
          */
         virtual void ModifyLunaClientAsync(const Model::ModifyLunaClientRequest& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the certificate used by the client.</p> <p>This action can
+         * potentially start a workflow to install the new certificate on the client's
+         * HSMs.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyLunaClientAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyLunaClientRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyLunaClientOutcome> ModifyLunaClientAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyLunaClientOutcome>([this, request](const std::function<void(Model::ModifyLunaClientOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyLunaClientAsync(request, [complete](const CloudHSMClient*, const Model::ModifyLunaClientRequest&, const Model::ModifyLunaClientOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyLunaClientOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes one or more tags from the specified resource.</p> <p>To remove a tag,
          * specify only the tag key to remove (not the value). To overwrite the value for
@@ -681,6 +1112,29 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes one or more tags from the specified resource.</p> <p>To remove a tag,
+         * specify only the tag key to remove (not the value). To overwrite the value for
+         * an existing tag, use <a>AddTagsToResource</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsFromResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsFromResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromResourceOutcome>([this, request](const std::function<void(Model::RemoveTagsFromResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsFromResourceAsync(request, [complete](const CloudHSMClient*, const Model::RemoveTagsFromResourceRequest&, const Model::RemoveTagsFromResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsFromResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -45,6 +45,7 @@
 #include <aws/cloudsearch/model/UpdateScalingParametersResult.h>
 #include <aws/cloudsearch/model/UpdateServiceAccessPoliciesResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -257,6 +258,29 @@ namespace Model
          */
         virtual void BuildSuggestersAsync(const Model::BuildSuggestersRequest& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Indexes the search suggestions. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-suggestions.html#configuring-suggesters">Configuring
+         * Suggesters</a> in the <i>Amazon CloudSearch Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way BuildSuggestersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BuildSuggestersRequest>
+        Aws::Utils::Threading::Awaitable<Model::BuildSuggestersOutcome> BuildSuggestersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BuildSuggestersOutcome>([this, request](const std::function<void(Model::BuildSuggestersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BuildSuggestersAsync(request, [complete](const CloudSearchClient*, const Model::BuildSuggestersRequest&, const Model::BuildSuggestersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BuildSuggestersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new search domain. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/creating-domains.html"
@@ -285,6 +309,30 @@ namespace Model
          */
         virtual void CreateDomainAsync(const Model::CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new search domain. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/creating-domains.html"
+         * target="_blank">Creating a Search Domain</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDomainOutcome> CreateDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDomainOutcome>([this, request](const std::function<void(Model::CreateDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDomainAsync(request, [complete](const CloudSearchClient*, const Model::CreateDomainRequest&, const Model::CreateDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Configures an analysis scheme that can be applied to a <code>text</code> or
          * <code>text-array</code> field to define language-specific text processing
@@ -319,6 +367,32 @@ namespace Model
          */
         virtual void DefineAnalysisSchemeAsync(const Model::DefineAnalysisSchemeRequest& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Configures an analysis scheme that can be applied to a <code>text</code> or
+         * <code>text-array</code> field to define language-specific text processing
+         * options. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-analysis-schemes.html"
+         * target="_blank">Configuring Analysis Schemes</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DefineAnalysisSchemeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DefineAnalysisSchemeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DefineAnalysisSchemeOutcome> DefineAnalysisSchemeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DefineAnalysisSchemeOutcome>([this, request](const std::function<void(Model::DefineAnalysisSchemeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DefineAnalysisSchemeAsync(request, [complete](const CloudSearchClient*, const Model::DefineAnalysisSchemeRequest&, const Model::DefineAnalysisSchemeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DefineAnalysisSchemeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Configures an <code><a>Expression</a></code> for the search domain. Used to
          * create new expressions and modify existing ones. If the expression exists, the
@@ -353,6 +427,32 @@ namespace Model
          */
         virtual void DefineExpressionAsync(const Model::DefineExpressionRequest& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Configures an <code><a>Expression</a></code> for the search domain. Used to
+         * create new expressions and modify existing ones. If the expression exists, the
+         * new configuration replaces the old one. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-expressions.html"
+         * target="_blank">Configuring Expressions</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DefineExpressionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DefineExpressionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DefineExpressionOutcome> DefineExpressionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DefineExpressionOutcome>([this, request](const std::function<void(Model::DefineExpressionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DefineExpressionAsync(request, [complete](const CloudSearchClient*, const Model::DefineExpressionRequest&, const Model::DefineExpressionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DefineExpressionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Configures an <code><a>IndexField</a></code> for the search domain. Used to
          * create new fields and modify existing ones. You must specify the name of the
@@ -399,6 +499,36 @@ namespace Model
          */
         virtual void DefineIndexFieldAsync(const Model::DefineIndexFieldRequest& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Configures an <code><a>IndexField</a></code> for the search domain. Used to
+         * create new fields and modify existing ones. You must specify the name of the
+         * domain you are configuring and an index field configuration. The index field
+         * configuration specifies a unique name, the index field type, and the options you
+         * want to configure for the field. The options you can specify depend on the
+         * <code><a>IndexFieldType</a></code>. If the field exists, the new configuration
+         * replaces the old one. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-index-fields.html"
+         * target="_blank">Configuring Index Fields</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DefineIndexFieldAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DefineIndexFieldRequest>
+        Aws::Utils::Threading::Awaitable<Model::DefineIndexFieldOutcome> DefineIndexFieldAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DefineIndexFieldOutcome>([this, request](const std::function<void(Model::DefineIndexFieldOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DefineIndexFieldAsync(request, [complete](const CloudSearchClient*, const Model::DefineIndexFieldRequest&, const Model::DefineIndexFieldOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DefineIndexFieldOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Configures a suggester for a domain. A suggester enables you to display
          * possible matches before users finish typing their queries. When you configure a
@@ -439,6 +569,34 @@ namespace Model
          */
         virtual void DefineSuggesterAsync(const Model::DefineSuggesterRequest& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Configures a suggester for a domain. A suggester enables you to display
+         * possible matches before users finish typing their queries. When you configure a
+         * suggester, you must specify the name of the text field you want to search for
+         * possible matches and a unique name for the suggester. For more information, see
+         * <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-suggestions.html"
+         * target="_blank">Getting Search Suggestions</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DefineSuggesterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DefineSuggesterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DefineSuggesterOutcome> DefineSuggesterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DefineSuggesterOutcome>([this, request](const std::function<void(Model::DefineSuggesterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DefineSuggesterAsync(request, [complete](const CloudSearchClient*, const Model::DefineSuggesterRequest&, const Model::DefineSuggesterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DefineSuggesterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an analysis scheme. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-analysis-schemes.html"
@@ -467,6 +625,30 @@ namespace Model
          */
         virtual void DeleteAnalysisSchemeAsync(const Model::DeleteAnalysisSchemeRequest& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an analysis scheme. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-analysis-schemes.html"
+         * target="_blank">Configuring Analysis Schemes</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAnalysisSchemeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAnalysisSchemeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAnalysisSchemeOutcome> DeleteAnalysisSchemeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAnalysisSchemeOutcome>([this, request](const std::function<void(Model::DeleteAnalysisSchemeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAnalysisSchemeAsync(request, [complete](const CloudSearchClient*, const Model::DeleteAnalysisSchemeRequest&, const Model::DeleteAnalysisSchemeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAnalysisSchemeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Permanently deletes a search domain and all of its data. Once a domain has
          * been deleted, it cannot be recovered. For more information, see <a
@@ -498,6 +680,31 @@ namespace Model
          */
         virtual void DeleteDomainAsync(const Model::DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Permanently deletes a search domain and all of its data. Once a domain has
+         * been deleted, it cannot be recovered. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/deleting-domains.html"
+         * target="_blank">Deleting a Search Domain</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDomainOutcome> DeleteDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDomainOutcome>([this, request](const std::function<void(Model::DeleteDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDomainAsync(request, [complete](const CloudSearchClient*, const Model::DeleteDomainRequest&, const Model::DeleteDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes an <code><a>Expression</a></code> from the search domain. For more
          * information, see <a
@@ -529,6 +736,31 @@ namespace Model
          */
         virtual void DeleteExpressionAsync(const Model::DeleteExpressionRequest& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes an <code><a>Expression</a></code> from the search domain. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-expressions.html"
+         * target="_blank">Configuring Expressions</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteExpressionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteExpressionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteExpressionOutcome> DeleteExpressionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteExpressionOutcome>([this, request](const std::function<void(Model::DeleteExpressionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteExpressionAsync(request, [complete](const CloudSearchClient*, const Model::DeleteExpressionRequest&, const Model::DeleteExpressionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteExpressionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes an <code><a>IndexField</a></code> from the search domain. For more
          * information, see <a
@@ -560,6 +792,31 @@ namespace Model
          */
         virtual void DeleteIndexFieldAsync(const Model::DeleteIndexFieldRequest& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes an <code><a>IndexField</a></code> from the search domain. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-index-fields.html"
+         * target="_blank">Configuring Index Fields</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteIndexFieldAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteIndexFieldRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteIndexFieldOutcome> DeleteIndexFieldAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteIndexFieldOutcome>([this, request](const std::function<void(Model::DeleteIndexFieldOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteIndexFieldAsync(request, [complete](const CloudSearchClient*, const Model::DeleteIndexFieldRequest&, const Model::DeleteIndexFieldOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteIndexFieldOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a suggester. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-suggestions.html"
@@ -588,6 +845,30 @@ namespace Model
          */
         virtual void DeleteSuggesterAsync(const Model::DeleteSuggesterRequest& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a suggester. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-suggestions.html"
+         * target="_blank">Getting Search Suggestions</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSuggesterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSuggesterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSuggesterOutcome> DeleteSuggesterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSuggesterOutcome>([this, request](const std::function<void(Model::DeleteSuggesterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSuggesterAsync(request, [complete](const CloudSearchClient*, const Model::DeleteSuggesterRequest&, const Model::DeleteSuggesterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSuggesterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the analysis schemes configured for a domain. An analysis scheme defines
          * language-specific text processing options for a <code>text</code> field. Can be
@@ -631,6 +912,35 @@ namespace Model
          */
         virtual void DescribeAnalysisSchemesAsync(const Model::DescribeAnalysisSchemesRequest& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the analysis schemes configured for a domain. An analysis scheme defines
+         * language-specific text processing options for a <code>text</code> field. Can be
+         * limited to specific analysis schemes by name. By default, shows all analysis
+         * schemes and includes any pending changes to the configuration. Set the
+         * <code>Deployed</code> option to <code>true</code> to show the active
+         * configuration and exclude pending changes. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-analysis-schemes.html"
+         * target="_blank">Configuring Analysis Schemes</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAnalysisSchemesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAnalysisSchemesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAnalysisSchemesOutcome> DescribeAnalysisSchemesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAnalysisSchemesOutcome>([this, request](const std::function<void(Model::DescribeAnalysisSchemesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAnalysisSchemesAsync(request, [complete](const CloudSearchClient*, const Model::DescribeAnalysisSchemesRequest&, const Model::DescribeAnalysisSchemesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAnalysisSchemesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the availability options configured for a domain. By default, shows the
          * configuration with any pending changes. Set the <code>Deployed</code> option to
@@ -668,6 +978,33 @@ namespace Model
          */
         virtual void DescribeAvailabilityOptionsAsync(const Model::DescribeAvailabilityOptionsRequest& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the availability options configured for a domain. By default, shows the
+         * configuration with any pending changes. Set the <code>Deployed</code> option to
+         * <code>true</code> to show the active configuration and exclude pending changes.
+         * For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-availability-options.html"
+         * target="_blank">Configuring Availability Options</a> in the <i>Amazon
+         * CloudSearch Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAvailabilityOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAvailabilityOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAvailabilityOptionsOutcome> DescribeAvailabilityOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAvailabilityOptionsOutcome>([this, request](const std::function<void(Model::DescribeAvailabilityOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAvailabilityOptionsAsync(request, [complete](const CloudSearchClient*, const Model::DescribeAvailabilityOptionsRequest&, const Model::DescribeAvailabilityOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAvailabilityOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the search domains owned by this account. Can be
          * limited to specific domains. Shows all domains by default. To get the number of
@@ -711,6 +1048,35 @@ namespace Model
          */
         virtual void DescribeDomainsAsync(const Model::DescribeDomainsRequest& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the search domains owned by this account. Can be
+         * limited to specific domains. Shows all domains by default. To get the number of
+         * searchable documents in a domain, use the console or submit a
+         * <code>matchall</code> request to your domain's search endpoint:
+         * <code>q=matchall&amp;amp;q.parser=structured&amp;amp;size=0</code>. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-domain-info.html"
+         * target="_blank">Getting Information about a Search Domain</a> in the <i>Amazon
+         * CloudSearch Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDomainsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDomainsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDomainsOutcome> DescribeDomainsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDomainsOutcome>([this, request](const std::function<void(Model::DescribeDomainsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDomainsAsync(request, [complete](const CloudSearchClient*, const Model::DescribeDomainsRequest&, const Model::DescribeDomainsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDomainsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the expressions configured for the search domain. Can be limited to
          * specific expressions by name. By default, shows all expressions and includes any
@@ -751,6 +1117,34 @@ namespace Model
          */
         virtual void DescribeExpressionsAsync(const Model::DescribeExpressionsRequest& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the expressions configured for the search domain. Can be limited to
+         * specific expressions by name. By default, shows all expressions and includes any
+         * pending changes to the configuration. Set the <code>Deployed</code> option to
+         * <code>true</code> to show the active configuration and exclude pending changes.
+         * For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-expressions.html"
+         * target="_blank">Configuring Expressions</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeExpressionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeExpressionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeExpressionsOutcome> DescribeExpressionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeExpressionsOutcome>([this, request](const std::function<void(Model::DescribeExpressionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeExpressionsAsync(request, [complete](const CloudSearchClient*, const Model::DescribeExpressionsRequest&, const Model::DescribeExpressionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeExpressionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the index fields configured for the search domain. Can
          * be limited to specific fields by name. By default, shows all fields and includes
@@ -791,6 +1185,34 @@ namespace Model
          */
         virtual void DescribeIndexFieldsAsync(const Model::DescribeIndexFieldsRequest& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the index fields configured for the search domain. Can
+         * be limited to specific fields by name. By default, shows all fields and includes
+         * any pending changes to the configuration. Set the <code>Deployed</code> option
+         * to <code>true</code> to show the active configuration and exclude pending
+         * changes. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-domain-info.html"
+         * target="_blank">Getting Domain Information</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeIndexFieldsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeIndexFieldsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeIndexFieldsOutcome> DescribeIndexFieldsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeIndexFieldsOutcome>([this, request](const std::function<void(Model::DescribeIndexFieldsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeIndexFieldsAsync(request, [complete](const CloudSearchClient*, const Model::DescribeIndexFieldsRequest&, const Model::DescribeIndexFieldsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeIndexFieldsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the scaling parameters configured for a domain. A domain's scaling
          * parameters specify the desired search instance type and replication count. For
@@ -825,6 +1247,32 @@ namespace Model
          */
         virtual void DescribeScalingParametersAsync(const Model::DescribeScalingParametersRequest& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the scaling parameters configured for a domain. A domain's scaling
+         * parameters specify the desired search instance type and replication count. For
+         * more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-scaling-options.html"
+         * target="_blank">Configuring Scaling Options</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeScalingParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeScalingParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeScalingParametersOutcome> DescribeScalingParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeScalingParametersOutcome>([this, request](const std::function<void(Model::DescribeScalingParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeScalingParametersAsync(request, [complete](const CloudSearchClient*, const Model::DescribeScalingParametersRequest&, const Model::DescribeScalingParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeScalingParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the access policies that control access to the
          * domain's document and search endpoints. By default, shows the configuration with
@@ -865,6 +1313,34 @@ namespace Model
          */
         virtual void DescribeServiceAccessPoliciesAsync(const Model::DescribeServiceAccessPoliciesRequest& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the access policies that control access to the
+         * domain's document and search endpoints. By default, shows the configuration with
+         * any pending changes. Set the <code>Deployed</code> option to <code>true</code>
+         * to show the active configuration and exclude pending changes. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-access.html"
+         * target="_blank">Configuring Access for a Search Domain</a> in the <i>Amazon
+         * CloudSearch Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeServiceAccessPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeServiceAccessPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeServiceAccessPoliciesOutcome> DescribeServiceAccessPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeServiceAccessPoliciesOutcome>([this, request](const std::function<void(Model::DescribeServiceAccessPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeServiceAccessPoliciesAsync(request, [complete](const CloudSearchClient*, const Model::DescribeServiceAccessPoliciesRequest&, const Model::DescribeServiceAccessPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeServiceAccessPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the suggesters configured for a domain. A suggester enables you to
          * display possible matches before users finish typing their queries. Can be
@@ -908,6 +1384,35 @@ namespace Model
          */
         virtual void DescribeSuggestersAsync(const Model::DescribeSuggestersRequest& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the suggesters configured for a domain. A suggester enables you to
+         * display possible matches before users finish typing their queries. Can be
+         * limited to specific suggesters by name. By default, shows all suggesters and
+         * includes any pending changes to the configuration. Set the <code>Deployed</code>
+         * option to <code>true</code> to show the active configuration and exclude pending
+         * changes. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-suggestions.html"
+         * target="_blank">Getting Search Suggestions</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSuggestersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSuggestersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSuggestersOutcome> DescribeSuggestersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSuggestersOutcome>([this, request](const std::function<void(Model::DescribeSuggestersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSuggestersAsync(request, [complete](const CloudSearchClient*, const Model::DescribeSuggestersRequest&, const Model::DescribeSuggestersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSuggestersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Tells the search domain to start indexing its documents using the latest
          * indexing options. This operation must be invoked to activate options whose
@@ -933,6 +1438,29 @@ namespace Model
          */
         virtual void IndexDocumentsAsync(const Model::IndexDocumentsRequest& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Tells the search domain to start indexing its documents using the latest
+         * indexing options. This operation must be invoked to activate options whose
+         * <a>OptionStatus</a> is <code>RequiresIndexDocuments</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way IndexDocumentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::IndexDocumentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::IndexDocumentsOutcome> IndexDocumentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::IndexDocumentsOutcome>([this, request](const std::function<void(Model::IndexDocumentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->IndexDocumentsAsync(request, [complete](const CloudSearchClient*, const Model::IndexDocumentsRequest&, const Model::IndexDocumentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::IndexDocumentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all search domains owned by an account.</p>
          */
@@ -952,6 +1480,27 @@ namespace Model
          */
         virtual void ListDomainNamesAsync(const Model::ListDomainNamesRequest& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all search domains owned by an account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDomainNamesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDomainNamesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDomainNamesOutcome> ListDomainNamesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDomainNamesOutcome>([this, request](const std::function<void(Model::ListDomainNamesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDomainNamesAsync(request, [complete](const CloudSearchClient*, const Model::ListDomainNamesRequest&, const Model::ListDomainNamesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDomainNamesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Configures the availability options for a domain. Enabling the Multi-AZ
          * option expands an Amazon CloudSearch domain to an additional Availability Zone
@@ -992,6 +1541,34 @@ namespace Model
          */
         virtual void UpdateAvailabilityOptionsAsync(const Model::UpdateAvailabilityOptionsRequest& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Configures the availability options for a domain. Enabling the Multi-AZ
+         * option expands an Amazon CloudSearch domain to an additional Availability Zone
+         * in the same Region to increase fault tolerance in the event of a service
+         * disruption. Changes to the Multi-AZ option can take about half an hour to become
+         * active. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-availability-options.html"
+         * target="_blank">Configuring Availability Options</a> in the <i>Amazon
+         * CloudSearch Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAvailabilityOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAvailabilityOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAvailabilityOptionsOutcome> UpdateAvailabilityOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAvailabilityOptionsOutcome>([this, request](const std::function<void(Model::UpdateAvailabilityOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAvailabilityOptionsAsync(request, [complete](const CloudSearchClient*, const Model::UpdateAvailabilityOptionsRequest&, const Model::UpdateAvailabilityOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAvailabilityOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Configures scaling parameters for a domain. A domain's scaling parameters
          * specify the desired search instance type and replication count. Amazon
@@ -1035,6 +1612,35 @@ namespace Model
          */
         virtual void UpdateScalingParametersAsync(const Model::UpdateScalingParametersRequest& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Configures scaling parameters for a domain. A domain's scaling parameters
+         * specify the desired search instance type and replication count. Amazon
+         * CloudSearch will still automatically scale your domain based on the volume of
+         * data and traffic, but not below the desired instance type and replication count.
+         * If the Multi-AZ option is enabled, these values control the resources used per
+         * Availability Zone. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-scaling-options.html"
+         * target="_blank">Configuring Scaling Options</a> in the <i>Amazon CloudSearch
+         * Developer Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateScalingParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateScalingParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateScalingParametersOutcome> UpdateScalingParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateScalingParametersOutcome>([this, request](const std::function<void(Model::UpdateScalingParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateScalingParametersAsync(request, [complete](const CloudSearchClient*, const Model::UpdateScalingParametersRequest&, const Model::UpdateScalingParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateScalingParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Configures the access rules that control access to the domain's document and
          * search endpoints. For more information, see <a
@@ -1063,6 +1669,30 @@ namespace Model
          */
         virtual void UpdateServiceAccessPoliciesAsync(const Model::UpdateServiceAccessPoliciesRequest& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Configures the access rules that control access to the domain's document and
+         * search endpoints. For more information, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-access.html"
+         * target="_blank"> Configuring Access for an Amazon CloudSearch Domain</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateServiceAccessPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateServiceAccessPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateServiceAccessPoliciesOutcome> UpdateServiceAccessPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateServiceAccessPoliciesOutcome>([this, request](const std::function<void(Model::UpdateServiceAccessPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateServiceAccessPoliciesAsync(request, [complete](const CloudSearchClient*, const Model::UpdateServiceAccessPoliciesRequest&, const Model::UpdateServiceAccessPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateServiceAccessPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
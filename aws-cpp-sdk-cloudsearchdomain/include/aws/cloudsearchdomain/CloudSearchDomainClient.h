@@ -24,6 +24,7 @@
 #include <aws/cloudsearchdomain/model/SuggestResult.h>
 #include <aws/cloudsearchdomain/model/UploadDocumentsResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -199,6 +200,45 @@ namespace Model
          */
         virtual void SearchAsync(const Model::SearchRequest& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves a list of documents that match the specified search criteria. How
+         * you specify the search criteria depends on which query parser you use. Amazon
+         * CloudSearch supports four query parsers:</p> <ul> <li><code>simple</code>:
+         * search all <code>text</code> and <code>text-array</code> fields for the
+         * specified string. Search for phrases, individual terms, and prefixes. </li>
+         * <li><code>structured</code>: search specific fields, construct compound queries
+         * using Boolean operators, and use advanced features such as term boosting and
+         * proximity searching.</li> <li><code>lucene</code>: specify search criteria using
+         * the Apache Lucene query parser syntax.</li> <li><code>dismax</code>: specify
+         * search criteria using the simplified subset of the Apache Lucene query parser
+         * syntax defined by the DisMax query parser.</li> </ul> <p>For more information,
+         * see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/searching.html">Searching
+         * Your Data</a> in the <i>Amazon CloudSearch Developer Guide</i>.</p> <p>The
+         * endpoint for submitting <code>Search</code> requests is domain-specific. You
+         * submit search requests to a domain's search endpoint. To get the search endpoint
+         * for your domain, use the Amazon CloudSearch configuration service
+         * <code>DescribeDomains</code> action. A domain's endpoints are also displayed on
+         * the domain dashboard in the Amazon CloudSearch console. </p>
+         *
+         * Returns an awaitable that starts the operation the way SearchAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SearchRequest>
+        Aws::Utils::Threading::Awaitable<Model::SearchOutcome> SearchAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SearchOutcome>([this, request](const std::function<void(Model::SearchOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SearchAsync(request, [complete](const CloudSearchDomainClient*, const Model::SearchRequest&, const Model::SearchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SearchOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves autocomplete suggestions for a partial query string. You can use
          * suggestions enable you to display likely matches before users finish typing. In
@@ -260,6 +300,41 @@ namespace Model
          */
         virtual void SuggestAsync(const Model::SuggestRequest& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves autocomplete suggestions for a partial query string. You can use
+         * suggestions enable you to display likely matches before users finish typing. In
+         * Amazon CloudSearch, suggestions are based on the contents of a particular text
+         * field. When you request suggestions, Amazon CloudSearch finds all of the
+         * documents whose values in the suggester field start with the specified query
+         * string. The beginning of the field must match the query string to be considered
+         * a match. </p> <p>For more information about configuring suggesters and
+         * retrieving suggestions, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-suggestions.html">Getting
+         * Suggestions</a> in the <i>Amazon CloudSearch Developer Guide</i>. </p> <p>The
+         * endpoint for submitting <code>Suggest</code> requests is domain-specific. You
+         * submit suggest requests to a domain's search endpoint. To get the search
+         * endpoint for your domain, use the Amazon CloudSearch configuration service
+         * <code>DescribeDomains</code> action. A domain's endpoints are also displayed on
+         * the domain dashboard in the Amazon CloudSearch console. </p>
+         *
+         * Returns an awaitable that starts the operation the way SuggestAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SuggestRequest>
+        Aws::Utils::Threading::Awaitable<Model::SuggestOutcome> SuggestAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SuggestOutcome>([this, request](const std::function<void(Model::SuggestOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SuggestAsync(request, [complete](const CloudSearchDomainClient*, const Model::SuggestRequest&, const Model::SuggestOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SuggestOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Posts a batch of documents to a search domain for indexing. A document batch
          * is a collection of add and delete operations that represent the documents you
@@ -339,6 +414,47 @@ namespace Model
          */
         virtual void UploadDocumentsAsync(const Model::UploadDocumentsRequest& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Posts a batch of documents to a search domain for indexing. A document batch
+         * is a collection of add and delete operations that represent the documents you
+         * want to add, update, or delete from your domain. Batches can be described in
+         * either JSON or XML. Each item that you want Amazon CloudSearch to return as a
+         * search result (such as a product) is represented as a document. Every document
+         * has a unique ID and one or more fields that contain the data that you want to
+         * search and return in results. Individual documents cannot contain more than 1 MB
+         * of data. The entire batch cannot exceed 5 MB. To get the best possible upload
+         * performance, group add and delete operations in batches that are close the 5 MB
+         * limit. Submitting a large volume of single-document batches can overload a
+         * domain's document service. </p> <p>The endpoint for submitting
+         * <code>UploadDocuments</code> requests is domain-specific. To get the document
+         * endpoint for your domain, use the Amazon CloudSearch configuration service
+         * <code>DescribeDomains</code> action. A domain's endpoints are also displayed on
+         * the domain dashboard in the Amazon CloudSearch console. </p> <p>For more
+         * information about formatting your data for Amazon CloudSearch, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/preparing-data.html">Preparing
+         * Your Data</a> in the <i>Amazon CloudSearch Developer Guide</i>. For more
+         * information about uploading data for indexing, see <a
+         * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/uploading-data.html">Uploading
+         * Data</a> in the <i>Amazon CloudSearch Developer Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way UploadDocumentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UploadDocumentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::UploadDocumentsOutcome> UploadDocumentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UploadDocumentsOutcome>([this, request](const std::function<void(Model::UploadDocumentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UploadDocumentsAsync(request, [complete](const CloudSearchDomainClient*, const Model::UploadDocumentsRequest&, const Model::UploadDocumentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UploadDocumentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
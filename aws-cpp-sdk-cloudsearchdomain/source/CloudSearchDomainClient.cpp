@@ -97,7 +97,7 @@ SearchOutcome CloudSearchDomainClient::Search(const SearchRequest& request) cons
   Aws::StringStream ss;
   ss << m_uri << "/2013-01-01/search?format=sdk&pretty=true";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "Search");
   if(outcome.IsSuccess())
   {
     return SearchOutcome(SearchResult(outcome.GetResult()));
@@ -110,17 +110,42 @@ SearchOutcome CloudSearchDomainClient::Search(const SearchRequest& request) cons
 
 SearchOutcomeCallable CloudSearchDomainClient::SearchCallable(const SearchRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchDomainClient::Search, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SearchOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->Search( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SearchOutcome > rejected;
+    rejected.set_value(SearchOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudSearchDomainClient::SearchAsync(const SearchRequest& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchDomainClient::SearchAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudSearchDomainClient::SearchAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SearchOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudSearchDomainClient::SearchAsyncHelper(const SearchRequest& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, Search(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-01-01/search?format=sdk&pretty=true";
+
+  auto sharedRequest = Aws::MakeShared<SearchRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "Search", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SearchOutcome(SearchResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SearchOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SuggestOutcome CloudSearchDomainClient::Suggest(const SuggestRequest& request) const
@@ -128,7 +153,7 @@ SuggestOutcome CloudSearchDomainClient::Suggest(const SuggestRequest& request) c
   Aws::StringStream ss;
   ss << m_uri << "/2013-01-01/suggest?format=sdk&pretty=true";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "Suggest");
   if(outcome.IsSuccess())
   {
     return SuggestOutcome(SuggestResult(outcome.GetResult()));
@@ -141,17 +166,42 @@ SuggestOutcome CloudSearchDomainClient::Suggest(const SuggestRequest& request) c
 
 SuggestOutcomeCallable CloudSearchDomainClient::SuggestCallable(const SuggestRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchDomainClient::Suggest, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SuggestOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->Suggest( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SuggestOutcome > rejected;
+    rejected.set_value(SuggestOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudSearchDomainClient::SuggestAsync(const SuggestRequest& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchDomainClient::SuggestAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudSearchDomainClient::SuggestAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SuggestOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudSearchDomainClient::SuggestAsyncHelper(const SuggestRequest& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, Suggest(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-01-01/suggest?format=sdk&pretty=true";
+
+  auto sharedRequest = Aws::MakeShared<SuggestRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "Suggest", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SuggestOutcome(SuggestResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SuggestOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UploadDocumentsOutcome CloudSearchDomainClient::UploadDocuments(const UploadDocumentsRequest& request) const
@@ -159,7 +209,7 @@ UploadDocumentsOutcome CloudSearchDomainClient::UploadDocuments(const UploadDocu
   Aws::StringStream ss;
   ss << m_uri << "/2013-01-01/documents/batch?format=sdk";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "UploadDocuments");
   if(outcome.IsSuccess())
   {
     return UploadDocumentsOutcome(UploadDocumentsResult(outcome.GetResult()));
@@ -172,16 +222,41 @@ UploadDocumentsOutcome CloudSearchDomainClient::UploadDocuments(const UploadDocu
 
 UploadDocumentsOutcomeCallable CloudSearchDomainClient::UploadDocumentsCallable(const UploadDocumentsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchDomainClient::UploadDocuments, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UploadDocumentsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UploadDocuments( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UploadDocumentsOutcome > rejected;
+    rejected.set_value(UploadDocumentsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CloudSearchDomainClient::UploadDocumentsAsync(const UploadDocumentsRequest& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchDomainClient::UploadDocumentsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CloudSearchDomainClient::UploadDocumentsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UploadDocumentsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CloudSearchDomainClient::UploadDocumentsAsyncHelper(const UploadDocumentsRequest& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UploadDocuments(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-01-01/documents/batch?format=sdk";
+
+  auto sharedRequest = Aws::MakeShared<UploadDocumentsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "UploadDocuments", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UploadDocumentsOutcome(UploadDocumentsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UploadDocumentsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
@@ -33,6 +33,7 @@
 #include <aws/cloudtrail/model/StopLoggingResult.h>
 #include <aws/cloudtrail/model/UpdateTrailResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -211,6 +212,32 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds one or more tags to a trail, up to a limit of 10. Tags must be unique
+         * per trail. Overwrites an existing tag's value when a new value is specified for
+         * an existing tag key. If you specify a key without a value, the tag will be
+         * created with the specified key and a value of null. You can tag a trail that
+         * applies to all regions only from the region in which the trail was created (that
+         * is, from its home region).</p>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsOutcome> AddTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsOutcome>([this, request](const std::function<void(Model::AddTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsAsync(request, [complete](const CloudTrailClient*, const Model::AddTagsRequest&, const Model::AddTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a trail that specifies the settings for delivery of log data to an
          * Amazon S3 bucket. A maximum of five trails can exist in a region, irrespective
@@ -236,6 +263,29 @@ namespace Model
          */
         virtual void CreateTrailAsync(const Model::CreateTrailRequest& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a trail that specifies the settings for delivery of log data to an
+         * Amazon S3 bucket. A maximum of five trails can exist in a region, irrespective
+         * of the region in which they were created.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateTrailAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTrailRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTrailOutcome> CreateTrailAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTrailOutcome>([this, request](const std::function<void(Model::CreateTrailOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTrailAsync(request, [complete](const CloudTrailClient*, const Model::CreateTrailRequest&, const Model::CreateTrailOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTrailOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a trail. This operation must be called from the region in which the
          * trail was created. <code>DeleteTrail</code> cannot be called on the shadow
@@ -264,6 +314,30 @@ namespace Model
          */
         virtual void DeleteTrailAsync(const Model::DeleteTrailRequest& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a trail. This operation must be called from the region in which the
+         * trail was created. <code>DeleteTrail</code> cannot be called on the shadow
+         * trails (replicated trails in other regions) of a trail that is enabled in all
+         * regions.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTrailAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTrailRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTrailOutcome> DeleteTrailAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTrailOutcome>([this, request](const std::function<void(Model::DeleteTrailOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTrailAsync(request, [complete](const CloudTrailClient*, const Model::DeleteTrailRequest&, const Model::DeleteTrailOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTrailOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves settings for the trail associated with the current region for your
          * account.</p>
@@ -286,6 +360,28 @@ namespace Model
          */
         virtual void DescribeTrailsAsync(const Model::DescribeTrailsRequest& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves settings for the trail associated with the current region for your
+         * account.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTrailsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTrailsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTrailsOutcome> DescribeTrailsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTrailsOutcome>([this, request](const std::function<void(Model::DescribeTrailsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTrailsAsync(request, [complete](const CloudTrailClient*, const Model::DescribeTrailsRequest&, const Model::DescribeTrailsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTrailsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a JSON-formatted list of information about the specified trail.
          * Fields include information on delivery errors, Amazon SNS and Amazon S3 errors,
@@ -317,6 +413,31 @@ namespace Model
          */
         virtual void GetTrailStatusAsync(const Model::GetTrailStatusRequest& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a JSON-formatted list of information about the specified trail.
+         * Fields include information on delivery errors, Amazon SNS and Amazon S3 errors,
+         * and start and stop logging times for each trail. This operation returns trail
+         * status from a single region. To return trail status from all regions, you must
+         * call the operation on each region.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetTrailStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetTrailStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetTrailStatusOutcome> GetTrailStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetTrailStatusOutcome>([this, request](const std::function<void(Model::GetTrailStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetTrailStatusAsync(request, [complete](const CloudTrailClient*, const Model::GetTrailStatusRequest&, const Model::GetTrailStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetTrailStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns all public keys whose private keys were used to sign the digest files
          * within the specified time range. The public key is needed to validate digest
@@ -354,6 +475,33 @@ namespace Model
          */
         virtual void ListPublicKeysAsync(const Model::ListPublicKeysRequest& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns all public keys whose private keys were used to sign the digest files
+         * within the specified time range. The public key is needed to validate digest
+         * files that were signed with its corresponding private key.</p> <note>CloudTrail
+         * uses different private/public key pairs per region. Each digest file is signed
+         * with a private key unique to its region. Therefore, when you validate a digest
+         * file from a particular region, you must look in the same region for its
+         * corresponding public key.</note>
+         *
+         * Returns an awaitable that starts the operation the way ListPublicKeysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPublicKeysRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPublicKeysOutcome> ListPublicKeysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPublicKeysOutcome>([this, request](const std::function<void(Model::ListPublicKeysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPublicKeysAsync(request, [complete](const CloudTrailClient*, const Model::ListPublicKeysRequest&, const Model::ListPublicKeysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPublicKeysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the tags for the specified trail or trails in the current region.</p>
          * <p>Lists the tags for the trail in the current region.</p>
@@ -376,6 +524,28 @@ namespace Model
          */
         virtual void ListTagsAsync(const Model::ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the tags for the specified trail or trails in the current region.</p>
+         * <p>Lists the tags for the trail in the current region.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsOutcome> ListTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsOutcome>([this, request](const std::function<void(Model::ListTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsAsync(request, [complete](const CloudTrailClient*, const Model::ListTagsRequest&, const Model::ListTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Looks up API activity events captured by CloudTrail that create, update, or
          * delete resources in your account. Events for a region can be looked up for the
@@ -434,6 +604,40 @@ namespace Model
          */
         virtual void LookupEventsAsync(const Model::LookupEventsRequest& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Looks up API activity events captured by CloudTrail that create, update, or
+         * delete resources in your account. Events for a region can be looked up for the
+         * times in which you had CloudTrail turned on in that region during the last seven
+         * days. Lookup supports five different attributes: time range (defined by a start
+         * time and end time), user name, event name, resource type, and resource name. All
+         * attributes are optional. The maximum number of attributes that can be specified
+         * in any one lookup request are time range and one other attribute. The default
+         * number of results returned is 10, with a maximum of 50 possible. The response
+         * includes a token that you can use to get the next page of results. </p>
+         * <important>The rate of lookup requests is limited to one per second per account.
+         * If this limit is exceeded, a throttling error occurs. </important>
+         * <important>Events that occurred during the selected time range will not be
+         * available for lookup if CloudTrail logging was not enabled when the events
+         * occurred.</important>
+         *
+         * Returns an awaitable that starts the operation the way LookupEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::LookupEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::LookupEventsOutcome> LookupEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::LookupEventsOutcome>([this, request](const std::function<void(Model::LookupEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->LookupEventsAsync(request, [complete](const CloudTrailClient*, const Model::LookupEventsRequest&, const Model::LookupEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::LookupEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified tags from a trail.</p>
          */
@@ -453,6 +657,27 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified tags from a trail.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsOutcome>([this, request](const std::function<void(Model::RemoveTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsAsync(request, [complete](const CloudTrailClient*, const Model::RemoveTagsRequest&, const Model::RemoveTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts the recording of AWS API calls and log file delivery for a trail. For
          * a trail that is enabled in all regions, this operation must be called from the
@@ -484,6 +709,31 @@ namespace Model
          */
         virtual void StartLoggingAsync(const Model::StartLoggingRequest& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts the recording of AWS API calls and log file delivery for a trail. For
+         * a trail that is enabled in all regions, this operation must be called from the
+         * region in which the trail was created. This operation cannot be called on the
+         * shadow trails (replicated trails in other regions) of a trail that is enabled in
+         * all regions.</p>
+         *
+         * Returns an awaitable that starts the operation the way StartLoggingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartLoggingRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartLoggingOutcome> StartLoggingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartLoggingOutcome>([this, request](const std::function<void(Model::StartLoggingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartLoggingAsync(request, [complete](const CloudTrailClient*, const Model::StartLoggingRequest&, const Model::StartLoggingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartLoggingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Suspends the recording of AWS API calls and log file delivery for the
          * specified trail. Under most circumstances, there is no need to use this action.
@@ -524,6 +774,34 @@ namespace Model
          */
         virtual void StopLoggingAsync(const Model::StopLoggingRequest& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Suspends the recording of AWS API calls and log file delivery for the
+         * specified trail. Under most circumstances, there is no need to use this action.
+         * You can update a trail without stopping it first. This action is the only way to
+         * stop recording. For a trail enabled in all regions, this operation must be
+         * called from the region in which the trail was created, or an
+         * <code>InvalidHomeRegionException</code> will occur. This operation cannot be
+         * called on the shadow trails (replicated trails in other regions) of a trail
+         * enabled in all regions.</p>
+         *
+         * Returns an awaitable that starts the operation the way StopLoggingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StopLoggingRequest>
+        Aws::Utils::Threading::Awaitable<Model::StopLoggingOutcome> StopLoggingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StopLoggingOutcome>([this, request](const std::function<void(Model::StopLoggingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StopLoggingAsync(request, [complete](const CloudTrailClient*, const Model::StopLoggingRequest&, const Model::StopLoggingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StopLoggingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the settings that specify delivery of log files. Changes to a trail
          * do not require stopping the CloudTrail service. Use this action to designate an
@@ -558,6 +836,32 @@ namespace Model
          */
         virtual void UpdateTrailAsync(const Model::UpdateTrailRequest& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the settings that specify delivery of log files. Changes to a trail
+         * do not require stopping the CloudTrail service. Use this action to designate an
+         * existing bucket for log delivery. If the existing bucket has previously been a
+         * target for CloudTrail log files, an IAM policy exists for the bucket.
+         * <code>UpdateTrail</code> must be called from the region in which the trail was
+         * created; otherwise, an <code>InvalidHomeRegionException</code> is thrown.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateTrailAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateTrailRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateTrailOutcome> UpdateTrailAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateTrailOutcome>([this, request](const std::function<void(Model::UpdateTrailOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateTrailAsync(request, [complete](const CloudTrailClient*, const Model::UpdateTrailRequest&, const Model::UpdateTrailOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateTrailOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -33,6 +33,7 @@
 #include <aws/codecommit/model/TestRepositoryTriggersResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -239,6 +240,32 @@ namespace Model
          */
         virtual void BatchGetRepositoriesAsync(const Model::BatchGetRepositoriesRequest& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about one or more repositories.</p> <note><p>The
+         * description field for a repository accepts all HTML characters and all valid
+         * Unicode characters. Applications that do not HTML-encode the description and
+         * display it in a web page could expose users to potentially malicious code. Make
+         * sure that you HTML-encode the description field in any application that uses
+         * this API to display the repository description on a web page.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way BatchGetRepositoriesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchGetRepositoriesRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchGetRepositoriesOutcome> BatchGetRepositoriesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchGetRepositoriesOutcome>([this, request](const std::function<void(Model::BatchGetRepositoriesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchGetRepositoriesAsync(request, [complete](const CodeCommitClient*, const Model::BatchGetRepositoriesRequest&, const Model::BatchGetRepositoriesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchGetRepositoriesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new branch in a repository and points the branch to a commit.</p>
          * <note><p>Calling the create branch operation does not set a repository's default
@@ -264,6 +291,29 @@ namespace Model
          */
         virtual void CreateBranchAsync(const Model::CreateBranchRequest& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new branch in a repository and points the branch to a commit.</p>
+         * <note><p>Calling the create branch operation does not set a repository's default
+         * branch. To do this, call the update default branch operation.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way CreateBranchAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateBranchRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateBranchOutcome> CreateBranchAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateBranchOutcome>([this, request](const std::function<void(Model::CreateBranchOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateBranchAsync(request, [complete](const CodeCommitClient*, const Model::CreateBranchRequest&, const Model::CreateBranchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateBranchOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new, empty repository.</p>
          */
@@ -283,6 +333,27 @@ namespace Model
          */
         virtual void CreateRepositoryAsync(const Model::CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new, empty repository.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateRepositoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateRepositoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateRepositoryOutcome> CreateRepositoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateRepositoryOutcome>([this, request](const std::function<void(Model::CreateRepositoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateRepositoryAsync(request, [complete](const CodeCommitClient*, const Model::CreateRepositoryRequest&, const Model::CreateRepositoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateRepositoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a repository. If a specified repository was already deleted, a null
          * repository ID will be returned.</p> <important>Deleting a repository also
@@ -311,6 +382,30 @@ namespace Model
          */
         virtual void DeleteRepositoryAsync(const Model::DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a repository. If a specified repository was already deleted, a null
+         * repository ID will be returned.</p> <important>Deleting a repository also
+         * deletes all associated objects and metadata. After a repository is deleted, all
+         * future push calls to the deleted repository will fail.</important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRepositoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRepositoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRepositoryOutcome> DeleteRepositoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRepositoryOutcome>([this, request](const std::function<void(Model::DeleteRepositoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRepositoryAsync(request, [complete](const CodeCommitClient*, const Model::DeleteRepositoryRequest&, const Model::DeleteRepositoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRepositoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about a repository branch, including its name and the
          * last commit ID.</p>
@@ -333,6 +428,28 @@ namespace Model
          */
         virtual void GetBranchAsync(const Model::GetBranchRequest& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about a repository branch, including its name and the
+         * last commit ID.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetBranchAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBranchRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBranchOutcome> GetBranchAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBranchOutcome>([this, request](const std::function<void(Model::GetBranchOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBranchAsync(request, [complete](const CodeCommitClient*, const Model::GetBranchRequest&, const Model::GetBranchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBranchOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about a commit, including commit message and committer
          * information.</p>
@@ -355,6 +472,28 @@ namespace Model
          */
         virtual void GetCommitAsync(const Model::GetCommitRequest& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about a commit, including commit message and committer
+         * information.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetCommitAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetCommitRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetCommitOutcome> GetCommitAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetCommitOutcome>([this, request](const std::function<void(Model::GetCommitOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetCommitAsync(request, [complete](const CodeCommitClient*, const Model::GetCommitRequest&, const Model::GetCommitOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetCommitOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about a repository.</p> <note><p>The description field
          * for a repository accepts all HTML characters and all valid Unicode characters.
@@ -389,6 +528,32 @@ namespace Model
          */
         virtual void GetRepositoryAsync(const Model::GetRepositoryRequest& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about a repository.</p> <note><p>The description field
+         * for a repository accepts all HTML characters and all valid Unicode characters.
+         * Applications that do not HTML-encode the description and display it in a web
+         * page could expose users to potentially malicious code. Make sure that you
+         * HTML-encode the description field in any application that uses this API to
+         * display the repository description on a web page.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way GetRepositoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetRepositoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetRepositoryOutcome> GetRepositoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetRepositoryOutcome>([this, request](const std::function<void(Model::GetRepositoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetRepositoryAsync(request, [complete](const CodeCommitClient*, const Model::GetRepositoryRequest&, const Model::GetRepositoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetRepositoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about triggers configured for a repository.</p>
          */
@@ -408,6 +573,27 @@ namespace Model
          */
         virtual void GetRepositoryTriggersAsync(const Model::GetRepositoryTriggersRequest& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about triggers configured for a repository.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetRepositoryTriggersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetRepositoryTriggersRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetRepositoryTriggersOutcome> GetRepositoryTriggersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetRepositoryTriggersOutcome>([this, request](const std::function<void(Model::GetRepositoryTriggersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetRepositoryTriggersAsync(request, [complete](const CodeCommitClient*, const Model::GetRepositoryTriggersRequest&, const Model::GetRepositoryTriggersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetRepositoryTriggersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about one or more branches in a repository.</p>
          */
@@ -427,6 +613,27 @@ namespace Model
          */
         virtual void ListBranchesAsync(const Model::ListBranchesRequest& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about one or more branches in a repository.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListBranchesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListBranchesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListBranchesOutcome> ListBranchesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListBranchesOutcome>([this, request](const std::function<void(Model::ListBranchesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListBranchesAsync(request, [complete](const CodeCommitClient*, const Model::ListBranchesRequest&, const Model::ListBranchesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListBranchesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about one or more repositories.</p>
          */
@@ -446,6 +653,27 @@ namespace Model
          */
         virtual void ListRepositoriesAsync(const Model::ListRepositoriesRequest& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about one or more repositories.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListRepositoriesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRepositoriesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRepositoriesOutcome> ListRepositoriesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRepositoriesOutcome>([this, request](const std::function<void(Model::ListRepositoriesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRepositoriesAsync(request, [complete](const CodeCommitClient*, const Model::ListRepositoriesRequest&, const Model::ListRepositoriesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRepositoriesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Replaces all triggers for a repository. This can be used to create or delete
          * triggers.</p>
@@ -468,6 +696,28 @@ namespace Model
          */
         virtual void PutRepositoryTriggersAsync(const Model::PutRepositoryTriggersRequest& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Replaces all triggers for a repository. This can be used to create or delete
+         * triggers.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutRepositoryTriggersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutRepositoryTriggersRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutRepositoryTriggersOutcome> PutRepositoryTriggersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutRepositoryTriggersOutcome>([this, request](const std::function<void(Model::PutRepositoryTriggersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutRepositoryTriggersAsync(request, [complete](const CodeCommitClient*, const Model::PutRepositoryTriggersRequest&, const Model::PutRepositoryTriggersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutRepositoryTriggersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Tests the functionality of repository triggers by sending information to the
          * trigger target. If real data is available in the repository, the test will send
@@ -496,6 +746,30 @@ namespace Model
          */
         virtual void TestRepositoryTriggersAsync(const Model::TestRepositoryTriggersRequest& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Tests the functionality of repository triggers by sending information to the
+         * trigger target. If real data is available in the repository, the test will send
+         * data from the last commit. If no data is available, sample data will be
+         * generated.</p>
+         *
+         * Returns an awaitable that starts the operation the way TestRepositoryTriggersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TestRepositoryTriggersRequest>
+        Aws::Utils::Threading::Awaitable<Model::TestRepositoryTriggersOutcome> TestRepositoryTriggersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TestRepositoryTriggersOutcome>([this, request](const std::function<void(Model::TestRepositoryTriggersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TestRepositoryTriggersAsync(request, [complete](const CodeCommitClient*, const Model::TestRepositoryTriggersRequest&, const Model::TestRepositoryTriggersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TestRepositoryTriggersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets or changes the default branch name for the specified repository.</p>
          * <note><p>If you use this operation to change the default branch name to the
@@ -524,6 +798,30 @@ namespace Model
          */
         virtual void UpdateDefaultBranchAsync(const Model::UpdateDefaultBranchRequest& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets or changes the default branch name for the specified repository.</p>
+         * <note><p>If you use this operation to change the default branch name to the
+         * current default branch name, a success message is returned even though the
+         * default branch did not change.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateDefaultBranchAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDefaultBranchRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDefaultBranchOutcome> UpdateDefaultBranchAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDefaultBranchOutcome>([this, request](const std::function<void(Model::UpdateDefaultBranchOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDefaultBranchAsync(request, [complete](const CodeCommitClient*, const Model::UpdateDefaultBranchRequest&, const Model::UpdateDefaultBranchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDefaultBranchOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets or changes the comment or description for a repository.</p> <note><p>The
          * description field for a repository accepts all HTML characters and all valid
@@ -558,6 +856,32 @@ namespace Model
          */
         virtual void UpdateRepositoryDescriptionAsync(const Model::UpdateRepositoryDescriptionRequest& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets or changes the comment or description for a repository.</p> <note><p>The
+         * description field for a repository accepts all HTML characters and all valid
+         * Unicode characters. Applications that do not HTML-encode the description and
+         * display it in a web page could expose users to potentially malicious code. Make
+         * sure that you HTML-encode the description field in any application that uses
+         * this API to display the repository description on a web page.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateRepositoryDescriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateRepositoryDescriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateRepositoryDescriptionOutcome> UpdateRepositoryDescriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateRepositoryDescriptionOutcome>([this, request](const std::function<void(Model::UpdateRepositoryDescriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateRepositoryDescriptionAsync(request, [complete](const CodeCommitClient*, const Model::UpdateRepositoryDescriptionRequest&, const Model::UpdateRepositoryDescriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateRepositoryDescriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Renames a repository. The repository name must be unique across the calling
          * AWS account. In addition, repository names are limited to 100 alphanumeric,
@@ -595,6 +919,33 @@ namespace Model
          */
         virtual void UpdateRepositoryNameAsync(const Model::UpdateRepositoryNameRequest& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Renames a repository. The repository name must be unique across the calling
+         * AWS account. In addition, repository names are limited to 100 alphanumeric,
+         * dash, and underscore characters, and cannot include certain characters. The
+         * suffix ".git" is prohibited. For a full description of the limits on repository
+         * names, see <a
+         * href="http://docs.aws.amazon.com/codecommit/latest/userguide/limits.html">Limits</a>
+         * in the AWS CodeCommit User Guide.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateRepositoryNameAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateRepositoryNameRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateRepositoryNameOutcome> UpdateRepositoryNameAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateRepositoryNameOutcome>([this, request](const std::function<void(Model::UpdateRepositoryNameOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateRepositoryNameAsync(request, [complete](const CodeCommitClient*, const Model::UpdateRepositoryNameRequest&, const Model::UpdateRepositoryNameOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateRepositoryNameOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -49,6 +49,7 @@
 #include <aws/codedeploy/model/UpdateDeploymentGroupResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -321,6 +322,27 @@ namespace Model
          */
         virtual void AddTagsToOnPremisesInstancesAsync(const Model::AddTagsToOnPremisesInstancesRequest& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds tags to on-premises instances.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsToOnPremisesInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsToOnPremisesInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsToOnPremisesInstancesOutcome> AddTagsToOnPremisesInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsToOnPremisesInstancesOutcome>([this, request](const std::function<void(Model::AddTagsToOnPremisesInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsToOnPremisesInstancesAsync(request, [complete](const CodeDeployClient*, const Model::AddTagsToOnPremisesInstancesRequest&, const Model::AddTagsToOnPremisesInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsToOnPremisesInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about one or more application revisions.</p>
          */
@@ -340,6 +362,27 @@ namespace Model
          */
         virtual void BatchGetApplicationRevisionsAsync(const Model::BatchGetApplicationRevisionsRequest& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about one or more application revisions.</p>
+         *
+         * Returns an awaitable that starts the operation the way BatchGetApplicationRevisionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchGetApplicationRevisionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchGetApplicationRevisionsOutcome> BatchGetApplicationRevisionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchGetApplicationRevisionsOutcome>([this, request](const std::function<void(Model::BatchGetApplicationRevisionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchGetApplicationRevisionsAsync(request, [complete](const CodeDeployClient*, const Model::BatchGetApplicationRevisionsRequest&, const Model::BatchGetApplicationRevisionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchGetApplicationRevisionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about one or more applications.</p>
          */
@@ -359,6 +402,27 @@ namespace Model
          */
         virtual void BatchGetApplicationsAsync(const Model::BatchGetApplicationsRequest& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about one or more applications.</p>
+         *
+         * Returns an awaitable that starts the operation the way BatchGetApplicationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchGetApplicationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchGetApplicationsOutcome> BatchGetApplicationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchGetApplicationsOutcome>([this, request](const std::function<void(Model::BatchGetApplicationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchGetApplicationsAsync(request, [complete](const CodeDeployClient*, const Model::BatchGetApplicationsRequest&, const Model::BatchGetApplicationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchGetApplicationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Get information about one or more deployment groups.</p>
          */
@@ -378,6 +442,27 @@ namespace Model
          */
         virtual void BatchGetDeploymentGroupsAsync(const Model::BatchGetDeploymentGroupsRequest& request, const BatchGetDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Get information about one or more deployment groups.</p>
+         *
+         * Returns an awaitable that starts the operation the way BatchGetDeploymentGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchGetDeploymentGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchGetDeploymentGroupsOutcome> BatchGetDeploymentGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchGetDeploymentGroupsOutcome>([this, request](const std::function<void(Model::BatchGetDeploymentGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchGetDeploymentGroupsAsync(request, [complete](const CodeDeployClient*, const Model::BatchGetDeploymentGroupsRequest&, const Model::BatchGetDeploymentGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchGetDeploymentGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about one or more instance that are part of a deployment
          * group.</p>
@@ -400,6 +485,28 @@ namespace Model
          */
         virtual void BatchGetDeploymentInstancesAsync(const Model::BatchGetDeploymentInstancesRequest& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about one or more instance that are part of a deployment
+         * group.</p>
+         *
+         * Returns an awaitable that starts the operation the way BatchGetDeploymentInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchGetDeploymentInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchGetDeploymentInstancesOutcome> BatchGetDeploymentInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchGetDeploymentInstancesOutcome>([this, request](const std::function<void(Model::BatchGetDeploymentInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchGetDeploymentInstancesAsync(request, [complete](const CodeDeployClient*, const Model::BatchGetDeploymentInstancesRequest&, const Model::BatchGetDeploymentInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchGetDeploymentInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about one or more deployments.</p>
          */
@@ -419,6 +526,27 @@ namespace Model
          */
         virtual void BatchGetDeploymentsAsync(const Model::BatchGetDeploymentsRequest& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about one or more deployments.</p>
+         *
+         * Returns an awaitable that starts the operation the way BatchGetDeploymentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchGetDeploymentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchGetDeploymentsOutcome> BatchGetDeploymentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchGetDeploymentsOutcome>([this, request](const std::function<void(Model::BatchGetDeploymentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchGetDeploymentsAsync(request, [complete](const CodeDeployClient*, const Model::BatchGetDeploymentsRequest&, const Model::BatchGetDeploymentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchGetDeploymentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about one or more on-premises instances.</p>
          */
@@ -438,6 +566,27 @@ namespace Model
          */
         virtual void BatchGetOnPremisesInstancesAsync(const Model::BatchGetOnPremisesInstancesRequest& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about one or more on-premises instances.</p>
+         *
+         * Returns an awaitable that starts the operation the way BatchGetOnPremisesInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchGetOnPremisesInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchGetOnPremisesInstancesOutcome> BatchGetOnPremisesInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchGetOnPremisesInstancesOutcome>([this, request](const std::function<void(Model::BatchGetOnPremisesInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchGetOnPremisesInstancesAsync(request, [complete](const CodeDeployClient*, const Model::BatchGetOnPremisesInstancesRequest&, const Model::BatchGetOnPremisesInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchGetOnPremisesInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an application.</p>
          */
@@ -457,6 +606,27 @@ namespace Model
          */
         virtual void CreateApplicationAsync(const Model::CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an application.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateApplicationOutcome> CreateApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateApplicationOutcome>([this, request](const std::function<void(Model::CreateApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateApplicationAsync(request, [complete](const CodeDeployClient*, const Model::CreateApplicationRequest&, const Model::CreateApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deploys an application revision through the specified deployment group.</p>
          */
@@ -476,6 +646,27 @@ namespace Model
          */
         virtual void CreateDeploymentAsync(const Model::CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deploys an application revision through the specified deployment group.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDeploymentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDeploymentRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDeploymentOutcome>([this, request](const std::function<void(Model::CreateDeploymentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDeploymentAsync(request, [complete](const CodeDeployClient*, const Model::CreateDeploymentRequest&, const Model::CreateDeploymentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDeploymentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a deployment configuration.</p>
          */
@@ -495,6 +686,27 @@ namespace Model
          */
         virtual void CreateDeploymentConfigAsync(const Model::CreateDeploymentConfigRequest& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a deployment configuration.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDeploymentConfigAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDeploymentConfigRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDeploymentConfigOutcome> CreateDeploymentConfigAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDeploymentConfigOutcome>([this, request](const std::function<void(Model::CreateDeploymentConfigOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDeploymentConfigAsync(request, [complete](const CodeDeployClient*, const Model::CreateDeploymentConfigRequest&, const Model::CreateDeploymentConfigOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDeploymentConfigOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a deployment group to which application revisions will be
          * deployed.</p>
@@ -517,6 +729,28 @@ namespace Model
          */
         virtual void CreateDeploymentGroupAsync(const Model::CreateDeploymentGroupRequest& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a deployment group to which application revisions will be
+         * deployed.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDeploymentGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDeploymentGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDeploymentGroupOutcome> CreateDeploymentGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDeploymentGroupOutcome>([this, request](const std::function<void(Model::CreateDeploymentGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDeploymentGroupAsync(request, [complete](const CodeDeployClient*, const Model::CreateDeploymentGroupRequest&, const Model::CreateDeploymentGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDeploymentGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an application.</p>
          */
@@ -536,6 +770,27 @@ namespace Model
          */
         virtual void DeleteApplicationAsync(const Model::DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an application.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteApplicationOutcome>([this, request](const std::function<void(Model::DeleteApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteApplicationAsync(request, [complete](const CodeDeployClient*, const Model::DeleteApplicationRequest&, const Model::DeleteApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a deployment configuration.</p> <note>A deployment configuration
          * cannot be deleted if it is currently in use. Predefined configurations cannot be
@@ -561,6 +816,29 @@ namespace Model
          */
         virtual void DeleteDeploymentConfigAsync(const Model::DeleteDeploymentConfigRequest& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a deployment configuration.</p> <note>A deployment configuration
+         * cannot be deleted if it is currently in use. Predefined configurations cannot be
+         * deleted.</note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDeploymentConfigAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDeploymentConfigRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDeploymentConfigOutcome> DeleteDeploymentConfigAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDeploymentConfigOutcome>([this, request](const std::function<void(Model::DeleteDeploymentConfigOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDeploymentConfigAsync(request, [complete](const CodeDeployClient*, const Model::DeleteDeploymentConfigRequest&, const Model::DeleteDeploymentConfigOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDeploymentConfigOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a deployment group.</p>
          */
@@ -580,6 +858,27 @@ namespace Model
          */
         virtual void DeleteDeploymentGroupAsync(const Model::DeleteDeploymentGroupRequest& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a deployment group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDeploymentGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDeploymentGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDeploymentGroupOutcome> DeleteDeploymentGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDeploymentGroupOutcome>([this, request](const std::function<void(Model::DeleteDeploymentGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDeploymentGroupAsync(request, [complete](const CodeDeployClient*, const Model::DeleteDeploymentGroupRequest&, const Model::DeleteDeploymentGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDeploymentGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deregisters an on-premises instance.</p>
          */
@@ -599,6 +898,27 @@ namespace Model
          */
         virtual void DeregisterOnPremisesInstanceAsync(const Model::DeregisterOnPremisesInstanceRequest& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deregisters an on-premises instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterOnPremisesInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterOnPremisesInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterOnPremisesInstanceOutcome> DeregisterOnPremisesInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterOnPremisesInstanceOutcome>([this, request](const std::function<void(Model::DeregisterOnPremisesInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterOnPremisesInstanceAsync(request, [complete](const CodeDeployClient*, const Model::DeregisterOnPremisesInstanceRequest&, const Model::DeregisterOnPremisesInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterOnPremisesInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about an application.</p>
          */
@@ -618,6 +938,27 @@ namespace Model
          */
         virtual void GetApplicationAsync(const Model::GetApplicationRequest& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about an application.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetApplicationOutcome> GetApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetApplicationOutcome>([this, request](const std::function<void(Model::GetApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetApplicationAsync(request, [complete](const CodeDeployClient*, const Model::GetApplicationRequest&, const Model::GetApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about an application revision.</p>
          */
@@ -637,6 +978,27 @@ namespace Model
          */
         virtual void GetApplicationRevisionAsync(const Model::GetApplicationRevisionRequest& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about an application revision.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetApplicationRevisionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetApplicationRevisionRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetApplicationRevisionOutcome> GetApplicationRevisionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetApplicationRevisionOutcome>([this, request](const std::function<void(Model::GetApplicationRevisionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetApplicationRevisionAsync(request, [complete](const CodeDeployClient*, const Model::GetApplicationRevisionRequest&, const Model::GetApplicationRevisionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetApplicationRevisionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a deployment.</p>
          */
@@ -656,6 +1018,27 @@ namespace Model
          */
         virtual void GetDeploymentAsync(const Model::GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a deployment.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDeploymentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDeploymentRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDeploymentOutcome> GetDeploymentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDeploymentOutcome>([this, request](const std::function<void(Model::GetDeploymentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDeploymentAsync(request, [complete](const CodeDeployClient*, const Model::GetDeploymentRequest&, const Model::GetDeploymentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDeploymentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a deployment configuration.</p>
          */
@@ -675,6 +1058,27 @@ namespace Model
          */
         virtual void GetDeploymentConfigAsync(const Model::GetDeploymentConfigRequest& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a deployment configuration.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDeploymentConfigAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDeploymentConfigRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDeploymentConfigOutcome> GetDeploymentConfigAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDeploymentConfigOutcome>([this, request](const std::function<void(Model::GetDeploymentConfigOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDeploymentConfigAsync(request, [complete](const CodeDeployClient*, const Model::GetDeploymentConfigRequest&, const Model::GetDeploymentConfigOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDeploymentConfigOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a deployment group.</p>
          */
@@ -694,6 +1098,27 @@ namespace Model
          */
         virtual void GetDeploymentGroupAsync(const Model::GetDeploymentGroupRequest& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a deployment group.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDeploymentGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDeploymentGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDeploymentGroupOutcome> GetDeploymentGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDeploymentGroupOutcome>([this, request](const std::function<void(Model::GetDeploymentGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDeploymentGroupAsync(request, [complete](const CodeDeployClient*, const Model::GetDeploymentGroupRequest&, const Model::GetDeploymentGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDeploymentGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about an instance as part of a deployment.</p>
          */
@@ -713,6 +1138,27 @@ namespace Model
          */
         virtual void GetDeploymentInstanceAsync(const Model::GetDeploymentInstanceRequest& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about an instance as part of a deployment.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDeploymentInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDeploymentInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDeploymentInstanceOutcome> GetDeploymentInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDeploymentInstanceOutcome>([this, request](const std::function<void(Model::GetDeploymentInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDeploymentInstanceAsync(request, [complete](const CodeDeployClient*, const Model::GetDeploymentInstanceRequest&, const Model::GetDeploymentInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDeploymentInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about an on-premises instance.</p>
          */
@@ -732,6 +1178,27 @@ namespace Model
          */
         virtual void GetOnPremisesInstanceAsync(const Model::GetOnPremisesInstanceRequest& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about an on-premises instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetOnPremisesInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetOnPremisesInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetOnPremisesInstanceOutcome> GetOnPremisesInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetOnPremisesInstanceOutcome>([this, request](const std::function<void(Model::GetOnPremisesInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetOnPremisesInstanceAsync(request, [complete](const CodeDeployClient*, const Model::GetOnPremisesInstanceRequest&, const Model::GetOnPremisesInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetOnPremisesInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists information about revisions for an application.</p>
          */
@@ -751,6 +1218,27 @@ namespace Model
          */
         virtual void ListApplicationRevisionsAsync(const Model::ListApplicationRevisionsRequest& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists information about revisions for an application.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListApplicationRevisionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListApplicationRevisionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListApplicationRevisionsOutcome> ListApplicationRevisionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListApplicationRevisionsOutcome>([this, request](const std::function<void(Model::ListApplicationRevisionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListApplicationRevisionsAsync(request, [complete](const CodeDeployClient*, const Model::ListApplicationRevisionsRequest&, const Model::ListApplicationRevisionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListApplicationRevisionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the applications registered with the applicable IAM user or AWS
          * account.</p>
@@ -773,6 +1261,28 @@ namespace Model
          */
         virtual void ListApplicationsAsync(const Model::ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the applications registered with the applicable IAM user or AWS
+         * account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListApplicationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListApplicationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListApplicationsOutcome> ListApplicationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListApplicationsOutcome>([this, request](const std::function<void(Model::ListApplicationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListApplicationsAsync(request, [complete](const CodeDeployClient*, const Model::ListApplicationsRequest&, const Model::ListApplicationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListApplicationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the deployment configurations with the applicable IAM user or AWS
          * account.</p>
@@ -795,6 +1305,28 @@ namespace Model
          */
         virtual void ListDeploymentConfigsAsync(const Model::ListDeploymentConfigsRequest& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the deployment configurations with the applicable IAM user or AWS
+         * account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDeploymentConfigsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDeploymentConfigsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDeploymentConfigsOutcome> ListDeploymentConfigsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDeploymentConfigsOutcome>([this, request](const std::function<void(Model::ListDeploymentConfigsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDeploymentConfigsAsync(request, [complete](const CodeDeployClient*, const Model::ListDeploymentConfigsRequest&, const Model::ListDeploymentConfigsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDeploymentConfigsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the deployment groups for an application registered with the applicable
          * IAM user or AWS account.</p>
@@ -817,6 +1349,28 @@ namespace Model
          */
         virtual void ListDeploymentGroupsAsync(const Model::ListDeploymentGroupsRequest& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the deployment groups for an application registered with the applicable
+         * IAM user or AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDeploymentGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDeploymentGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDeploymentGroupsOutcome> ListDeploymentGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDeploymentGroupsOutcome>([this, request](const std::function<void(Model::ListDeploymentGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDeploymentGroupsAsync(request, [complete](const CodeDeployClient*, const Model::ListDeploymentGroupsRequest&, const Model::ListDeploymentGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDeploymentGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the instance for a deployment associated with the applicable IAM user
          * or AWS account.</p>
@@ -839,6 +1393,28 @@ namespace Model
          */
         virtual void ListDeploymentInstancesAsync(const Model::ListDeploymentInstancesRequest& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the instance for a deployment associated with the applicable IAM user
+         * or AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDeploymentInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDeploymentInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDeploymentInstancesOutcome> ListDeploymentInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDeploymentInstancesOutcome>([this, request](const std::function<void(Model::ListDeploymentInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDeploymentInstancesAsync(request, [complete](const CodeDeployClient*, const Model::ListDeploymentInstancesRequest&, const Model::ListDeploymentInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDeploymentInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the deployments in a deployment group for an application registered
          * with the applicable IAM user or AWS account.</p>
@@ -861,6 +1437,28 @@ namespace Model
          */
         virtual void ListDeploymentsAsync(const Model::ListDeploymentsRequest& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the deployments in a deployment group for an application registered
+         * with the applicable IAM user or AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDeploymentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDeploymentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDeploymentsOutcome> ListDeploymentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDeploymentsOutcome>([this, request](const std::function<void(Model::ListDeploymentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDeploymentsAsync(request, [complete](const CodeDeployClient*, const Model::ListDeploymentsRequest&, const Model::ListDeploymentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDeploymentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets a list of names for one or more on-premises instances.</p> <p>Unless
          * otherwise specified, both registered and deregistered on-premises instance names
@@ -889,6 +1487,30 @@ namespace Model
          */
         virtual void ListOnPremisesInstancesAsync(const Model::ListOnPremisesInstancesRequest& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets a list of names for one or more on-premises instances.</p> <p>Unless
+         * otherwise specified, both registered and deregistered on-premises instance names
+         * will be listed. To list only registered or deregistered on-premises instance
+         * names, use the registration status parameter.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListOnPremisesInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListOnPremisesInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListOnPremisesInstancesOutcome> ListOnPremisesInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListOnPremisesInstancesOutcome>([this, request](const std::function<void(Model::ListOnPremisesInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListOnPremisesInstancesAsync(request, [complete](const CodeDeployClient*, const Model::ListOnPremisesInstancesRequest&, const Model::ListOnPremisesInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListOnPremisesInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers with AWS CodeDeploy a revision for the specified application.</p>
          */
@@ -908,6 +1530,27 @@ namespace Model
          */
         virtual void RegisterApplicationRevisionAsync(const Model::RegisterApplicationRevisionRequest& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers with AWS CodeDeploy a revision for the specified application.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterApplicationRevisionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterApplicationRevisionRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterApplicationRevisionOutcome> RegisterApplicationRevisionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterApplicationRevisionOutcome>([this, request](const std::function<void(Model::RegisterApplicationRevisionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterApplicationRevisionAsync(request, [complete](const CodeDeployClient*, const Model::RegisterApplicationRevisionRequest&, const Model::RegisterApplicationRevisionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterApplicationRevisionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers an on-premises instance.</p>
          */
@@ -927,6 +1570,27 @@ namespace Model
          */
         virtual void RegisterOnPremisesInstanceAsync(const Model::RegisterOnPremisesInstanceRequest& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers an on-premises instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterOnPremisesInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterOnPremisesInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterOnPremisesInstanceOutcome> RegisterOnPremisesInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterOnPremisesInstanceOutcome>([this, request](const std::function<void(Model::RegisterOnPremisesInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterOnPremisesInstanceAsync(request, [complete](const CodeDeployClient*, const Model::RegisterOnPremisesInstanceRequest&, const Model::RegisterOnPremisesInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterOnPremisesInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes one or more tags from one or more on-premises instances.</p>
          */
@@ -946,6 +1610,27 @@ namespace Model
          */
         virtual void RemoveTagsFromOnPremisesInstancesAsync(const Model::RemoveTagsFromOnPremisesInstancesRequest& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes one or more tags from one or more on-premises instances.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsFromOnPremisesInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsFromOnPremisesInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromOnPremisesInstancesOutcome> RemoveTagsFromOnPremisesInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromOnPremisesInstancesOutcome>([this, request](const std::function<void(Model::RemoveTagsFromOnPremisesInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsFromOnPremisesInstancesAsync(request, [complete](const CodeDeployClient*, const Model::RemoveTagsFromOnPremisesInstancesRequest&, const Model::RemoveTagsFromOnPremisesInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsFromOnPremisesInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attempts to stop an ongoing deployment.</p>
          */
@@ -965,6 +1650,27 @@ namespace Model
          */
         virtual void StopDeploymentAsync(const Model::StopDeploymentRequest& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attempts to stop an ongoing deployment.</p>
+         *
+         * Returns an awaitable that starts the operation the way StopDeploymentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StopDeploymentRequest>
+        Aws::Utils::Threading::Awaitable<Model::StopDeploymentOutcome> StopDeploymentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StopDeploymentOutcome>([this, request](const std::function<void(Model::StopDeploymentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StopDeploymentAsync(request, [complete](const CodeDeployClient*, const Model::StopDeploymentRequest&, const Model::StopDeploymentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StopDeploymentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes the name of an application.</p>
          */
@@ -984,6 +1690,27 @@ namespace Model
          */
         virtual void UpdateApplicationAsync(const Model::UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes the name of an application.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateApplicationOutcome>([this, request](const std::function<void(Model::UpdateApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateApplicationAsync(request, [complete](const CodeDeployClient*, const Model::UpdateApplicationRequest&, const Model::UpdateApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes information about a deployment group.</p>
          */
@@ -1003,6 +1730,27 @@ namespace Model
          */
         virtual void UpdateDeploymentGroupAsync(const Model::UpdateDeploymentGroupRequest& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes information about a deployment group.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateDeploymentGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDeploymentGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDeploymentGroupOutcome> UpdateDeploymentGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDeploymentGroupOutcome>([this, request](const std::function<void(Model::UpdateDeploymentGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDeploymentGroupAsync(request, [complete](const CodeDeployClient*, const Model::UpdateDeploymentGroupRequest&, const Model::UpdateDeploymentGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDeploymentGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
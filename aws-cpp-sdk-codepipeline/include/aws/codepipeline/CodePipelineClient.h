@@ -37,6 +37,7 @@
 #include <aws/codepipeline/model/UpdatePipelineResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -298,6 +299,28 @@ namespace Model
          */
         virtual void AcknowledgeJobAsync(const Model::AcknowledgeJobRequest& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about a specified job and whether that job has been
+         * received by the job worker. Only used for custom actions.</p>
+         *
+         * Returns an awaitable that starts the operation the way AcknowledgeJobAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AcknowledgeJobRequest>
+        Aws::Utils::Threading::Awaitable<Model::AcknowledgeJobOutcome> AcknowledgeJobAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AcknowledgeJobOutcome>([this, request](const std::function<void(Model::AcknowledgeJobOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AcknowledgeJobAsync(request, [complete](const CodePipelineClient*, const Model::AcknowledgeJobRequest&, const Model::AcknowledgeJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AcknowledgeJobOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Confirms a job worker has received the specified job. Only used for partner
          * actions.</p>
@@ -320,6 +343,28 @@ namespace Model
          */
         virtual void AcknowledgeThirdPartyJobAsync(const Model::AcknowledgeThirdPartyJobRequest& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Confirms a job worker has received the specified job. Only used for partner
+         * actions.</p>
+         *
+         * Returns an awaitable that starts the operation the way AcknowledgeThirdPartyJobAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AcknowledgeThirdPartyJobRequest>
+        Aws::Utils::Threading::Awaitable<Model::AcknowledgeThirdPartyJobOutcome> AcknowledgeThirdPartyJobAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AcknowledgeThirdPartyJobOutcome>([this, request](const std::function<void(Model::AcknowledgeThirdPartyJobOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AcknowledgeThirdPartyJobAsync(request, [complete](const CodePipelineClient*, const Model::AcknowledgeThirdPartyJobRequest&, const Model::AcknowledgeThirdPartyJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AcknowledgeThirdPartyJobOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new custom action that can be used in all pipelines associated with
          * the AWS account. Only used for custom actions.</p>
@@ -342,6 +387,28 @@ namespace Model
          */
         virtual void CreateCustomActionTypeAsync(const Model::CreateCustomActionTypeRequest& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new custom action that can be used in all pipelines associated with
+         * the AWS account. Only used for custom actions.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateCustomActionTypeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateCustomActionTypeRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateCustomActionTypeOutcome> CreateCustomActionTypeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateCustomActionTypeOutcome>([this, request](const std::function<void(Model::CreateCustomActionTypeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateCustomActionTypeAsync(request, [complete](const CodePipelineClient*, const Model::CreateCustomActionTypeRequest&, const Model::CreateCustomActionTypeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateCustomActionTypeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a pipeline.</p>
          */
@@ -361,6 +428,27 @@ namespace Model
          */
         virtual void CreatePipelineAsync(const Model::CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a pipeline.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePipelineOutcome> CreatePipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePipelineOutcome>([this, request](const std::function<void(Model::CreatePipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePipelineAsync(request, [complete](const CodePipelineClient*, const Model::CreatePipelineRequest&, const Model::CreatePipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Marks a custom action as deleted. PollForJobs for the custom action will fail
          * after the action is marked for deletion. Only used for custom actions.</p>
@@ -389,6 +477,30 @@ namespace Model
          */
         virtual void DeleteCustomActionTypeAsync(const Model::DeleteCustomActionTypeRequest& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Marks a custom action as deleted. PollForJobs for the custom action will fail
+         * after the action is marked for deletion. Only used for custom actions.</p>
+         * <important><p>You cannot recreate a custom action after it has been deleted
+         * unless you increase the version number of the action.</p></important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteCustomActionTypeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteCustomActionTypeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteCustomActionTypeOutcome> DeleteCustomActionTypeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteCustomActionTypeOutcome>([this, request](const std::function<void(Model::DeleteCustomActionTypeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteCustomActionTypeAsync(request, [complete](const CodePipelineClient*, const Model::DeleteCustomActionTypeRequest&, const Model::DeleteCustomActionTypeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteCustomActionTypeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified pipeline.</p>
          */
@@ -408,6 +520,27 @@ namespace Model
          */
         virtual void DeletePipelineAsync(const Model::DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified pipeline.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeletePipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeletePipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeletePipelineOutcome> DeletePipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeletePipelineOutcome>([this, request](const std::function<void(Model::DeletePipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeletePipelineAsync(request, [complete](const CodePipelineClient*, const Model::DeletePipelineRequest&, const Model::DeletePipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeletePipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Prevents artifacts in a pipeline from transitioning to the next stage in the
          * pipeline. </p>
@@ -430,6 +563,28 @@ namespace Model
          */
         virtual void DisableStageTransitionAsync(const Model::DisableStageTransitionRequest& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Prevents artifacts in a pipeline from transitioning to the next stage in the
+         * pipeline. </p>
+         *
+         * Returns an awaitable that starts the operation the way DisableStageTransitionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableStageTransitionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableStageTransitionOutcome> DisableStageTransitionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableStageTransitionOutcome>([this, request](const std::function<void(Model::DisableStageTransitionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableStageTransitionAsync(request, [complete](const CodePipelineClient*, const Model::DisableStageTransitionRequest&, const Model::DisableStageTransitionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableStageTransitionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables artifacts in a pipeline to transition to a stage in a pipeline.</p>
          */
@@ -449,6 +604,27 @@ namespace Model
          */
         virtual void EnableStageTransitionAsync(const Model::EnableStageTransitionRequest& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables artifacts in a pipeline to transition to a stage in a pipeline.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableStageTransitionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableStageTransitionRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableStageTransitionOutcome> EnableStageTransitionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableStageTransitionOutcome>([this, request](const std::function<void(Model::EnableStageTransitionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableStageTransitionAsync(request, [complete](const CodePipelineClient*, const Model::EnableStageTransitionRequest&, const Model::EnableStageTransitionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableStageTransitionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about a job. Only used for custom actions.</p>
          * <important><p>When this API is called, AWS CodePipeline returns temporary
@@ -483,6 +659,32 @@ namespace Model
          */
         virtual void GetJobDetailsAsync(const Model::GetJobDetailsRequest& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about a job. Only used for custom actions.</p>
+         * <important><p>When this API is called, AWS CodePipeline returns temporary
+         * credentials for the Amazon S3 bucket used to store artifacts for the pipeline,
+         * if the action requires access to that Amazon S3 bucket for input or output
+         * artifacts. Additionally, this API returns any secret values defined for the
+         * action.</p></important>
+         *
+         * Returns an awaitable that starts the operation the way GetJobDetailsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetJobDetailsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetJobDetailsOutcome> GetJobDetailsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetJobDetailsOutcome>([this, request](const std::function<void(Model::GetJobDetailsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetJobDetailsAsync(request, [complete](const CodePipelineClient*, const Model::GetJobDetailsRequest&, const Model::GetJobDetailsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetJobDetailsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the metadata, structure, stages, and actions of a pipeline. Can be
          * used to return the entire structure of a pipeline in JSON format, which can then
@@ -511,6 +713,30 @@ namespace Model
          */
         virtual void GetPipelineAsync(const Model::GetPipelineRequest& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the metadata, structure, stages, and actions of a pipeline. Can be
+         * used to return the entire structure of a pipeline in JSON format, which can then
+         * be modified and used to update the pipeline structure with
+         * <a>UpdatePipeline</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetPipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetPipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetPipelineOutcome> GetPipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetPipelineOutcome>([this, request](const std::function<void(Model::GetPipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetPipelineAsync(request, [complete](const CodePipelineClient*, const Model::GetPipelineRequest&, const Model::GetPipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetPipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the state of a pipeline, including the stages,
          * actions, and details about the last run of the pipeline.</p>
@@ -533,6 +759,28 @@ namespace Model
          */
         virtual void GetPipelineStateAsync(const Model::GetPipelineStateRequest& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the state of a pipeline, including the stages,
+         * actions, and details about the last run of the pipeline.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetPipelineStateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetPipelineStateRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetPipelineStateOutcome> GetPipelineStateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetPipelineStateOutcome>([this, request](const std::function<void(Model::GetPipelineStateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetPipelineStateAsync(request, [complete](const CodePipelineClient*, const Model::GetPipelineStateRequest&, const Model::GetPipelineStateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetPipelineStateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests the details of a job for a third party action. Only used for partner
          * actions.</p> <important><p>When this API is called, AWS CodePipeline returns
@@ -567,6 +815,32 @@ namespace Model
          */
         virtual void GetThirdPartyJobDetailsAsync(const Model::GetThirdPartyJobDetailsRequest& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests the details of a job for a third party action. Only used for partner
+         * actions.</p> <important><p>When this API is called, AWS CodePipeline returns
+         * temporary credentials for the Amazon S3 bucket used to store artifacts for the
+         * pipeline, if the action requires access to that Amazon S3 bucket for input or
+         * output artifacts. Additionally, this API returns any secret values defined for
+         * the action.</p></important>
+         *
+         * Returns an awaitable that starts the operation the way GetThirdPartyJobDetailsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetThirdPartyJobDetailsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetThirdPartyJobDetailsOutcome> GetThirdPartyJobDetailsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetThirdPartyJobDetailsOutcome>([this, request](const std::function<void(Model::GetThirdPartyJobDetailsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetThirdPartyJobDetailsAsync(request, [complete](const CodePipelineClient*, const Model::GetThirdPartyJobDetailsRequest&, const Model::GetThirdPartyJobDetailsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetThirdPartyJobDetailsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets a summary of all AWS CodePipeline action types associated with your
          * account.</p>
@@ -589,6 +863,28 @@ namespace Model
          */
         virtual void ListActionTypesAsync(const Model::ListActionTypesRequest& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets a summary of all AWS CodePipeline action types associated with your
+         * account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListActionTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListActionTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListActionTypesOutcome> ListActionTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListActionTypesOutcome>([this, request](const std::function<void(Model::ListActionTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListActionTypesAsync(request, [complete](const CodePipelineClient*, const Model::ListActionTypesRequest&, const Model::ListActionTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListActionTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets a summary of all of the pipelines associated with your account.</p>
          */
@@ -608,6 +904,27 @@ namespace Model
          */
         virtual void ListPipelinesAsync(const Model::ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets a summary of all of the pipelines associated with your account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListPipelinesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPipelinesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPipelinesOutcome> ListPipelinesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPipelinesOutcome>([this, request](const std::function<void(Model::ListPipelinesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPipelinesAsync(request, [complete](const CodePipelineClient*, const Model::ListPipelinesRequest&, const Model::ListPipelinesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPipelinesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about any jobs for AWS CodePipeline to act upon.</p>
          * <important><p>When this API is called, AWS CodePipeline returns temporary
@@ -642,6 +959,32 @@ namespace Model
          */
         virtual void PollForJobsAsync(const Model::PollForJobsRequest& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about any jobs for AWS CodePipeline to act upon.</p>
+         * <important><p>When this API is called, AWS CodePipeline returns temporary
+         * credentials for the Amazon S3 bucket used to store artifacts for the pipeline,
+         * if the action requires access to that Amazon S3 bucket for input or output
+         * artifacts. Additionally, this API returns any secret values defined for the
+         * action.</p></important>
+         *
+         * Returns an awaitable that starts the operation the way PollForJobsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PollForJobsRequest>
+        Aws::Utils::Threading::Awaitable<Model::PollForJobsOutcome> PollForJobsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PollForJobsOutcome>([this, request](const std::function<void(Model::PollForJobsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PollForJobsAsync(request, [complete](const CodePipelineClient*, const Model::PollForJobsRequest&, const Model::PollForJobsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PollForJobsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Determines whether there are any third party jobs for a job worker to act on.
          * Only used for partner actions.</p> <important><p>When this API is called, AWS
@@ -673,6 +1016,31 @@ namespace Model
          */
         virtual void PollForThirdPartyJobsAsync(const Model::PollForThirdPartyJobsRequest& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Determines whether there are any third party jobs for a job worker to act on.
+         * Only used for partner actions.</p> <important><p>When this API is called, AWS
+         * CodePipeline returns temporary credentials for the Amazon S3 bucket used to
+         * store artifacts for the pipeline, if the action requires access to that Amazon
+         * S3 bucket for input or output artifacts.</p></important>
+         *
+         * Returns an awaitable that starts the operation the way PollForThirdPartyJobsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PollForThirdPartyJobsRequest>
+        Aws::Utils::Threading::Awaitable<Model::PollForThirdPartyJobsOutcome> PollForThirdPartyJobsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PollForThirdPartyJobsOutcome>([this, request](const std::function<void(Model::PollForThirdPartyJobsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PollForThirdPartyJobsAsync(request, [complete](const CodePipelineClient*, const Model::PollForThirdPartyJobsRequest&, const Model::PollForThirdPartyJobsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PollForThirdPartyJobsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides information to AWS CodePipeline about new revisions to a source.</p>
          */
@@ -692,6 +1060,27 @@ namespace Model
          */
         virtual void PutActionRevisionAsync(const Model::PutActionRevisionRequest& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides information to AWS CodePipeline about new revisions to a source.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutActionRevisionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutActionRevisionRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutActionRevisionOutcome> PutActionRevisionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutActionRevisionOutcome>([this, request](const std::function<void(Model::PutActionRevisionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutActionRevisionAsync(request, [complete](const CodePipelineClient*, const Model::PutActionRevisionRequest&, const Model::PutActionRevisionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutActionRevisionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents the failure of a job as returned to the pipeline by a job worker.
          * Only used for custom actions.</p>
@@ -714,6 +1103,28 @@ namespace Model
          */
         virtual void PutJobFailureResultAsync(const Model::PutJobFailureResultRequest& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents the failure of a job as returned to the pipeline by a job worker.
+         * Only used for custom actions.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutJobFailureResultAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutJobFailureResultRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutJobFailureResultOutcome> PutJobFailureResultAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutJobFailureResultOutcome>([this, request](const std::function<void(Model::PutJobFailureResultOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutJobFailureResultAsync(request, [complete](const CodePipelineClient*, const Model::PutJobFailureResultRequest&, const Model::PutJobFailureResultOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutJobFailureResultOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents the success of a job as returned to the pipeline by a job worker.
          * Only used for custom actions.</p>
@@ -736,6 +1147,28 @@ namespace Model
          */
         virtual void PutJobSuccessResultAsync(const Model::PutJobSuccessResultRequest& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents the success of a job as returned to the pipeline by a job worker.
+         * Only used for custom actions.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutJobSuccessResultAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutJobSuccessResultRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutJobSuccessResultOutcome> PutJobSuccessResultAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutJobSuccessResultOutcome>([this, request](const std::function<void(Model::PutJobSuccessResultOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutJobSuccessResultAsync(request, [complete](const CodePipelineClient*, const Model::PutJobSuccessResultRequest&, const Model::PutJobSuccessResultOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutJobSuccessResultOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents the failure of a third party job as returned to the pipeline by a
          * job worker. Only used for partner actions.</p>
@@ -758,6 +1191,28 @@ namespace Model
          */
         virtual void PutThirdPartyJobFailureResultAsync(const Model::PutThirdPartyJobFailureResultRequest& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents the failure of a third party job as returned to the pipeline by a
+         * job worker. Only used for partner actions.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutThirdPartyJobFailureResultAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutThirdPartyJobFailureResultRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutThirdPartyJobFailureResultOutcome> PutThirdPartyJobFailureResultAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutThirdPartyJobFailureResultOutcome>([this, request](const std::function<void(Model::PutThirdPartyJobFailureResultOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutThirdPartyJobFailureResultAsync(request, [complete](const CodePipelineClient*, const Model::PutThirdPartyJobFailureResultRequest&, const Model::PutThirdPartyJobFailureResultOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutThirdPartyJobFailureResultOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Represents the success of a third party job as returned to the pipeline by a
          * job worker. Only used for partner actions.</p>
@@ -780,6 +1235,28 @@ namespace Model
          */
         virtual void PutThirdPartyJobSuccessResultAsync(const Model::PutThirdPartyJobSuccessResultRequest& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Represents the success of a third party job as returned to the pipeline by a
+         * job worker. Only used for partner actions.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutThirdPartyJobSuccessResultAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutThirdPartyJobSuccessResultRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutThirdPartyJobSuccessResultOutcome> PutThirdPartyJobSuccessResultAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutThirdPartyJobSuccessResultOutcome>([this, request](const std::function<void(Model::PutThirdPartyJobSuccessResultOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutThirdPartyJobSuccessResultAsync(request, [complete](const CodePipelineClient*, const Model::PutThirdPartyJobSuccessResultRequest&, const Model::PutThirdPartyJobSuccessResultOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutThirdPartyJobSuccessResultOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts the specified pipeline. Specifically, it begins processing the latest
          * commit to the source location specified as part of the pipeline.</p>
@@ -802,6 +1279,28 @@ namespace Model
          */
         virtual void StartPipelineExecutionAsync(const Model::StartPipelineExecutionRequest& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts the specified pipeline. Specifically, it begins processing the latest
+         * commit to the source location specified as part of the pipeline.</p>
+         *
+         * Returns an awaitable that starts the operation the way StartPipelineExecutionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartPipelineExecutionRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartPipelineExecutionOutcome> StartPipelineExecutionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartPipelineExecutionOutcome>([this, request](const std::function<void(Model::StartPipelineExecutionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartPipelineExecutionAsync(request, [complete](const CodePipelineClient*, const Model::StartPipelineExecutionRequest&, const Model::StartPipelineExecutionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartPipelineExecutionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a specified pipeline with edits or changes to its structure. Use a
          * JSON file with the pipeline structure in conjunction with UpdatePipeline to
@@ -830,6 +1329,30 @@ namespace Model
          */
         virtual void UpdatePipelineAsync(const Model::UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a specified pipeline with edits or changes to its structure. Use a
+         * JSON file with the pipeline structure in conjunction with UpdatePipeline to
+         * provide the full structure of the pipeline. Updating the pipeline increases the
+         * version number of the pipeline by 1.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdatePipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdatePipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdatePipelineOutcome> UpdatePipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdatePipelineOutcome>([this, request](const std::function<void(Model::UpdatePipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdatePipelineAsync(request, [complete](const CodePipelineClient*, const Model::UpdatePipelineRequest&, const Model::UpdatePipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdatePipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
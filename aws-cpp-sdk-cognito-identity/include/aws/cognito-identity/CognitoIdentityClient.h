@@ -36,6 +36,7 @@
 #include <aws/cognito-identity/model/UpdateIdentityPoolResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -259,6 +260,34 @@ namespace Model
          */
         virtual void CreateIdentityPoolAsync(const Model::CreateIdentityPoolRequest& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new identity pool. The identity pool is a store of user identity
+         * information that is specific to your AWS account. The limit on identity pools is
+         * 60 per account. The keys for <code>SupportedLoginProviders</code> are as
+         * follows: <ul> <li>Facebook: <code>graph.facebook.com</code> </li> <li>Google:
+         * <code>accounts.google.com</code> </li> <li>Amazon: <code>www.amazon.com</code>
+         * </li> <li>Twitter: <code>api.twitter.com</code> </li> <li>Digits:
+         * <code>www.digits.com</code> </li> </ul> You must use AWS Developer credentials
+         * to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateIdentityPoolAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateIdentityPoolRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateIdentityPoolOutcome> CreateIdentityPoolAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateIdentityPoolOutcome>([this, request](const std::function<void(Model::CreateIdentityPoolOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateIdentityPoolAsync(request, [complete](const CognitoIdentityClient*, const Model::CreateIdentityPoolRequest&, const Model::CreateIdentityPoolOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateIdentityPoolOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes identities from an identity pool. You can specify a list of 1-60
          * identities that you want to delete.</p> <p>You must use AWS Developer
@@ -284,6 +313,29 @@ namespace Model
          */
         virtual void DeleteIdentitiesAsync(const Model::DeleteIdentitiesRequest& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes identities from an identity pool. You can specify a list of 1-60
+         * identities that you want to delete.</p> <p>You must use AWS Developer
+         * credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteIdentitiesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteIdentitiesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteIdentitiesOutcome> DeleteIdentitiesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteIdentitiesOutcome>([this, request](const std::function<void(Model::DeleteIdentitiesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteIdentitiesAsync(request, [complete](const CognitoIdentityClient*, const Model::DeleteIdentitiesRequest&, const Model::DeleteIdentitiesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteIdentitiesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a user pool. Once a pool is deleted, users will not be able to
          * authenticate with the pool.</p> <p>You must use AWS Developer credentials to
@@ -309,6 +361,29 @@ namespace Model
          */
         virtual void DeleteIdentityPoolAsync(const Model::DeleteIdentityPoolRequest& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a user pool. Once a pool is deleted, users will not be able to
+         * authenticate with the pool.</p> <p>You must use AWS Developer credentials to
+         * call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteIdentityPoolAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteIdentityPoolRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteIdentityPoolOutcome> DeleteIdentityPoolAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteIdentityPoolOutcome>([this, request](const std::function<void(Model::DeleteIdentityPoolOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteIdentityPoolAsync(request, [complete](const CognitoIdentityClient*, const Model::DeleteIdentityPoolRequest&, const Model::DeleteIdentityPoolOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteIdentityPoolOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns metadata related to the given identity, including when the identity
          * was created and any associated linked logins.</p> <p>You must use AWS Developer
@@ -334,6 +409,29 @@ namespace Model
          */
         virtual void DescribeIdentityAsync(const Model::DescribeIdentityRequest& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns metadata related to the given identity, including when the identity
+         * was created and any associated linked logins.</p> <p>You must use AWS Developer
+         * credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeIdentityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeIdentityRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeIdentityOutcome> DescribeIdentityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeIdentityOutcome>([this, request](const std::function<void(Model::DescribeIdentityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeIdentityAsync(request, [complete](const CognitoIdentityClient*, const Model::DescribeIdentityRequest&, const Model::DescribeIdentityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeIdentityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets details about a particular identity pool, including the pool name, ID
          * description, creation date, and current number of users.</p> <p>You must use AWS
@@ -359,6 +457,29 @@ namespace Model
          */
         virtual void DescribeIdentityPoolAsync(const Model::DescribeIdentityPoolRequest& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets details about a particular identity pool, including the pool name, ID
+         * description, creation date, and current number of users.</p> <p>You must use AWS
+         * Developer credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeIdentityPoolAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeIdentityPoolRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeIdentityPoolOutcome> DescribeIdentityPoolAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeIdentityPoolOutcome>([this, request](const std::function<void(Model::DescribeIdentityPoolOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeIdentityPoolAsync(request, [complete](const CognitoIdentityClient*, const Model::DescribeIdentityPoolRequest&, const Model::DescribeIdentityPoolOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeIdentityPoolOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns credentials for the provided identity ID. Any provided logins will be
          * validated against supported login providers. If the token is for
@@ -390,6 +511,31 @@ namespace Model
          */
         virtual void GetCredentialsForIdentityAsync(const Model::GetCredentialsForIdentityRequest& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns credentials for the provided identity ID. Any provided logins will be
+         * validated against supported login providers. If the token is for
+         * cognito-identity.amazonaws.com, it will be passed through to AWS Security Token
+         * Service with the appropriate role for the token.</p> <p>This is a public API.
+         * You do not need any credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetCredentialsForIdentityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetCredentialsForIdentityRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetCredentialsForIdentityOutcome> GetCredentialsForIdentityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetCredentialsForIdentityOutcome>([this, request](const std::function<void(Model::GetCredentialsForIdentityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetCredentialsForIdentityAsync(request, [complete](const CognitoIdentityClient*, const Model::GetCredentialsForIdentityRequest&, const Model::GetCredentialsForIdentityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetCredentialsForIdentityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Generates (or retrieves) a Cognito ID. Supplying multiple logins will create
          * an implicit linked account.</p> <p>This is a public API. You do not need any
@@ -415,6 +561,29 @@ namespace Model
          */
         virtual void GetIdAsync(const Model::GetIdRequest& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Generates (or retrieves) a Cognito ID. Supplying multiple logins will create
+         * an implicit linked account.</p> <p>This is a public API. You do not need any
+         * credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIdAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIdRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIdOutcome> GetIdAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIdOutcome>([this, request](const std::function<void(Model::GetIdOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIdAsync(request, [complete](const CognitoIdentityClient*, const Model::GetIdRequest&, const Model::GetIdOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIdOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the roles for an identity pool.</p> <p>You must use AWS Developer
          * credentials to call this API.</p>
@@ -437,6 +606,28 @@ namespace Model
          */
         virtual void GetIdentityPoolRolesAsync(const Model::GetIdentityPoolRolesRequest& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the roles for an identity pool.</p> <p>You must use AWS Developer
+         * credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIdentityPoolRolesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIdentityPoolRolesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIdentityPoolRolesOutcome> GetIdentityPoolRolesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIdentityPoolRolesOutcome>([this, request](const std::function<void(Model::GetIdentityPoolRolesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIdentityPoolRolesAsync(request, [complete](const CognitoIdentityClient*, const Model::GetIdentityPoolRolesRequest&, const Model::GetIdentityPoolRolesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIdentityPoolRolesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets an OpenID token, using a known Cognito ID. This known Cognito ID is
          * returned by <a>GetId</a>. You can optionally add additional logins for the
@@ -468,6 +659,31 @@ namespace Model
          */
         virtual void GetOpenIdTokenAsync(const Model::GetOpenIdTokenRequest& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets an OpenID token, using a known Cognito ID. This known Cognito ID is
+         * returned by <a>GetId</a>. You can optionally add additional logins for the
+         * identity. Supplying multiple logins creates an implicit link.</p> <p>The OpenId
+         * token is valid for 15 minutes.</p> <p>This is a public API. You do not need any
+         * credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetOpenIdTokenAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetOpenIdTokenRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetOpenIdTokenOutcome> GetOpenIdTokenAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetOpenIdTokenOutcome>([this, request](const std::function<void(Model::GetOpenIdTokenOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetOpenIdTokenAsync(request, [complete](const CognitoIdentityClient*, const Model::GetOpenIdTokenRequest&, const Model::GetOpenIdTokenOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetOpenIdTokenOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers (or retrieves) a Cognito <code>IdentityId</code> and an OpenID
          * Connect token for a user authenticated by your backend authentication process.
@@ -526,6 +742,40 @@ namespace Model
          */
         virtual void GetOpenIdTokenForDeveloperIdentityAsync(const Model::GetOpenIdTokenForDeveloperIdentityRequest& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers (or retrieves) a Cognito <code>IdentityId</code> and an OpenID
+         * Connect token for a user authenticated by your backend authentication process.
+         * Supplying multiple logins will create an implicit linked account. You can only
+         * specify one developer provider as part of the <code>Logins</code> map, which is
+         * linked to the identity pool. The developer provider is the "domain" by which
+         * Cognito will refer to your users.</p> <p>You can use
+         * <code>GetOpenIdTokenForDeveloperIdentity</code> to create a new identity and to
+         * link new logins (that is, user credentials issued by a public provider or
+         * developer provider) to an existing identity. When you want to create a new
+         * identity, the <code>IdentityId</code> should be null. When you want to associate
+         * a new login with an existing authenticated/unauthenticated identity, you can do
+         * so by providing the existing <code>IdentityId</code>. This API will create the
+         * identity in the specified <code>IdentityPoolId</code>.</p> <p>You must use AWS
+         * Developer credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetOpenIdTokenForDeveloperIdentityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetOpenIdTokenForDeveloperIdentityRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetOpenIdTokenForDeveloperIdentityOutcome> GetOpenIdTokenForDeveloperIdentityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetOpenIdTokenForDeveloperIdentityOutcome>([this, request](const std::function<void(Model::GetOpenIdTokenForDeveloperIdentityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetOpenIdTokenForDeveloperIdentityAsync(request, [complete](const CognitoIdentityClient*, const Model::GetOpenIdTokenForDeveloperIdentityRequest&, const Model::GetOpenIdTokenForDeveloperIdentityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetOpenIdTokenForDeveloperIdentityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the identities in a pool.</p> <p>You must use AWS Developer credentials
          * to call this API.</p>
@@ -548,6 +798,28 @@ namespace Model
          */
         virtual void ListIdentitiesAsync(const Model::ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the identities in a pool.</p> <p>You must use AWS Developer credentials
+         * to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListIdentitiesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListIdentitiesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListIdentitiesOutcome> ListIdentitiesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListIdentitiesOutcome>([this, request](const std::function<void(Model::ListIdentitiesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListIdentitiesAsync(request, [complete](const CognitoIdentityClient*, const Model::ListIdentitiesRequest&, const Model::ListIdentitiesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListIdentitiesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all of the Cognito identity pools registered for your account.</p>
          * <p>You must use AWS Developer credentials to call this API.</p>
@@ -570,6 +842,28 @@ namespace Model
          */
         virtual void ListIdentityPoolsAsync(const Model::ListIdentityPoolsRequest& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all of the Cognito identity pools registered for your account.</p>
+         * <p>You must use AWS Developer credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListIdentityPoolsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListIdentityPoolsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListIdentityPoolsOutcome> ListIdentityPoolsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListIdentityPoolsOutcome>([this, request](const std::function<void(Model::ListIdentityPoolsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListIdentityPoolsAsync(request, [complete](const CognitoIdentityClient*, const Model::ListIdentityPoolsRequest&, const Model::ListIdentityPoolsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListIdentityPoolsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the <code>IdentityID</code> associated with a
          * <code>DeveloperUserIdentifier</code> or the list of
@@ -619,6 +913,37 @@ namespace Model
          */
         virtual void LookupDeveloperIdentityAsync(const Model::LookupDeveloperIdentityRequest& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the <code>IdentityID</code> associated with a
+         * <code>DeveloperUserIdentifier</code> or the list of
+         * <code>DeveloperUserIdentifier</code>s associated with an <code>IdentityId</code>
+         * for an existing identity. Either <code>IdentityID</code> or
+         * <code>DeveloperUserIdentifier</code> must not be null. If you supply only one of
+         * these values, the other value will be searched in the database and returned as a
+         * part of the response. If you supply both, <code>DeveloperUserIdentifier</code>
+         * will be matched against <code>IdentityID</code>. If the values are verified
+         * against the database, the response returns both values and is the same as the
+         * request. Otherwise a <code>ResourceConflictException</code> is thrown.</p>
+         * <p>You must use AWS Developer credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way LookupDeveloperIdentityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::LookupDeveloperIdentityRequest>
+        Aws::Utils::Threading::Awaitable<Model::LookupDeveloperIdentityOutcome> LookupDeveloperIdentityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::LookupDeveloperIdentityOutcome>([this, request](const std::function<void(Model::LookupDeveloperIdentityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->LookupDeveloperIdentityAsync(request, [complete](const CognitoIdentityClient*, const Model::LookupDeveloperIdentityRequest&, const Model::LookupDeveloperIdentityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::LookupDeveloperIdentityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Merges two users having different <code>IdentityId</code>s, existing in the
          * same identity pool, and identified by the same developer provider. You can use
@@ -662,6 +987,35 @@ namespace Model
          */
         virtual void MergeDeveloperIdentitiesAsync(const Model::MergeDeveloperIdentitiesRequest& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Merges two users having different <code>IdentityId</code>s, existing in the
+         * same identity pool, and identified by the same developer provider. You can use
+         * this action to request that discrete users be merged and identified as a single
+         * user in the Cognito environment. Cognito associates the given source user
+         * (<code>SourceUserIdentifier</code>) with the <code>IdentityId</code> of the
+         * <code>DestinationUserIdentifier</code>. Only developer-authenticated users can
+         * be merged. If the users to be merged are associated with the same public
+         * provider, but as two different users, an exception will be thrown.</p> <p>You
+         * must use AWS Developer credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way MergeDeveloperIdentitiesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::MergeDeveloperIdentitiesRequest>
+        Aws::Utils::Threading::Awaitable<Model::MergeDeveloperIdentitiesOutcome> MergeDeveloperIdentitiesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::MergeDeveloperIdentitiesOutcome>([this, request](const std::function<void(Model::MergeDeveloperIdentitiesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->MergeDeveloperIdentitiesAsync(request, [complete](const CognitoIdentityClient*, const Model::MergeDeveloperIdentitiesRequest&, const Model::MergeDeveloperIdentitiesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::MergeDeveloperIdentitiesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the roles for an identity pool. These roles are used when making calls
          * to <code>GetCredentialsForIdentity</code> action.</p> <p>You must use AWS
@@ -687,6 +1041,29 @@ namespace Model
          */
         virtual void SetIdentityPoolRolesAsync(const Model::SetIdentityPoolRolesRequest& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the roles for an identity pool. These roles are used when making calls
+         * to <code>GetCredentialsForIdentity</code> action.</p> <p>You must use AWS
+         * Developer credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetIdentityPoolRolesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetIdentityPoolRolesRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetIdentityPoolRolesOutcome> SetIdentityPoolRolesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetIdentityPoolRolesOutcome>([this, request](const std::function<void(Model::SetIdentityPoolRolesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetIdentityPoolRolesAsync(request, [complete](const CognitoIdentityClient*, const Model::SetIdentityPoolRolesRequest&, const Model::SetIdentityPoolRolesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetIdentityPoolRolesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Unlinks a <code>DeveloperUserIdentifier</code> from an existing identity.
          * Unlinked developer users will be considered new identities next time they are
@@ -721,6 +1098,32 @@ namespace Model
          */
         virtual void UnlinkDeveloperIdentityAsync(const Model::UnlinkDeveloperIdentityRequest& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Unlinks a <code>DeveloperUserIdentifier</code> from an existing identity.
+         * Unlinked developer users will be considered new identities next time they are
+         * seen. If, for a given Cognito identity, you remove all federated identities as
+         * well as the developer user identifier, the Cognito identity becomes
+         * inaccessible.</p> <p>You must use AWS Developer credentials to call this
+         * API.</p>
+         *
+         * Returns an awaitable that starts the operation the way UnlinkDeveloperIdentityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UnlinkDeveloperIdentityRequest>
+        Aws::Utils::Threading::Awaitable<Model::UnlinkDeveloperIdentityOutcome> UnlinkDeveloperIdentityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UnlinkDeveloperIdentityOutcome>([this, request](const std::function<void(Model::UnlinkDeveloperIdentityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UnlinkDeveloperIdentityAsync(request, [complete](const CognitoIdentityClient*, const Model::UnlinkDeveloperIdentityRequest&, const Model::UnlinkDeveloperIdentityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UnlinkDeveloperIdentityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Unlinks a federated identity from an existing account. Unlinked logins will
          * be considered new identities next time they are seen. Removing the last linked
@@ -749,6 +1152,30 @@ namespace Model
          */
         virtual void UnlinkIdentityAsync(const Model::UnlinkIdentityRequest& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Unlinks a federated identity from an existing account. Unlinked logins will
+         * be considered new identities next time they are seen. Removing the last linked
+         * login will make this identity inaccessible.</p> <p>This is a public API. You do
+         * not need any credentials to call this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way UnlinkIdentityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UnlinkIdentityRequest>
+        Aws::Utils::Threading::Awaitable<Model::UnlinkIdentityOutcome> UnlinkIdentityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UnlinkIdentityOutcome>([this, request](const std::function<void(Model::UnlinkIdentityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UnlinkIdentityAsync(request, [complete](const CognitoIdentityClient*, const Model::UnlinkIdentityRequest&, const Model::UnlinkIdentityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UnlinkIdentityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a user pool.</p> <p>You must use AWS Developer credentials to call
          * this API.</p>
@@ -771,6 +1198,28 @@ namespace Model
          */
         virtual void UpdateIdentityPoolAsync(const Model::UpdateIdentityPoolRequest& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a user pool.</p> <p>You must use AWS Developer credentials to call
+         * this API.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateIdentityPoolAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateIdentityPoolRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateIdentityPoolOutcome> UpdateIdentityPoolAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateIdentityPoolOutcome>([this, request](const std::function<void(Model::UpdateIdentityPoolOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateIdentityPoolAsync(request, [complete](const CognitoIdentityClient*, const Model::UpdateIdentityPoolRequest&, const Model::UpdateIdentityPoolOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateIdentityPoolOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
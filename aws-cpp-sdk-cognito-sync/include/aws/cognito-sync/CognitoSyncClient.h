@@ -38,6 +38,7 @@
 #include <aws/cognito-sync/model/UpdateRecordsResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -240,6 +241,32 @@ namespace Model
          */
         virtual void BulkPublishAsync(const Model::BulkPublishRequest& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Initiates a bulk publish of all existing datasets for an Identity Pool to the
+         * configured stream. Customers are limited to one successful bulk publish per 24
+         * hours. Bulk publish is an asynchronous request, customers can see the status of
+         * the request via the GetBulkPublishDetails operation.</p> <p>This API can only be
+         * called with developer credentials. You cannot call this API with the temporary
+         * user credentials provided by Cognito Identity.</p>
+         *
+         * Returns an awaitable that starts the operation the way BulkPublishAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BulkPublishRequest>
+        Aws::Utils::Threading::Awaitable<Model::BulkPublishOutcome> BulkPublishAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BulkPublishOutcome>([this, request](const std::function<void(Model::BulkPublishOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BulkPublishAsync(request, [complete](const CognitoSyncClient*, const Model::BulkPublishRequest&, const Model::BulkPublishOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BulkPublishOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specific dataset. The dataset will be deleted permanently, and
          * the action can't be undone. Datasets that this dataset was merged with will no
@@ -271,6 +298,31 @@ namespace Model
          */
         virtual void DeleteDatasetAsync(const Model::DeleteDatasetRequest& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specific dataset. The dataset will be deleted permanently, and
+         * the action can't be undone. Datasets that this dataset was merged with will no
+         * longer report the merge. Any subsequent operation on this dataset will result in
+         * a ResourceNotFoundException.</p> <p>This API can be called with temporary user
+         * credentials provided by Cognito Identity or with developer credentials.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDatasetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDatasetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDatasetOutcome> DeleteDatasetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDatasetOutcome>([this, request](const std::function<void(Model::DeleteDatasetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDatasetAsync(request, [complete](const CognitoSyncClient*, const Model::DeleteDatasetRequest&, const Model::DeleteDatasetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDatasetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets meta data about a dataset by identity and dataset name. With Amazon
          * Cognito Sync, each identity has access only to its own data. Thus, the
@@ -305,6 +357,32 @@ namespace Model
          */
         virtual void DescribeDatasetAsync(const Model::DescribeDatasetRequest& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets meta data about a dataset by identity and dataset name. With Amazon
+         * Cognito Sync, each identity has access only to its own data. Thus, the
+         * credentials used to make this API call need to have access to the identity
+         * data.</p> <p>This API can be called with temporary user credentials provided by
+         * Cognito Identity or with developer credentials. You should use Cognito Identity
+         * credentials to make this API call.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDatasetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDatasetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDatasetOutcome> DescribeDatasetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDatasetOutcome>([this, request](const std::function<void(Model::DescribeDatasetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDatasetAsync(request, [complete](const CognitoSyncClient*, const Model::DescribeDatasetRequest&, const Model::DescribeDatasetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDatasetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets usage details (for example, data storage) about a particular identity
          * pool.</p> <p>This API can only be called with developer credentials. You cannot
@@ -333,6 +411,30 @@ namespace Model
          */
         virtual void DescribeIdentityPoolUsageAsync(const Model::DescribeIdentityPoolUsageRequest& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets usage details (for example, data storage) about a particular identity
+         * pool.</p> <p>This API can only be called with developer credentials. You cannot
+         * call this API with the temporary user credentials provided by Cognito
+         * Identity.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeIdentityPoolUsageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeIdentityPoolUsageRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeIdentityPoolUsageOutcome> DescribeIdentityPoolUsageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeIdentityPoolUsageOutcome>([this, request](const std::function<void(Model::DescribeIdentityPoolUsageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeIdentityPoolUsageAsync(request, [complete](const CognitoSyncClient*, const Model::DescribeIdentityPoolUsageRequest&, const Model::DescribeIdentityPoolUsageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeIdentityPoolUsageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets usage information for an identity, including number of datasets and data
          * usage.</p> <p>This API can be called with temporary user credentials provided by
@@ -358,6 +460,29 @@ namespace Model
          */
         virtual void DescribeIdentityUsageAsync(const Model::DescribeIdentityUsageRequest& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets usage information for an identity, including number of datasets and data
+         * usage.</p> <p>This API can be called with temporary user credentials provided by
+         * Cognito Identity or with developer credentials.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeIdentityUsageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeIdentityUsageRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeIdentityUsageOutcome> DescribeIdentityUsageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeIdentityUsageOutcome>([this, request](const std::function<void(Model::DescribeIdentityUsageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeIdentityUsageAsync(request, [complete](const CognitoSyncClient*, const Model::DescribeIdentityUsageRequest&, const Model::DescribeIdentityUsageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeIdentityUsageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Get the status of the last BulkPublish operation for an identity pool.</p>
          * <p>This API can only be called with developer credentials. You cannot call this
@@ -383,6 +508,29 @@ namespace Model
          */
         virtual void GetBulkPublishDetailsAsync(const Model::GetBulkPublishDetailsRequest& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Get the status of the last BulkPublish operation for an identity pool.</p>
+         * <p>This API can only be called with developer credentials. You cannot call this
+         * API with the temporary user credentials provided by Cognito Identity.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetBulkPublishDetailsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBulkPublishDetailsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBulkPublishDetailsOutcome> GetBulkPublishDetailsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBulkPublishDetailsOutcome>([this, request](const std::function<void(Model::GetBulkPublishDetailsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBulkPublishDetailsAsync(request, [complete](const CognitoSyncClient*, const Model::GetBulkPublishDetailsRequest&, const Model::GetBulkPublishDetailsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBulkPublishDetailsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the events and the corresponding Lambda functions associated with an
          * identity pool.</p> <p>This API can only be called with developer credentials.
@@ -411,6 +559,30 @@ namespace Model
          */
         virtual void GetCognitoEventsAsync(const Model::GetCognitoEventsRequest& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the events and the corresponding Lambda functions associated with an
+         * identity pool.</p> <p>This API can only be called with developer credentials.
+         * You cannot call this API with the temporary user credentials provided by Cognito
+         * Identity.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetCognitoEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetCognitoEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetCognitoEventsOutcome> GetCognitoEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetCognitoEventsOutcome>([this, request](const std::function<void(Model::GetCognitoEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetCognitoEventsAsync(request, [complete](const CognitoSyncClient*, const Model::GetCognitoEventsRequest&, const Model::GetCognitoEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetCognitoEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the configuration settings of an identity pool.</p> <p>This API can only
          * be called with developer credentials. You cannot call this API with the
@@ -436,6 +608,29 @@ namespace Model
          */
         virtual void GetIdentityPoolConfigurationAsync(const Model::GetIdentityPoolConfigurationRequest& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the configuration settings of an identity pool.</p> <p>This API can only
+         * be called with developer credentials. You cannot call this API with the
+         * temporary user credentials provided by Cognito Identity.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIdentityPoolConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIdentityPoolConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIdentityPoolConfigurationOutcome> GetIdentityPoolConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIdentityPoolConfigurationOutcome>([this, request](const std::function<void(Model::GetIdentityPoolConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIdentityPoolConfigurationAsync(request, [complete](const CognitoSyncClient*, const Model::GetIdentityPoolConfigurationRequest&, const Model::GetIdentityPoolConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIdentityPoolConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists datasets for an identity. With Amazon Cognito Sync, each identity has
          * access only to its own data. Thus, the credentials used to make this API call
@@ -470,6 +665,32 @@ namespace Model
          */
         virtual void ListDatasetsAsync(const Model::ListDatasetsRequest& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists datasets for an identity. With Amazon Cognito Sync, each identity has
+         * access only to its own data. Thus, the credentials used to make this API call
+         * need to have access to the identity data.</p> <p>ListDatasets can be called with
+         * temporary user credentials provided by Cognito Identity or with developer
+         * credentials. You should use the Cognito Identity credentials to make this API
+         * call.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDatasetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDatasetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDatasetsOutcome> ListDatasetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDatasetsOutcome>([this, request](const std::function<void(Model::ListDatasetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDatasetsAsync(request, [complete](const CognitoSyncClient*, const Model::ListDatasetsRequest&, const Model::ListDatasetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDatasetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets a list of identity pools registered with Cognito.</p>
          * <p>ListIdentityPoolUsage can only be called with developer credentials. You
@@ -498,6 +719,30 @@ namespace Model
          */
         virtual void ListIdentityPoolUsageAsync(const Model::ListIdentityPoolUsageRequest& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets a list of identity pools registered with Cognito.</p>
+         * <p>ListIdentityPoolUsage can only be called with developer credentials. You
+         * cannot make this API call with the temporary user credentials provided by
+         * Cognito Identity.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListIdentityPoolUsageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListIdentityPoolUsageRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListIdentityPoolUsageOutcome> ListIdentityPoolUsageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListIdentityPoolUsageOutcome>([this, request](const std::function<void(Model::ListIdentityPoolUsageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListIdentityPoolUsageAsync(request, [complete](const CognitoSyncClient*, const Model::ListIdentityPoolUsageRequest&, const Model::ListIdentityPoolUsageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListIdentityPoolUsageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets paginated records, optionally changed after a particular sync count for
          * a dataset and identity. With Amazon Cognito Sync, each identity has access only
@@ -532,6 +777,32 @@ namespace Model
          */
         virtual void ListRecordsAsync(const Model::ListRecordsRequest& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets paginated records, optionally changed after a particular sync count for
+         * a dataset and identity. With Amazon Cognito Sync, each identity has access only
+         * to its own data. Thus, the credentials used to make this API call need to have
+         * access to the identity data.</p> <p>ListRecords can be called with temporary
+         * user credentials provided by Cognito Identity or with developer credentials. You
+         * should use Cognito Identity credentials to make this API call.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListRecordsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRecordsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRecordsOutcome> ListRecordsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRecordsOutcome>([this, request](const std::function<void(Model::ListRecordsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRecordsAsync(request, [complete](const CognitoSyncClient*, const Model::ListRecordsRequest&, const Model::ListRecordsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRecordsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers a device to receive push sync notifications.</p> <p>This API can
          * only be called with temporary credentials provided by Cognito Identity. You
@@ -557,6 +828,29 @@ namespace Model
          */
         virtual void RegisterDeviceAsync(const Model::RegisterDeviceRequest& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers a device to receive push sync notifications.</p> <p>This API can
+         * only be called with temporary credentials provided by Cognito Identity. You
+         * cannot call this API with developer credentials.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterDeviceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterDeviceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterDeviceOutcome> RegisterDeviceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterDeviceOutcome>([this, request](const std::function<void(Model::RegisterDeviceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterDeviceAsync(request, [complete](const CognitoSyncClient*, const Model::RegisterDeviceRequest&, const Model::RegisterDeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterDeviceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the AWS Lambda function for a given event type for an identity pool.
          * This request only updates the key/value pair specified. Other key/values pairs
@@ -591,6 +885,32 @@ namespace Model
          */
         virtual void SetCognitoEventsAsync(const Model::SetCognitoEventsRequest& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the AWS Lambda function for a given event type for an identity pool.
+         * This request only updates the key/value pair specified. Other key/values pairs
+         * are not updated. To remove a key value pair, pass a empty value for the
+         * particular key.</p> <p>This API can only be called with developer credentials.
+         * You cannot call this API with the temporary user credentials provided by Cognito
+         * Identity.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetCognitoEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetCognitoEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetCognitoEventsOutcome> SetCognitoEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetCognitoEventsOutcome>([this, request](const std::function<void(Model::SetCognitoEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetCognitoEventsAsync(request, [complete](const CognitoSyncClient*, const Model::SetCognitoEventsRequest&, const Model::SetCognitoEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetCognitoEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the necessary configuration for push sync.</p> <p>This API can only be
          * called with developer credentials. You cannot call this API with the temporary
@@ -616,6 +936,29 @@ namespace Model
          */
         virtual void SetIdentityPoolConfigurationAsync(const Model::SetIdentityPoolConfigurationRequest& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the necessary configuration for push sync.</p> <p>This API can only be
+         * called with developer credentials. You cannot call this API with the temporary
+         * user credentials provided by Cognito Identity.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetIdentityPoolConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetIdentityPoolConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetIdentityPoolConfigurationOutcome> SetIdentityPoolConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetIdentityPoolConfigurationOutcome>([this, request](const std::function<void(Model::SetIdentityPoolConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetIdentityPoolConfigurationAsync(request, [complete](const CognitoSyncClient*, const Model::SetIdentityPoolConfigurationRequest&, const Model::SetIdentityPoolConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetIdentityPoolConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Subscribes to receive notifications when a dataset is modified by another
          * device.</p> <p>This API can only be called with temporary credentials provided
@@ -641,6 +984,29 @@ namespace Model
          */
         virtual void SubscribeToDatasetAsync(const Model::SubscribeToDatasetRequest& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Subscribes to receive notifications when a dataset is modified by another
+         * device.</p> <p>This API can only be called with temporary credentials provided
+         * by Cognito Identity. You cannot call this API with developer credentials.</p>
+         *
+         * Returns an awaitable that starts the operation the way SubscribeToDatasetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SubscribeToDatasetRequest>
+        Aws::Utils::Threading::Awaitable<Model::SubscribeToDatasetOutcome> SubscribeToDatasetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SubscribeToDatasetOutcome>([this, request](const std::function<void(Model::SubscribeToDatasetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SubscribeToDatasetAsync(request, [complete](const CognitoSyncClient*, const Model::SubscribeToDatasetRequest&, const Model::SubscribeToDatasetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SubscribeToDatasetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Unsubscribes from receiving notifications when a dataset is modified by
          * another device.</p> <p>This API can only be called with temporary credentials
@@ -669,6 +1035,30 @@ namespace Model
          */
         virtual void UnsubscribeFromDatasetAsync(const Model::UnsubscribeFromDatasetRequest& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Unsubscribes from receiving notifications when a dataset is modified by
+         * another device.</p> <p>This API can only be called with temporary credentials
+         * provided by Cognito Identity. You cannot call this API with developer
+         * credentials.</p>
+         *
+         * Returns an awaitable that starts the operation the way UnsubscribeFromDatasetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UnsubscribeFromDatasetRequest>
+        Aws::Utils::Threading::Awaitable<Model::UnsubscribeFromDatasetOutcome> UnsubscribeFromDatasetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UnsubscribeFromDatasetOutcome>([this, request](const std::function<void(Model::UnsubscribeFromDatasetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UnsubscribeFromDatasetAsync(request, [complete](const CognitoSyncClient*, const Model::UnsubscribeFromDatasetRequest&, const Model::UnsubscribeFromDatasetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UnsubscribeFromDatasetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Posts updates to records and adds and deletes records for a dataset and
          * user.</p> <p>The sync count in the record patch is your last known sync count
@@ -721,6 +1111,38 @@ namespace Model
          */
         virtual void UpdateRecordsAsync(const Model::UpdateRecordsRequest& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Posts updates to records and adds and deletes records for a dataset and
+         * user.</p> <p>The sync count in the record patch is your last known sync count
+         * for that record. The server will reject an UpdateRecords request with a
+         * ResourceConflictException if you try to patch a record with a new value but a
+         * stale sync count.</p> <p>For example, if the sync count on the server is 5 for a
+         * key called highScore and you try and submit a new highScore with sync count of
+         * 4, the request will be rejected. To obtain the current sync count for a record,
+         * call ListRecords. On a successful update of the record, the response returns the
+         * new sync count for that record. You should present that sync count the next time
+         * you try to update that same record. When the record does not exist, specify the
+         * sync count as 0.</p> <p>This API can be called with temporary user credentials
+         * provided by Cognito Identity or with developer credentials.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateRecordsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateRecordsRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateRecordsOutcome> UpdateRecordsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateRecordsOutcome>([this, request](const std::function<void(Model::UpdateRecordsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateRecordsAsync(request, [complete](const CognitoSyncClient*, const Model::UpdateRecordsRequest&, const Model::UpdateRecordsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateRecordsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
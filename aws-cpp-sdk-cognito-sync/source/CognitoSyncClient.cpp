@@ -113,7 +113,7 @@ BulkPublishOutcome CognitoSyncClient::BulkPublish(const BulkPublishRequest& requ
   ss << request.GetIdentityPoolId();
   ss << "/bulkpublish";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "BulkPublish");
   if(outcome.IsSuccess())
   {
     return BulkPublishOutcome(BulkPublishResult(outcome.GetResult()));
@@ -126,17 +126,44 @@ BulkPublishOutcome CognitoSyncClient::BulkPublish(const BulkPublishRequest& requ
 
 BulkPublishOutcomeCallable CognitoSyncClient::BulkPublishCallable(const BulkPublishRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::BulkPublish, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< BulkPublishOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->BulkPublish( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< BulkPublishOutcome > rejected;
+    rejected.set_value(BulkPublishOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::BulkPublishAsync(const BulkPublishRequest& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::BulkPublishAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::BulkPublishAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, BulkPublishOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::BulkPublishAsyncHelper(const BulkPublishRequest& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, BulkPublish(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/bulkpublish";
+
+  auto sharedRequest = Aws::MakeShared<BulkPublishRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "BulkPublish", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, BulkPublishOutcome(BulkPublishResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, BulkPublishOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteDatasetOutcome CognitoSyncClient::DeleteDataset(const DeleteDatasetRequest& request) const
@@ -149,7 +176,7 @@ DeleteDatasetOutcome CognitoSyncClient::DeleteDataset(const DeleteDatasetRequest
   ss << "/datasets/";
   ss << request.GetDatasetName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteDataset");
   if(outcome.IsSuccess())
   {
     return DeleteDatasetOutcome(DeleteDatasetResult(outcome.GetResult()));
@@ -162,17 +189,47 @@ DeleteDatasetOutcome CognitoSyncClient::DeleteDataset(const DeleteDatasetRequest
 
 DeleteDatasetOutcomeCallable CognitoSyncClient::DeleteDatasetCallable(const DeleteDatasetRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::DeleteDataset, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteDatasetOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDataset( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteDatasetOutcome > rejected;
+    rejected.set_value(DeleteDatasetOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::DeleteDatasetAsync(const DeleteDatasetRequest& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::DeleteDatasetAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::DeleteDatasetAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteDatasetOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::DeleteDatasetAsyncHelper(const DeleteDatasetRequest& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteDataset(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/identities/";
+  ss << request.GetIdentityId();
+  ss << "/datasets/";
+  ss << request.GetDatasetName();
+
+  auto sharedRequest = Aws::MakeShared<DeleteDatasetRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteDataset", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteDatasetOutcome(DeleteDatasetResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteDatasetOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeDatasetOutcome CognitoSyncClient::DescribeDataset(const DescribeDatasetRequest& request) const
@@ -185,7 +242,7 @@ DescribeDatasetOutcome CognitoSyncClient::DescribeDataset(const DescribeDatasetR
   ss << "/datasets/";
   ss << request.GetDatasetName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "DescribeDataset");
   if(outcome.IsSuccess())
   {
     return DescribeDatasetOutcome(DescribeDatasetResult(outcome.GetResult()));
@@ -198,17 +255,47 @@ DescribeDatasetOutcome CognitoSyncClient::DescribeDataset(const DescribeDatasetR
 
 DescribeDatasetOutcomeCallable CognitoSyncClient::DescribeDatasetCallable(const DescribeDatasetRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::DescribeDataset, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeDatasetOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeDataset( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeDatasetOutcome > rejected;
+    rejected.set_value(DescribeDatasetOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::DescribeDatasetAsync(const DescribeDatasetRequest& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::DescribeDatasetAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::DescribeDatasetAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeDatasetOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::DescribeDatasetAsyncHelper(const DescribeDatasetRequest& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeDataset(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/identities/";
+  ss << request.GetIdentityId();
+  ss << "/datasets/";
+  ss << request.GetDatasetName();
+
+  auto sharedRequest = Aws::MakeShared<DescribeDatasetRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "DescribeDataset", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeDatasetOutcome(DescribeDatasetResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeDatasetOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeIdentityPoolUsageOutcome CognitoSyncClient::DescribeIdentityPoolUsage(const DescribeIdentityPoolUsageRequest& request) const
@@ -217,7 +304,7 @@ DescribeIdentityPoolUsageOutcome CognitoSyncClient::DescribeIdentityPoolUsage(co
   ss << m_uri << "/identitypools/";
   ss << request.GetIdentityPoolId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "DescribeIdentityPoolUsage");
   if(outcome.IsSuccess())
   {
     return DescribeIdentityPoolUsageOutcome(DescribeIdentityPoolUsageResult(outcome.GetResult()));
@@ -230,17 +317,43 @@ DescribeIdentityPoolUsageOutcome CognitoSyncClient::DescribeIdentityPoolUsage(co
 
 DescribeIdentityPoolUsageOutcomeCallable CognitoSyncClient::DescribeIdentityPoolUsageCallable(const DescribeIdentityPoolUsageRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::DescribeIdentityPoolUsage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeIdentityPoolUsageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeIdentityPoolUsage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeIdentityPoolUsageOutcome > rejected;
+    rejected.set_value(DescribeIdentityPoolUsageOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::DescribeIdentityPoolUsageAsync(const DescribeIdentityPoolUsageRequest& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::DescribeIdentityPoolUsageAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::DescribeIdentityPoolUsageAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeIdentityPoolUsageOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::DescribeIdentityPoolUsageAsyncHelper(const DescribeIdentityPoolUsageRequest& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeIdentityPoolUsage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+
+  auto sharedRequest = Aws::MakeShared<DescribeIdentityPoolUsageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "DescribeIdentityPoolUsage", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeIdentityPoolUsageOutcome(DescribeIdentityPoolUsageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeIdentityPoolUsageOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeIdentityUsageOutcome CognitoSyncClient::DescribeIdentityUsage(const DescribeIdentityUsageRequest& request) const
@@ -251,7 +364,7 @@ DescribeIdentityUsageOutcome CognitoSyncClient::DescribeIdentityUsage(const Desc
   ss << "/identities/";
   ss << request.GetIdentityId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "DescribeIdentityUsage");
   if(outcome.IsSuccess())
   {
     return DescribeIdentityUsageOutcome(DescribeIdentityUsageResult(outcome.GetResult()));
@@ -264,17 +377,45 @@ DescribeIdentityUsageOutcome CognitoSyncClient::DescribeIdentityUsage(const Desc
 
 DescribeIdentityUsageOutcomeCallable CognitoSyncClient::DescribeIdentityUsageCallable(const DescribeIdentityUsageRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::DescribeIdentityUsage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeIdentityUsageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeIdentityUsage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeIdentityUsageOutcome > rejected;
+    rejected.set_value(DescribeIdentityUsageOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::DescribeIdentityUsageAsync(const DescribeIdentityUsageRequest& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::DescribeIdentityUsageAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::DescribeIdentityUsageAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeIdentityUsageOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::DescribeIdentityUsageAsyncHelper(const DescribeIdentityUsageRequest& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeIdentityUsage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/identities/";
+  ss << request.GetIdentityId();
+
+  auto sharedRequest = Aws::MakeShared<DescribeIdentityUsageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "DescribeIdentityUsage", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeIdentityUsageOutcome(DescribeIdentityUsageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeIdentityUsageOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBulkPublishDetailsOutcome CognitoSyncClient::GetBulkPublishDetails(const GetBulkPublishDetailsRequest& request) const
@@ -284,7 +425,7 @@ GetBulkPublishDetailsOutcome CognitoSyncClient::GetBulkPublishDetails(const GetB
   ss << request.GetIdentityPoolId();
   ss << "/getBulkPublishDetails";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "GetBulkPublishDetails");
   if(outcome.IsSuccess())
   {
     return GetBulkPublishDetailsOutcome(GetBulkPublishDetailsResult(outcome.GetResult()));
@@ -297,17 +438,44 @@ GetBulkPublishDetailsOutcome CognitoSyncClient::GetBulkPublishDetails(const GetB
 
 GetBulkPublishDetailsOutcomeCallable CognitoSyncClient::GetBulkPublishDetailsCallable(const GetBulkPublishDetailsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::GetBulkPublishDetails, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBulkPublishDetailsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBulkPublishDetails( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBulkPublishDetailsOutcome > rejected;
+    rejected.set_value(GetBulkPublishDetailsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::GetBulkPublishDetailsAsync(const GetBulkPublishDetailsRequest& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::GetBulkPublishDetailsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::GetBulkPublishDetailsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBulkPublishDetailsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::GetBulkPublishDetailsAsyncHelper(const GetBulkPublishDetailsRequest& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBulkPublishDetails(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/getBulkPublishDetails";
+
+  auto sharedRequest = Aws::MakeShared<GetBulkPublishDetailsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "GetBulkPublishDetails", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBulkPublishDetailsOutcome(GetBulkPublishDetailsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBulkPublishDetailsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetCognitoEventsOutcome CognitoSyncClient::GetCognitoEvents(const GetCognitoEventsRequest& request) const
@@ -317,7 +485,7 @@ GetCognitoEventsOutcome CognitoSyncClient::GetCognitoEvents(const GetCognitoEven
   ss << request.GetIdentityPoolId();
   ss << "/events";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetCognitoEvents");
   if(outcome.IsSuccess())
   {
     return GetCognitoEventsOutcome(GetCognitoEventsResult(outcome.GetResult()));
@@ -330,17 +498,44 @@ GetCognitoEventsOutcome CognitoSyncClient::GetCognitoEvents(const GetCognitoEven
 
 GetCognitoEventsOutcomeCallable CognitoSyncClient::GetCognitoEventsCallable(const GetCognitoEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::GetCognitoEvents, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetCognitoEventsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCognitoEvents( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetCognitoEventsOutcome > rejected;
+    rejected.set_value(GetCognitoEventsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::GetCognitoEventsAsync(const GetCognitoEventsRequest& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::GetCognitoEventsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::GetCognitoEventsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetCognitoEventsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::GetCognitoEventsAsyncHelper(const GetCognitoEventsRequest& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetCognitoEvents(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/events";
+
+  auto sharedRequest = Aws::MakeShared<GetCognitoEventsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetCognitoEvents", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCognitoEventsOutcome(GetCognitoEventsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCognitoEventsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetIdentityPoolConfigurationOutcome CognitoSyncClient::GetIdentityPoolConfiguration(const GetIdentityPoolConfigurationRequest& request) const
@@ -350,7 +545,7 @@ GetIdentityPoolConfigurationOutcome CognitoSyncClient::GetIdentityPoolConfigurat
   ss << request.GetIdentityPoolId();
   ss << "/configuration";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetIdentityPoolConfiguration");
   if(outcome.IsSuccess())
   {
     return GetIdentityPoolConfigurationOutcome(GetIdentityPoolConfigurationResult(outcome.GetResult()));
@@ -363,17 +558,44 @@ GetIdentityPoolConfigurationOutcome CognitoSyncClient::GetIdentityPoolConfigurat
 
 GetIdentityPoolConfigurationOutcomeCallable CognitoSyncClient::GetIdentityPoolConfigurationCallable(const GetIdentityPoolConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::GetIdentityPoolConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetIdentityPoolConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetIdentityPoolConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetIdentityPoolConfigurationOutcome > rejected;
+    rejected.set_value(GetIdentityPoolConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::GetIdentityPoolConfigurationAsync(const GetIdentityPoolConfigurationRequest& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::GetIdentityPoolConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::GetIdentityPoolConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetIdentityPoolConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::GetIdentityPoolConfigurationAsyncHelper(const GetIdentityPoolConfigurationRequest& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetIdentityPoolConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/configuration";
+
+  auto sharedRequest = Aws::MakeShared<GetIdentityPoolConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetIdentityPoolConfiguration", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetIdentityPoolConfigurationOutcome(GetIdentityPoolConfigurationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetIdentityPoolConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListDatasetsOutcome CognitoSyncClient::ListDatasets(const ListDatasetsRequest& request) const
@@ -385,7 +607,7 @@ ListDatasetsOutcome CognitoSyncClient::ListDatasets(const ListDatasetsRequest& r
   ss << request.GetIdentityId();
   ss << "/datasets";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListDatasets");
   if(outcome.IsSuccess())
   {
     return ListDatasetsOutcome(ListDatasetsResult(outcome.GetResult()));
@@ -398,17 +620,46 @@ ListDatasetsOutcome CognitoSyncClient::ListDatasets(const ListDatasetsRequest& r
 
 ListDatasetsOutcomeCallable CognitoSyncClient::ListDatasetsCallable(const ListDatasetsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::ListDatasets, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListDatasetsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDatasets( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListDatasetsOutcome > rejected;
+    rejected.set_value(ListDatasetsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::ListDatasetsAsync(const ListDatasetsRequest& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::ListDatasetsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::ListDatasetsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListDatasetsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::ListDatasetsAsyncHelper(const ListDatasetsRequest& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListDatasets(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/identities/";
+  ss << request.GetIdentityId();
+  ss << "/datasets";
+
+  auto sharedRequest = Aws::MakeShared<ListDatasetsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListDatasets", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDatasetsOutcome(ListDatasetsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDatasetsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListIdentityPoolUsageOutcome CognitoSyncClient::ListIdentityPoolUsage(const ListIdentityPoolUsageRequest& request) const
@@ -416,7 +667,7 @@ ListIdentityPoolUsageOutcome CognitoSyncClient::ListIdentityPoolUsage(const List
   Aws::StringStream ss;
   ss << m_uri << "/identitypools";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListIdentityPoolUsage");
   if(outcome.IsSuccess())
   {
     return ListIdentityPoolUsageOutcome(ListIdentityPoolUsageResult(outcome.GetResult()));
@@ -429,17 +680,42 @@ ListIdentityPoolUsageOutcome CognitoSyncClient::ListIdentityPoolUsage(const List
 
 ListIdentityPoolUsageOutcomeCallable CognitoSyncClient::ListIdentityPoolUsageCallable(const ListIdentityPoolUsageRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::ListIdentityPoolUsage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListIdentityPoolUsageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListIdentityPoolUsage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListIdentityPoolUsageOutcome > rejected;
+    rejected.set_value(ListIdentityPoolUsageOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::ListIdentityPoolUsageAsync(const ListIdentityPoolUsageRequest& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::ListIdentityPoolUsageAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::ListIdentityPoolUsageAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListIdentityPoolUsageOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::ListIdentityPoolUsageAsyncHelper(const ListIdentityPoolUsageRequest& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListIdentityPoolUsage(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools";
+
+  auto sharedRequest = Aws::MakeShared<ListIdentityPoolUsageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListIdentityPoolUsage", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListIdentityPoolUsageOutcome(ListIdentityPoolUsageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListIdentityPoolUsageOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListRecordsOutcome CognitoSyncClient::ListRecords(const ListRecordsRequest& request) const
@@ -453,7 +729,7 @@ ListRecordsOutcome CognitoSyncClient::ListRecords(const ListRecordsRequest& requ
   ss << request.GetDatasetName();
   ss << "/records";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListRecords");
   if(outcome.IsSuccess())
   {
     return ListRecordsOutcome(ListRecordsResult(outcome.GetResult()));
@@ -466,17 +742,48 @@ ListRecordsOutcome CognitoSyncClient::ListRecords(const ListRecordsRequest& requ
 
 ListRecordsOutcomeCallable CognitoSyncClient::ListRecordsCallable(const ListRecordsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::ListRecords, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListRecordsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListRecords( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListRecordsOutcome > rejected;
+    rejected.set_value(ListRecordsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::ListRecordsAsync(const ListRecordsRequest& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::ListRecordsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::ListRecordsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListRecordsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::ListRecordsAsyncHelper(const ListRecordsRequest& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListRecords(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/identities/";
+  ss << request.GetIdentityId();
+  ss << "/datasets/";
+  ss << request.GetDatasetName();
+  ss << "/records";
+
+  auto sharedRequest = Aws::MakeShared<ListRecordsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListRecords", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListRecordsOutcome(ListRecordsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListRecordsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 RegisterDeviceOutcome CognitoSyncClient::RegisterDevice(const RegisterDeviceRequest& request) const
@@ -488,7 +795,7 @@ RegisterDeviceOutcome CognitoSyncClient::RegisterDevice(const RegisterDeviceRequ
   ss << request.GetIdentityId();
   ss << "/device";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "RegisterDevice");
   if(outcome.IsSuccess())
   {
     return RegisterDeviceOutcome(RegisterDeviceResult(outcome.GetResult()));
@@ -501,17 +808,46 @@ RegisterDeviceOutcome CognitoSyncClient::RegisterDevice(const RegisterDeviceRequ
 
 RegisterDeviceOutcomeCallable CognitoSyncClient::RegisterDeviceCallable(const RegisterDeviceRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::RegisterDevice, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< RegisterDeviceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RegisterDevice( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< RegisterDeviceOutcome > rejected;
+    rejected.set_value(RegisterDeviceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::RegisterDeviceAsync(const RegisterDeviceRequest& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::RegisterDeviceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::RegisterDeviceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, RegisterDeviceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::RegisterDeviceAsyncHelper(const RegisterDeviceRequest& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, RegisterDevice(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/identity/";
+  ss << request.GetIdentityId();
+  ss << "/device";
+
+  auto sharedRequest = Aws::MakeShared<RegisterDeviceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "RegisterDevice", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RegisterDeviceOutcome(RegisterDeviceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RegisterDeviceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SetCognitoEventsOutcome CognitoSyncClient::SetCognitoEvents(const SetCognitoEventsRequest& request) const
@@ -521,7 +857,7 @@ SetCognitoEventsOutcome CognitoSyncClient::SetCognitoEvents(const SetCognitoEven
   ss << request.GetIdentityPoolId();
   ss << "/events";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "SetCognitoEvents");
   if(outcome.IsSuccess())
   {
     return SetCognitoEventsOutcome(NoResult());
@@ -534,17 +870,44 @@ SetCognitoEventsOutcome CognitoSyncClient::SetCognitoEvents(const SetCognitoEven
 
 SetCognitoEventsOutcomeCallable CognitoSyncClient::SetCognitoEventsCallable(const SetCognitoEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::SetCognitoEvents, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetCognitoEventsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetCognitoEvents( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SetCognitoEventsOutcome > rejected;
+    rejected.set_value(SetCognitoEventsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::SetCognitoEventsAsync(const SetCognitoEventsRequest& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::SetCognitoEventsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::SetCognitoEventsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SetCognitoEventsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::SetCognitoEventsAsyncHelper(const SetCognitoEventsRequest& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SetCognitoEvents(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/events";
+
+  auto sharedRequest = Aws::MakeShared<SetCognitoEventsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "SetCognitoEvents", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetCognitoEventsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetCognitoEventsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SetIdentityPoolConfigurationOutcome CognitoSyncClient::SetIdentityPoolConfiguration(const SetIdentityPoolConfigurationRequest& request) const
@@ -554,7 +917,7 @@ SetIdentityPoolConfigurationOutcome CognitoSyncClient::SetIdentityPoolConfigurat
   ss << request.GetIdentityPoolId();
   ss << "/configuration";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "SetIdentityPoolConfiguration");
   if(outcome.IsSuccess())
   {
     return SetIdentityPoolConfigurationOutcome(SetIdentityPoolConfigurationResult(outcome.GetResult()));
@@ -567,17 +930,44 @@ SetIdentityPoolConfigurationOutcome CognitoSyncClient::SetIdentityPoolConfigurat
 
 SetIdentityPoolConfigurationOutcomeCallable CognitoSyncClient::SetIdentityPoolConfigurationCallable(const SetIdentityPoolConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::SetIdentityPoolConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetIdentityPoolConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetIdentityPoolConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SetIdentityPoolConfigurationOutcome > rejected;
+    rejected.set_value(SetIdentityPoolConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::SetIdentityPoolConfigurationAsync(const SetIdentityPoolConfigurationRequest& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::SetIdentityPoolConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::SetIdentityPoolConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SetIdentityPoolConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::SetIdentityPoolConfigurationAsyncHelper(const SetIdentityPoolConfigurationRequest& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SetIdentityPoolConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/configuration";
+
+  auto sharedRequest = Aws::MakeShared<SetIdentityPoolConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "SetIdentityPoolConfiguration", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetIdentityPoolConfigurationOutcome(SetIdentityPoolConfigurationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetIdentityPoolConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SubscribeToDatasetOutcome CognitoSyncClient::SubscribeToDataset(const SubscribeToDatasetRequest& request) const
@@ -592,7 +982,7 @@ SubscribeToDatasetOutcome CognitoSyncClient::SubscribeToDataset(const SubscribeT
   ss << "/subscriptions/";
   ss << request.GetDeviceId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "SubscribeToDataset");
   if(outcome.IsSuccess())
   {
     return SubscribeToDatasetOutcome(SubscribeToDatasetResult(outcome.GetResult()));
@@ -605,17 +995,49 @@ SubscribeToDatasetOutcome CognitoSyncClient::SubscribeToDataset(const SubscribeT
 
 SubscribeToDatasetOutcomeCallable CognitoSyncClient::SubscribeToDatasetCallable(const SubscribeToDatasetRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::SubscribeToDataset, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SubscribeToDatasetOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SubscribeToDataset( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SubscribeToDatasetOutcome > rejected;
+    rejected.set_value(SubscribeToDatasetOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::SubscribeToDatasetAsync(const SubscribeToDatasetRequest& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::SubscribeToDatasetAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::SubscribeToDatasetAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SubscribeToDatasetOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::SubscribeToDatasetAsyncHelper(const SubscribeToDatasetRequest& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SubscribeToDataset(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/identities/";
+  ss << request.GetIdentityId();
+  ss << "/datasets/";
+  ss << request.GetDatasetName();
+  ss << "/subscriptions/";
+  ss << request.GetDeviceId();
+
+  auto sharedRequest = Aws::MakeShared<SubscribeToDatasetRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "SubscribeToDataset", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SubscribeToDatasetOutcome(SubscribeToDatasetResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SubscribeToDatasetOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UnsubscribeFromDatasetOutcome CognitoSyncClient::UnsubscribeFromDataset(const UnsubscribeFromDatasetRequest& request) const
@@ -630,7 +1052,7 @@ UnsubscribeFromDatasetOutcome CognitoSyncClient::UnsubscribeFromDataset(const Un
   ss << "/subscriptions/";
   ss << request.GetDeviceId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "UnsubscribeFromDataset");
   if(outcome.IsSuccess())
   {
     return UnsubscribeFromDatasetOutcome(UnsubscribeFromDatasetResult(outcome.GetResult()));
@@ -643,17 +1065,49 @@ UnsubscribeFromDatasetOutcome CognitoSyncClient::UnsubscribeFromDataset(const Un
 
 UnsubscribeFromDatasetOutcomeCallable CognitoSyncClient::UnsubscribeFromDatasetCallable(const UnsubscribeFromDatasetRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::UnsubscribeFromDataset, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UnsubscribeFromDatasetOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UnsubscribeFromDataset( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UnsubscribeFromDatasetOutcome > rejected;
+    rejected.set_value(UnsubscribeFromDatasetOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::UnsubscribeFromDatasetAsync(const UnsubscribeFromDatasetRequest& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::UnsubscribeFromDatasetAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::UnsubscribeFromDatasetAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UnsubscribeFromDatasetOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::UnsubscribeFromDatasetAsyncHelper(const UnsubscribeFromDatasetRequest& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UnsubscribeFromDataset(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/identities/";
+  ss << request.GetIdentityId();
+  ss << "/datasets/";
+  ss << request.GetDatasetName();
+  ss << "/subscriptions/";
+  ss << request.GetDeviceId();
+
+  auto sharedRequest = Aws::MakeShared<UnsubscribeFromDatasetRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "UnsubscribeFromDataset", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UnsubscribeFromDatasetOutcome(UnsubscribeFromDatasetResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UnsubscribeFromDatasetOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateRecordsOutcome CognitoSyncClient::UpdateRecords(const UpdateRecordsRequest& request) const
@@ -666,7 +1120,7 @@ UpdateRecordsOutcome CognitoSyncClient::UpdateRecords(const UpdateRecordsRequest
   ss << "/datasets/";
   ss << request.GetDatasetName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "UpdateRecords");
   if(outcome.IsSuccess())
   {
     return UpdateRecordsOutcome(UpdateRecordsResult(outcome.GetResult()));
@@ -679,16 +1133,46 @@ UpdateRecordsOutcome CognitoSyncClient::UpdateRecords(const UpdateRecordsRequest
 
 UpdateRecordsOutcomeCallable CognitoSyncClient::UpdateRecordsCallable(const UpdateRecordsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::UpdateRecords, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateRecordsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateRecords( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateRecordsOutcome > rejected;
+    rejected.set_value(UpdateRecordsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void CognitoSyncClient::UpdateRecordsAsync(const UpdateRecordsRequest& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::UpdateRecordsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&CognitoSyncClient::UpdateRecordsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateRecordsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void CognitoSyncClient::UpdateRecordsAsyncHelper(const UpdateRecordsRequest& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateRecords(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/identitypools/";
+  ss << request.GetIdentityPoolId();
+  ss << "/identities/";
+  ss << request.GetIdentityId();
+  ss << "/datasets/";
+  ss << request.GetDatasetName();
+
+  auto sharedRequest = Aws::MakeShared<UpdateRecordsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "UpdateRecords", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateRecordsOutcome(UpdateRecordsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateRecordsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
@@ -38,6 +38,7 @@
 #include <aws/config/model/PutEvaluationsResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -268,6 +269,33 @@ namespace Model
          */
         virtual void DeleteConfigRuleAsync(const Model::DeleteConfigRuleRequest& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified AWS Config rule and all of its evaluation results.</p>
+         * <p>AWS Config sets the state of a rule to <code>DELETING</code> until the
+         * deletion is complete. You cannot update a rule while it is in this state. If you
+         * make a <code>PutConfigRule</code> or <code>DeleteConfigRule</code> request for
+         * the rule, you will receive a <code>ResourceInUseException</code>.</p> <p>You can
+         * check the state of a rule by using the <code>DescribeConfigRules</code>
+         * request.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteConfigRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteConfigRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteConfigRuleOutcome> DeleteConfigRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteConfigRuleOutcome>([this, request](const std::function<void(Model::DeleteConfigRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteConfigRuleAsync(request, [complete](const ConfigServiceClient*, const Model::DeleteConfigRuleRequest&, const Model::DeleteConfigRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteConfigRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified delivery channel.</p> <p>The delivery channel cannot be
          * deleted if it is the only delivery channel and the configuration recorder is
@@ -296,6 +324,30 @@ namespace Model
          */
         virtual void DeleteDeliveryChannelAsync(const Model::DeleteDeliveryChannelRequest& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified delivery channel.</p> <p>The delivery channel cannot be
+         * deleted if it is the only delivery channel and the configuration recorder is
+         * still running. To delete the delivery channel, stop the running configuration
+         * recorder using the <a>StopConfigurationRecorder</a> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDeliveryChannelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDeliveryChannelRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDeliveryChannelOutcome> DeleteDeliveryChannelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDeliveryChannelOutcome>([this, request](const std::function<void(Model::DeleteDeliveryChannelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDeliveryChannelAsync(request, [complete](const ConfigServiceClient*, const Model::DeleteDeliveryChannelRequest&, const Model::DeleteDeliveryChannelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDeliveryChannelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Schedules delivery of a configuration snapshot to the Amazon S3 bucket in the
          * specified delivery channel. After the delivery has started, AWS Config sends
@@ -333,6 +385,33 @@ namespace Model
          */
         virtual void DeliverConfigSnapshotAsync(const Model::DeliverConfigSnapshotRequest& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Schedules delivery of a configuration snapshot to the Amazon S3 bucket in the
+         * specified delivery channel. After the delivery has started, AWS Config sends
+         * following notifications using an Amazon SNS topic that you have specified.</p>
+         * <ul> <li>Notification of starting the delivery.</li> <li>Notification of
+         * delivery completed, if the delivery was successfully completed.</li>
+         * <li>Notification of delivery failure, if the delivery failed to complete.</li>
+         * </ul>
+         *
+         * Returns an awaitable that starts the operation the way DeliverConfigSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeliverConfigSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeliverConfigSnapshotOutcome> DeliverConfigSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeliverConfigSnapshotOutcome>([this, request](const std::function<void(Model::DeliverConfigSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeliverConfigSnapshotAsync(request, [complete](const ConfigServiceClient*, const Model::DeliverConfigSnapshotRequest&, const Model::DeliverConfigSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeliverConfigSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Indicates whether the specified AWS Config rules are compliant. If a rule is
          * noncompliant, this action returns the number of AWS resources that do not comply
@@ -403,6 +482,44 @@ namespace Model
          */
         virtual void DescribeComplianceByConfigRuleAsync(const Model::DescribeComplianceByConfigRuleRequest& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Indicates whether the specified AWS Config rules are compliant. If a rule is
+         * noncompliant, this action returns the number of AWS resources that do not comply
+         * with the rule.</p> <p>A rule is compliant if all of the evaluated resources
+         * comply with it, and it is noncompliant if any of these resources do not comply.
+         * </p> <p>If AWS Config has no current evaluation results for the rule, it returns
+         * <code>INSUFFICIENT_DATA</code>. This result might indicate one of the following
+         * conditions: <ul> <li>AWS Config has never invoked an evaluation for the rule. To
+         * check whether it has, use the <code>DescribeConfigRuleEvaluationStatus</code>
+         * action to get the <code>LastSuccessfulInvocationTime</code> and
+         * <code>LastFailedInvocationTime</code>.</li> <li>The rule's AWS Lambda function
+         * is failing to send evaluation results to AWS Config. Verify that the role that
+         * you assigned to your configuration recorder includes the
+         * <code>config:PutEvaluations</code> permission. If the rule is a customer managed
+         * rule, verify that the AWS Lambda execution role includes the
+         * <code>config:PutEvaluations</code> permission.</li> <li>The rule's AWS Lambda
+         * function has returned <code>NOT_APPLICABLE</code> for all evaluation results.
+         * This can occur if the resources were deleted or removed from the rule's
+         * scope.</li></ul></p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeComplianceByConfigRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeComplianceByConfigRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeComplianceByConfigRuleOutcome> DescribeComplianceByConfigRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeComplianceByConfigRuleOutcome>([this, request](const std::function<void(Model::DescribeComplianceByConfigRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeComplianceByConfigRuleAsync(request, [complete](const ConfigServiceClient*, const Model::DescribeComplianceByConfigRuleRequest&, const Model::DescribeComplianceByConfigRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeComplianceByConfigRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Indicates whether the specified AWS resources are compliant. If a resource is
          * noncompliant, this action returns the number of AWS Config rules that the
@@ -479,6 +596,46 @@ namespace Model
          */
         virtual void DescribeComplianceByResourceAsync(const Model::DescribeComplianceByResourceRequest& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Indicates whether the specified AWS resources are compliant. If a resource is
+         * noncompliant, this action returns the number of AWS Config rules that the
+         * resource does not comply with. </p> <p>A resource is compliant if it complies
+         * with all the AWS Config rules that evaluate it. It is noncompliant if it does
+         * not comply with one or more of these rules.</p> <p>If AWS Config has no current
+         * evaluation results for the resource, it returns <code>INSUFFICIENT_DATA</code>.
+         * This result might indicate one of the following conditions about the rules that
+         * evaluate the resource: <ul> <li>AWS Config has never invoked an evaluation for
+         * the rule. To check whether it has, use the
+         * <code>DescribeConfigRuleEvaluationStatus</code> action to get the
+         * <code>LastSuccessfulInvocationTime</code> and
+         * <code>LastFailedInvocationTime</code>.</li> <li>The rule's AWS Lambda function
+         * is failing to send evaluation results to AWS Config. Verify that the role that
+         * you assigned to your configuration recorder includes the
+         * <code>config:PutEvaluations</code> permission. If the rule is a customer managed
+         * rule, verify that the AWS Lambda execution role includes the
+         * <code>config:PutEvaluations</code> permission.</li> <li>The rule's AWS Lambda
+         * function has returned <code>NOT_APPLICABLE</code> for all evaluation results.
+         * This can occur if the resources were deleted or removed from the rule's
+         * scope.</li></ul></p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeComplianceByResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeComplianceByResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeComplianceByResourceOutcome> DescribeComplianceByResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeComplianceByResourceOutcome>([this, request](const std::function<void(Model::DescribeComplianceByResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeComplianceByResourceAsync(request, [complete](const ConfigServiceClient*, const Model::DescribeComplianceByResourceRequest&, const Model::DescribeComplianceByResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeComplianceByResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns status information for each of your AWS managed Config rules. The
          * status includes information such as the last time AWS Config invoked the rule,
@@ -507,6 +664,30 @@ namespace Model
          */
         virtual void DescribeConfigRuleEvaluationStatusAsync(const Model::DescribeConfigRuleEvaluationStatusRequest& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns status information for each of your AWS managed Config rules. The
+         * status includes information such as the last time AWS Config invoked the rule,
+         * the last time AWS Config failed to invoke the rule, and the related error for
+         * the last failure.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeConfigRuleEvaluationStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeConfigRuleEvaluationStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeConfigRuleEvaluationStatusOutcome> DescribeConfigRuleEvaluationStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeConfigRuleEvaluationStatusOutcome>([this, request](const std::function<void(Model::DescribeConfigRuleEvaluationStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeConfigRuleEvaluationStatusAsync(request, [complete](const ConfigServiceClient*, const Model::DescribeConfigRuleEvaluationStatusRequest&, const Model::DescribeConfigRuleEvaluationStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeConfigRuleEvaluationStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns details about your AWS Config rules.</p>
          */
@@ -526,6 +707,27 @@ namespace Model
          */
         virtual void DescribeConfigRulesAsync(const Model::DescribeConfigRulesRequest& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns details about your AWS Config rules.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeConfigRulesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeConfigRulesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeConfigRulesOutcome> DescribeConfigRulesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeConfigRulesOutcome>([this, request](const std::function<void(Model::DescribeConfigRulesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeConfigRulesAsync(request, [complete](const ConfigServiceClient*, const Model::DescribeConfigRulesRequest&, const Model::DescribeConfigRulesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeConfigRulesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the current status of the specified configuration recorder. If a
          * configuration recorder is not specified, this action returns the status of all
@@ -554,6 +756,30 @@ namespace Model
          */
         virtual void DescribeConfigurationRecorderStatusAsync(const Model::DescribeConfigurationRecorderStatusRequest& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the current status of the specified configuration recorder. If a
+         * configuration recorder is not specified, this action returns the status of all
+         * configuration recorder associated with the account.</p> <note>Currently, you can
+         * specify only one configuration recorder per account.</note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeConfigurationRecorderStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeConfigurationRecorderStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeConfigurationRecorderStatusOutcome> DescribeConfigurationRecorderStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeConfigurationRecorderStatusOutcome>([this, request](const std::function<void(Model::DescribeConfigurationRecorderStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeConfigurationRecorderStatusAsync(request, [complete](const ConfigServiceClient*, const Model::DescribeConfigurationRecorderStatusRequest&, const Model::DescribeConfigurationRecorderStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeConfigurationRecorderStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the name of one or more specified configuration recorders. If the
          * recorder name is not specified, this action returns the names of all the
@@ -582,6 +808,30 @@ namespace Model
          */
         virtual void DescribeConfigurationRecordersAsync(const Model::DescribeConfigurationRecordersRequest& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the name of one or more specified configuration recorders. If the
+         * recorder name is not specified, this action returns the names of all the
+         * configuration recorders associated with the account. </p> <note> <p>Currently,
+         * you can specify only one configuration recorder per account.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeConfigurationRecordersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeConfigurationRecordersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeConfigurationRecordersOutcome> DescribeConfigurationRecordersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeConfigurationRecordersOutcome>([this, request](const std::function<void(Model::DescribeConfigurationRecordersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeConfigurationRecordersAsync(request, [complete](const ConfigServiceClient*, const Model::DescribeConfigurationRecordersRequest&, const Model::DescribeConfigurationRecordersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeConfigurationRecordersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the current status of the specified delivery channel. If a delivery
          * channel is not specified, this action returns the current status of all delivery
@@ -610,6 +860,30 @@ namespace Model
          */
         virtual void DescribeDeliveryChannelStatusAsync(const Model::DescribeDeliveryChannelStatusRequest& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the current status of the specified delivery channel. If a delivery
+         * channel is not specified, this action returns the current status of all delivery
+         * channels associated with the account. </p> <note>Currently, you can specify only
+         * one delivery channel per account.</note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDeliveryChannelStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDeliveryChannelStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDeliveryChannelStatusOutcome> DescribeDeliveryChannelStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDeliveryChannelStatusOutcome>([this, request](const std::function<void(Model::DescribeDeliveryChannelStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDeliveryChannelStatusAsync(request, [complete](const ConfigServiceClient*, const Model::DescribeDeliveryChannelStatusRequest&, const Model::DescribeDeliveryChannelStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDeliveryChannelStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns details about the specified delivery channel. If a delivery channel
          * is not specified, this action returns the details of all delivery channels
@@ -638,6 +912,30 @@ namespace Model
          */
         virtual void DescribeDeliveryChannelsAsync(const Model::DescribeDeliveryChannelsRequest& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns details about the specified delivery channel. If a delivery channel
+         * is not specified, this action returns the details of all delivery channels
+         * associated with the account. </p> <note> <p>Currently, you can specify only one
+         * delivery channel per account.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDeliveryChannelsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDeliveryChannelsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDeliveryChannelsOutcome> DescribeDeliveryChannelsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDeliveryChannelsOutcome>([this, request](const std::function<void(Model::DescribeDeliveryChannelsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDeliveryChannelsAsync(request, [complete](const ConfigServiceClient*, const Model::DescribeDeliveryChannelsRequest&, const Model::DescribeDeliveryChannelsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDeliveryChannelsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the evaluation results for the specified AWS Config rule. The results
          * indicate which AWS resources were evaluated by the rule, when each resource was
@@ -663,6 +961,29 @@ namespace Model
          */
         virtual void GetComplianceDetailsByConfigRuleAsync(const Model::GetComplianceDetailsByConfigRuleRequest& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the evaluation results for the specified AWS Config rule. The results
+         * indicate which AWS resources were evaluated by the rule, when each resource was
+         * last evaluated, and whether each resource complies with the rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetComplianceDetailsByConfigRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetComplianceDetailsByConfigRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetComplianceDetailsByConfigRuleOutcome> GetComplianceDetailsByConfigRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetComplianceDetailsByConfigRuleOutcome>([this, request](const std::function<void(Model::GetComplianceDetailsByConfigRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetComplianceDetailsByConfigRuleAsync(request, [complete](const ConfigServiceClient*, const Model::GetComplianceDetailsByConfigRuleRequest&, const Model::GetComplianceDetailsByConfigRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetComplianceDetailsByConfigRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the evaluation results for the specified AWS resource. The results
          * indicate which AWS Config rules were used to evaluate the resource, when each
@@ -688,6 +1009,29 @@ namespace Model
          */
         virtual void GetComplianceDetailsByResourceAsync(const Model::GetComplianceDetailsByResourceRequest& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the evaluation results for the specified AWS resource. The results
+         * indicate which AWS Config rules were used to evaluate the resource, when each
+         * rule was last used, and whether the resource complies with each rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetComplianceDetailsByResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetComplianceDetailsByResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetComplianceDetailsByResourceOutcome> GetComplianceDetailsByResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetComplianceDetailsByResourceOutcome>([this, request](const std::function<void(Model::GetComplianceDetailsByResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetComplianceDetailsByResourceAsync(request, [complete](const ConfigServiceClient*, const Model::GetComplianceDetailsByResourceRequest&, const Model::GetComplianceDetailsByResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetComplianceDetailsByResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the number of AWS Config rules that are compliant and noncompliant,
          * up to a maximum of 25 for each.</p>
@@ -709,6 +1053,27 @@ namespace Model
          * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
         virtual void GetComplianceSummaryByConfigRuleAsync(const GetComplianceSummaryByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the number of AWS Config rules that are compliant and noncompliant,
+         * up to a maximum of 25 for each.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetComplianceSummaryByConfigRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        Aws::Utils::Threading::Awaitable<Model::GetComplianceSummaryByConfigRuleOutcome> GetComplianceSummaryByConfigRuleAwaitable() const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetComplianceSummaryByConfigRuleOutcome>([this](const std::function<void(Model::GetComplianceSummaryByConfigRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetComplianceSummaryByConfigRuleAsync([complete](const ConfigServiceClient*, const Model::GetComplianceSummaryByConfigRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetComplianceSummaryByConfigRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
         /**
          * <p>Returns the number of resources that are compliant and the number that are
          * noncompliant. You can specify one or more resource types to get these numbers
@@ -734,6 +1099,29 @@ namespace Model
          */
         virtual void GetComplianceSummaryByResourceTypeAsync(const Model::GetComplianceSummaryByResourceTypeRequest& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the number of resources that are compliant and the number that are
+         * noncompliant. You can specify one or more resource types to get these numbers
+         * for each resource type. The maximum number returned is 100.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetComplianceSummaryByResourceTypeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetComplianceSummaryByResourceTypeRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetComplianceSummaryByResourceTypeOutcome> GetComplianceSummaryByResourceTypeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetComplianceSummaryByResourceTypeOutcome>([this, request](const std::function<void(Model::GetComplianceSummaryByResourceTypeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetComplianceSummaryByResourceTypeAsync(request, [complete](const ConfigServiceClient*, const Model::GetComplianceSummaryByResourceTypeRequest&, const Model::GetComplianceSummaryByResourceTypeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetComplianceSummaryByResourceTypeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of configuration items for the specified resource. The list
          * contains details about each state of the resource during the specified time
@@ -783,6 +1171,37 @@ namespace Model
          */
         virtual void GetResourceConfigHistoryAsync(const Model::GetResourceConfigHistoryRequest& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of configuration items for the specified resource. The list
+         * contains details about each state of the resource during the specified time
+         * interval.</p> <p>The response is paginated, and by default, AWS Config returns a
+         * limit of 10 configuration items per page. You can customize this number with the
+         * <code>limit</code> parameter. The response includes a <code>nextToken</code>
+         * string, and to get the next page of results, run the request again and enter
+         * this string for the <code>nextToken</code> parameter.</p> <note> <p>Each call to
+         * the API is limited to span a duration of seven days. It is likely that the
+         * number of records returned is smaller than the specified <code>limit</code>. In
+         * such cases, you can make another call, using the <code>nextToken</code>.</p>
+         * </note>
+         *
+         * Returns an awaitable that starts the operation the way GetResourceConfigHistoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetResourceConfigHistoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetResourceConfigHistoryOutcome> GetResourceConfigHistoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetResourceConfigHistoryOutcome>([this, request](const std::function<void(Model::GetResourceConfigHistoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetResourceConfigHistoryAsync(request, [complete](const ConfigServiceClient*, const Model::GetResourceConfigHistoryRequest&, const Model::GetResourceConfigHistoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetResourceConfigHistoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Accepts a resource type and returns a list of resource identifiers for the
          * resources of that type. A resource identifier includes the resource type, ID,
@@ -835,6 +1254,38 @@ namespace Model
          */
         virtual void ListDiscoveredResourcesAsync(const Model::ListDiscoveredResourcesRequest& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Accepts a resource type and returns a list of resource identifiers for the
+         * resources of that type. A resource identifier includes the resource type, ID,
+         * and (if available) the custom resource name. The results consist of resources
+         * that AWS Config has discovered, including those that AWS Config is not currently
+         * recording. You can narrow the results to include only resources that have
+         * specific resource IDs or a resource name.</p> <note>You can specify either
+         * resource IDs or a resource name but not both in the same request.</note> <p>The
+         * response is paginated, and by default AWS Config lists 100 resource identifiers
+         * on each page. You can customize this number with the <code>limit</code>
+         * parameter. The response includes a <code>nextToken</code> string, and to get the
+         * next page of results, run the request again and enter this string for the
+         * <code>nextToken</code> parameter.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDiscoveredResourcesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDiscoveredResourcesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDiscoveredResourcesOutcome> ListDiscoveredResourcesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDiscoveredResourcesOutcome>([this, request](const std::function<void(Model::ListDiscoveredResourcesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDiscoveredResourcesAsync(request, [complete](const ConfigServiceClient*, const Model::ListDiscoveredResourcesRequest&, const Model::ListDiscoveredResourcesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDiscoveredResourcesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds or updates an AWS Config rule for evaluating whether your AWS resources
          * comply with your desired configurations. </p> <p>You can use this action for
@@ -935,6 +1386,54 @@ namespace Model
          */
         virtual void PutConfigRuleAsync(const Model::PutConfigRuleRequest& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds or updates an AWS Config rule for evaluating whether your AWS resources
+         * comply with your desired configurations. </p> <p>You can use this action for
+         * customer managed Config rules and AWS managed Config rules. A customer managed
+         * Config rule is a custom rule that you develop and maintain. An AWS managed
+         * Config rule is a customizable, predefined rule that is provided by AWS
+         * Config.</p> <p>If you are adding a new customer managed Config rule, you must
+         * first create the AWS Lambda function that the rule invokes to evaluate your
+         * resources. When you use the <code>PutConfigRule</code> action to add the rule to
+         * AWS Config, you must specify the Amazon Resource Name (ARN) that AWS Lambda
+         * assigns to the function. Specify the ARN for the <code>SourceIdentifier</code>
+         * key. This key is part of the <code>Source</code> object, which is part of the
+         * <code>ConfigRule</code> object. </p> <p>If you are adding a new AWS managed
+         * Config rule, specify the rule's identifier for the <code>SourceIdentifier</code>
+         * key. To reference AWS managed Config rule identifiers, see <a
+         * href="http://docs.aws.amazon.com/config/latest/developerguide/evaluate-config_use-managed-rules.html">Using
+         * AWS Managed Config Rules</a>.</p> <p>For any new rule that you add, specify the
+         * <code>ConfigRuleName</code> in the <code>ConfigRule</code> object. Do not
+         * specify the <code>ConfigRuleArn</code> or the <code>ConfigRuleId</code>. These
+         * values are generated by AWS Config for new rules.</p> <p>If you are updating a
+         * rule that you have added previously, specify the rule's
+         * <code>ConfigRuleName</code>, <code>ConfigRuleId</code>, or
+         * <code>ConfigRuleArn</code> in the <code>ConfigRule</code> data type that you use
+         * in this request.</p> <p>The maximum number of rules that AWS Config supports is
+         * 25.</p> <p>For more information about developing and using AWS Config rules, see
+         * <a
+         * href="http://docs.aws.amazon.com/config/latest/developerguide/evaluate-config.html">Evaluating
+         * AWS Resource Configurations with AWS Config</a> in the <i>AWS Config Developer
+         * Guide</i>.</p> <p/>
+         *
+         * Returns an awaitable that starts the operation the way PutConfigRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutConfigRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutConfigRuleOutcome> PutConfigRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutConfigRuleOutcome>([this, request](const std::function<void(Model::PutConfigRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutConfigRuleAsync(request, [complete](const ConfigServiceClient*, const Model::PutConfigRuleRequest&, const Model::PutConfigRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutConfigRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new configuration recorder to record the selected resource
          * configurations.</p> <p>You can use this action to change the role
@@ -975,6 +1474,34 @@ namespace Model
          */
         virtual void PutConfigurationRecorderAsync(const Model::PutConfigurationRecorderRequest& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new configuration recorder to record the selected resource
+         * configurations.</p> <p>You can use this action to change the role
+         * <code>roleARN</code> and/or the <code>recordingGroup</code> of an existing
+         * recorder. To change the role, call the action on the existing configuration
+         * recorder and specify a role.</p> <note> <p>Currently, you can specify only one
+         * configuration recorder per account.</p> <p>If <code>ConfigurationRecorder</code>
+         * does not have the <b>recordingGroup</b> parameter specified, the default is to
+         * record all supported resource types.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way PutConfigurationRecorderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutConfigurationRecorderRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutConfigurationRecorderOutcome> PutConfigurationRecorderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutConfigurationRecorderOutcome>([this, request](const std::function<void(Model::PutConfigurationRecorderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutConfigurationRecorderAsync(request, [complete](const ConfigServiceClient*, const Model::PutConfigurationRecorderRequest&, const Model::PutConfigurationRecorderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutConfigurationRecorderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new delivery channel object to deliver the configuration
          * information to an Amazon S3 bucket, and to an Amazon SNS topic. </p> <p>You can
@@ -1018,6 +1545,35 @@ namespace Model
          */
         virtual void PutDeliveryChannelAsync(const Model::PutDeliveryChannelRequest& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new delivery channel object to deliver the configuration
+         * information to an Amazon S3 bucket, and to an Amazon SNS topic. </p> <p>You can
+         * use this action to change the Amazon S3 bucket or an Amazon SNS topic of the
+         * existing delivery channel. To change the Amazon S3 bucket or an Amazon SNS
+         * topic, call this action and specify the changed values for the S3 bucket and the
+         * SNS topic. If you specify a different value for either the S3 bucket or the SNS
+         * topic, this action will keep the existing value for the parameter that is not
+         * changed. </p> <note> <p>Currently, you can specify only one delivery channel per
+         * account.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way PutDeliveryChannelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutDeliveryChannelRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutDeliveryChannelOutcome> PutDeliveryChannelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutDeliveryChannelOutcome>([this, request](const std::function<void(Model::PutDeliveryChannelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutDeliveryChannelAsync(request, [complete](const ConfigServiceClient*, const Model::PutDeliveryChannelRequest&, const Model::PutDeliveryChannelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutDeliveryChannelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Used by an AWS Lambda function to deliver evaluation results to AWS Config.
          * This action is required in every AWS Lambda function that is invoked by an AWS
@@ -1043,6 +1599,29 @@ namespace Model
          */
         virtual void PutEvaluationsAsync(const Model::PutEvaluationsRequest& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Used by an AWS Lambda function to deliver evaluation results to AWS Config.
+         * This action is required in every AWS Lambda function that is invoked by an AWS
+         * Config rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutEvaluationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutEvaluationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutEvaluationsOutcome> PutEvaluationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutEvaluationsOutcome>([this, request](const std::function<void(Model::PutEvaluationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutEvaluationsAsync(request, [complete](const ConfigServiceClient*, const Model::PutEvaluationsRequest&, const Model::PutEvaluationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutEvaluationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts recording configurations of the AWS resources you have selected to
          * record in your AWS account.</p> <p>You must have created at least one delivery
@@ -1068,6 +1647,29 @@ namespace Model
          */
         virtual void StartConfigurationRecorderAsync(const Model::StartConfigurationRecorderRequest& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts recording configurations of the AWS resources you have selected to
+         * record in your AWS account.</p> <p>You must have created at least one delivery
+         * channel to successfully start the configuration recorder.</p>
+         *
+         * Returns an awaitable that starts the operation the way StartConfigurationRecorderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartConfigurationRecorderRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartConfigurationRecorderOutcome> StartConfigurationRecorderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartConfigurationRecorderOutcome>([this, request](const std::function<void(Model::StartConfigurationRecorderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartConfigurationRecorderAsync(request, [complete](const ConfigServiceClient*, const Model::StartConfigurationRecorderRequest&, const Model::StartConfigurationRecorderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartConfigurationRecorderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Stops recording configurations of the AWS resources you have selected to
          * record in your AWS account.</p>
@@ -1090,6 +1692,28 @@ namespace Model
          */
         virtual void StopConfigurationRecorderAsync(const Model::StopConfigurationRecorderRequest& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Stops recording configurations of the AWS resources you have selected to
+         * record in your AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way StopConfigurationRecorderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StopConfigurationRecorderRequest>
+        Aws::Utils::Threading::Awaitable<Model::StopConfigurationRecorderOutcome> StopConfigurationRecorderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StopConfigurationRecorderOutcome>([this, request](const std::function<void(Model::StopConfigurationRecorderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StopConfigurationRecorderAsync(request, [complete](const ConfigServiceClient*, const Model::StopConfigurationRecorderRequest&, const Model::StopConfigurationRecorderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StopConfigurationRecorderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
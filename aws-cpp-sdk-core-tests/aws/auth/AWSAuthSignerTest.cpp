@@ -0,0 +1,481 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/ChunkedPayloadBodySource.h>
+#include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/crypto/Sha256HMAC.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+static const char* SIGNER_TEST_TAG = "AWSAuthSignerTest";
+
+//lets a test rotate the credentials underneath a signer.
+class RotatingCredentialsProvider : public AWSCredentialsProvider
+{
+public:
+    RotatingCredentialsProvider(const Aws::String& secretKey) : m_credentials("akid", secretKey) {}
+
+    AWSCredentials GetAWSCredentials() override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_credentials;
+    }
+
+    void Rotate(const Aws::String& secretKey)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_credentials.SetAWSSecretKey(secretKey);
+    }
+
+private:
+    std::mutex m_lock;
+    AWSCredentials m_credentials;
+};
+
+static std::shared_ptr<HttpRequest> CreateRequest()
+{
+    auto request = Aws::MakeShared<Standard::StandardHttpRequest>(SIGNER_TEST_TAG, URI("https://dynamodb.us-east-1.amazonaws.com/"), HttpMethod::HTTP_POST);
+    request->SetHeaderValue("x-amz-target", "DynamoDB_20120810.GetItem");
+    auto body = Aws::MakeShared<Aws::StringStream>(SIGNER_TEST_TAG);
+    *body << "{\"TableName\":\"table\",\"Key\":{\"id\":{\"S\":\"1\"}}}";
+    request->AddContentBody(body);
+    return request;
+}
+
+//signs as if it were always the same moment, so signatures can be compared against fixed values.
+class FixedClockSigner : public AWSAuthV4Signer
+{
+public:
+    FixedClockSigner(const std::shared_ptr<AWSCredentialsProvider>& credentialsProvider, const char* serviceName, const Aws::String& region) :
+        AWSAuthV4Signer(credentialsProvider, serviceName, region)
+    {
+    }
+
+protected:
+    Aws::String GetSigningTimestamp() const override { return "20150830T123600Z"; }
+};
+
+//signs one request with each signer, retrying in the unlikely case the clock ticked over between the two.
+static void SignWithBoth(const AWSAuthV4Signer& first, const AWSAuthV4Signer& second, Aws::String& firstAuthorization, Aws::String& secondAuthorization)
+{
+    for (;;)
+    {
+        auto firstRequest = CreateRequest();
+        auto secondRequest = CreateRequest();
+        ASSERT_TRUE(first.SignRequest(*firstRequest));
+        ASSERT_TRUE(second.SignRequest(*secondRequest));
+        //header names are stored lower cased, and looking up a missing one is undefined.
+        if (firstRequest->GetHeaderValue("x-amz-date") == secondRequest->GetHeaderValue("x-amz-date"))
+        {
+            firstAuthorization = firstRequest->GetAwsAuthorization();
+            secondAuthorization = secondRequest->GetAwsAuthorization();
+            return;
+        }
+    }
+}
+
+TEST(AWSAuthSignerTest, TestCachedSigningKeyFollowsCredentialRotation)
+{
+    auto rotatingProvider = Aws::MakeShared<RotatingCredentialsProvider>(SIGNER_TEST_TAG, "secret1");
+    AWSAuthV4Signer signer(rotatingProvider, "dynamodb", "us-east-1");
+    AWSAuthV4Signer freshSigner(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "akid", "secret1"), "dynamodb", "us-east-1");
+
+    Aws::String cachedAuthorization, freshAuthorization;
+    SignWithBoth(signer, freshSigner, cachedAuthorization, freshAuthorization);
+    ASSERT_FALSE(cachedAuthorization.empty());
+    ASSERT_EQ(freshAuthorization, cachedAuthorization);
+
+    //the key derived for secret1 is cached now; a rotated secret must not reuse it.
+    rotatingProvider->Rotate("secret2");
+    AWSAuthV4Signer rotatedSigner(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "akid", "secret2"), "dynamodb", "us-east-1");
+    Aws::String rotatedAuthorization;
+    SignWithBoth(signer, rotatedSigner, cachedAuthorization, rotatedAuthorization);
+    ASSERT_EQ(rotatedAuthorization, cachedAuthorization);
+    ASSERT_NE(freshAuthorization, cachedAuthorization);
+}
+
+//benchmark, not run by default: signing with a key derived on every call against signing with the cached key.
+static double MeasureSignaturesPerSecond(const AWSAuthV4Signer& signer, RotatingCredentialsProvider* rotateEveryCall, int iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        if (rotateEveryCall)
+        {
+            rotateEveryCall->Rotate(i % 2 ? "secret1" : "secret2");
+        }
+
+        auto request = CreateRequest();
+        signer.SignRequest(*request);
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return iterations / elapsed.count();
+}
+
+TEST(AWSAuthSignerTest, DISABLED_BenchmarkSigningKeyCache)
+{
+    static const int ITERATIONS = 20000;
+
+    auto rotatingProvider = Aws::MakeShared<RotatingCredentialsProvider>(SIGNER_TEST_TAG, "secret1");
+    AWSAuthV4Signer signer(rotatingProvider, "dynamodb", "us-east-1");
+
+    //alternating secrets defeats the cache, so every signature pays for the full key derivation.
+    double uncachedRate = MeasureSignaturesPerSecond(signer, rotatingProvider.get(), ITERATIONS);
+    double cachedRate = MeasureSignaturesPerSecond(signer, nullptr, ITERATIONS);
+
+    RecordProperty("SignaturesPerSecondDerivingTheKey", static_cast<int>(uncachedRate));
+    RecordProperty("SignaturesPerSecondWithTheCachedKey", static_cast<int>(cachedRate));
+    ASSERT_GT(cachedRate, uncachedRate);
+}
+
+static std::shared_ptr<HttpRequest> CreateNumberedRequest(int number)
+{
+    auto request = CreateRequest();
+    request->SetHeaderValue("x-amz-meta-number", Aws::Utils::StringUtils::to_string(number));
+    return request;
+}
+
+TEST(AWSAuthSignerTest, TestConcurrentSignersMatchSingleThreadedSignatures)
+{
+    static const int REQUESTS = 200;
+    static const int THREADS = 4;
+
+    FixedClockSigner signer(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "akid", "secret"), "dynamodb", "us-east-1");
+    Aws::Vector<Aws::String> expected;
+    {
+        //a separate signer, so the threads below start with a cold cache and hash pools.
+        FixedClockSigner referenceSigner(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "akid", "secret"), "dynamodb", "us-east-1");
+        for (int i = 0; i < REQUESTS; ++i)
+        {
+            auto request = CreateNumberedRequest(i);
+            ASSERT_TRUE(referenceSigner.SignRequest(*request));
+            expected.push_back(request->GetAwsAuthorization());
+        }
+    }
+
+    std::atomic<int> mismatches(0);
+    Aws::Vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&signer, &expected, &mismatches, t]
+        {
+            //each thread walks the requests from a different starting point so they sign different requests at the same time.
+            for (int i = 0; i < REQUESTS; ++i)
+            {
+                int number = (i + t * REQUESTS / THREADS) % REQUESTS;
+                auto request = CreateNumberedRequest(number);
+                if (!signer.SignRequest(*request) || request->GetAwsAuthorization() != expected[number])
+                {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(0, mismatches.load());
+}
+
+//signs from threadCount threads sharing one signer; returns total signatures per second.
+static double MeasureConcurrentSignaturesPerSecond(const AWSAuthV4Signer& signer, int threadCount, int iterationsPerThread, std::atomic<int>& failures)
+{
+    auto start = std::chrono::steady_clock::now();
+    Aws::Vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&signer, &failures, iterationsPerThread]
+        {
+            for (int j = 0; j < iterationsPerThread; ++j)
+            {
+                auto request = CreateRequest();
+                if (!signer.SignRequest(*request) || request->GetAwsAuthorization().empty())
+                {
+                    ++failures;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return threadCount * iterationsPerThread / elapsed.count();
+}
+
+//benchmark, not run by default: one shared signer on one thread against the same signer on several.
+TEST(AWSAuthSignerTest, DISABLED_BenchmarkConcurrentSigning)
+{
+    static const int ITERATIONS_PER_THREAD = 5000;
+    static const int THREADS = 4;
+
+    AWSAuthV4Signer signer(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "akid", "secret"), "dynamodb", "us-east-1");
+
+    std::atomic<int> failures(0);
+    double singleThreadRate = MeasureConcurrentSignaturesPerSecond(signer, 1, ITERATIONS_PER_THREAD, failures);
+    double multiThreadRate = MeasureConcurrentSignaturesPerSecond(signer, THREADS, ITERATIONS_PER_THREAD, failures);
+
+    RecordProperty("SignaturesPerSecondOnOneThread", static_cast<int>(singleThreadRate));
+    RecordProperty("SignaturesPerSecondOnFourThreads", static_cast<int>(multiThreadRate));
+    RecordProperty("HardwareConcurrency", static_cast<int>(std::thread::hardware_concurrency()));
+    ASSERT_EQ(0, failures.load());
+    ASSERT_GT(singleThreadRate, 0.0);
+    ASSERT_GT(multiThreadRate, 0.0);
+}
+
+TEST(AWSAuthSignerTest, TestSigningWhileCredentialsRotate)
+{
+    static const int REQUESTS = 200;
+    static const int THREADS = 4;
+
+    Aws::Vector<Aws::String> expectedWithFirst, expectedWithSecond;
+    {
+        FixedClockSigner firstSigner(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "akid", "secret1"), "dynamodb", "us-east-1");
+        FixedClockSigner secondSigner(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "akid", "secret2"), "dynamodb", "us-east-1");
+        for (int i = 0; i < REQUESTS; ++i)
+        {
+            auto firstRequest = CreateNumberedRequest(i);
+            auto secondRequest = CreateNumberedRequest(i);
+            ASSERT_TRUE(firstSigner.SignRequest(*firstRequest));
+            ASSERT_TRUE(secondSigner.SignRequest(*secondRequest));
+            expectedWithFirst.push_back(firstRequest->GetAwsAuthorization());
+            expectedWithSecond.push_back(secondRequest->GetAwsAuthorization());
+        }
+    }
+
+    //every rotation replaces the published key while other threads may still be signing with the one it replaced.
+    auto rotatingProvider = Aws::MakeShared<RotatingCredentialsProvider>(SIGNER_TEST_TAG, "secret1");
+    FixedClockSigner signer(rotatingProvider, "dynamodb", "us-east-1");
+    std::atomic<int> mismatches(0);
+    std::atomic<bool> signing(true);
+    std::thread rotator([&rotatingProvider, &signing]
+    {
+        for (int i = 0; signing; ++i)
+        {
+            rotatingProvider->Rotate(i % 2 ? "secret1" : "secret2");
+            std::this_thread::yield();
+        }
+    });
+
+    Aws::Vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&]
+        {
+            for (int i = 0; i < REQUESTS; ++i)
+            {
+                auto request = CreateNumberedRequest(i);
+                if (!signer.SignRequest(*request) ||
+                    (request->GetAwsAuthorization() != expectedWithFirst[i] && request->GetAwsAuthorization() != expectedWithSecond[i]))
+                {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    signing = false;
+    rotator.join();
+
+    ASSERT_EQ(0, mismatches.load());
+}
+
+static Aws::Utils::ByteBuffer HmacSha256(const Aws::String& data, const Aws::Utils::ByteBuffer& key)
+{
+    Aws::Utils::Crypto::Sha256HMAC hmac;
+    return hmac.Calculate(Aws::Utils::ByteBuffer((unsigned char*)data.c_str(), data.length()), key).GetResult();
+}
+
+static Aws::String ReadAll(RequestBodySource& source, std::size_t readSize)
+{
+    Aws::String body;
+    Aws::Vector<char> buffer(readSize);
+    for (std::size_t amountRead = source.Read(buffer.data(), readSize); amountRead > 0; amountRead = source.Read(buffer.data(), readSize))
+    {
+        body.append(buffer.data(), amountRead);
+    }
+    return body;
+}
+
+TEST(AWSAuthSignerTest, TestChunkSignaturesMatchPublishedExample)
+{
+    //the PUT Object example from http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-streaming.html
+    Aws::String secret("AWS4wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY");
+    auto signingKey = HmacSha256("aws4_request", HmacSha256("s3", HmacSha256("us-east-1",
+        HmacSha256("20130524", Aws::Utils::ByteBuffer((unsigned char*)secret.c_str(), secret.length())))));
+
+    Aws::String payload(66560, 'a');
+    auto payloadStream = Aws::MakeShared<Aws::StringStream>(SIGNER_TEST_TAG, payload);
+    ChunkedPayloadBodySource chunked(Aws::MakeShared<StreamBodySource>(SIGNER_TEST_TAG, payloadStream), payload.length(), signingKey,
+        "20130524T000000Z", "20130524/us-east-1/s3/aws4_request", "4f232c4386841ef735655705268965c44a0e4690baa4adea153f7db9fa80a0a9");
+
+    ASSERT_EQ(66824, ChunkedPayloadBodySource::ComputeEncodedLength(payload.length()));
+    ASSERT_EQ(66824, chunked.GetRemainingLength());
+
+    //odd read sizes make chunk boundaries fall in the middle of reads.
+    Aws::String body = ReadAll(chunked, 1000);
+    ASSERT_EQ(66824u, body.length());
+    ASSERT_EQ(0, chunked.GetRemainingLength());
+
+    Aws::String firstChunk = "10000;chunk-signature=ad80c730a21e5b8d04586a2213dd63b9a0e99e0e2307b0ade35a65485a288648\r\n" + Aws::String(65536, 'a') + "\r\n";
+    Aws::String secondChunk = "400;chunk-signature=0055627c9e194cb4542bae2aa5492e3c1575bbb81b612b7d234b86a503ef5497\r\n" + Aws::String(1024, 'a') + "\r\n";
+    Aws::String finalChunk = "0;chunk-signature=b6c6ea8a5354eaf15b3cb7646744f4275b71ea724fed81ceb9323e279d449df9\r\n\r\n";
+    ASSERT_EQ(firstChunk + secondChunk + finalChunk, body);
+}
+
+TEST(AWSAuthSignerTest, TestChunkedPolicySendsBodyAwsChunked)
+{
+    AWSAuthV4Signer signer(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "akid", "secret"), "s3", "us-east-1",
+        PayloadSigningPolicy::SIGN_CHUNKS);
+
+    auto request = Aws::MakeShared<Standard::StandardHttpRequest>(SIGNER_TEST_TAG, URI("https://bucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT);
+    auto body = Aws::MakeShared<Aws::StringStream>(SIGNER_TEST_TAG, Aws::String(100000, 'b'));
+    request->AddContentBody(body);
+    request->SetContentLength("100000");
+    request->SetHeaderValue("content-encoding", "gzip");
+    ASSERT_TRUE(signer.SignRequest(*request));
+
+    ASSERT_EQ("STREAMING-AWS4-HMAC-SHA256-PAYLOAD", request->GetHeaderValue("x-amz-content-sha256"));
+    ASSERT_EQ("aws-chunked,gzip", request->GetHeaderValue("content-encoding"));
+    ASSERT_EQ("100000", request->GetHeaderValue("x-amz-decoded-content-length"));
+    ASSERT_NE(Aws::String::npos, request->GetAwsAuthorization().find("content-encoding;content-length;host;x-amz-content-sha256;x-amz-date;x-amz-decoded-content-length"));
+
+    auto chunked = request->GetContentBodySource();
+    ASSERT_NE(nullptr, chunked);
+    Aws::String encoded = ReadAll(*chunked, 16 * 1024);
+    ASSERT_EQ(Aws::Utils::StringUtils::ConvertToInt64(request->GetContentLength().c_str()), static_cast<long long>(encoded.length()));
+    ASSERT_EQ(0u, encoded.find("10000;chunk-signature="));
+
+    //and ends with the empty chunk.
+    ASSERT_EQ(encoded.length() - 86, encoded.rfind("0;chunk-signature="));
+
+    //without a known length the body is signed whole.
+    auto unknownLength = CreateRequest();
+    unknownLength->DeleteHeader("content-length");
+    ASSERT_TRUE(signer.SignRequest(*unknownLength));
+    ASSERT_EQ(nullptr, unknownLength->GetContentBodySource());
+    ASSERT_EQ(64u, unknownLength->GetHeaderValue("x-amz-content-sha256").length());
+}
+
+TEST(AWSAuthSignerTest, TestUnsignedPayloadOnlyOverHttps)
+{
+    AWSAuthV4Signer signer(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "akid", "secret"), "s3", "us-east-1",
+        PayloadSigningPolicy::UNSIGNED_OVER_HTTPS);
+
+    auto httpsRequest = Aws::MakeShared<Standard::StandardHttpRequest>(SIGNER_TEST_TAG, URI("https://bucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT);
+    httpsRequest->AddContentBody(Aws::MakeShared<Aws::StringStream>(SIGNER_TEST_TAG, "payload"));
+    ASSERT_TRUE(signer.SignRequest(*httpsRequest));
+    ASSERT_EQ("UNSIGNED-PAYLOAD", httpsRequest->GetHeaderValue("x-amz-content-sha256"));
+    ASSERT_FALSE(httpsRequest->GetAwsAuthorization().empty());
+    ASSERT_EQ(nullptr, httpsRequest->GetContentBodySource());
+
+    //without TLS nothing else protects the body, so it is still hashed.
+    auto httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(SIGNER_TEST_TAG, URI("http://bucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT);
+    httpRequest->AddContentBody(Aws::MakeShared<Aws::StringStream>(SIGNER_TEST_TAG, "payload"));
+    ASSERT_TRUE(signer.SignRequest(*httpRequest));
+    ASSERT_EQ("239f59ed55e737c77147cf55ad0c1b030b6d7ee748a7426952f9b852d5a935e5", httpRequest->GetHeaderValue("x-amz-content-sha256"));
+}
+
+TEST(AWSAuthSignerTest, TestPrecomputedPayloadSha256IsUsed)
+{
+    AWSAuthV4Signer signer(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "akid", "secret"), "s3", "us-east-1");
+
+    auto request = Aws::MakeShared<Standard::StandardHttpRequest>(SIGNER_TEST_TAG, URI("https://bucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT);
+    request->AddContentBody(Aws::MakeShared<Aws::StringStream>(SIGNER_TEST_TAG, "payload"));
+    //a digest that cannot be the body's, to show the body was not read again.
+    Aws::Utils::ByteBuffer digest(32);
+    for (std::size_t i = 0; i < digest.GetLength(); ++i)
+    {
+        digest[i] = static_cast<unsigned char>(i);
+    }
+    request->SetContentSha256(digest);
+
+    ASSERT_TRUE(signer.SignRequest(*request));
+    ASSERT_EQ("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f", request->GetHeaderValue("x-amz-content-sha256"));
+}
+
+TEST(AWSAuthSignerTest, TestCanonicalRequestWithQueryRepeatedHeadersAndEmptyPayload)
+{
+    static const char* EMPTY_PAYLOAD_SHA256 = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+    FixedClockSigner signer(Aws::MakeShared<SimpleAWSCredentialsProvider>(SIGNER_TEST_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"),
+        "service", "us-east-1");
+
+    auto request = Aws::MakeShared<Standard::StandardHttpRequest>(SIGNER_TEST_TAG,
+        URI("https://example.amazonaws.com/path/to/resource?Param2=value2&Param1=value1"), HttpMethod::HTTP_GET);
+    //set twice under different case: only the last, trimmed value is signed.
+    request->SetHeaderValue("X-Amz-Meta-Color", "red");
+    request->SetHeaderValue("x-amz-meta-color", "  blue  ");
+    request->SetHeaderValue("X-Amz-Meta-List", "a,b");
+
+    ASSERT_TRUE(signer.SignRequest(*request));
+    ASSERT_EQ("20150830T123600Z", request->GetHeaderValue("x-amz-date"));
+    ASSERT_EQ(EMPTY_PAYLOAD_SHA256, request->GetHeaderValue("x-amz-content-sha256"));
+
+    Aws::String expectedCanonicalRequest = Aws::String("GET\n"
+        "/path/to/resource\n"
+        "Param1=value1&Param2=value2\n"
+        "host:example.amazonaws.com\n"
+        "x-amz-content-sha256:") + EMPTY_PAYLOAD_SHA256 + "\n"
+        "x-amz-date:20150830T123600Z\n"
+        "x-amz-meta-color:blue\n"
+        "x-amz-meta-list:a,b\n"
+        "\n"
+        "host;x-amz-content-sha256;x-amz-date;x-amz-meta-color;x-amz-meta-list\n" + EMPTY_PAYLOAD_SHA256;
+    static const char* EXPECTED_SIGNATURE = "53c1bbd4e9543db04c4330eacfd4d61f267772c3e3998a3b702f7e87a849a72e";
+
+    //the signature is only reproducible from exactly this canonical request.
+    Aws::Utils::Crypto::Sha256 sha256;
+    Aws::String stringToSign = "AWS4-HMAC-SHA256\n20150830T123600Z\n20150830/us-east-1/service/aws4_request\n" +
+        Aws::Utils::HashingUtils::HexEncode(sha256.Calculate(expectedCanonicalRequest).GetResult());
+    Aws::String secret("AWS4wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    auto signingKey = HmacSha256("20150830", Aws::Utils::ByteBuffer((unsigned char*)secret.c_str(), secret.length()));
+    signingKey = HmacSha256("us-east-1", signingKey);
+    signingKey = HmacSha256("service", signingKey);
+    signingKey = HmacSha256("aws4_request", signingKey);
+    ASSERT_EQ(EXPECTED_SIGNATURE, Aws::Utils::HashingUtils::HexEncode(HmacSha256(stringToSign, signingKey)));
+
+    ASSERT_EQ(Aws::String("AWS4-HMAC-SHA256 Credential=AKIDEXAMPLE/20150830/us-east-1/service/aws4_request, "
+        "SignedHeaders=host;x-amz-content-sha256;x-amz-date;x-amz-meta-color;x-amz-meta-list, Signature=") + EXPECTED_SIGNATURE,
+        request->GetAwsAuthorization());
+}
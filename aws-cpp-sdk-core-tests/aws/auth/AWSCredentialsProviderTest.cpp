@@ -18,13 +18,20 @@
 #include <aws/testing/MemoryTesting.h>
 
 #include <aws/testing/mocks/aws/auth/MockEC2MetadataClient.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
 
 #include <stdlib.h>
+#include <atomic>
+#include <mutex>
 #include <thread>
 #include <fstream>
 
@@ -137,6 +144,48 @@ TEST(ProfileConfigFileAWSCredentialsProviderTest, TestDefaultConfig)
 }
 
 
+static void WriteDefaultProfile(const Aws::String& fileName, const char* accessKey, const char* secretKey)
+{
+    Aws::OFStream configFile(fileName.c_str(), Aws::OFStream::out | Aws::OFStream::trunc);
+    configFile << "[default]" << std::endl;
+    configFile << "aws_access_key_id = " << accessKey << std::endl;
+    configFile << "aws_secret_access_key = " << secretKey << std::endl;
+    configFile.flush();
+    configFile.close();
+}
+
+TEST(ProfileConfigFileAWSCredentialsProviderTest, TestPicksUpChangesToTheFile)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+    FileSystemUtils::CreateDirectoryIfNotExists(ProfileConfigFileAWSCredentialsProvider::GetProfileDirectory().c_str());
+
+    Aws::String configFileName = ProfileConfigFileAWSCredentialsProvider::GetProfileFilename();
+    Aws::String tempFileName = configFileName + "_tempMv";
+
+    FileSystemUtils::RelocateFileOrDirectory(configFileName.c_str(), tempFileName.c_str());
+
+    WriteDefaultProfile(configFileName, "FirstAccessKey", "FirstSecretKey");
+
+    ProfileConfigFileAWSCredentialsProvider provider(10);
+    EXPECT_STREQ("FirstAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId().c_str());
+
+    //several checks of the unchanged file keep serving the parsed credentials.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_STREQ("FirstAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId().c_str());
+    EXPECT_STREQ("FirstSecretKey", provider.GetAWSCredentials().GetAWSSecretKey().c_str());
+
+    WriteDefaultProfile(configFileName, "RotatedAccessKey", "RotatedSecretKey");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+    EXPECT_STREQ("RotatedAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId().c_str());
+    EXPECT_STREQ("RotatedSecretKey", provider.GetAWSCredentials().GetAWSSecretKey().c_str());
+
+    FileSystemUtils::RemoveFileIfExists(configFileName.c_str());
+    FileSystemUtils::RelocateFileOrDirectory(tempFileName.c_str(), configFileName.c_str());
+
+    AWS_END_MEMORY_TEST
+}
+
 TEST(ProfileConfigFileAWSCredentialsProviderTest, TestWithEnvVars)
 {
     AWS_BEGIN_MEMORY_TEST(16, 10)
@@ -364,3 +413,362 @@ TEST(InstanceProfileCredentialsProviderTest, TestEC2MetadataClientReturnsBadData
 }
 
 
+
+TEST(InstanceProfileCredentialsProviderTest, TestRefreshesInBackgroundWithoutCallers)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
+
+    const char* validCredentials = "{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\" }";
+    mockClient->SetMockedCredentialsValue(validCredentials);
+
+    InstanceProfileCredentialsProvider provider(mockClient, 10);
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    const char* nextSetOfCredentials = "{ \"AccessKeyId\": \"betterAccessKey\", \"SecretAccessKey\": \"betterSecretKey\", \"Token\": \"betterToken\" }";
+    mockClient->SetMockedCredentialsValue(nextSetOfCredentials);
+
+    //nobody asks for credentials here, the reload still has to happen.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ("betterAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(InstanceProfileCredentialsProviderTest, TestReadsDoNotWaitForSlowRefresh)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
+
+    const char* validCredentials = "{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\" }";
+    mockClient->SetMockedCredentialsValue(validCredentials);
+
+    InstanceProfileCredentialsProvider provider(mockClient, 10);
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    const char* nextSetOfCredentials = "{ \"AccessKeyId\": \"betterAccessKey\", \"SecretAccessKey\": \"betterSecretKey\", \"Token\": \"betterToken\" }";
+    mockClient->SetMockedCredentialsValue(nextSetOfCredentials);
+    mockClient->SetMockedLatency(std::chrono::milliseconds(500));
+
+    //let the refresh thread get stuck in the metadata call, then make sure callers are served the old credentials right away.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    ASSERT_LT(elapsed.count(), 250);
+
+    mockClient->SetMockedLatency(std::chrono::milliseconds(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    ASSERT_EQ("betterAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(InstanceProfileCredentialsProviderTest, TestRefreshIsScheduledFromExpiration)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
+
+    const char* validCredentials = "{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\", "
+                                   "\"Expiration\": \"2100-01-01T00:00:00Z\" }";
+    mockClient->SetMockedCredentialsValue(validCredentials);
+
+    //the refresh rate only applies when the service doesn't say when the credentials expire.
+    InstanceProfileCredentialsProvider provider(mockClient, 10);
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    const char* nextSetOfCredentials = "{ \"AccessKeyId\": \"betterAccessKey\", \"SecretAccessKey\": \"betterSecretKey\", \"Token\": \"betterToken\" }";
+    mockClient->SetMockedCredentialsValue(nextSetOfCredentials);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    AWS_END_MEMORY_TEST
+}
+
+//counts its loads and remembers which threads ran them.
+class RecordingRefreshProvider : public BackgroundRefreshingAWSCredentialsProvider
+{
+public:
+    RecordingRefreshProvider(long refreshRateMs, bool hasCredentials) :
+        BackgroundRefreshingAWSCredentialsProvider(refreshRateMs),
+        m_hasCredentials(hasCredentials),
+        m_loads(0)
+    {
+    }
+
+    ~RecordingRefreshProvider()
+    {
+        StopRefreshing();
+    }
+
+    int GetLoadCount()
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_loads;
+    }
+
+    Aws::Set<std::thread::id> GetBackgroundLoadThreads()
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_backgroundThreads;
+    }
+
+protected:
+    AWSCredentials LoadCredentials() override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        if (m_loads++ > 0)
+        {
+            m_backgroundThreads.insert(std::this_thread::get_id());
+        }
+        return m_hasCredentials ? AWSCredentials("akid", "secret") : AWSCredentials("", "");
+    }
+
+private:
+    bool m_hasCredentials;
+    std::mutex m_lock;
+    int m_loads;
+    Aws::Set<std::thread::id> m_backgroundThreads;
+};
+
+TEST(BackgroundRefreshingAWSCredentialsProviderTest, TestProvidersShareOneRefreshThread)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    RecordingRefreshProvider first(10, true);
+    RecordingRefreshProvider second(10, true);
+    RecordingRefreshProvider third(10, true);
+    ASSERT_EQ("akid", first.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("akid", second.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("akid", third.GetAWSCredentials().GetAWSAccessKeyId());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    Aws::Set<std::thread::id> threads = first.GetBackgroundLoadThreads();
+    ASSERT_EQ(1u, threads.size());
+    ASSERT_NE(std::this_thread::get_id(), *threads.begin());
+    ASSERT_EQ(threads, second.GetBackgroundLoadThreads());
+    ASSERT_EQ(threads, third.GetBackgroundLoadThreads());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(BackgroundRefreshingAWSCredentialsProviderTest, TestProvidersWithoutCredentialsAreNotRefreshedInTheBackground)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    RecordingRefreshProvider provider(10, false);
+    ASSERT_EQ("", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(1, provider.GetLoadCount());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(1, provider.GetLoadCount());
+
+    //once the refresh interval has passed, the next caller gives the source another try.
+    ASSERT_EQ("", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(2, provider.GetLoadCount());
+
+    AWS_END_MEMORY_TEST
+}
+
+//builds, uses and drops a refreshing provider of its own on every load, the way a provider layered on another one would.
+class NestingRefreshProvider : public BackgroundRefreshingAWSCredentialsProvider
+{
+public:
+    NestingRefreshProvider(long refreshRateMs) :
+        BackgroundRefreshingAWSCredentialsProvider(refreshRateMs),
+        m_loads(0)
+    {
+    }
+
+    ~NestingRefreshProvider()
+    {
+        StopRefreshing();
+    }
+
+    int GetLoadCount() const
+    {
+        return m_loads.load();
+    }
+
+protected:
+    AWSCredentials LoadCredentials() override
+    {
+        RecordingRefreshProvider nested(10, true);
+        AWSCredentials credentials = nested.GetAWSCredentials();
+        ++m_loads;
+        return credentials;
+    }
+
+private:
+    std::atomic<int> m_loads;
+};
+
+TEST(BackgroundRefreshingAWSCredentialsProviderTest, TestProvidersRegisterAndUnregisterFromBackgroundReloads)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    {
+        NestingRefreshProvider outer(10);
+        ASSERT_EQ("akid", outer.GetAWSCredentials().GetAWSAccessKeyId());
+
+        //other providers come and go on this thread while the background reloads register and drop theirs on the refresh thread.
+        auto start = std::chrono::steady_clock::now();
+        while (outer.GetLoadCount() < 5 && std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+        {
+            RecordingRefreshProvider passing(10, true);
+            ASSERT_EQ("akid", passing.GetAWSCredentials().GetAWSAccessKeyId());
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_GE(outer.GetLoadCount(), 5);
+    }
+
+    //the last provider is gone, and a new one starts the scheduler up again.
+    RecordingRefreshProvider later(10, true);
+    ASSERT_EQ("akid", later.GetAWSCredentials().GetAWSAccessKeyId());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_GT(later.GetLoadCount(), 1);
+
+    AWS_END_MEMORY_TEST
+}
+
+static std::shared_ptr<Aws::Http::HttpResponse> MakeMetadataResponse(Aws::Http::HttpResponseCode responseCode, const char* body)
+{
+    MockHttpClientFactory factory;
+    auto request = factory.CreateHttpRequest("http://169.254.169.254", Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto response = Aws::MakeShared<Aws::Http::Standard::StandardHttpResponse>(AllocationTag, *request);
+    response->SetResponseCode(responseCode);
+    response->GetResponseBody() << body;
+    return response;
+}
+
+TEST(EC2MetadataClientTest, TestRetriesFailuresAndCachesRoleName)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(AllocationTag);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(AllocationTag);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+
+    Aws::Internal::EC2MetadataClient client("http://169.254.169.254", mockHttpClientFactory);
+
+    const char* credentials = "{ \"AccessKeyId\": \"goodAccessKey\" }";
+    mockHttpClient->AddFailureToReturn(Aws::Http::HttpTransferFailure::TIMED_OUT);
+    mockHttpClient->AddResponseToReturn(MakeMetadataResponse(Aws::Http::HttpResponseCode::SERVICE_UNAVAILABLE, ""));
+    mockHttpClient->AddResponseToReturn(MakeMetadataResponse(Aws::Http::HttpResponseCode::OK, "someRole\n"));
+    mockHttpClient->AddResponseToReturn(MakeMetadataResponse(Aws::Http::HttpResponseCode::OK, credentials));
+    ASSERT_EQ(credentials, client.GetDefaultCredentials());
+    ASSERT_EQ(4u, mockHttpClient->GetAllRequestsMade().size());
+    ASSERT_EQ("/latest/meta-data/iam/security-credentials/someRole", mockHttpClient->GetMostRecentHttpRequest().GetUri().GetPath());
+
+    //the role name isn't looked up again.
+    mockHttpClient->Reset();
+    mockHttpClient->AddResponseToReturn(MakeMetadataResponse(Aws::Http::HttpResponseCode::OK, credentials));
+    ASSERT_EQ(credentials, client.GetDefaultCredentials());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+
+    //unless the service no longer knows it.
+    mockHttpClient->Reset();
+    mockHttpClient->AddResponseToReturn(MakeMetadataResponse(Aws::Http::HttpResponseCode::NOT_FOUND, ""));
+    mockHttpClient->AddResponseToReturn(MakeMetadataResponse(Aws::Http::HttpResponseCode::OK, "otherRole"));
+    mockHttpClient->AddResponseToReturn(MakeMetadataResponse(Aws::Http::HttpResponseCode::OK, credentials));
+    ASSERT_EQ(credentials, client.GetDefaultCredentials());
+    ASSERT_EQ(3u, mockHttpClient->GetAllRequestsMade().size());
+    ASSERT_EQ("/latest/meta-data/iam/security-credentials/otherRole", mockHttpClient->GetMostRecentHttpRequest().GetUri().GetPath());
+
+    //a service that keeps failing is given up on after a bounded number of attempts.
+    mockHttpClient->Reset();
+    mockHttpClient->AddResponseToReturn(MakeMetadataResponse(Aws::Http::HttpResponseCode::NOT_FOUND, ""));
+    for (int i = 0; i < 4; ++i)
+    {
+        mockHttpClient->AddResponseToReturn(MakeMetadataResponse(Aws::Http::HttpResponseCode::INTERNAL_SERVER_ERROR, ""));
+    }
+    ASSERT_EQ("", client.GetDefaultCredentials());
+    ASSERT_EQ(4u, mockHttpClient->GetAllRequestsMade().size());
+
+    //and one that refuses the connection is not tried again, since nothing is listening.
+    mockHttpClient->Reset();
+    mockHttpClient->AddFailureToReturn(Aws::Http::HttpTransferFailure::CONNECT_FAILED);
+    mockHttpClient->AddResponseToReturn(MakeMetadataResponse(Aws::Http::HttpResponseCode::OK, "someRole\n"));
+    ASSERT_EQ("", client.GetDefaultCredentials());
+    ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+
+    //timeouts are retried, but only as often as any other failure.
+    mockHttpClient->Reset();
+    for (int i = 0; i < 4; ++i)
+    {
+        mockHttpClient->AddFailureToReturn(Aws::Http::HttpTransferFailure::TIMED_OUT);
+    }
+    ASSERT_EQ("", client.GetDefaultCredentials());
+    ASSERT_EQ(3u, mockHttpClient->GetAllRequestsMade().size());
+
+    AWS_END_MEMORY_TEST
+}
+
+class CountingCredentialsProvider : public AWSCredentialsProvider
+{
+public:
+    CountingCredentialsProvider(const char* accessKey) : m_accessKey(accessKey), m_calls(0) {}
+
+    AWSCredentials GetAWSCredentials() override
+    {
+        ++m_calls;
+        return AWSCredentials(m_accessKey, m_accessKey.empty() ? "" : "secretKey");
+    }
+
+    void SetAccessKey(const char* accessKey) { m_accessKey = accessKey; }
+    int GetCalls() const { return m_calls; }
+
+private:
+    Aws::String m_accessKey;
+    int m_calls;
+};
+
+class TestCredentialsProviderChain : public AWSCredentialsProviderChain
+{
+public:
+    using AWSCredentialsProviderChain::AddProvider;
+};
+
+TEST(AWSCredentialsProviderChainTest, TestGoesStraightToTheLastProviderThatAnswered)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto first = Aws::MakeShared<CountingCredentialsProvider>(AllocationTag, "");
+    auto second = Aws::MakeShared<CountingCredentialsProvider>(AllocationTag, "");
+    auto third = Aws::MakeShared<CountingCredentialsProvider>(AllocationTag, "thirdAccessKey");
+
+    TestCredentialsProviderChain chain;
+    chain.AddProvider(first);
+    chain.AddProvider(second);
+    chain.AddProvider(third);
+
+    ASSERT_EQ("thirdAccessKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("thirdAccessKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("thirdAccessKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(1, first->GetCalls());
+    ASSERT_EQ(1, second->GetCalls());
+    ASSERT_EQ(3, third->GetCalls());
+
+    //the chain is walked again, in order, once the remembered provider comes back empty.
+    second->SetAccessKey("secondAccessKey");
+    third->SetAccessKey("");
+    ASSERT_EQ("secondAccessKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("secondAccessKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(2, first->GetCalls());
+    ASSERT_EQ(3, second->GetCalls());
+    ASSERT_EQ(4, third->GetCalls());
+
+    second->SetAccessKey("");
+    ASSERT_EQ("", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(4, first->GetCalls());
+    ASSERT_EQ(5, second->GetCalls());
+    ASSERT_EQ(6, third->GetCalls());
+
+    AWS_END_MEMORY_TEST
+}
@@ -192,3 +192,28 @@ TEST(AWSClientTest, TestHostHeaderOverride)
 
     AWS_END_MEMORY_TEST
 }
+
+TEST(AWSClientTest, TestTransferMetricsAreCarriedByResultsAndErrors)
+{
+    HttpTransferMetrics metrics;
+    metrics.connectTimeUs = 1500;
+    metrics.firstByteTimeUs = 4200;
+    metrics.totalTimeUs = 5000;
+    metrics.bytesReceived = 512;
+    metrics.connectionReused = true;
+
+    AWSError<CoreErrors> error(CoreErrors::THROTTLING, true);
+    ASSERT_EQ(-1, error.GetTransferMetrics().totalTimeUs);
+    error.SetTransferMetrics(metrics);
+
+    AWSError<CoreErrors> copiedError(error);
+    ASSERT_EQ(1500, copiedError.GetTransferMetrics().connectTimeUs);
+    ASSERT_EQ(4200, copiedError.GetTransferMetrics().firstByteTimeUs);
+    ASSERT_TRUE(copiedError.GetTransferMetrics().connectionReused);
+
+    AmazonWebServiceResult<Aws::String> result("payload", HeaderValueCollection());
+    result.SetTransferMetrics(metrics);
+    AmazonWebServiceResult<Aws::String> movedResult(std::move(result));
+    ASSERT_EQ(5000, movedResult.GetTransferMetrics().totalTimeUs);
+    ASSERT_EQ(512, movedResult.GetTransferMetrics().bytesReceived);
+}
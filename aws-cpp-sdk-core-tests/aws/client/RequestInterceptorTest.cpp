@@ -0,0 +1,279 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/client/LatencyHistogramInterceptor.h>
+#include <aws/core/client/RequestInterceptor.h>
+#include <aws/core/client/RetryStrategy.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+
+using namespace Aws;
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+static const char* INTERCEPTOR_TEST_TAG = "RequestInterceptorTest";
+
+//answers the first request with a 503 and every later one with an empty json document.
+class ScriptedHttpClient : public HttpClient
+{
+public:
+    ScriptedHttpClient() : m_requests(0) {}
+
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface*,
+                                              Aws::Utils::RateLimits::RateLimiterInterface*) const override
+    {
+        auto response = Aws::MakeShared<Standard::StandardHttpResponse>(INTERCEPTOR_TEST_TAG, request);
+        response->AddHeader("x-amzn-RequestId", m_requests == 0 ? "first" : "second");
+        if (m_requests++ == 0)
+        {
+            response->SetResponseCode(HttpResponseCode::SERVICE_UNAVAILABLE);
+        }
+        else
+        {
+            response->SetResponseCode(HttpResponseCode::OK);
+            response->GetResponseBody() << "{}";
+        }
+
+        return response;
+    }
+
+private:
+    mutable int m_requests;
+};
+
+class ScriptedHttpClientFactory : public HttpClientFactory
+{
+public:
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration&) const override
+    {
+        return Aws::MakeShared<ScriptedHttpClient>(INTERCEPTOR_TEST_TAG);
+    }
+};
+
+class NoopSigner : public AWSAuthSigner
+{
+public:
+    bool SignRequest(HttpRequest& request) const override
+    {
+        request.SetHeaderValue("authorization", "signed");
+        return true;
+    }
+
+    bool PresignRequest(HttpRequest&, long long) const override { return true; }
+};
+
+class RetryOnce : public RetryStrategy
+{
+public:
+    bool ShouldRetry(const AWSError<CoreErrors>&, long attemptedRetries) const override { return attemptedRetries < 1; }
+    long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>&, long) const override { return 0; }
+};
+
+class TargetedRequest : public AmazonWebServiceRequest
+{
+public:
+    std::shared_ptr<Aws::IOStream> GetBody() const override { return nullptr; }
+
+    HeaderValueCollection GetHeaders() const override
+    {
+        HeaderValueCollection headers;
+        headers["X-Amz-Target"] = "TestService_20160101.ListThings";
+        return headers;
+    }
+};
+
+class InterceptedJsonClient : public AWSJsonClient
+{
+public:
+    InterceptedJsonClient(const ClientConfiguration& configuration) :
+        AWSJsonClient(Aws::MakeShared<ScriptedHttpClientFactory>(INTERCEPTOR_TEST_TAG), configuration,
+                      Aws::MakeShared<NoopSigner>(INTERCEPTOR_TEST_TAG), nullptr)
+    {
+    }
+
+    JsonOutcome Call(const AmazonWebServiceRequest& request, const char* requestName = nullptr) const
+    {
+        return MakeRequest("http://localhost/", request, HttpMethod::HTTP_POST, requestName);
+    }
+};
+
+struct RecordedEvent
+{
+    Aws::String event;
+    RequestPhase phase;
+    long attempt;
+    uint64_t invocationId;
+};
+
+class RecordingInterceptor : public RequestInterceptor
+{
+public:
+    void BeforePhase(const RequestInterceptorContext& context, RequestPhase phase, std::chrono::steady_clock::time_point) override
+    {
+        m_events.push_back({ "before", phase, context.GetAttempt(), context.GetInvocationId() });
+        if (phase == RequestPhase::SIGN)
+        {
+            //interceptors get to decorate the request before it is signed
+            context.GetHttpRequest()->SetHeaderValue("x-trace-id", "trace");
+            m_authorizedBeforeSigning = context.GetHttpRequest()->HasHeader("authorization");
+        }
+    }
+
+    void AfterPhase(const RequestInterceptorContext& context, RequestPhase phase, std::chrono::steady_clock::time_point,
+                    bool succeeded) override
+    {
+        m_events.push_back({ succeeded ? "after" : "failed", phase, context.GetAttempt(), context.GetInvocationId() });
+        if (phase == RequestPhase::TRANSMIT)
+        {
+            m_requestIds.push_back(context.GetRequestId());
+            m_traced = context.GetHttpRequest()->HasHeader("x-trace-id");
+        }
+    }
+
+    void OnComplete(const RequestInterceptorContext& context, std::chrono::steady_clock::time_point, bool succeeded) override
+    {
+        m_operationName = context.GetOperationName();
+        m_succeeded = succeeded;
+    }
+
+    Aws::Vector<RecordedEvent> m_events;
+    Aws::Vector<Aws::String> m_requestIds;
+    Aws::String m_operationName;
+    bool m_succeeded = false;
+    bool m_traced = false;
+    bool m_authorizedBeforeSigning = true;
+};
+
+TEST(RequestInterceptorTest, TestInterceptorsSeeEveryPhaseOfEveryAttempt)
+{
+    auto recorder = Aws::MakeShared<RecordingInterceptor>(INTERCEPTOR_TEST_TAG);
+    ClientConfiguration configuration;
+    configuration.retryStrategy = Aws::MakeShared<RetryOnce>(INTERCEPTOR_TEST_TAG);
+    configuration.interceptors.push_back(recorder);
+
+    InterceptedJsonClient client(configuration);
+    TargetedRequest request;
+    ASSERT_TRUE(client.Call(request).IsSuccess());
+
+    const RequestPhase expectedPhases[] = {
+        RequestPhase::SERIALIZE, RequestPhase::SIGN, RequestPhase::TRANSMIT, RequestPhase::DESERIALIZE, RequestPhase::RETRY_DELAY,
+        RequestPhase::SERIALIZE, RequestPhase::SIGN, RequestPhase::TRANSMIT, RequestPhase::DESERIALIZE };
+    const long expectedAttempts[] = { 0, 0, 0, 0, 0, 1, 1, 1, 1 };
+    //the bodiless 503 names no error, so deserializing it fails
+    const char* expectedOutcomes[] = { "after", "after", "after", "failed", "after", "after", "after", "after", "after" };
+
+    ASSERT_EQ(2 * (sizeof(expectedPhases) / sizeof(expectedPhases[0])), recorder->m_events.size());
+    for (std::size_t i = 0; i < sizeof(expectedPhases) / sizeof(expectedPhases[0]); ++i)
+    {
+        ASSERT_EQ("before", recorder->m_events[2 * i].event);
+        ASSERT_EQ(expectedOutcomes[i], recorder->m_events[2 * i + 1].event);
+        ASSERT_EQ(expectedPhases[i], recorder->m_events[2 * i].phase);
+        ASSERT_EQ(expectedPhases[i], recorder->m_events[2 * i + 1].phase);
+        ASSERT_EQ(expectedAttempts[i], recorder->m_events[2 * i].attempt);
+        ASSERT_EQ(recorder->m_events[0].invocationId, recorder->m_events[2 * i].invocationId);
+    }
+
+    ASSERT_EQ(2u, recorder->m_requestIds.size());
+    ASSERT_EQ("first", recorder->m_requestIds[0]);
+    ASSERT_EQ("second", recorder->m_requestIds[1]);
+    ASSERT_EQ("ListThings", recorder->m_operationName);
+    ASSERT_TRUE(recorder->m_succeeded);
+    ASSERT_TRUE(recorder->m_traced);
+    ASSERT_FALSE(recorder->m_authorizedBeforeSigning);
+
+    //every call gets its own id
+    uint64_t firstInvocation = recorder->m_events[0].invocationId;
+    recorder->m_events.clear();
+    ASSERT_TRUE(client.Call(request).IsSuccess());
+    ASSERT_LT(firstInvocation, recorder->m_events[0].invocationId);
+}
+
+TEST(RequestInterceptorTest, TestRequestNameTakesPrecedenceOverTheTargetHeader)
+{
+    auto recorder = Aws::MakeShared<RecordingInterceptor>(INTERCEPTOR_TEST_TAG);
+    ClientConfiguration configuration;
+    configuration.retryStrategy = Aws::MakeShared<RetryOnce>(INTERCEPTOR_TEST_TAG);
+    configuration.interceptors.push_back(recorder);
+
+    InterceptedJsonClient client(configuration);
+    TargetedRequest request;
+    ASSERT_TRUE(client.Call(request, "DescribeThings").IsSuccess());
+    ASSERT_EQ("DescribeThings", recorder->m_operationName);
+}
+
+TEST(RequestInterceptorTest, TestLatencyHistogramInterceptorRecordsPerOperation)
+{
+    auto histograms = Aws::MakeShared<LatencyHistogramInterceptor>(INTERCEPTOR_TEST_TAG);
+    ClientConfiguration configuration;
+    configuration.retryStrategy = Aws::MakeShared<RetryOnce>(INTERCEPTOR_TEST_TAG);
+    configuration.interceptors.push_back(histograms);
+
+    InterceptedJsonClient client(configuration);
+    TargetedRequest request;
+    ASSERT_TRUE(client.Call(request).IsSuccess());
+
+    ASSERT_EQ(nullptr, histograms->GetOperationLatency("DescribeThings"));
+    const OperationLatency* listThings = histograms->GetOperationLatency("ListThings");
+    ASSERT_NE(nullptr, listThings);
+    ASSERT_EQ(1u, histograms->GetOperationNames().size());
+    ASSERT_EQ(2u, listThings->GetPhaseLatency(RequestPhase::TRANSMIT).GetCount());
+    ASSERT_EQ(2u, listThings->GetPhaseLatency(RequestPhase::SIGN).GetCount());
+    ASSERT_EQ(1u, listThings->GetPhaseLatency(RequestPhase::RETRY_DELAY).GetCount());
+    ASSERT_EQ(1u, listThings->GetTotalLatency().GetCount());
+    ASSERT_EQ(1u, listThings->GetRetryCount());
+    ASSERT_EQ(0u, listThings->GetFailureCount());
+    ASSERT_GE(listThings->GetTotalLatency().GetMax(), listThings->GetPhaseLatency(RequestPhase::TRANSMIT).GetMax());
+}
+
+TEST(RequestInterceptorTest, TestLatencyHistogramPercentiles)
+{
+    LatencyHistogram histogram;
+    ASSERT_EQ(0u, histogram.GetPercentile(50));
+
+    for (uint64_t i = 1; i <= 1000; ++i)
+    {
+        histogram.Record(i);
+    }
+
+    ASSERT_EQ(1000u, histogram.GetCount());
+    ASSERT_EQ(500500u, histogram.GetSum());
+    ASSERT_EQ(1000u, histogram.GetMax());
+
+    //buckets are at most 12.5% wide, and percentiles report their upper bound
+    uint64_t median = histogram.GetPercentile(50);
+    ASSERT_GE(median, 500u);
+    ASSERT_LE(median, 563u);
+    uint64_t p99 = histogram.GetPercentile(99);
+    ASSERT_GE(p99, 990u);
+    ASSERT_LE(p99, 1000u);
+    ASSERT_EQ(1u, histogram.GetPercentile(0));
+    ASSERT_EQ(1000u, histogram.GetPercentile(100));
+
+    //huge values are clamped into the last bucket instead of overflowing
+    histogram.Record(static_cast<uint64_t>(1) << 50);
+    ASSERT_EQ(static_cast<uint64_t>(1) << 50, histogram.GetPercentile(100));
+}
@@ -0,0 +1,142 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#ifdef ENABLE_CURL_CLIENT
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/http/curl/CurlHandleContainer.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <thread>
+
+using namespace Aws::Http;
+
+static const char* FIRST_ENDPOINT = "https://first.amazonaws.com:443";
+static const char* SECOND_ENDPOINT = "https://second.amazonaws.com:443";
+
+TEST(CurlHandleContainerTest, TestHandlesAreReusedPerEndpoint)
+{
+    CurlHandleContainer container(4);
+
+    CURL* first = container.AcquireCurlHandle(FIRST_ENDPOINT);
+    CURL* second = container.AcquireCurlHandle(SECOND_ENDPOINT);
+    ASSERT_NE(first, second);
+    container.ReleaseCurlHandle(first);
+    container.ReleaseCurlHandle(second);
+
+    ASSERT_EQ(first, container.AcquireCurlHandle(FIRST_ENDPOINT));
+    ASSERT_EQ(second, container.AcquireCurlHandle(SECOND_ENDPOINT));
+
+    ConnectionPoolStatistics statistics = container.GetStatistics();
+    ASSERT_EQ(2u, statistics.inUse);
+    ASSERT_EQ(0u, statistics.idle);
+    ASSERT_EQ(4u, statistics.acquisitions);
+
+    container.ReleaseCurlHandle(first);
+    container.ReleaseCurlHandle(second);
+    statistics = container.GetStatistics();
+    ASSERT_EQ(0u, statistics.inUse);
+    ASSERT_EQ(2u, statistics.idle);
+}
+
+TEST(CurlHandleContainerTest, TestIdleHandleOfAnotherEndpointIsRecycledAtMaxSize)
+{
+    CurlHandleContainer container(1);
+
+    CURL* first = container.AcquireCurlHandle(FIRST_ENDPOINT);
+    container.ReleaseCurlHandle(first);
+
+    CURL* second = container.AcquireCurlHandle(SECOND_ENDPOINT);
+    ASSERT_NE(nullptr, second);
+    ConnectionPoolStatistics statistics = container.GetStatistics();
+    ASSERT_EQ(1u, statistics.inUse);
+    ASSERT_EQ(0u, statistics.idle);
+    container.ReleaseCurlHandle(second);
+}
+
+TEST(CurlHandleContainerTest, TestWaitingThreadsAreCounted)
+{
+    CurlHandleContainer container(1);
+    CURL* handle = container.AcquireCurlHandle(FIRST_ENDPOINT);
+
+    std::thread waiter([&]()
+    {
+        container.ReleaseCurlHandle(container.AcquireCurlHandle(FIRST_ENDPOINT));
+    });
+
+    for (unsigned i = 0; i < 500 && container.GetStatistics().waitingThreads == 0; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(1u, container.GetStatistics().waitingThreads);
+
+    container.ReleaseCurlHandle(handle);
+    waiter.join();
+
+    ConnectionPoolStatistics statistics = container.GetStatistics();
+    ASSERT_EQ(0u, statistics.waitingThreads);
+    ASSERT_EQ(2u, statistics.acquisitions);
+    ASSERT_LE(statistics.maxWaitTimeMs, statistics.totalWaitTimeMs);
+}
+
+TEST(CurlHandleContainerTest, TestIdleHandlesAreEvicted)
+{
+    CurlHandleContainer container(4, 3000, 1000, ConnectionCacheSharing::NONE, 50);
+
+    container.ReleaseCurlHandle(container.AcquireCurlHandle(FIRST_ENDPOINT));
+    ASSERT_EQ(1u, container.GetStatistics().idle);
+
+    for (unsigned i = 0; i < 500 && container.GetStatistics().idle > 0; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(0u, container.GetStatistics().idle);
+}
+
+TEST(CurlHandleContainerTest, TestHandlesPastMaxAgeAreClosedOnRelease)
+{
+    CurlHandleContainer container(4, 3000, 1000, ConnectionCacheSharing::NONE, 0, 1);
+
+    CURL* handle = container.AcquireCurlHandle(FIRST_ENDPOINT);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    container.ReleaseCurlHandle(handle);
+
+    ConnectionPoolStatistics statistics = container.GetStatistics();
+    ASSERT_EQ(0u, statistics.inUse);
+    ASSERT_EQ(0u, statistics.idle);
+}
+
+TEST(CurlHandleContainerTest, TestMultiplexedPoolIsSizedInStreams)
+{
+    CurlHandleContainer container(2, 3000, 1000, ConnectionCacheSharing::NONE, 0, 0, HttpVersion::HTTP_2_TLS, 3);
+    ASSERT_EQ(6u, container.GetStatistics().capacity);
+
+    Aws::Vector<CURL*> handles;
+    for (unsigned i = 0; i < 6; ++i)
+    {
+        handles.push_back(container.AcquireCurlHandle(FIRST_ENDPOINT));
+        ASSERT_NE(nullptr, handles.back());
+    }
+    ASSERT_EQ(6u, container.GetStatistics().inUse);
+
+    for (CURL* handle : handles)
+    {
+        container.ReleaseCurlHandle(handle);
+    }
+    ASSERT_EQ(6u, container.GetStatistics().idle);
+}
+
+#endif // ENABLE_CURL_CLIENT
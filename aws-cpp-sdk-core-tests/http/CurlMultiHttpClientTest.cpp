@@ -0,0 +1,691 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#ifdef ENABLE_CURL_CLIENT
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/client/RetryStrategy.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/ResponseBodySink.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/ratelimiter/DefaultRateLimiter.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+static const char* MULTI_CLIENT_TEST_TAG = "CurlMultiHttpClientTest";
+
+/**
+ * Minimal keep-alive HTTP/1.1 server on a loopback port. Requests are held until batchSize of them have arrived (or a
+ * generous deadline passes), so a client only gets its responses by having a whole batch in flight at once.
+ * The first failFirst requests are answered with a 503 and a json error message, every other one with a small json document.
+ */
+class BatchingHttpServer
+{
+public:
+    BatchingHttpServer(unsigned batchSize, unsigned failFirst = 0) :
+        m_batchSize(batchSize), m_failFirst(failFirst), m_listener(-1), m_port(0), m_arrived(0), m_held(0), m_maxHeld(0), m_stopped(false)
+    {
+        m_listener = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        bind(m_listener, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(m_listener, 64);
+
+        socklen_t length = sizeof(address);
+        getsockname(m_listener, reinterpret_cast<sockaddr*>(&address), &length);
+        m_port = ntohs(address.sin_port);
+
+        m_acceptThread = std::thread(&BatchingHttpServer::Accept, this);
+    }
+
+    ~BatchingHttpServer()
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            m_stopped = true;
+            for (int connection : m_connections)
+            {
+                shutdown(connection, SHUT_RDWR);
+            }
+        }
+        m_released.notify_all();
+        shutdown(m_listener, SHUT_RDWR);
+        close(m_listener);
+        m_acceptThread.join();
+        for (auto& thread : m_connectionThreads)
+        {
+            thread.join();
+        }
+        for (int connection : m_connections)
+        {
+            close(connection);
+        }
+    }
+
+    Aws::String GetUri() const
+    {
+        Aws::StringStream uri;
+        uri << "http://127.0.0.1:" << m_port << "/";
+        return uri.str();
+    }
+
+    unsigned GetRequestCount() const
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_arrived;
+    }
+
+    unsigned GetMaxConcurrentRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_maxHeld;
+    }
+
+private:
+    void Accept()
+    {
+        for (;;)
+        {
+            int connection = accept(m_listener, nullptr, nullptr);
+            std::lock_guard<std::mutex> locker(m_mutex);
+            if (connection < 0 || m_stopped)
+            {
+                if (connection >= 0)
+                {
+                    close(connection);
+                }
+                return;
+            }
+            m_connections.push_back(connection);
+            m_connectionThreads.push_back(std::thread(&BatchingHttpServer::Serve, this, connection));
+        }
+    }
+
+    void Serve(int connection)
+    {
+        Aws::String buffer;
+        char chunk[4096];
+        for (;;)
+        {
+            size_t headerEnd = buffer.find("\r\n\r\n");
+            while (headerEnd == Aws::String::npos)
+            {
+                ssize_t received = recv(connection, chunk, sizeof(chunk), 0);
+                if (received <= 0)
+                {
+                    return;
+                }
+                buffer.append(chunk, static_cast<size_t>(received));
+                headerEnd = buffer.find("\r\n\r\n");
+            }
+
+            size_t contentLength = 0;
+            Aws::String headers = buffer.substr(0, headerEnd);
+            for (auto& c : headers)
+            {
+                c = static_cast<char>(tolower(c));
+            }
+            size_t lengthHeader = headers.find("content-length:");
+            if (lengthHeader != Aws::String::npos)
+            {
+                contentLength = static_cast<size_t>(atoi(headers.c_str() + lengthHeader + sizeof("content-length:") - 1));
+            }
+
+            //curl asks before sending a request body, and would otherwise wait a second for this
+            if (headers.find("expect: 100-continue") != Aws::String::npos)
+            {
+                static const char continueResponse[] = "HTTP/1.1 100 Continue\r\n\r\n";
+                send(connection, continueResponse, sizeof(continueResponse) - 1, MSG_NOSIGNAL);
+            }
+
+            while (buffer.size() < headerEnd + 4 + contentLength)
+            {
+                ssize_t received = recv(connection, chunk, sizeof(chunk), 0);
+                if (received <= 0)
+                {
+                    return;
+                }
+                buffer.append(chunk, static_cast<size_t>(received));
+            }
+            buffer.erase(0, headerEnd + 4 + contentLength);
+
+            if (!Respond(connection, HoldUntilBatchArrives()))
+            {
+                return;
+            }
+        }
+    }
+
+    //returns the request's position in arrival order
+    unsigned HoldUntilBatchArrives()
+    {
+        std::unique_lock<std::mutex> locker(m_mutex);
+        unsigned ticket = m_arrived++;
+        ++m_held;
+        m_maxHeld = (std::max)(m_maxHeld, m_held);
+        m_released.notify_all();
+
+        unsigned batchEnd = (ticket / m_batchSize + 1) * m_batchSize;
+        m_released.wait_for(locker, std::chrono::seconds(5), [&]() { return m_stopped || m_arrived >= batchEnd; });
+        --m_held;
+        return ticket;
+    }
+
+    bool Respond(int connection, unsigned ticket)
+    {
+        Aws::StringStream response;
+        if (ticket < m_failFirst)
+        {
+            static const char errorBody[] = "{\"message\":\"unavailable\"}";
+            response << "HTTP/1.1 503 Service Unavailable\r\nContent-Type: application/x-amz-json-1.1\r\nContent-Length: " << sizeof(errorBody) - 1
+                << "\r\n\r\n" << errorBody;
+        }
+        else
+        {
+            Aws::StringStream body;
+            body << "{\"ticket\":" << ticket << "}";
+            response << "HTTP/1.1 200 OK\r\nContent-Type: application/x-amz-json-1.1\r\nContent-Length: " << body.str().size()
+                << "\r\n\r\n" << body.str();
+        }
+
+        Aws::String bytes = response.str();
+        return send(connection, bytes.c_str(), bytes.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(bytes.size());
+    }
+
+    unsigned m_batchSize;
+    unsigned m_failFirst;
+    int m_listener;
+    unsigned short m_port;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_released;
+    unsigned m_arrived;
+    unsigned m_held;
+    unsigned m_maxHeld;
+    bool m_stopped;
+    Aws::Vector<int> m_connections;
+    Aws::Vector<std::thread> m_connectionThreads;
+    std::thread m_acceptThread;
+};
+
+static ClientConfiguration CreateMultiClientConfiguration(unsigned eventLoops, unsigned maxConnections)
+{
+    ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    config.httpEventLoopThreads = eventLoops;
+    config.maxConnections = maxConnections;
+    config.requestTimeoutMs = 10000;
+    return config;
+}
+
+static std::shared_ptr<HttpRequest> CreateGetRequest(const Aws::String& uri)
+{
+    return HttpClientFactory().CreateHttpRequest(uri, HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+}
+
+/**
+ * Issues every request through MakeRequestAsync and waits for all of them. Returns the number that came back with a 200.
+ */
+static unsigned MakeConcurrentRequests(const HttpClient& client, const Aws::String& uri, unsigned requestCount)
+{
+    Aws::Vector<std::shared_ptr<HttpRequest>> requests;
+    for (unsigned i = 0; i < requestCount; ++i)
+    {
+        requests.push_back(CreateGetRequest(uri));
+    }
+
+    std::mutex completionMutex;
+    std::condition_variable completionSignal;
+    unsigned completed = 0;
+    unsigned succeeded = 0;
+
+    for (auto& request : requests)
+    {
+        client.MakeRequestAsync(*request, [&](const std::shared_ptr<HttpResponse>& response)
+        {
+            std::lock_guard<std::mutex> locker(completionMutex);
+            ++completed;
+            if (response && response->GetResponseCode() == HttpResponseCode::OK)
+            {
+                Aws::Utils::Json::JsonValue body(response->GetResponseBody());
+                if (body.WasParseSuccessful() && body.ValueExists("ticket"))
+                {
+                    ++succeeded;
+                }
+            }
+            completionSignal.notify_one();
+        });
+    }
+
+    std::unique_lock<std::mutex> locker(completionMutex);
+    completionSignal.wait_for(locker, std::chrono::seconds(30), [&](){ return completed == requestCount; });
+    return succeeded;
+}
+
+TEST(CurlMultiHttpClientTest, TestSynchronousRequestCompletesThroughEventLoop)
+{
+    BatchingHttpServer server(1);
+    auto client = HttpClientFactory().CreateHttpClient(CreateMultiClientConfiguration(1, 4));
+    auto request = CreateGetRequest(server.GetUri());
+
+    auto response = client->MakeRequest(*request);
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    ASSERT_EQ(1u, server.GetRequestCount());
+}
+
+TEST(CurlMultiHttpClientTest, TestTimedOutTransferKeepsItsMetrics)
+{
+    //a batch of two that only ever sees one request holds it well past the client's timeout.
+    BatchingHttpServer server(2);
+    ClientConfiguration config = CreateMultiClientConfiguration(1, 4);
+    config.requestTimeoutMs = 200;
+    auto client = HttpClientFactory().CreateHttpClient(config);
+    auto request = CreateGetRequest(server.GetUri());
+
+    ASSERT_EQ(nullptr, client->MakeRequest(*request));
+    ASSERT_EQ(HttpTransferFailure::TIMED_OUT, request->GetTransferFailure());
+    const HttpTransferMetrics& metrics = request->GetTransferMetrics();
+    ASSERT_GE(metrics.connectTimeUs, 0);
+    //curl checks its timeout against a millisecond clock that can run slightly ahead of the one it reports the total time with.
+    ASSERT_GE(metrics.totalTimeUs, 190 * 1000);
+    ASSERT_EQ(0, metrics.bytesReceived);
+}
+
+TEST(CurlMultiHttpClientTest, TestRefusedConnectionIsReportedAsAConnectFailure)
+{
+    //a port that was just bound and released has nothing listening on it.
+    int unused = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(unused, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    socklen_t length = sizeof(address);
+    getsockname(unused, reinterpret_cast<sockaddr*>(&address), &length);
+    close(unused);
+
+    Aws::StringStream uri;
+    uri << "http://127.0.0.1:" << ntohs(address.sin_port) << "/";
+    auto client = HttpClientFactory().CreateHttpClient(CreateMultiClientConfiguration(1, 4));
+    auto request = CreateGetRequest(uri.str());
+
+    ASSERT_EQ(nullptr, client->MakeRequest(*request));
+    ASSERT_EQ(HttpTransferFailure::CONNECT_FAILED, request->GetTransferFailure());
+}
+
+TEST(CurlMultiHttpClientTest, TestOneEventLoopDrivesManyConcurrentRequests)
+{
+    static const unsigned REQUEST_COUNT = 16;
+    //nothing is answered until all of them are in flight, which a single thread can only manage without blocking on any.
+    BatchingHttpServer server(REQUEST_COUNT);
+    auto client = HttpClientFactory().CreateHttpClient(CreateMultiClientConfiguration(1, REQUEST_COUNT));
+
+    ASSERT_EQ(REQUEST_COUNT, MakeConcurrentRequests(*client, server.GetUri(), REQUEST_COUNT));
+    ASSERT_EQ(REQUEST_COUNT, server.GetMaxConcurrentRequests());
+}
+
+TEST(CurlMultiHttpClientTest, TestRequestsQueueForConnectionsWithoutStallingTheLoop)
+{
+    static const unsigned REQUEST_COUNT = 8;
+    static const unsigned CONNECTIONS = 2;
+    BatchingHttpServer server(CONNECTIONS);
+    auto client = HttpClientFactory().CreateHttpClient(CreateMultiClientConfiguration(1, CONNECTIONS));
+
+    ASSERT_EQ(REQUEST_COUNT, MakeConcurrentRequests(*client, server.GetUri(), REQUEST_COUNT));
+    ASSERT_EQ(CONNECTIONS, server.GetMaxConcurrentRequests());
+    ASSERT_EQ(REQUEST_COUNT, server.GetRequestCount());
+}
+
+TEST(CurlMultiHttpClientTest, TestSynchronousRequestFromTheLoopFailsFastWhenTheLoopHoldsEveryConnection)
+{
+    //the first request is held until a second one arrives, so the loop keeps the only connection until then.
+    BatchingHttpServer server(2);
+    auto client = HttpClientFactory().CreateHttpClient(CreateMultiClientConfiguration(1, 1));
+
+    std::mutex completionMutex;
+    std::condition_variable completionSignal;
+    unsigned asyncSucceeded = 0;
+    bool syncCompleted = false;
+    std::shared_ptr<HttpResponse> syncResponse;
+
+    auto onAsyncComplete = [&](const std::shared_ptr<HttpResponse>& response)
+    {
+        std::lock_guard<std::mutex> locker(completionMutex);
+        if (response && response->GetResponseCode() == HttpResponseCode::OK)
+        {
+            ++asyncSucceeded;
+        }
+        completionSignal.notify_one();
+    };
+
+    auto heldRequest = CreateGetRequest(server.GetUri());
+    client->MakeRequestAsync(*heldRequest, onAsyncComplete);
+    while (server.GetRequestCount() < 1)
+    {
+        std::this_thread::yield();
+    }
+
+    //runs on the loop thread, which would wait forever for the connection its own transfer holds.
+    auto syncRequest = CreateGetRequest(server.GetUri());
+    client->ScheduleRetry(std::chrono::milliseconds(0), [&]()
+    {
+        auto response = client->MakeRequest(*syncRequest);
+        std::lock_guard<std::mutex> locker(completionMutex);
+        syncResponse = response;
+        syncCompleted = true;
+        completionSignal.notify_one();
+    });
+
+    {
+        std::unique_lock<std::mutex> locker(completionMutex);
+        ASSERT_TRUE(completionSignal.wait_for(locker, std::chrono::seconds(2), [&](){ return syncCompleted; }));
+        ASSERT_EQ(nullptr, syncResponse);
+    }
+
+    //the loop is still running: a request from elsewhere completes the batch, and the held one is answered too.
+    auto otherClient = HttpClientFactory().CreateHttpClient(CreateMultiClientConfiguration(1, 1));
+    auto releasingRequest = CreateGetRequest(server.GetUri());
+    auto releasingResponse = otherClient->MakeRequest(*releasingRequest);
+    ASSERT_NE(nullptr, releasingResponse);
+    ASSERT_EQ(HttpResponseCode::OK, releasingResponse->GetResponseCode());
+
+    std::unique_lock<std::mutex> locker(completionMutex);
+    ASSERT_TRUE(completionSignal.wait_for(locker, std::chrono::seconds(2), [&](){ return asyncSucceeded == 1; }));
+    ASSERT_EQ(2u, server.GetRequestCount());
+}
+
+TEST(CurlMultiHttpClientTest, TestReadRateLimitingPausesTransfersInsteadOfSleeping)
+{
+    static const unsigned LIMITED_COUNT = 4;
+    BatchingHttpServer server(1);
+    auto client = HttpClientFactory().CreateHttpClient(CreateMultiClientConfiguration(1, LIMITED_COUNT + 1));
+    //half a second in debt before the first byte arrives, so every limited response has to wait on the limiter.
+    Aws::Utils::RateLimits::DefaultRateLimiter<> readLimiter(100);
+    readLimiter.ApplyCost(150);
+
+    Aws::Vector<std::shared_ptr<HttpRequest>> requests;
+    for (unsigned i = 0; i <= LIMITED_COUNT; ++i)
+    {
+        requests.push_back(CreateGetRequest(server.GetUri()));
+    }
+
+    std::mutex completionMutex;
+    std::condition_variable completionSignal;
+    unsigned limitedCompleted = 0;
+    bool unlimitedCompleted = false;
+    unsigned limitedCompletedBeforeUnlimited = 0;
+
+    for (unsigned i = 0; i < LIMITED_COUNT; ++i)
+    {
+        client->MakeRequestAsync(*requests[i], [&](const std::shared_ptr<HttpResponse>& response)
+        {
+            std::lock_guard<std::mutex> locker(completionMutex);
+            if (response && response->GetResponseCode() == HttpResponseCode::OK)
+            {
+                ++limitedCompleted;
+            }
+            completionSignal.notify_one();
+        }, &readLimiter);
+    }
+
+    //shares the event loop with the limited transfers, which must not hold it up while they wait on the limiter.
+    client->MakeRequestAsync(*requests[LIMITED_COUNT], [&](const std::shared_ptr<HttpResponse>& response)
+    {
+        std::lock_guard<std::mutex> locker(completionMutex);
+        unlimitedCompleted = response && response->GetResponseCode() == HttpResponseCode::OK;
+        limitedCompletedBeforeUnlimited = limitedCompleted;
+        completionSignal.notify_one();
+    });
+
+    std::unique_lock<std::mutex> locker(completionMutex);
+    ASSERT_TRUE(completionSignal.wait_for(locker, std::chrono::seconds(30), [&](){ return limitedCompleted == LIMITED_COUNT && unlimitedCompleted; }));
+    ASSERT_EQ(0u, limitedCompletedBeforeUnlimited);
+}
+
+static const TransferLibType CURL_CLIENTS[] = { TransferLibType::CURL_CLIENT, TransferLibType::CURL_MULTI_CLIENT };
+
+TEST(CurlHttpClientTest, TestSuccessfulBodiesGoToTheSinkAndErrorsStayInTheStream)
+{
+    for (TransferLibType clientType : CURL_CLIENTS)
+    {
+        //the first request gets an error, the second a json document.
+        BatchingHttpServer server(1, 1);
+        ClientConfiguration config = CreateMultiClientConfiguration(1, 4);
+        config.httpLibOverride = clientType;
+        auto client = HttpClientFactory().CreateHttpClient(config);
+
+        unsigned char buffer[64];
+        auto sink = Aws::MakeShared<PreallocatedBodySink>(MULTI_CLIENT_TEST_TAG, buffer, sizeof(buffer));
+
+        auto errorRequest = CreateGetRequest(server.GetUri());
+        errorRequest->SetResponseBodySink(sink);
+        auto errorResponse = client->MakeRequest(*errorRequest);
+        ASSERT_NE(nullptr, errorResponse);
+        ASSERT_EQ(HttpResponseCode::SERVICE_UNAVAILABLE, errorResponse->GetResponseCode());
+        ASSERT_EQ(0u, sink->GetBytesWritten());
+        Aws::Utils::Json::JsonValue errorBody(errorResponse->GetResponseBody());
+        ASSERT_EQ("unavailable", errorBody.GetString("message"));
+
+        auto request = CreateGetRequest(server.GetUri());
+        request->SetResponseBodySink(sink);
+        auto response = client->MakeRequest(*request);
+        ASSERT_NE(nullptr, response);
+        ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+        ASSERT_EQ(0, static_cast<int>(response->GetResponseBody().tellp()));
+        ASSERT_EQ("{\"ticket\":1}", Aws::String(reinterpret_cast<const char*>(buffer), sink->GetBytesWritten()));
+    }
+}
+
+TEST(CurlHttpClientTest, TestRefusedBodiesFailTheTransferAsRefused)
+{
+    for (TransferLibType clientType : CURL_CLIENTS)
+    {
+        BatchingHttpServer server(1);
+        ClientConfiguration config = CreateMultiClientConfiguration(1, 4);
+        config.httpLibOverride = clientType;
+        auto client = HttpClientFactory().CreateHttpClient(config);
+
+        //too small for the document, so it is turned down before the first byte.
+        unsigned char buffer[4];
+        auto tooSmallRequest = CreateGetRequest(server.GetUri());
+        tooSmallRequest->SetResponseBodySink(Aws::MakeShared<PreallocatedBodySink>(MULTI_CLIENT_TEST_TAG, buffer, sizeof(buffer)));
+        ASSERT_EQ(nullptr, client->MakeRequest(*tooSmallRequest));
+        ASSERT_EQ(HttpTransferFailure::RESPONSE_BODY_REFUSED, tooSmallRequest->GetTransferFailure());
+
+        auto refusingRequest = CreateGetRequest(server.GetUri());
+        refusingRequest->SetResponseBodySink(Aws::MakeShared<CallbackBodySink>(MULTI_CLIENT_TEST_TAG,
+            [](const unsigned char*, std::size_t) { return false; }));
+        ASSERT_EQ(nullptr, client->MakeRequest(*refusingRequest));
+        ASSERT_EQ(HttpTransferFailure::RESPONSE_BODY_REFUSED, refusingRequest->GetTransferFailure());
+    }
+}
+
+TEST(CurlHttpClientTest, TestPrewarmUsesOnlyFreeConnections)
+{
+    //the first request is held until a second one arrives, which only the prewarm can provide.
+    BatchingHttpServer server(2);
+    ClientConfiguration config = CreateMultiClientConfiguration(1, 2);
+    config.httpLibOverride = TransferLibType::CURL_CLIENT;
+    auto client = HttpClientFactory().CreateHttpClient(config);
+
+    std::shared_ptr<HttpResponse> heldResponse;
+    auto heldRequest = CreateGetRequest(server.GetUri());
+    std::thread heldThread([&]() { heldResponse = client->MakeRequest(*heldRequest); });
+    while (server.GetRequestCount() < 1)
+    {
+        std::this_thread::yield();
+    }
+
+    //waiting for the held connection as well would hold the prewarm up until the server gave up on the batch.
+    auto prewarmStart = std::chrono::steady_clock::now();
+    ASSERT_EQ(1u, client->Prewarm(URI(server.GetUri()), 2));
+    ASSERT_LT(std::chrono::steady_clock::now() - prewarmStart, std::chrono::seconds(2));
+
+    heldThread.join();
+    ASSERT_NE(nullptr, heldResponse);
+    ASSERT_EQ(HttpResponseCode::OK, heldResponse->GetResponseCode());
+}
+
+class FixedSigner : public AWSAuthSigner
+{
+public:
+    bool SignRequest(HttpRequest& request) const override
+    {
+        request.SetHeaderValue("authorization", "signed");
+        return true;
+    }
+
+    bool PresignRequest(HttpRequest&, long long) const override { return true; }
+};
+
+class RetryOnceAfterDelay : public RetryStrategy
+{
+public:
+    bool ShouldRetry(const AWSError<CoreErrors>&, long attemptedRetries) const override { return attemptedRetries < 1; }
+
+    long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>&, long) const override { return 10; }
+};
+
+class EmptyJsonRequest : public Aws::AmazonWebServiceRequest
+{
+public:
+    std::shared_ptr<Aws::IOStream> GetBody() const override
+    {
+        return Aws::MakeShared<Aws::StringStream>(MULTI_CLIENT_TEST_TAG, "{}");
+    }
+
+    HeaderValueCollection GetHeaders() const override
+    {
+        HeaderValueCollection headers;
+        headers["X-Amz-Target"] = "TestService_20160101.GetThing";
+        return headers;
+    }
+};
+
+class EventDrivenJsonClient : public AWSJsonClient
+{
+public:
+    EventDrivenJsonClient(const ClientConfiguration& configuration, const Aws::String& uri) :
+        AWSJsonClient(Aws::MakeShared<HttpClientFactory>(MULTI_CLIENT_TEST_TAG), configuration,
+                      Aws::MakeShared<FixedSigner>(MULTI_CLIENT_TEST_TAG), nullptr),
+        m_uri(uri)
+    {
+    }
+
+    JsonOutcome Call(const Aws::AmazonWebServiceRequest& request) const
+    {
+        return MakeRequest(m_uri, request, HttpMethod::HTTP_POST, "Call");
+    }
+
+    void CallAsync(const JsonOutcomeHandler& handler) const
+    {
+        MakeRequestAsync(m_uri, Aws::MakeShared<EmptyJsonRequest>(MULTI_CLIENT_TEST_TAG), HttpMethod::HTTP_POST, "Call", handler);
+    }
+
+private:
+    Aws::String m_uri;
+};
+
+TEST(CurlMultiHttpClientTest, TestRefusedResponseBodyIsReportedWithoutRetrying)
+{
+    BatchingHttpServer server(1);
+    EventDrivenJsonClient client(CreateMultiClientConfiguration(1, 4), server.GetUri());
+
+    EmptyJsonRequest request;
+    unsigned char buffer[4];
+    request.SetResponseBodySink(Aws::MakeShared<PreallocatedBodySink>(MULTI_CLIENT_TEST_TAG, buffer, sizeof(buffer)));
+
+    JsonOutcome outcome = client.Call(request);
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ("ResponseBodyRefused", outcome.GetError().GetExceptionName());
+    ASSERT_FALSE(outcome.GetError().ShouldRetry());
+    ASSERT_EQ(1u, server.GetRequestCount());
+}
+
+TEST(CurlMultiHttpClientTest, TestAsyncClientCallsHoldNoThreadWhileInFlight)
+{
+    static const unsigned CALL_COUNT = 8;
+    //the first attempt of every call fails, so each of them also has to come back through a scheduled retry.
+    BatchingHttpServer server(CALL_COUNT, CALL_COUNT);
+
+    ClientConfiguration configuration = CreateMultiClientConfiguration(1, CALL_COUNT);
+    configuration.retryStrategy = Aws::MakeShared<RetryOnceAfterDelay>(MULTI_CLIENT_TEST_TAG);
+    configuration.executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(MULTI_CLIENT_TEST_TAG, 1, 64);
+    EventDrivenJsonClient client(configuration, server.GetUri());
+
+    std::mutex completionMutex;
+    std::condition_variable completionSignal;
+    unsigned completed = 0;
+    unsigned succeeded = 0;
+    std::thread::id callerThread = std::this_thread::get_id();
+    bool completedOffCallerThread = true;
+
+    //started from the single executor thread, the way the generated *Async operations start them.
+    configuration.executor->Submit([&]()
+    {
+        for (unsigned i = 0; i < CALL_COUNT; ++i)
+        {
+            client.CallAsync([&](JsonOutcome&& outcome)
+            {
+                std::lock_guard<std::mutex> locker(completionMutex);
+                ++completed;
+                if (outcome.IsSuccess() && outcome.GetResult().GetPayload().ValueExists("ticket"))
+                {
+                    ++succeeded;
+                }
+                completedOffCallerThread = completedOffCallerThread && std::this_thread::get_id() != callerThread;
+                completionSignal.notify_one();
+            });
+        }
+    });
+
+    {
+        std::unique_lock<std::mutex> locker(completionMutex);
+        ASSERT_TRUE(completionSignal.wait_for(locker, std::chrono::seconds(30), [&](){ return completed == CALL_COUNT; }));
+    }
+
+    ASSERT_EQ(CALL_COUNT, succeeded);
+    ASSERT_TRUE(completedOffCallerThread);
+    ASSERT_EQ(2 * CALL_COUNT, server.GetRequestCount());
+    ASSERT_EQ(CALL_COUNT, server.GetMaxConcurrentRequests());
+}
+
+#endif // ENABLE_CURL_CLIENT
@@ -0,0 +1,86 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/http/RequestBodySource.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+using namespace Aws::Utils::Stream;
+
+static const char* ALLOCATION_TAG = "RequestBodySourceTest";
+
+TEST(RequestBodySourceTest, TestPreallocatedStreamReadsAndWritesCallerMemory)
+{
+    unsigned char buffer[16];
+    memset(buffer, 0, sizeof(buffer));
+
+    PreallocatedIOStream stream(buffer, sizeof(buffer));
+    stream << "hello world";
+    ASSERT_EQ(0, memcmp(buffer, "hello world", 11));
+
+    stream.seekg(6);
+    char word[6] = {0};
+    stream.read(word, 5);
+    ASSERT_STREQ("world", word);
+
+    stream.seekg(0, std::ios_base::end);
+    ASSERT_EQ(16, static_cast<int>(stream.tellg()));
+
+    //writing past the end of the caller's buffer fails instead of reallocating
+    stream.seekp(14);
+    stream << "abc";
+    ASSERT_TRUE(stream.bad());
+    ASSERT_EQ('a', buffer[14]);
+    ASSERT_EQ('b', buffer[15]);
+}
+
+TEST(RequestBodySourceTest, TestStreamBodySourceReadsFromCurrentPosition)
+{
+    auto stream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG, "skip this body");
+    stream->seekg(5);
+
+    StreamBodySource source(stream);
+    ASSERT_EQ(9, source.GetRemainingLength());
+
+    char chunk[4];
+    ASSERT_EQ(4u, source.Read(chunk, sizeof(chunk)));
+    ASSERT_EQ(0, memcmp(chunk, "this", 4));
+    ASSERT_EQ(5, source.GetRemainingLength());
+
+    ASSERT_EQ(4u, source.Read(chunk, sizeof(chunk)));
+    ASSERT_EQ(1u, source.Read(chunk, sizeof(chunk)));
+    ASSERT_EQ('y', chunk[0]);
+    ASSERT_EQ(0, source.GetRemainingLength());
+    ASSERT_EQ(0u, source.Read(chunk, sizeof(chunk)));
+}
+
+TEST(RequestBodySourceTest, TestStreamBodySourceOverPreallocatedStream)
+{
+    unsigned char buffer[] = { 'p', 'a', 'r', 't' };
+    auto stream = Aws::MakeShared<PreallocatedIOStream>(ALLOCATION_TAG, buffer, sizeof(buffer));
+
+    StreamBodySource source(stream);
+    ASSERT_EQ(4, source.GetRemainingLength());
+
+    char chunk[8];
+    ASSERT_EQ(4u, source.Read(chunk, sizeof(chunk)));
+    ASSERT_EQ(0, memcmp(chunk, buffer, sizeof(buffer)));
+    ASSERT_EQ(0u, source.Read(chunk, sizeof(chunk)));
+}
@@ -0,0 +1,75 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/http/ResponseBodySink.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+
+static const unsigned char* AsBytes(const char* str)
+{
+    return reinterpret_cast<const unsigned char*>(str);
+}
+
+TEST(ResponseBodySinkTest, TestPreallocatedSinkWritesIntoCallerBuffer)
+{
+    unsigned char buffer[8];
+    PreallocatedBodySink sink(buffer, sizeof(buffer));
+
+    ASSERT_TRUE(sink.Begin(6));
+    ASSERT_TRUE(sink.Write(AsBytes("abc"), 3));
+    ASSERT_TRUE(sink.Write(AsBytes("def"), 3));
+    ASSERT_EQ(6u, sink.GetBytesWritten());
+    ASSERT_EQ(0, memcmp(buffer, "abcdef", 6));
+
+    //a retried response starts over at the front of the buffer
+    ASSERT_TRUE(sink.Begin(-1));
+    ASSERT_EQ(0u, sink.GetBytesWritten());
+    ASSERT_TRUE(sink.Write(AsBytes("xy"), 2));
+    ASSERT_EQ(0, memcmp(buffer, "xycdef", 6));
+}
+
+TEST(ResponseBodySinkTest, TestPreallocatedSinkRefusesBodiesThatDoNotFit)
+{
+    unsigned char buffer[4];
+    PreallocatedBodySink sink(buffer, sizeof(buffer));
+
+    ASSERT_FALSE(sink.Begin(5));
+
+    //without a Content-Length the overflow is caught on write
+    ASSERT_TRUE(sink.Begin(-1));
+    ASSERT_TRUE(sink.Write(AsBytes("abc"), 3));
+    ASSERT_FALSE(sink.Write(AsBytes("de"), 2));
+    ASSERT_EQ(3u, sink.GetBytesWritten());
+}
+
+TEST(ResponseBodySinkTest, TestCallbackSinkForwardsChunks)
+{
+    Aws::String received;
+    CallbackBodySink sink([&](const unsigned char* data, std::size_t length)
+    {
+        received.append(reinterpret_cast<const char*>(data), length);
+        return received.size() < 6;
+    });
+
+    ASSERT_TRUE(sink.Begin(-1));
+    ASSERT_TRUE(sink.Write(AsBytes("abc"), 3));
+    ASSERT_FALSE(sink.Write(AsBytes("def"), 3));
+    ASSERT_EQ("abcdef", received);
+}
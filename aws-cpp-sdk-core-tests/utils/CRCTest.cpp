@@ -0,0 +1,91 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/crypto/CRC.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+using namespace Aws::Utils::Crypto;
+
+static const unsigned char* Bytes(const Aws::String& value)
+{
+    return reinterpret_cast<const unsigned char*>(value.c_str());
+}
+
+TEST(CRCTest, TestCheckValues)
+{
+    Aws::String check("123456789");
+    ASSERT_EQ(0xCBF43926u, CRC32(Bytes(check), check.length()));
+    ASSERT_EQ(0xE3069283u, CRC32C(Bytes(check), check.length()));
+
+    ASSERT_EQ(0u, CRC32(nullptr, 0));
+    ASSERT_EQ(0u, CRC32C(nullptr, 0));
+
+    //rfc 3720 (iscsi) vectors.
+    Aws::String zeros(32, '\0');
+    Aws::String ones(32, '\xff');
+    ASSERT_EQ(0x8A9136AAu, CRC32C(Bytes(zeros), zeros.length()));
+    ASSERT_EQ(0x62A8AB43u, CRC32C(Bytes(ones), ones.length()));
+}
+
+TEST(CRCTest, TestChainingAtAnyAlignmentMatchesOneCall)
+{
+    Aws::String data;
+    for (int i = 0; i < 1000; ++i)
+    {
+        data.push_back(static_cast<char>(i * 31 + 7));
+    }
+
+    uint32_t crc32 = CRC32(Bytes(data), data.length());
+    uint32_t crc32c = CRC32C(Bytes(data), data.length());
+
+    //every split point, so both the word loops and the byte tails see misaligned starts.
+    for (std::size_t split = 0; split <= 17; ++split)
+    {
+        ASSERT_EQ(crc32, CRC32(Bytes(data) + split, data.length() - split, CRC32(Bytes(data), split)));
+        ASSERT_EQ(crc32c, CRC32C(Bytes(data) + split, data.length() - split, CRC32C(Bytes(data), split)));
+    }
+}
+
+static uint32_t BitwiseCRC(uint32_t polynomial, const unsigned char* data, std::size_t length)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ polynomial : crc >> 1;
+        }
+    }
+    return ~crc;
+}
+
+//the slicing tables are written out in the source; every byte value at every slice position must agree with the plain definition.
+TEST(CRCTest, TestTablesMatchTheBitwiseDefinition)
+{
+    Aws::String data;
+    for (int i = 0; i < 8 * 256; ++i)
+    {
+        data.push_back(static_cast<char>((i * 167 + i / 256) & 0xff));
+    }
+
+    for (std::size_t length = 0; length <= data.length(); length += 61)
+    {
+        ASSERT_EQ(BitwiseCRC(0xEDB88320u, Bytes(data), length), CRC32(Bytes(data), length));
+        ASSERT_EQ(BitwiseCRC(0x82F63B78u, Bytes(data), length), CRC32C(Bytes(data), length));
+    }
+}
@@ -0,0 +1,96 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <string.h>
+#include <thread>
+
+using namespace Aws::Utils;
+
+static bool IsISO8601Timestamp(const Aws::String& timestamp)
+{
+    //yyyy-mm-ddThh:mm:ssZ
+    static const char* PATTERN = "dddd-dd-ddTdd:dd:ddZ";
+    if (timestamp.length() != strlen(PATTERN))
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < timestamp.length(); ++i)
+    {
+        bool matches = PATTERN[i] == 'd' ? (timestamp[i] >= '0' && timestamp[i] <= '9') : timestamp[i] == PATTERN[i];
+        if (!matches)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST(DateTimeTest, TestFormatsFromManyThreads)
+{
+    static const int THREADS = 8;
+    static const int ITERATIONS = 2000;
+
+    std::atomic<int> malformed(0);
+    Aws::Vector<std::thread> threads;
+    for (int i = 0; i < THREADS; ++i)
+    {
+        threads.emplace_back([&malformed]
+        {
+            for (int j = 0; j < ITERATIONS; ++j)
+            {
+                if (!IsISO8601Timestamp(DateTime::ComputeCurrentTimestampInISO8601Format()) ||
+                    DateTime::CalculateLocalTimestampAsString("%Y-%m-%d %H:%M:%S").length() != 19 ||
+                    DateTime::ComputeCurrentDateInISO8601Format().length() != 10)
+                {
+                    ++malformed;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(0, malformed.load());
+
+    int hour = DateTime::CalculateCurrentHour();
+    ASSERT_TRUE(hour >= 0 && hour < 24);
+}
+
+TEST(DateTimeTest, TestConvertISO8601ToAmazonFormat)
+{
+    ASSERT_DOUBLE_EQ(0.0, DateTime::ConvertISO8601ToAmazonFormat("1970-01-01T00:00:00Z"));
+    ASSERT_DOUBLE_EQ(1461179508.0, DateTime::ConvertISO8601ToAmazonFormat("2016-04-20T19:11:48Z"));
+    ASSERT_DOUBLE_EQ(951782400.25, DateTime::ConvertISO8601ToAmazonFormat("2000-02-29T00:00:00.25Z"));
+    ASSERT_DOUBLE_EQ(4102444800.0, DateTime::ConvertISO8601ToAmazonFormat("2100-01-01T00:00:00Z"));
+
+    ASSERT_DOUBLE_EQ(0.0, DateTime::ConvertISO8601ToAmazonFormat(""));
+    ASSERT_DOUBLE_EQ(0.0, DateTime::ConvertISO8601ToAmazonFormat("2016-04-20"));
+    ASSERT_DOUBLE_EQ(0.0, DateTime::ConvertISO8601ToAmazonFormat("2016-04-20T19:11:48+02:00"));
+    ASSERT_DOUBLE_EQ(0.0, DateTime::ConvertISO8601ToAmazonFormat("2016-13-20T19:11:48Z"));
+
+    double now = DateTime::ComputeCurrentTimestampInAmazonFormat();
+    double parsedNow = DateTime::ConvertISO8601ToAmazonFormat(DateTime::ComputeCurrentTimestampInISO8601Format().c_str());
+    ASSERT_NEAR(now, parsedNow, 2.0);
+}
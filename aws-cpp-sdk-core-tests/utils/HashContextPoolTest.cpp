@@ -0,0 +1,50 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/HashContextPool.h>
+#include <aws/core/utils/crypto/Sha256.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* POOL_TEST_TAG = "HashContextPoolTest";
+
+TEST(HashContextPoolTest, TestLeasesAreExclusiveAndReused)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    HashContextPool<Sha256> pool(POOL_TEST_TAG);
+
+    Sha256* first = nullptr;
+    {
+        auto firstLease = pool.Acquire();
+        auto secondLease = pool.Acquire();
+        first = &*firstLease;
+        ASSERT_NE(first, &*secondLease);
+        ASSERT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", HashingUtils::HexEncode(firstLease->Calculate("").GetResult()));
+    }
+
+    //both went back to the pool; the next caller reuses one instead of creating another.
+    auto thirdLease = pool.Acquire();
+    auto fourthLease = pool.Acquire();
+    ASSERT_TRUE(first == &*thirdLease || first == &*fourthLease);
+
+    AWS_END_MEMORY_TEST
+}
@@ -0,0 +1,151 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/CRC.h>
+#include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/MultiHash.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const unsigned ALL_ALGORITHMS = MultiHash::MD5_ALGORITHM | MultiHash::SHA256_ALGORITHM | MultiHash::CRC32_ALGORITHM |
+    MultiHash::CRC32C_ALGORITHM;
+
+TEST(MultiHashTest, TestKnownDigests)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::String source("123456789");
+    MultiHash multiHash(ALL_ALGORITHMS);
+    ASSERT_TRUE(multiHash.IsValid());
+    multiHash.Update(reinterpret_cast<const unsigned char*>(source.c_str()), source.length());
+    multiHash.Finish();
+
+    ASSERT_EQ("25f9e794323b453885f5181f1b624d0b", HashingUtils::HexEncode(multiHash.GetMD5().GetResult()));
+    ASSERT_EQ("15e2b0d3c33891ebb0f1ef609ec419420c20e320ce94c65fbc8c3312448eb225", HashingUtils::HexEncode(multiHash.GetSha256().GetResult()));
+    ASSERT_EQ("cbf43926", HashingUtils::HexEncode(multiHash.GetCRC32().GetResult()));
+    ASSERT_EQ("e3069283", HashingUtils::HexEncode(multiHash.GetCRC32C().GetResult()));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(MultiHashTest, TestOnlyRequestedDigestsAreComputed)
+{
+    MultiHash multiHash(MultiHash::SHA256_ALGORITHM);
+    multiHash.Finish();
+
+    ASSERT_FALSE(multiHash.GetMD5().IsSuccess());
+    ASSERT_FALSE(multiHash.GetCRC32().IsSuccess());
+    ASSERT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", HashingUtils::HexEncode(multiHash.GetSha256().GetResult()));
+}
+
+TEST(MultiHashTest, TestStreamMatchesSeparateDigests)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    //larger than the internal read buffer, and not a multiple of it.
+    Aws::StringStream stream;
+    for (int i = 0; i < 3000; ++i)
+    {
+        stream << "line " << i << "\n";
+    }
+    stream.seekg(7);
+
+    MultiHash multiHash(ALL_ALGORITHMS);
+    ASSERT_TRUE(multiHash.Calculate(stream));
+    ASSERT_EQ(7, static_cast<int>(stream.tellg()));
+
+    ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateMD5(stream)), HashingUtils::HexEncode(multiHash.GetMD5().GetResult()));
+    ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256(stream)), HashingUtils::HexEncode(multiHash.GetSha256().GetResult()));
+
+    //feeding the same bytes in uneven pieces gives the same digests.
+    Aws::String contents = stream.str();
+    MultiHash pieces(ALL_ALGORITHMS);
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(contents.c_str());
+    std::size_t offset = 0;
+    for (std::size_t piece = 1; offset < contents.length(); piece = piece * 3 + 1)
+    {
+        std::size_t amount = (std::min)(piece, contents.length() - offset);
+        pieces.Update(data + offset, amount);
+        offset += amount;
+    }
+    pieces.Finish();
+
+    ASSERT_EQ(HashingUtils::HexEncode(multiHash.GetMD5().GetResult()), HashingUtils::HexEncode(pieces.GetMD5().GetResult()));
+    ASSERT_EQ(HashingUtils::HexEncode(multiHash.GetSha256().GetResult()), HashingUtils::HexEncode(pieces.GetSha256().GetResult()));
+    ASSERT_EQ(HashingUtils::HexEncode(multiHash.GetCRC32().GetResult()), HashingUtils::HexEncode(pieces.GetCRC32().GetResult()));
+    ASSERT_EQ(HashingUtils::HexEncode(multiHash.GetCRC32C().GetResult()), HashingUtils::HexEncode(pieces.GetCRC32C().GetResult()));
+
+    AWS_END_MEMORY_TEST
+}
+
+static double MeasureMegabytesPerSecond(const std::function<void()>& hashPayload, std::size_t payloadLength, int rounds)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i)
+    {
+        hashPayload();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return payloadLength * static_cast<double>(rounds) / (1024 * 1024) / elapsed.count();
+}
+
+//benchmark, not run by default: throughput of each digest on its own and of md5 and sha256 together in one pass.
+TEST(MultiHashTest, DISABLED_BenchmarkThroughputPerAlgorithm)
+{
+    static const std::size_t PAYLOAD_LENGTH = 8 * 1024 * 1024;
+    static const int ROUNDS = 4;
+
+    Aws::String payload(PAYLOAD_LENGTH, 'x');
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(payload.c_str());
+    MD5 md5;
+    Sha256 sha256;
+    volatile uint32_t sink = 0;
+
+    double md5Rate = MeasureMegabytesPerSecond([&] { md5.Calculate(payload); }, PAYLOAD_LENGTH, ROUNDS);
+    double sha256Rate = MeasureMegabytesPerSecond([&] { sha256.Calculate(payload); }, PAYLOAD_LENGTH, ROUNDS);
+    double crc32Rate = MeasureMegabytesPerSecond([&] { sink = CRC32(data, PAYLOAD_LENGTH); }, PAYLOAD_LENGTH, ROUNDS);
+    double crc32cRate = MeasureMegabytesPerSecond([&] { sink = CRC32C(data, PAYLOAD_LENGTH); }, PAYLOAD_LENGTH, ROUNDS);
+    double singlePassRate = MeasureMegabytesPerSecond([&]
+    {
+        MultiHash multiHash(MultiHash::MD5_ALGORITHM | MultiHash::SHA256_ALGORITHM);
+        multiHash.Update(data, PAYLOAD_LENGTH);
+        multiHash.Finish();
+    }, PAYLOAD_LENGTH, ROUNDS);
+
+    RecordProperty("MD5MegabytesPerSecond", static_cast<int>(md5Rate));
+    RecordProperty("Sha256MegabytesPerSecond", static_cast<int>(sha256Rate));
+    RecordProperty("CRC32MegabytesPerSecond", static_cast<int>(crc32Rate));
+    RecordProperty("CRC32CMegabytesPerSecond", static_cast<int>(crc32cRate));
+    RecordProperty("CRC32CHardwareAccelerated", IsCRC32CHardwareAccelerated() ? 1 : 0);
+    RecordProperty("MD5AndSha256SinglePassMegabytesPerSecond", static_cast<int>(singlePassRate));
+    ASSERT_GT(md5Rate, 0.0);
+    ASSERT_GT(sha256Rate, 0.0);
+    ASSERT_GT(crc32Rate, 0.0);
+    ASSERT_GT(crc32cRate, 0.0);
+    ASSERT_GT(singlePassRate, 0.0);
+}
@@ -0,0 +1,173 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/threading/Awaitable.h>
+
+#ifdef AWS_CORE_COROUTINES
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+static const char* ALLOCATION_TAG = "AwaitableTest";
+
+namespace
+{
+    struct ThreadTrace
+    {
+        std::thread::id before;
+        std::thread::id operation;
+        std::thread::id after;
+    };
+
+    Task<int> ReturnValue(int value)
+    {
+        co_return value;
+    }
+
+    Task<int> AddAfterAwaiting(int value)
+    {
+        int awaited = co_await ReturnValue(value);
+        co_return awaited + 1;
+    }
+
+    //completes the awaitable from one of executor's threads, the way an http event loop completes a request.
+    Task<int> AwaitOperation(std::shared_ptr<Executor> executor, ThreadTrace& trace)
+    {
+        trace.before = std::this_thread::get_id();
+        int result = co_await Awaitable<int>([executor, &trace](const Awaitable<int>::CompletionHandler& complete)
+        {
+            executor->Submit([&trace, complete]() { trace.operation = std::this_thread::get_id(); complete(7); });
+        });
+        trace.after = std::this_thread::get_id();
+        co_return result;
+    }
+
+    Task<int> AwaitInlineCompletion(ThreadTrace& trace)
+    {
+        trace.before = std::this_thread::get_id();
+        int result = co_await Awaitable<int>([&trace](const Awaitable<int>::CompletionHandler& complete)
+        {
+            trace.operation = std::this_thread::get_id();
+            complete(7);
+        });
+        trace.after = std::this_thread::get_id();
+        co_return result;
+    }
+
+    Task<> AwaitAndAdd(std::function<void(const Awaitable<int>::CompletionHandler&)> start, std::atomic<int>& total)
+    {
+        total += co_await Awaitable<int>(std::move(start));
+    }
+
+    Task<int> AwaitFailingStart()
+    {
+        co_return co_await Awaitable<int>([](const Awaitable<int>::CompletionHandler&) { throw std::runtime_error("start failed"); });
+    }
+
+    Task<bool> CatchFailingStart()
+    {
+        try
+        {
+            co_await AwaitFailingStart();
+        }
+        catch (const std::runtime_error&)
+        {
+            co_return true;
+        }
+        co_return false;
+    }
+
+    Task<> MoveOnto(Executor& executor, std::thread::id& resumedOn)
+    {
+        co_await ScheduleOn(executor);
+        resumedOn = std::this_thread::get_id();
+    }
+}
+
+TEST(AwaitableTest, TestSyncWaitReturnsTheTaskResult)
+{
+    ASSERT_EQ(42, SyncWait(ReturnValue(42)));
+    ASSERT_EQ(43, SyncWait(AddAfterAwaiting(42)));
+}
+
+TEST(AwaitableTest, TestAwaitableResumesOnTheCompletingThread)
+{
+    auto executor = Aws::MakeShared<PooledThreadExecutor>(ALLOCATION_TAG, 1, 4);
+    ThreadTrace trace;
+
+    ASSERT_EQ(7, SyncWait(AwaitOperation(executor, trace)));
+    ASSERT_EQ(std::this_thread::get_id(), trace.before);
+    ASSERT_NE(std::this_thread::get_id(), trace.operation);
+    ASSERT_EQ(trace.operation, trace.after);
+}
+
+TEST(AwaitableTest, TestCompletionBeforeSuspendingCarriesOnInline)
+{
+    ThreadTrace trace;
+
+    ASSERT_EQ(7, SyncWait(AwaitInlineCompletion(trace)));
+    ASSERT_EQ(std::this_thread::get_id(), trace.operation);
+    ASSERT_EQ(std::this_thread::get_id(), trace.after);
+}
+
+TEST(AwaitableTest, TestSuspendedAwaitablesHoldNoThread)
+{
+    //every coroutine is parked on this one thread until its completion handler is called.
+    Aws::Vector<Awaitable<int>::CompletionHandler> pending;
+    std::atomic<int> total(0);
+    for (int i = 0; i < 256; ++i)
+    {
+        AwaitAndAdd([&pending](const Awaitable<int>::CompletionHandler& complete) { pending.push_back(complete); }, total).Detach();
+    }
+    ASSERT_EQ(256u, pending.size());
+    ASSERT_EQ(0, total.load());
+
+    for (auto& complete : pending)
+    {
+        complete(1);
+    }
+    ASSERT_EQ(256, total.load());
+}
+
+TEST(AwaitableTest, TestExceptionFromStartReachesTheAwaiter)
+{
+    ASSERT_TRUE(SyncWait(CatchFailingStart()));
+    ASSERT_THROW(SyncWait(AwaitFailingStart()), std::runtime_error);
+}
+
+TEST(AwaitableTest, TestScheduleOnResumesOnTheExecutorThread)
+{
+    PooledThreadExecutor executor(1, 4);
+    std::thread::id poolThread;
+    ASSERT_TRUE(executor.Submit([&poolThread]() { poolThread = std::this_thread::get_id(); }));
+
+    std::thread::id resumedOn;
+    SyncWait(MoveOnto(executor, resumedOn));
+    executor.Shutdown();
+
+    ASSERT_NE(std::this_thread::get_id(), resumedOn);
+    ASSERT_EQ(poolThread, resumedOn);
+}
+
+#endif // AWS_CORE_COROUTINES
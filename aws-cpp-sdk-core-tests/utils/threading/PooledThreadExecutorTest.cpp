@@ -0,0 +1,181 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+//holds the pool's only worker until released, so tests can fill the queue deterministically.
+class WorkerGate
+{
+public:
+    WorkerGate() : m_entered(false), m_open(false) {}
+
+    void Hold()
+    {
+        m_entered = true;
+        while (!m_open)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void WaitUntilHeld() const
+    {
+        while (!m_entered)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void Open() { m_open = true; }
+
+private:
+    std::atomic<bool> m_entered;
+    std::atomic<bool> m_open;
+};
+
+TEST(PooledThreadExecutorTest, TestTasksRunOnAFixedNumberOfThreads)
+{
+    std::atomic<int> completed(0);
+    std::mutex threadIdsLock;
+    Aws::Set<std::thread::id> threadIds;
+
+    {
+        PooledThreadExecutor executor(4, 16);
+        ASSERT_EQ(4u, executor.GetPoolSize());
+        for (int i = 0; i < 1000; ++i)
+        {
+            ASSERT_TRUE(executor.Submit([&]
+            {
+                {
+                    std::lock_guard<std::mutex> locker(threadIdsLock);
+                    threadIds.insert(std::this_thread::get_id());
+                }
+                ++completed;
+            }));
+        }
+    }
+
+    ASSERT_EQ(1000, completed.load());
+    ASSERT_LE(threadIds.size(), 4u);
+    ASSERT_EQ(0u, threadIds.count(std::this_thread::get_id()));
+}
+
+TEST(PooledThreadExecutorTest, TestRejectImmediatelyRefusesTasksWhenTheQueueIsFull)
+{
+    WorkerGate gate;
+    std::atomic<int> completed(0);
+    PooledThreadExecutor executor(1, 1, OverflowPolicy::REJECT_IMMEDIATELY);
+
+    ASSERT_TRUE(executor.Submit([&] { gate.Hold(); ++completed; }));
+    gate.WaitUntilHeld();
+    ASSERT_TRUE(executor.Submit([&] { ++completed; }));
+    ASSERT_FALSE(executor.Submit([&] { ++completed; }));
+
+    gate.Open();
+    executor.Shutdown();
+    ASSERT_EQ(2, completed.load());
+}
+
+TEST(PooledThreadExecutorTest, TestRunInCallerRunsOverflowOnTheSubmittingThread)
+{
+    WorkerGate gate;
+    std::thread::id overflowThread;
+    PooledThreadExecutor executor(1, 1, OverflowPolicy::RUN_IN_CALLER);
+
+    ASSERT_TRUE(executor.Submit([&] { gate.Hold(); }));
+    gate.WaitUntilHeld();
+    ASSERT_TRUE(executor.Submit([] {}));
+    ASSERT_TRUE(executor.Submit([&] { overflowThread = std::this_thread::get_id(); }));
+    ASSERT_EQ(std::this_thread::get_id(), overflowThread);
+
+    gate.Open();
+}
+
+TEST(PooledThreadExecutorTest, TestBlockWaitsForRoomAndShutdownDrainsTheQueue)
+{
+    WorkerGate gate;
+    std::atomic<int> completed(0);
+    PooledThreadExecutor executor(1, 1, OverflowPolicy::BLOCK);
+
+    ASSERT_TRUE(executor.Submit([&] { gate.Hold(); ++completed; }));
+    gate.WaitUntilHeld();
+    ASSERT_TRUE(executor.Submit([&] { ++completed; }));
+
+    std::atomic<bool> submitted(false);
+    std::thread producer([&]
+    {
+        executor.Submit([&] { ++completed; });
+        submitted = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(submitted.load());
+
+    gate.Open();
+    producer.join();
+    ASSERT_TRUE(submitted.load());
+
+    executor.Shutdown();
+    ASSERT_EQ(3, completed.load());
+    ASSERT_FALSE(executor.Submit([&] { ++completed; }));
+}
+
+TEST(PooledThreadExecutorTest, TestShutdownFromATaskStopsAcceptingWithoutJoiningItself)
+{
+    std::atomic<bool> shutdownReturned(false);
+    std::atomic<bool> rejectedAfterShutdown(false);
+    PooledThreadExecutor executor(2, 4);
+
+    ASSERT_TRUE(executor.Submit([&]
+    {
+        executor.Shutdown();
+        rejectedAfterShutdown = !executor.Submit([] {});
+        shutdownReturned = true;
+    }));
+
+    executor.Shutdown();
+    ASSERT_TRUE(shutdownReturned.load());
+    ASSERT_TRUE(rejectedAfterShutdown.load());
+}
+
+TEST(PooledThreadExecutorTest, TestReleasingTheLastReferenceFromATaskStillDrainsTheQueue)
+{
+    WorkerGate gate;
+    std::atomic<int> completed(0);
+    auto executor = Aws::MakeShared<PooledThreadExecutor>("PooledThreadExecutorTest", 1, 4);
+    auto lastReference = executor;
+
+    ASSERT_TRUE(executor->Submit([&] { gate.Hold(); lastReference.reset(); ++completed; }));
+    gate.WaitUntilHeld();
+    ASSERT_TRUE(executor->Submit([&] { ++completed; }));
+    executor.reset();
+
+    gate.Open();
+    for (int i = 0; i < 500 && completed.load() < 2; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_EQ(2, completed.load());
+}
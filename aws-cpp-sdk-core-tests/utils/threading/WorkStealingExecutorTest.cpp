@@ -0,0 +1,241 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+using namespace Aws::Http;
+
+TEST(WorkStealingExecutorTest, TestAllTasksRun)
+{
+    std::atomic<int> completed(0);
+    {
+        WorkStealingExecutor executor(4);
+        ASSERT_EQ(4u, executor.GetPoolSize());
+        for (int i = 0; i < 1000; ++i)
+        {
+            ASSERT_TRUE(executor.Submit([&] { ++completed; }));
+        }
+    }
+
+    ASSERT_EQ(1000, completed.load());
+}
+
+TEST(WorkStealingExecutorTest, TestContinuationsRunNewestFirst)
+{
+    Aws::Vector<int> order;
+    {
+        WorkStealingExecutor executor(1);
+        executor.Submit([&]
+        {
+            executor.Submit([&] { order.push_back(1); });
+            executor.Submit([&] { order.push_back(2); });
+        });
+    }
+
+    ASSERT_EQ(2u, order.size());
+    ASSERT_EQ(2, order[0]);
+    ASSERT_EQ(1, order[1]);
+}
+
+TEST(WorkStealingExecutorTest, TestIdleWorkersStealQueuedContinuations)
+{
+    std::atomic<bool> stolen(false);
+    std::thread::id parentThread;
+    std::thread::id continuationThread;
+    {
+        WorkStealingExecutor executor(2);
+        executor.Submit([&]
+        {
+            parentThread = std::this_thread::get_id();
+            executor.Submit([&]
+            {
+                continuationThread = std::this_thread::get_id();
+                stolen = true;
+            });
+
+            //the continuation sits on this thread's deque, so only the other thread can run it while this one waits.
+            while (!stolen)
+            {
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    ASSERT_TRUE(stolen.load());
+    ASSERT_NE(parentThread, continuationThread);
+}
+
+TEST(WorkStealingExecutorTest, TestShutdownFinishesChainsAndRejectsNewWork)
+{
+    std::atomic<int> completed(0);
+    WorkStealingExecutor executor(2);
+
+    std::function<void(int)> link = [&](int remaining)
+    {
+        ++completed;
+        if (remaining > 1)
+        {
+            ASSERT_TRUE(executor.Submit(link, remaining - 1));
+        }
+    };
+
+    ASSERT_TRUE(executor.Submit(link, 100));
+    executor.Shutdown();
+
+    ASSERT_EQ(100, completed.load());
+    ASSERT_FALSE(executor.Submit([&] { ++completed; }));
+}
+
+TEST(WorkStealingExecutorTest, TestShutdownFromATaskStopsAcceptingWithoutJoiningItself)
+{
+    std::atomic<bool> shutdownReturned(false);
+    std::atomic<bool> rejectedFromOutside(false);
+    WorkStealingExecutor executor(2);
+
+    ASSERT_TRUE(executor.Submit([&]
+    {
+        executor.Shutdown();
+        shutdownReturned = true;
+    }));
+
+    while (!shutdownReturned)
+    {
+        std::this_thread::yield();
+    }
+
+    rejectedFromOutside = !executor.Submit([] {});
+    executor.Shutdown();
+    ASSERT_TRUE(rejectedFromOutside.load());
+}
+
+TEST(WorkStealingExecutorTest, TestReleasingTheLastReferenceFromATaskStillDrainsTheQueues)
+{
+    std::atomic<bool> release(false);
+    std::atomic<int> completed(0);
+    auto executor = Aws::MakeShared<WorkStealingExecutor>("WorkStealingExecutorTest", 2);
+    auto lastReference = executor;
+
+    ASSERT_TRUE(executor->Submit([&]
+    {
+        while (!release)
+        {
+            std::this_thread::yield();
+        }
+
+        //queued on this thread's deque by the executor that is about to be destroyed.
+        lastReference->Submit([&] { ++completed; });
+        lastReference.reset();
+        ++completed;
+    }));
+    executor.reset();
+
+    release = true;
+    for (int i = 0; i < 500 && completed.load() < 2; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_EQ(2, completed.load());
+}
+
+TEST(WorkStealingExecutorTest, TestTasksFromAnotherPoolAreNotTreatedAsContinuations)
+{
+    std::atomic<bool> submitted(false);
+    std::atomic<bool> accepted(false);
+    WorkStealingExecutor target(1);
+    target.Shutdown();
+
+    WorkStealingExecutor other(1);
+    other.Submit([&]
+    {
+        //a thread of another pool is an outside caller, so a shut down executor refuses it.
+        accepted = target.Submit([] {});
+        submitted = true;
+    });
+    other.Shutdown();
+
+    ASSERT_TRUE(submitted.load());
+    ASSERT_FALSE(accepted.load());
+}
+
+//one link of a chain of calls: marshall a request, parse a canned response the way a json client would, then issue the next call.
+static void RunChainedCall(Executor& executor, std::atomic<int>& completed, int remaining)
+{
+    Standard::StandardHttpRequest request(URI("https://dynamodb.us-east-1.amazonaws.com/"), HttpMethod::HTTP_POST);
+    request.SetHeaderValue("x-amz-target", "DynamoDB_20120810.GetItem");
+    request.SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    Standard::StandardHttpResponse response(request);
+    response.GetResponseBody() << "{\"Item\":{\"id\":{\"S\":\"" << remaining << "\"},\"payload\":{\"S\":\"0123456789abcdef\"}}}";
+    Aws::Utils::Json::JsonValue item(response.GetResponseBody());
+
+    ++completed;
+    if (remaining > 1 && item.WasParseSuccessful())
+    {
+        executor.Submit([&executor, &completed, remaining] { RunChainedCall(executor, completed, remaining - 1); });
+    }
+}
+
+//returns calls per second, or 0 if the chains did not all finish within a minute.
+static double MeasureChainedCallsPerSecond(Executor& executor, int chains, int depth)
+{
+    std::atomic<int> completed(0);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < chains; ++i)
+    {
+        executor.Submit([&executor, &completed, depth] { RunChainedCall(executor, completed, depth); });
+    }
+
+    while (completed < chains * depth && std::chrono::steady_clock::now() - start < std::chrono::minutes(1))
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return completed == chains * depth ? chains * depth / elapsed.count() : 0.0;
+}
+
+//benchmark, not run by default: chains of callbacks that each submit the next call, on a plain pool and on the work stealing pool.
+TEST(WorkStealingExecutorTest, DISABLED_BenchmarkChainedCallsAgainstPooledExecutor)
+{
+    static const int CHAINS = 64;
+    static const int DEPTH = 200;
+    static const std::size_t THREADS = 4;
+
+    PooledThreadExecutor pooledExecutor(THREADS, CHAINS * DEPTH);
+    double pooledRate = MeasureChainedCallsPerSecond(pooledExecutor, CHAINS, DEPTH);
+    pooledExecutor.Shutdown();
+
+    WorkStealingExecutor workStealingExecutor(THREADS);
+    double workStealingRate = MeasureChainedCallsPerSecond(workStealingExecutor, CHAINS, DEPTH);
+    workStealingExecutor.Shutdown();
+
+    RecordProperty("PooledCallsPerSecond", static_cast<int>(pooledRate));
+    RecordProperty("WorkStealingCallsPerSecond", static_cast<int>(workStealingRate));
+    ASSERT_GT(pooledRate, 0.0);
+    ASSERT_GT(workStealingRate, 0.0);
+}
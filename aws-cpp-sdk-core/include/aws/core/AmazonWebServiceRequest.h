@@ -22,6 +22,8 @@
 #include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/http/HttpTypes.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/RequestBodySource.h>
+#include <aws/core/utils/Array.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 
@@ -64,6 +66,36 @@ namespace Aws
          * Set the response stream factory.
          */
         void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) { m_responseStreamFactory = AWS_BUILD_FUNCTION(factory); }
+        /**
+         * Writes the body of a successful response into bodySink as it arrives instead of into the response stream, which is then left empty.
+         * Copies of this request share the sink.
+         */
+        inline void SetResponseBodySink(const std::shared_ptr<Aws::Http::ResponseBodySink>& bodySink) { m_responseBodySink = bodySink; }
+        /**
+         * Hands the body of a successful response to callback, chunk by chunk, instead of writing it into the response stream.
+         */
+        void SetResponseBodySink(const Aws::Http::ResponseBodyCallback& callback);
+        /**
+         * Writes the body of a successful response straight into buffer, which the caller owns and must keep alive until the request
+         * completes. Responses whose Content-Length exceeds length fail without touching the buffer.
+         * Returns the sink, which reports how many bytes were written.
+         */
+        std::shared_ptr<Aws::Http::PreallocatedBodySink> SetResponseBuffer(unsigned char* buffer, std::size_t length);
+        /**
+         * Gets the sink the body of a successful response is written to, if any.
+         */
+        inline const std::shared_ptr<Aws::Http::ResponseBodySink>& GetResponseBodySink() const { return m_responseBodySink; }
+        /**
+         * Sends the body from the sources factory creates (one per attempt) instead of from the body stream, for instance straight out of
+         * caller memory or a mapped file. When the request has no body stream, the signature, Content-MD5 and Content-Length are computed
+         * from an extra source read before sending, so every source the factory creates must yield the same bytes.
+         * Copies of this request share the factory.
+         */
+        inline void SetContentBodySourceFactory(const Aws::Http::RequestBodySourceFactory& factory) { m_contentBodySourceFactory = factory; }
+        /**
+         * Gets the factory the body sources are created from, if one was set.
+         */
+        inline const Aws::Http::RequestBodySourceFactory& GetContentBodySourceFactory() const { return m_contentBodySourceFactory; }
         /**
          * Register closure for data recieved event.
          */
@@ -92,11 +124,23 @@ namespace Aws
          * If this is set to true, content-md5 needs to be computed and set on the request
          */
         inline virtual bool ShouldComputeContentMd5() const { return false; }
+        /**
+         * Sets the sha256 digest of the body, for callers that hash the body themselves anyway (for instance to compute its Content-MD5 with
+         * a MultiHash). The signer then uses it instead of reading the body again. Must describe the body exactly.
+         */
+        inline void SetPayloadSha256(const Aws::Utils::ByteBuffer& sha256) { m_payloadSha256 = sha256; }
+        /**
+         * Gets the precomputed sha256 digest of the body; empty if none was set.
+         */
+        inline const Aws::Utils::ByteBuffer& GetPayloadSha256() const { return m_payloadSha256; }
 
 
     private:
 
         Aws::IOStreamFactory m_responseStreamFactory;
+        std::shared_ptr<Aws::Http::ResponseBodySink> m_responseBodySink;
+        Aws::Http::RequestBodySourceFactory m_contentBodySourceFactory;
+        Aws::Utils::ByteBuffer m_payloadSha256;
 
         Aws::Http::DataReceivedEventHandler m_onDataReceived;
         Aws::Http::DataSentEventHandler m_onDataSent;
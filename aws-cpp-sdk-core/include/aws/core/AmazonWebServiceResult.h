@@ -48,13 +48,15 @@ namespace Aws
         AmazonWebServiceResult(const AmazonWebServiceResult& result) :
             m_payload(result.m_payload),
             m_responseHeaders(result.m_responseHeaders),
-            m_responseCode(result.m_responseCode)
+            m_responseCode(result.m_responseCode),
+            m_transferMetrics(result.m_transferMetrics)
         {}
 
         AmazonWebServiceResult(AmazonWebServiceResult&& result) :
             m_payload(std::move(result.m_payload)),
             m_responseHeaders(std::move(result.m_responseHeaders)),
-            m_responseCode(result.m_responseCode)
+            m_responseCode(result.m_responseCode),
+            m_transferMetrics(result.m_transferMetrics)
         {}
 
         /**
@@ -73,11 +75,20 @@ namespace Aws
         * Get the http response code from the response
         */
         inline Http::HttpResponseCode GetResponseCode() const { return m_responseCode; }
+        /**
+        * Get the timing breakdown and byte counts of the http exchange that produced this result
+        */
+        inline const Http::HttpTransferMetrics& GetTransferMetrics() const { return m_transferMetrics; }
+        /**
+        * Set the timing breakdown and byte counts of the http exchange that produced this result
+        */
+        inline void SetTransferMetrics(const Http::HttpTransferMetrics& metrics) { m_transferMetrics = metrics; }
 
     private:
         PAYLOAD_TYPE m_payload;
         Http::HeaderValueCollection m_responseHeaders;
         Http::HttpResponseCode m_responseCode;
+        Http::HttpTransferMetrics m_transferMetrics;
     };
 
 
@@ -18,9 +18,14 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <aws/core/Region.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/crypto/HashContextPool.h>
 #include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 namespace Aws
 {
@@ -49,6 +54,28 @@ namespace Aws
     {
         struct ClientConfiguration;
 
+        /**
+         * How AWSAuthV4Signer covers the request body with the signature.
+         */
+        enum class PayloadSigningPolicy
+        {
+            /**
+             * Hash the whole body before the request is sent, which reads the body one extra time.
+             */
+            SIGN_BODY,
+            /**
+             * Send the body aws-chunked and sign each chunk as the http client pulls it (STREAMING-AWS4-HMAC-SHA256-PAYLOAD), so the body
+             * is read exactly once and may come from a non-seekable source. Only S3 accepts this; the body length must be known up front,
+             * and bodies of unknown length are still signed whole.
+             */
+            SIGN_CHUNKS,
+            /**
+             * Sign UNSIGNED-PAYLOAD instead of a body hash when the request goes over HTTPS, so the body is streamed straight to the
+             * socket without a hashing pass; TLS still protects its integrity. Plain HTTP requests are signed whole. Only S3 accepts this.
+             */
+            UNSIGNED_OVER_HTTPS
+        };
+
         /**
          * Auth Signer interface. Takes a generic AWS request and applies crypto tamper resistent signatures on the request.
          */
@@ -81,7 +108,8 @@ namespace Aws
             * Take credentials provider and uses it for authentication. This constructor
             * is ideal for special credentials providers such as cognito-identity.
             */
-            AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider, const char* serviceName, const Aws::String& region);
+            AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider, const char* serviceName, const Aws::String& region,
+                PayloadSigningPolicy payloadSigningPolicy = PayloadSigningPolicy::SIGN_BODY);
 
             virtual ~AWSAuthV4Signer();
 
@@ -99,16 +127,46 @@ namespace Aws
             */
             bool PresignRequest(Aws::Http::HttpRequest& request, long long expirationInSeconds = 0) const override;
 
+        protected:
+            /**
+            * The current time as yyyyMMddTHHmmssZ, used for X-Amz-Date and the credential scope. Tests override it to pin the clock.
+            */
+            virtual Aws::String GetSigningTimestamp() const;
+
         private:
+            /**
+             * Derived signing key, along with the secret key and date it was derived for.
+             */
+            struct SigningKey;
+            /**
+             * Holds the signing key for a set of credentials and a date while a signing call uses it.
+             */
+            class SigningKeyLease;
+
             Aws::String GenerateSignature(const Aws::Auth::AWSCredentials& credentials, const Aws::String& stringToSign, const Aws::String& simpleDate) const;
+            SigningKey* PublishSigningKey(const Aws::Auth::AWSCredentials& credentials, const Aws::String& simpleDate) const;
+            void ReclaimRetiredSigningKeys() const;
+            Aws::Utils::ByteBuffer ComputeSigningKey(const Aws::String& secretKey, const Aws::String& simpleDate) const;
             Aws::String ComputePayloadHash(Aws::Http::HttpRequest&) const;
+            int64_t GetChunkablePayloadLength(const Aws::Http::HttpRequest& request) const;
             Aws::String GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& canonicalRequestHash) const;
+            void AppendCredentialScope(const Aws::String& simpleDate, Aws::String& output) const;
 
             std::shared_ptr<Auth::AWSCredentialsProvider> m_credentialsProvider;
             Aws::String m_serviceName;
             Aws::String m_region;
-            Aws::UniquePtr<Aws::Utils::Crypto::Sha256> m_hash;
-            Aws::UniquePtr<Aws::Utils::Crypto::Sha256HMAC> m_HMAC;
+            PayloadSigningPolicy m_payloadSigningPolicy;
+            //SignRequest runs on many threads at once; each call borrows its own hash objects.
+            mutable Aws::Utils::Crypto::HashContextPool<Aws::Utils::Crypto::Sha256> m_hashes;
+            mutable Aws::Utils::Crypto::HashContextPool<Aws::Utils::Crypto::Sha256HMAC> m_HMACs;
+            //region and service are fixed per signer, so the key only changes with the date or when credentials rotate.
+            //A published key is never modified. Readers count themselves in m_signingKeyReaders before loading the pointer and take no
+            //lock. A replaced key is retired instead of deleted, and retired keys are only deleted once no reader is counted.
+            mutable std::atomic<SigningKey*> m_signingKey;
+            mutable std::atomic<int> m_signingKeyReaders;
+            mutable std::atomic<bool> m_hasRetiredSigningKeys;
+            mutable std::mutex m_retiredSigningKeysLock;
+            mutable Aws::Vector<SigningKey*> m_retiredSigningKeys;
         };
 
     } // namespace Client
@@ -22,8 +22,14 @@
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <random>
+#include <thread>
 
 namespace Aws
 {
@@ -160,6 +166,72 @@ namespace Aws
             long long m_lastLoadedMs;
         };
 
+        /**
+         * Base class for providers that load credentials from a slow source such as a file or a web service. The loaded credentials
+         * are published through a shared_ptr swapped with std::atomic_load/atomic_store, so once they are available GetAWSCredentials
+         * never waits for a load. Those atomics are not lock free for shared_ptr (libstdc++ guards them with a small pool of mutexes),
+         * but that lock is only held to copy the pointer.
+         *
+         * The first call to GetAWSCredentials loads the credentials synchronously. Once a load has produced credentials, the provider
+         * is handed to a refresh thread shared by every provider in the process, which reloads them a little ahead of every refresh
+         * interval, with random jitter so that many providers don't hit the source at the same moment. Callers keep getting the
+         * previous credentials while a reload is in flight. A provider whose source has had nothing so far is not refreshed in the
+         * background; callers try the source again at most once per refresh interval.
+         *
+         * Derived classes implement LoadCredentials and must call StopRefreshing from their destructor, before any member used by
+         * LoadCredentials is destroyed.
+         */
+        class AWS_CORE_API BackgroundRefreshingAWSCredentialsProvider : public AWSCredentialsProvider
+        {
+        public:
+            /**
+             * refreshRateMs is how long loaded credentials are used before they are reloaded. 0 or less loads them only once.
+             */
+            BackgroundRefreshingAWSCredentialsProvider(long refreshRateMs);
+
+            virtual ~BackgroundRefreshingAWSCredentialsProvider();
+
+            /**
+             * Returns the most recently loaded credentials, loading them first if this is the first call.
+             */
+            AWSCredentials GetAWSCredentials() override;
+
+        protected:
+            /**
+             * Loads the credentials from their source. Called by GetAWSCredentials until it returns credentials, then from the shared
+             * refresh thread; never called concurrently with itself.
+             */
+            virtual AWSCredentials LoadCredentials() = 0;
+
+            /**
+             * How long to keep the credentials that were just loaded before reloading them. Called on the refresh thread after every
+             * load; the default is the refresh rate the provider was created with. Jitter is taken off whatever this returns.
+             */
+            virtual long GetRefreshIntervalMs() const;
+
+            /**
+             * Takes the provider off the shared refresh thread, waiting for a reload that is already running. Safe to call more than once.
+             */
+            void StopRefreshing();
+
+        private:
+            class RefreshScheduler;
+
+            bool ShouldLoad(const std::shared_ptr<const AWSCredentials>& credentials) const;
+            void Publish(const AWSCredentials& credentials);
+            std::chrono::milliseconds Refresh();
+            std::chrono::milliseconds NextRefreshDelay();
+
+            std::shared_ptr<const AWSCredentials> m_credentials;
+            long m_loadFrequencyMs;
+            std::minstd_rand m_jitter;
+            std::mutex m_refreshMutex;
+            //steady clock milliseconds before which a provider that has no credentials won't try its source again.
+            std::atomic<long long> m_nextLoadAttemptMs;
+            bool m_scheduled;
+            bool m_stopRefresh;
+        };
+
         /**
          * Simply a provider that always returns empty credentials. This is useful for a client that needs to make unsigned
          * calls.
@@ -225,12 +297,13 @@ namespace Aws
         };
 
         /**
-        * Reads credentials profile from the default Profile Config File. Refreshes at set interval for credential rotation.
+        * Reads credentials profile from the default Profile Config File. Checks the file at set interval for credential rotation and
+        * only reparses it when its size or last write time changed.
         * Looks for environment variables AWS_SHARED_CREDENTIALS_FILE and AWS_PROFILE. If they aren't found, then it defaults
         * to ~/.aws/credentials and default. Optionally a user can specify the profile and it will override the environment variable
         * and defaults. To alter the file this pulls from, then the user should alter the AWS_SHARED_CREDENTIALS_FILE variable.
         */
-        class AWS_CORE_API ProfileConfigFileAWSCredentialsProvider : public AWSCredentialsProvider
+        class AWS_CORE_API ProfileConfigFileAWSCredentialsProvider : public BackgroundRefreshingAWSCredentialsProvider
         {
         public:
 
@@ -245,10 +318,7 @@ namespace Aws
             */
             ProfileConfigFileAWSCredentialsProvider(const char* profile, long refreshRateMs = REFRESH_THRESHOLD);
 
-            /**
-            * Retrieves the credentials if found, otherwise returns empty credential set.
-            */
-            AWSCredentials GetAWSCredentials() override;
+            ~ProfileConfigFileAWSCredentialsProvider();
 
             /**
              * Returns the fullpath of the calculated profile file
@@ -265,26 +335,30 @@ namespace Aws
              */
             static Aws::String GetProfileDirectory();
 
-        private:
-
+        protected:
             /**
-            * Checks to see if the refresh interval has expired and reparses the file if it has.
+            * Parses the file if it changed since it was last parsed and returns the credentials for the profile if found, otherwise
+            * an empty credential set.
             */
-            void RefreshIfExpired();
+            AWSCredentials LoadCredentials() override;
+
+        private:
             static Aws::Map<Aws::String, Aws::String> ParseProfileConfigFile(const Aws::String& filename);
 
             Aws::String m_fileName;
             Aws::String m_profileToUse;
-            std::shared_ptr<AWSCredentials> m_credentials;
-            mutable std::mutex m_reloadMutex;
-            long m_loadFrequencyMs;
+            std::shared_ptr<const Aws::Map<Aws::String, Aws::String>> m_profiles;
+            bool m_fileExists;
+            uint64_t m_fileSize;
+            int64_t m_fileModificationTime;
         };
 
         /**
         * Credentials provider implementation that loads credentials from the Amazon
-        * EC2 Instance Metadata Service.
+        * EC2 Instance Metadata Service. Credentials are reloaded a few minutes before the Expiration the service reports; the refresh
+        * rate is only used when the service doesn't report one. If a reload fails, the previous credentials are kept until they expire.
         */
-        class AWS_CORE_API InstanceProfileCredentialsProvider : public AWSCredentialsProvider
+        class AWS_CORE_API InstanceProfileCredentialsProvider : public BackgroundRefreshingAWSCredentialsProvider
         {
         public:
             /**
@@ -299,18 +373,23 @@ namespace Aws
              */
             InstanceProfileCredentialsProvider(const std::shared_ptr<Internal::EC2MetadataClient>&, long refreshRateMs = REFRESH_THRESHOLD);
 
+            ~InstanceProfileCredentialsProvider();
+
+        protected:
             /**
-            * Retrieves the credentials if found, otherwise returns empty credential set.
+            * Pulls the credentials from the metadata service, returns an empty credential set if they could not be found.
             */
-            AWSCredentials GetAWSCredentials() override;
+            AWSCredentials LoadCredentials() override;
 
-        private:
-            void RefreshIfExpired();
+            /**
+            * Time left until shortly before the last credentials expire, or the refresh rate if their expiration is unknown.
+            */
+            long GetRefreshIntervalMs() const override;
 
+        private:
             std::shared_ptr<Internal::EC2MetadataClient> m_metadataClient;
-            std::shared_ptr<AWSCredentials> m_credentials;
-            long m_loadFrequencyMs;
-            mutable std::mutex m_reloadMutex;
+            AWSCredentials m_lastCredentials;
+            double m_expiration;
         };
     } // namespace Auth
 } // namespace Aws
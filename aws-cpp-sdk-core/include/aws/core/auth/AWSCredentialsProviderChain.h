@@ -18,6 +18,7 @@
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <atomic>
 #include <memory>
 
 namespace Aws
@@ -27,6 +28,8 @@ namespace Aws
         /**
          * Abstract class for providing chains of credentials providers. When a credentials provider in the chain returns empty credentials,
          * We go on to the next provider until we have either exhausted the installed providers in the chain or something returns non-empty credentials.
+         * The provider that last returned credentials is asked first on the next call, and the chain is only walked again when it returns
+         * empty credentials.
          */
         class AWS_CORE_API AWSCredentialsProviderChain : public AWSCredentialsProvider
         {
@@ -43,7 +46,7 @@ namespace Aws
             /**
              * This class is only allowed to be initialized by subclasses.
              */
-            AWSCredentialsProviderChain() = default;
+            AWSCredentialsProviderChain();
 
             /**
              * Adds a provider to the back of the chain.
@@ -52,6 +55,7 @@ namespace Aws
 
         private:            
             Aws::Vector<std::shared_ptr<AWSCredentialsProvider> > m_providerChain;
+            std::atomic<std::size_t> m_lastProviderIndex;
         };
 
         /**
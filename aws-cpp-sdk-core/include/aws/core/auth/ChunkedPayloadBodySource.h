@@ -0,0 +1,92 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/http/RequestBodySource.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <memory>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            class Sha256;
+            class Sha256HMAC;
+        } // namespace Crypto
+    } // namespace Utils
+
+    namespace Client
+    {
+        /**
+         * Encodes a payload as aws-chunked while the http client pulls it, signing every chunk with the signature of the one before it,
+         * starting from the signature of the request headers. See
+         * http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-streaming.html
+         */
+        class AWS_CORE_API ChunkedPayloadBodySource : public Aws::Http::RequestBodySource
+        {
+        public:
+            /**
+             * Payload bytes per chunk. S3 requires at least 8KB for every chunk but the last.
+             */
+            static const std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+            /**
+             * payload supplies payloadLength bytes. signingKey, dateValue (x-amz-date) and credentialScope are those the request
+             * headers were signed with, and seedSignature is the resulting hex signature.
+             */
+            ChunkedPayloadBodySource(const std::shared_ptr<Aws::Http::RequestBodySource>& payload, int64_t payloadLength,
+                const Aws::Utils::ByteBuffer& signingKey, const Aws::String& dateValue, const Aws::String& credentialScope,
+                const Aws::String& seedSignature, std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+            ~ChunkedPayloadBodySource();
+
+            std::size_t Read(char* buffer, std::size_t length) override;
+
+            int64_t GetRemainingLength() const override { return m_remainingLength; }
+
+            /**
+             * Content-Length of the encoded body for a payload of payloadLength bytes.
+             */
+            static int64_t ComputeEncodedLength(int64_t payloadLength, std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+        private:
+            bool EncodeNextChunk();
+            bool SignChunk(Aws::String& signature);
+
+            std::shared_ptr<Aws::Http::RequestBodySource> m_payload;
+            int64_t m_payloadRemaining;
+            Aws::Utils::ByteBuffer m_signingKey;
+            Aws::String m_stringToSignPrefix;
+            Aws::String m_previousSignature;
+            std::size_t m_chunkSize;
+            Aws::String m_chunkData;
+            Aws::String m_encodedChunk;
+            std::size_t m_encodedPosition;
+            int64_t m_remainingLength;
+            bool m_finished;
+            Aws::UniquePtr<Aws::Utils::Crypto::Sha256> m_hash;
+            Aws::UniquePtr<Aws::Utils::Crypto::Sha256HMAC> m_HMAC;
+        };
+
+    } // namespace Client
+} // namespace Aws
@@ -17,11 +17,16 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/RequestInterceptor.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/RequestBodySource.h>
+#include <aws/core/utils/crypto/HashContextPool.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <memory>
 #include <atomic>
+#include <functional>
 
 namespace Aws
 {
@@ -49,6 +54,11 @@ namespace Aws
         {
             class MD5;
         } // namespace Crypto
+
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
     } // namespace Utils
 
     namespace Http
@@ -77,6 +87,8 @@ namespace Aws
 
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
+        typedef std::function<void(HttpResponseOutcome&&)> HttpResponseOutcomeHandler;
+        typedef std::function<void(StreamOutcome&&)> StreamOutcomeHandler;
 
         /**
          * Abstract AWS Client. Contains most of the functionality necessary to build an http request, get it signed, and send it accross the wire.
@@ -116,6 +128,12 @@ namespace Aws
              */
             void EnableRequestProcessing();
 
+            /**
+             * Opens up to connections connections to endpoint (e.g. https://dynamodb.us-east-1.amazonaws.com) before traffic arrives,
+             * so the first burst of requests does not land on cold sockets. Returns the number of connections that were opened.
+             */
+            unsigned PrewarmConnections(const Aws::String& endpoint, unsigned connections);
+
         protected:
             /**
              * Calls AttemptOnRequest until it either, succeeds, runs out of retries from the retry strategy,
@@ -123,13 +141,14 @@ namespace Aws
              */
             HttpResponseOutcome AttemptExhaustively(const Aws::String& uri,
                 const Aws::AmazonWebServiceRequest& request,
-                Http::HttpMethod httpMethod) const;
+                Http::HttpMethod httpMethod,
+                RequestInterceptorContext& context) const;
 
             /**
              * Calls AttemptOnRequest until it either, succeeds, runs out of retries from the retry strategy,
              * or encounters and error that is not retryable. This method is for payloadless requests e.g. GET, DELETE, HEAD
              */
-            HttpResponseOutcome AttemptExhaustively(const Aws::String& uri, Http::HttpMethod httpMethod) const;
+            HttpResponseOutcome AttemptExhaustively(const Aws::String& uri, Http::HttpMethod httpMethod, RequestInterceptorContext& context) const;
 
             /**
              * Constructs and Http Request from the uri and AmazonWebServiceRequest object. Signs the request, sends it accross the wire
@@ -137,27 +156,57 @@ namespace Aws
              */
             HttpResponseOutcome AttemptOneRequest(const Aws::String& uri,
                 const Aws::AmazonWebServiceRequest& request,
-                Http::HttpMethod httpMethod) const;
+                Http::HttpMethod httpMethod,
+                RequestInterceptorContext& context) const;
 
             /**
             * Constructs and Http Request from the uri and AmazonWebServiceRequest object. Signs the request, sends it accross the wire
             * then reports the http response. This method is for payloadless requests e.g. GET, DELETE, HEAD
             */
-            HttpResponseOutcome AttemptOneRequest(const Aws::String& uri, Http::HttpMethod httpMethod) const;
+            HttpResponseOutcome AttemptOneRequest(const Aws::String& uri, Http::HttpMethod httpMethod, RequestInterceptorContext& context) const;
+
+            /**
+             * Asynchronous AttemptExhaustively. Every attempt goes through the http client's MakeRequestAsync and every backoff through
+             * its ScheduleRetry, so with an event driven http client no thread waits on the call while it is in flight.
+             * request is null for payloadless requests. onComplete is called once, either on the calling thread or on a thread of
+             * the configured executor. The client must outlive the call.
+             */
+            void AttemptExhaustivelyAsync(const Aws::String& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                Http::HttpMethod httpMethod,
+                const std::shared_ptr<RequestInterceptorContext>& context,
+                const HttpResponseOutcomeHandler& onComplete) const;
 
             /**
              * This is used for structureless response payloads (file streams, binary data etc...). It calls AttemptExhaustively, but upon
-             * return transfers ownership of the underlying stream for the http response to the caller.
+             * return transfers ownership of the underlying stream for the http response to the caller. requestName is the modeled
+             * operation name that interceptors see.
              */
             StreamOutcome MakeRequestWithUnparsedResponse(const Aws::String& uri,
                 const Aws::AmazonWebServiceRequest& request,
-                Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* requestName = nullptr) const;
+
+            /**
+             * Asynchronous MakeRequestWithUnparsedResponse. handler is called as described on AttemptExhaustivelyAsync.
+             */
+            void MakeRequestWithUnparsedResponseAsync(const Aws::String& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                Http::HttpMethod method,
+                const char* requestName,
+                const StreamOutcomeHandler& handler) const;
 
             /**
              * Abstract.  Subclassing clients should override this to tell the client how to marshall error payloads
              */
             virtual AWSError<CoreErrors> BuildAWSError(const std::shared_ptr<Aws::Http::HttpResponse>& response) const = 0;
 
+            /**
+             * The error *Callable and *Async operations complete with when the client's executor refuses to take the call, e.g. a
+             * PooledThreadExecutor with a full queue and OverflowPolicy::REJECT_IMMEDIATELY. It is retryable.
+             */
+            static AWSError<CoreErrors> BuildExecutorRejectedError();
+
             /**
              * Transforms the AmazonWebServicesResult object into an HttpRequest.
              */
@@ -172,10 +221,40 @@ namespace Aws
                 return m_errorMarshaller;
             }
 
+            /**
+             * Tells every registered interceptor that phase is about to start.
+             */
+            void NotifyBeforePhase(RequestInterceptorContext& context, RequestPhase phase) const;
+
+            /**
+             * Tells every registered interceptor that phase has ended.
+             */
+            void NotifyAfterPhase(const RequestInterceptorContext& context, RequestPhase phase, bool succeeded) const;
+
+            /**
+             * Tells every registered interceptor that the call has finished.
+             */
+            void NotifyComplete(const RequestInterceptorContext& context, bool succeeded) const;
+
         private:
+            struct AsyncCall;
+
+            /**
+             * Builds the http request, from request unless it is null, and signs it. Returns nullptr if signing failed.
+             */
+            std::shared_ptr<Aws::Http::HttpRequest> BuildAndSignHttpRequest(const Aws::String& uri, const Aws::AmazonWebServiceRequest* request,
+                Http::HttpMethod method, RequestInterceptorContext& context) const;
+            HttpResponseOutcome BuildHttpResponseOutcome(const std::shared_ptr<Aws::Http::HttpResponse>& httpResponse, RequestInterceptorContext& context) const;
+            StreamOutcome BuildStreamOutcome(const HttpResponseOutcome& httpResponseOutcome) const;
+            void AttemptOneRequestAsync(const std::shared_ptr<AsyncCall>& call) const;
+            void OnAsyncResponse(const std::shared_ptr<AsyncCall>& call, const std::shared_ptr<Aws::Http::HttpResponse>& httpResponse) const;
+            //runs step right away on the thread that started the call, and on the executor anywhere else (such as an http event loop)
+            void RunAsyncStep(const std::shared_ptr<AsyncCall>& call, const std::function<void()>& step) const;
             void AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const Http::HeaderValueCollection& headerValues) const;
             void AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
                                          const std::shared_ptr<Aws::IOStream>& body, bool needsContentMd5 = false) const;
+            void AddContentBodySourceToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
+                                               const Aws::Http::RequestBodySourceFactory& factory, bool needsContentMd5) const;
             void AddCommonHeaders(Aws::Http::HttpRequest& httpRequest) const;
             void InitializeGlobalStatics();
             void CleanupGlobalStatics();
@@ -185,15 +264,19 @@ namespace Aws
             std::shared_ptr<Aws::Client::AWSAuthSigner> m_signer;
             std::shared_ptr<AWSErrorMarshaller> m_errorMarshaller;
             std::shared_ptr<RetryStrategy> m_retryStrategy;
+            Aws::Vector<std::shared_ptr<RequestInterceptor>> m_interceptors;
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_completionExecutor;
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> m_writeRateLimiter;
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> m_readRateLimiter;
             Aws::String m_userAgent;
             const char* m_hostHeaderOverride;
-            Aws::UniquePtr<Aws::Utils::Crypto::MD5> m_hash;
+            //requests are built on many threads at once; each borrows its own md5.
+            mutable Aws::Utils::Crypto::HashContextPool<Aws::Utils::Crypto::MD5> m_hashes;
             static std::atomic<int> s_refCount;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonValue>, AWSError<CoreErrors>> JsonOutcome;
+        typedef std::function<void(JsonOutcome&&)> JsonOutcomeHandler;
 
         /**
          *  AWSClient that handles marshalling json response bodies. You would inherit from this class
@@ -225,24 +308,46 @@ namespace Aws
              * Returns a Json document or an error from the request. Does some marshalling json and raw streams,
              * then just calls AttemptExhaustively.
              *
-             * method defaults to POST
+             * method defaults to POST. requestName is the modeled operation name that interceptors see.
              */
             JsonOutcome MakeRequest(const Aws::String& uri,
                 const Aws::AmazonWebServiceRequest& request,
-                Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* requestName = nullptr) const;
 
             /**
              * Returns a Json document or an error from the request. Does some marshalling json and raw streams,
              * then just calls AttemptExhaustively.
              *
-             * method defaults to POST
+             * method defaults to POST. requestName is the modeled operation name that interceptors see.
              */
             JsonOutcome MakeRequest(const Aws::String& uri,
-                Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* requestName = nullptr) const;
+
+            /**
+             * Asynchronous MakeRequest. handler is called with the Json document or the error as described on AttemptExhaustivelyAsync.
+             */
+            void MakeRequestAsync(const Aws::String& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                Http::HttpMethod method,
+                const char* requestName,
+                const JsonOutcomeHandler& handler) const;
+
+            /**
+             * Asynchronous MakeRequest for payloadless requests.
+             */
+            void MakeRequestAsync(const Aws::String& uri,
+                Http::HttpMethod method,
+                const char* requestName,
+                const JsonOutcomeHandler& handler) const;
 
+        private:
+            JsonOutcome BuildJsonOutcome(const HttpResponseOutcome& httpOutcome, RequestInterceptorContext& context, bool failOnParseError) const;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Xml::XmlDocument>, AWSError<CoreErrors>> XmlOutcome;
+        typedef std::function<void(XmlOutcome&&)> XmlOutcomeHandler;
 
         /**
         *  AWSClient that handles marshalling xml response bodies. You would inherit from this class
@@ -272,20 +377,42 @@ namespace Aws
              * Returns an xml document or an error from the request. Does some marshalling xml and raw streams,
              * then just calls AttemptExhaustively.
              *
-             * method defaults to POST
+             * method defaults to POST. requestName is the modeled operation name that interceptors see.
              */
             XmlOutcome MakeRequest(const Aws::String& uri,
                 const Aws::AmazonWebServiceRequest& request,
-                Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* requestName = nullptr) const;
 
             /**
              * Returns an xml document or an error from the request. Does some marshalling xml and raw streams,
              * then just calls AttemptExhaustively.
              *
-             * method defaults to POST
+             * method defaults to POST. requestName is the modeled operation name that interceptors see.
              */
             XmlOutcome MakeRequest(const Aws::String& uri,
-                Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                const char* requestName = nullptr) const;
+
+            /**
+             * Asynchronous MakeRequest. handler is called with the xml document or the error as described on AttemptExhaustivelyAsync.
+             */
+            void MakeRequestAsync(const Aws::String& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                Http::HttpMethod method,
+                const char* requestName,
+                const XmlOutcomeHandler& handler) const;
+
+            /**
+             * Asynchronous MakeRequest for payloadless requests.
+             */
+            void MakeRequestAsync(const Aws::String& uri,
+                Http::HttpMethod method,
+                const char* requestName,
+                const XmlOutcomeHandler& handler) const;
+
+        private:
+            XmlOutcome BuildXmlOutcome(const HttpResponseOutcome& httpOutcome, RequestInterceptorContext& context, bool failOnParseError) const;
         };
 
     } // namespace Client
@@ -17,6 +17,7 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/http/HttpTypes.h>
 
 namespace Aws
 {
@@ -48,7 +49,8 @@ namespace Aws
 
             //by policy we enforce all clients to contain a CoreErrors alignment for their Errors.
             AWSError(const AWSError<CoreErrors>& rhs) :
-                m_errorType(static_cast<ERROR_TYPE>(rhs.GetErrorType())), m_exceptionName(rhs.GetExceptionName()), m_message(rhs.GetMessage()), m_isRetryable(rhs.ShouldRetry())
+                m_errorType(static_cast<ERROR_TYPE>(rhs.GetErrorType())), m_exceptionName(rhs.GetExceptionName()), m_message(rhs.GetMessage()), m_isRetryable(rhs.ShouldRetry()),
+                m_transferMetrics(rhs.GetTransferMetrics())
             {}
 
             /**
@@ -75,12 +77,22 @@ namespace Aws
              * returns whether or not this error is eligible for retry.
              */
             inline bool ShouldRetry() const { return m_isRetryable; }
+            /**
+             * Gets the timing breakdown and byte counts of the http exchange that failed, including exchanges that never got a response.
+             * All -1 if the request was never sent.
+             */
+            inline const Aws::Http::HttpTransferMetrics& GetTransferMetrics() const { return m_transferMetrics; }
+            /**
+             * Sets the timing breakdown and byte counts of the http exchange that failed.
+             */
+            inline void SetTransferMetrics(const Aws::Http::HttpTransferMetrics& metrics) { m_transferMetrics = metrics; }
 
         private:
             ERROR_TYPE m_errorType;
             Aws::String m_exceptionName;
             Aws::String m_message;
             bool m_isRetryable;
+            Aws::Http::HttpTransferMetrics m_transferMetrics;
         };
 
     } // namespace Client
@@ -16,9 +16,11 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/auth/AWSAuthSigner.h>
 #include <aws/core/http/Scheme.h>
 #include <aws/core/Region.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/http/HttpTypes.h>
 #include <memory>
 
@@ -40,6 +42,7 @@ namespace Aws
     namespace Client
     {
         class RetryStrategy; // forward declare
+        class RequestInterceptor;
 
         /**
           * This mutable structure is used to configure any of the AWS clients.
@@ -102,7 +105,8 @@ namespace Aws
             */
             Aws::String proxyPassword;
             /**
-            * Threading Executor implementation. Default uses std::thread::detach()
+            * Threading Executor implementation. Default uses std::thread::detach(); use a PooledThreadExecutor to bound the number of threads
+            * and queued tasks under load.
             */
             std::shared_ptr<Aws::Utils::Threading::Executor> executor;
             /**
@@ -131,6 +135,46 @@ namespace Aws
              * If set to true the http stack will follow 300 redirect codes.
              */
             bool followRedirects;
+            /**
+             * Number of event loop threads used to drive transfers when httpLibOverride is CURL_MULTI_CLIENT.
+             * Each loop multiplexes all of its in-flight requests on a single thread. Default 1.
+             */
+            unsigned httpEventLoopThreads;
+            /**
+             * Share DNS lookups and TLS sessions between all connections of a client (PER_CLIENT), or between every client in the
+             * process that asks for PROCESS_WIDE. New connections then skip the DNS lookup and resume TLS sessions instead of
+             * performing full handshakes. Default NONE.
+             */
+            Aws::Http::ConnectionCacheSharing connectionCacheSharing;
+            /**
+             * Connections left unused for longer than this are closed by a background thread instead of being reused
+             * after the server may have dropped them. 0 keeps idle connections indefinitely. Default 0.
+             */
+            long connectionIdleTimeoutMs;
+            /**
+             * Connections older than this are closed once they are released, regardless of use. 0 disables the limit. Default 0.
+             */
+            long connectionMaxAgeMs;
+            /**
+             * Http protocol version to negotiate. With HTTP_2_TLS the CURL_MULTI_CLIENT multiplexes concurrent requests to a host as streams
+             * over a few shared connections; maxConnections then bounds connections rather than requests in flight. Default DEFAULT.
+             */
+            Aws::Http::HttpVersion httpVersion;
+            /**
+             * Most concurrent requests multiplexed over one HTTP/2 connection. Servers may advertise a lower limit, which takes precedence.
+             * Only used with HTTP_2_TLS. Default 100.
+             */
+            unsigned maxStreamsPerConnection;
+            /**
+             * Called, in order, around every phase of every call the client makes; see RequestInterceptor. Default empty.
+             */
+            Aws::Vector<std::shared_ptr<RequestInterceptor>> interceptors;
+            /**
+             * How S3 clients sign request bodies; SIGN_CHUNKS streams uploads aws-chunked instead of reading them twice, and
+             * UNSIGNED_OVER_HTTPS skips hashing the body on TLS connections. Other services accept neither and always sign the whole
+             * body. Default SIGN_BODY.
+             */
+            PayloadSigningPolicy payloadSigningPolicy;
         };
 
     } // namespace Client
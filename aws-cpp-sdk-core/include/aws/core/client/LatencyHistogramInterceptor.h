@@ -0,0 +1,141 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/RequestInterceptor.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Lock free histogram of durations in microseconds. Buckets are log-linear: every power of two is split into 8 buckets, so a
+         * percentile is reported within 12.5% of the real value. Safe to record into from any number of threads.
+         */
+        class AWS_CORE_API LatencyHistogram
+        {
+        public:
+            LatencyHistogram();
+
+            LatencyHistogram(const LatencyHistogram&) = delete;
+            LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+            /**
+             * Adds one sample.
+             */
+            void Record(uint64_t microseconds);
+
+            /**
+             * Number of samples recorded.
+             */
+            inline uint64_t GetCount() const { return m_count.load(std::memory_order_relaxed); }
+            /**
+             * Sum of all samples, for computing the mean.
+             */
+            inline uint64_t GetSum() const { return m_sum.load(std::memory_order_relaxed); }
+            /**
+             * Largest sample recorded.
+             */
+            inline uint64_t GetMax() const { return m_max.load(std::memory_order_relaxed); }
+            /**
+             * Upper bound of the bucket holding the given percentile (0 - 100) of samples, or 0 if there are none.
+             */
+            uint64_t GetPercentile(double percentile) const;
+
+            static const unsigned SUB_BUCKET_BITS = 3;
+            static const unsigned SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+            //durations are clamped to 2^40 microseconds, about 12 days.
+            static const unsigned MAX_EXPONENT = 40;
+            static const unsigned BUCKET_COUNT = SUB_BUCKETS + (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+        private:
+            static unsigned GetBucketIndex(uint64_t microseconds);
+            static uint64_t GetBucketUpperBound(unsigned index);
+
+            std::atomic<uint64_t> m_buckets[BUCKET_COUNT];
+            std::atomic<uint64_t> m_count;
+            std::atomic<uint64_t> m_sum;
+            std::atomic<uint64_t> m_max;
+        };
+
+        /**
+         * Latency of every phase of one operation, the end to end latency of its calls, and how often they were retried or failed.
+         */
+        class AWS_CORE_API OperationLatency
+        {
+        public:
+            OperationLatency(const Aws::String& operationName);
+
+            inline const Aws::String& GetOperationName() const { return m_operationName; }
+            inline const LatencyHistogram& GetPhaseLatency(RequestPhase phase) const { return m_phases[static_cast<unsigned>(phase)]; }
+            /**
+             * From the start of the call until it completed, including retries.
+             */
+            inline const LatencyHistogram& GetTotalLatency() const { return m_total; }
+            inline uint64_t GetRetryCount() const { return m_retries.load(std::memory_order_relaxed); }
+            inline uint64_t GetFailureCount() const { return m_failures.load(std::memory_order_relaxed); }
+
+        private:
+            friend class LatencyHistogramInterceptor;
+
+            Aws::String m_operationName;
+            LatencyHistogram m_phases[REQUEST_PHASE_COUNT];
+            LatencyHistogram m_total;
+            std::atomic<uint64_t> m_retries;
+            std::atomic<uint64_t> m_failures;
+        };
+
+        /**
+         * Interceptor that records per operation latency histograms for every phase and for whole calls, along with retry and failure
+         * counts. Recording never takes a lock. Up to MAX_OPERATIONS distinct operations are tracked; any beyond that are folded into
+         * one entry named OTHER_OPERATIONS.
+         */
+        class AWS_CORE_API LatencyHistogramInterceptor : public RequestInterceptor
+        {
+        public:
+            LatencyHistogramInterceptor();
+            ~LatencyHistogramInterceptor();
+
+            void AfterPhase(const RequestInterceptorContext& context, RequestPhase phase, std::chrono::steady_clock::time_point time,
+                            bool succeeded) override;
+            void OnComplete(const RequestInterceptorContext& context, std::chrono::steady_clock::time_point time, bool succeeded) override;
+
+            /**
+             * Names of the operations seen so far.
+             */
+            Aws::Vector<Aws::String> GetOperationNames() const;
+            /**
+             * Latencies recorded for operationName, or nullptr if it has not been seen. The returned object lives as long as the interceptor.
+             */
+            const OperationLatency* GetOperationLatency(const Aws::String& operationName) const;
+
+            static const unsigned MAX_OPERATIONS = 128;
+            static const char* OTHER_OPERATIONS;
+
+        private:
+            OperationLatency* FindOrAddOperation(const Aws::String& operationName);
+
+            std::atomic<OperationLatency*> m_operations[MAX_OPERATIONS];
+            OperationLatency m_otherOperations;
+        };
+
+    } // namespace Client
+} // namespace Aws
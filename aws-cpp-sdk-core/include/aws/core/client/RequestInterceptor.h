@@ -0,0 +1,169 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/UnreferencedParam.h>
+
+#include <memory>
+#include <chrono>
+#include <cstdint>
+
+namespace Aws
+{
+    class AmazonWebServiceRequest;
+
+    namespace Http
+    {
+        class HttpRequest;
+        class HttpResponse;
+    } // namespace Http
+
+    namespace Client
+    {
+        /**
+         * The steps AWSClient goes through for every call. SERIALIZE, SIGN and TRANSMIT run once per attempt, DESERIALIZE once the
+         * final response is in (or for every failed attempt, to build its error), and RETRY_DELAY is the backoff before another attempt.
+         */
+        enum class RequestPhase
+        {
+            SERIALIZE,
+            SIGN,
+            TRANSMIT,
+            DESERIALIZE,
+            RETRY_DELAY
+        };
+
+        /**
+         * Number of values in RequestPhase.
+         */
+        static const unsigned REQUEST_PHASE_COUNT = 5;
+
+        /**
+         * What interceptors get to see of a call in progress. Created by AWSClient for every call and filled in as the call proceeds.
+         */
+        class AWS_CORE_API RequestInterceptorContext
+        {
+        public:
+            /**
+             * request is the modeled request being sent, or nullptr for payloadless calls. operationName is the modeled name of the
+             * operation; when it is nullptr the name is derived from the http request instead.
+             */
+            RequestInterceptorContext(const AmazonWebServiceRequest* request, const char* operationName = nullptr);
+
+            /**
+             * Process-wide unique, monotonically increasing id of this call.
+             */
+            inline uint64_t GetInvocationId() const { return m_invocationId; }
+            /**
+             * When the call started.
+             */
+            inline std::chrono::steady_clock::time_point GetStartTime() const { return m_startTime; }
+            /**
+             * The modeled request, or nullptr for payloadless calls.
+             */
+            inline const AmazonWebServiceRequest* GetRequest() const { return m_request; }
+            /**
+             * The http request of the current attempt, once it has been serialized. Interceptors may add headers to it
+             * (e.g. trace context) before it is signed.
+             */
+            inline const std::shared_ptr<Http::HttpRequest>& GetHttpRequest() const { return m_httpRequest; }
+            /**
+             * The http response of the current attempt, once it has arrived. nullptr if the attempt never got a response.
+             */
+            inline const std::shared_ptr<Http::HttpResponse>& GetHttpResponse() const { return m_httpResponse; }
+            /**
+             * Name of the operation being called, e.g. "GetObject". Generated clients always supply it; for other callers it falls back
+             * to the X-Amz-Target operation for json services and to the http method otherwise.
+             */
+            inline const Aws::String& GetOperationName() const { return m_operationName; }
+            /**
+             * The request id the service assigned to the current attempt, empty until a response with one has arrived.
+             */
+            inline const Aws::String& GetRequestId() const { return m_requestId; }
+            /**
+             * Retries made so far; 0 during the first attempt.
+             */
+            inline long GetAttempt() const { return m_attempt; }
+            /**
+             * When the most recent run of phase started, so AfterPhase can tell how long it took.
+             */
+            inline std::chrono::steady_clock::time_point GetPhaseStartTime(RequestPhase phase) const { return m_phaseStartTimes[static_cast<unsigned>(phase)]; }
+
+            void SetHttpRequest(const std::shared_ptr<Http::HttpRequest>& httpRequest);
+            void SetHttpResponse(const std::shared_ptr<Http::HttpResponse>& httpResponse);
+            inline void SetAttempt(long attempt) { m_attempt = attempt; }
+            inline void SetPhaseStartTime(RequestPhase phase, std::chrono::steady_clock::time_point time) { m_phaseStartTimes[static_cast<unsigned>(phase)] = time; }
+
+        private:
+            uint64_t m_invocationId;
+            std::chrono::steady_clock::time_point m_startTime;
+            const AmazonWebServiceRequest* m_request;
+            std::shared_ptr<Http::HttpRequest> m_httpRequest;
+            std::shared_ptr<Http::HttpResponse> m_httpResponse;
+            Aws::String m_operationName;
+            Aws::String m_requestId;
+            long m_attempt;
+            std::chrono::steady_clock::time_point m_phaseStartTimes[REQUEST_PHASE_COUNT];
+        };
+
+        /**
+         * Hooks into every call an AWSClient makes. Register instances on ClientConfiguration::interceptors; they are called in order,
+         * synchronously, on the thread making the call, so they must be thread safe and cheap. Asynchronous calls may move between threads
+         * from one phase to the next, so the same call can reach an interceptor from different threads. Timestamps come from a monotonic clock.
+         */
+        class AWS_CORE_API RequestInterceptor
+        {
+        public:
+            virtual ~RequestInterceptor() {}
+
+            /**
+             * Called right before phase starts.
+             */
+            virtual void BeforePhase(const RequestInterceptorContext& context, RequestPhase phase, std::chrono::steady_clock::time_point time)
+            {
+                AWS_UNREFERENCED_PARAM(context);
+                AWS_UNREFERENCED_PARAM(phase);
+                AWS_UNREFERENCED_PARAM(time);
+            }
+
+            /**
+             * Called right after phase ends. succeeded is false if the phase itself failed: signing failed, no response arrived, the
+             * response could not be parsed, or an error response did not name an error the client recognizes.
+             */
+            virtual void AfterPhase(const RequestInterceptorContext& context, RequestPhase phase, std::chrono::steady_clock::time_point time,
+                                    bool succeeded)
+            {
+                AWS_UNREFERENCED_PARAM(context);
+                AWS_UNREFERENCED_PARAM(phase);
+                AWS_UNREFERENCED_PARAM(time);
+                AWS_UNREFERENCED_PARAM(succeeded);
+            }
+
+            /**
+             * Called once the call has finished, after all retries, with whether it produced a successful outcome.
+             */
+            virtual void OnComplete(const RequestInterceptorContext& context, std::chrono::steady_clock::time_point time, bool succeeded)
+            {
+                AWS_UNREFERENCED_PARAM(context);
+                AWS_UNREFERENCED_PARAM(time);
+                AWS_UNREFERENCED_PARAM(succeeded);
+            }
+        };
+
+    } // namespace Client
+} // namespace Aws
@@ -18,7 +18,9 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <memory>
+#include <functional>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <condition_variable>
 
@@ -36,6 +38,12 @@ namespace Aws
     {
         class HttpRequest;
         class HttpResponse;
+        class URI;
+
+        /**
+         * Invoked once an asynchronously issued request has finished. The response is null if the request could not be completed.
+         */
+        typedef std::function<void(const std::shared_ptr<HttpResponse>&)> HttpResponseCallback;
 
         /**
           * Abstract HttpClient. All it does is make HttpRequests and return their response.
@@ -53,6 +61,23 @@ namespace Aws
                 Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
                 Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const = 0;
 
+            /**
+             * Takes an http request and calls onComplete with its response once the request has finished.
+             * The request must stay alive until onComplete has been invoked. The default implementation makes the request
+             * synchronously on the calling thread; event driven implementations return immediately and invoke onComplete
+             * from their own threads.
+             */
+            virtual void MakeRequestAsync(HttpRequest& request, const HttpResponseCallback& onComplete,
+                Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
+
+            /**
+             * Opens up to connections connections to endpoint ahead of traffic by sending HEAD requests to it, so the first
+             * real requests do not pay for DNS, TCP and TLS setup. Only connections that are free at the time are used; none are
+             * waited for. Returns the number of requests that got a response.
+             */
+            virtual unsigned Prewarm(const URI& endpoint, unsigned connections) const;
+
             /**
              * Stops all requests in progress and prevents any others from initiating.
              */
@@ -69,6 +94,11 @@ namespace Aws
              * Sleeps current thread for sleepTime.
              */
             void RetryRequestSleep(std::chrono::milliseconds sleepTime);
+            /**
+             * Calls retry once sleepTime has passed, or sooner if request processing gets disabled. The default implementation sleeps
+             * the calling thread; event driven implementations return immediately and call retry from their own threads.
+             */
+            virtual void ScheduleRetry(std::chrono::milliseconds sleepTime, const std::function<void()>& retry);
 
         private:
 
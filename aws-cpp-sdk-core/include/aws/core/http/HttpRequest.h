@@ -19,6 +19,9 @@
 
 #include <aws/core/http/URI.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/RequestBodySource.h>
+#include <aws/core/http/ResponseBodySink.h>
+#include <aws/core/utils/Array.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
@@ -69,7 +72,7 @@ namespace Aws
              * Initializes an HttpRequest object with uri and http method.
              */
             HttpRequest(const URI& uri, HttpMethod method) :
-                m_uri(uri), m_method(method)
+                m_uri(uri), m_method(method), m_transferFailure(HttpTransferFailure::NONE)
             {}
 
             virtual ~HttpRequest() {}
@@ -102,6 +105,50 @@ namespace Aws
              * Gets the content body stream that will be used for this request.
              */
             virtual const std::shared_ptr<Aws::IOStream>& GetContentBody() const = 0;
+            /**
+             * Sets the source the body is sent from. When set, http clients send the body from it instead of from the content body
+             * stream. A request with a source but no stream must carry the body's sha256 (SetContentSha256) for signers to use.
+             */
+            inline void SetContentBodySource(const std::shared_ptr<RequestBodySource>& bodySource) { m_contentBodySource = bodySource; }
+            /**
+             * Gets the source the body will be sent from, if one was set.
+             */
+            inline const std::shared_ptr<RequestBodySource>& GetContentBodySource() const { return m_contentBodySource; }
+            /**
+             * Sets the sha256 digest of the content body, computed by whoever last read the body (for instance alongside its Content-MD5),
+             * so signers can use it instead of reading the body again. Must describe the body exactly.
+             */
+            inline void SetContentSha256(const Aws::Utils::ByteBuffer& sha256) { m_contentSha256 = sha256; }
+            /**
+             * Gets the precomputed sha256 digest of the content body; empty if none was set.
+             */
+            inline const Aws::Utils::ByteBuffer& GetContentSha256() const { return m_contentSha256; }
+            /**
+             * Sets the sink the body of a successful response is written to. When set, http clients write the body into it instead of
+             * into the response body stream, which is left empty.
+             */
+            inline void SetResponseBodySink(const std::shared_ptr<ResponseBodySink>& bodySink) { m_responseBodySink = bodySink; }
+            /**
+             * Gets the sink the body of a successful response will be written to, if one was set.
+             */
+            inline const std::shared_ptr<ResponseBodySink>& GetResponseBodySink() const { return m_responseBodySink; }
+            /**
+             * Sets the metrics of the latest attempt to send this request. Http clients set them whether or not the attempt got a response,
+             * so they are the place to look when a transfer failed or timed out.
+             */
+            inline void SetTransferMetrics(const HttpTransferMetrics& metrics) { m_transferMetrics = metrics; }
+            /**
+             * Gets the metrics of the latest attempt to send this request; every field is -1 if it has not been sent.
+             */
+            inline const HttpTransferMetrics& GetTransferMetrics() const { return m_transferMetrics; }
+            /**
+             * Sets why the latest attempt to send this request got no response; NONE if it got one.
+             */
+            inline void SetTransferFailure(HttpTransferFailure failure) { m_transferFailure = failure; }
+            /**
+             * Gets why the latest attempt to send this request got no response.
+             */
+            inline HttpTransferFailure GetTransferFailure() const { return m_transferFailure; }
             /**
              * Returns true if a header exists in the request with name
              */
@@ -369,6 +416,11 @@ namespace Aws
         private:
             URI m_uri;
             HttpMethod m_method;
+            std::shared_ptr<RequestBodySource> m_contentBodySource;
+            Aws::Utils::ByteBuffer m_contentSha256;
+            std::shared_ptr<ResponseBodySink> m_responseBodySink;
+            HttpTransferMetrics m_transferMetrics;
+            HttpTransferFailure m_transferFailure;
             DataReceivedEventHandler onDataReceived;
             DataSentEventHandler onDataSent;
 
@@ -176,6 +176,14 @@ namespace Aws
              * Sets the content type header on the http response object.
              */
             virtual void SetContentType(const Aws::String& contentType) { AddHeader("content-type", contentType); };
+            /**
+             * Gets the timing breakdown and byte counts of the exchange that produced this response.
+             */
+            inline const HttpTransferMetrics& GetTransferMetrics() const { return transferMetrics; }
+            /**
+             * Sets the timing breakdown and byte counts of the exchange that produced this response.
+             */
+            inline void SetTransferMetrics(const HttpTransferMetrics& metrics) { transferMetrics = metrics; }
 
         private:
             HttpResponse(const HttpResponse&);
@@ -183,6 +191,7 @@ namespace Aws
 
             const HttpRequest& httpRequest;
             HttpResponseCode responseCode;
+            HttpTransferMetrics transferMetrics;
         };
 
 
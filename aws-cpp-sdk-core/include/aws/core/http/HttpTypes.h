@@ -22,6 +22,7 @@
 #include <aws/core/utils/memory/stl/AWSMap.h>
 
 #include <memory>
+#include <cstdint>
 
 namespace Aws
 {
@@ -48,7 +49,103 @@ namespace Aws
             DEFAULT_CLIENT,
             CURL_CLIENT,
             WIN_INET_CLIENT,
-            WIN_HTTP_CLIENT
+            WIN_HTTP_CLIENT,
+            CURL_MULTI_CLIENT
+        };
+
+        /**
+         * How widely an http client shares its DNS and TLS session caches between connections.
+         */
+        enum class AWS_CORE_API ConnectionCacheSharing
+        {
+            NONE,
+            PER_CLIENT,
+            PROCESS_WIDE
+        };
+
+        /**
+         * Http protocol version an http client negotiates.
+         */
+        enum class AWS_CORE_API HttpVersion
+        {
+            /**
+             * Whatever the http library prefers.
+             */
+            DEFAULT,
+            HTTP_1_1,
+            /**
+             * HTTP/2 over TLS, negotiated through ALPN; plain http endpoints and servers that do not offer h2 stay on HTTP/1.1.
+             */
+            HTTP_2_TLS
+        };
+
+        /**
+         * Where the time of a single http exchange went, as reported by the http client. Times are in microseconds from the start of the
+         * exchange and are cumulative: connect includes the name lookup, the TLS handshake includes connect, and so on. A value of -1
+         * means the http client did not measure it.
+         */
+        struct AWS_CORE_API HttpTransferMetrics
+        {
+            HttpTransferMetrics() : nameLookupTimeUs(-1), connectTimeUs(-1), tlsHandshakeTimeUs(-1), preTransferTimeUs(-1),
+                firstByteTimeUs(-1), totalTimeUs(-1), bytesSent(-1), bytesReceived(-1), connectionReused(false) {}
+
+            /**
+             * Name lookup done.
+             */
+            int64_t nameLookupTimeUs;
+            /**
+             * TCP connection established.
+             */
+            int64_t connectTimeUs;
+            /**
+             * TLS handshake done; 0 for plain http.
+             */
+            int64_t tlsHandshakeTimeUs;
+            /**
+             * About to send the request.
+             */
+            int64_t preTransferTimeUs;
+            /**
+             * First byte of the response received.
+             */
+            int64_t firstByteTimeUs;
+            /**
+             * Exchange complete.
+             */
+            int64_t totalTimeUs;
+            /**
+             * Request and response body bytes.
+             */
+            int64_t bytesSent;
+            int64_t bytesReceived;
+            /**
+             * True if the request went out on a connection that was already open.
+             */
+            bool connectionReused;
+        };
+
+        /**
+         * Why an http exchange ended without a response, as far as the http client can tell.
+         */
+        enum class AWS_CORE_API HttpTransferFailure
+        {
+            /**
+             * The exchange got a response, was never attempted, or the http client does not say why it failed.
+             */
+            NONE,
+            /**
+             * Nothing could be reached: the name did not resolve or the connection was refused.
+             */
+            CONNECT_FAILED,
+            /**
+             * Connecting or the exchange took longer than the configured timeouts.
+             */
+            TIMED_OUT,
+            /**
+             * The response body sink refused the body, so the transfer was aborted.
+             */
+            RESPONSE_BODY_REFUSED,
+            OTHER
         };
 
         namespace HttpMethodMapper
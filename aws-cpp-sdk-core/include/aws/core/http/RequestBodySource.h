@@ -0,0 +1,74 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <memory>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Where an http client pulls the bytes of a request body from while sending it. Implement this to feed a body from memory,
+         * a mapped file or a file descriptor without going through an iostream.
+         */
+        class AWS_CORE_API RequestBodySource
+        {
+        public:
+            virtual ~RequestBodySource() {}
+
+            /**
+             * Copies up to length bytes of the body into buffer and returns how many were copied. Returns 0 once the body is exhausted.
+             */
+            virtual std::size_t Read(char* buffer, std::size_t length) = 0;
+
+            /**
+             * Number of body bytes not read yet, or -1 if that is not known up front.
+             */
+            virtual int64_t GetRemainingLength() const = 0;
+        };
+
+        /**
+         * Sends a body stream from its current position. The remaining length is determined once up front, and each chunk is pulled
+         * straight from the stream buffer, so there is no per-chunk seeking or istream bookkeeping.
+         */
+        class AWS_CORE_API StreamBodySource : public RequestBodySource
+        {
+        public:
+            StreamBodySource(const std::shared_ptr<Aws::IOStream>& stream);
+
+            std::size_t Read(char* buffer, std::size_t length) override;
+
+            int64_t GetRemainingLength() const override { return m_remainingLength; }
+
+        private:
+            std::shared_ptr<Aws::IOStream> m_stream;
+            int64_t m_remainingLength;
+        };
+
+        /**
+         * Creates a fresh source positioned at the start of the body. Called once per attempt, so retries resend the whole body.
+         */
+        typedef std::function<std::shared_ptr<RequestBodySource>()> RequestBodySourceFactory;
+
+    } // namespace Http
+} // namespace Aws
@@ -0,0 +1,99 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSFunction.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Receives a chunk of response body. Return false to abort the transfer.
+         */
+        typedef std::function<bool(const unsigned char* data, std::size_t length)> ResponseBodyCallback;
+
+        /**
+         * Where an http client writes the body of a successful (2xx) response as it arrives, instead of the response body stream.
+         * Error responses still go to the response body stream so they can be parsed. A sink that refuses a body aborts the transfer,
+         * and the call fails with a ResponseBodyRefused error that is not retried.
+         */
+        class AWS_CORE_API ResponseBodySink
+        {
+        public:
+            virtual ~ResponseBodySink() {}
+
+            /**
+             * Called once per response before its first chunk, with the Content-Length of the body or -1 if the server did not send one.
+             * Retries call this again, so it is also where a sink starts over. Return false to abort the transfer.
+             */
+            virtual bool Begin(int64_t contentLength) = 0;
+
+            /**
+             * Writes the next chunk of the body. Return false to abort the transfer.
+             */
+            virtual bool Write(const unsigned char* data, std::size_t length) = 0;
+        };
+
+        /**
+         * Writes the body into a contiguous buffer owned by the caller. Bodies whose Content-Length does not fit are refused
+         * before a single byte is written. The buffer must outlive the request.
+         */
+        class AWS_CORE_API PreallocatedBodySink : public ResponseBodySink
+        {
+        public:
+            PreallocatedBodySink(unsigned char* buffer, std::size_t length);
+
+            bool Begin(int64_t contentLength) override;
+            bool Write(const unsigned char* data, std::size_t length) override;
+
+            /**
+             * Gives access to the underlying buffer.
+             */
+            inline unsigned char* GetBuffer() const { return m_buffer; }
+            /**
+             * Number of body bytes written into the buffer so far.
+             */
+            inline std::size_t GetBytesWritten() const { return m_bytesWritten; }
+
+        private:
+            unsigned char* m_buffer;
+            std::size_t m_length;
+            std::size_t m_bytesWritten;
+        };
+
+        /**
+         * Hands every chunk of the body to a callback as it comes off the wire. If a request is retried after part of a body was
+         * delivered, the callback sees the body again from the start; implement ResponseBodySink directly to be told about that.
+         */
+        class AWS_CORE_API CallbackBodySink : public ResponseBodySink
+        {
+        public:
+            CallbackBodySink(const ResponseBodyCallback& callback);
+
+            bool Begin(int64_t contentLength) override;
+            bool Write(const unsigned char* data, std::size_t length) override;
+
+        private:
+            ResponseBodyCallback m_callback;
+        };
+
+    } // namespace Http
+} // namespace Aws
@@ -15,10 +15,17 @@
 
 #pragma once
 
-#include <aws/core/utils/memory/stl/AWSStack.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/http/HttpTypes.h>
 
 #include <utility>
+#include <memory>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include <condition_variable>
 #include <curl/curl.h>
 
@@ -26,52 +33,138 @@ namespace Aws
 {
 namespace Http
 {
+class CurlShareHandle;
 
 /**
-  * Simple Connection pool manager for Curl. It maintains connections in a thread safe manner. You
-  * can call into acquire a handle, then put it back when finished. It is assumed that reusing an already
-  * initialized handle is preferable (especially for synchronous clients). The pool doubles in capacity as
-  * needed up to the maximum amount of connections.
+  * Point in time snapshot of a CurlHandleContainer.
+  */
+struct ConnectionPoolStatistics
+{
+    ConnectionPoolStatistics() : capacity(0), inUse(0), idle(0), waitingThreads(0), acquisitions(0), totalWaitTimeMs(0), maxWaitTimeMs(0) {}
+
+    /**
+      * Most handles the pool hands out at once: connections times streams per connection.
+      */
+    unsigned capacity;
+    /**
+      * Handles currently checked out of the pool. Each is one request in flight, i.e. one stream when connections are multiplexed.
+      */
+    unsigned inUse;
+    /**
+      * Handles sitting in the pool, across all endpoints.
+      */
+    unsigned idle;
+    /**
+      * Threads currently blocked in AcquireCurlHandle.
+      */
+    unsigned waitingThreads;
+    /**
+      * Number of handles handed out since the pool was created.
+      */
+    uint64_t acquisitions;
+    /**
+      * Total and maximum time spent inside AcquireCurlHandle.
+      */
+    uint64_t totalWaitTimeMs;
+    uint64_t maxWaitTimeMs;
+};
+
+/**
+  * Connection pool manager for Curl. It maintains connections in a thread safe manner. You
+  * can call into acquire a handle, then put it back when finished. Idle handles are kept per endpoint
+  * (scheme, host and port), so a handle acquired for an endpoint is one whose connection to that endpoint is still open
+  * whenever possible. New handles are created on demand up to the maximum amount of connections; beyond that an idle
+  * handle of another endpoint is recycled, and only when there is none does the caller wait.
+  * Idle handles that outlive the idle timeout and handles older than the maximum age are closed by a background thread.
+  * When HTTP/2 connections are multiplexed, every handle is a stream rather than a socket, so the pool is sized in streams.
   */
 class CurlHandleContainer
 {
 public:
     /**
-      * Initializes an empty stack of CURL handles. If you are only making synchronous calls via your http client
-      * then a small size is best. For async support, a good value would be 6 * number of Processors.   *
+      * Initializes an empty pool of CURL handles. If you are only making synchronous calls via your http client
+      * then a small size is best. For async support, a good value would be 6 * number of Processors.
+      * cacheSharing controls whether the handles share a DNS and TLS session cache with each other or with the whole process.
+      * idleTimeoutMs and maxAgeMs bound how long a connection may sit unused and how long it may live at all; 0 disables the limit.
+      * httpVersion is negotiated by every handle. maxStreamsPerConnection is how many handles share one connection when their transfers
+      * are multiplexed; the pool then holds up to maxSize * maxStreamsPerConnection handles.
       */
-    CurlHandleContainer(unsigned maxSize = 50, long requestTimeout = 3000, long connectTimeout = 1000);
+    CurlHandleContainer(unsigned maxSize = 50, long requestTimeout = 3000, long connectTimeout = 1000,
+                        ConnectionCacheSharing cacheSharing = ConnectionCacheSharing::NONE,
+                        long idleTimeoutMs = 0, long maxAgeMs = 0,
+                        HttpVersion httpVersion = HttpVersion::DEFAULT, unsigned maxStreamsPerConnection = 1);
     ~CurlHandleContainer();
 
     /**
-      * Blocks until a curl handle from the pool is available for use.
+      * Blocks until a curl handle from the pool is available for use. Handles last used for endpoint are preferred.
+      */
+    CURL* AcquireCurlHandle(const Aws::String& endpoint = "");
+    /**
+      * Same as AcquireCurlHandle, but returns nullptr instead of waiting when the pool is at its max size and has no idle handle
+      * to give. poolExhausted tells that case, in which the caller may try again once a handle has been released, apart from
+      * a handle that could not be created at all.
       */
-    CURL* AcquireCurlHandle();
+    CURL* TryAcquireCurlHandle(const Aws::String& endpoint, bool& poolExhausted);
     /**
       * Returns a handle to the pool for reuse. It is imperative that this is called
       * after you are finished with the handle.
       */
     void ReleaseCurlHandle(CURL* handle);
 
+    /**
+      * Returns the current pool gauges.
+      */
+    ConnectionPoolStatistics GetStatistics() const;
+
 private:
     CurlHandleContainer(const CurlHandleContainer&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&) = delete;
     CurlHandleContainer(const CurlHandleContainer&&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&&) = delete;
 
-    bool CheckAndGrowPool();
+    struct PooledHandle
+    {
+        CURL* m_handle;
+        Aws::String m_endpoint;
+        std::chrono::steady_clock::time_point m_createdAt;
+        std::chrono::steady_clock::time_point m_lastReleasedAt;
+    };
+
+    typedef Aws::Deque<PooledHandle> IdleHandles;
+
+    bool TakeIdleHandle(const Aws::String& endpoint, PooledHandle& pooledHandle);
+    bool CreateOrRecycleHandle(const Aws::String& endpoint, PooledHandle& pooledHandle);
+    bool RecycleIdleHandle(PooledHandle& pooledHandle);
+    CURL* CheckOutHandle(const Aws::String& endpoint, PooledHandle& pooledHandle, std::chrono::steady_clock::time_point acquireStart);
+    CURL* CreateHandle();
+    bool IsExpired(const PooledHandle& pooledHandle, std::chrono::steady_clock::time_point now) const;
     void SetDefaultOptionsOnHandle(void* handle);
+    void EvictExpiredHandles();
+    void RunEviction();
 
-    Aws::Stack<CURL*> m_handleContainer;
-    std::mutex m_handleContainerMutex;
+    Aws::Map<Aws::String, IdleHandles> m_idleHandles;
+    Aws::Map<CURL*, PooledHandle> m_handlesInUse;
+    mutable std::mutex m_handleContainerMutex;
     std::condition_variable m_conditionVariable;
     unsigned m_maxPoolSize;
     unsigned long m_requestTimeout;
     unsigned long m_connectTimeout;
+    std::chrono::milliseconds m_idleTimeout;
+    std::chrono::milliseconds m_maxAge;
+    HttpVersion m_httpVersion;
+    unsigned m_maxStreamsPerConnection;
     unsigned m_poolSize;
+    unsigned m_idleCount;
+    unsigned m_waitingThreads;
+    uint64_t m_acquisitions;
+    uint64_t m_totalWaitTimeMs;
+    uint64_t m_maxWaitTimeMs;
+    std::shared_ptr<CurlShareHandle> m_shareHandle;
+    bool m_stopEviction;
+    std::condition_variable m_evictionSignal;
+    std::thread m_evictionThread;
     static bool isInit;
 };
 
 } // namespace Http
 } // namespace Aws
-
@@ -26,7 +26,7 @@ namespace Aws
 namespace Http
 {
 
-//Curl implementation of an http client. Right now it is only synchronous.
+//Curl implementation of an http client. Each request is performed synchronously on the calling thread.
 class CurlHttpClient: public HttpClient
 {
 public:
@@ -37,7 +37,55 @@ public:
     CurlHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
     //Makes request and receives response synchronously
     std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
-            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    /**
+     * Checks out up to connections handles (bounded by maxConnections) at once and performs a HEAD request to endpoint on each,
+     * so each of them holds its own open connection when it goes back to the pool.
+     */
+    unsigned Prewarm(const URI& endpoint, unsigned connections) const override;
+
+    /**
+     * Returns the in-use, idle and waiting gauges of the connection pool.
+     */
+    ConnectionPoolStatistics GetConnectionPoolStatistics() const;
+
+protected:
+    /**
+     * Creates a client whose pool lets maxStreamsPerConnection handles share each of clientConfig.maxConnections connections,
+     * for subclasses that multiplex their transfers.
+     */
+    CurlHttpClient(const Aws::Client::ClientConfiguration& clientConfig, unsigned maxStreamsPerConnection);
+
+    /**
+     * State for a single request bound to a pooled curl handle. Defined in the implementation file.
+     */
+    struct CurlTransfer;
+
+    /**
+     * Acquires a handle from the pool and configures it to perform request. Returns nullptr if no handle could be acquired.
+     * The returned transfer must be passed to EndTransfer once curl has finished with it.
+     */
+    CurlTransfer* BeginTransfer(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const;
+    /**
+     * Same as BeginTransfer, but for callers that must never block: returns nullptr right away when the pool has no handle to
+     * spare, setting poolExhausted so the caller knows to try again later, and does not apply any write limiter.
+     * Instead of sleeping while readLimiter is over budget, the transfer pauses its reads and calls resumeReadsAfter with the delay;
+     * the caller must then resume the handle with curl_easy_pause once that delay has passed. With no resumeReadsAfter, reads
+     * sleep on readLimiter as they do for BeginTransfer.
+     */
+    CurlTransfer* TryBeginTransfer(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+            const std::function<void(std::chrono::milliseconds)>& resumeReadsAfter, bool& poolExhausted) const;
+    /**
+     * Collects the result of a transfer, returns its handle to the pool and frees the transfer.
+     * Returns the response, or nullptr if curl reported an error.
+     */
+    std::shared_ptr<HttpResponse> EndTransfer(CurlTransfer* transfer, CURLcode curlResponseCode) const;
+    /**
+     * Returns the curl handle the transfer is bound to.
+     */
+    static CURL* GetTransferHandle(const CurlTransfer* transfer);
 
 private:
     mutable CurlHandleContainer m_curlHandleContainer;
@@ -49,6 +97,10 @@ private:
     bool m_verifySSL;
     Aws::String m_caPath;
     bool m_allowRedirects;
+    unsigned m_maxConnections;
+
+    //Configures a freshly acquired handle to perform request
+    CurlTransfer* SetUpTransfer(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, CURL* connectionHandle) const;
 
     //Callback to read the content from the content body of the request
     static size_t ReadBody(char* ptr, size_t size, size_t nmemb, void* userdata);
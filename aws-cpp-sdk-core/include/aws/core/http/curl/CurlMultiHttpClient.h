@@ -0,0 +1,84 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+ * Event driven curl implementation of an http client. Requests are handed to a small, fixed number of event loop threads,
+ * each of which drives all of its transfers through a single curl multi handle. Thousands of requests can be in flight
+ * without dedicating a thread to each of them; use MakeRequestAsync to take advantage of that.
+ * MakeRequest is still supported and blocks the calling thread until its transfer has completed. Called from an event loop
+ * thread, for instance from a completion callback, it performs the transfer in place instead, holding up every other transfer
+ * on that loop until it is done, and fails right away if no connection is free rather than wait for one the loop itself holds.
+ */
+class CurlMultiHttpClient: public CurlHttpClient
+{
+public:
+
+    using Base = CurlHttpClient;
+
+    /**
+     * Creates the client and starts clientConfig.httpEventLoopThreads event loops (at least one).
+     */
+    CurlMultiHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
+    /**
+     * Stops the event loops. Transfers still in flight are completed with a null response.
+     */
+    ~CurlMultiHttpClient();
+
+    /**
+     * Submits the request to an event loop and blocks until it has completed.
+     */
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    /**
+     * Submits the request to an event loop and returns immediately. onComplete runs on the event loop thread,
+     * so it should hand any expensive work off to another thread. The loop never blocks on the request's behalf: it waits for
+     * a free connection, and for the rate limiters, by leaving the request queued or its reads paused.
+     */
+    void MakeRequestAsync(HttpRequest& request, const HttpResponseCallback& onComplete,
+            Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    /**
+     * Returns immediately and calls retry on an event loop thread once sleepTime has passed.
+     */
+    void ScheduleRetry(std::chrono::milliseconds sleepTime, const std::function<void()>& retry) override;
+
+private:
+    class EventLoop;
+
+    bool IsEventLoopThread() const;
+    EventLoop& NextEventLoop() const;
+
+    Aws::Vector<Aws::UniquePtr<EventLoop>> m_eventLoops;
+    mutable std::atomic<unsigned> m_nextEventLoop;
+};
+
+} // namespace Http
+} // namespace Aws
+
@@ -0,0 +1,65 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <curl/curl.h>
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+  * Thread safe wrapper around a curl share handle. Every easy handle attached to it shares one DNS cache and one TLS session
+  * cache, so a freshly created handle can skip the lookup and resume a session instead of doing a full handshake.
+  * Connections themselves are not shared: libcurl does not support using a shared connection cache from concurrent threads.
+  */
+class CurlShareHandle
+{
+public:
+    CurlShareHandle();
+    /**
+      * All easy handles must be detached (or cleaned up) before the share handle is destroyed.
+      */
+    ~CurlShareHandle();
+
+    /**
+      * Attaches the shared caches to an easy handle. Must be called again after curl_easy_reset.
+      */
+    void Attach(CURL* handle) const;
+
+    /**
+      * Returns the share handle used by every client configured with ConnectionCacheSharing::PROCESS_WIDE.
+      * It is created on first use and destroyed once the last client using it goes away.
+      */
+    static std::shared_ptr<CurlShareHandle> GetProcessWideInstance();
+
+private:
+    CurlShareHandle(const CurlShareHandle&) = delete;
+    const CurlShareHandle& operator = (const CurlShareHandle&) = delete;
+
+    static void LockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
+    static void UnlockShare(CURL* handle, curl_lock_data data, void* userptr);
+
+    CURLSH* m_shareHandle;
+    std::mutex m_locks[CURL_LOCK_DATA_LAST];
+};
+
+} // namespace Http
+} // namespace Aws
+
@@ -93,7 +93,7 @@ namespace Aws
 
             bool StreamPayloadToRequest(const HttpRequest& request, void* hHttpRequest) const;
             void LogRequestInternalFailure() const;
-            std::shared_ptr<HttpResponse> BuildSuccessResponse(const Aws::Http::HttpRequest& request, void* hHttpRequest, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter) const;
+            std::shared_ptr<HttpResponse> BuildSuccessResponse(Aws::Http::HttpRequest& request, void* hHttpRequest, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter) const;
             void AddHeadersToRequest(const HttpRequest& request, void* hHttpRequest) const;
 
             void* m_openHandle;
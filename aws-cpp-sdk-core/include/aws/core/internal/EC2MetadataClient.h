@@ -19,6 +19,7 @@
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <memory>
+#include <mutex>
 
 namespace Aws
 {
@@ -31,7 +32,8 @@ namespace Aws
     namespace Internal
     {
         /**
-         * Simple client for accessing the Amazon EC2 Instance Metadata Service.
+         * Simple client for accessing the Amazon EC2 Instance Metadata Service. The service is link local, so requests use short
+         * connect and request timeouts and are retried a bounded number of times rather than waiting on the general client defaults.
          */
         class AWS_CORE_API EC2MetadataClient
         {
@@ -47,7 +49,8 @@ namespace Aws
 
             /**
              * Connects to the Amazon EC2 Instance Metadata Service to retrieve the
-             * default credential information (if any).
+             * default credential information (if any). The instance role name is looked up once and cached; it is only looked up
+             * again if the service no longer knows the cached role.
              */
             virtual Aws::String GetDefaultCredentials() const;
 
@@ -64,6 +67,8 @@ namespace Aws
             std::shared_ptr<Http::HttpClient> m_httpClient;
             std::shared_ptr<Http::HttpClientFactory const> m_httpClientFactory;
             Aws::String m_endpoint;
+            mutable std::mutex m_roleNameMutex;
+            mutable Aws::String m_roleName;
         };
 
     } // namespace Internal
@@ -19,15 +19,13 @@
 
 #include <aws/core/utils/memory/stl/AWSString.h>
 
-#include <mutex>
-
 namespace Aws
 {
     namespace Utils
     {
         /**
-        * Wrapper for all the weird crap we need to do with timestamps. The time functions aren't thread
-        * safe so please use this class instead of calculating timestamps yourself.
+        * Wrapper for all the weird crap we need to do with timestamps. The standard gmtime/localtime aren't thread
+        * safe so please use this class instead of calculating timestamps yourself; it takes no locks.
         */
         class AWS_CORE_API DateTime
         {
@@ -52,6 +50,12 @@ namespace Aws
              */
             static double ComputeCurrentTimestampInAmazonFormat();
 
+            /**
+             * Converts a UTC ISO-8601 timestamp such as 2016-04-20T19:11:48Z (fractional seconds are allowed) into the amazon
+             * timestamp format. Returns 0.0 if the timestamp can't be parsed.
+             */
+            static double ConvertISO8601ToAmazonFormat(const char* timestamp);
+
             /**
             * Computes the timestamp in ISO-8601 format
             */
@@ -61,9 +65,6 @@ namespace Aws
             * Computes the current date in ISO-8601 format
             */
             static Aws::String ComputeCurrentDateInISO8601Format();
-
-        private:
-            static std::mutex timeMutex;
         };
 
     } // namespace Utils
@@ -17,6 +17,8 @@
 
 #include <aws/core/utils/memory/stl/AWSString.h>
 
+#include <cstdint>
+
 namespace Aws
 {
     namespace Utils
@@ -53,6 +55,12 @@ namespace Aws
              */
             static bool RelocateFileOrDirectory(const char* from, const char* to);
 
+            /**
+             * Reads the size and last write time of a file without opening it, enough to tell whether it was rewritten. The time is
+             * in platform units, only meant to be compared with another value from this function. Returns false if the file doesn't exist.
+             */
+            static bool GetFileSizeAndModificationTime(const char* path, uint64_t& size, int64_t& modificationTime);
+
             /**
              * Gets path delimiter for the current platform
              */
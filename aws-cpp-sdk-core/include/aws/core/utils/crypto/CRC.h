@@ -0,0 +1,48 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            /**
+             * CRC32 (the zlib/ethernet polynomial) of length bytes of data. Pass the result of a previous call as previousCrc to continue
+             * a checksum across several buffers; 0 starts a new one.
+             */
+            AWS_CORE_API uint32_t CRC32(const unsigned char* data, std::size_t length, uint32_t previousCrc = 0);
+
+            /**
+             * CRC32C (the Castagnoli polynomial) of length bytes of data, chained the same way as CRC32. Uses the SSE4.2 crc32 instruction
+             * when the cpu running the process supports it.
+             */
+            AWS_CORE_API uint32_t CRC32C(const unsigned char* data, std::size_t length, uint32_t previousCrc = 0);
+
+            /**
+             * True when CRC32C runs on the SSE4.2 instruction rather than the portable tables.
+             */
+            AWS_CORE_API bool IsCRC32CHardwareAccelerated();
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
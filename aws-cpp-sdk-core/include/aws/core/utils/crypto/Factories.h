@@ -28,6 +28,7 @@ namespace Aws
             class HMAC;
             class HashFactory;
             class HMACFactory;
+            class MultiHashDigests;
 
             /**
              * Create an MD5 Hash provider
@@ -41,6 +42,11 @@ namespace Aws
              * Create a Sha256 HMACHash provider
              */
             AWS_CORE_API std::shared_ptr<HMAC> CreateSha256HMACImplementation();
+            /**
+             * Create running MD5 and/or Sha256 contexts for MultiHash. Returns nullptr if a custom MD5 or Sha256 factory has been set,
+             * since those providers only hash whole payloads.
+             */
+            AWS_CORE_API std::shared_ptr<MultiHashDigests> CreateMultiHashDigestsImplementation(bool md5, bool sha256);
 
             /**
              * Set the global factory for MD5 Hash providers
@@ -0,0 +1,111 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <mutex>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            /**
+             * Hands out hash objects (MD5, Sha256, Sha256HMAC, ...) one caller at a time, so an object shared by many threads (a client,
+             * a signer) never hashes on two threads at once. Objects are created through the crypto factories on demand and reused
+             * afterwards, so platform setup such as opening bcrypt algorithm providers happens once per concurrent caller rather than
+             * once per call, and the pool only ever grows to the peak number of simultaneous callers.
+             *
+             * The lock is held just long enough to pop or push an idle object; the hashing itself runs unlocked.
+             */
+            template<typename HASH>
+            class HashContextPool
+            {
+            public:
+                /**
+                 * A borrowed hash object; it goes back to the pool when the lease is destroyed.
+                 */
+                class Lease
+                {
+                public:
+                    Lease(HashContextPool& pool, Aws::UniquePtr<HASH>&& hash) : m_pool(&pool), m_hash(std::move(hash)) {}
+
+                    Lease(Lease&& other) : m_pool(other.m_pool), m_hash(std::move(other.m_hash)) {}
+
+                    Lease(const Lease&) = delete;
+                    Lease& operator=(const Lease&) = delete;
+
+                    ~Lease()
+                    {
+                        if (m_hash)
+                        {
+                            m_pool->Release(std::move(m_hash));
+                        }
+                    }
+
+                    HASH* operator->() const { return m_hash.get(); }
+                    HASH& operator*() const { return *m_hash; }
+
+                private:
+                    HashContextPool* m_pool;
+                    Aws::UniquePtr<HASH> m_hash;
+                };
+
+                /**
+                 * allocationTag is used for the hash objects the pool creates.
+                 */
+                HashContextPool(const char* allocationTag) : m_allocationTag(allocationTag) {}
+
+                HashContextPool(const HashContextPool&) = delete;
+                HashContextPool& operator=(const HashContextPool&) = delete;
+
+                /**
+                 * Borrows an idle hash object, creating one if every object is in use.
+                 */
+                Lease Acquire()
+                {
+                    {
+                        std::lock_guard<std::mutex> locker(m_lock);
+                        if (!m_idle.empty())
+                        {
+                            Aws::UniquePtr<HASH> hash(std::move(m_idle.back()));
+                            m_idle.pop_back();
+                            return Lease(*this, std::move(hash));
+                        }
+                    }
+
+                    return Lease(*this, Aws::MakeUnique<HASH>(m_allocationTag));
+                }
+
+            private:
+                void Release(Aws::UniquePtr<HASH>&& hash)
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    m_idle.push_back(std::move(hash));
+                }
+
+                const char* m_allocationTag;
+                std::mutex m_lock;
+                Aws::Vector<Aws::UniquePtr<HASH>> m_idle;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,130 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/crypto/HashResult.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <memory>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            /**
+             * Running MD5 and Sha256 contexts behind MultiHash; each crypto backend implements one.
+             */
+            class AWS_CORE_API MultiHashDigests
+            {
+            public:
+                virtual ~MultiHashDigests() {}
+
+                /**
+                 * Adds length bytes of data to the digests this instance was created with.
+                 */
+                virtual void Update(const unsigned char* data, std::size_t length) = 0;
+
+                /**
+                 * Finalizes the digests into md5 and sha256. A digest that was not requested, or that failed, is left empty.
+                 */
+                virtual void Finish(ByteBuffer& md5, ByteBuffer& sha256) = 0;
+            };
+
+            /**
+             * Computes several digests over the same data in a single pass, so every byte is read from memory once no matter how many
+             * digests the request needs. Feed data with Update (or hash a whole stream with Calculate), then call Finish once and read
+             * the results.
+             *
+             * MultiHash drives the platform crypto library directly, so it cannot honor factories installed with SetMD5Factory or
+             * SetSha256Factory; callers should check IsValid and fall back to MD5/Sha256 when it returns false.
+             */
+            class AWS_CORE_API MultiHash
+            {
+            public:
+                /**
+                 * Digests that can be requested, or'ed together.
+                 */
+                enum Algorithm
+                {
+                    MD5_ALGORITHM = 1,
+                    SHA256_ALGORITHM = 2,
+                    CRC32_ALGORITHM = 4,
+                    CRC32C_ALGORITHM = 8
+                };
+
+                /**
+                 * algorithms is a combination of Algorithm values.
+                 */
+                MultiHash(unsigned algorithms);
+                ~MultiHash();
+
+                MultiHash(const MultiHash&) = delete;
+                MultiHash& operator=(const MultiHash&) = delete;
+
+                /**
+                 * False when MD5 or Sha256 was requested but no platform crypto library is compiled in, or a custom MD5 or Sha256 factory
+                 * has been installed.
+                 */
+                bool IsValid() const;
+
+                /**
+                 * Adds length bytes of data to every requested digest.
+                 */
+                void Update(const unsigned char* data, std::size_t length);
+
+                /**
+                 * Finalizes the digests. Update may not be called afterwards.
+                 */
+                void Finish();
+
+                /**
+                 * Hashes the entire stream and calls Finish. The stream is left at the position it had on entry. Returns false if the
+                 * stream could not be read to the end.
+                 */
+                bool Calculate(Aws::IStream& stream);
+
+                /**
+                 * Results, available after Finish. A digest that was not requested, or that the platform failed to compute, is a failed
+                 * outcome.
+                 */
+                HashResult GetMD5() const;
+                HashResult GetSha256() const;
+                /**
+                 * Big endian CRC32 (the zlib/ethernet polynomial).
+                 */
+                HashResult GetCRC32() const;
+                /**
+                 * Big endian CRC32C (the Castagnoli polynomial).
+                 */
+                HashResult GetCRC32C() const;
+
+            private:
+                unsigned m_algorithms;
+                bool m_finished;
+                uint32_t m_crc32;
+                uint32_t m_crc32c;
+                std::shared_ptr<MultiHashDigests> m_digests;
+                ByteBuffer m_md5;
+                ByteBuffer m_sha256;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
@@ -18,6 +18,7 @@
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/utils/crypto/HMAC.h>
+#include <aws/core/utils/crypto/MultiHash.h>
 #include <mutex>
 
 #ifdef AWS_SDK_PLATFORM_WINDOWS
@@ -153,6 +154,51 @@ namespace Aws
                 BCryptHashImpl m_impl;
             };
 
+            /**
+             * Bcrypt based running md5 and sha256 contexts for MultiHash. Each instance opens its own algorithm handles, so no locking is
+             * needed.
+             */
+            class MultiHashDigestsBcryptImpl : public MultiHashDigests
+            {
+            public:
+
+                MultiHashDigestsBcryptImpl(bool md5, bool sha256);
+                virtual ~MultiHashDigestsBcryptImpl();
+
+                /**
+                 * Adds data to the requested digests.
+                 */
+                virtual void Update(const unsigned char* data, std::size_t length) override;
+
+                /**
+                 * Finalizes the requested digests.
+                 */
+                virtual void Finish(ByteBuffer& md5, ByteBuffer& sha256) override;
+
+            private:
+
+                /**
+                 * One algorithm handle, its hash object, and the hash handle created over it.
+                 */
+                struct Digest
+                {
+                    Digest() : m_algorithmHandle(nullptr), m_hashHandle(nullptr), m_hashObject(nullptr), m_hashLength(0), m_isValid(false) {}
+
+                    void* m_algorithmHandle;
+                    void* m_hashHandle;
+                    PBYTE m_hashObject;
+                    DWORD m_hashLength;
+                    bool m_isValid;
+                };
+
+                static void Open(Digest& digest, LPCWSTR algorithmName);
+                static void Close(Digest& digest);
+                static void Finish(Digest& digest, ByteBuffer& result);
+
+                Digest m_md5;
+                Digest m_sha256;
+            };
+
         } // namespace Crypto
     } // namespace Utils
 } // namespace Aws
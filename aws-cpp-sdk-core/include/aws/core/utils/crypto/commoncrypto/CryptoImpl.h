@@ -2,6 +2,7 @@
 
 #include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/utils/crypto/HMAC.h>
+#include <aws/core/utils/crypto/MultiHash.h>
 
 namespace Aws
 {
@@ -47,6 +48,24 @@ namespace Aws
 
             };
 
+            class MultiHashDigestsCommonCryptoImpl : public MultiHashDigests
+            {
+            public:
+
+                MultiHashDigestsCommonCryptoImpl(bool md5, bool sha256);
+                virtual ~MultiHashDigestsCommonCryptoImpl();
+
+                virtual void Update(const unsigned char* data, std::size_t length) override;
+
+                virtual void Finish(ByteBuffer& md5, ByteBuffer& sha256) override;
+
+            private:
+
+                //CC_MD5_CTX and CC_SHA256_CTX, kept opaque so this header does not need CommonCrypto's.
+                void* m_md5Context;
+                void* m_sha256Context;
+            };
+
         } // namespace Crypto
     } // namespace Utils
 } // namespace Aws
@@ -2,6 +2,7 @@
 
 #include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/utils/crypto/HMAC.h>
+#include <aws/core/utils/crypto/MultiHash.h>
 
 namespace Aws
 {
@@ -14,37 +15,67 @@ namespace Aws
             {
             public:
 
-                MD5OpenSSLImpl() {}
-                virtual ~MD5OpenSSLImpl() {}
+                MD5OpenSSLImpl();
+                virtual ~MD5OpenSSLImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+            private:
+
+                //EVP_MD_CTX pointer reused by every digest, so an instance must not be used by two threads at once.
+                void* m_context;
             };
 
             class Sha256OpenSSLImpl : public Hash
             {
             public:
 
-                Sha256OpenSSLImpl() {}
-                virtual ~Sha256OpenSSLImpl() {}
+                Sha256OpenSSLImpl();
+                virtual ~Sha256OpenSSLImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+
+            private:
+
+                //EVP_MD_CTX pointer reused by every digest, so an instance must not be used by two threads at once.
+                void* m_context;
             };
 
             class Sha256HMACOpenSSLImpl : public HMAC
             {
             public:
 
-                Sha256HMACOpenSSLImpl() {}
-                virtual ~Sha256HMACOpenSSLImpl() {}
+                Sha256HMACOpenSSLImpl();
+                virtual ~Sha256HMACOpenSSLImpl();
 
                 virtual HashResult Calculate(const ByteBuffer& toSign, const ByteBuffer& secret) override;
 
+            private:
+
+                //HMAC_CTX pointer reused by every signature, so an instance must not be used by two threads at once.
+                void* m_context;
+            };
+
+            class MultiHashDigestsOpenSSLImpl : public MultiHashDigests
+            {
+            public:
+
+                MultiHashDigestsOpenSSLImpl(bool md5, bool sha256);
+                virtual ~MultiHashDigestsOpenSSLImpl();
+
+                virtual void Update(const unsigned char* data, std::size_t length) override;
+
+                virtual void Finish(ByteBuffer& md5, ByteBuffer& sha256) override;
+
+            private:
 
+                //EVP_MD_CTX pointers, kept opaque so this header does not need openssl's.
+                void* m_md5Context;
+                void* m_sha256Context;
             };
 
         } // namespace Crypto
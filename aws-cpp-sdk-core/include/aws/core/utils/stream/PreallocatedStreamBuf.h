@@ -0,0 +1,77 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <streambuf>
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * A stream buffer over memory owned by the caller. Nothing is copied or reallocated: reads come straight out of the
+             * buffer and writes go straight into it, up to its length. The buffer must outlive the stream buffer.
+             */
+            class AWS_CORE_API PreallocatedStreamBuf : public std::streambuf
+            {
+            public:
+                /**
+                 * Wraps buffer, which holds length bytes.
+                 */
+                PreallocatedStreamBuf(unsigned char* buffer, std::size_t length);
+
+                PreallocatedStreamBuf(const PreallocatedStreamBuf&) = delete;
+                PreallocatedStreamBuf& operator=(const PreallocatedStreamBuf&) = delete;
+
+                /**
+                 * Gives access to the underlying buffer.
+                 */
+                inline unsigned char* GetBuffer() const { return m_underlyingBuffer; }
+                /**
+                 * Length of the underlying buffer.
+                 */
+                inline std::size_t GetLength() const { return m_length; }
+
+            protected:
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+            private:
+                unsigned char* m_underlyingBuffer;
+                std::size_t m_length;
+            };
+
+            /**
+             * IOStream that reads from and writes to memory owned by the caller through a PreallocatedStreamBuf.
+             */
+            class AWS_CORE_API PreallocatedIOStream : public Aws::IOStream
+            {
+            public:
+                using Base = Aws::IOStream;
+
+                PreallocatedIOStream(unsigned char* buffer, std::size_t length);
+                virtual ~PreallocatedIOStream();
+            };
+
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
@@ -0,0 +1,347 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+/**
+ * C++20 coroutine support. Opt in by defining AWS_ENABLE_COROUTINES when compiling your code with a compiler that implements coroutines;
+ * the SDK itself does not need to be rebuilt, everything here is header only. Service clients then offer an XxxAwaitable(request) for
+ * every operation.
+ */
+#if defined(AWS_ENABLE_COROUTINES) && defined(__cpp_impl_coroutine)
+#define AWS_CORE_COROUTINES 1
+#endif
+
+#ifdef AWS_CORE_COROUTINES
+
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+             * Awaiting this calls start with a completion handler and suspends the awaiting coroutine until the handler is called with
+             * the result; the coroutine then resumes on whichever thread called it (for service operations, the thread that finished
+             * the request, such as an http event loop). No thread is held while the operation is in flight. If the handler is called
+             * before start returns, the coroutine simply carries on without suspending. An exception thrown by start is rethrown from
+             * the co_await.
+             */
+            template<typename RESULT>
+            class Awaitable
+            {
+            public:
+                typedef std::function<void(RESULT&&)> CompletionHandler;
+
+                Awaitable(std::function<void(const CompletionHandler&)>&& start) :
+                    m_start(std::move(start)),
+                    m_completedOrSuspended(false)
+                {
+                }
+
+                bool await_ready() const noexcept { return false; }
+
+                bool await_suspend(std::coroutine_handle<> awaiter)
+                {
+                    m_start([this, awaiter](RESULT&& result)
+                    {
+                        m_result.emplace(std::move(result));
+                        //whichever of the completion and await_suspend gets here second resumes the coroutine (or keeps it running).
+                        if (m_completedOrSuspended.exchange(true))
+                        {
+                            awaiter.resume();
+                        }
+                    });
+
+                    //once the flag is set the coroutine (and this awaitable with it) may resume and finish on another thread, so
+                    //nothing here may be touched afterwards.
+                    return !m_completedOrSuspended.exchange(true);
+                }
+
+                RESULT await_resume()
+                {
+                    return std::move(*m_result);
+                }
+
+            private:
+                std::function<void(const CompletionHandler&)> m_start;
+                std::optional<RESULT> m_result;
+                std::atomic<bool> m_completedOrSuspended;
+            };
+
+            /**
+             * co_await ScheduleOn(executor) moves the rest of the coroutine onto one of executor's threads.
+             */
+            class ScheduleOn
+            {
+            public:
+                ScheduleOn(Executor& executor) : m_executor(executor) {}
+
+                bool await_ready() const noexcept { return false; }
+
+                bool await_suspend(std::coroutine_handle<> awaiter)
+                {
+                    return m_executor.Submit([awaiter]() { awaiter.resume(); });
+                }
+
+                void await_resume() const noexcept {}
+
+            private:
+                Executor& m_executor;
+            };
+
+            template<typename T>
+            class Task;
+
+            namespace Detail
+            {
+                template<typename T>
+                struct TaskPromiseBase
+                {
+                    struct FinalAwaiter
+                    {
+                        bool await_ready() const noexcept { return false; }
+
+                        template<typename PROMISE>
+                        std::coroutine_handle<> await_suspend(std::coroutine_handle<PROMISE> finished) noexcept
+                        {
+                            auto& promise = finished.promise();
+                            if (promise.m_continuation)
+                            {
+                                return promise.m_continuation;
+                            }
+
+                            if (promise.m_detached)
+                            {
+                                finished.destroy();
+                            }
+                            return std::noop_coroutine();
+                        }
+
+                        void await_resume() const noexcept {}
+                    };
+
+                    std::suspend_always initial_suspend() const noexcept { return {}; }
+                    FinalAwaiter final_suspend() const noexcept { return {}; }
+
+                    void unhandled_exception() noexcept
+                    {
+                        //a detached task has nobody to report the exception to.
+                        if (m_detached)
+                        {
+                            std::terminate();
+                        }
+                        m_exception = std::current_exception();
+                    }
+
+                    void RethrowIfFailed() const
+                    {
+                        if (m_exception)
+                        {
+                            std::rethrow_exception(m_exception);
+                        }
+                    }
+
+                    std::coroutine_handle<> m_continuation;
+                    std::exception_ptr m_exception;
+                    bool m_detached = false;
+                };
+
+                template<typename T>
+                struct TaskPromise : TaskPromiseBase<T>
+                {
+                    Task<T> get_return_object();
+                    void return_value(T value) { m_value.emplace(std::move(value)); }
+                    T TakeResult()
+                    {
+                        this->RethrowIfFailed();
+                        return std::move(*m_value);
+                    }
+
+                    std::optional<T> m_value;
+                };
+
+                template<>
+                struct TaskPromise<void> : TaskPromiseBase<void>
+                {
+                    Task<void> get_return_object();
+                    void return_void() const noexcept {}
+                    void TakeResult() const { RethrowIfFailed(); }
+                };
+            } // namespace Detail
+
+            /**
+             * Coroutine type for request flows. A Task starts when it is awaited by another coroutine, or when it is detached or waited
+             * for with SyncWait. Thousands of them can be in flight at once on a handful of executor threads, since a Task waiting on an
+             * Awaitable holds no thread. An exception escaping the coroutine is rethrown to whoever awaits it.
+             */
+            template<typename T = void>
+            class Task
+            {
+            public:
+                using promise_type = Detail::TaskPromise<T>;
+
+                explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+                Task(Task&& other) noexcept : m_handle(other.m_handle) { other.m_handle = nullptr; }
+                Task(const Task&) = delete;
+                Task& operator=(const Task&) = delete;
+
+                ~Task()
+                {
+                    if (m_handle)
+                    {
+                        m_handle.destroy();
+                    }
+                }
+
+                bool await_ready() const noexcept { return !m_handle || m_handle.done(); }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+                {
+                    m_handle.promise().m_continuation = awaiter;
+                    return m_handle;
+                }
+
+                T await_resume() { return m_handle.promise().TakeResult(); }
+
+                /**
+                 * Starts the task on the calling thread without waiting for it; it cleans up after itself once it finishes.
+                 */
+                void Detach()
+                {
+                    auto handle = m_handle;
+                    m_handle = nullptr;
+                    handle.promise().m_detached = true;
+                    handle.resume();
+                }
+
+            private:
+                std::coroutine_handle<promise_type> m_handle;
+            };
+
+            namespace Detail
+            {
+                template<typename T>
+                Task<T> TaskPromise<T>::get_return_object()
+                {
+                    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+                }
+
+                inline Task<void> TaskPromise<void>::get_return_object()
+                {
+                    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+                }
+
+                struct SyncWaitState
+                {
+                    std::mutex lock;
+                    std::condition_variable signal;
+                    std::exception_ptr exception;
+                    bool done = false;
+
+                    void Finish()
+                    {
+                        std::lock_guard<std::mutex> locker(lock);
+                        done = true;
+                        signal.notify_one();
+                    }
+
+                    void Wait()
+                    {
+                        std::unique_lock<std::mutex> locker(lock);
+                        signal.wait(locker, [this] { return done; });
+                        if (exception)
+                        {
+                            std::rethrow_exception(exception);
+                        }
+                    }
+                };
+
+                //the wrappers run detached, so they catch what the awaited task throws and hand it to the waiting thread.
+                template<typename T>
+                Task<void> RunAndStore(Task<T> task, std::optional<T>& result, SyncWaitState& state)
+                {
+#ifdef __cpp_exceptions
+                    try
+                    {
+                        result.emplace(co_await std::move(task));
+                    }
+                    catch (...)
+                    {
+                        state.exception = std::current_exception();
+                    }
+#else
+                    result.emplace(co_await std::move(task));
+#endif
+                    state.Finish();
+                }
+
+                inline Task<void> RunAndSignal(Task<void> task, SyncWaitState& state)
+                {
+#ifdef __cpp_exceptions
+                    try
+                    {
+                        co_await std::move(task);
+                    }
+                    catch (...)
+                    {
+                        state.exception = std::current_exception();
+                    }
+#else
+                    co_await std::move(task);
+#endif
+                    state.Finish();
+                }
+            } // namespace Detail
+
+            /**
+             * Blocks the calling thread until task has finished and returns its result, rethrowing any exception it ended with. Meant
+             * for the edge of a program (main, tests); inside coroutines use co_await.
+             */
+            template<typename T>
+            T SyncWait(Task<T> task)
+            {
+                Detail::SyncWaitState state;
+                std::optional<T> result;
+                Detail::RunAndStore(std::move(task), result, state).Detach();
+                state.Wait();
+                return std::move(*result);
+            }
+
+            inline void SyncWait(Task<void> task)
+            {
+                Detail::SyncWaitState state;
+                Detail::RunAndSignal(std::move(task), state).Detach();
+                state.Wait();
+            }
+
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
+
+#endif // AWS_CORE_COROUTINES
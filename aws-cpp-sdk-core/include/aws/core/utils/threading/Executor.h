@@ -20,7 +20,16 @@
 
 
 #include <functional>
+#include <memory>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSFunction.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSQueue.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace Aws
 {
@@ -66,6 +75,109 @@ namespace Aws
                 bool SubmitToThread(std::function<void()>&&);
             };
 
+            /**
+             * What PooledThreadExecutor does with a task submitted while its queue is full.
+             */
+            enum class OverflowPolicy
+            {
+                /**
+                 * Wait for room in the queue. Tasks submitted from one of the pool's own threads run inline instead, so a full pool
+                 * cannot deadlock on itself.
+                 */
+                BLOCK,
+                /**
+                 * Refuse the task; Submit returns false.
+                 */
+                REJECT_IMMEDIATELY,
+                /**
+                 * Run the task on the submitting thread, which slows producers down to the rate the pool drains at.
+                 */
+                RUN_IN_CALLER
+            };
+
+            /**
+            * Executor that runs tasks on a fixed number of threads fed from a bounded queue, so bursts of async calls neither spawn
+            * a thread per call nor queue unbounded work. Destroying the executor runs every queued task and joins the threads; if the
+            * last reference goes away on one of the pool's own threads, the threads are detached instead and finish the queue on their own.
+            */
+            class AWS_CORE_API PooledThreadExecutor : public Executor
+            {
+            public:
+                PooledThreadExecutor(std::size_t poolSize, std::size_t maxQueueSize, OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK);
+                ~PooledThreadExecutor();
+
+                PooledThreadExecutor(const PooledThreadExecutor&) = delete;
+                PooledThreadExecutor& operator=(const PooledThreadExecutor&) = delete;
+
+                /**
+                 * Stops accepting tasks, waits for the queued ones to finish and joins the threads. Safe to call more than once.
+                 * Called from a task running on the pool it only stops accepting tasks, since a thread cannot join itself; the destructor
+                 * takes care of the threads.
+                 */
+                void Shutdown();
+
+                inline std::size_t GetPoolSize() const { return m_workers.size(); }
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+
+            private:
+                struct PoolState;
+
+                //the threads only touch the shared state, so they can outlive the executor when it is destroyed by one of them.
+                static void WorkerLoop(std::shared_ptr<PoolState> state);
+                void StopAccepting();
+                bool IsWorkerThread() const;
+
+                std::shared_ptr<PoolState> m_state;
+                Aws::Vector<std::thread> m_workers;
+                //filled in by the constructor and never changed, so it can be read without a lock.
+                Aws::Vector<std::thread::id> m_workerIds;
+                std::mutex m_joinLock;
+            };
+
+            /**
+            * Executor for completion handlers that submit follow-up calls. Every thread owns a deque of tasks: tasks submitted from one
+            * of the pool's threads go onto that thread's deque and are run newest first, so a continuation runs right after the task that
+            * queued it, while its data is still in cache. Tasks submitted from other threads are spread round robin over the deques.
+            * Threads that run out of work steal the oldest tasks from the others. Destroying the executor runs every queued task,
+            * including continuations they queue, and joins the threads; if the last reference goes away on one of the pool's own threads,
+            * the threads are detached instead and finish the queues on their own.
+            */
+            class AWS_CORE_API WorkStealingExecutor : public Executor
+            {
+            public:
+                WorkStealingExecutor(std::size_t poolSize);
+                ~WorkStealingExecutor();
+
+                WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+                WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+                /**
+                 * Stops accepting tasks from outside the pool, waits for the queued ones (and anything they submit) to finish and joins
+                 * the threads. Safe to call more than once. Called from a task running on the pool it only stops accepting tasks, since a
+                 * thread cannot join itself; the destructor takes care of the threads.
+                 */
+                void Shutdown();
+
+                inline std::size_t GetPoolSize() const { return m_workers.size(); }
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+
+            private:
+                struct PoolState;
+
+                //the threads only touch the shared state, so they can outlive the executor when it is destroyed by one of them.
+                static void WorkerLoop(std::shared_ptr<PoolState> state, std::size_t index);
+                void StopAccepting();
+                std::size_t GetWorkerIndex() const;
+
+                std::shared_ptr<PoolState> m_state;
+                Aws::Vector<std::thread> m_workers;
+                std::mutex m_joinLock;
+            };
+
 
         } // namespace Threading
     } // namespace Utils
@@ -26,3 +26,17 @@ AmazonWebServiceRequest::AmazonWebServiceRequest() :
 {
 }
 
+
+static const char* AMAZON_WEB_SERVICE_REQUEST_TAG = "AmazonWebServiceRequest";
+
+void AmazonWebServiceRequest::SetResponseBodySink(const Aws::Http::ResponseBodyCallback& callback)
+{
+    m_responseBodySink = Aws::MakeShared<Aws::Http::CallbackBodySink>(AMAZON_WEB_SERVICE_REQUEST_TAG, callback);
+}
+
+std::shared_ptr<Aws::Http::PreallocatedBodySink> AmazonWebServiceRequest::SetResponseBuffer(unsigned char* buffer, std::size_t length)
+{
+    auto bodySink = Aws::MakeShared<Aws::Http::PreallocatedBodySink>(AMAZON_WEB_SERVICE_REQUEST_TAG, buffer, length);
+    m_responseBodySink = bodySink;
+    return bodySink;
+}
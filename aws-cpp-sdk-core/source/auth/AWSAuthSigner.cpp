@@ -16,6 +16,7 @@
 #include <aws/core/auth/AWSAuthSigner.h>
 
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/ChunkedPayloadBodySource.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/HttpResponse.h>
@@ -28,6 +29,7 @@
 #include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/crypto/Sha256HMAC.h>
 
+#include <atomic>
 #include <cstdio>
 #include <iomanip>
 #include <math.h>
@@ -51,51 +53,118 @@ static const char* X_AMZ_SIGNED_HEADERS = "X-Amz-SignedHeaders";
 static const char* X_AMZ_ALGORITHM = "X-Amz-Algorithm";
 static const char* X_AMZ_CREDENTIAL = "X-Amz-Credential";
 static const char* UNSIGNED_PAYLOAD = "UNSIGNED-PAYLOAD";
+static const char* STREAMING_PAYLOAD = "STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
+static const char* CONTENT_ENCODING_HEADER = "content-encoding";
+static const char* AWS_CHUNKED = "aws-chunked";
+static const char* X_AMZ_DECODED_CONTENT_LENGTH = "x-amz-decoded-content-length";
 static const char* X_AMZ_SIGNATURE = "X-Amz-Signature";
 static const char* SIGNING_KEY = "AWS4";
 static const char* LONG_DATE_FORMAT_STR = "%Y%m%dT%H%M%SZ";
-static const char* SIMPLE_DATE_FORMAT_STR = "%Y%m%d";
+//length of the yyyyMMdd prefix of LONG_DATE_FORMAT_STR.
+static const size_t SIMPLE_DATE_LENGTH = 8;
 
 static const char* v4LogTag = "AWSAuthV4Signer";
 
-Aws::String CanonicalizeRequestSigningString(HttpRequest& request)
+//the method, path and query string lines of the canonical request; the query string is expected to be canonicalized already.
+static std::size_t CanonicalRequestPrefixLength(const HttpRequest& request, const Aws::String& encodedPath)
 {
-    request.CanonicalizeRequest();
-    Aws::StringStream signingStringStream;
-    signingStringStream << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
+    return strlen(HttpMethodMapper::GetNameForHttpMethod(request.GetMethod())) + encodedPath.length() + request.GetQueryString().length() + 4;
+}
 
-    signingStringStream << NEWLINE << request.GetUri().GetURLEncodedPath() << NEWLINE;
+static void AppendCanonicalRequestPrefix(const HttpRequest& request, const Aws::String& encodedPath, Aws::String& canonicalRequest)
+{
+    canonicalRequest.append(HttpMethodMapper::GetNameForHttpMethod(request.GetMethod()));
+    canonicalRequest.append(NEWLINE);
+    canonicalRequest.append(encodedPath);
+    canonicalRequest.append(NEWLINE);
 
-    if (request.GetQueryString().size() > 1 && request.GetQueryString().find("=") != std::string::npos)
+    const Aws::String& queryString = request.GetQueryString();
+    if (queryString.size() > 1)
     {
-        signingStringStream << request.GetQueryString().substr(1) << NEWLINE;
+        canonicalRequest.append(queryString, 1, Aws::String::npos);
+        if (queryString.find('=') == Aws::String::npos)
+        {
+            canonicalRequest.append(EQ);
+        }
     }
-    else if (request.GetQueryString().size() > 1)
+    canonicalRequest.append(NEWLINE);
+}
+
+struct AWSAuthV4Signer::SigningKey
+{
+    SigningKey(const Aws::String& secret, const Aws::String& date, const ByteBuffer& derivedKey) :
+        secretKey(secret), simpleDate(date), key(derivedKey)
     {
-        signingStringStream << request.GetQueryString().substr(1) << "=" << NEWLINE;
     }
-    else
+
+    Aws::String secretKey;
+    Aws::String simpleDate;
+    ByteBuffer key;
+};
+
+class AWSAuthV4Signer::SigningKeyLease
+{
+public:
+    SigningKeyLease(const AWSAuthV4Signer& signer, const AWSCredentials& credentials, const Aws::String& simpleDate) :
+        m_signer(signer), m_signingKey(nullptr)
     {
-        signingStringStream << NEWLINE;
+        //counted before the pointer is loaded, so whichever key this sees stays alive until the count drops again.
+        ++m_signer.m_signingKeyReaders;
+        SigningKey* cached = m_signer.m_signingKey.load();
+        if (cached && cached->simpleDate == simpleDate && cached->secretKey == credentials.GetAWSSecretKey())
+        {
+            m_signingKey = cached;
+            return;
+        }
+
+        m_signingKey = m_signer.PublishSigningKey(credentials, simpleDate);
     }
 
-    return signingStringStream.str();
-}
+    ~SigningKeyLease()
+    {
+        if (--m_signer.m_signingKeyReaders == 0 && m_signer.m_hasRetiredSigningKeys.load())
+        {
+            m_signer.ReclaimRetiredSigningKeys();
+        }
+    }
+
+    SigningKeyLease(const SigningKeyLease&) = delete;
+    SigningKeyLease& operator=(const SigningKeyLease&) = delete;
+
+    /**
+     * The signing key, or null if it could not be derived.
+     */
+    const SigningKey* Get() const { return m_signingKey; }
+
+private:
+    const AWSAuthV4Signer& m_signer;
+    const SigningKey* m_signingKey;
+};
 
 AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
     const char* serviceName,
-    const Aws::String& region) :
+    const Aws::String& region,
+    PayloadSigningPolicy payloadSigningPolicy) :
     m_credentialsProvider(credentialsProvider),
     m_serviceName(serviceName),
     m_region(region),
-    m_hash(Aws::MakeUnique<Aws::Utils::Crypto::Sha256>(v4LogTag)),
-    m_HMAC(Aws::MakeUnique<Aws::Utils::Crypto::Sha256HMAC>(v4LogTag))
+    m_payloadSigningPolicy(payloadSigningPolicy),
+    m_hashes(v4LogTag),
+    m_HMACs(v4LogTag),
+    m_signingKey(nullptr),
+    m_signingKeyReaders(0),
+    m_hasRetiredSigningKeys(false)
 {
 }
 
 AWSAuthV4Signer::~AWSAuthV4Signer()
 {
-    // empty destructor in .cpp file to keep from needing the implementation of (AWSCredentialsProvider, Sha256, Sha256HMAC) in the header file 
+    //nothing can be signing with a signer that is being destroyed, so every key can go.
+    Aws::Delete(m_signingKey.load());
+    for (auto signingKey : m_retiredSigningKeys)
+    {
+        Aws::Delete(signingKey);
+    }
 }
 
 bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
@@ -114,40 +183,75 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
     }
 
     //calculate date header to use in internal signature (this also goes into date header).
-    Aws::String dateHeaderValue = DateTime::CalculateGmtTimestampAsString(LONG_DATE_FORMAT_STR);
+    //the credential scope date is its leading yyyyMMdd, so the clock is only read once.
+    Aws::String dateHeaderValue = GetSigningTimestamp();
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
+    Aws::String simpleDate(dateHeaderValue, 0, SIMPLE_DATE_LENGTH);
 
-    Aws::String payloadHash(ComputePayloadHash(request));
-    if (payloadHash.empty())
+    //with chunked signing the body is encoded and signed while it is sent, and the headers only announce that.
+    int64_t chunkedPayloadLength = GetChunkablePayloadLength(request);
+    Aws::String payloadHash;
+    if (chunkedPayloadLength > 0)
     {
-        return false;
+        payloadHash = STREAMING_PAYLOAD;
+        const Aws::String& contentEncoding = request.GetHeaderValue(CONTENT_ENCODING_HEADER);
+        request.SetHeaderValue(CONTENT_ENCODING_HEADER, contentEncoding.empty() ? Aws::String(AWS_CHUNKED) : AWS_CHUNKED + Aws::String(",") + contentEncoding);
+        request.SetHeaderValue(X_AMZ_DECODED_CONTENT_LENGTH, StringUtils::to_string(chunkedPayloadLength));
+        request.SetContentLength(StringUtils::to_string(ChunkedPayloadBodySource::ComputeEncodedLength(chunkedPayloadLength)));
+    }
+    else if (m_payloadSigningPolicy == PayloadSigningPolicy::UNSIGNED_OVER_HTTPS && request.GetUri().GetScheme() == Scheme::HTTPS)
+    {
+        payloadHash = UNSIGNED_PAYLOAD;
+    }
+    else
+    {
+        payloadHash = ComputePayloadHash(request);
+        if (payloadHash.empty())
+        {
+            return false;
+        }
     }
 
     request.SetHeaderValue("x-amz-content-sha256", payloadHash);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
+    request.CanonicalizeRequest();
+    HeaderValueCollection headers = request.GetHeaders();
+    Aws::String encodedPath = request.GetUri().GetURLEncodedPath();
 
-    for (const auto& header : request.GetHeaders())
+    //size everything up front so the canonical request is built with a single allocation.
+    std::size_t headerNamesLength = 0;
+    std::size_t headerValuesLength = 0;
+    for (const auto& header : headers)
     {
-        headersStream << header.first << ":" << header.second << NEWLINE;
-        signedHeadersStream << header.first << ";";
+        headerNamesLength += header.first.length();
+        headerValuesLength += header.second.length();
     }
 
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
-
     //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    signedHeadersValue.erase(signedHeadersValue.length() - 1);
+    Aws::String signedHeadersValue;
+    signedHeadersValue.reserve(headerNamesLength + headers.size());
+    for (const auto& header : headers)
+    {
+        if (!signedHeadersValue.empty())
+        {
+            signedHeadersValue.append(";");
+        }
+        signedHeadersValue.append(header.first);
+    }
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
 
-    //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request);
-
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
+    //generate generalized canonicalized request string, followed by the v4 stuff.
+    Aws::String canonicalRequestString;
+    canonicalRequestString.reserve(CanonicalRequestPrefixLength(request, encodedPath) + headerNamesLength + headerValuesLength + 2 * headers.size() +
+        signedHeadersValue.length() + payloadHash.length() + 2);
+    AppendCanonicalRequestPrefix(request, encodedPath, canonicalRequestString);
+    for (const auto& header : headers)
+    {
+        canonicalRequestString.append(header.first);
+        canonicalRequestString.append(":");
+        canonicalRequestString.append(header.second);
+        canonicalRequestString.append(NEWLINE);
+    }
     canonicalRequestString.append(NEWLINE);
     canonicalRequestString.append(signedHeadersValue);
     canonicalRequestString.append(NEWLINE);
@@ -155,7 +259,7 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
+    auto hashResult = m_hashes.Acquire()->Calculate(canonicalRequestString);
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << canonicalRequestString << "\"");
@@ -164,20 +268,57 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
 
     auto sha256Digest = hashResult.GetResult();
     Aws::String cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
-    Aws::String simpleDate = DateTime::CalculateGmtTimestampAsString(SIMPLE_DATE_FORMAT_STR);
 
     Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, cannonicalRequestHash);
     auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate);
+    if (finalSignature.empty())
+    {
+        return false;
+    }
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << m_region << "/" << m_serviceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << finalSignature;
+    Aws::String awsAuthString;
+    awsAuthString.reserve(strlen(AWS_HMAC_SHA256) + strlen(CREDENTIAL) + credentials.GetAWSAccessKeyId().length() + simpleDate.length() +
+        m_region.length() + m_serviceName.length() + strlen(AWS4_REQUEST) + strlen(SIGNED_HEADERS) + signedHeadersValue.length() +
+        strlen(SIGNATURE) + finalSignature.length() + 15);
+    awsAuthString.append(AWS_HMAC_SHA256);
+    awsAuthString.append(" ");
+    awsAuthString.append(CREDENTIAL);
+    awsAuthString.append(EQ);
+    awsAuthString.append(credentials.GetAWSAccessKeyId());
+    awsAuthString.append("/");
+    AppendCredentialScope(simpleDate, awsAuthString);
+    awsAuthString.append(", ");
+    awsAuthString.append(SIGNED_HEADERS);
+    awsAuthString.append(EQ);
+    awsAuthString.append(signedHeadersValue);
+    awsAuthString.append(", ");
+    awsAuthString.append(SIGNATURE);
+    awsAuthString.append(EQ);
+    awsAuthString.append(finalSignature);
 
-    auto awsAuthString = ss.str();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
 
+    if (chunkedPayloadLength > 0)
+    {
+        SigningKeyLease signingKey(*this, credentials, simpleDate);
+        if (!signingKey.Get())
+        {
+            return false;
+        }
+
+        Aws::String credentialScope;
+        AppendCredentialScope(simpleDate, credentialScope);
+
+        std::shared_ptr<RequestBodySource> payload = request.GetContentBodySource();
+        if (!payload)
+        {
+            payload = Aws::MakeShared<StreamBodySource>(v4LogTag, request.GetContentBody());
+        }
+        request.SetContentBodySource(Aws::MakeShared<ChunkedPayloadBodySource>(v4LogTag, payload, chunkedPayloadLength, signingKey.Get()->key,
+            dateHeaderValue, credentialScope, finalSignature));
+    }
+
     return true;
 }
 
@@ -191,9 +332,7 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
         return true;
     }
 
-    Aws::StringStream intConversionStream;
-    intConversionStream << expirationTimeInSeconds;
-    request.AddQueryStringParameter(Http::X_AMZ_EXPIRES_HEADER, intConversionStream.str());   
+    request.AddQueryStringParameter(Http::X_AMZ_EXPIRES_HEADER, StringUtils::to_string(expirationTimeInSeconds));
 
     if (!credentials.GetSessionToken().empty())
     {
@@ -201,15 +340,11 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
     }
 
     //calculate date header to use in internal signature (this also goes into date header).
-    Aws::String dateQueryValue = DateTime::CalculateGmtTimestampAsString(LONG_DATE_FORMAT_STR);
+    Aws::String dateQueryValue = GetSigningTimestamp();
     request.AddQueryStringParameter(Http::AWS_DATE_HEADER, dateQueryValue);
+    Aws::String simpleDate(dateQueryValue, 0, SIMPLE_DATE_LENGTH);
 
-    Aws::StringStream ss;
-    ss << Http::HOST_HEADER << ":" << request.GetHeaderValue(Http::HOST_HEADER) << NEWLINE;
-    Aws::String canonicalHeadersString(ss.str());
-    ss.str("");
-
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
+    const Aws::String& hostHeaderValue = request.GetHeaderValue(Http::HOST_HEADER);
 
     //calculate signed headers parameter
     Aws::String signedHeadersValue(Http::HOST_HEADER);
@@ -217,19 +352,28 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
     
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value: " << signedHeadersValue);
 
-    Aws::String simpleDate = DateTime::CalculateGmtTimestampAsString(SIMPLE_DATE_FORMAT_STR);
-    ss << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << m_region << "/" << m_serviceName << "/" << AWS4_REQUEST;
+    Aws::String credentialValue;
+    credentialValue.reserve(credentials.GetAWSAccessKeyId().length() + simpleDate.length() + m_region.length() + m_serviceName.length() +
+        strlen(AWS4_REQUEST) + 4);
+    credentialValue.append(credentials.GetAWSAccessKeyId());
+    credentialValue.append("/");
+    AppendCredentialScope(simpleDate, credentialValue);
 
     request.AddQueryStringParameter(X_AMZ_ALGORITHM, AWS_HMAC_SHA256);
-    request.AddQueryStringParameter(X_AMZ_CREDENTIAL, ss.str());
-    ss.str("");
-
-    //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request);
+    request.AddQueryStringParameter(X_AMZ_CREDENTIAL, credentialValue);
 
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
+    //generate generalized canonicalized request string, followed by the v4 stuff.
+    request.CanonicalizeRequest();
+    Aws::String encodedPath = request.GetUri().GetURLEncodedPath();
+
+    Aws::String canonicalRequestString;
+    canonicalRequestString.reserve(CanonicalRequestPrefixLength(request, encodedPath) + strlen(Http::HOST_HEADER) + hostHeaderValue.length() +
+        signedHeadersValue.length() + strlen(UNSIGNED_PAYLOAD) + 4);
+    AppendCanonicalRequestPrefix(request, encodedPath, canonicalRequestString);
+    canonicalRequestString.append(Http::HOST_HEADER);
+    canonicalRequestString.append(":");
+    canonicalRequestString.append(hostHeaderValue);
+    canonicalRequestString.append(NEWLINE);
     canonicalRequestString.append(NEWLINE);
     canonicalRequestString.append(signedHeadersValue);
     canonicalRequestString.append(NEWLINE);
@@ -237,7 +381,7 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
+    auto hashResult = m_hashes.Acquire()->Calculate(canonicalRequestString);
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << canonicalRequestString << "\"");
@@ -265,67 +409,132 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials
 {
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Final String to sign: " << stringToSign);
 
-    Aws::StringStream ss;
+    SigningKeyLease signingKey(*this, credentials, simpleDate);
+    if (!signingKey.Get())
+    {
+        return "";
+    }
+
+    auto hashResult = m_HMACs.Acquire()->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), signingKey.Get()->key);
+    if (!hashResult.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) final string \"" << stringToSign << "\"");
+        return "";
+    }
+
+    //now we finally sign our request string with our hex encoded derived hash.
+    auto finalSigningDigest = hashResult.GetResult();
+
+    auto finalSigningHash = HashingUtils::HexEncode(finalSigningDigest);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Final computed signing hash: " << finalSigningHash);
+
+    return finalSigningHash;
+}
+
+Aws::String AWSAuthV4Signer::GetSigningTimestamp() const
+{
+    return DateTime::CalculateGmtTimestampAsString(LONG_DATE_FORMAT_STR);
+}
+
+AWSAuthV4Signer::SigningKey* AWSAuthV4Signer::PublishSigningKey(const AWSCredentials& credentials, const Aws::String& simpleDate) const
+{
+    //a new day or rotated credentials; racing threads may each derive the key, whichever publishes last wins.
+    auto derivedKey = ComputeSigningKey(credentials.GetAWSSecretKey(), simpleDate);
+    if (derivedKey.GetLength() == 0)
+    {
+        return nullptr;
+    }
+
+    SigningKey* signingKey = Aws::New<SigningKey>(v4LogTag, credentials.GetAWSSecretKey(), simpleDate, derivedKey);
+    SigningKey* replaced = m_signingKey.exchange(signingKey);
+    if (replaced)
+    {
+        std::lock_guard<std::mutex> locker(m_retiredSigningKeysLock);
+        m_retiredSigningKeys.push_back(replaced);
+        m_hasRetiredSigningKeys = true;
+    }
+    return signingKey;
+}
+
+void AWSAuthV4Signer::ReclaimRetiredSigningKeys() const
+{
+    std::lock_guard<std::mutex> locker(m_retiredSigningKeysLock);
+    //a key is unpublished before it is retired, so a reader can only hold one if it was counted before then and is still counted.
+    if (m_signingKeyReaders.load() != 0)
+    {
+        return;
+    }
+
+    for (auto signingKey : m_retiredSigningKeys)
+    {
+        Aws::Delete(signingKey);
+    }
+    m_retiredSigningKeys.clear();
+    m_hasRetiredSigningKeys = false;
+}
 
+ByteBuffer AWSAuthV4Signer::ComputeSigningKey(const Aws::String& secretKey, const Aws::String& simpleDate) const
+{
     //now we do the complicated part of deriving a signing key.
     Aws::String signingKey(SIGNING_KEY);
-    signingKey.append(credentials.GetAWSSecretKey());
+    signingKey.append(secretKey);
 
     //we use digest only for the derivation process.
-    auto hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)simpleDate.c_str(), simpleDate.length()),
+    auto hmac = m_HMACs.Acquire();
+    auto hashResult = hmac->Calculate(ByteBuffer((unsigned char*)simpleDate.c_str(), simpleDate.length()),
         ByteBuffer((unsigned char*)signingKey.c_str(), signingKey.length()));
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) date string \"" << simpleDate << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kDate = hashResult.GetResult();
-    hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)m_region.c_str(), m_region.length()), kDate);
+    hashResult = hmac->Calculate(ByteBuffer((unsigned char*)m_region.c_str(), m_region.length()), kDate);
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) region string \"" << m_region << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kRegion = hashResult.GetResult();
-    hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)m_serviceName.c_str(), m_serviceName.length()), kRegion);
+    hashResult = hmac->Calculate(ByteBuffer((unsigned char*)m_serviceName.c_str(), m_serviceName.length()), kRegion);
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) service string \"" << m_serviceName << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kService = hashResult.GetResult();
-    hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)AWS4_REQUEST, strlen(AWS4_REQUEST)), kService);
+    hashResult = hmac->Calculate(ByteBuffer((unsigned char*)AWS4_REQUEST, strlen(AWS4_REQUEST)), kService);
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) request string \"" << AWS4_REQUEST << "\"");
-        return "";
-    }
-
-    auto kSigning = hashResult.GetResult();
-    hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), kSigning);
-    if (!hashResult.IsSuccess())
-    {
-        AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) final string \"" << stringToSign << "\"");
-        return "";
+        return ByteBuffer();
     }
 
-    //now we finally sign our request string with our hex encoded derived hash.
-    auto finalSigningDigest = hashResult.GetResult();
-
-    auto finalSigningHash = HashingUtils::HexEncode(finalSigningDigest);
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Final computed signing hash: " << finalSigningHash);
-
-    return finalSigningHash;
+    return hashResult.GetResult();
 }
 
 Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request) const
 {
+    //whoever read the body before us (the client computing Content-MD5, the transfer manager) may have hashed it already.
+    if ((request.GetContentBody() || request.GetContentBodySource()) && request.GetContentSha256().GetLength() > 0)
+    {
+        return HashingUtils::HexEncode(request.GetContentSha256());
+    }
+
+    //a body sent only from a source cannot be rewound here; signing it as empty would just be rejected by the service.
+    if (!request.GetContentBody() && request.GetContentBodySource())
+    {
+        AWS_LOG_ERROR(v4LogTag, "Request body is sent from a source without a precomputed sha256, unable to sign its payload");
+        return "";
+    }
+
     //compute hash on payload if it exists.
-    auto hashResult = request.GetContentBody() ? m_hash->Calculate(*request.GetContentBody())
-        : m_hash->Calculate("");
+    auto hash = m_hashes.Acquire();
+    auto hashResult = request.GetContentBody() ? hash->Calculate(*request.GetContentBody())
+        : hash->Calculate("");
     if (!hashResult.IsSuccess())
     {
         AWS_LOG_ERROR(v4LogTag, "Unable to hash (sha256) request body");
@@ -339,13 +548,41 @@ Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request)
     return payloadHash;
 }
 
+int64_t AWSAuthV4Signer::GetChunkablePayloadLength(const Aws::Http::HttpRequest& request) const
+{
+    if (m_payloadSigningPolicy != PayloadSigningPolicy::SIGN_CHUNKS || (!request.GetContentBody() && !request.GetContentBodySource()) ||
+        !request.HasHeader(CONTENT_LENGTH_HEADER))
+    {
+        return 0;
+    }
+
+    return StringUtils::ConvertToInt64(request.GetContentLength().c_str());
+}
+
 Aws::String AWSAuthV4Signer::GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& canonicalRequestHash) const
 {
     //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
-
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << m_region << "/"
-        << m_serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
+    Aws::String stringToSign;
+    stringToSign.reserve(strlen(AWS_HMAC_SHA256) + dateValue.length() + simpleDate.length() + m_region.length() + m_serviceName.length() +
+        strlen(AWS4_REQUEST) + canonicalRequestHash.length() + 6);
+    stringToSign.append(AWS_HMAC_SHA256);
+    stringToSign.append(NEWLINE);
+    stringToSign.append(dateValue);
+    stringToSign.append(NEWLINE);
+    AppendCredentialScope(simpleDate, stringToSign);
+    stringToSign.append(NEWLINE);
+    stringToSign.append(canonicalRequestHash);
+
+    return stringToSign;
+}
 
-    return ss.str();
+void AWSAuthV4Signer::AppendCredentialScope(const Aws::String& simpleDate, Aws::String& output) const
+{
+    output.append(simpleDate);
+    output.append("/");
+    output.append(m_region);
+    output.append("/");
+    output.append(m_serviceName);
+    output.append("/");
+    output.append(AWS4_REQUEST);
 }
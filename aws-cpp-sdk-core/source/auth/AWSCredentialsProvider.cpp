@@ -22,10 +22,15 @@
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/internal/EC2MetadataClient.h>
 #include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <chrono>
 #include <fstream>
+#include <cstdint>
+#include <limits>
 #include <string.h>
 
 #ifdef _WIN32
@@ -79,6 +84,266 @@ bool AWSCredentialsProvider::IsTimeToRefresh(long reloadFrequency)
 }
 
 
+static const char* refreshingLogTag = "BackgroundRefreshingAWSCredentialsProvider";
+
+//reloads start somewhere in the last tenth of the refresh interval, so providers created together spread their reloads out.
+static const long REFRESH_JITTER_DIVISOR = 10;
+
+static long long SteadyNowMs()
+{
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * One thread that reloads every provider that has credentials to keep fresh, each at its own time.
+ */
+class BackgroundRefreshingAWSCredentialsProvider::RefreshScheduler
+{
+public:
+    /**
+     * Reloads provider after delay and then on whatever schedule its refreshes ask for, until Unregister.
+     */
+    static void Register(BackgroundRefreshingAWSCredentialsProvider* provider, std::chrono::milliseconds delay)
+    {
+        std::lock_guard<std::mutex> locker(s_instanceMutex);
+        if (s_instance == nullptr)
+        {
+            s_instance = Aws::New<RefreshScheduler>(refreshingLogTag);
+        }
+
+        ++s_registeredProviders;
+        s_instance->Schedule(provider, delay);
+    }
+
+    static void Unregister(BackgroundRefreshingAWSCredentialsProvider* provider)
+    {
+        //provider still counts as registered until the cancel is done, so the instance cannot go away underneath it. The wait for
+        //a running reload happens outside s_instanceMutex, since that reload may itself register a provider.
+        RefreshScheduler* instance = nullptr;
+        {
+            std::lock_guard<std::mutex> locker(s_instanceMutex);
+            instance = s_instance;
+        }
+
+        instance->Cancel(provider);
+
+        RefreshScheduler* unused = nullptr;
+        {
+            std::lock_guard<std::mutex> locker(s_instanceMutex);
+            if (--s_registeredProviders == 0)
+            {
+                unused = s_instance;
+                s_instance = nullptr;
+            }
+        }
+
+        //joins the refresh thread, which has nothing left to reload; a later Register starts a new one meanwhile.
+        Aws::Delete(unused);
+    }
+
+    RefreshScheduler() : m_refreshing(nullptr), m_stop(false)
+    {
+        m_thread = std::thread(&RefreshScheduler::Run, this);
+    }
+
+    ~RefreshScheduler()
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_stop = true;
+        }
+
+        m_signal.notify_all();
+        m_thread.join();
+    }
+
+    void Schedule(BackgroundRefreshingAWSCredentialsProvider* provider, std::chrono::milliseconds delay)
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_due.insert(DueRefresh(std::chrono::steady_clock::now() + delay, provider));
+        }
+
+        m_signal.notify_all();
+    }
+
+    void Cancel(BackgroundRefreshingAWSCredentialsProvider* provider)
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        //a running reload puts the provider back on the schedule when it is done, so wait for it before taking it off.
+        m_signal.wait(locker, [this, provider] { return m_refreshing != provider; });
+        for (auto due = m_due.begin(); due != m_due.end(); ++due)
+        {
+            if (due->second == provider)
+            {
+                m_due.erase(due);
+                break;
+            }
+        }
+    }
+
+private:
+    typedef std::pair<std::chrono::steady_clock::time_point, BackgroundRefreshingAWSCredentialsProvider*> DueRefresh;
+
+    void Run()
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        while (!m_stop)
+        {
+            if (m_due.empty())
+            {
+                m_signal.wait(locker);
+                continue;
+            }
+
+            auto next = m_due.begin();
+            if (next->first > std::chrono::steady_clock::now())
+            {
+                m_signal.wait_until(locker, next->first);
+                continue;
+            }
+
+            BackgroundRefreshingAWSCredentialsProvider* provider = next->second;
+            m_due.erase(next);
+            m_refreshing = provider;
+
+            //other providers may be scheduled and cancelled while this one talks to its source.
+            locker.unlock();
+            std::chrono::milliseconds delay = provider->Refresh();
+            locker.lock();
+
+            m_due.insert(DueRefresh(std::chrono::steady_clock::now() + delay, provider));
+            m_refreshing = nullptr;
+            m_signal.notify_all();
+        }
+    }
+
+    static std::mutex s_instanceMutex;
+    //created with the first provider that needs refreshing and deleted with the last, so no thread is left running once they are gone.
+    static RefreshScheduler* s_instance;
+    static std::size_t s_registeredProviders;
+
+    Aws::Set<DueRefresh> m_due;
+    BackgroundRefreshingAWSCredentialsProvider* m_refreshing;
+    bool m_stop;
+    std::mutex m_lock;
+    std::condition_variable m_signal;
+    std::thread m_thread;
+};
+
+std::mutex BackgroundRefreshingAWSCredentialsProvider::RefreshScheduler::s_instanceMutex;
+BackgroundRefreshingAWSCredentialsProvider::RefreshScheduler* BackgroundRefreshingAWSCredentialsProvider::RefreshScheduler::s_instance = nullptr;
+std::size_t BackgroundRefreshingAWSCredentialsProvider::RefreshScheduler::s_registeredProviders = 0;
+
+BackgroundRefreshingAWSCredentialsProvider::BackgroundRefreshingAWSCredentialsProvider(long refreshRateMs) :
+        m_credentials(nullptr),
+        m_loadFrequencyMs(refreshRateMs),
+        m_jitter(static_cast<std::minstd_rand::result_type>(std::chrono::steady_clock::now().time_since_epoch().count()) ^
+                 static_cast<std::minstd_rand::result_type>(reinterpret_cast<uintptr_t>(this))),
+        m_nextLoadAttemptMs(0),
+        m_scheduled(false),
+        m_stopRefresh(false)
+{
+}
+
+BackgroundRefreshingAWSCredentialsProvider::~BackgroundRefreshingAWSCredentialsProvider()
+{
+    StopRefreshing();
+}
+
+bool BackgroundRefreshingAWSCredentialsProvider::ShouldLoad(const std::shared_ptr<const AWSCredentials>& credentials) const
+{
+    if (!credentials)
+    {
+        return true;
+    }
+
+    return credentials->GetAWSAccessKeyId().empty() && SteadyNowMs() >= m_nextLoadAttemptMs;
+}
+
+AWSCredentials BackgroundRefreshingAWSCredentialsProvider::GetAWSCredentials()
+{
+    std::shared_ptr<const AWSCredentials> credentials = std::atomic_load(&m_credentials);
+    if (!ShouldLoad(credentials))
+    {
+        return *credentials;
+    }
+
+    //only the first calls, and calls to a provider whose source had nothing, get here; one of them loads while the others wait.
+    std::lock_guard<std::mutex> locker(m_refreshMutex);
+    credentials = std::atomic_load(&m_credentials);
+    if (!ShouldLoad(credentials))
+    {
+        return *credentials;
+    }
+
+    AWSCredentials loaded = LoadCredentials();
+    Publish(loaded);
+
+    //there is nothing to keep fresh until the source has produced credentials.
+    if (!loaded.GetAWSAccessKeyId().empty() && m_loadFrequencyMs > 0 && !m_scheduled && !m_stopRefresh)
+    {
+        m_scheduled = true;
+        RefreshScheduler::Register(this, NextRefreshDelay());
+    }
+
+    return loaded;
+}
+
+void BackgroundRefreshingAWSCredentialsProvider::Publish(const AWSCredentials& credentials)
+{
+    if (credentials.GetAWSAccessKeyId().empty())
+    {
+        //0 or less means load once, and that holds for an empty load as well.
+        m_nextLoadAttemptMs = m_loadFrequencyMs > 0 ? SteadyNowMs() + GetRefreshIntervalMs() : (std::numeric_limits<long long>::max)();
+    }
+
+    std::atomic_store(&m_credentials, std::shared_ptr<const AWSCredentials>(Aws::MakeShared<AWSCredentials>(refreshingLogTag, credentials)));
+}
+
+void BackgroundRefreshingAWSCredentialsProvider::StopRefreshing()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_refreshMutex);
+        m_stopRefresh = true;
+        if (!m_scheduled)
+        {
+            return;
+        }
+        m_scheduled = false;
+    }
+
+    RefreshScheduler::Unregister(this);
+}
+
+long BackgroundRefreshingAWSCredentialsProvider::GetRefreshIntervalMs() const
+{
+    return m_loadFrequencyMs;
+}
+
+std::chrono::milliseconds BackgroundRefreshingAWSCredentialsProvider::NextRefreshDelay()
+{
+    long interval = GetRefreshIntervalMs();
+    long maxJitter = interval / REFRESH_JITTER_DIVISOR;
+    long jitter = maxJitter > 0 ? static_cast<long>(m_jitter() % (maxJitter + 1)) : 0;
+    return std::chrono::milliseconds(interval - jitter);
+}
+
+std::chrono::milliseconds BackgroundRefreshingAWSCredentialsProvider::Refresh()
+{
+    //readers keep getting the current credentials while the source is being read.
+    std::lock_guard<std::mutex> locker(m_refreshMutex);
+    if (!m_stopRefresh)
+    {
+        AWS_LOG_DEBUG(refreshingLogTag, "Reloading credentials in the background.");
+        Publish(LoadCredentials());
+    }
+
+    return NextRefreshDelay();
+}
+
+
 static const char* environmentLogTag = "EnvironmentAWSCredentialsProvider";
 
 
@@ -167,9 +432,12 @@ static const char* profileLogTag = "ProfileConfigFileAWSCredentialsProvider";
 
 
 ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider(long refreshRateMs) :
+        BackgroundRefreshingAWSCredentialsProvider(refreshRateMs),
         m_fileName(GetProfileFilename()),
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        m_profiles(nullptr),
+        m_fileExists(false),
+        m_fileSize(0),
+        m_fileModificationTime(0)
 {
     char* profileFromVar = std::getenv(AWS_PROFILE_ENVIRONMENT_VARIABLE);
     if (profileFromVar)
@@ -187,54 +455,69 @@ ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider
 }
 
 ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider(const char* profile, long refreshRateMs) :
+        BackgroundRefreshingAWSCredentialsProvider(refreshRateMs),
         m_fileName(GetProfileFilename()),
         m_profileToUse(profile),
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        m_profiles(nullptr),
+        m_fileExists(false),
+        m_fileSize(0),
+        m_fileModificationTime(0)
 {
     AWS_LOGSTREAM_INFO(profileLogTag, "Setting provider to read credentials from " << m_fileName
                                       << ", for use with profile " << m_profileToUse);
 }
 
-AWSCredentials ProfileConfigFileAWSCredentialsProvider::GetAWSCredentials()
+ProfileConfigFileAWSCredentialsProvider::~ProfileConfigFileAWSCredentialsProvider()
 {
-    RefreshIfExpired();
-    assert(m_credentials != nullptr);
-    return *m_credentials;
+    StopRefreshing();
 }
 
-
-void ProfileConfigFileAWSCredentialsProvider::RefreshIfExpired()
+AWSCredentials ProfileConfigFileAWSCredentialsProvider::LoadCredentials()
 {
-    std::lock_guard<std::mutex> locker(m_reloadMutex);
-    if (!m_credentials || IsTimeToRefresh(m_loadFrequencyMs))
+    //checked before parsing, so a rewrite that lands while the file is being read is picked up on the next check.
+    uint64_t fileSize = 0;
+    int64_t fileModificationTime = 0;
+    bool fileExists = FileSystemUtils::GetFileSizeAndModificationTime(m_fileName.c_str(), fileSize, fileModificationTime);
+
+    std::shared_ptr<const Aws::Map<Aws::String, Aws::String>> profiles = std::atomic_load(&m_profiles);
+    if (profiles && fileExists == m_fileExists && fileSize == m_fileSize && fileModificationTime == m_fileModificationTime)
+    {
+        AWS_LOG_TRACE(profileLogTag, "Profile file unchanged, keeping the parsed profiles.");
+    }
+    else
     {
         AWS_LOG_DEBUG(profileLogTag, "Refreshing credentials.");
 
-        Aws::Map<Aws::String, Aws::String> propertyValueMap = ParseProfileConfigFile(m_fileName);
+        profiles = Aws::MakeShared<Aws::Map<Aws::String, Aws::String>>(profileLogTag, ParseProfileConfigFile(m_fileName));
+        std::atomic_store(&m_profiles, profiles);
+        m_fileExists = fileExists;
+        m_fileSize = fileSize;
+        m_fileModificationTime = fileModificationTime;
+    }
+
+    const Aws::Map<Aws::String, Aws::String>& propertyValueMap = *profiles;
 
-        Aws::String accessKey, secretKey, sessionToken;
-        auto accessKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_ACCESS_KEY_ID);
-        auto secretKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SECRET_ACCESS_KEY);
-        auto sessionTokenIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SESSION_TOKEN);
+    Aws::String accessKey, secretKey, sessionToken;
+    auto accessKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_ACCESS_KEY_ID);
+    auto secretKeyIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SECRET_ACCESS_KEY);
+    auto sessionTokenIter = propertyValueMap.find(m_profileToUse + ":" + AWS_SESSION_TOKEN);
 
-        if (accessKeyIter != propertyValueMap.end())
-            accessKey = accessKeyIter->second;
-        else
-        AWS_LOG_INFO(profileLogTag, "Access key for profile not found.");
+    if (accessKeyIter != propertyValueMap.end())
+        accessKey = accessKeyIter->second;
+    else
+    AWS_LOG_INFO(profileLogTag, "Access key for profile not found.");
 
-        if (secretKeyIter != propertyValueMap.end())
-            secretKey = secretKeyIter->second;
-        else
-        AWS_LOG_INFO(profileLogTag, "Secret key for profile not found.");
+    if (secretKeyIter != propertyValueMap.end())
+        secretKey = secretKeyIter->second;
+    else
+    AWS_LOG_INFO(profileLogTag, "Secret key for profile not found.");
 
-        if (sessionTokenIter != propertyValueMap.end())
-            sessionToken = sessionTokenIter->second;
-        else
-        AWS_LOG_INFO(profileLogTag, "Optional session token for profile not found.");
+    if (sessionTokenIter != propertyValueMap.end())
+        sessionToken = sessionTokenIter->second;
+    else
+    AWS_LOG_INFO(profileLogTag, "Optional session token for profile not found.");
 
-        m_credentials = Aws::MakeShared<AWSCredentials>(profileLogTag, accessKey, secretKey, sessionToken);
-    }
+    return AWSCredentials(accessKey, secretKey, sessionToken);
 }
 
 
@@ -285,9 +568,15 @@ Aws::Map<Aws::String, Aws::String> ProfileConfigFileAWSCredentialsProvider::Pars
 
 static const char* instanceLogTag = "InstanceProfileCredentialsProvider";
 
+//the metadata service has new credentials ready at least five minutes before the old ones expire.
+static const long EXPIRATION_REFRESH_MARGIN_MS = 1000 * 60 * 5;
+static const long MIN_EXPIRATION_REFRESH_MS = 1000 * 15;
+static const long MAX_EXPIRATION_REFRESH_MS = 1000 * 60 * 60 * 24;
+
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refreshRateMs) :
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        BackgroundRefreshingAWSCredentialsProvider(refreshRateMs),
+        m_lastCredentials("", ""),
+        m_expiration(0.0)
 {
     AWS_LOGSTREAM_INFO(instanceLogTag, "Creating Instance with default EC2MetadataClient and refresh rate " << refreshRateMs);
 
@@ -297,60 +586,79 @@ InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refr
 
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(const std::shared_ptr<EC2MetadataClient>& mdClient,
                                                                        long refreshRateMs) :
+        BackgroundRefreshingAWSCredentialsProvider(refreshRateMs),
         m_metadataClient(mdClient),
-        m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        m_lastCredentials("", ""),
+        m_expiration(0.0)
 {
     AWS_LOGSTREAM_INFO(instanceLogTag, "Creating Instance with injected EC2MetadataClient and refresh rate " << refreshRateMs);
 }
 
-
-AWSCredentials InstanceProfileCredentialsProvider::GetAWSCredentials()
+InstanceProfileCredentialsProvider::~InstanceProfileCredentialsProvider()
 {
-    RefreshIfExpired();
-    return *m_credentials;
+    StopRefreshing();
 }
 
 
-void InstanceProfileCredentialsProvider::RefreshIfExpired()
+AWSCredentials InstanceProfileCredentialsProvider::LoadCredentials()
 {
-    AWS_LOG_DEBUG(instanceLogTag, "Checking if latest credential pull has expired.");
+    AWS_LOG_INFO(instanceLogTag, "Credentials have expired attempting to repull from EC2 Metadata Service.");
+    Aws::String mdRet = m_metadataClient->GetDefaultCredentials();
 
-    std::lock_guard<std::mutex> locker(m_reloadMutex);
-    if (!m_credentials || IsTimeToRefresh(m_loadFrequencyMs))
-    {
-        AWS_LOG_INFO(instanceLogTag, "Credentials have expired attempting to repull from EC2 Metadata Service.");
-        Aws::String mdRet = m_metadataClient->GetDefaultCredentials();
+    const char* accessKeyId = "AccessKeyId";
+    const char* secretAccessKey = "SecretAccessKey";
+    Aws::String accessKey, secretKey, token, expiration;
 
-        if (mdRet.empty())
-        {
-            AWS_LOG_WARN(instanceLogTag, "Not able to pull credentials from the metadata service, returning empty credentials.");
-            m_credentials = Aws::MakeShared<AWSCredentials>(instanceLogTag, "", "");
-            return;
-        }
-
-        const char* accessKeyId = "AccessKeyId";
-        const char* secretAccessKey = "SecretAccessKey";
-        Aws::String accessKey, secretKey, token;
+    using namespace Aws::Utils::Json;
+    JsonValue jsonValue(mdRet);
 
-        using namespace Aws::Utils::Json;
-        JsonValue jsonValue(mdRet);
+    if (mdRet.empty())
+    {
+        AWS_LOG_WARN(instanceLogTag, "Not able to pull credentials from the metadata service.");
+    }
+    else if (jsonValue.WasParseSuccessful())
+    {
+        accessKey = jsonValue.GetString(accessKeyId);
+        AWS_LOGSTREAM_INFO(instanceLogTag, "Successfully pulled credentials from metadata service with access key " << accessKey);
 
-        if (jsonValue.WasParseSuccessful())
-        {
-            accessKey = jsonValue.GetString(accessKeyId);
-            AWS_LOGSTREAM_INFO(instanceLogTag, "Successfully pulled credentials from metadata service with access key " << accessKey);
+        secretKey = jsonValue.GetString(secretAccessKey);
+        token = jsonValue.GetString("Token");
+        expiration = jsonValue.GetString("Expiration");
+    }
+    else
+    {
+        AWS_LOGSTREAM_ERROR(instanceLogTag, "Failed to parse output from Ec2MetadataService with error " << jsonValue.GetErrorMessage());
+    }
 
-            secretKey = jsonValue.GetString(secretAccessKey);
-            token = jsonValue.GetString("Token");
-        }
-        else
+    if (accessKey.empty())
+    {
+        if (m_expiration > DateTime::ComputeCurrentTimestampInAmazonFormat())
         {
-            AWS_LOGSTREAM_ERROR(instanceLogTag, "Failed to parse output from Ec2MetadataService with error " << jsonValue.GetErrorMessage());
+            AWS_LOG_WARN(instanceLogTag, "Keeping the previous credentials until they expire.");
+            return m_lastCredentials;
         }
 
-        m_credentials = Aws::MakeShared<AWSCredentials>(instanceLogTag, accessKey, secretKey, token);
+        AWS_LOG_WARN(instanceLogTag, "Returning empty credentials.");
+        m_expiration = 0.0;
+        m_lastCredentials = AWSCredentials("", "");
+        return m_lastCredentials;
     }
+
+    m_expiration = DateTime::ConvertISO8601ToAmazonFormat(expiration.c_str());
+    m_lastCredentials = AWSCredentials(accessKey, secretKey, token);
+    return m_lastCredentials;
 }
 
+long InstanceProfileCredentialsProvider::GetRefreshIntervalMs() const
+{
+    if (m_expiration <= 0.0)
+    {
+        return BackgroundRefreshingAWSCredentialsProvider::GetRefreshIntervalMs();
+    }
+
+    double untilRefreshMs = (m_expiration - DateTime::ComputeCurrentTimestampInAmazonFormat()) * 1000 - EXPIRATION_REFRESH_MARGIN_MS;
+    untilRefreshMs = (std::max)(untilRefreshMs, static_cast<double>(MIN_EXPIRATION_REFRESH_MS));
+    untilRefreshMs = (std::min)(untilRefreshMs, static_cast<double>(MAX_EXPIRATION_REFRESH_MS));
+    return static_cast<long>(untilRefreshMs);
+}
 
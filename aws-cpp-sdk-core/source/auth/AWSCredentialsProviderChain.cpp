@@ -19,17 +19,46 @@
 
 using namespace Aws::Auth;
 
+static const std::size_t NO_PROVIDER = static_cast<std::size_t>(-1);
+
+static bool HasCredentials(const AWSCredentials& credentials)
+{
+    return !credentials.GetAWSAccessKeyId().empty() && !credentials.GetAWSSecretKey().empty();
+}
+
+AWSCredentialsProviderChain::AWSCredentialsProviderChain() : m_lastProviderIndex(NO_PROVIDER)
+{
+}
+
 AWSCredentials AWSCredentialsProviderChain::GetAWSCredentials()
 {
-    for (auto credentialsProvider : m_providerChain)
+    //the providers ahead of the last one to answer would read the environment and the filesystem on every signed request for nothing.
+    std::size_t lastProviderIndex = m_lastProviderIndex.load();
+    if (lastProviderIndex < m_providerChain.size())
+    {
+        AWSCredentials credentials = m_providerChain[lastProviderIndex]->GetAWSCredentials();
+        if (HasCredentials(credentials))
+        {
+            return credentials;
+        }
+    }
+
+    for (std::size_t i = 0; i < m_providerChain.size(); ++i)
     {
-        AWSCredentials credentials = credentialsProvider->GetAWSCredentials();
-        if (!credentials.GetAWSAccessKeyId().empty() && !credentials.GetAWSSecretKey().empty())
+        if (i == lastProviderIndex)
+        {
+            continue;
+        }
+
+        AWSCredentials credentials = m_providerChain[i]->GetAWSCredentials();
+        if (HasCredentials(credentials))
         {
+            m_lastProviderIndex.store(i);
             return credentials;
         }
     }
 
+    m_lastProviderIndex.store(NO_PROVIDER);
     return AWSCredentials("", "");
 }
 
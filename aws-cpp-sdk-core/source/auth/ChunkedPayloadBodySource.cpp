@@ -0,0 +1,202 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/auth/ChunkedPayloadBodySource.h>
+
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/crypto/Sha256HMAC.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <string.h>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils;
+
+static const char* CHUNKED_PAYLOAD_TAG = "ChunkedPayloadBodySource";
+static const char* CHUNK_STRING_TO_SIGN_ALGORITHM = "AWS4-HMAC-SHA256-PAYLOAD";
+static const char* CHUNK_SIGNATURE = ";chunk-signature=";
+static const char* CHUNK_LINE_END = "\r\n";
+//hex sha256 of the empty string, which stands in for the (absent) chunk headers.
+static const char* EMPTY_STRING_SHA256 = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+static const std::size_t SIGNATURE_LENGTH = 64;
+
+static std::size_t HexLength(std::size_t value)
+{
+    std::size_t digits = 1;
+    while (value >>= 4)
+    {
+        ++digits;
+    }
+    return digits;
+}
+
+static void AppendHex(std::size_t value, Aws::String& output)
+{
+    static const char* HEX_DIGITS = "0123456789abcdef";
+
+    std::size_t shift = (HexLength(value) - 1) * 4;
+    for (;;)
+    {
+        output.push_back(HEX_DIGITS[(value >> shift) & 0xf]);
+        if (shift == 0)
+        {
+            break;
+        }
+        shift -= 4;
+    }
+}
+
+static int64_t EncodedChunkLength(std::size_t chunkSize)
+{
+    return static_cast<int64_t>(HexLength(chunkSize) + strlen(CHUNK_SIGNATURE) + SIGNATURE_LENGTH + 2 * strlen(CHUNK_LINE_END) + chunkSize);
+}
+
+ChunkedPayloadBodySource::ChunkedPayloadBodySource(const std::shared_ptr<RequestBodySource>& payload, int64_t payloadLength,
+    const ByteBuffer& signingKey, const Aws::String& dateValue, const Aws::String& credentialScope, const Aws::String& seedSignature,
+    std::size_t chunkSize) :
+    m_payload(payload),
+    m_payloadRemaining(payloadLength),
+    m_signingKey(signingKey),
+    m_previousSignature(seedSignature),
+    m_chunkSize(chunkSize),
+    m_encodedPosition(0),
+    m_remainingLength(ComputeEncodedLength(payloadLength, chunkSize)),
+    m_finished(false),
+    m_hash(Aws::MakeUnique<Crypto::Sha256>(CHUNKED_PAYLOAD_TAG)),
+    m_HMAC(Aws::MakeUnique<Crypto::Sha256HMAC>(CHUNKED_PAYLOAD_TAG))
+{
+    m_stringToSignPrefix.reserve(strlen(CHUNK_STRING_TO_SIGN_ALGORITHM) + dateValue.length() + credentialScope.length() + 3);
+    m_stringToSignPrefix.append(CHUNK_STRING_TO_SIGN_ALGORITHM);
+    m_stringToSignPrefix.append("\n");
+    m_stringToSignPrefix.append(dateValue);
+    m_stringToSignPrefix.append("\n");
+    m_stringToSignPrefix.append(credentialScope);
+    m_stringToSignPrefix.append("\n");
+
+    m_chunkData.reserve(m_chunkSize);
+    m_encodedChunk.reserve(static_cast<std::size_t>(EncodedChunkLength(m_chunkSize)));
+}
+
+ChunkedPayloadBodySource::~ChunkedPayloadBodySource()
+{
+    // empty destructor in .cpp file to keep from needing the implementation of (Sha256, Sha256HMAC) in the header file
+}
+
+int64_t ChunkedPayloadBodySource::ComputeEncodedLength(int64_t payloadLength, std::size_t chunkSize)
+{
+    int64_t fullChunks = payloadLength / static_cast<int64_t>(chunkSize);
+    std::size_t lastChunkSize = static_cast<std::size_t>(payloadLength % static_cast<int64_t>(chunkSize));
+
+    int64_t encodedLength = fullChunks * EncodedChunkLength(chunkSize) + EncodedChunkLength(0);
+    if (lastChunkSize > 0)
+    {
+        encodedLength += EncodedChunkLength(lastChunkSize);
+    }
+    return encodedLength;
+}
+
+std::size_t ChunkedPayloadBodySource::Read(char* buffer, std::size_t length)
+{
+    std::size_t copied = 0;
+    while (copied < length)
+    {
+        if (m_encodedPosition == m_encodedChunk.length() && (m_finished || !EncodeNextChunk()))
+        {
+            break;
+        }
+
+        std::size_t amount = (std::min)(length - copied, m_encodedChunk.length() - m_encodedPosition);
+        memcpy(buffer + copied, m_encodedChunk.data() + m_encodedPosition, amount);
+        m_encodedPosition += amount;
+        copied += amount;
+    }
+
+    m_remainingLength -= static_cast<int64_t>(copied);
+    return copied;
+}
+
+bool ChunkedPayloadBodySource::EncodeNextChunk()
+{
+    std::size_t wanted = static_cast<std::size_t>((std::min)(static_cast<int64_t>(m_chunkSize), m_payloadRemaining));
+    m_chunkData.resize(wanted);
+
+    std::size_t filled = 0;
+    while (filled < wanted)
+    {
+        std::size_t amountRead = m_payload ? m_payload->Read(&m_chunkData[filled], wanted - filled) : 0;
+        if (amountRead == 0)
+        {
+            //the content length promised the server more than this; stop and let the transfer fail rather than send a bad body.
+            AWS_LOGSTREAM_ERROR(CHUNKED_PAYLOAD_TAG, "Payload ended " << (m_payloadRemaining - static_cast<int64_t>(filled))
+                << " bytes short of its declared length");
+            return false;
+        }
+        filled += amountRead;
+    }
+    m_payloadRemaining -= static_cast<int64_t>(filled);
+
+    Aws::String signature;
+    if (!SignChunk(signature))
+    {
+        return false;
+    }
+
+    //an empty chunk terminates the body.
+    m_finished = filled == 0;
+
+    m_encodedChunk.clear();
+    AppendHex(filled, m_encodedChunk);
+    m_encodedChunk.append(CHUNK_SIGNATURE);
+    m_encodedChunk.append(signature);
+    m_encodedChunk.append(CHUNK_LINE_END);
+    m_encodedChunk.append(m_chunkData);
+    m_encodedChunk.append(CHUNK_LINE_END);
+    m_encodedPosition = 0;
+    return true;
+}
+
+bool ChunkedPayloadBodySource::SignChunk(Aws::String& signature)
+{
+    auto hashResult = m_hash->Calculate(m_chunkData);
+    if (!hashResult.IsSuccess())
+    {
+        AWS_LOG_ERROR(CHUNKED_PAYLOAD_TAG, "Unable to hash (sha256) chunk");
+        return false;
+    }
+
+    Aws::String stringToSign;
+    stringToSign.reserve(m_stringToSignPrefix.length() + 3 * SIGNATURE_LENGTH + 2);
+    stringToSign.append(m_stringToSignPrefix);
+    stringToSign.append(m_previousSignature);
+    stringToSign.append("\n");
+    stringToSign.append(EMPTY_STRING_SHA256);
+    stringToSign.append("\n");
+    stringToSign.append(HashingUtils::HexEncode(hashResult.GetResult()));
+
+    auto signatureResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), m_signingKey);
+    if (!signatureResult.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(CHUNKED_PAYLOAD_TAG, "Unable to hmac (sha256) chunk string \"" << stringToSign << "\"");
+        return false;
+    }
+
+    signature = HashingUtils::HexEncode(signatureResult.GetResult());
+    m_previousSignature = signature;
+    return true;
+}
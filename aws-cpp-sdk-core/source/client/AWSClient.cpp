@@ -26,6 +26,7 @@
 #include <aws/core/http/HttpResponse.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/Array.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
@@ -34,6 +35,8 @@
 #include <aws/core/Globals.h>
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/MultiHash.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <thread>
 #include <aws/core/utils/HashingUtils.h>
 
@@ -98,11 +101,13 @@ AWSClient::AWSClient(const std::shared_ptr<Aws::Http::HttpClientFactory const>&
     m_signer(signer),
     m_errorMarshaller(errorMarshaller),
     m_retryStrategy(configuration.retryStrategy),
+    m_interceptors(configuration.interceptors),
+    m_completionExecutor(configuration.executor),
     m_writeRateLimiter(configuration.writeRateLimiter),
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hostHeaderOverride(hostHeaderOverride),
-    m_hash(Aws::MakeUnique<Aws::Utils::Crypto::MD5>(LOG_TAG))
+    m_hashes(LOG_TAG)
 {
     InitializeGlobalStatics();
 }
@@ -122,13 +127,20 @@ void AWSClient::EnableRequestProcessing()
     m_httpClient->EnableRequestProcessing();
 }
 
+unsigned AWSClient::PrewarmConnections(const Aws::String& endpoint, unsigned connections)
+{
+    return m_httpClient->Prewarm(URI(endpoint), connections);
+}
+
 HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
-    HttpMethod method) const
+    HttpMethod method,
+    RequestInterceptorContext& context) const
 {
     for (long retries = 0;; retries++)
     {
-        HttpResponseOutcome outcome = AttemptOneRequest(uri, request, method);
+        context.SetAttempt(retries);
+        HttpResponseOutcome outcome = AttemptOneRequest(uri, request, method, context);
         if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
         {
             AWS_LOG_TRACE(LOG_TAG, "Request was either successful, or we are now out of retries.");
@@ -143,16 +155,19 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri,
         {
             long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
             AWS_LOG_WARN(LOG_TAG, "Request failed, now waiting %d ms before attempting again.", sleepMillis);
+            NotifyBeforePhase(context, RequestPhase::RETRY_DELAY);
             m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            NotifyAfterPhase(context, RequestPhase::RETRY_DELAY, true);
         }
     }
 }
 
-HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri, HttpMethod method) const
+HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri, HttpMethod method, RequestInterceptorContext& context) const
 {
     for (long retries = 0;; retries++)
     {
-        HttpResponseOutcome outcome = AttemptOneRequest(uri, method);
+        context.SetAttempt(retries);
+        HttpResponseOutcome outcome = AttemptOneRequest(uri, method, context);
         if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
         {
             return outcome;
@@ -160,7 +175,9 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri, HttpM
         else
         {
             long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
+            NotifyBeforePhase(context, RequestPhase::RETRY_DELAY);
             m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            NotifyAfterPhase(context, RequestPhase::RETRY_DELAY, true);
         }
     }
 }
@@ -175,27 +192,69 @@ static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& respo
 }
 
 
-HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    HttpMethod method) const
+std::shared_ptr<HttpRequest> AWSClient::BuildAndSignHttpRequest(const Aws::String& uri, const Aws::AmazonWebServiceRequest* request,
+    HttpMethod method, RequestInterceptorContext& context) const
 {
-    std::shared_ptr<HttpRequest> httpRequest(m_clientFactory->CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
-    BuildHttpRequest(request, httpRequest);
+    NotifyBeforePhase(context, RequestPhase::SERIALIZE);
+    std::shared_ptr<HttpRequest> httpRequest;
+    if (request)
+    {
+        httpRequest = m_clientFactory->CreateHttpRequest(uri, method, request->GetResponseStreamFactory());
+        BuildHttpRequest(*request, httpRequest);
+    }
+    else
+    {
+        httpRequest = m_clientFactory->CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        AddCommonHeaders(*httpRequest);
+    }
+    context.SetHttpRequest(httpRequest);
+    NotifyAfterPhase(context, RequestPhase::SERIALIZE, true);
 
-    if (!m_signer->SignRequest(*httpRequest))
+    NotifyBeforePhase(context, RequestPhase::SIGN);
+    bool signedRequest = m_signer->SignRequest(*httpRequest);
+    NotifyAfterPhase(context, RequestPhase::SIGN, signedRequest);
+    if (!signedRequest)
     {
         AWS_LOG_ERROR(LOG_TAG, "Request signing failed. Returning error.");
-        return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
+        return nullptr;
     }
 
     AWS_LOG_DEBUG(LOG_TAG, "Request Successfully signed");
-    std::shared_ptr<HttpResponse> httpResponse(
-        m_httpClient->MakeRequest(*httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    return httpRequest;
+}
+
+HttpResponseOutcome AWSClient::BuildHttpResponseOutcome(const std::shared_ptr<HttpResponse>& httpResponse, RequestInterceptorContext& context) const
+{
+    context.SetHttpResponse(httpResponse);
+    NotifyAfterPhase(context, RequestPhase::TRANSMIT, httpResponse != nullptr);
+
+    const std::shared_ptr<HttpRequest>& httpRequest = context.GetHttpRequest();
+    if (!httpResponse && httpRequest && httpRequest->GetTransferFailure() == HttpTransferFailure::RESPONSE_BODY_REFUSED)
+    {
+        //the caller's sink turned the body down, which would happen again on every retry.
+        AWS_LOG_ERROR(LOG_TAG, "The response body sink refused the response body.");
+        AWSError<CoreErrors> error(CoreErrors::INTERNAL_FAILURE, "ResponseBodyRefused", "The response body sink refused the response body", false);
+        error.SetTransferMetrics(httpRequest->GetTransferMetrics());
+        return HttpResponseOutcome(error);
+    }
 
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOG_DEBUG(LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
-        return HttpResponseOutcome(BuildAWSError(httpResponse));
+        NotifyBeforePhase(context, RequestPhase::DESERIALIZE);
+        AWSError<CoreErrors> error = BuildAWSError(httpResponse);
+        //the error payload only counts as deserialized if it named an error this client recognizes.
+        NotifyAfterPhase(context, RequestPhase::DESERIALIZE, httpResponse && error.GetErrorType() != CoreErrors::UNKNOWN);
+        if (httpResponse)
+        {
+            error.SetTransferMetrics(httpResponse->GetTransferMetrics());
+        }
+        else if (httpRequest)
+        {
+            //no response to carry them, but the http client still recorded how far the attempt got.
+            error.SetTransferMetrics(httpRequest->GetTransferMetrics());
+        }
+        return HttpResponseOutcome(error);
     }
 
     AWS_LOG_DEBUG(LOG_TAG, "Request returned successful response.");
@@ -203,47 +262,215 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
     return HttpResponseOutcome(httpResponse);
 }
 
-HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri, HttpMethod method) const
+HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    HttpMethod method,
+    RequestInterceptorContext& context) const
 {
-    std::shared_ptr<HttpRequest> httpRequest(m_clientFactory->CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
-    AddCommonHeaders(*httpRequest);
+    std::shared_ptr<HttpRequest> httpRequest = BuildAndSignHttpRequest(uri, &request, method, context);
+    if (!httpRequest)
+    {
+        return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
+    }
+
+    NotifyBeforePhase(context, RequestPhase::TRANSMIT);
+    std::shared_ptr<HttpResponse> httpResponse(
+        m_httpClient->MakeRequest(*httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    return BuildHttpResponseOutcome(httpResponse, context);
+}
 
-    if (!m_signer->SignRequest(*httpRequest))
+HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri, HttpMethod method, RequestInterceptorContext& context) const
+{
+    std::shared_ptr<HttpRequest> httpRequest = BuildAndSignHttpRequest(uri, nullptr, method, context);
+    if (!httpRequest)
     {
-        AWS_LOG_ERROR(LOG_TAG, "Request signing failed. Returning error.");
         return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
     }
 
-    AWS_LOG_DEBUG(LOG_TAG, "Request Successfully signed");
+    NotifyBeforePhase(context, RequestPhase::TRANSMIT);
     std::shared_ptr<HttpResponse> httpResponse(
         m_httpClient->MakeRequest(*httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    return BuildHttpResponseOutcome(httpResponse, context);
+}
 
-    if (DoesResponseGenerateError(httpResponse))
+/**
+ * Everything an asynchronous call carries from one attempt to the next.
+ */
+struct AWSClient::AsyncCall
+{
+    AsyncCall() : m_method(HttpMethod::HTTP_POST), m_callerThread(std::this_thread::get_id()), m_retries(0) {}
+
+    Aws::String m_uri;
+    std::shared_ptr<const Aws::AmazonWebServiceRequest> m_request;
+    HttpMethod m_method;
+    std::shared_ptr<RequestInterceptorContext> m_context;
+    HttpResponseOutcomeHandler m_onComplete;
+    std::thread::id m_callerThread;
+    long m_retries;
+};
+
+void AWSClient::AttemptExhaustivelyAsync(const Aws::String& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    HttpMethod method,
+    const std::shared_ptr<RequestInterceptorContext>& context,
+    const HttpResponseOutcomeHandler& onComplete) const
+{
+    auto call = Aws::MakeShared<AsyncCall>(LOG_TAG);
+    call->m_uri = uri;
+    call->m_request = request;
+    call->m_method = method;
+    call->m_context = context;
+    call->m_onComplete = onComplete;
+    AttemptOneRequestAsync(call);
+}
+
+void AWSClient::AttemptOneRequestAsync(const std::shared_ptr<AsyncCall>& call) const
+{
+    RequestInterceptorContext& context = *call->m_context;
+    context.SetAttempt(call->m_retries);
+    std::shared_ptr<HttpRequest> httpRequest = BuildAndSignHttpRequest(call->m_uri, call->m_request.get(), call->m_method, context);
+    if (!httpRequest)
     {
-        AWS_LOG_DEBUG(LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
-        return HttpResponseOutcome(BuildAWSError(httpResponse));
+        call->m_onComplete(HttpResponseOutcome());
+        return;
     }
 
-    AWS_LOG_DEBUG(LOG_TAG, "Request returned successful response.");
+    NotifyBeforePhase(context, RequestPhase::TRANSMIT);
+    //the callback holds on to the http request, which has to outlive the transfer.
+    m_httpClient->MakeRequestAsync(*httpRequest, [this, call, httpRequest](const std::shared_ptr<HttpResponse>& httpResponse)
+    {
+        RunAsyncStep(call, [this, call, httpResponse]() { OnAsyncResponse(call, httpResponse); });
+    }, m_readRateLimiter.get(), m_writeRateLimiter.get());
+}
 
-    return HttpResponseOutcome(httpResponse);
+void AWSClient::OnAsyncResponse(const std::shared_ptr<AsyncCall>& call, const std::shared_ptr<HttpResponse>& httpResponse) const
+{
+    HttpResponseOutcome outcome = BuildHttpResponseOutcome(httpResponse, *call->m_context);
+    if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), call->m_retries))
+    {
+        AWS_LOG_TRACE(LOG_TAG, "Request was either successful, or we are now out of retries.");
+        call->m_onComplete(std::move(outcome));
+        return;
+    }
+
+    if (!m_httpClient->IsRequestProcessingEnabled())
+    {
+        AWS_LOG_TRACE(LOG_TAG, "Request was cancelled externally.");
+        call->m_onComplete(std::move(outcome));
+        return;
+    }
+
+    long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), call->m_retries);
+    AWS_LOG_WARN(LOG_TAG, "Request failed, now waiting %d ms before attempting again.", sleepMillis);
+    NotifyBeforePhase(*call->m_context, RequestPhase::RETRY_DELAY);
+    m_httpClient->ScheduleRetry(std::chrono::milliseconds(sleepMillis), [this, call]()
+    {
+        RunAsyncStep(call, [this, call]()
+        {
+            NotifyAfterPhase(*call->m_context, RequestPhase::RETRY_DELAY, true);
+            ++call->m_retries;
+            AttemptOneRequestAsync(call);
+        });
+    });
 }
 
-StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::String& uri,
-    const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method) const
+void AWSClient::RunAsyncStep(const std::shared_ptr<AsyncCall>& call, const std::function<void()>& step) const
+{
+    if (std::this_thread::get_id() == call->m_callerThread || !m_completionExecutor)
+    {
+        step();
+        return;
+    }
+
+    if (!m_completionExecutor->Submit(step))
+    {
+        AWS_LOG_WARN(LOG_TAG, "Executor refused to continue an asynchronous request, continuing it on the current thread.");
+        step();
+    }
+}
+
+StreamOutcome AWSClient::BuildStreamOutcome(const HttpResponseOutcome& httpResponseOutcome) const
 {
-    HttpResponseOutcome httpResponseOutcome = AttemptExhaustively(uri, request, method);
     if (httpResponseOutcome.IsSuccess())
     {
-        return StreamOutcome(AmazonWebServiceResult<Stream::ResponseStream>(
+        AmazonWebServiceResult<Stream::ResponseStream> result(
             httpResponseOutcome.GetResult()->SwapResponseStreamOwnership(),
-            httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode()));
+            httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode());
+        result.SetTransferMetrics(httpResponseOutcome.GetResult()->GetTransferMetrics());
+        return StreamOutcome(std::move(result));
     }
 
     return StreamOutcome(httpResponseOutcome.GetError());
 }
 
+StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    Http::HttpMethod method,
+    const char* requestName) const
+{
+    RequestInterceptorContext context(&request, requestName);
+    HttpResponseOutcome httpResponseOutcome = AttemptExhaustively(uri, request, method, context);
+    NotifyComplete(context, httpResponseOutcome.IsSuccess());
+    return BuildStreamOutcome(httpResponseOutcome);
+}
+
+void AWSClient::MakeRequestWithUnparsedResponseAsync(const Aws::String& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    Http::HttpMethod method,
+    const char* requestName,
+    const StreamOutcomeHandler& handler) const
+{
+    auto context = Aws::MakeShared<RequestInterceptorContext>(LOG_TAG, request.get(), requestName);
+    AttemptExhaustivelyAsync(uri, request, method, context, [this, context, handler](HttpResponseOutcome&& httpResponseOutcome)
+    {
+        NotifyComplete(*context, httpResponseOutcome.IsSuccess());
+        handler(BuildStreamOutcome(httpResponseOutcome));
+    });
+}
+
+void AWSClient::NotifyBeforePhase(RequestInterceptorContext& context, RequestPhase phase) const
+{
+    if (m_interceptors.empty())
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    context.SetPhaseStartTime(phase, now);
+    for (auto& interceptor : m_interceptors)
+    {
+        interceptor->BeforePhase(context, phase, now);
+    }
+}
+
+void AWSClient::NotifyAfterPhase(const RequestInterceptorContext& context, RequestPhase phase, bool succeeded) const
+{
+    if (m_interceptors.empty())
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    for (auto& interceptor : m_interceptors)
+    {
+        interceptor->AfterPhase(context, phase, now, succeeded);
+    }
+}
+
+void AWSClient::NotifyComplete(const RequestInterceptorContext& context, bool succeeded) const
+{
+    if (m_interceptors.empty())
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    for (auto& interceptor : m_interceptors)
+    {
+        interceptor->OnComplete(context, now, succeeded);
+    }
+}
+
 void AWSClient::AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
     const Http::HeaderValueCollection& headerValues) const
 {
@@ -289,11 +516,30 @@ void AWSClient::AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpReq
         AWS_LOGSTREAM_TRACE(LOG_TAG, "Found body, and content-md5 needs to be set" <<
            ", attempting to compute content-md5");
 
-        //changing the internal state of the hash computation is not a logical state
-        //change as far as constness goes for this class. Due to the platform specificness
-        //of hash computations, we can't control the fact that computing a hash mutates
-        //state on some platforms such as windows (but that isn't a concern of this class.
-        auto md5HashResult = const_cast<AWSClient*>(this)->m_hash->Calculate(*body);
+        //the signer hashes the body with sha256 next, so do both digests in a single read of it unless the caller already supplied one.
+        bool needsSha256 = httpRequest->GetContentSha256().GetLength() == 0;
+        Aws::Utils::Crypto::MultiHash multiHash(needsSha256 ? Aws::Utils::Crypto::MultiHash::MD5_ALGORITHM | Aws::Utils::Crypto::MultiHash::SHA256_ALGORITHM
+            : Aws::Utils::Crypto::MultiHash::MD5_ALGORITHM);
+        if (multiHash.IsValid())
+        {
+            if (multiHash.Calculate(*body))
+            {
+                auto md5HashResult = multiHash.GetMD5();
+                if (md5HashResult.IsSuccess())
+                {
+                    httpRequest->SetHeaderValue(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(md5HashResult.GetResult()));
+                }
+
+                auto sha256HashResult = multiHash.GetSha256();
+                if (needsSha256 && sha256HashResult.IsSuccess())
+                {
+                    httpRequest->SetContentSha256(sha256HashResult.GetResult());
+                }
+            }
+            return;
+        }
+
+        auto md5HashResult = m_hashes.Acquire()->Calculate(*body);
         if(md5HashResult.IsSuccess())
         {
             httpRequest->SetHeaderValue(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(md5HashResult.GetResult()));
@@ -301,16 +547,105 @@ void AWSClient::AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpReq
     }
 }
 
+void AWSClient::AddContentBodySourceToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
+    const Aws::Http::RequestBodySourceFactory& factory, bool needsContentMd5) const
+{
+    static const std::size_t HASH_CHUNK_SIZE = 64 * 1024;
+
+    auto bodySource = factory();
+    int64_t contentLength = bodySource ? bodySource->GetRemainingLength() : 0;
+
+    //there is no stream for the signer or the checksums to read, so digest the body through a source of its own. The send source
+    //is untouched, and the body is still read from the caller's memory without being copied.
+    bool needsSha256 = httpRequest->GetContentSha256().GetLength() == 0;
+    bool needsMd5 = needsContentMd5 && !httpRequest->HasHeader(Http::CONTENT_MD5_HEADER);
+    if (bodySource && (needsSha256 || needsMd5 || contentLength < 0))
+    {
+        unsigned algorithms = (needsSha256 ? Aws::Utils::Crypto::MultiHash::SHA256_ALGORITHM : 0) |
+            (needsMd5 ? Aws::Utils::Crypto::MultiHash::MD5_ALGORITHM : 0);
+        Aws::Utils::Crypto::MultiHash multiHash(algorithms);
+        auto hashSource = factory();
+        if (!hashSource)
+        {
+            AWS_LOG_ERROR(LOG_TAG, "The content body source factory returned no source to hash the body from");
+        }
+        else if (multiHash.IsValid())
+        {
+            Aws::Utils::Array<unsigned char> chunk(HASH_CHUNK_SIZE);
+            int64_t bodyLength = 0;
+            std::size_t read = 0;
+            while ((read = hashSource->Read(reinterpret_cast<char*>(chunk.GetUnderlyingData()), chunk.GetLength())) > 0)
+            {
+                multiHash.Update(chunk.GetUnderlyingData(), read);
+                bodyLength += read;
+            }
+            multiHash.Finish();
+
+            auto md5HashResult = multiHash.GetMD5();
+            if (needsMd5 && md5HashResult.IsSuccess())
+            {
+                httpRequest->SetHeaderValue(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(md5HashResult.GetResult()));
+            }
+            auto sha256HashResult = multiHash.GetSha256();
+            if (needsSha256 && sha256HashResult.IsSuccess())
+            {
+                httpRequest->SetContentSha256(sha256HashResult.GetResult());
+            }
+            if (contentLength < 0)
+            {
+                contentLength = bodyLength;
+            }
+        }
+        else
+        {
+            //no platform digest to feed incrementally; copy the body into a stream that the signer and the checksums read instead.
+            AWS_LOG_DEBUG(LOG_TAG, "Copying the content body source into a stream to hash it");
+            auto bodyStream = Aws::MakeShared<Aws::StringStream>(LOG_TAG);
+            Aws::Utils::Array<char> chunk(HASH_CHUNK_SIZE);
+            std::size_t read = 0;
+            while ((read = hashSource->Read(chunk.GetUnderlyingData(), chunk.GetLength())) > 0)
+            {
+                bodyStream->write(chunk.GetUnderlyingData(), read);
+            }
+            AddContentBodyToRequest(httpRequest, bodyStream, needsContentMd5);
+            httpRequest->SetContentBodySource(bodySource);
+            return;
+        }
+    }
+
+    if (contentLength >= 0)
+    {
+        Aws::StringStream ss;
+        ss << contentLength;
+        httpRequest->SetContentLength(ss.str());
+    }
+    httpRequest->SetContentBodySource(bodySource);
+}
+
 void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
     const std::shared_ptr<HttpRequest>& httpRequest) const
 {
     //do headers first since the request likely will set content-length as it's own header.
     AddHeadersToRequest(httpRequest, request.GetHeaders());
-    AddContentBodyToRequest(httpRequest, request.GetBody(), request.ShouldComputeContentMd5());
+    httpRequest->SetContentSha256(request.GetPayloadSha256());
+    auto body = request.GetBody();
+    if (!body && request.GetContentBodySourceFactory())
+    {
+        AddContentBodySourceToRequest(httpRequest, request.GetContentBodySourceFactory(), request.ShouldComputeContentMd5());
+    }
+    else
+    {
+        AddContentBodyToRequest(httpRequest, body, request.ShouldComputeContentMd5());
+        if (request.GetContentBodySourceFactory())
+        {
+            httpRequest->SetContentBodySource(request.GetContentBodySourceFactory()());
+        }
+    }
 
     // Pass along handlers for processing data sent/received in bytes
     httpRequest->SetDataReceivedEventHandler(request.GetDataReceivedEventHandler());
     httpRequest->SetDataSentEventHandler(request.GetDataSentEventHandler());
+    httpRequest->SetResponseBodySink(request.GetResponseBodySink());
 
     request.AddQueryStringParameters(httpRequest->GetUri());
 }
@@ -325,6 +660,12 @@ void AWSClient::AddCommonHeaders(HttpRequest& httpRequest) const
     httpRequest.SetUserAgent(m_userAgent);
 }
 
+AWSError<CoreErrors> AWSClient::BuildExecutorRejectedError()
+{
+    AWS_LOG_WARN(LOG_TAG, "The client's executor rejected an asynchronous call.");
+    return AWSError<CoreErrors>(CoreErrors::INTERNAL_FAILURE, "ExecutorRejected", "The client's executor rejected the call", true);
+}
+
 Aws::String AWSClient::GeneratePresignedUrl(URI& uri, HttpMethod method, long long expirationInSeconds)
 {
     std::shared_ptr<HttpRequest> request = m_clientFactory->CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
@@ -348,48 +689,80 @@ AWSJsonClient::AWSJsonClient(const std::shared_ptr<Aws::Http::HttpClientFactory
 
 JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method) const
+    Http::HttpMethod method,
+    const char* requestName) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method));
-    if (!httpOutcome.IsSuccess())
-    {
-        return JsonOutcome(httpOutcome.GetError());
-    }
+    RequestInterceptorContext context(&request, requestName);
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, context));
+    return BuildJsonOutcome(httpOutcome, context, false);
+}
 
-    if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
-        //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(httpOutcome.GetResult()->GetResponseBody()),
-        httpOutcome.GetResult()->GetHeaders(),
-        httpOutcome.GetResult()->GetResponseCode()));
+JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
+    Http::HttpMethod method,
+    const char* requestName) const
+{
+    RequestInterceptorContext context(nullptr, requestName);
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, context));
+    return BuildJsonOutcome(httpOutcome, context, true);
+}
 
-    else
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
+void AWSJsonClient::MakeRequestAsync(const Aws::String& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    Http::HttpMethod method,
+    const char* requestName,
+    const JsonOutcomeHandler& handler) const
+{
+    auto context = Aws::MakeShared<RequestInterceptorContext>(LOG_TAG, request.get(), requestName);
+    AttemptExhaustivelyAsync(uri, request, method, context, [this, context, handler](HttpResponseOutcome&& httpOutcome)
+    {
+        handler(BuildJsonOutcome(httpOutcome, *context, false));
+    });
 }
 
-JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
-    Http::HttpMethod method) const
+void AWSJsonClient::MakeRequestAsync(const Aws::String& uri,
+    Http::HttpMethod method,
+    const char* requestName,
+    const JsonOutcomeHandler& handler) const
+{
+    auto context = Aws::MakeShared<RequestInterceptorContext>(LOG_TAG, nullptr, requestName);
+    AttemptExhaustivelyAsync(uri, nullptr, method, context, [this, context, handler](HttpResponseOutcome&& httpOutcome)
+    {
+        handler(BuildJsonOutcome(httpOutcome, *context, true));
+    });
+}
+
+JsonOutcome AWSJsonClient::BuildJsonOutcome(const HttpResponseOutcome& httpOutcome, RequestInterceptorContext& context, bool failOnParseError) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method));
     if (!httpOutcome.IsSuccess())
     {
+        NotifyComplete(context, false);
         return JsonOutcome(httpOutcome.GetError());
     }
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
+        NotifyBeforePhase(context, RequestPhase::DESERIALIZE);
         JsonValue jsonValue(httpOutcome.GetResult()->GetResponseBody());
-        if (!jsonValue.WasParseSuccessful())
+        NotifyAfterPhase(context, RequestPhase::DESERIALIZE, jsonValue.WasParseSuccessful());
+        if (failOnParseError && !jsonValue.WasParseSuccessful())
         {
+            NotifyComplete(context, false);
             return JsonOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", jsonValue.GetErrorMessage(), false));
         }
 
         //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(std::move(jsonValue),
+        AmazonWebServiceResult<JsonValue> result(std::move(jsonValue),
             httpOutcome.GetResult()->GetHeaders(),
-            httpOutcome.GetResult()->GetResponseCode()));
+            httpOutcome.GetResult()->GetResponseCode());
+        result.SetTransferMetrics(httpOutcome.GetResult()->GetTransferMetrics());
+        NotifyComplete(context, true);
+        return JsonOutcome(std::move(result));
     }
 
-    return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
+    AmazonWebServiceResult<JsonValue> result(JsonValue(), httpOutcome.GetResult()->GetHeaders());
+    result.SetTransferMetrics(httpOutcome.GetResult()->GetTransferMetrics());
+    NotifyComplete(context, true);
+    return JsonOutcome(std::move(result));
 }
 
 const char* MESSAGE_LOWER_CASE = "message";
@@ -447,48 +820,80 @@ AWSXMLClient::AWSXMLClient(const std::shared_ptr<Aws::Http::HttpClientFactory co
 
 XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
-    Http::HttpMethod method) const
+    Http::HttpMethod method,
+    const char* requestName) const
+{
+    RequestInterceptorContext context(&request, requestName);
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, context));
+    return BuildXmlOutcome(httpOutcome, context, true);
+}
+
+XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
+    Http::HttpMethod method,
+    const char* requestName) const
+{
+    RequestInterceptorContext context(nullptr, requestName);
+    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, context));
+    return BuildXmlOutcome(httpOutcome, context, false);
+}
+
+void AWSXMLClient::MakeRequestAsync(const Aws::String& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    Http::HttpMethod method,
+    const char* requestName,
+    const XmlOutcomeHandler& handler) const
+{
+    auto context = Aws::MakeShared<RequestInterceptorContext>(LOG_TAG, request.get(), requestName);
+    AttemptExhaustivelyAsync(uri, request, method, context, [this, context, handler](HttpResponseOutcome&& httpOutcome)
+    {
+        handler(BuildXmlOutcome(httpOutcome, *context, true));
+    });
+}
+
+void AWSXMLClient::MakeRequestAsync(const Aws::String& uri,
+    Http::HttpMethod method,
+    const char* requestName,
+    const XmlOutcomeHandler& handler) const
+{
+    auto context = Aws::MakeShared<RequestInterceptorContext>(LOG_TAG, nullptr, requestName);
+    AttemptExhaustivelyAsync(uri, nullptr, method, context, [this, context, handler](HttpResponseOutcome&& httpOutcome)
+    {
+        handler(BuildXmlOutcome(httpOutcome, *context, false));
+    });
+}
+
+XmlOutcome AWSXMLClient::BuildXmlOutcome(const HttpResponseOutcome& httpOutcome, RequestInterceptorContext& context, bool failOnParseError) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method));
     if (!httpOutcome.IsSuccess())
     {
+        NotifyComplete(context, false);
         return XmlOutcome(httpOutcome.GetError());
     }
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
+        NotifyBeforePhase(context, RequestPhase::DESERIALIZE);
         XmlDocument xmlDoc = XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody());
+        NotifyAfterPhase(context, RequestPhase::DESERIALIZE, xmlDoc.WasParseSuccessful());
 
-        if (!xmlDoc.WasParseSuccessful())
+        if (failOnParseError && !xmlDoc.WasParseSuccessful())
         {
             AWS_LOG_ERROR(LOG_TAG, "Xml parsing for error failed with message %s", xmlDoc.GetErrorMessage().c_str());
+            NotifyComplete(context, false);
             return AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Xml Parse Error", xmlDoc.GetErrorMessage(), false);
         }
 
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc),
-            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
-    }
-
-    return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
-}
-
-XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
-    Http::HttpMethod method) const
-{
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method));
-    if (!httpOutcome.IsSuccess())
-    {
-        return XmlOutcome(httpOutcome.GetError());
-    }
-
-    if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
-    {
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(
-            XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody()),
-            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
+        AmazonWebServiceResult<XmlDocument> result(std::move(xmlDoc),
+            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode());
+        result.SetTransferMetrics(httpOutcome.GetResult()->GetTransferMetrics());
+        NotifyComplete(context, true);
+        return XmlOutcome(std::move(result));
     }
 
-    return XmlOutcome(AmazonWebServiceResult<XmlDocument>(XmlDocument(), httpOutcome.GetResult()->GetHeaders()));
+    AmazonWebServiceResult<XmlDocument> result(XmlDocument(), httpOutcome.GetResult()->GetHeaders());
+    result.SetTransferMetrics(httpOutcome.GetResult()->GetTransferMetrics());
+    NotifyComplete(context, true);
+    return XmlOutcome(std::move(result));
 }
 
 AWSError<CoreErrors> AWSXMLClient::BuildAWSError(const std::shared_ptr<Http::HttpResponse>& httpResponse) const
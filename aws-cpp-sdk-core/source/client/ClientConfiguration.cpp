@@ -51,7 +51,14 @@ ClientConfiguration::ClientConfiguration() :
     writeRateLimiter(nullptr),
     readRateLimiter(nullptr),
     httpLibOverride(Aws::Http::TransferLibType::DEFAULT_CLIENT),
-    followRedirects(true)
+    followRedirects(true),
+    httpEventLoopThreads(1),
+    connectionCacheSharing(Aws::Http::ConnectionCacheSharing::NONE),
+    connectionIdleTimeoutMs(0),
+    connectionMaxAgeMs(0),
+    httpVersion(Aws::Http::HttpVersion::DEFAULT),
+    maxStreamsPerConnection(100),
+    payloadSigningPolicy(PayloadSigningPolicy::SIGN_BODY)
 {
 }
 
@@ -0,0 +1,247 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/LatencyHistogramInterceptor.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Client;
+
+static const char* LATENCY_HISTOGRAM_TAG = "LatencyHistogramInterceptor";
+
+const char* LatencyHistogramInterceptor::OTHER_OPERATIONS = "Other";
+
+static uint64_t ToMicroseconds(std::chrono::steady_clock::duration duration)
+{
+    auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    return microseconds > 0 ? static_cast<uint64_t>(microseconds) : 0;
+}
+
+LatencyHistogram::LatencyHistogram() :
+    m_count(0),
+    m_sum(0),
+    m_max(0)
+{
+    for (unsigned i = 0; i < BUCKET_COUNT; ++i)
+    {
+        m_buckets[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+unsigned LatencyHistogram::GetBucketIndex(uint64_t microseconds)
+{
+    if (microseconds < SUB_BUCKETS)
+    {
+        return static_cast<unsigned>(microseconds);
+    }
+
+    unsigned exponent = 0;
+    for (uint64_t value = microseconds; value > 1; value >>= 1)
+    {
+        ++exponent;
+    }
+
+    if (exponent > MAX_EXPONENT)
+    {
+        return BUCKET_COUNT - 1;
+    }
+
+    unsigned subBucket = static_cast<unsigned>(microseconds >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return SUB_BUCKETS + (exponent - SUB_BUCKET_BITS) * SUB_BUCKETS + subBucket;
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(unsigned index)
+{
+    if (index < SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    unsigned shift = (index - SUB_BUCKETS) / SUB_BUCKETS;
+    uint64_t subBucket = (index - SUB_BUCKETS) % SUB_BUCKETS;
+    return ((SUB_BUCKETS + subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(uint64_t microseconds)
+{
+    m_buckets[GetBucketIndex(microseconds)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(microseconds, std::memory_order_relaxed);
+
+    uint64_t currentMax = m_max.load(std::memory_order_relaxed);
+    while (microseconds > currentMax && !m_max.compare_exchange_weak(currentMax, microseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+uint64_t LatencyHistogram::GetPercentile(double percentile) const
+{
+    uint64_t count = GetCount();
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(count) + 0.5);
+    rank = rank == 0 ? 1 : (rank > count ? count : rank);
+
+    uint64_t seen = 0;
+    for (unsigned i = 0; i < BUCKET_COUNT; ++i)
+    {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank)
+        {
+            //the last bucket also holds everything that was clamped into it.
+            uint64_t upperBound = i == BUCKET_COUNT - 1 ? GetMax() : GetBucketUpperBound(i);
+            uint64_t max = GetMax();
+            return upperBound < max ? upperBound : max;
+        }
+    }
+
+    //samples recorded while we were reading can leave the buckets behind the count.
+    return GetMax();
+}
+
+OperationLatency::OperationLatency(const Aws::String& operationName) :
+    m_operationName(operationName),
+    m_retries(0),
+    m_failures(0)
+{
+}
+
+LatencyHistogramInterceptor::LatencyHistogramInterceptor() :
+    m_otherOperations(OTHER_OPERATIONS)
+{
+    for (unsigned i = 0; i < MAX_OPERATIONS; ++i)
+    {
+        m_operations[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+LatencyHistogramInterceptor::~LatencyHistogramInterceptor()
+{
+    for (unsigned i = 0; i < MAX_OPERATIONS; ++i)
+    {
+        OperationLatency* operation = m_operations[i].load(std::memory_order_relaxed);
+        if (operation)
+        {
+            Aws::Delete(operation);
+        }
+    }
+}
+
+OperationLatency* LatencyHistogramInterceptor::FindOrAddOperation(const Aws::String& operationName)
+{
+    std::size_t start = static_cast<std::size_t>(Aws::Utils::HashingUtils::HashString(operationName.c_str())) % MAX_OPERATIONS;
+    OperationLatency* added = nullptr;
+
+    //open addressing; slots are only ever filled, never emptied, so a probe can stop at the first empty one.
+    for (unsigned probe = 0; probe < MAX_OPERATIONS; ++probe)
+    {
+        std::atomic<OperationLatency*>& slot = m_operations[(start + probe) % MAX_OPERATIONS];
+        OperationLatency* operation = slot.load(std::memory_order_acquire);
+        if (!operation)
+        {
+            if (!added)
+            {
+                added = Aws::New<OperationLatency>(LATENCY_HISTOGRAM_TAG, operationName);
+            }
+
+            if (slot.compare_exchange_strong(operation, added, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return added;
+            }
+        }
+
+        if (operation->GetOperationName() == operationName)
+        {
+            if (added)
+            {
+                Aws::Delete(added);
+            }
+            return operation;
+        }
+    }
+
+    if (added)
+    {
+        Aws::Delete(added);
+    }
+    return &m_otherOperations;
+}
+
+void LatencyHistogramInterceptor::AfterPhase(const RequestInterceptorContext& context, RequestPhase phase,
+                                              std::chrono::steady_clock::time_point time, bool succeeded)
+{
+    AWS_UNREFERENCED_PARAM(succeeded);
+
+    OperationLatency* operation = FindOrAddOperation(context.GetOperationName());
+    operation->m_phases[static_cast<unsigned>(phase)].Record(ToMicroseconds(time - context.GetPhaseStartTime(phase)));
+    if (phase == RequestPhase::RETRY_DELAY)
+    {
+        operation->m_retries.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogramInterceptor::OnComplete(const RequestInterceptorContext& context, std::chrono::steady_clock::time_point time,
+                                              bool succeeded)
+{
+    OperationLatency* operation = FindOrAddOperation(context.GetOperationName());
+    operation->m_total.Record(ToMicroseconds(time - context.GetStartTime()));
+    if (!succeeded)
+    {
+        operation->m_failures.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+Aws::Vector<Aws::String> LatencyHistogramInterceptor::GetOperationNames() const
+{
+    Aws::Vector<Aws::String> names;
+    for (unsigned i = 0; i < MAX_OPERATIONS; ++i)
+    {
+        const OperationLatency* operation = m_operations[i].load(std::memory_order_acquire);
+        if (operation)
+        {
+            names.push_back(operation->GetOperationName());
+        }
+    }
+
+    if (m_otherOperations.GetTotalLatency().GetCount() > 0)
+    {
+        names.push_back(m_otherOperations.GetOperationName());
+    }
+
+    return names;
+}
+
+const OperationLatency* LatencyHistogramInterceptor::GetOperationLatency(const Aws::String& operationName) const
+{
+    std::size_t start = static_cast<std::size_t>(Aws::Utils::HashingUtils::HashString(operationName.c_str())) % MAX_OPERATIONS;
+    for (unsigned probe = 0; probe < MAX_OPERATIONS; ++probe)
+    {
+        const OperationLatency* operation = m_operations[(start + probe) % MAX_OPERATIONS].load(std::memory_order_acquire);
+        if (!operation)
+        {
+            break;
+        }
+
+        if (operation->GetOperationName() == operationName)
+        {
+            return operation;
+        }
+    }
+
+    return operationName == m_otherOperations.GetOperationName() ? &m_otherOperations : nullptr;
+}
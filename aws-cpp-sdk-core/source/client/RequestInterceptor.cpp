@@ -0,0 +1,79 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/RequestInterceptor.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
+
+#include <atomic>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+static const char* AMZN_REQUEST_ID_HEADER = "x-amzn-requestid";
+static const char* AMZ_REQUEST_ID_HEADER = "x-amz-request-id";
+
+static std::atomic<uint64_t> s_nextInvocationId(1);
+
+RequestInterceptorContext::RequestInterceptorContext(const AmazonWebServiceRequest* request, const char* operationName) :
+    m_invocationId(s_nextInvocationId++),
+    m_startTime(std::chrono::steady_clock::now()),
+    m_request(request),
+    m_operationName(operationName ? operationName : ""),
+    m_attempt(0)
+{
+}
+
+void RequestInterceptorContext::SetHttpRequest(const std::shared_ptr<HttpRequest>& httpRequest)
+{
+    m_httpRequest = httpRequest;
+    m_httpResponse = nullptr;
+    m_requestId.clear();
+
+    if (!m_operationName.empty() || !httpRequest)
+    {
+        return;
+    }
+
+    //json services name the operation in X-Amz-Target as <service version>.<operation>
+    if (httpRequest->HasHeader(AMZ_TARGET_HEADER))
+    {
+        const Aws::String& target = httpRequest->GetHeaderValue(AMZ_TARGET_HEADER);
+        auto separator = target.rfind('.');
+        m_operationName = separator == Aws::String::npos ? target : target.substr(separator + 1);
+    }
+    else
+    {
+        m_operationName = HttpMethodMapper::GetNameForHttpMethod(httpRequest->GetMethod());
+    }
+}
+
+void RequestInterceptorContext::SetHttpResponse(const std::shared_ptr<HttpResponse>& httpResponse)
+{
+    m_httpResponse = httpResponse;
+    if (!httpResponse)
+    {
+        return;
+    }
+
+    if (httpResponse->HasHeader(AMZN_REQUEST_ID_HEADER))
+    {
+        m_requestId = httpResponse->GetHeader(AMZN_REQUEST_ID_HEADER);
+    }
+    else if (httpResponse->HasHeader(AMZ_REQUEST_ID_HEADER))
+    {
+        m_requestId = httpResponse->GetHeader(AMZ_REQUEST_ID_HEADER);
+    }
+}
@@ -14,10 +14,17 @@
   */
 
 #include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 
 using namespace Aws;
 using namespace Aws::Http;
 
+static const char* HttpClientTag = "HttpClient";
+
 HttpClient::HttpClient() :
     m_disableRequestProcessing( false ),
     m_requestProcessingSignalLock(),
@@ -25,6 +32,51 @@ HttpClient::HttpClient() :
 {
 }
 
+void HttpClient::MakeRequestAsync(HttpRequest& request, const HttpResponseCallback& onComplete,
+    Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    auto response = MakeRequest(request, readLimiter, writeLimiter);
+    if (onComplete)
+    {
+        onComplete(response);
+    }
+}
+
+unsigned HttpClient::Prewarm(const URI& endpoint, unsigned connections) const
+{
+    Aws::Vector<std::shared_ptr<HttpRequest>> requests;
+    for (unsigned i = 0; i < connections; ++i)
+    {
+        auto request = Aws::MakeShared<Standard::StandardHttpRequest>(HttpClientTag, endpoint, HttpMethod::HTTP_HEAD);
+        request->SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        requests.push_back(request);
+    }
+
+    std::mutex completionMutex;
+    std::condition_variable completionSignal;
+    unsigned completed = 0;
+    unsigned responded = 0;
+
+    //issued together so that event driven clients open them concurrently
+    for (auto& request : requests)
+    {
+        MakeRequestAsync(*request, [&](const std::shared_ptr<HttpResponse>& response)
+        {
+            std::lock_guard<std::mutex> locker(completionMutex);
+            ++completed;
+            if (response)
+            {
+                ++responded;
+            }
+            completionSignal.notify_one();
+        });
+    }
+
+    std::unique_lock<std::mutex> locker(completionMutex);
+    completionSignal.wait(locker, [&](){ return completed == connections; });
+    return responded;
+}
+
 void HttpClient::DisableRequestProcessing() 
 { 
     m_disableRequestProcessing = true;
@@ -46,3 +98,9 @@ void HttpClient::RetryRequestSleep(std::chrono::milliseconds sleepTime)
     std::unique_lock< std::mutex > signalLocker(m_requestProcessingSignalLock);
     m_requestProcessingSignal.wait_for(signalLocker, sleepTime, [this](){ return m_disableRequestProcessing.load() == true; });
 }
+
+void HttpClient::ScheduleRetry(std::chrono::milliseconds sleepTime, const std::function<void()>& retry)
+{
+    RetryRequestSleep(sleepTime);
+    retry();
+}
@@ -0,0 +1,59 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/RequestBodySource.h>
+
+#include <algorithm>
+
+using namespace Aws::Http;
+
+StreamBodySource::StreamBodySource(const std::shared_ptr<Aws::IOStream>& stream) :
+    m_stream(stream),
+    m_remainingLength(-1)
+{
+    std::streambuf* streamBuffer = m_stream ? m_stream->rdbuf() : nullptr;
+    if (streamBuffer)
+    {
+        auto currentPos = streamBuffer->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+        auto endPos = streamBuffer->pubseekoff(0, std::ios_base::end, std::ios_base::in);
+        if (currentPos != std::streampos(-1) && endPos != std::streampos(-1))
+        {
+            m_remainingLength = static_cast<int64_t>(endPos - currentPos);
+            streamBuffer->pubseekpos(currentPos, std::ios_base::in);
+        }
+    }
+}
+
+std::size_t StreamBodySource::Read(char* buffer, std::size_t length)
+{
+    std::streambuf* streamBuffer = m_stream ? m_stream->rdbuf() : nullptr;
+    if (!streamBuffer || m_remainingLength == 0)
+    {
+        return 0;
+    }
+
+    if (m_remainingLength > 0)
+    {
+        length = static_cast<std::size_t>((std::min)(static_cast<int64_t>(length), m_remainingLength));
+    }
+
+    std::size_t amountRead = static_cast<std::size_t>(streamBuffer->sgetn(buffer, static_cast<std::streamsize>(length)));
+    if (m_remainingLength > 0)
+    {
+        m_remainingLength -= static_cast<int64_t>(amountRead);
+    }
+
+    return amountRead;
+}
@@ -0,0 +1,70 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/ResponseBodySink.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+
+static const char* RESPONSE_BODY_SINK_TAG = "ResponseBodySink";
+
+PreallocatedBodySink::PreallocatedBodySink(unsigned char* buffer, std::size_t length) :
+    m_buffer(buffer),
+    m_length(length),
+    m_bytesWritten(0)
+{
+}
+
+bool PreallocatedBodySink::Begin(int64_t contentLength)
+{
+    m_bytesWritten = 0;
+    if (contentLength > static_cast<int64_t>(m_length))
+    {
+        AWS_LOGSTREAM_ERROR(RESPONSE_BODY_SINK_TAG, "Response body of " << contentLength << " bytes does not fit in a buffer of " << m_length << " bytes.");
+        return false;
+    }
+
+    return true;
+}
+
+bool PreallocatedBodySink::Write(const unsigned char* data, std::size_t length)
+{
+    if (length > m_length - m_bytesWritten)
+    {
+        AWS_LOGSTREAM_ERROR(RESPONSE_BODY_SINK_TAG, "Response body overflows a buffer of " << m_length << " bytes.");
+        return false;
+    }
+
+    memcpy(m_buffer + m_bytesWritten, data, length);
+    m_bytesWritten += length;
+    return true;
+}
+
+CallbackBodySink::CallbackBodySink(const ResponseBodyCallback& callback) :
+    m_callback(callback)
+{
+}
+
+bool CallbackBodySink::Begin(int64_t)
+{
+    return true;
+}
+
+bool CallbackBodySink::Write(const unsigned char* data, std::size_t length)
+{
+    return m_callback(data, length);
+}
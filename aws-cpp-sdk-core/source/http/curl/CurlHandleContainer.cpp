@@ -14,7 +14,13 @@
   */
 
 #include <aws/core/http/curl/CurlHandleContainer.h>
+#include <aws/core/http/curl/CurlShareHandle.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <algorithm>
+#include <iterator>
 
 #undef min
 
@@ -127,11 +133,15 @@ static char* strdup_callback(const char* str)
 
 
 
-CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout) :
-                m_maxPoolSize(maxSize), m_requestTimeout(requestTimeout), m_connectTimeout(connectTimeout),
-                m_poolSize(0)
+CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout, ConnectionCacheSharing cacheSharing,
+                                         long idleTimeoutMs, long maxAgeMs, HttpVersion httpVersion, unsigned maxStreamsPerConnection) :
+                m_maxPoolSize(maxSize * (maxStreamsPerConnection > 0 ? maxStreamsPerConnection : 1)),
+                m_requestTimeout(requestTimeout), m_connectTimeout(connectTimeout),
+                m_idleTimeout(idleTimeoutMs), m_maxAge(maxAgeMs), m_httpVersion(httpVersion),
+                m_maxStreamsPerConnection(maxStreamsPerConnection > 0 ? maxStreamsPerConnection : 1), m_poolSize(0), m_idleCount(0), m_waitingThreads(0),
+                m_acquisitions(0), m_totalWaitTimeMs(0), m_maxWaitTimeMs(0), m_stopEviction(false)
 {
-    AWS_LOGSTREAM_INFO(CurlTag, "Initializing CurlHandleContainer with size " << maxSize);
+    AWS_LOGSTREAM_INFO(CurlTag, "Initializing CurlHandleContainer with size " << maxSize << " and " << m_maxStreamsPerConnection << " streams per connection");
     if (!isInit)
     {
         AWS_LOG_INFO(CurlTag, "Initializing Curl library");
@@ -142,39 +152,134 @@ CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout,
         curl_global_init(CURL_GLOBAL_ALL);
 #endif
     }
+
+    //the share handle allocates through curl, so it can only be created once curl has been initialized.
+    switch (cacheSharing)
+    {
+        case ConnectionCacheSharing::PER_CLIENT:
+            AWS_LOG_INFO(CurlTag, "Sharing DNS and TLS session caches between the handles of this container.");
+            m_shareHandle = Aws::MakeShared<CurlShareHandle>(CurlTag);
+            break;
+        case ConnectionCacheSharing::PROCESS_WIDE:
+            AWS_LOG_INFO(CurlTag, "Sharing DNS and TLS session caches with every container in the process.");
+            m_shareHandle = CurlShareHandle::GetProcessWideInstance();
+            break;
+        default:
+            break;
+    }
+
+    if (m_idleTimeout.count() > 0 || m_maxAge.count() > 0)
+    {
+        AWS_LOGSTREAM_INFO(CurlTag, "Evicting connections idle for " << m_idleTimeout.count() << " ms or older than " << m_maxAge.count() << " ms.");
+        m_evictionThread = std::thread(&CurlHandleContainer::RunEviction, this);
+    }
 }
 
 CurlHandleContainer::~CurlHandleContainer()
 {
+    if (m_evictionThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_handleContainerMutex);
+            m_stopEviction = true;
+        }
+        m_evictionSignal.notify_one();
+        m_evictionThread.join();
+    }
+
     AWS_LOG_INFO(CurlTag, "Cleaning up CurlHandleContainer.");
-    while (m_handleContainer.size() > 0)
+    for (auto& idleHandles : m_idleHandles)
     {
-        AWS_LOG_DEBUG(CurlTag, "Cleaning up %p.", m_handleContainer.top());
-        curl_easy_cleanup(m_handleContainer.top());
-        m_handleContainer.pop();
+        for (auto& pooledHandle : idleHandles.second)
+        {
+            AWS_LOG_DEBUG(CurlTag, "Cleaning up %p.", pooledHandle.m_handle);
+            curl_easy_cleanup(pooledHandle.m_handle);
+        }
     }
+    m_idleHandles.clear();
 }
 
-CURL* CurlHandleContainer::AcquireCurlHandle()
+CURL* CurlHandleContainer::AcquireCurlHandle(const Aws::String& endpoint)
 {
     AWS_LOG_DEBUG(CurlTag, "Attempting to acquire curl connection.");
+    auto acquireStart = std::chrono::steady_clock::now();
     std::unique_lock<std::mutex> locker(m_handleContainerMutex);
 
-    while (m_handleContainer.size() == 0)
+    PooledHandle pooledHandle;
+    bool acquired = TakeIdleHandle(endpoint, pooledHandle);
+    while (!acquired)
+    {
+        if (CreateOrRecycleHandle(endpoint, pooledHandle))
+        {
+            break;
+        }
+
+        if (m_handlesInUse.empty())
+        {
+            AWS_LOG_ERROR(CurlTag, "Unable to create a curl handle and none are in use. Giving up.");
+            return nullptr;
+        }
+
+        AWS_LOG_INFO(CurlTag, "Connection pool has reached its max size. Waiting on connection to be freed.");
+        ++m_waitingThreads;
+        m_conditionVariable.wait(locker);
+        --m_waitingThreads;
+        AWS_LOG_INFO(CurlTag, "Connection has been released. Continuing.");
+        acquired = TakeIdleHandle(endpoint, pooledHandle);
+    }
+
+    return CheckOutHandle(endpoint, pooledHandle, acquireStart);
+}
+
+CURL* CurlHandleContainer::TryAcquireCurlHandle(const Aws::String& endpoint, bool& poolExhausted)
+{
+    auto acquireStart = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> locker(m_handleContainerMutex);
+
+    PooledHandle pooledHandle;
+    if (!TakeIdleHandle(endpoint, pooledHandle) && !CreateOrRecycleHandle(endpoint, pooledHandle))
     {
-        AWS_LOG_DEBUG(CurlTag, "No current connections available in pool. Attempting to create new connections.");
-        if (!CheckAndGrowPool())
+        poolExhausted = !m_handlesInUse.empty();
+        if (!poolExhausted)
         {
-            AWS_LOG_INFO(CurlTag, "Connection pool has reached its max size. Waiting on connection to be freed.");
-            m_conditionVariable.wait(locker);
-            AWS_LOG_INFO(CurlTag, "Connection has been released. Continuing.");
+            AWS_LOG_ERROR(CurlTag, "Unable to create a curl handle and none are in use. Giving up.");
         }
+        return nullptr;
     }
 
-    CURL* handle = m_handleContainer.top();
-    AWS_LOGSTREAM_DEBUG(CurlTag, "Returning connection handle " << handle);
-    m_handleContainer.pop();
-    return handle;
+    poolExhausted = false;
+    return CheckOutHandle(endpoint, pooledHandle, acquireStart);
+}
+
+bool CurlHandleContainer::CreateOrRecycleHandle(const Aws::String& endpoint, PooledHandle& pooledHandle)
+{
+    if (m_poolSize < m_maxPoolSize)
+    {
+        AWS_LOGSTREAM_DEBUG(CurlTag, "No idle connection to " << endpoint << " in pool. Creating a new connection.");
+        pooledHandle.m_handle = CreateHandle();
+        if (pooledHandle.m_handle)
+        {
+            pooledHandle.m_createdAt = std::chrono::steady_clock::now();
+            ++m_poolSize;
+            return true;
+        }
+    }
+
+    return RecycleIdleHandle(pooledHandle);
+}
+
+CURL* CurlHandleContainer::CheckOutHandle(const Aws::String& endpoint, PooledHandle& pooledHandle, std::chrono::steady_clock::time_point acquireStart)
+{
+    pooledHandle.m_endpoint = endpoint;
+    m_handlesInUse[pooledHandle.m_handle] = pooledHandle;
+
+    uint64_t waitTimeMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - acquireStart).count());
+    ++m_acquisitions;
+    m_totalWaitTimeMs += waitTimeMs;
+    m_maxWaitTimeMs = std::max(m_maxWaitTimeMs, waitTimeMs);
+
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Returning connection handle " << pooledHandle.m_handle);
+    return pooledHandle.m_handle;
 }
 
 void CurlHandleContainer::ReleaseCurlHandle(CURL* handle)
@@ -184,48 +289,211 @@ void CurlHandleContainer::ReleaseCurlHandle(CURL* handle)
         curl_easy_reset(handle);
         SetDefaultOptionsOnHandle(handle);
         AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << handle);
+
+        auto now = std::chrono::steady_clock::now();
         std::unique_lock<std::mutex> locker(m_handleContainerMutex);
-        m_handleContainer.push(handle);
-        locker.unlock();
+        PooledHandle pooledHandle;
+        auto inUse = m_handlesInUse.find(handle);
+        if (inUse != m_handlesInUse.end())
+        {
+            pooledHandle = inUse->second;
+            m_handlesInUse.erase(inUse);
+        }
+        else
+        {
+            pooledHandle.m_handle = handle;
+            pooledHandle.m_createdAt = now;
+        }
+        pooledHandle.m_lastReleasedAt = now;
+
+        if (m_maxAge.count() > 0 && now - pooledHandle.m_createdAt >= m_maxAge)
+        {
+            AWS_LOGSTREAM_DEBUG(CurlTag, "Handle " << handle << " reached its maximum age. Closing it.");
+            --m_poolSize;
+            locker.unlock();
+            curl_easy_cleanup(handle);
+        }
+        else
+        {
+            m_idleHandles[pooledHandle.m_endpoint].push_back(pooledHandle);
+            ++m_idleCount;
+            locker.unlock();
+        }
+
         AWS_LOG_DEBUG(CurlTag, "Notifying waiting threads.");
         m_conditionVariable.notify_one();
     }
 }
 
-bool CurlHandleContainer::CheckAndGrowPool()
+ConnectionPoolStatistics CurlHandleContainer::GetStatistics() const
 {
-    if (m_poolSize < m_maxPoolSize)
+    std::lock_guard<std::mutex> locker(m_handleContainerMutex);
+    ConnectionPoolStatistics statistics;
+    statistics.capacity = m_maxPoolSize;
+    statistics.inUse = static_cast<unsigned>(m_handlesInUse.size());
+    statistics.idle = m_idleCount;
+    statistics.waitingThreads = m_waitingThreads;
+    statistics.acquisitions = m_acquisitions;
+    statistics.totalWaitTimeMs = m_totalWaitTimeMs;
+    statistics.maxWaitTimeMs = m_maxWaitTimeMs;
+    return statistics;
+}
+
+bool CurlHandleContainer::TakeIdleHandle(const Aws::String& endpoint, PooledHandle& pooledHandle)
+{
+    auto idleHandles = m_idleHandles.find(endpoint);
+    if (idleHandles == m_idleHandles.end())
+    {
+        return false;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    bool found = false;
+    //most recently used at the back; its connection is the least likely to have been closed by the server.
+    while (!found && !idleHandles->second.empty())
     {
-        unsigned multiplier = m_poolSize > 0 ? m_poolSize : 1;
-        unsigned amountToAdd = std::min(multiplier * 2, m_maxPoolSize - m_poolSize);
-        AWS_LOGSTREAM_DEBUG(CurlTag, "attempting to grow pool size by " << amountToAdd);
+        pooledHandle = idleHandles->second.back();
+        idleHandles->second.pop_back();
+        --m_idleCount;
 
-        unsigned actuallyAdded = 0;
-        for (unsigned i = 0; i < amountToAdd; ++i)
+        if (IsExpired(pooledHandle, now))
+        {
+            AWS_LOGSTREAM_DEBUG(CurlTag, "Closing expired handle " << pooledHandle.m_handle);
+            curl_easy_cleanup(pooledHandle.m_handle);
+            --m_poolSize;
+        }
+        else
         {
-            CURL* curlHandle = curl_easy_init();
+            found = true;
+        }
+    }
 
-            if (curlHandle)
-            {
-                SetDefaultOptionsOnHandle(curlHandle);
-                m_handleContainer.push(curlHandle);
-                ++actuallyAdded;
-            }
-            else
+    if (idleHandles->second.empty())
+    {
+        m_idleHandles.erase(idleHandles);
+    }
+
+    return found;
+}
+
+bool CurlHandleContainer::RecycleIdleHandle(PooledHandle& pooledHandle)
+{
+    //take the least recently used handle of any endpoint; its connection belongs to another host, so start from a fresh handle.
+    auto oldest = m_idleHandles.end();
+    for (auto idleHandles = m_idleHandles.begin(); idleHandles != m_idleHandles.end(); ++idleHandles)
+    {
+        if (oldest == m_idleHandles.end() || idleHandles->second.front().m_lastReleasedAt < oldest->second.front().m_lastReleasedAt)
+        {
+            oldest = idleHandles;
+        }
+    }
+
+    if (oldest == m_idleHandles.end())
+    {
+        return false;
+    }
+
+    CURL* recycled = oldest->second.front().m_handle;
+    oldest->second.pop_front();
+    --m_idleCount;
+    if (oldest->second.empty())
+    {
+        m_idleHandles.erase(oldest);
+    }
+
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Recycling idle handle " << recycled << " for another endpoint.");
+    curl_easy_cleanup(recycled);
+    pooledHandle.m_handle = CreateHandle();
+    if (!pooledHandle.m_handle)
+    {
+        --m_poolSize;
+        return false;
+    }
+
+    pooledHandle.m_createdAt = std::chrono::steady_clock::now();
+    return true;
+}
+
+CURL* CurlHandleContainer::CreateHandle()
+{
+    CURL* curlHandle = curl_easy_init();
+    if (curlHandle)
+    {
+        SetDefaultOptionsOnHandle(curlHandle);
+    }
+    else
+    {
+        AWS_LOG_ERROR(CurlTag, "curl_easy_init failed to allocate.");
+    }
+    return curlHandle;
+}
+
+bool CurlHandleContainer::IsExpired(const PooledHandle& pooledHandle, std::chrono::steady_clock::time_point now) const
+{
+    return (m_idleTimeout.count() > 0 && now - pooledHandle.m_lastReleasedAt >= m_idleTimeout) ||
+           (m_maxAge.count() > 0 && now - pooledHandle.m_createdAt >= m_maxAge);
+}
+
+void CurlHandleContainer::EvictExpiredHandles()
+{
+    Aws::Vector<CURL*> expiredHandles;
+    {
+        std::lock_guard<std::mutex> locker(m_handleContainerMutex);
+        auto now = std::chrono::steady_clock::now();
+        for (auto idleHandles = m_idleHandles.begin(); idleHandles != m_idleHandles.end();)
+        {
+            auto& handles = idleHandles->second;
+            for (auto pooledHandle = handles.begin(); pooledHandle != handles.end();)
             {
-                AWS_LOG_ERROR(CurlTag, "curl_easy_init failed to allocate. Will continue retrying until amount to add has exhausted.");
+                if (IsExpired(*pooledHandle, now))
+                {
+                    expiredHandles.push_back(pooledHandle->m_handle);
+                    pooledHandle = handles.erase(pooledHandle);
+                }
+                else
+                {
+                    ++pooledHandle;
+                }
             }
+
+            idleHandles = handles.empty() ? m_idleHandles.erase(idleHandles) : std::next(idleHandles);
         }
 
-        AWS_LOGSTREAM_INFO(CurlTag, "Pool successfully grown by " << actuallyAdded);
-        m_poolSize += actuallyAdded;
+        m_idleCount -= static_cast<unsigned>(expiredHandles.size());
+        m_poolSize -= static_cast<unsigned>(expiredHandles.size());
+    }
 
-        return actuallyAdded > 0;
+    if (!expiredHandles.empty())
+    {
+        AWS_LOGSTREAM_DEBUG(CurlTag, "Evicting " << expiredHandles.size() << " expired connections.");
+        for (CURL* handle : expiredHandles)
+        {
+            curl_easy_cleanup(handle);
+        }
+        m_conditionVariable.notify_all();
     }
+}
 
-    AWS_LOG_INFO(CurlTag, "Pool cannot be grown any further, already at max size.");
+void CurlHandleContainer::RunEviction()
+{
+    std::chrono::milliseconds interval = m_idleTimeout.count() > 0 ? m_idleTimeout : m_maxAge;
+    if (m_maxAge.count() > 0 && m_maxAge < interval)
+    {
+        interval = m_maxAge;
+    }
+    interval = std::max(interval / 2, std::chrono::milliseconds(10));
 
-    return false;
+    std::unique_lock<std::mutex> locker(m_handleContainerMutex);
+    while (!m_stopEviction)
+    {
+        m_evictionSignal.wait_for(locker, interval, [this](){ return m_stopEviction; });
+        if (!m_stopEviction)
+        {
+            locker.unlock();
+            EvictExpiredHandles();
+            locker.lock();
+        }
+    }
 }
 
 void CurlHandleContainer::SetDefaultOptionsOnHandle(void* handle)
@@ -236,4 +504,46 @@ void CurlHandleContainer::SetDefaultOptionsOnHandle(void* handle)
     curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
     curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, m_requestTimeout);
     curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT_MS, m_connectTimeout);
+
+    //keeps curl itself from reusing a connection the pool would already consider expired.
+#if LIBCURL_VERSION_NUM >= 0x074100
+    if (m_idleTimeout.count() > 0)
+    {
+        curl_easy_setopt(handle, CURLOPT_MAXAGE_CONN, static_cast<long>(std::max<long long>(1, m_idleTimeout.count() / 1000)));
+    }
+#endif
+#if LIBCURL_VERSION_NUM >= 0x075000
+    if (m_maxAge.count() > 0)
+    {
+        curl_easy_setopt(handle, CURLOPT_MAXLIFETIME_CONN, static_cast<long>(std::max<long long>(1, m_maxAge.count() / 1000)));
+    }
+#endif
+
+    switch (m_httpVersion)
+    {
+        case HttpVersion::HTTP_1_1:
+            curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+            break;
+        case HttpVersion::HTTP_2_TLS:
+#if LIBCURL_VERSION_NUM >= 0x072f00
+            curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+#else
+            curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x072b00
+            //wait for a connection that can take another stream rather than opening a new one right away.
+            if (m_maxStreamsPerConnection > 1)
+            {
+                curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+            }
+#endif
+            break;
+        default:
+            break;
+    }
+
+    if (m_shareHandle)
+    {
+        m_shareHandle->Attach(handle);
+    }
 }
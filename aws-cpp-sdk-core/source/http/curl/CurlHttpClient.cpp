@@ -17,10 +17,13 @@
 
 
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <cassert>
 #include <algorithm>
 
@@ -41,13 +44,28 @@ struct CurlWriteCallbackContext
         m_client(client),
         m_request(request),
         m_response(response),
-        m_rateLimiter(rateLimiter)
+        m_rateLimiter(rateLimiter),
+        m_handle(nullptr),
+        m_bodySink(nullptr),
+        m_bodySinkResolved(false),
+        m_bodySinkRefused(false),
+        m_readCostPaid(false)
     {}
 
     const CurlHttpClient* m_client;
     HttpRequest* m_request;
     HttpResponse* m_response;
     Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    CURL* m_handle;
+    //where the body goes instead of the response stream; decided on the first chunk, once the status code is known.
+    ResponseBodySink* m_bodySink;
+    bool m_bodySinkResolved;
+    //the sink turned the body down; the transfer fails because of the caller, not the network.
+    bool m_bodySinkRefused;
+    //set for transfers that pause instead of sleeping when the rate limiter asks for a delay.
+    std::function<void(std::chrono::milliseconds)> m_resumeAfter;
+    //the chunk curl hands back after a pause has already been paid for.
+    bool m_readCostPaid;
 };
 
 struct CurlReadCallbackContext
@@ -59,6 +77,7 @@ struct CurlReadCallbackContext
 
     const CurlHttpClient* m_client;
     HttpRequest* m_request;
+    std::shared_ptr<RequestBodySource> m_bodySource;
 };
 
 static const char* CurlTag = "CurlHttpClient";
@@ -110,17 +129,94 @@ void SetOptCodeForHttpMethod(CURL* requestHandle, const HttpRequest& request)
 }
 
 CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
+    CurlHttpClient(clientConfig, 1)
+{
+}
+
+CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig, unsigned maxStreamsPerConnection) :
     Base(),   
-    m_curlHandleContainer(clientConfig.maxConnections, clientConfig.requestTimeoutMs, clientConfig.connectTimeoutMs),
+    m_curlHandleContainer(clientConfig.maxConnections, clientConfig.requestTimeoutMs, clientConfig.connectTimeoutMs, clientConfig.connectionCacheSharing,
+                          clientConfig.connectionIdleTimeoutMs, clientConfig.connectionMaxAgeMs, clientConfig.httpVersion, maxStreamsPerConnection),
     m_isUsingProxy(!clientConfig.proxyHost.empty()), m_proxyUserName(clientConfig.proxyUserName),
     m_proxyPassword(clientConfig.proxyPassword), m_proxyHost(clientConfig.proxyHost),
-    m_proxyPort(clientConfig.proxyPort), m_verifySSL(clientConfig.verifySSL), m_caPath(clientConfig.caPath), m_allowRedirects(clientConfig.followRedirects)
+    m_proxyPort(clientConfig.proxyPort), m_verifySSL(clientConfig.verifySSL), m_caPath(clientConfig.caPath), m_allowRedirects(clientConfig.followRedirects),
+    m_maxConnections(clientConfig.maxConnections)
 {
 }
 
 
+struct CurlHttpClient::CurlTransfer
+{
+    CurlTransfer(const CurlHttpClient* client, HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter) :
+        m_handle(nullptr),
+        m_headers(nullptr),
+        m_response(Aws::MakeShared<StandardHttpResponse>(CurlTag, request)),
+        m_writeContext(client, &request, m_response.get(), readLimiter),
+        m_readContext(client, &request)
+    {}
+
+    CURL* m_handle;
+    struct curl_slist* m_headers;
+    Aws::String m_url;
+    std::shared_ptr<HttpResponse> m_response;
+    CurlWriteCallbackContext m_writeContext;
+    CurlReadCallbackContext m_readContext;
+};
+
 std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
                                                           Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    CurlTransfer* transfer = BeginTransfer(request, readLimiter, writeLimiter);
+    if (!transfer)
+    {
+        return nullptr;
+    }
+
+    CURLcode curlResponseCode = curl_easy_perform(transfer->m_handle);
+    return EndTransfer(transfer, curlResponseCode);
+}
+
+static Aws::String GetPoolEndpoint(const HttpRequest& request)
+{
+    const URI& uri = request.GetUri();
+    Aws::StringStream endpoint;
+    endpoint << SchemeMapper::ToString(uri.GetScheme()) << "://" << uri.GetAuthority() << ":" << uri.GetPort();
+    return endpoint.str();
+}
+
+CurlHttpClient::CurlTransfer* CurlHttpClient::BeginTransfer(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                                            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    if (writeLimiter != nullptr)
+    {
+        writeLimiter->ApplyAndPayForCost(request.GetSize());
+    }
+
+    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle(GetPoolEndpoint(request));
+    if (!connectionHandle)
+    {
+        return nullptr;
+    }
+
+    return SetUpTransfer(request, readLimiter, connectionHandle);
+}
+
+CurlHttpClient::CurlTransfer* CurlHttpClient::TryBeginTransfer(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                                               const std::function<void(std::chrono::milliseconds)>& resumeReadsAfter, bool& poolExhausted) const
+{
+    CURL* connectionHandle = m_curlHandleContainer.TryAcquireCurlHandle(GetPoolEndpoint(request), poolExhausted);
+    if (!connectionHandle)
+    {
+        return nullptr;
+    }
+
+    CurlTransfer* transfer = SetUpTransfer(request, readLimiter, connectionHandle);
+    transfer->m_writeContext.m_resumeAfter = resumeReadsAfter;
+    return transfer;
+}
+
+CurlHttpClient::CurlTransfer* CurlHttpClient::SetUpTransfer(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                                            CURL* connectionHandle) const
 {
     //handle uri encoding at last second. Otherwise, the signer and the http layer will mismatch.
     URI uri = request.GetUri();
@@ -130,11 +226,6 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request,
     AWS_LOGSTREAM_TRACE(CurlTag, "Making request to " << url);
     struct curl_slist* headers = NULL;
 
-    if (writeLimiter != nullptr)
-    {
-        writeLimiter->ApplyAndPayForCost(request.GetSize());
-    }
-
     Aws::StringStream headerStream;
     HeaderValueCollection requestHeaders = request.GetHeaders();
 
@@ -159,123 +250,313 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request,
         headers = curl_slist_append(headers, "content-type:");
     }
 
-    std::shared_ptr<HttpResponse> response(nullptr);
-    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
-
-    if (connectionHandle)
-    {
-        AWS_LOGSTREAM_DEBUG(CurlTag, "Obtained connection handle " << connectionHandle);
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Obtained connection handle " << connectionHandle);
 
-        if (headers)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
-        }
+    CurlTransfer* transfer = Aws::New<CurlTransfer>(CurlTag, this, request, readLimiter);
+    transfer->m_handle = connectionHandle;
+    transfer->m_writeContext.m_handle = connectionHandle;
+    transfer->m_headers = headers;
+    transfer->m_url = url;
 
-        response = Aws::MakeShared<StandardHttpResponse>(CurlTag, request);
-        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
-        CurlReadCallbackContext readContext(this, &request);
+    if (headers)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
+    }
 
-        SetOptCodeForHttpMethod(connectionHandle, request);
+    SetOptCodeForHttpMethod(connectionHandle, request);
 
-        curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &CurlHttpClient::WriteData);
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &CurlHttpClient::WriteHeader);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, response.get());
+    curl_easy_setopt(connectionHandle, CURLOPT_URL, transfer->m_url.c_str());
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &CurlHttpClient::WriteData);
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &transfer->m_writeContext);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &CurlHttpClient::WriteHeader);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, transfer->m_response.get());
 
-        //we only want to override the default path if someone has explicitly told us to.
-        if(!m_caPath.empty())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
-        }
+    //we only want to override the default path if someone has explicitly told us to.
+    if(!m_caPath.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
+    }
 
-	// only set by android test builds because the emulator is missing a cert needed for aws services
+    // only set by android test builds because the emulator is missing a cert needed for aws services
 #ifdef TEST_CERT_PATH
-	curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
+    curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
 #endif // TEST_CERT_PATH
 
-        if (m_verifySSL)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
+    if (m_verifySSL)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
 
 #if LIBCURL_VERSION_MAJOR >= 7
 #if LIBCURL_VERSION_MINOR >= 34
-            curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
 #endif //LIBCURL_VERSION_MINOR
 #endif //LIBCURL_VERSION_MAJOR
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
-        }
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
 
-        if (m_allowRedirects)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
-        }
-        //curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
+    if (m_allowRedirects)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
+    }
+    //curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
 
-        if (m_isUsingProxy)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, m_proxyHost.c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
-        }
+    if (m_isUsingProxy)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, m_proxyHost.c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
+    }
 
-        if (request.GetContentBody())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, &CurlHttpClient::ReadBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
-        }
+    if (request.GetContentBodySource())
+    {
+        transfer->m_readContext.m_bodySource = request.GetContentBodySource();
+    }
+    else if (request.GetContentBody())
+    {
+        transfer->m_readContext.m_bodySource = Aws::MakeShared<StreamBodySource>(CurlTag, request.GetContentBody());
+    }
+
+    if (transfer->m_readContext.m_bodySource)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, &CurlHttpClient::ReadBody);
+        curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &transfer->m_readContext);
+    }
+
+    return transfer;
+}
+
+#if LIBCURL_VERSION_NUM >= 0x073d00
+static int64_t GetTimeUs(CURL* handle, CURLINFO info)
+{
+    curl_off_t value = -1;
+    return curl_easy_getinfo(handle, info, &value) == CURLE_OK ? static_cast<int64_t>(value) : -1;
+}
+#else
+static int64_t GetTimeUs(CURL* handle, CURLINFO info)
+{
+    double value = -1;
+    return curl_easy_getinfo(handle, info, &value) == CURLE_OK ? static_cast<int64_t>(value * 1000000) : -1;
+}
+#endif
+
+#if LIBCURL_VERSION_NUM >= 0x073700
+static int64_t GetByteCount(CURL* handle, CURLINFO info)
+{
+    curl_off_t value = -1;
+    return curl_easy_getinfo(handle, info, &value) == CURLE_OK ? static_cast<int64_t>(value) : -1;
+}
+#else
+static int64_t GetByteCount(CURL* handle, CURLINFO info)
+{
+    double value = -1;
+    return curl_easy_getinfo(handle, info, &value) == CURLE_OK ? static_cast<int64_t>(value) : -1;
+}
+#endif
+
+static HttpTransferMetrics CollectTransferMetrics(CURL* handle)
+{
+    HttpTransferMetrics metrics;
+#if LIBCURL_VERSION_NUM >= 0x073d00
+    metrics.nameLookupTimeUs = GetTimeUs(handle, CURLINFO_NAMELOOKUP_TIME_T);
+    metrics.connectTimeUs = GetTimeUs(handle, CURLINFO_CONNECT_TIME_T);
+    metrics.tlsHandshakeTimeUs = GetTimeUs(handle, CURLINFO_APPCONNECT_TIME_T);
+    metrics.preTransferTimeUs = GetTimeUs(handle, CURLINFO_PRETRANSFER_TIME_T);
+    metrics.firstByteTimeUs = GetTimeUs(handle, CURLINFO_STARTTRANSFER_TIME_T);
+    metrics.totalTimeUs = GetTimeUs(handle, CURLINFO_TOTAL_TIME_T);
+#else
+    metrics.nameLookupTimeUs = GetTimeUs(handle, CURLINFO_NAMELOOKUP_TIME);
+    metrics.connectTimeUs = GetTimeUs(handle, CURLINFO_CONNECT_TIME);
+    metrics.tlsHandshakeTimeUs = GetTimeUs(handle, CURLINFO_APPCONNECT_TIME);
+    metrics.preTransferTimeUs = GetTimeUs(handle, CURLINFO_PRETRANSFER_TIME);
+    metrics.firstByteTimeUs = GetTimeUs(handle, CURLINFO_STARTTRANSFER_TIME);
+    metrics.totalTimeUs = GetTimeUs(handle, CURLINFO_TOTAL_TIME);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x073700
+    metrics.bytesSent = GetByteCount(handle, CURLINFO_SIZE_UPLOAD_T);
+    metrics.bytesReceived = GetByteCount(handle, CURLINFO_SIZE_DOWNLOAD_T);
+#else
+    metrics.bytesSent = GetByteCount(handle, CURLINFO_SIZE_UPLOAD);
+    metrics.bytesReceived = GetByteCount(handle, CURLINFO_SIZE_DOWNLOAD);
+#endif
+
+    //curl counts the connections it had to open for the transfer, so none means an existing one was reused.
+    long newConnections = 0;
+    if (curl_easy_getinfo(handle, CURLINFO_NUM_CONNECTS, &newConnections) == CURLE_OK)
+    {
+        metrics.connectionReused = newConnections == 0;
+    }
 
-        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
-        if (curlResponseCode != CURLE_OK)
+    return metrics;
+}
+
+static HttpTransferFailure GetTransferFailure(CURLcode curlResponseCode)
+{
+    switch (curlResponseCode)
+    {
+        case CURLE_OK:
+            return HttpTransferFailure::NONE;
+        case CURLE_COULDNT_RESOLVE_PROXY:
+        case CURLE_COULDNT_RESOLVE_HOST:
+        case CURLE_COULDNT_CONNECT:
+            return HttpTransferFailure::CONNECT_FAILED;
+        case CURLE_OPERATION_TIMEDOUT:
+            return HttpTransferFailure::TIMED_OUT;
+        default:
+            return HttpTransferFailure::OTHER;
+    }
+}
+
+std::shared_ptr<HttpResponse> CurlHttpClient::EndTransfer(CurlTransfer* transfer, CURLcode curlResponseCode) const
+{
+    CURL* connectionHandle = transfer->m_handle;
+    std::shared_ptr<HttpResponse> response = transfer->m_response;
+
+    //failed and timed out transfers are the ones whose timings matter most, so they are kept on the request either way.
+    HttpTransferMetrics metrics = CollectTransferMetrics(connectionHandle);
+    transfer->m_writeContext.m_request->SetTransferMetrics(metrics);
+    transfer->m_writeContext.m_request->SetTransferFailure(curlResponseCode != CURLE_OK && transfer->m_writeContext.m_bodySinkRefused ?
+        HttpTransferFailure::RESPONSE_BODY_REFUSED : GetTransferFailure(curlResponseCode));
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Timings (us): dns " << metrics.nameLookupTimeUs << ", connect " << metrics.connectTimeUs
+        << ", tls " << metrics.tlsHandshakeTimeUs << ", pretransfer " << metrics.preTransferTimeUs << ", first byte " << metrics.firstByteTimeUs
+        << ", total " << metrics.totalTimeUs << "; bytes sent " << metrics.bytesSent << ", received " << metrics.bytesReceived
+        << (metrics.connectionReused ? ", reused connection" : ", new connection"));
+
+    if (curlResponseCode != CURLE_OK)
+    {
+        response = nullptr;
+        AWS_LOGSTREAM_ERROR(CurlTag, "Curl returned error code " << curlResponseCode << " after " << metrics.totalTimeUs << "us");
+    }
+    else
+    {
+        long responseCode;
+        curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+        response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
+        AWS_LOGSTREAM_DEBUG(CurlTag, "Returned http response code " << responseCode);
+
+        char* contentType = nullptr;
+        curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
+        if (contentType)
         {
-            response = nullptr;
-            AWS_LOGSTREAM_ERROR(CurlTag, "Curl returned error code " << curlResponseCode);
+            response->SetContentType(contentType);
+            AWS_LOGSTREAM_DEBUG(CurlTag, "Returned content type " << contentType);
         }
-        else
-        {
-            long responseCode;
-            curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
-            response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
-            AWS_LOGSTREAM_DEBUG(CurlTag, "Returned http response code " << responseCode);
-
-            char* contentType = nullptr;
-            curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
-            if (contentType)
-            {
-                response->SetContentType(contentType);
-                AWS_LOGSTREAM_DEBUG(CurlTag, "Returned content type " << contentType);
-            }
 
-            AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << connectionHandle);
+        response->SetTransferMetrics(metrics);
+
+        AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << connectionHandle);
+    }
+
+    m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
+    //go ahead and flush the response body stream
+    if(response)
+    {
+        response->GetResponseBody().flush();
+    }
+
+    if (transfer->m_headers)
+    {
+        curl_slist_free_all(transfer->m_headers);
+    }
+    Aws::Delete(transfer);
+
+    return response;
+}
+
+unsigned CurlHttpClient::Prewarm(const URI& endpoint, unsigned connections) const
+{
+    connections = (std::min)(connections, m_maxConnections);
+    AWS_LOGSTREAM_INFO(CurlTag, "Prewarming " << connections << " connections to " << endpoint.GetURIString());
+
+    Aws::Vector<std::shared_ptr<HttpRequest>> requests;
+    Aws::Vector<CurlTransfer*> transfers;
+    for (unsigned i = 0; i < connections; ++i)
+    {
+        auto request = Aws::MakeShared<StandardHttpRequest>(CurlTag, endpoint, HttpMethod::HTTP_HEAD);
+        request->SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        requests.push_back(request);
+
+        //holding on to every handle until all of them are done forces a distinct connection per handle. Only handles free right
+        //now are taken: waiting for more while holding these would deadlock with anyone else doing the same.
+        bool poolExhausted = false;
+        CurlTransfer* transfer = TryBeginTransfer(*request, nullptr, std::function<void(std::chrono::milliseconds)>(), poolExhausted);
+        if (!transfer)
+        {
+            AWS_LOGSTREAM_INFO(CurlTag, "Only " << transfers.size() << " connections free to prewarm.");
+            break;
         }
+        transfers.push_back(transfer);
+    }
 
-        m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
-        //go ahead and flush the response body stream
-        if(response)
+    unsigned opened = 0;
+    Aws::Vector<CURLcode> results;
+    for (CurlTransfer* transfer : transfers)
+    {
+        CURLcode result = curl_easy_perform(transfer->m_handle);
+        if (result == CURLE_OK)
         {
-            response->GetResponseBody().flush();
+            ++opened;
         }
+        results.push_back(result);
     }
 
-    if (headers)
+    for (size_t i = 0; i < transfers.size(); ++i)
     {
-        curl_slist_free_all(headers);
+        EndTransfer(transfers[i], results[i]);
     }
 
-    return response;
+    return opened;
+}
+
+ConnectionPoolStatistics CurlHttpClient::GetConnectionPoolStatistics() const
+{
+    return m_curlHandleContainer.GetStatistics();
+}
+
+CURL* CurlHttpClient::GetTransferHandle(const CurlTransfer* transfer)
+{
+    return transfer->m_handle;
 }
 
 
+//successful responses go to the caller's sink when there is one; errors still go to the body stream so they can be parsed.
+static bool ResolveBodySink(CurlWriteCallbackContext* context)
+{
+    ResponseBodySink* bodySink = context->m_request->GetResponseBodySink().get();
+    if (!bodySink)
+    {
+        return true;
+    }
+
+    long responseCode = 0;
+    curl_easy_getinfo(context->m_handle, CURLINFO_RESPONSE_CODE, &responseCode);
+    if (responseCode < 200 || responseCode > 299)
+    {
+        return true;
+    }
+
+    HttpResponse* response = context->m_response;
+    int64_t contentLength = response->HasHeader(CONTENT_LENGTH_HEADER) ?
+        static_cast<int64_t>(StringUtils::ConvertToInt64(response->GetHeader(CONTENT_LENGTH_HEADER).c_str())) : -1;
+    if (!bodySink->Begin(contentLength))
+    {
+        AWS_LOGSTREAM_ERROR(CurlTag, "Response body sink refused a body of " << contentLength << " bytes, aborting transfer.");
+        return false;
+    }
+
+    context->m_bodySink = bodySink;
+    return true;
+}
+
 size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
     if (ptr)
@@ -292,10 +573,50 @@ size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* use
         size_t sizeToWrite = size * nmemb;
         if (context->m_rateLimiter)
         {
-            context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(sizeToWrite));
+            if (!context->m_resumeAfter)
+            {
+                context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(sizeToWrite));
+            }
+            else if (context->m_readCostPaid)
+            {
+                context->m_readCostPaid = false;
+            }
+            else
+            {
+                //curl keeps the chunk and hands it back to us once the handle is resumed.
+                auto delay = context->m_rateLimiter->ApplyCost(static_cast<int64_t>(sizeToWrite));
+                if (delay.count() > 0)
+                {
+                    context->m_readCostPaid = true;
+                    context->m_resumeAfter(delay);
+                    return CURL_WRITEFUNC_PAUSE;
+                }
+            }
         }
 
-        response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        if (!context->m_bodySinkResolved)
+        {
+            context->m_bodySinkResolved = true;
+            if (!ResolveBodySink(context))
+            {
+                context->m_bodySinkRefused = true;
+                return 0;
+            }
+        }
+
+        if (context->m_bodySink)
+        {
+            if (!context->m_bodySink->Write(reinterpret_cast<const unsigned char*>(ptr), sizeToWrite))
+            {
+                AWS_LOG_ERROR(CurlTag, "Response body sink refused a chunk, aborting transfer.");
+                context->m_bodySinkRefused = true;
+                return 0;
+            }
+        }
+        else
+        {
+            response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        }
         auto& receivedHandler = context->m_request->GetDataReceivedEventHandler();
         if (receivedHandler)
         {
@@ -351,24 +672,18 @@ size_t CurlHttpClient::ReadBody(char* ptr, size_t size, size_t nmemb, void* user
     }
 
     HttpRequest* request = context->m_request;
-    std::shared_ptr<Aws::IOStream> ioStream = request->GetContentBody();
+    RequestBodySource* bodySource = context->m_bodySource.get();
 
-    if (ioStream != nullptr && size * nmemb)
+    if (bodySource != nullptr && size * nmemb > 0)
     {
-        auto currentPos = ioStream->tellg();
-        ioStream->seekg(0, ioStream->end);
-        auto length = ioStream->tellg();
-        ioStream->seekg(currentPos, ioStream->beg);
-        size_t amountToRead = static_cast< size_t >(std::min<decltype(length)>(length - currentPos, size * nmemb));
-
-        ioStream->read(ptr, amountToRead);
+        size_t amountRead = bodySource->Read(ptr, size * nmemb);
         auto& sentHandler = request->GetDataSentEventHandler();
         if (sentHandler)
         {
-            sentHandler(request, amountToRead);
+            sentHandler(request, static_cast<long long>(amountRead));
         }
 
-        return amountToRead;
+        return amountRead;
     }
 
     return 0;
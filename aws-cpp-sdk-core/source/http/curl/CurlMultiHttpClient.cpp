@@ -0,0 +1,491 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSList.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSMultiMap.h>
+#include <aws/core/utils/memory/stl/AWSQueue.h>
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils::Logging;
+
+static const char* CurlMultiTag = "CurlMultiHttpClient";
+
+// curl_multi_poll and curl_multi_wakeup arrived in 7.68.0. Older versions fall back to curl_multi_wait, in which case
+// this is also the longest a newly submitted request can sit in the queue while other transfers are in flight.
+static const int POLL_TIMEOUT_MS = 10;
+
+#if LIBCURL_VERSION_NUM >= 0x074400
+#define AWS_CURL_HAS_MULTI_WAKEUP 1
+#endif
+
+/**
+ * Owns one curl multi handle and the thread that drives it. Nothing the thread does may block: requests wait in a queue
+ * while the connection pool is exhausted, and rate limiter delays and retry backoffs become timers.
+ */
+class CurlMultiHttpClient::EventLoop
+{
+public:
+    EventLoop(const CurlMultiHttpClient* client, long maxHostConnections, long maxStreamsPerConnection) :
+        m_client(client),
+        m_multiHandle(curl_multi_init()),
+        m_running(true),
+        m_nextTransferId(0)
+    {
+        if (maxStreamsPerConnection > 1)
+        {
+            //concurrent requests to a host become streams on its existing connections, and only once those are full
+            //is another connection opened, up to maxHostConnections.
+#if LIBCURL_VERSION_NUM >= 0x072b00
+            curl_multi_setopt(m_multiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+            curl_multi_setopt(m_multiHandle, CURLMOPT_MAX_HOST_CONNECTIONS, maxHostConnections);
+#if LIBCURL_VERSION_NUM >= 0x074300
+            curl_multi_setopt(m_multiHandle, CURLMOPT_MAX_CONCURRENT_STREAMS, maxStreamsPerConnection);
+#endif
+        }
+
+        m_thread = std::thread(std::bind(&EventLoop::Run, this));
+    }
+
+    ~EventLoop()
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_submissionMutex);
+            m_running = false;
+        }
+        Wakeup();
+        m_thread.join();
+        curl_multi_cleanup(m_multiHandle);
+    }
+
+    void Submit(HttpRequest& request, const HttpResponseCallback& onComplete,
+                Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter)
+    {
+        PendingTransfer* pending = Aws::New<PendingTransfer>(CurlMultiTag);
+        pending->m_request = &request;
+        pending->m_readLimiter = readLimiter;
+        pending->m_writeLimiter = writeLimiter;
+        pending->m_onComplete = onComplete;
+
+        {
+            std::lock_guard<std::mutex> locker(m_submissionMutex);
+            m_submitted.push(pending);
+        }
+        Wakeup();
+    }
+
+    /**
+     * Runs callback on the event loop thread once delay has passed.
+     */
+    void Schedule(std::chrono::milliseconds delay, const std::function<void()>& callback)
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_submissionMutex);
+            m_submittedTimers.push_back(Timer(std::chrono::steady_clock::now() + delay, callback));
+        }
+        Wakeup();
+    }
+
+    bool IsLoopThread() const
+    {
+        return std::this_thread::get_id() == m_thread.get_id();
+    }
+
+private:
+    typedef std::chrono::steady_clock::time_point TimePoint;
+    typedef std::pair<TimePoint, std::function<void()>> Timer;
+
+    struct PendingTransfer
+    {
+        PendingTransfer() :
+            m_request(nullptr), m_readLimiter(nullptr), m_writeLimiter(nullptr), m_transfer(nullptr), m_id(0)
+        {}
+
+        HttpRequest* m_request;
+        Aws::Utils::RateLimits::RateLimiterInterface* m_readLimiter;
+        Aws::Utils::RateLimits::RateLimiterInterface* m_writeLimiter;
+        HttpResponseCallback m_onComplete;
+        //null until a handle has been acquired for the request
+        CurlTransfer* m_transfer;
+        uint64_t m_id;
+        //when the write limiter lets the request go out
+        TimePoint m_startAfter;
+    };
+
+    void Wakeup()
+    {
+        m_submissionSignal.notify_one();
+#ifdef AWS_CURL_HAS_MULTI_WAKEUP
+        curl_multi_wakeup(m_multiHandle);
+#endif
+    }
+
+    void Run()
+    {
+        while (m_running)
+        {
+            TakeSubmissions();
+            RunDueTimers();
+            StartWaitingTransfers();
+
+            if (!m_active.empty())
+            {
+                int runningHandles = 0;
+                curl_multi_perform(m_multiHandle, &runningHandles);
+                CompleteFinishedTransfers();
+            }
+
+            Wait();
+        }
+
+        AbortAll();
+    }
+
+    void TakeSubmissions()
+    {
+        Aws::Queue<PendingTransfer*> submitted;
+        Aws::Vector<Timer> submittedTimers;
+        {
+            std::lock_guard<std::mutex> locker(m_submissionMutex);
+            submitted.swap(m_submitted);
+            submittedTimers.swap(m_submittedTimers);
+        }
+
+        for (auto& timer : submittedTimers)
+        {
+            m_timers.insert(timer);
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        while (!submitted.empty())
+        {
+            PendingTransfer* pending = submitted.front();
+            submitted.pop();
+
+            pending->m_id = ++m_nextTransferId;
+            pending->m_startAfter = now;
+            if (pending->m_writeLimiter)
+            {
+                pending->m_startAfter += pending->m_writeLimiter->ApplyCost(pending->m_request->GetSize());
+            }
+            m_waiting.push_back(pending);
+        }
+    }
+
+    void RunDueTimers()
+    {
+        if (m_timers.empty())
+        {
+            return;
+        }
+
+        //a timer may schedule another one, so the due ones are taken out before any of them runs.
+        auto due = m_client->IsRequestProcessingEnabled() ? m_timers.upper_bound(std::chrono::steady_clock::now()) : m_timers.end();
+        Aws::Vector<std::function<void()>> callbacks;
+        for (auto timer = m_timers.begin(); timer != due; ++timer)
+        {
+            callbacks.push_back(timer->second);
+        }
+        m_timers.erase(m_timers.begin(), due);
+
+        for (auto& callback : callbacks)
+        {
+            callback();
+        }
+    }
+
+    void StartWaitingTransfers()
+    {
+        auto now = std::chrono::steady_clock::now();
+        auto waiting = m_waiting.begin();
+        while (waiting != m_waiting.end())
+        {
+            PendingTransfer* pending = *waiting;
+            if (pending->m_startAfter > now)
+            {
+                ++waiting;
+                continue;
+            }
+
+            uint64_t id = pending->m_id;
+            bool poolExhausted = false;
+            pending->m_transfer = m_client->TryBeginTransfer(*pending->m_request, pending->m_readLimiter,
+                [this, id](std::chrono::milliseconds delay) { ResumeReadsAfter(id, delay); }, poolExhausted);
+            if (!pending->m_transfer && poolExhausted)
+            {
+                //tried again once a transfer has given its handle back; the rest of the queue still gets its chance, since another
+                //loop may have released a handle in the meantime.
+                ++waiting;
+                continue;
+            }
+
+            waiting = m_waiting.erase(waiting);
+            if (!pending->m_transfer)
+            {
+                Complete(pending, CURLE_FAILED_INIT);
+                continue;
+            }
+
+            CURL* handle = GetTransferHandle(pending->m_transfer);
+            curl_easy_setopt(handle, CURLOPT_PRIVATE, pending);
+            CURLMcode addResult = curl_multi_add_handle(m_multiHandle, handle);
+            if (addResult != CURLM_OK)
+            {
+                AWS_LOGSTREAM_ERROR(CurlMultiTag, "Failed to add handle " << handle << " to multi handle, error code " << addResult);
+                Complete(pending, CURLE_FAILED_INIT);
+                continue;
+            }
+
+            AWS_LOGSTREAM_DEBUG(CurlMultiTag, "Added handle " << handle << " to event loop.");
+            m_active[id] = pending;
+        }
+    }
+
+    //called from the write callback, so on the loop thread
+    void ResumeReadsAfter(uint64_t id, std::chrono::milliseconds delay)
+    {
+        m_timers.insert(Timer(std::chrono::steady_clock::now() + delay, [this, id]()
+        {
+            auto active = m_active.find(id);
+            if (active != m_active.end())
+            {
+                curl_easy_pause(GetTransferHandle(active->second->m_transfer), CURLPAUSE_CONT);
+            }
+        }));
+    }
+
+    void CompleteFinishedTransfers()
+    {
+        int messagesInQueue = 0;
+        CURLMsg* message = nullptr;
+        while ((message = curl_multi_info_read(m_multiHandle, &messagesInQueue)) != nullptr)
+        {
+            if (message->msg != CURLMSG_DONE)
+            {
+                continue;
+            }
+
+            CURL* handle = message->easy_handle;
+            CURLcode result = message->data.result;
+            PendingTransfer* pending = nullptr;
+            curl_easy_getinfo(handle, CURLINFO_PRIVATE, reinterpret_cast<char**>(&pending));
+            curl_multi_remove_handle(m_multiHandle, handle);
+
+            m_active.erase(pending->m_id);
+            Complete(pending, result);
+        }
+    }
+
+    void Wait()
+    {
+        int timeoutMs = POLL_TIMEOUT_MS;
+        if (!m_timers.empty())
+        {
+            auto untilNextTimer = std::chrono::duration_cast<std::chrono::milliseconds>(m_timers.begin()->first - std::chrono::steady_clock::now());
+            timeoutMs = static_cast<int>((std::max)(static_cast<int64_t>(0), (std::min)(static_cast<int64_t>(timeoutMs), static_cast<int64_t>(untilNextTimer.count()))));
+        }
+
+        if (!m_active.empty())
+        {
+            int numFds = 0;
+#ifdef AWS_CURL_HAS_MULTI_WAKEUP
+            curl_multi_poll(m_multiHandle, nullptr, 0, timeoutMs, &numFds);
+#else
+            curl_multi_wait(m_multiHandle, nullptr, 0, timeoutMs, &numFds);
+#endif
+            return;
+        }
+
+        std::unique_lock<std::mutex> locker(m_submissionMutex);
+        auto hasWork = [this]() { return !m_running || !m_submitted.empty() || !m_submittedTimers.empty(); };
+        if (m_waiting.empty() && m_timers.empty())
+        {
+            m_submissionSignal.wait(locker, hasWork);
+        }
+        else
+        {
+            m_submissionSignal.wait_for(locker, std::chrono::milliseconds(timeoutMs), hasWork);
+        }
+    }
+
+    void AbortAll()
+    {
+        AWS_LOGSTREAM_INFO(CurlMultiTag, "Event loop shutting down, aborting " << m_active.size() << " transfers in flight and "
+            << m_waiting.size() << " waiting for a connection; dropping " << m_timers.size() << " timers.");
+        for (auto& active : m_active)
+        {
+            curl_multi_remove_handle(m_multiHandle, GetTransferHandle(active.second->m_transfer));
+            Complete(active.second, CURLE_ABORTED_BY_CALLBACK);
+        }
+        m_active.clear();
+
+        for (PendingTransfer* pending : m_waiting)
+        {
+            Complete(pending, CURLE_ABORTED_BY_CALLBACK);
+        }
+        m_waiting.clear();
+        m_timers.clear();
+
+        std::lock_guard<std::mutex> locker(m_submissionMutex);
+        while (!m_submitted.empty())
+        {
+            Complete(m_submitted.front(), CURLE_ABORTED_BY_CALLBACK);
+            m_submitted.pop();
+        }
+        m_submittedTimers.clear();
+    }
+
+    void Complete(PendingTransfer* pending, CURLcode result)
+    {
+        std::shared_ptr<HttpResponse> response;
+        if (pending->m_transfer)
+        {
+            response = m_client->EndTransfer(pending->m_transfer, result);
+        }
+        if (pending->m_onComplete)
+        {
+            pending->m_onComplete(response);
+        }
+        Aws::Delete(pending);
+    }
+
+    const CurlMultiHttpClient* m_client;
+    CURLM* m_multiHandle;
+    std::atomic<bool> m_running;
+    std::mutex m_submissionMutex;
+    std::condition_variable m_submissionSignal;
+    Aws::Queue<PendingTransfer*> m_submitted;
+    Aws::Vector<Timer> m_submittedTimers;
+    //only touched by the event loop thread
+    uint64_t m_nextTransferId;
+    Aws::List<PendingTransfer*> m_waiting;
+    Aws::Map<uint64_t, PendingTransfer*> m_active;
+    Aws::MultiMap<TimePoint, std::function<void()>> m_timers;
+    std::thread m_thread;
+};
+
+static unsigned GetMaxStreamsPerConnection(const ClientConfiguration& clientConfig)
+{
+    if (clientConfig.httpVersion != HttpVersion::HTTP_2_TLS || clientConfig.maxStreamsPerConnection == 0)
+    {
+        return 1;
+    }
+
+    return clientConfig.maxStreamsPerConnection;
+}
+
+CurlMultiHttpClient::CurlMultiHttpClient(const ClientConfiguration& clientConfig) :
+    Base(clientConfig, GetMaxStreamsPerConnection(clientConfig)),
+    m_nextEventLoop(0)
+{
+    unsigned eventLoopCount = clientConfig.httpEventLoopThreads > 0 ? clientConfig.httpEventLoopThreads : 1;
+    unsigned maxStreamsPerConnection = GetMaxStreamsPerConnection(clientConfig);
+    //every loop has its own connection cache, so maxConnections is split between them.
+    unsigned maxHostConnections = (std::max)(1u, (clientConfig.maxConnections + eventLoopCount - 1) / eventLoopCount);
+
+    AWS_LOGSTREAM_INFO(CurlMultiTag, "Starting " << eventLoopCount << " event loop threads with " << maxStreamsPerConnection << " streams per connection.");
+    for (unsigned i = 0; i < eventLoopCount; ++i)
+    {
+        m_eventLoops.push_back(Aws::MakeUnique<EventLoop>(CurlMultiTag, this, static_cast<long>(maxHostConnections), static_cast<long>(maxStreamsPerConnection)));
+    }
+}
+
+CurlMultiHttpClient::~CurlMultiHttpClient()
+{
+    m_eventLoops.clear();
+}
+
+bool CurlMultiHttpClient::IsEventLoopThread() const
+{
+    for (auto& eventLoop : m_eventLoops)
+    {
+        if (eventLoop->IsLoopThread())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+CurlMultiHttpClient::EventLoop& CurlMultiHttpClient::NextEventLoop() const
+{
+    return *m_eventLoops[m_nextEventLoop++ % m_eventLoops.size()];
+}
+
+std::shared_ptr<HttpResponse> CurlMultiHttpClient::MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                                               Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    //waiting on an event loop from one of its own threads would deadlock, so those requests are made in place. Nor may they wait
+    //for a connection: the ones in use may belong to this loop's transfers, which can't finish until this call returns.
+    if (IsEventLoopThread())
+    {
+        if (writeLimiter != nullptr)
+        {
+            writeLimiter->ApplyAndPayForCost(request.GetSize());
+        }
+
+        bool poolExhausted = false;
+        CurlTransfer* transfer = TryBeginTransfer(request, readLimiter, std::function<void(std::chrono::milliseconds)>(), poolExhausted);
+        if (!transfer)
+        {
+            AWS_LOGSTREAM_ERROR(CurlMultiTag, "No connection free for a request made from an event loop thread; failing it instead of waiting.");
+            request.SetTransferFailure(HttpTransferFailure::OTHER);
+            return nullptr;
+        }
+
+        return EndTransfer(transfer, curl_easy_perform(GetTransferHandle(transfer)));
+    }
+
+    std::mutex completionMutex;
+    std::condition_variable completionSignal;
+    bool completed = false;
+    std::shared_ptr<HttpResponse> result;
+
+    MakeRequestAsync(request, [&](const std::shared_ptr<HttpResponse>& response)
+    {
+        std::lock_guard<std::mutex> locker(completionMutex);
+        result = response;
+        completed = true;
+        completionSignal.notify_one();
+    }, readLimiter, writeLimiter);
+
+    std::unique_lock<std::mutex> locker(completionMutex);
+    completionSignal.wait(locker, [&](){ return completed; });
+    return result;
+}
+
+void CurlMultiHttpClient::MakeRequestAsync(HttpRequest& request, const HttpResponseCallback& onComplete,
+                                           Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                           Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    NextEventLoop().Submit(request, onComplete, readLimiter, writeLimiter);
+}
+
+void CurlMultiHttpClient::ScheduleRetry(std::chrono::milliseconds sleepTime, const std::function<void()>& retry)
+{
+    NextEventLoop().Schedule(sleepTime, retry);
+}
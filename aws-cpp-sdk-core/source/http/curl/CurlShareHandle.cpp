@@ -0,0 +1,85 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/curl/CurlShareHandle.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Utils::Logging;
+using namespace Aws::Http;
+
+static const char* CurlShareTag = "CurlShareHandle";
+
+static std::mutex s_processWideMutex;
+static std::weak_ptr<CurlShareHandle> s_processWideInstance;
+
+CurlShareHandle::CurlShareHandle() :
+    m_shareHandle(curl_share_init())
+{
+    if (!m_shareHandle)
+    {
+        AWS_LOG_ERROR(CurlShareTag, "curl_share_init failed, handles will not share caches.");
+        return;
+    }
+
+    curl_share_setopt(m_shareHandle, CURLSHOPT_LOCKFUNC, &CurlShareHandle::LockShare);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_UNLOCKFUNC, &CurlShareHandle::UnlockShare);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+}
+
+CurlShareHandle::~CurlShareHandle()
+{
+    if (m_shareHandle)
+    {
+        CURLSHcode cleanupResult = curl_share_cleanup(m_shareHandle);
+        if (cleanupResult != CURLSHE_OK)
+        {
+            AWS_LOGSTREAM_ERROR(CurlShareTag, "curl_share_cleanup failed with error code " << cleanupResult);
+        }
+    }
+}
+
+void CurlShareHandle::Attach(CURL* handle) const
+{
+    if (m_shareHandle)
+    {
+        curl_easy_setopt(handle, CURLOPT_SHARE, m_shareHandle);
+    }
+}
+
+std::shared_ptr<CurlShareHandle> CurlShareHandle::GetProcessWideInstance()
+{
+    std::lock_guard<std::mutex> locker(s_processWideMutex);
+    std::shared_ptr<CurlShareHandle> instance = s_processWideInstance.lock();
+    if (!instance)
+    {
+        AWS_LOG_INFO(CurlShareTag, "Creating process wide curl share handle.");
+        instance = Aws::MakeShared<CurlShareHandle>(CurlShareTag);
+        s_processWideInstance = instance;
+    }
+    return instance;
+}
+
+void CurlShareHandle::LockShare(CURL*, curl_lock_data data, curl_lock_access, void* userptr)
+{
+    reinterpret_cast<CurlShareHandle*>(userptr)->m_locks[data].lock();
+}
+
+void CurlShareHandle::UnlockShare(CURL*, curl_lock_data data, void* userptr)
+{
+    reinterpret_cast<CurlShareHandle*>(userptr)->m_locks[data].unlock();
+}
@@ -98,8 +98,27 @@ void WinSyncHttpClient::AddHeadersToRequest(const HttpRequest& request, void* hH
 bool WinSyncHttpClient::StreamPayloadToRequest(const HttpRequest& request, void* hHttpRequest) const
 {
     bool success = true;
+    auto bodySource = request.GetContentBodySource();
     auto payloadStream = request.GetContentBody();
-    if(payloadStream)
+    if(bodySource)
+    {
+        char sourceBuffer[ HTTP_REQUEST_WRITE_BUFFER_LENGTH ];
+        std::size_t bytesRead = 0;
+        while(success && (bytesRead = bodySource->Read(sourceBuffer, HTTP_REQUEST_WRITE_BUFFER_LENGTH)) > 0)
+        {
+            uint64_t bytesWritten = DoWriteData(hHttpRequest, sourceBuffer, bytesRead);
+            success = bytesWritten > 0;
+
+            auto& sentHandler = request.GetDataSentEventHandler();
+            if (sentHandler)
+            {
+                sentHandler(&request, (long long)bytesWritten);
+            }
+
+            success = success && IsRequestProcessingEnabled();
+        }
+    }
+    else if(payloadStream)
     {
         auto startingPos = payloadStream->tellg();
 
@@ -167,7 +186,7 @@ void WinSyncHttpClient::LogRequestInternalFailure() const
 
 }
 
-std::shared_ptr<HttpResponse> WinSyncHttpClient::BuildSuccessResponse(const Aws::Http::HttpRequest& request, void* hHttpRequest, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter) const
+std::shared_ptr<HttpResponse> WinSyncHttpClient::BuildSuccessResponse(Aws::Http::HttpRequest& request, void* hHttpRequest, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter) const
 {
     auto response = Aws::MakeShared<StandardHttpResponse>(GetLogTag(), request);
     Aws::StringStream ss;
@@ -208,10 +227,35 @@ std::shared_ptr<HttpResponse> WinSyncHttpClient::BuildSuccessResponse(const Aws:
         uint64_t bodySize = sizeof(body);
         read = 0;
         bool success = true;
+        bool sinkAccepted = true;
 
-        while (DoReadData(hHttpRequest, body, bodySize, read) && read > 0 && success)
+        //successful responses go to the caller's sink when there is one; errors still go to the body stream to be parsed.
+        ResponseBodySink* bodySink = request.GetResponseBodySink().get();
+        int responseCode = static_cast<int>(response->GetResponseCode());
+        if (bodySink && (responseCode < 200 || responseCode > 299))
         {
-            response->GetResponseBody().write(body, read);
+            bodySink = nullptr;
+        }
+
+        if (bodySink)
+        {
+            int64_t contentLength = response->HasHeader(CONTENT_LENGTH_HEADER) ?
+                static_cast<int64_t>(StringUtils::ConvertToInt64(response->GetHeader(CONTENT_LENGTH_HEADER).c_str())) : -1;
+            sinkAccepted = bodySink->Begin(contentLength);
+            success = sinkAccepted;
+        }
+
+        while (success && DoReadData(hHttpRequest, body, bodySize, read) && read > 0)
+        {
+            if (bodySink)
+            {
+                sinkAccepted = bodySink->Write(reinterpret_cast<const unsigned char*>(body), static_cast<std::size_t>(read));
+                success = sinkAccepted;
+            }
+            else
+            {
+                response->GetResponseBody().write(body, read);
+            }
             if (read > 0)
             {
                 if (readLimiter != nullptr)
@@ -230,6 +274,11 @@ std::shared_ptr<HttpResponse> WinSyncHttpClient::BuildSuccessResponse(const Aws:
 
         if(!success)
         {
+            if (!sinkAccepted)
+            {
+                AWS_LOGSTREAM_ERROR(GetLogTag(), "Response body sink refused the body, aborting transfer.");
+                request.SetTransferFailure(HttpTransferFailure::RESPONSE_BODY_REFUSED);
+            }
             return nullptr;
         }
     }
@@ -22,7 +22,9 @@
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/StringUtils.h>
 
+#include <chrono>
 #include <sstream>
+#include <thread>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Logging;
@@ -34,6 +36,12 @@ static const char* SECURITY_CREDENTIALS_RESOURCE = "/latest/meta-data/iam/securi
 
 static const char* logTag = "EC2MetadataClient";
 
+//the service answers from the host in well under a millisecond; anything slower is a dropped packet or no service at all.
+static const long METADATA_CONNECT_TIMEOUT_MS = 1000;
+static const long METADATA_REQUEST_TIMEOUT_MS = 1000;
+static const unsigned METADATA_MAX_ATTEMPTS = 3;
+static const long METADATA_RETRY_BASE_DELAY_MS = 100;
+
 EC2MetadataClient::EC2MetadataClient(const char* endpoint, std::shared_ptr<HttpClientFactory const> httpClientFactory) :
     m_httpClient(nullptr),
     m_httpClientFactory((httpClientFactory != nullptr) ? httpClientFactory : Aws::MakeShared<Http::HttpClientFactory>(logTag)),
@@ -43,6 +51,8 @@ EC2MetadataClient::EC2MetadataClient(const char* endpoint, std::shared_ptr<HttpC
     ClientConfiguration clientConfiguration;
     clientConfiguration.maxConnections = 2;
     clientConfiguration.scheme = Scheme::HTTP;
+    clientConfiguration.connectTimeoutMs = METADATA_CONNECT_TIMEOUT_MS;
+    clientConfiguration.requestTimeoutMs = METADATA_REQUEST_TIMEOUT_MS;
 
     m_httpClient = m_httpClientFactory->CreateHttpClient(clientConfiguration);
 }
@@ -51,9 +61,86 @@ EC2MetadataClient::~EC2MetadataClient()
 {
 }
 
+static bool IsRetryableResponse(const HttpRequest& request, const std::shared_ptr<HttpResponse>& response)
+{
+    //a refused connection means nothing is listening, and asking again only makes the caller wait longer. A timeout is more
+    //likely the dropped packet the short timeouts are there to catch, which the next attempt can get past.
+    if (response == nullptr)
+    {
+        return request.GetTransferFailure() != HttpTransferFailure::CONNECT_FAILED;
+    }
+
+    HttpResponseCode responseCode = response->GetResponseCode();
+    return responseCode == HttpResponseCode::TOO_MANY_REQUESTS || static_cast<int>(responseCode) >= 500;
+}
+
+static Aws::String FetchResource(const HttpClient& httpClient, const HttpClientFactory& httpClientFactory, const Aws::String& uri,
+                                 HttpResponseCode& responseCode)
+{
+    responseCode = HttpResponseCode::REQUEST_NOT_MADE;
+    for (unsigned attempt = 0; attempt < METADATA_MAX_ATTEMPTS; ++attempt)
+    {
+        if (attempt > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(METADATA_RETRY_BASE_DELAY_MS << (attempt - 1)));
+            AWS_LOG_DEBUG(logTag, "Retrying call to Ec2MetadataService, attempt %u", attempt + 1);
+        }
+
+        std::shared_ptr<HttpRequest> request(httpClientFactory.CreateHttpRequest(uri, HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
+        std::shared_ptr<HttpResponse> response(httpClient.MakeRequest(*request));
+
+        if (response == nullptr)
+        {
+            AWS_LOG_ERROR(logTag, "Http request to Ec2MetadataService failed.");
+        }
+        else
+        {
+            responseCode = response->GetResponseCode();
+            if (responseCode == HttpResponseCode::OK)
+            {
+                Aws::IStreamBufIterator eos;
+                return Aws::String(Aws::IStreamBufIterator(response->GetResponseBody()), eos);
+            }
+
+            AWS_LOG_ERROR(logTag, "Http request failed with error code %d", (int) responseCode);
+        }
+
+        if (!IsRetryableResponse(*request, response))
+        {
+            break;
+        }
+    }
+
+    return "";
+}
+
 Aws::String EC2MetadataClient::GetDefaultCredentials() const
 {
     AWS_LOG_TRACE(logTag, "Getting default credentials for ec2 instance");
+
+    Aws::String roleName;
+    {
+        std::lock_guard<std::mutex> locker(m_roleNameMutex);
+        roleName = m_roleName;
+    }
+
+    if (!roleName.empty())
+    {
+        Aws::StringStream ss;
+        ss << m_endpoint << SECURITY_CREDENTIALS_RESOURCE << roleName;
+        HttpResponseCode responseCode;
+        Aws::String credentials = FetchResource(*m_httpClient, *m_httpClientFactory, ss.str(), responseCode);
+        if (!credentials.empty() || responseCode != HttpResponseCode::NOT_FOUND)
+        {
+            return credentials;
+        }
+
+        //the role attached to the instance was changed; look it up again.
+        AWS_LOG_INFO(logTag, "Cached instance role %s no longer exists.", roleName.c_str());
+        std::lock_guard<std::mutex> locker(m_roleNameMutex);
+        m_roleName.clear();
+    }
+
     Aws::String credentialsString = GetResource(SECURITY_CREDENTIALS_RESOURCE);
 
     if (!credentialsString.empty())
@@ -68,6 +155,11 @@ Aws::String EC2MetadataClient::GetDefaultCredentials() const
             return "";
         }
 
+        {
+            std::lock_guard<std::mutex> locker(m_roleNameMutex);
+            m_roleName = securityCredentials[0];
+        }
+
         Aws::StringStream ss;
         ss << SECURITY_CREDENTIALS_RESOURCE << securityCredentials[0];
         AWS_LOG_DEBUG(logTag, "Calling EC2MetatadaService resource %s", ss.str().c_str());
@@ -83,22 +175,6 @@ Aws::String EC2MetadataClient::GetResource(const char* resource) const
     ss << m_endpoint << resource;
     AWS_LOG_TRACE(logTag, "Calling Ec2MetadataService at %s", ss.str().c_str());
 
-    std::shared_ptr<HttpRequest> request(m_httpClientFactory->CreateHttpRequest(ss.str(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
-    std::shared_ptr<HttpResponse> response(m_httpClient->MakeRequest(*request));
-
-    if (response == nullptr)
-    {
-        AWS_LOG_ERROR(logTag, "Http request to Ec2MetadataService failed.");
-    }
-    else if (response->GetResponseCode() != HttpResponseCode::OK)
-    {
-        AWS_LOG_ERROR(logTag, "Http request failed with error code %d", (int) response->GetResponseCode());
-    }
-    else
-    {
-        Aws::IStreamBufIterator eos;
-        return Aws::String(Aws::IStreamBufIterator(response->GetResponseBody()), eos);
-    }
-
-    return "";
+    HttpResponseCode responseCode;
+    return FetchResource(*m_httpClient, *m_httpClientFactory, ss.str(), responseCode);
 }
@@ -15,61 +15,68 @@
 
 #include <aws/core/utils/DateTime.h>
 
+#include <chrono>
 #include <ctime>
 
-#ifdef _WIN32
-    //gmtime and localtime are admittedly giant pains in the lower-back. However, we maintain thread safety here and also do buffer checks.
-    //this is the best and most platform independent way we've found to do this. 
-    #pragma warning( disable : 4996)
-#endif
-
 static const char* ISO_8601_LONG_DATE_FORMAT_STR = "%Y-%m-%dT%H:%M:%SZ";
 static const char* ISO_8601_SIMPLE_DATE_FORMAT_STR = "%Y-%m-%d";
 
 using namespace Aws::Utils;
 
-std::mutex DateTime::timeMutex;
+//the reentrant conversions write into the caller's tm instead of a shared static one, so concurrent callers (the signer, every log line)
+//never wait on each other.
+static bool ConvertToLocalTime(std::time_t time, struct tm& timestamp)
+{
+#ifdef _WIN32
+    return localtime_s(&timestamp, &time) == 0;
+#else
+    return localtime_r(&time, &timestamp) != nullptr;
+#endif
+}
 
-Aws::String DateTime::CalculateLocalTimestampAsString(const char* formatStr)
+static bool ConvertToGmtTime(std::time_t time, struct tm& timestamp)
+{
+#ifdef _WIN32
+    return gmtime_s(&timestamp, &time) == 0;
+#else
+    return gmtime_r(&time, &timestamp) != nullptr;
+#endif
+}
+
+static Aws::String FormatTimestamp(const struct tm& timestamp, const char* formatStr)
 {
-    std::lock_guard<std::mutex> locker(timeMutex);
-    std::time_t time = std::time(nullptr);
-    struct tm* timestamp = std::localtime(&time);
+    char formatedString[100];
+    std::size_t length = std::strftime(formatedString, sizeof(formatedString), formatStr, &timestamp);
 
-    if (timestamp)
-    {
-        char formatedString[100];
-        std::strftime(formatedString, sizeof(formatedString), formatStr, timestamp);
+    return Aws::String(formatedString, length);
+}
 
-        return formatedString;
+Aws::String DateTime::CalculateLocalTimestampAsString(const char* formatStr)
+{
+    struct tm timestamp;
+    if (ConvertToLocalTime(std::time(nullptr), timestamp))
+    {
+        return FormatTimestamp(timestamp, formatStr);
     }
     return "";
 }
 
 Aws::String DateTime::CalculateGmtTimestampAsString(const char* formatStr)
 {
-    std::lock_guard<std::mutex> locker(timeMutex);
-    std::time_t time = std::time(nullptr);
-    struct tm* timestamp = std::gmtime(&time);
-
-    if(timestamp)
+    struct tm timestamp;
+    if (ConvertToGmtTime(std::time(nullptr), timestamp))
     {
-        char formatedString[100];
-        std::strftime(formatedString, sizeof(formatedString), formatStr, timestamp);
-
-        return formatedString;
+        return FormatTimestamp(timestamp, formatStr);
     }
     return "";
 }
 
 int DateTime::CalculateCurrentHour()
 {
-    std::lock_guard<std::mutex> locker(timeMutex);
-    std::time_t time = std::time(nullptr);
-    struct tm* timestamp = std::localtime(&time);
-    if (timestamp)
+    struct tm timestamp;
+    if (ConvertToLocalTime(std::time(nullptr), timestamp))
     {
-        return timestamp->tm_hour;
+        return timestamp.tm_hour;
     }
 
     return -1;
@@ -81,6 +88,73 @@ double DateTime::ComputeCurrentTimestampInAmazonFormat()
     return now.count();
 }
 
+//days between 1970-01-01 and the given proleptic gregorian date; timegm is not portable and mktime works in local time.
+static long long DaysSinceEpoch(int year, unsigned month, unsigned day)
+{
+    year -= month <= 2 ? 1 : 0;
+    int era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+    unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return static_cast<long long>(era) * 146097 + static_cast<long long>(dayOfEra) - 719468;
+}
+
+//reads exactly digits decimal digits followed by separator (0 for none) and advances position past both.
+static bool ReadField(const char*& position, int digits, char separator, int& value)
+{
+    value = 0;
+    for (int i = 0; i < digits; ++i, ++position)
+    {
+        if (*position < '0' || *position > '9')
+        {
+            return false;
+        }
+        value = value * 10 + (*position - '0');
+    }
+
+    if (separator != 0)
+    {
+        if (*position != separator)
+        {
+            return false;
+        }
+        ++position;
+    }
+
+    return true;
+}
+
+double DateTime::ConvertISO8601ToAmazonFormat(const char* timestamp)
+{
+    int year, month, day, hour, minute, second;
+    const char* position = timestamp;
+    if (position == nullptr ||
+        !ReadField(position, 4, '-', year) || !ReadField(position, 2, '-', month) || !ReadField(position, 2, 'T', day) ||
+        !ReadField(position, 2, ':', hour) || !ReadField(position, 2, ':', minute) || !ReadField(position, 2, 0, second) ||
+        month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60)
+    {
+        return 0.0;
+    }
+
+    double fraction = 0.0;
+    if (*position == '.')
+    {
+        double scale = 0.1;
+        for (++position; *position >= '0' && *position <= '9'; ++position, scale /= 10)
+        {
+            fraction += (*position - '0') * scale;
+        }
+    }
+
+    if (*position != 'Z')
+    {
+        return 0.0;
+    }
+
+    long long days = DaysSinceEpoch(year, static_cast<unsigned>(month), static_cast<unsigned>(day));
+    return static_cast<double>(days * 86400 + hour * 3600 + minute * 60 + second) + fraction;
+}
+
 Aws::String DateTime::ComputeCurrentTimestampInISO8601Format()
 {
     return CalculateGmtTimestampAsString(ISO_8601_LONG_DATE_FORMAT_STR);
@@ -15,6 +15,8 @@
 
 
 #include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/crypto/MultiHash.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 #if ENABLE_BCRYPT_ENCRYPTION
     #include <aws/core/utils/crypto/bcrypt/CryptoImpl.h>
@@ -101,3 +103,23 @@ std::shared_ptr<HMAC> Aws::Utils::Crypto::CreateSha256HMACImplementation()
     return nullptr;
 #endif
 }
+
+std::shared_ptr<MultiHashDigests> Aws::Utils::Crypto::CreateMultiHashDigestsImplementation(bool md5, bool sha256)
+{
+    if((md5 && s_MD5Factory) || (sha256 && s_Sha256Factory))
+    {
+        return nullptr;
+    }
+
+#if ENABLE_BCRYPT_ENCRYPTION
+    return Aws::MakeShared<MultiHashDigestsBcryptImpl>(s_allocationTag, md5, sha256);
+#elif ENABLE_OPENSSL_ENCRYPTION
+    return Aws::MakeShared<MultiHashDigestsOpenSSLImpl>(s_allocationTag, md5, sha256);
+#elif ENABLE_COMMONCRYPTO_ENCRYPTION
+    return Aws::MakeShared<MultiHashDigestsCommonCryptoImpl>(s_allocationTag, md5, sha256);
+#else
+    AWS_UNREFERENCED_PARAM(md5);
+    AWS_UNREFERENCED_PARAM(sha256);
+    return nullptr;
+#endif
+}
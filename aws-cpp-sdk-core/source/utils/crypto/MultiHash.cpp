@@ -0,0 +1,170 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/MultiHash.h>
+
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/CRC.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <algorithm>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+//crypto libraries take 32 bit lengths on some platforms, so large buffers are handed over in pieces.
+static const std::size_t MAX_UPDATE_LENGTH = 1 << 30;
+
+MultiHash::MultiHash(unsigned algorithms) :
+    m_algorithms(algorithms),
+    m_finished(false),
+    m_crc32(0),
+    m_crc32c(0)
+{
+    bool md5 = (m_algorithms & MD5_ALGORITHM) != 0;
+    bool sha256 = (m_algorithms & SHA256_ALGORITHM) != 0;
+    if (md5 || sha256)
+    {
+        m_digests = CreateMultiHashDigestsImplementation(md5, sha256);
+    }
+}
+
+MultiHash::~MultiHash()
+{
+}
+
+bool MultiHash::IsValid() const
+{
+    return m_digests || (m_algorithms & (MD5_ALGORITHM | SHA256_ALGORITHM)) == 0;
+}
+
+void MultiHash::Update(const unsigned char* data, std::size_t length)
+{
+    if (m_finished)
+    {
+        return;
+    }
+
+    if (m_algorithms & CRC32_ALGORITHM)
+    {
+        m_crc32 = CRC32(data, length, m_crc32);
+    }
+
+    if (m_algorithms & CRC32C_ALGORITHM)
+    {
+        m_crc32c = CRC32C(data, length, m_crc32c);
+    }
+
+    if (m_digests)
+    {
+        while (length > 0)
+        {
+            std::size_t amount = (std::min)(length, MAX_UPDATE_LENGTH);
+            m_digests->Update(data, amount);
+            data += amount;
+            length -= amount;
+        }
+    }
+}
+
+void MultiHash::Finish()
+{
+    if (m_finished)
+    {
+        return;
+    }
+
+    m_finished = true;
+    if (m_digests)
+    {
+        m_digests->Finish(m_md5, m_sha256);
+    }
+}
+
+bool MultiHash::Calculate(Aws::IStream& stream)
+{
+    auto startingPos = stream.tellg();
+    stream.seekg(0, stream.beg);
+
+    char streamBuffer[Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
+    while (stream.good())
+    {
+        stream.read(streamBuffer, Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
+        auto bytesRead = stream.gcount();
+        if (bytesRead > 0)
+        {
+            Update(reinterpret_cast<unsigned char*>(streamBuffer), static_cast<std::size_t>(bytesRead));
+        }
+    }
+
+    bool success = stream.eof();
+    stream.clear();
+    stream.seekg(startingPos, stream.beg);
+
+    Finish();
+    return success;
+}
+
+HashResult MultiHash::GetMD5() const
+{
+    if (!m_finished || m_md5.GetLength() == 0)
+    {
+        return HashResult();
+    }
+
+    return HashResult(m_md5);
+}
+
+HashResult MultiHash::GetSha256() const
+{
+    if (!m_finished || m_sha256.GetLength() == 0)
+    {
+        return HashResult();
+    }
+
+    return HashResult(m_sha256);
+}
+
+static HashResult ToBigEndian(uint32_t crc)
+{
+    ByteBuffer result(4);
+    result[0] = static_cast<unsigned char>(crc >> 24);
+    result[1] = static_cast<unsigned char>(crc >> 16);
+    result[2] = static_cast<unsigned char>(crc >> 8);
+    result[3] = static_cast<unsigned char>(crc);
+    return HashResult(std::move(result));
+}
+
+HashResult MultiHash::GetCRC32() const
+{
+    if (!m_finished || (m_algorithms & CRC32_ALGORITHM) == 0)
+    {
+        return HashResult();
+    }
+
+    return ToBigEndian(m_crc32);
+}
+
+HashResult MultiHash::GetCRC32C() const
+{
+    if (!m_finished || (m_algorithms & CRC32C_ALGORITHM) == 0)
+    {
+        return HashResult();
+    }
+
+    return ToBigEndian(m_crc32c);
+}
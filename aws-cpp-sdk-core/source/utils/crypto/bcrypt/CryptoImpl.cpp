@@ -301,6 +301,113 @@ HashResult Sha256HMACBcryptImpl::Calculate(const ByteBuffer& toSign, const ByteB
     return m_impl.Calculate(toSign, secret); 
 }
 
+MultiHashDigestsBcryptImpl::MultiHashDigestsBcryptImpl(bool md5, bool sha256)
+{
+    if (md5)
+    {
+        Open(m_md5, BCRYPT_MD5_ALGORITHM);
+    }
+
+    if (sha256)
+    {
+        Open(m_sha256, BCRYPT_SHA256_ALGORITHM);
+    }
+}
+
+MultiHashDigestsBcryptImpl::~MultiHashDigestsBcryptImpl()
+{
+    Close(m_md5);
+    Close(m_sha256);
+}
+
+void MultiHashDigestsBcryptImpl::Open(Digest& digest, LPCWSTR algorithmName)
+{
+    NTSTATUS status = BCryptOpenAlgorithmProvider(&digest.m_algorithmHandle, algorithmName, MS_PRIMITIVE_PROVIDER, 0);
+    if (!NT_SUCCESS(status))
+    {
+        AWS_LOGSTREAM_ERROR(logTag, "Failed initializing BCryptOpenAlgorithmProvider for " << algorithmName);
+        return;
+    }
+
+    DWORD resultLength = 0;
+    status = BCryptGetProperty(digest.m_algorithmHandle, BCRYPT_HASH_LENGTH, (PBYTE)&digest.m_hashLength, sizeof(digest.m_hashLength), &resultLength, 0);
+    if (!NT_SUCCESS(status) || digest.m_hashLength <= 0)
+    {
+        AWS_LOG_ERROR(logTag, "Error computing hash buffer length.");
+        return;
+    }
+
+    DWORD hashObjectLength = 0;
+    resultLength = 0;
+    status = BCryptGetProperty(digest.m_algorithmHandle, BCRYPT_OBJECT_LENGTH, (PBYTE)&hashObjectLength, sizeof(hashObjectLength), &resultLength, 0);
+    if (!NT_SUCCESS(status) || hashObjectLength <= 0)
+    {
+        AWS_LOG_ERROR(logTag, "Error computing hash object length.");
+        return;
+    }
+
+    digest.m_hashObject = Aws::NewArray<BYTE>(hashObjectLength, logTag);
+    status = BCryptCreateHash(digest.m_algorithmHandle, &digest.m_hashHandle, digest.m_hashObject, hashObjectLength, nullptr, 0, 0);
+    if (!NT_SUCCESS(status))
+    {
+        AWS_LOG_ERROR(logTag, "Error creating hash handle.");
+        return;
+    }
+
+    digest.m_isValid = true;
+}
+
+void MultiHashDigestsBcryptImpl::Close(Digest& digest)
+{
+    if (digest.m_hashHandle)
+    {
+        BCryptDestroyHash(digest.m_hashHandle);
+    }
+
+    Aws::DeleteArray(digest.m_hashObject);
+
+    if (digest.m_algorithmHandle)
+    {
+        BCryptCloseAlgorithmProvider(digest.m_algorithmHandle, 0);
+    }
+}
+
+void MultiHashDigestsBcryptImpl::Update(const unsigned char* data, std::size_t length)
+{
+    Digest* digests[] = { &m_md5, &m_sha256 };
+    for (Digest* digest : digests)
+    {
+        if (digest->m_isValid && !NT_SUCCESS(BCryptHashData(digest->m_hashHandle, (PBYTE)data, static_cast<ULONG>(length), 0)))
+        {
+            AWS_LOG_ERROR(logTag, "Error computing hash.");
+            digest->m_isValid = false;
+        }
+    }
+}
+
+void MultiHashDigestsBcryptImpl::Finish(Digest& digest, ByteBuffer& result)
+{
+    if (!digest.m_isValid)
+    {
+        return;
+    }
+
+    ByteBuffer hash(digest.m_hashLength);
+    if (!NT_SUCCESS(BCryptFinishHash(digest.m_hashHandle, hash.GetUnderlyingData(), digest.m_hashLength, 0)))
+    {
+        AWS_LOG_ERROR(logTag, "Error obtaining computed hash");
+        return;
+    }
+
+    result = std::move(hash);
+}
+
+void MultiHashDigestsBcryptImpl::Finish(ByteBuffer& md5, ByteBuffer& sha256)
+{
+    Finish(m_md5, md5);
+    Finish(m_sha256, sha256);
+}
+
 
 } // namespace Crypto
 } // namespace Utils
@@ -15,6 +15,7 @@
 
 #include <aws/core/utils/crypto/commoncrypto/CryptoImpl.h>
 #include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <CommonCrypto/CommonDigest.h>
 #include <CommonCrypto/CommonHMAC.h>
 #include <CommonCrypto/CommonCrypto.h>
@@ -23,6 +24,8 @@
 using namespace Aws::Utils;
 using namespace Aws::Utils::Crypto;
 
+static const char* COMMON_CRYPTO_MULTI_HASH_TAG = "MultiHashDigestsCommonCryptoImpl";
+
 HashResult MD5CommonCryptoImpl::Calculate(const Aws::String& str)
 {
     ByteBuffer hash(CC_MD5_DIGEST_LENGTH);
@@ -107,3 +110,58 @@ HashResult Sha256HMACCommonCryptoImpl::Calculate(const ByteBuffer& toSign, const
 
     return HashResult(std::move(digest));
 }
+
+MultiHashDigestsCommonCryptoImpl::MultiHashDigestsCommonCryptoImpl(bool md5, bool sha256) :
+    m_md5Context(nullptr),
+    m_sha256Context(nullptr)
+{
+    if(md5)
+    {
+        CC_MD5_CTX* md5Context = Aws::New<CC_MD5_CTX>(COMMON_CRYPTO_MULTI_HASH_TAG);
+        CC_MD5_Init(md5Context);
+        m_md5Context = md5Context;
+    }
+
+    if(sha256)
+    {
+        CC_SHA256_CTX* sha256Context = Aws::New<CC_SHA256_CTX>(COMMON_CRYPTO_MULTI_HASH_TAG);
+        CC_SHA256_Init(sha256Context);
+        m_sha256Context = sha256Context;
+    }
+}
+
+MultiHashDigestsCommonCryptoImpl::~MultiHashDigestsCommonCryptoImpl()
+{
+    Aws::Delete(static_cast<CC_MD5_CTX*>(m_md5Context));
+    Aws::Delete(static_cast<CC_SHA256_CTX*>(m_sha256Context));
+}
+
+void MultiHashDigestsCommonCryptoImpl::Update(const unsigned char* data, std::size_t length)
+{
+    if(m_md5Context)
+    {
+        CC_MD5_Update(static_cast<CC_MD5_CTX*>(m_md5Context), data, static_cast<CC_LONG>(length));
+    }
+
+    if(m_sha256Context)
+    {
+        CC_SHA256_Update(static_cast<CC_SHA256_CTX*>(m_sha256Context), data, static_cast<CC_LONG>(length));
+    }
+}
+
+void MultiHashDigestsCommonCryptoImpl::Finish(ByteBuffer& md5, ByteBuffer& sha256)
+{
+    if(m_md5Context)
+    {
+        ByteBuffer hash(CC_MD5_DIGEST_LENGTH);
+        CC_MD5_Final(hash.GetUnderlyingData(), static_cast<CC_MD5_CTX*>(m_md5Context));
+        md5 = std::move(hash);
+    }
+
+    if(m_sha256Context)
+    {
+        ByteBuffer hash(CC_SHA256_DIGEST_LENGTH);
+        CC_SHA256_Final(hash.GetUnderlyingData(), static_cast<CC_SHA256_CTX*>(m_sha256Context));
+        sha256 = std::move(hash);
+    }
+}
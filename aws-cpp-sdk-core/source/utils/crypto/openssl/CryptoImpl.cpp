@@ -17,108 +17,240 @@
 
 #include <aws/core/utils/crypto/openssl/CryptoImpl.h>
 #include <aws/core/utils/Outcome.h>
-#include <openssl/md5.h>
-#include <openssl/sha.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <openssl/evp.h>
 #include <openssl/hmac.h>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Crypto;
 
-HashResult MD5OpenSSLImpl::Calculate(const Aws::String& str)
+//everything goes through the EVP interface, where OpenSSL picks the fastest kernel the cpu supports (SHA extensions, AVX2, ...)
+//at runtime; the low level MD5_*/SHA256_* calls are deprecated and bypass engines.
+//Each hash object keeps one EVP_MD_CTX for its lifetime and re-initializes it per digest. The objects are borrowed from pools
+//(HashContextPool) one caller at a time, so the contexts are reused across calls instead of being allocated for every digest.
+static HashResult DigestString(EVP_MD_CTX* context, const EVP_MD* algorithm, const Aws::String& str)
 {
-    MD5_CTX md5;
-    MD5_Init(&md5);
-    MD5_Update(&md5, str.c_str(), str.size());
- 
-    ByteBuffer hash(MD5_DIGEST_LENGTH);
-    MD5_Final(hash.GetUnderlyingData(), &md5);
+    ByteBuffer hash(EVP_MD_size(algorithm));
+    unsigned int length = 0;
+    if(!context || !EVP_DigestInit_ex(context, algorithm, nullptr) || !EVP_DigestUpdate(context, str.c_str(), str.size()) ||
+        !EVP_DigestFinal_ex(context, hash.GetUnderlyingData(), &length))
+    {
+        return HashResult();
+    }
 
     return HashResult(std::move(hash));
 }
 
-HashResult MD5OpenSSLImpl::Calculate(Aws::IStream& stream)
+static HashResult DigestStream(EVP_MD_CTX* context, const EVP_MD* algorithm, Aws::IStream& stream)
 {
-    MD5_CTX md5;
-    MD5_Init(&md5);
+    if(!context || !EVP_DigestInit_ex(context, algorithm, nullptr))
+    {
+        return HashResult();
+    }
 
-    unsigned currentPos = stream.tellg();
+    auto currentPos = stream.tellg();
     stream.seekg(0, stream.beg);
 
+    bool success = true;
     char streamBuffer[Aws::Utils::Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
-    while(stream.good())
+    while(success && stream.good())
     {
-	    stream.read(streamBuffer, Aws::Utils::Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
-	    auto bytesRead = stream.gcount();
+        stream.read(streamBuffer, Aws::Utils::Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
+        auto bytesRead = stream.gcount();
 
-	    if(bytesRead > 0)
-	    {
-	        MD5_Update(&md5, streamBuffer, bytesRead);
-	    }
+        if(bytesRead > 0)
+        {
+            success = EVP_DigestUpdate(context, streamBuffer, static_cast<std::size_t>(bytesRead)) != 0;
+        }
     }
 
     stream.clear();
     stream.seekg(currentPos, stream.beg);
 
-    ByteBuffer hash(MD5_DIGEST_LENGTH);
-    MD5_Final(hash.GetUnderlyingData(), &md5);
+    ByteBuffer hash(EVP_MD_size(algorithm));
+    unsigned int length = 0;
+    success = success && EVP_DigestFinal_ex(context, hash.GetUnderlyingData(), &length);
+
+    if(!success)
+    {
+        return HashResult();
+    }
 
     return HashResult(std::move(hash));
 }
 
-HashResult Sha256OpenSSLImpl::Calculate(const Aws::String& str)
+MD5OpenSSLImpl::MD5OpenSSLImpl() :
+    m_context(EVP_MD_CTX_create())
 {
-    SHA256_CTX sha256;
-    SHA256_Init(&sha256);
-    SHA256_Update(&sha256, str.c_str(), str.size());
+}
 
-    ByteBuffer hash(SHA256_DIGEST_LENGTH);
-    SHA256_Final(hash.GetUnderlyingData(), &sha256);
+MD5OpenSSLImpl::~MD5OpenSSLImpl()
+{
+    if(m_context)
+    {
+        EVP_MD_CTX_destroy(static_cast<EVP_MD_CTX*>(m_context));
+    }
+}
 
-    return HashResult(std::move(hash));
+HashResult MD5OpenSSLImpl::Calculate(const Aws::String& str)
+{
+    return DigestString(static_cast<EVP_MD_CTX*>(m_context), EVP_md5(), str);
 }
 
-HashResult Sha256OpenSSLImpl::Calculate(Aws::IStream& stream)
+HashResult MD5OpenSSLImpl::Calculate(Aws::IStream& stream)
 {
-    SHA256_CTX sha256;
-    SHA256_Init(&sha256);
+    return DigestStream(static_cast<EVP_MD_CTX*>(m_context), EVP_md5(), stream);
+}
 
-    unsigned currentPos = stream.tellg();
-    stream.seekg(0, stream.beg);
+Sha256OpenSSLImpl::Sha256OpenSSLImpl() :
+    m_context(EVP_MD_CTX_create())
+{
+}
 
-    char streamBuffer[Aws::Utils::Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
-    while(stream.good())
+Sha256OpenSSLImpl::~Sha256OpenSSLImpl()
+{
+    if(m_context)
     {
-	    stream.read(streamBuffer, Aws::Utils::Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
-	    auto bytesRead = stream.gcount();
-
-	    if(bytesRead > 0)
-	    {
-	        SHA256_Update(&sha256, streamBuffer, bytesRead);
-	    }
+        EVP_MD_CTX_destroy(static_cast<EVP_MD_CTX*>(m_context));
     }
+}
 
-    stream.clear();
-    stream.seekg(currentPos, stream.beg);
+HashResult Sha256OpenSSLImpl::Calculate(const Aws::String& str)
+{
+    return DigestString(static_cast<EVP_MD_CTX*>(m_context), EVP_sha256(), str);
+}
 
-    ByteBuffer hash(SHA256_DIGEST_LENGTH);
-    SHA256_Final(hash.GetUnderlyingData(), &sha256);
+HashResult Sha256OpenSSLImpl::Calculate(Aws::IStream& stream)
+{
+    return DigestStream(static_cast<EVP_MD_CTX*>(m_context), EVP_sha256(), stream);
+}
 
-    return HashResult(std::move(hash));
+//HMAC_CTX became opaque in openssl 1.1, which added HMAC_CTX_new/free/reset in place of embedding it and HMAC_CTX_init/cleanup.
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+static HMAC_CTX* CreateHMACContext()
+{
+    return HMAC_CTX_new();
+}
+
+static void DestroyHMACContext(HMAC_CTX* context)
+{
+    HMAC_CTX_free(context);
+}
+#else
+static HMAC_CTX* CreateHMACContext()
+{
+    HMAC_CTX* context = Aws::New<HMAC_CTX>("Sha256HMACOpenSSLImpl");
+    HMAC_CTX_init(context);
+    return context;
+}
+
+static void DestroyHMACContext(HMAC_CTX* context)
+{
+    HMAC_CTX_cleanup(context);
+    Aws::Delete(context);
+}
+#endif
+
+Sha256HMACOpenSSLImpl::Sha256HMACOpenSSLImpl() :
+    m_context(CreateHMACContext())
+{
+}
+
+Sha256HMACOpenSSLImpl::~Sha256HMACOpenSSLImpl()
+{
+    if(m_context)
+    {
+        DestroyHMACContext(static_cast<HMAC_CTX*>(m_context));
+    }
 }
 
 HashResult Sha256HMACOpenSSLImpl::Calculate(const ByteBuffer& toSign, const ByteBuffer& secret)
 {
-    unsigned int length = SHA256_DIGEST_LENGTH;
+    unsigned int length = EVP_MD_size(EVP_sha256());
     ByteBuffer digest(length);
     memset(digest.GetUnderlyingData(), 0, length);
 
-    HMAC_CTX ctx;
-    HMAC_CTX_init(&ctx);
-
-    HMAC_Init_ex(&ctx, secret.GetUnderlyingData(), secret.GetLength(), EVP_sha256(), NULL);
-    HMAC_Update(&ctx, toSign.GetUnderlyingData(), toSign.GetLength());
-    HMAC_Final(&ctx, digest.GetUnderlyingData(), &length);
-    HMAC_CTX_cleanup(&ctx);
+    //passing the digest again makes HMAC_Init_ex start over with the new key on the same context.
+    HMAC_CTX* context = static_cast<HMAC_CTX*>(m_context);
+    if(!context || !HMAC_Init_ex(context, secret.GetUnderlyingData(), static_cast<int>(secret.GetLength()), EVP_sha256(), nullptr) ||
+        !HMAC_Update(context, toSign.GetUnderlyingData(), toSign.GetLength()) || !HMAC_Final(context, digest.GetUnderlyingData(), &length))
+    {
+        return HashResult();
+    }
 
     return HashResult(std::move(digest));
 }
+
+MultiHashDigestsOpenSSLImpl::MultiHashDigestsOpenSSLImpl(bool md5, bool sha256) :
+    m_md5Context(nullptr),
+    m_sha256Context(nullptr)
+{
+    if(md5)
+    {
+        EVP_MD_CTX* md5Context = EVP_MD_CTX_create();
+        if(md5Context && !EVP_DigestInit_ex(md5Context, EVP_md5(), nullptr))
+        {
+            EVP_MD_CTX_destroy(md5Context);
+            md5Context = nullptr;
+        }
+        m_md5Context = md5Context;
+    }
+
+    if(sha256)
+    {
+        EVP_MD_CTX* sha256Context = EVP_MD_CTX_create();
+        if(sha256Context && !EVP_DigestInit_ex(sha256Context, EVP_sha256(), nullptr))
+        {
+            EVP_MD_CTX_destroy(sha256Context);
+            sha256Context = nullptr;
+        }
+        m_sha256Context = sha256Context;
+    }
+}
+
+MultiHashDigestsOpenSSLImpl::~MultiHashDigestsOpenSSLImpl()
+{
+    if(m_md5Context)
+    {
+        EVP_MD_CTX_destroy(static_cast<EVP_MD_CTX*>(m_md5Context));
+    }
+
+    if(m_sha256Context)
+    {
+        EVP_MD_CTX_destroy(static_cast<EVP_MD_CTX*>(m_sha256Context));
+    }
+}
+
+void MultiHashDigestsOpenSSLImpl::Update(const unsigned char* data, std::size_t length)
+{
+    if(m_md5Context)
+    {
+        EVP_DigestUpdate(static_cast<EVP_MD_CTX*>(m_md5Context), data, length);
+    }
+
+    if(m_sha256Context)
+    {
+        EVP_DigestUpdate(static_cast<EVP_MD_CTX*>(m_sha256Context), data, length);
+    }
+}
+
+static void FinishDigest(void* context, ByteBuffer& result)
+{
+    if(!context)
+    {
+        return;
+    }
+
+    unsigned char hash[EVP_MAX_MD_SIZE];
+    unsigned int length = 0;
+    if(EVP_DigestFinal_ex(static_cast<EVP_MD_CTX*>(context), hash, &length))
+    {
+        result = ByteBuffer(hash, length);
+    }
+}
+
+void MultiHashDigestsOpenSSLImpl::Finish(ByteBuffer& md5, ByteBuffer& sha256)
+{
+    FinishDigest(m_md5Context, md5);
+    FinishDigest(m_sha256Context, sha256);
+}
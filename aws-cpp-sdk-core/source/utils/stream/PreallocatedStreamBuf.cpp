@@ -0,0 +1,92 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <limits>
+
+using namespace Aws::Utils::Stream;
+
+static const char* PREALLOCATED_STREAM_TAG = "PreallocatedIOStream";
+
+PreallocatedStreamBuf::PreallocatedStreamBuf(unsigned char* buffer, std::size_t length) :
+    m_underlyingBuffer(buffer),
+    m_length(length)
+{
+    char* begin = reinterpret_cast<char*>(m_underlyingBuffer);
+    char* end = begin + m_length;
+    setg(begin, begin, end);
+    setp(begin, end);
+}
+
+PreallocatedStreamBuf::pos_type PreallocatedStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+        base = (which & std::ios_base::in) ? static_cast<off_type>(gptr() - eback()) : static_cast<off_type>(pptr() - pbase());
+    }
+    else if (dir == std::ios_base::end)
+    {
+        base = static_cast<off_type>(m_length);
+    }
+
+    return seekpos(pos_type(base + off), which);
+}
+
+PreallocatedStreamBuf::pos_type PreallocatedStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    off_type offset = static_cast<off_type>(pos);
+    if (offset < 0 || static_cast<std::size_t>(offset) > m_length)
+    {
+        return pos_type(off_type(-1));
+    }
+
+    char* begin = reinterpret_cast<char*>(m_underlyingBuffer);
+    char* end = begin + m_length;
+
+    if (which & std::ios_base::in)
+    {
+        setg(begin, begin + offset, end);
+    }
+
+    if (which & std::ios_base::out)
+    {
+        setp(begin, end);
+        //pbump only takes an int
+        while (offset > 0)
+        {
+            int step = offset > static_cast<off_type>((std::numeric_limits<int>::max)()) ? (std::numeric_limits<int>::max)() : static_cast<int>(offset);
+            pbump(step);
+            offset -= step;
+        }
+    }
+
+    return pos;
+}
+
+PreallocatedIOStream::PreallocatedIOStream(unsigned char* buffer, std::size_t length) :
+    Base(Aws::New<PreallocatedStreamBuf>(PREALLOCATED_STREAM_TAG, buffer, length))
+{
+}
+
+PreallocatedIOStream::~PreallocatedIOStream()
+{
+    if (rdbuf())
+    {
+        Aws::Delete(rdbuf());
+    }
+}
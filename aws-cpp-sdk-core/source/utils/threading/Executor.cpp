@@ -14,15 +14,369 @@
   */
 
 #include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/logging/LogMacros.h>
 
 
 #include <thread>
 
 using namespace Aws::Utils::Threading;
 
+static const char* POOLED_EXECUTOR_TAG = "PooledThreadExecutor";
+static const char* WORK_STEALING_EXECUTOR_TAG = "WorkStealingExecutor";
+
 bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
 {
     std::thread t(fx);
     t.detach();
     return true;
-}
\ No newline at end of file
+}
+
+struct PooledThreadExecutor::PoolState
+{
+    PoolState(std::size_t maxQueueSize, OverflowPolicy overflowPolicy) :
+        m_maxQueueSize(maxQueueSize),
+        m_overflowPolicy(overflowPolicy),
+        m_shuttingDown(false)
+    {}
+
+    Aws::Queue<std::function<void()>> m_tasks;
+    std::size_t m_maxQueueSize;
+    OverflowPolicy m_overflowPolicy;
+    bool m_shuttingDown;
+    std::mutex m_queueLock;
+    std::condition_variable m_taskAvailable;
+    std::condition_variable m_spaceAvailable;
+};
+
+PooledThreadExecutor::PooledThreadExecutor(std::size_t poolSize, std::size_t maxQueueSize, OverflowPolicy overflowPolicy) :
+    m_state(Aws::MakeShared<PoolState>(POOLED_EXECUTOR_TAG, maxQueueSize > 0 ? maxQueueSize : 1, overflowPolicy))
+{
+    std::size_t workerCount = poolSize > 0 ? poolSize : 1;
+    m_workers.reserve(workerCount);
+    m_workerIds.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&PooledThreadExecutor::WorkerLoop, m_state);
+        m_workerIds.push_back(m_workers.back().get_id());
+    }
+}
+
+PooledThreadExecutor::~PooledThreadExecutor()
+{
+    if (!IsWorkerThread())
+    {
+        Shutdown();
+        return;
+    }
+
+    //destroyed by one of its own tasks: nobody can wait for the pool, so let the threads drain the queue and exit by themselves.
+    StopAccepting();
+    for (auto& worker : m_workers)
+    {
+        worker.detach();
+    }
+}
+
+void PooledThreadExecutor::StopAccepting()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_state->m_queueLock);
+        m_state->m_shuttingDown = true;
+    }
+
+    m_state->m_taskAvailable.notify_all();
+    m_state->m_spaceAvailable.notify_all();
+}
+
+void PooledThreadExecutor::Shutdown()
+{
+    StopAccepting();
+    if (IsWorkerThread())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> locker(m_joinLock);
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+bool PooledThreadExecutor::IsWorkerThread() const
+{
+    auto currentThread = std::this_thread::get_id();
+    for (auto& workerId : m_workerIds)
+    {
+        if (workerId == currentThread)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fx)
+{
+    PoolState& state = *m_state;
+    std::unique_lock<std::mutex> locker(state.m_queueLock);
+    if (state.m_shuttingDown)
+    {
+        AWS_LOG_WARN(POOLED_EXECUTOR_TAG, "Task submitted after shutdown was rejected.");
+        return false;
+    }
+
+    if (state.m_tasks.size() >= state.m_maxQueueSize)
+    {
+        switch (state.m_overflowPolicy)
+        {
+            case OverflowPolicy::REJECT_IMMEDIATELY:
+                AWS_LOG_WARN(POOLED_EXECUTOR_TAG, "Task queue is full, rejecting task.");
+                return false;
+            case OverflowPolicy::RUN_IN_CALLER:
+                locker.unlock();
+                fx();
+                return true;
+            case OverflowPolicy::BLOCK:
+            default:
+                if (IsWorkerThread())
+                {
+                    locker.unlock();
+                    fx();
+                    return true;
+                }
+
+                state.m_spaceAvailable.wait(locker, [&state] { return state.m_shuttingDown || state.m_tasks.size() < state.m_maxQueueSize; });
+                if (state.m_shuttingDown)
+                {
+                    AWS_LOG_WARN(POOLED_EXECUTOR_TAG, "Executor shut down while waiting for room in the queue, rejecting task.");
+                    return false;
+                }
+                break;
+        }
+    }
+
+    state.m_tasks.push(std::move(fx));
+    locker.unlock();
+    state.m_taskAvailable.notify_one();
+    return true;
+}
+
+void PooledThreadExecutor::WorkerLoop(std::shared_ptr<PoolState> state)
+{
+    for (;;)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> locker(state->m_queueLock);
+            state->m_taskAvailable.wait(locker, [&state] { return state->m_shuttingDown || !state->m_tasks.empty(); });
+            if (state->m_tasks.empty())
+            {
+                return;
+            }
+
+            task = std::move(state->m_tasks.front());
+            state->m_tasks.pop();
+        }
+
+        state->m_spaceAvailable.notify_one();
+        task();
+    }
+}
+
+struct WorkStealingExecutor::PoolState
+{
+    struct WorkerQueue
+    {
+        std::mutex lock;
+        Aws::Deque<std::function<void()>> tasks;
+    };
+
+    PoolState(std::size_t workerCount) :
+        m_nextQueue(0),
+        m_pendingTasks(0),
+        m_idleWorkers(0),
+        m_shuttingDown(false)
+    {
+        m_queues.reserve(workerCount);
+        for (std::size_t i = 0; i < workerCount; ++i)
+        {
+            m_queues.push_back(Aws::MakeUnique<WorkerQueue>(WORK_STEALING_EXECUTOR_TAG));
+        }
+    }
+
+    bool PopLocal(std::size_t index, std::function<void()>& task)
+    {
+        WorkerQueue& queue = *m_queues[index];
+        std::lock_guard<std::mutex> locker(queue.lock);
+        if (queue.tasks.empty())
+        {
+            return false;
+        }
+
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    bool Steal(std::size_t index, std::function<void()>& task)
+    {
+        for (std::size_t offset = 1; offset < m_queues.size(); ++offset)
+        {
+            WorkerQueue& victim = *m_queues[(index + offset) % m_queues.size()];
+            std::lock_guard<std::mutex> locker(victim.lock);
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    Aws::Vector<Aws::UniquePtr<WorkerQueue>> m_queues;
+    std::atomic<std::size_t> m_nextQueue;
+    std::atomic<std::size_t> m_pendingTasks;
+    std::atomic<std::size_t> m_idleWorkers;
+    std::atomic<bool> m_shuttingDown;
+    std::mutex m_idleLock;
+    std::condition_variable m_taskAvailable;
+};
+
+//set once by each work stealing thread before it runs anything, so a submission can find its own deque without locking.
+//VS2013 has no thread_local; both are plain data, which is all __declspec(thread) needs.
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define AWS_WORKER_THREAD_LOCAL __declspec(thread)
+#else
+#define AWS_WORKER_THREAD_LOCAL thread_local
+#endif
+static AWS_WORKER_THREAD_LOCAL const void* s_workerPool = nullptr;
+static AWS_WORKER_THREAD_LOCAL std::size_t s_workerIndex = 0;
+
+WorkStealingExecutor::WorkStealingExecutor(std::size_t poolSize)
+{
+    std::size_t workerCount = poolSize > 0 ? poolSize : 1;
+    //every queue has to exist before any worker starts stealing from them.
+    m_state = Aws::MakeShared<PoolState>(WORK_STEALING_EXECUTOR_TAG, workerCount);
+
+    m_workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&WorkStealingExecutor::WorkerLoop, m_state, i);
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor()
+{
+    if (GetWorkerIndex() == m_workers.size())
+    {
+        Shutdown();
+        return;
+    }
+
+    //destroyed by one of its own tasks: nobody can wait for the pool, so let the threads drain the queues and exit by themselves.
+    StopAccepting();
+    for (auto& worker : m_workers)
+    {
+        worker.detach();
+    }
+}
+
+void WorkStealingExecutor::StopAccepting()
+{
+    m_state->m_shuttingDown = true;
+    {
+        std::lock_guard<std::mutex> locker(m_state->m_idleLock);
+    }
+    m_state->m_taskAvailable.notify_all();
+}
+
+void WorkStealingExecutor::Shutdown()
+{
+    StopAccepting();
+    if (GetWorkerIndex() < m_workers.size())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> locker(m_joinLock);
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+std::size_t WorkStealingExecutor::GetWorkerIndex() const
+{
+    return s_workerPool == m_state.get() ? s_workerIndex : m_state->m_queues.size();
+}
+
+bool WorkStealingExecutor::SubmitToThread(std::function<void()>&& fx)
+{
+    PoolState& state = *m_state;
+    std::size_t index = GetWorkerIndex();
+    bool fromWorker = index < state.m_queues.size();
+    //continuations are still accepted while shutting down so that draining the queues also finishes the chains they belong to.
+    if (state.m_shuttingDown && !fromWorker)
+    {
+        AWS_LOG_WARN(WORK_STEALING_EXECUTOR_TAG, "Task submitted after shutdown was rejected.");
+        return false;
+    }
+
+    if (!fromWorker)
+    {
+        index = state.m_nextQueue++ % state.m_queues.size();
+    }
+
+    //counted before it is queued so a worker can never pop a task the count does not include.
+    ++state.m_pendingTasks;
+    {
+        std::lock_guard<std::mutex> locker(state.m_queues[index]->lock);
+        state.m_queues[index]->tasks.push_back(std::move(fx));
+    }
+
+    if (state.m_idleWorkers > 0)
+    {
+        {
+            std::lock_guard<std::mutex> locker(state.m_idleLock);
+        }
+        state.m_taskAvailable.notify_one();
+    }
+
+    return true;
+}
+
+void WorkStealingExecutor::WorkerLoop(std::shared_ptr<PoolState> state, std::size_t index)
+{
+    s_workerPool = state.get();
+    s_workerIndex = index;
+
+    for (;;)
+    {
+        std::function<void()> task;
+        if (state->PopLocal(index, task) || state->Steal(index, task))
+        {
+            --state->m_pendingTasks;
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> locker(state->m_idleLock);
+        ++state->m_idleWorkers;
+        state->m_taskAvailable.wait(locker, [&state] { return state->m_pendingTasks > 0 || state->m_shuttingDown; });
+        --state->m_idleWorkers;
+        if (state->m_shuttingDown && state->m_pendingTasks == 0)
+        {
+            return;
+        }
+    }
+}
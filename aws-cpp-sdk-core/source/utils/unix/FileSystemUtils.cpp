@@ -91,3 +91,24 @@ bool FileSystemUtils::RelocateFileOrDirectory(const char* from, const char* to)
     AWS_LOGSTREAM_DEBUG(LOG_TAG,  "The moving operation of file at " << from << " to " << to << " Returned error code of " << errno);
     return errorCode == 0;
 }
+
+bool FileSystemUtils::GetFileSizeAndModificationTime(const char* path, uint64_t& size, int64_t& modificationTime)
+{
+    struct stat fileInfo;
+    if (stat(path, &fileInfo) != 0)
+    {
+        AWS_LOGSTREAM_TRACE(LOG_TAG, "Unable to stat file " << path << ", error code " << errno);
+        return false;
+    }
+
+    size = static_cast<uint64_t>(fileInfo.st_size);
+    //whole seconds alone would miss a same sized rewrite within the second.
+#if defined(__APPLE__)
+    modificationTime = static_cast<int64_t>(fileInfo.st_mtimespec.tv_sec) * 1000000000 + fileInfo.st_mtimespec.tv_nsec;
+#elif defined(__linux__) && !defined(__ANDROID__)
+    modificationTime = static_cast<int64_t>(fileInfo.st_mtim.tv_sec) * 1000000000 + fileInfo.st_mtim.tv_nsec;
+#else
+    modificationTime = static_cast<int64_t>(fileInfo.st_mtime) * 1000000000;
+#endif
+    return true;
+}
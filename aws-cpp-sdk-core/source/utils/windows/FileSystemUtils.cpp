@@ -112,4 +112,18 @@ bool FileSystemUtils::RelocateFileOrDirectory(const char* from, const char* to)
         AWS_LOGSTREAM_DEBUG(LOG_TAG,  "The moving operation of file at " << from << " to " << to << " Returned error code of " << errorCode);
         return false;
     }
-}
\ No newline at end of file
+}
+
+bool FileSystemUtils::GetFileSizeAndModificationTime(const char* path, uint64_t& size, int64_t& modificationTime)
+{
+    WIN32_FILE_ATTRIBUTE_DATA fileInfo;
+    if (!GetFileAttributesExA(path, GetFileExInfoStandard, &fileInfo))
+    {
+        AWS_LOGSTREAM_TRACE(LOG_TAG, "Unable to read attributes of file " << path << ", error code " << GetLastError());
+        return false;
+    }
+
+    size = (static_cast<uint64_t>(fileInfo.nFileSizeHigh) << 32) | fileInfo.nFileSizeLow;
+    modificationTime = static_cast<int64_t>((static_cast<uint64_t>(fileInfo.ftLastWriteTime.dwHighDateTime) << 32) | fileInfo.ftLastWriteTime.dwLowDateTime);
+    return true;
+}
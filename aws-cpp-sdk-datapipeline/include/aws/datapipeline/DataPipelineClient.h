@@ -39,6 +39,7 @@
 #include <aws/datapipeline/model/ValidatePipelineDefinitionResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -244,6 +245,31 @@ namespace Model
          */
         virtual void ActivatePipelineAsync(const Model::ActivatePipelineRequest& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Validates the specified pipeline and starts processing pipeline tasks. If the
+         * pipeline does not pass validation, activation fails.</p> <p>If you need to pause
+         * the pipeline to investigate an issue with a component, such as a data source or
+         * script, call <a>DeactivatePipeline</a>.</p> <p>To activate a finished pipeline,
+         * modify the end date for the pipeline and then activate it.</p>
+         *
+         * Returns an awaitable that starts the operation the way ActivatePipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ActivatePipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::ActivatePipelineOutcome> ActivatePipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ActivatePipelineOutcome>([this, request](const std::function<void(Model::ActivatePipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ActivatePipelineAsync(request, [complete](const DataPipelineClient*, const Model::ActivatePipelineRequest&, const Model::ActivatePipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ActivatePipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds or modifies tags for the specified pipeline.</p>
          */
@@ -263,6 +289,27 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds or modifies tags for the specified pipeline.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsOutcome> AddTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsOutcome>([this, request](const std::function<void(Model::AddTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsAsync(request, [complete](const DataPipelineClient*, const Model::AddTagsRequest&, const Model::AddTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new, empty pipeline. Use <a>PutPipelineDefinition</a> to populate
          * the pipeline.</p>
@@ -285,6 +332,28 @@ namespace Model
          */
         virtual void CreatePipelineAsync(const Model::CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new, empty pipeline. Use <a>PutPipelineDefinition</a> to populate
+         * the pipeline.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePipelineOutcome> CreatePipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePipelineOutcome>([this, request](const std::function<void(Model::CreatePipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePipelineAsync(request, [complete](const DataPipelineClient*, const Model::CreatePipelineRequest&, const Model::CreatePipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deactivates the specified running pipeline. The pipeline is set to the
          * <code>DEACTIVATING</code> state until the deactivation process completes.</p>
@@ -316,6 +385,31 @@ namespace Model
          */
         virtual void DeactivatePipelineAsync(const Model::DeactivatePipelineRequest& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deactivates the specified running pipeline. The pipeline is set to the
+         * <code>DEACTIVATING</code> state until the deactivation process completes.</p>
+         * <p>To resume a deactivated pipeline, use <a>ActivatePipeline</a>. By default,
+         * the pipeline resumes from the last completed execution. Optionally, you can
+         * specify the date and time to resume the pipeline.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeactivatePipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeactivatePipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeactivatePipelineOutcome> DeactivatePipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeactivatePipelineOutcome>([this, request](const std::function<void(Model::DeactivatePipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeactivatePipelineAsync(request, [complete](const DataPipelineClient*, const Model::DeactivatePipelineRequest&, const Model::DeactivatePipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeactivatePipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a pipeline, its pipeline definition, and its run history. AWS Data
          * Pipeline attempts to cancel instances associated with the pipeline that are
@@ -353,6 +447,33 @@ namespace Model
          */
         virtual void DeletePipelineAsync(const Model::DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a pipeline, its pipeline definition, and its run history. AWS Data
+         * Pipeline attempts to cancel instances associated with the pipeline that are
+         * currently being processed by task runners.</p> <p>Deleting a pipeline cannot be
+         * undone. You cannot query or restore a deleted pipeline. To temporarily pause a
+         * pipeline instead of deleting it, call <a>SetStatus</a> with the status set to
+         * <code>PAUSE</code> on individual components. Components that are paused by
+         * <a>SetStatus</a> can be resumed.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeletePipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeletePipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeletePipelineOutcome> DeletePipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeletePipelineOutcome>([this, request](const std::function<void(Model::DeletePipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeletePipelineAsync(request, [complete](const DataPipelineClient*, const Model::DeletePipelineRequest&, const Model::DeletePipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeletePipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the object definitions for a set of objects associated with the
          * pipeline. Object definitions are composed of a set of fields that define the
@@ -378,6 +499,29 @@ namespace Model
          */
         virtual void DescribeObjectsAsync(const Model::DescribeObjectsRequest& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the object definitions for a set of objects associated with the
+         * pipeline. Object definitions are composed of a set of fields that define the
+         * properties of the object.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeObjectsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeObjectsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeObjectsOutcome> DescribeObjectsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeObjectsOutcome>([this, request](const std::function<void(Model::DescribeObjectsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeObjectsAsync(request, [complete](const DataPipelineClient*, const Model::DescribeObjectsRequest&, const Model::DescribeObjectsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeObjectsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves metadata about one or more pipelines. The information retrieved
          * includes the name of the pipeline, the pipeline identifier, its current state,
@@ -418,6 +562,34 @@ namespace Model
          */
         virtual void DescribePipelinesAsync(const Model::DescribePipelinesRequest& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves metadata about one or more pipelines. The information retrieved
+         * includes the name of the pipeline, the pipeline identifier, its current state,
+         * and the user account that owns the pipeline. Using account credentials, you can
+         * retrieve metadata about pipelines that you or your IAM users have created. If
+         * you are using an IAM user account, you can retrieve metadata about only those
+         * pipelines for which you have read permissions.</p> <p>To retrieve the full
+         * pipeline definition instead of metadata about the pipeline, call
+         * <a>GetPipelineDefinition</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribePipelinesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribePipelinesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribePipelinesOutcome> DescribePipelinesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribePipelinesOutcome>([this, request](const std::function<void(Model::DescribePipelinesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribePipelinesAsync(request, [complete](const DataPipelineClient*, const Model::DescribePipelinesRequest&, const Model::DescribePipelinesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribePipelinesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Task runners call <code>EvaluateExpression</code> to evaluate a string in the
          * context of the specified object. For example, a task runner can evaluate SQL
@@ -443,6 +615,29 @@ namespace Model
          */
         virtual void EvaluateExpressionAsync(const Model::EvaluateExpressionRequest& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Task runners call <code>EvaluateExpression</code> to evaluate a string in the
+         * context of the specified object. For example, a task runner can evaluate SQL
+         * queries stored in Amazon S3.</p>
+         *
+         * Returns an awaitable that starts the operation the way EvaluateExpressionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EvaluateExpressionRequest>
+        Aws::Utils::Threading::Awaitable<Model::EvaluateExpressionOutcome> EvaluateExpressionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EvaluateExpressionOutcome>([this, request](const std::function<void(Model::EvaluateExpressionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EvaluateExpressionAsync(request, [complete](const DataPipelineClient*, const Model::EvaluateExpressionRequest&, const Model::EvaluateExpressionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EvaluateExpressionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the definition of the specified pipeline. You can call
          * <code>GetPipelineDefinition</code> to retrieve the pipeline definition that you
@@ -468,6 +663,29 @@ namespace Model
          */
         virtual void GetPipelineDefinitionAsync(const Model::GetPipelineDefinitionRequest& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the definition of the specified pipeline. You can call
+         * <code>GetPipelineDefinition</code> to retrieve the pipeline definition that you
+         * provided using <a>PutPipelineDefinition</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetPipelineDefinitionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetPipelineDefinitionRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetPipelineDefinitionOutcome> GetPipelineDefinitionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetPipelineDefinitionOutcome>([this, request](const std::function<void(Model::GetPipelineDefinitionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetPipelineDefinitionAsync(request, [complete](const DataPipelineClient*, const Model::GetPipelineDefinitionRequest&, const Model::GetPipelineDefinitionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetPipelineDefinitionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the pipeline identifiers for all active pipelines that you have
          * permission to access.</p>
@@ -490,6 +708,28 @@ namespace Model
          */
         virtual void ListPipelinesAsync(const Model::ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the pipeline identifiers for all active pipelines that you have
+         * permission to access.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListPipelinesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPipelinesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPipelinesOutcome> ListPipelinesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPipelinesOutcome>([this, request](const std::function<void(Model::ListPipelinesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPipelinesAsync(request, [complete](const DataPipelineClient*, const Model::ListPipelinesRequest&, const Model::ListPipelinesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPipelinesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Task runners call <code>PollForTask</code> to receive a task to perform from
          * AWS Data Pipeline. The task runner specifies which tasks it can perform by
@@ -545,6 +785,39 @@ namespace Model
          */
         virtual void PollForTaskAsync(const Model::PollForTaskRequest& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Task runners call <code>PollForTask</code> to receive a task to perform from
+         * AWS Data Pipeline. The task runner specifies which tasks it can perform by
+         * setting a value for the <code>workerGroup</code> parameter. The task returned
+         * can come from any of the pipelines that match the <code>workerGroup</code> value
+         * passed in by the task runner and that was launched using the IAM user
+         * credentials specified by the task runner.</p> <p>If tasks are ready in the work
+         * queue, <code>PollForTask</code> returns a response immediately. If no tasks are
+         * available in the queue, <code>PollForTask</code> uses long-polling and holds on
+         * to a poll connection for up to a 90 seconds, during which time the first newly
+         * scheduled task is handed to the task runner. To accomodate this, set the socket
+         * timeout in your task runner to 90 seconds. The task runner should not call
+         * <code>PollForTask</code> again on the same <code>workerGroup</code> until it
+         * receives a response, and this can take up to 90 seconds. </p>
+         *
+         * Returns an awaitable that starts the operation the way PollForTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PollForTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::PollForTaskOutcome> PollForTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PollForTaskOutcome>([this, request](const std::function<void(Model::PollForTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PollForTaskAsync(request, [complete](const DataPipelineClient*, const Model::PollForTaskRequest&, const Model::PollForTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PollForTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds tasks, schedules, and preconditions to the specified pipeline. You can
          * use <code>PutPipelineDefinition</code> to populate a new pipeline.</p> <p>
@@ -594,6 +867,37 @@ namespace Model
          */
         virtual void PutPipelineDefinitionAsync(const Model::PutPipelineDefinitionRequest& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds tasks, schedules, and preconditions to the specified pipeline. You can
+         * use <code>PutPipelineDefinition</code> to populate a new pipeline.</p> <p>
+         * <code>PutPipelineDefinition</code> also validates the configuration as it adds
+         * it to the pipeline. Changes to the pipeline are saved unless one of the
+         * following three validation errors exists in the pipeline. </p> <ol> <li>An
+         * object is missing a name or identifier field.</li> <li>A string or reference
+         * field is empty.</li> <li>The number of objects in the pipeline exceeds the
+         * maximum allowed objects.</li> <li>The pipeline is in a FINISHED state.</li>
+         * </ol> <p> Pipeline object definitions are passed to the
+         * <code>PutPipelineDefinition</code> action and returned by the
+         * <a>GetPipelineDefinition</a> action. </p>
+         *
+         * Returns an awaitable that starts the operation the way PutPipelineDefinitionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutPipelineDefinitionRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutPipelineDefinitionOutcome> PutPipelineDefinitionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutPipelineDefinitionOutcome>([this, request](const std::function<void(Model::PutPipelineDefinitionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutPipelineDefinitionAsync(request, [complete](const DataPipelineClient*, const Model::PutPipelineDefinitionRequest&, const Model::PutPipelineDefinitionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutPipelineDefinitionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Queries the specified pipeline for the names of objects that match the
          * specified set of conditions.</p>
@@ -616,6 +920,28 @@ namespace Model
          */
         virtual void QueryObjectsAsync(const Model::QueryObjectsRequest& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Queries the specified pipeline for the names of objects that match the
+         * specified set of conditions.</p>
+         *
+         * Returns an awaitable that starts the operation the way QueryObjectsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::QueryObjectsRequest>
+        Aws::Utils::Threading::Awaitable<Model::QueryObjectsOutcome> QueryObjectsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::QueryObjectsOutcome>([this, request](const std::function<void(Model::QueryObjectsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->QueryObjectsAsync(request, [complete](const DataPipelineClient*, const Model::QueryObjectsRequest&, const Model::QueryObjectsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::QueryObjectsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes existing tags from the specified pipeline.</p>
          */
@@ -635,6 +961,27 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes existing tags from the specified pipeline.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsOutcome>([this, request](const std::function<void(Model::RemoveTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsAsync(request, [complete](const DataPipelineClient*, const Model::RemoveTagsRequest&, const Model::RemoveTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Task runners call <code>ReportTaskProgress</code> when assigned a task to
          * acknowledge that it has the task. If the web service does not receive this
@@ -684,6 +1031,37 @@ namespace Model
          */
         virtual void ReportTaskProgressAsync(const Model::ReportTaskProgressRequest& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Task runners call <code>ReportTaskProgress</code> when assigned a task to
+         * acknowledge that it has the task. If the web service does not receive this
+         * acknowledgement within 2 minutes, it assigns the task in a subsequent
+         * <a>PollForTask</a> call. After this initial acknowledgement, the task runner
+         * only needs to report progress every 15 minutes to maintain its ownership of the
+         * task. You can change this reporting time from 15 minutes by specifying a
+         * <code>reportProgressTimeout</code> field in your pipeline.</p> <p>If a task
+         * runner does not report its status after 5 minutes, AWS Data Pipeline assumes
+         * that the task runner is unable to process the task and reassigns the task in a
+         * subsequent response to <a>PollForTask</a>. Task runners should call
+         * <code>ReportTaskProgress</code> every 60 seconds.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReportTaskProgressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReportTaskProgressRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReportTaskProgressOutcome> ReportTaskProgressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReportTaskProgressOutcome>([this, request](const std::function<void(Model::ReportTaskProgressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReportTaskProgressAsync(request, [complete](const DataPipelineClient*, const Model::ReportTaskProgressRequest&, const Model::ReportTaskProgressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReportTaskProgressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Task runners call <code>ReportTaskRunnerHeartbeat</code> every 15 minutes to
          * indicate that they are operational. If the AWS Data Pipeline Task Runner is
@@ -715,6 +1093,31 @@ namespace Model
          */
         virtual void ReportTaskRunnerHeartbeatAsync(const Model::ReportTaskRunnerHeartbeatRequest& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Task runners call <code>ReportTaskRunnerHeartbeat</code> every 15 minutes to
+         * indicate that they are operational. If the AWS Data Pipeline Task Runner is
+         * launched on a resource managed by AWS Data Pipeline, the web service can use
+         * this call to detect when the task runner application has failed and restart a
+         * new instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReportTaskRunnerHeartbeatAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReportTaskRunnerHeartbeatRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReportTaskRunnerHeartbeatOutcome> ReportTaskRunnerHeartbeatAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReportTaskRunnerHeartbeatOutcome>([this, request](const std::function<void(Model::ReportTaskRunnerHeartbeatOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReportTaskRunnerHeartbeatAsync(request, [complete](const DataPipelineClient*, const Model::ReportTaskRunnerHeartbeatRequest&, const Model::ReportTaskRunnerHeartbeatOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReportTaskRunnerHeartbeatOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests that the status of the specified physical or logical pipeline
          * objects be updated in the specified pipeline. This update might not occur
@@ -749,6 +1152,32 @@ namespace Model
          */
         virtual void SetStatusAsync(const Model::SetStatusRequest& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests that the status of the specified physical or logical pipeline
+         * objects be updated in the specified pipeline. This update might not occur
+         * immediately, but is eventually consistent. The status that can be set depends on
+         * the type of object (for example, DataNode or Activity). You cannot perform this
+         * operation on <code>FINISHED</code> pipelines and attempting to do so returns
+         * <code>InvalidRequestException</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetStatusOutcome> SetStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetStatusOutcome>([this, request](const std::function<void(Model::SetStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetStatusAsync(request, [complete](const DataPipelineClient*, const Model::SetStatusRequest&, const Model::SetStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Task runners call <code>SetTaskStatus</code> to notify AWS Data Pipeline that
          * a task is completed and provide information about the final status. A task
@@ -780,6 +1209,31 @@ namespace Model
          */
         virtual void SetTaskStatusAsync(const Model::SetTaskStatusRequest& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Task runners call <code>SetTaskStatus</code> to notify AWS Data Pipeline that
+         * a task is completed and provide information about the final status. A task
+         * runner makes this call regardless of whether the task was sucessful. A task
+         * runner does not need to call <code>SetTaskStatus</code> for tasks that are
+         * canceled by the web service during a call to <a>ReportTaskProgress</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetTaskStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetTaskStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetTaskStatusOutcome> SetTaskStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetTaskStatusOutcome>([this, request](const std::function<void(Model::SetTaskStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetTaskStatusAsync(request, [complete](const DataPipelineClient*, const Model::SetTaskStatusRequest&, const Model::SetTaskStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetTaskStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Validates the specified pipeline definition to ensure that it is well formed
          * and can be run without error.</p>
@@ -802,6 +1256,28 @@ namespace Model
          */
         virtual void ValidatePipelineDefinitionAsync(const Model::ValidatePipelineDefinitionRequest& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Validates the specified pipeline definition to ensure that it is well formed
+         * and can be run without error.</p>
+         *
+         * Returns an awaitable that starts the operation the way ValidatePipelineDefinitionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ValidatePipelineDefinitionRequest>
+        Aws::Utils::Threading::Awaitable<Model::ValidatePipelineDefinitionOutcome> ValidatePipelineDefinitionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ValidatePipelineDefinitionOutcome>([this, request](const std::function<void(Model::ValidatePipelineDefinitionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ValidatePipelineDefinitionAsync(request, [complete](const DataPipelineClient*, const Model::ValidatePipelineDefinitionRequest&, const Model::ValidatePipelineDefinitionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ValidatePipelineDefinitionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -58,6 +58,7 @@
 #include <aws/devicefarm/model/UpdateDevicePoolResult.h>
 #include <aws/devicefarm/model/UpdateProjectResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -308,6 +309,27 @@ namespace Model
          */
         virtual void CreateDevicePoolAsync(const Model::CreateDevicePoolRequest& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a device pool.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDevicePoolAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDevicePoolRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDevicePoolOutcome> CreateDevicePoolAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDevicePoolOutcome>([this, request](const std::function<void(Model::CreateDevicePoolOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDevicePoolAsync(request, [complete](const DeviceFarmClient*, const Model::CreateDevicePoolRequest&, const Model::CreateDevicePoolOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDevicePoolOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new project.</p>
          */
@@ -327,6 +349,27 @@ namespace Model
          */
         virtual void CreateProjectAsync(const Model::CreateProjectRequest& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new project.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateProjectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateProjectRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateProjectOutcome> CreateProjectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateProjectOutcome>([this, request](const std::function<void(Model::CreateProjectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateProjectAsync(request, [complete](const DeviceFarmClient*, const Model::CreateProjectRequest&, const Model::CreateProjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateProjectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Uploads an app or test scripts.</p>
          */
@@ -346,6 +389,27 @@ namespace Model
          */
         virtual void CreateUploadAsync(const Model::CreateUploadRequest& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Uploads an app or test scripts.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateUploadAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateUploadRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateUploadOutcome> CreateUploadAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateUploadOutcome>([this, request](const std::function<void(Model::CreateUploadOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateUploadAsync(request, [complete](const DeviceFarmClient*, const Model::CreateUploadRequest&, const Model::CreateUploadOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateUploadOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a device pool given the pool ARN. Does not allow deletion of curated
          * pools owned by the system.</p>
@@ -368,6 +432,28 @@ namespace Model
          */
         virtual void DeleteDevicePoolAsync(const Model::DeleteDevicePoolRequest& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a device pool given the pool ARN. Does not allow deletion of curated
+         * pools owned by the system.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDevicePoolAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDevicePoolRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDevicePoolOutcome> DeleteDevicePoolAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDevicePoolOutcome>([this, request](const std::function<void(Model::DeleteDevicePoolOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDevicePoolAsync(request, [complete](const DeviceFarmClient*, const Model::DeleteDevicePoolRequest&, const Model::DeleteDevicePoolOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDevicePoolOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an AWS Device Farm project, given the project ARN.</p> <p><b>Note</b>
          * Deleting this resource does not stop an in-progress run.</p>
@@ -390,6 +476,28 @@ namespace Model
          */
         virtual void DeleteProjectAsync(const Model::DeleteProjectRequest& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an AWS Device Farm project, given the project ARN.</p> <p><b>Note</b>
+         * Deleting this resource does not stop an in-progress run.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteProjectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteProjectRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteProjectOutcome> DeleteProjectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteProjectOutcome>([this, request](const std::function<void(Model::DeleteProjectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteProjectAsync(request, [complete](const DeviceFarmClient*, const Model::DeleteProjectRequest&, const Model::DeleteProjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteProjectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the run, given the run ARN.</p> <p><b>Note</b> Deleting this resource
          * does not stop an in-progress run.</p>
@@ -412,6 +520,28 @@ namespace Model
          */
         virtual void DeleteRunAsync(const Model::DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the run, given the run ARN.</p> <p><b>Note</b> Deleting this resource
+         * does not stop an in-progress run.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRunAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRunRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRunOutcome> DeleteRunAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRunOutcome>([this, request](const std::function<void(Model::DeleteRunOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRunAsync(request, [complete](const DeviceFarmClient*, const Model::DeleteRunRequest&, const Model::DeleteRunOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRunOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an upload given the upload ARN.</p>
          */
@@ -431,6 +561,27 @@ namespace Model
          */
         virtual void DeleteUploadAsync(const Model::DeleteUploadRequest& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an upload given the upload ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteUploadAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteUploadRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteUploadOutcome> DeleteUploadAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteUploadOutcome>([this, request](const std::function<void(Model::DeleteUploadOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteUploadAsync(request, [complete](const DeviceFarmClient*, const Model::DeleteUploadRequest&, const Model::DeleteUploadOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteUploadOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the number of unmetered iOS and/or unmetered Android devices that
          * have been purchased by the account.</p>
@@ -453,6 +604,28 @@ namespace Model
          */
         virtual void GetAccountSettingsAsync(const Model::GetAccountSettingsRequest& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the number of unmetered iOS and/or unmetered Android devices that
+         * have been purchased by the account.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetAccountSettingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAccountSettingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAccountSettingsOutcome> GetAccountSettingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAccountSettingsOutcome>([this, request](const std::function<void(Model::GetAccountSettingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAccountSettingsAsync(request, [complete](const DeviceFarmClient*, const Model::GetAccountSettingsRequest&, const Model::GetAccountSettingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAccountSettingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a unique device type.</p>
          */
@@ -472,6 +645,27 @@ namespace Model
          */
         virtual void GetDeviceAsync(const Model::GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a unique device type.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDeviceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDeviceRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDeviceOutcome> GetDeviceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDeviceOutcome>([this, request](const std::function<void(Model::GetDeviceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDeviceAsync(request, [complete](const DeviceFarmClient*, const Model::GetDeviceRequest&, const Model::GetDeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDeviceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a device pool.</p>
          */
@@ -491,6 +685,27 @@ namespace Model
          */
         virtual void GetDevicePoolAsync(const Model::GetDevicePoolRequest& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a device pool.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDevicePoolAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDevicePoolRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDevicePoolOutcome> GetDevicePoolAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDevicePoolOutcome>([this, request](const std::function<void(Model::GetDevicePoolOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDevicePoolAsync(request, [complete](const DeviceFarmClient*, const Model::GetDevicePoolRequest&, const Model::GetDevicePoolOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDevicePoolOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about compatibility with a device pool.</p>
          */
@@ -510,6 +725,27 @@ namespace Model
          */
         virtual void GetDevicePoolCompatibilityAsync(const Model::GetDevicePoolCompatibilityRequest& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about compatibility with a device pool.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDevicePoolCompatibilityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDevicePoolCompatibilityRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDevicePoolCompatibilityOutcome> GetDevicePoolCompatibilityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDevicePoolCompatibilityOutcome>([this, request](const std::function<void(Model::GetDevicePoolCompatibilityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDevicePoolCompatibilityAsync(request, [complete](const DeviceFarmClient*, const Model::GetDevicePoolCompatibilityRequest&, const Model::GetDevicePoolCompatibilityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDevicePoolCompatibilityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a job.</p>
          */
@@ -529,6 +765,27 @@ namespace Model
          */
         virtual void GetJobAsync(const Model::GetJobRequest& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a job.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetJobAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetJobRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetJobOutcome> GetJobAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetJobOutcome>([this, request](const std::function<void(Model::GetJobOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetJobAsync(request, [complete](const DeviceFarmClient*, const Model::GetJobRequest&, const Model::GetJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetJobOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the current status and future status of all offerings purchased by an
          * AWS account. The response indicates how many offerings are currently available
@@ -566,6 +823,33 @@ namespace Model
          */
         virtual void GetOfferingStatusAsync(const Model::GetOfferingStatusRequest& request, const GetOfferingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the current status and future status of all offerings purchased by an
+         * AWS account. The response indicates how many offerings are currently available
+         * and the offerings that will be available in the next period. The API returns a
+         * <code>NotEligible</code> error if the user is not permitted to invoke the
+         * operation. Please contact <a
+         * href="mailto:aws-devicefarm-support@amazon.com">aws-devicefarm-support@amazon.com</a>
+         * if you believe that you should be able to invoke this operation.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetOfferingStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetOfferingStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetOfferingStatusOutcome> GetOfferingStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetOfferingStatusOutcome>([this, request](const std::function<void(Model::GetOfferingStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetOfferingStatusAsync(request, [complete](const DeviceFarmClient*, const Model::GetOfferingStatusRequest&, const Model::GetOfferingStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetOfferingStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a project.</p>
          */
@@ -585,6 +869,27 @@ namespace Model
          */
         virtual void GetProjectAsync(const Model::GetProjectRequest& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a project.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetProjectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetProjectRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetProjectOutcome> GetProjectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetProjectOutcome>([this, request](const std::function<void(Model::GetProjectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetProjectAsync(request, [complete](const DeviceFarmClient*, const Model::GetProjectRequest&, const Model::GetProjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetProjectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a run.</p>
          */
@@ -604,6 +909,27 @@ namespace Model
          */
         virtual void GetRunAsync(const Model::GetRunRequest& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a run.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetRunAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetRunRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetRunOutcome> GetRunAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetRunOutcome>([this, request](const std::function<void(Model::GetRunOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetRunAsync(request, [complete](const DeviceFarmClient*, const Model::GetRunRequest&, const Model::GetRunOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetRunOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a suite.</p>
          */
@@ -623,6 +949,27 @@ namespace Model
          */
         virtual void GetSuiteAsync(const Model::GetSuiteRequest& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a suite.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetSuiteAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetSuiteRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetSuiteOutcome> GetSuiteAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetSuiteOutcome>([this, request](const std::function<void(Model::GetSuiteOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetSuiteAsync(request, [complete](const DeviceFarmClient*, const Model::GetSuiteRequest&, const Model::GetSuiteOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetSuiteOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a test.</p>
          */
@@ -642,6 +989,27 @@ namespace Model
          */
         virtual void GetTestAsync(const Model::GetTestRequest& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a test.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetTestAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetTestRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetTestOutcome> GetTestAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetTestOutcome>([this, request](const std::function<void(Model::GetTestOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetTestAsync(request, [complete](const DeviceFarmClient*, const Model::GetTestRequest&, const Model::GetTestOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetTestOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about an upload.</p>
          */
@@ -661,6 +1029,27 @@ namespace Model
          */
         virtual void GetUploadAsync(const Model::GetUploadRequest& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about an upload.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetUploadAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetUploadRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetUploadOutcome> GetUploadAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetUploadOutcome>([this, request](const std::function<void(Model::GetUploadOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetUploadAsync(request, [complete](const DeviceFarmClient*, const Model::GetUploadRequest&, const Model::GetUploadOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetUploadOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about artifacts.</p>
          */
@@ -680,6 +1069,27 @@ namespace Model
          */
         virtual void ListArtifactsAsync(const Model::ListArtifactsRequest& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about artifacts.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListArtifactsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListArtifactsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListArtifactsOutcome> ListArtifactsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListArtifactsOutcome>([this, request](const std::function<void(Model::ListArtifactsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListArtifactsAsync(request, [complete](const DeviceFarmClient*, const Model::ListArtifactsRequest&, const Model::ListArtifactsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListArtifactsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about device pools.</p>
          */
@@ -699,6 +1109,27 @@ namespace Model
          */
         virtual void ListDevicePoolsAsync(const Model::ListDevicePoolsRequest& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about device pools.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDevicePoolsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDevicePoolsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDevicePoolsOutcome> ListDevicePoolsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDevicePoolsOutcome>([this, request](const std::function<void(Model::ListDevicePoolsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDevicePoolsAsync(request, [complete](const DeviceFarmClient*, const Model::ListDevicePoolsRequest&, const Model::ListDevicePoolsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDevicePoolsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about unique device types.</p>
          */
@@ -718,6 +1149,27 @@ namespace Model
          */
         virtual void ListDevicesAsync(const Model::ListDevicesRequest& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about unique device types.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDevicesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDevicesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDevicesOutcome> ListDevicesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDevicesOutcome>([this, request](const std::function<void(Model::ListDevicesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDevicesAsync(request, [complete](const DeviceFarmClient*, const Model::ListDevicesRequest&, const Model::ListDevicesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDevicesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about jobs.</p>
          */
@@ -737,6 +1189,27 @@ namespace Model
          */
         virtual void ListJobsAsync(const Model::ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about jobs.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListJobsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListJobsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListJobsOutcome> ListJobsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListJobsOutcome>([this, request](const std::function<void(Model::ListJobsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListJobsAsync(request, [complete](const DeviceFarmClient*, const Model::ListJobsRequest&, const Model::ListJobsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListJobsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of all historical purchases, renewals, and system renewal
          * transactions for an AWS account. The list is paginated and ordered by a
@@ -774,6 +1247,33 @@ namespace Model
          */
         virtual void ListOfferingTransactionsAsync(const Model::ListOfferingTransactionsRequest& request, const ListOfferingTransactionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of all historical purchases, renewals, and system renewal
+         * transactions for an AWS account. The list is paginated and ordered by a
+         * descending timestamp (most recent transactions are first). The API returns a
+         * <code>NotEligible</code> error if the user is not permitted to invoke the
+         * operation. Please contact <a
+         * href="mailto:aws-devicefarm-support@amazon.com">aws-devicefarm-support@amazon.com</a>
+         * if you believe that you should be able to invoke this operation.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListOfferingTransactionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListOfferingTransactionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListOfferingTransactionsOutcome> ListOfferingTransactionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListOfferingTransactionsOutcome>([this, request](const std::function<void(Model::ListOfferingTransactionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListOfferingTransactionsAsync(request, [complete](const DeviceFarmClient*, const Model::ListOfferingTransactionsRequest&, const Model::ListOfferingTransactionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListOfferingTransactionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of products or offerings that the user can manage through the
          * API. Each offering record indicates the recurring price per unit and the
@@ -808,6 +1308,32 @@ namespace Model
          */
         virtual void ListOfferingsAsync(const Model::ListOfferingsRequest& request, const ListOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of products or offerings that the user can manage through the
+         * API. Each offering record indicates the recurring price per unit and the
+         * frequency for that offering. The API returns a <code>NotEligible</code> error if
+         * the user is not permitted to invoke the operation. Please contact <a
+         * href="mailto:aws-devicefarm-support@amazon.com">aws-devicefarm-support@amazon.com</a>
+         * if you believe that you should be able to invoke this operation.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListOfferingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListOfferingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListOfferingsOutcome> ListOfferingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListOfferingsOutcome>([this, request](const std::function<void(Model::ListOfferingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListOfferingsAsync(request, [complete](const DeviceFarmClient*, const Model::ListOfferingsRequest&, const Model::ListOfferingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListOfferingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about projects.</p>
          */
@@ -827,6 +1353,27 @@ namespace Model
          */
         virtual void ListProjectsAsync(const Model::ListProjectsRequest& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about projects.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListProjectsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListProjectsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListProjectsOutcome> ListProjectsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListProjectsOutcome>([this, request](const std::function<void(Model::ListProjectsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListProjectsAsync(request, [complete](const DeviceFarmClient*, const Model::ListProjectsRequest&, const Model::ListProjectsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListProjectsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about runs.</p>
          */
@@ -846,6 +1393,27 @@ namespace Model
          */
         virtual void ListRunsAsync(const Model::ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about runs.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListRunsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRunsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRunsOutcome> ListRunsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRunsOutcome>([this, request](const std::function<void(Model::ListRunsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRunsAsync(request, [complete](const DeviceFarmClient*, const Model::ListRunsRequest&, const Model::ListRunsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRunsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about samples.</p>
          */
@@ -865,6 +1433,27 @@ namespace Model
          */
         virtual void ListSamplesAsync(const Model::ListSamplesRequest& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about samples.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListSamplesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListSamplesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListSamplesOutcome> ListSamplesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListSamplesOutcome>([this, request](const std::function<void(Model::ListSamplesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListSamplesAsync(request, [complete](const DeviceFarmClient*, const Model::ListSamplesRequest&, const Model::ListSamplesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListSamplesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about suites.</p>
          */
@@ -884,6 +1473,27 @@ namespace Model
          */
         virtual void ListSuitesAsync(const Model::ListSuitesRequest& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about suites.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListSuitesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListSuitesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListSuitesOutcome> ListSuitesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListSuitesOutcome>([this, request](const std::function<void(Model::ListSuitesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListSuitesAsync(request, [complete](const DeviceFarmClient*, const Model::ListSuitesRequest&, const Model::ListSuitesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListSuitesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about tests.</p>
          */
@@ -903,6 +1513,27 @@ namespace Model
          */
         virtual void ListTestsAsync(const Model::ListTestsRequest& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about tests.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTestsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTestsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTestsOutcome> ListTestsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTestsOutcome>([this, request](const std::function<void(Model::ListTestsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTestsAsync(request, [complete](const DeviceFarmClient*, const Model::ListTestsRequest&, const Model::ListTestsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTestsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about unique problems.</p>
          */
@@ -922,6 +1553,27 @@ namespace Model
          */
         virtual void ListUniqueProblemsAsync(const Model::ListUniqueProblemsRequest& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about unique problems.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListUniqueProblemsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListUniqueProblemsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListUniqueProblemsOutcome> ListUniqueProblemsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListUniqueProblemsOutcome>([this, request](const std::function<void(Model::ListUniqueProblemsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListUniqueProblemsAsync(request, [complete](const DeviceFarmClient*, const Model::ListUniqueProblemsRequest&, const Model::ListUniqueProblemsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListUniqueProblemsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about uploads.</p>
          */
@@ -941,6 +1593,27 @@ namespace Model
          */
         virtual void ListUploadsAsync(const Model::ListUploadsRequest& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about uploads.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListUploadsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListUploadsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListUploadsOutcome> ListUploadsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListUploadsOutcome>([this, request](const std::function<void(Model::ListUploadsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListUploadsAsync(request, [complete](const DeviceFarmClient*, const Model::ListUploadsRequest&, const Model::ListUploadsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListUploadsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Immediately purchases offerings for an AWS account. Offerings renew with the
          * latest total purchased quantity for an offering, unless the renewal was
@@ -975,6 +1648,32 @@ namespace Model
          */
         virtual void PurchaseOfferingAsync(const Model::PurchaseOfferingRequest& request, const PurchaseOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Immediately purchases offerings for an AWS account. Offerings renew with the
+         * latest total purchased quantity for an offering, unless the renewal was
+         * overridden. The API returns a <code>NotEligible</code> error if the user is not
+         * permitted to invoke the operation. Please contact <a
+         * href="mailto:aws-devicefarm-support@amazon.com">aws-devicefarm-support@amazon.com</a>
+         * if you believe that you should be able to invoke this operation.</p>
+         *
+         * Returns an awaitable that starts the operation the way PurchaseOfferingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PurchaseOfferingRequest>
+        Aws::Utils::Threading::Awaitable<Model::PurchaseOfferingOutcome> PurchaseOfferingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PurchaseOfferingOutcome>([this, request](const std::function<void(Model::PurchaseOfferingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PurchaseOfferingAsync(request, [complete](const DeviceFarmClient*, const Model::PurchaseOfferingRequest&, const Model::PurchaseOfferingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PurchaseOfferingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Explicitly sets the quantity of devices to renew for an offering, starting
          * from the <code>effectiveDate</code> of the next period. The API returns a
@@ -1009,6 +1708,32 @@ namespace Model
          */
         virtual void RenewOfferingAsync(const Model::RenewOfferingRequest& request, const RenewOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Explicitly sets the quantity of devices to renew for an offering, starting
+         * from the <code>effectiveDate</code> of the next period. The API returns a
+         * <code>NotEligible</code> error if the user is not permitted to invoke the
+         * operation. Please contact <a
+         * href="mailto:aws-devicefarm-support@amazon.com">aws-devicefarm-support@amazon.com</a>
+         * if you believe that you should be able to invoke this operation.</p>
+         *
+         * Returns an awaitable that starts the operation the way RenewOfferingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RenewOfferingRequest>
+        Aws::Utils::Threading::Awaitable<Model::RenewOfferingOutcome> RenewOfferingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RenewOfferingOutcome>([this, request](const std::function<void(Model::RenewOfferingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RenewOfferingAsync(request, [complete](const DeviceFarmClient*, const Model::RenewOfferingRequest&, const Model::RenewOfferingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RenewOfferingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Schedules a run.</p>
          */
@@ -1028,6 +1753,27 @@ namespace Model
          */
         virtual void ScheduleRunAsync(const Model::ScheduleRunRequest& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Schedules a run.</p>
+         *
+         * Returns an awaitable that starts the operation the way ScheduleRunAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ScheduleRunRequest>
+        Aws::Utils::Threading::Awaitable<Model::ScheduleRunOutcome> ScheduleRunAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ScheduleRunOutcome>([this, request](const std::function<void(Model::ScheduleRunOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ScheduleRunAsync(request, [complete](const DeviceFarmClient*, const Model::ScheduleRunRequest&, const Model::ScheduleRunOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ScheduleRunOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Initiates a stop request for the current test run. AWS Device Farm will
          * immediately stop the run on devices where tests have not started executing, and
@@ -1062,6 +1808,32 @@ namespace Model
          */
         virtual void StopRunAsync(const Model::StopRunRequest& request, const StopRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Initiates a stop request for the current test run. AWS Device Farm will
+         * immediately stop the run on devices where tests have not started executing, and
+         * you will not be billed for these devices. On devices where tests have started
+         * executing, Setup Suite and Teardown Suite tests will run to completion before
+         * stopping execution on those devices. You will be billed for Setup, Teardown, and
+         * any tests that were in progress or already completed.</p>
+         *
+         * Returns an awaitable that starts the operation the way StopRunAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StopRunRequest>
+        Aws::Utils::Threading::Awaitable<Model::StopRunOutcome> StopRunAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StopRunOutcome>([this, request](const std::function<void(Model::StopRunOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StopRunAsync(request, [complete](const DeviceFarmClient*, const Model::StopRunRequest&, const Model::StopRunOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StopRunOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the name, description, and rules in a device pool given the
          * attributes and the pool ARN. Rule updates are all-or-nothing, meaning they can
@@ -1087,6 +1859,29 @@ namespace Model
          */
         virtual void UpdateDevicePoolAsync(const Model::UpdateDevicePoolRequest& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the name, description, and rules in a device pool given the
+         * attributes and the pool ARN. Rule updates are all-or-nothing, meaning they can
+         * only be updated as a whole (or not at all).</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateDevicePoolAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDevicePoolRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDevicePoolOutcome> UpdateDevicePoolAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDevicePoolOutcome>([this, request](const std::function<void(Model::UpdateDevicePoolOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDevicePoolAsync(request, [complete](const DeviceFarmClient*, const Model::UpdateDevicePoolRequest&, const Model::UpdateDevicePoolOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDevicePoolOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the specified project name, given the project ARN and a new
          * name.</p>
@@ -1109,6 +1904,28 @@ namespace Model
          */
         virtual void UpdateProjectAsync(const Model::UpdateProjectRequest& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the specified project name, given the project ARN and a new
+         * name.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateProjectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateProjectRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateProjectOutcome> UpdateProjectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateProjectOutcome>([this, request](const std::function<void(Model::UpdateProjectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateProjectAsync(request, [complete](const DeviceFarmClient*, const Model::UpdateProjectRequest&, const Model::UpdateProjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateProjectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
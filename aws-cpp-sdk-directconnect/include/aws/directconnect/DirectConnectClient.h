@@ -40,6 +40,7 @@
 #include <aws/directconnect/model/DescribeVirtualGatewaysResult.h>
 #include <aws/directconnect/model/DescribeVirtualInterfacesResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -231,6 +232,29 @@ namespace Model
          */
         virtual void AllocateConnectionOnInterconnectAsync(const Model::AllocateConnectionOnInterconnectRequest& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a hosted connection on an interconnect.</p> <p>Allocates a VLAN
+         * number and a specified amount of bandwidth for use by a hosted connection on the
+         * given interconnect.</p>
+         *
+         * Returns an awaitable that starts the operation the way AllocateConnectionOnInterconnectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AllocateConnectionOnInterconnectRequest>
+        Aws::Utils::Threading::Awaitable<Model::AllocateConnectionOnInterconnectOutcome> AllocateConnectionOnInterconnectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AllocateConnectionOnInterconnectOutcome>([this, request](const std::function<void(Model::AllocateConnectionOnInterconnectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AllocateConnectionOnInterconnectAsync(request, [complete](const DirectConnectClient*, const Model::AllocateConnectionOnInterconnectRequest&, const Model::AllocateConnectionOnInterconnectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AllocateConnectionOnInterconnectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provisions a private virtual interface to be owned by a different
          * customer.</p> <p>The owner of a connection calls this function to provision a
@@ -268,6 +292,33 @@ namespace Model
          */
         virtual void AllocatePrivateVirtualInterfaceAsync(const Model::AllocatePrivateVirtualInterfaceRequest& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provisions a private virtual interface to be owned by a different
+         * customer.</p> <p>The owner of a connection calls this function to provision a
+         * private virtual interface which will be owned by another AWS customer.</p>
+         * <p>Virtual interfaces created using this function must be confirmed by the
+         * virtual interface owner by calling ConfirmPrivateVirtualInterface. Until this
+         * step has been completed, the virtual interface will be in 'Confirming' state,
+         * and will not be available for handling traffic.</p>
+         *
+         * Returns an awaitable that starts the operation the way AllocatePrivateVirtualInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AllocatePrivateVirtualInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::AllocatePrivateVirtualInterfaceOutcome> AllocatePrivateVirtualInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AllocatePrivateVirtualInterfaceOutcome>([this, request](const std::function<void(Model::AllocatePrivateVirtualInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AllocatePrivateVirtualInterfaceAsync(request, [complete](const DirectConnectClient*, const Model::AllocatePrivateVirtualInterfaceRequest&, const Model::AllocatePrivateVirtualInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AllocatePrivateVirtualInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provisions a public virtual interface to be owned by a different
          * customer.</p> <p>The owner of a connection calls this function to provision a
@@ -305,6 +356,33 @@ namespace Model
          */
         virtual void AllocatePublicVirtualInterfaceAsync(const Model::AllocatePublicVirtualInterfaceRequest& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provisions a public virtual interface to be owned by a different
+         * customer.</p> <p>The owner of a connection calls this function to provision a
+         * public virtual interface which will be owned by another AWS customer.</p>
+         * <p>Virtual interfaces created using this function must be confirmed by the
+         * virtual interface owner by calling ConfirmPublicVirtualInterface. Until this
+         * step has been completed, the virtual interface will be in 'Confirming' state,
+         * and will not be available for handling traffic.</p>
+         *
+         * Returns an awaitable that starts the operation the way AllocatePublicVirtualInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AllocatePublicVirtualInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::AllocatePublicVirtualInterfaceOutcome> AllocatePublicVirtualInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AllocatePublicVirtualInterfaceOutcome>([this, request](const std::function<void(Model::AllocatePublicVirtualInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AllocatePublicVirtualInterfaceAsync(request, [complete](const DirectConnectClient*, const Model::AllocatePublicVirtualInterfaceRequest&, const Model::AllocatePublicVirtualInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AllocatePublicVirtualInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Confirm the creation of a hosted connection on an interconnect.</p> <p>Upon
          * creation, the hosted connection is initially in the 'Ordering' state, and will
@@ -333,6 +411,30 @@ namespace Model
          */
         virtual void ConfirmConnectionAsync(const Model::ConfirmConnectionRequest& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Confirm the creation of a hosted connection on an interconnect.</p> <p>Upon
+         * creation, the hosted connection is initially in the 'Ordering' state, and will
+         * remain in this state until the owner calls ConfirmConnection to confirm creation
+         * of the hosted connection.</p>
+         *
+         * Returns an awaitable that starts the operation the way ConfirmConnectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ConfirmConnectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::ConfirmConnectionOutcome> ConfirmConnectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ConfirmConnectionOutcome>([this, request](const std::function<void(Model::ConfirmConnectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ConfirmConnectionAsync(request, [complete](const DirectConnectClient*, const Model::ConfirmConnectionRequest&, const Model::ConfirmConnectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ConfirmConnectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Accept ownership of a private virtual interface created by another
          * customer.</p> <p>After the virtual interface owner calls this function, the
@@ -361,6 +463,30 @@ namespace Model
          */
         virtual void ConfirmPrivateVirtualInterfaceAsync(const Model::ConfirmPrivateVirtualInterfaceRequest& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Accept ownership of a private virtual interface created by another
+         * customer.</p> <p>After the virtual interface owner calls this function, the
+         * virtual interface will be created and attached to the given virtual private
+         * gateway, and will be available for handling traffic.</p>
+         *
+         * Returns an awaitable that starts the operation the way ConfirmPrivateVirtualInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ConfirmPrivateVirtualInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ConfirmPrivateVirtualInterfaceOutcome> ConfirmPrivateVirtualInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ConfirmPrivateVirtualInterfaceOutcome>([this, request](const std::function<void(Model::ConfirmPrivateVirtualInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ConfirmPrivateVirtualInterfaceAsync(request, [complete](const DirectConnectClient*, const Model::ConfirmPrivateVirtualInterfaceRequest&, const Model::ConfirmPrivateVirtualInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ConfirmPrivateVirtualInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Accept ownership of a public virtual interface created by another
          * customer.</p> <p>After the virtual interface owner calls this function, the
@@ -389,6 +515,30 @@ namespace Model
          */
         virtual void ConfirmPublicVirtualInterfaceAsync(const Model::ConfirmPublicVirtualInterfaceRequest& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Accept ownership of a public virtual interface created by another
+         * customer.</p> <p>After the virtual interface owner calls this function, the
+         * specified virtual interface will be created and made available for handling
+         * traffic.</p>
+         *
+         * Returns an awaitable that starts the operation the way ConfirmPublicVirtualInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ConfirmPublicVirtualInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ConfirmPublicVirtualInterfaceOutcome> ConfirmPublicVirtualInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ConfirmPublicVirtualInterfaceOutcome>([this, request](const std::function<void(Model::ConfirmPublicVirtualInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ConfirmPublicVirtualInterfaceAsync(request, [complete](const DirectConnectClient*, const Model::ConfirmPublicVirtualInterfaceRequest&, const Model::ConfirmPublicVirtualInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ConfirmPublicVirtualInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new connection between the customer network and a specific AWS
          * Direct Connect location.</p> <p>A connection links your internal network to an
@@ -429,6 +579,34 @@ namespace Model
          */
         virtual void CreateConnectionAsync(const Model::CreateConnectionRequest& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new connection between the customer network and a specific AWS
+         * Direct Connect location.</p> <p>A connection links your internal network to an
+         * AWS Direct Connect location over a standard 1 gigabit or 10 gigabit Ethernet
+         * fiber-optic cable. One end of the cable is connected to your router, the other
+         * to an AWS Direct Connect router. An AWS Direct Connect location provides access
+         * to Amazon Web Services in the region it is associated with. You can establish
+         * connections with AWS Direct Connect locations in multiple regions, but a
+         * connection in one region does not provide connectivity to other regions.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateConnectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateConnectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateConnectionOutcome> CreateConnectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateConnectionOutcome>([this, request](const std::function<void(Model::CreateConnectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateConnectionAsync(request, [complete](const DirectConnectClient*, const Model::CreateConnectionRequest&, const Model::CreateConnectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateConnectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new interconnect between a AWS Direct Connect partner's network and
          * a specific AWS Direct Connect location.</p> <p>An interconnect is a connection
@@ -484,6 +662,39 @@ namespace Model
          */
         virtual void CreateInterconnectAsync(const Model::CreateInterconnectRequest& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new interconnect between a AWS Direct Connect partner's network and
+         * a specific AWS Direct Connect location.</p> <p>An interconnect is a connection
+         * which is capable of hosting other connections. The AWS Direct Connect partner
+         * can use an interconnect to provide sub-1Gbps AWS Direct Connect service to tier
+         * 2 customers who do not have their own connections. Like a standard connection,
+         * an interconnect links the AWS Direct Connect partner's network to an AWS Direct
+         * Connect location over a standard 1 Gbps or 10 Gbps Ethernet fiber-optic cable.
+         * One end is connected to the partner's router, the other to an AWS Direct Connect
+         * router.</p> <p>For each end customer, the AWS Direct Connect partner provisions
+         * a connection on their interconnect by calling AllocateConnectionOnInterconnect.
+         * The end customer can then connect to AWS resources by creating a virtual
+         * interface on their connection, using the VLAN assigned to them by the AWS Direct
+         * Connect partner.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateInterconnectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateInterconnectRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateInterconnectOutcome> CreateInterconnectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateInterconnectOutcome>([this, request](const std::function<void(Model::CreateInterconnectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateInterconnectAsync(request, [complete](const DirectConnectClient*, const Model::CreateInterconnectRequest&, const Model::CreateInterconnectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateInterconnectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new private virtual interface. A virtual interface is the VLAN that
          * transports AWS Direct Connect traffic. A private virtual interface supports
@@ -509,6 +720,29 @@ namespace Model
          */
         virtual void CreatePrivateVirtualInterfaceAsync(const Model::CreatePrivateVirtualInterfaceRequest& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new private virtual interface. A virtual interface is the VLAN that
+         * transports AWS Direct Connect traffic. A private virtual interface supports
+         * sending traffic to a single virtual private cloud (VPC).</p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePrivateVirtualInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePrivateVirtualInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePrivateVirtualInterfaceOutcome> CreatePrivateVirtualInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePrivateVirtualInterfaceOutcome>([this, request](const std::function<void(Model::CreatePrivateVirtualInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePrivateVirtualInterfaceAsync(request, [complete](const DirectConnectClient*, const Model::CreatePrivateVirtualInterfaceRequest&, const Model::CreatePrivateVirtualInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePrivateVirtualInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new public virtual interface. A virtual interface is the VLAN that
          * transports AWS Direct Connect traffic. A public virtual interface supports
@@ -537,6 +771,30 @@ namespace Model
          */
         virtual void CreatePublicVirtualInterfaceAsync(const Model::CreatePublicVirtualInterfaceRequest& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new public virtual interface. A virtual interface is the VLAN that
+         * transports AWS Direct Connect traffic. A public virtual interface supports
+         * sending traffic to public services of AWS such as Amazon Simple Storage Service
+         * (Amazon S3).</p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePublicVirtualInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePublicVirtualInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePublicVirtualInterfaceOutcome> CreatePublicVirtualInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePublicVirtualInterfaceOutcome>([this, request](const std::function<void(Model::CreatePublicVirtualInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePublicVirtualInterfaceAsync(request, [complete](const DirectConnectClient*, const Model::CreatePublicVirtualInterfaceRequest&, const Model::CreatePublicVirtualInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePublicVirtualInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the connection.</p> <p>Deleting a connection only stops the AWS
          * Direct Connect port hour and data transfer charges. You need to cancel
@@ -565,6 +823,30 @@ namespace Model
          */
         virtual void DeleteConnectionAsync(const Model::DeleteConnectionRequest& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the connection.</p> <p>Deleting a connection only stops the AWS
+         * Direct Connect port hour and data transfer charges. You need to cancel
+         * separately with the providers any services or charges for cross-connects or
+         * network circuits that connect you to the AWS Direct Connect location.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteConnectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteConnectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteConnectionOutcome> DeleteConnectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteConnectionOutcome>([this, request](const std::function<void(Model::DeleteConnectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteConnectionAsync(request, [complete](const DirectConnectClient*, const Model::DeleteConnectionRequest&, const Model::DeleteConnectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteConnectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified interconnect.</p>
          */
@@ -584,6 +866,27 @@ namespace Model
          */
         virtual void DeleteInterconnectAsync(const Model::DeleteInterconnectRequest& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified interconnect.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteInterconnectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteInterconnectRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteInterconnectOutcome> DeleteInterconnectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteInterconnectOutcome>([this, request](const std::function<void(Model::DeleteInterconnectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteInterconnectAsync(request, [complete](const DirectConnectClient*, const Model::DeleteInterconnectRequest&, const Model::DeleteInterconnectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteInterconnectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a virtual interface.</p>
          */
@@ -603,6 +906,27 @@ namespace Model
          */
         virtual void DeleteVirtualInterfaceAsync(const Model::DeleteVirtualInterfaceRequest& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a virtual interface.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVirtualInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVirtualInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVirtualInterfaceOutcome> DeleteVirtualInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVirtualInterfaceOutcome>([this, request](const std::function<void(Model::DeleteVirtualInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVirtualInterfaceAsync(request, [complete](const DirectConnectClient*, const Model::DeleteVirtualInterfaceRequest&, const Model::DeleteVirtualInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVirtualInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Displays all connections in this region.</p> <p>If a connection ID is
          * provided, the call returns only that particular connection.</p>
@@ -625,6 +949,28 @@ namespace Model
          */
         virtual void DescribeConnectionsAsync(const Model::DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Displays all connections in this region.</p> <p>If a connection ID is
+         * provided, the call returns only that particular connection.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeConnectionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeConnectionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeConnectionsOutcome> DescribeConnectionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeConnectionsOutcome>([this, request](const std::function<void(Model::DescribeConnectionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeConnectionsAsync(request, [complete](const DirectConnectClient*, const Model::DescribeConnectionsRequest&, const Model::DescribeConnectionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeConnectionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Return a list of connections that have been provisioned on the given
          * interconnect.</p>
@@ -647,6 +993,28 @@ namespace Model
          */
         virtual void DescribeConnectionsOnInterconnectAsync(const Model::DescribeConnectionsOnInterconnectRequest& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Return a list of connections that have been provisioned on the given
+         * interconnect.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeConnectionsOnInterconnectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeConnectionsOnInterconnectRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeConnectionsOnInterconnectOutcome> DescribeConnectionsOnInterconnectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeConnectionsOnInterconnectOutcome>([this, request](const std::function<void(Model::DescribeConnectionsOnInterconnectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeConnectionsOnInterconnectAsync(request, [complete](const DirectConnectClient*, const Model::DescribeConnectionsOnInterconnectRequest&, const Model::DescribeConnectionsOnInterconnectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeConnectionsOnInterconnectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of interconnects owned by the AWS account.</p> <p>If an
          * interconnect ID is provided, it will only return this particular
@@ -672,6 +1040,29 @@ namespace Model
          */
         virtual void DescribeInterconnectsAsync(const Model::DescribeInterconnectsRequest& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of interconnects owned by the AWS account.</p> <p>If an
+         * interconnect ID is provided, it will only return this particular
+         * interconnect.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeInterconnectsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeInterconnectsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeInterconnectsOutcome> DescribeInterconnectsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeInterconnectsOutcome>([this, request](const std::function<void(Model::DescribeInterconnectsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeInterconnectsAsync(request, [complete](const DirectConnectClient*, const Model::DescribeInterconnectsRequest&, const Model::DescribeInterconnectsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeInterconnectsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the list of AWS Direct Connect locations in the current AWS region.
          * These are the locations that may be selected when calling CreateConnection or
@@ -696,6 +1087,28 @@ namespace Model
          * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
         virtual void DescribeLocationsAsync(const DescribeLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the list of AWS Direct Connect locations in the current AWS region.
+         * These are the locations that may be selected when calling CreateConnection or
+         * CreateInterconnect.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLocationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        Aws::Utils::Threading::Awaitable<Model::DescribeLocationsOutcome> DescribeLocationsAwaitable() const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLocationsOutcome>([this](const std::function<void(Model::DescribeLocationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLocationsAsync([complete](const DirectConnectClient*, const Model::DescribeLocationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLocationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
         /**
          * <p>Returns a list of virtual private gateways owned by the AWS account.</p>
          * <p>You can create one or more AWS Direct Connect private virtual interfaces
@@ -729,6 +1142,31 @@ namespace Model
          * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
         virtual void DescribeVirtualGatewaysAsync(const DescribeVirtualGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of virtual private gateways owned by the AWS account.</p>
+         * <p>You can create one or more AWS Direct Connect private virtual interfaces
+         * linking to a virtual private gateway. A virtual private gateway can be managed
+         * via Amazon Virtual Private Cloud (VPC) console or the <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/APIReference/ApiReference-query-CreateVpnGateway.html">EC2
+         * CreateVpnGateway</a> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVirtualGatewaysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        Aws::Utils::Threading::Awaitable<Model::DescribeVirtualGatewaysOutcome> DescribeVirtualGatewaysAwaitable() const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVirtualGatewaysOutcome>([this](const std::function<void(Model::DescribeVirtualGatewaysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVirtualGatewaysAsync([complete](const DirectConnectClient*, const Model::DescribeVirtualGatewaysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVirtualGatewaysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
         /**
          * <p>Displays all virtual interfaces for an AWS account. Virtual interfaces
          * deleted fewer than 15 minutes before DescribeVirtualInterfaces is called are
@@ -772,6 +1210,35 @@ namespace Model
          */
         virtual void DescribeVirtualInterfacesAsync(const Model::DescribeVirtualInterfacesRequest& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Displays all virtual interfaces for an AWS account. Virtual interfaces
+         * deleted fewer than 15 minutes before DescribeVirtualInterfaces is called are
+         * also returned. If a connection ID is included then only virtual interfaces
+         * associated with this connection will be returned. If a virtual interface ID is
+         * included then only a single virtual interface will be returned.</p> <p>A virtual
+         * interface (VLAN) transmits the traffic between the AWS Direct Connect location
+         * and the customer.</p> <p>If a connection ID is provided, only virtual interfaces
+         * provisioned on the specified connection will be returned. If a virtual interface
+         * ID is provided, only this particular virtual interface will be returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVirtualInterfacesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVirtualInterfacesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVirtualInterfacesOutcome> DescribeVirtualInterfacesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVirtualInterfacesOutcome>([this, request](const std::function<void(Model::DescribeVirtualInterfacesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVirtualInterfacesAsync(request, [complete](const DirectConnectClient*, const Model::DescribeVirtualInterfacesRequest&, const Model::DescribeVirtualInterfacesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVirtualInterfacesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -50,6 +50,7 @@
 #include <aws/dms/model/StopReplicationTaskResult.h>
 #include <aws/dms/model/TestConnectionResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -272,6 +273,27 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>For internal use only</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsToResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsToResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsToResourceOutcome>([this, request](const std::function<void(Model::AddTagsToResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsToResourceAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::AddTagsToResourceRequest&, const Model::AddTagsToResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsToResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an endpoint using the provided settings.</p> <note/><p/>
          */
@@ -291,6 +313,27 @@ namespace Model
          */
         virtual void CreateEndpointAsync(const Model::CreateEndpointRequest& request, const CreateEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an endpoint using the provided settings.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way CreateEndpointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateEndpointRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateEndpointOutcome> CreateEndpointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateEndpointOutcome>([this, request](const std::function<void(Model::CreateEndpointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateEndpointAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::CreateEndpointRequest&, const Model::CreateEndpointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateEndpointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates the replication instance using the specified parameters.</p>
          * <note/><p/>
@@ -313,6 +356,28 @@ namespace Model
          */
         virtual void CreateReplicationInstanceAsync(const Model::CreateReplicationInstanceRequest& request, const CreateReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates the replication instance using the specified parameters.</p>
+         * <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way CreateReplicationInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateReplicationInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateReplicationInstanceOutcome> CreateReplicationInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateReplicationInstanceOutcome>([this, request](const std::function<void(Model::CreateReplicationInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateReplicationInstanceAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::CreateReplicationInstanceRequest&, const Model::CreateReplicationInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateReplicationInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a replication subnet group given a list of the subnet IDs in a
          * VPC.</p> <note/><p/>
@@ -335,6 +400,28 @@ namespace Model
          */
         virtual void CreateReplicationSubnetGroupAsync(const Model::CreateReplicationSubnetGroupRequest& request, const CreateReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a replication subnet group given a list of the subnet IDs in a
+         * VPC.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way CreateReplicationSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateReplicationSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateReplicationSubnetGroupOutcome> CreateReplicationSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateReplicationSubnetGroupOutcome>([this, request](const std::function<void(Model::CreateReplicationSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateReplicationSubnetGroupAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::CreateReplicationSubnetGroupRequest&, const Model::CreateReplicationSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateReplicationSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a replication task using the specified parameters.</p> <note/><p/>
          */
@@ -354,6 +441,27 @@ namespace Model
          */
         virtual void CreateReplicationTaskAsync(const Model::CreateReplicationTaskRequest& request, const CreateReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a replication task using the specified parameters.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way CreateReplicationTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateReplicationTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateReplicationTaskOutcome> CreateReplicationTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateReplicationTaskOutcome>([this, request](const std::function<void(Model::CreateReplicationTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateReplicationTaskAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::CreateReplicationTaskRequest&, const Model::CreateReplicationTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateReplicationTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified endpoint. </p> <note>All tasks associated with the
          * endpoint must be deleted before you can delete the endpoint.</note><p/>
@@ -376,6 +484,28 @@ namespace Model
          */
         virtual void DeleteEndpointAsync(const Model::DeleteEndpointRequest& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified endpoint. </p> <note>All tasks associated with the
+         * endpoint must be deleted before you can delete the endpoint.</note><p/>
+         *
+         * Returns an awaitable that starts the operation the way DeleteEndpointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteEndpointRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteEndpointOutcome> DeleteEndpointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteEndpointOutcome>([this, request](const std::function<void(Model::DeleteEndpointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteEndpointAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DeleteEndpointRequest&, const Model::DeleteEndpointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteEndpointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified replication instance. </p> <note>You must delete any
          * migration tasks that are associated with the replication instance before you can
@@ -401,6 +531,29 @@ namespace Model
          */
         virtual void DeleteReplicationInstanceAsync(const Model::DeleteReplicationInstanceRequest& request, const DeleteReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified replication instance. </p> <note>You must delete any
+         * migration tasks that are associated with the replication instance before you can
+         * delete it.</note><p/>
+         *
+         * Returns an awaitable that starts the operation the way DeleteReplicationInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteReplicationInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteReplicationInstanceOutcome> DeleteReplicationInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteReplicationInstanceOutcome>([this, request](const std::function<void(Model::DeleteReplicationInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteReplicationInstanceAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DeleteReplicationInstanceRequest&, const Model::DeleteReplicationInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteReplicationInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a subnet group.</p> <note/><p/>
          */
@@ -420,6 +573,27 @@ namespace Model
          */
         virtual void DeleteReplicationSubnetGroupAsync(const Model::DeleteReplicationSubnetGroupRequest& request, const DeleteReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a subnet group.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DeleteReplicationSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteReplicationSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteReplicationSubnetGroupOutcome> DeleteReplicationSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteReplicationSubnetGroupOutcome>([this, request](const std::function<void(Model::DeleteReplicationSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteReplicationSubnetGroupAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DeleteReplicationSubnetGroupRequest&, const Model::DeleteReplicationSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteReplicationSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified replication task.</p> <note/><p/>
          */
@@ -439,6 +613,27 @@ namespace Model
          */
         virtual void DeleteReplicationTaskAsync(const Model::DeleteReplicationTaskRequest& request, const DeleteReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified replication task.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DeleteReplicationTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteReplicationTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteReplicationTaskOutcome> DeleteReplicationTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteReplicationTaskOutcome>([this, request](const std::function<void(Model::DeleteReplicationTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteReplicationTaskAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DeleteReplicationTaskRequest&, const Model::DeleteReplicationTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteReplicationTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all of the AWS DMS attributes for a customer account. The attributes
          * include AWS DMS quotas for the account, such as the number of replication
@@ -470,6 +665,31 @@ namespace Model
          */
         virtual void DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all of the AWS DMS attributes for a customer account. The attributes
+         * include AWS DMS quotas for the account, such as the number of replication
+         * instances allowed. The description for a quota includes the quota name, current
+         * usage toward that quota, and the quota's maximum value. </p> <p>This command
+         * does not take any parameters.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAccountAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAccountAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAccountAttributesOutcome> DescribeAccountAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAccountAttributesOutcome>([this, request](const std::function<void(Model::DescribeAccountAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAccountAttributesAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeAccountAttributesRequest&, const Model::DescribeAccountAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAccountAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the status of the connections that have been made between the
          * replication instance and an endpoint. Connections are created when you test an
@@ -495,6 +715,29 @@ namespace Model
          */
         virtual void DescribeConnectionsAsync(const Model::DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the status of the connections that have been made between the
+         * replication instance and an endpoint. Connections are created when you test an
+         * endpoint.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeConnectionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeConnectionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeConnectionsOutcome> DescribeConnectionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeConnectionsOutcome>([this, request](const std::function<void(Model::DescribeConnectionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeConnectionsAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeConnectionsRequest&, const Model::DescribeConnectionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeConnectionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the type of endpoints available.</p> <note/> <p/>
          */
@@ -514,6 +757,27 @@ namespace Model
          */
         virtual void DescribeEndpointTypesAsync(const Model::DescribeEndpointTypesRequest& request, const DescribeEndpointTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the type of endpoints available.</p> <note/> <p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEndpointTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEndpointTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEndpointTypesOutcome> DescribeEndpointTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEndpointTypesOutcome>([this, request](const std::function<void(Model::DescribeEndpointTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEndpointTypesAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeEndpointTypesRequest&, const Model::DescribeEndpointTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEndpointTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the endpoints for your account in the current
          * region.</p> <note/><p/>
@@ -536,6 +800,28 @@ namespace Model
          */
         virtual void DescribeEndpointsAsync(const Model::DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the endpoints for your account in the current
+         * region.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEndpointsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEndpointsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEndpointsOutcome> DescribeEndpointsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEndpointsOutcome>([this, request](const std::function<void(Model::DescribeEndpointsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEndpointsAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeEndpointsRequest&, const Model::DescribeEndpointsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEndpointsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the replication instance types that can be created
          * in the specified region.</p> <note/><p/>
@@ -558,6 +844,28 @@ namespace Model
          */
         virtual void DescribeOrderableReplicationInstancesAsync(const Model::DescribeOrderableReplicationInstancesRequest& request, const DescribeOrderableReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the replication instance types that can be created
+         * in the specified region.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeOrderableReplicationInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeOrderableReplicationInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeOrderableReplicationInstancesOutcome> DescribeOrderableReplicationInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeOrderableReplicationInstancesOutcome>([this, request](const std::function<void(Model::DescribeOrderableReplicationInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeOrderableReplicationInstancesAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeOrderableReplicationInstancesRequest&, const Model::DescribeOrderableReplicationInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeOrderableReplicationInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the status of the RefreshSchemas operation.</p> <note/><p/>
          */
@@ -577,6 +885,27 @@ namespace Model
          */
         virtual void DescribeRefreshSchemasStatusAsync(const Model::DescribeRefreshSchemasStatusRequest& request, const DescribeRefreshSchemasStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the status of the RefreshSchemas operation.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeRefreshSchemasStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeRefreshSchemasStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeRefreshSchemasStatusOutcome> DescribeRefreshSchemasStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeRefreshSchemasStatusOutcome>([this, request](const std::function<void(Model::DescribeRefreshSchemasStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeRefreshSchemasStatusAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeRefreshSchemasStatusRequest&, const Model::DescribeRefreshSchemasStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeRefreshSchemasStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about replication instances for your account in the
          * current region.</p> <note/><p/>
@@ -599,6 +928,28 @@ namespace Model
          */
         virtual void DescribeReplicationInstancesAsync(const Model::DescribeReplicationInstancesRequest& request, const DescribeReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about replication instances for your account in the
+         * current region.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReplicationInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReplicationInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReplicationInstancesOutcome> DescribeReplicationInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReplicationInstancesOutcome>([this, request](const std::function<void(Model::DescribeReplicationInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReplicationInstancesAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeReplicationInstancesRequest&, const Model::DescribeReplicationInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReplicationInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the replication subnet groups.</p> <note/><p/>
          */
@@ -618,6 +969,27 @@ namespace Model
          */
         virtual void DescribeReplicationSubnetGroupsAsync(const Model::DescribeReplicationSubnetGroupsRequest& request, const DescribeReplicationSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the replication subnet groups.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReplicationSubnetGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReplicationSubnetGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReplicationSubnetGroupsOutcome> DescribeReplicationSubnetGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReplicationSubnetGroupsOutcome>([this, request](const std::function<void(Model::DescribeReplicationSubnetGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReplicationSubnetGroupsAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeReplicationSubnetGroupsRequest&, const Model::DescribeReplicationSubnetGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReplicationSubnetGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about replication tasks for your account in the current
          * region.</p> <note/><p/>
@@ -640,6 +1012,28 @@ namespace Model
          */
         virtual void DescribeReplicationTasksAsync(const Model::DescribeReplicationTasksRequest& request, const DescribeReplicationTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about replication tasks for your account in the current
+         * region.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReplicationTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReplicationTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReplicationTasksOutcome> DescribeReplicationTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReplicationTasksOutcome>([this, request](const std::function<void(Model::DescribeReplicationTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReplicationTasksAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeReplicationTasksRequest&, const Model::DescribeReplicationTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReplicationTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the schema for the specified endpoint.</p>
          * <note/><p/>
@@ -662,6 +1056,28 @@ namespace Model
          */
         virtual void DescribeSchemasAsync(const Model::DescribeSchemasRequest& request, const DescribeSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the schema for the specified endpoint.</p>
+         * <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSchemasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSchemasRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSchemasOutcome> DescribeSchemasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSchemasOutcome>([this, request](const std::function<void(Model::DescribeSchemasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSchemasAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeSchemasRequest&, const Model::DescribeSchemasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSchemasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns table statistics on the database migration task, including table
          * name, rows inserted, rows updated, and rows deleted.</p> <note/><p/>
@@ -684,6 +1100,28 @@ namespace Model
          */
         virtual void DescribeTableStatisticsAsync(const Model::DescribeTableStatisticsRequest& request, const DescribeTableStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns table statistics on the database migration task, including table
+         * name, rows inserted, rows updated, and rows deleted.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTableStatisticsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTableStatisticsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTableStatisticsOutcome> DescribeTableStatisticsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTableStatisticsOutcome>([this, request](const std::function<void(Model::DescribeTableStatisticsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTableStatisticsAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::DescribeTableStatisticsRequest&, const Model::DescribeTableStatisticsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTableStatisticsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>For internal use only</p> <note/><p/>
          */
@@ -703,6 +1141,27 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>For internal use only</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way ListTagsForResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsForResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome>([this, request](const std::function<void(Model::ListTagsForResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsForResourceAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::ListTagsForResourceRequest&, const Model::ListTagsForResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsForResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the specified endpoint.</p> <note/><p/>
          */
@@ -722,6 +1181,27 @@ namespace Model
          */
         virtual void ModifyEndpointAsync(const Model::ModifyEndpointRequest& request, const ModifyEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the specified endpoint.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way ModifyEndpointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyEndpointRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyEndpointOutcome> ModifyEndpointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyEndpointOutcome>([this, request](const std::function<void(Model::ModifyEndpointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyEndpointAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::ModifyEndpointRequest&, const Model::ModifyEndpointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyEndpointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the replication instance to apply new settings. You can change one
          * or more parameters by specifying these parameters and the new values in the
@@ -750,6 +1230,30 @@ namespace Model
          */
         virtual void ModifyReplicationInstanceAsync(const Model::ModifyReplicationInstanceRequest& request, const ModifyReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the replication instance to apply new settings. You can change one
+         * or more parameters by specifying these parameters and the new values in the
+         * request.</p> <note>Some settings are applied during the maintenance
+         * window.</note><p/> <p/>
+         *
+         * Returns an awaitable that starts the operation the way ModifyReplicationInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyReplicationInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyReplicationInstanceOutcome> ModifyReplicationInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyReplicationInstanceOutcome>([this, request](const std::function<void(Model::ModifyReplicationInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyReplicationInstanceAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::ModifyReplicationInstanceRequest&, const Model::ModifyReplicationInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyReplicationInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the settings for the specified replication subnet group.</p>
          * <note/><p/>
@@ -772,6 +1276,28 @@ namespace Model
          */
         virtual void ModifyReplicationSubnetGroupAsync(const Model::ModifyReplicationSubnetGroupRequest& request, const ModifyReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the settings for the specified replication subnet group.</p>
+         * <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way ModifyReplicationSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyReplicationSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyReplicationSubnetGroupOutcome> ModifyReplicationSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyReplicationSubnetGroupOutcome>([this, request](const std::function<void(Model::ModifyReplicationSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyReplicationSubnetGroupAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::ModifyReplicationSubnetGroupRequest&, const Model::ModifyReplicationSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyReplicationSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Populates the schema for the specified endpoint. This is an asynchronous
          * operation and can take several minutes. You can check the status of this
@@ -797,6 +1323,29 @@ namespace Model
          */
         virtual void RefreshSchemasAsync(const Model::RefreshSchemasRequest& request, const RefreshSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Populates the schema for the specified endpoint. This is an asynchronous
+         * operation and can take several minutes. You can check the status of this
+         * operation by calling the DescribeRefreshSchemasStatus operation.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way RefreshSchemasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RefreshSchemasRequest>
+        Aws::Utils::Threading::Awaitable<Model::RefreshSchemasOutcome> RefreshSchemasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RefreshSchemasOutcome>([this, request](const std::function<void(Model::RefreshSchemasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RefreshSchemasAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::RefreshSchemasRequest&, const Model::RefreshSchemasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RefreshSchemasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>For internal use only</p> <note/><p/>
          */
@@ -816,6 +1365,27 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>For internal use only</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsFromResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsFromResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromResourceOutcome>([this, request](const std::function<void(Model::RemoveTagsFromResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsFromResourceAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::RemoveTagsFromResourceRequest&, const Model::RemoveTagsFromResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsFromResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts the replication task.</p> <note/><p/>
          */
@@ -835,6 +1405,27 @@ namespace Model
          */
         virtual void StartReplicationTaskAsync(const Model::StartReplicationTaskRequest& request, const StartReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts the replication task.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way StartReplicationTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartReplicationTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartReplicationTaskOutcome> StartReplicationTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartReplicationTaskOutcome>([this, request](const std::function<void(Model::StartReplicationTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartReplicationTaskAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::StartReplicationTaskRequest&, const Model::StartReplicationTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartReplicationTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Stops the replication task.</p> <note/><p/>
          */
@@ -854,6 +1445,27 @@ namespace Model
          */
         virtual void StopReplicationTaskAsync(const Model::StopReplicationTaskRequest& request, const StopReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Stops the replication task.</p> <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way StopReplicationTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StopReplicationTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::StopReplicationTaskOutcome> StopReplicationTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StopReplicationTaskOutcome>([this, request](const std::function<void(Model::StopReplicationTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StopReplicationTaskAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::StopReplicationTaskRequest&, const Model::StopReplicationTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StopReplicationTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Tests the connection between the replication instance and the endpoint. </p>
          * <note/><p/>
@@ -876,6 +1488,28 @@ namespace Model
          */
         virtual void TestConnectionAsync(const Model::TestConnectionRequest& request, const TestConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Tests the connection between the replication instance and the endpoint. </p>
+         * <note/><p/>
+         *
+         * Returns an awaitable that starts the operation the way TestConnectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TestConnectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::TestConnectionOutcome> TestConnectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TestConnectionOutcome>([this, request](const std::function<void(Model::TestConnectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TestConnectionAsync(request, [complete](const DatabaseMigrationServiceClient*, const Model::TestConnectionRequest&, const Model::TestConnectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TestConnectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -46,6 +46,7 @@
 #include <aws/ds/model/UpdateRadiusResult.h>
 #include <aws/ds/model/VerifyTrustResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -248,6 +249,27 @@ namespace Model
          */
         virtual void ConnectDirectoryAsync(const Model::ConnectDirectoryRequest& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an AD Connector to connect to an on-premises directory.</p>
+         *
+         * Returns an awaitable that starts the operation the way ConnectDirectoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ConnectDirectoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::ConnectDirectoryOutcome> ConnectDirectoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ConnectDirectoryOutcome>([this, request](const std::function<void(Model::ConnectDirectoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ConnectDirectoryAsync(request, [complete](const DirectoryServiceClient*, const Model::ConnectDirectoryRequest&, const Model::ConnectDirectoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ConnectDirectoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an alias for a directory and assigns the alias to the directory. The
          * alias is used to construct the access URL for the directory, such as
@@ -282,6 +304,32 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an alias for a directory and assigns the alias to the directory. The
+         * alias is used to construct the access URL for the directory, such as
+         * <code>http://<![CDATA[&#x3C;]]>alias<![CDATA[&#x3E;]]>.awsapps.com</code>.</p>
+         * <important> <p>After an alias has been created, it cannot be deleted or reused,
+         * so this operation should only be used when absolutely necessary.</p>
+         * </important>
+         *
+         * Returns an awaitable that starts the operation the way CreateAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAliasOutcome>([this, request](const std::function<void(Model::CreateAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAliasAsync(request, [complete](const DirectoryServiceClient*, const Model::CreateAliasRequest&, const Model::CreateAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a computer account in the specified directory, and joins the computer
          * to the directory.</p>
@@ -304,6 +352,28 @@ namespace Model
          */
         virtual void CreateComputerAsync(const Model::CreateComputerRequest& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a computer account in the specified directory, and joins the computer
+         * to the directory.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateComputerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateComputerRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateComputerOutcome> CreateComputerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateComputerOutcome>([this, request](const std::function<void(Model::CreateComputerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateComputerAsync(request, [complete](const DirectoryServiceClient*, const Model::CreateComputerRequest&, const Model::CreateComputerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateComputerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a Simple AD directory.</p>
          */
@@ -323,6 +393,27 @@ namespace Model
          */
         virtual void CreateDirectoryAsync(const Model::CreateDirectoryRequest& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a Simple AD directory.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDirectoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDirectoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDirectoryOutcome> CreateDirectoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDirectoryOutcome>([this, request](const std::function<void(Model::CreateDirectoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDirectoryAsync(request, [complete](const DirectoryServiceClient*, const Model::CreateDirectoryRequest&, const Model::CreateDirectoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDirectoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Creates a Microsoft AD in the AWS cloud.
          */
@@ -342,6 +433,27 @@ namespace Model
          */
         virtual void CreateMicrosoftADAsync(const Model::CreateMicrosoftADRequest& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Creates a Microsoft AD in the AWS cloud.
+         *
+         * Returns an awaitable that starts the operation the way CreateMicrosoftADAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateMicrosoftADRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateMicrosoftADOutcome> CreateMicrosoftADAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateMicrosoftADOutcome>([this, request](const std::function<void(Model::CreateMicrosoftADOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateMicrosoftADAsync(request, [complete](const DirectoryServiceClient*, const Model::CreateMicrosoftADRequest&, const Model::CreateMicrosoftADOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateMicrosoftADOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a snapshot of a Simple AD or Microsoft AD directory in the AWS
          * cloud.</p> <note> <p>You cannot take snapshots of AD Connector directories.</p>
@@ -367,6 +479,29 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a snapshot of a Simple AD or Microsoft AD directory in the AWS
+         * cloud.</p> <note> <p>You cannot take snapshots of AD Connector directories.</p>
+         * </note>
+         *
+         * Returns an awaitable that starts the operation the way CreateSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSnapshotOutcome>([this, request](const std::function<void(Model::CreateSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSnapshotAsync(request, [complete](const DirectoryServiceClient*, const Model::CreateSnapshotRequest&, const Model::CreateSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>AWS Directory Service for Microsoft Active Directory allows you to configure
          * trust relationships. For example, you can establish a trust between your
@@ -404,6 +539,33 @@ namespace Model
          */
         virtual void CreateTrustAsync(const Model::CreateTrustRequest& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>AWS Directory Service for Microsoft Active Directory allows you to configure
+         * trust relationships. For example, you can establish a trust between your
+         * Microsoft AD in the AWS cloud, and your existing on-premises Microsoft Active
+         * Directory. This would allow you to provide users and groups access to resources
+         * in either domain, with a single set of credentials.</p><p>This action initiates
+         * the creation of the AWS side of a trust relationship between a Microsoft AD in
+         * the AWS cloud and an external domain.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateTrustAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTrustRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTrustOutcome> CreateTrustAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTrustOutcome>([this, request](const std::function<void(Model::CreateTrustOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTrustAsync(request, [complete](const DirectoryServiceClient*, const Model::CreateTrustRequest&, const Model::CreateTrustOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTrustOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an AWS Directory Service directory.</p>
          */
@@ -423,6 +585,27 @@ namespace Model
          */
         virtual void DeleteDirectoryAsync(const Model::DeleteDirectoryRequest& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an AWS Directory Service directory.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDirectoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDirectoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDirectoryOutcome> DeleteDirectoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDirectoryOutcome>([this, request](const std::function<void(Model::DeleteDirectoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDirectoryAsync(request, [complete](const DirectoryServiceClient*, const Model::DeleteDirectoryRequest&, const Model::DeleteDirectoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDirectoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a directory snapshot.</p>
          */
@@ -442,6 +625,27 @@ namespace Model
          */
         virtual void DeleteSnapshotAsync(const Model::DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a directory snapshot.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSnapshotOutcome>([this, request](const std::function<void(Model::DeleteSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSnapshotAsync(request, [complete](const DirectoryServiceClient*, const Model::DeleteSnapshotRequest&, const Model::DeleteSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Deletes an existing trust relationship between your Microsoft AD in the AWS
          * cloud and an external domain.
@@ -464,6 +668,28 @@ namespace Model
          */
         virtual void DeleteTrustAsync(const Model::DeleteTrustRequest& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Deletes an existing trust relationship between your Microsoft AD in the AWS
+         * cloud and an external domain.
+         *
+         * Returns an awaitable that starts the operation the way DeleteTrustAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTrustRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTrustOutcome> DeleteTrustAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTrustOutcome>([this, request](const std::function<void(Model::DeleteTrustOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTrustAsync(request, [complete](const DirectoryServiceClient*, const Model::DeleteTrustRequest&, const Model::DeleteTrustOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTrustOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified directory as a publisher to the specified SNS
          * topic.</p>
@@ -486,6 +712,28 @@ namespace Model
          */
         virtual void DeregisterEventTopicAsync(const Model::DeregisterEventTopicRequest& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified directory as a publisher to the specified SNS
+         * topic.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterEventTopicAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterEventTopicRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterEventTopicOutcome> DeregisterEventTopicAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterEventTopicOutcome>([this, request](const std::function<void(Model::DeregisterEventTopicOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterEventTopicAsync(request, [complete](const DirectoryServiceClient*, const Model::DeregisterEventTopicRequest&, const Model::DeregisterEventTopicOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterEventTopicOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Obtains information about the directories that belong to this account.</p>
          * <p>You can retrieve information about specific directories by passing the
@@ -532,6 +780,36 @@ namespace Model
          */
         virtual void DescribeDirectoriesAsync(const Model::DescribeDirectoriesRequest& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Obtains information about the directories that belong to this account.</p>
+         * <p>You can retrieve information about specific directories by passing the
+         * directory identifiers in the <i>DirectoryIds</i> parameter. Otherwise, all
+         * directories that belong to the current account are returned.</p> <p>This
+         * operation supports pagination with the use of the <i>NextToken</i> request and
+         * response parameters. If more results are available, the
+         * <i>DescribeDirectoriesResult.NextToken</i> member contains a token that you pass
+         * in the next call to <a>DescribeDirectories</a> to retrieve the next set of
+         * items.</p> <p>You can also specify a maximum number of return results with the
+         * <i>Limit</i> parameter.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDirectoriesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDirectoriesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDirectoriesOutcome> DescribeDirectoriesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDirectoriesOutcome>([this, request](const std::function<void(Model::DescribeDirectoriesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDirectoriesAsync(request, [complete](const DirectoryServiceClient*, const Model::DescribeDirectoriesRequest&, const Model::DescribeDirectoriesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDirectoriesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Obtains information about which SNS topics receive status messages from the
          * specified directory.</p> <p>If no input parameters are provided, such as
@@ -560,6 +838,30 @@ namespace Model
          */
         virtual void DescribeEventTopicsAsync(const Model::DescribeEventTopicsRequest& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Obtains information about which SNS topics receive status messages from the
+         * specified directory.</p> <p>If no input parameters are provided, such as
+         * DirectoryId or TopicName, this request describes all of the associations in the
+         * account.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEventTopicsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEventTopicsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEventTopicsOutcome> DescribeEventTopicsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEventTopicsOutcome>([this, request](const std::function<void(Model::DescribeEventTopicsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEventTopicsAsync(request, [complete](const DirectoryServiceClient*, const Model::DescribeEventTopicsRequest&, const Model::DescribeEventTopicsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEventTopicsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Obtains information about the directory snapshots that belong to this
          * account.</p> <p>This operation supports pagination with the use of the
@@ -597,6 +899,33 @@ namespace Model
          */
         virtual void DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Obtains information about the directory snapshots that belong to this
+         * account.</p> <p>This operation supports pagination with the use of the
+         * <i>NextToken</i> request and response parameters. If more results are available,
+         * the <i>DescribeSnapshots.NextToken</i> member contains a token that you pass in
+         * the next call to <a>DescribeSnapshots</a> to retrieve the next set of items.</p>
+         * <p>You can also specify a maximum number of return results with the <i>Limit</i>
+         * parameter.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSnapshotsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSnapshotsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotsOutcome>([this, request](const std::function<void(Model::DescribeSnapshotsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSnapshotsAsync(request, [complete](const DirectoryServiceClient*, const Model::DescribeSnapshotsRequest&, const Model::DescribeSnapshotsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSnapshotsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Obtains information about the trust relationships for this account.</p> <p>If
          * no input parameters are provided, such as DirectoryId or TrustIds, this request
@@ -622,6 +951,29 @@ namespace Model
          */
         virtual void DescribeTrustsAsync(const Model::DescribeTrustsRequest& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Obtains information about the trust relationships for this account.</p> <p>If
+         * no input parameters are provided, such as DirectoryId or TrustIds, this request
+         * describes all the trust relationships belonging to the account.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTrustsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTrustsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTrustsOutcome> DescribeTrustsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTrustsOutcome>([this, request](const std::function<void(Model::DescribeTrustsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTrustsAsync(request, [complete](const DirectoryServiceClient*, const Model::DescribeTrustsRequest&, const Model::DescribeTrustsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTrustsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables multi-factor authentication (MFA) with the Remote Authentication
          * Dial In User Service (RADIUS) server for an AD Connector directory.</p>
@@ -644,6 +996,28 @@ namespace Model
          */
         virtual void DisableRadiusAsync(const Model::DisableRadiusRequest& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables multi-factor authentication (MFA) with the Remote Authentication
+         * Dial In User Service (RADIUS) server for an AD Connector directory.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableRadiusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableRadiusRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableRadiusOutcome> DisableRadiusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableRadiusOutcome>([this, request](const std::function<void(Model::DisableRadiusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableRadiusAsync(request, [complete](const DirectoryServiceClient*, const Model::DisableRadiusRequest&, const Model::DisableRadiusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableRadiusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables single-sign on for a directory.</p>
          */
@@ -663,6 +1037,27 @@ namespace Model
          */
         virtual void DisableSsoAsync(const Model::DisableSsoRequest& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables single-sign on for a directory.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableSsoAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableSsoRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableSsoOutcome> DisableSsoAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableSsoOutcome>([this, request](const std::function<void(Model::DisableSsoOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableSsoAsync(request, [complete](const DirectoryServiceClient*, const Model::DisableSsoRequest&, const Model::DisableSsoOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableSsoOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables multi-factor authentication (MFA) with the Remote Authentication Dial
          * In User Service (RADIUS) server for an AD Connector directory.</p>
@@ -685,6 +1080,28 @@ namespace Model
          */
         virtual void EnableRadiusAsync(const Model::EnableRadiusRequest& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables multi-factor authentication (MFA) with the Remote Authentication Dial
+         * In User Service (RADIUS) server for an AD Connector directory.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableRadiusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableRadiusRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableRadiusOutcome> EnableRadiusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableRadiusOutcome>([this, request](const std::function<void(Model::EnableRadiusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableRadiusAsync(request, [complete](const DirectoryServiceClient*, const Model::EnableRadiusRequest&, const Model::EnableRadiusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableRadiusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables single-sign on for a directory.</p>
          */
@@ -704,6 +1121,27 @@ namespace Model
          */
         virtual void EnableSsoAsync(const Model::EnableSsoRequest& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables single-sign on for a directory.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableSsoAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableSsoRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableSsoOutcome> EnableSsoAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableSsoOutcome>([this, request](const std::function<void(Model::EnableSsoOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableSsoAsync(request, [complete](const DirectoryServiceClient*, const Model::EnableSsoRequest&, const Model::EnableSsoOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableSsoOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Obtains directory limit information for the current region.</p>
          */
@@ -723,6 +1161,27 @@ namespace Model
          */
         virtual void GetDirectoryLimitsAsync(const Model::GetDirectoryLimitsRequest& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Obtains directory limit information for the current region.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDirectoryLimitsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDirectoryLimitsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDirectoryLimitsOutcome> GetDirectoryLimitsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDirectoryLimitsOutcome>([this, request](const std::function<void(Model::GetDirectoryLimitsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDirectoryLimitsAsync(request, [complete](const DirectoryServiceClient*, const Model::GetDirectoryLimitsRequest&, const Model::GetDirectoryLimitsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDirectoryLimitsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Obtains the manual snapshot limits for a directory.</p>
          */
@@ -742,6 +1201,27 @@ namespace Model
          */
         virtual void GetSnapshotLimitsAsync(const Model::GetSnapshotLimitsRequest& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Obtains the manual snapshot limits for a directory.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetSnapshotLimitsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetSnapshotLimitsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetSnapshotLimitsOutcome> GetSnapshotLimitsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetSnapshotLimitsOutcome>([this, request](const std::function<void(Model::GetSnapshotLimitsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetSnapshotLimitsAsync(request, [complete](const DirectoryServiceClient*, const Model::GetSnapshotLimitsRequest&, const Model::GetSnapshotLimitsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetSnapshotLimitsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Associates a directory with an SNS topic. This establishes the directory as a
          * publisher to the specified SNS topic. You can then receive email or text (SMS)
@@ -773,6 +1253,31 @@ namespace Model
          */
         virtual void RegisterEventTopicAsync(const Model::RegisterEventTopicRequest& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Associates a directory with an SNS topic. This establishes the directory as a
+         * publisher to the specified SNS topic. You can then receive email or text (SMS)
+         * messages when the status of your directory changes. You get notified if your
+         * directory goes from an Active status to an Impaired or Inoperable status. You
+         * also receive a notification when the directory returns to an Active status. </p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterEventTopicAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterEventTopicRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterEventTopicOutcome> RegisterEventTopicAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterEventTopicOutcome>([this, request](const std::function<void(Model::RegisterEventTopicOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterEventTopicAsync(request, [complete](const DirectoryServiceClient*, const Model::RegisterEventTopicRequest&, const Model::RegisterEventTopicOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterEventTopicOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Restores a directory using an existing directory snapshot.</p> <p>When you
          * restore a directory from a snapshot, any changes made to the directory after the
@@ -810,6 +1315,33 @@ namespace Model
          */
         virtual void RestoreFromSnapshotAsync(const Model::RestoreFromSnapshotRequest& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Restores a directory using an existing directory snapshot.</p> <p>When you
+         * restore a directory from a snapshot, any changes made to the directory after the
+         * snapshot date are overwritten.</p> <p>This action returns as soon as the restore
+         * operation is initiated. You can monitor the progress of the restore operation by
+         * calling the <a>DescribeDirectories</a> operation with the directory identifier.
+         * When the <b>DirectoryDescription.Stage</b> value changes to <code>Active</code>,
+         * the restore operation is complete.</p>
+         *
+         * Returns an awaitable that starts the operation the way RestoreFromSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RestoreFromSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::RestoreFromSnapshotOutcome> RestoreFromSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RestoreFromSnapshotOutcome>([this, request](const std::function<void(Model::RestoreFromSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RestoreFromSnapshotAsync(request, [complete](const DirectoryServiceClient*, const Model::RestoreFromSnapshotRequest&, const Model::RestoreFromSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RestoreFromSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the Remote Authentication Dial In User Service (RADIUS) server
          * information for an AD Connector directory.</p>
@@ -832,6 +1364,28 @@ namespace Model
          */
         virtual void UpdateRadiusAsync(const Model::UpdateRadiusRequest& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the Remote Authentication Dial In User Service (RADIUS) server
+         * information for an AD Connector directory.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateRadiusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateRadiusRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateRadiusOutcome> UpdateRadiusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateRadiusOutcome>([this, request](const std::function<void(Model::UpdateRadiusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateRadiusAsync(request, [complete](const DirectoryServiceClient*, const Model::UpdateRadiusRequest&, const Model::UpdateRadiusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateRadiusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>AWS Directory Service for Microsoft Active Directory allows you to configure
          * and verify trust relationships. </p><p>This action verifies a trust relationship
@@ -857,6 +1411,29 @@ namespace Model
          */
         virtual void VerifyTrustAsync(const Model::VerifyTrustRequest& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>AWS Directory Service for Microsoft Active Directory allows you to configure
+         * and verify trust relationships. </p><p>This action verifies a trust relationship
+         * between your Microsoft AD in the AWS cloud and an external domain.</p>
+         *
+         * Returns an awaitable that starts the operation the way VerifyTrustAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::VerifyTrustRequest>
+        Aws::Utils::Threading::Awaitable<Model::VerifyTrustOutcome> VerifyTrustAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::VerifyTrustOutcome>([this, request](const std::function<void(Model::VerifyTrustOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->VerifyTrustAsync(request, [complete](const DirectoryServiceClient*, const Model::VerifyTrustRequest&, const Model::VerifyTrustOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::VerifyTrustOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -35,6 +35,7 @@
 #include <aws/dynamodb/model/UpdateItemResult.h>
 #include <aws/dynamodb/model/UpdateTableResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -407,6 +408,69 @@ namespace Model
          */
         virtual void BatchGetItemAsync(const Model::BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>BatchGetItem</i> operation returns the attributes of one or more items
+         * from one or more tables. You identify requested items by primary key.</p> <p>A
+         * single operation can retrieve up to 16 MB of data, which can contain as many as
+         * 100 items. <i>BatchGetItem</i> will return a partial result if the response size
+         * limit is exceeded, the table's provisioned throughput is exceeded, or an
+         * internal processing failure occurs. If a partial result is returned, the
+         * operation returns a value for <i>UnprocessedKeys</i>. You can use this value to
+         * retry the operation starting with the next item to get.</p> <important><p>If you
+         * request more than 100 items <i>BatchGetItem</i> will return a
+         * <i>ValidationException</i> with the message "Too many items requested for the
+         * BatchGetItem call".</p></important> <p>For example, if you ask to retrieve 100
+         * items, but each individual item is 300 KB in size, the system returns 52 items
+         * (so as not to exceed the 16 MB limit). It also returns an appropriate
+         * <i>UnprocessedKeys</i> value so you can get the next page of results. If
+         * desired, your application can include its own logic to assemble the pages of
+         * results into one data set.</p> <p>If <i>none</i> of the items can be processed
+         * due to insufficient provisioned throughput on all of the tables in the request,
+         * then <i>BatchGetItem</i> will return a
+         * <i>ProvisionedThroughputExceededException</i>. If <i>at least one</i> of the
+         * items is successfully processed, then <i>BatchGetItem</i> completes
+         * successfully, while returning the keys of the unread items in
+         * <i>UnprocessedKeys</i>.</p> <important> <p>If DynamoDB returns any unprocessed
+         * items, you should retry the batch operation on those items. However, <i>we
+         * strongly recommend that you use an exponential backoff algorithm</i>. If you
+         * retry the batch operation immediately, the underlying read or write requests can
+         * still fail due to throttling on the individual tables. If you delay the batch
+         * operation using exponential backoff, the individual requests in the batch are
+         * much more likely to succeed.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/amazondynamodb/latest/developerguide/ErrorHandling.html#BatchOperations">Batch
+         * Operations and Error Handling</a> in the <i>Amazon DynamoDB Developer
+         * Guide</i>.</p> </important> <p>By default, <i>BatchGetItem</i> performs
+         * eventually consistent reads on every table in the request. If you want strongly
+         * consistent reads instead, you can set <i>ConsistentRead</i> to <code>true</code>
+         * for any or all tables.</p> <p>In order to minimize response latency,
+         * <i>BatchGetItem</i> retrieves items in parallel.</p> <p>When designing your
+         * application, keep in mind that DynamoDB does not return attributes in any
+         * particular order. To help parse the response by item, include the primary key
+         * values for the items in your request in the <i>AttributesToGet</i>
+         * parameter.</p> <p>If a requested item does not exist, it is not returned in the
+         * result. Requests for nonexistent items consume the minimum read capacity units
+         * according to the type of read. For more information, see <a
+         * href="http://docs.aws.amazon.com/amazondynamodb/latest/developerguide/WorkingWithTables.html#CapacityUnitCalculations">Capacity
+         * Units Calculations</a> in the <i>Amazon DynamoDB Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way BatchGetItemAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchGetItemRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchGetItemOutcome> BatchGetItemAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchGetItemOutcome>([this, request](const std::function<void(Model::BatchGetItemOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchGetItemAsync(request, [complete](const DynamoDBClient*, const Model::BatchGetItemRequest&, const Model::BatchGetItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchGetItemOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>BatchWriteItem</i> operation puts or deletes multiple items in one or
          * more tables. A single call to <i>BatchWriteItem</i> can write up to 16 MB of
@@ -585,6 +649,80 @@ namespace Model
          */
         virtual void BatchWriteItemAsync(const Model::BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>BatchWriteItem</i> operation puts or deletes multiple items in one or
+         * more tables. A single call to <i>BatchWriteItem</i> can write up to 16 MB of
+         * data, which can comprise as many as 25 put or delete requests. Individual items
+         * to be written can be as large as 400 KB.</p> <note> <p><i>BatchWriteItem</i>
+         * cannot update items. To update items, use the <i>UpdateItem</i> API.</p> </note>
+         * <p>The individual <i>PutItem</i> and <i>DeleteItem</i> operations specified in
+         * <i>BatchWriteItem</i> are atomic; however <i>BatchWriteItem</i> as a whole is
+         * not. If any requested operations fail because the table's provisioned throughput
+         * is exceeded or an internal processing failure occurs, the failed operations are
+         * returned in the <i>UnprocessedItems</i> response parameter. You can investigate
+         * and optionally resend the requests. Typically, you would call
+         * <i>BatchWriteItem</i> in a loop. Each iteration would check for unprocessed
+         * items and submit a new <i>BatchWriteItem</i> request with those unprocessed
+         * items until all items have been processed.</p> <p>Note that if <i>none</i> of
+         * the items can be processed due to insufficient provisioned throughput on all of
+         * the tables in the request, then <i>BatchWriteItem</i> will return a
+         * <i>ProvisionedThroughputExceededException</i>.</p> <important> <p>If DynamoDB
+         * returns any unprocessed items, you should retry the batch operation on those
+         * items. However, <i>we strongly recommend that you use an exponential backoff
+         * algorithm</i>. If you retry the batch operation immediately, the underlying read
+         * or write requests can still fail due to throttling on the individual tables. If
+         * you delay the batch operation using exponential backoff, the individual requests
+         * in the batch are much more likely to succeed.</p> <p>For more information, see
+         * <a
+         * href="http://docs.aws.amazon.com/amazondynamodb/latest/developerguide/ErrorHandling.html#BatchOperations">Batch
+         * Operations and Error Handling</a> in the <i>Amazon DynamoDB Developer
+         * Guide</i>.</p> </important> <p>With <i>BatchWriteItem</i>, you can efficiently
+         * write or delete large amounts of data, such as from Amazon Elastic MapReduce
+         * (EMR), or copy data from another database into DynamoDB. In order to improve
+         * performance with these large-scale operations, <i>BatchWriteItem</i> does not
+         * behave in the same way as individual <i>PutItem</i> and <i>DeleteItem</i> calls
+         * would. For example, you cannot specify conditions on individual put and delete
+         * requests, and <i>BatchWriteItem</i> does not return deleted items in the
+         * response.</p> <p>If you use a programming language that supports concurrency,
+         * you can use threads to write items in parallel. Your application must include
+         * the necessary logic to manage the threads. With languages that don't support
+         * threading, you must update or delete the specified items one at a time. In both
+         * situations, <i>BatchWriteItem</i> provides an alternative where the API performs
+         * the specified put and delete operations in parallel, giving you the power of the
+         * thread pool approach without having to introduce complexity into your
+         * application.</p> <p>Parallel processing reduces latency, but each specified put
+         * and delete request consumes the same number of write capacity units whether it
+         * is processed in parallel or not. Delete operations on nonexistent items consume
+         * one write capacity unit.</p> <p>If one or more of the following is true,
+         * DynamoDB rejects the entire batch write operation:</p> <ul> <li> <p>One or more
+         * tables specified in the <i>BatchWriteItem</i> request does not exist.</p> </li>
+         * <li> <p>Primary key attributes specified on an item in the request do not match
+         * those in the corresponding table's primary key schema.</p> </li> <li> <p>You try
+         * to perform multiple operations on the same item in the same
+         * <i>BatchWriteItem</i> request. For example, you cannot put and delete the same
+         * item in the same <i>BatchWriteItem</i> request. </p> </li> <li> <p>There are
+         * more than 25 requests in the batch.</p></li> <li> <p>Any individual item in a
+         * batch exceeds 400 KB.</p> </li> <li><p>The total request size exceeds 16 MB.</p>
+         * </li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way BatchWriteItemAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchWriteItemRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchWriteItemOutcome> BatchWriteItemAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchWriteItemOutcome>([this, request](const std::function<void(Model::BatchWriteItemOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchWriteItemAsync(request, [complete](const DynamoDBClient*, const Model::BatchWriteItemRequest&, const Model::BatchWriteItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchWriteItemOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>CreateTable</i> operation adds a new table to your account. In an AWS
          * account, table names must be unique within each region. That is, you can have
@@ -643,6 +781,40 @@ namespace Model
          */
         virtual void CreateTableAsync(const Model::CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>CreateTable</i> operation adds a new table to your account. In an AWS
+         * account, table names must be unique within each region. That is, you can have
+         * two tables with same name if you create the tables in different regions.</p>
+         * <p><i>CreateTable</i> is an asynchronous operation. Upon receiving a
+         * <i>CreateTable</i> request, DynamoDB immediately returns a response with a
+         * <i>TableStatus</i> of <code>CREATING</code>. After the table is created,
+         * DynamoDB sets the <i>TableStatus</i> to <code>ACTIVE</code>. You can perform
+         * read and write operations only on an <code>ACTIVE</code> table. </p> <p>You can
+         * optionally define secondary indexes on the new table, as part of the
+         * <i>CreateTable</i> operation. If you want to create multiple tables with
+         * secondary indexes on them, you must create the tables sequentially. Only one
+         * table with secondary indexes can be in the <code>CREATING</code> state at any
+         * given time.</p> <p>You can use the <i>DescribeTable</i> API to check the table
+         * status.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateTableAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTableRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTableOutcome> CreateTableAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTableOutcome>([this, request](const std::function<void(Model::CreateTableOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTableAsync(request, [complete](const DynamoDBClient*, const Model::CreateTableRequest&, const Model::CreateTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTableOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a single item in a table by primary key. You can perform a
          * conditional delete operation that deletes the item if it exists, or if it has an
@@ -689,6 +861,36 @@ namespace Model
          */
         virtual void DeleteItemAsync(const Model::DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a single item in a table by primary key. You can perform a
+         * conditional delete operation that deletes the item if it exists, or if it has an
+         * expected attribute value.</p> <p>In addition to deleting an item, you can also
+         * return the item's attribute values in the same operation, using the
+         * <i>ReturnValues</i> parameter.</p> <p>Unless you specify conditions, the
+         * <i>DeleteItem</i> is an idempotent operation; running it multiple times on the
+         * same item or attribute does <i>not</i> result in an error response.</p>
+         * <p>Conditional deletes are useful for deleting items only if specific conditions
+         * are met. If those conditions are met, DynamoDB performs the delete. Otherwise,
+         * the item is not deleted. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteItemAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteItemRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteItemOutcome> DeleteItemAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteItemOutcome>([this, request](const std::function<void(Model::DeleteItemOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteItemAsync(request, [complete](const DynamoDBClient*, const Model::DeleteItemRequest&, const Model::DeleteItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteItemOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DeleteTable</i> operation deletes a table and all of its items. After
          * a <i>DeleteTable</i> request, the specified table is in the
@@ -753,6 +955,42 @@ namespace Model
          */
         virtual void DeleteTableAsync(const Model::DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DeleteTable</i> operation deletes a table and all of its items. After
+         * a <i>DeleteTable</i> request, the specified table is in the
+         * <code>DELETING</code> state until DynamoDB completes the deletion. If the table
+         * is in the <code>ACTIVE</code> state, you can delete it. If a table is in
+         * <code>CREATING</code> or <code>UPDATING</code> states, then DynamoDB returns a
+         * <i>ResourceInUseException</i>. If the specified table does not exist, DynamoDB
+         * returns a <i>ResourceNotFoundException</i>. If table is already in the
+         * <code>DELETING</code> state, no error is returned. </p> <note> <p>DynamoDB might
+         * continue to accept data read and write operations, such as <i>GetItem</i> and
+         * <i>PutItem</i>, on a table in the <code>DELETING</code> state until the table
+         * deletion is complete.</p> </note> <p>When you delete a table, any indexes on
+         * that table are also deleted.</p> <p>If you have DynamoDB Streams enabled on the
+         * table, then the corresponding stream on that table goes into the
+         * <code>DISABLED</code> state, and the stream is automatically deleted after 24
+         * hours.</p> <p>Use the <i>DescribeTable</i> API to check the status of the table.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTableAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTableRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTableOutcome> DeleteTableAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTableOutcome>([this, request](const std::function<void(Model::DeleteTableOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTableAsync(request, [complete](const DynamoDBClient*, const Model::DeleteTableRequest&, const Model::DeleteTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTableOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the current provisioned-capacity limits for your AWS account in a
          * region, both for the region as a whole and for any one DynamoDB table that you
@@ -886,6 +1124,65 @@ namespace Model
          */
         virtual void DescribeLimitsAsync(const Model::DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the current provisioned-capacity limits for your AWS account in a
+         * region, both for the region as a whole and for any one DynamoDB table that you
+         * create there.</p> <p>When you establish an AWS account, the account has initial
+         * limits on the maximum read capacity units and write capacity units that you can
+         * provision across all of your DynamoDB tables in a given region. Also, there are
+         * per-table limits that apply when you create a table there. For more information,
+         * see <a
+         * href="http://docs.aws.amazon.com/amazondynamodb/latest/developerguide/Limits.html">Limits</a>
+         * page in the <i>Amazon DynamoDB Developer Guide</i>.</p> <p>Although you can
+         * increase these limits by filing a case at <a
+         * href="https://console.aws.amazon.com/support/home#/">AWS Support Center</a>,
+         * obtaining the increase is not instantaneous. The <i>DescribeLimits</i> API lets
+         * you write code to compare the capacity you are currently using to those limits
+         * imposed by your account so that you have enough time to apply for an increase
+         * before you hit a limit.</p> <p> For example, you could use one of the AWS SDKs
+         * to do the following:</p> <ol> <li>Call <i>DescribeLimits</i> for a particular
+         * region to obtain your current account limits on provisioned capacity there.</li>
+         * <li>Create a variable to hold the aggregate read capacity units provisioned for
+         * all your tables in that region, and one to hold the aggregate write capacity
+         * units. Zero them both.</li> <li>Call <i>ListTables</i> to obtain a list of all
+         * your DynamoDB tables.</li> <li><p>For each table name listed by
+         * <i>ListTables</i>, do the following:</p> <ul> <li>Call <i>DescribeTable</i> with
+         * the table name.</li> <li>Use the data returned by <i>DescribeTable</i> to add
+         * the read capacity units and write capacity units provisioned for the table
+         * itself to your variables.</li> <li>If the table has one or more global secondary
+         * indexes (GSIs), loop over these GSIs and add their provisioned capacity values
+         * to your variables as well.</li> </ul> </li> <li>Report the account limits for
+         * that region returned by <i>DescribeLimits</i>, along with the total current
+         * provisioned capacity levels you have calculated.</li> </ol> <p>This will let you
+         * see whether you are getting close to your account-level limits.</p> <p>The
+         * per-table limits apply only when you are creating a new table. They restrict the
+         * sum of the provisioned capacity of the new table itself and all its global
+         * secondary indexes.</p> <p>For existing tables and their GSIs, DynamoDB will not
+         * let you increase provisioned capacity extremely rapidly, but the only upper
+         * limit that applies is that the aggregate provisioned capacity over all your
+         * tables and GSIs cannot exceed either of the per-account limits.</p>
+         * <note><p><i>DescribeLimits</i> should only be called periodically. You can
+         * expect throttling errors if you call it more than once in a minute.</p> </note>
+         * <p>The <i>DescribeLimits</i> Request element has no content.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLimitsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLimitsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLimitsOutcome> DescribeLimitsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLimitsOutcome>([this, request](const std::function<void(Model::DescribeLimitsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLimitsAsync(request, [complete](const DynamoDBClient*, const Model::DescribeLimitsRequest&, const Model::DescribeLimitsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLimitsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the table, including the current status of the
          * table, when it was created, the primary key schema, and any indexes on the
@@ -926,6 +1223,34 @@ namespace Model
          */
         virtual void DescribeTableAsync(const Model::DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the table, including the current status of the
+         * table, when it was created, the primary key schema, and any indexes on the
+         * table.</p> <note> <p>If you issue a <i>DescribeTable</i> request immediately
+         * after a <i>CreateTable</i> request, DynamoDB might return a
+         * <i>ResourceNotFoundException</i>. This is because <i>DescribeTable</i> uses an
+         * eventually consistent query, and the metadata for your table might not be
+         * available at that moment. Wait for a few seconds, and then try the
+         * <i>DescribeTable</i> request again.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTableAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTableRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTableOutcome> DescribeTableAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTableOutcome>([this, request](const std::function<void(Model::DescribeTableOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTableAsync(request, [complete](const DynamoDBClient*, const Model::DescribeTableRequest&, const Model::DescribeTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTableOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>GetItem</i> operation returns a set of attributes for the item with
          * the given primary key. If there is no matching item, <i>GetItem</i> does not
@@ -963,6 +1288,33 @@ namespace Model
          */
         virtual void GetItemAsync(const Model::GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>GetItem</i> operation returns a set of attributes for the item with
+         * the given primary key. If there is no matching item, <i>GetItem</i> does not
+         * return any data.</p> <p><i>GetItem</i> provides an eventually consistent read by
+         * default. If your application requires a strongly consistent read, set
+         * <i>ConsistentRead</i> to <code>true</code>. Although a strongly consistent read
+         * might take more time than an eventually consistent read, it always returns the
+         * last updated value.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetItemAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetItemRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetItemOutcome> GetItemAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetItemOutcome>([this, request](const std::function<void(Model::GetItemOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetItemAsync(request, [complete](const DynamoDBClient*, const Model::GetItemRequest&, const Model::GetItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetItemOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns an array of table names associated with the current account and
          * endpoint. The output from <i>ListTables</i> is paginated, with each page
@@ -988,6 +1340,29 @@ namespace Model
          */
         virtual void ListTablesAsync(const Model::ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns an array of table names associated with the current account and
+         * endpoint. The output from <i>ListTables</i> is paginated, with each page
+         * returning a maximum of 100 table names.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTablesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTablesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTablesOutcome> ListTablesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTablesOutcome>([this, request](const std::function<void(Model::ListTablesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTablesAsync(request, [complete](const DynamoDBClient*, const Model::ListTablesRequest&, const Model::ListTablesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTablesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new item, or replaces an old item with a new item. If an item that
          * has the same primary key as the new item already exists in the specified table,
@@ -1070,6 +1445,48 @@ namespace Model
          */
         virtual void PutItemAsync(const Model::PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new item, or replaces an old item with a new item. If an item that
+         * has the same primary key as the new item already exists in the specified table,
+         * the new item completely replaces the existing item. You can perform a
+         * conditional put operation (add a new item if one with the specified primary key
+         * doesn't exist), or replace an existing item if it has certain attribute values.
+         * </p> <p>In addition to putting an item, you can also return the item's attribute
+         * values in the same operation, using the <i>ReturnValues</i> parameter.</p>
+         * <p>When you add an item, the primary key attribute(s) are the only required
+         * attributes. Attribute values cannot be null. String and Binary type attributes
+         * must have lengths greater than zero. Set type attributes cannot be empty.
+         * Requests with empty values will be rejected with a <i>ValidationException</i>
+         * exception.</p> <p>You can request that <i>PutItem</i> return either a copy of
+         * the original item (before the update) or a copy of the updated item (after the
+         * update). For more information, see the <i>ReturnValues</i> description
+         * below.</p> <note> <p>To prevent a new item from replacing an existing item, use
+         * a conditional expression that contains the <code>attribute_not_exists</code>
+         * function with the name of the attribute being used as the partition key for the
+         * table. Since every record must contain that attribute, the
+         * <code>attribute_not_exists</code> function will only succeed if no matching item
+         * exists.</p> </note> <p>For more information about using this API, see <a
+         * href="http://docs.aws.amazon.com/amazondynamodb/latest/developerguide/WorkingWithItems.html">Working
+         * with Items</a> in the <i>Amazon DynamoDB Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutItemAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutItemRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutItemOutcome> PutItemAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutItemOutcome>([this, request](const std::function<void(Model::PutItemOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutItemAsync(request, [complete](const DynamoDBClient*, const Model::PutItemRequest&, const Model::PutItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutItemOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>A <i>Query</i> operation uses the primary key of a table or a secondary index
          * to directly access items from that table or index.</p> <p>Use the
@@ -1152,6 +1569,48 @@ namespace Model
          */
         virtual void QueryAsync(const Model::QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>A <i>Query</i> operation uses the primary key of a table or a secondary index
+         * to directly access items from that table or index.</p> <p>Use the
+         * <i>KeyConditionExpression</i> parameter to provide a specific value for the
+         * partition key. The <i>Query</i> operation will return all of the items from the
+         * table or index with that partition key value. You can optionally narrow the
+         * scope of the <i>Query</i> operation by specifying a sort key value and a
+         * comparison operator in <i>KeyConditionExpression</i>. You can use the
+         * <i>ScanIndexForward</i> parameter to get results in forward or reverse order, by
+         * sort key.</p> <p>Queries that do not return results consume the minimum number
+         * of read capacity units for that type of read operation.</p> <p>If the total
+         * number of items meeting the query criteria exceeds the result set size limit of
+         * 1 MB, the query stops and results are returned to the user with the
+         * <i>LastEvaluatedKey</i> element to continue the query in a subsequent operation.
+         * Unlike a <i>Scan</i> operation, a <i>Query</i> operation never returns both an
+         * empty result set and a <i>LastEvaluatedKey</i> value. <i>LastEvaluatedKey</i> is
+         * only provided if the results exceed 1 MB, or if you have used the <i>Limit</i>
+         * parameter. </p> <p>You can query a table, a local secondary index, or a global
+         * secondary index. For a query on a table or on a local secondary index, you can
+         * set the <i>ConsistentRead</i> parameter to <code>true</code> and obtain a
+         * strongly consistent result. Global secondary indexes support eventually
+         * consistent reads only, so do not specify <i>ConsistentRead</i> when querying a
+         * global secondary index.</p>
+         *
+         * Returns an awaitable that starts the operation the way QueryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::QueryRequest>
+        Aws::Utils::Threading::Awaitable<Model::QueryOutcome> QueryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::QueryOutcome>([this, request](const std::function<void(Model::QueryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->QueryAsync(request, [complete](const DynamoDBClient*, const Model::QueryRequest&, const Model::QueryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::QueryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>Scan</i> operation returns one or more items and item attributes by
          * accessing every item in a table or a secondary index. To have DynamoDB return
@@ -1225,6 +1684,45 @@ namespace Model
          */
         virtual void ScanAsync(const Model::ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>Scan</i> operation returns one or more items and item attributes by
+         * accessing every item in a table or a secondary index. To have DynamoDB return
+         * fewer items, you can provide a <i>ScanFilter</i> operation.</p> <p>If the total
+         * number of scanned items exceeds the maximum data set size limit of 1 MB, the
+         * scan stops and results are returned to the user as a <i>LastEvaluatedKey</i>
+         * value to continue the scan in a subsequent operation. The results also include
+         * the number of items exceeding the limit. A scan can result in no table data
+         * meeting the filter criteria. </p> <p>By default, <i>Scan</i> operations proceed
+         * sequentially; however, for faster performance on a large table or secondary
+         * index, applications can request a parallel <i>Scan</i> operation by providing
+         * the <i>Segment</i> and <i>TotalSegments</i> parameters. For more information,
+         * see <a
+         * href="http://docs.aws.amazon.com/amazondynamodb/latest/developerguide/QueryAndScan.html#QueryAndScanParallelScan">Parallel
+         * Scan</a> in the <i>Amazon DynamoDB Developer Guide</i>.</p> <p>By default,
+         * <i>Scan</i> uses eventually consistent reads when accessing the data in a table;
+         * therefore, the result set might not include the changes to data in the table
+         * immediately before the operation began. If you need a consistent copy of the
+         * data, as of the time that the Scan begins, you can set the <i>ConsistentRead</i>
+         * parameter to <i>true</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ScanAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ScanRequest>
+        Aws::Utils::Threading::Awaitable<Model::ScanOutcome> ScanAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ScanOutcome>([this, request](const std::function<void(Model::ScanOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ScanAsync(request, [complete](const DynamoDBClient*, const Model::ScanRequest&, const Model::ScanOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ScanOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Edits an existing item's attributes, or adds a new item to the table if it
          * does not already exist. You can put, delete, or add attribute values. You can
@@ -1262,6 +1760,33 @@ namespace Model
          */
         virtual void UpdateItemAsync(const Model::UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Edits an existing item's attributes, or adds a new item to the table if it
+         * does not already exist. You can put, delete, or add attribute values. You can
+         * also perform a conditional update on an existing item (insert a new attribute
+         * name-value pair if it doesn't exist, or replace an existing name-value pair if
+         * it has certain expected attribute values). </p> <p>You can also return the
+         * item's attribute values in the same <i>UpdateItem</i> operation using the
+         * <i>ReturnValues</i> parameter.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateItemAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateItemRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateItemOutcome> UpdateItemAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateItemOutcome>([this, request](const std::function<void(Model::UpdateItemOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateItemAsync(request, [complete](const DynamoDBClient*, const Model::UpdateItemRequest&, const Model::UpdateItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateItemOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the provisioned throughput settings, global secondary indexes, or
          * DynamoDB Streams settings for a given table.</p> <p>You can only perform one of
@@ -1314,6 +1839,38 @@ namespace Model
          */
         virtual void UpdateTableAsync(const Model::UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the provisioned throughput settings, global secondary indexes, or
+         * DynamoDB Streams settings for a given table.</p> <p>You can only perform one of
+         * the following operations at once:</p> <ul> <li><p>Modify the provisioned
+         * throughput settings of the table.</p></li> <li><p>Enable or disable Streams on
+         * the table.</p></li> <li><p>Remove a global secondary index from the
+         * table.</p></li> <li> <p>Create a new global secondary index on the table. Once
+         * the index begins backfilling, you can use <i>UpdateTable</i> to perform other
+         * operations.</p></li> </ul> <p><i>UpdateTable</i> is an asynchronous operation;
+         * while it is executing, the table status changes from <code>ACTIVE</code> to
+         * <code>UPDATING</code>. While it is <code>UPDATING</code>, you cannot issue
+         * another <i>UpdateTable</i> request. When the table returns to the
+         * <code>ACTIVE</code> state, the <i>UpdateTable</i> operation is complete.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateTableAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateTableRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateTableOutcome> UpdateTableAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateTableOutcome>([this, request](const std::function<void(Model::UpdateTableOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateTableAsync(request, [complete](const DynamoDBClient*, const Model::UpdateTableRequest&, const Model::UpdateTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateTableOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
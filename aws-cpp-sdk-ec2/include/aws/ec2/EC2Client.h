@@ -162,6 +162,7 @@
 #include <aws/ec2/model/UnmonitorInstancesResponse.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -1074,6 +1075,30 @@ namespace Model
          */
         virtual void AcceptVpcPeeringConnectionAsync(const Model::AcceptVpcPeeringConnectionRequest& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Accept a VPC peering connection request. To accept a request, the VPC peering
+         * connection must be in the <code>pending-acceptance</code> state, and you must be
+         * the owner of the peer VPC. Use the <code>DescribeVpcPeeringConnections</code>
+         * request to view your outstanding VPC peering connection requests.</p>
+         *
+         * Returns an awaitable that starts the operation the way AcceptVpcPeeringConnectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AcceptVpcPeeringConnectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::AcceptVpcPeeringConnectionOutcome> AcceptVpcPeeringConnectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AcceptVpcPeeringConnectionOutcome>([this, request](const std::function<void(Model::AcceptVpcPeeringConnectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AcceptVpcPeeringConnectionAsync(request, [complete](const EC2Client*, const Model::AcceptVpcPeeringConnectionRequest&, const Model::AcceptVpcPeeringConnectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AcceptVpcPeeringConnectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Acquires an Elastic IP address.</p> <p>An Elastic IP address is for use
          * either in the EC2-Classic platform or in a VPC. For more information, see <a
@@ -1102,6 +1127,30 @@ namespace Model
          */
         virtual void AllocateAddressAsync(const Model::AllocateAddressRequest& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Acquires an Elastic IP address.</p> <p>An Elastic IP address is for use
+         * either in the EC2-Classic platform or in a VPC. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/elastic-ip-addresses-eip.html">Elastic
+         * IP Addresses</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AllocateAddressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AllocateAddressRequest>
+        Aws::Utils::Threading::Awaitable<Model::AllocateAddressOutcome> AllocateAddressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AllocateAddressOutcome>([this, request](const std::function<void(Model::AllocateAddressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AllocateAddressAsync(request, [complete](const EC2Client*, const Model::AllocateAddressRequest&, const Model::AllocateAddressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AllocateAddressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Allocates a Dedicated host to your account. At minimum you need to specify
          * the instance size type, Availability Zone, and quantity of hosts you want to
@@ -1127,6 +1176,29 @@ namespace Model
          */
         virtual void AllocateHostsAsync(const Model::AllocateHostsRequest& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Allocates a Dedicated host to your account. At minimum you need to specify
+         * the instance size type, Availability Zone, and quantity of hosts you want to
+         * allocate.</p>
+         *
+         * Returns an awaitable that starts the operation the way AllocateHostsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AllocateHostsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AllocateHostsOutcome> AllocateHostsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AllocateHostsOutcome>([this, request](const std::function<void(Model::AllocateHostsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AllocateHostsAsync(request, [complete](const EC2Client*, const Model::AllocateHostsRequest&, const Model::AllocateHostsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AllocateHostsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Assigns one or more secondary private IP addresses to the specified network
          * interface. You can specify one or more specific secondary IP addresses, or you
@@ -1179,6 +1251,38 @@ namespace Model
          */
         virtual void AssignPrivateIpAddressesAsync(const Model::AssignPrivateIpAddressesRequest& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Assigns one or more secondary private IP addresses to the specified network
+         * interface. You can specify one or more specific secondary IP addresses, or you
+         * can specify the number of secondary IP addresses to be automatically assigned
+         * within the subnet's CIDR block range. The number of secondary IP addresses that
+         * you can assign to an instance varies by instance type. For information about
+         * instance types, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/instance-types.html">Instance
+         * Types</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>. For more
+         * information about Elastic IP addresses, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/elastic-ip-addresses-eip.html">Elastic
+         * IP Addresses</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         * <p>AssignPrivateIpAddresses is available only in EC2-VPC.</p>
+         *
+         * Returns an awaitable that starts the operation the way AssignPrivateIpAddressesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AssignPrivateIpAddressesRequest>
+        Aws::Utils::Threading::Awaitable<Model::AssignPrivateIpAddressesOutcome> AssignPrivateIpAddressesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AssignPrivateIpAddressesOutcome>([this, request](const std::function<void(Model::AssignPrivateIpAddressesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AssignPrivateIpAddressesAsync(request, [complete](const EC2Client*, const Model::AssignPrivateIpAddressesRequest&, const Model::AssignPrivateIpAddressesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AssignPrivateIpAddressesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Associates an Elastic IP address with an instance or a network interface.</p>
          * <p>An Elastic IP address is for use in either the EC2-Classic platform or in a
@@ -1237,6 +1341,40 @@ namespace Model
          */
         virtual void AssociateAddressAsync(const Model::AssociateAddressRequest& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Associates an Elastic IP address with an instance or a network interface.</p>
+         * <p>An Elastic IP address is for use in either the EC2-Classic platform or in a
+         * VPC. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/elastic-ip-addresses-eip.html">Elastic
+         * IP Addresses</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         * <p>[EC2-Classic, VPC in an EC2-VPC-only account] If the Elastic IP address is
+         * already associated with a different instance, it is disassociated from that
+         * instance and associated with the specified instance.</p> <p>[VPC in an
+         * EC2-Classic account] If you don't specify a private IP address, the Elastic IP
+         * address is associated with the primary IP address. If the Elastic IP address is
+         * already associated with a different instance or a network interface, you get an
+         * error unless you allow reassociation.</p> <p>This is an idempotent operation. If
+         * you perform the operation more than once, Amazon EC2 doesn't return an
+         * error.</p>
+         *
+         * Returns an awaitable that starts the operation the way AssociateAddressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AssociateAddressRequest>
+        Aws::Utils::Threading::Awaitable<Model::AssociateAddressOutcome> AssociateAddressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AssociateAddressOutcome>([this, request](const std::function<void(Model::AssociateAddressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AssociateAddressAsync(request, [complete](const EC2Client*, const Model::AssociateAddressRequest&, const Model::AssociateAddressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AssociateAddressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Associates a set of DHCP options (that you've previously created) with the
          * specified VPC, or associates no DHCP options with the VPC.</p> <p>After you
@@ -1283,6 +1421,36 @@ namespace Model
          */
         virtual void AssociateDhcpOptionsAsync(const Model::AssociateDhcpOptionsRequest& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Associates a set of DHCP options (that you've previously created) with the
+         * specified VPC, or associates no DHCP options with the VPC.</p> <p>After you
+         * associate the options with the VPC, any existing instances and all new instances
+         * that you launch in that VPC use the options. You don't need to restart or
+         * relaunch the instances. They automatically pick up the changes within a few
+         * hours, depending on how frequently the instance renews its DHCP lease. You can
+         * explicitly renew the lease using the operating system on the instance.</p>
+         * <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_DHCP_Options.html">DHCP
+         * Options Sets</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AssociateDhcpOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AssociateDhcpOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AssociateDhcpOptionsOutcome> AssociateDhcpOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AssociateDhcpOptionsOutcome>([this, request](const std::function<void(Model::AssociateDhcpOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AssociateDhcpOptionsAsync(request, [complete](const EC2Client*, const Model::AssociateDhcpOptionsRequest&, const Model::AssociateDhcpOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AssociateDhcpOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Associates a subnet with a route table. The subnet and route table must be in
          * the same VPC. This association causes traffic originating from the subnet to be
@@ -1323,6 +1491,34 @@ namespace Model
          */
         virtual void AssociateRouteTableAsync(const Model::AssociateRouteTableRequest& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Associates a subnet with a route table. The subnet and route table must be in
+         * the same VPC. This association causes traffic originating from the subnet to be
+         * routed according to the routes in the route table. The action returns an
+         * association ID, which you need in order to disassociate the route table from the
+         * subnet later. A route table can be associated with multiple subnets.</p> <p>For
+         * more information about route tables, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_Route_Tables.html">Route
+         * Tables</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AssociateRouteTableAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AssociateRouteTableRequest>
+        Aws::Utils::Threading::Awaitable<Model::AssociateRouteTableOutcome> AssociateRouteTableAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AssociateRouteTableOutcome>([this, request](const std::function<void(Model::AssociateRouteTableOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AssociateRouteTableAsync(request, [complete](const EC2Client*, const Model::AssociateRouteTableRequest&, const Model::AssociateRouteTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AssociateRouteTableOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Links an EC2-Classic instance to a ClassicLink-enabled VPC through one or
          * more of the VPC's security groups. You cannot link an EC2-Classic instance to
@@ -1366,6 +1562,35 @@ namespace Model
          */
         virtual void AttachClassicLinkVpcAsync(const Model::AttachClassicLinkVpcRequest& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Links an EC2-Classic instance to a ClassicLink-enabled VPC through one or
+         * more of the VPC's security groups. You cannot link an EC2-Classic instance to
+         * more than one VPC at a time. You can only link an instance that's in the
+         * <code>running</code> state. An instance is automatically unlinked from a VPC
+         * when it's stopped - you can link it to the VPC again when you restart it.</p>
+         * <p>After you've linked an instance, you cannot change the VPC security groups
+         * that are associated with it. To change the security groups, you must first
+         * unlink the instance, and then link it again. </p> <p>Linking your instance to a
+         * VPC is sometimes referred to as <i>attaching</i> your instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachClassicLinkVpcAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachClassicLinkVpcRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachClassicLinkVpcOutcome> AttachClassicLinkVpcAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachClassicLinkVpcOutcome>([this, request](const std::function<void(Model::AttachClassicLinkVpcOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachClassicLinkVpcAsync(request, [complete](const EC2Client*, const Model::AttachClassicLinkVpcRequest&, const Model::AttachClassicLinkVpcOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachClassicLinkVpcOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches an Internet gateway to a VPC, enabling connectivity between the
          * Internet and the VPC. For more information about your VPC and Internet gateway,
@@ -1394,6 +1619,30 @@ namespace Model
          */
         virtual void AttachInternetGatewayAsync(const Model::AttachInternetGatewayRequest& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches an Internet gateway to a VPC, enabling connectivity between the
+         * Internet and the VPC. For more information about your VPC and Internet gateway,
+         * see the <a href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/">Amazon
+         * Virtual Private Cloud User Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachInternetGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachInternetGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachInternetGatewayOutcome> AttachInternetGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachInternetGatewayOutcome>([this, request](const std::function<void(Model::AttachInternetGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachInternetGatewayAsync(request, [complete](const EC2Client*, const Model::AttachInternetGatewayRequest&, const Model::AttachInternetGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachInternetGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches a network interface to an instance.</p>
          */
@@ -1413,6 +1662,27 @@ namespace Model
          */
         virtual void AttachNetworkInterfaceAsync(const Model::AttachNetworkInterfaceRequest& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches a network interface to an instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachNetworkInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachNetworkInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachNetworkInterfaceOutcome> AttachNetworkInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachNetworkInterfaceOutcome>([this, request](const std::function<void(Model::AttachNetworkInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachNetworkInterfaceAsync(request, [complete](const EC2Client*, const Model::AttachNetworkInterfaceRequest&, const Model::AttachNetworkInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachNetworkInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches an EBS volume to a running or stopped instance and exposes it to the
          * instance with the specified device name.</p> <p>Encrypted EBS volumes may only
@@ -1501,6 +1771,50 @@ namespace Model
          */
         virtual void AttachVolumeAsync(const Model::AttachVolumeRequest& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches an EBS volume to a running or stopped instance and exposes it to the
+         * instance with the specified device name.</p> <p>Encrypted EBS volumes may only
+         * be attached to instances that support Amazon EBS encryption. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/EBSEncryption.html">Amazon
+         * EBS Encryption</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         * <p>For a list of supported device names, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ebs-attaching-volume.html">Attaching
+         * an EBS Volume to an Instance</a>. Any device names that aren't reserved for
+         * instance store volumes can be used for EBS volumes. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/InstanceStorage.html">Amazon
+         * EC2 Instance Store</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p> <p>If a volume has an AWS Marketplace product code:</p> <ul>
+         * <li>The volume can be attached only to a stopped instance.</li> <li>AWS
+         * Marketplace product codes are copied from the volume to the instance.</li>
+         * <li>You must be subscribed to the product.</li> <li>The instance type and
+         * operating system of the instance must support the product. For example, you
+         * can't detach a volume from a Windows instance and attach it to a Linux
+         * instance.</li> </ul> <p>For an overview of the AWS Marketplace, see <a
+         * href="https://aws.amazon.com/marketplace/help/200900000">Introducing AWS
+         * Marketplace</a>.</p> <p>For more information about EBS volumes, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ebs-attaching-volume.html">Attaching
+         * Amazon EBS Volumes</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachVolumeOutcome> AttachVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachVolumeOutcome>([this, request](const std::function<void(Model::AttachVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachVolumeAsync(request, [complete](const EC2Client*, const Model::AttachVolumeRequest&, const Model::AttachVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches a virtual private gateway to a VPC. For more information, see <a
          * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
@@ -1529,6 +1843,30 @@ namespace Model
          */
         virtual void AttachVpnGatewayAsync(const Model::AttachVpnGatewayRequest& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches a virtual private gateway to a VPC. For more information, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
+         * a Hardware Virtual Private Gateway to Your VPC</a> in the <i>Amazon Virtual
+         * Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachVpnGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachVpnGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachVpnGatewayOutcome> AttachVpnGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachVpnGatewayOutcome>([this, request](const std::function<void(Model::AttachVpnGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachVpnGatewayAsync(request, [complete](const EC2Client*, const Model::AttachVpnGatewayRequest&, const Model::AttachVpnGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachVpnGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>[EC2-VPC only] Adds one or more egress rules to a security group for use with
          * a VPC. Specifically, this action permits instances to send traffic to one or
@@ -1590,6 +1928,41 @@ namespace Model
          */
         virtual void AuthorizeSecurityGroupEgressAsync(const Model::AuthorizeSecurityGroupEgressRequest& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>[EC2-VPC only] Adds one or more egress rules to a security group for use with
+         * a VPC. Specifically, this action permits instances to send traffic to one or
+         * more destination CIDR IP address ranges, or to one or more destination security
+         * groups for the same VPC. This action doesn't apply to security groups for use in
+         * EC2-Classic. For more information, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_SecurityGroups.html">Security
+         * Groups for Your VPC</a> in the <i>Amazon Virtual Private Cloud User
+         * Guide</i>.</p> <important> <p>You can have up to 50 rules per security group
+         * (covering both ingress and egress rules).</p> </important> <p>Each rule consists
+         * of the protocol (for example, TCP), plus either a CIDR range or a source group.
+         * For the TCP and UDP protocols, you must also specify the destination port or
+         * port range. For the ICMP protocol, you must also specify the ICMP type and code.
+         * You can use -1 for the type or code to mean all types or all codes.</p> <p>Rule
+         * changes are propagated to affected instances as quickly as possible. However, a
+         * small delay might occur.</p>
+         *
+         * Returns an awaitable that starts the operation the way AuthorizeSecurityGroupEgressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AuthorizeSecurityGroupEgressRequest>
+        Aws::Utils::Threading::Awaitable<Model::AuthorizeSecurityGroupEgressOutcome> AuthorizeSecurityGroupEgressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AuthorizeSecurityGroupEgressOutcome>([this, request](const std::function<void(Model::AuthorizeSecurityGroupEgressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AuthorizeSecurityGroupEgressAsync(request, [complete](const EC2Client*, const Model::AuthorizeSecurityGroupEgressRequest&, const Model::AuthorizeSecurityGroupEgressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AuthorizeSecurityGroupEgressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds one or more ingress rules to a security group.</p> <important>
          * <p>EC2-Classic: You can have up to 100 rules per group.</p> <p>EC2-VPC: You can
@@ -1645,6 +2018,39 @@ namespace Model
          */
         virtual void AuthorizeSecurityGroupIngressAsync(const Model::AuthorizeSecurityGroupIngressRequest& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds one or more ingress rules to a security group.</p> <important>
+         * <p>EC2-Classic: You can have up to 100 rules per group.</p> <p>EC2-VPC: You can
+         * have up to 50 rules per group (covering both ingress and egress rules).</p>
+         * </important> <p>Rule changes are propagated to instances within the security
+         * group as quickly as possible. However, a small delay might occur.</p>
+         * <p>[EC2-Classic] This action gives one or more CIDR IP address ranges permission
+         * to access a security group in your account, or gives one or more security groups
+         * (called the <i>source groups</i>) permission to access a security group for your
+         * account. A source group can be for your own AWS account, or another.</p>
+         * <p>[EC2-VPC] This action gives one or more CIDR IP address ranges permission to
+         * access a security group in your VPC, or gives one or more other security groups
+         * (called the <i>source groups</i>) permission to access a security group for your
+         * VPC. The security groups must all be for the same VPC.</p>
+         *
+         * Returns an awaitable that starts the operation the way AuthorizeSecurityGroupIngressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AuthorizeSecurityGroupIngressRequest>
+        Aws::Utils::Threading::Awaitable<Model::AuthorizeSecurityGroupIngressOutcome> AuthorizeSecurityGroupIngressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AuthorizeSecurityGroupIngressOutcome>([this, request](const std::function<void(Model::AuthorizeSecurityGroupIngressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AuthorizeSecurityGroupIngressAsync(request, [complete](const EC2Client*, const Model::AuthorizeSecurityGroupIngressRequest&, const Model::AuthorizeSecurityGroupIngressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AuthorizeSecurityGroupIngressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Bundles an Amazon instance store-backed Windows instance.</p> <p>During
          * bundling, only the root device volume (C:\) is bundled. Data on other instance
@@ -1682,6 +2088,33 @@ namespace Model
          */
         virtual void BundleInstanceAsync(const Model::BundleInstanceRequest& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Bundles an Amazon instance store-backed Windows instance.</p> <p>During
+         * bundling, only the root device volume (C:\) is bundled. Data on other instance
+         * store volumes is not preserved.</p> <note> <p>This action is not applicable for
+         * Linux/Unix instances or Windows instances that are backed by Amazon EBS.</p>
+         * </note> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/WindowsGuide/Creating_InstanceStoreBacked_WinAMI.html">Creating
+         * an Instance Store-Backed Windows AMI</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way BundleInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BundleInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::BundleInstanceOutcome> BundleInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BundleInstanceOutcome>([this, request](const std::function<void(Model::BundleInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BundleInstanceAsync(request, [complete](const EC2Client*, const Model::BundleInstanceRequest&, const Model::BundleInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BundleInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Cancels a bundling operation for an instance store-backed Windows
          * instance.</p>
@@ -1704,6 +2137,28 @@ namespace Model
          */
         virtual void CancelBundleTaskAsync(const Model::CancelBundleTaskRequest& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels a bundling operation for an instance store-backed Windows
+         * instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way CancelBundleTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelBundleTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelBundleTaskOutcome> CancelBundleTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelBundleTaskOutcome>([this, request](const std::function<void(Model::CancelBundleTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelBundleTaskAsync(request, [complete](const EC2Client*, const Model::CancelBundleTaskRequest&, const Model::CancelBundleTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelBundleTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Cancels an active conversion task. The task can be the import of an instance
          * or volume. The action removes all artifacts of the conversion, including a
@@ -1744,6 +2199,34 @@ namespace Model
          */
         virtual void CancelConversionTaskAsync(const Model::CancelConversionTaskRequest& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels an active conversion task. The task can be the import of an instance
+         * or volume. The action removes all artifacts of the conversion, including a
+         * partially uploaded volume or instance. If the conversion is complete or is in
+         * the process of transferring the final disk image, the command fails and returns
+         * an exception.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/UploadingYourInstancesandVolumes.html">Using
+         * the Command Line Tools to Import Your Virtual Machine to Amazon EC2</a> in the
+         * <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CancelConversionTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelConversionTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelConversionTaskOutcome> CancelConversionTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelConversionTaskOutcome>([this, request](const std::function<void(Model::CancelConversionTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelConversionTaskAsync(request, [complete](const EC2Client*, const Model::CancelConversionTaskRequest&, const Model::CancelConversionTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelConversionTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Cancels an active export task. The request removes all artifacts of the
          * export, including any partially-created Amazon S3 objects. If the export task is
@@ -1772,6 +2255,30 @@ namespace Model
          */
         virtual void CancelExportTaskAsync(const Model::CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels an active export task. The request removes all artifacts of the
+         * export, including any partially-created Amazon S3 objects. If the export task is
+         * complete or is in the process of transferring the final disk image, the command
+         * fails and returns an error.</p>
+         *
+         * Returns an awaitable that starts the operation the way CancelExportTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelExportTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelExportTaskOutcome> CancelExportTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelExportTaskOutcome>([this, request](const std::function<void(Model::CancelExportTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelExportTaskAsync(request, [complete](const EC2Client*, const Model::CancelExportTaskRequest&, const Model::CancelExportTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelExportTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Cancels an in-process import virtual machine or import snapshot task.</p>
          */
@@ -1791,6 +2298,27 @@ namespace Model
          */
         virtual void CancelImportTaskAsync(const Model::CancelImportTaskRequest& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels an in-process import virtual machine or import snapshot task.</p>
+         *
+         * Returns an awaitable that starts the operation the way CancelImportTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelImportTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelImportTaskOutcome> CancelImportTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelImportTaskOutcome>([this, request](const std::function<void(Model::CancelImportTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelImportTaskAsync(request, [complete](const EC2Client*, const Model::CancelImportTaskRequest&, const Model::CancelImportTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelImportTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Cancels the specified Reserved Instance listing in the Reserved Instance
          * Marketplace.</p> <p>For more information, see <a
@@ -1822,6 +2350,31 @@ namespace Model
          */
         virtual void CancelReservedInstancesListingAsync(const Model::CancelReservedInstancesListingRequest& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels the specified Reserved Instance listing in the Reserved Instance
+         * Marketplace.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ri-market-general.html">Reserved
+         * Instance Marketplace</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CancelReservedInstancesListingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelReservedInstancesListingRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelReservedInstancesListingOutcome> CancelReservedInstancesListingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelReservedInstancesListingOutcome>([this, request](const std::function<void(Model::CancelReservedInstancesListingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelReservedInstancesListingAsync(request, [complete](const EC2Client*, const Model::CancelReservedInstancesListingRequest&, const Model::CancelReservedInstancesListingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelReservedInstancesListingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Cancels the specified Spot fleet requests.</p> <p>After you cancel a Spot
          * fleet request, the Spot fleet launches no new Spot instances. You must specify
@@ -1859,6 +2412,33 @@ namespace Model
          */
         virtual void CancelSpotFleetRequestsAsync(const Model::CancelSpotFleetRequestsRequest& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels the specified Spot fleet requests.</p> <p>After you cancel a Spot
+         * fleet request, the Spot fleet launches no new Spot instances. You must specify
+         * whether the Spot fleet should also terminate its Spot instances. If you
+         * terminate the instances, the Spot fleet request enters the
+         * <code>cancelled_terminating</code> state. Otherwise, the Spot fleet request
+         * enters the <code>cancelled_running</code> state and the instances continue to
+         * run until they are interrupted or you terminate them manually.</p>
+         *
+         * Returns an awaitable that starts the operation the way CancelSpotFleetRequestsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelSpotFleetRequestsRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelSpotFleetRequestsOutcome> CancelSpotFleetRequestsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelSpotFleetRequestsOutcome>([this, request](const std::function<void(Model::CancelSpotFleetRequestsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelSpotFleetRequestsAsync(request, [complete](const EC2Client*, const Model::CancelSpotFleetRequestsRequest&, const Model::CancelSpotFleetRequestsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelSpotFleetRequestsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Cancels one or more Spot instance requests. Spot instances are instances that
          * Amazon EC2 starts on your behalf when the bid price that you specify exceeds the
@@ -1902,6 +2482,35 @@ namespace Model
          */
         virtual void CancelSpotInstanceRequestsAsync(const Model::CancelSpotInstanceRequestsRequest& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels one or more Spot instance requests. Spot instances are instances that
+         * Amazon EC2 starts on your behalf when the bid price that you specify exceeds the
+         * current Spot price. Amazon EC2 periodically sets the Spot price based on
+         * available Spot instance capacity and current Spot instance requests. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/spot-requests.html">Spot
+         * Instance Requests</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         * <important> <p>Canceling a Spot instance request does not terminate running Spot
+         * instances associated with the request.</p> </important>
+         *
+         * Returns an awaitable that starts the operation the way CancelSpotInstanceRequestsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelSpotInstanceRequestsRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelSpotInstanceRequestsOutcome> CancelSpotInstanceRequestsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelSpotInstanceRequestsOutcome>([this, request](const std::function<void(Model::CancelSpotInstanceRequestsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelSpotInstanceRequestsAsync(request, [complete](const EC2Client*, const Model::CancelSpotInstanceRequestsRequest&, const Model::CancelSpotInstanceRequestsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelSpotInstanceRequestsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Determines whether a product code is associated with an instance. This action
          * can only be used by the owner of the product code. It is useful when a product
@@ -1930,6 +2539,30 @@ namespace Model
          */
         virtual void ConfirmProductInstanceAsync(const Model::ConfirmProductInstanceRequest& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Determines whether a product code is associated with an instance. This action
+         * can only be used by the owner of the product code. It is useful when a product
+         * code owner needs to verify whether another user's instance is eligible for
+         * support.</p>
+         *
+         * Returns an awaitable that starts the operation the way ConfirmProductInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ConfirmProductInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ConfirmProductInstanceOutcome> ConfirmProductInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ConfirmProductInstanceOutcome>([this, request](const std::function<void(Model::ConfirmProductInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ConfirmProductInstanceAsync(request, [complete](const EC2Client*, const Model::ConfirmProductInstanceRequest&, const Model::ConfirmProductInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ConfirmProductInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Initiates the copy of an AMI from the specified source region to the current
          * region. You specify the destination region by using its endpoint when making the
@@ -1961,6 +2594,31 @@ namespace Model
          */
         virtual void CopyImageAsync(const Model::CopyImageRequest& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Initiates the copy of an AMI from the specified source region to the current
+         * region. You specify the destination region by using its endpoint when making the
+         * request.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/CopyingAMIs.html">Copying
+         * AMIs</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CopyImageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CopyImageRequest>
+        Aws::Utils::Threading::Awaitable<Model::CopyImageOutcome> CopyImageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CopyImageOutcome>([this, request](const std::function<void(Model::CopyImageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CopyImageAsync(request, [complete](const EC2Client*, const Model::CopyImageRequest&, const Model::CopyImageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CopyImageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Copies a point-in-time snapshot of an EBS volume and stores it in Amazon S3.
          * You can copy the snapshot within the same region or from one region to another.
@@ -2016,6 +2674,39 @@ namespace Model
          */
         virtual void CopySnapshotAsync(const Model::CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Copies a point-in-time snapshot of an EBS volume and stores it in Amazon S3.
+         * You can copy the snapshot within the same region or from one region to another.
+         * You can use the snapshot to create EBS volumes or Amazon Machine Images (AMIs).
+         * The snapshot is copied to the regional endpoint that you send the HTTP request
+         * to.</p> <p>Copies of encrypted EBS snapshots remain encrypted. Copies of
+         * unencrypted snapshots remain unencrypted, unless the <code>Encrypted</code> flag
+         * is specified during the snapshot copy operation. By default, encrypted snapshot
+         * copies use the default AWS Key Management Service (AWS KMS) customer master key
+         * (CMK); however, you can specify a non-default CMK with the <code>KmsKeyId</code>
+         * parameter.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ebs-copy-snapshot.html">Copying
+         * an Amazon EBS Snapshot</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CopySnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CopySnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CopySnapshotOutcome> CopySnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CopySnapshotOutcome>([this, request](const std::function<void(Model::CopySnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CopySnapshotAsync(request, [complete](const EC2Client*, const Model::CopySnapshotRequest&, const Model::CopySnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CopySnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides information to AWS about your VPN customer gateway device. The
          * customer gateway is the appliance at your end of the VPN connection. (The device
@@ -2095,6 +2786,47 @@ namespace Model
          */
         virtual void CreateCustomerGatewayAsync(const Model::CreateCustomerGatewayRequest& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides information to AWS about your VPN customer gateway device. The
+         * customer gateway is the appliance at your end of the VPN connection. (The device
+         * on the AWS side of the VPN connection is the virtual private gateway.) You must
+         * provide the Internet-routable IP address of the customer gateway's external
+         * interface. The IP address must be static and may be behind a device performing
+         * network address translation (NAT).</p> <p>For devices that use Border Gateway
+         * Protocol (BGP), you can also provide the device's BGP Autonomous System Number
+         * (ASN). You can use an existing ASN assigned to your network. If you don't have
+         * an ASN already, you can use a private ASN (in the 64512 - 65534 range).</p>
+         * <note> <p>Amazon EC2 supports all 2-byte ASN numbers in the range of 1 - 65534,
+         * with the exception of 7224, which is reserved in the <code>us-east-1</code>
+         * region, and 9059, which is reserved in the <code>eu-west-1</code> region.</p>
+         * </note> <p>For more information about VPN customer gateways, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
+         * a Hardware Virtual Private Gateway to Your VPC</a> in the <i>Amazon Virtual
+         * Private Cloud User Guide</i>.</p> <important> <p>You cannot create more than one
+         * customer gateway with the same VPN type, IP address, and BGP ASN parameter
+         * values. If you run an identical request more than one time, the first request
+         * creates the customer gateway, and subsequent requests return information about
+         * the existing customer gateway. The subsequent requests do not create new
+         * customer gateway resources. </p> </important>
+         *
+         * Returns an awaitable that starts the operation the way CreateCustomerGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateCustomerGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateCustomerGatewayOutcome> CreateCustomerGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateCustomerGatewayOutcome>([this, request](const std::function<void(Model::CreateCustomerGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateCustomerGatewayAsync(request, [complete](const EC2Client*, const Model::CreateCustomerGatewayRequest&, const Model::CreateCustomerGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateCustomerGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a set of DHCP options for your VPC. After creating the set, you must
          * associate it with the VPC, causing all existing and new instances that you
@@ -2213,6 +2945,60 @@ namespace Model
          */
         virtual void CreateDhcpOptionsAsync(const Model::CreateDhcpOptionsRequest& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a set of DHCP options for your VPC. After creating the set, you must
+         * associate it with the VPC, causing all existing and new instances that you
+         * launch in the VPC to use this set of DHCP options. The following are the
+         * individual DHCP options you can specify. For more information about the options,
+         * see <a href="http://www.ietf.org/rfc/rfc2132.txt">RFC 2132</a>.</p> <ul>
+         * <li><code>domain-name-servers</code> - The IP addresses of up to four domain
+         * name servers, or <code>AmazonProvidedDNS</code>. The default DHCP option set
+         * specifies <code>AmazonProvidedDNS</code>. If specifying more than one domain
+         * name server, specify the IP addresses in a single parameter, separated by
+         * commas.</li> <li><code>domain-name</code> - If you're using AmazonProvidedDNS in
+         * <code>us-east-1</code>, specify <code>ec2.internal</code>. If you're using
+         * AmazonProvidedDNS in another region, specify
+         * <code>region.compute.internal</code> (for example,
+         * <code>ap-northeast-1.compute.internal</code>). Otherwise, specify a domain name
+         * (for example, <code>MyCompany.com</code>). <b>Important</b>: Some Linux
+         * operating systems accept multiple domain names separated by spaces. However,
+         * Windows and other Linux operating systems treat the value as a single domain,
+         * which results in unexpected behavior. If your DHCP options set is associated
+         * with a VPC that has instances with multiple operating systems, specify only one
+         * domain name.</li> <li><code>ntp-servers</code> - The IP addresses of up to four
+         * Network Time Protocol (NTP) servers.</li> <li><code>netbios-name-servers</code>
+         * - The IP addresses of up to four NetBIOS name servers.</li>
+         * <li><code>netbios-node-type</code> - The NetBIOS node type (1, 2, 4, or 8). We
+         * recommend that you specify 2 (broadcast and multicast are not currently
+         * supported). For more information about these node types, see <a
+         * href="http://www.ietf.org/rfc/rfc2132.txt">RFC 2132</a>. </li> </ul> <p>Your VPC
+         * automatically starts out with a set of DHCP options that includes only a DNS
+         * server that we provide (AmazonProvidedDNS). If you create a set of options, and
+         * if your VPC has an Internet gateway, make sure to set the
+         * <code>domain-name-servers</code> option either to <code>AmazonProvidedDNS</code>
+         * or to a domain name server of your choice. For more information about DHCP
+         * options, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_DHCP_Options.html">DHCP
+         * Options Sets</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDhcpOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDhcpOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDhcpOptionsOutcome> CreateDhcpOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDhcpOptionsOutcome>([this, request](const std::function<void(Model::CreateDhcpOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDhcpOptionsAsync(request, [complete](const EC2Client*, const Model::CreateDhcpOptionsRequest&, const Model::CreateDhcpOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDhcpOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates one or more flow logs to capture IP traffic for a specific network
          * interface, subnet, or VPC. Flow logs are delivered to a specified log group in
@@ -2253,6 +3039,34 @@ namespace Model
          */
         virtual void CreateFlowLogsAsync(const Model::CreateFlowLogsRequest& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates one or more flow logs to capture IP traffic for a specific network
+         * interface, subnet, or VPC. Flow logs are delivered to a specified log group in
+         * Amazon CloudWatch Logs. If you specify a VPC or subnet in the request, a log
+         * stream is created in CloudWatch Logs for each network interface in the subnet or
+         * VPC. Log streams can include information about accepted and rejected traffic to
+         * a network interface. You can view the data in your log streams using Amazon
+         * CloudWatch Logs. </p> <p>In your request, you must also specify an IAM role that
+         * has permission to publish logs to CloudWatch Logs.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateFlowLogsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateFlowLogsRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateFlowLogsOutcome> CreateFlowLogsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateFlowLogsOutcome>([this, request](const std::function<void(Model::CreateFlowLogsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateFlowLogsAsync(request, [complete](const EC2Client*, const Model::CreateFlowLogsRequest&, const Model::CreateFlowLogsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateFlowLogsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an Amazon EBS-backed AMI from an Amazon EBS-backed instance that is
          * either running or stopped.</p> <p>If you customized your instance with instance
@@ -2296,6 +3110,35 @@ namespace Model
          */
         virtual void CreateImageAsync(const Model::CreateImageRequest& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an Amazon EBS-backed AMI from an Amazon EBS-backed instance that is
+         * either running or stopped.</p> <p>If you customized your instance with instance
+         * store volumes or EBS volumes in addition to the root device volume, the new AMI
+         * contains block device mapping information for those volumes. When you launch an
+         * instance from this new AMI, the instance automatically launches with those
+         * additional volumes.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/creating-an-ami-ebs.html">Creating
+         * Amazon EBS-Backed Linux AMIs</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateImageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateImageRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateImageOutcome> CreateImageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateImageOutcome>([this, request](const std::function<void(Model::CreateImageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateImageAsync(request, [complete](const EC2Client*, const Model::CreateImageRequest&, const Model::CreateImageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateImageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Exports a running or stopped instance to an S3 bucket.</p> <p>For information
          * about the supported operating systems, image formats, and known limitations for
@@ -2327,6 +3170,31 @@ namespace Model
          */
         virtual void CreateInstanceExportTaskAsync(const Model::CreateInstanceExportTaskRequest& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Exports a running or stopped instance to an S3 bucket.</p> <p>For information
+         * about the supported operating systems, image formats, and known limitations for
+         * the types of instances you can export, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ExportingEC2Instances.html">Exporting
+         * EC2 Instances</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateInstanceExportTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateInstanceExportTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateInstanceExportTaskOutcome> CreateInstanceExportTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateInstanceExportTaskOutcome>([this, request](const std::function<void(Model::CreateInstanceExportTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateInstanceExportTaskAsync(request, [complete](const EC2Client*, const Model::CreateInstanceExportTaskRequest&, const Model::CreateInstanceExportTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateInstanceExportTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an Internet gateway for use with a VPC. After creating the Internet
          * gateway, you attach it to a VPC using <a>AttachInternetGateway</a>.</p> <p>For
@@ -2358,6 +3226,31 @@ namespace Model
          */
         virtual void CreateInternetGatewayAsync(const Model::CreateInternetGatewayRequest& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an Internet gateway for use with a VPC. After creating the Internet
+         * gateway, you attach it to a VPC using <a>AttachInternetGateway</a>.</p> <p>For
+         * more information about your VPC and Internet gateway, see the <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/">Amazon Virtual
+         * Private Cloud User Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateInternetGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateInternetGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateInternetGatewayOutcome> CreateInternetGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateInternetGatewayOutcome>([this, request](const std::function<void(Model::CreateInternetGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateInternetGatewayAsync(request, [complete](const EC2Client*, const Model::CreateInternetGatewayRequest&, const Model::CreateInternetGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateInternetGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a 2048-bit RSA key pair with the specified name. Amazon EC2 stores
          * the public key and displays the private key for you to save to a file. The
@@ -2404,6 +3297,36 @@ namespace Model
          */
         virtual void CreateKeyPairAsync(const Model::CreateKeyPairRequest& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a 2048-bit RSA key pair with the specified name. Amazon EC2 stores
+         * the public key and displays the private key for you to save to a file. The
+         * private key is returned as an unencrypted PEM encoded PKCS#8 private key. If a
+         * key with the specified name already exists, Amazon EC2 returns an error.</p>
+         * <p>You can have up to five thousand key pairs per region.</p> <p>The key pair
+         * returned to you is available only in the region in which you create it. To
+         * create a key pair that is available in all regions, use
+         * <a>ImportKeyPair</a>.</p> <p>For more information about key pairs, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ec2-key-pairs.html">Key
+         * Pairs</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateKeyPairAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateKeyPairRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateKeyPairOutcome> CreateKeyPairAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateKeyPairOutcome>([this, request](const std::function<void(Model::CreateKeyPairOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateKeyPairAsync(request, [complete](const EC2Client*, const Model::CreateKeyPairRequest&, const Model::CreateKeyPairOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateKeyPairOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a NAT gateway in the specified subnet. A NAT gateway can be used to
          * enable instances in a private subnet to connect to the Internet. This action
@@ -2438,6 +3361,32 @@ namespace Model
          */
         virtual void CreateNatGatewayAsync(const Model::CreateNatGatewayRequest& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a NAT gateway in the specified subnet. A NAT gateway can be used to
+         * enable instances in a private subnet to connect to the Internet. This action
+         * creates a network interface in the specified subnet with a private IP address
+         * from the IP address range of the subnet. For more information, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/vpc-nat-gateway.html">NAT
+         * Gateways</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateNatGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateNatGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateNatGatewayOutcome> CreateNatGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateNatGatewayOutcome>([this, request](const std::function<void(Model::CreateNatGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateNatGatewayAsync(request, [complete](const EC2Client*, const Model::CreateNatGatewayRequest&, const Model::CreateNatGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateNatGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a network ACL in a VPC. Network ACLs provide an optional layer of
          * security (in addition to security groups) for the instances in your VPC.</p>
@@ -2469,6 +3418,31 @@ namespace Model
          */
         virtual void CreateNetworkAclAsync(const Model::CreateNetworkAclRequest& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a network ACL in a VPC. Network ACLs provide an optional layer of
+         * security (in addition to security groups) for the instances in your VPC.</p>
+         * <p>For more information about network ACLs, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_ACLs.html">Network
+         * ACLs</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateNetworkAclAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateNetworkAclRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateNetworkAclOutcome> CreateNetworkAclAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateNetworkAclOutcome>([this, request](const std::function<void(Model::CreateNetworkAclOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateNetworkAclAsync(request, [complete](const EC2Client*, const Model::CreateNetworkAclRequest&, const Model::CreateNetworkAclOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateNetworkAclOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an entry (a rule) in a network ACL with the specified rule number.
          * Each network ACL has a set of numbered ingress rules and a separate set of
@@ -2527,6 +3501,40 @@ namespace Model
          */
         virtual void CreateNetworkAclEntryAsync(const Model::CreateNetworkAclEntryRequest& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an entry (a rule) in a network ACL with the specified rule number.
+         * Each network ACL has a set of numbered ingress rules and a separate set of
+         * numbered egress rules. When determining whether a packet should be allowed in or
+         * out of a subnet associated with the ACL, we process the entries in the ACL
+         * according to the rule numbers, in ascending order. Each network ACL has a set of
+         * ingress rules and a separate set of egress rules.</p> <p>We recommend that you
+         * leave room between the rule numbers (for example, 100, 110, 120, ...), and not
+         * number them one right after the other (for example, 101, 102, 103, ...). This
+         * makes it easier to add a rule between existing ones without having to renumber
+         * the rules.</p> <p>After you add an entry, you can't modify it; you must either
+         * replace it, or create an entry and delete the old one.</p> <p>For more
+         * information about network ACLs, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_ACLs.html">Network
+         * ACLs</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateNetworkAclEntryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateNetworkAclEntryRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateNetworkAclEntryOutcome> CreateNetworkAclEntryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateNetworkAclEntryOutcome>([this, request](const std::function<void(Model::CreateNetworkAclEntryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateNetworkAclEntryAsync(request, [complete](const EC2Client*, const Model::CreateNetworkAclEntryRequest&, const Model::CreateNetworkAclEntryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateNetworkAclEntryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a network interface in the specified subnet.</p> <p>For more
          * information about network interfaces, see <a
@@ -2558,6 +3566,31 @@ namespace Model
          */
         virtual void CreateNetworkInterfaceAsync(const Model::CreateNetworkInterfaceRequest& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a network interface in the specified subnet.</p> <p>For more
+         * information about network interfaces, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using-eni.html">Elastic
+         * Network Interfaces</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateNetworkInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateNetworkInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateNetworkInterfaceOutcome> CreateNetworkInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateNetworkInterfaceOutcome>([this, request](const std::function<void(Model::CreateNetworkInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateNetworkInterfaceAsync(request, [complete](const EC2Client*, const Model::CreateNetworkInterfaceRequest&, const Model::CreateNetworkInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateNetworkInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a placement group that you launch cluster instances into. You must
          * give the group a name that's unique within the scope of your account.</p> <p>For
@@ -2589,6 +3622,31 @@ namespace Model
          */
         virtual void CreatePlacementGroupAsync(const Model::CreatePlacementGroupRequest& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a placement group that you launch cluster instances into. You must
+         * give the group a name that's unique within the scope of your account.</p> <p>For
+         * more information about placement groups and cluster instances, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using_cluster_computing.html">Cluster
+         * Instances</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePlacementGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePlacementGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePlacementGroupOutcome> CreatePlacementGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePlacementGroupOutcome>([this, request](const std::function<void(Model::CreatePlacementGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePlacementGroupAsync(request, [complete](const EC2Client*, const Model::CreatePlacementGroupRequest&, const Model::CreatePlacementGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePlacementGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a listing for Amazon EC2 Reserved Instances to be sold in the
          * Reserved Instance Marketplace. You can submit one Reserved Instance listing at a
@@ -2659,6 +3717,44 @@ namespace Model
          */
         virtual void CreateReservedInstancesListingAsync(const Model::CreateReservedInstancesListingRequest& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a listing for Amazon EC2 Reserved Instances to be sold in the
+         * Reserved Instance Marketplace. You can submit one Reserved Instance listing at a
+         * time. To get a list of your Reserved Instances, you can use the
+         * <a>DescribeReservedInstances</a> operation.</p> <p>The Reserved Instance
+         * Marketplace matches sellers who want to resell Reserved Instance capacity that
+         * they no longer need with buyers who want to purchase additional capacity.
+         * Reserved Instances bought and sold through the Reserved Instance Marketplace
+         * work like any other Reserved Instances.</p> <p>To sell your Reserved Instances,
+         * you must first register as a seller in the Reserved Instance Marketplace. After
+         * completing the registration process, you can create a Reserved Instance
+         * Marketplace listing of some or all of your Reserved Instances, and specify the
+         * upfront price to receive for them. Your Reserved Instance listings then become
+         * available for purchase. To view the details of your Reserved Instance listing,
+         * you can use the <a>DescribeReservedInstancesListings</a> operation.</p> <p>For
+         * more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ri-market-general.html">Reserved
+         * Instance Marketplace</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateReservedInstancesListingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateReservedInstancesListingRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateReservedInstancesListingOutcome> CreateReservedInstancesListingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateReservedInstancesListingOutcome>([this, request](const std::function<void(Model::CreateReservedInstancesListingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateReservedInstancesListingAsync(request, [complete](const EC2Client*, const Model::CreateReservedInstancesListingRequest&, const Model::CreateReservedInstancesListingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateReservedInstancesListingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a route in a route table within a VPC.</p> <p>You must specify one of
          * the following targets: Internet gateway or virtual private gateway, NAT
@@ -2717,6 +3813,40 @@ namespace Model
          */
         virtual void CreateRouteAsync(const Model::CreateRouteRequest& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a route in a route table within a VPC.</p> <p>You must specify one of
+         * the following targets: Internet gateway or virtual private gateway, NAT
+         * instance, NAT gateway, VPC peering connection, or network interface.</p> <p>When
+         * determining how to route traffic, we use the route with the most specific match.
+         * For example, let's say the traffic is destined for <code>192.0.2.3</code>, and
+         * the route table includes the following two routes:</p> <ul> <li>
+         * <p><code>192.0.2.0/24</code> (goes to some target A)</p> </li> <li>
+         * <p><code>192.0.2.0/28</code> (goes to some target B)</p> </li> </ul> <p>Both
+         * routes apply to the traffic destined for <code>192.0.2.3</code>. However, the
+         * second route in the list covers a smaller number of IP addresses and is
+         * therefore more specific, so we use that route to determine where to target the
+         * traffic.</p> <p>For more information about route tables, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_Route_Tables.html">Route
+         * Tables</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateRouteAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateRouteRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateRouteOutcome> CreateRouteAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateRouteOutcome>([this, request](const std::function<void(Model::CreateRouteOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateRouteAsync(request, [complete](const EC2Client*, const Model::CreateRouteRequest&, const Model::CreateRouteOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateRouteOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a route table for the specified VPC. After you create a route table,
          * you can add routes and associate the table with a subnet.</p> <p>For more
@@ -2748,6 +3878,31 @@ namespace Model
          */
         virtual void CreateRouteTableAsync(const Model::CreateRouteTableRequest& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a route table for the specified VPC. After you create a route table,
+         * you can add routes and associate the table with a subnet.</p> <p>For more
+         * information about route tables, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_Route_Tables.html">Route
+         * Tables</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateRouteTableAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateRouteTableRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateRouteTableOutcome> CreateRouteTableAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateRouteTableOutcome>([this, request](const std::function<void(Model::CreateRouteTableOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateRouteTableAsync(request, [complete](const EC2Client*, const Model::CreateRouteTableRequest&, const Model::CreateRouteTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateRouteTableOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a security group.</p> <p>A security group is for use with instances
          * either in the EC2-Classic platform or in a specific VPC. For more information,
@@ -2830,6 +3985,48 @@ namespace Model
          */
         virtual void CreateSecurityGroupAsync(const Model::CreateSecurityGroupRequest& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a security group.</p> <p>A security group is for use with instances
+         * either in the EC2-Classic platform or in a specific VPC. For more information,
+         * see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using-network-security.html">Amazon
+         * EC2 Security Groups</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>
+         * and <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_SecurityGroups.html">Security
+         * Groups for Your VPC</a> in the <i>Amazon Virtual Private Cloud User
+         * Guide</i>.</p> <important> <p>EC2-Classic: You can have up to 500 security
+         * groups.</p> <p>EC2-VPC: You can create up to 500 security groups per VPC.</p>
+         * </important> <p>When you create a security group, you specify a friendly name of
+         * your choice. You can have a security group for use in EC2-Classic with the same
+         * name as a security group for use in a VPC. However, you can't have two security
+         * groups for use in EC2-Classic with the same name or two security groups for use
+         * in a VPC with the same name.</p> <p>You have a default security group for use in
+         * EC2-Classic and a default security group for use in your VPC. If you don't
+         * specify a security group when you launch an instance, the instance is launched
+         * into the appropriate default security group. A default security group includes a
+         * default rule that grants instances unrestricted network access to each
+         * other.</p> <p>You can add or remove rules from your security groups using
+         * <a>AuthorizeSecurityGroupIngress</a>, <a>AuthorizeSecurityGroupEgress</a>,
+         * <a>RevokeSecurityGroupIngress</a>, and <a>RevokeSecurityGroupEgress</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateSecurityGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSecurityGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSecurityGroupOutcome> CreateSecurityGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSecurityGroupOutcome>([this, request](const std::function<void(Model::CreateSecurityGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSecurityGroupAsync(request, [complete](const EC2Client*, const Model::CreateSecurityGroupRequest&, const Model::CreateSecurityGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSecurityGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a snapshot of an EBS volume and stores it in Amazon S3. You can use
          * snapshots for backups, to make copies of EBS volumes, and to save data before
@@ -2915,6 +4112,49 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a snapshot of an EBS volume and stores it in Amazon S3. You can use
+         * snapshots for backups, to make copies of EBS volumes, and to save data before
+         * shutting down an instance.</p> <p>When a snapshot is created, any AWS
+         * Marketplace product codes that are associated with the source volume are
+         * propagated to the snapshot.</p> <p>You can take a snapshot of an attached volume
+         * that is in use. However, snapshots only capture data that has been written to
+         * your EBS volume at the time the snapshot command is issued; this may exclude any
+         * data that has been cached by any applications or the operating system. If you
+         * can pause any file systems on the volume long enough to take a snapshot, your
+         * snapshot should be complete. However, if you cannot pause all file writes to the
+         * volume, you should unmount the volume from within the instance, issue the
+         * snapshot command, and then remount the volume to ensure a consistent and
+         * complete snapshot. You may remount and use your volume while the snapshot status
+         * is <code>pending</code>.</p> <p>To create a snapshot for EBS volumes that serve
+         * as root devices, you should stop the instance before taking the snapshot.</p>
+         * <p>Snapshots that are taken from encrypted volumes are automatically encrypted.
+         * Volumes that are created from encrypted snapshots are also automatically
+         * encrypted. Your encrypted volumes and any associated snapshots always remain
+         * protected.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/AmazonEBS.html">Amazon
+         * Elastic Block Store</a> and <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/EBSEncryption.html">Amazon
+         * EBS Encryption</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSnapshotOutcome>([this, request](const std::function<void(Model::CreateSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSnapshotAsync(request, [complete](const EC2Client*, const Model::CreateSnapshotRequest&, const Model::CreateSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a data feed for Spot instances, enabling you to view Spot instance
          * usage logs. You can create one data feed per AWS account. For more information,
@@ -2949,6 +4189,32 @@ namespace Model
          */
         virtual void CreateSpotDatafeedSubscriptionAsync(const Model::CreateSpotDatafeedSubscriptionRequest& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a data feed for Spot instances, enabling you to view Spot instance
+         * usage logs. You can create one data feed per AWS account. For more information,
+         * see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/spot-data-feeds.html">Spot
+         * Instance Data Feed</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateSpotDatafeedSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSpotDatafeedSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSpotDatafeedSubscriptionOutcome> CreateSpotDatafeedSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSpotDatafeedSubscriptionOutcome>([this, request](const std::function<void(Model::CreateSpotDatafeedSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSpotDatafeedSubscriptionAsync(request, [complete](const EC2Client*, const Model::CreateSpotDatafeedSubscriptionRequest&, const Model::CreateSpotDatafeedSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSpotDatafeedSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a subnet in an existing VPC.</p> <p>When you create each subnet, you
          * provide the VPC ID and the CIDR block you want for the subnet. After you create
@@ -3022,6 +4288,45 @@ namespace Model
          */
         virtual void CreateSubnetAsync(const Model::CreateSubnetRequest& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a subnet in an existing VPC.</p> <p>When you create each subnet, you
+         * provide the VPC ID and the CIDR block you want for the subnet. After you create
+         * a subnet, you can't change its CIDR block. The subnet's CIDR block can be the
+         * same as the VPC's CIDR block (assuming you want only a single subnet in the
+         * VPC), or a subset of the VPC's CIDR block. If you create more than one subnet in
+         * a VPC, the subnets' CIDR blocks must not overlap. The smallest subnet (and VPC)
+         * you can create uses a /28 netmask (16 IP addresses), and the largest uses a /16
+         * netmask (65,536 IP addresses).</p> <important> <p>AWS reserves both the first
+         * four and the last IP address in each subnet's CIDR block. They're not available
+         * for use.</p> </important> <p>If you add more than one subnet to a VPC, they're
+         * set up in a star topology with a logical router in the middle.</p> <p>If you
+         * launch an instance in a VPC using an Amazon EBS-backed AMI, the IP address
+         * doesn't change if you stop and restart the instance (unlike a similar instance
+         * launched outside a VPC, which gets a new IP address when restarted). It's
+         * therefore possible to have a subnet with no running instances (they're all
+         * stopped), but no remaining IP addresses available.</p> <p>For more information
+         * about subnets, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_Subnets.html">Your
+         * VPC and Subnets</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateSubnetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSubnetRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSubnetOutcome> CreateSubnetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSubnetOutcome>([this, request](const std::function<void(Model::CreateSubnetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSubnetAsync(request, [complete](const EC2Client*, const Model::CreateSubnetRequest&, const Model::CreateSubnetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSubnetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds or overwrites one or more tags for the specified Amazon EC2 resource or
          * resources. Each resource can have a maximum of 10 tags. Each tag consists of a
@@ -3071,6 +4376,37 @@ namespace Model
          */
         virtual void CreateTagsAsync(const Model::CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds or overwrites one or more tags for the specified Amazon EC2 resource or
+         * resources. Each resource can have a maximum of 10 tags. Each tag consists of a
+         * key and optional value. Tag keys must be unique per resource.</p> <p>For more
+         * information about tags, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/Using_Tags.html">Tagging
+         * Your Resources</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>. For
+         * more information about creating IAM policies that control users' access to
+         * resources based on tags, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ec2-supported-iam-actions-resources.html">Supported
+         * Resource-Level Permissions for Amazon EC2 API Actions</a> in the <i>Amazon
+         * Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTagsOutcome> CreateTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTagsOutcome>([this, request](const std::function<void(Model::CreateTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTagsAsync(request, [complete](const EC2Client*, const Model::CreateTagsRequest&, const Model::CreateTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an EBS volume that can be attached to an instance in the same
          * Availability Zone. The volume is created in the regional endpoint that you send
@@ -3138,6 +4474,43 @@ namespace Model
          */
         virtual void CreateVolumeAsync(const Model::CreateVolumeRequest& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an EBS volume that can be attached to an instance in the same
+         * Availability Zone. The volume is created in the regional endpoint that you send
+         * the HTTP request to. For more information see <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/rande.html">Regions and
+         * Endpoints</a>.</p> <p>You can create a new empty volume or restore a volume from
+         * an EBS snapshot. Any AWS Marketplace product codes from the snapshot are
+         * propagated to the volume.</p> <p>You can create encrypted volumes with the
+         * <code>Encrypted</code> parameter. Encrypted volumes may only be attached to
+         * instances that support Amazon EBS encryption. Volumes that are created from
+         * encrypted snapshots are also automatically encrypted. For more information, see
+         * <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/EBSEncryption.html">Amazon
+         * EBS Encryption</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         * <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ebs-creating-volume.html">Creating
+         * or Restoring an Amazon EBS Volume</a> in the <i>Amazon Elastic Compute Cloud
+         * User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateVolumeOutcome> CreateVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateVolumeOutcome>([this, request](const std::function<void(Model::CreateVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateVolumeAsync(request, [complete](const EC2Client*, const Model::CreateVolumeRequest&, const Model::CreateVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a VPC with the specified CIDR block.</p> <p>The smallest VPC you can
          * create uses a /28 netmask (16 IP addresses), and the largest uses a /16 netmask
@@ -3184,6 +4557,36 @@ namespace Model
          */
         virtual void CreateVpcAsync(const Model::CreateVpcRequest& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a VPC with the specified CIDR block.</p> <p>The smallest VPC you can
+         * create uses a /28 netmask (16 IP addresses), and the largest uses a /16 netmask
+         * (65,536 IP addresses). To help you decide how big to make your VPC, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_Subnets.html">Your
+         * VPC and Subnets</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         * <p>By default, each instance you launch in the VPC has the default DHCP options,
+         * which includes only a default DNS server that we provide (AmazonProvidedDNS).
+         * For more information about DHCP options, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_DHCP_Options.html">DHCP
+         * Options Sets</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateVpcAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateVpcRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateVpcOutcome> CreateVpcAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateVpcOutcome>([this, request](const std::function<void(Model::CreateVpcOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateVpcAsync(request, [complete](const EC2Client*, const Model::CreateVpcRequest&, const Model::CreateVpcOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateVpcOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a VPC endpoint for a specified AWS service. An endpoint enables you
          * to create a private connection between your VPC and another AWS service in your
@@ -3218,6 +4621,32 @@ namespace Model
          */
         virtual void CreateVpcEndpointAsync(const Model::CreateVpcEndpointRequest& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a VPC endpoint for a specified AWS service. An endpoint enables you
+         * to create a private connection between your VPC and another AWS service in your
+         * account. You can specify an endpoint policy to attach to the endpoint that will
+         * control access to the service from your VPC. You can also specify the VPC route
+         * tables that use the endpoint.</p> <p>Currently, only endpoints to Amazon S3 are
+         * supported.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateVpcEndpointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateVpcEndpointRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateVpcEndpointOutcome> CreateVpcEndpointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateVpcEndpointOutcome>([this, request](const std::function<void(Model::CreateVpcEndpointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateVpcEndpointAsync(request, [complete](const EC2Client*, const Model::CreateVpcEndpointRequest&, const Model::CreateVpcEndpointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateVpcEndpointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests a VPC peering connection between two VPCs: a requester VPC that you
          * own and a peer VPC with which to create the connection. The peer VPC can belong
@@ -3261,6 +4690,35 @@ namespace Model
          */
         virtual void CreateVpcPeeringConnectionAsync(const Model::CreateVpcPeeringConnectionRequest& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests a VPC peering connection between two VPCs: a requester VPC that you
+         * own and a peer VPC with which to create the connection. The peer VPC can belong
+         * to another AWS account. The requester VPC and peer VPC cannot have overlapping
+         * CIDR blocks.</p> <p>The owner of the peer VPC must accept the peering request to
+         * activate the peering connection. The VPC peering connection request expires
+         * after 7 days, after which it cannot be accepted or rejected.</p> <p>A
+         * <code>CreateVpcPeeringConnection</code> request between VPCs with overlapping
+         * CIDR blocks results in the VPC peering connection having a status of
+         * <code>failed</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateVpcPeeringConnectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateVpcPeeringConnectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateVpcPeeringConnectionOutcome> CreateVpcPeeringConnectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateVpcPeeringConnectionOutcome>([this, request](const std::function<void(Model::CreateVpcPeeringConnectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateVpcPeeringConnectionAsync(request, [complete](const EC2Client*, const Model::CreateVpcPeeringConnectionRequest&, const Model::CreateVpcPeeringConnectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateVpcPeeringConnectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a VPN connection between an existing virtual private gateway and a
          * VPN customer gateway. The only supported connection type is
@@ -3316,6 +4774,39 @@ namespace Model
          */
         virtual void CreateVpnConnectionAsync(const Model::CreateVpnConnectionRequest& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a VPN connection between an existing virtual private gateway and a
+         * VPN customer gateway. The only supported connection type is
+         * <code>ipsec.1</code>.</p> <p>The response includes information that you need to
+         * give to your network administrator to configure your customer gateway.</p>
+         * <important> <p>We strongly recommend that you use HTTPS when calling this
+         * operation because the response contains sensitive cryptographic information for
+         * configuring your customer gateway.</p> </important> <p>If you decide to shut
+         * down your VPN connection for any reason and later create a new VPN connection,
+         * you must reconfigure your customer gateway with the new information returned
+         * from this call.</p> <p>For more information about VPN connections, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
+         * a Hardware Virtual Private Gateway to Your VPC</a> in the <i>Amazon Virtual
+         * Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateVpnConnectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateVpnConnectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateVpnConnectionOutcome> CreateVpnConnectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateVpnConnectionOutcome>([this, request](const std::function<void(Model::CreateVpnConnectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateVpnConnectionAsync(request, [complete](const EC2Client*, const Model::CreateVpnConnectionRequest&, const Model::CreateVpnConnectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateVpnConnectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a static route associated with a VPN connection between an existing
          * virtual private gateway and a VPN customer gateway. The static route allows
@@ -3353,6 +4844,33 @@ namespace Model
          */
         virtual void CreateVpnConnectionRouteAsync(const Model::CreateVpnConnectionRouteRequest& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a static route associated with a VPN connection between an existing
+         * virtual private gateway and a VPN customer gateway. The static route allows
+         * traffic to be routed from the virtual private gateway to the VPN customer
+         * gateway.</p> <p>For more information about VPN connections, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
+         * a Hardware Virtual Private Gateway to Your VPC</a> in the <i>Amazon Virtual
+         * Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateVpnConnectionRouteAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateVpnConnectionRouteRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateVpnConnectionRouteOutcome> CreateVpnConnectionRouteAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateVpnConnectionRouteOutcome>([this, request](const std::function<void(Model::CreateVpnConnectionRouteOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateVpnConnectionRouteAsync(request, [complete](const EC2Client*, const Model::CreateVpnConnectionRouteRequest&, const Model::CreateVpnConnectionRouteOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateVpnConnectionRouteOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a virtual private gateway. A virtual private gateway is the endpoint
          * on the VPC side of your VPN connection. You can create a virtual private gateway
@@ -3390,6 +4908,33 @@ namespace Model
          */
         virtual void CreateVpnGatewayAsync(const Model::CreateVpnGatewayRequest& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a virtual private gateway. A virtual private gateway is the endpoint
+         * on the VPC side of your VPN connection. You can create a virtual private gateway
+         * before creating the VPC itself.</p> <p>For more information about virtual
+         * private gateways, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
+         * a Hardware Virtual Private Gateway to Your VPC</a> in the <i>Amazon Virtual
+         * Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateVpnGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateVpnGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateVpnGatewayOutcome> CreateVpnGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateVpnGatewayOutcome>([this, request](const std::function<void(Model::CreateVpnGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateVpnGatewayAsync(request, [complete](const EC2Client*, const Model::CreateVpnGatewayRequest&, const Model::CreateVpnGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateVpnGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified customer gateway. You must delete the VPN connection
          * before you can delete the customer gateway.</p>
@@ -3412,6 +4957,28 @@ namespace Model
          */
         virtual void DeleteCustomerGatewayAsync(const Model::DeleteCustomerGatewayRequest& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified customer gateway. You must delete the VPN connection
+         * before you can delete the customer gateway.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteCustomerGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteCustomerGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteCustomerGatewayOutcome> DeleteCustomerGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteCustomerGatewayOutcome>([this, request](const std::function<void(Model::DeleteCustomerGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteCustomerGatewayAsync(request, [complete](const EC2Client*, const Model::DeleteCustomerGatewayRequest&, const Model::DeleteCustomerGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteCustomerGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified set of DHCP options. You must disassociate the set of
          * DHCP options before you can delete it. You can disassociate the set of DHCP
@@ -3440,6 +5007,30 @@ namespace Model
          */
         virtual void DeleteDhcpOptionsAsync(const Model::DeleteDhcpOptionsRequest& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified set of DHCP options. You must disassociate the set of
+         * DHCP options before you can delete it. You can disassociate the set of DHCP
+         * options by associating either a new set of options or the default set of options
+         * with the VPC.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDhcpOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDhcpOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDhcpOptionsOutcome> DeleteDhcpOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDhcpOptionsOutcome>([this, request](const std::function<void(Model::DeleteDhcpOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDhcpOptionsAsync(request, [complete](const EC2Client*, const Model::DeleteDhcpOptionsRequest&, const Model::DeleteDhcpOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDhcpOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes one or more flow logs.</p>
          */
@@ -3459,6 +5050,27 @@ namespace Model
          */
         virtual void DeleteFlowLogsAsync(const Model::DeleteFlowLogsRequest& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes one or more flow logs.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteFlowLogsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteFlowLogsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteFlowLogsOutcome> DeleteFlowLogsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteFlowLogsOutcome>([this, request](const std::function<void(Model::DeleteFlowLogsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteFlowLogsAsync(request, [complete](const EC2Client*, const Model::DeleteFlowLogsRequest&, const Model::DeleteFlowLogsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteFlowLogsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified Internet gateway. You must detach the Internet gateway
          * from the VPC before you can delete it.</p>
@@ -3481,6 +5093,28 @@ namespace Model
          */
         virtual void DeleteInternetGatewayAsync(const Model::DeleteInternetGatewayRequest& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified Internet gateway. You must detach the Internet gateway
+         * from the VPC before you can delete it.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteInternetGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteInternetGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteInternetGatewayOutcome> DeleteInternetGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteInternetGatewayOutcome>([this, request](const std::function<void(Model::DeleteInternetGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteInternetGatewayAsync(request, [complete](const EC2Client*, const Model::DeleteInternetGatewayRequest&, const Model::DeleteInternetGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteInternetGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified key pair, by removing the public key from Amazon
          * EC2.</p>
@@ -3503,6 +5137,28 @@ namespace Model
          */
         virtual void DeleteKeyPairAsync(const Model::DeleteKeyPairRequest& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified key pair, by removing the public key from Amazon
+         * EC2.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteKeyPairAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteKeyPairRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteKeyPairOutcome> DeleteKeyPairAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteKeyPairOutcome>([this, request](const std::function<void(Model::DeleteKeyPairOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteKeyPairAsync(request, [complete](const EC2Client*, const Model::DeleteKeyPairRequest&, const Model::DeleteKeyPairOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteKeyPairOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified NAT gateway. Deleting a NAT gateway disassociates its
          * Elastic IP address, but does not release the address from your account. Deleting
@@ -3528,6 +5184,29 @@ namespace Model
          */
         virtual void DeleteNatGatewayAsync(const Model::DeleteNatGatewayRequest& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified NAT gateway. Deleting a NAT gateway disassociates its
+         * Elastic IP address, but does not release the address from your account. Deleting
+         * a NAT gateway does not delete any NAT gateway routes in your route tables. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteNatGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteNatGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteNatGatewayOutcome> DeleteNatGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteNatGatewayOutcome>([this, request](const std::function<void(Model::DeleteNatGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteNatGatewayAsync(request, [complete](const EC2Client*, const Model::DeleteNatGatewayRequest&, const Model::DeleteNatGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteNatGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified network ACL. You can't delete the ACL if it's
          * associated with any subnets. You can't delete the default network ACL.</p>
@@ -3550,6 +5229,28 @@ namespace Model
          */
         virtual void DeleteNetworkAclAsync(const Model::DeleteNetworkAclRequest& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified network ACL. You can't delete the ACL if it's
+         * associated with any subnets. You can't delete the default network ACL.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteNetworkAclAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteNetworkAclRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteNetworkAclOutcome> DeleteNetworkAclAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteNetworkAclOutcome>([this, request](const std::function<void(Model::DeleteNetworkAclOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteNetworkAclAsync(request, [complete](const EC2Client*, const Model::DeleteNetworkAclRequest&, const Model::DeleteNetworkAclOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteNetworkAclOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified ingress or egress entry (rule) from the specified
          * network ACL.</p>
@@ -3572,6 +5273,28 @@ namespace Model
          */
         virtual void DeleteNetworkAclEntryAsync(const Model::DeleteNetworkAclEntryRequest& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified ingress or egress entry (rule) from the specified
+         * network ACL.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteNetworkAclEntryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteNetworkAclEntryRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteNetworkAclEntryOutcome> DeleteNetworkAclEntryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteNetworkAclEntryOutcome>([this, request](const std::function<void(Model::DeleteNetworkAclEntryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteNetworkAclEntryAsync(request, [complete](const EC2Client*, const Model::DeleteNetworkAclEntryRequest&, const Model::DeleteNetworkAclEntryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteNetworkAclEntryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified network interface. You must detach the network
          * interface before you can delete it.</p>
@@ -3594,6 +5317,28 @@ namespace Model
          */
         virtual void DeleteNetworkInterfaceAsync(const Model::DeleteNetworkInterfaceRequest& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified network interface. You must detach the network
+         * interface before you can delete it.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteNetworkInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteNetworkInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteNetworkInterfaceOutcome> DeleteNetworkInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteNetworkInterfaceOutcome>([this, request](const std::function<void(Model::DeleteNetworkInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteNetworkInterfaceAsync(request, [complete](const EC2Client*, const Model::DeleteNetworkInterfaceRequest&, const Model::DeleteNetworkInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteNetworkInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified placement group. You must terminate all instances in
          * the placement group before you can delete the placement group. For more
@@ -3625,6 +5370,31 @@ namespace Model
          */
         virtual void DeletePlacementGroupAsync(const Model::DeletePlacementGroupRequest& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified placement group. You must terminate all instances in
+         * the placement group before you can delete the placement group. For more
+         * information about placement groups and cluster instances, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using_cluster_computing.html">Cluster
+         * Instances</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeletePlacementGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeletePlacementGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeletePlacementGroupOutcome> DeletePlacementGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeletePlacementGroupOutcome>([this, request](const std::function<void(Model::DeletePlacementGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeletePlacementGroupAsync(request, [complete](const EC2Client*, const Model::DeletePlacementGroupRequest&, const Model::DeletePlacementGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeletePlacementGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified route from the specified route table.</p>
          */
@@ -3644,6 +5414,27 @@ namespace Model
          */
         virtual void DeleteRouteAsync(const Model::DeleteRouteRequest& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified route from the specified route table.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRouteAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRouteRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRouteOutcome> DeleteRouteAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRouteOutcome>([this, request](const std::function<void(Model::DeleteRouteOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRouteAsync(request, [complete](const EC2Client*, const Model::DeleteRouteRequest&, const Model::DeleteRouteOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRouteOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified route table. You must disassociate the route table from
          * any subnets before you can delete it. You can't delete the main route table.</p>
@@ -3666,6 +5457,28 @@ namespace Model
          */
         virtual void DeleteRouteTableAsync(const Model::DeleteRouteTableRequest& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified route table. You must disassociate the route table from
+         * any subnets before you can delete it. You can't delete the main route table.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRouteTableAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRouteTableRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRouteTableOutcome> DeleteRouteTableAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRouteTableOutcome>([this, request](const std::function<void(Model::DeleteRouteTableOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRouteTableAsync(request, [complete](const EC2Client*, const Model::DeleteRouteTableRequest&, const Model::DeleteRouteTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRouteTableOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a security group.</p> <p>If you attempt to delete a security group
          * that is associated with an instance, or is referenced by another security group,
@@ -3694,6 +5507,30 @@ namespace Model
          */
         virtual void DeleteSecurityGroupAsync(const Model::DeleteSecurityGroupRequest& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a security group.</p> <p>If you attempt to delete a security group
+         * that is associated with an instance, or is referenced by another security group,
+         * the operation fails with <code>InvalidGroup.InUse</code> in EC2-Classic or
+         * <code>DependencyViolation</code> in EC2-VPC.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSecurityGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSecurityGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSecurityGroupOutcome> DeleteSecurityGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSecurityGroupOutcome>([this, request](const std::function<void(Model::DeleteSecurityGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSecurityGroupAsync(request, [complete](const EC2Client*, const Model::DeleteSecurityGroupRequest&, const Model::DeleteSecurityGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSecurityGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified snapshot.</p> <p>When you make periodic snapshots of a
          * volume, the snapshots are incremental, and only the blocks on the device that
@@ -3746,6 +5583,38 @@ namespace Model
          */
         virtual void DeleteSnapshotAsync(const Model::DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified snapshot.</p> <p>When you make periodic snapshots of a
+         * volume, the snapshots are incremental, and only the blocks on the device that
+         * have changed since your last snapshot are saved in the new snapshot. When you
+         * delete a snapshot, only the data not needed for any other snapshot is removed.
+         * So regardless of which prior snapshots have been deleted, all active snapshots
+         * will have access to all the information needed to restore the volume.</p> <p>You
+         * cannot delete a snapshot of the root device of an EBS volume used by a
+         * registered AMI. You must first de-register the AMI before you can delete the
+         * snapshot.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ebs-deleting-snapshot.html">Deleting
+         * an Amazon EBS Snapshot</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSnapshotOutcome>([this, request](const std::function<void(Model::DeleteSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSnapshotAsync(request, [complete](const EC2Client*, const Model::DeleteSnapshotRequest&, const Model::DeleteSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the data feed for Spot instances.</p>
          */
@@ -3765,6 +5634,27 @@ namespace Model
          */
         virtual void DeleteSpotDatafeedSubscriptionAsync(const Model::DeleteSpotDatafeedSubscriptionRequest& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the data feed for Spot instances.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSpotDatafeedSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSpotDatafeedSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSpotDatafeedSubscriptionOutcome> DeleteSpotDatafeedSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSpotDatafeedSubscriptionOutcome>([this, request](const std::function<void(Model::DeleteSpotDatafeedSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSpotDatafeedSubscriptionAsync(request, [complete](const EC2Client*, const Model::DeleteSpotDatafeedSubscriptionRequest&, const Model::DeleteSpotDatafeedSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSpotDatafeedSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified subnet. You must terminate all running instances in the
          * subnet before you can delete the subnet.</p>
@@ -3787,6 +5677,28 @@ namespace Model
          */
         virtual void DeleteSubnetAsync(const Model::DeleteSubnetRequest& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified subnet. You must terminate all running instances in the
+         * subnet before you can delete the subnet.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSubnetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSubnetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSubnetOutcome> DeleteSubnetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSubnetOutcome>([this, request](const std::function<void(Model::DeleteSubnetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSubnetAsync(request, [complete](const EC2Client*, const Model::DeleteSubnetRequest&, const Model::DeleteSubnetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSubnetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified set of tags from the specified set of resources. This
          * call is designed to follow a <code>DescribeTags</code> request.</p> <p>For more
@@ -3818,6 +5730,31 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified set of tags from the specified set of resources. This
+         * call is designed to follow a <code>DescribeTags</code> request.</p> <p>For more
+         * information about tags, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/Using_Tags.html">Tagging
+         * Your Resources</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTagsOutcome>([this, request](const std::function<void(Model::DeleteTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTagsAsync(request, [complete](const EC2Client*, const Model::DeleteTagsRequest&, const Model::DeleteTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified EBS volume. The volume must be in the
          * <code>available</code> state (not attached to an instance).</p> <note> <p>The
@@ -3855,6 +5792,33 @@ namespace Model
          */
         virtual void DeleteVolumeAsync(const Model::DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified EBS volume. The volume must be in the
+         * <code>available</code> state (not attached to an instance).</p> <note> <p>The
+         * volume may remain in the <code>deleting</code> state for several minutes.</p>
+         * </note> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ebs-deleting-volume.html">Deleting
+         * an Amazon EBS Volume</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVolumeOutcome> DeleteVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVolumeOutcome>([this, request](const std::function<void(Model::DeleteVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVolumeAsync(request, [complete](const EC2Client*, const Model::DeleteVolumeRequest&, const Model::DeleteVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified VPC. You must detach or delete all gateways and
          * resources that are associated with the VPC before you can delete it. For
@@ -3886,6 +5850,31 @@ namespace Model
          */
         virtual void DeleteVpcAsync(const Model::DeleteVpcRequest& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified VPC. You must detach or delete all gateways and
+         * resources that are associated with the VPC before you can delete it. For
+         * example, you must terminate all instances running in the VPC, delete all
+         * security groups associated with the VPC (except the default one), delete all
+         * route tables associated with the VPC (except the default one), and so on.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVpcAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVpcRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVpcOutcome> DeleteVpcAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVpcOutcome>([this, request](const std::function<void(Model::DeleteVpcOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVpcAsync(request, [complete](const EC2Client*, const Model::DeleteVpcRequest&, const Model::DeleteVpcOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVpcOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes one or more specified VPC endpoints. Deleting the endpoint also
          * deletes the endpoint routes in the route tables that were associated with the
@@ -3911,6 +5900,29 @@ namespace Model
          */
         virtual void DeleteVpcEndpointsAsync(const Model::DeleteVpcEndpointsRequest& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes one or more specified VPC endpoints. Deleting the endpoint also
+         * deletes the endpoint routes in the route tables that were associated with the
+         * endpoint.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVpcEndpointsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVpcEndpointsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVpcEndpointsOutcome> DeleteVpcEndpointsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVpcEndpointsOutcome>([this, request](const std::function<void(Model::DeleteVpcEndpointsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVpcEndpointsAsync(request, [complete](const EC2Client*, const Model::DeleteVpcEndpointsRequest&, const Model::DeleteVpcEndpointsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVpcEndpointsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a VPC peering connection. Either the owner of the requester VPC or
          * the owner of the peer VPC can delete the VPC peering connection if it's in the
@@ -3939,6 +5951,30 @@ namespace Model
          */
         virtual void DeleteVpcPeeringConnectionAsync(const Model::DeleteVpcPeeringConnectionRequest& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a VPC peering connection. Either the owner of the requester VPC or
+         * the owner of the peer VPC can delete the VPC peering connection if it's in the
+         * <code>active</code> state. The owner of the requester VPC can delete a VPC
+         * peering connection in the <code>pending-acceptance</code> state. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVpcPeeringConnectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVpcPeeringConnectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVpcPeeringConnectionOutcome> DeleteVpcPeeringConnectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVpcPeeringConnectionOutcome>([this, request](const std::function<void(Model::DeleteVpcPeeringConnectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVpcPeeringConnectionAsync(request, [complete](const EC2Client*, const Model::DeleteVpcPeeringConnectionRequest&, const Model::DeleteVpcPeeringConnectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVpcPeeringConnectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified VPN connection.</p> <p>If you're deleting the VPC and
          * its associated components, we recommend that you detach the virtual private
@@ -3979,6 +6015,34 @@ namespace Model
          */
         virtual void DeleteVpnConnectionAsync(const Model::DeleteVpnConnectionRequest& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified VPN connection.</p> <p>If you're deleting the VPC and
+         * its associated components, we recommend that you detach the virtual private
+         * gateway from the VPC and delete the VPC before deleting the VPN connection. If
+         * you believe that the tunnel credentials for your VPN connection have been
+         * compromised, you can delete the VPN connection and create a new one that has new
+         * keys, without needing to delete the VPC or virtual private gateway. If you
+         * create a new VPN connection, you must reconfigure the customer gateway using the
+         * new configuration information returned with the new VPN connection ID.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVpnConnectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVpnConnectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVpnConnectionOutcome> DeleteVpnConnectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVpnConnectionOutcome>([this, request](const std::function<void(Model::DeleteVpnConnectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVpnConnectionAsync(request, [complete](const EC2Client*, const Model::DeleteVpnConnectionRequest&, const Model::DeleteVpnConnectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVpnConnectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified static route associated with a VPN connection between
          * an existing virtual private gateway and a VPN customer gateway. The static route
@@ -4007,6 +6071,30 @@ namespace Model
          */
         virtual void DeleteVpnConnectionRouteAsync(const Model::DeleteVpnConnectionRouteRequest& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified static route associated with a VPN connection between
+         * an existing virtual private gateway and a VPN customer gateway. The static route
+         * allows traffic to be routed from the virtual private gateway to the VPN customer
+         * gateway.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVpnConnectionRouteAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVpnConnectionRouteRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVpnConnectionRouteOutcome> DeleteVpnConnectionRouteAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVpnConnectionRouteOutcome>([this, request](const std::function<void(Model::DeleteVpnConnectionRouteOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVpnConnectionRouteAsync(request, [complete](const EC2Client*, const Model::DeleteVpnConnectionRouteRequest&, const Model::DeleteVpnConnectionRouteOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVpnConnectionRouteOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified virtual private gateway. We recommend that before you
          * delete a virtual private gateway, you detach it from the VPC and delete the VPN
@@ -4038,6 +6126,31 @@ namespace Model
          */
         virtual void DeleteVpnGatewayAsync(const Model::DeleteVpnGatewayRequest& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified virtual private gateway. We recommend that before you
+         * delete a virtual private gateway, you detach it from the VPC and delete the VPN
+         * connection. Note that you don't need to delete the virtual private gateway if
+         * you plan to delete and recreate the VPN connection between your VPC and your
+         * network.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVpnGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVpnGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVpnGatewayOutcome> DeleteVpnGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVpnGatewayOutcome>([this, request](const std::function<void(Model::DeleteVpnGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVpnGatewayAsync(request, [complete](const EC2Client*, const Model::DeleteVpnGatewayRequest&, const Model::DeleteVpnGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVpnGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deregisters the specified AMI. After you deregister an AMI, it can't be used
          * to launch new instances.</p> <p>This command does not delete the AMI.</p>
@@ -4060,6 +6173,28 @@ namespace Model
          */
         virtual void DeregisterImageAsync(const Model::DeregisterImageRequest& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deregisters the specified AMI. After you deregister an AMI, it can't be used
+         * to launch new instances.</p> <p>This command does not delete the AMI.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterImageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterImageRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterImageOutcome> DeregisterImageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterImageOutcome>([this, request](const std::function<void(Model::DeregisterImageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterImageAsync(request, [complete](const EC2Client*, const Model::DeregisterImageRequest&, const Model::DeregisterImageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterImageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes attributes of your AWS account. The following are the supported
          * account attributes:</p> <ul> <li> <p><code>supported-platforms</code>: Indicates
@@ -4115,6 +6250,39 @@ namespace Model
          */
         virtual void DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes attributes of your AWS account. The following are the supported
+         * account attributes:</p> <ul> <li> <p><code>supported-platforms</code>: Indicates
+         * whether your account can launch instances into EC2-Classic and EC2-VPC, or only
+         * into EC2-VPC.</p> </li> <li> <p><code>default-vpc</code>: The ID of the default
+         * VPC for your account, or <code>none</code>.</p> </li> <li>
+         * <p><code>max-instances</code>: The maximum number of On-Demand instances that
+         * you can run.</p> </li> <li>
+         * <p><code>vpc-max-security-groups-per-interface</code>: The maximum number of
+         * security groups that you can assign to a network interface.</p> </li> <li>
+         * <p><code>max-elastic-ips</code>: The maximum number of Elastic IP addresses that
+         * you can allocate for use with EC2-Classic. </p> </li> <li>
+         * <p><code>vpc-max-elastic-ips</code>: The maximum number of Elastic IP addresses
+         * that you can allocate for use with EC2-VPC.</p> </li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAccountAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAccountAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAccountAttributesOutcome> DescribeAccountAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAccountAttributesOutcome>([this, request](const std::function<void(Model::DescribeAccountAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAccountAttributesAsync(request, [complete](const EC2Client*, const Model::DescribeAccountAttributesRequest&, const Model::DescribeAccountAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAccountAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your Elastic IP addresses.</p> <p>An Elastic IP
          * address is for use in either the EC2-Classic platform or in a VPC. For more
@@ -4146,6 +6314,31 @@ namespace Model
          */
         virtual void DescribeAddressesAsync(const Model::DescribeAddressesRequest& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your Elastic IP addresses.</p> <p>An Elastic IP
+         * address is for use in either the EC2-Classic platform or in a VPC. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/elastic-ip-addresses-eip.html">Elastic
+         * IP Addresses</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAddressesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAddressesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAddressesOutcome> DescribeAddressesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAddressesOutcome>([this, request](const std::function<void(Model::DescribeAddressesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAddressesAsync(request, [complete](const EC2Client*, const Model::DescribeAddressesRequest&, const Model::DescribeAddressesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAddressesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of the Availability Zones that are available to you.
          * The results include zones only for the region you're currently using. If there
@@ -4186,6 +6379,34 @@ namespace Model
          */
         virtual void DescribeAvailabilityZonesAsync(const Model::DescribeAvailabilityZonesRequest& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of the Availability Zones that are available to you.
+         * The results include zones only for the region you're currently using. If there
+         * is an event impacting an Availability Zone, you can use this request to view the
+         * state and any provided message for that Availability Zone.</p> <p>For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using-regions-availability-zones.html">Regions
+         * and Availability Zones</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAvailabilityZonesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAvailabilityZonesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAvailabilityZonesOutcome> DescribeAvailabilityZonesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAvailabilityZonesOutcome>([this, request](const std::function<void(Model::DescribeAvailabilityZonesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAvailabilityZonesAsync(request, [complete](const EC2Client*, const Model::DescribeAvailabilityZonesRequest&, const Model::DescribeAvailabilityZonesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAvailabilityZonesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your bundling tasks.</p> <note><p>Completed bundle
          * tasks are listed for only a limited time. If your bundle task is no longer in
@@ -4217,6 +6438,31 @@ namespace Model
          */
         virtual void DescribeBundleTasksAsync(const Model::DescribeBundleTasksRequest& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your bundling tasks.</p> <note><p>Completed bundle
+         * tasks are listed for only a limited time. If your bundle task is no longer in
+         * the list, you can still register an AMI from it. Just use
+         * <code>RegisterImage</code> with the Amazon S3 bucket name and image manifest
+         * name you provided to the bundle task.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeBundleTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeBundleTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeBundleTasksOutcome> DescribeBundleTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeBundleTasksOutcome>([this, request](const std::function<void(Model::DescribeBundleTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeBundleTasksAsync(request, [complete](const EC2Client*, const Model::DescribeBundleTasksRequest&, const Model::DescribeBundleTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeBundleTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your linked EC2-Classic instances. This request only
          * returns information about EC2-Classic instances linked to a VPC through
@@ -4245,6 +6491,30 @@ namespace Model
          */
         virtual void DescribeClassicLinkInstancesAsync(const Model::DescribeClassicLinkInstancesRequest& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your linked EC2-Classic instances. This request only
+         * returns information about EC2-Classic instances linked to a VPC through
+         * ClassicLink; you cannot use this request to return information about other
+         * instances.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeClassicLinkInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeClassicLinkInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeClassicLinkInstancesOutcome> DescribeClassicLinkInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeClassicLinkInstancesOutcome>([this, request](const std::function<void(Model::DescribeClassicLinkInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeClassicLinkInstancesAsync(request, [complete](const EC2Client*, const Model::DescribeClassicLinkInstancesRequest&, const Model::DescribeClassicLinkInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeClassicLinkInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your conversion tasks. For more information, see <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/UploadingYourInstancesandVolumes.html">Using
@@ -4282,6 +6552,33 @@ namespace Model
          */
         virtual void DescribeConversionTasksAsync(const Model::DescribeConversionTasksRequest& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your conversion tasks. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/UploadingYourInstancesandVolumes.html">Using
+         * the Command Line Tools to Import Your Virtual Machine to Amazon EC2</a> in the
+         * <i>Amazon Elastic Compute Cloud User Guide</i>.</p> <p>For information about the
+         * import manifest referenced by this API action, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/APIReference/manifest.html">VM
+         * Import Manifest</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeConversionTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeConversionTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeConversionTasksOutcome> DescribeConversionTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeConversionTasksOutcome>([this, request](const std::function<void(Model::DescribeConversionTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeConversionTasksAsync(request, [complete](const EC2Client*, const Model::DescribeConversionTasksRequest&, const Model::DescribeConversionTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeConversionTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your VPN customer gateways.</p> <p>For more
          * information about VPN customer gateways, see <a
@@ -4313,6 +6610,31 @@ namespace Model
          */
         virtual void DescribeCustomerGatewaysAsync(const Model::DescribeCustomerGatewaysRequest& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your VPN customer gateways.</p> <p>For more
+         * information about VPN customer gateways, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
+         * a Hardware Virtual Private Gateway to Your VPC</a> in the <i>Amazon Virtual
+         * Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCustomerGatewaysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCustomerGatewaysRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCustomerGatewaysOutcome> DescribeCustomerGatewaysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCustomerGatewaysOutcome>([this, request](const std::function<void(Model::DescribeCustomerGatewaysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCustomerGatewaysAsync(request, [complete](const EC2Client*, const Model::DescribeCustomerGatewaysRequest&, const Model::DescribeCustomerGatewaysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCustomerGatewaysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your DHCP options sets.</p> <p>For more information
          * about DHCP options sets, see <a
@@ -4341,6 +6663,30 @@ namespace Model
          */
         virtual void DescribeDhcpOptionsAsync(const Model::DescribeDhcpOptionsRequest& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your DHCP options sets.</p> <p>For more information
+         * about DHCP options sets, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_DHCP_Options.html">DHCP
+         * Options Sets</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDhcpOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDhcpOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDhcpOptionsOutcome> DescribeDhcpOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDhcpOptionsOutcome>([this, request](const std::function<void(Model::DescribeDhcpOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDhcpOptionsAsync(request, [complete](const EC2Client*, const Model::DescribeDhcpOptionsRequest&, const Model::DescribeDhcpOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDhcpOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your export tasks.</p>
          */
@@ -4360,6 +6706,27 @@ namespace Model
          */
         virtual void DescribeExportTasksAsync(const Model::DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your export tasks.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeExportTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeExportTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeExportTasksOutcome> DescribeExportTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeExportTasksOutcome>([this, request](const std::function<void(Model::DescribeExportTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeExportTasksAsync(request, [complete](const EC2Client*, const Model::DescribeExportTasksRequest&, const Model::DescribeExportTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeExportTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more flow logs. To view the information in your flow logs
          * (the log streams for the network interfaces), you must use the CloudWatch Logs
@@ -4385,6 +6752,29 @@ namespace Model
          */
         virtual void DescribeFlowLogsAsync(const Model::DescribeFlowLogsRequest& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more flow logs. To view the information in your flow logs
+         * (the log streams for the network interfaces), you must use the CloudWatch Logs
+         * console or the CloudWatch Logs API.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeFlowLogsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeFlowLogsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeFlowLogsOutcome> DescribeFlowLogsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeFlowLogsOutcome>([this, request](const std::function<void(Model::DescribeFlowLogsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeFlowLogsAsync(request, [complete](const EC2Client*, const Model::DescribeFlowLogsRequest&, const Model::DescribeFlowLogsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeFlowLogsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your Dedicated hosts.</p> <p>The results describe
          * only the Dedicated hosts in the region you're currently using. All listed
@@ -4411,7 +6801,31 @@ namespace Model
          *
          * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
-        virtual void DescribeHostsAsync(const Model::DescribeHostsRequest& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        virtual void DescribeHostsAsync(const Model::DescribeHostsRequest& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your Dedicated hosts.</p> <p>The results describe
+         * only the Dedicated hosts in the region you're currently using. All listed
+         * instances consume capacity on your Dedicated host. Dedicated hosts that have
+         * recently been released will be listed with the state <code>released</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeHostsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeHostsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeHostsOutcome> DescribeHostsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeHostsOutcome>([this, request](const std::function<void(Model::DescribeHostsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeHostsAsync(request, [complete](const EC2Client*, const Model::DescribeHostsRequest&, const Model::DescribeHostsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeHostsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Describes the ID format settings for your resources on a per-region basis,
@@ -4465,6 +6879,38 @@ namespace Model
          */
         virtual void DescribeIdFormatAsync(const Model::DescribeIdFormatRequest& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the ID format settings for your resources on a per-region basis,
+         * for example, to view which resource types are enabled for longer IDs. This
+         * request only returns information about resource types whose ID formats can be
+         * modified; it does not return information about other resource types. </p> <p>The
+         * following resource types support longer IDs: <code>instance</code> |
+         * <code>reservation</code>. </p> <p>These settings apply to the IAM user who makes
+         * the request; they do not apply to the entire AWS account. By default, an IAM
+         * user defaults to the same settings as the root user, unless they explicitly
+         * override the settings by running the <a>ModifyIdFormat</a> command. Resources
+         * created with longer IDs are visible to all IAM users, regardless of these
+         * settings and provided that they have permission to use the relevant
+         * <code>Describe</code> command for the resource type.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeIdFormatAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeIdFormatRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeIdFormatOutcome> DescribeIdFormatAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeIdFormatOutcome>([this, request](const std::function<void(Model::DescribeIdFormatOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeIdFormatAsync(request, [complete](const EC2Client*, const Model::DescribeIdFormatRequest&, const Model::DescribeIdFormatOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeIdFormatOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified attribute of the specified AMI. You can specify only
          * one attribute at a time.</p>
@@ -4487,6 +6933,28 @@ namespace Model
          */
         virtual void DescribeImageAttributeAsync(const Model::DescribeImageAttributeRequest& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified attribute of the specified AMI. You can specify only
+         * one attribute at a time.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeImageAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeImageAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeImageAttributeOutcome> DescribeImageAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeImageAttributeOutcome>([this, request](const std::function<void(Model::DescribeImageAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeImageAttributeAsync(request, [complete](const EC2Client*, const Model::DescribeImageAttributeRequest&, const Model::DescribeImageAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeImageAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of the images (AMIs, AKIs, and ARIs) available to you.
          * Images available to you include public images, private images that you own, and
@@ -4518,6 +6986,31 @@ namespace Model
          */
         virtual void DescribeImagesAsync(const Model::DescribeImagesRequest& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of the images (AMIs, AKIs, and ARIs) available to you.
+         * Images available to you include public images, private images that you own, and
+         * private images owned by other AWS accounts but for which you have explicit
+         * launch permissions.</p> <note><p>Deregistered images are included in the
+         * returned results for an unspecified interval after deregistration.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeImagesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeImagesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeImagesOutcome> DescribeImagesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeImagesOutcome>([this, request](const std::function<void(Model::DescribeImagesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeImagesAsync(request, [complete](const EC2Client*, const Model::DescribeImagesRequest&, const Model::DescribeImagesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeImagesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Displays details about an import virtual machine or import snapshot tasks
          * that are already created.</p>
@@ -4540,6 +7033,28 @@ namespace Model
          */
         virtual void DescribeImportImageTasksAsync(const Model::DescribeImportImageTasksRequest& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Displays details about an import virtual machine or import snapshot tasks
+         * that are already created.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeImportImageTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeImportImageTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeImportImageTasksOutcome> DescribeImportImageTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeImportImageTasksOutcome>([this, request](const std::function<void(Model::DescribeImportImageTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeImportImageTasksAsync(request, [complete](const EC2Client*, const Model::DescribeImportImageTasksRequest&, const Model::DescribeImportImageTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeImportImageTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes your import snapshot tasks.</p>
          */
@@ -4559,6 +7074,27 @@ namespace Model
          */
         virtual void DescribeImportSnapshotTasksAsync(const Model::DescribeImportSnapshotTasksRequest& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes your import snapshot tasks.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeImportSnapshotTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeImportSnapshotTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeImportSnapshotTasksOutcome> DescribeImportSnapshotTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeImportSnapshotTasksOutcome>([this, request](const std::function<void(Model::DescribeImportSnapshotTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeImportSnapshotTasksAsync(request, [complete](const EC2Client*, const Model::DescribeImportSnapshotTasksRequest&, const Model::DescribeImportSnapshotTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeImportSnapshotTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified attribute of the specified instance. You can specify
          * only one attribute at a time. Valid attribute values are:
@@ -4599,6 +7135,34 @@ namespace Model
          */
         virtual void DescribeInstanceAttributeAsync(const Model::DescribeInstanceAttributeRequest& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified attribute of the specified instance. You can specify
+         * only one attribute at a time. Valid attribute values are:
+         * <code>instanceType</code> | <code>kernel</code> | <code>ramdisk</code> |
+         * <code>userData</code> | <code>disableApiTermination</code> |
+         * <code>instanceInitiatedShutdownBehavior</code> | <code>rootDeviceName</code> |
+         * <code>blockDeviceMapping</code> | <code>productCodes</code> |
+         * <code>sourceDestCheck</code> | <code>groupSet</code> | <code>ebsOptimized</code>
+         * | <code>sriovNetSupport</code></p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeInstanceAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeInstanceAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeInstanceAttributeOutcome> DescribeInstanceAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeInstanceAttributeOutcome>([this, request](const std::function<void(Model::DescribeInstanceAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeInstanceAttributeAsync(request, [complete](const EC2Client*, const Model::DescribeInstanceAttributeRequest&, const Model::DescribeInstanceAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeInstanceAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the status of one or more instances.</p> <p>Instance status
          * includes the following components:</p> <ul> <li> <p><b>Status checks</b> -
@@ -4675,6 +7239,46 @@ namespace Model
          */
         virtual void DescribeInstanceStatusAsync(const Model::DescribeInstanceStatusRequest& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the status of one or more instances.</p> <p>Instance status
+         * includes the following components:</p> <ul> <li> <p><b>Status checks</b> -
+         * Amazon EC2 performs status checks on running EC2 instances to identify hardware
+         * and software issues. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/monitoring-system-instance-status-check.html">Status
+         * Checks for Your Instances</a> and <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/TroubleshootingInstances.html">Troubleshooting
+         * Instances with Failed Status Checks</a> in the <i>Amazon Elastic Compute Cloud
+         * User Guide</i>.</p></li> <li> <p><b>Scheduled events</b> - Amazon EC2 can
+         * schedule events (such as reboot, stop, or terminate) for your instances related
+         * to hardware issues, software updates, or system maintenance. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/monitoring-instances-status-check_sched.html">Scheduled
+         * Events for Your Instances</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p> </li> <li> <p><b>Instance state</b> - You can manage your
+         * instances from the moment you launch them through their termination. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ec2-instance-lifecycle.html">Instance
+         * Lifecycle</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p> </li>
+         * </ul>
+         *
+         * Returns an awaitable that starts the operation the way DescribeInstanceStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeInstanceStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeInstanceStatusOutcome> DescribeInstanceStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeInstanceStatusOutcome>([this, request](const std::function<void(Model::DescribeInstanceStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeInstanceStatusAsync(request, [complete](const EC2Client*, const Model::DescribeInstanceStatusRequest&, const Model::DescribeInstanceStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeInstanceStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your instances.</p> <p>If you specify one or more
          * instance IDs, Amazon EC2 returns information for those instances. If you do not
@@ -4712,6 +7316,33 @@ namespace Model
          */
         virtual void DescribeInstancesAsync(const Model::DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your instances.</p> <p>If you specify one or more
+         * instance IDs, Amazon EC2 returns information for those instances. If you do not
+         * specify instance IDs, Amazon EC2 returns information for all relevant instances.
+         * If you specify an instance ID that is not valid, an error is returned. If you
+         * specify an instance that you do not own, it is not included in the returned
+         * results.</p> <p>Recently terminated instances might appear in the returned
+         * results. This interval is usually less than one hour.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeInstancesOutcome> DescribeInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeInstancesOutcome>([this, request](const std::function<void(Model::DescribeInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeInstancesAsync(request, [complete](const EC2Client*, const Model::DescribeInstancesRequest&, const Model::DescribeInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your Internet gateways.</p>
          */
@@ -4731,6 +7362,27 @@ namespace Model
          */
         virtual void DescribeInternetGatewaysAsync(const Model::DescribeInternetGatewaysRequest& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your Internet gateways.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeInternetGatewaysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeInternetGatewaysRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeInternetGatewaysOutcome> DescribeInternetGatewaysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeInternetGatewaysOutcome>([this, request](const std::function<void(Model::DescribeInternetGatewaysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeInternetGatewaysAsync(request, [complete](const EC2Client*, const Model::DescribeInternetGatewaysRequest&, const Model::DescribeInternetGatewaysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeInternetGatewaysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your key pairs.</p> <p>For more information about
          * key pairs, see <a
@@ -4759,6 +7411,30 @@ namespace Model
          */
         virtual void DescribeKeyPairsAsync(const Model::DescribeKeyPairsRequest& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your key pairs.</p> <p>For more information about
+         * key pairs, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ec2-key-pairs.html">Key
+         * Pairs</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeKeyPairsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeKeyPairsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeKeyPairsOutcome> DescribeKeyPairsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeKeyPairsOutcome>([this, request](const std::function<void(Model::DescribeKeyPairsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeKeyPairsAsync(request, [complete](const EC2Client*, const Model::DescribeKeyPairsRequest&, const Model::DescribeKeyPairsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeKeyPairsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes your Elastic IP addresses that are being moved to the EC2-VPC
          * platform, or that are being restored to the EC2-Classic platform. This request
@@ -4787,6 +7463,30 @@ namespace Model
          */
         virtual void DescribeMovingAddressesAsync(const Model::DescribeMovingAddressesRequest& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes your Elastic IP addresses that are being moved to the EC2-VPC
+         * platform, or that are being restored to the EC2-Classic platform. This request
+         * does not return information about any other Elastic IP addresses in your
+         * account.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeMovingAddressesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeMovingAddressesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeMovingAddressesOutcome> DescribeMovingAddressesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeMovingAddressesOutcome>([this, request](const std::function<void(Model::DescribeMovingAddressesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeMovingAddressesAsync(request, [complete](const EC2Client*, const Model::DescribeMovingAddressesRequest&, const Model::DescribeMovingAddressesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeMovingAddressesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of the your NAT gateways.</p>
          */
@@ -4806,6 +7506,27 @@ namespace Model
          */
         virtual void DescribeNatGatewaysAsync(const Model::DescribeNatGatewaysRequest& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of the your NAT gateways.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeNatGatewaysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeNatGatewaysRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeNatGatewaysOutcome> DescribeNatGatewaysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeNatGatewaysOutcome>([this, request](const std::function<void(Model::DescribeNatGatewaysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeNatGatewaysAsync(request, [complete](const EC2Client*, const Model::DescribeNatGatewaysRequest&, const Model::DescribeNatGatewaysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeNatGatewaysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your network ACLs.</p> <p>For more information about
          * network ACLs, see <a
@@ -4834,6 +7555,30 @@ namespace Model
          */
         virtual void DescribeNetworkAclsAsync(const Model::DescribeNetworkAclsRequest& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your network ACLs.</p> <p>For more information about
+         * network ACLs, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_ACLs.html">Network
+         * ACLs</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeNetworkAclsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeNetworkAclsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeNetworkAclsOutcome> DescribeNetworkAclsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeNetworkAclsOutcome>([this, request](const std::function<void(Model::DescribeNetworkAclsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeNetworkAclsAsync(request, [complete](const EC2Client*, const Model::DescribeNetworkAclsRequest&, const Model::DescribeNetworkAclsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeNetworkAclsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes a network interface attribute. You can specify only one attribute
          * at a time.</p>
@@ -4856,6 +7601,28 @@ namespace Model
          */
         virtual void DescribeNetworkInterfaceAttributeAsync(const Model::DescribeNetworkInterfaceAttributeRequest& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes a network interface attribute. You can specify only one attribute
+         * at a time.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeNetworkInterfaceAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeNetworkInterfaceAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeNetworkInterfaceAttributeOutcome> DescribeNetworkInterfaceAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeNetworkInterfaceAttributeOutcome>([this, request](const std::function<void(Model::DescribeNetworkInterfaceAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeNetworkInterfaceAttributeAsync(request, [complete](const EC2Client*, const Model::DescribeNetworkInterfaceAttributeRequest&, const Model::DescribeNetworkInterfaceAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeNetworkInterfaceAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your network interfaces.</p>
          */
@@ -4875,6 +7642,27 @@ namespace Model
          */
         virtual void DescribeNetworkInterfacesAsync(const Model::DescribeNetworkInterfacesRequest& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your network interfaces.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeNetworkInterfacesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeNetworkInterfacesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeNetworkInterfacesOutcome> DescribeNetworkInterfacesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeNetworkInterfacesOutcome>([this, request](const std::function<void(Model::DescribeNetworkInterfacesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeNetworkInterfacesAsync(request, [complete](const EC2Client*, const Model::DescribeNetworkInterfacesRequest&, const Model::DescribeNetworkInterfacesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeNetworkInterfacesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your placement groups. For more information about
          * placement groups and cluster instances, see <a
@@ -4903,6 +7691,30 @@ namespace Model
          */
         virtual void DescribePlacementGroupsAsync(const Model::DescribePlacementGroupsRequest& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your placement groups. For more information about
+         * placement groups and cluster instances, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using_cluster_computing.html">Cluster
+         * Instances</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribePlacementGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribePlacementGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribePlacementGroupsOutcome> DescribePlacementGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribePlacementGroupsOutcome>([this, request](const std::function<void(Model::DescribePlacementGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribePlacementGroupsAsync(request, [complete](const EC2Client*, const Model::DescribePlacementGroupsRequest&, const Model::DescribePlacementGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribePlacementGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes available AWS services in a prefix list format, which includes the
          * prefix list name and prefix list ID of the service and the IP address range for
@@ -4934,6 +7746,31 @@ namespace Model
          */
         virtual void DescribePrefixListsAsync(const Model::DescribePrefixListsRequest& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes available AWS services in a prefix list format, which includes the
+         * prefix list name and prefix list ID of the service and the IP address range for
+         * the service. A prefix list ID is required for creating an outbound security
+         * group rule that allows traffic from a VPC to access an AWS service through a VPC
+         * endpoint.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribePrefixListsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribePrefixListsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribePrefixListsOutcome> DescribePrefixListsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribePrefixListsOutcome>([this, request](const std::function<void(Model::DescribePrefixListsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribePrefixListsAsync(request, [complete](const EC2Client*, const Model::DescribePrefixListsRequest&, const Model::DescribePrefixListsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribePrefixListsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more regions that are currently available to you.</p> <p>For
          * a list of the regions supported by Amazon EC2, see <a
@@ -4962,6 +7799,30 @@ namespace Model
          */
         virtual void DescribeRegionsAsync(const Model::DescribeRegionsRequest& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more regions that are currently available to you.</p> <p>For
+         * a list of the regions supported by Amazon EC2, see <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/rande.html#ec2_region">Regions
+         * and Endpoints</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeRegionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeRegionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeRegionsOutcome> DescribeRegionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeRegionsOutcome>([this, request](const std::function<void(Model::DescribeRegionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeRegionsAsync(request, [complete](const EC2Client*, const Model::DescribeRegionsRequest&, const Model::DescribeRegionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeRegionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of the Reserved Instances that you purchased.</p>
          * <p>For more information about Reserved Instances, see <a
@@ -4990,6 +7851,30 @@ namespace Model
          */
         virtual void DescribeReservedInstancesAsync(const Model::DescribeReservedInstancesRequest& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of the Reserved Instances that you purchased.</p>
+         * <p>For more information about Reserved Instances, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/concepts-on-demand-reserved-instances.html">Reserved
+         * Instances</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReservedInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReservedInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReservedInstancesOutcome> DescribeReservedInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReservedInstancesOutcome>([this, request](const std::function<void(Model::DescribeReservedInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReservedInstancesAsync(request, [complete](const EC2Client*, const Model::DescribeReservedInstancesRequest&, const Model::DescribeReservedInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReservedInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes your account's Reserved Instance listings in the Reserved Instance
          * Marketplace.</p> <p>The Reserved Instance Marketplace matches sellers who want
@@ -5057,6 +7942,43 @@ namespace Model
          */
         virtual void DescribeReservedInstancesListingsAsync(const Model::DescribeReservedInstancesListingsRequest& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes your account's Reserved Instance listings in the Reserved Instance
+         * Marketplace.</p> <p>The Reserved Instance Marketplace matches sellers who want
+         * to resell Reserved Instance capacity that they no longer need with buyers who
+         * want to purchase additional capacity. Reserved Instances bought and sold through
+         * the Reserved Instance Marketplace work like any other Reserved Instances. </p>
+         * <p>As a seller, you choose to list some or all of your Reserved Instances, and
+         * you specify the upfront price to receive for them. Your Reserved Instances are
+         * then listed in the Reserved Instance Marketplace and are available for purchase.
+         * </p> <p>As a buyer, you specify the configuration of the Reserved Instance to
+         * purchase, and the Marketplace matches what you're searching for with what's
+         * available. The Marketplace first sells the lowest priced Reserved Instances to
+         * you, and continues to sell available Reserved Instance listings to you until
+         * your demand is met. You are charged based on the total price of all of the
+         * listings that you purchase.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ri-market-general.html">Reserved
+         * Instance Marketplace</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReservedInstancesListingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReservedInstancesListingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReservedInstancesListingsOutcome> DescribeReservedInstancesListingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReservedInstancesListingsOutcome>([this, request](const std::function<void(Model::DescribeReservedInstancesListingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReservedInstancesListingsAsync(request, [complete](const EC2Client*, const Model::DescribeReservedInstancesListingsRequest&, const Model::DescribeReservedInstancesListingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReservedInstancesListingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the modifications made to your Reserved Instances. If no parameter
          * is specified, information about all your Reserved Instances modification
@@ -5091,6 +8013,32 @@ namespace Model
          */
         virtual void DescribeReservedInstancesModificationsAsync(const Model::DescribeReservedInstancesModificationsRequest& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the modifications made to your Reserved Instances. If no parameter
+         * is specified, information about all your Reserved Instances modification
+         * requests is returned. If a modification ID is specified, only information about
+         * the specific modification is returned.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ri-modifying.html">Modifying
+         * Reserved Instances</a> in the Amazon Elastic Compute Cloud User Guide.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReservedInstancesModificationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReservedInstancesModificationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReservedInstancesModificationsOutcome> DescribeReservedInstancesModificationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReservedInstancesModificationsOutcome>([this, request](const std::function<void(Model::DescribeReservedInstancesModificationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReservedInstancesModificationsAsync(request, [complete](const EC2Client*, const Model::DescribeReservedInstancesModificationsRequest&, const Model::DescribeReservedInstancesModificationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReservedInstancesModificationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes Reserved Instance offerings that are available for purchase. With
          * Reserved Instances, you purchase the right to launch instances for a period of
@@ -5140,6 +8088,37 @@ namespace Model
          */
         virtual void DescribeReservedInstancesOfferingsAsync(const Model::DescribeReservedInstancesOfferingsRequest& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes Reserved Instance offerings that are available for purchase. With
+         * Reserved Instances, you purchase the right to launch instances for a period of
+         * time. During that time period, you do not receive insufficient capacity errors,
+         * and you pay a lower usage rate than the rate charged for On-Demand instances for
+         * the actual time used.</p> <p>If you have listed your own Reserved Instances for
+         * sale in the Reserved Instance Marketplace, they will be excluded from these
+         * results. This is to ensure that you do not purchase your own Reserved
+         * Instances.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ri-market-general.html">Reserved
+         * Instance Marketplace</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReservedInstancesOfferingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReservedInstancesOfferingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReservedInstancesOfferingsOutcome> DescribeReservedInstancesOfferingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReservedInstancesOfferingsOutcome>([this, request](const std::function<void(Model::DescribeReservedInstancesOfferingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReservedInstancesOfferingsAsync(request, [complete](const EC2Client*, const Model::DescribeReservedInstancesOfferingsRequest&, const Model::DescribeReservedInstancesOfferingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReservedInstancesOfferingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your route tables. </p> <p>Each subnet in your VPC
          * must be associated with a route table. If a subnet is not explicitly associated
@@ -5177,6 +8156,33 @@ namespace Model
          */
         virtual void DescribeRouteTablesAsync(const Model::DescribeRouteTablesRequest& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your route tables. </p> <p>Each subnet in your VPC
+         * must be associated with a route table. If a subnet is not explicitly associated
+         * with any route table, it is implicitly associated with the main route table.
+         * This command does not return the subnet ID for implicit associations.</p> <p>For
+         * more information about route tables, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_Route_Tables.html">Route
+         * Tables</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeRouteTablesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeRouteTablesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeRouteTablesOutcome> DescribeRouteTablesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeRouteTablesOutcome>([this, request](const std::function<void(Model::DescribeRouteTablesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeRouteTablesAsync(request, [complete](const EC2Client*, const Model::DescribeRouteTablesRequest&, const Model::DescribeRouteTablesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeRouteTablesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Finds available schedules that meet the specified criteria.</p> <p>You can
          * search for an available schedule no more than 3 months in advance. You must meet
@@ -5214,6 +8220,33 @@ namespace Model
          */
         virtual void DescribeScheduledInstanceAvailabilityAsync(const Model::DescribeScheduledInstanceAvailabilityRequest& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Finds available schedules that meet the specified criteria.</p> <p>You can
+         * search for an available schedule no more than 3 months in advance. You must meet
+         * the minimum required duration of 1,200 hours per year. For example, the minimum
+         * daily schedule is 4 hours, the minimum weekly schedule is 24 hours, and the
+         * minimum monthly schedule is 100 hours.</p> <p>After you find a schedule that
+         * meets your needs, call <a>PurchaseScheduledInstances</a> to purchase Scheduled
+         * Instances with that schedule.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeScheduledInstanceAvailabilityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeScheduledInstanceAvailabilityRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeScheduledInstanceAvailabilityOutcome> DescribeScheduledInstanceAvailabilityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeScheduledInstanceAvailabilityOutcome>([this, request](const std::function<void(Model::DescribeScheduledInstanceAvailabilityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeScheduledInstanceAvailabilityAsync(request, [complete](const EC2Client*, const Model::DescribeScheduledInstanceAvailabilityRequest&, const Model::DescribeScheduledInstanceAvailabilityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeScheduledInstanceAvailabilityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your Scheduled Instances.</p>
          */
@@ -5233,6 +8266,27 @@ namespace Model
          */
         virtual void DescribeScheduledInstancesAsync(const Model::DescribeScheduledInstancesRequest& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your Scheduled Instances.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeScheduledInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeScheduledInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeScheduledInstancesOutcome> DescribeScheduledInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeScheduledInstancesOutcome>([this, request](const std::function<void(Model::DescribeScheduledInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeScheduledInstancesAsync(request, [complete](const EC2Client*, const Model::DescribeScheduledInstancesRequest&, const Model::DescribeScheduledInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeScheduledInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your security groups.</p> <p>A security group is for
          * use with instances either in the EC2-Classic platform or in a specific VPC. For
@@ -5257,10 +8311,26 @@ namespace Model
          * Groups for Your VPC</a> in the <i>Amazon Virtual Private Cloud User
          * Guide</i>.</p>
          *
-         * returns a future to the operation so that it can be executed in parallel to other requests.
+         * returns a future to the operation so that it can be executed in parallel to other requests.
+         */
+        virtual Model::DescribeSecurityGroupsOutcomeCallable DescribeSecurityGroupsCallable(const Model::DescribeSecurityGroupsRequest& request) const;
+
+        /**
+         * <p>Describes one or more of your security groups.</p> <p>A security group is for
+         * use with instances either in the EC2-Classic platform or in a specific VPC. For
+         * more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using-network-security.html">Amazon
+         * EC2 Security Groups</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>
+         * and <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_SecurityGroups.html">Security
+         * Groups for Your VPC</a> in the <i>Amazon Virtual Private Cloud User
+         * Guide</i>.</p>
+         *
+         * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
-        virtual Model::DescribeSecurityGroupsOutcomeCallable DescribeSecurityGroupsCallable(const Model::DescribeSecurityGroupsRequest& request) const;
+        virtual void DescribeSecurityGroupsAsync(const Model::DescribeSecurityGroupsRequest& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
          * <p>Describes one or more of your security groups.</p> <p>A security group is for
          * use with instances either in the EC2-Classic platform or in a specific VPC. For
@@ -5272,9 +8342,22 @@ namespace Model
          * Groups for Your VPC</a> in the <i>Amazon Virtual Private Cloud User
          * Guide</i>.</p>
          *
-         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         * Returns an awaitable that starts the operation the way DescribeSecurityGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
          */
-        virtual void DescribeSecurityGroupsAsync(const Model::DescribeSecurityGroupsRequest& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        template<typename REQUEST = Model::DescribeSecurityGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSecurityGroupsOutcome> DescribeSecurityGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSecurityGroupsOutcome>([this, request](const std::function<void(Model::DescribeSecurityGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSecurityGroupsAsync(request, [complete](const EC2Client*, const Model::DescribeSecurityGroupsRequest&, const Model::DescribeSecurityGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSecurityGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Describes the specified attribute of the specified snapshot. You can specify
@@ -5307,6 +8390,31 @@ namespace Model
          */
         virtual void DescribeSnapshotAttributeAsync(const Model::DescribeSnapshotAttributeRequest& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified attribute of the specified snapshot. You can specify
+         * only one attribute at a time.</p> <p>For more information about EBS snapshots,
+         * see <a
+         * href='http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/EBSSnapshots.html'>Amazon
+         * EBS Snapshots</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSnapshotAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSnapshotAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotAttributeOutcome> DescribeSnapshotAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotAttributeOutcome>([this, request](const std::function<void(Model::DescribeSnapshotAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSnapshotAttributeAsync(request, [complete](const EC2Client*, const Model::DescribeSnapshotAttributeRequest&, const Model::DescribeSnapshotAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSnapshotAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of the EBS snapshots available to you. Available
          * snapshots include public snapshots available for any AWS account to launch,
@@ -5428,6 +8536,61 @@ namespace Model
          */
         virtual void DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of the EBS snapshots available to you. Available
+         * snapshots include public snapshots available for any AWS account to launch,
+         * private snapshots that you own, and private snapshots owned by another AWS
+         * account but for which you've been given explicit create volume permissions.</p>
+         * <p>The create volume permissions fall into the following categories:</p> <ul>
+         * <li><i>public</i>: The owner of the snapshot granted create volume permissions
+         * for the snapshot to the <code>all</code> group. All AWS accounts have create
+         * volume permissions for these snapshots.</li> <li><i>explicit</i>: The owner of
+         * the snapshot granted create volume permissions to a specific AWS account.</li>
+         * <li><i>implicit</i>: An AWS account has implicit create volume permissions for
+         * all snapshots it owns.</li> </ul> <p>The list of snapshots returned can be
+         * modified by specifying snapshot IDs, snapshot owners, or AWS accounts with
+         * create volume permissions. If no options are specified, Amazon EC2 returns all
+         * snapshots for which you have create volume permissions.</p> <p>If you specify
+         * one or more snapshot IDs, only snapshots that have the specified IDs are
+         * returned. If you specify an invalid snapshot ID, an error is returned. If you
+         * specify a snapshot ID for which you do not have access, it is not included in
+         * the returned results.</p> <p>If you specify one or more snapshot owners, only
+         * snapshots from the specified owners and for which you have access are returned.
+         * The results can include the AWS account IDs of the specified owners,
+         * <code>amazon</code> for snapshots owned by Amazon, or <code>self</code> for
+         * snapshots that you own.</p> <p>If you specify a list of restorable users, only
+         * snapshots with create snapshot permissions for those users are returned. You can
+         * specify AWS account IDs (if you own the snapshots), <code>self</code> for
+         * snapshots for which you own or have explicit permissions, or <code>all</code>
+         * for public snapshots.</p> <p>If you are describing a long list of snapshots, you
+         * can paginate the output to make the list more manageable. The
+         * <code>MaxResults</code> parameter sets the maximum number of results returned in
+         * a single page. If the list of results exceeds your <code>MaxResults</code>
+         * value, then that number of results is returned along with a
+         * <code>NextToken</code> value that can be passed to a subsequent
+         * <code>DescribeSnapshots</code> request to retrieve the remaining results.</p>
+         * <p>For more information about EBS snapshots, see <a
+         * href='http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/EBSSnapshots.html'>Amazon
+         * EBS Snapshots</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSnapshotsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSnapshotsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotsOutcome>([this, request](const std::function<void(Model::DescribeSnapshotsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSnapshotsAsync(request, [complete](const EC2Client*, const Model::DescribeSnapshotsRequest&, const Model::DescribeSnapshotsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSnapshotsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the data feed for Spot instances. For more information, see <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/spot-data-feeds.html">Spot
@@ -5456,6 +8619,30 @@ namespace Model
          */
         virtual void DescribeSpotDatafeedSubscriptionAsync(const Model::DescribeSpotDatafeedSubscriptionRequest& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the data feed for Spot instances. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/spot-data-feeds.html">Spot
+         * Instance Data Feed</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSpotDatafeedSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSpotDatafeedSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSpotDatafeedSubscriptionOutcome> DescribeSpotDatafeedSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSpotDatafeedSubscriptionOutcome>([this, request](const std::function<void(Model::DescribeSpotDatafeedSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSpotDatafeedSubscriptionAsync(request, [complete](const EC2Client*, const Model::DescribeSpotDatafeedSubscriptionRequest&, const Model::DescribeSpotDatafeedSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSpotDatafeedSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the running instances for the specified Spot fleet.</p>
          */
@@ -5475,6 +8662,27 @@ namespace Model
          */
         virtual void DescribeSpotFleetInstancesAsync(const Model::DescribeSpotFleetInstancesRequest& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the running instances for the specified Spot fleet.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSpotFleetInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSpotFleetInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSpotFleetInstancesOutcome> DescribeSpotFleetInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSpotFleetInstancesOutcome>([this, request](const std::function<void(Model::DescribeSpotFleetInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSpotFleetInstancesAsync(request, [complete](const EC2Client*, const Model::DescribeSpotFleetInstancesRequest&, const Model::DescribeSpotFleetInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSpotFleetInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the events for the specified Spot fleet request during the
          * specified time.</p> <p>Spot fleet events are delayed by up to 30 seconds before
@@ -5503,6 +8711,30 @@ namespace Model
          */
         virtual void DescribeSpotFleetRequestHistoryAsync(const Model::DescribeSpotFleetRequestHistoryRequest& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the events for the specified Spot fleet request during the
+         * specified time.</p> <p>Spot fleet events are delayed by up to 30 seconds before
+         * they can be described. This ensures that you can query by the last evaluated
+         * time and not miss a recorded event.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSpotFleetRequestHistoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSpotFleetRequestHistoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSpotFleetRequestHistoryOutcome> DescribeSpotFleetRequestHistoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSpotFleetRequestHistoryOutcome>([this, request](const std::function<void(Model::DescribeSpotFleetRequestHistoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSpotFleetRequestHistoryAsync(request, [complete](const EC2Client*, const Model::DescribeSpotFleetRequestHistoryRequest&, const Model::DescribeSpotFleetRequestHistoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSpotFleetRequestHistoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes your Spot fleet requests.</p>
          */
@@ -5522,6 +8754,27 @@ namespace Model
          */
         virtual void DescribeSpotFleetRequestsAsync(const Model::DescribeSpotFleetRequestsRequest& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes your Spot fleet requests.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSpotFleetRequestsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSpotFleetRequestsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSpotFleetRequestsOutcome> DescribeSpotFleetRequestsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSpotFleetRequestsOutcome>([this, request](const std::function<void(Model::DescribeSpotFleetRequestsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSpotFleetRequestsAsync(request, [complete](const EC2Client*, const Model::DescribeSpotFleetRequestsRequest&, const Model::DescribeSpotFleetRequestsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSpotFleetRequestsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the Spot instance requests that belong to your account. Spot
          * instances are instances that Amazon EC2 launches when the bid price that you
@@ -5577,6 +8830,39 @@ namespace Model
          */
         virtual void DescribeSpotInstanceRequestsAsync(const Model::DescribeSpotInstanceRequestsRequest& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the Spot instance requests that belong to your account. Spot
+         * instances are instances that Amazon EC2 launches when the bid price that you
+         * specify exceeds the current Spot price. Amazon EC2 periodically sets the Spot
+         * price based on available Spot instance capacity and current Spot instance
+         * requests. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/spot-requests.html">Spot
+         * Instance Requests</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         * <p>You can use <code>DescribeSpotInstanceRequests</code> to find a running Spot
+         * instance by examining the response. If the status of the Spot instance is
+         * <code>fulfilled</code>, the instance ID appears in the response and contains the
+         * identifier of the instance. Alternatively, you can use <a>DescribeInstances</a>
+         * with a filter to look for instances where the instance lifecycle is
+         * <code>spot</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSpotInstanceRequestsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSpotInstanceRequestsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSpotInstanceRequestsOutcome> DescribeSpotInstanceRequestsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSpotInstanceRequestsOutcome>([this, request](const std::function<void(Model::DescribeSpotInstanceRequestsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSpotInstanceRequestsAsync(request, [complete](const EC2Client*, const Model::DescribeSpotInstanceRequestsRequest&, const Model::DescribeSpotInstanceRequestsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSpotInstanceRequestsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the Spot price history. The prices returned are listed in
          * chronological order, from the oldest to the most recent, for up to the past 90
@@ -5623,6 +8909,36 @@ namespace Model
          */
         virtual void DescribeSpotPriceHistoryAsync(const Model::DescribeSpotPriceHistoryRequest& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the Spot price history. The prices returned are listed in
+         * chronological order, from the oldest to the most recent, for up to the past 90
+         * days. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using-spot-instances-history.html">Spot
+         * Instance Pricing History</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p> <p>When you specify a start and end time, this operation returns
+         * the prices of the instance types within the time range that you specified and
+         * the time when the price changed. The price is valid within the time period that
+         * you specified; the response merely indicates the last time that the price
+         * changed.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSpotPriceHistoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSpotPriceHistoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSpotPriceHistoryOutcome> DescribeSpotPriceHistoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSpotPriceHistoryOutcome>([this, request](const std::function<void(Model::DescribeSpotPriceHistoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSpotPriceHistoryAsync(request, [complete](const EC2Client*, const Model::DescribeSpotPriceHistoryRequest&, const Model::DescribeSpotPriceHistoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSpotPriceHistoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your subnets.</p> <p>For more information about
          * subnets, see <a
@@ -5651,6 +8967,30 @@ namespace Model
          */
         virtual void DescribeSubnetsAsync(const Model::DescribeSubnetsRequest& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your subnets.</p> <p>For more information about
+         * subnets, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_Subnets.html">Your
+         * VPC and Subnets</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSubnetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSubnetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSubnetsOutcome> DescribeSubnetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSubnetsOutcome>([this, request](const std::function<void(Model::DescribeSubnetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSubnetsAsync(request, [complete](const EC2Client*, const Model::DescribeSubnetsRequest&, const Model::DescribeSubnetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSubnetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of the tags for your EC2 resources.</p> <p>For more
          * information about tags, see <a
@@ -5679,6 +9019,30 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of the tags for your EC2 resources.</p> <p>For more
+         * information about tags, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/Using_Tags.html">Tagging
+         * Your Resources</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTagsOutcome>([this, request](const std::function<void(Model::DescribeTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTagsAsync(request, [complete](const EC2Client*, const Model::DescribeTagsRequest&, const Model::DescribeTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified attribute of the specified volume. You can specify
          * only one attribute at a time.</p> <p>For more information about EBS volumes, see
@@ -5710,6 +9074,31 @@ namespace Model
          */
         virtual void DescribeVolumeAttributeAsync(const Model::DescribeVolumeAttributeRequest& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified attribute of the specified volume. You can specify
+         * only one attribute at a time.</p> <p>For more information about EBS volumes, see
+         * <a
+         * href='http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/EBSVolumes.html'>Amazon
+         * EBS Volumes</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVolumeAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVolumeAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVolumeAttributeOutcome> DescribeVolumeAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVolumeAttributeOutcome>([this, request](const std::function<void(Model::DescribeVolumeAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVolumeAttributeAsync(request, [complete](const EC2Client*, const Model::DescribeVolumeAttributeRequest&, const Model::DescribeVolumeAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVolumeAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the status of the specified volumes. Volume status provides the
          * result of the checks performed on your volumes to determine events that can
@@ -5822,6 +9211,58 @@ namespace Model
          */
         virtual void DescribeVolumeStatusAsync(const Model::DescribeVolumeStatusRequest& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the status of the specified volumes. Volume status provides the
+         * result of the checks performed on your volumes to determine events that can
+         * impair the performance of your volumes. The performance of a volume can be
+         * affected if an issue occurs on the volume's underlying host. If the volume's
+         * underlying host experiences a power outage or system issue, after the system is
+         * restored, there could be data inconsistencies on the volume. Volume events
+         * notify you if this occurs. Volume actions notify you if any action needs to be
+         * taken in response to the event.</p> <p>The <code>DescribeVolumeStatus</code>
+         * operation provides the following information about the specified volumes:</p>
+         * <p><i>Status</i>: Reflects the current status of the volume. The possible values
+         * are <code>ok</code>, <code>impaired</code> , <code>warning</code>, or
+         * <code>insufficient-data</code>. If all checks pass, the overall status of the
+         * volume is <code>ok</code>. If the check fails, the overall status is
+         * <code>impaired</code>. If the status is <code>insufficient-data</code>, then the
+         * checks may still be taking place on your volume at the time. We recommend that
+         * you retry the request. For more information on volume status, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/monitoring-volume-status.html">Monitoring
+         * the Status of Your Volumes</a>.</p> <p><i>Events</i>: Reflect the cause of a
+         * volume status and may require you to take action. For example, if your volume
+         * returns an <code>impaired</code> status, then the volume event might be
+         * <code>potential-data-inconsistency</code>. This means that your volume has been
+         * affected by an issue with the underlying host, has all I/O operations disabled,
+         * and may have inconsistent data.</p> <p><i>Actions</i>: Reflect the actions you
+         * may have to take in response to an event. For example, if the status of the
+         * volume is <code>impaired</code> and the volume event shows
+         * <code>potential-data-inconsistency</code>, then the action shows
+         * <code>enable-volume-io</code>. This means that you may want to enable the I/O
+         * operations for the volume by calling the <a>EnableVolumeIO</a> action and then
+         * check the volume for data consistency.</p> <note> <p>Volume status is based on
+         * the volume status checks, and does not reflect the volume state. Therefore,
+         * volume status does not indicate volumes in the <code>error</code> state (for
+         * example, when a volume is incapable of accepting I/O.)</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVolumeStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVolumeStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVolumeStatusOutcome> DescribeVolumeStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVolumeStatusOutcome>([this, request](const std::function<void(Model::DescribeVolumeStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVolumeStatusAsync(request, [complete](const EC2Client*, const Model::DescribeVolumeStatusRequest&, const Model::DescribeVolumeStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVolumeStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified EBS volumes.</p> <p>If you are describing a long list
          * of volumes, you can paginate the output to make the list more manageable. The
@@ -5868,6 +9309,36 @@ namespace Model
          */
         virtual void DescribeVolumesAsync(const Model::DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified EBS volumes.</p> <p>If you are describing a long list
+         * of volumes, you can paginate the output to make the list more manageable. The
+         * <code>MaxResults</code> parameter sets the maximum number of results returned in
+         * a single page. If the list of results exceeds your <code>MaxResults</code>
+         * value, then that number of results is returned along with a
+         * <code>NextToken</code> value that can be passed to a subsequent
+         * <code>DescribeVolumes</code> request to retrieve the remaining results.</p>
+         * <p>For more information about EBS volumes, see <a
+         * href='http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/EBSVolumes.html'>Amazon
+         * EBS Volumes</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVolumesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVolumesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVolumesOutcome> DescribeVolumesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVolumesOutcome>([this, request](const std::function<void(Model::DescribeVolumesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVolumesAsync(request, [complete](const EC2Client*, const Model::DescribeVolumesRequest&, const Model::DescribeVolumesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVolumesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified attribute of the specified VPC. You can specify only
          * one attribute at a time.</p>
@@ -5890,6 +9361,28 @@ namespace Model
          */
         virtual void DescribeVpcAttributeAsync(const Model::DescribeVpcAttributeRequest& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified attribute of the specified VPC. You can specify only
+         * one attribute at a time.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVpcAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVpcAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVpcAttributeOutcome> DescribeVpcAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVpcAttributeOutcome>([this, request](const std::function<void(Model::DescribeVpcAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVpcAttributeAsync(request, [complete](const EC2Client*, const Model::DescribeVpcAttributeRequest&, const Model::DescribeVpcAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVpcAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the ClassicLink status of one or more VPCs. </p>
          */
@@ -5909,6 +9402,27 @@ namespace Model
          */
         virtual void DescribeVpcClassicLinkAsync(const Model::DescribeVpcClassicLinkRequest& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the ClassicLink status of one or more VPCs. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVpcClassicLinkAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVpcClassicLinkRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVpcClassicLinkOutcome> DescribeVpcClassicLinkAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVpcClassicLinkOutcome>([this, request](const std::function<void(Model::DescribeVpcClassicLinkOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVpcClassicLinkAsync(request, [complete](const EC2Client*, const Model::DescribeVpcClassicLinkRequest&, const Model::DescribeVpcClassicLinkOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVpcClassicLinkOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the ClassicLink DNS support status of one or more VPCs. If enabled,
          * the DNS hostname of a linked EC2-Classic instance resolves to its private IP
@@ -5949,6 +9463,34 @@ namespace Model
          */
         virtual void DescribeVpcClassicLinkDnsSupportAsync(const Model::DescribeVpcClassicLinkDnsSupportRequest& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the ClassicLink DNS support status of one or more VPCs. If enabled,
+         * the DNS hostname of a linked EC2-Classic instance resolves to its private IP
+         * address when addressed from an instance in the VPC to which it's linked.
+         * Similarly, the DNS hostname of an instance in a VPC resolves to its private IP
+         * address when addressed from a linked EC2-Classic instance. For more information
+         * about ClassicLink, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/vpc-classiclink.html">ClassicLink</a>
+         * in the Amazon Elastic Compute Cloud User Guide.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVpcClassicLinkDnsSupportAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVpcClassicLinkDnsSupportRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVpcClassicLinkDnsSupportOutcome> DescribeVpcClassicLinkDnsSupportAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVpcClassicLinkDnsSupportOutcome>([this, request](const std::function<void(Model::DescribeVpcClassicLinkDnsSupportOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVpcClassicLinkDnsSupportAsync(request, [complete](const EC2Client*, const Model::DescribeVpcClassicLinkDnsSupportRequest&, const Model::DescribeVpcClassicLinkDnsSupportOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVpcClassicLinkDnsSupportOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes all supported AWS services that can be specified when creating a
          * VPC endpoint.</p>
@@ -5971,6 +9513,28 @@ namespace Model
          */
         virtual void DescribeVpcEndpointServicesAsync(const Model::DescribeVpcEndpointServicesRequest& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes all supported AWS services that can be specified when creating a
+         * VPC endpoint.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVpcEndpointServicesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVpcEndpointServicesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVpcEndpointServicesOutcome> DescribeVpcEndpointServicesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVpcEndpointServicesOutcome>([this, request](const std::function<void(Model::DescribeVpcEndpointServicesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVpcEndpointServicesAsync(request, [complete](const EC2Client*, const Model::DescribeVpcEndpointServicesRequest&, const Model::DescribeVpcEndpointServicesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVpcEndpointServicesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your VPC endpoints.</p>
          */
@@ -5990,6 +9554,27 @@ namespace Model
          */
         virtual void DescribeVpcEndpointsAsync(const Model::DescribeVpcEndpointsRequest& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your VPC endpoints.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVpcEndpointsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVpcEndpointsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVpcEndpointsOutcome> DescribeVpcEndpointsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVpcEndpointsOutcome>([this, request](const std::function<void(Model::DescribeVpcEndpointsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVpcEndpointsAsync(request, [complete](const EC2Client*, const Model::DescribeVpcEndpointsRequest&, const Model::DescribeVpcEndpointsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVpcEndpointsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your VPC peering connections.</p>
          */
@@ -6009,6 +9594,27 @@ namespace Model
          */
         virtual void DescribeVpcPeeringConnectionsAsync(const Model::DescribeVpcPeeringConnectionsRequest& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your VPC peering connections.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVpcPeeringConnectionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVpcPeeringConnectionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVpcPeeringConnectionsOutcome> DescribeVpcPeeringConnectionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVpcPeeringConnectionsOutcome>([this, request](const std::function<void(Model::DescribeVpcPeeringConnectionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVpcPeeringConnectionsAsync(request, [complete](const EC2Client*, const Model::DescribeVpcPeeringConnectionsRequest&, const Model::DescribeVpcPeeringConnectionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVpcPeeringConnectionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your VPCs.</p>
          */
@@ -6028,6 +9634,27 @@ namespace Model
          */
         virtual void DescribeVpcsAsync(const Model::DescribeVpcsRequest& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your VPCs.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVpcsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVpcsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVpcsOutcome> DescribeVpcsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVpcsOutcome>([this, request](const std::function<void(Model::DescribeVpcsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVpcsAsync(request, [complete](const EC2Client*, const Model::DescribeVpcsRequest&, const Model::DescribeVpcsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVpcsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your VPN connections.</p> <p>For more information
          * about VPN connections, see <a
@@ -6059,6 +9686,31 @@ namespace Model
          */
         virtual void DescribeVpnConnectionsAsync(const Model::DescribeVpnConnectionsRequest& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your VPN connections.</p> <p>For more information
+         * about VPN connections, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
+         * a Hardware Virtual Private Gateway to Your VPC</a> in the <i>Amazon Virtual
+         * Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVpnConnectionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVpnConnectionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVpnConnectionsOutcome> DescribeVpnConnectionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVpnConnectionsOutcome>([this, request](const std::function<void(Model::DescribeVpnConnectionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVpnConnectionsAsync(request, [complete](const EC2Client*, const Model::DescribeVpnConnectionsRequest&, const Model::DescribeVpnConnectionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVpnConnectionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your virtual private gateways.</p> <p>For more
          * information about virtual private gateways, see <a
@@ -6090,6 +9742,31 @@ namespace Model
          */
         virtual void DescribeVpnGatewaysAsync(const Model::DescribeVpnGatewaysRequest& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your virtual private gateways.</p> <p>For more
+         * information about virtual private gateways, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
+         * an IPsec Hardware VPN to Your VPC</a> in the <i>Amazon Virtual Private Cloud
+         * User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVpnGatewaysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVpnGatewaysRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVpnGatewaysOutcome> DescribeVpnGatewaysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVpnGatewaysOutcome>([this, request](const std::function<void(Model::DescribeVpnGatewaysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVpnGatewaysAsync(request, [complete](const EC2Client*, const Model::DescribeVpnGatewaysRequest&, const Model::DescribeVpnGatewaysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVpnGatewaysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Unlinks (detaches) a linked EC2-Classic instance from a VPC. After the
          * instance has been unlinked, the VPC security groups are no longer associated
@@ -6104,16 +9781,39 @@ namespace Model
          *
          * returns a future to the operation so that it can be executed in parallel to other requests.
          */
-        virtual Model::DetachClassicLinkVpcOutcomeCallable DetachClassicLinkVpcCallable(const Model::DetachClassicLinkVpcRequest& request) const;
+        virtual Model::DetachClassicLinkVpcOutcomeCallable DetachClassicLinkVpcCallable(const Model::DetachClassicLinkVpcRequest& request) const;
+
+        /**
+         * <p>Unlinks (detaches) a linked EC2-Classic instance from a VPC. After the
+         * instance has been unlinked, the VPC security groups are no longer associated
+         * with it. An instance is automatically unlinked from a VPC when it's stopped.</p>
+         *
+         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         */
+        virtual void DetachClassicLinkVpcAsync(const Model::DetachClassicLinkVpcRequest& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
          * <p>Unlinks (detaches) a linked EC2-Classic instance from a VPC. After the
          * instance has been unlinked, the VPC security groups are no longer associated
          * with it. An instance is automatically unlinked from a VPC when it's stopped.</p>
          *
-         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         * Returns an awaitable that starts the operation the way DetachClassicLinkVpcAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
          */
-        virtual void DetachClassicLinkVpcAsync(const Model::DetachClassicLinkVpcRequest& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        template<typename REQUEST = Model::DetachClassicLinkVpcRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachClassicLinkVpcOutcome> DetachClassicLinkVpcAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachClassicLinkVpcOutcome>([this, request](const std::function<void(Model::DetachClassicLinkVpcOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachClassicLinkVpcAsync(request, [complete](const EC2Client*, const Model::DetachClassicLinkVpcRequest&, const Model::DetachClassicLinkVpcOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachClassicLinkVpcOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Detaches an Internet gateway from a VPC, disabling connectivity between the
@@ -6140,6 +9840,29 @@ namespace Model
          */
         virtual void DetachInternetGatewayAsync(const Model::DetachInternetGatewayRequest& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Detaches an Internet gateway from a VPC, disabling connectivity between the
+         * Internet and the VPC. The VPC must not contain any running instances with
+         * Elastic IP addresses.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachInternetGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachInternetGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachInternetGatewayOutcome> DetachInternetGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachInternetGatewayOutcome>([this, request](const std::function<void(Model::DetachInternetGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachInternetGatewayAsync(request, [complete](const EC2Client*, const Model::DetachInternetGatewayRequest&, const Model::DetachInternetGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachInternetGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Detaches a network interface from an instance.</p>
          */
@@ -6159,6 +9882,27 @@ namespace Model
          */
         virtual void DetachNetworkInterfaceAsync(const Model::DetachNetworkInterfaceRequest& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Detaches a network interface from an instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachNetworkInterfaceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachNetworkInterfaceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachNetworkInterfaceOutcome> DetachNetworkInterfaceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachNetworkInterfaceOutcome>([this, request](const std::function<void(Model::DetachNetworkInterfaceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachNetworkInterfaceAsync(request, [complete](const EC2Client*, const Model::DetachNetworkInterfaceRequest&, const Model::DetachNetworkInterfaceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachNetworkInterfaceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Detaches an EBS volume from an instance. Make sure to unmount any file
          * systems on the device within your operating system before detaching the volume.
@@ -6208,6 +9952,37 @@ namespace Model
          */
         virtual void DetachVolumeAsync(const Model::DetachVolumeRequest& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Detaches an EBS volume from an instance. Make sure to unmount any file
+         * systems on the device within your operating system before detaching the volume.
+         * Failure to do so results in the volume being stuck in a busy state while
+         * detaching.</p> <p>If an Amazon EBS volume is the root device of an instance, it
+         * can't be detached while the instance is running. To detach the root volume, stop
+         * the instance first.</p> <p>When a volume with an AWS Marketplace product code is
+         * detached from an instance, the product code is no longer associated with the
+         * instance.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ebs-detaching-volume.html">Detaching
+         * an Amazon EBS Volume</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachVolumeOutcome> DetachVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachVolumeOutcome>([this, request](const std::function<void(Model::DetachVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachVolumeAsync(request, [complete](const EC2Client*, const Model::DetachVolumeRequest&, const Model::DetachVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Detaches a virtual private gateway from a VPC. You do this if you're planning
          * to turn off the VPC and not use it anymore. You can confirm a virtual private
@@ -6245,6 +10020,33 @@ namespace Model
          */
         virtual void DetachVpnGatewayAsync(const Model::DetachVpnGatewayRequest& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Detaches a virtual private gateway from a VPC. You do this if you're planning
+         * to turn off the VPC and not use it anymore. You can confirm a virtual private
+         * gateway has been completely detached from a VPC by describing the virtual
+         * private gateway (any attachments to the virtual private gateway are also
+         * described).</p> <p>You must wait for the attachment's state to switch to
+         * <code>detached</code> before you can delete the VPC or attach a different VPC to
+         * the virtual private gateway.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachVpnGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachVpnGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachVpnGatewayOutcome> DetachVpnGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachVpnGatewayOutcome>([this, request](const std::function<void(Model::DetachVpnGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachVpnGatewayAsync(request, [complete](const EC2Client*, const Model::DetachVpnGatewayRequest&, const Model::DetachVpnGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachVpnGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables a virtual private gateway (VGW) from propagating routes to a
          * specified route table of a VPC.</p>
@@ -6267,6 +10069,28 @@ namespace Model
          */
         virtual void DisableVgwRoutePropagationAsync(const Model::DisableVgwRoutePropagationRequest& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables a virtual private gateway (VGW) from propagating routes to a
+         * specified route table of a VPC.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableVgwRoutePropagationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableVgwRoutePropagationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableVgwRoutePropagationOutcome> DisableVgwRoutePropagationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableVgwRoutePropagationOutcome>([this, request](const std::function<void(Model::DisableVgwRoutePropagationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableVgwRoutePropagationAsync(request, [complete](const EC2Client*, const Model::DisableVgwRoutePropagationRequest&, const Model::DisableVgwRoutePropagationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableVgwRoutePropagationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables ClassicLink for a VPC. You cannot disable ClassicLink for a VPC that
          * has EC2-Classic instances linked to it.</p>
@@ -6289,6 +10113,28 @@ namespace Model
          */
         virtual void DisableVpcClassicLinkAsync(const Model::DisableVpcClassicLinkRequest& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables ClassicLink for a VPC. You cannot disable ClassicLink for a VPC that
+         * has EC2-Classic instances linked to it.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableVpcClassicLinkAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableVpcClassicLinkRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableVpcClassicLinkOutcome> DisableVpcClassicLinkAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableVpcClassicLinkOutcome>([this, request](const std::function<void(Model::DisableVpcClassicLinkOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableVpcClassicLinkAsync(request, [complete](const EC2Client*, const Model::DisableVpcClassicLinkRequest&, const Model::DisableVpcClassicLinkOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableVpcClassicLinkOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables ClassicLink DNS support for a VPC. If disabled, DNS hostnames
          * resolve to public IP addresses when addressed between a linked EC2-Classic
@@ -6323,6 +10169,32 @@ namespace Model
          */
         virtual void DisableVpcClassicLinkDnsSupportAsync(const Model::DisableVpcClassicLinkDnsSupportRequest& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables ClassicLink DNS support for a VPC. If disabled, DNS hostnames
+         * resolve to public IP addresses when addressed between a linked EC2-Classic
+         * instance and instances in the VPC to which it's linked. For more information
+         * about ClassicLink, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/vpc-classiclink.html">ClassicLink</a>
+         * in the Amazon Elastic Compute Cloud User Guide.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableVpcClassicLinkDnsSupportAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableVpcClassicLinkDnsSupportRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableVpcClassicLinkDnsSupportOutcome> DisableVpcClassicLinkDnsSupportAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableVpcClassicLinkDnsSupportOutcome>([this, request](const std::function<void(Model::DisableVpcClassicLinkDnsSupportOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableVpcClassicLinkDnsSupportAsync(request, [complete](const EC2Client*, const Model::DisableVpcClassicLinkDnsSupportRequest&, const Model::DisableVpcClassicLinkDnsSupportOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableVpcClassicLinkDnsSupportOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disassociates an Elastic IP address from the instance or network interface
          * it's associated with.</p> <p>An Elastic IP address is for use in either the
@@ -6360,6 +10232,33 @@ namespace Model
          */
         virtual void DisassociateAddressAsync(const Model::DisassociateAddressRequest& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disassociates an Elastic IP address from the instance or network interface
+         * it's associated with.</p> <p>An Elastic IP address is for use in either the
+         * EC2-Classic platform or in a VPC. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/elastic-ip-addresses-eip.html">Elastic
+         * IP Addresses</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         * <p>This is an idempotent operation. If you perform the operation more than once,
+         * Amazon EC2 doesn't return an error.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisassociateAddressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisassociateAddressRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisassociateAddressOutcome> DisassociateAddressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisassociateAddressOutcome>([this, request](const std::function<void(Model::DisassociateAddressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisassociateAddressAsync(request, [complete](const EC2Client*, const Model::DisassociateAddressRequest&, const Model::DisassociateAddressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisassociateAddressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disassociates a subnet from a route table.</p> <p>After you perform this
          * action, the subnet no longer uses the routes in the route table. Instead, it
@@ -6394,6 +10293,32 @@ namespace Model
          */
         virtual void DisassociateRouteTableAsync(const Model::DisassociateRouteTableRequest& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disassociates a subnet from a route table.</p> <p>After you perform this
+         * action, the subnet no longer uses the routes in the route table. Instead, it
+         * uses the routes in the VPC's main route table. For more information about route
+         * tables, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_Route_Tables.html">Route
+         * Tables</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisassociateRouteTableAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisassociateRouteTableRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisassociateRouteTableOutcome> DisassociateRouteTableAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisassociateRouteTableOutcome>([this, request](const std::function<void(Model::DisassociateRouteTableOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisassociateRouteTableAsync(request, [complete](const EC2Client*, const Model::DisassociateRouteTableRequest&, const Model::DisassociateRouteTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisassociateRouteTableOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables a virtual private gateway (VGW) to propagate routes to the specified
          * route table of a VPC.</p>
@@ -6416,6 +10341,28 @@ namespace Model
          */
         virtual void EnableVgwRoutePropagationAsync(const Model::EnableVgwRoutePropagationRequest& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables a virtual private gateway (VGW) to propagate routes to the specified
+         * route table of a VPC.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableVgwRoutePropagationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableVgwRoutePropagationRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableVgwRoutePropagationOutcome> EnableVgwRoutePropagationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableVgwRoutePropagationOutcome>([this, request](const std::function<void(Model::EnableVgwRoutePropagationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableVgwRoutePropagationAsync(request, [complete](const EC2Client*, const Model::EnableVgwRoutePropagationRequest&, const Model::EnableVgwRoutePropagationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableVgwRoutePropagationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables I/O operations for a volume that had I/O operations disabled because
          * the data on the volume was potentially inconsistent.</p>
@@ -6438,6 +10385,28 @@ namespace Model
          */
         virtual void EnableVolumeIOAsync(const Model::EnableVolumeIORequest& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables I/O operations for a volume that had I/O operations disabled because
+         * the data on the volume was potentially inconsistent.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableVolumeIOAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableVolumeIORequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableVolumeIOOutcome> EnableVolumeIOAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableVolumeIOOutcome>([this, request](const std::function<void(Model::EnableVolumeIOOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableVolumeIOAsync(request, [complete](const EC2Client*, const Model::EnableVolumeIORequest&, const Model::EnableVolumeIOOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableVolumeIOOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables a VPC for ClassicLink. You can then link EC2-Classic instances to
          * your ClassicLink-enabled VPC to allow communication over private IP addresses.
@@ -6478,6 +10447,34 @@ namespace Model
          */
         virtual void EnableVpcClassicLinkAsync(const Model::EnableVpcClassicLinkRequest& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables a VPC for ClassicLink. You can then link EC2-Classic instances to
+         * your ClassicLink-enabled VPC to allow communication over private IP addresses.
+         * You cannot enable your VPC for ClassicLink if any of your VPC's route tables
+         * have existing routes for address ranges within the <code>10.0.0.0/8</code> IP
+         * address range, excluding local routes for VPCs in the <code>10.0.0.0/16</code>
+         * and <code>10.1.0.0/16</code> IP address ranges. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/vpc-classiclink.html">ClassicLink</a>
+         * in the Amazon Elastic Compute Cloud User Guide.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableVpcClassicLinkAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableVpcClassicLinkRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableVpcClassicLinkOutcome> EnableVpcClassicLinkAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableVpcClassicLinkOutcome>([this, request](const std::function<void(Model::EnableVpcClassicLinkOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableVpcClassicLinkAsync(request, [complete](const EC2Client*, const Model::EnableVpcClassicLinkRequest&, const Model::EnableVpcClassicLinkOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableVpcClassicLinkOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables a VPC to support DNS hostname resolution for ClassicLink. If enabled,
          * the DNS hostname of a linked EC2-Classic instance resolves to its private IP
@@ -6518,6 +10515,34 @@ namespace Model
          */
         virtual void EnableVpcClassicLinkDnsSupportAsync(const Model::EnableVpcClassicLinkDnsSupportRequest& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables a VPC to support DNS hostname resolution for ClassicLink. If enabled,
+         * the DNS hostname of a linked EC2-Classic instance resolves to its private IP
+         * address when addressed from an instance in the VPC to which it's linked.
+         * Similarly, the DNS hostname of an instance in a VPC resolves to its private IP
+         * address when addressed from a linked EC2-Classic instance. For more information
+         * about ClassicLink, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/vpc-classiclink.html">ClassicLink</a>
+         * in the Amazon Elastic Compute Cloud User Guide.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableVpcClassicLinkDnsSupportAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableVpcClassicLinkDnsSupportRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableVpcClassicLinkDnsSupportOutcome> EnableVpcClassicLinkDnsSupportAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableVpcClassicLinkDnsSupportOutcome>([this, request](const std::function<void(Model::EnableVpcClassicLinkDnsSupportOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableVpcClassicLinkDnsSupportAsync(request, [complete](const EC2Client*, const Model::EnableVpcClassicLinkDnsSupportRequest&, const Model::EnableVpcClassicLinkDnsSupportOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableVpcClassicLinkDnsSupportOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the console output for the specified instance.</p> <p>Instances do not
          * have a physical monitor through which you can view their console output. They
@@ -6573,6 +10598,39 @@ namespace Model
          */
         virtual void GetConsoleOutputAsync(const Model::GetConsoleOutputRequest& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the console output for the specified instance.</p> <p>Instances do not
+         * have a physical monitor through which you can view their console output. They
+         * also lack physical controls that allow you to power up, reboot, or shut them
+         * down. To allow these actions, we provide them through the Amazon EC2 API and
+         * command line interface.</p> <p>Instance console output is buffered and posted
+         * shortly after instance boot, reboot, and termination. Amazon EC2 preserves the
+         * most recent 64 KB output which is available for at least one hour after the most
+         * recent post.</p> <p>For Linux instances, the instance console output displays
+         * the exact console output that would normally be displayed on a physical monitor
+         * attached to a computer. This output is buffered because the instance produces it
+         * and then posts it to a store where the instance's owner can retrieve it.</p>
+         * <p>For Windows instances, the instance console output includes output from the
+         * EC2Config service.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetConsoleOutputAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetConsoleOutputRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetConsoleOutputOutcome> GetConsoleOutputAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetConsoleOutputOutcome>([this, request](const std::function<void(Model::GetConsoleOutputOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetConsoleOutputAsync(request, [complete](const EC2Client*, const Model::GetConsoleOutputRequest&, const Model::GetConsoleOutputOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetConsoleOutputOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the encrypted administrator password for an instance running
          * Windows.</p> <p>The Windows password is generated at boot if the
@@ -6622,6 +10680,37 @@ namespace Model
          */
         virtual void GetPasswordDataAsync(const Model::GetPasswordDataRequest& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the encrypted administrator password for an instance running
+         * Windows.</p> <p>The Windows password is generated at boot if the
+         * <code>EC2Config</code> service plugin, <code>Ec2SetPassword</code>, is enabled.
+         * This usually only happens the first time an AMI is launched, and then
+         * <code>Ec2SetPassword</code> is automatically disabled. The password is not
+         * generated for rebundled AMIs unless <code>Ec2SetPassword</code> is enabled
+         * before bundling.</p> <p>The password is encrypted using the key pair that you
+         * specified when you launched the instance. You must provide the corresponding key
+         * pair file.</p> <p>Password generation and encryption takes a few moments. We
+         * recommend that you wait up to 15 minutes after launching an instance before
+         * trying to retrieve the generated password.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetPasswordDataAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetPasswordDataRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetPasswordDataOutcome> GetPasswordDataAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetPasswordDataOutcome>([this, request](const std::function<void(Model::GetPasswordDataOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetPasswordDataAsync(request, [complete](const EC2Client*, const Model::GetPasswordDataRequest&, const Model::GetPasswordDataOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetPasswordDataOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Import single or multi-volume disk images or EBS snapshots into an Amazon
          * Machine Image (AMI).</p>
@@ -6644,6 +10733,28 @@ namespace Model
          */
         virtual void ImportImageAsync(const Model::ImportImageRequest& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Import single or multi-volume disk images or EBS snapshots into an Amazon
+         * Machine Image (AMI).</p>
+         *
+         * Returns an awaitable that starts the operation the way ImportImageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ImportImageRequest>
+        Aws::Utils::Threading::Awaitable<Model::ImportImageOutcome> ImportImageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ImportImageOutcome>([this, request](const std::function<void(Model::ImportImageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ImportImageAsync(request, [complete](const EC2Client*, const Model::ImportImageRequest&, const Model::ImportImageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ImportImageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an import instance task using metadata from the specified disk image.
          * <code>ImportInstance</code> only supports single-volume VMs. To import
@@ -6693,6 +10804,37 @@ namespace Model
          */
         virtual void ImportInstanceAsync(const Model::ImportInstanceRequest& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an import instance task using metadata from the specified disk image.
+         * <code>ImportInstance</code> only supports single-volume VMs. To import
+         * multi-volume VMs, use <a>ImportImage</a>. After importing the image, you then
+         * upload it using the <code>ec2-import-volume</code> command in the EC2 command
+         * line tools. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/UploadingYourInstancesandVolumes.html">Using
+         * the Command Line Tools to Import Your Virtual Machine to Amazon EC2</a> in the
+         * <i>Amazon Elastic Compute Cloud User Guide</i>.</p> <p>For information about the
+         * import manifest referenced by this API action, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/APIReference/manifest.html">VM
+         * Import Manifest</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ImportInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ImportInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ImportInstanceOutcome> ImportInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ImportInstanceOutcome>([this, request](const std::function<void(Model::ImportInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ImportInstanceAsync(request, [complete](const EC2Client*, const Model::ImportInstanceRequest&, const Model::ImportInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ImportInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Imports the public key from an RSA key pair that you created with a
          * third-party tool. Compare this with <a>CreateKeyPair</a>, in which AWS creates
@@ -6733,6 +10875,34 @@ namespace Model
          */
         virtual void ImportKeyPairAsync(const Model::ImportKeyPairRequest& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Imports the public key from an RSA key pair that you created with a
+         * third-party tool. Compare this with <a>CreateKeyPair</a>, in which AWS creates
+         * the key pair and gives the keys to you (AWS keeps a copy of the public key).
+         * With ImportKeyPair, you create the key pair and give AWS just the public key.
+         * The private key is never transferred between you and AWS.</p> <p>For more
+         * information about key pairs, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ec2-key-pairs.html">Key
+         * Pairs</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ImportKeyPairAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ImportKeyPairRequest>
+        Aws::Utils::Threading::Awaitable<Model::ImportKeyPairOutcome> ImportKeyPairAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ImportKeyPairOutcome>([this, request](const std::function<void(Model::ImportKeyPairOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ImportKeyPairAsync(request, [complete](const EC2Client*, const Model::ImportKeyPairRequest&, const Model::ImportKeyPairOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ImportKeyPairOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Imports a disk into an EBS snapshot.</p>
          */
@@ -6752,6 +10922,27 @@ namespace Model
          */
         virtual void ImportSnapshotAsync(const Model::ImportSnapshotRequest& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Imports a disk into an EBS snapshot.</p>
+         *
+         * Returns an awaitable that starts the operation the way ImportSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ImportSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::ImportSnapshotOutcome> ImportSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ImportSnapshotOutcome>([this, request](const std::function<void(Model::ImportSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ImportSnapshotAsync(request, [complete](const EC2Client*, const Model::ImportSnapshotRequest&, const Model::ImportSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ImportSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an import volume task using metadata from the specified disk image.
          * After importing the image, you then upload it using the
@@ -6798,6 +10989,36 @@ namespace Model
          */
         virtual void ImportVolumeAsync(const Model::ImportVolumeRequest& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an import volume task using metadata from the specified disk image.
+         * After importing the image, you then upload it using the
+         * <code>ec2-import-volume</code> command in the Amazon EC2 command-line interface
+         * (CLI) tools. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/UploadingYourInstancesandVolumes.html">Using
+         * the Command Line Tools to Import Your Virtual Machine to Amazon EC2</a> in the
+         * <i>Amazon Elastic Compute Cloud User Guide</i>.</p> <p>For information about the
+         * import manifest referenced by this API action, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/APIReference/manifest.html">VM
+         * Import Manifest</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ImportVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ImportVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ImportVolumeOutcome> ImportVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ImportVolumeOutcome>([this, request](const std::function<void(Model::ImportVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ImportVolumeAsync(request, [complete](const EC2Client*, const Model::ImportVolumeRequest&, const Model::ImportVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ImportVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modify the auto-placement setting of a Dedicated host. When auto-placement is
          * enabled, AWS will place instances that you launch with a tenancy of
@@ -6835,6 +11056,33 @@ namespace Model
          */
         virtual void ModifyHostsAsync(const Model::ModifyHostsRequest& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modify the auto-placement setting of a Dedicated host. When auto-placement is
+         * enabled, AWS will place instances that you launch with a tenancy of
+         * <code>host</code>, but without targeting a specific host ID, onto any available
+         * Dedicated host in your account which has auto-placement enabled. When
+         * auto-placement is disabled, you need to provide a host ID if you want the
+         * instance to launch onto a specific host. If no host ID is provided, the instance
+         * will be launched onto a suitable host which has auto-placement enabled.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyHostsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyHostsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyHostsOutcome> ModifyHostsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyHostsOutcome>([this, request](const std::function<void(Model::ModifyHostsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyHostsAsync(request, [complete](const EC2Client*, const Model::ModifyHostsRequest&, const Model::ModifyHostsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyHostsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the ID format for the specified resource on a per-region basis. You
          * can specify that resources should receive longer IDs (17-character IDs) when
@@ -6896,6 +11144,41 @@ namespace Model
          */
         virtual void ModifyIdFormatAsync(const Model::ModifyIdFormatRequest& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the ID format for the specified resource on a per-region basis. You
+         * can specify that resources should receive longer IDs (17-character IDs) when
+         * they are created. The following resource types support longer IDs:
+         * <code>instance</code> | <code>reservation</code>.</p> <p>This setting applies to
+         * the IAM user who makes the request; it does not apply to the entire AWS account.
+         * By default, an IAM user defaults to the same settings as the root user. If
+         * you're using this action as the root user or as an IAM role that has permission
+         * to use this action, then these settings apply to the entire account, unless an
+         * IAM user explicitly overrides these settings for themselves. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/resource-ids.html#resource-ids-access">Controlling
+         * Access to Longer ID Settings</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>. </p> <p>Resources created with longer IDs are visible to all IAM
+         * users, regardless of these settings and provided that they have permission to
+         * use the relevant <code>Describe</code> command for the resource type.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyIdFormatAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyIdFormatRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyIdFormatOutcome> ModifyIdFormatAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyIdFormatOutcome>([this, request](const std::function<void(Model::ModifyIdFormatOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyIdFormatAsync(request, [complete](const EC2Client*, const Model::ModifyIdFormatRequest&, const Model::ModifyIdFormatOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyIdFormatOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the specified attribute of the specified AMI. You can specify only
          * one attribute at a time.</p> <note><p>AWS Marketplace product codes cannot be
@@ -6924,6 +11207,30 @@ namespace Model
          */
         virtual void ModifyImageAttributeAsync(const Model::ModifyImageAttributeRequest& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the specified attribute of the specified AMI. You can specify only
+         * one attribute at a time.</p> <note><p>AWS Marketplace product codes cannot be
+         * modified. Images with an AWS Marketplace product code cannot be made
+         * public.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way ModifyImageAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyImageAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyImageAttributeOutcome> ModifyImageAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyImageAttributeOutcome>([this, request](const std::function<void(Model::ModifyImageAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyImageAttributeAsync(request, [complete](const EC2Client*, const Model::ModifyImageAttributeRequest&, const Model::ModifyImageAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyImageAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the specified attribute of the specified instance. You can specify
          * only one attribute at a time.</p> <p>To modify some attributes, the instance
@@ -6954,9 +11261,35 @@ namespace Model
          * Attributes of a Stopped Instance</a> in the <i>Amazon Elastic Compute Cloud User
          * Guide</i>.</p>
          *
-         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         */
+        virtual void ModifyInstanceAttributeAsync(const Model::ModifyInstanceAttributeRequest& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the specified attribute of the specified instance. You can specify
+         * only one attribute at a time.</p> <p>To modify some attributes, the instance
+         * must be stopped. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/Using_ChangingAttributesWhileInstanceStopped.html">Modifying
+         * Attributes of a Stopped Instance</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyInstanceAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
          */
-        virtual void ModifyInstanceAttributeAsync(const Model::ModifyInstanceAttributeRequest& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        template<typename REQUEST = Model::ModifyInstanceAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyInstanceAttributeOutcome> ModifyInstanceAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyInstanceAttributeOutcome>([this, request](const std::function<void(Model::ModifyInstanceAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyInstanceAttributeAsync(request, [complete](const EC2Client*, const Model::ModifyInstanceAttributeRequest&, const Model::ModifyInstanceAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyInstanceAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Set the instance affinity value for a specific stopped instance and modify
@@ -7013,6 +11346,39 @@ namespace Model
          */
         virtual void ModifyInstancePlacementAsync(const Model::ModifyInstancePlacementRequest& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Set the instance affinity value for a specific stopped instance and modify
+         * the instance tenancy setting.</p> <p>Instance affinity is disabled by default.
+         * When instance affinity is <code>host</code> and it is not associated with a
+         * specific Dedicated host, the next time it is launched it will automatically be
+         * associated with the host it lands on. This relationship will persist if the
+         * instance is stopped/started, or rebooted.</p> <p>You can modify the host ID
+         * associated with a stopped instance. If a stopped instance has a new host ID
+         * association, the instance will target that host when restarted.</p> <p>You can
+         * modify the tenancy of a stopped instance with a tenancy of <code>host</code> or
+         * <code>dedicated</code>.</p> <p>Affinity, hostID, and tenancy are not required
+         * parameters, but at least one of them must be specified in the request. Affinity
+         * and tenancy can be modified in the same request, but tenancy can only be
+         * modified on instances that are stopped.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyInstancePlacementAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyInstancePlacementRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyInstancePlacementOutcome> ModifyInstancePlacementAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyInstancePlacementOutcome>([this, request](const std::function<void(Model::ModifyInstancePlacementOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyInstancePlacementAsync(request, [complete](const EC2Client*, const Model::ModifyInstancePlacementRequest&, const Model::ModifyInstancePlacementOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyInstancePlacementOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the specified network interface attribute. You can specify only one
          * attribute at a time.</p>
@@ -7035,6 +11401,28 @@ namespace Model
          */
         virtual void ModifyNetworkInterfaceAttributeAsync(const Model::ModifyNetworkInterfaceAttributeRequest& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the specified network interface attribute. You can specify only one
+         * attribute at a time.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyNetworkInterfaceAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyNetworkInterfaceAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyNetworkInterfaceAttributeOutcome> ModifyNetworkInterfaceAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyNetworkInterfaceAttributeOutcome>([this, request](const std::function<void(Model::ModifyNetworkInterfaceAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyNetworkInterfaceAttributeAsync(request, [complete](const EC2Client*, const Model::ModifyNetworkInterfaceAttributeRequest&, const Model::ModifyNetworkInterfaceAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyNetworkInterfaceAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the Availability Zone, instance count, instance type, or network
          * platform (EC2-Classic or EC2-VPC) of your Reserved Instances. The Reserved
@@ -7069,6 +11457,32 @@ namespace Model
          */
         virtual void ModifyReservedInstancesAsync(const Model::ModifyReservedInstancesRequest& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the Availability Zone, instance count, instance type, or network
+         * platform (EC2-Classic or EC2-VPC) of your Reserved Instances. The Reserved
+         * Instances to be modified must be identical, except for Availability Zone,
+         * network platform, and instance type.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ri-modifying.html">Modifying
+         * Reserved Instances</a> in the Amazon Elastic Compute Cloud User Guide.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyReservedInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyReservedInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyReservedInstancesOutcome> ModifyReservedInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyReservedInstancesOutcome>([this, request](const std::function<void(Model::ModifyReservedInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyReservedInstancesAsync(request, [complete](const EC2Client*, const Model::ModifyReservedInstancesRequest&, const Model::ModifyReservedInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyReservedInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds or removes permission settings for the specified snapshot. You may add
          * or remove specified AWS account IDs from a snapshot's list of create volume
@@ -7112,6 +11526,35 @@ namespace Model
          */
         virtual void ModifySnapshotAttributeAsync(const Model::ModifySnapshotAttributeRequest& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds or removes permission settings for the specified snapshot. You may add
+         * or remove specified AWS account IDs from a snapshot's list of create volume
+         * permissions, but you cannot do both in a single API call. If you need to both
+         * add and remove account IDs for a snapshot, you must use multiple API calls.</p>
+         * <p>For more information on modifying snapshot permissions, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ebs-modifying-snapshot-permissions.html">Sharing
+         * Snapshots</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p> <note>
+         * <p>Snapshots with AWS Marketplace product codes cannot be made public.</p>
+         * </note>
+         *
+         * Returns an awaitable that starts the operation the way ModifySnapshotAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifySnapshotAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifySnapshotAttributeOutcome> ModifySnapshotAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifySnapshotAttributeOutcome>([this, request](const std::function<void(Model::ModifySnapshotAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifySnapshotAttributeAsync(request, [complete](const EC2Client*, const Model::ModifySnapshotAttributeRequest&, const Model::ModifySnapshotAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifySnapshotAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the specified Spot fleet request.</p> <p>While the Spot fleet
          * request is being modified, it is in the <code>modifying</code> state.</p> <p>To
@@ -7179,6 +11622,43 @@ namespace Model
          */
         virtual void ModifySpotFleetRequestAsync(const Model::ModifySpotFleetRequestRequest& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the specified Spot fleet request.</p> <p>While the Spot fleet
+         * request is being modified, it is in the <code>modifying</code> state.</p> <p>To
+         * scale up your Spot fleet, increase its target capacity. The Spot fleet launches
+         * the additional Spot instances according to the allocation strategy for the Spot
+         * fleet request. If the allocation strategy is <code>lowestPrice</code>, the Spot
+         * fleet launches instances using the Spot pool with the lowest price. If the
+         * allocation strategy is <code>diversified</code>, the Spot fleet distributes the
+         * instances across the Spot pools.</p> <p>To scale down your Spot fleet, decrease
+         * its target capacity. First, the Spot fleet cancels any open bids that exceed the
+         * new target capacity. You can request that the Spot fleet terminate Spot
+         * instances until the size of the fleet no longer exceeds the new target capacity.
+         * If the allocation strategy is <code>lowestPrice</code>, the Spot fleet
+         * terminates the instances with the highest price per unit. If the allocation
+         * strategy is <code>diversified</code>, the Spot fleet terminates instances across
+         * the Spot pools. Alternatively, you can request that the Spot fleet keep the
+         * fleet at its current size, but not replace any Spot instances that are
+         * interrupted or that you terminate manually.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifySpotFleetRequestAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifySpotFleetRequestRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifySpotFleetRequestOutcome> ModifySpotFleetRequestAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifySpotFleetRequestOutcome>([this, request](const std::function<void(Model::ModifySpotFleetRequestOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifySpotFleetRequestAsync(request, [complete](const EC2Client*, const Model::ModifySpotFleetRequestRequest&, const Model::ModifySpotFleetRequestOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifySpotFleetRequestOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies a subnet attribute.</p>
          */
@@ -7198,6 +11678,27 @@ namespace Model
          */
         virtual void ModifySubnetAttributeAsync(const Model::ModifySubnetAttributeRequest& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies a subnet attribute.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifySubnetAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifySubnetAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifySubnetAttributeOutcome> ModifySubnetAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifySubnetAttributeOutcome>([this, request](const std::function<void(Model::ModifySubnetAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifySubnetAttributeAsync(request, [complete](const EC2Client*, const Model::ModifySubnetAttributeRequest&, const Model::ModifySubnetAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifySubnetAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies a volume attribute.</p> <p>By default, all I/O operations for the
          * volume are suspended when the data on the volume is determined to be potentially
@@ -7235,6 +11736,33 @@ namespace Model
          */
         virtual void ModifyVolumeAttributeAsync(const Model::ModifyVolumeAttributeRequest& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies a volume attribute.</p> <p>By default, all I/O operations for the
+         * volume are suspended when the data on the volume is determined to be potentially
+         * inconsistent, to prevent undetectable, latent data corruption. The I/O access to
+         * the volume can be resumed by first enabling I/O access and then checking the
+         * data consistency on your volume.</p> <p>You can change the default behavior to
+         * resume I/O operations. We recommend that you change this only for boot volumes
+         * or for volumes that are stateless or disposable.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyVolumeAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyVolumeAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyVolumeAttributeOutcome> ModifyVolumeAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyVolumeAttributeOutcome>([this, request](const std::function<void(Model::ModifyVolumeAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyVolumeAttributeAsync(request, [complete](const EC2Client*, const Model::ModifyVolumeAttributeRequest&, const Model::ModifyVolumeAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyVolumeAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the specified attribute of the specified VPC.</p>
          */
@@ -7254,6 +11782,27 @@ namespace Model
          */
         virtual void ModifyVpcAttributeAsync(const Model::ModifyVpcAttributeRequest& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the specified attribute of the specified VPC.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyVpcAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyVpcAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyVpcAttributeOutcome> ModifyVpcAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyVpcAttributeOutcome>([this, request](const std::function<void(Model::ModifyVpcAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyVpcAttributeAsync(request, [complete](const EC2Client*, const Model::ModifyVpcAttributeRequest&, const Model::ModifyVpcAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyVpcAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies attributes of a specified VPC endpoint. You can modify the policy
          * associated with the endpoint, and you can add and remove route tables associated
@@ -7279,6 +11828,29 @@ namespace Model
          */
         virtual void ModifyVpcEndpointAsync(const Model::ModifyVpcEndpointRequest& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies attributes of a specified VPC endpoint. You can modify the policy
+         * associated with the endpoint, and you can add and remove route tables associated
+         * with the endpoint.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyVpcEndpointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyVpcEndpointRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyVpcEndpointOutcome> ModifyVpcEndpointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyVpcEndpointOutcome>([this, request](const std::function<void(Model::ModifyVpcEndpointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyVpcEndpointAsync(request, [complete](const EC2Client*, const Model::ModifyVpcEndpointRequest&, const Model::ModifyVpcEndpointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyVpcEndpointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables monitoring for a running instance. For more information about
          * monitoring instances, see <a
@@ -7310,6 +11882,31 @@ namespace Model
          */
         virtual void MonitorInstancesAsync(const Model::MonitorInstancesRequest& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables monitoring for a running instance. For more information about
+         * monitoring instances, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using-cloudwatch.html">Monitoring
+         * Your Instances and Volumes</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way MonitorInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::MonitorInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::MonitorInstancesOutcome> MonitorInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::MonitorInstancesOutcome>([this, request](const std::function<void(Model::MonitorInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->MonitorInstancesAsync(request, [complete](const EC2Client*, const Model::MonitorInstancesRequest&, const Model::MonitorInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::MonitorInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Moves an Elastic IP address from the EC2-Classic platform to the EC2-VPC
          * platform. The Elastic IP address must be allocated to your account for more than
@@ -7353,6 +11950,35 @@ namespace Model
          */
         virtual void MoveAddressToVpcAsync(const Model::MoveAddressToVpcRequest& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Moves an Elastic IP address from the EC2-Classic platform to the EC2-VPC
+         * platform. The Elastic IP address must be allocated to your account for more than
+         * 24 hours, and it must not be associated with an instance. After the Elastic IP
+         * address is moved, it is no longer available for use in the EC2-Classic platform,
+         * unless you move it back using the <a>RestoreAddressToClassic</a> request. You
+         * cannot move an Elastic IP address that's allocated for use in the EC2-VPC
+         * platform to the EC2-Classic platform. You cannot migrate an Elastic IP address
+         * that's associated with a reverse DNS record. Contact AWS account and billing
+         * support to remove the reverse DNS record. </p>
+         *
+         * Returns an awaitable that starts the operation the way MoveAddressToVpcAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::MoveAddressToVpcRequest>
+        Aws::Utils::Threading::Awaitable<Model::MoveAddressToVpcOutcome> MoveAddressToVpcAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::MoveAddressToVpcOutcome>([this, request](const std::function<void(Model::MoveAddressToVpcOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->MoveAddressToVpcAsync(request, [complete](const EC2Client*, const Model::MoveAddressToVpcRequest&, const Model::MoveAddressToVpcOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::MoveAddressToVpcOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Purchases a Reserved Instance for use with your account. With Reserved
          * Instances, you obtain a capacity reservation for a certain instance
@@ -7408,6 +12034,39 @@ namespace Model
          */
         virtual void PurchaseReservedInstancesOfferingAsync(const Model::PurchaseReservedInstancesOfferingRequest& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Purchases a Reserved Instance for use with your account. With Reserved
+         * Instances, you obtain a capacity reservation for a certain instance
+         * configuration over a specified period of time and pay a lower hourly rate
+         * compared to On-Demand instance pricing.</p> <p>Use
+         * <a>DescribeReservedInstancesOfferings</a> to get a list of Reserved Instance
+         * offerings that match your specifications. After you've purchased a Reserved
+         * Instance, you can check for your new Reserved Instance with
+         * <a>DescribeReservedInstances</a>.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/concepts-on-demand-reserved-instances.html">Reserved
+         * Instances</a> and <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ri-market-general.html">Reserved
+         * Instance Marketplace</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way PurchaseReservedInstancesOfferingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PurchaseReservedInstancesOfferingRequest>
+        Aws::Utils::Threading::Awaitable<Model::PurchaseReservedInstancesOfferingOutcome> PurchaseReservedInstancesOfferingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PurchaseReservedInstancesOfferingOutcome>([this, request](const std::function<void(Model::PurchaseReservedInstancesOfferingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PurchaseReservedInstancesOfferingAsync(request, [complete](const EC2Client*, const Model::PurchaseReservedInstancesOfferingRequest&, const Model::PurchaseReservedInstancesOfferingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PurchaseReservedInstancesOfferingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Purchases one or more Scheduled Instances with the specified schedule.</p>
          * <p>Scheduled Instances enable you to purchase Amazon EC2 compute capacity by the
@@ -7439,6 +12098,31 @@ namespace Model
          */
         virtual void PurchaseScheduledInstancesAsync(const Model::PurchaseScheduledInstancesRequest& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Purchases one or more Scheduled Instances with the specified schedule.</p>
+         * <p>Scheduled Instances enable you to purchase Amazon EC2 compute capacity by the
+         * hour for a one-year term. Before you can purchase a Scheduled Instance, you must
+         * call <a>DescribeScheduledInstanceAvailability</a> to check for available
+         * schedules and obtain a purchase token.</p>
+         *
+         * Returns an awaitable that starts the operation the way PurchaseScheduledInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PurchaseScheduledInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::PurchaseScheduledInstancesOutcome> PurchaseScheduledInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PurchaseScheduledInstancesOutcome>([this, request](const std::function<void(Model::PurchaseScheduledInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PurchaseScheduledInstancesAsync(request, [complete](const EC2Client*, const Model::PurchaseScheduledInstancesRequest&, const Model::PurchaseScheduledInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PurchaseScheduledInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests a reboot of one or more instances. This operation is asynchronous;
          * it only queues a request to reboot the specified instances. The operation
@@ -7482,6 +12166,35 @@ namespace Model
          */
         virtual void RebootInstancesAsync(const Model::RebootInstancesRequest& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests a reboot of one or more instances. This operation is asynchronous;
+         * it only queues a request to reboot the specified instances. The operation
+         * succeeds if the instances are valid and belong to you. Requests to reboot
+         * terminated instances are ignored.</p> <p>If a Linux/Unix instance does not
+         * cleanly shut down within four minutes, Amazon EC2 performs a hard reboot.</p>
+         * <p>For more information about troubleshooting, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/instance-console.html">Getting
+         * Console Output and Rebooting Instances</a> in the <i>Amazon Elastic Compute
+         * Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RebootInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RebootInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::RebootInstancesOutcome> RebootInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RebootInstancesOutcome>([this, request](const std::function<void(Model::RebootInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RebootInstancesAsync(request, [complete](const EC2Client*, const Model::RebootInstancesRequest&, const Model::RebootInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RebootInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers an AMI. When you're creating an AMI, this is the final step you
          * must complete before you can launch an instance from the AMI. For more
@@ -7579,6 +12292,53 @@ namespace Model
          */
         virtual void RegisterImageAsync(const Model::RegisterImageRequest& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers an AMI. When you're creating an AMI, this is the final step you
+         * must complete before you can launch an instance from the AMI. For more
+         * information about creating AMIs, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/creating-an-ami.html">Creating
+         * Your Own AMIs</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         * <note><p>For Amazon EBS-backed instances, <a>CreateImage</a> creates and
+         * registers the AMI in a single request, so you don't have to register the AMI
+         * yourself.</p></note> <p>You can also use <code>RegisterImage</code> to create an
+         * Amazon EBS-backed Linux AMI from a snapshot of a root device volume. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/Using_LaunchingInstanceFromSnapshot.html">Launching
+         * an Instance from a Snapshot</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p> <important> <p>Some Linux distributions, such as Red Hat
+         * Enterprise Linux (RHEL) and SUSE Linux Enterprise Server (SLES), use the EC2
+         * <code>billingProduct</code> code associated with an AMI to verify subscription
+         * status for package updates. Creating an AMI from an EBS snapshot does not
+         * maintain this billing code, and subsequent instances launched from such an AMI
+         * will not be able to connect to package update infrastructure.</p> <p>Similarly,
+         * although you can create a Windows AMI from a snapshot, you can't successfully
+         * launch an instance from the AMI.</p> <p>To create Windows AMIs or to create AMIs
+         * for Linux operating systems that must retain AMI billing codes to work properly,
+         * see <a>CreateImage</a>.</p> </important> <p>If needed, you can deregister an AMI
+         * at any time. Any modifications you make to an AMI backed by an instance store
+         * volume invalidates its registration. If you make changes to an image, deregister
+         * the previous image and register the new image.</p> <note><p>You can't register
+         * an image where a secondary (non-root) snapshot has AWS Marketplace product
+         * codes.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way RegisterImageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterImageRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterImageOutcome> RegisterImageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterImageOutcome>([this, request](const std::function<void(Model::RegisterImageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterImageAsync(request, [complete](const EC2Client*, const Model::RegisterImageRequest&, const Model::RegisterImageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterImageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Rejects a VPC peering connection request. The VPC peering connection must be
          * in the <code>pending-acceptance</code> state. Use the
@@ -7613,6 +12373,32 @@ namespace Model
          */
         virtual void RejectVpcPeeringConnectionAsync(const Model::RejectVpcPeeringConnectionRequest& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Rejects a VPC peering connection request. The VPC peering connection must be
+         * in the <code>pending-acceptance</code> state. Use the
+         * <a>DescribeVpcPeeringConnections</a> request to view your outstanding VPC
+         * peering connection requests. To delete an active VPC peering connection, or to
+         * delete a VPC peering connection request that you initiated, use
+         * <a>DeleteVpcPeeringConnection</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RejectVpcPeeringConnectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RejectVpcPeeringConnectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::RejectVpcPeeringConnectionOutcome> RejectVpcPeeringConnectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RejectVpcPeeringConnectionOutcome>([this, request](const std::function<void(Model::RejectVpcPeeringConnectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RejectVpcPeeringConnectionAsync(request, [complete](const EC2Client*, const Model::RejectVpcPeeringConnectionRequest&, const Model::RejectVpcPeeringConnectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RejectVpcPeeringConnectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Releases the specified Elastic IP address.</p> <p>After releasing an Elastic
          * IP address, it is released to the IP address pool and might be unavailable to
@@ -7665,6 +12451,38 @@ namespace Model
          */
         virtual void ReleaseAddressAsync(const Model::ReleaseAddressRequest& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Releases the specified Elastic IP address.</p> <p>After releasing an Elastic
+         * IP address, it is released to the IP address pool and might be unavailable to
+         * you. Be sure to update your DNS records and any servers or devices that
+         * communicate with the address. If you attempt to release an Elastic IP address
+         * that you already released, you'll get an <code>AuthFailure</code> error if the
+         * address is already allocated to another AWS account.</p> <p>[EC2-Classic,
+         * default VPC] Releasing an Elastic IP address automatically disassociates it from
+         * any instance that it's associated with. To disassociate an Elastic IP address
+         * without releasing it, use <a>DisassociateAddress</a>.</p> <p>[Nondefault VPC]
+         * You must use <a>DisassociateAddress</a> to disassociate the Elastic IP address
+         * before you try to release it. Otherwise, Amazon EC2 returns an error
+         * (<code>InvalidIPAddress.InUse</code>).</p>
+         *
+         * Returns an awaitable that starts the operation the way ReleaseAddressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReleaseAddressRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReleaseAddressOutcome> ReleaseAddressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReleaseAddressOutcome>([this, request](const std::function<void(Model::ReleaseAddressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReleaseAddressAsync(request, [complete](const EC2Client*, const Model::ReleaseAddressRequest&, const Model::ReleaseAddressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReleaseAddressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>When you no longer want to use a Dedicated host it can be released. On-Demand
          * billing is stopped and the host goes into <code>released</code> state. The host
@@ -7708,6 +12526,35 @@ namespace Model
          */
         virtual void ReleaseHostsAsync(const Model::ReleaseHostsRequest& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>When you no longer want to use a Dedicated host it can be released. On-Demand
+         * billing is stopped and the host goes into <code>released</code> state. The host
+         * ID of Dedicated hosts that have been released can no longer be specified in
+         * another request, e.g., ModifyHosts. You must stop or terminate all instances on
+         * a host before it can be released.</p> <p>When Dedicated hosts are released, it
+         * make take some time for them to stop counting toward your limit and you may
+         * receive capacity errors when trying to allocate new Dedicated hosts. Try waiting
+         * a few minutes, and then try again. </p> <p>Released hosts will still appear in a
+         * DescribeHosts response.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReleaseHostsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReleaseHostsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReleaseHostsOutcome> ReleaseHostsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReleaseHostsOutcome>([this, request](const std::function<void(Model::ReleaseHostsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReleaseHostsAsync(request, [complete](const EC2Client*, const Model::ReleaseHostsRequest&, const Model::ReleaseHostsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReleaseHostsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes which network ACL a subnet is associated with. By default when you
          * create a subnet, it's automatically associated with the default network ACL. For
@@ -7739,6 +12586,31 @@ namespace Model
          */
         virtual void ReplaceNetworkAclAssociationAsync(const Model::ReplaceNetworkAclAssociationRequest& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes which network ACL a subnet is associated with. By default when you
+         * create a subnet, it's automatically associated with the default network ACL. For
+         * more information about network ACLs, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_ACLs.html">Network
+         * ACLs</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReplaceNetworkAclAssociationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReplaceNetworkAclAssociationRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReplaceNetworkAclAssociationOutcome> ReplaceNetworkAclAssociationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReplaceNetworkAclAssociationOutcome>([this, request](const std::function<void(Model::ReplaceNetworkAclAssociationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReplaceNetworkAclAssociationAsync(request, [complete](const EC2Client*, const Model::ReplaceNetworkAclAssociationRequest&, const Model::ReplaceNetworkAclAssociationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReplaceNetworkAclAssociationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Replaces an entry (rule) in a network ACL. For more information about network
          * ACLs, see <a
@@ -7767,6 +12639,30 @@ namespace Model
          */
         virtual void ReplaceNetworkAclEntryAsync(const Model::ReplaceNetworkAclEntryRequest& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Replaces an entry (rule) in a network ACL. For more information about network
+         * ACLs, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_ACLs.html">Network
+         * ACLs</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReplaceNetworkAclEntryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReplaceNetworkAclEntryRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReplaceNetworkAclEntryOutcome> ReplaceNetworkAclEntryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReplaceNetworkAclEntryOutcome>([this, request](const std::function<void(Model::ReplaceNetworkAclEntryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReplaceNetworkAclEntryAsync(request, [complete](const EC2Client*, const Model::ReplaceNetworkAclEntryRequest&, const Model::ReplaceNetworkAclEntryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReplaceNetworkAclEntryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Replaces an existing route within a route table in a VPC. You must provide
          * only one of the following: Internet gateway or virtual private gateway, NAT
@@ -7799,7 +12695,33 @@ namespace Model
          *
          * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
-        virtual void ReplaceRouteAsync(const Model::ReplaceRouteRequest& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        virtual void ReplaceRouteAsync(const Model::ReplaceRouteRequest& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Replaces an existing route within a route table in a VPC. You must provide
+         * only one of the following: Internet gateway or virtual private gateway, NAT
+         * instance, NAT gateway, VPC peering connection, or network interface.</p> <p>For
+         * more information about route tables, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_Route_Tables.html">Route
+         * Tables</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReplaceRouteAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReplaceRouteRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReplaceRouteOutcome> ReplaceRouteAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReplaceRouteOutcome>([this, request](const std::function<void(Model::ReplaceRouteOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReplaceRouteAsync(request, [complete](const EC2Client*, const Model::ReplaceRouteRequest&, const Model::ReplaceRouteOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReplaceRouteOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Changes the route table associated with a given subnet in a VPC. After the
@@ -7841,6 +12763,34 @@ namespace Model
          */
         virtual void ReplaceRouteTableAssociationAsync(const Model::ReplaceRouteTableAssociationRequest& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes the route table associated with a given subnet in a VPC. After the
+         * operation completes, the subnet uses the routes in the new route table it's
+         * associated with. For more information about route tables, see <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_Route_Tables.html">Route
+         * Tables</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p> <p>You can
+         * also use ReplaceRouteTableAssociation to change which table is the main route
+         * table in the VPC. You just specify the main route table's association ID and the
+         * route table to be the new main route table.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReplaceRouteTableAssociationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReplaceRouteTableAssociationRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReplaceRouteTableAssociationOutcome> ReplaceRouteTableAssociationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReplaceRouteTableAssociationOutcome>([this, request](const std::function<void(Model::ReplaceRouteTableAssociationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReplaceRouteTableAssociationAsync(request, [complete](const EC2Client*, const Model::ReplaceRouteTableAssociationRequest&, const Model::ReplaceRouteTableAssociationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReplaceRouteTableAssociationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Submits feedback about the status of an instance. The instance must be in the
          * <code>running</code> state. If your experience with the instance differs from
@@ -7878,6 +12828,33 @@ namespace Model
          */
         virtual void ReportInstanceStatusAsync(const Model::ReportInstanceStatusRequest& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Submits feedback about the status of an instance. The instance must be in the
+         * <code>running</code> state. If your experience with the instance differs from
+         * the instance status returned by <a>DescribeInstanceStatus</a>, use
+         * <a>ReportInstanceStatus</a> to report your experience with the instance. Amazon
+         * EC2 collects this information to improve the accuracy of status checks.</p>
+         * <p>Use of this action does not change the value returned by
+         * <a>DescribeInstanceStatus</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReportInstanceStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReportInstanceStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReportInstanceStatusOutcome> ReportInstanceStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReportInstanceStatusOutcome>([this, request](const std::function<void(Model::ReportInstanceStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReportInstanceStatusAsync(request, [complete](const EC2Client*, const Model::ReportInstanceStatusRequest&, const Model::ReportInstanceStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReportInstanceStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a Spot fleet request.</p> <p>You can submit a single request that
          * includes multiple launch specifications that vary by instance type, AMI,
@@ -7930,6 +12907,38 @@ namespace Model
          */
         virtual void RequestSpotFleetAsync(const Model::RequestSpotFleetRequest& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a Spot fleet request.</p> <p>You can submit a single request that
+         * includes multiple launch specifications that vary by instance type, AMI,
+         * Availability Zone, or subnet.</p> <p>By default, the Spot fleet requests Spot
+         * instances in the Spot pool where the price per unit is the lowest. Each launch
+         * specification can include its own instance weighting that reflects the value of
+         * the instance type to your application workload.</p> <p>Alternatively, you can
+         * specify that the Spot fleet distribute the target capacity across the Spot pools
+         * included in its launch specifications. By ensuring that the Spot instances in
+         * your Spot fleet are in different Spot pools, you can improve the availability of
+         * your fleet.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/spot-fleet-requests.html">Spot
+         * Fleet Requests</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RequestSpotFleetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RequestSpotFleetRequest>
+        Aws::Utils::Threading::Awaitable<Model::RequestSpotFleetOutcome> RequestSpotFleetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RequestSpotFleetOutcome>([this, request](const std::function<void(Model::RequestSpotFleetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RequestSpotFleetAsync(request, [complete](const EC2Client*, const Model::RequestSpotFleetRequest&, const Model::RequestSpotFleetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RequestSpotFleetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a Spot instance request. Spot instances are instances that Amazon EC2
          * launches when the bid price that you specify exceeds the current Spot price.
@@ -7964,6 +12973,32 @@ namespace Model
          */
         virtual void RequestSpotInstancesAsync(const Model::RequestSpotInstancesRequest& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a Spot instance request. Spot instances are instances that Amazon EC2
+         * launches when the bid price that you specify exceeds the current Spot price.
+         * Amazon EC2 periodically sets the Spot price based on available Spot Instance
+         * capacity and current Spot instance requests. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/spot-requests.html">Spot
+         * Instance Requests</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RequestSpotInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RequestSpotInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::RequestSpotInstancesOutcome> RequestSpotInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RequestSpotInstancesOutcome>([this, request](const std::function<void(Model::RequestSpotInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RequestSpotInstancesAsync(request, [complete](const EC2Client*, const Model::RequestSpotInstancesRequest&, const Model::RequestSpotInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RequestSpotInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Resets an attribute of an AMI to its default value.</p> <note><p> The
          * productCodes attribute can't be reset. </p></note>
@@ -7986,6 +13021,28 @@ namespace Model
          */
         virtual void ResetImageAttributeAsync(const Model::ResetImageAttributeRequest& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Resets an attribute of an AMI to its default value.</p> <note><p> The
+         * productCodes attribute can't be reset. </p></note>
+         *
+         * Returns an awaitable that starts the operation the way ResetImageAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResetImageAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResetImageAttributeOutcome> ResetImageAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResetImageAttributeOutcome>([this, request](const std::function<void(Model::ResetImageAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResetImageAttributeAsync(request, [complete](const EC2Client*, const Model::ResetImageAttributeRequest&, const Model::ResetImageAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResetImageAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Resets an attribute of an instance to its default value. To reset the
          * <code>kernel</code> or <code>ramdisk</code>, the instance must be in a stopped
@@ -8032,6 +13089,36 @@ namespace Model
          */
         virtual void ResetInstanceAttributeAsync(const Model::ResetInstanceAttributeRequest& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Resets an attribute of an instance to its default value. To reset the
+         * <code>kernel</code> or <code>ramdisk</code>, the instance must be in a stopped
+         * state. To reset the <code>SourceDestCheck</code>, the instance can be either
+         * running or stopped.</p> <p>The <code>SourceDestCheck</code> attribute controls
+         * whether source/destination checking is enabled. The default value is
+         * <code>true</code>, which means checking is enabled. This value must be
+         * <code>false</code> for a NAT instance to perform NAT. For more information, see
+         * <a
+         * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_NAT_Instance.html">NAT
+         * Instances</a> in the <i>Amazon Virtual Private Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ResetInstanceAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResetInstanceAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResetInstanceAttributeOutcome> ResetInstanceAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResetInstanceAttributeOutcome>([this, request](const std::function<void(Model::ResetInstanceAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResetInstanceAttributeAsync(request, [complete](const EC2Client*, const Model::ResetInstanceAttributeRequest&, const Model::ResetInstanceAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResetInstanceAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Resets a network interface attribute. You can specify only one attribute at a
          * time.</p>
@@ -8054,6 +13141,28 @@ namespace Model
          */
         virtual void ResetNetworkInterfaceAttributeAsync(const Model::ResetNetworkInterfaceAttributeRequest& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Resets a network interface attribute. You can specify only one attribute at a
+         * time.</p>
+         *
+         * Returns an awaitable that starts the operation the way ResetNetworkInterfaceAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResetNetworkInterfaceAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResetNetworkInterfaceAttributeOutcome> ResetNetworkInterfaceAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResetNetworkInterfaceAttributeOutcome>([this, request](const std::function<void(Model::ResetNetworkInterfaceAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResetNetworkInterfaceAttributeAsync(request, [complete](const EC2Client*, const Model::ResetNetworkInterfaceAttributeRequest&, const Model::ResetNetworkInterfaceAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResetNetworkInterfaceAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Resets permission settings for the specified snapshot.</p> <p>For more
          * information on modifying snapshot permissions, see <a
@@ -8082,6 +13191,30 @@ namespace Model
          */
         virtual void ResetSnapshotAttributeAsync(const Model::ResetSnapshotAttributeRequest& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Resets permission settings for the specified snapshot.</p> <p>For more
+         * information on modifying snapshot permissions, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ebs-modifying-snapshot-permissions.html">Sharing
+         * Snapshots</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ResetSnapshotAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResetSnapshotAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResetSnapshotAttributeOutcome> ResetSnapshotAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResetSnapshotAttributeOutcome>([this, request](const std::function<void(Model::ResetSnapshotAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResetSnapshotAttributeAsync(request, [complete](const EC2Client*, const Model::ResetSnapshotAttributeRequest&, const Model::ResetSnapshotAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResetSnapshotAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Restores an Elastic IP address that was previously moved to the EC2-VPC
          * platform back to the EC2-Classic platform. You cannot move an Elastic IP address
@@ -8116,6 +13249,32 @@ namespace Model
          */
         virtual void RestoreAddressToClassicAsync(const Model::RestoreAddressToClassicRequest& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Restores an Elastic IP address that was previously moved to the EC2-VPC
+         * platform back to the EC2-Classic platform. You cannot move an Elastic IP address
+         * that was originally allocated for use in EC2-VPC. The Elastic IP address must
+         * not be associated with an instance or network interface. You cannot restore an
+         * Elastic IP address that's associated with a reverse DNS record. Contact AWS
+         * account and billing support to remove the reverse DNS record. </p>
+         *
+         * Returns an awaitable that starts the operation the way RestoreAddressToClassicAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RestoreAddressToClassicRequest>
+        Aws::Utils::Threading::Awaitable<Model::RestoreAddressToClassicOutcome> RestoreAddressToClassicAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RestoreAddressToClassicOutcome>([this, request](const std::function<void(Model::RestoreAddressToClassicOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RestoreAddressToClassicAsync(request, [complete](const EC2Client*, const Model::RestoreAddressToClassicRequest&, const Model::RestoreAddressToClassicOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RestoreAddressToClassicOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>[EC2-VPC only] Removes one or more egress rules from a security group for
          * EC2-VPC. This action doesn't apply to security groups for use in EC2-Classic.
@@ -8159,6 +13318,35 @@ namespace Model
          */
         virtual void RevokeSecurityGroupEgressAsync(const Model::RevokeSecurityGroupEgressRequest& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>[EC2-VPC only] Removes one or more egress rules from a security group for
+         * EC2-VPC. This action doesn't apply to security groups for use in EC2-Classic.
+         * The values that you specify in the revoke request (for example, ports) must
+         * match the existing rule's values for the rule to be revoked.</p> <p>Each rule
+         * consists of the protocol and the CIDR range or source security group. For the
+         * TCP and UDP protocols, you must also specify the destination port or range of
+         * ports. For the ICMP protocol, you must also specify the ICMP type and code.</p>
+         * <p>Rule changes are propagated to instances within the security group as quickly
+         * as possible. However, a small delay might occur.</p>
+         *
+         * Returns an awaitable that starts the operation the way RevokeSecurityGroupEgressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RevokeSecurityGroupEgressRequest>
+        Aws::Utils::Threading::Awaitable<Model::RevokeSecurityGroupEgressOutcome> RevokeSecurityGroupEgressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RevokeSecurityGroupEgressOutcome>([this, request](const std::function<void(Model::RevokeSecurityGroupEgressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RevokeSecurityGroupEgressAsync(request, [complete](const EC2Client*, const Model::RevokeSecurityGroupEgressRequest&, const Model::RevokeSecurityGroupEgressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RevokeSecurityGroupEgressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes one or more ingress rules from a security group. The values that you
          * specify in the revoke request (for example, ports) must match the existing
@@ -8199,6 +13387,34 @@ namespace Model
          */
         virtual void RevokeSecurityGroupIngressAsync(const Model::RevokeSecurityGroupIngressRequest& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes one or more ingress rules from a security group. The values that you
+         * specify in the revoke request (for example, ports) must match the existing
+         * rule's values for the rule to be removed.</p> <p>Each rule consists of the
+         * protocol and the CIDR range or source security group. For the TCP and UDP
+         * protocols, you must also specify the destination port or range of ports. For the
+         * ICMP protocol, you must also specify the ICMP type and code.</p> <p>Rule changes
+         * are propagated to instances within the security group as quickly as possible.
+         * However, a small delay might occur.</p>
+         *
+         * Returns an awaitable that starts the operation the way RevokeSecurityGroupIngressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RevokeSecurityGroupIngressRequest>
+        Aws::Utils::Threading::Awaitable<Model::RevokeSecurityGroupIngressOutcome> RevokeSecurityGroupIngressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RevokeSecurityGroupIngressOutcome>([this, request](const std::function<void(Model::RevokeSecurityGroupIngressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RevokeSecurityGroupIngressAsync(request, [complete](const EC2Client*, const Model::RevokeSecurityGroupIngressRequest&, const Model::RevokeSecurityGroupIngressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RevokeSecurityGroupIngressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Launches the specified number of instances using an AMI for which you have
          * permissions.</p> <p>When you launch an instance, it enters the
@@ -8329,6 +13545,64 @@ namespace Model
          */
         virtual void RunInstancesAsync(const Model::RunInstancesRequest& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Launches the specified number of instances using an AMI for which you have
+         * permissions.</p> <p>When you launch an instance, it enters the
+         * <code>pending</code> state. After the instance is ready for you, it enters the
+         * <code>running</code> state. To check the state of your instance, call
+         * <a>DescribeInstances</a>.</p> <p>To ensure faster instance launches, break up
+         * large requests into smaller batches. For example, create five separate launch
+         * requests for 100 instances each instead of one launch request for 500
+         * instances.</p> <p>If you don't specify a security group when launching an
+         * instance, Amazon EC2 uses the default security group. For more information, see
+         * <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using-network-security.html">Security
+         * Groups</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         * <p>[EC2-VPC only accounts] If you don't specify a subnet in the request, we
+         * choose a default subnet from your default VPC for you. </p> <p>[EC2-Classic
+         * accounts] If you're launching into EC2-Classic and you don't specify an
+         * Availability Zone, we choose one for you.</p> <p>Linux instances have access to
+         * the public key of the key pair at boot. You can use this key to provide secure
+         * access to the instance. Amazon EC2 public images use this feature to provide
+         * secure access without passwords. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ec2-key-pairs.html">Key
+         * Pairs</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p> <p>You can
+         * provide optional user data when launching an instance. For more information, see
+         * <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/AESDG-chapter-instancedata.html">Instance
+         * Metadata</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p> <p>If
+         * any of the AMIs have a product code attached for which the user has not
+         * subscribed, <code>RunInstances</code> fails.</p> <p>Some instance types can only
+         * be launched into a VPC. If you do not have a default VPC, or if you do not
+         * specify a subnet ID in the request, <code>RunInstances</code> fails. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using-vpc.html#vpc-only-instance-types">Instance
+         * Types Available Only in a VPC</a>.</p> <p>For more information about
+         * troubleshooting, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/Using_InstanceStraightToTerminated.html">What
+         * To Do If An Instance Immediately Terminates</a>, and <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/TroubleshootingInstancesConnecting.html">Troubleshooting
+         * Connecting to Your Instance</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RunInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RunInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::RunInstancesOutcome> RunInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RunInstancesOutcome>([this, request](const std::function<void(Model::RunInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RunInstancesAsync(request, [complete](const EC2Client*, const Model::RunInstancesRequest&, const Model::RunInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RunInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Launches the specified Scheduled Instances.</p> <p>Before you can launch a
          * Scheduled Instance, you must purchase it and obtain an identifier using
@@ -8366,6 +13640,33 @@ namespace Model
          */
         virtual void RunScheduledInstancesAsync(const Model::RunScheduledInstancesRequest& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Launches the specified Scheduled Instances.</p> <p>Before you can launch a
+         * Scheduled Instance, you must purchase it and obtain an identifier using
+         * <a>PurchaseScheduledInstances</a>.</p> <p>You must launch a Scheduled Instance
+         * during its scheduled time period. You can't stop or reboot a Scheduled Instance,
+         * but you can terminate it as needed. If you terminate a Scheduled Instance before
+         * the current scheduled time period ends, you can launch it again after a few
+         * minutes.</p>
+         *
+         * Returns an awaitable that starts the operation the way RunScheduledInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RunScheduledInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::RunScheduledInstancesOutcome> RunScheduledInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RunScheduledInstancesOutcome>([this, request](const std::function<void(Model::RunScheduledInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RunScheduledInstancesAsync(request, [complete](const EC2Client*, const Model::RunScheduledInstancesRequest&, const Model::RunScheduledInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RunScheduledInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts an Amazon EBS-backed AMI that you've previously stopped.</p>
          * <p>Instances that use Amazon EBS volumes as their root devices can be quickly
@@ -8424,6 +13725,40 @@ namespace Model
          */
         virtual void StartInstancesAsync(const Model::StartInstancesRequest& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts an Amazon EBS-backed AMI that you've previously stopped.</p>
+         * <p>Instances that use Amazon EBS volumes as their root devices can be quickly
+         * stopped and started. When an instance is stopped, the compute resources are
+         * released and you are not billed for hourly instance usage. However, your root
+         * partition Amazon EBS volume remains, continues to persist your data, and you are
+         * charged for Amazon EBS volume usage. You can restart your instance at any time.
+         * Each time you transition an instance from stopped to started, Amazon EC2 charges
+         * a full instance hour, even if transitions happen multiple times within a single
+         * hour.</p> <p>Before stopping an instance, make sure it is in a state from which
+         * it can be restarted. Stopping an instance does not preserve data stored in
+         * RAM.</p> <p>Performing this operation on an instance that uses an instance store
+         * as its root device returns an error.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/Stop_Start.html">Stopping
+         * Instances</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way StartInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartInstancesOutcome> StartInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartInstancesOutcome>([this, request](const std::function<void(Model::StartInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartInstancesAsync(request, [complete](const EC2Client*, const Model::StartInstancesRequest&, const Model::StartInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Stops an Amazon EBS-backed instance. Each time you transition an instance
          * from stopped to started, Amazon EC2 charges a full instance hour, even if
@@ -8515,6 +13850,51 @@ namespace Model
          */
         virtual void StopInstancesAsync(const Model::StopInstancesRequest& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Stops an Amazon EBS-backed instance. Each time you transition an instance
+         * from stopped to started, Amazon EC2 charges a full instance hour, even if
+         * transitions happen multiple times within a single hour.</p> <p>You can't start
+         * or stop Spot instances.</p> <p>Instances that use Amazon EBS volumes as their
+         * root devices can be quickly stopped and started. When an instance is stopped,
+         * the compute resources are released and you are not billed for hourly instance
+         * usage. However, your root partition Amazon EBS volume remains, continues to
+         * persist your data, and you are charged for Amazon EBS volume usage. You can
+         * restart your instance at any time.</p> <p>Before stopping an instance, make sure
+         * it is in a state from which it can be restarted. Stopping an instance does not
+         * preserve data stored in RAM.</p> <p>Performing this operation on an instance
+         * that uses an instance store as its root device returns an error.</p> <p>You can
+         * stop, start, and terminate EBS-backed instances. You can only terminate instance
+         * store-backed instances. What happens to an instance differs if you stop it or
+         * terminate it. For example, when you stop an instance, the root device and any
+         * other devices attached to the instance persist. When you terminate an instance,
+         * the root device and any other devices attached during the instance launch are
+         * automatically deleted. For more information about the differences between
+         * stopping and terminating instances, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ec2-instance-lifecycle.html">Instance
+         * Lifecycle</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p> <p>For
+         * more information about troubleshooting, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/TroubleshootingInstancesStopping.html">Troubleshooting
+         * Stopping Your Instance</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way StopInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StopInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::StopInstancesOutcome> StopInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StopInstancesOutcome>([this, request](const std::function<void(Model::StopInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StopInstancesAsync(request, [complete](const EC2Client*, const Model::StopInstancesRequest&, const Model::StopInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StopInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Shuts down one or more instances. This operation is idempotent; if you
          * terminate an instance more than once, each call succeeds.</p> <p>Terminated
@@ -8588,6 +13968,45 @@ namespace Model
          */
         virtual void TerminateInstancesAsync(const Model::TerminateInstancesRequest& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Shuts down one or more instances. This operation is idempotent; if you
+         * terminate an instance more than once, each call succeeds.</p> <p>Terminated
+         * instances remain visible after termination (for approximately one hour).</p>
+         * <p>By default, Amazon EC2 deletes all EBS volumes that were attached when the
+         * instance launched. Volumes attached after instance launch continue running.</p>
+         * <p>You can stop, start, and terminate EBS-backed instances. You can only
+         * terminate instance store-backed instances. What happens to an instance differs
+         * if you stop it or terminate it. For example, when you stop an instance, the root
+         * device and any other devices attached to the instance persist. When you
+         * terminate an instance, any attached EBS volumes with the
+         * <code>DeleteOnTermination</code> block device mapping parameter set to
+         * <code>true</code> are automatically deleted. For more information about the
+         * differences between stopping and terminating instances, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/ec2-instance-lifecycle.html">Instance
+         * Lifecycle</a> in the <i>Amazon Elastic Compute Cloud User Guide</i>.</p> <p>For
+         * more information about troubleshooting, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/TroubleshootingInstancesShuttingDown.html">Troubleshooting
+         * Terminating Your Instance</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way TerminateInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TerminateInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::TerminateInstancesOutcome> TerminateInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TerminateInstancesOutcome>([this, request](const std::function<void(Model::TerminateInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TerminateInstancesAsync(request, [complete](const EC2Client*, const Model::TerminateInstancesRequest&, const Model::TerminateInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TerminateInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Unassigns one or more secondary private IP addresses from a network
          * interface.</p>
@@ -8610,6 +14029,28 @@ namespace Model
          */
         virtual void UnassignPrivateIpAddressesAsync(const Model::UnassignPrivateIpAddressesRequest& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Unassigns one or more secondary private IP addresses from a network
+         * interface.</p>
+         *
+         * Returns an awaitable that starts the operation the way UnassignPrivateIpAddressesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UnassignPrivateIpAddressesRequest>
+        Aws::Utils::Threading::Awaitable<Model::UnassignPrivateIpAddressesOutcome> UnassignPrivateIpAddressesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UnassignPrivateIpAddressesOutcome>([this, request](const std::function<void(Model::UnassignPrivateIpAddressesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UnassignPrivateIpAddressesAsync(request, [complete](const EC2Client*, const Model::UnassignPrivateIpAddressesRequest&, const Model::UnassignPrivateIpAddressesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UnassignPrivateIpAddressesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables monitoring for a running instance. For more information about
          * monitoring instances, see <a
@@ -8641,6 +14082,31 @@ namespace Model
          */
         virtual void UnmonitorInstancesAsync(const Model::UnmonitorInstancesRequest& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables monitoring for a running instance. For more information about
+         * monitoring instances, see <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/using-cloudwatch.html">Monitoring
+         * Your Instances and Volumes</a> in the <i>Amazon Elastic Compute Cloud User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UnmonitorInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UnmonitorInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::UnmonitorInstancesOutcome> UnmonitorInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UnmonitorInstancesOutcome>([this, request](const std::function<void(Model::UnmonitorInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UnmonitorInstancesAsync(request, [complete](const EC2Client*, const Model::UnmonitorInstancesRequest&, const Model::UnmonitorInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UnmonitorInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -37,6 +37,7 @@
 #include <aws/ecr/model/SetRepositoryPolicyResult.h>
 #include <aws/ecr/model/UploadLayerPartResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -215,6 +216,30 @@ namespace Model
          */
         virtual void BatchCheckLayerAvailabilityAsync(const Model::BatchCheckLayerAvailabilityRequest& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Check the availability of multiple image layers in a specified registry and
+         * repository.</p> <note> <p>This operation is used by the Amazon ECR proxy, and it
+         * is not intended for general use by customers. Use the <code>docker</code> CLI to
+         * pull, tag, and push images.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way BatchCheckLayerAvailabilityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchCheckLayerAvailabilityRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchCheckLayerAvailabilityOutcome> BatchCheckLayerAvailabilityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchCheckLayerAvailabilityOutcome>([this, request](const std::function<void(Model::BatchCheckLayerAvailabilityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchCheckLayerAvailabilityAsync(request, [complete](const ECRClient*, const Model::BatchCheckLayerAvailabilityRequest&, const Model::BatchCheckLayerAvailabilityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchCheckLayerAvailabilityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a list of specified images within a specified repository. Images are
          * specified with either <code>imageTag</code> or <code>imageDigest</code>.</p>
@@ -237,6 +262,28 @@ namespace Model
          */
         virtual void BatchDeleteImageAsync(const Model::BatchDeleteImageRequest& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a list of specified images within a specified repository. Images are
+         * specified with either <code>imageTag</code> or <code>imageDigest</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way BatchDeleteImageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchDeleteImageRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchDeleteImageOutcome> BatchDeleteImageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchDeleteImageOutcome>([this, request](const std::function<void(Model::BatchDeleteImageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchDeleteImageAsync(request, [complete](const ECRClient*, const Model::BatchDeleteImageRequest&, const Model::BatchDeleteImageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchDeleteImageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets detailed information for specified images within a specified repository.
          * Images are specified with either <code>imageTag</code> or
@@ -262,6 +309,29 @@ namespace Model
          */
         virtual void BatchGetImageAsync(const Model::BatchGetImageRequest& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets detailed information for specified images within a specified repository.
+         * Images are specified with either <code>imageTag</code> or
+         * <code>imageDigest</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way BatchGetImageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchGetImageRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchGetImageOutcome> BatchGetImageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchGetImageOutcome>([this, request](const std::function<void(Model::BatchGetImageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchGetImageAsync(request, [complete](const ECRClient*, const Model::BatchGetImageRequest&, const Model::BatchGetImageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchGetImageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Inform Amazon ECR that the image layer upload for a specified registry,
          * repository name, and upload ID, has completed. You can optionally provide a
@@ -296,6 +366,32 @@ namespace Model
          */
         virtual void CompleteLayerUploadAsync(const Model::CompleteLayerUploadRequest& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Inform Amazon ECR that the image layer upload for a specified registry,
+         * repository name, and upload ID, has completed. You can optionally provide a
+         * <code>sha256</code> digest of the image layer for data validation purposes.</p>
+         * <note> <p>This operation is used by the Amazon ECR proxy, and it is not intended
+         * for general use by customers. Use the <code>docker</code> CLI to pull, tag, and
+         * push images.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way CompleteLayerUploadAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CompleteLayerUploadRequest>
+        Aws::Utils::Threading::Awaitable<Model::CompleteLayerUploadOutcome> CompleteLayerUploadAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CompleteLayerUploadOutcome>([this, request](const std::function<void(Model::CompleteLayerUploadOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CompleteLayerUploadAsync(request, [complete](const ECRClient*, const Model::CompleteLayerUploadRequest&, const Model::CompleteLayerUploadOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CompleteLayerUploadOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an image repository.</p>
          */
@@ -315,6 +411,27 @@ namespace Model
          */
         virtual void CreateRepositoryAsync(const Model::CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an image repository.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateRepositoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateRepositoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateRepositoryOutcome> CreateRepositoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateRepositoryOutcome>([this, request](const std::function<void(Model::CreateRepositoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateRepositoryAsync(request, [complete](const ECRClient*, const Model::CreateRepositoryRequest&, const Model::CreateRepositoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateRepositoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an existing image repository. If a repository contains images, you
          * must use the <code>force</code> option to delete it.</p>
@@ -337,6 +454,28 @@ namespace Model
          */
         virtual void DeleteRepositoryAsync(const Model::DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an existing image repository. If a repository contains images, you
+         * must use the <code>force</code> option to delete it.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRepositoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRepositoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRepositoryOutcome> DeleteRepositoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRepositoryOutcome>([this, request](const std::function<void(Model::DeleteRepositoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRepositoryAsync(request, [complete](const ECRClient*, const Model::DeleteRepositoryRequest&, const Model::DeleteRepositoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRepositoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the repository policy from a specified repository.</p>
          */
@@ -356,6 +495,27 @@ namespace Model
          */
         virtual void DeleteRepositoryPolicyAsync(const Model::DeleteRepositoryPolicyRequest& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the repository policy from a specified repository.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRepositoryPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRepositoryPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRepositoryPolicyOutcome> DeleteRepositoryPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRepositoryPolicyOutcome>([this, request](const std::function<void(Model::DeleteRepositoryPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRepositoryPolicyAsync(request, [complete](const ECRClient*, const Model::DeleteRepositoryPolicyRequest&, const Model::DeleteRepositoryPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRepositoryPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes image repositories in a registry.</p>
          */
@@ -375,6 +535,27 @@ namespace Model
          */
         virtual void DescribeRepositoriesAsync(const Model::DescribeRepositoriesRequest& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes image repositories in a registry.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeRepositoriesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeRepositoriesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeRepositoriesOutcome> DescribeRepositoriesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeRepositoriesOutcome>([this, request](const std::function<void(Model::DescribeRepositoriesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeRepositoriesAsync(request, [complete](const ECRClient*, const Model::DescribeRepositoriesRequest&, const Model::DescribeRepositoriesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeRepositoriesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves a token that is valid for a specified registry for 12 hours. This
          * command allows you to use the <code>docker</code> CLI to push and pull images
@@ -415,6 +596,34 @@ namespace Model
          */
         virtual void GetAuthorizationTokenAsync(const Model::GetAuthorizationTokenRequest& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves a token that is valid for a specified registry for 12 hours. This
+         * command allows you to use the <code>docker</code> CLI to push and pull images
+         * with Amazon ECR. If you do not specify a registry, the default registry is
+         * assumed.</p> <p>The <code>authorizationToken</code> returned for each registry
+         * specified is a base64 encoded string that can be decoded and used in a
+         * <code>docker login</code> command to authenticate to a registry. The AWS CLI
+         * offers an <code>aws ecr get-login</code> command that simplifies the login
+         * process.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetAuthorizationTokenAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAuthorizationTokenRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAuthorizationTokenOutcome> GetAuthorizationTokenAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAuthorizationTokenOutcome>([this, request](const std::function<void(Model::GetAuthorizationTokenOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAuthorizationTokenAsync(request, [complete](const ECRClient*, const Model::GetAuthorizationTokenRequest&, const Model::GetAuthorizationTokenOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAuthorizationTokenOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the pre-signed Amazon S3 download URL corresponding to an image
          * layer. You can only get URLs for image layers that are referenced in an
@@ -446,6 +655,31 @@ namespace Model
          */
         virtual void GetDownloadUrlForLayerAsync(const Model::GetDownloadUrlForLayerRequest& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the pre-signed Amazon S3 download URL corresponding to an image
+         * layer. You can only get URLs for image layers that are referenced in an
+         * image.</p> <note> <p>This operation is used by the Amazon ECR proxy, and it is
+         * not intended for general use by customers. Use the <code>docker</code> CLI to
+         * pull, tag, and push images.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way GetDownloadUrlForLayerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDownloadUrlForLayerRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDownloadUrlForLayerOutcome> GetDownloadUrlForLayerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDownloadUrlForLayerOutcome>([this, request](const std::function<void(Model::GetDownloadUrlForLayerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDownloadUrlForLayerAsync(request, [complete](const ECRClient*, const Model::GetDownloadUrlForLayerRequest&, const Model::GetDownloadUrlForLayerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDownloadUrlForLayerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the repository policy for a specified repository.</p>
          */
@@ -465,6 +699,27 @@ namespace Model
          */
         virtual void GetRepositoryPolicyAsync(const Model::GetRepositoryPolicyRequest& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the repository policy for a specified repository.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetRepositoryPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetRepositoryPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetRepositoryPolicyOutcome> GetRepositoryPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetRepositoryPolicyOutcome>([this, request](const std::function<void(Model::GetRepositoryPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetRepositoryPolicyAsync(request, [complete](const ECRClient*, const Model::GetRepositoryPolicyRequest&, const Model::GetRepositoryPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetRepositoryPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Notify Amazon ECR that you intend to upload an image layer. </p> <note>
          * <p>This operation is used by the Amazon ECR proxy, and it is not intended for
@@ -493,6 +748,30 @@ namespace Model
          */
         virtual void InitiateLayerUploadAsync(const Model::InitiateLayerUploadRequest& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Notify Amazon ECR that you intend to upload an image layer. </p> <note>
+         * <p>This operation is used by the Amazon ECR proxy, and it is not intended for
+         * general use by customers. Use the <code>docker</code> CLI to pull, tag, and push
+         * images.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way InitiateLayerUploadAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::InitiateLayerUploadRequest>
+        Aws::Utils::Threading::Awaitable<Model::InitiateLayerUploadOutcome> InitiateLayerUploadAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::InitiateLayerUploadOutcome>([this, request](const std::function<void(Model::InitiateLayerUploadOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->InitiateLayerUploadAsync(request, [complete](const ECRClient*, const Model::InitiateLayerUploadRequest&, const Model::InitiateLayerUploadOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::InitiateLayerUploadOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all the image IDs for a given repository.</p>
          */
@@ -512,6 +791,27 @@ namespace Model
          */
         virtual void ListImagesAsync(const Model::ListImagesRequest& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all the image IDs for a given repository.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListImagesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListImagesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListImagesOutcome> ListImagesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListImagesOutcome>([this, request](const std::function<void(Model::ListImagesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListImagesAsync(request, [complete](const ECRClient*, const Model::ListImagesRequest&, const Model::ListImagesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListImagesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates or updates the image manifest associated with an image.</p> <note>
          * <p>This operation is used by the Amazon ECR proxy, and it is not intended for
@@ -540,6 +840,30 @@ namespace Model
          */
         virtual void PutImageAsync(const Model::PutImageRequest& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates or updates the image manifest associated with an image.</p> <note>
+         * <p>This operation is used by the Amazon ECR proxy, and it is not intended for
+         * general use by customers. Use the <code>docker</code> CLI to pull, tag, and push
+         * images.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way PutImageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutImageRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutImageOutcome> PutImageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutImageOutcome>([this, request](const std::function<void(Model::PutImageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutImageAsync(request, [complete](const ECRClient*, const Model::PutImageRequest&, const Model::PutImageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutImageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Applies a repository policy on a specified repository to control access
          * permissions.</p>
@@ -562,6 +886,28 @@ namespace Model
          */
         virtual void SetRepositoryPolicyAsync(const Model::SetRepositoryPolicyRequest& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Applies a repository policy on a specified repository to control access
+         * permissions.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetRepositoryPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetRepositoryPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetRepositoryPolicyOutcome> SetRepositoryPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetRepositoryPolicyOutcome>([this, request](const std::function<void(Model::SetRepositoryPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetRepositoryPolicyAsync(request, [complete](const ECRClient*, const Model::SetRepositoryPolicyRequest&, const Model::SetRepositoryPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetRepositoryPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Uploads an image layer part to Amazon ECR.</p> <note> <p>This operation is
          * used by the Amazon ECR proxy, and it is not intended for general use by
@@ -590,6 +936,30 @@ namespace Model
          */
         virtual void UploadLayerPartAsync(const Model::UploadLayerPartRequest& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Uploads an image layer part to Amazon ECR.</p> <note> <p>This operation is
+         * used by the Amazon ECR proxy, and it is not intended for general use by
+         * customers. Use the <code>docker</code> CLI to pull, tag, and push images.</p>
+         * </note>
+         *
+         * Returns an awaitable that starts the operation the way UploadLayerPartAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UploadLayerPartRequest>
+        Aws::Utils::Threading::Awaitable<Model::UploadLayerPartOutcome> UploadLayerPartAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UploadLayerPartOutcome>([this, request](const std::function<void(Model::UploadLayerPartOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UploadLayerPartAsync(request, [complete](const ECRClient*, const Model::UploadLayerPartRequest&, const Model::UploadLayerPartOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UploadLayerPartOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
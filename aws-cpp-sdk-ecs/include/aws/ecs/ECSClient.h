@@ -48,6 +48,7 @@
 #include <aws/ecs/model/UpdateContainerAgentResult.h>
 #include <aws/ecs/model/UpdateServiceResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -275,6 +276,30 @@ namespace Model
          */
         virtual void CreateClusterAsync(const Model::CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new Amazon ECS cluster. By default, your account receives a
+         * <code>default</code> cluster when you launch your first container instance.
+         * However, you can create your own cluster with a unique name with the
+         * <code>CreateCluster</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateClusterOutcome> CreateClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateClusterOutcome>([this, request](const std::function<void(Model::CreateClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateClusterAsync(request, [complete](const ECSClient*, const Model::CreateClusterRequest&, const Model::CreateClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Runs and maintains a desired number of tasks from a specified task
          * definition. If the number of tasks running in a service drops below
@@ -405,6 +430,64 @@ namespace Model
          */
         virtual void CreateServiceAsync(const Model::CreateServiceRequest& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Runs and maintains a desired number of tasks from a specified task
+         * definition. If the number of tasks running in a service drops below
+         * <code>desiredCount</code>, Amazon ECS spawns another instantiation of the task
+         * in the specified cluster. To update an existing service, see
+         * <a>UpdateService</a>.</p> <p>You can optionally specify a deployment
+         * configuration for your service. During a deployment (which is triggered by
+         * changing the task definition of a service with an <a>UpdateService</a>
+         * operation), the service scheduler uses the <code>minimumHealthyPercent</code>
+         * and <code>maximumPercent</code> parameters to determine the deployment
+         * strategy.</p> <p>If the <code>minimumHealthyPercent</code> is below 100%, the
+         * scheduler can ignore the <code>desiredCount</code> temporarily during a
+         * deployment. For example, if your service has a <code>desiredCount</code> of four
+         * tasks, a <code>minimumHealthyPercent</code> of 50% allows the scheduler to stop
+         * two existing tasks before starting two new tasks. Tasks for services that <i>do
+         * not</i> use a load balancer are considered healthy if they are in the
+         * <code>RUNNING</code> state; tasks for services that <i>do</i> use a load
+         * balancer are considered healthy if they are in the <code>RUNNING</code> state
+         * and the container instance it is hosted on is reported as healthy by the load
+         * balancer. The default value for <code>minimumHealthyPercent</code> is 50% in the
+         * console and 100% for the AWS CLI, the AWS SDKs, and the APIs.</p> <p>The
+         * <code>maximumPercent</code> parameter represents an upper limit on the number of
+         * running tasks during a deployment, which enables you to define the deployment
+         * batch size. For example, if your service has a <code>desiredCount</code> of four
+         * tasks, a <code>maximumPercent</code> value of 200% starts four new tasks before
+         * stopping the four older tasks (provided that the cluster resources required to
+         * do this are available). The default value for <code>maximumPercent</code> is
+         * 200%.</p> <p>When the service scheduler launches new tasks, it attempts to
+         * balance them across the Availability Zones in your cluster with the following
+         * logic:</p> <ul> <li> <p>Determine which of the container instances in your
+         * cluster can support your service's task definition (for example, they have the
+         * required CPU, memory, ports, and container instance attributes).</p> </li> <li>
+         * <p>Sort the valid container instances by the fewest number of running tasks for
+         * this service in the same Availability Zone as the instance. For example, if zone
+         * A has one running service task and zones B and C each have zero, valid container
+         * instances in either zone B or C are considered optimal for placement.</p> </li>
+         * <li> <p>Place the new service task on a valid container instance in an optimal
+         * Availability Zone (based on the previous steps), favoring container instances
+         * with the fewest number of running tasks for this service.</p> </li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way CreateServiceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateServiceRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateServiceOutcome> CreateServiceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateServiceOutcome>([this, request](const std::function<void(Model::CreateServiceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateServiceAsync(request, [complete](const ECSClient*, const Model::CreateServiceRequest&, const Model::CreateServiceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateServiceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified cluster. You must deregister all container instances
          * from this cluster before you may delete it. You can list the container instances
@@ -433,6 +516,30 @@ namespace Model
          */
         virtual void DeleteClusterAsync(const Model::DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified cluster. You must deregister all container instances
+         * from this cluster before you may delete it. You can list the container instances
+         * in a cluster with <a>ListContainerInstances</a> and deregister them with
+         * <a>DeregisterContainerInstance</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteClusterOutcome> DeleteClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteClusterOutcome>([this, request](const std::function<void(Model::DeleteClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteClusterAsync(request, [complete](const ECSClient*, const Model::DeleteClusterRequest&, const Model::DeleteClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a specified service within a cluster. You can delete a service if you
          * have no running tasks in it and the desired task count is zero. If the service
@@ -494,6 +601,41 @@ namespace Model
          */
         virtual void DeleteServiceAsync(const Model::DeleteServiceRequest& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a specified service within a cluster. You can delete a service if you
+         * have no running tasks in it and the desired task count is zero. If the service
+         * is actively maintaining tasks, you cannot delete it, and you must update the
+         * service to a desired task count of zero. For more information, see
+         * <a>UpdateService</a>.</p> <note> <p>When you delete a service, if there are
+         * still running tasks that require cleanup, the service status moves from
+         * <code>ACTIVE</code> to <code>DRAINING</code>, and the service is no longer
+         * visible in the console or in <a>ListServices</a> API operations. After the tasks
+         * have stopped, then the service status moves from <code>DRAINING</code> to
+         * <code>INACTIVE</code>. Services in the <code>DRAINING</code> or
+         * <code>INACTIVE</code> status can still be viewed with <a>DescribeServices</a>
+         * API operations; however, in the future, <code>INACTIVE</code> services may be
+         * cleaned up and purged from Amazon ECS record keeping, and
+         * <a>DescribeServices</a> API operations on those services will return a
+         * <code>ServiceNotFoundException</code> error.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteServiceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteServiceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteServiceOutcome> DeleteServiceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteServiceOutcome>([this, request](const std::function<void(Model::DeleteServiceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteServiceAsync(request, [complete](const ECSClient*, const Model::DeleteServiceRequest&, const Model::DeleteServiceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteServiceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deregisters an Amazon ECS container instance from the specified cluster. This
          * instance is no longer available to run tasks.</p> <p>If you intend to use the
@@ -540,6 +682,36 @@ namespace Model
          */
         virtual void DeregisterContainerInstanceAsync(const Model::DeregisterContainerInstanceRequest& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deregisters an Amazon ECS container instance from the specified cluster. This
+         * instance is no longer available to run tasks.</p> <p>If you intend to use the
+         * container instance for some other purpose after deregistration, you should stop
+         * all of the tasks running on the container instance before deregistration to
+         * avoid any orphaned tasks from consuming resources.</p> <p>Deregistering a
+         * container instance removes the instance from a cluster, but it does not
+         * terminate the EC2 instance; if you are finished using the instance, be sure to
+         * terminate it in the Amazon EC2 console to stop billing.</p> <note><p>When you
+         * terminate a container instance, it is automatically deregistered from your
+         * cluster.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterContainerInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterContainerInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterContainerInstanceOutcome> DeregisterContainerInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterContainerInstanceOutcome>([this, request](const std::function<void(Model::DeregisterContainerInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterContainerInstanceAsync(request, [complete](const ECSClient*, const Model::DeregisterContainerInstanceRequest&, const Model::DeregisterContainerInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterContainerInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deregisters the specified task definition by family and revision. Upon
          * deregistration, the task definition is marked as <code>INACTIVE</code>. Existing
@@ -586,6 +758,36 @@ namespace Model
          */
         virtual void DeregisterTaskDefinitionAsync(const Model::DeregisterTaskDefinitionRequest& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deregisters the specified task definition by family and revision. Upon
+         * deregistration, the task definition is marked as <code>INACTIVE</code>. Existing
+         * tasks and services that reference an <code>INACTIVE</code> task definition
+         * continue to run without disruption. Existing services that reference an
+         * <code>INACTIVE</code> task definition can still scale up or down by modifying
+         * the service's desired count.</p> <p>You cannot use an <code>INACTIVE</code> task
+         * definition to run new tasks or create new services, and you cannot update an
+         * existing service to reference an <code>INACTIVE</code> task definition (although
+         * there may be up to a 10 minute window following deregistration where these
+         * restrictions have not yet taken effect).</p>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterTaskDefinitionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterTaskDefinitionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterTaskDefinitionOutcome> DeregisterTaskDefinitionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterTaskDefinitionOutcome>([this, request](const std::function<void(Model::DeregisterTaskDefinitionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterTaskDefinitionAsync(request, [complete](const ECSClient*, const Model::DeregisterTaskDefinitionRequest&, const Model::DeregisterTaskDefinitionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterTaskDefinitionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your clusters.</p>
          */
@@ -605,6 +807,27 @@ namespace Model
          */
         virtual void DescribeClustersAsync(const Model::DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your clusters.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeClustersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeClustersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeClustersOutcome> DescribeClustersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeClustersOutcome>([this, request](const std::function<void(Model::DescribeClustersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeClustersAsync(request, [complete](const ECSClient*, const Model::DescribeClustersRequest&, const Model::DescribeClustersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeClustersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes Amazon EC2 Container Service container instances. Returns metadata
          * about registered and remaining resources on each container instance
@@ -630,6 +853,29 @@ namespace Model
          */
         virtual void DescribeContainerInstancesAsync(const Model::DescribeContainerInstancesRequest& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes Amazon EC2 Container Service container instances. Returns metadata
+         * about registered and remaining resources on each container instance
+         * requested.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeContainerInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeContainerInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeContainerInstancesOutcome> DescribeContainerInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeContainerInstancesOutcome>([this, request](const std::function<void(Model::DescribeContainerInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeContainerInstancesAsync(request, [complete](const ECSClient*, const Model::DescribeContainerInstancesRequest&, const Model::DescribeContainerInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeContainerInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified services running in your cluster.</p>
          */
@@ -649,6 +895,27 @@ namespace Model
          */
         virtual void DescribeServicesAsync(const Model::DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified services running in your cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeServicesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeServicesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeServicesOutcome> DescribeServicesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeServicesOutcome>([this, request](const std::function<void(Model::DescribeServicesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeServicesAsync(request, [complete](const ECSClient*, const Model::DescribeServicesRequest&, const Model::DescribeServicesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeServicesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes a task definition. You can specify a <code>family</code> and
          * <code>revision</code> to find information about a specific task definition, or
@@ -683,6 +950,32 @@ namespace Model
          */
         virtual void DescribeTaskDefinitionAsync(const Model::DescribeTaskDefinitionRequest& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes a task definition. You can specify a <code>family</code> and
+         * <code>revision</code> to find information about a specific task definition, or
+         * you can simply specify the family to find the latest <code>ACTIVE</code>
+         * revision in that family.</p> <note> <p>You can only describe
+         * <code>INACTIVE</code> task definitions while an active task or service
+         * references them.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTaskDefinitionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTaskDefinitionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTaskDefinitionOutcome> DescribeTaskDefinitionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTaskDefinitionOutcome>([this, request](const std::function<void(Model::DescribeTaskDefinitionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTaskDefinitionAsync(request, [complete](const ECSClient*, const Model::DescribeTaskDefinitionRequest&, const Model::DescribeTaskDefinitionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTaskDefinitionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes a specified task or tasks.</p>
          */
@@ -702,6 +995,27 @@ namespace Model
          */
         virtual void DescribeTasksAsync(const Model::DescribeTasksRequest& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes a specified task or tasks.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTasksOutcome> DescribeTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTasksOutcome>([this, request](const std::function<void(Model::DescribeTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTasksAsync(request, [complete](const ECSClient*, const Model::DescribeTasksRequest&, const Model::DescribeTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Returns an
@@ -727,6 +1041,29 @@ namespace Model
          */
         virtual void DiscoverPollEndpointAsync(const Model::DiscoverPollEndpointRequest& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
+         * it is not intended for use outside of the agent.</p></note> <p>Returns an
+         * endpoint for the Amazon EC2 Container Service agent to poll for updates.</p>
+         *
+         * Returns an awaitable that starts the operation the way DiscoverPollEndpointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DiscoverPollEndpointRequest>
+        Aws::Utils::Threading::Awaitable<Model::DiscoverPollEndpointOutcome> DiscoverPollEndpointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DiscoverPollEndpointOutcome>([this, request](const std::function<void(Model::DiscoverPollEndpointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DiscoverPollEndpointAsync(request, [complete](const ECSClient*, const Model::DiscoverPollEndpointRequest&, const Model::DiscoverPollEndpointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DiscoverPollEndpointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of existing clusters.</p>
          */
@@ -746,6 +1083,27 @@ namespace Model
          */
         virtual void ListClustersAsync(const Model::ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of existing clusters.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListClustersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListClustersRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListClustersOutcome> ListClustersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListClustersOutcome>([this, request](const std::function<void(Model::ListClustersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListClustersAsync(request, [complete](const ECSClient*, const Model::ListClustersRequest&, const Model::ListClustersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListClustersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of container instances in a specified cluster.</p>
          */
@@ -765,6 +1123,27 @@ namespace Model
          */
         virtual void ListContainerInstancesAsync(const Model::ListContainerInstancesRequest& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of container instances in a specified cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListContainerInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListContainerInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListContainerInstancesOutcome> ListContainerInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListContainerInstancesOutcome>([this, request](const std::function<void(Model::ListContainerInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListContainerInstancesAsync(request, [complete](const ECSClient*, const Model::ListContainerInstancesRequest&, const Model::ListContainerInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListContainerInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the services that are running in a specified cluster.</p>
          */
@@ -784,6 +1163,27 @@ namespace Model
          */
         virtual void ListServicesAsync(const Model::ListServicesRequest& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the services that are running in a specified cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListServicesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListServicesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListServicesOutcome> ListServicesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListServicesOutcome>([this, request](const std::function<void(Model::ListServicesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListServicesAsync(request, [complete](const ECSClient*, const Model::ListServicesRequest&, const Model::ListServicesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListServicesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of task definition families that are registered to your
          * account (which may include task definition families that no longer have any
@@ -812,6 +1212,30 @@ namespace Model
          */
         virtual void ListTaskDefinitionFamiliesAsync(const Model::ListTaskDefinitionFamiliesRequest& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of task definition families that are registered to your
+         * account (which may include task definition families that no longer have any
+         * <code>ACTIVE</code> task definitions). You can filter the results with the
+         * <code>familyPrefix</code> parameter.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTaskDefinitionFamiliesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTaskDefinitionFamiliesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTaskDefinitionFamiliesOutcome> ListTaskDefinitionFamiliesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTaskDefinitionFamiliesOutcome>([this, request](const std::function<void(Model::ListTaskDefinitionFamiliesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTaskDefinitionFamiliesAsync(request, [complete](const ECSClient*, const Model::ListTaskDefinitionFamiliesRequest&, const Model::ListTaskDefinitionFamiliesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTaskDefinitionFamiliesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of task definitions that are registered to your account. You
          * can filter the results by family name with the <code>familyPrefix</code>
@@ -837,6 +1261,29 @@ namespace Model
          */
         virtual void ListTaskDefinitionsAsync(const Model::ListTaskDefinitionsRequest& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of task definitions that are registered to your account. You
+         * can filter the results by family name with the <code>familyPrefix</code>
+         * parameter or by status with the <code>status</code> parameter.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTaskDefinitionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTaskDefinitionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTaskDefinitionsOutcome> ListTaskDefinitionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTaskDefinitionsOutcome>([this, request](const std::function<void(Model::ListTaskDefinitionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTaskDefinitionsAsync(request, [complete](const ECSClient*, const Model::ListTaskDefinitionsRequest&, const Model::ListTaskDefinitionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTaskDefinitionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of tasks for a specified cluster. You can filter the results
          * by family name, by a particular container instance, or by the desired status of
@@ -865,6 +1312,30 @@ namespace Model
          */
         virtual void ListTasksAsync(const Model::ListTasksRequest& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of tasks for a specified cluster. You can filter the results
+         * by family name, by a particular container instance, or by the desired status of
+         * the task with the <code>family</code>, <code>containerInstance</code>, and
+         * <code>desiredStatus</code> parameters.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTasksOutcome> ListTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTasksOutcome>([this, request](const std::function<void(Model::ListTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTasksAsync(request, [complete](const ECSClient*, const Model::ListTasksRequest&, const Model::ListTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Registers an EC2
@@ -893,6 +1364,30 @@ namespace Model
          */
         virtual void RegisterContainerInstanceAsync(const Model::RegisterContainerInstanceRequest& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
+         * it is not intended for use outside of the agent.</p></note> <p>Registers an EC2
+         * instance into the specified cluster. This instance becomes available to place
+         * containers on.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterContainerInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterContainerInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterContainerInstanceOutcome> RegisterContainerInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterContainerInstanceOutcome>([this, request](const std::function<void(Model::RegisterContainerInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterContainerInstanceAsync(request, [complete](const ECSClient*, const Model::RegisterContainerInstanceRequest&, const Model::RegisterContainerInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterContainerInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers a new task definition from the supplied <code>family</code> and
          * <code>containerDefinitions</code>. Optionally, you can add data volumes to your
@@ -930,6 +1425,33 @@ namespace Model
          */
         virtual void RegisterTaskDefinitionAsync(const Model::RegisterTaskDefinitionRequest& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers a new task definition from the supplied <code>family</code> and
+         * <code>containerDefinitions</code>. Optionally, you can add data volumes to your
+         * containers with the <code>volumes</code> parameter. For more information about
+         * task definition parameters and defaults, see <a
+         * href="http://docs.aws.amazon.com/AmazonECS/latest/developerguide/task_defintions.html">Amazon
+         * ECS Task Definitions</a> in the <i>Amazon EC2 Container Service Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterTaskDefinitionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterTaskDefinitionRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterTaskDefinitionOutcome> RegisterTaskDefinitionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterTaskDefinitionOutcome>([this, request](const std::function<void(Model::RegisterTaskDefinitionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterTaskDefinitionAsync(request, [complete](const ECSClient*, const Model::RegisterTaskDefinitionRequest&, const Model::RegisterTaskDefinitionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterTaskDefinitionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Start a task using random placement and the default Amazon ECS scheduler. To
          * use your own scheduler or place a task on a specific container instance, use
@@ -958,6 +1480,30 @@ namespace Model
          */
         virtual void RunTaskAsync(const Model::RunTaskRequest& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Start a task using random placement and the default Amazon ECS scheduler. To
+         * use your own scheduler or place a task on a specific container instance, use
+         * <code>StartTask</code> instead.</p> <important> <p>The <code>count</code>
+         * parameter is limited to 10 tasks per call.</p> </important>
+         *
+         * Returns an awaitable that starts the operation the way RunTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RunTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::RunTaskOutcome> RunTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RunTaskOutcome>([this, request](const std::function<void(Model::RunTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RunTaskAsync(request, [complete](const ECSClient*, const Model::RunTaskRequest&, const Model::RunTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RunTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts a new task from the specified task definition on the specified
          * container instance or instances. To use the default Amazon ECS scheduler to
@@ -986,6 +1532,30 @@ namespace Model
          */
         virtual void StartTaskAsync(const Model::StartTaskRequest& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts a new task from the specified task definition on the specified
+         * container instance or instances. To use the default Amazon ECS scheduler to
+         * place your task, use <code>RunTask</code> instead.</p> <important> <p>The list
+         * of container instances to start tasks on is limited to 10.</p> </important>
+         *
+         * Returns an awaitable that starts the operation the way StartTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartTaskOutcome> StartTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartTaskOutcome>([this, request](const std::function<void(Model::StartTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartTaskAsync(request, [complete](const ECSClient*, const Model::StartTaskRequest&, const Model::StartTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Stops a running task.</p> <p>When <a>StopTask</a> is called on a task, the
          * equivalent of <code>docker stop</code> is issued to the containers running in
@@ -1020,6 +1590,32 @@ namespace Model
          */
         virtual void StopTaskAsync(const Model::StopTaskRequest& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Stops a running task.</p> <p>When <a>StopTask</a> is called on a task, the
+         * equivalent of <code>docker stop</code> is issued to the containers running in
+         * the task. This results in a <code>SIGTERM</code> and a 30-second timeout, after
+         * which <code>SIGKILL</code> is sent and the containers are forcibly stopped. If
+         * the container handles the <code>SIGTERM</code> gracefully and exits within 30
+         * seconds from receiving it, no <code>SIGKILL</code> is sent.</p>
+         *
+         * Returns an awaitable that starts the operation the way StopTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StopTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::StopTaskOutcome> StopTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StopTaskOutcome>([this, request](const std::function<void(Model::StopTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StopTaskAsync(request, [complete](const ECSClient*, const Model::StopTaskRequest&, const Model::StopTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StopTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Sent to
@@ -1045,6 +1641,29 @@ namespace Model
          */
         virtual void SubmitContainerStateChangeAsync(const Model::SubmitContainerStateChangeRequest& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
+         * it is not intended for use outside of the agent.</p></note> <p>Sent to
+         * acknowledge that a container changed states.</p>
+         *
+         * Returns an awaitable that starts the operation the way SubmitContainerStateChangeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SubmitContainerStateChangeRequest>
+        Aws::Utils::Threading::Awaitable<Model::SubmitContainerStateChangeOutcome> SubmitContainerStateChangeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SubmitContainerStateChangeOutcome>([this, request](const std::function<void(Model::SubmitContainerStateChangeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SubmitContainerStateChangeAsync(request, [complete](const ECSClient*, const Model::SubmitContainerStateChangeRequest&, const Model::SubmitContainerStateChangeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SubmitContainerStateChangeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Sent to
@@ -1070,6 +1689,29 @@ namespace Model
          */
         virtual void SubmitTaskStateChangeAsync(const Model::SubmitTaskStateChangeRequest& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
+         * it is not intended for use outside of the agent.</p></note> <p>Sent to
+         * acknowledge that a task changed states.</p>
+         *
+         * Returns an awaitable that starts the operation the way SubmitTaskStateChangeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SubmitTaskStateChangeRequest>
+        Aws::Utils::Threading::Awaitable<Model::SubmitTaskStateChangeOutcome> SubmitTaskStateChangeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SubmitTaskStateChangeOutcome>([this, request](const std::function<void(Model::SubmitTaskStateChangeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SubmitTaskStateChangeAsync(request, [complete](const ECSClient*, const Model::SubmitTaskStateChangeRequest&, const Model::SubmitTaskStateChangeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SubmitTaskStateChangeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the Amazon ECS container agent on a specified container instance.
          * Updating the Amazon ECS container agent does not interrupt running tasks or
@@ -1119,6 +1761,37 @@ namespace Model
          */
         virtual void UpdateContainerAgentAsync(const Model::UpdateContainerAgentRequest& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the Amazon ECS container agent on a specified container instance.
+         * Updating the Amazon ECS container agent does not interrupt running tasks or
+         * services on the container instance. The process for updating the agent differs
+         * depending on whether your container instance was launched with the Amazon
+         * ECS-optimized AMI or another operating system.</p>
+         * <p><code>UpdateContainerAgent</code> requires the Amazon ECS-optimized AMI or
+         * Amazon Linux with the <code>ecs-init</code> service installed and running. For
+         * help updating the Amazon ECS container agent on other operating systems, see <a
+         * href="http://docs.aws.amazon.com/AmazonECS/latest/developerguide/ecs-agent-update.html#manually_update_agent">Manually
+         * Updating the Amazon ECS Container Agent</a> in the <i>Amazon EC2 Container
+         * Service Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateContainerAgentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateContainerAgentRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateContainerAgentOutcome> UpdateContainerAgentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateContainerAgentOutcome>([this, request](const std::function<void(Model::UpdateContainerAgentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateContainerAgentAsync(request, [complete](const ECSClient*, const Model::UpdateContainerAgentRequest&, const Model::UpdateContainerAgentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateContainerAgentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the desired count, deployment configuration, or task definition used
          * in a service.</p> <p>You can add to or subtract from the number of
@@ -1264,6 +1937,69 @@ namespace Model
          */
         virtual void UpdateServiceAsync(const Model::UpdateServiceRequest& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the desired count, deployment configuration, or task definition used
+         * in a service.</p> <p>You can add to or subtract from the number of
+         * instantiations of a task definition in a service by specifying the cluster that
+         * the service is running in and a new <code>desiredCount</code> parameter.</p>
+         * <p>You can use <a>UpdateService</a> to modify your task definition and deploy a
+         * new version of your service.</p> <p>You can also update the deployment
+         * configuration of a service. When a deployment is triggered by updating the task
+         * definition of a service, the service scheduler uses the deployment configuration
+         * parameters, <code>minimumHealthyPercent</code> and <code>maximumPercent</code>,
+         * to determine the deployment strategy.</p> <p>If the
+         * <code>minimumHealthyPercent</code> is below 100%, the scheduler can ignore the
+         * <code>desiredCount</code> temporarily during a deployment. For example, if your
+         * service has a <code>desiredCount</code> of four tasks, a
+         * <code>minimumHealthyPercent</code> of 50% allows the scheduler to stop two
+         * existing tasks before starting two new tasks. Tasks for services that <i>do
+         * not</i> use a load balancer are considered healthy if they are in the
+         * <code>RUNNING</code> state; tasks for services that <i>do</i> use a load
+         * balancer are considered healthy if they are in the <code>RUNNING</code> state
+         * and the container instance it is hosted on is reported as healthy by the load
+         * balancer.</p> <p>The <code>maximumPercent</code> parameter represents an upper
+         * limit on the number of running tasks during a deployment, which enables you to
+         * define the deployment batch size. For example, if your service has a
+         * <code>desiredCount</code> of four tasks, a <code>maximumPercent</code> value of
+         * 200% starts four new tasks before stopping the four older tasks (provided that
+         * the cluster resources required to do this are available).</p> <p>When
+         * <a>UpdateService</a> stops a task during a deployment, the equivalent of
+         * <code>docker stop</code> is issued to the containers running in the task. This
+         * results in a <code>SIGTERM</code> and a 30-second timeout, after which
+         * <code>SIGKILL</code> is sent and the containers are forcibly stopped. If the
+         * container handles the <code>SIGTERM</code> gracefully and exits within 30
+         * seconds from receiving it, no <code>SIGKILL</code> is sent.</p> <p>When the
+         * service scheduler launches new tasks, it attempts to balance them across the
+         * Availability Zones in your cluster with the following logic:</p> <ul> <li>
+         * <p>Determine which of the container instances in your cluster can support your
+         * service's task definition (for example, they have the required CPU, memory,
+         * ports, and container instance attributes).</p> </li> <li> <p>Sort the valid
+         * container instances by the fewest number of running tasks for this service in
+         * the same Availability Zone as the instance. For example, if zone A has one
+         * running service task and zones B and C each have zero, valid container instances
+         * in either zone B or C are considered optimal for placement.</p> </li> <li>
+         * <p>Place the new service task on a valid container instance in an optimal
+         * Availability Zone (based on the previous steps), favoring container instances
+         * with the fewest number of running tasks for this service.</p> </li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way UpdateServiceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateServiceRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateServiceOutcome> UpdateServiceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateServiceOutcome>([this, request](const std::function<void(Model::UpdateServiceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateServiceAsync(request, [complete](const ECSClient*, const Model::UpdateServiceRequest&, const Model::UpdateServiceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateServiceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
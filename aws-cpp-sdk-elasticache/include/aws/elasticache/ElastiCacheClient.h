@@ -57,6 +57,7 @@
 #include <aws/elasticache/model/RevokeCacheSecurityGroupIngressResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -347,6 +348,37 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>AddTagsToResource</i> action adds up to 10 cost allocation tags to the
+         * named resource. A <i>cost allocation tag</i> is a key-value pair where the key
+         * and value are case-sensitive. Cost allocation tags can be used to categorize and
+         * track your AWS costs.</p> <p> When you apply tags to your ElastiCache resources,
+         * AWS generates a cost allocation report as a comma-separated value (CSV) file
+         * with your usage and costs aggregated by your tags. You can apply tags that
+         * represent business categories (such as cost centers, application names, or
+         * owners) to organize your costs across multiple services. For more information,
+         * see <a
+         * href="http://docs.aws.amazon.com/AmazonElastiCache/latest/UserGuide/Tagging.html">Using
+         * Cost Allocation Tags in Amazon ElastiCache</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsToResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsToResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsToResourceOutcome>([this, request](const std::function<void(Model::AddTagsToResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsToResourceAsync(request, [complete](const ElastiCacheClient*, const Model::AddTagsToResourceRequest&, const Model::AddTagsToResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsToResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>AuthorizeCacheSecurityGroupIngress</i> action allows network ingress
          * to a cache security group. Applications using ElastiCache must be running on
@@ -378,6 +410,31 @@ namespace Model
          */
         virtual void AuthorizeCacheSecurityGroupIngressAsync(const Model::AuthorizeCacheSecurityGroupIngressRequest& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>AuthorizeCacheSecurityGroupIngress</i> action allows network ingress
+         * to a cache security group. Applications using ElastiCache must be running on
+         * Amazon EC2, and Amazon EC2 security groups are used as the authorization
+         * mechanism.</p> <note>You cannot authorize ingress from an Amazon EC2 security
+         * group in one region to an ElastiCache cluster in another region. </note>
+         *
+         * Returns an awaitable that starts the operation the way AuthorizeCacheSecurityGroupIngressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AuthorizeCacheSecurityGroupIngressRequest>
+        Aws::Utils::Threading::Awaitable<Model::AuthorizeCacheSecurityGroupIngressOutcome> AuthorizeCacheSecurityGroupIngressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AuthorizeCacheSecurityGroupIngressOutcome>([this, request](const std::function<void(Model::AuthorizeCacheSecurityGroupIngressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AuthorizeCacheSecurityGroupIngressAsync(request, [complete](const ElastiCacheClient*, const Model::AuthorizeCacheSecurityGroupIngressRequest&, const Model::AuthorizeCacheSecurityGroupIngressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AuthorizeCacheSecurityGroupIngressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>CopySnapshot</i> action makes a copy of an existing snapshot.</p>
          */
@@ -397,6 +454,27 @@ namespace Model
          */
         virtual void CopySnapshotAsync(const Model::CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>CopySnapshot</i> action makes a copy of an existing snapshot.</p>
+         *
+         * Returns an awaitable that starts the operation the way CopySnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CopySnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CopySnapshotOutcome> CopySnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CopySnapshotOutcome>([this, request](const std::function<void(Model::CopySnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CopySnapshotAsync(request, [complete](const ElastiCacheClient*, const Model::CopySnapshotRequest&, const Model::CopySnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CopySnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>CreateCacheCluster</i> action creates a cache cluster. All nodes in
          * the cache cluster run the same protocol-compliant cache engine software, either
@@ -422,6 +500,29 @@ namespace Model
          */
         virtual void CreateCacheClusterAsync(const Model::CreateCacheClusterRequest& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>CreateCacheCluster</i> action creates a cache cluster. All nodes in
+         * the cache cluster run the same protocol-compliant cache engine software, either
+         * Memcached or Redis.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateCacheClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateCacheClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateCacheClusterOutcome> CreateCacheClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateCacheClusterOutcome>([this, request](const std::function<void(Model::CreateCacheClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateCacheClusterAsync(request, [complete](const ElastiCacheClient*, const Model::CreateCacheClusterRequest&, const Model::CreateCacheClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateCacheClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>CreateCacheParameterGroup</i> action creates a new cache parameter
          * group. A cache parameter group is a collection of parameters that you apply to
@@ -447,6 +548,29 @@ namespace Model
          */
         virtual void CreateCacheParameterGroupAsync(const Model::CreateCacheParameterGroupRequest& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>CreateCacheParameterGroup</i> action creates a new cache parameter
+         * group. A cache parameter group is a collection of parameters that you apply to
+         * all of the nodes in a cache cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateCacheParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateCacheParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateCacheParameterGroupOutcome> CreateCacheParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateCacheParameterGroupOutcome>([this, request](const std::function<void(Model::CreateCacheParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateCacheParameterGroupAsync(request, [complete](const ElastiCacheClient*, const Model::CreateCacheParameterGroupRequest&, const Model::CreateCacheParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateCacheParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>CreateCacheSecurityGroup</i> action creates a new cache security
          * group. Use a cache security group to control access to one or more cache
@@ -484,6 +608,33 @@ namespace Model
          */
         virtual void CreateCacheSecurityGroupAsync(const Model::CreateCacheSecurityGroupRequest& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>CreateCacheSecurityGroup</i> action creates a new cache security
+         * group. Use a cache security group to control access to one or more cache
+         * clusters.</p> <p>Cache security groups are only used when you are creating a
+         * cache cluster outside of an Amazon Virtual Private Cloud (VPC). If you are
+         * creating a cache cluster inside of a VPC, use a cache subnet group instead. For
+         * more information, see <a
+         * href="http://docs.aws.amazon.com/AmazonElastiCache/latest/APIReference/API_CreateCacheSubnetGroup.html">CreateCacheSubnetGroup</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateCacheSecurityGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateCacheSecurityGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateCacheSecurityGroupOutcome> CreateCacheSecurityGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateCacheSecurityGroupOutcome>([this, request](const std::function<void(Model::CreateCacheSecurityGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateCacheSecurityGroupAsync(request, [complete](const ElastiCacheClient*, const Model::CreateCacheSecurityGroupRequest&, const Model::CreateCacheSecurityGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateCacheSecurityGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>CreateCacheSubnetGroup</i> action creates a new cache subnet
          * group.</p> <p>Use this parameter only when you are creating a cluster in an
@@ -509,6 +660,29 @@ namespace Model
          */
         virtual void CreateCacheSubnetGroupAsync(const Model::CreateCacheSubnetGroupRequest& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>CreateCacheSubnetGroup</i> action creates a new cache subnet
+         * group.</p> <p>Use this parameter only when you are creating a cluster in an
+         * Amazon Virtual Private Cloud (VPC).</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateCacheSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateCacheSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateCacheSubnetGroupOutcome> CreateCacheSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateCacheSubnetGroupOutcome>([this, request](const std::function<void(Model::CreateCacheSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateCacheSubnetGroupAsync(request, [complete](const ElastiCacheClient*, const Model::CreateCacheSubnetGroupRequest&, const Model::CreateCacheSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateCacheSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>CreateReplicationGroup</i> action creates a replication group. A
          * replication group is a collection of cache clusters, where one of the cache
@@ -549,6 +723,34 @@ namespace Model
          */
         virtual void CreateReplicationGroupAsync(const Model::CreateReplicationGroupRequest& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>CreateReplicationGroup</i> action creates a replication group. A
+         * replication group is a collection of cache clusters, where one of the cache
+         * clusters is a read/write primary and the others are read-only replicas. Writes
+         * to the primary are automatically propagated to the replicas.</p> <p>When you
+         * create a replication group, you must specify an existing cache cluster that is
+         * in the primary role. When the replication group has been successfully created,
+         * you can add one or more read replica replicas to it, up to a total of five read
+         * replicas.</p> <p><b>Note:</b> This action is valid only for Redis.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateReplicationGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateReplicationGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateReplicationGroupOutcome> CreateReplicationGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateReplicationGroupOutcome>([this, request](const std::function<void(Model::CreateReplicationGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateReplicationGroupAsync(request, [complete](const ElastiCacheClient*, const Model::CreateReplicationGroupRequest&, const Model::CreateReplicationGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateReplicationGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>CreateSnapshot</i> action creates a copy of an entire cache cluster at
          * a specific moment in time.</p>
@@ -571,6 +773,28 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>CreateSnapshot</i> action creates a copy of an entire cache cluster at
+         * a specific moment in time.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSnapshotOutcome>([this, request](const std::function<void(Model::CreateSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSnapshotAsync(request, [complete](const ElastiCacheClient*, const Model::CreateSnapshotRequest&, const Model::CreateSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DeleteCacheCluster</i> action deletes a previously provisioned cache
          * cluster. <i>DeleteCacheCluster</i> deletes all associated cache nodes, node
@@ -608,6 +832,33 @@ namespace Model
          */
         virtual void DeleteCacheClusterAsync(const Model::DeleteCacheClusterRequest& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DeleteCacheCluster</i> action deletes a previously provisioned cache
+         * cluster. <i>DeleteCacheCluster</i> deletes all associated cache nodes, node
+         * endpoints and the cache cluster itself. When you receive a successful response
+         * from this action, Amazon ElastiCache immediately begins deleting the cache
+         * cluster; you cannot cancel or revert this action.</p> <p>This API cannot be used
+         * to delete a cache cluster that is the last read replica of a replication group
+         * that has Multi-AZ mode enabled.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteCacheClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteCacheClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteCacheClusterOutcome> DeleteCacheClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteCacheClusterOutcome>([this, request](const std::function<void(Model::DeleteCacheClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteCacheClusterAsync(request, [complete](const ElastiCacheClient*, const Model::DeleteCacheClusterRequest&, const Model::DeleteCacheClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteCacheClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DeleteCacheParameterGroup</i> action deletes the specified cache
          * parameter group. You cannot delete a cache parameter group if it is associated
@@ -633,6 +884,29 @@ namespace Model
          */
         virtual void DeleteCacheParameterGroupAsync(const Model::DeleteCacheParameterGroupRequest& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DeleteCacheParameterGroup</i> action deletes the specified cache
+         * parameter group. You cannot delete a cache parameter group if it is associated
+         * with any cache clusters.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteCacheParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteCacheParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteCacheParameterGroupOutcome> DeleteCacheParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteCacheParameterGroupOutcome>([this, request](const std::function<void(Model::DeleteCacheParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteCacheParameterGroupAsync(request, [complete](const ElastiCacheClient*, const Model::DeleteCacheParameterGroupRequest&, const Model::DeleteCacheParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteCacheParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DeleteCacheSecurityGroup</i> action deletes a cache security
          * group.</p> <note>You cannot delete a cache security group if it is associated
@@ -658,6 +932,29 @@ namespace Model
          */
         virtual void DeleteCacheSecurityGroupAsync(const Model::DeleteCacheSecurityGroupRequest& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DeleteCacheSecurityGroup</i> action deletes a cache security
+         * group.</p> <note>You cannot delete a cache security group if it is associated
+         * with any cache clusters.</note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteCacheSecurityGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteCacheSecurityGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteCacheSecurityGroupOutcome> DeleteCacheSecurityGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteCacheSecurityGroupOutcome>([this, request](const std::function<void(Model::DeleteCacheSecurityGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteCacheSecurityGroupAsync(request, [complete](const ElastiCacheClient*, const Model::DeleteCacheSecurityGroupRequest&, const Model::DeleteCacheSecurityGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteCacheSecurityGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DeleteCacheSubnetGroup</i> action deletes a cache subnet group.</p>
          * <note>You cannot delete a cache subnet group if it is associated with any cache
@@ -683,6 +980,29 @@ namespace Model
          */
         virtual void DeleteCacheSubnetGroupAsync(const Model::DeleteCacheSubnetGroupRequest& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DeleteCacheSubnetGroup</i> action deletes a cache subnet group.</p>
+         * <note>You cannot delete a cache subnet group if it is associated with any cache
+         * clusters.</note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteCacheSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteCacheSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteCacheSubnetGroupOutcome> DeleteCacheSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteCacheSubnetGroupOutcome>([this, request](const std::function<void(Model::DeleteCacheSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteCacheSubnetGroupAsync(request, [complete](const ElastiCacheClient*, const Model::DeleteCacheSubnetGroupRequest&, const Model::DeleteCacheSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteCacheSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DeleteReplicationGroup</i> action deletes an existing replication
          * group. By default, this action deletes the entire replication group, including
@@ -717,6 +1037,32 @@ namespace Model
          */
         virtual void DeleteReplicationGroupAsync(const Model::DeleteReplicationGroupRequest& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DeleteReplicationGroup</i> action deletes an existing replication
+         * group. By default, this action deletes the entire replication group, including
+         * the primary cluster and all of the read replicas. You can optionally delete only
+         * the read replicas, while retaining the primary cluster.</p> <p>When you receive
+         * a successful response from this action, Amazon ElastiCache immediately begins
+         * deleting the selected resources; you cannot cancel or revert this action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteReplicationGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteReplicationGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteReplicationGroupOutcome> DeleteReplicationGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteReplicationGroupOutcome>([this, request](const std::function<void(Model::DeleteReplicationGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteReplicationGroupAsync(request, [complete](const ElastiCacheClient*, const Model::DeleteReplicationGroupRequest&, const Model::DeleteReplicationGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteReplicationGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DeleteSnapshot</i> action deletes an existing snapshot. When you
          * receive a successful response from this action, ElastiCache immediately begins
@@ -742,6 +1088,29 @@ namespace Model
          */
         virtual void DeleteSnapshotAsync(const Model::DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DeleteSnapshot</i> action deletes an existing snapshot. When you
+         * receive a successful response from this action, ElastiCache immediately begins
+         * deleting the snapshot; you cannot cancel or revert this action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSnapshotOutcome>([this, request](const std::function<void(Model::DeleteSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSnapshotAsync(request, [complete](const ElastiCacheClient*, const Model::DeleteSnapshotRequest&, const Model::DeleteSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeCacheClusters</i> action returns information about all
          * provisioned cache clusters if no cache cluster identifier is specified, or about
@@ -806,6 +1175,42 @@ namespace Model
          */
         virtual void DescribeCacheClustersAsync(const Model::DescribeCacheClustersRequest& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeCacheClusters</i> action returns information about all
+         * provisioned cache clusters if no cache cluster identifier is specified, or about
+         * a specific cache cluster if a cache cluster identifier is supplied.</p> <p>By
+         * default, abbreviated information about the cache clusters(s) will be returned.
+         * You can use the optional <i>ShowDetails</i> flag to retrieve detailed
+         * information about the cache nodes associated with the cache clusters. These
+         * details include the DNS address and port for the cache node endpoint.</p> <p>If
+         * the cluster is in the CREATING state, only cluster level information will be
+         * displayed until all of the nodes are successfully provisioned.</p> <p>If the
+         * cluster is in the DELETING state, only cluster level information will be
+         * displayed.</p> <p>If cache nodes are currently being added to the cache cluster,
+         * node endpoint information and creation time for the additional nodes will not be
+         * displayed until they are completely provisioned. When the cache cluster state is
+         * <i>available</i>, the cluster is ready for use.</p> <p>If cache nodes are
+         * currently being removed from the cache cluster, no endpoint information for the
+         * removed nodes is displayed.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCacheClustersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCacheClustersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCacheClustersOutcome> DescribeCacheClustersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCacheClustersOutcome>([this, request](const std::function<void(Model::DescribeCacheClustersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCacheClustersAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeCacheClustersRequest&, const Model::DescribeCacheClustersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCacheClustersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeCacheEngineVersions</i> action returns a list of the available
          * cache engines and their versions.</p>
@@ -828,6 +1233,28 @@ namespace Model
          */
         virtual void DescribeCacheEngineVersionsAsync(const Model::DescribeCacheEngineVersionsRequest& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeCacheEngineVersions</i> action returns a list of the available
+         * cache engines and their versions.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCacheEngineVersionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCacheEngineVersionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCacheEngineVersionsOutcome> DescribeCacheEngineVersionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCacheEngineVersionsOutcome>([this, request](const std::function<void(Model::DescribeCacheEngineVersionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCacheEngineVersionsAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeCacheEngineVersionsRequest&, const Model::DescribeCacheEngineVersionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCacheEngineVersionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeCacheParameterGroups</i> action returns a list of cache
          * parameter group descriptions. If a cache parameter group name is specified, the
@@ -853,6 +1280,29 @@ namespace Model
          */
         virtual void DescribeCacheParameterGroupsAsync(const Model::DescribeCacheParameterGroupsRequest& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeCacheParameterGroups</i> action returns a list of cache
+         * parameter group descriptions. If a cache parameter group name is specified, the
+         * list will contain only the descriptions for that group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCacheParameterGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCacheParameterGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCacheParameterGroupsOutcome> DescribeCacheParameterGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCacheParameterGroupsOutcome>([this, request](const std::function<void(Model::DescribeCacheParameterGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCacheParameterGroupsAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeCacheParameterGroupsRequest&, const Model::DescribeCacheParameterGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCacheParameterGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeCacheParameters</i> action returns the detailed parameter list
          * for a particular cache parameter group.</p>
@@ -875,6 +1325,28 @@ namespace Model
          */
         virtual void DescribeCacheParametersAsync(const Model::DescribeCacheParametersRequest& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeCacheParameters</i> action returns the detailed parameter list
+         * for a particular cache parameter group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCacheParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCacheParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCacheParametersOutcome> DescribeCacheParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCacheParametersOutcome>([this, request](const std::function<void(Model::DescribeCacheParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCacheParametersAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeCacheParametersRequest&, const Model::DescribeCacheParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCacheParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeCacheSecurityGroups</i> action returns a list of cache
          * security group descriptions. If a cache security group name is specified, the
@@ -900,6 +1372,29 @@ namespace Model
          */
         virtual void DescribeCacheSecurityGroupsAsync(const Model::DescribeCacheSecurityGroupsRequest& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeCacheSecurityGroups</i> action returns a list of cache
+         * security group descriptions. If a cache security group name is specified, the
+         * list will contain only the description of that group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCacheSecurityGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCacheSecurityGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCacheSecurityGroupsOutcome> DescribeCacheSecurityGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCacheSecurityGroupsOutcome>([this, request](const std::function<void(Model::DescribeCacheSecurityGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCacheSecurityGroupsAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeCacheSecurityGroupsRequest&, const Model::DescribeCacheSecurityGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCacheSecurityGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeCacheSubnetGroups</i> action returns a list of cache subnet
          * group descriptions. If a subnet group name is specified, the list will contain
@@ -925,6 +1420,29 @@ namespace Model
          */
         virtual void DescribeCacheSubnetGroupsAsync(const Model::DescribeCacheSubnetGroupsRequest& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeCacheSubnetGroups</i> action returns a list of cache subnet
+         * group descriptions. If a subnet group name is specified, the list will contain
+         * only the description of that group.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCacheSubnetGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCacheSubnetGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCacheSubnetGroupsOutcome> DescribeCacheSubnetGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCacheSubnetGroupsOutcome>([this, request](const std::function<void(Model::DescribeCacheSubnetGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCacheSubnetGroupsAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeCacheSubnetGroupsRequest&, const Model::DescribeCacheSubnetGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCacheSubnetGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeEngineDefaultParameters</i> action returns the default engine
          * and system parameter information for the specified cache engine.</p>
@@ -947,6 +1465,28 @@ namespace Model
          */
         virtual void DescribeEngineDefaultParametersAsync(const Model::DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeEngineDefaultParameters</i> action returns the default engine
+         * and system parameter information for the specified cache engine.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEngineDefaultParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEngineDefaultParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEngineDefaultParametersOutcome> DescribeEngineDefaultParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEngineDefaultParametersOutcome>([this, request](const std::function<void(Model::DescribeEngineDefaultParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEngineDefaultParametersAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeEngineDefaultParametersRequest&, const Model::DescribeEngineDefaultParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEngineDefaultParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeEvents</i> action returns events related to cache clusters,
          * cache security groups, and cache parameter groups. You can obtain events
@@ -981,6 +1521,32 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeEvents</i> action returns events related to cache clusters,
+         * cache security groups, and cache parameter groups. You can obtain events
+         * specific to a particular cache cluster, cache security group, or cache parameter
+         * group by providing the name as a parameter.</p> <p>By default, only the events
+         * occurring within the last hour are returned; however, you can retrieve up to 14
+         * days' worth of events if necessary.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEventsOutcome>([this, request](const std::function<void(Model::DescribeEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEventsAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeEventsRequest&, const Model::DescribeEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeReplicationGroups</i> action returns information about a
          * particular replication group. If no identifier is specified,
@@ -1009,6 +1575,30 @@ namespace Model
          */
         virtual void DescribeReplicationGroupsAsync(const Model::DescribeReplicationGroupsRequest& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeReplicationGroups</i> action returns information about a
+         * particular replication group. If no identifier is specified,
+         * <i>DescribeReplicationGroups</i> returns information about all replication
+         * groups.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReplicationGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReplicationGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReplicationGroupsOutcome> DescribeReplicationGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReplicationGroupsOutcome>([this, request](const std::function<void(Model::DescribeReplicationGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReplicationGroupsAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeReplicationGroupsRequest&, const Model::DescribeReplicationGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReplicationGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeReservedCacheNodes</i> action returns information about
          * reserved cache nodes for this account, or about a specified reserved cache
@@ -1034,6 +1624,29 @@ namespace Model
          */
         virtual void DescribeReservedCacheNodesAsync(const Model::DescribeReservedCacheNodesRequest& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeReservedCacheNodes</i> action returns information about
+         * reserved cache nodes for this account, or about a specified reserved cache
+         * node.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReservedCacheNodesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReservedCacheNodesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReservedCacheNodesOutcome> DescribeReservedCacheNodesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReservedCacheNodesOutcome>([this, request](const std::function<void(Model::DescribeReservedCacheNodesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReservedCacheNodesAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeReservedCacheNodesRequest&, const Model::DescribeReservedCacheNodesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReservedCacheNodesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeReservedCacheNodesOfferings</i> action lists available
          * reserved cache node offerings.</p>
@@ -1056,6 +1669,28 @@ namespace Model
          */
         virtual void DescribeReservedCacheNodesOfferingsAsync(const Model::DescribeReservedCacheNodesOfferingsRequest& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeReservedCacheNodesOfferings</i> action lists available
+         * reserved cache node offerings.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReservedCacheNodesOfferingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReservedCacheNodesOfferingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReservedCacheNodesOfferingsOutcome> DescribeReservedCacheNodesOfferingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReservedCacheNodesOfferingsOutcome>([this, request](const std::function<void(Model::DescribeReservedCacheNodesOfferingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReservedCacheNodesOfferingsAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeReservedCacheNodesOfferingsRequest&, const Model::DescribeReservedCacheNodesOfferingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReservedCacheNodesOfferingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>DescribeSnapshots</i> action returns information about cache cluster
          * snapshots. By default, <i>DescribeSnapshots</i> lists all of your snapshots; it
@@ -1084,6 +1719,30 @@ namespace Model
          */
         virtual void DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>DescribeSnapshots</i> action returns information about cache cluster
+         * snapshots. By default, <i>DescribeSnapshots</i> lists all of your snapshots; it
+         * can optionally describe a single snapshot, or just the snapshots associated with
+         * a particular cache cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSnapshotsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSnapshotsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotsOutcome>([this, request](const std::function<void(Model::DescribeSnapshotsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSnapshotsAsync(request, [complete](const ElastiCacheClient*, const Model::DescribeSnapshotsRequest&, const Model::DescribeSnapshotsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSnapshotsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <code>ListAllowedNodeTypeModifications</code> action lists all available
          * node types that you can scale your Redis cluster's or replication group's
@@ -1118,6 +1777,32 @@ namespace Model
          */
         virtual void ListAllowedNodeTypeModificationsAsync(const Model::ListAllowedNodeTypeModificationsRequest& request, const ListAllowedNodeTypeModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <code>ListAllowedNodeTypeModifications</code> action lists all available
+         * node types that you can scale your Redis cluster's or replication group's
+         * current node type up to.</p> <p>When you use the <code>ModifyCacheCluster</code>
+         * or <code>ModifyReplicationGroup</code> APIs to scale up your cluster or
+         * replication group, the value of the <i>CacheNodeType</i> parameter must be one
+         * of the node types returned by this action.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListAllowedNodeTypeModificationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAllowedNodeTypeModificationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAllowedNodeTypeModificationsOutcome> ListAllowedNodeTypeModificationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAllowedNodeTypeModificationsOutcome>([this, request](const std::function<void(Model::ListAllowedNodeTypeModificationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAllowedNodeTypeModificationsAsync(request, [complete](const ElastiCacheClient*, const Model::ListAllowedNodeTypeModificationsRequest&, const Model::ListAllowedNodeTypeModificationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAllowedNodeTypeModificationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>ListTagsForResource</i> action lists all cost allocation tags
          * currently on the named resource. A <i>cost allocation tag</i> is a key-value
@@ -1158,6 +1843,34 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>ListTagsForResource</i> action lists all cost allocation tags
+         * currently on the named resource. A <i>cost allocation tag</i> is a key-value
+         * pair where the key is case-sensitive and the value is optional. Cost allocation
+         * tags can be used to categorize and track your AWS costs.</p> <p>You can have a
+         * maximum of 10 cost allocation tags on an ElastiCache resource. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AmazonElastiCache/latest/UserGuide/BestPractices.html">Using
+         * Cost Allocation Tags in Amazon ElastiCache</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTagsForResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsForResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome>([this, request](const std::function<void(Model::ListTagsForResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsForResourceAsync(request, [complete](const ElastiCacheClient*, const Model::ListTagsForResourceRequest&, const Model::ListTagsForResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsForResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>ModifyCacheCluster</i> action modifies the settings for a cache
          * cluster. You can use this action to change one or more cluster configuration
@@ -1183,6 +1896,29 @@ namespace Model
          */
         virtual void ModifyCacheClusterAsync(const Model::ModifyCacheClusterRequest& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>ModifyCacheCluster</i> action modifies the settings for a cache
+         * cluster. You can use this action to change one or more cluster configuration
+         * parameters by specifying the parameters and the new values.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyCacheClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyCacheClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyCacheClusterOutcome> ModifyCacheClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyCacheClusterOutcome>([this, request](const std::function<void(Model::ModifyCacheClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyCacheClusterAsync(request, [complete](const ElastiCacheClient*, const Model::ModifyCacheClusterRequest&, const Model::ModifyCacheClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyCacheClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>ModifyCacheParameterGroup</i> action modifies the parameters of a
          * cache parameter group. You can modify up to 20 parameters in a single request by
@@ -1208,6 +1944,29 @@ namespace Model
          */
         virtual void ModifyCacheParameterGroupAsync(const Model::ModifyCacheParameterGroupRequest& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>ModifyCacheParameterGroup</i> action modifies the parameters of a
+         * cache parameter group. You can modify up to 20 parameters in a single request by
+         * submitting a list parameter name and value pairs.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyCacheParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyCacheParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyCacheParameterGroupOutcome> ModifyCacheParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyCacheParameterGroupOutcome>([this, request](const std::function<void(Model::ModifyCacheParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyCacheParameterGroupAsync(request, [complete](const ElastiCacheClient*, const Model::ModifyCacheParameterGroupRequest&, const Model::ModifyCacheParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyCacheParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>ModifyCacheSubnetGroup</i> action modifies an existing cache subnet
          * group.</p>
@@ -1230,6 +1989,28 @@ namespace Model
          */
         virtual void ModifyCacheSubnetGroupAsync(const Model::ModifyCacheSubnetGroupRequest& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>ModifyCacheSubnetGroup</i> action modifies an existing cache subnet
+         * group.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyCacheSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyCacheSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyCacheSubnetGroupOutcome> ModifyCacheSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyCacheSubnetGroupOutcome>([this, request](const std::function<void(Model::ModifyCacheSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyCacheSubnetGroupAsync(request, [complete](const ElastiCacheClient*, const Model::ModifyCacheSubnetGroupRequest&, const Model::ModifyCacheSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyCacheSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>ModifyReplicationGroup</i> action modifies the settings for a
          * replication group.</p>
@@ -1252,6 +2033,28 @@ namespace Model
          */
         virtual void ModifyReplicationGroupAsync(const Model::ModifyReplicationGroupRequest& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>ModifyReplicationGroup</i> action modifies the settings for a
+         * replication group.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyReplicationGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyReplicationGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyReplicationGroupOutcome> ModifyReplicationGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyReplicationGroupOutcome>([this, request](const std::function<void(Model::ModifyReplicationGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyReplicationGroupAsync(request, [complete](const ElastiCacheClient*, const Model::ModifyReplicationGroupRequest&, const Model::ModifyReplicationGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyReplicationGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>PurchaseReservedCacheNodesOffering</i> action allows you to purchase a
          * reserved cache node offering.</p>
@@ -1274,6 +2077,28 @@ namespace Model
          */
         virtual void PurchaseReservedCacheNodesOfferingAsync(const Model::PurchaseReservedCacheNodesOfferingRequest& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>PurchaseReservedCacheNodesOffering</i> action allows you to purchase a
+         * reserved cache node offering.</p>
+         *
+         * Returns an awaitable that starts the operation the way PurchaseReservedCacheNodesOfferingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PurchaseReservedCacheNodesOfferingRequest>
+        Aws::Utils::Threading::Awaitable<Model::PurchaseReservedCacheNodesOfferingOutcome> PurchaseReservedCacheNodesOfferingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PurchaseReservedCacheNodesOfferingOutcome>([this, request](const std::function<void(Model::PurchaseReservedCacheNodesOfferingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PurchaseReservedCacheNodesOfferingAsync(request, [complete](const ElastiCacheClient*, const Model::PurchaseReservedCacheNodesOfferingRequest&, const Model::PurchaseReservedCacheNodesOfferingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PurchaseReservedCacheNodesOfferingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>RebootCacheCluster</i> action reboots some, or all, of the cache nodes
          * within a provisioned cache cluster. This API will apply any modified cache
@@ -1311,6 +2136,33 @@ namespace Model
          */
         virtual void RebootCacheClusterAsync(const Model::RebootCacheClusterRequest& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>RebootCacheCluster</i> action reboots some, or all, of the cache nodes
+         * within a provisioned cache cluster. This API will apply any modified cache
+         * parameter groups to the cache cluster. The reboot action takes place as soon as
+         * possible, and results in a momentary outage to the cache cluster. During the
+         * reboot, the cache cluster status is set to REBOOTING.</p> <p>The reboot causes
+         * the contents of the cache (for each cache node being rebooted) to be lost.</p>
+         * <p>When the reboot is complete, a cache cluster event is created.</p>
+         *
+         * Returns an awaitable that starts the operation the way RebootCacheClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RebootCacheClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::RebootCacheClusterOutcome> RebootCacheClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RebootCacheClusterOutcome>([this, request](const std::function<void(Model::RebootCacheClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RebootCacheClusterAsync(request, [complete](const ElastiCacheClient*, const Model::RebootCacheClusterRequest&, const Model::RebootCacheClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RebootCacheClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>RemoveTagsFromResource</i> action removes the tags identified by the
          * <code>TagKeys</code> list from the named resource.</p>
@@ -1333,6 +2185,28 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>RemoveTagsFromResource</i> action removes the tags identified by the
+         * <code>TagKeys</code> list from the named resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsFromResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsFromResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromResourceOutcome>([this, request](const std::function<void(Model::RemoveTagsFromResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsFromResourceAsync(request, [complete](const ElastiCacheClient*, const Model::RemoveTagsFromResourceRequest&, const Model::RemoveTagsFromResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsFromResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>ResetCacheParameterGroup</i> action modifies the parameters of a cache
          * parameter group to the engine or system default value. You can reset specific
@@ -1364,6 +2238,31 @@ namespace Model
          */
         virtual void ResetCacheParameterGroupAsync(const Model::ResetCacheParameterGroupRequest& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>ResetCacheParameterGroup</i> action modifies the parameters of a cache
+         * parameter group to the engine or system default value. You can reset specific
+         * parameters by submitting a list of parameter names. To reset the entire cache
+         * parameter group, specify the <i>ResetAllParameters</i> and
+         * <i>CacheParameterGroupName</i> parameters.</p>
+         *
+         * Returns an awaitable that starts the operation the way ResetCacheParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResetCacheParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResetCacheParameterGroupOutcome> ResetCacheParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResetCacheParameterGroupOutcome>([this, request](const std::function<void(Model::ResetCacheParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResetCacheParameterGroupAsync(request, [complete](const ElastiCacheClient*, const Model::ResetCacheParameterGroupRequest&, const Model::ResetCacheParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResetCacheParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The <i>RevokeCacheSecurityGroupIngress</i> action revokes ingress from a
          * cache security group. Use this action to disallow access from an Amazon EC2
@@ -1389,6 +2288,29 @@ namespace Model
          */
         virtual void RevokeCacheSecurityGroupIngressAsync(const Model::RevokeCacheSecurityGroupIngressRequest& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The <i>RevokeCacheSecurityGroupIngress</i> action revokes ingress from a
+         * cache security group. Use this action to disallow access from an Amazon EC2
+         * security group that had been previously authorized.</p>
+         *
+         * Returns an awaitable that starts the operation the way RevokeCacheSecurityGroupIngressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RevokeCacheSecurityGroupIngressRequest>
+        Aws::Utils::Threading::Awaitable<Model::RevokeCacheSecurityGroupIngressOutcome> RevokeCacheSecurityGroupIngressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RevokeCacheSecurityGroupIngressOutcome>([this, request](const std::function<void(Model::RevokeCacheSecurityGroupIngressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RevokeCacheSecurityGroupIngressAsync(request, [complete](const ElastiCacheClient*, const Model::RevokeCacheSecurityGroupIngressRequest&, const Model::RevokeCacheSecurityGroupIngressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RevokeCacheSecurityGroupIngressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -46,6 +46,7 @@
 #include <aws/elasticbeanstalk/model/ValidateConfigurationSettingsResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -296,6 +297,28 @@ namespace Model
          */
         virtual void AbortEnvironmentUpdateAsync(const Model::AbortEnvironmentUpdateRequest& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels in-progress environment configuration update or application version
+         * deployment.</p>
+         *
+         * Returns an awaitable that starts the operation the way AbortEnvironmentUpdateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AbortEnvironmentUpdateRequest>
+        Aws::Utils::Threading::Awaitable<Model::AbortEnvironmentUpdateOutcome> AbortEnvironmentUpdateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AbortEnvironmentUpdateOutcome>([this, request](const std::function<void(Model::AbortEnvironmentUpdateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AbortEnvironmentUpdateAsync(request, [complete](const ElasticBeanstalkClient*, const Model::AbortEnvironmentUpdateRequest&, const Model::AbortEnvironmentUpdateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AbortEnvironmentUpdateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Checks if the specified CNAME is available. </p>
          */
@@ -315,6 +338,27 @@ namespace Model
          */
         virtual void CheckDNSAvailabilityAsync(const Model::CheckDNSAvailabilityRequest& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Checks if the specified CNAME is available. </p>
+         *
+         * Returns an awaitable that starts the operation the way CheckDNSAvailabilityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CheckDNSAvailabilityRequest>
+        Aws::Utils::Threading::Awaitable<Model::CheckDNSAvailabilityOutcome> CheckDNSAvailabilityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CheckDNSAvailabilityOutcome>([this, request](const std::function<void(Model::CheckDNSAvailabilityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CheckDNSAvailabilityAsync(request, [complete](const ElasticBeanstalkClient*, const Model::CheckDNSAvailabilityRequest&, const Model::CheckDNSAvailabilityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CheckDNSAvailabilityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Create or update a group of environments that each run a separate component
          * of a single application. Takes a list of version labels that specify application
@@ -352,6 +396,33 @@ namespace Model
          */
         virtual void ComposeEnvironmentsAsync(const Model::ComposeEnvironmentsRequest& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Create or update a group of environments that each run a separate component
+         * of a single application. Takes a list of version labels that specify application
+         * source bundles for each of the environments to create or update. The name of
+         * each environment and other required information must be included in the source
+         * bundles in an environment manifest named <code>env.yaml</code>. See <a
+         * href="http://docs.aws.amazon.com/elasticbeanstalk/latest/dg/environment-mgmt-compose.html">Compose
+         * Environments</a> for details.</p>
+         *
+         * Returns an awaitable that starts the operation the way ComposeEnvironmentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ComposeEnvironmentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ComposeEnvironmentsOutcome> ComposeEnvironmentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ComposeEnvironmentsOutcome>([this, request](const std::function<void(Model::ComposeEnvironmentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ComposeEnvironmentsAsync(request, [complete](const ElasticBeanstalkClient*, const Model::ComposeEnvironmentsRequest&, const Model::ComposeEnvironmentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ComposeEnvironmentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates an application that has one configuration template named
          * <code>default</code> and no application versions. </p>
@@ -374,6 +445,28 @@ namespace Model
          */
         virtual void CreateApplicationAsync(const Model::CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates an application that has one configuration template named
+         * <code>default</code> and no application versions. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateApplicationOutcome> CreateApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateApplicationOutcome>([this, request](const std::function<void(Model::CreateApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateApplicationAsync(request, [complete](const ElasticBeanstalkClient*, const Model::CreateApplicationRequest&, const Model::CreateApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an application version for the specified application.</p> <note>Once
          * you create an application version with a specified Amazon S3 bucket and key
@@ -405,6 +498,31 @@ namespace Model
          */
         virtual void CreateApplicationVersionAsync(const Model::CreateApplicationVersionRequest& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an application version for the specified application.</p> <note>Once
+         * you create an application version with a specified Amazon S3 bucket and key
+         * location, you cannot change that Amazon S3 location. If you change the Amazon S3
+         * location, you receive an exception when you attempt to launch an environment
+         * from the application version. </note>
+         *
+         * Returns an awaitable that starts the operation the way CreateApplicationVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateApplicationVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateApplicationVersionOutcome> CreateApplicationVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateApplicationVersionOutcome>([this, request](const std::function<void(Model::CreateApplicationVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateApplicationVersionAsync(request, [complete](const ElasticBeanstalkClient*, const Model::CreateApplicationVersionRequest&, const Model::CreateApplicationVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateApplicationVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a configuration template. Templates are associated with a specific
          * application and are used to deploy different versions of the application with
@@ -439,6 +557,32 @@ namespace Model
          */
         virtual void CreateConfigurationTemplateAsync(const Model::CreateConfigurationTemplateRequest& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a configuration template. Templates are associated with a specific
+         * application and are used to deploy different versions of the application with
+         * the same configuration settings.</p> <p>Related Topics</p> <ul> <li>
+         * <a>DescribeConfigurationOptions</a> </li> <li>
+         * <a>DescribeConfigurationSettings</a> </li> <li>
+         * <a>ListAvailableSolutionStacks</a> </li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way CreateConfigurationTemplateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateConfigurationTemplateRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateConfigurationTemplateOutcome> CreateConfigurationTemplateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateConfigurationTemplateOutcome>([this, request](const std::function<void(Model::CreateConfigurationTemplateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateConfigurationTemplateAsync(request, [complete](const ElasticBeanstalkClient*, const Model::CreateConfigurationTemplateRequest&, const Model::CreateConfigurationTemplateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateConfigurationTemplateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Launches an environment for the specified application using the specified
          * configuration.</p>
@@ -461,6 +605,28 @@ namespace Model
          */
         virtual void CreateEnvironmentAsync(const Model::CreateEnvironmentRequest& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Launches an environment for the specified application using the specified
+         * configuration.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateEnvironmentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateEnvironmentRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateEnvironmentOutcome> CreateEnvironmentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateEnvironmentOutcome>([this, request](const std::function<void(Model::CreateEnvironmentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateEnvironmentAsync(request, [complete](const ElasticBeanstalkClient*, const Model::CreateEnvironmentRequest&, const Model::CreateEnvironmentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateEnvironmentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates the Amazon S3 storage location for the account. </p> <p> This
          * location is used to store user log files. </p>
@@ -483,6 +649,28 @@ namespace Model
          */
         virtual void CreateStorageLocationAsync(const Model::CreateStorageLocationRequest& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates the Amazon S3 storage location for the account. </p> <p> This
+         * location is used to store user log files. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateStorageLocationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateStorageLocationRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateStorageLocationOutcome> CreateStorageLocationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateStorageLocationOutcome>([this, request](const std::function<void(Model::CreateStorageLocationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateStorageLocationAsync(request, [complete](const ElasticBeanstalkClient*, const Model::CreateStorageLocationRequest&, const Model::CreateStorageLocationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateStorageLocationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the specified application along with all associated versions and
          * configurations. The application versions will not be deleted from your Amazon S3
@@ -511,6 +699,30 @@ namespace Model
          */
         virtual void DeleteApplicationAsync(const Model::DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the specified application along with all associated versions and
+         * configurations. The application versions will not be deleted from your Amazon S3
+         * bucket. </p> <note>You cannot delete an application that has a running
+         * environment. </note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteApplicationOutcome>([this, request](const std::function<void(Model::DeleteApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteApplicationAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DeleteApplicationRequest&, const Model::DeleteApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the specified version from the specified application. </p> <note>You
          * cannot delete an application version that is associated with a running
@@ -536,6 +748,29 @@ namespace Model
          */
         virtual void DeleteApplicationVersionAsync(const Model::DeleteApplicationVersionRequest& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the specified version from the specified application. </p> <note>You
+         * cannot delete an application version that is associated with a running
+         * environment.</note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteApplicationVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteApplicationVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteApplicationVersionOutcome> DeleteApplicationVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteApplicationVersionOutcome>([this, request](const std::function<void(Model::DeleteApplicationVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteApplicationVersionAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DeleteApplicationVersionRequest&, const Model::DeleteApplicationVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteApplicationVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified configuration template.</p> <note>When you launch an
          * environment using a configuration template, the environment gets a copy of the
@@ -564,6 +799,30 @@ namespace Model
          */
         virtual void DeleteConfigurationTemplateAsync(const Model::DeleteConfigurationTemplateRequest& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified configuration template.</p> <note>When you launch an
+         * environment using a configuration template, the environment gets a copy of the
+         * template. You can delete or modify the environment's copy of the template
+         * without affecting the running environment.</note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteConfigurationTemplateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteConfigurationTemplateRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteConfigurationTemplateOutcome> DeleteConfigurationTemplateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteConfigurationTemplateOutcome>([this, request](const std::function<void(Model::DeleteConfigurationTemplateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteConfigurationTemplateAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DeleteConfigurationTemplateRequest&, const Model::DeleteConfigurationTemplateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteConfigurationTemplateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the draft configuration associated with the running environment.</p>
          * <p>Updating a running environment with any configuration changes creates a draft
@@ -601,6 +860,33 @@ namespace Model
          */
         virtual void DeleteEnvironmentConfigurationAsync(const Model::DeleteEnvironmentConfigurationRequest& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the draft configuration associated with the running environment.</p>
+         * <p>Updating a running environment with any configuration changes creates a draft
+         * configuration set. You can get the draft configuration using
+         * <a>DescribeConfigurationSettings</a> while the update is in progress or if the
+         * update fails. The <code>DeploymentStatus</code> for the draft configuration
+         * indicates whether the deployment is in process or has failed. The draft
+         * configuration remains in existence until it is deleted with this action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteEnvironmentConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteEnvironmentConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteEnvironmentConfigurationOutcome> DeleteEnvironmentConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteEnvironmentConfigurationOutcome>([this, request](const std::function<void(Model::DeleteEnvironmentConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteEnvironmentConfigurationAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DeleteEnvironmentConfigurationRequest&, const Model::DeleteEnvironmentConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteEnvironmentConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieve a list of application versions stored in your AWS Elastic Beanstalk
          * storage bucket.</p>
@@ -623,6 +909,28 @@ namespace Model
          */
         virtual void DescribeApplicationVersionsAsync(const Model::DescribeApplicationVersionsRequest& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieve a list of application versions stored in your AWS Elastic Beanstalk
+         * storage bucket.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeApplicationVersionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeApplicationVersionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeApplicationVersionsOutcome> DescribeApplicationVersionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeApplicationVersionsOutcome>([this, request](const std::function<void(Model::DescribeApplicationVersionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeApplicationVersionsAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DescribeApplicationVersionsRequest&, const Model::DescribeApplicationVersionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeApplicationVersionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the descriptions of existing applications.</p>
          */
@@ -642,6 +950,27 @@ namespace Model
          */
         virtual void DescribeApplicationsAsync(const Model::DescribeApplicationsRequest& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the descriptions of existing applications.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeApplicationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeApplicationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeApplicationsOutcome> DescribeApplicationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeApplicationsOutcome>([this, request](const std::function<void(Model::DescribeApplicationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeApplicationsAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DescribeApplicationsRequest&, const Model::DescribeApplicationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeApplicationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Describes the configuration options that are used in a particular
          * configuration template or environment, or that a specified solution stack
@@ -673,6 +1002,31 @@ namespace Model
          */
         virtual void DescribeConfigurationOptionsAsync(const Model::DescribeConfigurationOptionsRequest& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Describes the configuration options that are used in a particular
+         * configuration template or environment, or that a specified solution stack
+         * defines. The description includes the values the options, their default values,
+         * and an indication of the required action on a running environment if an option
+         * value is changed. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeConfigurationOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeConfigurationOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeConfigurationOptionsOutcome> DescribeConfigurationOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeConfigurationOptionsOutcome>([this, request](const std::function<void(Model::DescribeConfigurationOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeConfigurationOptionsAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DescribeConfigurationOptionsRequest&, const Model::DescribeConfigurationOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeConfigurationOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a description of the settings for the specified configuration set,
          * that is, either a configuration template or the configuration set associated
@@ -713,6 +1067,34 @@ namespace Model
          */
         virtual void DescribeConfigurationSettingsAsync(const Model::DescribeConfigurationSettingsRequest& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a description of the settings for the specified configuration set,
+         * that is, either a configuration template or the configuration set associated
+         * with a running environment. </p> <p> When describing the settings for the
+         * configuration set associated with a running environment, it is possible to
+         * receive two sets of setting descriptions. One is the deployed configuration set,
+         * and the other is a draft configuration of an environment that is either in the
+         * process of deployment or that failed to deploy. </p> <p>Related Topics</p> <ul>
+         * <li> <a>DeleteEnvironmentConfiguration</a> </li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way DescribeConfigurationSettingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeConfigurationSettingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeConfigurationSettingsOutcome> DescribeConfigurationSettingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeConfigurationSettingsOutcome>([this, request](const std::function<void(Model::DescribeConfigurationSettingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeConfigurationSettingsAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DescribeConfigurationSettingsRequest&, const Model::DescribeConfigurationSettingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeConfigurationSettingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the overall health of the specified environment.
          * The <b>DescribeEnvironmentHealth</b> operation is only available with AWS
@@ -738,6 +1120,29 @@ namespace Model
          */
         virtual void DescribeEnvironmentHealthAsync(const Model::DescribeEnvironmentHealthRequest& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the overall health of the specified environment.
+         * The <b>DescribeEnvironmentHealth</b> operation is only available with AWS
+         * Elastic Beanstalk Enhanced Health.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEnvironmentHealthAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEnvironmentHealthRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEnvironmentHealthOutcome> DescribeEnvironmentHealthAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEnvironmentHealthOutcome>([this, request](const std::function<void(Model::DescribeEnvironmentHealthOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEnvironmentHealthAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DescribeEnvironmentHealthRequest&, const Model::DescribeEnvironmentHealthOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEnvironmentHealthOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns AWS resources for this environment.</p>
          */
@@ -757,6 +1162,27 @@ namespace Model
          */
         virtual void DescribeEnvironmentResourcesAsync(const Model::DescribeEnvironmentResourcesRequest& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns AWS resources for this environment.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEnvironmentResourcesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEnvironmentResourcesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEnvironmentResourcesOutcome> DescribeEnvironmentResourcesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEnvironmentResourcesOutcome>([this, request](const std::function<void(Model::DescribeEnvironmentResourcesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEnvironmentResourcesAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DescribeEnvironmentResourcesRequest&, const Model::DescribeEnvironmentResourcesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEnvironmentResourcesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns descriptions for existing environments.</p>
          */
@@ -776,6 +1202,27 @@ namespace Model
          */
         virtual void DescribeEnvironmentsAsync(const Model::DescribeEnvironmentsRequest& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns descriptions for existing environments.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEnvironmentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEnvironmentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEnvironmentsOutcome> DescribeEnvironmentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEnvironmentsOutcome>([this, request](const std::function<void(Model::DescribeEnvironmentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEnvironmentsAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DescribeEnvironmentsRequest&, const Model::DescribeEnvironmentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEnvironmentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns list of event descriptions matching criteria up to the last 6
          * weeks.</p> <note>This action returns the most recent 1,000 events from the
@@ -801,6 +1248,29 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns list of event descriptions matching criteria up to the last 6
+         * weeks.</p> <note>This action returns the most recent 1,000 events from the
+         * specified <code>NextToken</code>.</note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEventsOutcome>([this, request](const std::function<void(Model::DescribeEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEventsAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DescribeEventsRequest&, const Model::DescribeEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns more detailed information about the health of the specified instances
          * (for example, CPU utilization, load average, and causes). The
@@ -829,6 +1299,30 @@ namespace Model
          */
         virtual void DescribeInstancesHealthAsync(const Model::DescribeInstancesHealthRequest& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns more detailed information about the health of the specified instances
+         * (for example, CPU utilization, load average, and causes). The
+         * <b>DescribeInstancesHealth</b> operation is only available with AWS Elastic
+         * Beanstalk Enhanced Health.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeInstancesHealthAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeInstancesHealthRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeInstancesHealthOutcome> DescribeInstancesHealthAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeInstancesHealthOutcome>([this, request](const std::function<void(Model::DescribeInstancesHealthOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeInstancesHealthAsync(request, [complete](const ElasticBeanstalkClient*, const Model::DescribeInstancesHealthRequest&, const Model::DescribeInstancesHealthOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeInstancesHealthOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of the available solution stack names. </p>
          */
@@ -848,6 +1342,27 @@ namespace Model
          */
         virtual void ListAvailableSolutionStacksAsync(const Model::ListAvailableSolutionStacksRequest& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of the available solution stack names. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListAvailableSolutionStacksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAvailableSolutionStacksRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAvailableSolutionStacksOutcome> ListAvailableSolutionStacksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAvailableSolutionStacksOutcome>([this, request](const std::function<void(Model::ListAvailableSolutionStacksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAvailableSolutionStacksAsync(request, [complete](const ElasticBeanstalkClient*, const Model::ListAvailableSolutionStacksRequest&, const Model::ListAvailableSolutionStacksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAvailableSolutionStacksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes and recreates all of the AWS resources (for example: the Auto
          * Scaling group, load balancer, etc.) for a specified environment and forces a
@@ -873,6 +1388,29 @@ namespace Model
          */
         virtual void RebuildEnvironmentAsync(const Model::RebuildEnvironmentRequest& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes and recreates all of the AWS resources (for example: the Auto
+         * Scaling group, load balancer, etc.) for a specified environment and forces a
+         * restart. </p>
+         *
+         * Returns an awaitable that starts the operation the way RebuildEnvironmentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RebuildEnvironmentRequest>
+        Aws::Utils::Threading::Awaitable<Model::RebuildEnvironmentOutcome> RebuildEnvironmentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RebuildEnvironmentOutcome>([this, request](const std::function<void(Model::RebuildEnvironmentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RebuildEnvironmentAsync(request, [complete](const ElasticBeanstalkClient*, const Model::RebuildEnvironmentRequest&, const Model::RebuildEnvironmentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RebuildEnvironmentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Initiates a request to compile the specified type of information of the
          * deployed environment. </p> <p> Setting the <code>InfoType</code> to
@@ -916,6 +1454,35 @@ namespace Model
          */
         virtual void RequestEnvironmentInfoAsync(const Model::RequestEnvironmentInfoRequest& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Initiates a request to compile the specified type of information of the
+         * deployed environment. </p> <p> Setting the <code>InfoType</code> to
+         * <code>tail</code> compiles the last lines from the application server log files
+         * of every Amazon EC2 instance in your environment. </p> <p> Setting the
+         * <code>InfoType</code> to <code>bundle</code> compresses the application server
+         * log files for every Amazon EC2 instance into a <code>.zip</code> file. Legacy
+         * and .NET containers do not support bundle logs. </p> <p> Use
+         * <a>RetrieveEnvironmentInfo</a> to obtain the set of logs. </p> <p>Related
+         * Topics</p> <ul> <li> <a>RetrieveEnvironmentInfo</a> </li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way RequestEnvironmentInfoAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RequestEnvironmentInfoRequest>
+        Aws::Utils::Threading::Awaitable<Model::RequestEnvironmentInfoOutcome> RequestEnvironmentInfoAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RequestEnvironmentInfoOutcome>([this, request](const std::function<void(Model::RequestEnvironmentInfoOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RequestEnvironmentInfoAsync(request, [complete](const ElasticBeanstalkClient*, const Model::RequestEnvironmentInfoRequest&, const Model::RequestEnvironmentInfoOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RequestEnvironmentInfoOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Causes the environment to restart the application container server running
          * on each Amazon EC2 instance. </p>
@@ -938,6 +1505,28 @@ namespace Model
          */
         virtual void RestartAppServerAsync(const Model::RestartAppServerRequest& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Causes the environment to restart the application container server running
+         * on each Amazon EC2 instance. </p>
+         *
+         * Returns an awaitable that starts the operation the way RestartAppServerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RestartAppServerRequest>
+        Aws::Utils::Threading::Awaitable<Model::RestartAppServerOutcome> RestartAppServerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RestartAppServerOutcome>([this, request](const std::function<void(Model::RestartAppServerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RestartAppServerAsync(request, [complete](const ElasticBeanstalkClient*, const Model::RestartAppServerRequest&, const Model::RestartAppServerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RestartAppServerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the compiled information from a <a>RequestEnvironmentInfo</a>
          * request.</p> <p>Related Topics</p> <ul> <li> <a>RequestEnvironmentInfo</a> </li>
@@ -963,6 +1552,29 @@ namespace Model
          */
         virtual void RetrieveEnvironmentInfoAsync(const Model::RetrieveEnvironmentInfoRequest& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the compiled information from a <a>RequestEnvironmentInfo</a>
+         * request.</p> <p>Related Topics</p> <ul> <li> <a>RequestEnvironmentInfo</a> </li>
+         * </ul>
+         *
+         * Returns an awaitable that starts the operation the way RetrieveEnvironmentInfoAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RetrieveEnvironmentInfoRequest>
+        Aws::Utils::Threading::Awaitable<Model::RetrieveEnvironmentInfoOutcome> RetrieveEnvironmentInfoAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RetrieveEnvironmentInfoOutcome>([this, request](const std::function<void(Model::RetrieveEnvironmentInfoOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RetrieveEnvironmentInfoAsync(request, [complete](const ElasticBeanstalkClient*, const Model::RetrieveEnvironmentInfoRequest&, const Model::RetrieveEnvironmentInfoOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RetrieveEnvironmentInfoOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Swaps the CNAMEs of two environments. </p>
          */
@@ -982,6 +1594,27 @@ namespace Model
          */
         virtual void SwapEnvironmentCNAMEsAsync(const Model::SwapEnvironmentCNAMEsRequest& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Swaps the CNAMEs of two environments. </p>
+         *
+         * Returns an awaitable that starts the operation the way SwapEnvironmentCNAMEsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SwapEnvironmentCNAMEsRequest>
+        Aws::Utils::Threading::Awaitable<Model::SwapEnvironmentCNAMEsOutcome> SwapEnvironmentCNAMEsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SwapEnvironmentCNAMEsOutcome>([this, request](const std::function<void(Model::SwapEnvironmentCNAMEsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SwapEnvironmentCNAMEsAsync(request, [complete](const ElasticBeanstalkClient*, const Model::SwapEnvironmentCNAMEsRequest&, const Model::SwapEnvironmentCNAMEsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SwapEnvironmentCNAMEsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Terminates the specified environment. </p>
          */
@@ -1001,6 +1634,27 @@ namespace Model
          */
         virtual void TerminateEnvironmentAsync(const Model::TerminateEnvironmentRequest& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Terminates the specified environment. </p>
+         *
+         * Returns an awaitable that starts the operation the way TerminateEnvironmentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TerminateEnvironmentRequest>
+        Aws::Utils::Threading::Awaitable<Model::TerminateEnvironmentOutcome> TerminateEnvironmentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TerminateEnvironmentOutcome>([this, request](const std::function<void(Model::TerminateEnvironmentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TerminateEnvironmentAsync(request, [complete](const ElasticBeanstalkClient*, const Model::TerminateEnvironmentRequest&, const Model::TerminateEnvironmentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TerminateEnvironmentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the specified application to have the specified properties. </p>
          * <note> If a property (for example, <code>description</code>) is not provided,
@@ -1029,6 +1683,30 @@ namespace Model
          */
         virtual void UpdateApplicationAsync(const Model::UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the specified application to have the specified properties. </p>
+         * <note> If a property (for example, <code>description</code>) is not provided,
+         * the value remains unchanged. To clear these properties, specify an empty string.
+         * </note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateApplicationOutcome>([this, request](const std::function<void(Model::UpdateApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateApplicationAsync(request, [complete](const ElasticBeanstalkClient*, const Model::UpdateApplicationRequest&, const Model::UpdateApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Updates the specified application version to have the specified properties.
          * </p> <note> If a property (for example, <code>description</code>) is not
@@ -1057,6 +1735,30 @@ namespace Model
          */
         virtual void UpdateApplicationVersionAsync(const Model::UpdateApplicationVersionRequest& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Updates the specified application version to have the specified properties.
+         * </p> <note> If a property (for example, <code>description</code>) is not
+         * provided, the value remains unchanged. To clear properties, specify an empty
+         * string. </note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateApplicationVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateApplicationVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateApplicationVersionOutcome> UpdateApplicationVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateApplicationVersionOutcome>([this, request](const std::function<void(Model::UpdateApplicationVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateApplicationVersionAsync(request, [complete](const ElasticBeanstalkClient*, const Model::UpdateApplicationVersionRequest&, const Model::UpdateApplicationVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateApplicationVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Updates the specified configuration template to have the specified
          * properties or configuration option values. </p> <note> If a property (for
@@ -1088,6 +1790,31 @@ namespace Model
          */
         virtual void UpdateConfigurationTemplateAsync(const Model::UpdateConfigurationTemplateRequest& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Updates the specified configuration template to have the specified
+         * properties or configuration option values. </p> <note> If a property (for
+         * example, <code>ApplicationName</code>) is not provided, its value remains
+         * unchanged. To clear such properties, specify an empty string. </note> <p>Related
+         * Topics</p> <ul> <li> <a>DescribeConfigurationOptions</a> </li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way UpdateConfigurationTemplateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateConfigurationTemplateRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateConfigurationTemplateOutcome> UpdateConfigurationTemplateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateConfigurationTemplateOutcome>([this, request](const std::function<void(Model::UpdateConfigurationTemplateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateConfigurationTemplateAsync(request, [complete](const ElasticBeanstalkClient*, const Model::UpdateConfigurationTemplateRequest&, const Model::UpdateConfigurationTemplateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateConfigurationTemplateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Updates the environment description, deploys a new application version,
          * updates the configuration settings to an entirely new configuration template, or
@@ -1131,6 +1858,35 @@ namespace Model
          */
         virtual void UpdateEnvironmentAsync(const Model::UpdateEnvironmentRequest& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Updates the environment description, deploys a new application version,
+         * updates the configuration settings to an entirely new configuration template, or
+         * updates select configuration option values in the running environment. </p> <p>
+         * Attempting to update both the release and configuration is not allowed and AWS
+         * Elastic Beanstalk returns an <code>InvalidParameterCombination</code> error.
+         * </p> <p> When updating the configuration settings to a new template or
+         * individual settings, a draft configuration is created and
+         * <a>DescribeConfigurationSettings</a> for this environment returns two setting
+         * descriptions with different <code>DeploymentStatus</code> values. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateEnvironmentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateEnvironmentRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateEnvironmentOutcome> UpdateEnvironmentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateEnvironmentOutcome>([this, request](const std::function<void(Model::UpdateEnvironmentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateEnvironmentAsync(request, [complete](const ElasticBeanstalkClient*, const Model::UpdateEnvironmentRequest&, const Model::UpdateEnvironmentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateEnvironmentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Takes a set of configuration settings and either a configuration template or
          * environment, and determines whether those values are valid. </p> <p> This action
@@ -1159,6 +1915,30 @@ namespace Model
          */
         virtual void ValidateConfigurationSettingsAsync(const Model::ValidateConfigurationSettingsRequest& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Takes a set of configuration settings and either a configuration template or
+         * environment, and determines whether those values are valid. </p> <p> This action
+         * returns a list of messages indicating any errors or warnings associated with the
+         * selection of option values. </p>
+         *
+         * Returns an awaitable that starts the operation the way ValidateConfigurationSettingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ValidateConfigurationSettingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ValidateConfigurationSettingsOutcome> ValidateConfigurationSettingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ValidateConfigurationSettingsOutcome>([this, request](const std::function<void(Model::ValidateConfigurationSettingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ValidateConfigurationSettingsAsync(request, [complete](const ElasticBeanstalkClient*, const Model::ValidateConfigurationSettingsRequest&, const Model::ValidateConfigurationSettingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ValidateConfigurationSettingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -105,7 +105,7 @@ CreateFileSystemOutcome EFSClient::CreateFileSystem(const CreateFileSystemReques
   Aws::StringStream ss;
   ss << m_uri << "/2015-02-01/file-systems";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateFileSystem");
   if(outcome.IsSuccess())
   {
     return CreateFileSystemOutcome(CreateFileSystemResult(outcome.GetResult()));
@@ -118,17 +118,42 @@ CreateFileSystemOutcome EFSClient::CreateFileSystem(const CreateFileSystemReques
 
 CreateFileSystemOutcomeCallable EFSClient::CreateFileSystemCallable(const CreateFileSystemRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::CreateFileSystem, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateFileSystemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateFileSystem( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateFileSystemOutcome > rejected;
+    rejected.set_value(CreateFileSystemOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::CreateFileSystemAsync(const CreateFileSystemRequest& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::CreateFileSystemAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::CreateFileSystemAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateFileSystemOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::CreateFileSystemAsyncHelper(const CreateFileSystemRequest& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateFileSystem(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/file-systems";
+
+  auto sharedRequest = Aws::MakeShared<CreateFileSystemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateFileSystem", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateFileSystemOutcome(CreateFileSystemResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateFileSystemOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateMountTargetOutcome EFSClient::CreateMountTarget(const CreateMountTargetRequest& request) const
@@ -136,7 +161,7 @@ CreateMountTargetOutcome EFSClient::CreateMountTarget(const CreateMountTargetReq
   Aws::StringStream ss;
   ss << m_uri << "/2015-02-01/mount-targets";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateMountTarget");
   if(outcome.IsSuccess())
   {
     return CreateMountTargetOutcome(CreateMountTargetResult(outcome.GetResult()));
@@ -149,17 +174,42 @@ CreateMountTargetOutcome EFSClient::CreateMountTarget(const CreateMountTargetReq
 
 CreateMountTargetOutcomeCallable EFSClient::CreateMountTargetCallable(const CreateMountTargetRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::CreateMountTarget, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateMountTargetOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateMountTarget( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateMountTargetOutcome > rejected;
+    rejected.set_value(CreateMountTargetOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::CreateMountTargetAsync(const CreateMountTargetRequest& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::CreateMountTargetAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::CreateMountTargetAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateMountTargetOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::CreateMountTargetAsyncHelper(const CreateMountTargetRequest& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateMountTarget(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/mount-targets";
+
+  auto sharedRequest = Aws::MakeShared<CreateMountTargetRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateMountTarget", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateMountTargetOutcome(CreateMountTargetResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateMountTargetOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateTagsOutcome EFSClient::CreateTags(const CreateTagsRequest& request) const
@@ -168,7 +218,7 @@ CreateTagsOutcome EFSClient::CreateTags(const CreateTagsRequest& request) const
   ss << m_uri << "/2015-02-01/create-tags/";
   ss << request.GetFileSystemId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateTags");
   if(outcome.IsSuccess())
   {
     return CreateTagsOutcome(NoResult());
@@ -181,17 +231,43 @@ CreateTagsOutcome EFSClient::CreateTags(const CreateTagsRequest& request) const
 
 CreateTagsOutcomeCallable EFSClient::CreateTagsCallable(const CreateTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::CreateTags, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateTags( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateTagsOutcome > rejected;
+    rejected.set_value(CreateTagsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::CreateTagsAsync(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::CreateTagsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::CreateTagsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateTagsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::CreateTagsAsyncHelper(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateTags(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/create-tags/";
+  ss << request.GetFileSystemId();
+
+  auto sharedRequest = Aws::MakeShared<CreateTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateTags", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateTagsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateTagsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteFileSystemOutcome EFSClient::DeleteFileSystem(const DeleteFileSystemRequest& request) const
@@ -200,7 +276,7 @@ DeleteFileSystemOutcome EFSClient::DeleteFileSystem(const DeleteFileSystemReques
   ss << m_uri << "/2015-02-01/file-systems/";
   ss << request.GetFileSystemId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteFileSystem");
   if(outcome.IsSuccess())
   {
     return DeleteFileSystemOutcome(NoResult());
@@ -213,17 +289,43 @@ DeleteFileSystemOutcome EFSClient::DeleteFileSystem(const DeleteFileSystemReques
 
 DeleteFileSystemOutcomeCallable EFSClient::DeleteFileSystemCallable(const DeleteFileSystemRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DeleteFileSystem, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteFileSystemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteFileSystem( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteFileSystemOutcome > rejected;
+    rejected.set_value(DeleteFileSystemOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::DeleteFileSystemAsync(const DeleteFileSystemRequest& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DeleteFileSystemAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::DeleteFileSystemAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteFileSystemOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::DeleteFileSystemAsyncHelper(const DeleteFileSystemRequest& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteFileSystem(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/file-systems/";
+  ss << request.GetFileSystemId();
+
+  auto sharedRequest = Aws::MakeShared<DeleteFileSystemRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteFileSystem", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteFileSystemOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteFileSystemOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteMountTargetOutcome EFSClient::DeleteMountTarget(const DeleteMountTargetRequest& request) const
@@ -232,7 +334,7 @@ DeleteMountTargetOutcome EFSClient::DeleteMountTarget(const DeleteMountTargetReq
   ss << m_uri << "/2015-02-01/mount-targets/";
   ss << request.GetMountTargetId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteMountTarget");
   if(outcome.IsSuccess())
   {
     return DeleteMountTargetOutcome(NoResult());
@@ -245,17 +347,43 @@ DeleteMountTargetOutcome EFSClient::DeleteMountTarget(const DeleteMountTargetReq
 
 DeleteMountTargetOutcomeCallable EFSClient::DeleteMountTargetCallable(const DeleteMountTargetRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DeleteMountTarget, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteMountTargetOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteMountTarget( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteMountTargetOutcome > rejected;
+    rejected.set_value(DeleteMountTargetOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::DeleteMountTargetAsync(const DeleteMountTargetRequest& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DeleteMountTargetAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::DeleteMountTargetAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteMountTargetOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::DeleteMountTargetAsyncHelper(const DeleteMountTargetRequest& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteMountTarget(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/mount-targets/";
+  ss << request.GetMountTargetId();
+
+  auto sharedRequest = Aws::MakeShared<DeleteMountTargetRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteMountTarget", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteMountTargetOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteMountTargetOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteTagsOutcome EFSClient::DeleteTags(const DeleteTagsRequest& request) const
@@ -264,7 +392,7 @@ DeleteTagsOutcome EFSClient::DeleteTags(const DeleteTagsRequest& request) const
   ss << m_uri << "/2015-02-01/delete-tags/";
   ss << request.GetFileSystemId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeleteTags");
   if(outcome.IsSuccess())
   {
     return DeleteTagsOutcome(NoResult());
@@ -277,17 +405,43 @@ DeleteTagsOutcome EFSClient::DeleteTags(const DeleteTagsRequest& request) const
 
 DeleteTagsOutcomeCallable EFSClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DeleteTags, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteTags( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteTagsOutcome > rejected;
+    rejected.set_value(DeleteTagsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DeleteTagsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::DeleteTagsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteTagsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteTags(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/delete-tags/";
+  ss << request.GetFileSystemId();
+
+  auto sharedRequest = Aws::MakeShared<DeleteTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeleteTags", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteTagsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteTagsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeFileSystemsOutcome EFSClient::DescribeFileSystems(const DescribeFileSystemsRequest& request) const
@@ -295,7 +449,7 @@ DescribeFileSystemsOutcome EFSClient::DescribeFileSystems(const DescribeFileSyst
   Aws::StringStream ss;
   ss << m_uri << "/2015-02-01/file-systems";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "DescribeFileSystems");
   if(outcome.IsSuccess())
   {
     return DescribeFileSystemsOutcome(DescribeFileSystemsResult(outcome.GetResult()));
@@ -308,17 +462,42 @@ DescribeFileSystemsOutcome EFSClient::DescribeFileSystems(const DescribeFileSyst
 
 DescribeFileSystemsOutcomeCallable EFSClient::DescribeFileSystemsCallable(const DescribeFileSystemsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DescribeFileSystems, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeFileSystemsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeFileSystems( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeFileSystemsOutcome > rejected;
+    rejected.set_value(DescribeFileSystemsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::DescribeFileSystemsAsync(const DescribeFileSystemsRequest& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DescribeFileSystemsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::DescribeFileSystemsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeFileSystemsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::DescribeFileSystemsAsyncHelper(const DescribeFileSystemsRequest& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeFileSystems(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/file-systems";
+
+  auto sharedRequest = Aws::MakeShared<DescribeFileSystemsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "DescribeFileSystems", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeFileSystemsOutcome(DescribeFileSystemsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeFileSystemsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeMountTargetSecurityGroupsOutcome EFSClient::DescribeMountTargetSecurityGroups(const DescribeMountTargetSecurityGroupsRequest& request) const
@@ -328,7 +507,7 @@ DescribeMountTargetSecurityGroupsOutcome EFSClient::DescribeMountTargetSecurityG
   ss << request.GetMountTargetId();
   ss << "/security-groups";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "DescribeMountTargetSecurityGroups");
   if(outcome.IsSuccess())
   {
     return DescribeMountTargetSecurityGroupsOutcome(DescribeMountTargetSecurityGroupsResult(outcome.GetResult()));
@@ -341,17 +520,44 @@ DescribeMountTargetSecurityGroupsOutcome EFSClient::DescribeMountTargetSecurityG
 
 DescribeMountTargetSecurityGroupsOutcomeCallable EFSClient::DescribeMountTargetSecurityGroupsCallable(const DescribeMountTargetSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DescribeMountTargetSecurityGroups, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeMountTargetSecurityGroupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeMountTargetSecurityGroups( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeMountTargetSecurityGroupsOutcome > rejected;
+    rejected.set_value(DescribeMountTargetSecurityGroupsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::DescribeMountTargetSecurityGroupsAsync(const DescribeMountTargetSecurityGroupsRequest& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DescribeMountTargetSecurityGroupsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::DescribeMountTargetSecurityGroupsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeMountTargetSecurityGroupsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::DescribeMountTargetSecurityGroupsAsyncHelper(const DescribeMountTargetSecurityGroupsRequest& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeMountTargetSecurityGroups(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/mount-targets/";
+  ss << request.GetMountTargetId();
+  ss << "/security-groups";
+
+  auto sharedRequest = Aws::MakeShared<DescribeMountTargetSecurityGroupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "DescribeMountTargetSecurityGroups", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeMountTargetSecurityGroupsOutcome(DescribeMountTargetSecurityGroupsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeMountTargetSecurityGroupsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeMountTargetsOutcome EFSClient::DescribeMountTargets(const DescribeMountTargetsRequest& request) const
@@ -359,7 +565,7 @@ DescribeMountTargetsOutcome EFSClient::DescribeMountTargets(const DescribeMountT
   Aws::StringStream ss;
   ss << m_uri << "/2015-02-01/mount-targets";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "DescribeMountTargets");
   if(outcome.IsSuccess())
   {
     return DescribeMountTargetsOutcome(DescribeMountTargetsResult(outcome.GetResult()));
@@ -372,17 +578,42 @@ DescribeMountTargetsOutcome EFSClient::DescribeMountTargets(const DescribeMountT
 
 DescribeMountTargetsOutcomeCallable EFSClient::DescribeMountTargetsCallable(const DescribeMountTargetsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DescribeMountTargets, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeMountTargetsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeMountTargets( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeMountTargetsOutcome > rejected;
+    rejected.set_value(DescribeMountTargetsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::DescribeMountTargetsAsync(const DescribeMountTargetsRequest& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DescribeMountTargetsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::DescribeMountTargetsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeMountTargetsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::DescribeMountTargetsAsyncHelper(const DescribeMountTargetsRequest& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeMountTargets(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/mount-targets";
+
+  auto sharedRequest = Aws::MakeShared<DescribeMountTargetsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "DescribeMountTargets", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeMountTargetsOutcome(DescribeMountTargetsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeMountTargetsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeTagsOutcome EFSClient::DescribeTags(const DescribeTagsRequest& request) const
@@ -392,7 +623,7 @@ DescribeTagsOutcome EFSClient::DescribeTags(const DescribeTagsRequest& request)
   ss << request.GetFileSystemId();
   ss << "/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "DescribeTags");
   if(outcome.IsSuccess())
   {
     return DescribeTagsOutcome(DescribeTagsResult(outcome.GetResult()));
@@ -405,17 +636,44 @@ DescribeTagsOutcome EFSClient::DescribeTags(const DescribeTagsRequest& request)
 
 DescribeTagsOutcomeCallable EFSClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DescribeTags, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeTagsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTags( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeTagsOutcome > rejected;
+    rejected.set_value(DescribeTagsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DescribeTagsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::DescribeTagsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeTagsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeTags(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/tags/";
+  ss << request.GetFileSystemId();
+  ss << "/";
+
+  auto sharedRequest = Aws::MakeShared<DescribeTagsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "DescribeTags", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeTagsOutcome(DescribeTagsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeTagsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ModifyMountTargetSecurityGroupsOutcome EFSClient::ModifyMountTargetSecurityGroups(const ModifyMountTargetSecurityGroupsRequest& request) const
@@ -425,7 +683,7 @@ ModifyMountTargetSecurityGroupsOutcome EFSClient::ModifyMountTargetSecurityGroup
   ss << request.GetMountTargetId();
   ss << "/security-groups";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "ModifyMountTargetSecurityGroups");
   if(outcome.IsSuccess())
   {
     return ModifyMountTargetSecurityGroupsOutcome(NoResult());
@@ -438,16 +696,43 @@ ModifyMountTargetSecurityGroupsOutcome EFSClient::ModifyMountTargetSecurityGroup
 
 ModifyMountTargetSecurityGroupsOutcomeCallable EFSClient::ModifyMountTargetSecurityGroupsCallable(const ModifyMountTargetSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::ModifyMountTargetSecurityGroups, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ModifyMountTargetSecurityGroupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ModifyMountTargetSecurityGroups( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ModifyMountTargetSecurityGroupsOutcome > rejected;
+    rejected.set_value(ModifyMountTargetSecurityGroupsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void EFSClient::ModifyMountTargetSecurityGroupsAsync(const ModifyMountTargetSecurityGroupsRequest& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::ModifyMountTargetSecurityGroupsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&EFSClient::ModifyMountTargetSecurityGroupsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ModifyMountTargetSecurityGroupsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void EFSClient::ModifyMountTargetSecurityGroupsAsyncHelper(const ModifyMountTargetSecurityGroupsRequest& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ModifyMountTargetSecurityGroups(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-02-01/mount-targets/";
+  ss << request.GetMountTargetId();
+  ss << "/security-groups";
+
+  auto sharedRequest = Aws::MakeShared<ModifyMountTargetSecurityGroupsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "ModifyMountTargetSecurityGroups", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ModifyMountTargetSecurityGroupsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ModifyMountTargetSecurityGroupsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
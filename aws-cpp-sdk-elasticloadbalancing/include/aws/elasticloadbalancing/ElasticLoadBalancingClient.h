@@ -49,6 +49,7 @@
 #include <aws/elasticloadbalancing/model/SetLoadBalancerPoliciesForBackendServerResult.h>
 #include <aws/elasticloadbalancing/model/SetLoadBalancerPoliciesOfListenerResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -287,6 +288,32 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds the specified tags to the specified load balancer. Each load balancer
+         * can have a maximum of 10 tags.</p> <p>Each tag consists of a key and an optional
+         * value. If a tag with the same key is already associated with the load balancer,
+         * <code>AddTags</code> updates its value.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/add-remove-tags.html">Tag
+         * Your Load Balancer</a> in the <i>Elastic Load Balancing Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsOutcome> AddTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsOutcome>([this, request](const std::function<void(Model::AddTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::AddTagsRequest&, const Model::AddTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Associates one or more security groups with your load balancer in a virtual
          * private cloud (VPC). The specified security groups override the previously
@@ -321,6 +348,32 @@ namespace Model
          */
         virtual void ApplySecurityGroupsToLoadBalancerAsync(const Model::ApplySecurityGroupsToLoadBalancerRequest& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Associates one or more security groups with your load balancer in a virtual
+         * private cloud (VPC). The specified security groups override the previously
+         * associated security groups.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/elb-security-groups.html#elb-vpc-security-groups">Security
+         * Groups for Load Balancers in a VPC</a> in the <i>Elastic Load Balancing
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ApplySecurityGroupsToLoadBalancerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ApplySecurityGroupsToLoadBalancerRequest>
+        Aws::Utils::Threading::Awaitable<Model::ApplySecurityGroupsToLoadBalancerOutcome> ApplySecurityGroupsToLoadBalancerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ApplySecurityGroupsToLoadBalancerOutcome>([this, request](const std::function<void(Model::ApplySecurityGroupsToLoadBalancerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ApplySecurityGroupsToLoadBalancerAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::ApplySecurityGroupsToLoadBalancerRequest&, const Model::ApplySecurityGroupsToLoadBalancerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ApplySecurityGroupsToLoadBalancerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds one or more subnets to the set of configured subnets for the specified
          * load balancer.</p> <p>The load balancer evenly distributes requests across all
@@ -355,6 +408,32 @@ namespace Model
          */
         virtual void AttachLoadBalancerToSubnetsAsync(const Model::AttachLoadBalancerToSubnetsRequest& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds one or more subnets to the set of configured subnets for the specified
+         * load balancer.</p> <p>The load balancer evenly distributes requests across all
+         * registered subnets. For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/elb-manage-subnets.html">Add
+         * or Remove Subnets for Your Load Balancer in a VPC</a> in the <i>Elastic Load
+         * Balancing Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachLoadBalancerToSubnetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachLoadBalancerToSubnetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachLoadBalancerToSubnetsOutcome> AttachLoadBalancerToSubnetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachLoadBalancerToSubnetsOutcome>([this, request](const std::function<void(Model::AttachLoadBalancerToSubnetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachLoadBalancerToSubnetsAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::AttachLoadBalancerToSubnetsRequest&, const Model::AttachLoadBalancerToSubnetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachLoadBalancerToSubnetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Specifies the health check settings to use when evaluating the health state
          * of your back-end instances.</p> <p>For more information, see <a
@@ -383,6 +462,30 @@ namespace Model
          */
         virtual void ConfigureHealthCheckAsync(const Model::ConfigureHealthCheckRequest& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Specifies the health check settings to use when evaluating the health state
+         * of your back-end instances.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/elb-healthchecks.html">Configure
+         * Health Checks</a> in the <i>Elastic Load Balancing Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ConfigureHealthCheckAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ConfigureHealthCheckRequest>
+        Aws::Utils::Threading::Awaitable<Model::ConfigureHealthCheckOutcome> ConfigureHealthCheckAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ConfigureHealthCheckOutcome>([this, request](const std::function<void(Model::ConfigureHealthCheckOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ConfigureHealthCheckAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::ConfigureHealthCheckRequest&, const Model::ConfigureHealthCheckOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ConfigureHealthCheckOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Generates a stickiness policy with sticky session lifetimes that follow that
          * of an application-generated cookie. This policy can be associated only with
@@ -435,6 +538,38 @@ namespace Model
          */
         virtual void CreateAppCookieStickinessPolicyAsync(const Model::CreateAppCookieStickinessPolicyRequest& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Generates a stickiness policy with sticky session lifetimes that follow that
+         * of an application-generated cookie. This policy can be associated only with
+         * HTTP/HTTPS listeners.</p> <p>This policy is similar to the policy created by
+         * <a>CreateLBCookieStickinessPolicy</a>, except that the lifetime of the special
+         * Elastic Load Balancing cookie, <code>AWSELB</code>, follows the lifetime of the
+         * application-generated cookie specified in the policy configuration. The load
+         * balancer only inserts a new stickiness cookie when the application response
+         * includes a new application cookie.</p> <p>If the application cookie is
+         * explicitly removed or expires, the session stops being sticky until a new
+         * application cookie is issued.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/elb-sticky-sessions.html#enable-sticky-sessions-application">Application-Controlled
+         * Session Stickiness</a> in the <i>Elastic Load Balancing Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateAppCookieStickinessPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAppCookieStickinessPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAppCookieStickinessPolicyOutcome> CreateAppCookieStickinessPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAppCookieStickinessPolicyOutcome>([this, request](const std::function<void(Model::CreateAppCookieStickinessPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAppCookieStickinessPolicyAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::CreateAppCookieStickinessPolicyRequest&, const Model::CreateAppCookieStickinessPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAppCookieStickinessPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Generates a stickiness policy with sticky session lifetimes controlled by the
          * lifetime of the browser (user-agent) or a specified expiration period. This
@@ -496,6 +631,41 @@ namespace Model
          */
         virtual void CreateLBCookieStickinessPolicyAsync(const Model::CreateLBCookieStickinessPolicyRequest& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Generates a stickiness policy with sticky session lifetimes controlled by the
+         * lifetime of the browser (user-agent) or a specified expiration period. This
+         * policy can be associated only with HTTP/HTTPS listeners.</p> <p>When a load
+         * balancer implements this policy, the load balancer uses a special cookie to
+         * track the back-end server instance for each request. When the load balancer
+         * receives a request, it first checks to see if this cookie is present in the
+         * request. If so, the load balancer sends the request to the application server
+         * specified in the cookie. If not, the load balancer sends the request to a server
+         * that is chosen based on the existing load-balancing algorithm.</p> <p>A cookie
+         * is inserted into the response for binding subsequent requests from the same user
+         * to that server. The validity of the cookie is based on the cookie expiration
+         * time, which is specified in the policy configuration.</p> <p>For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/elb-sticky-sessions.html#enable-sticky-sessions-duration">Duration-Based
+         * Session Stickiness</a> in the <i>Elastic Load Balancing Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateLBCookieStickinessPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateLBCookieStickinessPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateLBCookieStickinessPolicyOutcome> CreateLBCookieStickinessPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateLBCookieStickinessPolicyOutcome>([this, request](const std::function<void(Model::CreateLBCookieStickinessPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateLBCookieStickinessPolicyAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::CreateLBCookieStickinessPolicyRequest&, const Model::CreateLBCookieStickinessPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateLBCookieStickinessPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a load balancer.</p> <p>If the call completes successfully, a new
          * load balancer is created with a unique Domain Name Service (DNS) name. The load
@@ -548,6 +718,38 @@ namespace Model
          */
         virtual void CreateLoadBalancerAsync(const Model::CreateLoadBalancerRequest& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a load balancer.</p> <p>If the call completes successfully, a new
+         * load balancer is created with a unique Domain Name Service (DNS) name. The load
+         * balancer receives incoming traffic and routes it to the registered instances.
+         * For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/how-elb-works.html">How
+         * Elastic Load Balancing Works</a> in the <i>Elastic Load Balancing Developer
+         * Guide</i>.</p> <p>You can create up to 20 load balancers per region per account.
+         * You can request an increase for the number of load balancers for your account.
+         * For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/elb-limits.html">Elastic
+         * Load Balancing Limits</a> in the <i>Elastic Load Balancing Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateLoadBalancerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateLoadBalancerRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateLoadBalancerOutcome> CreateLoadBalancerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateLoadBalancerOutcome>([this, request](const std::function<void(Model::CreateLoadBalancerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateLoadBalancerAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::CreateLoadBalancerRequest&, const Model::CreateLoadBalancerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateLoadBalancerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates one or more listeners for the specified load balancer. If a listener
          * with the specified port does not already exist, it is created; otherwise, the
@@ -585,6 +787,33 @@ namespace Model
          */
         virtual void CreateLoadBalancerListenersAsync(const Model::CreateLoadBalancerListenersRequest& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates one or more listeners for the specified load balancer. If a listener
+         * with the specified port does not already exist, it is created; otherwise, the
+         * properties of the new listener must match the properties of the existing
+         * listener.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/us-add-listener.html">Add
+         * a Listener to Your Load Balancer</a> in the <i>Elastic Load Balancing Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateLoadBalancerListenersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateLoadBalancerListenersRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateLoadBalancerListenersOutcome> CreateLoadBalancerListenersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateLoadBalancerListenersOutcome>([this, request](const std::function<void(Model::CreateLoadBalancerListenersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateLoadBalancerListenersAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::CreateLoadBalancerListenersRequest&, const Model::CreateLoadBalancerListenersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateLoadBalancerListenersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a policy with the specified attributes for the specified load
          * balancer.</p> <p>Policies are settings that are saved for your load balancer and
@@ -613,6 +842,30 @@ namespace Model
          */
         virtual void CreateLoadBalancerPolicyAsync(const Model::CreateLoadBalancerPolicyRequest& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a policy with the specified attributes for the specified load
+         * balancer.</p> <p>Policies are settings that are saved for your load balancer and
+         * that can be applied to the front-end listener or the back-end application
+         * server, depending on the policy type.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateLoadBalancerPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateLoadBalancerPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateLoadBalancerPolicyOutcome> CreateLoadBalancerPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateLoadBalancerPolicyOutcome>([this, request](const std::function<void(Model::CreateLoadBalancerPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateLoadBalancerPolicyAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::CreateLoadBalancerPolicyRequest&, const Model::CreateLoadBalancerPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateLoadBalancerPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified load balancer.</p> <p>If you are attempting to recreate
          * a load balancer, you must reconfigure all settings. The DNS name associated with
@@ -650,6 +903,33 @@ namespace Model
          */
         virtual void DeleteLoadBalancerAsync(const Model::DeleteLoadBalancerRequest& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified load balancer.</p> <p>If you are attempting to recreate
+         * a load balancer, you must reconfigure all settings. The DNS name associated with
+         * a deleted load balancer are no longer usable. The name and associated DNS record
+         * of the deleted load balancer no longer exist and traffic sent to any of its IP
+         * addresses is no longer delivered to back-end instances.</p> <p>If the load
+         * balancer does not exist or has already been deleted, the call to
+         * <code>DeleteLoadBalancer</code> still succeeds.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteLoadBalancerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteLoadBalancerRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteLoadBalancerOutcome> DeleteLoadBalancerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteLoadBalancerOutcome>([this, request](const std::function<void(Model::DeleteLoadBalancerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteLoadBalancerAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DeleteLoadBalancerRequest&, const Model::DeleteLoadBalancerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteLoadBalancerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified listeners from the specified load balancer.</p>
          */
@@ -669,6 +949,27 @@ namespace Model
          */
         virtual void DeleteLoadBalancerListenersAsync(const Model::DeleteLoadBalancerListenersRequest& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified listeners from the specified load balancer.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteLoadBalancerListenersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteLoadBalancerListenersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteLoadBalancerListenersOutcome> DeleteLoadBalancerListenersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteLoadBalancerListenersOutcome>([this, request](const std::function<void(Model::DeleteLoadBalancerListenersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteLoadBalancerListenersAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DeleteLoadBalancerListenersRequest&, const Model::DeleteLoadBalancerListenersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteLoadBalancerListenersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified policy from the specified load balancer. This policy
          * must not be enabled for any listeners.</p>
@@ -691,6 +992,28 @@ namespace Model
          */
         virtual void DeleteLoadBalancerPolicyAsync(const Model::DeleteLoadBalancerPolicyRequest& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified policy from the specified load balancer. This policy
+         * must not be enabled for any listeners.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteLoadBalancerPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteLoadBalancerPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteLoadBalancerPolicyOutcome> DeleteLoadBalancerPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteLoadBalancerPolicyOutcome>([this, request](const std::function<void(Model::DeleteLoadBalancerPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteLoadBalancerPolicyAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DeleteLoadBalancerPolicyRequest&, const Model::DeleteLoadBalancerPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteLoadBalancerPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deregisters the specified instances from the specified load balancer. After
          * the instance is deregistered, it no longer receives traffic from the load
@@ -731,6 +1054,34 @@ namespace Model
          */
         virtual void DeregisterInstancesFromLoadBalancerAsync(const Model::DeregisterInstancesFromLoadBalancerRequest& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deregisters the specified instances from the specified load balancer. After
+         * the instance is deregistered, it no longer receives traffic from the load
+         * balancer.</p> <p>You can use <a>DescribeLoadBalancers</a> to verify that the
+         * instance is deregistered from the load balancer.</p> <p>For more information,
+         * see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/US_DeReg_Reg_Instances.html">Deregister
+         * and Register Amazon EC2 Instances</a> in the <i>Elastic Load Balancing Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterInstancesFromLoadBalancerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterInstancesFromLoadBalancerRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterInstancesFromLoadBalancerOutcome> DeregisterInstancesFromLoadBalancerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterInstancesFromLoadBalancerOutcome>([this, request](const std::function<void(Model::DeregisterInstancesFromLoadBalancerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterInstancesFromLoadBalancerAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DeregisterInstancesFromLoadBalancerRequest&, const Model::DeregisterInstancesFromLoadBalancerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterInstancesFromLoadBalancerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the state of the specified instances with respect to the specified
          * load balancer. If no instances are specified, the call describes the state of
@@ -762,6 +1113,31 @@ namespace Model
          */
         virtual void DescribeInstanceHealthAsync(const Model::DescribeInstanceHealthRequest& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the state of the specified instances with respect to the specified
+         * load balancer. If no instances are specified, the call describes the state of
+         * all instances that are currently registered with the load balancer. If instances
+         * are specified, their state is returned even if they are no longer registered
+         * with the load balancer. The state of terminated instances is not returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeInstanceHealthAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeInstanceHealthRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeInstanceHealthOutcome> DescribeInstanceHealthAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeInstanceHealthOutcome>([this, request](const std::function<void(Model::DescribeInstanceHealthOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeInstanceHealthAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DescribeInstanceHealthRequest&, const Model::DescribeInstanceHealthOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeInstanceHealthOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the attributes for the specified load balancer.</p>
          */
@@ -781,6 +1157,27 @@ namespace Model
          */
         virtual void DescribeLoadBalancerAttributesAsync(const Model::DescribeLoadBalancerAttributesRequest& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the attributes for the specified load balancer.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLoadBalancerAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLoadBalancerAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLoadBalancerAttributesOutcome> DescribeLoadBalancerAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLoadBalancerAttributesOutcome>([this, request](const std::function<void(Model::DescribeLoadBalancerAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLoadBalancerAttributesAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DescribeLoadBalancerAttributesRequest&, const Model::DescribeLoadBalancerAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLoadBalancerAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified policies.</p> <p>If you specify a load balancer name,
          * the action returns the descriptions of all policies created for the load
@@ -818,6 +1215,33 @@ namespace Model
          */
         virtual void DescribeLoadBalancerPoliciesAsync(const Model::DescribeLoadBalancerPoliciesRequest& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified policies.</p> <p>If you specify a load balancer name,
+         * the action returns the descriptions of all policies created for the load
+         * balancer. If you specify a policy name associated with your load balancer, the
+         * action returns the description of that policy. If you don't specify a load
+         * balancer name, the action returns descriptions of the specified sample policies,
+         * or descriptions of all sample policies. The names of the sample policies have
+         * the <code>ELBSample-</code> prefix.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLoadBalancerPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLoadBalancerPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLoadBalancerPoliciesOutcome> DescribeLoadBalancerPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLoadBalancerPoliciesOutcome>([this, request](const std::function<void(Model::DescribeLoadBalancerPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLoadBalancerPoliciesAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DescribeLoadBalancerPoliciesRequest&, const Model::DescribeLoadBalancerPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLoadBalancerPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified load balancer policy types.</p> <p>You can use these
          * policy types with <a>CreateLoadBalancerPolicy</a> to create policy
@@ -843,6 +1267,29 @@ namespace Model
          */
         virtual void DescribeLoadBalancerPolicyTypesAsync(const Model::DescribeLoadBalancerPolicyTypesRequest& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified load balancer policy types.</p> <p>You can use these
+         * policy types with <a>CreateLoadBalancerPolicy</a> to create policy
+         * configurations for a load balancer.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLoadBalancerPolicyTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLoadBalancerPolicyTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLoadBalancerPolicyTypesOutcome> DescribeLoadBalancerPolicyTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLoadBalancerPolicyTypesOutcome>([this, request](const std::function<void(Model::DescribeLoadBalancerPolicyTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLoadBalancerPolicyTypesAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DescribeLoadBalancerPolicyTypesRequest&, const Model::DescribeLoadBalancerPolicyTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLoadBalancerPolicyTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified the load balancers. If no load balancers are
          * specified, the call describes all of your load balancers.</p>
@@ -865,6 +1312,28 @@ namespace Model
          */
         virtual void DescribeLoadBalancersAsync(const Model::DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified the load balancers. If no load balancers are
+         * specified, the call describes all of your load balancers.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLoadBalancersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLoadBalancersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLoadBalancersOutcome>([this, request](const std::function<void(Model::DescribeLoadBalancersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLoadBalancersAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DescribeLoadBalancersRequest&, const Model::DescribeLoadBalancersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLoadBalancersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the tags associated with the specified load balancers.</p>
          */
@@ -884,6 +1353,27 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the tags associated with the specified load balancers.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTagsOutcome>([this, request](const std::function<void(Model::DescribeTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTagsAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DescribeTagsRequest&, const Model::DescribeTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified subnets from the set of configured subnets for the load
          * balancer.</p> <p>After a subnet is removed, all EC2 instances registered with
@@ -915,6 +1405,31 @@ namespace Model
          */
         virtual void DetachLoadBalancerFromSubnetsAsync(const Model::DetachLoadBalancerFromSubnetsRequest& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified subnets from the set of configured subnets for the load
+         * balancer.</p> <p>After a subnet is removed, all EC2 instances registered with
+         * the load balancer in the removed subnet go into the <code>OutOfService</code>
+         * state. Then, the load balancer balances the traffic among the remaining routable
+         * subnets.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachLoadBalancerFromSubnetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachLoadBalancerFromSubnetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachLoadBalancerFromSubnetsOutcome> DetachLoadBalancerFromSubnetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachLoadBalancerFromSubnetsOutcome>([this, request](const std::function<void(Model::DetachLoadBalancerFromSubnetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachLoadBalancerFromSubnetsAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DetachLoadBalancerFromSubnetsRequest&, const Model::DetachLoadBalancerFromSubnetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachLoadBalancerFromSubnetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified Availability Zones from the set of Availability Zones
          * for the specified load balancer.</p> <p>There must be at least one Availability
@@ -961,6 +1476,36 @@ namespace Model
          */
         virtual void DisableAvailabilityZonesForLoadBalancerAsync(const Model::DisableAvailabilityZonesForLoadBalancerRequest& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified Availability Zones from the set of Availability Zones
+         * for the specified load balancer.</p> <p>There must be at least one Availability
+         * Zone registered with a load balancer at all times. After an Availability Zone is
+         * removed, all instances registered with the load balancer that are in the removed
+         * Availability Zone go into the <code>OutOfService</code> state. Then, the load
+         * balancer attempts to equally balance the traffic among its remaining
+         * Availability Zones.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/US_ShrinkLBApp04.html">Disable
+         * an Availability Zone from a Load-Balanced Application</a> in the <i>Elastic Load
+         * Balancing Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableAvailabilityZonesForLoadBalancerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableAvailabilityZonesForLoadBalancerRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableAvailabilityZonesForLoadBalancerOutcome> DisableAvailabilityZonesForLoadBalancerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableAvailabilityZonesForLoadBalancerOutcome>([this, request](const std::function<void(Model::DisableAvailabilityZonesForLoadBalancerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableAvailabilityZonesForLoadBalancerAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::DisableAvailabilityZonesForLoadBalancerRequest&, const Model::DisableAvailabilityZonesForLoadBalancerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableAvailabilityZonesForLoadBalancerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds the specified Availability Zones to the set of Availability Zones for
          * the specified load balancer.</p> <p>The load balancer evenly distributes
@@ -995,6 +1540,32 @@ namespace Model
          */
         virtual void EnableAvailabilityZonesForLoadBalancerAsync(const Model::EnableAvailabilityZonesForLoadBalancerRequest& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds the specified Availability Zones to the set of Availability Zones for
+         * the specified load balancer.</p> <p>The load balancer evenly distributes
+         * requests across all its registered Availability Zones that contain
+         * instances.</p> <p>For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/US_AddLBAvailabilityZone.html">Add
+         * Availability Zone</a> in the <i>Elastic Load Balancing Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableAvailabilityZonesForLoadBalancerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableAvailabilityZonesForLoadBalancerRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableAvailabilityZonesForLoadBalancerOutcome> EnableAvailabilityZonesForLoadBalancerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableAvailabilityZonesForLoadBalancerOutcome>([this, request](const std::function<void(Model::EnableAvailabilityZonesForLoadBalancerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableAvailabilityZonesForLoadBalancerAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::EnableAvailabilityZonesForLoadBalancerRequest&, const Model::EnableAvailabilityZonesForLoadBalancerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableAvailabilityZonesForLoadBalancerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the attributes of the specified load balancer.</p> <p>You can modify
          * the load balancer attributes, such as <code>AccessLogs</code>,
@@ -1056,6 +1627,41 @@ namespace Model
          */
         virtual void ModifyLoadBalancerAttributesAsync(const Model::ModifyLoadBalancerAttributesRequest& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the attributes of the specified load balancer.</p> <p>You can modify
+         * the load balancer attributes, such as <code>AccessLogs</code>,
+         * <code>ConnectionDraining</code>, and <code>CrossZoneLoadBalancing</code> by
+         * either enabling or disabling them. Or, you can modify the load balancer
+         * attribute <code>ConnectionSettings</code> by specifying an idle connection
+         * timeout value for your load balancer.</p> <p>For more information, see the
+         * following in the <i>Elastic Load Balancing Developer Guide</i>:</p> <ul> <li><a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/TerminologyandKeyConcepts.html#request-routing">Cross-Zone
+         * Load Balancing</a></li> <li><a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/TerminologyandKeyConcepts.html#conn-drain">Connection
+         * Draining</a></li> <li><a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/access-log-collection.html">Access
+         * Logs</a></li> <li><a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/TerminologyandKeyConcepts.html#idle-timeout">Idle
+         * Connection Timeout</a></li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way ModifyLoadBalancerAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyLoadBalancerAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyLoadBalancerAttributesOutcome> ModifyLoadBalancerAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyLoadBalancerAttributesOutcome>([this, request](const std::function<void(Model::ModifyLoadBalancerAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyLoadBalancerAttributesAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::ModifyLoadBalancerAttributesRequest&, const Model::ModifyLoadBalancerAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyLoadBalancerAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds the specified instances to the specified load balancer.</p> <p>The
          * instance must be a running instance in the same network as the load balancer
@@ -1147,6 +1753,51 @@ namespace Model
          */
         virtual void RegisterInstancesWithLoadBalancerAsync(const Model::RegisterInstancesWithLoadBalancerRequest& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds the specified instances to the specified load balancer.</p> <p>The
+         * instance must be a running instance in the same network as the load balancer
+         * (EC2-Classic or the same VPC). If you have EC2-Classic instances and a load
+         * balancer in a VPC with ClassicLink enabled, you can link the EC2-Classic
+         * instances to that VPC and then register the linked EC2-Classic instances with
+         * the load balancer in the VPC.</p> <p>Note that
+         * <code>RegisterInstanceWithLoadBalancer</code> completes when the request has
+         * been registered. Instance registration takes a little time to complete. To check
+         * the state of the registered instances, use <a>DescribeLoadBalancers</a> or
+         * <a>DescribeInstanceHealth</a>.</p> <p>After the instance is registered, it
+         * starts receiving traffic and requests from the load balancer. Any instance that
+         * is not in one of the Availability Zones registered for the load balancer is
+         * moved to the <code>OutOfService</code> state. If an Availability Zone is added
+         * to the load balancer later, any instances registered with the load balancer move
+         * to the <code>InService</code> state.</p> <p>If you stop an instance registered
+         * with a load balancer and then start it, the IP addresses associated with the
+         * instance changes. Elastic Load Balancing cannot recognize the new IP address,
+         * which prevents it from routing traffic to the instances. We recommend that you
+         * use the following sequence: stop the instance, deregister the instance, start
+         * the instance, and then register the instance. To deregister instances from a
+         * load balancer, use <a>DeregisterInstancesFromLoadBalancer</a>.</p> <p>For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/US_DeReg_Reg_Instances.html">Deregister
+         * and Register EC2 Instances</a> in the <i>Elastic Load Balancing Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterInstancesWithLoadBalancerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterInstancesWithLoadBalancerRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterInstancesWithLoadBalancerOutcome> RegisterInstancesWithLoadBalancerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterInstancesWithLoadBalancerOutcome>([this, request](const std::function<void(Model::RegisterInstancesWithLoadBalancerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterInstancesWithLoadBalancerAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::RegisterInstancesWithLoadBalancerRequest&, const Model::RegisterInstancesWithLoadBalancerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterInstancesWithLoadBalancerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes one or more tags from the specified load balancer.</p>
          */
@@ -1166,6 +1817,27 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes one or more tags from the specified load balancer.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsOutcome>([this, request](const std::function<void(Model::RemoveTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::RemoveTagsRequest&, const Model::RemoveTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the certificate that terminates the specified listener's SSL
          * connections. The specified certificate replaces any prior certificate that was
@@ -1203,6 +1875,33 @@ namespace Model
          */
         virtual void SetLoadBalancerListenerSSLCertificateAsync(const Model::SetLoadBalancerListenerSSLCertificateRequest& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the certificate that terminates the specified listener's SSL
+         * connections. The specified certificate replaces any prior certificate that was
+         * used on the same load balancer and port.</p> <p>For more information about
+         * updating your SSL certificate, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/US_UpdatingLoadBalancerSSL.html">Updating
+         * an SSL Certificate for a Load Balancer</a> in the <i>Elastic Load Balancing
+         * Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetLoadBalancerListenerSSLCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetLoadBalancerListenerSSLCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetLoadBalancerListenerSSLCertificateOutcome> SetLoadBalancerListenerSSLCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetLoadBalancerListenerSSLCertificateOutcome>([this, request](const std::function<void(Model::SetLoadBalancerListenerSSLCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetLoadBalancerListenerSSLCertificateAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::SetLoadBalancerListenerSSLCertificateRequest&, const Model::SetLoadBalancerListenerSSLCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetLoadBalancerListenerSSLCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Replaces the set of policies associated with the specified port on which the
          * back-end server is listening with a new set of policies. At this time, only the
@@ -1246,6 +1945,35 @@ namespace Model
          */
         virtual void SetLoadBalancerPoliciesForBackendServerAsync(const Model::SetLoadBalancerPoliciesForBackendServerRequest& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Replaces the set of policies associated with the specified port on which the
+         * back-end server is listening with a new set of policies. At this time, only the
+         * back-end server authentication policy type can be applied to the back-end ports;
+         * this policy type is composed of multiple public key policies.</p> <p>Each time
+         * you use <code>SetLoadBalancerPoliciesForBackendServer</code> to enable the
+         * policies, use the <code>PolicyNames</code> parameter to list the policies that
+         * you want to enable.</p> <p>You can use <a>DescribeLoadBalancers</a> or
+         * <a>DescribeLoadBalancerPolicies</a> to verify that the policy is associated with
+         * the back-end server.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetLoadBalancerPoliciesForBackendServerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetLoadBalancerPoliciesForBackendServerRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetLoadBalancerPoliciesForBackendServerOutcome> SetLoadBalancerPoliciesForBackendServerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetLoadBalancerPoliciesForBackendServerOutcome>([this, request](const std::function<void(Model::SetLoadBalancerPoliciesForBackendServerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetLoadBalancerPoliciesForBackendServerAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::SetLoadBalancerPoliciesForBackendServerRequest&, const Model::SetLoadBalancerPoliciesForBackendServerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetLoadBalancerPoliciesForBackendServerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Associates, updates, or disables a policy with a listener for the specified
          * load balancer. You can associate multiple policies with a listener.</p>
@@ -1268,6 +1996,28 @@ namespace Model
          */
         virtual void SetLoadBalancerPoliciesOfListenerAsync(const Model::SetLoadBalancerPoliciesOfListenerRequest& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Associates, updates, or disables a policy with a listener for the specified
+         * load balancer. You can associate multiple policies with a listener.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetLoadBalancerPoliciesOfListenerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetLoadBalancerPoliciesOfListenerRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetLoadBalancerPoliciesOfListenerOutcome> SetLoadBalancerPoliciesOfListenerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetLoadBalancerPoliciesOfListenerOutcome>([this, request](const std::function<void(Model::SetLoadBalancerPoliciesOfListenerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetLoadBalancerPoliciesOfListenerAsync(request, [complete](const ElasticLoadBalancingClient*, const Model::SetLoadBalancerPoliciesOfListenerRequest&, const Model::SetLoadBalancerPoliciesOfListenerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetLoadBalancerPoliciesOfListenerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
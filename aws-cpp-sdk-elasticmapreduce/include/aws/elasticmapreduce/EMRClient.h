@@ -34,6 +34,7 @@
 #include <aws/elasticmapreduce/model/RunJobFlowResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -202,6 +203,27 @@ namespace Model
          */
         virtual void AddInstanceGroupsAsync(const Model::AddInstanceGroupsRequest& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>AddInstanceGroups adds an instance group to a running cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddInstanceGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddInstanceGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddInstanceGroupsOutcome> AddInstanceGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddInstanceGroupsOutcome>([this, request](const std::function<void(Model::AddInstanceGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddInstanceGroupsAsync(request, [complete](const EMRClient*, const Model::AddInstanceGroupsRequest&, const Model::AddInstanceGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddInstanceGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> AddJobFlowSteps adds new steps to a running job flow. A maximum of 256 steps
          * are allowed in each job flow. </p> <p>If your job flow is long-running (such as
@@ -275,6 +297,45 @@ namespace Model
          */
         virtual void AddJobFlowStepsAsync(const Model::AddJobFlowStepsRequest& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> AddJobFlowSteps adds new steps to a running job flow. A maximum of 256 steps
+         * are allowed in each job flow. </p> <p>If your job flow is long-running (such as
+         * a Hive data warehouse) or complex, you may require more than 256 steps to
+         * process your data. You can bypass the 256-step limitation in various ways,
+         * including using the SSH shell to connect to the master node and submitting
+         * queries directly to the software running on the master node, such as Hive and
+         * Hadoop. For more information on how to do this, go to <a
+         * href="http://docs.aws.amazon.com/ElasticMapReduce/latest/DeveloperGuide/AddMoreThan256Steps.html">Add
+         * More than 256 Steps to a Job Flow</a> in the <i>Amazon Elastic MapReduce
+         * Developer's Guide</i>.</p> <p> A step specifies the location of a JAR file
+         * stored either on the master node of the job flow or in Amazon S3. Each step is
+         * performed by the main function of the main class of the JAR file. The main class
+         * can be specified either in the manifest of the JAR or by using the MainFunction
+         * parameter of the step. </p> <p> Elastic MapReduce executes each step in the
+         * order listed. For a step to be considered complete, the main function must exit
+         * with a zero exit code and all Hadoop jobs started while the step was running
+         * must have completed and run successfully. </p> <p> You can only add steps to a
+         * job flow that is in one of the following states: STARTING, BOOTSTRAPPING,
+         * RUNNING, or WAITING.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddJobFlowStepsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddJobFlowStepsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddJobFlowStepsOutcome> AddJobFlowStepsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddJobFlowStepsOutcome>([this, request](const std::function<void(Model::AddJobFlowStepsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddJobFlowStepsAsync(request, [complete](const EMRClient*, const Model::AddJobFlowStepsRequest&, const Model::AddJobFlowStepsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddJobFlowStepsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds tags to an Amazon EMR resource. Tags make it easier to associate
          * clusters in various ways, such as grouping clusters to track your Amazon EMR
@@ -306,6 +367,31 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds tags to an Amazon EMR resource. Tags make it easier to associate
+         * clusters in various ways, such as grouping clusters to track your Amazon EMR
+         * resource allocation costs. For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticMapReduce/latest/DeveloperGuide/emr-plan-tags.html">Tagging
+         * Amazon EMR Resources</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsOutcome> AddTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsOutcome>([this, request](const std::function<void(Model::AddTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsAsync(request, [complete](const EMRClient*, const Model::AddTagsRequest&, const Model::AddTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides cluster-level details including status, hardware and software
          * configuration, VPC settings, and so on. For information about the cluster steps,
@@ -331,6 +417,29 @@ namespace Model
          */
         virtual void DescribeClusterAsync(const Model::DescribeClusterRequest& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides cluster-level details including status, hardware and software
+         * configuration, VPC settings, and so on. For information about the cluster steps,
+         * see <a>ListSteps</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeClusterOutcome> DescribeClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeClusterOutcome>([this, request](const std::function<void(Model::DescribeClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeClusterAsync(request, [complete](const EMRClient*, const Model::DescribeClusterRequest&, const Model::DescribeClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides more detail about the cluster step.</p>
          */
@@ -350,6 +459,27 @@ namespace Model
          */
         virtual void DescribeStepAsync(const Model::DescribeStepRequest& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides more detail about the cluster step.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeStepAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeStepRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeStepOutcome> DescribeStepAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeStepOutcome>([this, request](const std::function<void(Model::DescribeStepOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeStepAsync(request, [complete](const EMRClient*, const Model::DescribeStepRequest&, const Model::DescribeStepOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeStepOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides information about the bootstrap actions associated with a
          * cluster.</p>
@@ -372,6 +502,28 @@ namespace Model
          */
         virtual void ListBootstrapActionsAsync(const Model::ListBootstrapActionsRequest& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides information about the bootstrap actions associated with a
+         * cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListBootstrapActionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListBootstrapActionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListBootstrapActionsOutcome> ListBootstrapActionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListBootstrapActionsOutcome>([this, request](const std::function<void(Model::ListBootstrapActionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListBootstrapActionsAsync(request, [complete](const EMRClient*, const Model::ListBootstrapActionsRequest&, const Model::ListBootstrapActionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListBootstrapActionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides the status of all clusters visible to this AWS account. Allows you
          * to filter the list of clusters based on certain criteria; for example, filtering
@@ -403,6 +555,31 @@ namespace Model
          */
         virtual void ListClustersAsync(const Model::ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides the status of all clusters visible to this AWS account. Allows you
+         * to filter the list of clusters based on certain criteria; for example, filtering
+         * by cluster creation date and time or by status. This call returns a maximum of
+         * 50 clusters per call, but returns a marker to track the paging of the cluster
+         * list across multiple ListClusters calls. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListClustersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListClustersRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListClustersOutcome> ListClustersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListClustersOutcome>([this, request](const std::function<void(Model::ListClustersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListClustersAsync(request, [complete](const EMRClient*, const Model::ListClustersRequest&, const Model::ListClustersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListClustersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides all available details about the instance groups in a cluster.</p>
          */
@@ -422,6 +599,27 @@ namespace Model
          */
         virtual void ListInstanceGroupsAsync(const Model::ListInstanceGroupsRequest& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides all available details about the instance groups in a cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListInstanceGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListInstanceGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListInstanceGroupsOutcome> ListInstanceGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListInstanceGroupsOutcome>([this, request](const std::function<void(Model::ListInstanceGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListInstanceGroupsAsync(request, [complete](const EMRClient*, const Model::ListInstanceGroupsRequest&, const Model::ListInstanceGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListInstanceGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides information about the cluster instances that Amazon EMR provisions
          * on behalf of a user when it creates the cluster. For example, this operation
@@ -453,6 +651,31 @@ namespace Model
          */
         virtual void ListInstancesAsync(const Model::ListInstancesRequest& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides information about the cluster instances that Amazon EMR provisions
+         * on behalf of a user when it creates the cluster. For example, this operation
+         * indicates when the EC2 instances reach the Ready state, when instances become
+         * available to Amazon EMR to use for jobs, and the IP addresses for cluster
+         * instances, etc. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListInstancesOutcome> ListInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListInstancesOutcome>([this, request](const std::function<void(Model::ListInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListInstancesAsync(request, [complete](const EMRClient*, const Model::ListInstancesRequest&, const Model::ListInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides a list of steps for the cluster. </p>
          */
@@ -472,6 +695,27 @@ namespace Model
          */
         virtual void ListStepsAsync(const Model::ListStepsRequest& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides a list of steps for the cluster. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListStepsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListStepsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListStepsOutcome> ListStepsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListStepsOutcome>([this, request](const std::function<void(Model::ListStepsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListStepsAsync(request, [complete](const EMRClient*, const Model::ListStepsRequest&, const Model::ListStepsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListStepsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>ModifyInstanceGroups modifies the number of nodes and configuration settings
          * of an instance group. The input parameters include the new target instance count
@@ -500,6 +744,30 @@ namespace Model
          */
         virtual void ModifyInstanceGroupsAsync(const Model::ModifyInstanceGroupsRequest& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>ModifyInstanceGroups modifies the number of nodes and configuration settings
+         * of an instance group. The input parameters include the new target instance count
+         * for the group and the instance group ID. The call will either succeed or fail
+         * atomically.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyInstanceGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyInstanceGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyInstanceGroupsOutcome> ModifyInstanceGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyInstanceGroupsOutcome>([this, request](const std::function<void(Model::ModifyInstanceGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyInstanceGroupsAsync(request, [complete](const EMRClient*, const Model::ModifyInstanceGroupsRequest&, const Model::ModifyInstanceGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyInstanceGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes tags from an Amazon EMR resource. Tags make it easier to associate
          * clusters in various ways, such as grouping clusters to track your Amazon EMR
@@ -534,6 +802,32 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes tags from an Amazon EMR resource. Tags make it easier to associate
+         * clusters in various ways, such as grouping clusters to track your Amazon EMR
+         * resource allocation costs. For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticMapReduce/latest/DeveloperGuide/emr-plan-tags.html">Tagging
+         * Amazon EMR Resources</a>. </p> <p>The following example removes the stack tag
+         * with value Prod from a cluster:</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsOutcome>([this, request](const std::function<void(Model::RemoveTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsAsync(request, [complete](const EMRClient*, const Model::RemoveTagsRequest&, const Model::RemoveTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> RunJobFlow creates and starts running a new job flow. The job flow will run
          * the steps specified. Once the job flow completes, the cluster is stopped and the
@@ -610,6 +904,46 @@ namespace Model
          */
         virtual void RunJobFlowAsync(const Model::RunJobFlowRequest& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> RunJobFlow creates and starts running a new job flow. The job flow will run
+         * the steps specified. Once the job flow completes, the cluster is stopped and the
+         * HDFS partition is lost. To prevent loss of data, configure the last step of the
+         * job flow to store results in Amazon S3. If the <a>JobFlowInstancesConfig</a>
+         * <code>KeepJobFlowAliveWhenNoSteps</code> parameter is set to <code>TRUE</code>,
+         * the job flow will transition to the WAITING state rather than shutting down once
+         * the steps have completed. </p> <p>For additional protection, you can set the
+         * <a>JobFlowInstancesConfig</a> <code>TerminationProtected</code> parameter to
+         * <code>TRUE</code> to lock the job flow and prevent it from being terminated by
+         * API call, user intervention, or in the event of a job flow error.</p> <p>A
+         * maximum of 256 steps are allowed in each job flow.</p> <p>If your job flow is
+         * long-running (such as a Hive data warehouse) or complex, you may require more
+         * than 256 steps to process your data. You can bypass the 256-step limitation in
+         * various ways, including using the SSH shell to connect to the master node and
+         * submitting queries directly to the software running on the master node, such as
+         * Hive and Hadoop. For more information on how to do this, go to <a
+         * href="http://docs.aws.amazon.com/ElasticMapReduce/latest/DeveloperGuide/AddMoreThan256Steps.html">Add
+         * More than 256 Steps to a Job Flow</a> in the <i>Amazon Elastic MapReduce
+         * Developer's Guide</i>.</p> <p>For long running job flows, we recommend that you
+         * periodically store your results.</p>
+         *
+         * Returns an awaitable that starts the operation the way RunJobFlowAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RunJobFlowRequest>
+        Aws::Utils::Threading::Awaitable<Model::RunJobFlowOutcome> RunJobFlowAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RunJobFlowOutcome>([this, request](const std::function<void(Model::RunJobFlowOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RunJobFlowAsync(request, [complete](const EMRClient*, const Model::RunJobFlowRequest&, const Model::RunJobFlowOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RunJobFlowOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> SetTerminationProtection locks a job flow so the Amazon EC2 instances in the
          * cluster cannot be terminated by user intervention, an API call, or in the event
@@ -671,6 +1005,41 @@ namespace Model
          */
         virtual void SetTerminationProtectionAsync(const Model::SetTerminationProtectionRequest& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> SetTerminationProtection locks a job flow so the Amazon EC2 instances in the
+         * cluster cannot be terminated by user intervention, an API call, or in the event
+         * of a job-flow error. The cluster still terminates upon successful completion of
+         * the job flow. Calling SetTerminationProtection on a job flow is analogous to
+         * calling the Amazon EC2 DisableAPITermination API on all of the EC2 instances in
+         * a cluster.</p> <p> SetTerminationProtection is used to prevent accidental
+         * termination of a job flow and to ensure that in the event of an error, the
+         * instances will persist so you can recover any data stored in their ephemeral
+         * instance storage.</p> <p> To terminate a job flow that has been locked by
+         * setting SetTerminationProtection to <code>true</code>, you must first unlock the
+         * job flow by a subsequent call to SetTerminationProtection in which you set the
+         * value to <code>false</code>. </p> <p> For more information, go to <a
+         * href="http://docs.aws.amazon.com/ElasticMapReduce/latest/DeveloperGuide/UsingEMR_TerminationProtection.html">Protecting
+         * a Job Flow from Termination</a> in the <i>Amazon Elastic MapReduce Developer's
+         * Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way SetTerminationProtectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetTerminationProtectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetTerminationProtectionOutcome> SetTerminationProtectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetTerminationProtectionOutcome>([this, request](const std::function<void(Model::SetTerminationProtectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetTerminationProtectionAsync(request, [complete](const EMRClient*, const Model::SetTerminationProtectionRequest&, const Model::SetTerminationProtectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetTerminationProtectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets whether all AWS Identity and Access Management (IAM) users under your
          * account can access the specified job flows. This action works on running job
@@ -705,6 +1074,32 @@ namespace Model
          */
         virtual void SetVisibleToAllUsersAsync(const Model::SetVisibleToAllUsersRequest& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets whether all AWS Identity and Access Management (IAM) users under your
+         * account can access the specified job flows. This action works on running job
+         * flows. You can also set the visibility of a job flow when you launch it using
+         * the <code>VisibleToAllUsers</code> parameter of <a>RunJobFlow</a>. The
+         * SetVisibleToAllUsers action can be called only by an IAM user who created the
+         * job flow or the AWS account that owns the job flow.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetVisibleToAllUsersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetVisibleToAllUsersRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetVisibleToAllUsersOutcome> SetVisibleToAllUsersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetVisibleToAllUsersOutcome>([this, request](const std::function<void(Model::SetVisibleToAllUsersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetVisibleToAllUsersAsync(request, [complete](const EMRClient*, const Model::SetVisibleToAllUsersRequest&, const Model::SetVisibleToAllUsersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetVisibleToAllUsersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> TerminateJobFlows shuts a list of job flows down. When a job flow is shut
          * down, any step not yet completed is canceled and the EC2 instances on which the
@@ -745,6 +1140,34 @@ namespace Model
          */
         virtual void TerminateJobFlowsAsync(const Model::TerminateJobFlowsRequest& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> TerminateJobFlows shuts a list of job flows down. When a job flow is shut
+         * down, any step not yet completed is canceled and the EC2 instances on which the
+         * job flow is running are stopped. Any log files not already saved are uploaded to
+         * Amazon S3 if a LogUri was specified when the job flow was created. </p> <p> The
+         * maximum number of JobFlows allowed is 10. The call to TerminateJobFlows is
+         * asynchronous. Depending on the configuration of the job flow, it may take up to
+         * 5-20 minutes for the job flow to completely terminate and release allocated
+         * resources, such as Amazon EC2 instances. </p>
+         *
+         * Returns an awaitable that starts the operation the way TerminateJobFlowsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TerminateJobFlowsRequest>
+        Aws::Utils::Threading::Awaitable<Model::TerminateJobFlowsOutcome> TerminateJobFlowsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TerminateJobFlowsOutcome>([this, request](const std::function<void(Model::TerminateJobFlowsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TerminateJobFlowsAsync(request, [complete](const EMRClient*, const Model::TerminateJobFlowsRequest&, const Model::TerminateJobFlowsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TerminateJobFlowsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -38,6 +38,7 @@
 #include <aws/elastictranscoder/model/UpdatePipelineNotificationsResult.h>
 #include <aws/elastictranscoder/model/UpdatePipelineStatusResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -216,6 +217,30 @@ namespace Model
          */
         virtual void CancelJobAsync(const Model::CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The CancelJob operation cancels an unfinished job.</p> <note>You can only
+         * cancel a job that has a status of <code>Submitted</code>. To prevent a pipeline
+         * from starting to process a job while you're getting the job identifier, use
+         * <a>UpdatePipelineStatus</a> to temporarily pause the pipeline.</note>
+         *
+         * Returns an awaitable that starts the operation the way CancelJobAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelJobRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelJobOutcome> CancelJobAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelJobOutcome>([this, request](const std::function<void(Model::CancelJobOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelJobAsync(request, [complete](const ElasticTranscoderClient*, const Model::CancelJobRequest&, const Model::CancelJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelJobOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> When you create a job, Elastic Transcoder returns JSON data that includes
          * the values that you specified plus information about the job that is created.
@@ -250,6 +275,32 @@ namespace Model
          */
         virtual void CreateJobAsync(const Model::CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> When you create a job, Elastic Transcoder returns JSON data that includes
+         * the values that you specified plus information about the job that is created.
+         * </p> <p>If you have specified more than one output for your jobs (for example,
+         * one output for the Kindle Fire and another output for the Apple iPhone 4s), you
+         * currently must use the Elastic Transcoder API to list the jobs (as opposed to
+         * the AWS Console).</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateJobAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateJobRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateJobOutcome> CreateJobAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateJobOutcome>([this, request](const std::function<void(Model::CreateJobOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateJobAsync(request, [complete](const ElasticTranscoderClient*, const Model::CreateJobRequest&, const Model::CreateJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateJobOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The CreatePipeline operation creates a pipeline with settings that you
          * specify.</p>
@@ -272,6 +323,28 @@ namespace Model
          */
         virtual void CreatePipelineAsync(const Model::CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The CreatePipeline operation creates a pipeline with settings that you
+         * specify.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePipelineOutcome> CreatePipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePipelineOutcome>([this, request](const std::function<void(Model::CreatePipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePipelineAsync(request, [complete](const ElasticTranscoderClient*, const Model::CreatePipelineRequest&, const Model::CreatePipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The CreatePreset operation creates a preset with settings that you
          * specify.</p> <important>Elastic Transcoder checks the CreatePreset settings to
@@ -330,6 +403,40 @@ namespace Model
          */
         virtual void CreatePresetAsync(const Model::CreatePresetRequest& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The CreatePreset operation creates a preset with settings that you
+         * specify.</p> <important>Elastic Transcoder checks the CreatePreset settings to
+         * ensure that they meet Elastic Transcoder requirements and to determine whether
+         * they comply with H.264 standards. If your settings are not valid for Elastic
+         * Transcoder, Elastic Transcoder returns an HTTP 400 response
+         * (<code>ValidationException</code>) and does not create the preset. If the
+         * settings are valid for Elastic Transcoder but aren't strictly compliant with the
+         * H.264 standard, Elastic Transcoder creates the preset and returns a warning
+         * message in the response. This helps you determine whether your settings comply
+         * with the H.264 standard while giving you greater flexibility with respect to the
+         * video that Elastic Transcoder produces.</important> <p>Elastic Transcoder uses
+         * the H.264 video-compression format. For more information, see the International
+         * Telecommunication Union publication <i>Recommendation ITU-T H.264: Advanced
+         * video coding for generic audiovisual services</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePresetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePresetRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePresetOutcome> CreatePresetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePresetOutcome>([this, request](const std::function<void(Model::CreatePresetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePresetAsync(request, [complete](const ElasticTranscoderClient*, const Model::CreatePresetRequest&, const Model::CreatePresetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePresetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The DeletePipeline operation removes a pipeline.</p> <p> You can only delete
          * a pipeline that has never been used or that is not currently in use (doesn't
@@ -358,6 +465,30 @@ namespace Model
          */
         virtual void DeletePipelineAsync(const Model::DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The DeletePipeline operation removes a pipeline.</p> <p> You can only delete
+         * a pipeline that has never been used or that is not currently in use (doesn't
+         * contain any active jobs). If the pipeline is currently in use,
+         * <code>DeletePipeline</code> returns an error. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeletePipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeletePipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeletePipelineOutcome> DeletePipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeletePipelineOutcome>([this, request](const std::function<void(Model::DeletePipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeletePipelineAsync(request, [complete](const ElasticTranscoderClient*, const Model::DeletePipelineRequest&, const Model::DeletePipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeletePipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The DeletePreset operation removes a preset that you've added in an AWS
          * region.</p> <note> <p>You can't delete the default presets that are included
@@ -383,6 +514,29 @@ namespace Model
          */
         virtual void DeletePresetAsync(const Model::DeletePresetRequest& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The DeletePreset operation removes a preset that you've added in an AWS
+         * region.</p> <note> <p>You can't delete the default presets that are included
+         * with Elastic Transcoder.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way DeletePresetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeletePresetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeletePresetOutcome> DeletePresetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeletePresetOutcome>([this, request](const std::function<void(Model::DeletePresetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeletePresetAsync(request, [complete](const ElasticTranscoderClient*, const Model::DeletePresetRequest&, const Model::DeletePresetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeletePresetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The ListJobsByPipeline operation gets a list of the jobs currently in a
          * pipeline.</p> <p>Elastic Transcoder returns all of the jobs currently in the
@@ -411,6 +565,30 @@ namespace Model
          */
         virtual void ListJobsByPipelineAsync(const Model::ListJobsByPipelineRequest& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The ListJobsByPipeline operation gets a list of the jobs currently in a
+         * pipeline.</p> <p>Elastic Transcoder returns all of the jobs currently in the
+         * specified pipeline. The response body contains one element for each job that
+         * satisfies the search criteria.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListJobsByPipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListJobsByPipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListJobsByPipelineOutcome> ListJobsByPipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListJobsByPipelineOutcome>([this, request](const std::function<void(Model::ListJobsByPipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListJobsByPipelineAsync(request, [complete](const ElasticTranscoderClient*, const Model::ListJobsByPipelineRequest&, const Model::ListJobsByPipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListJobsByPipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The ListJobsByStatus operation gets a list of jobs that have a specified
          * status. The response body contains one element for each job that satisfies the
@@ -436,6 +614,29 @@ namespace Model
          */
         virtual void ListJobsByStatusAsync(const Model::ListJobsByStatusRequest& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The ListJobsByStatus operation gets a list of jobs that have a specified
+         * status. The response body contains one element for each job that satisfies the
+         * search criteria.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListJobsByStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListJobsByStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListJobsByStatusOutcome> ListJobsByStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListJobsByStatusOutcome>([this, request](const std::function<void(Model::ListJobsByStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListJobsByStatusAsync(request, [complete](const ElasticTranscoderClient*, const Model::ListJobsByStatusRequest&, const Model::ListJobsByStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListJobsByStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The ListPipelines operation gets a list of the pipelines associated with the
          * current AWS account.</p>
@@ -458,6 +659,28 @@ namespace Model
          */
         virtual void ListPipelinesAsync(const Model::ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The ListPipelines operation gets a list of the pipelines associated with the
+         * current AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListPipelinesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPipelinesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPipelinesOutcome> ListPipelinesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPipelinesOutcome>([this, request](const std::function<void(Model::ListPipelinesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPipelinesAsync(request, [complete](const ElasticTranscoderClient*, const Model::ListPipelinesRequest&, const Model::ListPipelinesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPipelinesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The ListPresets operation gets a list of the default presets included with
          * Elastic Transcoder and the presets that you've added in an AWS region.</p>
@@ -480,6 +703,28 @@ namespace Model
          */
         virtual void ListPresetsAsync(const Model::ListPresetsRequest& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The ListPresets operation gets a list of the default presets included with
+         * Elastic Transcoder and the presets that you've added in an AWS region.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListPresetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPresetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPresetsOutcome> ListPresetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPresetsOutcome>([this, request](const std::function<void(Model::ListPresetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPresetsAsync(request, [complete](const ElasticTranscoderClient*, const Model::ListPresetsRequest&, const Model::ListPresetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPresetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The ReadJob operation returns detailed information about a job.</p>
          */
@@ -499,6 +744,27 @@ namespace Model
          */
         virtual void ReadJobAsync(const Model::ReadJobRequest& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The ReadJob operation returns detailed information about a job.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReadJobAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReadJobRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReadJobOutcome> ReadJobAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReadJobOutcome>([this, request](const std::function<void(Model::ReadJobOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReadJobAsync(request, [complete](const ElasticTranscoderClient*, const Model::ReadJobRequest&, const Model::ReadJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReadJobOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The ReadPipeline operation gets detailed information about a pipeline.</p>
          */
@@ -518,6 +784,27 @@ namespace Model
          */
         virtual void ReadPipelineAsync(const Model::ReadPipelineRequest& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The ReadPipeline operation gets detailed information about a pipeline.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReadPipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReadPipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReadPipelineOutcome> ReadPipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReadPipelineOutcome>([this, request](const std::function<void(Model::ReadPipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReadPipelineAsync(request, [complete](const ElasticTranscoderClient*, const Model::ReadPipelineRequest&, const Model::ReadPipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReadPipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The ReadPreset operation gets detailed information about a preset.</p>
          */
@@ -537,6 +824,27 @@ namespace Model
          */
         virtual void ReadPresetAsync(const Model::ReadPresetRequest& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The ReadPreset operation gets detailed information about a preset.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReadPresetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReadPresetRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReadPresetOutcome> ReadPresetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReadPresetOutcome>([this, request](const std::function<void(Model::ReadPresetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReadPresetAsync(request, [complete](const ElasticTranscoderClient*, const Model::ReadPresetRequest&, const Model::ReadPresetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReadPresetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The TestRole operation tests the IAM role used to create the pipeline.</p>
          * <p>The <code>TestRole</code> action lets you determine whether the IAM role you
@@ -571,6 +879,32 @@ namespace Model
          */
         virtual void TestRoleAsync(const Model::TestRoleRequest& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The TestRole operation tests the IAM role used to create the pipeline.</p>
+         * <p>The <code>TestRole</code> action lets you determine whether the IAM role you
+         * are using has sufficient permissions to let Elastic Transcoder perform tasks
+         * associated with the transcoding process. The action attempts to assume the
+         * specified IAM role, checks read access to the input and output buckets, and
+         * tries to send a test notification to Amazon SNS topics that you specify.</p>
+         *
+         * Returns an awaitable that starts the operation the way TestRoleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TestRoleRequest>
+        Aws::Utils::Threading::Awaitable<Model::TestRoleOutcome> TestRoleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TestRoleOutcome>([this, request](const std::function<void(Model::TestRoleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TestRoleAsync(request, [complete](const ElasticTranscoderClient*, const Model::TestRoleRequest&, const Model::TestRoleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TestRoleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Use the <code>UpdatePipeline</code> operation to update settings for a
          * pipeline. <important>When you change pipeline settings, your changes take effect
@@ -602,6 +936,31 @@ namespace Model
          */
         virtual void UpdatePipelineAsync(const Model::UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Use the <code>UpdatePipeline</code> operation to update settings for a
+         * pipeline. <important>When you change pipeline settings, your changes take effect
+         * immediately. Jobs that you have already submitted and that Elastic Transcoder
+         * has not started to process are affected in addition to jobs that you submit
+         * after you change settings. </important> </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdatePipelineAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdatePipelineRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdatePipelineOutcome> UpdatePipelineAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdatePipelineOutcome>([this, request](const std::function<void(Model::UpdatePipelineOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdatePipelineAsync(request, [complete](const ElasticTranscoderClient*, const Model::UpdatePipelineRequest&, const Model::UpdatePipelineOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdatePipelineOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>With the UpdatePipelineNotifications operation, you can update Amazon Simple
          * Notification Service (Amazon SNS) notifications for a pipeline.</p> <p>When you
@@ -630,6 +989,30 @@ namespace Model
          */
         virtual void UpdatePipelineNotificationsAsync(const Model::UpdatePipelineNotificationsRequest& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>With the UpdatePipelineNotifications operation, you can update Amazon Simple
+         * Notification Service (Amazon SNS) notifications for a pipeline.</p> <p>When you
+         * update notifications for a pipeline, Elastic Transcoder returns the values that
+         * you specified in the request.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdatePipelineNotificationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdatePipelineNotificationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdatePipelineNotificationsOutcome> UpdatePipelineNotificationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdatePipelineNotificationsOutcome>([this, request](const std::function<void(Model::UpdatePipelineNotificationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdatePipelineNotificationsAsync(request, [complete](const ElasticTranscoderClient*, const Model::UpdatePipelineNotificationsRequest&, const Model::UpdatePipelineNotificationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdatePipelineNotificationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The UpdatePipelineStatus operation pauses or reactivates a pipeline, so that
          * the pipeline stops or restarts the processing of jobs.</p> <p>Changing the
@@ -667,6 +1050,33 @@ namespace Model
          */
         virtual void UpdatePipelineStatusAsync(const Model::UpdatePipelineStatusRequest& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The UpdatePipelineStatus operation pauses or reactivates a pipeline, so that
+         * the pipeline stops or restarts the processing of jobs.</p> <p>Changing the
+         * pipeline status is useful if you want to cancel one or more jobs. You can't
+         * cancel jobs after Elastic Transcoder has started processing them; if you pause
+         * the pipeline to which you submitted the jobs, you have more time to get the job
+         * IDs for the jobs that you want to cancel, and to send a <a>CancelJob</a>
+         * request. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdatePipelineStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdatePipelineStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdatePipelineStatusOutcome> UpdatePipelineStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdatePipelineStatusOutcome>([this, request](const std::function<void(Model::UpdatePipelineStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdatePipelineStatusAsync(request, [complete](const ElasticTranscoderClient*, const Model::UpdatePipelineStatusRequest&, const Model::UpdatePipelineStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdatePipelineStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
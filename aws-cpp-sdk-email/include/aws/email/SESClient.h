@@ -61,6 +61,7 @@
 #include <aws/email/model/VerifyEmailIdentityResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -350,6 +351,33 @@ namespace Model
          */
         virtual void CloneReceiptRuleSetAsync(const Model::CloneReceiptRuleSetRequest& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a receipt rule set by cloning an existing one. All receipt rules and
+         * configurations are copied to the new receipt rule set and are completely
+         * independent of the source rule set.</p> <p>For information about setting up rule
+         * sets, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-receipt-rule-set.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way CloneReceiptRuleSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CloneReceiptRuleSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::CloneReceiptRuleSetOutcome> CloneReceiptRuleSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CloneReceiptRuleSetOutcome>([this, request](const std::function<void(Model::CloneReceiptRuleSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CloneReceiptRuleSetAsync(request, [complete](const SESClient*, const Model::CloneReceiptRuleSetRequest&, const Model::CloneReceiptRuleSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CloneReceiptRuleSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new IP address filter.</p> <p>For information about setting up IP
          * address filters, see the <a
@@ -381,6 +409,31 @@ namespace Model
          */
         virtual void CreateReceiptFilterAsync(const Model::CreateReceiptFilterRequest& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new IP address filter.</p> <p>For information about setting up IP
+         * address filters, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-ip-filters.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateReceiptFilterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateReceiptFilterRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateReceiptFilterOutcome> CreateReceiptFilterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateReceiptFilterOutcome>([this, request](const std::function<void(Model::CreateReceiptFilterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateReceiptFilterAsync(request, [complete](const SESClient*, const Model::CreateReceiptFilterRequest&, const Model::CreateReceiptFilterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateReceiptFilterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a receipt rule.</p> <p>For information about setting up receipt
          * rules, see the <a
@@ -412,6 +465,31 @@ namespace Model
          */
         virtual void CreateReceiptRuleAsync(const Model::CreateReceiptRuleRequest& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a receipt rule.</p> <p>For information about setting up receipt
+         * rules, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-receipt-rules.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateReceiptRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateReceiptRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateReceiptRuleOutcome> CreateReceiptRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateReceiptRuleOutcome>([this, request](const std::function<void(Model::CreateReceiptRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateReceiptRuleAsync(request, [complete](const SESClient*, const Model::CreateReceiptRuleRequest&, const Model::CreateReceiptRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateReceiptRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an empty receipt rule set.</p> <p>For information about setting up
          * receipt rule sets, see the <a
@@ -443,6 +521,31 @@ namespace Model
          */
         virtual void CreateReceiptRuleSetAsync(const Model::CreateReceiptRuleSetRequest& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an empty receipt rule set.</p> <p>For information about setting up
+         * receipt rule sets, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-receipt-rule-set.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateReceiptRuleSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateReceiptRuleSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateReceiptRuleSetOutcome> CreateReceiptRuleSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateReceiptRuleSetOutcome>([this, request](const std::function<void(Model::CreateReceiptRuleSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateReceiptRuleSetAsync(request, [complete](const SESClient*, const Model::CreateReceiptRuleSetRequest&, const Model::CreateReceiptRuleSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateReceiptRuleSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified identity (email address or domain) from the list of
          * verified identities.</p> <p>This action is throttled at one request per
@@ -468,6 +571,29 @@ namespace Model
          */
         virtual void DeleteIdentityAsync(const Model::DeleteIdentityRequest& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified identity (email address or domain) from the list of
+         * verified identities.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteIdentityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteIdentityRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteIdentityOutcome> DeleteIdentityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteIdentityOutcome>([this, request](const std::function<void(Model::DeleteIdentityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteIdentityAsync(request, [complete](const SESClient*, const Model::DeleteIdentityRequest&, const Model::DeleteIdentityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteIdentityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified sending authorization policy for the given identity
          * (email address or domain). This API returns successfully even if a policy with
@@ -514,6 +640,36 @@ namespace Model
          */
         virtual void DeleteIdentityPolicyAsync(const Model::DeleteIdentityPolicyRequest& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified sending authorization policy for the given identity
+         * (email address or domain). This API returns successfully even if a policy with
+         * the specified name does not exist.</p> <note>This API is for the identity owner
+         * only. If you have not verified the identity, this API will return an
+         * error.</note> <p>Sending authorization is a feature that enables an identity
+         * owner to authorize other senders to use its identities. For information about
+         * using sending authorization, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/sending-authorization.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteIdentityPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteIdentityPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteIdentityPolicyOutcome> DeleteIdentityPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteIdentityPolicyOutcome>([this, request](const std::function<void(Model::DeleteIdentityPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteIdentityPolicyAsync(request, [complete](const SESClient*, const Model::DeleteIdentityPolicyRequest&, const Model::DeleteIdentityPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteIdentityPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified IP address filter.</p> <p>For information about
          * managing IP address filters, see the <a
@@ -545,6 +701,31 @@ namespace Model
          */
         virtual void DeleteReceiptFilterAsync(const Model::DeleteReceiptFilterRequest& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified IP address filter.</p> <p>For information about
+         * managing IP address filters, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-managing-ip-filters.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteReceiptFilterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteReceiptFilterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteReceiptFilterOutcome> DeleteReceiptFilterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteReceiptFilterOutcome>([this, request](const std::function<void(Model::DeleteReceiptFilterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteReceiptFilterAsync(request, [complete](const SESClient*, const Model::DeleteReceiptFilterRequest&, const Model::DeleteReceiptFilterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteReceiptFilterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified receipt rule.</p> <p>For information about managing
          * receipt rules, see the <a
@@ -576,6 +757,31 @@ namespace Model
          */
         virtual void DeleteReceiptRuleAsync(const Model::DeleteReceiptRuleRequest& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified receipt rule.</p> <p>For information about managing
+         * receipt rules, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-managing-receipt-rules.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteReceiptRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteReceiptRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteReceiptRuleOutcome> DeleteReceiptRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteReceiptRuleOutcome>([this, request](const std::function<void(Model::DeleteReceiptRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteReceiptRuleAsync(request, [complete](const SESClient*, const Model::DeleteReceiptRuleRequest&, const Model::DeleteReceiptRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteReceiptRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified receipt rule set and all of the receipt rules it
          * contains.</p> <note>The currently active rule set cannot be deleted.</note>
@@ -610,6 +816,32 @@ namespace Model
          */
         virtual void DeleteReceiptRuleSetAsync(const Model::DeleteReceiptRuleSetRequest& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified receipt rule set and all of the receipt rules it
+         * contains.</p> <note>The currently active rule set cannot be deleted.</note>
+         * <p>For information about managing receipt rule sets, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-managing-receipt-rule-sets.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteReceiptRuleSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteReceiptRuleSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteReceiptRuleSetOutcome> DeleteReceiptRuleSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteReceiptRuleSetOutcome>([this, request](const std::function<void(Model::DeleteReceiptRuleSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteReceiptRuleSetAsync(request, [complete](const SESClient*, const Model::DeleteReceiptRuleSetRequest&, const Model::DeleteReceiptRuleSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteReceiptRuleSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified email address from the list of verified addresses.</p>
          * <important>The DeleteVerifiedEmailAddress action is deprecated as of the May 15,
@@ -641,6 +873,31 @@ namespace Model
          */
         virtual void DeleteVerifiedEmailAddressAsync(const Model::DeleteVerifiedEmailAddressRequest& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified email address from the list of verified addresses.</p>
+         * <important>The DeleteVerifiedEmailAddress action is deprecated as of the May 15,
+         * 2012 release of Domain Verification. The DeleteIdentity action is now
+         * preferred.</important> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVerifiedEmailAddressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVerifiedEmailAddressRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVerifiedEmailAddressOutcome> DeleteVerifiedEmailAddressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVerifiedEmailAddressOutcome>([this, request](const std::function<void(Model::DeleteVerifiedEmailAddressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVerifiedEmailAddressAsync(request, [complete](const SESClient*, const Model::DeleteVerifiedEmailAddressRequest&, const Model::DeleteVerifiedEmailAddressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVerifiedEmailAddressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the metadata and receipt rules for the receipt rule set that is
          * currently active.</p> <p>For information about setting up receipt rule sets, see
@@ -675,6 +932,32 @@ namespace Model
          */
         virtual void DescribeActiveReceiptRuleSetAsync(const Model::DescribeActiveReceiptRuleSetRequest& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the metadata and receipt rules for the receipt rule set that is
+         * currently active.</p> <p>For information about setting up receipt rule sets, see
+         * the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-receipt-rule-set.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeActiveReceiptRuleSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeActiveReceiptRuleSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeActiveReceiptRuleSetOutcome> DescribeActiveReceiptRuleSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeActiveReceiptRuleSetOutcome>([this, request](const std::function<void(Model::DescribeActiveReceiptRuleSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeActiveReceiptRuleSetAsync(request, [complete](const SESClient*, const Model::DescribeActiveReceiptRuleSetRequest&, const Model::DescribeActiveReceiptRuleSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeActiveReceiptRuleSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the details of the specified receipt rule.</p> <p>For information
          * about setting up receipt rules, see the <a
@@ -706,6 +989,31 @@ namespace Model
          */
         virtual void DescribeReceiptRuleAsync(const Model::DescribeReceiptRuleRequest& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the details of the specified receipt rule.</p> <p>For information
+         * about setting up receipt rules, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-receipt-rules.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReceiptRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReceiptRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReceiptRuleOutcome> DescribeReceiptRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReceiptRuleOutcome>([this, request](const std::function<void(Model::DescribeReceiptRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReceiptRuleAsync(request, [complete](const SESClient*, const Model::DescribeReceiptRuleRequest&, const Model::DescribeReceiptRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReceiptRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the details of the specified receipt rule set.</p> <p>For information
          * about managing receipt rule sets, see the <a
@@ -737,6 +1045,31 @@ namespace Model
          */
         virtual void DescribeReceiptRuleSetAsync(const Model::DescribeReceiptRuleSetRequest& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the details of the specified receipt rule set.</p> <p>For information
+         * about managing receipt rule sets, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-managing-receipt-rule-sets.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReceiptRuleSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReceiptRuleSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReceiptRuleSetOutcome> DescribeReceiptRuleSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReceiptRuleSetOutcome>([this, request](const std::function<void(Model::DescribeReceiptRuleSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReceiptRuleSetAsync(request, [complete](const SESClient*, const Model::DescribeReceiptRuleSetRequest&, const Model::DescribeReceiptRuleSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReceiptRuleSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the current status of Easy DKIM signing for an entity. For domain
          * name identities, this action also returns the DKIM tokens that are required for
@@ -798,6 +1131,41 @@ namespace Model
          */
         virtual void GetIdentityDkimAttributesAsync(const Model::GetIdentityDkimAttributesRequest& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the current status of Easy DKIM signing for an entity. For domain
+         * name identities, this action also returns the DKIM tokens that are required for
+         * Easy DKIM signing, and whether Amazon SES has successfully verified that these
+         * tokens have been published.</p> <p>This action takes a list of identities as
+         * input and returns the following information for each:</p> <ul> <li>Whether Easy
+         * DKIM signing is enabled or disabled.</li> <li>A set of DKIM tokens that
+         * represent the identity. If the identity is an email address, the tokens
+         * represent the domain of that address.</li> <li>Whether Amazon SES has
+         * successfully verified the DKIM tokens published in the domain's DNS. This
+         * information is only returned for domain name identities, not for email
+         * addresses.</li> </ul> <p>This action is throttled at one request per second and
+         * can only get DKIM attributes for up to 100 identities at a time.</p> <p>For more
+         * information about creating DNS records using DKIM tokens, go to the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/easy-dkim-dns-records.html">Amazon
+         * SES Developer Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIdentityDkimAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIdentityDkimAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIdentityDkimAttributesOutcome> GetIdentityDkimAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIdentityDkimAttributesOutcome>([this, request](const std::function<void(Model::GetIdentityDkimAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIdentityDkimAttributesAsync(request, [complete](const SESClient*, const Model::GetIdentityDkimAttributesRequest&, const Model::GetIdentityDkimAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIdentityDkimAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the custom MAIL FROM attributes for a list of identities (email
          * addresses and/or domains).</p> <p>This action is throttled at one request per
@@ -826,6 +1194,30 @@ namespace Model
          */
         virtual void GetIdentityMailFromDomainAttributesAsync(const Model::GetIdentityMailFromDomainAttributesRequest& request, const GetIdentityMailFromDomainAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the custom MAIL FROM attributes for a list of identities (email
+         * addresses and/or domains).</p> <p>This action is throttled at one request per
+         * second and can only get custom MAIL FROM attributes for up to 100 identities at
+         * a time.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIdentityMailFromDomainAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIdentityMailFromDomainAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIdentityMailFromDomainAttributesOutcome> GetIdentityMailFromDomainAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIdentityMailFromDomainAttributesOutcome>([this, request](const std::function<void(Model::GetIdentityMailFromDomainAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIdentityMailFromDomainAttributesAsync(request, [complete](const SESClient*, const Model::GetIdentityMailFromDomainAttributesRequest&, const Model::GetIdentityMailFromDomainAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIdentityMailFromDomainAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Given a list of verified identities (email addresses and/or domains), returns
          * a structure describing identity notification attributes.</p> <p>This action is
@@ -863,6 +1255,33 @@ namespace Model
          */
         virtual void GetIdentityNotificationAttributesAsync(const Model::GetIdentityNotificationAttributesRequest& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Given a list of verified identities (email addresses and/or domains), returns
+         * a structure describing identity notification attributes.</p> <p>This action is
+         * throttled at one request per second and can only get notification attributes for
+         * up to 100 identities at a time.</p> <p>For more information about using
+         * notifications with Amazon SES, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/notifications.html">Amazon
+         * SES Developer Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIdentityNotificationAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIdentityNotificationAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIdentityNotificationAttributesOutcome> GetIdentityNotificationAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIdentityNotificationAttributesOutcome>([this, request](const std::function<void(Model::GetIdentityNotificationAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIdentityNotificationAttributesAsync(request, [complete](const SESClient*, const Model::GetIdentityNotificationAttributesRequest&, const Model::GetIdentityNotificationAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIdentityNotificationAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the requested sending authorization policies for the given identity
          * (email address or domain). The policies are returned as a map of policy names to
@@ -909,6 +1328,36 @@ namespace Model
          */
         virtual void GetIdentityPoliciesAsync(const Model::GetIdentityPoliciesRequest& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the requested sending authorization policies for the given identity
+         * (email address or domain). The policies are returned as a map of policy names to
+         * policy contents. You can retrieve a maximum of 20 policies at a time.</p>
+         * <note>This API is for the identity owner only. If you have not verified the
+         * identity, this API will return an error.</note> <p>Sending authorization is a
+         * feature that enables an identity owner to authorize other senders to use its
+         * identities. For information about using sending authorization, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/sending-authorization.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIdentityPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIdentityPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIdentityPoliciesOutcome> GetIdentityPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIdentityPoliciesOutcome>([this, request](const std::function<void(Model::GetIdentityPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIdentityPoliciesAsync(request, [complete](const SESClient*, const Model::GetIdentityPoliciesRequest&, const Model::GetIdentityPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIdentityPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Given a list of identities (email addresses and/or domains), returns the
          * verification status and (for domain identities) the verification token for each
@@ -937,6 +1386,30 @@ namespace Model
          */
         virtual void GetIdentityVerificationAttributesAsync(const Model::GetIdentityVerificationAttributesRequest& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Given a list of identities (email addresses and/or domains), returns the
+         * verification status and (for domain identities) the verification token for each
+         * identity.</p> <p>This action is throttled at one request per second and can only
+         * get verification attributes for up to 100 identities at a time.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIdentityVerificationAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIdentityVerificationAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIdentityVerificationAttributesOutcome> GetIdentityVerificationAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIdentityVerificationAttributesOutcome>([this, request](const std::function<void(Model::GetIdentityVerificationAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIdentityVerificationAttributesAsync(request, [complete](const SESClient*, const Model::GetIdentityVerificationAttributesRequest&, const Model::GetIdentityVerificationAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIdentityVerificationAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the user's current sending limits.</p> <p>This action is throttled at
          * one request per second.</p>
@@ -959,6 +1432,28 @@ namespace Model
          */
         virtual void GetSendQuotaAsync(const Model::GetSendQuotaRequest& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the user's current sending limits.</p> <p>This action is throttled at
+         * one request per second.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetSendQuotaAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetSendQuotaRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetSendQuotaOutcome> GetSendQuotaAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetSendQuotaOutcome>([this, request](const std::function<void(Model::GetSendQuotaOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetSendQuotaAsync(request, [complete](const SESClient*, const Model::GetSendQuotaRequest&, const Model::GetSendQuotaOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetSendQuotaOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the user's sending statistics. The result is a list of data points,
          * representing the last two weeks of sending activity. </p> <p>Each data point in
@@ -987,6 +1482,30 @@ namespace Model
          */
         virtual void GetSendStatisticsAsync(const Model::GetSendStatisticsRequest& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the user's sending statistics. The result is a list of data points,
+         * representing the last two weeks of sending activity. </p> <p>Each data point in
+         * the list contains statistics for a 15-minute interval.</p> <p>This action is
+         * throttled at one request per second.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetSendStatisticsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetSendStatisticsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetSendStatisticsOutcome> GetSendStatisticsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetSendStatisticsOutcome>([this, request](const std::function<void(Model::GetSendStatisticsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetSendStatisticsAsync(request, [complete](const SESClient*, const Model::GetSendStatisticsRequest&, const Model::GetSendStatisticsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetSendStatisticsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list containing all of the identities (email addresses and domains)
          * for a specific AWS Account, regardless of verification status.</p> <p>This
@@ -1012,6 +1531,29 @@ namespace Model
          */
         virtual void ListIdentitiesAsync(const Model::ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list containing all of the identities (email addresses and domains)
+         * for a specific AWS Account, regardless of verification status.</p> <p>This
+         * action is throttled at one request per second.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListIdentitiesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListIdentitiesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListIdentitiesOutcome> ListIdentitiesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListIdentitiesOutcome>([this, request](const std::function<void(Model::ListIdentitiesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListIdentitiesAsync(request, [complete](const SESClient*, const Model::ListIdentitiesRequest&, const Model::ListIdentitiesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListIdentitiesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of sending authorization policies that are attached to the
          * given identity (email address or domain). This API returns only a list. If you
@@ -1061,6 +1603,37 @@ namespace Model
          */
         virtual void ListIdentityPoliciesAsync(const Model::ListIdentityPoliciesRequest& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of sending authorization policies that are attached to the
+         * given identity (email address or domain). This API returns only a list. If you
+         * want the actual policy content, you can use
+         * <code>GetIdentityPolicies</code>.</p> <note>This API is for the identity owner
+         * only. If you have not verified the identity, this API will return an
+         * error.</note> <p>Sending authorization is a feature that enables an identity
+         * owner to authorize other senders to use its identities. For information about
+         * using sending authorization, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/sending-authorization.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListIdentityPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListIdentityPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListIdentityPoliciesOutcome> ListIdentityPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListIdentityPoliciesOutcome>([this, request](const std::function<void(Model::ListIdentityPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListIdentityPoliciesAsync(request, [complete](const SESClient*, const Model::ListIdentityPoliciesRequest&, const Model::ListIdentityPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListIdentityPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the IP address filters associated with your account.</p> <p>For
          * information about managing IP address filters, see the <a
@@ -1092,6 +1665,31 @@ namespace Model
          */
         virtual void ListReceiptFiltersAsync(const Model::ListReceiptFiltersRequest& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the IP address filters associated with your account.</p> <p>For
+         * information about managing IP address filters, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-managing-ip-filters.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListReceiptFiltersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListReceiptFiltersRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListReceiptFiltersOutcome> ListReceiptFiltersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListReceiptFiltersOutcome>([this, request](const std::function<void(Model::ListReceiptFiltersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListReceiptFiltersAsync(request, [complete](const SESClient*, const Model::ListReceiptFiltersRequest&, const Model::ListReceiptFiltersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListReceiptFiltersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the receipt rule sets that exist under your AWS account. If there are
          * additional receipt rule sets to be retrieved, you will receive a
@@ -1132,6 +1730,34 @@ namespace Model
          */
         virtual void ListReceiptRuleSetsAsync(const Model::ListReceiptRuleSetsRequest& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the receipt rule sets that exist under your AWS account. If there are
+         * additional receipt rule sets to be retrieved, you will receive a
+         * <code>NextToken</code> that you can provide to the next call to
+         * <code>ListReceiptRuleSets</code> to retrieve the additional entries.</p> <p>For
+         * information about managing receipt rule sets, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-managing-receipt-rule-sets.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListReceiptRuleSetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListReceiptRuleSetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListReceiptRuleSetsOutcome> ListReceiptRuleSetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListReceiptRuleSetsOutcome>([this, request](const std::function<void(Model::ListReceiptRuleSetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListReceiptRuleSetsAsync(request, [complete](const SESClient*, const Model::ListReceiptRuleSetsRequest&, const Model::ListReceiptRuleSetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListReceiptRuleSetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list containing all of the email addresses that have been
          * verified.</p> <important>The ListVerifiedEmailAddresses action is deprecated as
@@ -1163,6 +1789,31 @@ namespace Model
          */
         virtual void ListVerifiedEmailAddressesAsync(const Model::ListVerifiedEmailAddressesRequest& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list containing all of the email addresses that have been
+         * verified.</p> <important>The ListVerifiedEmailAddresses action is deprecated as
+         * of the May 15, 2012 release of Domain Verification. The ListIdentities action is
+         * now preferred.</important> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListVerifiedEmailAddressesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListVerifiedEmailAddressesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListVerifiedEmailAddressesOutcome> ListVerifiedEmailAddressesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListVerifiedEmailAddressesOutcome>([this, request](const std::function<void(Model::ListVerifiedEmailAddressesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListVerifiedEmailAddressesAsync(request, [complete](const SESClient*, const Model::ListVerifiedEmailAddressesRequest&, const Model::ListVerifiedEmailAddressesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListVerifiedEmailAddressesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds or updates a sending authorization policy for the specified identity
          * (email address or domain).</p> <note>This API is for the identity owner only. If
@@ -1206,6 +1857,35 @@ namespace Model
          */
         virtual void PutIdentityPolicyAsync(const Model::PutIdentityPolicyRequest& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds or updates a sending authorization policy for the specified identity
+         * (email address or domain).</p> <note>This API is for the identity owner only. If
+         * you have not verified the identity, this API will return an error.</note>
+         * <p>Sending authorization is a feature that enables an identity owner to
+         * authorize other senders to use its identities. For information about using
+         * sending authorization, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/sending-authorization.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutIdentityPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutIdentityPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutIdentityPolicyOutcome> PutIdentityPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutIdentityPolicyOutcome>([this, request](const std::function<void(Model::PutIdentityPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutIdentityPolicyAsync(request, [complete](const SESClient*, const Model::PutIdentityPolicyRequest&, const Model::PutIdentityPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutIdentityPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Reorders the receipt rules within a receipt rule set.</p> <note>All of the
          * rules in the rule set must be represented in this request. That is, this API
@@ -1246,6 +1926,34 @@ namespace Model
          */
         virtual void ReorderReceiptRuleSetAsync(const Model::ReorderReceiptRuleSetRequest& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Reorders the receipt rules within a receipt rule set.</p> <note>All of the
+         * rules in the rule set must be represented in this request. That is, this API
+         * will return an error if the reorder request doesn't explicitly position all of
+         * the rules.</note> <p>For information about managing receipt rule sets, see the
+         * <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-managing-receipt-rule-sets.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReorderReceiptRuleSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReorderReceiptRuleSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReorderReceiptRuleSetOutcome> ReorderReceiptRuleSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReorderReceiptRuleSetOutcome>([this, request](const std::function<void(Model::ReorderReceiptRuleSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReorderReceiptRuleSetAsync(request, [complete](const SESClient*, const Model::ReorderReceiptRuleSetRequest&, const Model::ReorderReceiptRuleSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReorderReceiptRuleSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Generates and sends a bounce message to the sender of an email you received
          * through Amazon SES. You can only use this API on an email up to 24 hours after
@@ -1286,6 +1994,34 @@ namespace Model
          */
         virtual void SendBounceAsync(const Model::SendBounceRequest& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Generates and sends a bounce message to the sender of an email you received
+         * through Amazon SES. You can only use this API on an email up to 24 hours after
+         * you receive it.</p> <note>You cannot use this API to send generic bounces for
+         * mail that was not received by Amazon SES.</note> <p>For information about
+         * receiving email through Amazon SES, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way SendBounceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SendBounceRequest>
+        Aws::Utils::Threading::Awaitable<Model::SendBounceOutcome> SendBounceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SendBounceOutcome>([this, request](const std::function<void(Model::SendBounceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SendBounceAsync(request, [complete](const SESClient*, const Model::SendBounceRequest&, const Model::SendBounceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SendBounceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Composes an email message based on input data, and then immediately queues
          * the message for sending. </p> <p>There are several important points to know
@@ -1362,6 +2098,46 @@ namespace Model
          */
         virtual void SendEmailAsync(const Model::SendEmailRequest& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Composes an email message based on input data, and then immediately queues
+         * the message for sending. </p> <p>There are several important points to know
+         * about <code>SendEmail</code>:</p> <ul> <li>You can only send email from verified
+         * email addresses and domains; otherwise, you will get an "Email address not
+         * verified" error. If your account is still in the Amazon SES sandbox, you must
+         * also verify every recipient email address except for the recipients provided by
+         * the Amazon SES mailbox simulator. For more information, go to the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/verify-addresses-and-domains.html">Amazon
+         * SES Developer Guide</a>.</li> <li>The total size of the message cannot exceed 10
+         * MB. This includes any attachments that are part of the message.</li> <li>Amazon
+         * SES has a limit on the total number of recipients per message. The combined
+         * number of To:, CC: and BCC: email addresses cannot exceed 50. If you need to
+         * send an email message to a larger audience, you can divide your recipient list
+         * into groups of 50 or fewer, and then call Amazon SES repeatedly to send the
+         * message to each group.</li> <li>For every message that you send, the total
+         * number of recipients (To:, CC: and BCC:) is counted against your sending quota -
+         * the maximum number of emails you can send in a 24-hour period. For information
+         * about your sending quota, go to the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/manage-sending-limits.html">Amazon
+         * SES Developer Guide</a>.</li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way SendEmailAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SendEmailRequest>
+        Aws::Utils::Threading::Awaitable<Model::SendEmailOutcome> SendEmailAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SendEmailOutcome>([this, request](const std::function<void(Model::SendEmailOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SendEmailAsync(request, [complete](const SESClient*, const Model::SendEmailRequest&, const Model::SendEmailOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SendEmailOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sends an email message, with header and content specified by the client. The
          * <code>SendRawEmail</code> action is useful for sending multipart MIME emails.
@@ -1510,6 +2286,70 @@ namespace Model
          */
         virtual void SendRawEmailAsync(const Model::SendRawEmailRequest& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sends an email message, with header and content specified by the client. The
+         * <code>SendRawEmail</code> action is useful for sending multipart MIME emails.
+         * The raw text of the message must comply with Internet email standards;
+         * otherwise, the message cannot be sent. </p> <p>There are several important
+         * points to know about <code>SendRawEmail</code>:</p> <ul> <li>You can only send
+         * email from verified email addresses and domains; otherwise, you will get an
+         * "Email address not verified" error. If your account is still in the Amazon SES
+         * sandbox, you must also verify every recipient email address except for the
+         * recipients provided by the Amazon SES mailbox simulator. For more information,
+         * go to the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/verify-addresses-and-domains.html">Amazon
+         * SES Developer Guide</a>.</li> <li>The total size of the message cannot exceed 10
+         * MB. This includes any attachments that are part of the message.</li> <li>Amazon
+         * SES has a limit on the total number of recipients per message. The combined
+         * number of To:, CC: and BCC: email addresses cannot exceed 50. If you need to
+         * send an email message to a larger audience, you can divide your recipient list
+         * into groups of 50 or fewer, and then call Amazon SES repeatedly to send the
+         * message to each group.</li> <li>The To:, CC:, and BCC: headers in the raw
+         * message can contain a group list. Note that each recipient in a group list
+         * counts towards the 50-recipient limit.</li> <li>For every message that you send,
+         * the total number of recipients (To:, CC: and BCC:) is counted against your
+         * sending quota - the maximum number of emails you can send in a 24-hour period.
+         * For information about your sending quota, go to the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/manage-sending-limits.html">Amazon
+         * SES Developer Guide</a>.</li> <li>If you are using sending authorization to send
+         * on behalf of another user, <code>SendRawEmail</code> enables you to specify the
+         * cross-account identity for the email's "Source," "From," and "Return-Path"
+         * parameters in one of two ways: you can pass optional parameters
+         * <code>SourceArn</code>, <code>FromArn</code>, and/or <code>ReturnPathArn</code>
+         * to the API, or you can include the following X-headers in the header of your raw
+         * email: <ul> <li><code>X-SES-SOURCE-ARN</code></li>
+         * <li><code>X-SES-FROM-ARN</code></li> <li><code>X-SES-RETURN-PATH-ARN</code></li>
+         * </ul> <important>Do not include these X-headers in the DKIM signature, because
+         * they are removed by Amazon SES before sending the email.</important> For the
+         * most common sending authorization use case, we recommend that you specify the
+         * <code>SourceIdentityArn</code> and do not specify either the
+         * <code>FromIdentityArn</code> or <code>ReturnPathIdentityArn</code>. (The same
+         * note applies to the corresponding X-headers.) If you only specify the
+         * <code>SourceIdentityArn</code>, Amazon SES will simply set the "From" address
+         * and the "Return Path" address to the identity specified in
+         * <code>SourceIdentityArn</code>. For more information about sending
+         * authorization, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/sending-authorization.html">Amazon
+         * SES Developer Guide</a>.</li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way SendRawEmailAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SendRawEmailRequest>
+        Aws::Utils::Threading::Awaitable<Model::SendRawEmailOutcome> SendRawEmailAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SendRawEmailOutcome>([this, request](const std::function<void(Model::SendRawEmailOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SendRawEmailAsync(request, [complete](const SESClient*, const Model::SendRawEmailRequest&, const Model::SendRawEmailOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SendRawEmailOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the specified receipt rule set as the active receipt rule set.</p>
          * <note>To disable your email-receiving through Amazon SES completely, you can
@@ -1547,6 +2387,33 @@ namespace Model
          */
         virtual void SetActiveReceiptRuleSetAsync(const Model::SetActiveReceiptRuleSetRequest& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the specified receipt rule set as the active receipt rule set.</p>
+         * <note>To disable your email-receiving through Amazon SES completely, you can
+         * call this API with RuleSetName set to null.</note> <p>For information about
+         * managing receipt rule sets, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-managing-receipt-rule-sets.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetActiveReceiptRuleSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetActiveReceiptRuleSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetActiveReceiptRuleSetOutcome> SetActiveReceiptRuleSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetActiveReceiptRuleSetOutcome>([this, request](const std::function<void(Model::SetActiveReceiptRuleSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetActiveReceiptRuleSetAsync(request, [complete](const SESClient*, const Model::SetActiveReceiptRuleSetRequest&, const Model::SetActiveReceiptRuleSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetActiveReceiptRuleSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables or disables Easy DKIM signing of email sent from an identity:</p>
          * <ul> <li>If Easy DKIM signing is enabled for a domain name identity (e.g.,
@@ -1602,6 +2469,39 @@ namespace Model
          */
         virtual void SetIdentityDkimEnabledAsync(const Model::SetIdentityDkimEnabledRequest& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables or disables Easy DKIM signing of email sent from an identity:</p>
+         * <ul> <li>If Easy DKIM signing is enabled for a domain name identity (e.g.,
+         * <code>example.com</code>), then Amazon SES will DKIM-sign all email sent by
+         * addresses under that domain name (e.g., <code>user@example.com</code>).</li>
+         * <li>If Easy DKIM signing is enabled for an email address, then Amazon SES will
+         * DKIM-sign all email sent by that email address.</li> </ul> <p>For email
+         * addresses (e.g., <code>user@example.com</code>), you can only enable Easy DKIM
+         * signing if the corresponding domain (e.g., <code>example.com</code>) has been
+         * set up for Easy DKIM using the AWS Console or the <code>VerifyDomainDkim</code>
+         * action.</p> <p>This action is throttled at one request per second.</p> <p>For
+         * more information about Easy DKIM signing, go to the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/easy-dkim.html">Amazon
+         * SES Developer Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetIdentityDkimEnabledAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetIdentityDkimEnabledRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetIdentityDkimEnabledOutcome> SetIdentityDkimEnabledAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetIdentityDkimEnabledOutcome>([this, request](const std::function<void(Model::SetIdentityDkimEnabledOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetIdentityDkimEnabledAsync(request, [complete](const SESClient*, const Model::SetIdentityDkimEnabledRequest&, const Model::SetIdentityDkimEnabledOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetIdentityDkimEnabledOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Given an identity (email address or domain), enables or disables whether
          * Amazon SES forwards bounce and complaint notifications as email. Feedback
@@ -1648,6 +2548,36 @@ namespace Model
          */
         virtual void SetIdentityFeedbackForwardingEnabledAsync(const Model::SetIdentityFeedbackForwardingEnabledRequest& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Given an identity (email address or domain), enables or disables whether
+         * Amazon SES forwards bounce and complaint notifications as email. Feedback
+         * forwarding can only be disabled when Amazon Simple Notification Service (Amazon
+         * SNS) topics are specified for both bounces and complaints.</p> <note>Feedback
+         * forwarding does not apply to delivery notifications. Delivery notifications are
+         * only available through Amazon SNS.</note> <p>This action is throttled at one
+         * request per second.</p> <p>For more information about using notifications with
+         * Amazon SES, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/notifications.html">Amazon
+         * SES Developer Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetIdentityFeedbackForwardingEnabledAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetIdentityFeedbackForwardingEnabledRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetIdentityFeedbackForwardingEnabledOutcome> SetIdentityFeedbackForwardingEnabledAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetIdentityFeedbackForwardingEnabledOutcome>([this, request](const std::function<void(Model::SetIdentityFeedbackForwardingEnabledOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetIdentityFeedbackForwardingEnabledAsync(request, [complete](const SESClient*, const Model::SetIdentityFeedbackForwardingEnabledRequest&, const Model::SetIdentityFeedbackForwardingEnabledOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetIdentityFeedbackForwardingEnabledOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables or disables the custom MAIL FROM domain setup for a verified identity
          * (email address or domain). </p> <important>To send emails using the specified
@@ -1688,6 +2618,34 @@ namespace Model
          */
         virtual void SetIdentityMailFromDomainAsync(const Model::SetIdentityMailFromDomainRequest& request, const SetIdentityMailFromDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables or disables the custom MAIL FROM domain setup for a verified identity
+         * (email address or domain). </p> <important>To send emails using the specified
+         * MAIL FROM domain, you must add an MX record to your MAIL FROM domain's DNS
+         * settings. If you want your emails to pass Sender Policy Framework (SPF) checks,
+         * you must also add or update an SPF record. For more information, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/mail-from-set.html">Amazon
+         * SES Developer Guide</a>.</important> <p>This action is throttled at one request
+         * per second.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetIdentityMailFromDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetIdentityMailFromDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetIdentityMailFromDomainOutcome> SetIdentityMailFromDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetIdentityMailFromDomainOutcome>([this, request](const std::function<void(Model::SetIdentityMailFromDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetIdentityMailFromDomainAsync(request, [complete](const SESClient*, const Model::SetIdentityMailFromDomainRequest&, const Model::SetIdentityMailFromDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetIdentityMailFromDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Given an identity (email address or domain), sets the Amazon Simple
          * Notification Service (Amazon SNS) topic to which Amazon SES will publish bounce,
@@ -1734,6 +2692,36 @@ namespace Model
          */
         virtual void SetIdentityNotificationTopicAsync(const Model::SetIdentityNotificationTopicRequest& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Given an identity (email address or domain), sets the Amazon Simple
+         * Notification Service (Amazon SNS) topic to which Amazon SES will publish bounce,
+         * complaint, and/or delivery notifications for emails sent with that identity as
+         * the <code>Source</code>.</p> <note>Unless feedback forwarding is enabled, you
+         * must specify Amazon SNS topics for bounce and complaint notifications. For more
+         * information, see <code>SetIdentityFeedbackForwardingEnabled</code>. </note>
+         * <p>This action is throttled at one request per second.</p> <p>For more
+         * information about feedback notification, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/notifications.html">Amazon
+         * SES Developer Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetIdentityNotificationTopicAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetIdentityNotificationTopicRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetIdentityNotificationTopicOutcome> SetIdentityNotificationTopicAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetIdentityNotificationTopicOutcome>([this, request](const std::function<void(Model::SetIdentityNotificationTopicOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetIdentityNotificationTopicAsync(request, [complete](const SESClient*, const Model::SetIdentityNotificationTopicRequest&, const Model::SetIdentityNotificationTopicOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetIdentityNotificationTopicOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the position of the specified receipt rule in the receipt rule set.</p>
          * <p>For information about managing receipt rules, see the <a
@@ -1765,6 +2753,31 @@ namespace Model
          */
         virtual void SetReceiptRulePositionAsync(const Model::SetReceiptRulePositionRequest& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the position of the specified receipt rule in the receipt rule set.</p>
+         * <p>For information about managing receipt rules, see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-managing-receipt-rules.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetReceiptRulePositionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetReceiptRulePositionRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetReceiptRulePositionOutcome> SetReceiptRulePositionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetReceiptRulePositionOutcome>([this, request](const std::function<void(Model::SetReceiptRulePositionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetReceiptRulePositionAsync(request, [complete](const SESClient*, const Model::SetReceiptRulePositionRequest&, const Model::SetReceiptRulePositionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetReceiptRulePositionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a receipt rule.</p> <p>For information about managing receipt rules,
          * see the <a
@@ -1796,6 +2809,31 @@ namespace Model
          */
         virtual void UpdateReceiptRuleAsync(const Model::UpdateReceiptRuleRequest& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a receipt rule.</p> <p>For information about managing receipt rules,
+         * see the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/receiving-email-managing-receipt-rules.html">Amazon
+         * SES Developer Guide</a>.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateReceiptRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateReceiptRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateReceiptRuleOutcome> UpdateReceiptRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateReceiptRuleOutcome>([this, request](const std::function<void(Model::UpdateReceiptRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateReceiptRuleAsync(request, [complete](const SESClient*, const Model::UpdateReceiptRuleRequest&, const Model::UpdateReceiptRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateReceiptRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a set of DKIM tokens for a domain. DKIM <i>tokens</i> are character
          * strings that represent your domain's identity. Using these tokens, you will need
@@ -1848,6 +2886,38 @@ namespace Model
          */
         virtual void VerifyDomainDkimAsync(const Model::VerifyDomainDkimRequest& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a set of DKIM tokens for a domain. DKIM <i>tokens</i> are character
+         * strings that represent your domain's identity. Using these tokens, you will need
+         * to create DNS CNAME records that point to DKIM public keys hosted by Amazon SES.
+         * Amazon Web Services will eventually detect that you have updated your DNS
+         * records; this detection process may take up to 72 hours. Upon successful
+         * detection, Amazon SES will be able to DKIM-sign email originating from that
+         * domain.</p> <p>This action is throttled at one request per second.</p> <p>To
+         * enable or disable Easy DKIM signing for a domain, use the
+         * <code>SetIdentityDkimEnabled</code> action.</p> <p>For more information about
+         * creating DNS records using DKIM tokens, go to the <a
+         * href="http://docs.aws.amazon.com/ses/latest/DeveloperGuide/easy-dkim-dns-records.html">Amazon
+         * SES Developer Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way VerifyDomainDkimAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::VerifyDomainDkimRequest>
+        Aws::Utils::Threading::Awaitable<Model::VerifyDomainDkimOutcome> VerifyDomainDkimAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::VerifyDomainDkimOutcome>([this, request](const std::function<void(Model::VerifyDomainDkimOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->VerifyDomainDkimAsync(request, [complete](const SESClient*, const Model::VerifyDomainDkimRequest&, const Model::VerifyDomainDkimOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::VerifyDomainDkimOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Verifies a domain.</p> <p>This action is throttled at one request per
          * second.</p>
@@ -1870,6 +2940,28 @@ namespace Model
          */
         virtual void VerifyDomainIdentityAsync(const Model::VerifyDomainIdentityRequest& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Verifies a domain.</p> <p>This action is throttled at one request per
+         * second.</p>
+         *
+         * Returns an awaitable that starts the operation the way VerifyDomainIdentityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::VerifyDomainIdentityRequest>
+        Aws::Utils::Threading::Awaitable<Model::VerifyDomainIdentityOutcome> VerifyDomainIdentityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::VerifyDomainIdentityOutcome>([this, request](const std::function<void(Model::VerifyDomainIdentityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->VerifyDomainIdentityAsync(request, [complete](const SESClient*, const Model::VerifyDomainIdentityRequest&, const Model::VerifyDomainIdentityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::VerifyDomainIdentityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Verifies an email address. This action causes a confirmation email message to
          * be sent to the specified address.</p> <important>The VerifyEmailAddress action
@@ -1901,6 +2993,31 @@ namespace Model
          */
         virtual void VerifyEmailAddressAsync(const Model::VerifyEmailAddressRequest& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Verifies an email address. This action causes a confirmation email message to
+         * be sent to the specified address.</p> <important>The VerifyEmailAddress action
+         * is deprecated as of the May 15, 2012 release of Domain Verification. The
+         * VerifyEmailIdentity action is now preferred.</important> <p>This action is
+         * throttled at one request per second.</p>
+         *
+         * Returns an awaitable that starts the operation the way VerifyEmailAddressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::VerifyEmailAddressRequest>
+        Aws::Utils::Threading::Awaitable<Model::VerifyEmailAddressOutcome> VerifyEmailAddressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::VerifyEmailAddressOutcome>([this, request](const std::function<void(Model::VerifyEmailAddressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->VerifyEmailAddressAsync(request, [complete](const SESClient*, const Model::VerifyEmailAddressRequest&, const Model::VerifyEmailAddressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::VerifyEmailAddressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Verifies an email address. This action causes a confirmation email message to
          * be sent to the specified address.</p> <p>This action is throttled at one request
@@ -1926,6 +3043,29 @@ namespace Model
          */
         virtual void VerifyEmailIdentityAsync(const Model::VerifyEmailIdentityRequest& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Verifies an email address. This action causes a confirmation email message to
+         * be sent to the specified address.</p> <p>This action is throttled at one request
+         * per second.</p>
+         *
+         * Returns an awaitable that starts the operation the way VerifyEmailIdentityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::VerifyEmailIdentityRequest>
+        Aws::Utils::Threading::Awaitable<Model::VerifyEmailIdentityOutcome> VerifyEmailIdentityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::VerifyEmailIdentityOutcome>([this, request](const std::function<void(Model::VerifyEmailIdentityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->VerifyEmailIdentityAsync(request, [complete](const SESClient*, const Model::VerifyEmailIdentityRequest&, const Model::VerifyEmailIdentityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::VerifyEmailIdentityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
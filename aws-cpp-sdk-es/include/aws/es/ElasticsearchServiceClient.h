@@ -30,6 +30,7 @@
 #include <aws/es/model/UpdateElasticsearchDomainConfigResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -191,6 +192,32 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches tags to an existing Elasticsearch domain. Tags are a set of
+         * case-sensitive key value pairs. An Elasticsearch domain may have up to 10 tags.
+         * See <a
+         * href="http://docs.aws.amazon.com/elasticsearch-service/latest/developerguide/es-managedomains.html#es-managedomains-awsresorcetagging"
+         * target="_blank"> Tagging Amazon Elasticsearch Service Domains for more
+         * information.</a></p>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsOutcome> AddTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsOutcome>([this, request](const std::function<void(Model::AddTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsAsync(request, [complete](const ElasticsearchServiceClient*, const Model::AddTagsRequest&, const Model::AddTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new Elasticsearch domain. For more information, see <a
          * href="http://docs.aws.amazon.com/elasticsearch-service/latest/developerguide/es-createupdatedomains.html#es-createdomains"
@@ -219,6 +246,30 @@ namespace Model
          */
         virtual void CreateElasticsearchDomainAsync(const Model::CreateElasticsearchDomainRequest& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new Elasticsearch domain. For more information, see <a
+         * href="http://docs.aws.amazon.com/elasticsearch-service/latest/developerguide/es-createupdatedomains.html#es-createdomains"
+         * target="_blank">Creating Elasticsearch Domains</a> in the <i>Amazon
+         * Elasticsearch Service Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateElasticsearchDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateElasticsearchDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateElasticsearchDomainOutcome> CreateElasticsearchDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateElasticsearchDomainOutcome>([this, request](const std::function<void(Model::CreateElasticsearchDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateElasticsearchDomainAsync(request, [complete](const ElasticsearchServiceClient*, const Model::CreateElasticsearchDomainRequest&, const Model::CreateElasticsearchDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateElasticsearchDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Permanently deletes the specified Elasticsearch domain and all of its data.
          * Once a domain is deleted, it cannot be recovered.</p>
@@ -241,6 +292,28 @@ namespace Model
          */
         virtual void DeleteElasticsearchDomainAsync(const Model::DeleteElasticsearchDomainRequest& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Permanently deletes the specified Elasticsearch domain and all of its data.
+         * Once a domain is deleted, it cannot be recovered.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteElasticsearchDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteElasticsearchDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteElasticsearchDomainOutcome> DeleteElasticsearchDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteElasticsearchDomainOutcome>([this, request](const std::function<void(Model::DeleteElasticsearchDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteElasticsearchDomainAsync(request, [complete](const ElasticsearchServiceClient*, const Model::DeleteElasticsearchDomainRequest&, const Model::DeleteElasticsearchDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteElasticsearchDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns domain configuration information about the specified Elasticsearch
          * domain, including the domain ID, domain endpoint, and domain ARN.</p>
@@ -263,6 +336,28 @@ namespace Model
          */
         virtual void DescribeElasticsearchDomainAsync(const Model::DescribeElasticsearchDomainRequest& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns domain configuration information about the specified Elasticsearch
+         * domain, including the domain ID, domain endpoint, and domain ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeElasticsearchDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeElasticsearchDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeElasticsearchDomainOutcome> DescribeElasticsearchDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeElasticsearchDomainOutcome>([this, request](const std::function<void(Model::DescribeElasticsearchDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeElasticsearchDomainAsync(request, [complete](const ElasticsearchServiceClient*, const Model::DescribeElasticsearchDomainRequest&, const Model::DescribeElasticsearchDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeElasticsearchDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides cluster configuration information about the specified Elasticsearch
          * domain, such as the state, creation date, update version, and update date for
@@ -288,6 +383,29 @@ namespace Model
          */
         virtual void DescribeElasticsearchDomainConfigAsync(const Model::DescribeElasticsearchDomainConfigRequest& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides cluster configuration information about the specified Elasticsearch
+         * domain, such as the state, creation date, update version, and update date for
+         * cluster options.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeElasticsearchDomainConfigAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeElasticsearchDomainConfigRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeElasticsearchDomainConfigOutcome> DescribeElasticsearchDomainConfigAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeElasticsearchDomainConfigOutcome>([this, request](const std::function<void(Model::DescribeElasticsearchDomainConfigOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeElasticsearchDomainConfigAsync(request, [complete](const ElasticsearchServiceClient*, const Model::DescribeElasticsearchDomainConfigRequest&, const Model::DescribeElasticsearchDomainConfigOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeElasticsearchDomainConfigOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns domain configuration information about the specified Elasticsearch
          * domains, including the domain ID, domain endpoint, and domain ARN.</p>
@@ -310,6 +428,28 @@ namespace Model
          */
         virtual void DescribeElasticsearchDomainsAsync(const Model::DescribeElasticsearchDomainsRequest& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns domain configuration information about the specified Elasticsearch
+         * domains, including the domain ID, domain endpoint, and domain ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeElasticsearchDomainsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeElasticsearchDomainsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeElasticsearchDomainsOutcome> DescribeElasticsearchDomainsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeElasticsearchDomainsOutcome>([this, request](const std::function<void(Model::DescribeElasticsearchDomainsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeElasticsearchDomainsAsync(request, [complete](const ElasticsearchServiceClient*, const Model::DescribeElasticsearchDomainsRequest&, const Model::DescribeElasticsearchDomainsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeElasticsearchDomainsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the name of all Elasticsearch domains owned by the current user's
          * account. </p>
@@ -331,6 +471,27 @@ namespace Model
          * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
         virtual void ListDomainNamesAsync(const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the name of all Elasticsearch domains owned by the current user's
+         * account. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListDomainNamesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        Aws::Utils::Threading::Awaitable<Model::ListDomainNamesOutcome> ListDomainNamesAwaitable() const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDomainNamesOutcome>([this](const std::function<void(Model::ListDomainNamesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDomainNamesAsync([complete](const ElasticsearchServiceClient*, const Model::ListDomainNamesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDomainNamesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
         /**
          * <p>Returns all tags for the given Elasticsearch domain.</p>
          */
@@ -350,6 +511,27 @@ namespace Model
          */
         virtual void ListTagsAsync(const Model::ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns all tags for the given Elasticsearch domain.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsOutcome> ListTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsOutcome>([this, request](const std::function<void(Model::ListTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsAsync(request, [complete](const ElasticsearchServiceClient*, const Model::ListTagsRequest&, const Model::ListTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified set of tags from the specified Elasticsearch
          * domain.</p>
@@ -372,6 +554,28 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified set of tags from the specified Elasticsearch
+         * domain.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsOutcome>([this, request](const std::function<void(Model::RemoveTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsAsync(request, [complete](const ElasticsearchServiceClient*, const Model::RemoveTagsRequest&, const Model::RemoveTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies the cluster configuration of the specified Elasticsearch domain,
          * setting as setting the instance type and the number of instances. </p>
@@ -394,6 +598,28 @@ namespace Model
          */
         virtual void UpdateElasticsearchDomainConfigAsync(const Model::UpdateElasticsearchDomainConfigRequest& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies the cluster configuration of the specified Elasticsearch domain,
+         * setting as setting the instance type and the number of instances. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateElasticsearchDomainConfigAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateElasticsearchDomainConfigRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateElasticsearchDomainConfigOutcome> UpdateElasticsearchDomainConfigAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateElasticsearchDomainConfigOutcome>([this, request](const std::function<void(Model::UpdateElasticsearchDomainConfigOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateElasticsearchDomainConfigAsync(request, [complete](const ElasticsearchServiceClient*, const Model::UpdateElasticsearchDomainConfigRequest&, const Model::UpdateElasticsearchDomainConfigOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateElasticsearchDomainConfigOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -31,6 +31,7 @@
 #include <aws/events/model/TestEventPatternResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -201,6 +202,30 @@ namespace Model
          */
         virtual void DeleteRuleAsync(const Model::DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a rule. You must remove all targets from a rule using
+         * <a>RemoveTargets</a> before you can delete the rule.</p> <p> <b>Note:</b> When
+         * you delete a rule, incoming events might still continue to match to the deleted
+         * rule. Please allow a short period of time for changes to take effect. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRuleOutcome> DeleteRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRuleOutcome>([this, request](const std::function<void(Model::DeleteRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRuleAsync(request, [complete](const CloudWatchEventsClient*, const Model::DeleteRuleRequest&, const Model::DeleteRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the details of the specified rule.</p>
          */
@@ -220,6 +245,27 @@ namespace Model
          */
         virtual void DescribeRuleAsync(const Model::DescribeRuleRequest& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the details of the specified rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeRuleOutcome> DescribeRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeRuleOutcome>([this, request](const std::function<void(Model::DescribeRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeRuleAsync(request, [complete](const CloudWatchEventsClient*, const Model::DescribeRuleRequest&, const Model::DescribeRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables a rule. A disabled rule won't match any events, and won't
          * self-trigger if it has a schedule expression.</p> <p> <b>Note:</b> When you
@@ -248,6 +294,30 @@ namespace Model
          */
         virtual void DisableRuleAsync(const Model::DisableRuleRequest& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables a rule. A disabled rule won't match any events, and won't
+         * self-trigger if it has a schedule expression.</p> <p> <b>Note:</b> When you
+         * disable a rule, incoming events might still continue to match to the disabled
+         * rule. Please allow a short period of time for changes to take effect. </p>
+         *
+         * Returns an awaitable that starts the operation the way DisableRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableRuleOutcome> DisableRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableRuleOutcome>([this, request](const std::function<void(Model::DisableRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableRuleAsync(request, [complete](const CloudWatchEventsClient*, const Model::DisableRuleRequest&, const Model::DisableRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables a rule. If the rule does not exist, the operation fails.</p> <p>
          * <b>Note:</b> When you enable a rule, incoming events might not immediately start
@@ -276,6 +346,30 @@ namespace Model
          */
         virtual void EnableRuleAsync(const Model::EnableRuleRequest& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables a rule. If the rule does not exist, the operation fails.</p> <p>
+         * <b>Note:</b> When you enable a rule, incoming events might not immediately start
+         * matching to a newly enabled rule. Please allow a short period of time for
+         * changes to take effect. </p>
+         *
+         * Returns an awaitable that starts the operation the way EnableRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableRuleOutcome> EnableRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableRuleOutcome>([this, request](const std::function<void(Model::EnableRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableRuleAsync(request, [complete](const CloudWatchEventsClient*, const Model::EnableRuleRequest&, const Model::EnableRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the names of the rules that the given target is put to. You can see
          * which of the rules in Amazon CloudWatch Events can invoke a specific target in
@@ -310,6 +404,32 @@ namespace Model
          */
         virtual void ListRuleNamesByTargetAsync(const Model::ListRuleNamesByTargetRequest& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the names of the rules that the given target is put to. You can see
+         * which of the rules in Amazon CloudWatch Events can invoke a specific target in
+         * your account. If you have more rules in your account than the given limit, the
+         * results will be paginated. In that case, use the next token returned in the
+         * response and repeat ListRulesByTarget until the NextToken in the response is
+         * returned as null.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListRuleNamesByTargetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRuleNamesByTargetRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRuleNamesByTargetOutcome> ListRuleNamesByTargetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRuleNamesByTargetOutcome>([this, request](const std::function<void(Model::ListRuleNamesByTargetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRuleNamesByTargetAsync(request, [complete](const CloudWatchEventsClient*, const Model::ListRuleNamesByTargetRequest&, const Model::ListRuleNamesByTargetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRuleNamesByTargetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the Amazon CloudWatch Events rules in your account. You can either list
          * all the rules or you can provide a prefix to match to the rule names. If you
@@ -341,6 +461,31 @@ namespace Model
          */
         virtual void ListRulesAsync(const Model::ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the Amazon CloudWatch Events rules in your account. You can either list
+         * all the rules or you can provide a prefix to match to the rule names. If you
+         * have more rules in your account than the given limit, the results will be
+         * paginated. In that case, use the next token returned in the response and repeat
+         * ListRules until the NextToken in the response is returned as null.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListRulesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRulesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRulesOutcome> ListRulesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRulesOutcome>([this, request](const std::function<void(Model::ListRulesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRulesAsync(request, [complete](const CloudWatchEventsClient*, const Model::ListRulesRequest&, const Model::ListRulesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRulesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists of targets assigned to the rule.</p>
          */
@@ -360,6 +505,27 @@ namespace Model
          */
         virtual void ListTargetsByRuleAsync(const Model::ListTargetsByRuleRequest& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists of targets assigned to the rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTargetsByRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTargetsByRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTargetsByRuleOutcome> ListTargetsByRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTargetsByRuleOutcome>([this, request](const std::function<void(Model::ListTargetsByRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTargetsByRuleAsync(request, [complete](const CloudWatchEventsClient*, const Model::ListTargetsByRuleRequest&, const Model::ListTargetsByRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTargetsByRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sends custom events to Amazon CloudWatch Events so that they can be matched
          * to rules.</p>
@@ -382,6 +548,28 @@ namespace Model
          */
         virtual void PutEventsAsync(const Model::PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sends custom events to Amazon CloudWatch Events so that they can be matched
+         * to rules.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutEventsOutcome> PutEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutEventsOutcome>([this, request](const std::function<void(Model::PutEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutEventsAsync(request, [complete](const CloudWatchEventsClient*, const Model::PutEventsRequest&, const Model::PutEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates or updates a rule. Rules are enabled by default, or based on value of
          * the State parameter. You can disable a rule using <a>DisableRule</a>.</p> <p>
@@ -440,6 +628,40 @@ namespace Model
          */
         virtual void PutRuleAsync(const Model::PutRuleRequest& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates or updates a rule. Rules are enabled by default, or based on value of
+         * the State parameter. You can disable a rule using <a>DisableRule</a>.</p> <p>
+         * <b>Note:</b> When you create or update a rule, incoming events might not
+         * immediately start matching to new or updated rules. Please allow a short period
+         * of time for changes to take effect.</p> <p>A rule must contain at least an
+         * EventPattern or ScheduleExpression. Rules with EventPatterns are triggered when
+         * a matching event is observed. Rules with ScheduleExpressions self-trigger based
+         * on the given schedule. A rule can have both an EventPattern and a
+         * ScheduleExpression, in which case the rule will trigger on matching events as
+         * well as on a schedule.</p> <p> <b>Note:</b> Most services in AWS treat : or / as
+         * the same character in Amazon Resource Names (ARNs). However, CloudWatch Events
+         * uses an exact match in event patterns and rules. Be sure to use the correct ARN
+         * characters when creating event patterns so that they match the ARN syntax in the
+         * event you want to match. </p>
+         *
+         * Returns an awaitable that starts the operation the way PutRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutRuleOutcome> PutRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutRuleOutcome>([this, request](const std::function<void(Model::PutRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutRuleAsync(request, [complete](const CloudWatchEventsClient*, const Model::PutRuleRequest&, const Model::PutRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds target(s) to a rule. Targets are the resources that can be invoked when
          * a rule is triggered. For example, AWS Lambda functions, Amazon Kinesis streams,
@@ -525,6 +747,49 @@ namespace Model
          */
         virtual void PutTargetsAsync(const Model::PutTargetsRequest& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds target(s) to a rule. Targets are the resources that can be invoked when
+         * a rule is triggered. For example, AWS Lambda functions, Amazon Kinesis streams,
+         * and built-in targets. Updates the target(s) if they are already associated with
+         * the role. In other words, if there is already a target with the given target ID,
+         * then the target associated with that ID is updated.</p> <p>In order to be able
+         * to make API calls against the resources you own, Amazon CloudWatch Events needs
+         * the appropriate permissions. For AWS Lambda and Amazon SNS resources, CloudWatch
+         * Events relies on resource-based policies. For Amazon Kinesis streams, CloudWatch
+         * Events relies on IAM roles. For more information, see <a
+         * href="http://docs.aws.amazon.com/AmazonCloudWatch/latest/DeveloperGuide/EventsTargetPermissions.html">Permissions
+         * for Sending Events to Targets</a> in the <b><i>Amazon CloudWatch Developer
+         * Guide</i></b>.</p> <p><b>Input</b> and <b>InputPath</b> are mutually-exclusive
+         * and optional parameters of a target. When a rule is triggered due to a matched
+         * event, if for a target:</p> <ul> <li>Neither <b>Input</b> nor <b>InputPath</b>
+         * is specified, then the entire event is passed to the target in JSON form.</li>
+         * <li> <b>InputPath</b> is specified in the form of JSONPath (e.g.
+         * <b>$.detail</b>), then only the part of the event specified in the path is
+         * passed to the target (e.g. only the detail part of the event is passed). </li>
+         * <li> <b>Input</b> is specified in the form of a valid JSON, then the matched
+         * event is overridden with this constant.</li> </ul> <p> <b>Note:</b> When you add
+         * targets to a rule, when the associated rule triggers, new or updated targets
+         * might not be immediately invoked. Please allow a short period of time for
+         * changes to take effect. </p>
+         *
+         * Returns an awaitable that starts the operation the way PutTargetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutTargetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutTargetsOutcome> PutTargetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutTargetsOutcome>([this, request](const std::function<void(Model::PutTargetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutTargetsAsync(request, [complete](const CloudWatchEventsClient*, const Model::PutTargetsRequest&, const Model::PutTargetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutTargetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes target(s) from a rule so that when the rule is triggered, those
          * targets will no longer be invoked.</p> <p> <b>Note:</b> When you remove a
@@ -556,6 +821,31 @@ namespace Model
          */
         virtual void RemoveTargetsAsync(const Model::RemoveTargetsRequest& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes target(s) from a rule so that when the rule is triggered, those
+         * targets will no longer be invoked.</p> <p> <b>Note:</b> When you remove a
+         * target, when the associated rule triggers, removed targets might still continue
+         * to be invoked. Please allow a short period of time for changes to take effect.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTargetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTargetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTargetsOutcome> RemoveTargetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTargetsOutcome>([this, request](const std::function<void(Model::RemoveTargetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTargetsAsync(request, [complete](const CloudWatchEventsClient*, const Model::RemoveTargetsRequest&, const Model::RemoveTargetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTargetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Tests whether an event pattern matches the provided event.</p> <p>
          * <b>Note:</b> Most services in AWS treat : or / as the same character in Amazon
@@ -590,6 +880,32 @@ namespace Model
          */
         virtual void TestEventPatternAsync(const Model::TestEventPatternRequest& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Tests whether an event pattern matches the provided event.</p> <p>
+         * <b>Note:</b> Most services in AWS treat : or / as the same character in Amazon
+         * Resource Names (ARNs). However, CloudWatch Events uses an exact match in event
+         * patterns and rules. Be sure to use the correct ARN characters when creating
+         * event patterns so that they match the ARN syntax in the event you want to match.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way TestEventPatternAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TestEventPatternRequest>
+        Aws::Utils::Threading::Awaitable<Model::TestEventPatternOutcome> TestEventPatternAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TestEventPatternOutcome>([this, request](const std::function<void(Model::TestEventPatternOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TestEventPatternAsync(request, [complete](const CloudWatchEventsClient*, const Model::TestEventPatternRequest&, const Model::TestEventPatternOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TestEventPatternOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
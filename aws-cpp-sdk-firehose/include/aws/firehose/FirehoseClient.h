@@ -28,6 +28,7 @@
 #include <aws/firehose/model/PutRecordBatchResult.h>
 #include <aws/firehose/model/UpdateDestinationResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -287,6 +288,70 @@ namespace Model
          */
         virtual void CreateDeliveryStreamAsync(const Model::CreateDeliveryStreamRequest& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a delivery stream.</p> <p><a>CreateDeliveryStream</a> is an
+         * asynchronous operation that immediately returns. The initial status of the
+         * delivery stream is <code>CREATING</code>. After the delivery stream is created,
+         * its status is <code>ACTIVE</code> and it now accepts data. Attempts to send data
+         * to a delivery stream that is not in the <code>ACTIVE</code> state cause an
+         * exception. To check the state of a delivery stream, use
+         * <a>DescribeDeliveryStream</a>.</p> <p>The name of a delivery stream identifies
+         * it. You can't have two delivery streams with the same name in the same region.
+         * Two delivery streams in different AWS accounts or different regions in the same
+         * AWS account can have the same name.</p> <p>By default, you can create up to 5
+         * delivery streams per region.</p> <p>A delivery stream can only be configured
+         * with a single destination, Amazon S3 or Amazon Redshift. For correct
+         * <a>CreateDeliveryStream</a> request syntax, specify only one destination
+         * configuration parameter: either <code>RedshiftDestinationConfiguration</code> or
+         * <code>S3DestinationConfiguration</code></p> <p>As part of
+         * <code>S3DestinationConfiguration</code>, optional values
+         * <code>BufferingHints</code>, <code>EncryptionConfiguration</code>, and
+         * <code>CompressionFormat</code> can be provided. By default, if no
+         * <code>BufferingHints</code> value is provided, Amazon Kinesis Firehose buffers
+         * data up to 5 MB or for 5 minutes, whichever condition is satisfied first. Note
+         * that <code>BufferingHints</code> is a hint, so there are some cases where the
+         * service cannot adhere to these conditions strictly; for example, record
+         * boundaries are such that the size is a little over or under the configured
+         * buffering size. By default, no encryption is performed. We strongly recommend
+         * that you enable encryption to ensure secure data storage in Amazon S3.</p> <p>A
+         * few notes about <code>RedshiftDestinationConfiguration</code>:</p> <ul> <li>An
+         * Amazon Redshift destination requires an S3 bucket as intermediate location, as
+         * Amazon Kinesis Firehose first delivers data to S3 and then uses
+         * <code>COPY</code> syntax to load data into an Amazon Redshift table. This is
+         * specified in the <code>RedshiftDestinationConfiguration.S3Configuration</code>
+         * parameter element.</li> <li>The compression formats <code>SNAPPY</code> or
+         * <code>ZIP</code> cannot be specified in
+         * <code>RedshiftDestinationConfiguration.S3Configuration</code> because the Amazon
+         * Redshift <code>COPY</code> operation that reads from the S3 bucket doesn't
+         * support these compression formats.</li> <li>We strongly recommend that the
+         * username and password provided is used exclusively for Amazon Kinesis Firehose
+         * purposes, and that the permissions for the account are restricted for Amazon
+         * Redshift <code>INSERT</code> permissions.</li> </ul> <p>Amazon Kinesis Firehose
+         * assumes the IAM role that is configured as part of destinations. The IAM role
+         * should allow the Amazon Kinesis Firehose principal to assume the role, and the
+         * role should have permissions that allows the service to deliver the data. For
+         * more information, see <a
+         * href="http://docs.aws.amazon.com/firehose/latest/dev/controlling-access.html#using-iam-s3">Amazon
+         * S3 Bucket Access</a> in the <i>Amazon Kinesis Firehose Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDeliveryStreamAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDeliveryStreamRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDeliveryStreamOutcome> CreateDeliveryStreamAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDeliveryStreamOutcome>([this, request](const std::function<void(Model::CreateDeliveryStreamOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDeliveryStreamAsync(request, [complete](const FirehoseClient*, const Model::CreateDeliveryStreamRequest&, const Model::CreateDeliveryStreamOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDeliveryStreamOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a delivery stream and its data.</p> <p>You can delete a delivery
          * stream only if it is in <code>ACTIVE</code> or <code>DELETING</code> state, and
@@ -333,6 +398,36 @@ namespace Model
          */
         virtual void DeleteDeliveryStreamAsync(const Model::DeleteDeliveryStreamRequest& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a delivery stream and its data.</p> <p>You can delete a delivery
+         * stream only if it is in <code>ACTIVE</code> or <code>DELETING</code> state, and
+         * not in the <code>CREATING</code> state. While the deletion request is in
+         * process, the delivery stream is in the <code>DELETING</code> state.</p> <p>To
+         * check the state of a delivery stream, use <a>DescribeDeliveryStream</a>.</p>
+         * <p>While the delivery stream is <code>DELETING</code> state, the service may
+         * continue to accept the records, but the service doesn't make any guarantees with
+         * respect to delivering the data. Therefore, as a best practice, you should first
+         * stop any applications that are sending records before deleting a delivery
+         * stream.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDeliveryStreamAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDeliveryStreamRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDeliveryStreamOutcome> DeleteDeliveryStreamAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDeliveryStreamOutcome>([this, request](const std::function<void(Model::DeleteDeliveryStreamOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDeliveryStreamAsync(request, [complete](const FirehoseClient*, const Model::DeleteDeliveryStreamRequest&, const Model::DeleteDeliveryStreamOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDeliveryStreamOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified delivery stream and gets the status. For example,
          * after your delivery stream is created, call <a>DescribeDeliveryStream</a> to see
@@ -361,6 +456,30 @@ namespace Model
          */
         virtual void DescribeDeliveryStreamAsync(const Model::DescribeDeliveryStreamRequest& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified delivery stream and gets the status. For example,
+         * after your delivery stream is created, call <a>DescribeDeliveryStream</a> to see
+         * if the delivery stream is <code>ACTIVE</code> and therefore ready for data to be
+         * sent to it.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDeliveryStreamAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDeliveryStreamRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDeliveryStreamOutcome> DescribeDeliveryStreamAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDeliveryStreamOutcome>([this, request](const std::function<void(Model::DescribeDeliveryStreamOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDeliveryStreamAsync(request, [complete](const FirehoseClient*, const Model::DescribeDeliveryStreamRequest&, const Model::DescribeDeliveryStreamOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDeliveryStreamOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists your delivery streams.</p> <p>The number of delivery streams might be
          * too large to return using a single call to <a>ListDeliveryStreams</a>. You can
@@ -404,6 +523,35 @@ namespace Model
          */
         virtual void ListDeliveryStreamsAsync(const Model::ListDeliveryStreamsRequest& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists your delivery streams.</p> <p>The number of delivery streams might be
+         * too large to return using a single call to <a>ListDeliveryStreams</a>. You can
+         * limit the number of delivery streams returned, using the <code>Limit</code>
+         * parameter. To determine whether there are more delivery streams to list, check
+         * the value of <code>HasMoreDeliveryStreams</code> in the output. If there are
+         * more delivery streams to list, you can request them by specifying the name of
+         * the last delivery stream returned in the call in the
+         * <code>ExclusiveStartDeliveryStreamName</code> parameter of a subsequent
+         * call.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDeliveryStreamsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDeliveryStreamsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDeliveryStreamsOutcome> ListDeliveryStreamsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDeliveryStreamsOutcome>([this, request](const std::function<void(Model::ListDeliveryStreamsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDeliveryStreamsAsync(request, [complete](const FirehoseClient*, const Model::ListDeliveryStreamsRequest&, const Model::ListDeliveryStreamsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDeliveryStreamsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Writes a single data record into an Amazon Kinesis Firehose delivery stream.
          * To write multiple data records into a delivery stream, use
@@ -513,6 +661,57 @@ namespace Model
          */
         virtual void PutRecordAsync(const Model::PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Writes a single data record into an Amazon Kinesis Firehose delivery stream.
+         * To write multiple data records into a delivery stream, use
+         * <a>PutRecordBatch</a>. Applications using these operations are referred to as
+         * producers.</p> <p>By default, each delivery stream can take in up to 2,000
+         * transactions per second, 5,000 records per second, or 5 MB per second. Note that
+         * if you use <a>PutRecord</a> and <a>PutRecordBatch</a>, the limits are an
+         * aggregate across these two operations for each delivery stream. For more
+         * information about limits and how to request an increase, see <a
+         * href="http://docs.aws.amazon.com/firehose/latest/dev/limits.html">Amazon Kinesis
+         * Firehose Limits</a>. </p> <p>You must specify the name of the delivery stream
+         * and the data record when using <a>PutRecord</a>. The data record consists of a
+         * data blob that can be up to 1,000 KB in size, and any kind of data, for example,
+         * a segment from a log file, geographic location data, web site clickstream data,
+         * etc.</p> <p>Amazon Kinesis Firehose buffers records before delivering them to
+         * the destination. To disambiguate the data blobs at the destination, a common
+         * solution is to use delimiters in the data, such as a newline (<code>\n</code>)
+         * or some other character unique within the data. This allows the consumer
+         * application(s) to parse individual data items when reading the data from the
+         * destination.</p> <p>Amazon Kinesis Firehose does not maintain data record
+         * ordering. If the destination data needs to be re-ordered by the consumer
+         * application, the producer should include some form of sequence number in each
+         * data record. </p> <p>The <a>PutRecord</a> operation returns a
+         * <code>RecordId</code>, which is a unique string assigned to each record.
+         * Producer applications can use this ID for purposes such as auditability and
+         * investigation.</p> <p>If the <a>PutRecord</a> operation throws a
+         * <code>ServiceUnavailableException</code>, back off and retry. If the exception
+         * persists, it is possible that the throughput limits have been exceeded for the
+         * delivery stream. </p> <p>Data records sent to Amazon Kinesis Firehose are stored
+         * for 24 hours from the time they are added to a delivery stream as it attempts to
+         * send the records to the destination. If the destination is unreachable for more
+         * than 24 hours, the data is no longer available.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutRecordAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutRecordRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutRecordOutcome> PutRecordAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutRecordOutcome>([this, request](const std::function<void(Model::PutRecordOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutRecordAsync(request, [complete](const FirehoseClient*, const Model::PutRecordRequest&, const Model::PutRecordOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutRecordOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Writes multiple data records into a delivery stream in a single call, which
          * can achieve higher throughput per producer than when writing single records. To
@@ -682,6 +881,77 @@ namespace Model
          */
         virtual void PutRecordBatchAsync(const Model::PutRecordBatchRequest& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Writes multiple data records into a delivery stream in a single call, which
+         * can achieve higher throughput per producer than when writing single records. To
+         * write single data records into a delivery stream, use <a>PutRecord</a>.
+         * Applications using these operations are referred to as producers.</p> <p>Each
+         * <a>PutRecordBatch</a> request supports up to 500 records. Each record in the
+         * request can be as large as 1,000 KB (before 64-bit encoding), up to a limit of 4
+         * MB for the entire request. By default, each delivery stream can take in up to
+         * 2,000 transactions per second, 5,000 records per second, or 5 MB per second.
+         * Note that if you use <a>PutRecord</a> and <a>PutRecordBatch</a>, the limits are
+         * an aggregate across these two operations for each delivery stream. For more
+         * information about limits and how to request an increase, see <a
+         * href="http://docs.aws.amazon.com/firehose/latest/dev/limits.html">Amazon Kinesis
+         * Firehose Limits</a>. </p> <p>You must specify the name of the delivery stream
+         * and the data record when using <a>PutRecord</a>. The data record consists of a
+         * data blob that can be up to 1,000 KB in size, and any kind of data, for example,
+         * a segment from a log file, geographic location data, web site clickstream data,
+         * and so on.</p> <p>Amazon Kinesis Firehose buffers records before delivering them
+         * to the destination. To disambiguate the data blobs at the destination, a common
+         * solution is to use delimiters in the data, such as a newline (<code>\n</code>)
+         * or some other character unique within the data. This allows the consumer
+         * application(s) to parse individual data items when reading the data from the
+         * destination.</p> <p>The <a>PutRecordBatch</a> response includes a count of any
+         * failed records, <code>FailedPutCount</code>, and an array of responses,
+         * <code>RequestResponses</code>. The <code>FailedPutCount</code> value is a count
+         * of records that failed. Each entry in the <code>RequestResponses</code> array
+         * gives additional information of the processed record. Each entry in
+         * <code>RequestResponses</code> directly correlates with a record in the request
+         * array using the same ordering, from the top to the bottom of the request and
+         * response. <code>RequestResponses</code> always includes the same number of
+         * records as the request array. <code>RequestResponses</code> both successfully
+         * and unsuccessfully processed records. Amazon Kinesis Firehose attempts to
+         * process all records in each <a>PutRecordBatch</a> request. A single record
+         * failure does not stop the processing of subsequent records.</p> <p>A
+         * successfully processed record includes a <code>RecordId</code> value, which is a
+         * unique value identified for the record. An unsuccessfully processed record
+         * includes <code>ErrorCode</code> and <code>ErrorMessage</code> values.
+         * <code>ErrorCode</code> reflects the type of error and is one of the following
+         * values: <code>ServiceUnavailable</code> or <code>InternalFailure</code>.
+         * <code>ErrorMessage</code> provides more detailed information about the
+         * error.</p> <p>If <code>FailedPutCount</code> is greater than 0 (zero), retry the
+         * request. A retry of the entire batch of records is possible; however, we
+         * strongly recommend that you inspect the entire response and resend only those
+         * records that failed processing. This minimizes duplicate records and also
+         * reduces the total bytes sent (and corresponding charges).</p> <p>If the
+         * <a>PutRecordBatch</a> operation throws a
+         * <code>ServiceUnavailableException</code>, back off and retry. If the exception
+         * persists, it is possible that the throughput limits have been exceeded for the
+         * delivery stream.</p> <p>Data records sent to Amazon Kinesis Firehose are stored
+         * for 24 hours from the time they are added to a delivery stream as it attempts to
+         * send the records to the destination. If the destination is unreachable for more
+         * than 24 hours, the data is no longer available.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutRecordBatchAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutRecordBatchRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutRecordBatchOutcome> PutRecordBatchAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutRecordBatchOutcome>([this, request](const std::function<void(Model::PutRecordBatchOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutRecordBatchAsync(request, [complete](const FirehoseClient*, const Model::PutRecordBatchRequest&, const Model::PutRecordBatchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutRecordBatchOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the specified destination of the specified delivery stream. </p>
          * <p>This operation can be used to change the destination type (for example, to
@@ -776,6 +1046,52 @@ namespace Model
          */
         virtual void UpdateDestinationAsync(const Model::UpdateDestinationRequest& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the specified destination of the specified delivery stream. </p>
+         * <p>This operation can be used to change the destination type (for example, to
+         * replace the Amazon S3 destination with Amazon Redshift) or change the parameters
+         * associated with a given destination (for example, to change the bucket name of
+         * the Amazon S3 destination). The update may not occur immediately. The target
+         * delivery stream remains active while the configurations are updated, so data
+         * writes to the delivery stream can continue during this process. The updated
+         * configurations are normally effective within a few minutes. </p> <p>If the
+         * destination type is the same, Amazon Kinesis Firehose merges the configuration
+         * parameters specified in the <a>UpdateDestination</a> request with the
+         * destination configuration that already exists on the delivery stream. If any of
+         * the parameters are not specified in the update request, then the existing
+         * configuration parameters are retained. For example, in the Amazon S3
+         * destination, if <a>EncryptionConfiguration</a> is not specified then the
+         * existing <a>EncryptionConfiguration</a> is maintained on the destination.</p>
+         * <p>If the destination type is not the same, for example, changing the
+         * destination from Amazon S3 to Amazon Redshift, Amazon Kinesis Firehose does not
+         * merge any parameters. In this case, all parameters must be specified.</p>
+         * <p>Amazon Kinesis Firehose uses the <code>CurrentDeliveryStreamVersionId</code>
+         * to avoid race conditions and conflicting merges. This is a required field in
+         * every request and the service only updates the configuration if the existing
+         * configuration matches the <code>VersionId</code>. After the update is applied
+         * successfully, the <code>VersionId</code> is updated, which can be retrieved with
+         * the <a>DescribeDeliveryStream</a> operation. The new <code>VersionId</code>
+         * should be uses to set <code>CurrentDeliveryStreamVersionId</code> in the next
+         * <a>UpdateDestination</a> operation.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateDestinationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDestinationRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDestinationOutcome> UpdateDestinationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDestinationOutcome>([this, request](const std::function<void(Model::UpdateDestinationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDestinationAsync(request, [complete](const FirehoseClient*, const Model::UpdateDestinationRequest&, const Model::UpdateDestinationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDestinationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
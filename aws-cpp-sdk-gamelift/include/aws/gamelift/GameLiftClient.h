@@ -50,6 +50,7 @@
 #include <aws/gamelift/model/UpdateGameSessionResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -346,6 +347,37 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an alias for a fleet. You can use an alias to anonymize your fleet by
+         * referencing an alias instead of a specific fleet when you create game sessions.
+         * Amazon GameLift supports two types of routing strategies for aliases: simple and
+         * terminal. Use a simple alias to point to an active fleet. Use a terminal alias
+         * to display a message to incoming traffic instead of routing players to an active
+         * fleet. This option is useful when a game server is no longer supported but you
+         * want to provide better messaging than a standard 404 error.</p> <p>To create a
+         * fleet alias, specify an alias name, routing strategy, and optional description.
+         * If successful, a new alias record is returned, including an alias ID, which you
+         * can reference when creating a game session. To reassign the alias to another
+         * fleet ID, call <a>UpdateAlias</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAliasOutcome>([this, request](const std::function<void(Model::CreateAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAliasAsync(request, [complete](const GameLiftClient*, const Model::CreateAliasRequest&, const Model::CreateAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Initializes a new build record and generates information required to upload a
          * game build to Amazon GameLift. Once the build record has been created and is in
@@ -407,6 +439,41 @@ namespace Model
          */
         virtual void CreateBuildAsync(const Model::CreateBuildRequest& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Initializes a new build record and generates information required to upload a
+         * game build to Amazon GameLift. Once the build record has been created and is in
+         * an INITIALIZED state, you can upload your game build.</p> <important><p>To
+         * create a build, use the CLI command <code>upload-build</code>, which creates a
+         * new build record and uploads the build files in one step. (See the <a
+         * href="http://docs.aws.amazon.com/gamelift/latest/developerguide/">Amazon
+         * GameLift Developer Guide</a> for more details on the CLI and the upload
+         * process.) Call the <code>CreateBuild</code> action only if you have your own
+         * Amazon Simple Storage Service (Amazon S3) client and need to manually upload
+         * your build files.</p></important> <p>To create a new build, optionally specify a
+         * build name and version. This metadata is stored with other properties in the
+         * build record and is displayed in the GameLift console (but not visible to
+         * players). If successful, this action returns the newly created build record
+         * along with an Amazon S3 storage location and AWS account credentials. Use the
+         * location and credentials to upload your game build.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateBuildAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateBuildRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateBuildOutcome> CreateBuildAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateBuildOutcome>([this, request](const std::function<void(Model::CreateBuildOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateBuildAsync(request, [complete](const GameLiftClient*, const Model::CreateBuildRequest&, const Model::CreateBuildOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateBuildOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new fleet to host game servers. A fleet consists of a set of Amazon
          * Elastic Compute Cloud (Amazon EC2) instances of a certain type, which defines
@@ -501,6 +568,52 @@ namespace Model
          */
         virtual void CreateFleetAsync(const Model::CreateFleetRequest& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new fleet to host game servers. A fleet consists of a set of Amazon
+         * Elastic Compute Cloud (Amazon EC2) instances of a certain type, which defines
+         * the CPU, memory, storage, and networking capacity of each host in the fleet. See
+         * <a href="https://aws.amazon.com/ec2/instance-types/">Amazon EC2 Instance
+         * Types</a> for more information. Each instance in the fleet hosts a game server
+         * created from the specified game build. Once a fleet is in an ACTIVE state, it
+         * can begin hosting game sessions.</p> <p>To create a new fleet, provide a name
+         * and the EC2 instance type for the new fleet, and specify the build and server
+         * launch path. Builds must be in a READY state before they can be used to build
+         * fleets. When configuring the new fleet, you can optionally (1) provide a set of
+         * launch parameters to be passed to a game server when activated; (2) limit
+         * incoming traffic to a specified range of IP addresses and port numbers; and (3)
+         * configure Amazon GameLift to store game session logs by specifying the path to
+         * the logs stored in your game server files. If the call is successful, Amazon
+         * GameLift performs the following tasks:</p> <ul> <li>Creates a fleet record and
+         * sets the state to NEW.</li> <li>Sets the fleet's capacity to 1 "desired" and 1
+         * "active" EC2 instance count.</li> <li>Creates an EC2 instance and begins the
+         * process of initializing the fleet and activating a game server on the
+         * instance.</li> <li>Begins writing events to the fleet event log, which can be
+         * accessed in the GameLift console.</li> </ul> <p>Once a fleet is created, use the
+         * following actions to change certain fleet properties (server launch parameters
+         * and log paths cannot be changed):</p> <ul> <li> <a>UpdateFleetAttributes</a> --
+         * Update fleet metadata, including name and description.</li> <li>
+         * <a>UpdateFleetCapacity</a> -- Increase or decrease the number of instances you
+         * want the fleet to maintain.</li> <li> <a>UpdateFleetPortSettings</a> -- Change
+         * the IP addresses and ports that allow access to incoming traffic.</li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way CreateFleetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateFleetRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateFleetOutcome> CreateFleetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateFleetOutcome>([this, request](const std::function<void(Model::CreateFleetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateFleetAsync(request, [complete](const GameLiftClient*, const Model::CreateFleetRequest&, const Model::CreateFleetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateFleetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a multiplayer game session for players. This action creates a game
          * session record and assigns the new session to an instance in the specified
@@ -550,6 +663,37 @@ namespace Model
          */
         virtual void CreateGameSessionAsync(const Model::CreateGameSessionRequest& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a multiplayer game session for players. This action creates a game
+         * session record and assigns the new session to an instance in the specified
+         * fleet, which activates the server initialization process in your game server. A
+         * fleet must be in an ACTIVE state before a game session can be created for
+         * it.</p> <p>To create a game session, specify either a fleet ID or an alias ID
+         * and indicate the maximum number of players the game session allows. You can also
+         * provide a name and a set of properties for your game (optional). If successful,
+         * a <a>GameSession</a> object is returned containing session properties, including
+         * an IP address. By default, newly created game sessions are set to accept adding
+         * any new players to the game session. Use <a>UpdateGameSession</a> to change the
+         * creation policy.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateGameSessionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateGameSessionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateGameSessionOutcome> CreateGameSessionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateGameSessionOutcome>([this, request](const std::function<void(Model::CreateGameSessionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateGameSessionAsync(request, [complete](const GameLiftClient*, const Model::CreateGameSessionRequest&, const Model::CreateGameSessionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateGameSessionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds a player to a game session and creates a player session record. A game
          * session must be in an ACTIVE state, have a creation policy of ALLOW_ALL, and
@@ -584,6 +728,32 @@ namespace Model
          */
         virtual void CreatePlayerSessionAsync(const Model::CreatePlayerSessionRequest& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds a player to a game session and creates a player session record. A game
+         * session must be in an ACTIVE state, have a creation policy of ALLOW_ALL, and
+         * have an open player slot before players can be added to the session.</p> <p>To
+         * create a player session, specify a game session ID and player ID. If successful,
+         * the player is added to the game session and a new <a>PlayerSession</a> object is
+         * returned. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePlayerSessionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePlayerSessionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePlayerSessionOutcome> CreatePlayerSessionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePlayerSessionOutcome>([this, request](const std::function<void(Model::CreatePlayerSessionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePlayerSessionAsync(request, [complete](const GameLiftClient*, const Model::CreatePlayerSessionRequest&, const Model::CreatePlayerSessionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePlayerSessionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds a group of players to a game session. Similar to
          * <a>CreatePlayerSession</a>, this action allows you to add multiple players in a
@@ -624,6 +794,34 @@ namespace Model
          */
         virtual void CreatePlayerSessionsAsync(const Model::CreatePlayerSessionsRequest& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds a group of players to a game session. Similar to
+         * <a>CreatePlayerSession</a>, this action allows you to add multiple players in a
+         * single call, which is useful for games that provide party and/or matchmaking
+         * features. A game session must be in an ACTIVE state, have a creation policy of
+         * ALLOW_ALL, and have an open player slot before players can be added to the
+         * session.</p> <p>To create player sessions, specify a game session ID and a list
+         * of player IDs. If successful, the players are added to the game session and a
+         * set of new <a>PlayerSession</a> objects is returned. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePlayerSessionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePlayerSessionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePlayerSessionsOutcome> CreatePlayerSessionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePlayerSessionsOutcome>([this, request](const std::function<void(Model::CreatePlayerSessionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePlayerSessionsAsync(request, [complete](const GameLiftClient*, const Model::CreatePlayerSessionsRequest&, const Model::CreatePlayerSessionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePlayerSessionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an alias. This action removes all record of the alias; game clients
          * attempting to access a game server using the deleted alias receive an error. To
@@ -649,6 +847,29 @@ namespace Model
          */
         virtual void DeleteAliasAsync(const Model::DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an alias. This action removes all record of the alias; game clients
+         * attempting to access a game server using the deleted alias receive an error. To
+         * delete an alias, specify the alias ID to be deleted.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAliasOutcome> DeleteAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAliasOutcome>([this, request](const std::function<void(Model::DeleteAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAliasAsync(request, [complete](const GameLiftClient*, const Model::DeleteAliasRequest&, const Model::DeleteAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a build. This action permanently deletes the build record and any
          * uploaded build files.</p> <p>To delete a build, specify its ID. Deleting a build
@@ -677,6 +898,30 @@ namespace Model
          */
         virtual void DeleteBuildAsync(const Model::DeleteBuildRequest& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a build. This action permanently deletes the build record and any
+         * uploaded build files.</p> <p>To delete a build, specify its ID. Deleting a build
+         * does not affect the status of any active fleets, but you can no longer create
+         * new fleets for the deleted build.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteBuildAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBuildRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBuildOutcome> DeleteBuildAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBuildOutcome>([this, request](const std::function<void(Model::DeleteBuildOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBuildAsync(request, [complete](const GameLiftClient*, const Model::DeleteBuildRequest&, const Model::DeleteBuildOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBuildOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes everything related to a fleet. Before deleting a fleet, you must set
          * the fleet's desired capacity to zero. See <a>UpdateFleetCapacity</a>.</p>
@@ -705,6 +950,30 @@ namespace Model
          */
         virtual void DeleteFleetAsync(const Model::DeleteFleetRequest& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes everything related to a fleet. Before deleting a fleet, you must set
+         * the fleet's desired capacity to zero. See <a>UpdateFleetCapacity</a>.</p>
+         * <p>This action removes the fleet's resources and the fleet record. Once a fleet
+         * is deleted, you can no longer use that fleet.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteFleetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteFleetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteFleetOutcome> DeleteFleetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteFleetOutcome>([this, request](const std::function<void(Model::DeleteFleetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteFleetAsync(request, [complete](const GameLiftClient*, const Model::DeleteFleetRequest&, const Model::DeleteFleetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteFleetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves properties for a specified alias. To get the alias, specify an
          * alias ID. If successful, an <a>Alias</a> object is returned.</p>
@@ -727,6 +996,28 @@ namespace Model
          */
         virtual void DescribeAliasAsync(const Model::DescribeAliasRequest& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves properties for a specified alias. To get the alias, specify an
+         * alias ID. If successful, an <a>Alias</a> object is returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAliasOutcome> DescribeAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAliasOutcome>([this, request](const std::function<void(Model::DescribeAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAliasAsync(request, [complete](const GameLiftClient*, const Model::DescribeAliasRequest&, const Model::DescribeAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves properties for a build. To get a build record, specify a build ID.
          * If successful, an object containing the build properties is returned.</p>
@@ -749,6 +1040,28 @@ namespace Model
          */
         virtual void DescribeBuildAsync(const Model::DescribeBuildRequest& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves properties for a build. To get a build record, specify a build ID.
+         * If successful, an object containing the build properties is returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeBuildAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeBuildRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeBuildOutcome> DescribeBuildAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeBuildOutcome>([this, request](const std::function<void(Model::DescribeBuildOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeBuildAsync(request, [complete](const GameLiftClient*, const Model::DescribeBuildRequest&, const Model::DescribeBuildOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeBuildOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the maximum number of instances allowed, per AWS account, for each
          * specified EC2 instance type. The current usage level for the AWS account is also
@@ -774,6 +1087,29 @@ namespace Model
          */
         virtual void DescribeEC2InstanceLimitsAsync(const Model::DescribeEC2InstanceLimitsRequest& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the maximum number of instances allowed, per AWS account, for each
+         * specified EC2 instance type. The current usage level for the AWS account is also
+         * retrieved.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEC2InstanceLimitsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEC2InstanceLimitsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEC2InstanceLimitsOutcome> DescribeEC2InstanceLimitsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEC2InstanceLimitsOutcome>([this, request](const std::function<void(Model::DescribeEC2InstanceLimitsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEC2InstanceLimitsAsync(request, [complete](const GameLiftClient*, const Model::DescribeEC2InstanceLimitsRequest&, const Model::DescribeEC2InstanceLimitsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEC2InstanceLimitsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves fleet properties, including metadata, status, and configuration,
          * for one or more fleets. You can request attributes for all fleets, or specify a
@@ -817,6 +1153,35 @@ namespace Model
          */
         virtual void DescribeFleetAttributesAsync(const Model::DescribeFleetAttributesRequest& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves fleet properties, including metadata, status, and configuration,
+         * for one or more fleets. You can request attributes for all fleets, or specify a
+         * list of one or more fleet IDs. When requesting all fleets, use the pagination
+         * parameters to retrieve results as a set of sequential pages. If successful, a
+         * <a>FleetAttributes</a> object is returned for each requested fleet ID. When
+         * specifying a list of fleet IDs, attribute objects are returned only for fleets
+         * that currently exist. </p> <note><p>Some API actions may limit the number of
+         * fleet IDs allowed in one request. If a request exceeds this limit, the request
+         * fails and the error message includes the maximum allowed.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeFleetAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeFleetAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeFleetAttributesOutcome> DescribeFleetAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeFleetAttributesOutcome>([this, request](const std::function<void(Model::DescribeFleetAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeFleetAttributesAsync(request, [complete](const GameLiftClient*, const Model::DescribeFleetAttributesRequest&, const Model::DescribeFleetAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeFleetAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the current status of fleet capacity for one or more fleets. This
          * information includes the number of instances that have been requested for the
@@ -863,6 +1228,36 @@ namespace Model
          */
         virtual void DescribeFleetCapacityAsync(const Model::DescribeFleetCapacityRequest& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the current status of fleet capacity for one or more fleets. This
+         * information includes the number of instances that have been requested for the
+         * fleet and the number currently active. You can request capacity for all fleets,
+         * or specify a list of one or more fleet IDs. When requesting all fleets, use the
+         * pagination parameters to retrieve results as a set of sequential pages. If
+         * successful, a <a>FleetCapacity</a> object is returned for each requested fleet
+         * ID. When specifying a list of fleet IDs, attribute objects are returned only for
+         * fleets that currently exist. </p> <note><p>Some API actions may limit the number
+         * of fleet IDs allowed in one request. If a request exceeds this limit, the
+         * request fails and the error message includes the maximum allowed.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeFleetCapacityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeFleetCapacityRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeFleetCapacityOutcome> DescribeFleetCapacityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeFleetCapacityOutcome>([this, request](const std::function<void(Model::DescribeFleetCapacityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeFleetCapacityAsync(request, [complete](const GameLiftClient*, const Model::DescribeFleetCapacityRequest&, const Model::DescribeFleetCapacityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeFleetCapacityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves entries from the fleet event log. You can specify a time range to
          * limit the result set. Use the pagination parameters to retrieve results as a set
@@ -891,6 +1286,30 @@ namespace Model
          */
         virtual void DescribeFleetEventsAsync(const Model::DescribeFleetEventsRequest& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves entries from the fleet event log. You can specify a time range to
+         * limit the result set. Use the pagination parameters to retrieve results as a set
+         * of sequential pages. If successful, a collection of event log entries matching
+         * the request are returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeFleetEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeFleetEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeFleetEventsOutcome> DescribeFleetEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeFleetEventsOutcome>([this, request](const std::function<void(Model::DescribeFleetEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeFleetEventsAsync(request, [complete](const GameLiftClient*, const Model::DescribeFleetEventsRequest&, const Model::DescribeFleetEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeFleetEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the port settings for a fleet. Port settings are used to limit
          * incoming traffic access to game servers in the fleet. To get a fleet's port
@@ -922,6 +1341,31 @@ namespace Model
          */
         virtual void DescribeFleetPortSettingsAsync(const Model::DescribeFleetPortSettingsRequest& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the port settings for a fleet. Port settings are used to limit
+         * incoming traffic access to game servers in the fleet. To get a fleet's port
+         * settings, specify a fleet ID. If successful, an <a>IpPermission</a> object is
+         * returned for the requested fleet ID. If the requested fleet has been deleted,
+         * the result set will be empty.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeFleetPortSettingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeFleetPortSettingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeFleetPortSettingsOutcome> DescribeFleetPortSettingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeFleetPortSettingsOutcome>([this, request](const std::function<void(Model::DescribeFleetPortSettingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeFleetPortSettingsAsync(request, [complete](const GameLiftClient*, const Model::DescribeFleetPortSettingsRequest&, const Model::DescribeFleetPortSettingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeFleetPortSettingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves utilization statistics for one or more fleets. You can request
          * utilization data for all fleets, or specify a list of one or more fleet IDs.
@@ -965,6 +1409,35 @@ namespace Model
          */
         virtual void DescribeFleetUtilizationAsync(const Model::DescribeFleetUtilizationRequest& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves utilization statistics for one or more fleets. You can request
+         * utilization data for all fleets, or specify a list of one or more fleet IDs.
+         * When requesting all fleets, use the pagination parameters to retrieve results as
+         * a set of sequential pages. If successful, a <a>FleetUtilization</a> object is
+         * returned for each requested fleet ID. When specifying a list of fleet IDs,
+         * utilization objects are returned only for fleets that currently exist. </p>
+         * <note><p>Some API actions may limit the number of fleet IDs allowed in one
+         * request. If a request exceeds this limit, the request fails and the error
+         * message includes the maximum allowed.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeFleetUtilizationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeFleetUtilizationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeFleetUtilizationOutcome> DescribeFleetUtilizationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeFleetUtilizationOutcome>([this, request](const std::function<void(Model::DescribeFleetUtilizationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeFleetUtilizationAsync(request, [complete](const GameLiftClient*, const Model::DescribeFleetUtilizationRequest&, const Model::DescribeFleetUtilizationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeFleetUtilizationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves properties for one or more game sessions. This action can be used
          * in several ways: (1) provide a <i>GameSessionId</i> parameter to request
@@ -1008,6 +1481,35 @@ namespace Model
          */
         virtual void DescribeGameSessionsAsync(const Model::DescribeGameSessionsRequest& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves properties for one or more game sessions. This action can be used
+         * in several ways: (1) provide a <i>GameSessionId</i> parameter to request
+         * properties for a specific game session; (2) provide a <i>FleetId</i> or
+         * <i>AliasId</i> parameter to request properties for all game sessions running on
+         * a fleet. </p> <p>To get game session record(s), specify only one of the
+         * following: game session ID, fleet ID, or alias ID. You can filter this request
+         * by game session status. Use the pagination parameters to retrieve results as a
+         * set of sequential pages. If successful, a <a>GameSession</a> object is returned
+         * for each session matching the request.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeGameSessionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeGameSessionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeGameSessionsOutcome> DescribeGameSessionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeGameSessionsOutcome>([this, request](const std::function<void(Model::DescribeGameSessionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeGameSessionsAsync(request, [complete](const GameLiftClient*, const Model::DescribeGameSessionsRequest&, const Model::DescribeGameSessionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeGameSessionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves properties for one or more player sessions. This action can be used
          * in several ways: (1) provide a <i>PlayerSessionId</i> parameter to request
@@ -1057,6 +1559,37 @@ namespace Model
          */
         virtual void DescribePlayerSessionsAsync(const Model::DescribePlayerSessionsRequest& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves properties for one or more player sessions. This action can be used
+         * in several ways: (1) provide a <i>PlayerSessionId</i> parameter to request
+         * properties for a specific player session; (2) provide a <i>GameSessionId</i>
+         * parameter to request properties for all player sessions in the specified game
+         * session; (3) provide a <i>PlayerId</i> parameter to request properties for all
+         * player sessions of a specified player. </p> <p>To get game session record(s),
+         * specify only one of the following: a player session ID, a game session ID, or a
+         * player ID. You can filter this request by player session status. Use the
+         * pagination parameters to retrieve results as a set of sequential pages. If
+         * successful, a <a>PlayerSession</a> object is returned for each session matching
+         * the request.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribePlayerSessionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribePlayerSessionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribePlayerSessionsOutcome> DescribePlayerSessionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribePlayerSessionsOutcome>([this, request](const std::function<void(Model::DescribePlayerSessionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribePlayerSessionsAsync(request, [complete](const GameLiftClient*, const Model::DescribePlayerSessionsRequest&, const Model::DescribePlayerSessionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribePlayerSessionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the location of stored game session logs for a specified game
          * session. When a game session is terminated, Amazon GameLift automatically stores
@@ -1094,6 +1627,33 @@ namespace Model
          */
         virtual void GetGameSessionLogUrlAsync(const Model::GetGameSessionLogUrlRequest& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the location of stored game session logs for a specified game
+         * session. When a game session is terminated, Amazon GameLift automatically stores
+         * the logs in Amazon S3. Use this URL to download the logs.</p> <note><p>See the
+         * <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/aws_service_limits.html#limits_gamelift">AWS
+         * Service Limits</a> page for maximum log file sizes. Log files that exceed this
+         * limit are not saved.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way GetGameSessionLogUrlAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetGameSessionLogUrlRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetGameSessionLogUrlOutcome> GetGameSessionLogUrlAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetGameSessionLogUrlOutcome>([this, request](const std::function<void(Model::GetGameSessionLogUrlOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetGameSessionLogUrlAsync(request, [complete](const GameLiftClient*, const Model::GetGameSessionLogUrlRequest&, const Model::GetGameSessionLogUrlOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetGameSessionLogUrlOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves a collection of alias records for this AWS account. You can filter
          * the result set by alias name and/or routing strategy type. Use the pagination
@@ -1122,6 +1682,30 @@ namespace Model
          */
         virtual void ListAliasesAsync(const Model::ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves a collection of alias records for this AWS account. You can filter
+         * the result set by alias name and/or routing strategy type. Use the pagination
+         * parameters to retrieve results in sequential pages. </p> <note><p>Aliases are
+         * not listed in any particular order.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way ListAliasesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAliasesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAliasesOutcome> ListAliasesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAliasesOutcome>([this, request](const std::function<void(Model::ListAliasesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAliasesAsync(request, [complete](const GameLiftClient*, const Model::ListAliasesRequest&, const Model::ListAliasesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAliasesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves build records for all builds associated with an AWS account. You
          * can filter the result set by build status. Use the pagination parameters to
@@ -1150,6 +1734,30 @@ namespace Model
          */
         virtual void ListBuildsAsync(const Model::ListBuildsRequest& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves build records for all builds associated with an AWS account. You
+         * can filter the result set by build status. Use the pagination parameters to
+         * retrieve results in a set of sequential pages. </p> <note><p>Build records are
+         * not listed in any particular order.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way ListBuildsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListBuildsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListBuildsOutcome> ListBuildsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListBuildsOutcome>([this, request](const std::function<void(Model::ListBuildsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListBuildsAsync(request, [complete](const GameLiftClient*, const Model::ListBuildsRequest&, const Model::ListBuildsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListBuildsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves a collection of fleet records for this AWS account. You can filter
          * the result set by build ID. Use the pagination parameters to retrieve results in
@@ -1178,6 +1786,30 @@ namespace Model
          */
         virtual void ListFleetsAsync(const Model::ListFleetsRequest& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves a collection of fleet records for this AWS account. You can filter
+         * the result set by build ID. Use the pagination parameters to retrieve results in
+         * sequential pages. </p> <note><p>Fleet records are not listed in any particular
+         * order.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way ListFleetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListFleetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListFleetsOutcome> ListFleetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListFleetsOutcome>([this, request](const std::function<void(Model::ListFleetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListFleetsAsync(request, [complete](const GameLiftClient*, const Model::ListFleetsRequest&, const Model::ListFleetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListFleetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves a fresh set of upload credentials and the assigned Amazon S3
          * storage location for a specific build. Valid credentials are required to upload
@@ -1224,6 +1856,36 @@ namespace Model
          */
         virtual void RequestUploadCredentialsAsync(const Model::RequestUploadCredentialsRequest& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves a fresh set of upload credentials and the assigned Amazon S3
+         * storage location for a specific build. Valid credentials are required to upload
+         * your game build files to Amazon S3.</p> <important><p>Call this action only if
+         * you need credentials for a build created with <a>CreateBuild</a>. This is a rare
+         * situation; in most cases, builds are created using the CLI command
+         * <code>upload-build</code>, which creates a build record and also uploads build
+         * files. </p></important> <p>Upload credentials are returned when you create the
+         * build, but they have a limited lifespan. You can get fresh credentials and use
+         * them to re-upload game files until the state of that build changes to READY.
+         * Once this happens, you must create a brand new build.</p>
+         *
+         * Returns an awaitable that starts the operation the way RequestUploadCredentialsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RequestUploadCredentialsRequest>
+        Aws::Utils::Threading::Awaitable<Model::RequestUploadCredentialsOutcome> RequestUploadCredentialsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RequestUploadCredentialsOutcome>([this, request](const std::function<void(Model::RequestUploadCredentialsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RequestUploadCredentialsAsync(request, [complete](const GameLiftClient*, const Model::RequestUploadCredentialsRequest&, const Model::RequestUploadCredentialsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RequestUploadCredentialsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the fleet ID that a specified alias is currently pointing to. </p>
          */
@@ -1243,6 +1905,27 @@ namespace Model
          */
         virtual void ResolveAliasAsync(const Model::ResolveAliasRequest& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the fleet ID that a specified alias is currently pointing to. </p>
+         *
+         * Returns an awaitable that starts the operation the way ResolveAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResolveAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResolveAliasOutcome> ResolveAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResolveAliasOutcome>([this, request](const std::function<void(Model::ResolveAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResolveAliasAsync(request, [complete](const GameLiftClient*, const Model::ResolveAliasRequest&, const Model::ResolveAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResolveAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates properties for an alias. To update properties, specify the alias ID
          * to be updated and provide the information to be changed. To reassign an alias to
@@ -1271,6 +1954,30 @@ namespace Model
          */
         virtual void UpdateAliasAsync(const Model::UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates properties for an alias. To update properties, specify the alias ID
+         * to be updated and provide the information to be changed. To reassign an alias to
+         * another fleet, provide an updated routing strategy. If successful, the updated
+         * alias record is returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAliasOutcome> UpdateAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAliasOutcome>([this, request](const std::function<void(Model::UpdateAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAliasAsync(request, [complete](const GameLiftClient*, const Model::UpdateAliasRequest&, const Model::UpdateAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates metadata in a build record, including the build name and version. To
          * update the metadata, specify the build ID to update and provide the new values.
@@ -1296,6 +2003,29 @@ namespace Model
          */
         virtual void UpdateBuildAsync(const Model::UpdateBuildRequest& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates metadata in a build record, including the build name and version. To
+         * update the metadata, specify the build ID to update and provide the new values.
+         * If successful, a build object containing the updated metadata is returned. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateBuildAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateBuildRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateBuildOutcome> UpdateBuildAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateBuildOutcome>([this, request](const std::function<void(Model::UpdateBuildOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateBuildAsync(request, [complete](const GameLiftClient*, const Model::UpdateBuildRequest&, const Model::UpdateBuildOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateBuildOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates fleet properties, including name and description, for a fleet. To
          * update metadata, specify the fleet ID and the property values you want to
@@ -1321,6 +2051,29 @@ namespace Model
          */
         virtual void UpdateFleetAttributesAsync(const Model::UpdateFleetAttributesRequest& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates fleet properties, including name and description, for a fleet. To
+         * update metadata, specify the fleet ID and the property values you want to
+         * change. If successful, the fleet ID for the updated fleet is returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateFleetAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateFleetAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateFleetAttributesOutcome> UpdateFleetAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateFleetAttributesOutcome>([this, request](const std::function<void(Model::UpdateFleetAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateFleetAttributesAsync(request, [complete](const GameLiftClient*, const Model::UpdateFleetAttributesRequest&, const Model::UpdateFleetAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateFleetAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates capacity settings for a fleet. Use this action to specify the number
          * of EC2 instances (hosts) you want this fleet to contain. Before calling this
@@ -1367,6 +2120,36 @@ namespace Model
          */
         virtual void UpdateFleetCapacityAsync(const Model::UpdateFleetCapacityRequest& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates capacity settings for a fleet. Use this action to specify the number
+         * of EC2 instances (hosts) you want this fleet to contain. Before calling this
+         * action, you may want to call <a>DescribeEC2InstanceLimits</a> to get the maximum
+         * capacity based on the fleet's EC2 instance type.</p> <p>To update fleet
+         * capacity, specify the fleet ID and the desired number of instances. If
+         * successful, Amazon GameLift starts or terminates instances so that the fleet's
+         * active instance count matches the desired instance count. You can view a fleet's
+         * current capacity information by calling <a>DescribeFleetCapacity</a>. If the
+         * desired instance count is higher than the instance type's limit, the "Limit
+         * Exceeded" exception will occur.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateFleetCapacityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateFleetCapacityRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateFleetCapacityOutcome> UpdateFleetCapacityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateFleetCapacityOutcome>([this, request](const std::function<void(Model::UpdateFleetCapacityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateFleetCapacityAsync(request, [complete](const GameLiftClient*, const Model::UpdateFleetCapacityRequest&, const Model::UpdateFleetCapacityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateFleetCapacityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates port settings for a fleet. To update settings, specify the fleet ID
          * to be updated and list the permissions you want to update. List the permissions
@@ -1401,6 +2184,32 @@ namespace Model
          */
         virtual void UpdateFleetPortSettingsAsync(const Model::UpdateFleetPortSettingsRequest& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates port settings for a fleet. To update settings, specify the fleet ID
+         * to be updated and list the permissions you want to update. List the permissions
+         * you want to add in <i>InboundPermissionAuthorizations</i>, and permissions you
+         * want to remove in <i>InboundPermissionRevocations</i>. Permissions to be removed
+         * must match existing fleet permissions. If successful, the fleet ID for the
+         * updated fleet is returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateFleetPortSettingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateFleetPortSettingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateFleetPortSettingsOutcome> UpdateFleetPortSettingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateFleetPortSettingsOutcome>([this, request](const std::function<void(Model::UpdateFleetPortSettingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateFleetPortSettingsAsync(request, [complete](const GameLiftClient*, const Model::UpdateFleetPortSettingsRequest&, const Model::UpdateFleetPortSettingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateFleetPortSettingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates game session properties. This includes the session name, maximum
          * player count and the player session creation policy, which either allows or
@@ -1432,6 +2241,31 @@ namespace Model
          */
         virtual void UpdateGameSessionAsync(const Model::UpdateGameSessionRequest& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates game session properties. This includes the session name, maximum
+         * player count and the player session creation policy, which either allows or
+         * denies new players from joining the session. To update a game session, specify
+         * the game session ID and the values you want to change. If successful, an updated
+         * <a>GameSession</a> object is returned. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateGameSessionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateGameSessionRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateGameSessionOutcome> UpdateGameSessionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateGameSessionOutcome>([this, request](const std::function<void(Model::UpdateGameSessionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateGameSessionAsync(request, [complete](const GameLiftClient*, const Model::UpdateGameSessionRequest&, const Model::UpdateGameSessionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateGameSessionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
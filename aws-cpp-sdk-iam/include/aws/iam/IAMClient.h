@@ -85,6 +85,7 @@
 #include <aws/iam/model/UploadSigningCertificateResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -689,6 +690,30 @@ namespace Model
          */
         virtual void AddClientIDToOpenIDConnectProviderAsync(const Model::AddClientIDToOpenIDConnectProviderRequest& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds a new client ID (also known as audience) to the list of client IDs
+         * already registered for the specified IAM OpenID Connect provider.</p> <p>This
+         * action is idempotent; it does not fail or return an error if you add an existing
+         * client ID to the provider.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddClientIDToOpenIDConnectProviderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddClientIDToOpenIDConnectProviderRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddClientIDToOpenIDConnectProviderOutcome> AddClientIDToOpenIDConnectProviderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddClientIDToOpenIDConnectProviderOutcome>([this, request](const std::function<void(Model::AddClientIDToOpenIDConnectProviderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddClientIDToOpenIDConnectProviderAsync(request, [complete](const IAMClient*, const Model::AddClientIDToOpenIDConnectProviderRequest&, const Model::AddClientIDToOpenIDConnectProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddClientIDToOpenIDConnectProviderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds the specified role to the specified instance profile. For more
          * information about roles, go to <a
@@ -723,6 +748,32 @@ namespace Model
          */
         virtual void AddRoleToInstanceProfileAsync(const Model::AddRoleToInstanceProfileRequest& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds the specified role to the specified instance profile. For more
+         * information about roles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/WorkingWithRoles.html">Working
+         * with Roles</a>. For more information about instance profiles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/AboutInstanceProfiles.html">About
+         * Instance Profiles</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way AddRoleToInstanceProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddRoleToInstanceProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddRoleToInstanceProfileOutcome> AddRoleToInstanceProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddRoleToInstanceProfileOutcome>([this, request](const std::function<void(Model::AddRoleToInstanceProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddRoleToInstanceProfileAsync(request, [complete](const IAMClient*, const Model::AddRoleToInstanceProfileRequest&, const Model::AddRoleToInstanceProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddRoleToInstanceProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds the specified user to the specified group.</p>
          */
@@ -742,6 +793,27 @@ namespace Model
          */
         virtual void AddUserToGroupAsync(const Model::AddUserToGroupRequest& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds the specified user to the specified group.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddUserToGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddUserToGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddUserToGroupOutcome> AddUserToGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddUserToGroupOutcome>([this, request](const std::function<void(Model::AddUserToGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddUserToGroupAsync(request, [complete](const IAMClient*, const Model::AddUserToGroupRequest&, const Model::AddUserToGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddUserToGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches the specified managed policy to the specified group.</p> <p>You use
          * this API to attach a managed policy to a group. To embed an inline policy in a
@@ -776,6 +848,32 @@ namespace Model
          */
         virtual void AttachGroupPolicyAsync(const Model::AttachGroupPolicyRequest& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches the specified managed policy to the specified group.</p> <p>You use
+         * this API to attach a managed policy to a group. To embed an inline policy in a
+         * group, use <a>PutGroupPolicy</a>. </p> <p>For more information about policies,
+         * refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way AttachGroupPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachGroupPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachGroupPolicyOutcome> AttachGroupPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachGroupPolicyOutcome>([this, request](const std::function<void(Model::AttachGroupPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachGroupPolicyAsync(request, [complete](const IAMClient*, const Model::AttachGroupPolicyRequest&, const Model::AttachGroupPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachGroupPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches the specified managed policy to the specified role.</p> <p>When you
          * attach a managed policy to a role, the managed policy is used as the role's
@@ -822,6 +920,36 @@ namespace Model
          */
         virtual void AttachRolePolicyAsync(const Model::AttachRolePolicyRequest& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches the specified managed policy to the specified role.</p> <p>When you
+         * attach a managed policy to a role, the managed policy is used as the role's
+         * access (permissions) policy. You cannot use a managed policy as the role's trust
+         * policy. The role's trust policy is created at the same time as the role, using
+         * <a>CreateRole</a>. You can update a role's trust policy using
+         * <a>UpdateAssumeRolePolicy</a>. </p> <p>Use this API to attach a managed policy
+         * to a role. To embed an inline policy in a role, use <a>PutRolePolicy</a>. For
+         * more information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachRolePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachRolePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachRolePolicyOutcome> AttachRolePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachRolePolicyOutcome>([this, request](const std::function<void(Model::AttachRolePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachRolePolicyAsync(request, [complete](const IAMClient*, const Model::AttachRolePolicyRequest&, const Model::AttachRolePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachRolePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches the specified managed policy to the specified user.</p> <p>You use
          * this API to attach a managed policy to a user. To embed an inline policy in a
@@ -856,6 +984,32 @@ namespace Model
          */
         virtual void AttachUserPolicyAsync(const Model::AttachUserPolicyRequest& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches the specified managed policy to the specified user.</p> <p>You use
+         * this API to attach a managed policy to a user. To embed an inline policy in a
+         * user, use <a>PutUserPolicy</a>. </p> <p>For more information about policies,
+         * refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way AttachUserPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachUserPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachUserPolicyOutcome> AttachUserPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachUserPolicyOutcome>([this, request](const std::function<void(Model::AttachUserPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachUserPolicyAsync(request, [complete](const IAMClient*, const Model::AttachUserPolicyRequest&, const Model::AttachUserPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachUserPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes the password of the IAM user who is calling this action. The root
          * account password is not affected by this action. </p> <p>To change the password
@@ -890,6 +1044,32 @@ namespace Model
          */
         virtual void ChangePasswordAsync(const Model::ChangePasswordRequest& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes the password of the IAM user who is calling this action. The root
+         * account password is not affected by this action. </p> <p>To change the password
+         * for a different user, see <a>UpdateLoginProfile</a>. For more information about
+         * modifying passwords, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_ManagingLogins.html">Managing
+         * Passwords</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way ChangePasswordAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ChangePasswordRequest>
+        Aws::Utils::Threading::Awaitable<Model::ChangePasswordOutcome> ChangePasswordAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ChangePasswordOutcome>([this, request](const std::function<void(Model::ChangePasswordOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ChangePasswordAsync(request, [complete](const IAMClient*, const Model::ChangePasswordRequest&, const Model::ChangePasswordOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ChangePasswordOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new AWS secret access key and corresponding AWS access key ID for
          * the specified user. The default status for new keys is <code>Active</code>. </p>
@@ -945,6 +1125,39 @@ namespace Model
          */
         virtual void CreateAccessKeyAsync(const Model::CreateAccessKeyRequest& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new AWS secret access key and corresponding AWS access key ID for
+         * the specified user. The default status for new keys is <code>Active</code>. </p>
+         * <p> If you do not specify a user name, IAM determines the user name implicitly
+         * based on the AWS access key ID signing the request. Because this action works
+         * for access keys under the AWS account, you can use this action to manage root
+         * credentials even if the AWS account has no associated users. </p> <p> For
+         * information about limits on the number of keys you can create, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/LimitationsOnEntities.html">Limitations
+         * on IAM Entities</a> in the <i>IAM User Guide</i>. </p> <important> To ensure the
+         * security of your AWS account, the secret access key is accessible only during
+         * key and user creation. You must save the key (for example, in a text file) if
+         * you want to be able to access it again. If a secret key is lost, you can delete
+         * the access keys for the associated user and then create new keys. </important>
+         *
+         * Returns an awaitable that starts the operation the way CreateAccessKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAccessKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAccessKeyOutcome> CreateAccessKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAccessKeyOutcome>([this, request](const std::function<void(Model::CreateAccessKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAccessKeyAsync(request, [complete](const IAMClient*, const Model::CreateAccessKeyRequest&, const Model::CreateAccessKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAccessKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an alias for your AWS account. For information about using an AWS
          * account alias, see <a
@@ -973,6 +1186,30 @@ namespace Model
          */
         virtual void CreateAccountAliasAsync(const Model::CreateAccountAliasRequest& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an alias for your AWS account. For information about using an AWS
+         * account alias, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/AccountAlias.html">Using
+         * an Alias for Your AWS Account ID</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateAccountAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAccountAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAccountAliasOutcome> CreateAccountAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAccountAliasOutcome>([this, request](const std::function<void(Model::CreateAccountAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAccountAliasAsync(request, [complete](const IAMClient*, const Model::CreateAccountAliasRequest&, const Model::CreateAccountAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAccountAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new group.</p> <p> For information about the number of groups you
          * can create, see <a
@@ -1001,6 +1238,30 @@ namespace Model
          */
         virtual void CreateGroupAsync(const Model::CreateGroupRequest& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new group.</p> <p> For information about the number of groups you
+         * can create, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/LimitationsOnEntities.html">Limitations
+         * on IAM Entities</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateGroupOutcome> CreateGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateGroupOutcome>([this, request](const std::function<void(Model::CreateGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateGroupAsync(request, [complete](const IAMClient*, const Model::CreateGroupRequest&, const Model::CreateGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new instance profile. For information about instance profiles, go
          * to <a
@@ -1038,6 +1299,33 @@ namespace Model
          */
         virtual void CreateInstanceProfileAsync(const Model::CreateInstanceProfileRequest& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new instance profile. For information about instance profiles, go
+         * to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/AboutInstanceProfiles.html">About
+         * Instance Profiles</a>. </p> <p> For information about the number of instance
+         * profiles you can create, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/LimitationsOnEntities.html">Limitations
+         * on IAM Entities</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateInstanceProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateInstanceProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateInstanceProfileOutcome> CreateInstanceProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateInstanceProfileOutcome>([this, request](const std::function<void(Model::CreateInstanceProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateInstanceProfileAsync(request, [complete](const IAMClient*, const Model::CreateInstanceProfileRequest&, const Model::CreateInstanceProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateInstanceProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a password for the specified user, giving the user the ability to
          * access AWS services through the AWS Management Console. For more information
@@ -1069,6 +1357,31 @@ namespace Model
          */
         virtual void CreateLoginProfileAsync(const Model::CreateLoginProfileRequest& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a password for the specified user, giving the user the ability to
+         * access AWS services through the AWS Management Console. For more information
+         * about managing passwords, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_ManagingLogins.html">Managing
+         * Passwords</a> in the <i>Using IAM</i> guide. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateLoginProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateLoginProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateLoginProfileOutcome> CreateLoginProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateLoginProfileOutcome>([this, request](const std::function<void(Model::CreateLoginProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateLoginProfileAsync(request, [complete](const IAMClient*, const Model::CreateLoginProfileRequest&, const Model::CreateLoginProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateLoginProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an IAM entity to describe an identity provider (IdP) that supports <a
          * href="http://openid.net/connect/">OpenID Connect (OIDC)</a>. </p> <p>The OIDC
@@ -1124,6 +1437,39 @@ namespace Model
          */
         virtual void CreateOpenIDConnectProviderAsync(const Model::CreateOpenIDConnectProviderRequest& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an IAM entity to describe an identity provider (IdP) that supports <a
+         * href="http://openid.net/connect/">OpenID Connect (OIDC)</a>. </p> <p>The OIDC
+         * provider that you create with this operation can be used as a principal in a
+         * role's trust policy to establish a trust relationship between AWS and the OIDC
+         * provider. </p> <p>When you create the IAM OIDC provider, you specify the URL of
+         * the OIDC identity provider (IdP) to trust, a list of client IDs (also known as
+         * audiences) that identify the application or applications that are allowed to
+         * authenticate using the OIDC provider, and a list of thumbprints of the server
+         * certificate(s) that the IdP uses. You get all of this information from the OIDC
+         * IdP that you want to use for access to AWS. </p> <note>Because trust for the
+         * OIDC provider is ultimately derived from the IAM provider that this action
+         * creates, it is a best practice to limit access to the
+         * <a>CreateOpenIDConnectProvider</a> action to highly-privileged users. </note>
+         *
+         * Returns an awaitable that starts the operation the way CreateOpenIDConnectProviderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateOpenIDConnectProviderRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateOpenIDConnectProviderOutcome> CreateOpenIDConnectProviderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateOpenIDConnectProviderOutcome>([this, request](const std::function<void(Model::CreateOpenIDConnectProviderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateOpenIDConnectProviderAsync(request, [complete](const IAMClient*, const Model::CreateOpenIDConnectProviderRequest&, const Model::CreateOpenIDConnectProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateOpenIDConnectProviderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new managed policy for your AWS account. </p> <p>This operation
          * creates a policy version with a version identifier of <code>v1</code> and sets
@@ -1167,6 +1513,35 @@ namespace Model
          */
         virtual void CreatePolicyAsync(const Model::CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new managed policy for your AWS account. </p> <p>This operation
+         * creates a policy version with a version identifier of <code>v1</code> and sets
+         * v1 as the policy's default version. For more information about policy versions,
+         * see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-versions.html">Versioning
+         * for Managed Policies</a> in the <i>IAM User Guide</i>. </p> <p>For more
+         * information about managed policies in general, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePolicyOutcome> CreatePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePolicyOutcome>([this, request](const std::function<void(Model::CreatePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePolicyAsync(request, [complete](const IAMClient*, const Model::CreatePolicyRequest&, const Model::CreatePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new version of the specified managed policy. To update a managed
          * policy, you create a new policy version. A managed policy can have up to five
@@ -1213,6 +1588,36 @@ namespace Model
          */
         virtual void CreatePolicyVersionAsync(const Model::CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new version of the specified managed policy. To update a managed
+         * policy, you create a new policy version. A managed policy can have up to five
+         * versions. If the policy has five versions, you must delete an existing version
+         * using <a>DeletePolicyVersion</a> before you create a new version. </p>
+         * <p>Optionally, you can set the new version as the policy's default version. The
+         * default version is the operative version; that is, the version that is in effect
+         * for the IAM users, groups, and roles that the policy is attached to. </p> <p>For
+         * more information about managed policy versions, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-versions.html">Versioning
+         * for Managed Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePolicyVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePolicyVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePolicyVersionOutcome> CreatePolicyVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePolicyVersionOutcome>([this, request](const std::function<void(Model::CreatePolicyVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePolicyVersionAsync(request, [complete](const IAMClient*, const Model::CreatePolicyVersionRequest&, const Model::CreatePolicyVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePolicyVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new role for your AWS account. For more information about roles, go
          * to <a
@@ -1250,6 +1655,33 @@ namespace Model
          */
         virtual void CreateRoleAsync(const Model::CreateRoleRequest& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new role for your AWS account. For more information about roles, go
+         * to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/WorkingWithRoles.html">Working
+         * with Roles</a>. For information about limitations on role names and the number
+         * of roles you can create, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/LimitationsOnEntities.html">Limitations
+         * on IAM Entities</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateRoleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateRoleRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateRoleOutcome> CreateRoleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateRoleOutcome>([this, request](const std::function<void(Model::CreateRoleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateRoleAsync(request, [complete](const IAMClient*, const Model::CreateRoleRequest&, const Model::CreateRoleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateRoleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an IAM entity to describe an identity provider (IdP) that supports
          * SAML 2.0.</p> <p> The SAML provider that you create with this operation can be
@@ -1317,6 +1749,43 @@ namespace Model
          */
         virtual void CreateSAMLProviderAsync(const Model::CreateSAMLProviderRequest& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an IAM entity to describe an identity provider (IdP) that supports
+         * SAML 2.0.</p> <p> The SAML provider that you create with this operation can be
+         * used as a principal in a role's trust policy to establish a trust relationship
+         * between AWS and a SAML identity provider. You can create an IAM role that
+         * supports Web-based single sign-on (SSO) to the AWS Management Console or one
+         * that supports API access to AWS. </p> <p> When you create the SAML provider, you
+         * upload an a SAML metadata document that you get from your IdP and that includes
+         * the issuer's name, expiration information, and keys that can be used to validate
+         * the SAML authentication response (assertions) that are received from the IdP.
+         * You must generate the metadata document using the identity management software
+         * that is used as your organization's IdP. </p> <note> This operation requires <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/signature-version-4.html">Signature
+         * Version 4</a>. </note> <p> For more information, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/id_roles_providers_enable-console-saml.html">Enabling
+         * SAML 2.0 Federated Users to Access the AWS Management Console</a> and <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/id_roles_providers_saml.html">About
+         * SAML 2.0-based Federation</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateSAMLProviderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSAMLProviderRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSAMLProviderOutcome> CreateSAMLProviderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSAMLProviderOutcome>([this, request](const std::function<void(Model::CreateSAMLProviderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSAMLProviderAsync(request, [complete](const IAMClient*, const Model::CreateSAMLProviderRequest&, const Model::CreateSAMLProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSAMLProviderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new user for your AWS account.</p> <p> For information about
          * limitations on the number of users you can create, see <a
@@ -1345,6 +1814,30 @@ namespace Model
          */
         virtual void CreateUserAsync(const Model::CreateUserRequest& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new user for your AWS account.</p> <p> For information about
+         * limitations on the number of users you can create, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/LimitationsOnEntities.html">Limitations
+         * on IAM Entities</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateUserAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateUserRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateUserOutcome> CreateUserAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateUserOutcome>([this, request](const std::function<void(Model::CreateUserOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateUserAsync(request, [complete](const IAMClient*, const Model::CreateUserRequest&, const Model::CreateUserOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateUserOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new virtual MFA device for the AWS account. After creating the
          * virtual MFA, use <a>EnableMFADevice</a> to attach the MFA device to an IAM user.
@@ -1400,6 +1893,39 @@ namespace Model
          */
         virtual void CreateVirtualMFADeviceAsync(const Model::CreateVirtualMFADeviceRequest& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new virtual MFA device for the AWS account. After creating the
+         * virtual MFA, use <a>EnableMFADevice</a> to attach the MFA device to an IAM user.
+         * For more information about creating and working with virtual MFA devices, go to
+         * <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_VirtualMFA.html">Using
+         * a Virtual MFA Device</a> in the <i>Using IAM</i> guide. </p> <p>For information
+         * about limits on the number of MFA devices you can create, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/LimitationsOnEntities.html">Limitations
+         * on Entities</a> in the <i>Using IAM</i> guide. </p> <important>The seed
+         * information contained in the QR code and the Base32 string should be treated
+         * like any other secret access information, such as your AWS access keys or your
+         * passwords. After you provision your virtual device, you should ensure that the
+         * information is destroyed following secure procedures. </important>
+         *
+         * Returns an awaitable that starts the operation the way CreateVirtualMFADeviceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateVirtualMFADeviceRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateVirtualMFADeviceOutcome> CreateVirtualMFADeviceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateVirtualMFADeviceOutcome>([this, request](const std::function<void(Model::CreateVirtualMFADeviceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateVirtualMFADeviceAsync(request, [complete](const IAMClient*, const Model::CreateVirtualMFADeviceRequest&, const Model::CreateVirtualMFADeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateVirtualMFADeviceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deactivates the specified MFA device and removes it from association with the
          * user name for which it was originally enabled. </p> <p>For more information
@@ -1431,6 +1957,31 @@ namespace Model
          */
         virtual void DeactivateMFADeviceAsync(const Model::DeactivateMFADeviceRequest& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deactivates the specified MFA device and removes it from association with the
+         * user name for which it was originally enabled. </p> <p>For more information
+         * about creating and working with virtual MFA devices, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_VirtualMFA.html">Using
+         * a Virtual MFA Device</a> in the <i>Using IAM</i> guide. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeactivateMFADeviceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeactivateMFADeviceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeactivateMFADeviceOutcome> DeactivateMFADeviceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeactivateMFADeviceOutcome>([this, request](const std::function<void(Model::DeactivateMFADeviceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeactivateMFADeviceAsync(request, [complete](const IAMClient*, const Model::DeactivateMFADeviceRequest&, const Model::DeactivateMFADeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeactivateMFADeviceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the access key associated with the specified user.</p> <p> If you do
          * not specify a user name, IAM determines the user name implicitly based on the
@@ -1462,6 +2013,31 @@ namespace Model
          */
         virtual void DeleteAccessKeyAsync(const Model::DeleteAccessKeyRequest& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the access key associated with the specified user.</p> <p> If you do
+         * not specify a user name, IAM determines the user name implicitly based on the
+         * AWS access key ID signing the request. Because this action works for access keys
+         * under the AWS account, you can use this action to manage root credentials even
+         * if the AWS account has no associated users. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAccessKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAccessKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAccessKeyOutcome> DeleteAccessKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAccessKeyOutcome>([this, request](const std::function<void(Model::DeleteAccessKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAccessKeyAsync(request, [complete](const IAMClient*, const Model::DeleteAccessKeyRequest&, const Model::DeleteAccessKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAccessKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the specified AWS account alias. For information about using an AWS
          * account alias, see <a
@@ -1490,6 +2066,30 @@ namespace Model
          */
         virtual void DeleteAccountAliasAsync(const Model::DeleteAccountAliasRequest& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the specified AWS account alias. For information about using an AWS
+         * account alias, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/AccountAlias.html">Using
+         * an Alias for Your AWS Account ID</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAccountAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAccountAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAccountAliasOutcome> DeleteAccountAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAccountAliasOutcome>([this, request](const std::function<void(Model::DeleteAccountAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAccountAliasAsync(request, [complete](const IAMClient*, const Model::DeleteAccountAliasRequest&, const Model::DeleteAccountAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAccountAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the password policy for the AWS account.</p>
          */
@@ -1509,6 +2109,27 @@ namespace Model
          */
         virtual void DeleteAccountPasswordPolicyAsync(const Model::DeleteAccountPasswordPolicyRequest& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the password policy for the AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAccountPasswordPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAccountPasswordPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAccountPasswordPolicyOutcome> DeleteAccountPasswordPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAccountPasswordPolicyOutcome>([this, request](const std::function<void(Model::DeleteAccountPasswordPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAccountPasswordPolicyAsync(request, [complete](const IAMClient*, const Model::DeleteAccountPasswordPolicyRequest&, const Model::DeleteAccountPasswordPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAccountPasswordPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the specified group. The group must not contain any users or have
          * any attached policies. </p>
@@ -1531,11 +2152,33 @@ namespace Model
          */
         virtual void DeleteGroupAsync(const Model::DeleteGroupRequest& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
-         * <p>Deletes the specified inline policy that is embedded in the specified
-         * group.</p> <p>A group can also have managed policies attached to it. To detach a
-         * managed policy from a group, use <a>DetachGroupPolicy</a>. For more information
-         * about policies, refer to <a
+         * <p> Deletes the specified group. The group must not contain any users or have
+         * any attached policies. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteGroupOutcome> DeleteGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteGroupOutcome>([this, request](const std::function<void(Model::DeleteGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteGroupAsync(request, [complete](const IAMClient*, const Model::DeleteGroupRequest&, const Model::DeleteGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
+        /**
+         * <p>Deletes the specified inline policy that is embedded in the specified
+         * group.</p> <p>A group can also have managed policies attached to it. To detach a
+         * managed policy from a group, use <a>DetachGroupPolicy</a>. For more information
+         * about policies, refer to <a
          * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
          * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
          */
@@ -1565,6 +2208,32 @@ namespace Model
          */
         virtual void DeleteGroupPolicyAsync(const Model::DeleteGroupPolicyRequest& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified inline policy that is embedded in the specified
+         * group.</p> <p>A group can also have managed policies attached to it. To detach a
+         * managed policy from a group, use <a>DetachGroupPolicy</a>. For more information
+         * about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteGroupPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteGroupPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteGroupPolicyOutcome> DeleteGroupPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteGroupPolicyOutcome>([this, request](const std::function<void(Model::DeleteGroupPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteGroupPolicyAsync(request, [complete](const IAMClient*, const Model::DeleteGroupPolicyRequest&, const Model::DeleteGroupPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteGroupPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified instance profile. The instance profile must not have an
          * associated role. </p> <important> Make sure you do not have any Amazon EC2
@@ -1605,6 +2274,34 @@ namespace Model
          */
         virtual void DeleteInstanceProfileAsync(const Model::DeleteInstanceProfileRequest& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified instance profile. The instance profile must not have an
+         * associated role. </p> <important> Make sure you do not have any Amazon EC2
+         * instances running with the instance profile you are about to delete. Deleting a
+         * role or instance profile that is associated with a running instance will break
+         * any applications running on the instance. </important> <p>For more information
+         * about instance profiles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/AboutInstanceProfiles.html">About
+         * Instance Profiles</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteInstanceProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteInstanceProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteInstanceProfileOutcome> DeleteInstanceProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteInstanceProfileOutcome>([this, request](const std::function<void(Model::DeleteInstanceProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteInstanceProfileAsync(request, [complete](const IAMClient*, const Model::DeleteInstanceProfileRequest&, const Model::DeleteInstanceProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteInstanceProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the password for the specified user, which terminates the user's
          * ability to access AWS services through the AWS Management Console. </p>
@@ -1642,6 +2339,33 @@ namespace Model
          */
         virtual void DeleteLoginProfileAsync(const Model::DeleteLoginProfileRequest& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the password for the specified user, which terminates the user's
+         * ability to access AWS services through the AWS Management Console. </p>
+         * <important> Deleting a user's password does not prevent a user from accessing
+         * IAM through the command line interface or the API. To prevent all user access
+         * you must also either make the access key inactive or delete it. For more
+         * information about making keys inactive or deleting them, see
+         * <a>UpdateAccessKey</a> and <a>DeleteAccessKey</a>. </important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteLoginProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteLoginProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteLoginProfileOutcome> DeleteLoginProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteLoginProfileOutcome>([this, request](const std::function<void(Model::DeleteLoginProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteLoginProfileAsync(request, [complete](const IAMClient*, const Model::DeleteLoginProfileRequest&, const Model::DeleteLoginProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteLoginProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an IAM OpenID Connect identity provider.</p> <p>Deleting an OIDC
          * provider does not update any roles that reference the provider as a principal in
@@ -1676,6 +2400,32 @@ namespace Model
          */
         virtual void DeleteOpenIDConnectProviderAsync(const Model::DeleteOpenIDConnectProviderRequest& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an IAM OpenID Connect identity provider.</p> <p>Deleting an OIDC
+         * provider does not update any roles that reference the provider as a principal in
+         * their trust policies. Any attempt to assume a role that references a provider
+         * that has been deleted will fail. </p> <p>This action is idempotent; it does not
+         * fail or return an error if you call the action for a provider that was already
+         * deleted.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteOpenIDConnectProviderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteOpenIDConnectProviderRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteOpenIDConnectProviderOutcome> DeleteOpenIDConnectProviderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteOpenIDConnectProviderOutcome>([this, request](const std::function<void(Model::DeleteOpenIDConnectProviderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteOpenIDConnectProviderAsync(request, [complete](const IAMClient*, const Model::DeleteOpenIDConnectProviderRequest&, const Model::DeleteOpenIDConnectProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteOpenIDConnectProviderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified managed policy.</p> <p>Before you can delete a managed
          * policy, you must detach the policy from all users, groups, and roles that it is
@@ -1743,6 +2493,43 @@ namespace Model
          */
         virtual void DeletePolicyAsync(const Model::DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified managed policy.</p> <p>Before you can delete a managed
+         * policy, you must detach the policy from all users, groups, and roles that it is
+         * attached to, and you must delete all of the policy's versions. The following
+         * steps describe the process for deleting a managed policy: <ol> <li>Detach the
+         * policy from all users, groups, and roles that the policy is attached to, using
+         * the <a>DetachUserPolicy</a>, <a>DetachGroupPolicy</a>, or
+         * <a>DetachRolePolicy</a> APIs. To list all the users, groups, and roles that a
+         * policy is attached to, use <a>ListEntitiesForPolicy</a>. </li> <li>Delete all
+         * versions of the policy using <a>DeletePolicyVersion</a>. To list the policy's
+         * versions, use <a>ListPolicyVersions</a>. You cannot use
+         * <a>DeletePolicyVersion</a> to delete the version that is marked as the default
+         * version. You delete the policy's default version in the next step of the
+         * process. </li> <li>Delete the policy (this automatically deletes the policy's
+         * default version) using this API. </li> </ol> </p> <p>For information about
+         * managed policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeletePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeletePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeletePolicyOutcome> DeletePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeletePolicyOutcome>([this, request](const std::function<void(Model::DeletePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeletePolicyAsync(request, [complete](const IAMClient*, const Model::DeletePolicyRequest&, const Model::DeletePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeletePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified version of the specified managed policy.</p> <p>You
          * cannot delete the default version of a policy using this API. To delete the
@@ -1780,6 +2567,33 @@ namespace Model
          */
         virtual void DeletePolicyVersionAsync(const Model::DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified version of the specified managed policy.</p> <p>You
+         * cannot delete the default version of a policy using this API. To delete the
+         * default version of a policy, use <a>DeletePolicy</a>. To find out which version
+         * of a policy is marked as the default version, use <a>ListPolicyVersions</a>.
+         * </p> <p>For information about versions for managed policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-versions.html">Versioning
+         * for Managed Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeletePolicyVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeletePolicyVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeletePolicyVersionOutcome> DeletePolicyVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeletePolicyVersionOutcome>([this, request](const std::function<void(Model::DeletePolicyVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeletePolicyVersionAsync(request, [complete](const IAMClient*, const Model::DeletePolicyVersionRequest&, const Model::DeletePolicyVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeletePolicyVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified role. The role must not have any policies attached. For
          * more information about roles, go to <a
@@ -1817,6 +2631,33 @@ namespace Model
          */
         virtual void DeleteRoleAsync(const Model::DeleteRoleRequest& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified role. The role must not have any policies attached. For
+         * more information about roles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/WorkingWithRoles.html">Working
+         * with Roles</a>. </p> <important>Make sure you do not have any Amazon EC2
+         * instances running with the role you are about to delete. Deleting a role or
+         * instance profile that is associated with a running instance will break any
+         * applications running on the instance. </important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRoleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRoleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRoleOutcome> DeleteRoleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRoleOutcome>([this, request](const std::function<void(Model::DeleteRoleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRoleAsync(request, [complete](const IAMClient*, const Model::DeleteRoleRequest&, const Model::DeleteRoleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRoleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified
          * role.</p> <p>A role can also have managed policies attached to it. To detach a
@@ -1851,6 +2692,32 @@ namespace Model
          */
         virtual void DeleteRolePolicyAsync(const Model::DeleteRolePolicyRequest& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified inline policy that is embedded in the specified
+         * role.</p> <p>A role can also have managed policies attached to it. To detach a
+         * managed policy from a role, use <a>DetachRolePolicy</a>. For more information
+         * about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRolePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRolePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRolePolicyOutcome> DeleteRolePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRolePolicyOutcome>([this, request](const std::function<void(Model::DeleteRolePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRolePolicyAsync(request, [complete](const IAMClient*, const Model::DeleteRolePolicyRequest&, const Model::DeleteRolePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRolePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a SAML provider.</p> <p> Deleting the provider does not update any
          * roles that reference the SAML provider as a principal in their trust policies.
@@ -1885,6 +2752,32 @@ namespace Model
          */
         virtual void DeleteSAMLProviderAsync(const Model::DeleteSAMLProviderRequest& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a SAML provider.</p> <p> Deleting the provider does not update any
+         * roles that reference the SAML provider as a principal in their trust policies.
+         * Any attempt to assume a role that references a SAML provider that has been
+         * deleted will fail. </p> <note> This operation requires <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/signature-version-4.html">Signature
+         * Version 4</a>. </note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSAMLProviderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSAMLProviderRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSAMLProviderOutcome> DeleteSAMLProviderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSAMLProviderOutcome>([this, request](const std::function<void(Model::DeleteSAMLProviderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSAMLProviderAsync(request, [complete](const IAMClient*, const Model::DeleteSAMLProviderRequest&, const Model::DeleteSAMLProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSAMLProviderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified SSH public key.</p> <p>The SSH public key deleted by
          * this action is used only for authenticating the associated IAM user to an AWS
@@ -1922,6 +2815,33 @@ namespace Model
          */
         virtual void DeleteSSHPublicKeyAsync(const Model::DeleteSSHPublicKeyRequest& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified SSH public key.</p> <p>The SSH public key deleted by
+         * this action is used only for authenticating the associated IAM user to an AWS
+         * CodeCommit repository. For more information about using SSH keys to authenticate
+         * to an AWS CodeCommit repository, see <a
+         * href="http://docs.aws.amazon.com/codecommit/latest/userguide/setting-up-credentials-ssh.html">Set
+         * up AWS CodeCommit for SSH Connections</a> in the <i>AWS CodeCommit User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSSHPublicKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSSHPublicKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSSHPublicKeyOutcome> DeleteSSHPublicKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSSHPublicKeyOutcome>([this, request](const std::function<void(Model::DeleteSSHPublicKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSSHPublicKeyAsync(request, [complete](const IAMClient*, const Model::DeleteSSHPublicKeyRequest&, const Model::DeleteSSHPublicKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSSHPublicKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified server certificate.</p> <p>For more information about
          * working with server certificates, including a list of AWS services that can use
@@ -1980,6 +2900,40 @@ namespace Model
          */
         virtual void DeleteServerCertificateAsync(const Model::DeleteServerCertificateRequest& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified server certificate.</p> <p>For more information about
+         * working with server certificates, including a list of AWS services that can use
+         * the server certificates that you manage with IAM, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/id_credentials_server-certs.html">Working
+         * with Server Certificates</a> in the <i>IAM User Guide</i>.</p> <important> If
+         * you are using a server certificate with Elastic Load Balancing, deleting the
+         * certificate could have implications for your application. If Elastic Load
+         * Balancing doesn't detect the deletion of bound certificates, it may continue to
+         * use the certificates. This could cause Elastic Load Balancing to stop accepting
+         * traffic. We recommend that you remove the reference to the certificate from
+         * Elastic Load Balancing before using this command to delete the certificate. For
+         * more information, go to <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/APIReference/API_DeleteLoadBalancerListeners.html">DeleteLoadBalancerListeners</a>
+         * in the <i>Elastic Load Balancing API Reference</i>. </important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteServerCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteServerCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteServerCertificateOutcome> DeleteServerCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteServerCertificateOutcome>([this, request](const std::function<void(Model::DeleteServerCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteServerCertificateAsync(request, [complete](const IAMClient*, const Model::DeleteServerCertificateRequest&, const Model::DeleteServerCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteServerCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified signing certificate associated with the specified
          * user.</p> <p>If you do not specify a user name, IAM determines the user name
@@ -2011,6 +2965,31 @@ namespace Model
          */
         virtual void DeleteSigningCertificateAsync(const Model::DeleteSigningCertificateRequest& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified signing certificate associated with the specified
+         * user.</p> <p>If you do not specify a user name, IAM determines the user name
+         * implicitly based on the AWS access key ID signing the request. Because this
+         * action works for access keys under the AWS account, you can use this action to
+         * manage root credentials even if the AWS account has no associated users. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSigningCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSigningCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSigningCertificateOutcome> DeleteSigningCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSigningCertificateOutcome>([this, request](const std::function<void(Model::DeleteSigningCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSigningCertificateAsync(request, [complete](const IAMClient*, const Model::DeleteSigningCertificateRequest&, const Model::DeleteSigningCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSigningCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the specified user. The user must not belong to any groups, have any
          * keys or signing certificates, or have any attached policies. </p>
@@ -2033,6 +3012,28 @@ namespace Model
          */
         virtual void DeleteUserAsync(const Model::DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the specified user. The user must not belong to any groups, have any
+         * keys or signing certificates, or have any attached policies. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteUserAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteUserRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteUserOutcome> DeleteUserAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteUserOutcome>([this, request](const std::function<void(Model::DeleteUserOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteUserAsync(request, [complete](const IAMClient*, const Model::DeleteUserRequest&, const Model::DeleteUserOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteUserOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified
          * user.</p> <p>A user can also have managed policies attached to it. To detach a
@@ -2067,6 +3068,32 @@ namespace Model
          */
         virtual void DeleteUserPolicyAsync(const Model::DeleteUserPolicyRequest& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified inline policy that is embedded in the specified
+         * user.</p> <p>A user can also have managed policies attached to it. To detach a
+         * managed policy from a user, use <a>DetachUserPolicy</a>. For more information
+         * about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteUserPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteUserPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteUserPolicyOutcome> DeleteUserPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteUserPolicyOutcome>([this, request](const std::function<void(Model::DeleteUserPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteUserPolicyAsync(request, [complete](const IAMClient*, const Model::DeleteUserPolicyRequest&, const Model::DeleteUserPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteUserPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a virtual MFA device.</p> <note> You must deactivate a user's virtual
          * MFA device before you can delete it. For information about deactivating MFA
@@ -2092,6 +3119,29 @@ namespace Model
          */
         virtual void DeleteVirtualMFADeviceAsync(const Model::DeleteVirtualMFADeviceRequest& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a virtual MFA device.</p> <note> You must deactivate a user's virtual
+         * MFA device before you can delete it. For information about deactivating MFA
+         * devices, see <a>DeactivateMFADevice</a>. </note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVirtualMFADeviceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVirtualMFADeviceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVirtualMFADeviceOutcome> DeleteVirtualMFADeviceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVirtualMFADeviceOutcome>([this, request](const std::function<void(Model::DeleteVirtualMFADeviceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVirtualMFADeviceAsync(request, [complete](const IAMClient*, const Model::DeleteVirtualMFADeviceRequest&, const Model::DeleteVirtualMFADeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVirtualMFADeviceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified managed policy from the specified group. </p> <p>A
          * group can also have inline policies embedded with it. To delete an inline
@@ -2126,6 +3176,32 @@ namespace Model
          */
         virtual void DetachGroupPolicyAsync(const Model::DetachGroupPolicyRequest& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified managed policy from the specified group. </p> <p>A
+         * group can also have inline policies embedded with it. To delete an inline
+         * policy, use the <a>DeleteGroupPolicy</a> API. For information about policies,
+         * refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DetachGroupPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachGroupPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachGroupPolicyOutcome> DetachGroupPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachGroupPolicyOutcome>([this, request](const std::function<void(Model::DetachGroupPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachGroupPolicyAsync(request, [complete](const IAMClient*, const Model::DetachGroupPolicyRequest&, const Model::DetachGroupPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachGroupPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified managed policy from the specified role. </p> <p>A role
          * can also have inline policies embedded with it. To delete an inline policy, use
@@ -2157,6 +3233,31 @@ namespace Model
          */
         virtual void DetachRolePolicyAsync(const Model::DetachRolePolicyRequest& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified managed policy from the specified role. </p> <p>A role
+         * can also have inline policies embedded with it. To delete an inline policy, use
+         * the <a>DeleteRolePolicy</a> API. For information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DetachRolePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachRolePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachRolePolicyOutcome> DetachRolePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachRolePolicyOutcome>([this, request](const std::function<void(Model::DetachRolePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachRolePolicyAsync(request, [complete](const IAMClient*, const Model::DetachRolePolicyRequest&, const Model::DetachRolePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachRolePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified managed policy from the specified user. </p> <p>A user
          * can also have inline policies embedded with it. To delete an inline policy, use
@@ -2188,6 +3289,31 @@ namespace Model
          */
         virtual void DetachUserPolicyAsync(const Model::DetachUserPolicyRequest& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified managed policy from the specified user. </p> <p>A user
+         * can also have inline policies embedded with it. To delete an inline policy, use
+         * the <a>DeleteUserPolicy</a> API. For information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DetachUserPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachUserPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachUserPolicyOutcome> DetachUserPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachUserPolicyOutcome>([this, request](const std::function<void(Model::DetachUserPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachUserPolicyAsync(request, [complete](const IAMClient*, const Model::DetachUserPolicyRequest&, const Model::DetachUserPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachUserPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Enables the specified MFA device and associates it with the specified user
          * name. When enabled, the MFA device is required for every subsequent login by the
@@ -2213,6 +3339,29 @@ namespace Model
          */
         virtual void EnableMFADeviceAsync(const Model::EnableMFADeviceRequest& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Enables the specified MFA device and associates it with the specified user
+         * name. When enabled, the MFA device is required for every subsequent login by the
+         * user name associated with the device. </p>
+         *
+         * Returns an awaitable that starts the operation the way EnableMFADeviceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableMFADeviceRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableMFADeviceOutcome> EnableMFADeviceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableMFADeviceOutcome>([this, request](const std::function<void(Model::EnableMFADeviceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableMFADeviceAsync(request, [complete](const IAMClient*, const Model::EnableMFADeviceRequest&, const Model::EnableMFADeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableMFADeviceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Generates a credential report for the AWS account. For more information
          * about the credential report, see <a
@@ -2241,6 +3390,30 @@ namespace Model
          */
         virtual void GenerateCredentialReportAsync(const Model::GenerateCredentialReportRequest& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Generates a credential report for the AWS account. For more information
+         * about the credential report, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/credential-reports.html">Getting
+         * Credential Reports</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GenerateCredentialReportAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GenerateCredentialReportRequest>
+        Aws::Utils::Threading::Awaitable<Model::GenerateCredentialReportOutcome> GenerateCredentialReportAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GenerateCredentialReportOutcome>([this, request](const std::function<void(Model::GenerateCredentialReportOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GenerateCredentialReportAsync(request, [complete](const IAMClient*, const Model::GenerateCredentialReportRequest&, const Model::GenerateCredentialReportOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GenerateCredentialReportOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about when the specified access key was last used. The
          * information includes the date and time of last use, along with the AWS service
@@ -2266,6 +3439,29 @@ namespace Model
          */
         virtual void GetAccessKeyLastUsedAsync(const Model::GetAccessKeyLastUsedRequest& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about when the specified access key was last used. The
+         * information includes the date and time of last use, along with the AWS service
+         * and region that were specified in the last request made with that key.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetAccessKeyLastUsedAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAccessKeyLastUsedRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAccessKeyLastUsedOutcome> GetAccessKeyLastUsedAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAccessKeyLastUsedOutcome>([this, request](const std::function<void(Model::GetAccessKeyLastUsedOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAccessKeyLastUsedAsync(request, [complete](const IAMClient*, const Model::GetAccessKeyLastUsedRequest&, const Model::GetAccessKeyLastUsedOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAccessKeyLastUsedOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about all IAM users, groups, roles, and policies in
          * your account, including their relationships to one another. Use this API to
@@ -2300,6 +3496,32 @@ namespace Model
          */
         virtual void GetAccountAuthorizationDetailsAsync(const Model::GetAccountAuthorizationDetailsRequest& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about all IAM users, groups, roles, and policies in
+         * your account, including their relationships to one another. Use this API to
+         * obtain a snapshot of the configuration of IAM permissions (users, groups, roles,
+         * and policies) in your account.</p> <p>You can optionally filter the results
+         * using the <code>Filter</code> parameter. You can paginate the results using the
+         * <code>MaxItems</code> and <code>Marker</code> parameters. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetAccountAuthorizationDetailsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAccountAuthorizationDetailsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAccountAuthorizationDetailsOutcome> GetAccountAuthorizationDetailsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAccountAuthorizationDetailsOutcome>([this, request](const std::function<void(Model::GetAccountAuthorizationDetailsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAccountAuthorizationDetailsAsync(request, [complete](const IAMClient*, const Model::GetAccountAuthorizationDetailsRequest&, const Model::GetAccountAuthorizationDetailsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAccountAuthorizationDetailsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the password policy for the AWS account. For more information about
          * using a password policy, go to <a
@@ -2328,6 +3550,30 @@ namespace Model
          */
         virtual void GetAccountPasswordPolicyAsync(const Model::GetAccountPasswordPolicyRequest& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the password policy for the AWS account. For more information about
+         * using a password policy, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_ManagingPasswordPolicies.html">Managing
+         * an IAM Password Policy</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetAccountPasswordPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAccountPasswordPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAccountPasswordPolicyOutcome> GetAccountPasswordPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAccountPasswordPolicyOutcome>([this, request](const std::function<void(Model::GetAccountPasswordPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAccountPasswordPolicyAsync(request, [complete](const IAMClient*, const Model::GetAccountPasswordPolicyRequest&, const Model::GetAccountPasswordPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAccountPasswordPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about IAM entity usage and IAM quotas in the AWS
          * account.</p> <p> For information about limitations on IAM entities, see <a
@@ -2356,6 +3602,30 @@ namespace Model
          */
         virtual void GetAccountSummaryAsync(const Model::GetAccountSummaryRequest& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about IAM entity usage and IAM quotas in the AWS
+         * account.</p> <p> For information about limitations on IAM entities, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/LimitationsOnEntities.html">Limitations
+         * on IAM Entities</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetAccountSummaryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAccountSummaryRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAccountSummaryOutcome> GetAccountSummaryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAccountSummaryOutcome>([this, request](const std::function<void(Model::GetAccountSummaryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAccountSummaryAsync(request, [complete](const IAMClient*, const Model::GetAccountSummaryRequest&, const Model::GetAccountSummaryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAccountSummaryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets a list of all of the context keys referenced in <code>Condition</code>
          * elements in the input policies. The policies are supplied as a list of one or
@@ -2405,11 +3675,42 @@ namespace Model
          */
         virtual void GetContextKeysForCustomPolicyAsync(const Model::GetContextKeysForCustomPolicyRequest& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
          * <p>Gets a list of all of the context keys referenced in <code>Condition</code>
-         * elements in all of the IAM policies attached to the specified IAM entity. The
-         * entity can be an IAM user, group, or role. If you specify a user, then the
-         * request also includes all of the policies attached to groups that the user is a
+         * elements in the input policies. The policies are supplied as a list of one or
+         * more strings. To get the context keys from policies associated with an IAM user,
+         * group, or role, use <a>GetContextKeysForPrincipalPolicy</a>.</p> <p>Context keys
+         * are variables maintained by AWS and its services that provide details about the
+         * context of an API query request, and can be evaluated by using the
+         * <code>Condition</code> element of an IAM policy. Use
+         * GetContextKeysForCustomPolicy to understand what key names and values you must
+         * supply when you call <a>SimulateCustomPolicy</a>. Note that all parameters are
+         * shown in unencoded form here for clarity, but must be URL encoded to be included
+         * as a part of a real HTML request.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetContextKeysForCustomPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetContextKeysForCustomPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetContextKeysForCustomPolicyOutcome> GetContextKeysForCustomPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetContextKeysForCustomPolicyOutcome>([this, request](const std::function<void(Model::GetContextKeysForCustomPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetContextKeysForCustomPolicyAsync(request, [complete](const IAMClient*, const Model::GetContextKeysForCustomPolicyRequest&, const Model::GetContextKeysForCustomPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetContextKeysForCustomPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
+        /**
+         * <p>Gets a list of all of the context keys referenced in <code>Condition</code>
+         * elements in all of the IAM policies attached to the specified IAM entity. The
+         * entity can be an IAM user, group, or role. If you specify a user, then the
+         * request also includes all of the policies attached to groups that the user is a
          * member of.</p> <p>You can optionally include a list of one or more additional
          * policies, specified as strings. If you want to include only a list of policies
          * by string, use <a>GetContextKeysForCustomPolicy</a> instead.</p> <p><b>Note:</b>
@@ -2466,6 +3767,41 @@ namespace Model
          */
         virtual void GetContextKeysForPrincipalPolicyAsync(const Model::GetContextKeysForPrincipalPolicyRequest& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets a list of all of the context keys referenced in <code>Condition</code>
+         * elements in all of the IAM policies attached to the specified IAM entity. The
+         * entity can be an IAM user, group, or role. If you specify a user, then the
+         * request also includes all of the policies attached to groups that the user is a
+         * member of.</p> <p>You can optionally include a list of one or more additional
+         * policies, specified as strings. If you want to include only a list of policies
+         * by string, use <a>GetContextKeysForCustomPolicy</a> instead.</p> <p><b>Note:</b>
+         * This API discloses information about the permissions granted to other users. If
+         * you do not want users to see other user's permissions, then consider allowing
+         * them to use <a>GetContextKeysForCustomPolicy</a> instead.</p> <p>Context keys
+         * are variables maintained by AWS and its services that provide details about the
+         * context of an API query request, and can be evaluated by using the
+         * <code>Condition</code> element of an IAM policy. Use
+         * GetContextKeysForPrincipalPolicy to understand what key names and values you
+         * must supply when you call <a>SimulatePrincipalPolicy</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetContextKeysForPrincipalPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetContextKeysForPrincipalPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetContextKeysForPrincipalPolicyOutcome> GetContextKeysForPrincipalPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetContextKeysForPrincipalPolicyOutcome>([this, request](const std::function<void(Model::GetContextKeysForPrincipalPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetContextKeysForPrincipalPolicyAsync(request, [complete](const IAMClient*, const Model::GetContextKeysForPrincipalPolicyRequest&, const Model::GetContextKeysForPrincipalPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetContextKeysForPrincipalPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Retrieves a credential report for the AWS account. For more information
          * about the credential report, see <a
@@ -2494,6 +3830,30 @@ namespace Model
          */
         virtual void GetCredentialReportAsync(const Model::GetCredentialReportRequest& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Retrieves a credential report for the AWS account. For more information
+         * about the credential report, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/credential-reports.html">Getting
+         * Credential Reports</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetCredentialReportAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetCredentialReportRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetCredentialReportOutcome> GetCredentialReportAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetCredentialReportOutcome>([this, request](const std::function<void(Model::GetCredentialReportOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetCredentialReportAsync(request, [complete](const IAMClient*, const Model::GetCredentialReportRequest&, const Model::GetCredentialReportOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetCredentialReportOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of users that are in the specified group. You can paginate
          * the results using the <code>MaxItems</code> and <code>Marker</code> parameters.
@@ -2519,6 +3879,29 @@ namespace Model
          */
         virtual void GetGroupAsync(const Model::GetGroupRequest& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of users that are in the specified group. You can paginate
+         * the results using the <code>MaxItems</code> and <code>Marker</code> parameters.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way GetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetGroupOutcome> GetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetGroupOutcome>([this, request](const std::function<void(Model::GetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetGroupAsync(request, [complete](const IAMClient*, const Model::GetGroupRequest&, const Model::GetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded in the
          * specified group. </p> <p>A group can also have managed policies attached to it.
@@ -2559,6 +3942,34 @@ namespace Model
          */
         virtual void GetGroupPolicyAsync(const Model::GetGroupPolicyRequest& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the specified inline policy document that is embedded in the
+         * specified group. </p> <p>A group can also have managed policies attached to it.
+         * To retrieve a managed policy document that is attached to a group, use
+         * <a>GetPolicy</a> to determine the policy's default version, then use
+         * <a>GetPolicyVersion</a> to retrieve the policy document. </p> <p>For more
+         * information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetGroupPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetGroupPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetGroupPolicyOutcome> GetGroupPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetGroupPolicyOutcome>([this, request](const std::function<void(Model::GetGroupPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetGroupPolicyAsync(request, [complete](const IAMClient*, const Model::GetGroupPolicyRequest&, const Model::GetGroupPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetGroupPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Retrieves information about the specified instance profile, including the
          * instance profile's path, GUID, ARN, and role. For more information about
@@ -2596,6 +4007,33 @@ namespace Model
          */
         virtual void GetInstanceProfileAsync(const Model::GetInstanceProfileRequest& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Retrieves information about the specified instance profile, including the
+         * instance profile's path, GUID, ARN, and role. For more information about
+         * instance profiles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/AboutInstanceProfiles.html">About
+         * Instance Profiles</a>. For more information about ARNs, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_Identifiers.html#Identifiers_ARNs">ARNs</a>.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way GetInstanceProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetInstanceProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetInstanceProfileOutcome> GetInstanceProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetInstanceProfileOutcome>([this, request](const std::function<void(Model::GetInstanceProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetInstanceProfileAsync(request, [complete](const IAMClient*, const Model::GetInstanceProfileRequest&, const Model::GetInstanceProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetInstanceProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the user name and password-creation date for the specified user. If
          * the user has not been assigned a password, the action returns a 404
@@ -2621,6 +4059,29 @@ namespace Model
          */
         virtual void GetLoginProfileAsync(const Model::GetLoginProfileRequest& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the user name and password-creation date for the specified user. If
+         * the user has not been assigned a password, the action returns a 404
+         * (<code>NoSuchEntity</code>) error. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetLoginProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetLoginProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetLoginProfileOutcome> GetLoginProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetLoginProfileOutcome>([this, request](const std::function<void(Model::GetLoginProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetLoginProfileAsync(request, [complete](const IAMClient*, const Model::GetLoginProfileRequest&, const Model::GetLoginProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetLoginProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the specified OpenID Connect provider.</p>
          */
@@ -2640,6 +4101,27 @@ namespace Model
          */
         virtual void GetOpenIDConnectProviderAsync(const Model::GetOpenIDConnectProviderRequest& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the specified OpenID Connect provider.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetOpenIDConnectProviderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetOpenIDConnectProviderRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetOpenIDConnectProviderOutcome> GetOpenIDConnectProviderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetOpenIDConnectProviderOutcome>([this, request](const std::function<void(Model::GetOpenIDConnectProviderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetOpenIDConnectProviderAsync(request, [complete](const IAMClient*, const Model::GetOpenIDConnectProviderRequest&, const Model::GetOpenIDConnectProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetOpenIDConnectProviderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about the specified managed policy, including the
          * policy's default version and the total number of users, groups, and roles that
@@ -2692,6 +4174,38 @@ namespace Model
          */
         virtual void GetPolicyAsync(const Model::GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about the specified managed policy, including the
+         * policy's default version and the total number of users, groups, and roles that
+         * the policy is attached to. For a list of the specific users, groups, and roles
+         * that the policy is attached to, use the <a>ListEntitiesForPolicy</a> API. This
+         * API returns metadata about the policy. To retrieve the policy document for a
+         * specific version of the policy, use <a>GetPolicyVersion</a>. </p> <p>This API
+         * retrieves information about managed policies. To retrieve information about an
+         * inline policy that is embedded with a user, group, or role, use the
+         * <a>GetUserPolicy</a>, <a>GetGroupPolicy</a>, or <a>GetRolePolicy</a> API. </p>
+         * <p>For more information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetPolicyOutcome> GetPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetPolicyOutcome>([this, request](const std::function<void(Model::GetPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetPolicyAsync(request, [complete](const IAMClient*, const Model::GetPolicyRequest&, const Model::GetPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about the specified version of the specified managed
          * policy, including the policy document. </p> <p>To list the available versions
@@ -2735,6 +4249,35 @@ namespace Model
          */
         virtual void GetPolicyVersionAsync(const Model::GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about the specified version of the specified managed
+         * policy, including the policy document. </p> <p>To list the available versions
+         * for a policy, use <a>ListPolicyVersions</a>. </p> <p>This API retrieves
+         * information about managed policies. To retrieve information about an inline
+         * policy that is embedded in a user, group, or role, use the <a>GetUserPolicy</a>,
+         * <a>GetGroupPolicy</a>, or <a>GetRolePolicy</a> API. </p> <p>For more information
+         * about the types of policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetPolicyVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetPolicyVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetPolicyVersionOutcome> GetPolicyVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetPolicyVersionOutcome>([this, request](const std::function<void(Model::GetPolicyVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetPolicyVersionAsync(request, [complete](const IAMClient*, const Model::GetPolicyVersionRequest&, const Model::GetPolicyVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetPolicyVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about the specified role, including the role's path,
          * GUID, ARN, and the policy granting permission to assume the role. For more
@@ -2772,6 +4315,33 @@ namespace Model
          */
         virtual void GetRoleAsync(const Model::GetRoleRequest& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about the specified role, including the role's path,
+         * GUID, ARN, and the policy granting permission to assume the role. For more
+         * information about ARNs, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_Identifiers.html#Identifiers_ARNs">ARNs</a>.
+         * For more information about roles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/WorkingWithRoles.html">Working
+         * with Roles</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetRoleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetRoleRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetRoleOutcome> GetRoleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetRoleOutcome>([this, request](const std::function<void(Model::GetRoleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetRoleAsync(request, [complete](const IAMClient*, const Model::GetRoleRequest&, const Model::GetRoleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetRoleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded with the
          * specified role. </p> <p>A role can also have managed policies attached to it. To
@@ -2821,6 +4391,37 @@ namespace Model
          */
         virtual void GetRolePolicyAsync(const Model::GetRolePolicyRequest& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the specified inline policy document that is embedded with the
+         * specified role. </p> <p>A role can also have managed policies attached to it. To
+         * retrieve a managed policy document that is attached to a role, use
+         * <a>GetPolicy</a> to determine the policy's default version, then use
+         * <a>GetPolicyVersion</a> to retrieve the policy document. </p> <p>For more
+         * information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p> <p>For more
+         * information about roles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/roles-toplevel.html">Using
+         * Roles to Delegate Permissions and Federate Identities</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetRolePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetRolePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetRolePolicyOutcome> GetRolePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetRolePolicyOutcome>([this, request](const std::function<void(Model::GetRolePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetRolePolicyAsync(request, [complete](const IAMClient*, const Model::GetRolePolicyRequest&, const Model::GetRolePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetRolePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the SAML provider metadocument that was uploaded when the provider
          * was created or updated. </p> <note>This operation requires <a
@@ -2849,6 +4450,30 @@ namespace Model
          */
         virtual void GetSAMLProviderAsync(const Model::GetSAMLProviderRequest& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the SAML provider metadocument that was uploaded when the provider
+         * was created or updated. </p> <note>This operation requires <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/signature-version-4.html">Signature
+         * Version 4</a>. </note>
+         *
+         * Returns an awaitable that starts the operation the way GetSAMLProviderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetSAMLProviderRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetSAMLProviderOutcome> GetSAMLProviderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetSAMLProviderOutcome>([this, request](const std::function<void(Model::GetSAMLProviderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetSAMLProviderAsync(request, [complete](const IAMClient*, const Model::GetSAMLProviderRequest&, const Model::GetSAMLProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetSAMLProviderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the specified SSH public key, including metadata about the key.</p>
          * <p>The SSH public key retrieved by this action is used only for authenticating
@@ -2886,6 +4511,33 @@ namespace Model
          */
         virtual void GetSSHPublicKeyAsync(const Model::GetSSHPublicKeyRequest& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the specified SSH public key, including metadata about the key.</p>
+         * <p>The SSH public key retrieved by this action is used only for authenticating
+         * the associated IAM user to an AWS CodeCommit repository. For more information
+         * about using SSH keys to authenticate to an AWS CodeCommit repository, see <a
+         * href="http://docs.aws.amazon.com/codecommit/latest/userguide/setting-up-credentials-ssh.html">Set
+         * up AWS CodeCommit for SSH Connections</a> in the <i>AWS CodeCommit User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetSSHPublicKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetSSHPublicKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetSSHPublicKeyOutcome> GetSSHPublicKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetSSHPublicKeyOutcome>([this, request](const std::function<void(Model::GetSSHPublicKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetSSHPublicKeyAsync(request, [complete](const IAMClient*, const Model::GetSSHPublicKeyRequest&, const Model::GetSSHPublicKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetSSHPublicKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about the specified server certificate.</p> <p>For more
          * information about working with server certificates, including a list of AWS
@@ -2917,6 +4569,31 @@ namespace Model
          */
         virtual void GetServerCertificateAsync(const Model::GetServerCertificateRequest& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about the specified server certificate.</p> <p>For more
+         * information about working with server certificates, including a list of AWS
+         * services that can use the server certificates that you manage with IAM, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/id_credentials_server-certs.html">Working
+         * with Server Certificates</a> in the <i>IAM User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetServerCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetServerCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetServerCertificateOutcome> GetServerCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetServerCertificateOutcome>([this, request](const std::function<void(Model::GetServerCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetServerCertificateAsync(request, [complete](const IAMClient*, const Model::GetServerCertificateRequest&, const Model::GetServerCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetServerCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about the specified user, including the user's creation
          * date, path, unique ID, and ARN. </p> <p>If you do not specify a user name, IAM
@@ -2945,6 +4622,30 @@ namespace Model
          */
         virtual void GetUserAsync(const Model::GetUserRequest& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about the specified user, including the user's creation
+         * date, path, unique ID, and ARN. </p> <p>If you do not specify a user name, IAM
+         * determines the user name implicitly based on the AWS access key ID used to sign
+         * the request. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetUserAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetUserRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetUserOutcome> GetUserAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetUserOutcome>([this, request](const std::function<void(Model::GetUserOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetUserAsync(request, [complete](const IAMClient*, const Model::GetUserRequest&, const Model::GetUserOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetUserOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded in the
          * specified user. </p> <p>A user can also have managed policies attached to it. To
@@ -2985,6 +4686,34 @@ namespace Model
          */
         virtual void GetUserPolicyAsync(const Model::GetUserPolicyRequest& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the specified inline policy document that is embedded in the
+         * specified user. </p> <p>A user can also have managed policies attached to it. To
+         * retrieve a managed policy document that is attached to a user, use
+         * <a>GetPolicy</a> to determine the policy's default version, then use
+         * <a>GetPolicyVersion</a> to retrieve the policy document. </p> <p>For more
+         * information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetUserPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetUserPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetUserPolicyOutcome> GetUserPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetUserPolicyOutcome>([this, request](const std::function<void(Model::GetUserPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetUserPolicyAsync(request, [complete](const IAMClient*, const Model::GetUserPolicyRequest&, const Model::GetUserPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetUserPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the access key IDs associated with the specified
          * user. If there are none, the action returns an empty list. </p> <p>Although each
@@ -3031,6 +4760,36 @@ namespace Model
          */
         virtual void ListAccessKeysAsync(const Model::ListAccessKeysRequest& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the access key IDs associated with the specified
+         * user. If there are none, the action returns an empty list. </p> <p>Although each
+         * user is limited to a small number of keys, you can still paginate the results
+         * using the <code>MaxItems</code> and <code>Marker</code> parameters. </p> <p>If
+         * the <code>UserName</code> field is not specified, the UserName is determined
+         * implicitly based on the AWS access key ID used to sign the request. Because this
+         * action works for access keys under the AWS account, you can use this action to
+         * manage root credentials even if the AWS account has no associated users. </p>
+         * <note>To ensure the security of your AWS account, the secret access key is
+         * accessible only during key and user creation. </note>
+         *
+         * Returns an awaitable that starts the operation the way ListAccessKeysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAccessKeysRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAccessKeysOutcome> ListAccessKeysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAccessKeysOutcome>([this, request](const std::function<void(Model::ListAccessKeysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAccessKeysAsync(request, [complete](const IAMClient*, const Model::ListAccessKeysRequest&, const Model::ListAccessKeysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAccessKeysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Lists the account alias associated with the account (Note: you can have only
          * one). For information about using an AWS account alias, see <a
@@ -3059,6 +4818,30 @@ namespace Model
          */
         virtual void ListAccountAliasesAsync(const Model::ListAccountAliasesRequest& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Lists the account alias associated with the account (Note: you can have only
+         * one). For information about using an AWS account alias, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/AccountAlias.html">Using
+         * an Alias for Your AWS Account ID</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListAccountAliasesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAccountAliasesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAccountAliasesOutcome> ListAccountAliasesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAccountAliasesOutcome>([this, request](const std::function<void(Model::ListAccountAliasesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAccountAliasesAsync(request, [complete](const IAMClient*, const Model::ListAccountAliasesRequest&, const Model::ListAccountAliasesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAccountAliasesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all managed policies that are attached to the specified group.</p> <p>A
          * group can also have inline policies embedded with it. To list the inline
@@ -3108,6 +4891,37 @@ namespace Model
          */
         virtual void ListAttachedGroupPoliciesAsync(const Model::ListAttachedGroupPoliciesRequest& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all managed policies that are attached to the specified group.</p> <p>A
+         * group can also have inline policies embedded with it. To list the inline
+         * policies for a group, use the <a>ListGroupPolicies</a> API. For information
+         * about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p> <p>You can
+         * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
+         * parameters. You can use the <code>PathPrefix</code> parameter to limit the list
+         * of policies to only those matching the specified path prefix. If there are no
+         * policies attached to the specified group (or none that match the specified path
+         * prefix), the action returns an empty list. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListAttachedGroupPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAttachedGroupPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAttachedGroupPoliciesOutcome> ListAttachedGroupPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAttachedGroupPoliciesOutcome>([this, request](const std::function<void(Model::ListAttachedGroupPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAttachedGroupPoliciesAsync(request, [complete](const IAMClient*, const Model::ListAttachedGroupPoliciesRequest&, const Model::ListAttachedGroupPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAttachedGroupPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all managed policies that are attached to the specified role. </p> <p>A
          * role can also have inline policies embedded with it. To list the inline policies
@@ -3157,6 +4971,37 @@ namespace Model
          */
         virtual void ListAttachedRolePoliciesAsync(const Model::ListAttachedRolePoliciesRequest& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all managed policies that are attached to the specified role. </p> <p>A
+         * role can also have inline policies embedded with it. To list the inline policies
+         * for a role, use the <a>ListRolePolicies</a> API. For information about policies,
+         * refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p> <p>You can
+         * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
+         * parameters. You can use the <code>PathPrefix</code> parameter to limit the list
+         * of policies to only those matching the specified path prefix. If there are no
+         * policies attached to the specified role (or none that match the specified path
+         * prefix), the action returns an empty list. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListAttachedRolePoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAttachedRolePoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAttachedRolePoliciesOutcome> ListAttachedRolePoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAttachedRolePoliciesOutcome>([this, request](const std::function<void(Model::ListAttachedRolePoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAttachedRolePoliciesAsync(request, [complete](const IAMClient*, const Model::ListAttachedRolePoliciesRequest&, const Model::ListAttachedRolePoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAttachedRolePoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all managed policies that are attached to the specified user. </p> <p>A
          * user can also have inline policies embedded with it. To list the inline policies
@@ -3206,6 +5051,37 @@ namespace Model
          */
         virtual void ListAttachedUserPoliciesAsync(const Model::ListAttachedUserPoliciesRequest& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all managed policies that are attached to the specified user. </p> <p>A
+         * user can also have inline policies embedded with it. To list the inline policies
+         * for a user, use the <a>ListUserPolicies</a> API. For information about policies,
+         * refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p> <p>You can
+         * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
+         * parameters. You can use the <code>PathPrefix</code> parameter to limit the list
+         * of policies to only those matching the specified path prefix. If there are no
+         * policies attached to the specified group (or none that match the specified path
+         * prefix), the action returns an empty list. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListAttachedUserPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAttachedUserPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAttachedUserPoliciesOutcome> ListAttachedUserPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAttachedUserPoliciesOutcome>([this, request](const std::function<void(Model::ListAttachedUserPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAttachedUserPoliciesAsync(request, [complete](const IAMClient*, const Model::ListAttachedUserPoliciesRequest&, const Model::ListAttachedUserPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAttachedUserPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all users, groups, and roles that the specified managed policy is
          * attached to. </p> <p>You can use the optional <code>EntityFilter</code>
@@ -3243,6 +5119,33 @@ namespace Model
          */
         virtual void ListEntitiesForPolicyAsync(const Model::ListEntitiesForPolicyRequest& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all users, groups, and roles that the specified managed policy is
+         * attached to. </p> <p>You can use the optional <code>EntityFilter</code>
+         * parameter to limit the results to a particular type of entity (users, groups, or
+         * roles). For example, to list only the roles that are attached to the specified
+         * policy, set <code>EntityFilter</code> to <code>Role</code>. </p> <p>You can
+         * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
+         * parameters. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListEntitiesForPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListEntitiesForPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListEntitiesForPolicyOutcome> ListEntitiesForPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListEntitiesForPolicyOutcome>([this, request](const std::function<void(Model::ListEntitiesForPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListEntitiesForPolicyAsync(request, [complete](const IAMClient*, const Model::ListEntitiesForPolicyRequest&, const Model::ListEntitiesForPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListEntitiesForPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the names of the inline policies that are embedded in the specified
          * group. </p> <p>A group can also have managed policies attached to it. To list
@@ -3289,6 +5192,36 @@ namespace Model
          */
         virtual void ListGroupPoliciesAsync(const Model::ListGroupPoliciesRequest& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the names of the inline policies that are embedded in the specified
+         * group. </p> <p>A group can also have managed policies attached to it. To list
+         * the managed policies that are attached to a group, use
+         * <a>ListAttachedGroupPolicies</a>. For more information about policies, refer to
+         * <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p> <p>You can
+         * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
+         * parameters. If there are no inline policies embedded with the specified group,
+         * the action returns an empty list. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListGroupPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListGroupPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListGroupPoliciesOutcome> ListGroupPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListGroupPoliciesOutcome>([this, request](const std::function<void(Model::ListGroupPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListGroupPoliciesAsync(request, [complete](const IAMClient*, const Model::ListGroupPoliciesRequest&, const Model::ListGroupPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListGroupPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the groups that have the specified path prefix.</p> <p> You can
          * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
@@ -3314,6 +5247,29 @@ namespace Model
          */
         virtual void ListGroupsAsync(const Model::ListGroupsRequest& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the groups that have the specified path prefix.</p> <p> You can
+         * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
+         * parameters. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListGroupsOutcome> ListGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListGroupsOutcome>([this, request](const std::function<void(Model::ListGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListGroupsAsync(request, [complete](const IAMClient*, const Model::ListGroupsRequest&, const Model::ListGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the groups the specified user belongs to.</p> <p>You can paginate the
          * results using the <code>MaxItems</code> and <code>Marker</code> parameters. </p>
@@ -3336,6 +5292,28 @@ namespace Model
          */
         virtual void ListGroupsForUserAsync(const Model::ListGroupsForUserRequest& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the groups the specified user belongs to.</p> <p>You can paginate the
+         * results using the <code>MaxItems</code> and <code>Marker</code> parameters. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListGroupsForUserAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListGroupsForUserRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListGroupsForUserOutcome> ListGroupsForUserAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListGroupsForUserOutcome>([this, request](const std::function<void(Model::ListGroupsForUserOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListGroupsForUserAsync(request, [complete](const IAMClient*, const Model::ListGroupsForUserRequest&, const Model::ListGroupsForUserOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListGroupsForUserOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the instance profiles that have the specified path prefix. If there are
          * none, the action returns an empty list. For more information about instance
@@ -3344,7 +5322,19 @@ namespace Model
          * Instance Profiles</a>. </p> <p>You can paginate the results using the
          * <code>MaxItems</code> and <code>Marker</code> parameters. </p>
          */
-        virtual Model::ListInstanceProfilesOutcome ListInstanceProfiles(const Model::ListInstanceProfilesRequest& request) const;
+        virtual Model::ListInstanceProfilesOutcome ListInstanceProfiles(const Model::ListInstanceProfilesRequest& request) const;
+
+        /**
+         * <p>Lists the instance profiles that have the specified path prefix. If there are
+         * none, the action returns an empty list. For more information about instance
+         * profiles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/AboutInstanceProfiles.html">About
+         * Instance Profiles</a>. </p> <p>You can paginate the results using the
+         * <code>MaxItems</code> and <code>Marker</code> parameters. </p>
+         *
+         * returns a future to the operation so that it can be executed in parallel to other requests.
+         */
+        virtual Model::ListInstanceProfilesOutcomeCallable ListInstanceProfilesCallable(const Model::ListInstanceProfilesRequest& request) const;
 
         /**
          * <p>Lists the instance profiles that have the specified path prefix. If there are
@@ -3354,10 +5344,11 @@ namespace Model
          * Instance Profiles</a>. </p> <p>You can paginate the results using the
          * <code>MaxItems</code> and <code>Marker</code> parameters. </p>
          *
-         * returns a future to the operation so that it can be executed in parallel to other requests.
+         * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
-        virtual Model::ListInstanceProfilesOutcomeCallable ListInstanceProfilesCallable(const Model::ListInstanceProfilesRequest& request) const;
+        virtual void ListInstanceProfilesAsync(const Model::ListInstanceProfilesRequest& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
          * <p>Lists the instance profiles that have the specified path prefix. If there are
          * none, the action returns an empty list. For more information about instance
@@ -3366,9 +5357,22 @@ namespace Model
          * Instance Profiles</a>. </p> <p>You can paginate the results using the
          * <code>MaxItems</code> and <code>Marker</code> parameters. </p>
          *
-         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         * Returns an awaitable that starts the operation the way ListInstanceProfilesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
          */
-        virtual void ListInstanceProfilesAsync(const Model::ListInstanceProfilesRequest& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        template<typename REQUEST = Model::ListInstanceProfilesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListInstanceProfilesOutcome> ListInstanceProfilesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListInstanceProfilesOutcome>([this, request](const std::function<void(Model::ListInstanceProfilesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListInstanceProfilesAsync(request, [complete](const IAMClient*, const Model::ListInstanceProfilesRequest&, const Model::ListInstanceProfilesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListInstanceProfilesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Lists the instance profiles that have the specified associated role. If there
@@ -3404,6 +5408,32 @@ namespace Model
          */
         virtual void ListInstanceProfilesForRoleAsync(const Model::ListInstanceProfilesForRoleRequest& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the instance profiles that have the specified associated role. If there
+         * are none, the action returns an empty list. For more information about instance
+         * profiles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/AboutInstanceProfiles.html">About
+         * Instance Profiles</a>. </p> <p>You can paginate the results using the
+         * <code>MaxItems</code> and <code>Marker</code> parameters. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListInstanceProfilesForRoleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListInstanceProfilesForRoleRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListInstanceProfilesForRoleOutcome> ListInstanceProfilesForRoleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListInstanceProfilesForRoleOutcome>([this, request](const std::function<void(Model::ListInstanceProfilesForRoleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListInstanceProfilesForRoleAsync(request, [complete](const IAMClient*, const Model::ListInstanceProfilesForRoleRequest&, const Model::ListInstanceProfilesForRoleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListInstanceProfilesForRoleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the MFA devices. If the request includes the user name, then this
          * action lists all the MFA devices associated with the specified user name. If you
@@ -3435,6 +5465,31 @@ namespace Model
          */
         virtual void ListMFADevicesAsync(const Model::ListMFADevicesRequest& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the MFA devices. If the request includes the user name, then this
+         * action lists all the MFA devices associated with the specified user name. If you
+         * do not specify a user name, IAM determines the user name implicitly based on the
+         * AWS access key ID signing the request. </p> <p>You can paginate the results
+         * using the <code>MaxItems</code> and <code>Marker</code> parameters. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListMFADevicesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListMFADevicesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListMFADevicesOutcome> ListMFADevicesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListMFADevicesOutcome>([this, request](const std::function<void(Model::ListMFADevicesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListMFADevicesAsync(request, [complete](const IAMClient*, const Model::ListMFADevicesRequest&, const Model::ListMFADevicesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListMFADevicesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists information about the OpenID Connect providers in the AWS account. </p>
          */
@@ -3454,6 +5509,27 @@ namespace Model
          */
         virtual void ListOpenIDConnectProvidersAsync(const Model::ListOpenIDConnectProvidersRequest& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists information about the OpenID Connect providers in the AWS account. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListOpenIDConnectProvidersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListOpenIDConnectProvidersRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListOpenIDConnectProvidersOutcome> ListOpenIDConnectProvidersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListOpenIDConnectProvidersOutcome>([this, request](const std::function<void(Model::ListOpenIDConnectProvidersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListOpenIDConnectProvidersAsync(request, [complete](const IAMClient*, const Model::ListOpenIDConnectProvidersRequest&, const Model::ListOpenIDConnectProvidersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListOpenIDConnectProvidersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all the managed policies that are available to your account, including
          * your own customer managed policies and all AWS managed policies. </p> <p>You can
@@ -3503,6 +5579,37 @@ namespace Model
          */
         virtual void ListPoliciesAsync(const Model::ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all the managed policies that are available to your account, including
+         * your own customer managed policies and all AWS managed policies. </p> <p>You can
+         * filter the list of policies that is returned using the optional
+         * <code>OnlyAttached</code>, <code>Scope</code>, and <code>PathPrefix</code>
+         * parameters. For example, to list only the customer managed policies in your AWS
+         * account, set <code>Scope</code> to <code>Local</code>. To list only AWS managed
+         * policies, set <code>Scope</code> to <code>AWS</code>. </p> <p>You can paginate
+         * the results using the <code>MaxItems</code> and <code>Marker</code> parameters.
+         * </p> <p>For more information about managed policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPoliciesOutcome> ListPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPoliciesOutcome>([this, request](const std::function<void(Model::ListPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPoliciesAsync(request, [complete](const IAMClient*, const Model::ListPoliciesRequest&, const Model::ListPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists information about the versions of the specified managed policy,
          * including the version that is set as the policy's default version. </p> <p>For
@@ -3534,6 +5641,31 @@ namespace Model
          */
         virtual void ListPolicyVersionsAsync(const Model::ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists information about the versions of the specified managed policy,
+         * including the version that is set as the policy's default version. </p> <p>For
+         * more information about managed policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListPolicyVersionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPolicyVersionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPolicyVersionsOutcome> ListPolicyVersionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPolicyVersionsOutcome>([this, request](const std::function<void(Model::ListPolicyVersionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPolicyVersionsAsync(request, [complete](const IAMClient*, const Model::ListPolicyVersionsRequest&, const Model::ListPolicyVersionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPolicyVersionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the names of the inline policies that are embedded in the specified
          * role. </p> <p>A role can also have managed policies attached to it. To list the
@@ -3580,6 +5712,36 @@ namespace Model
          */
         virtual void ListRolePoliciesAsync(const Model::ListRolePoliciesRequest& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the names of the inline policies that are embedded in the specified
+         * role. </p> <p>A role can also have managed policies attached to it. To list the
+         * managed policies that are attached to a role, use
+         * <a>ListAttachedRolePolicies</a>. For more information about policies, refer to
+         * <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p> <p>You can
+         * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
+         * parameters. If there are no inline policies embedded with the specified role,
+         * the action returns an empty list. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListRolePoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRolePoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRolePoliciesOutcome> ListRolePoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRolePoliciesOutcome>([this, request](const std::function<void(Model::ListRolePoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRolePoliciesAsync(request, [complete](const IAMClient*, const Model::ListRolePoliciesRequest&, const Model::ListRolePoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRolePoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the roles that have the specified path prefix. If there are none, the
          * action returns an empty list. For more information about roles, go to <a
@@ -3611,6 +5773,31 @@ namespace Model
          */
         virtual void ListRolesAsync(const Model::ListRolesRequest& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the roles that have the specified path prefix. If there are none, the
+         * action returns an empty list. For more information about roles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/WorkingWithRoles.html">Working
+         * with Roles</a>. </p> <p>You can paginate the results using the
+         * <code>MaxItems</code> and <code>Marker</code> parameters. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListRolesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRolesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRolesOutcome> ListRolesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRolesOutcome>([this, request](const std::function<void(Model::ListRolesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRolesAsync(request, [complete](const IAMClient*, const Model::ListRolesRequest&, const Model::ListRolesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRolesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the SAML providers in the account.</p> <note> This operation requires
          * <a
@@ -3639,6 +5826,30 @@ namespace Model
          */
         virtual void ListSAMLProvidersAsync(const Model::ListSAMLProvidersRequest& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the SAML providers in the account.</p> <note> This operation requires
+         * <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/signature-version-4.html">Signature
+         * Version 4</a>. </note>
+         *
+         * Returns an awaitable that starts the operation the way ListSAMLProvidersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListSAMLProvidersRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListSAMLProvidersOutcome> ListSAMLProvidersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListSAMLProvidersOutcome>([this, request](const std::function<void(Model::ListSAMLProvidersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListSAMLProvidersAsync(request, [complete](const IAMClient*, const Model::ListSAMLProvidersRequest&, const Model::ListSAMLProvidersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListSAMLProvidersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the SSH public keys associated with the specified
          * IAM user. If there are none, the action returns an empty list.</p> <p>The SSH
@@ -3685,6 +5896,36 @@ namespace Model
          */
         virtual void ListSSHPublicKeysAsync(const Model::ListSSHPublicKeysRequest& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the SSH public keys associated with the specified
+         * IAM user. If there are none, the action returns an empty list.</p> <p>The SSH
+         * public keys returned by this action are used only for authenticating the IAM
+         * user to an AWS CodeCommit repository. For more information about using SSH keys
+         * to authenticate to an AWS CodeCommit repository, see <a
+         * href="http://docs.aws.amazon.com/codecommit/latest/userguide/setting-up-credentials-ssh.html">Set
+         * up AWS CodeCommit for SSH Connections</a> in the <i>AWS CodeCommit User
+         * Guide</i>.</p> <p>Although each user is limited to a small number of keys, you
+         * can still paginate the results using the <code>MaxItems</code> and
+         * <code>Marker</code> parameters.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListSSHPublicKeysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListSSHPublicKeysRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListSSHPublicKeysOutcome> ListSSHPublicKeysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListSSHPublicKeysOutcome>([this, request](const std::function<void(Model::ListSSHPublicKeysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListSSHPublicKeysAsync(request, [complete](const IAMClient*, const Model::ListSSHPublicKeysRequest&, const Model::ListSSHPublicKeysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListSSHPublicKeysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Lists the server certificates that have the specified path prefix. If none
          * exist, the action returns an empty list. </p> <p> You can paginate the results
@@ -3722,6 +5963,33 @@ namespace Model
          */
         virtual void ListServerCertificatesAsync(const Model::ListServerCertificatesRequest& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Lists the server certificates that have the specified path prefix. If none
+         * exist, the action returns an empty list. </p> <p> You can paginate the results
+         * using the <code>MaxItems</code> and <code>Marker</code> parameters. </p> <p>For
+         * more information about working with server certificates, including a list of AWS
+         * services that can use the server certificates that you manage with IAM, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/id_credentials_server-certs.html">Working
+         * with Server Certificates</a> in the <i>IAM User Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListServerCertificatesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListServerCertificatesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListServerCertificatesOutcome> ListServerCertificatesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListServerCertificatesOutcome>([this, request](const std::function<void(Model::ListServerCertificatesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListServerCertificatesAsync(request, [complete](const IAMClient*, const Model::ListServerCertificatesRequest&, const Model::ListServerCertificatesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListServerCertificatesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the signing certificates associated with the
          * specified user. If there are none, the action returns an empty list. </p>
@@ -3765,6 +6033,35 @@ namespace Model
          */
         virtual void ListSigningCertificatesAsync(const Model::ListSigningCertificatesRequest& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the signing certificates associated with the
+         * specified user. If there are none, the action returns an empty list. </p>
+         * <p>Although each user is limited to a small number of signing certificates, you
+         * can still paginate the results using the <code>MaxItems</code> and
+         * <code>Marker</code> parameters. </p> <p>If the <code>UserName</code> field is
+         * not specified, the user name is determined implicitly based on the AWS access
+         * key ID used to sign the request. Because this action works for access keys under
+         * the AWS account, you can use this action to manage root credentials even if the
+         * AWS account has no associated users. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListSigningCertificatesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListSigningCertificatesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListSigningCertificatesOutcome> ListSigningCertificatesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListSigningCertificatesOutcome>([this, request](const std::function<void(Model::ListSigningCertificatesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListSigningCertificatesAsync(request, [complete](const IAMClient*, const Model::ListSigningCertificatesRequest&, const Model::ListSigningCertificatesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListSigningCertificatesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the names of the inline policies embedded in the specified user. </p>
          * <p>A user can also have managed policies attached to it. To list the managed
@@ -3808,6 +6105,35 @@ namespace Model
          */
         virtual void ListUserPoliciesAsync(const Model::ListUserPoliciesRequest& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the names of the inline policies embedded in the specified user. </p>
+         * <p>A user can also have managed policies attached to it. To list the managed
+         * policies that are attached to a user, use <a>ListAttachedUserPolicies</a>. For
+         * more information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p> <p>You can
+         * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
+         * parameters. If there are no inline policies embedded with the specified user,
+         * the action returns an empty list. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListUserPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListUserPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListUserPoliciesOutcome> ListUserPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListUserPoliciesOutcome>([this, request](const std::function<void(Model::ListUserPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListUserPoliciesAsync(request, [complete](const IAMClient*, const Model::ListUserPoliciesRequest&, const Model::ListUserPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListUserPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the IAM users that have the specified path prefix. If no path prefix is
          * specified, the action returns all users in the AWS account. If there are none,
@@ -3836,6 +6162,30 @@ namespace Model
          */
         virtual void ListUsersAsync(const Model::ListUsersRequest& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the IAM users that have the specified path prefix. If no path prefix is
+         * specified, the action returns all users in the AWS account. If there are none,
+         * the action returns an empty list. </p> <p>You can paginate the results using the
+         * <code>MaxItems</code> and <code>Marker</code> parameters. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListUsersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListUsersRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListUsersOutcome> ListUsersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListUsersOutcome>([this, request](const std::function<void(Model::ListUsersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListUsersAsync(request, [complete](const IAMClient*, const Model::ListUsersRequest&, const Model::ListUsersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListUsersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the virtual MFA devices under the AWS account by assignment status. If
          * you do not specify an assignment status, the action returns a list of all
@@ -3867,6 +6217,31 @@ namespace Model
          */
         virtual void ListVirtualMFADevicesAsync(const Model::ListVirtualMFADevicesRequest& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the virtual MFA devices under the AWS account by assignment status. If
+         * you do not specify an assignment status, the action returns a list of all
+         * virtual MFA devices. Assignment status can be <code>Assigned</code>,
+         * <code>Unassigned</code>, or <code>Any</code>. </p> <p>You can paginate the
+         * results using the <code>MaxItems</code> and <code>Marker</code> parameters. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListVirtualMFADevicesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListVirtualMFADevicesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListVirtualMFADevicesOutcome> ListVirtualMFADevicesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListVirtualMFADevicesOutcome>([this, request](const std::function<void(Model::ListVirtualMFADevicesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListVirtualMFADevicesAsync(request, [complete](const IAMClient*, const Model::ListVirtualMFADevicesRequest&, const Model::ListVirtualMFADevicesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListVirtualMFADevicesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds (or updates) an inline policy document that is embedded in the specified
          * group. </p> <p>A user can also have managed policies attached to it. To attach a
@@ -3928,6 +6303,41 @@ namespace Model
          */
         virtual void PutGroupPolicyAsync(const Model::PutGroupPolicyRequest& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds (or updates) an inline policy document that is embedded in the specified
+         * group. </p> <p>A user can also have managed policies attached to it. To attach a
+         * managed policy to a group, use <a>AttachGroupPolicy</a>. To create a new managed
+         * policy, use <a>CreatePolicy</a>. For information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p> <p>For
+         * information about limits on the number of inline policies that you can embed in
+         * a group, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/LimitationsOnEntities.html">Limitations
+         * on IAM Entities</a> in the <i>IAM User Guide</i>. </p> <note>Because policy
+         * documents can be large, you should use POST rather than GET when calling
+         * <code>PutGroupPolicy</code>. For general information about using the Query API
+         * with IAM, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/IAM_UsingQueryAPI.html">Making
+         * Query Requests</a> in the <i>Using IAM</i> guide. </note>
+         *
+         * Returns an awaitable that starts the operation the way PutGroupPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutGroupPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutGroupPolicyOutcome> PutGroupPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutGroupPolicyOutcome>([this, request](const std::function<void(Model::PutGroupPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutGroupPolicyAsync(request, [complete](const IAMClient*, const Model::PutGroupPolicyRequest&, const Model::PutGroupPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutGroupPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds (or updates) an inline policy document that is embedded in the specified
          * role. </p> <p>When you embed an inline policy in a role, the inline policy is
@@ -4010,6 +6420,48 @@ namespace Model
          */
         virtual void PutRolePolicyAsync(const Model::PutRolePolicyRequest& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds (or updates) an inline policy document that is embedded in the specified
+         * role. </p> <p>When you embed an inline policy in a role, the inline policy is
+         * used as the role's access (permissions) policy. The role's trust policy is
+         * created at the same time as the role, using <a>CreateRole</a>. You can update a
+         * role's trust policy using <a>UpdateAssumeRolePolicy</a>. For more information
+         * about roles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/roles-toplevel.html">Using
+         * Roles to Delegate Permissions and Federate Identities</a>. </p> <p>A role can
+         * also have a managed policy attached to it. To attach a managed policy to a role,
+         * use <a>AttachRolePolicy</a>. To create a new managed policy, use
+         * <a>CreatePolicy</a>. For information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p> <p>For
+         * information about limits on the number of inline policies that you can embed
+         * with a role, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/LimitationsOnEntities.html">Limitations
+         * on IAM Entities</a> in the <i>IAM User Guide</i>. </p> <note>Because policy
+         * documents can be large, you should use POST rather than GET when calling
+         * <code>PutRolePolicy</code>. For general information about using the Query API
+         * with IAM, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/IAM_UsingQueryAPI.html">Making
+         * Query Requests</a> in the <i>Using IAM</i> guide. </note>
+         *
+         * Returns an awaitable that starts the operation the way PutRolePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutRolePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutRolePolicyOutcome> PutRolePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutRolePolicyOutcome>([this, request](const std::function<void(Model::PutRolePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutRolePolicyAsync(request, [complete](const IAMClient*, const Model::PutRolePolicyRequest&, const Model::PutRolePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutRolePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds (or updates) an inline policy document that is embedded in the specified
          * user. </p> <p>A user can also have a managed policy attached to it. To attach a
@@ -4071,6 +6523,41 @@ namespace Model
          */
         virtual void PutUserPolicyAsync(const Model::PutUserPolicyRequest& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds (or updates) an inline policy document that is embedded in the specified
+         * user. </p> <p>A user can also have a managed policy attached to it. To attach a
+         * managed policy to a user, use <a>AttachUserPolicy</a>. To create a new managed
+         * policy, use <a>CreatePolicy</a>. For information about policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p> <p>For
+         * information about limits on the number of inline policies that you can embed in
+         * a user, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/LimitationsOnEntities.html">Limitations
+         * on IAM Entities</a> in the <i>IAM User Guide</i>. </p> <note>Because policy
+         * documents can be large, you should use POST rather than GET when calling
+         * <code>PutUserPolicy</code>. For general information about using the Query API
+         * with IAM, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/IAM_UsingQueryAPI.html">Making
+         * Query Requests</a> in the <i>Using IAM</i> guide. </note>
+         *
+         * Returns an awaitable that starts the operation the way PutUserPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutUserPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutUserPolicyOutcome> PutUserPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutUserPolicyOutcome>([this, request](const std::function<void(Model::PutUserPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutUserPolicyAsync(request, [complete](const IAMClient*, const Model::PutUserPolicyRequest&, const Model::PutUserPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutUserPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified client ID (also known as audience) from the list of
          * client IDs registered for the specified IAM OpenID Connect provider.</p> <p>This
@@ -4099,6 +6586,30 @@ namespace Model
          */
         virtual void RemoveClientIDFromOpenIDConnectProviderAsync(const Model::RemoveClientIDFromOpenIDConnectProviderRequest& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified client ID (also known as audience) from the list of
+         * client IDs registered for the specified IAM OpenID Connect provider.</p> <p>This
+         * action is idempotent; it does not fail or return an error if you try to remove a
+         * client ID that was removed previously.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveClientIDFromOpenIDConnectProviderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveClientIDFromOpenIDConnectProviderRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveClientIDFromOpenIDConnectProviderOutcome> RemoveClientIDFromOpenIDConnectProviderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveClientIDFromOpenIDConnectProviderOutcome>([this, request](const std::function<void(Model::RemoveClientIDFromOpenIDConnectProviderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveClientIDFromOpenIDConnectProviderAsync(request, [complete](const IAMClient*, const Model::RemoveClientIDFromOpenIDConnectProviderRequest&, const Model::RemoveClientIDFromOpenIDConnectProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveClientIDFromOpenIDConnectProviderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified role from the specified instance profile.</p>
          * <important> Make sure you do not have any Amazon EC2 instances running with the
@@ -4145,6 +6656,36 @@ namespace Model
          */
         virtual void RemoveRoleFromInstanceProfileAsync(const Model::RemoveRoleFromInstanceProfileRequest& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified role from the specified instance profile.</p>
+         * <important> Make sure you do not have any Amazon EC2 instances running with the
+         * role you are about to remove from the instance profile. Removing a role from an
+         * instance profile that is associated with a running instance will break any
+         * applications running on the instance. </important> <p> For more information
+         * about roles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/WorkingWithRoles.html">Working
+         * with Roles</a>. For more information about instance profiles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/AboutInstanceProfiles.html">About
+         * Instance Profiles</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveRoleFromInstanceProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveRoleFromInstanceProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveRoleFromInstanceProfileOutcome> RemoveRoleFromInstanceProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveRoleFromInstanceProfileOutcome>([this, request](const std::function<void(Model::RemoveRoleFromInstanceProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveRoleFromInstanceProfileAsync(request, [complete](const IAMClient*, const Model::RemoveRoleFromInstanceProfileRequest&, const Model::RemoveRoleFromInstanceProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveRoleFromInstanceProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified user from the specified group.</p>
          */
@@ -4164,6 +6705,27 @@ namespace Model
          */
         virtual void RemoveUserFromGroupAsync(const Model::RemoveUserFromGroupRequest& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified user from the specified group.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveUserFromGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveUserFromGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveUserFromGroupOutcome> RemoveUserFromGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveUserFromGroupOutcome>([this, request](const std::function<void(Model::RemoveUserFromGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveUserFromGroupAsync(request, [complete](const IAMClient*, const Model::RemoveUserFromGroupRequest&, const Model::RemoveUserFromGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveUserFromGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Synchronizes the specified MFA device with AWS servers.</p> <p>For more
          * information about creating and working with virtual MFA devices, go to <a
@@ -4180,17 +6742,41 @@ namespace Model
          *
          * returns a future to the operation so that it can be executed in parallel to other requests.
          */
-        virtual Model::ResyncMFADeviceOutcomeCallable ResyncMFADeviceCallable(const Model::ResyncMFADeviceRequest& request) const;
+        virtual Model::ResyncMFADeviceOutcomeCallable ResyncMFADeviceCallable(const Model::ResyncMFADeviceRequest& request) const;
+
+        /**
+         * <p>Synchronizes the specified MFA device with AWS servers.</p> <p>For more
+         * information about creating and working with virtual MFA devices, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_VirtualMFA.html">Using
+         * a Virtual MFA Device</a> in the <i>Using IAM</i> guide. </p>
+         *
+         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         */
+        virtual void ResyncMFADeviceAsync(const Model::ResyncMFADeviceRequest& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
          * <p>Synchronizes the specified MFA device with AWS servers.</p> <p>For more
          * information about creating and working with virtual MFA devices, go to <a
          * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_VirtualMFA.html">Using
          * a Virtual MFA Device</a> in the <i>Using IAM</i> guide. </p>
          *
-         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         * Returns an awaitable that starts the operation the way ResyncMFADeviceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
          */
-        virtual void ResyncMFADeviceAsync(const Model::ResyncMFADeviceRequest& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        template<typename REQUEST = Model::ResyncMFADeviceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResyncMFADeviceOutcome> ResyncMFADeviceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResyncMFADeviceOutcome>([this, request](const std::function<void(Model::ResyncMFADeviceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResyncMFADeviceAsync(request, [complete](const IAMClient*, const Model::ResyncMFADeviceRequest&, const Model::ResyncMFADeviceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResyncMFADeviceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Sets the specified version of the specified policy as the policy's default
@@ -4229,6 +6815,33 @@ namespace Model
          */
         virtual void SetDefaultPolicyVersionAsync(const Model::SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the specified version of the specified policy as the policy's default
+         * (operative) version. </p> <p>This action affects all users, groups, and roles
+         * that the policy is attached to. To list the users, groups, and roles that the
+         * policy is attached to, use the <a>ListEntitiesForPolicy</a> API. </p> <p>For
+         * information about managed policies, refer to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies-managed-vs-inline.html">Managed
+         * Policies and Inline Policies</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way SetDefaultPolicyVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetDefaultPolicyVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetDefaultPolicyVersionOutcome> SetDefaultPolicyVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetDefaultPolicyVersionOutcome>([this, request](const std::function<void(Model::SetDefaultPolicyVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetDefaultPolicyVersionAsync(request, [complete](const IAMClient*, const Model::SetDefaultPolicyVersionRequest&, const Model::SetDefaultPolicyVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetDefaultPolicyVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Simulate how a set of IAM policies and optionally a resource-based policy
          * works with a list of API actions and AWS resources to determine the policies'
@@ -4287,6 +6900,40 @@ namespace Model
          */
         virtual void SimulateCustomPolicyAsync(const Model::SimulateCustomPolicyRequest& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Simulate how a set of IAM policies and optionally a resource-based policy
+         * works with a list of API actions and AWS resources to determine the policies'
+         * effective permissions. The policies are provided as strings.</p> <p>The
+         * simulation does not perform the API actions; it only checks the authorization to
+         * determine if the simulated policies allow or deny the actions.</p> <p>If you
+         * want to simulate existing policies attached to an IAM user, group, or role, use
+         * <a>SimulatePrincipalPolicy</a> instead.</p> <p>Context keys are variables
+         * maintained by AWS and its services that provide details about the context of an
+         * API query request. You can use the <code>Condition</code> element of an IAM
+         * policy to evaluate context keys. To get the list of context keys that the
+         * policies require for correct simulation, use
+         * <a>GetContextKeysForCustomPolicy</a>.</p> <p>If the output is long, you can use
+         * <code>MaxItems</code> and <code>Marker</code> parameters to paginate the
+         * results.</p>
+         *
+         * Returns an awaitable that starts the operation the way SimulateCustomPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SimulateCustomPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::SimulateCustomPolicyOutcome> SimulateCustomPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SimulateCustomPolicyOutcome>([this, request](const std::function<void(Model::SimulateCustomPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SimulateCustomPolicyAsync(request, [complete](const IAMClient*, const Model::SimulateCustomPolicyRequest&, const Model::SimulateCustomPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SimulateCustomPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Simulate how a set of IAM policies attached to an IAM entity works with a
          * list of API actions and AWS resources to determine the policies' effective
@@ -4366,6 +7013,47 @@ namespace Model
          */
         virtual void SimulatePrincipalPolicyAsync(const Model::SimulatePrincipalPolicyRequest& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Simulate how a set of IAM policies attached to an IAM entity works with a
+         * list of API actions and AWS resources to determine the policies' effective
+         * permissions. The entity can be an IAM user, group, or role. If you specify a
+         * user, then the simulation also includes all of the policies that are attached to
+         * groups that the user belongs to .</p> <p>You can optionally include a list of
+         * one or more additional policies specified as strings to include in the
+         * simulation. If you want to simulate only policies specified as strings, use
+         * <a>SimulateCustomPolicy</a> instead.</p> <p>You can also optionally include one
+         * resource-based policy to be evaluated with each of the resources included in the
+         * simulation.</p> <p>The simulation does not perform the API actions, it only
+         * checks the authorization to determine if the simulated policies allow or deny
+         * the actions.</p> <p><b>Note:</b> This API discloses information about the
+         * permissions granted to other users. If you do not want users to see other user's
+         * permissions, then consider allowing them to use <a>SimulateCustomPolicy</a>
+         * instead.</p> <p>Context keys are variables maintained by AWS and its services
+         * that provide details about the context of an API query request. You can use the
+         * <code>Condition</code> element of an IAM policy to evaluate context keys. To get
+         * the list of context keys that the policies require for correct simulation, use
+         * <a>GetContextKeysForPrincipalPolicy</a>.</p> <p>If the output is long, you can
+         * use the <code>MaxItems</code> and <code>Marker</code> parameters to paginate the
+         * results.</p>
+         *
+         * Returns an awaitable that starts the operation the way SimulatePrincipalPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SimulatePrincipalPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::SimulatePrincipalPolicyOutcome> SimulatePrincipalPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SimulatePrincipalPolicyOutcome>([this, request](const std::function<void(Model::SimulatePrincipalPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SimulatePrincipalPolicyAsync(request, [complete](const IAMClient*, const Model::SimulatePrincipalPolicyRequest&, const Model::SimulatePrincipalPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SimulatePrincipalPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes the status of the specified access key from Active to Inactive, or
          * vice versa. This action can be used to disable a user's key as part of a key
@@ -4412,6 +7100,36 @@ namespace Model
          */
         virtual void UpdateAccessKeyAsync(const Model::UpdateAccessKeyRequest& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes the status of the specified access key from Active to Inactive, or
+         * vice versa. This action can be used to disable a user's key as part of a key
+         * rotation work flow. </p> <p>If the <code>UserName</code> field is not specified,
+         * the UserName is determined implicitly based on the AWS access key ID used to
+         * sign the request. Because this action works for access keys under the AWS
+         * account, you can use this action to manage root credentials even if the AWS
+         * account has no associated users. </p> <p>For information about rotating keys,
+         * see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/ManagingCredentials.html">Managing
+         * Keys and Certificates</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAccessKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAccessKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAccessKeyOutcome> UpdateAccessKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAccessKeyOutcome>([this, request](const std::function<void(Model::UpdateAccessKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAccessKeyAsync(request, [complete](const IAMClient*, const Model::UpdateAccessKeyRequest&, const Model::UpdateAccessKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAccessKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the password policy settings for the AWS account.</p> <note> <p>This
          * action does not support partial updates. No parameters are required, but if you
@@ -4449,6 +7167,33 @@ namespace Model
          */
         virtual void UpdateAccountPasswordPolicyAsync(const Model::UpdateAccountPasswordPolicyRequest& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the password policy settings for the AWS account.</p> <note> <p>This
+         * action does not support partial updates. No parameters are required, but if you
+         * do not specify a parameter, that parameter's value reverts to its default value.
+         * See the <b>Request Parameters</b> section for each parameter's default value.
+         * </p> </note> <p> For more information about using a password policy, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_ManagingPasswordPolicies.html">Managing
+         * an IAM Password Policy</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAccountPasswordPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAccountPasswordPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAccountPasswordPolicyOutcome> UpdateAccountPasswordPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAccountPasswordPolicyOutcome>([this, request](const std::function<void(Model::UpdateAccountPasswordPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAccountPasswordPolicyAsync(request, [complete](const IAMClient*, const Model::UpdateAccountPasswordPolicyRequest&, const Model::UpdateAccountPasswordPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAccountPasswordPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Updates the policy that grants an entity permission to assume a role. For
          * more information about roles, go to <a
@@ -4477,6 +7222,30 @@ namespace Model
          */
         virtual void UpdateAssumeRolePolicyAsync(const Model::UpdateAssumeRolePolicyRequest& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Updates the policy that grants an entity permission to assume a role. For
+         * more information about roles, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/roles-toplevel.html">Using
+         * Roles to Delegate Permissions and Federate Identities</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAssumeRolePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAssumeRolePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAssumeRolePolicyOutcome> UpdateAssumeRolePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAssumeRolePolicyOutcome>([this, request](const std::function<void(Model::UpdateAssumeRolePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAssumeRolePolicyAsync(request, [complete](const IAMClient*, const Model::UpdateAssumeRolePolicyRequest&, const Model::UpdateAssumeRolePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAssumeRolePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the name and/or the path of the specified group.</p> <important> You
          * should understand the implications of changing a group's path or name. For more
@@ -4526,6 +7295,37 @@ namespace Model
          */
         virtual void UpdateGroupAsync(const Model::UpdateGroupRequest& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the name and/or the path of the specified group.</p> <important> You
+         * should understand the implications of changing a group's path or name. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_WorkingWithGroupsAndUsers.html">Renaming
+         * Users and Groups</a> in the <i>IAM User Guide</i>. </important> <note>To change
+         * a group name the requester must have appropriate permissions on both the source
+         * object and the target object. For example, to change Managers to MGRs, the
+         * entity making the request must have permission on Managers and MGRs, or must
+         * have permission on all (*). For more information about permissions, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/PermissionsAndPolicies.html"
+         * target="blank">Permissions and Policies</a>. </note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateGroupOutcome> UpdateGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateGroupOutcome>([this, request](const std::function<void(Model::UpdateGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateGroupAsync(request, [complete](const IAMClient*, const Model::UpdateGroupRequest&, const Model::UpdateGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes the password for the specified user.</p> <p>Users can change their
          * own passwords by calling <a>ChangePassword</a>. For more information about
@@ -4557,6 +7357,31 @@ namespace Model
          */
         virtual void UpdateLoginProfileAsync(const Model::UpdateLoginProfileRequest& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes the password for the specified user.</p> <p>Users can change their
+         * own passwords by calling <a>ChangePassword</a>. For more information about
+         * modifying passwords, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/Using_ManagingLogins.html">Managing
+         * Passwords</a> in the <i>IAM User Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateLoginProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateLoginProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateLoginProfileOutcome> UpdateLoginProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateLoginProfileOutcome>([this, request](const std::function<void(Model::UpdateLoginProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateLoginProfileAsync(request, [complete](const IAMClient*, const Model::UpdateLoginProfileRequest&, const Model::UpdateLoginProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateLoginProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Replaces the existing list of server certificate thumbprints with a new list.
          * </p> <p>The list that you pass with this action completely replaces the existing
@@ -4606,6 +7431,37 @@ namespace Model
          */
         virtual void UpdateOpenIDConnectProviderThumbprintAsync(const Model::UpdateOpenIDConnectProviderThumbprintRequest& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Replaces the existing list of server certificate thumbprints with a new list.
+         * </p> <p>The list that you pass with this action completely replaces the existing
+         * list of thumbprints. (The lists are not merged.)</p> <p>Typically, you need to
+         * update a thumbprint only when the identity provider's certificate changes, which
+         * occurs rarely. However, if the provider's certificate <i>does</i> change, any
+         * attempt to assume an IAM role that specifies the OIDC provider as a principal
+         * will fail until the certificate thumbprint is updated.</p> <note>Because trust
+         * for the OpenID Connect provider is ultimately derived from the provider's
+         * certificate and is validated by the thumbprint, it is a best practice to limit
+         * access to the <code>UpdateOpenIDConnectProviderThumbprint</code> action to
+         * highly-privileged users. </note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateOpenIDConnectProviderThumbprintAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateOpenIDConnectProviderThumbprintRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateOpenIDConnectProviderThumbprintOutcome> UpdateOpenIDConnectProviderThumbprintAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateOpenIDConnectProviderThumbprintOutcome>([this, request](const std::function<void(Model::UpdateOpenIDConnectProviderThumbprintOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateOpenIDConnectProviderThumbprintAsync(request, [complete](const IAMClient*, const Model::UpdateOpenIDConnectProviderThumbprintRequest&, const Model::UpdateOpenIDConnectProviderThumbprintOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateOpenIDConnectProviderThumbprintOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the metadata document for an existing SAML provider.</p> <note>This
          * operation requires <a
@@ -4634,6 +7490,30 @@ namespace Model
          */
         virtual void UpdateSAMLProviderAsync(const Model::UpdateSAMLProviderRequest& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the metadata document for an existing SAML provider.</p> <note>This
+         * operation requires <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/signature-version-4.html">Signature
+         * Version 4</a>. </note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateSAMLProviderAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateSAMLProviderRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateSAMLProviderOutcome> UpdateSAMLProviderAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateSAMLProviderOutcome>([this, request](const std::function<void(Model::UpdateSAMLProviderOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateSAMLProviderAsync(request, [complete](const IAMClient*, const Model::UpdateSAMLProviderRequest&, const Model::UpdateSAMLProviderOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateSAMLProviderOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the status of the specified SSH public key to active or inactive. SSH
          * public keys that are inactive cannot be used for authentication. This action can
@@ -4680,6 +7560,36 @@ namespace Model
          */
         virtual void UpdateSSHPublicKeyAsync(const Model::UpdateSSHPublicKeyRequest& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the status of the specified SSH public key to active or inactive. SSH
+         * public keys that are inactive cannot be used for authentication. This action can
+         * be used to disable a user's SSH public key as part of a key rotation work flow.
+         * </p> <p>The SSH public key affected by this action is used only for
+         * authenticating the associated IAM user to an AWS CodeCommit repository. For more
+         * information about using SSH keys to authenticate to an AWS CodeCommit
+         * repository, see <a
+         * href="http://docs.aws.amazon.com/codecommit/latest/userguide/setting-up-credentials-ssh.html">Set
+         * up AWS CodeCommit for SSH Connections</a> in the <i>AWS CodeCommit User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateSSHPublicKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateSSHPublicKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateSSHPublicKeyOutcome> UpdateSSHPublicKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateSSHPublicKeyOutcome>([this, request](const std::function<void(Model::UpdateSSHPublicKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateSSHPublicKeyAsync(request, [complete](const IAMClient*, const Model::UpdateSSHPublicKeyRequest&, const Model::UpdateSSHPublicKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateSSHPublicKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the name and/or the path of the specified server certificate.</p>
          * <p>For more information about working with server certificates, including a list
@@ -4747,6 +7657,43 @@ namespace Model
          */
         virtual void UpdateServerCertificateAsync(const Model::UpdateServerCertificateRequest& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the name and/or the path of the specified server certificate.</p>
+         * <p>For more information about working with server certificates, including a list
+         * of AWS services that can use the server certificates that you manage with IAM,
+         * go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/id_credentials_server-certs.html">Working
+         * with Server Certificates</a> in the <i>IAM User Guide</i>.</p> <important>You
+         * should understand the implications of changing a server certificate's path or
+         * name. For more information, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/id_credentials_server-certs_manage.html#RenamingServerCerts">Renaming
+         * a Server Certificate</a> in the <i>IAM User Guide</i>.</important> <note>To
+         * change a server certificate name the requester must have appropriate permissions
+         * on both the source object and the target object. For example, to change the name
+         * from ProductionCert to ProdCert, the entity making the request must have
+         * permission on ProductionCert and ProdCert, or must have permission on all (*).
+         * For more information about permissions, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/access.html">Access
+         * Management</a> in the <i>IAM User Guide</i>. </note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateServerCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateServerCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateServerCertificateOutcome> UpdateServerCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateServerCertificateOutcome>([this, request](const std::function<void(Model::UpdateServerCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateServerCertificateAsync(request, [complete](const IAMClient*, const Model::UpdateServerCertificateRequest&, const Model::UpdateServerCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateServerCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes the status of the specified signing certificate from active to
          * disabled, or vice versa. This action can be used to disable a user's signing
@@ -4784,6 +7731,33 @@ namespace Model
          */
         virtual void UpdateSigningCertificateAsync(const Model::UpdateSigningCertificateRequest& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes the status of the specified signing certificate from active to
+         * disabled, or vice versa. This action can be used to disable a user's signing
+         * certificate as part of a certificate rotation work flow. </p> <p>If the
+         * <code>UserName</code> field is not specified, the UserName is determined
+         * implicitly based on the AWS access key ID used to sign the request. Because this
+         * action works for access keys under the AWS account, you can use this action to
+         * manage root credentials even if the AWS account has no associated users. </p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateSigningCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateSigningCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateSigningCertificateOutcome> UpdateSigningCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateSigningCertificateOutcome>([this, request](const std::function<void(Model::UpdateSigningCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateSigningCertificateAsync(request, [complete](const IAMClient*, const Model::UpdateSigningCertificateRequest&, const Model::UpdateSigningCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateSigningCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the name and/or the path of the specified user.</p> <important> You
          * should understand the implications of changing a user's path or name. For more
@@ -4839,6 +7813,39 @@ namespace Model
          */
         virtual void UpdateUserAsync(const Model::UpdateUserRequest& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the name and/or the path of the specified user.</p> <important> You
+         * should understand the implications of changing a user's path or name. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/id_users_manage.html#id_users_renaming">Renaming
+         * an IAM User</a> and <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/id_groups_manage_rename.html">Renaming
+         * an IAM Group</a> in the <i>IAM User Guide</i>. </important> <note> To change a
+         * user name the requester must have appropriate permissions on both the source
+         * object and the target object. For example, to change Bob to Robert, the entity
+         * making the request must have permission on Bob and Robert, or must have
+         * permission on all (*). For more information about permissions, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/PermissionsAndPolicies.html"
+         * target="blank">Permissions and Policies</a>. </note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateUserAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateUserRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateUserOutcome> UpdateUserAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateUserOutcome>([this, request](const std::function<void(Model::UpdateUserOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateUserAsync(request, [complete](const IAMClient*, const Model::UpdateUserRequest&, const Model::UpdateUserOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateUserOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Uploads an SSH public key and associates it with the specified IAM user.</p>
          * <p>The SSH public key uploaded by this action can be used only for
@@ -4879,6 +7886,34 @@ namespace Model
          */
         virtual void UploadSSHPublicKeyAsync(const Model::UploadSSHPublicKeyRequest& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Uploads an SSH public key and associates it with the specified IAM user.</p>
+         * <p>The SSH public key uploaded by this action can be used only for
+         * authenticating the associated IAM user to an AWS CodeCommit repository. For more
+         * information about using SSH keys to authenticate to an AWS CodeCommit
+         * repository, see <a
+         * href="http://docs.aws.amazon.com/codecommit/latest/userguide/setting-up-credentials-ssh.html">Set
+         * up AWS CodeCommit for SSH Connections</a> in the <i>AWS CodeCommit User
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UploadSSHPublicKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UploadSSHPublicKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::UploadSSHPublicKeyOutcome> UploadSSHPublicKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UploadSSHPublicKeyOutcome>([this, request](const std::function<void(Model::UploadSSHPublicKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UploadSSHPublicKeyAsync(request, [complete](const IAMClient*, const Model::UploadSSHPublicKeyRequest&, const Model::UploadSSHPublicKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UploadSSHPublicKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Uploads a server certificate entity for the AWS account. The server
          * certificate entity includes a public key certificate, a private key, and an
@@ -4952,6 +7987,45 @@ namespace Model
          */
         virtual void UploadServerCertificateAsync(const Model::UploadServerCertificateRequest& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Uploads a server certificate entity for the AWS account. The server
+         * certificate entity includes a public key certificate, a private key, and an
+         * optional certificate chain, which should all be PEM-encoded. </p> <p>For more
+         * information about working with server certificates, including a list of AWS
+         * services that can use the server certificates that you manage with IAM, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/id_credentials_server-certs.html">Working
+         * with Server Certificates</a> in the <i>IAM User Guide</i>.</p> <p>For
+         * information about the number of server certificates you can upload, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/reference_iam-limits.html">Limitations
+         * on IAM Entities and Objects</a> in the <i>IAM User Guide</i>. </p> <note>Because
+         * the body of the public key certificate, private key, and the certificate chain
+         * can be large, you should use POST rather than GET when calling
+         * <code>UploadServerCertificate</code>. For information about setting up
+         * signatures and authorization through the API, go to <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/signing_aws_api_requests.html">Signing
+         * AWS API Requests</a> in the <i>AWS General Reference</i>. For general
+         * information about using the Query API with IAM, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/programming.html">Calling
+         * the API by Making HTTP Query Requests</a> in the <i>IAM User Guide</i>. </note>
+         *
+         * Returns an awaitable that starts the operation the way UploadServerCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UploadServerCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::UploadServerCertificateOutcome> UploadServerCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UploadServerCertificateOutcome>([this, request](const std::function<void(Model::UploadServerCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UploadServerCertificateAsync(request, [complete](const IAMClient*, const Model::UploadServerCertificateRequest&, const Model::UploadServerCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UploadServerCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Uploads an X.509 signing certificate and associates it with the specified
          * user. Some AWS services use X.509 signing certificates to validate requests that
@@ -5016,6 +8090,42 @@ namespace Model
          */
         virtual void UploadSigningCertificateAsync(const Model::UploadSigningCertificateRequest& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Uploads an X.509 signing certificate and associates it with the specified
+         * user. Some AWS services use X.509 signing certificates to validate requests that
+         * are signed with a corresponding private key. When you upload the certificate,
+         * its default status is <code>Active</code>. </p> <p>If the <code>UserName</code>
+         * field is not specified, the user name is determined implicitly based on the AWS
+         * access key ID used to sign the request. Because this action works for access
+         * keys under the AWS account, you can use this action to manage root credentials
+         * even if the AWS account has no associated users. </p> <note>Because the body of
+         * a X.509 certificate can be large, you should use POST rather than GET when
+         * calling <code>UploadSigningCertificate</code>. For information about setting up
+         * signatures and authorization through the API, go to <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/signing_aws_api_requests.html">Signing
+         * AWS API Requests</a> in the <i>AWS General Reference</i>. For general
+         * information about using the Query API with IAM, go to <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/IAM_UsingQueryAPI.html">Making
+         * Query Requests</a> in the <i>Using IAM</i>guide. </note>
+         *
+         * Returns an awaitable that starts the operation the way UploadSigningCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UploadSigningCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::UploadSigningCertificateOutcome> UploadSigningCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UploadSigningCertificateOutcome>([this, request](const std::function<void(Model::UploadSigningCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UploadSigningCertificateAsync(request, [complete](const IAMClient*, const Model::UploadSigningCertificateRequest&, const Model::UploadSigningCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UploadSigningCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
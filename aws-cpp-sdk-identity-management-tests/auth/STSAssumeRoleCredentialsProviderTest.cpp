@@ -0,0 +1,177 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/identity-management/auth/STSAssumeRoleCredentialsProvider.h>
+#include <aws/sts/STSClient.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+
+#include <thread>
+
+using namespace Aws::Auth;
+using namespace Aws::STS;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+static const char* ALLOCATION_TAG = "STSAssumeRoleCredentialsProviderTest";
+static const char* ROLE_ARN_1 = "arn:aws:iam::123456789012:role/SomeRole1";
+static const char* ROLE_ARN_2 = "arn:aws:iam::123456789012:role/SomeRole2";
+
+namespace
+{
+    class STSAssumeRoleCredentialsProviderTest : public ::testing::Test
+    {
+    protected:
+        std::shared_ptr<STSClient> stsClient;
+        std::shared_ptr<MockHttpClient> mockHttpClient;
+        std::shared_ptr<MockHttpClientFactory> mockHttpClientFactory;
+
+        void SetUp()
+        {
+            ClientConfiguration config;
+            config.scheme = Scheme::HTTP;
+
+            mockHttpClient = Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG);
+            mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(ALLOCATION_TAG);
+            mockHttpClientFactory->SetClient(mockHttpClient);
+            stsClient = Aws::MakeShared<STSClient>(ALLOCATION_TAG, Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "", ""),
+                                                   config, mockHttpClientFactory);
+        }
+
+        void TearDown()
+        {
+            stsClient = nullptr;
+            mockHttpClient = nullptr;
+            mockHttpClientFactory = nullptr;
+        }
+
+        void AddAssumeRoleResponse(const char* accessKey)
+        {
+            std::shared_ptr<HttpRequest> request =
+                    mockHttpClientFactory->CreateHttpRequest("www.uri.com", HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            std::shared_ptr<StandardHttpResponse> response = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, *request);
+            response->SetResponseCode(HttpResponseCode::OK);
+            response->GetResponseBody() << "<AssumeRoleResponse><AssumeRoleResult><Credentials>"
+                << "<AccessKeyId>" << accessKey << "</AccessKeyId>"
+                << "<SecretAccessKey>SomeSecretKey</SecretAccessKey>"
+                << "<SessionToken>SomeSessionToken</SessionToken>"
+                << "<Expiration>2100-01-01T00:00:00Z</Expiration>"
+                << "</Credentials></AssumeRoleResult></AssumeRoleResponse>";
+            mockHttpClient->AddResponseToReturn(response);
+        }
+    };
+
+    TEST_F(STSAssumeRoleCredentialsProviderTest, TestProvidersForTheSameRoleShareCredentials)
+    {
+        AddAssumeRoleResponse("SomeAccessKey1");
+        AddAssumeRoleResponse("SomeAccessKey2");
+
+        STSAssumeRoleCredentialsProvider firstProvider(ROLE_ARN_1, "session", "", 900, 1000 * 60, stsClient);
+        STSAssumeRoleCredentialsProvider secondProvider(ROLE_ARN_1, "session", "", 900, 1000 * 60, stsClient);
+        ASSERT_EQ("SomeAccessKey1", firstProvider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ("SomeAccessKey1", secondProvider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ("SomeSessionToken", secondProvider.GetAWSCredentials().GetSessionToken());
+        ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+
+        STSAssumeRoleCredentialsProvider otherRoleProvider(ROLE_ARN_2, "session", "", 900, 1000 * 60, stsClient);
+        ASSERT_EQ("SomeAccessKey2", otherRoleProvider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+    }
+
+    TEST_F(STSAssumeRoleCredentialsProviderTest, TestProvidersWithDifferentExternalIdsDoNotShareCredentials)
+    {
+        AddAssumeRoleResponse("SomeAccessKey1");
+        AddAssumeRoleResponse("SomeAccessKey2");
+
+        //the external id is what the role's trust policy checks, so one caller's credentials must never be handed to the other.
+        STSAssumeRoleCredentialsProvider firstProvider(ROLE_ARN_1, "session", "externalId1", 900, 1000 * 60, stsClient);
+        STSAssumeRoleCredentialsProvider secondProvider(ROLE_ARN_1, "session", "externalId2", 900, 1000 * 60, stsClient);
+        ASSERT_EQ("SomeAccessKey1", firstProvider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ("SomeAccessKey2", secondProvider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+
+        ASSERT_EQ("SomeAccessKey1", firstProvider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ("SomeAccessKey2", secondProvider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+    }
+
+    TEST_F(STSAssumeRoleCredentialsProviderTest, TestProvidersWithDifferentSTSClientsDoNotShareCredentials)
+    {
+        AddAssumeRoleResponse("SomeAccessKey1");
+        AddAssumeRoleResponse("SomeAccessKey2");
+
+        ClientConfiguration config;
+        config.scheme = Scheme::HTTP;
+        auto otherStsClient = Aws::MakeShared<STSClient>(ALLOCATION_TAG, Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "", ""),
+                                                         config, mockHttpClientFactory);
+
+        STSAssumeRoleCredentialsProvider firstProvider(ROLE_ARN_1, "session", "", 900, 1000 * 60, stsClient);
+        STSAssumeRoleCredentialsProvider secondProvider(ROLE_ARN_1, "session", "", 900, 1000 * 60, otherStsClient);
+        ASSERT_EQ("SomeAccessKey1", firstProvider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ("SomeAccessKey2", secondProvider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+    }
+
+    TEST_F(STSAssumeRoleCredentialsProviderTest, TestConcurrentFirstCallsAssumeTheRoleOnce)
+    {
+        static const int THREADS = 8;
+        AddAssumeRoleResponse("SomeAccessKey1");
+
+        Aws::Vector<std::shared_ptr<STSAssumeRoleCredentialsProvider>> providers;
+        for (int i = 0; i < THREADS; ++i)
+        {
+            providers.push_back(Aws::MakeShared<STSAssumeRoleCredentialsProvider>(ALLOCATION_TAG, ROLE_ARN_1, "session", "", 900, 1000 * 60, stsClient));
+        }
+
+        Aws::Vector<Aws::String> accessKeys(THREADS);
+        Aws::Vector<std::thread> threads;
+        for (int i = 0; i < THREADS; ++i)
+        {
+            threads.emplace_back([&providers, &accessKeys, i]
+            {
+                accessKeys[i] = providers[i]->GetAWSCredentials().GetAWSAccessKeyId();
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const auto& accessKey : accessKeys)
+        {
+            ASSERT_EQ("SomeAccessKey1", accessKey);
+        }
+        ASSERT_EQ(1u, mockHttpClient->GetAllRequestsMade().size());
+    }
+
+    TEST_F(STSAssumeRoleCredentialsProviderTest, TestCredentialsAreReleasedWithTheLastProvider)
+    {
+        AddAssumeRoleResponse("SomeAccessKey1");
+        AddAssumeRoleResponse("SomeAccessKey2");
+
+        {
+            STSAssumeRoleCredentialsProvider provider(ROLE_ARN_1, "session", "", 900, 1000 * 60, stsClient);
+            ASSERT_EQ("SomeAccessKey1", provider.GetAWSCredentials().GetAWSAccessKeyId());
+        }
+
+        STSAssumeRoleCredentialsProvider provider(ROLE_ARN_1, "session", "", 900, 1000 * 60, stsClient);
+        ASSERT_EQ("SomeAccessKey2", provider.GetAWSCredentials().GetAWSAccessKeyId());
+        ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+    }
+}
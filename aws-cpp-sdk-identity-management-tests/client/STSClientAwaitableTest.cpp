@@ -0,0 +1,134 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/sts/STSClient.h>
+
+#ifdef AWS_CORE_COROUTINES
+
+#include <aws/external/gtest.h>
+#include <aws/sts/model/GetSessionTokenRequest.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+
+#include <thread>
+
+using namespace Aws::Auth;
+using namespace Aws::STS;
+using namespace Aws::STS::Model;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils::Threading;
+
+static const char* ALLOCATION_TAG = "STSClientAwaitableTest";
+
+namespace
+{
+    static const char* GET_SESSION_TOKEN_RESPONSE = "<GetSessionTokenResponse><GetSessionTokenResult><Credentials>"
+        "<AccessKeyId>SomeAccessKey</AccessKeyId><SecretAccessKey>SomeSecretKey</SecretAccessKey><SessionToken>SomeSessionToken</SessionToken>"
+        "<Expiration>2100-01-01T00:00:00Z</Expiration></Credentials></GetSessionTokenResult></GetSessionTokenResponse>";
+
+    class STSClientAwaitableTest : public ::testing::Test
+    {
+    protected:
+        std::shared_ptr<STSClient> stsClient;
+        std::shared_ptr<MockHttpClient> mockHttpClient;
+        std::shared_ptr<MockHttpClientFactory> mockHttpClientFactory;
+
+        void SetUp()
+        {
+            ClientConfiguration config;
+            config.scheme = Scheme::HTTP;
+            config.executor = Aws::MakeShared<PooledThreadExecutor>(ALLOCATION_TAG, 1, 4);
+
+            mockHttpClient = Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG);
+            mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(ALLOCATION_TAG);
+            mockHttpClientFactory->SetClient(mockHttpClient);
+            stsClient = Aws::MakeShared<STSClient>(ALLOCATION_TAG, Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "akid", "secret"),
+                                                   config, mockHttpClientFactory);
+        }
+
+        void TearDown()
+        {
+            stsClient = nullptr;
+            mockHttpClient = nullptr;
+            mockHttpClientFactory = nullptr;
+        }
+
+        void AddResponse(HttpResponseCode responseCode, const char* body)
+        {
+            std::shared_ptr<HttpRequest> request =
+                    mockHttpClientFactory->CreateHttpRequest("www.uri.com", HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            std::shared_ptr<StandardHttpResponse> response = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, *request);
+            response->SetResponseCode(responseCode);
+            response->GetResponseBody() << body;
+            mockHttpClient->AddResponseToReturn(response);
+        }
+    };
+
+    Task<GetSessionTokenOutcome> GetSessionToken(const STSClient& client, std::thread::id& resumedOn)
+    {
+        GetSessionTokenOutcome outcome = co_await client.GetSessionTokenAwaitable(GetSessionTokenRequest());
+        resumedOn = std::this_thread::get_id();
+        co_return outcome;
+    }
+
+    TEST_F(STSClientAwaitableTest, TestAwaitableReturnsTheParsedOutcomeOnTheCompletingThread)
+    {
+        AddResponse(HttpResponseCode::OK, GET_SESSION_TOKEN_RESPONSE);
+
+        std::thread::id resumedOn;
+        GetSessionTokenOutcome outcome = SyncWait(GetSessionToken(*stsClient, resumedOn));
+
+        ASSERT_TRUE(outcome.IsSuccess());
+        ASSERT_EQ("SomeAccessKey", outcome.GetResult().GetCredentials().GetAccessKeyId());
+        ASSERT_NE(std::this_thread::get_id(), resumedOn);
+    }
+
+    TEST_F(STSClientAwaitableTest, TestAwaitableReturnsServiceErrors)
+    {
+        AddResponse(HttpResponseCode::FORBIDDEN, "<ErrorResponse><Error><Code>AccessDenied</Code><Message>Not allowed</Message></Error></ErrorResponse>");
+
+        std::thread::id resumedOn;
+        GetSessionTokenOutcome outcome = SyncWait(GetSessionToken(*stsClient, resumedOn));
+
+        ASSERT_FALSE(outcome.IsSuccess());
+        ASSERT_EQ("AccessDenied", outcome.GetError().GetExceptionName());
+    }
+
+    TEST_F(STSClientAwaitableTest, TestAwaitableGoesThroughTheAsyncPath)
+    {
+        ClientConfiguration config;
+        config.scheme = Scheme::HTTP;
+        auto executor = Aws::MakeShared<PooledThreadExecutor>(ALLOCATION_TAG, 1, 1);
+        executor->Shutdown();
+        config.executor = executor;
+        STSClient rejectingClient(Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "akid", "secret"), config, mockHttpClientFactory);
+        AddResponse(HttpResponseCode::OK, GET_SESSION_TOKEN_RESPONSE);
+
+        //the request is started like GetSessionTokenAsync, so a refused executor is reported instead of the call running inline
+        std::thread::id resumedOn;
+        GetSessionTokenOutcome outcome = SyncWait(GetSessionToken(rejectingClient, resumedOn));
+
+        ASSERT_FALSE(outcome.IsSuccess());
+        ASSERT_EQ("ExecutorRejected", outcome.GetError().GetExceptionName());
+        ASSERT_EQ(std::this_thread::get_id(), resumedOn);
+        ASSERT_EQ(0u, mockHttpClient->GetAllRequestsMade().size());
+    }
+}
+
+#endif // AWS_CORE_COROUTINES
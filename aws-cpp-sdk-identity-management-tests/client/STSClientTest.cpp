@@ -0,0 +1,331 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/sts/STSClient.h>
+#include <aws/sts/model/GetSessionTokenRequest.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/RequestInterceptor.h>
+#include <aws/core/http/RequestBodySource.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Auth;
+using namespace Aws::STS;
+using namespace Aws::STS::Model;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Threading;
+
+static const char* ALLOCATION_TAG = "STSClientTest";
+
+namespace
+{
+    class MemoryBodySource : public RequestBodySource
+    {
+    public:
+        MemoryBodySource(const Aws::String& body) : m_body(body), m_position(0) {}
+
+        std::size_t Read(char* buffer, std::size_t length) override
+        {
+            std::size_t toCopy = (std::min)(length, m_body.size() - m_position);
+            memcpy(buffer, m_body.c_str() + m_position, toCopy);
+            m_position += toCopy;
+            return toCopy;
+        }
+
+        int64_t GetRemainingLength() const override { return static_cast<int64_t>(m_body.size() - m_position); }
+
+    private:
+        Aws::String m_body;
+        std::size_t m_position;
+    };
+
+    //a request whose body is sent only from its content body source, with no stream for the signer to read.
+    class SourceOnlyGetSessionTokenRequest : public GetSessionTokenRequest
+    {
+    public:
+        std::shared_ptr<Aws::IOStream> GetBody() const override { return nullptr; }
+    };
+
+    class FixedClockSigner : public AWSAuthV4Signer
+    {
+    public:
+        FixedClockSigner(const Aws::String& timestamp) :
+            AWSAuthV4Signer(Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "akid", "secret"), "sts", "us-east-1"),
+            m_timestamp(timestamp)
+        {
+        }
+
+    protected:
+        Aws::String GetSigningTimestamp() const override { return m_timestamp; }
+
+    private:
+        Aws::String m_timestamp;
+    };
+
+    class OperationRecorder : public RequestInterceptor
+    {
+    public:
+        void OnComplete(const RequestInterceptorContext& context, std::chrono::steady_clock::time_point, bool) override
+        {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            m_operationNames.push_back(context.GetOperationName());
+            m_completed.notify_all();
+        }
+
+        Aws::Vector<Aws::String> WaitForOperations(std::size_t count)
+        {
+            std::unique_lock<std::mutex> locker(m_mutex);
+            m_completed.wait_for(locker, std::chrono::seconds(10), [&]() { return m_operationNames.size() >= count; });
+            return m_operationNames;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_completed;
+        Aws::Vector<Aws::String> m_operationNames;
+    };
+
+    class STSClientTest : public ::testing::Test
+    {
+    protected:
+        std::shared_ptr<STSClient> stsClient;
+        std::shared_ptr<MockHttpClient> mockHttpClient;
+        std::shared_ptr<MockHttpClientFactory> mockHttpClientFactory;
+
+        std::shared_ptr<OperationRecorder> operationRecorder;
+
+        void SetUp()
+        {
+            ClientConfiguration config;
+            config.scheme = Scheme::HTTP;
+            operationRecorder = Aws::MakeShared<OperationRecorder>(ALLOCATION_TAG);
+            config.interceptors.push_back(operationRecorder);
+
+            mockHttpClient = Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG);
+            mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(ALLOCATION_TAG);
+            mockHttpClientFactory->SetClient(mockHttpClient);
+            stsClient = Aws::MakeShared<STSClient>(ALLOCATION_TAG, Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "akid", "secret"),
+                                                   config, mockHttpClientFactory);
+        }
+
+        void TearDown()
+        {
+            stsClient = nullptr;
+            mockHttpClient = nullptr;
+            mockHttpClientFactory = nullptr;
+            operationRecorder = nullptr;
+        }
+
+        void AddResponse(HttpResponseCode responseCode, const char* body)
+        {
+            std::shared_ptr<HttpRequest> request =
+                    mockHttpClientFactory->CreateHttpRequest("www.uri.com", HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            std::shared_ptr<StandardHttpResponse> response = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, *request);
+            response->SetResponseCode(responseCode);
+            response->GetResponseBody() << body;
+            mockHttpClient->AddResponseToReturn(response);
+        }
+
+        static Aws::String ReadAll(RequestBodySource& bodySource)
+        {
+            Aws::String body;
+            char buffer[7];
+            std::size_t read = 0;
+            while ((read = bodySource.Read(buffer, sizeof(buffer))) > 0)
+            {
+                body.append(buffer, read);
+            }
+            return body;
+        }
+    };
+
+    static const char* GET_SESSION_TOKEN_RESPONSE = "<GetSessionTokenResponse><GetSessionTokenResult><Credentials>"
+        "<AccessKeyId>SomeAccessKey</AccessKeyId><SecretAccessKey>SomeSecretKey</SecretAccessKey><SessionToken>SomeSessionToken</SessionToken>"
+        "<Expiration>2100-01-01T00:00:00Z</Expiration></Credentials></GetSessionTokenResult></GetSessionTokenResponse>";
+
+    TEST_F(STSClientTest, TestContentBodySourceIsPassedToTheHttpClient)
+    {
+        AddResponse(HttpResponseCode::OK, GET_SESSION_TOKEN_RESPONSE);
+
+        GetSessionTokenRequest request;
+        Aws::String body = request.SerializePayload();
+        Aws::Vector<std::shared_ptr<RequestBodySource>> createdSources;
+        request.SetContentBodySourceFactory([&body, &createdSources]()
+        {
+            std::shared_ptr<RequestBodySource> bodySource = Aws::MakeShared<MemoryBodySource>(ALLOCATION_TAG, body);
+            createdSources.push_back(bodySource);
+            return bodySource;
+        });
+
+        auto outcome = stsClient->GetSessionToken(request);
+        ASSERT_TRUE(outcome.IsSuccess());
+        ASSERT_EQ("SomeAccessKey", outcome.GetResult().GetCredentials().GetAccessKeyId());
+
+        ASSERT_EQ(1u, createdSources.size());
+        const StandardHttpRequest& sentRequest = mockHttpClient->GetMostRecentHttpRequest();
+        ASSERT_EQ(createdSources[0], sentRequest.GetContentBodySource());
+        ASSERT_EQ(static_cast<int64_t>(body.size()), sentRequest.GetContentBodySource()->GetRemainingLength());
+        ASSERT_EQ(body, ReadAll(*sentRequest.GetContentBodySource()));
+    }
+
+    TEST_F(STSClientTest, TestSourceOnlyBodiesAreSignedOverTheSourceBytes)
+    {
+        AddResponse(HttpResponseCode::OK, GET_SESSION_TOKEN_RESPONSE);
+
+        SourceOnlyGetSessionTokenRequest request;
+        Aws::String body = request.SerializePayload();
+        Aws::Vector<std::shared_ptr<RequestBodySource>> createdSources;
+        request.SetContentBodySourceFactory([&body, &createdSources]()
+        {
+            std::shared_ptr<RequestBodySource> bodySource = Aws::MakeShared<MemoryBodySource>(ALLOCATION_TAG, body);
+            createdSources.push_back(bodySource);
+            return bodySource;
+        });
+
+        ASSERT_TRUE(stsClient->GetSessionToken(request).IsSuccess());
+
+        //the first source is sent and a second one is read for the digest
+        ASSERT_EQ(2u, createdSources.size());
+        const StandardHttpRequest& sentRequest = mockHttpClient->GetMostRecentHttpRequest();
+        ASSERT_EQ(nullptr, sentRequest.GetContentBody());
+        ASSERT_EQ(createdSources[0], sentRequest.GetContentBodySource());
+        ASSERT_EQ(static_cast<int64_t>(body.size()), sentRequest.GetContentBodySource()->GetRemainingLength());
+        ASSERT_EQ(StringUtils::to_string(body.size()), sentRequest.GetContentLength());
+        ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256(body)), sentRequest.GetHeaderValue("x-amz-content-sha256"));
+
+        //signing the same headers over a stream of the same bytes has to produce the same signature
+        StandardHttpRequest streamRequest(sentRequest.GetUri(), HttpMethod::HTTP_POST);
+        for (const auto& header : sentRequest.GetHeaders())
+        {
+            if (header.first != "authorization" && header.first != "x-amz-content-sha256" && header.first != "x-amz-date")
+            {
+                streamRequest.SetHeaderValue(header.first, header.second);
+            }
+        }
+        auto bodyStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        *bodyStream << body;
+        streamRequest.AddContentBody(bodyStream);
+        FixedClockSigner signer(sentRequest.GetHeaderValue("x-amz-date"));
+        ASSERT_TRUE(signer.SignRequest(streamRequest));
+        ASSERT_EQ(streamRequest.GetHeaderValue("x-amz-content-sha256"), sentRequest.GetHeaderValue("x-amz-content-sha256"));
+        ASSERT_EQ(streamRequest.GetHeaderValue("authorization"), sentRequest.GetHeaderValue("authorization"));
+    }
+
+    TEST_F(STSClientTest, TestEachAttemptGetsAFreshContentBodySource)
+    {
+        AddResponse(HttpResponseCode::BAD_REQUEST, "<ErrorResponse><Error><Code>Throttling</Code><Message>Rate exceeded</Message></Error></ErrorResponse>");
+        AddResponse(HttpResponseCode::OK, GET_SESSION_TOKEN_RESPONSE);
+
+        GetSessionTokenRequest request;
+        Aws::String body = request.SerializePayload();
+        Aws::Vector<std::shared_ptr<RequestBodySource>> createdSources;
+        request.SetContentBodySourceFactory([&body, &createdSources]()
+        {
+            std::shared_ptr<RequestBodySource> bodySource = Aws::MakeShared<MemoryBodySource>(ALLOCATION_TAG, body);
+            createdSources.push_back(bodySource);
+            return bodySource;
+        });
+
+        ASSERT_TRUE(stsClient->GetSessionToken(request).IsSuccess());
+        ASSERT_EQ(2u, mockHttpClient->GetAllRequestsMade().size());
+        ASSERT_EQ(2u, createdSources.size());
+        ASSERT_NE(createdSources[0], createdSources[1]);
+        ASSERT_EQ(createdSources[1], mockHttpClient->GetMostRecentHttpRequest().GetContentBodySource());
+    }
+
+    TEST_F(STSClientTest, TestRequestsWithoutAFactoryHaveNoContentBodySource)
+    {
+        AddResponse(HttpResponseCode::OK, GET_SESSION_TOKEN_RESPONSE);
+
+        ASSERT_TRUE(stsClient->GetSessionToken(GetSessionTokenRequest()).IsSuccess());
+        ASSERT_EQ(nullptr, mockHttpClient->GetMostRecentHttpRequest().GetContentBodySource());
+    }
+
+    TEST_F(STSClientTest, TestInterceptorsSeeTheModeledOperationName)
+    {
+        AddResponse(HttpResponseCode::OK, GET_SESSION_TOKEN_RESPONSE);
+        AddResponse(HttpResponseCode::OK, GET_SESSION_TOKEN_RESPONSE);
+
+        ASSERT_TRUE(stsClient->GetSessionToken(GetSessionTokenRequest()).IsSuccess());
+        stsClient->GetSessionTokenAsync(GetSessionTokenRequest(),
+            [](const STSClient*, const GetSessionTokenRequest&, const GetSessionTokenOutcome&, const std::shared_ptr<const AsyncCallerContext>&) {});
+
+        //query requests carry no X-Amz-Target, so without the generated name both would be reported as POST
+        Aws::Vector<Aws::String> operationNames = operationRecorder->WaitForOperations(2);
+        ASSERT_EQ(2u, operationNames.size());
+        ASSERT_EQ("GetSessionToken", operationNames[0]);
+        ASSERT_EQ("GetSessionToken", operationNames[1]);
+    }
+
+    TEST_F(STSClientTest, TestRejectedAsyncCallsReportAnError)
+    {
+        ClientConfiguration config;
+        config.scheme = Scheme::HTTP;
+        auto executor = Aws::MakeShared<PooledThreadExecutor>(ALLOCATION_TAG, 1, 1, OverflowPolicy::REJECT_IMMEDIATELY);
+        config.executor = executor;
+        STSClient rejectingClient(Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "akid", "secret"), config, mockHttpClientFactory);
+
+        //occupy the only thread and the only queue slot so the client's submissions are refused
+        std::atomic<bool> workerHeld(false);
+        std::atomic<bool> releaseWorker(false);
+        ASSERT_TRUE(executor->Submit([&]() { workerHeld = true; while (!releaseWorker) { std::this_thread::yield(); } }));
+        while (!workerHeld)
+        {
+            std::this_thread::yield();
+        }
+        ASSERT_TRUE(executor->Submit([]() {}));
+
+        bool handlerCalled = false;
+        GetSessionTokenOutcome handlerOutcome;
+        rejectingClient.GetSessionTokenAsync(GetSessionTokenRequest(),
+            [&](const STSClient*, const GetSessionTokenRequest&, const GetSessionTokenOutcome& outcome, const std::shared_ptr<const AsyncCallerContext>&)
+            {
+                handlerCalled = true;
+                handlerOutcome = outcome;
+            });
+
+        //a refused call is reported right away on the calling thread instead of being dropped
+        ASSERT_TRUE(handlerCalled);
+        ASSERT_FALSE(handlerOutcome.IsSuccess());
+        ASSERT_EQ("ExecutorRejected", handlerOutcome.GetError().GetExceptionName());
+        ASSERT_TRUE(handlerOutcome.GetError().ShouldRetry());
+
+        GetSessionTokenOutcomeCallable callable = rejectingClient.GetSessionTokenCallable(GetSessionTokenRequest());
+        ASSERT_EQ(std::future_status::ready, callable.wait_for(std::chrono::seconds(0)));
+        GetSessionTokenOutcome callableOutcome = callable.get();
+        ASSERT_FALSE(callableOutcome.IsSuccess());
+        ASSERT_EQ("ExecutorRejected", callableOutcome.GetError().GetExceptionName());
+
+        releaseWorker = true;
+        executor->Shutdown();
+    }
+}
@@ -0,0 +1,68 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/identity-management/IdentityManagment_EXPORTS.h>
+
+#include <memory>
+
+namespace Aws
+{
+    namespace STS
+    {
+        class STSClient;
+    }
+
+    namespace Auth
+    {
+        static const long STS_ASSUME_ROLE_DEFAULT_DURATION_SECONDS = 3600;
+        static const long STS_ASSUME_ROLE_DEFAULT_REFRESH_MARGIN_MS = 1000 * 60 * 5;
+
+        /**
+         * Credentials provider that assumes an IAM role through STS AssumeRole.
+         *
+         * Assumed role credentials are shared process wide: every provider constructed with the same role ARN, session name,
+         * external id, duration, margin and STS client, in any number of service clients, reads the same credentials, and a single
+         * background thread calls AssumeRole again refreshMarginMs before they expire. Concurrent first calls wait for one AssumeRole
+         * call instead of each making their own. Providers that differ in any of those get their own session. The shared credentials
+         * are released when the last provider using them is destroyed.
+         *
+         * If a refresh fails the previous credentials keep being served until they expire, and the refresh is retried shortly.
+         */
+        class AWS_IDENTITY_MANAGEMENT_API STSAssumeRoleCredentialsProvider : public AWSCredentialsProvider
+        {
+        public:
+            /**
+             * roleArn and sessionName are passed to AssumeRole, along with externalId when it is not empty. If stsClient is null, an
+             * STSClient using the default credentials provider chain is created.
+             */
+            STSAssumeRoleCredentialsProvider(const Aws::String& roleArn, const Aws::String& sessionName, const Aws::String& externalId = "",
+                                             long durationSeconds = STS_ASSUME_ROLE_DEFAULT_DURATION_SECONDS,
+                                             long refreshMarginMs = STS_ASSUME_ROLE_DEFAULT_REFRESH_MARGIN_MS,
+                                             const std::shared_ptr<STS::STSClient>& stsClient = nullptr);
+
+            /**
+             * Returns the current credentials for the role, assuming it first if no provider has done so yet. Returns empty
+             * credentials if the role could not be assumed.
+             */
+            AWSCredentials GetAWSCredentials() override;
+
+        private:
+            std::shared_ptr<AWSCredentialsProvider> m_session;
+        };
+    }
+}
@@ -0,0 +1,205 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/identity-management/auth/STSAssumeRoleCredentialsProvider.h>
+#include <aws/sts/STSClient.h>
+#include <aws/sts/model/AssumeRoleRequest.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <mutex>
+
+using namespace Aws::Auth;
+using namespace Aws::STS;
+using namespace Aws::STS::Model;
+using namespace Aws::Utils;
+
+static const char* LOG_TAG = "STSAssumeRoleCredentialsProvider";
+static const char* MEM_TAG = "STSAssumeRoleCredentialsProvider";
+
+//how soon to try again after a failed AssumeRole, and the shortest time credentials are kept before being refreshed.
+static const long MIN_REFRESH_INTERVAL_MS = 1000 * 10;
+static const long MAX_REFRESH_INTERVAL_MS = 1000 * 60 * 60 * 24;
+
+namespace
+{
+    /**
+     * The credentials for one role, shared by every provider that asks for the role with the same parameters.
+     */
+    class AssumedRoleSession : public BackgroundRefreshingAWSCredentialsProvider
+    {
+    public:
+        AssumedRoleSession(const Aws::String& sessionKey, const Aws::String& roleArn, const Aws::String& sessionName, const Aws::String& externalId,
+                           long durationSeconds, long refreshMarginMs, const std::shared_ptr<STSClient>& stsClient);
+
+        ~AssumedRoleSession();
+
+    protected:
+        AWSCredentials LoadCredentials() override;
+        long GetRefreshIntervalMs() const override;
+
+    private:
+        Aws::String m_sessionKey;
+        Aws::String m_roleArn;
+        Aws::String m_sessionName;
+        Aws::String m_externalId;
+        long m_durationSeconds;
+        long m_refreshMarginMs;
+        std::shared_ptr<STSClient> m_stsClient;
+        AWSCredentials m_lastCredentials;
+        double m_expiration;
+    };
+}
+
+typedef Aws::Map<Aws::String, std::weak_ptr<AWSCredentialsProvider>> SessionsByKey;
+
+static std::mutex s_sessionsMutex;
+//created with the first session and deleted with the last, so nothing is left allocated once every provider is gone.
+static SessionsByKey* s_sessions = nullptr;
+
+//everything that changes which credentials AssumeRole hands back, or who asks for them. Sharing a session across any of these would
+//give a provider credentials from a call it never asked for (another external id, or an STS client with other credentials).
+static Aws::String ComputeSessionKey(const Aws::String& roleArn, const Aws::String& sessionName, const Aws::String& externalId,
+                                     long durationSeconds, long refreshMarginMs, const std::shared_ptr<STSClient>& stsClient)
+{
+    Aws::StringStream ss;
+    ss << roleArn.size() << ':' << roleArn << sessionName.size() << ':' << sessionName << externalId.size() << ':' << externalId
+       << durationSeconds << ':' << refreshMarginMs << ':' << static_cast<const void*>(stsClient.get());
+    return ss.str();
+}
+
+AssumedRoleSession::AssumedRoleSession(const Aws::String& sessionKey, const Aws::String& roleArn, const Aws::String& sessionName,
+                                       const Aws::String& externalId, long durationSeconds, long refreshMarginMs,
+                                       const std::shared_ptr<STSClient>& stsClient) :
+    BackgroundRefreshingAWSCredentialsProvider(durationSeconds * 1000),
+    m_sessionKey(sessionKey),
+    m_roleArn(roleArn),
+    m_sessionName(sessionName),
+    m_externalId(externalId),
+    m_durationSeconds(durationSeconds),
+    m_refreshMarginMs(refreshMarginMs),
+    m_stsClient(stsClient != nullptr ? stsClient : Aws::MakeShared<STSClient>(MEM_TAG)),
+    m_lastCredentials("", ""),
+    m_expiration(0.0)
+{
+}
+
+AssumedRoleSession::~AssumedRoleSession()
+{
+    StopRefreshing();
+
+    std::lock_guard<std::mutex> locker(s_sessionsMutex);
+    auto session = s_sessions->find(m_sessionKey);
+    //a new session with the same key may have been registered while this one was going away.
+    if (session != s_sessions->end() && session->second.expired())
+    {
+        s_sessions->erase(session);
+    }
+
+    if (s_sessions->empty())
+    {
+        Aws::Delete(s_sessions);
+        s_sessions = nullptr;
+    }
+}
+
+AWSCredentials AssumedRoleSession::LoadCredentials()
+{
+    AWS_LOGSTREAM_INFO(LOG_TAG, "Assuming role " << m_roleArn);
+
+    AssumeRoleRequest request;
+    request.SetRoleArn(m_roleArn);
+    request.SetRoleSessionName(m_sessionName);
+    request.SetDurationSeconds(m_durationSeconds);
+    if (!m_externalId.empty())
+    {
+        request.SetExternalId(m_externalId);
+    }
+
+    double requestTime = DateTime::ComputeCurrentTimestampInAmazonFormat();
+    auto outcome = m_stsClient->AssumeRole(request);
+    if (outcome.IsSuccess())
+    {
+        const Model::Credentials& credentials = outcome.GetResult().GetCredentials();
+        m_lastCredentials = AWSCredentials(credentials.GetAccessKeyId(), credentials.GetSecretAccessKey(), credentials.GetSessionToken());
+
+        //fall back to the requested duration when the reported expiration can't be used.
+        m_expiration = credentials.GetExpiration();
+        if (m_expiration <= requestTime)
+        {
+            m_expiration = requestTime + m_durationSeconds;
+        }
+
+        AWS_LOGSTREAM_INFO(LOG_TAG, "Assumed role " << m_roleArn << ", credentials expire at " << static_cast<long long>(m_expiration));
+        return m_lastCredentials;
+    }
+
+    AWS_LOGSTREAM_ERROR(LOG_TAG, "Failed to assume role " << m_roleArn << ". Error: " << outcome.GetError().GetExceptionName()
+                                 << "  Message: " << outcome.GetError().GetMessage());
+
+    if (m_expiration > DateTime::ComputeCurrentTimestampInAmazonFormat())
+    {
+        AWS_LOG_WARN(LOG_TAG, "Keeping the previous credentials until they expire.");
+        return m_lastCredentials;
+    }
+
+    m_expiration = 0.0;
+    m_lastCredentials = AWSCredentials("", "");
+    return m_lastCredentials;
+}
+
+long AssumedRoleSession::GetRefreshIntervalMs() const
+{
+    if (m_expiration <= 0.0)
+    {
+        return MIN_REFRESH_INTERVAL_MS;
+    }
+
+    double untilRefreshMs = (m_expiration - DateTime::ComputeCurrentTimestampInAmazonFormat()) * 1000 - m_refreshMarginMs;
+    untilRefreshMs = (std::max)(untilRefreshMs, static_cast<double>(MIN_REFRESH_INTERVAL_MS));
+    untilRefreshMs = (std::min)(untilRefreshMs, static_cast<double>(MAX_REFRESH_INTERVAL_MS));
+    return static_cast<long>(untilRefreshMs);
+}
+
+STSAssumeRoleCredentialsProvider::STSAssumeRoleCredentialsProvider(const Aws::String& roleArn, const Aws::String& sessionName,
+                                                                   const Aws::String& externalId, long durationSeconds, long refreshMarginMs,
+                                                                   const std::shared_ptr<STSClient>& stsClient)
+{
+    std::lock_guard<std::mutex> locker(s_sessionsMutex);
+    if (s_sessions == nullptr)
+    {
+        s_sessions = Aws::New<SessionsByKey>(MEM_TAG);
+    }
+
+    Aws::String sessionKey = ComputeSessionKey(roleArn, sessionName, externalId, durationSeconds, refreshMarginMs, stsClient);
+    std::weak_ptr<AWSCredentialsProvider>& session = (*s_sessions)[sessionKey];
+    m_session = session.lock();
+    if (!m_session)
+    {
+        AWS_LOGSTREAM_DEBUG(LOG_TAG, "Creating shared credentials for role " << roleArn);
+        m_session = Aws::MakeShared<AssumedRoleSession>(MEM_TAG, sessionKey, roleArn, sessionName, externalId, durationSeconds,
+                                                        refreshMarginMs, stsClient);
+        session = m_session;
+    }
+}
+
+AWSCredentials STSAssumeRoleCredentialsProvider::GetAWSCredentials()
+{
+    return m_session->GetAWSCredentials();
+}
@@ -27,6 +27,7 @@
 #include <aws/importexport/model/ListJobsResult.h>
 #include <aws/importexport/model/UpdateJobResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -159,6 +160,28 @@ namespace Model
          */
         virtual void CancelJobAsync(const Model::CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * This operation cancels a specified job. Only the job owner can cancel it. The
+         * operation fails if the job has already started or is complete.
+         *
+         * Returns an awaitable that starts the operation the way CancelJobAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelJobRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelJobOutcome> CancelJobAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelJobOutcome>([this, request](const std::function<void(Model::CancelJobOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelJobAsync(request, [complete](const ImportExportClient*, const Model::CancelJobRequest&, const Model::CancelJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelJobOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * This operation initiates the process of scheduling an upload or download of your
          * data. You include in the request a manifest that describes the data transfer
@@ -190,6 +213,31 @@ namespace Model
          */
         virtual void CreateJobAsync(const Model::CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * This operation initiates the process of scheduling an upload or download of your
+         * data. You include in the request a manifest that describes the data transfer
+         * specifics. The response to the request includes a job ID, which you can use in
+         * other operations, a signature that you use to identify your storage device, and
+         * the address where you should ship your storage device.
+         *
+         * Returns an awaitable that starts the operation the way CreateJobAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateJobRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateJobOutcome> CreateJobAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateJobOutcome>([this, request](const std::function<void(Model::CreateJobOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateJobAsync(request, [complete](const ImportExportClient*, const Model::CreateJobRequest&, const Model::CreateJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateJobOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * This operation returns information about a job, including where the job is in
          * the processing pipeline, the status of the results, and the signature value
@@ -215,6 +263,29 @@ namespace Model
          */
         virtual void GetShippingLabelAsync(const Model::GetShippingLabelRequest& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * This operation returns information about a job, including where the job is in
+         * the processing pipeline, the status of the results, and the signature value
+         * associated with the job. You can only return information about jobs you own.
+         *
+         * Returns an awaitable that starts the operation the way GetShippingLabelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetShippingLabelRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetShippingLabelOutcome> GetShippingLabelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetShippingLabelOutcome>([this, request](const std::function<void(Model::GetShippingLabelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetShippingLabelAsync(request, [complete](const ImportExportClient*, const Model::GetShippingLabelRequest&, const Model::GetShippingLabelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetShippingLabelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * This operation returns information about a job, including where the job is in
          * the processing pipeline, the status of the results, and the signature value
@@ -240,6 +311,29 @@ namespace Model
          */
         virtual void GetStatusAsync(const Model::GetStatusRequest& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * This operation returns information about a job, including where the job is in
+         * the processing pipeline, the status of the results, and the signature value
+         * associated with the job. You can only return information about jobs you own.
+         *
+         * Returns an awaitable that starts the operation the way GetStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetStatusOutcome> GetStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetStatusOutcome>([this, request](const std::function<void(Model::GetStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetStatusAsync(request, [complete](const ImportExportClient*, const Model::GetStatusRequest&, const Model::GetStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * This operation returns the jobs associated with the requester. AWS Import/Export
          * lists the jobs in reverse chronological order based on the date of creation. For
@@ -268,6 +362,30 @@ namespace Model
          */
         virtual void ListJobsAsync(const Model::ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * This operation returns the jobs associated with the requester. AWS Import/Export
+         * lists the jobs in reverse chronological order based on the date of creation. For
+         * example if Job Test1 was created 2009Dec30 and Test2 was created 2010Feb05, the
+         * ListJobs operation would return Test2 followed by Test1.
+         *
+         * Returns an awaitable that starts the operation the way ListJobsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListJobsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListJobsOutcome> ListJobsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListJobsOutcome>([this, request](const std::function<void(Model::ListJobsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListJobsAsync(request, [complete](const ImportExportClient*, const Model::ListJobsRequest&, const Model::ListJobsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListJobsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * You use this operation to change the parameters specified in the original
          * manifest file by supplying a new manifest file. The manifest file attached to
@@ -299,6 +417,31 @@ namespace Model
          */
         virtual void UpdateJobAsync(const Model::UpdateJobRequest& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * You use this operation to change the parameters specified in the original
+         * manifest file by supplying a new manifest file. The manifest file attached to
+         * this request replaces the original manifest file. You can only use the operation
+         * after a CreateJob request but before the data transfer starts and you can only
+         * use it on jobs you own.
+         *
+         * Returns an awaitable that starts the operation the way UpdateJobAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateJobRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateJobOutcome> UpdateJobAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateJobOutcome>([this, request](const std::function<void(Model::UpdateJobOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateJobAsync(request, [complete](const ImportExportClient*, const Model::UpdateJobRequest&, const Model::UpdateJobOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateJobOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
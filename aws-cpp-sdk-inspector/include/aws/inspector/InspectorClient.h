@@ -57,6 +57,7 @@
 #include <aws/inspector/model/UpdateApplicationResult.h>
 #include <aws/inspector/model/UpdateAssessmentResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -307,6 +308,28 @@ namespace Model
          */
         virtual void AddAttributesToFindingsAsync(const Model::AddAttributesToFindingsRequest& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Assigns attributes (key and value pair) to the findings specified by the
+         * findings' ARNs.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddAttributesToFindingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddAttributesToFindingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddAttributesToFindingsOutcome> AddAttributesToFindingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddAttributesToFindingsOutcome>([this, request](const std::function<void(Model::AddAttributesToFindingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddAttributesToFindingsAsync(request, [complete](const InspectorClient*, const Model::AddAttributesToFindingsRequest&, const Model::AddAttributesToFindingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddAttributesToFindingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches the rules package specified by the rules package ARN to the
          * assessment specified by the assessment ARN.</p>
@@ -329,6 +352,28 @@ namespace Model
          */
         virtual void AttachAssessmentAndRulesPackageAsync(const Model::AttachAssessmentAndRulesPackageRequest& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches the rules package specified by the rules package ARN to the
+         * assessment specified by the assessment ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachAssessmentAndRulesPackageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachAssessmentAndRulesPackageRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachAssessmentAndRulesPackageOutcome> AttachAssessmentAndRulesPackageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachAssessmentAndRulesPackageOutcome>([this, request](const std::function<void(Model::AttachAssessmentAndRulesPackageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachAssessmentAndRulesPackageAsync(request, [complete](const InspectorClient*, const Model::AttachAssessmentAndRulesPackageRequest&, const Model::AttachAssessmentAndRulesPackageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachAssessmentAndRulesPackageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new application using the resource group ARN generated by
          * <a>CreateResourceGroup</a>. You can create up to 50 applications per AWS
@@ -363,6 +408,32 @@ namespace Model
          */
         virtual void CreateApplicationAsync(const Model::CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new application using the resource group ARN generated by
+         * <a>CreateResourceGroup</a>. You can create up to 50 applications per AWS
+         * account. You can run up to 500 concurrent agents per AWS account. For more
+         * information, see <a
+         * href="https://docs.aws.amazon.com/inspector/latest/userguide//inspector_applications.html">
+         * Inspector Applications.</a></p>
+         *
+         * Returns an awaitable that starts the operation the way CreateApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateApplicationOutcome> CreateApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateApplicationOutcome>([this, request](const std::function<void(Model::CreateApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateApplicationAsync(request, [complete](const InspectorClient*, const Model::CreateApplicationRequest&, const Model::CreateApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an assessment for the application specified by the application ARN.
          * You can create up to 500 assessments per AWS account.</p>
@@ -385,6 +456,28 @@ namespace Model
          */
         virtual void CreateAssessmentAsync(const Model::CreateAssessmentRequest& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an assessment for the application specified by the application ARN.
+         * You can create up to 500 assessments per AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateAssessmentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAssessmentRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAssessmentOutcome> CreateAssessmentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAssessmentOutcome>([this, request](const std::function<void(Model::CreateAssessmentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAssessmentAsync(request, [complete](const InspectorClient*, const Model::CreateAssessmentRequest&, const Model::CreateAssessmentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAssessmentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a resource group using the specified set of tags (key and value
          * pairs) that are used to select the EC2 instances to be included in an Inspector
@@ -413,6 +506,30 @@ namespace Model
          */
         virtual void CreateResourceGroupAsync(const Model::CreateResourceGroupRequest& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a resource group using the specified set of tags (key and value
+         * pairs) that are used to select the EC2 instances to be included in an Inspector
+         * application. The created resource group is then used to create an Inspector
+         * application.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateResourceGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateResourceGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateResourceGroupOutcome> CreateResourceGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateResourceGroupOutcome>([this, request](const std::function<void(Model::CreateResourceGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateResourceGroupAsync(request, [complete](const InspectorClient*, const Model::CreateResourceGroupRequest&, const Model::CreateResourceGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateResourceGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the application specified by the application ARN.</p>
          */
@@ -432,6 +549,27 @@ namespace Model
          */
         virtual void DeleteApplicationAsync(const Model::DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the application specified by the application ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteApplicationOutcome>([this, request](const std::function<void(Model::DeleteApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteApplicationAsync(request, [complete](const InspectorClient*, const Model::DeleteApplicationRequest&, const Model::DeleteApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the assessment specified by the assessment ARN.</p>
          */
@@ -451,6 +589,27 @@ namespace Model
          */
         virtual void DeleteAssessmentAsync(const Model::DeleteAssessmentRequest& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the assessment specified by the assessment ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAssessmentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAssessmentRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAssessmentOutcome> DeleteAssessmentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAssessmentOutcome>([this, request](const std::function<void(Model::DeleteAssessmentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAssessmentAsync(request, [complete](const InspectorClient*, const Model::DeleteAssessmentRequest&, const Model::DeleteAssessmentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAssessmentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the assessment run specified by the run ARN.</p>
          */
@@ -470,6 +629,27 @@ namespace Model
          */
         virtual void DeleteRunAsync(const Model::DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the assessment run specified by the run ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRunAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRunRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRunOutcome> DeleteRunAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRunOutcome>([this, request](const std::function<void(Model::DeleteRunOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRunAsync(request, [complete](const InspectorClient*, const Model::DeleteRunRequest&, const Model::DeleteRunOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRunOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the application specified by the application ARN.</p>
          */
@@ -489,6 +669,27 @@ namespace Model
          */
         virtual void DescribeApplicationAsync(const Model::DescribeApplicationRequest& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the application specified by the application ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeApplicationOutcome> DescribeApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeApplicationOutcome>([this, request](const std::function<void(Model::DescribeApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeApplicationAsync(request, [complete](const InspectorClient*, const Model::DescribeApplicationRequest&, const Model::DescribeApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the assessment specified by the assessment ARN.</p>
          */
@@ -508,6 +709,27 @@ namespace Model
          */
         virtual void DescribeAssessmentAsync(const Model::DescribeAssessmentRequest& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the assessment specified by the assessment ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAssessmentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAssessmentRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAssessmentOutcome> DescribeAssessmentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAssessmentOutcome>([this, request](const std::function<void(Model::DescribeAssessmentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAssessmentAsync(request, [complete](const InspectorClient*, const Model::DescribeAssessmentRequest&, const Model::DescribeAssessmentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAssessmentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the IAM role that enables Inspector to access your AWS account.</p>
          */
@@ -526,6 +748,26 @@ namespace Model
          * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
         virtual void DescribeCrossAccountAccessRoleAsync(const DescribeCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the IAM role that enables Inspector to access your AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCrossAccountAccessRoleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        Aws::Utils::Threading::Awaitable<Model::DescribeCrossAccountAccessRoleOutcome> DescribeCrossAccountAccessRoleAwaitable() const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCrossAccountAccessRoleOutcome>([this](const std::function<void(Model::DescribeCrossAccountAccessRoleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCrossAccountAccessRoleAsync([complete](const InspectorClient*, const Model::DescribeCrossAccountAccessRoleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCrossAccountAccessRoleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
         /**
          * <p>Describes the finding specified by the finding ARN.</p>
          */
@@ -545,6 +787,27 @@ namespace Model
          */
         virtual void DescribeFindingAsync(const Model::DescribeFindingRequest& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the finding specified by the finding ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeFindingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeFindingRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeFindingOutcome> DescribeFindingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeFindingOutcome>([this, request](const std::function<void(Model::DescribeFindingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeFindingAsync(request, [complete](const InspectorClient*, const Model::DescribeFindingRequest&, const Model::DescribeFindingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeFindingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the resource group specified by the resource group ARN.</p>
          */
@@ -564,6 +827,27 @@ namespace Model
          */
         virtual void DescribeResourceGroupAsync(const Model::DescribeResourceGroupRequest& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the resource group specified by the resource group ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeResourceGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeResourceGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeResourceGroupOutcome> DescribeResourceGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeResourceGroupOutcome>([this, request](const std::function<void(Model::DescribeResourceGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeResourceGroupAsync(request, [complete](const InspectorClient*, const Model::DescribeResourceGroupRequest&, const Model::DescribeResourceGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeResourceGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the rules package specified by the rules package ARN.</p>
          */
@@ -583,6 +867,27 @@ namespace Model
          */
         virtual void DescribeRulesPackageAsync(const Model::DescribeRulesPackageRequest& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the rules package specified by the rules package ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeRulesPackageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeRulesPackageRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeRulesPackageOutcome> DescribeRulesPackageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeRulesPackageOutcome>([this, request](const std::function<void(Model::DescribeRulesPackageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeRulesPackageAsync(request, [complete](const InspectorClient*, const Model::DescribeRulesPackageRequest&, const Model::DescribeRulesPackageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeRulesPackageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the assessment run specified by the run ARN.</p>
          */
@@ -602,6 +907,27 @@ namespace Model
          */
         virtual void DescribeRunAsync(const Model::DescribeRunRequest& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the assessment run specified by the run ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeRunAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeRunRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeRunOutcome> DescribeRunAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeRunOutcome>([this, request](const std::function<void(Model::DescribeRunOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeRunAsync(request, [complete](const InspectorClient*, const Model::DescribeRunRequest&, const Model::DescribeRunOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeRunOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Detaches the rules package specified by the rules package ARN from the
          * assessment specified by the assessment ARN.</p>
@@ -624,6 +950,28 @@ namespace Model
          */
         virtual void DetachAssessmentAndRulesPackageAsync(const Model::DetachAssessmentAndRulesPackageRequest& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Detaches the rules package specified by the rules package ARN from the
+         * assessment specified by the assessment ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachAssessmentAndRulesPackageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachAssessmentAndRulesPackageRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachAssessmentAndRulesPackageOutcome> DetachAssessmentAndRulesPackageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachAssessmentAndRulesPackageOutcome>([this, request](const std::function<void(Model::DetachAssessmentAndRulesPackageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachAssessmentAndRulesPackageAsync(request, [complete](const InspectorClient*, const Model::DetachAssessmentAndRulesPackageRequest&, const Model::DetachAssessmentAndRulesPackageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachAssessmentAndRulesPackageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the metadata about the telemetry (application behavioral data) for
          * the assessment specified by the assessment ARN.</p>
@@ -646,6 +994,28 @@ namespace Model
          */
         virtual void GetAssessmentTelemetryAsync(const Model::GetAssessmentTelemetryRequest& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the metadata about the telemetry (application behavioral data) for
+         * the assessment specified by the assessment ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetAssessmentTelemetryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAssessmentTelemetryRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAssessmentTelemetryOutcome> GetAssessmentTelemetryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAssessmentTelemetryOutcome>([this, request](const std::function<void(Model::GetAssessmentTelemetryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAssessmentTelemetryAsync(request, [complete](const InspectorClient*, const Model::GetAssessmentTelemetryRequest&, const Model::GetAssessmentTelemetryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAssessmentTelemetryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the ARNs of the applications within this AWS account. For more
          * information about applications, see <a
@@ -674,6 +1044,30 @@ namespace Model
          */
         virtual void ListApplicationsAsync(const Model::ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the ARNs of the applications within this AWS account. For more
+         * information about applications, see <a
+         * href="https://docs.aws.amazon.com/inspector/latest/userguide//inspector_applications.html">Inspector
+         * Applications</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListApplicationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListApplicationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListApplicationsOutcome> ListApplicationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListApplicationsOutcome>([this, request](const std::function<void(Model::ListApplicationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListApplicationsAsync(request, [complete](const InspectorClient*, const Model::ListApplicationsRequest&, const Model::ListApplicationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListApplicationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the agents of the assessment specified by the assessment ARN.</p>
          */
@@ -693,6 +1087,27 @@ namespace Model
          */
         virtual void ListAssessmentAgentsAsync(const Model::ListAssessmentAgentsRequest& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the agents of the assessment specified by the assessment ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListAssessmentAgentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAssessmentAgentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAssessmentAgentsOutcome> ListAssessmentAgentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAssessmentAgentsOutcome>([this, request](const std::function<void(Model::ListAssessmentAgentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAssessmentAgentsAsync(request, [complete](const InspectorClient*, const Model::ListAssessmentAgentsRequest&, const Model::ListAssessmentAgentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAssessmentAgentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the assessments corresponding to applications specified by the
          * applications' ARNs.</p>
@@ -715,6 +1130,28 @@ namespace Model
          */
         virtual void ListAssessmentsAsync(const Model::ListAssessmentsRequest& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the assessments corresponding to applications specified by the
+         * applications' ARNs.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListAssessmentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAssessmentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAssessmentsOutcome> ListAssessmentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAssessmentsOutcome>([this, request](const std::function<void(Model::ListAssessmentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAssessmentsAsync(request, [complete](const InspectorClient*, const Model::ListAssessmentsRequest&, const Model::ListAssessmentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAssessmentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the assessments attached to the rules package specified by the rules
          * package ARN.</p>
@@ -737,6 +1174,28 @@ namespace Model
          */
         virtual void ListAttachedAssessmentsAsync(const Model::ListAttachedAssessmentsRequest& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the assessments attached to the rules package specified by the rules
+         * package ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListAttachedAssessmentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAttachedAssessmentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAttachedAssessmentsOutcome> ListAttachedAssessmentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAttachedAssessmentsOutcome>([this, request](const std::function<void(Model::ListAttachedAssessmentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAttachedAssessmentsAsync(request, [complete](const InspectorClient*, const Model::ListAttachedAssessmentsRequest&, const Model::ListAttachedAssessmentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAttachedAssessmentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the rules packages attached to the assessment specified by the
          * assessment ARN.</p>
@@ -759,6 +1218,28 @@ namespace Model
          */
         virtual void ListAttachedRulesPackagesAsync(const Model::ListAttachedRulesPackagesRequest& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the rules packages attached to the assessment specified by the
+         * assessment ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListAttachedRulesPackagesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAttachedRulesPackagesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAttachedRulesPackagesOutcome> ListAttachedRulesPackagesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAttachedRulesPackagesOutcome>([this, request](const std::function<void(Model::ListAttachedRulesPackagesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAttachedRulesPackagesAsync(request, [complete](const InspectorClient*, const Model::ListAttachedRulesPackagesRequest&, const Model::ListAttachedRulesPackagesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAttachedRulesPackagesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists findings generated by the assessment run specified by the run ARNs.</p>
          */
@@ -778,6 +1259,27 @@ namespace Model
          */
         virtual void ListFindingsAsync(const Model::ListFindingsRequest& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists findings generated by the assessment run specified by the run ARNs.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListFindingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListFindingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListFindingsOutcome> ListFindingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListFindingsOutcome>([this, request](const std::function<void(Model::ListFindingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListFindingsAsync(request, [complete](const InspectorClient*, const Model::ListFindingsRequest&, const Model::ListFindingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListFindingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all available Inspector rules packages.</p>
          */
@@ -797,6 +1299,27 @@ namespace Model
          */
         virtual void ListRulesPackagesAsync(const Model::ListRulesPackagesRequest& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all available Inspector rules packages.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListRulesPackagesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRulesPackagesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRulesPackagesOutcome> ListRulesPackagesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRulesPackagesOutcome>([this, request](const std::function<void(Model::ListRulesPackagesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRulesPackagesAsync(request, [complete](const InspectorClient*, const Model::ListRulesPackagesRequest&, const Model::ListRulesPackagesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRulesPackagesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the assessment runs associated with the assessments specified by the
          * assessment ARNs.</p>
@@ -819,6 +1342,28 @@ namespace Model
          */
         virtual void ListRunsAsync(const Model::ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the assessment runs associated with the assessments specified by the
+         * assessment ARNs.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListRunsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRunsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRunsOutcome> ListRunsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRunsOutcome>([this, request](const std::function<void(Model::ListRunsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRunsAsync(request, [complete](const InspectorClient*, const Model::ListRunsRequest&, const Model::ListRunsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRunsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all tags associated with a resource.</p>
          */
@@ -838,6 +1383,27 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all tags associated with a resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTagsForResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsForResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome>([this, request](const std::function<void(Model::ListTagsForResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsForResourceAsync(request, [complete](const InspectorClient*, const Model::ListTagsForResourceRequest&, const Model::ListTagsForResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsForResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Translates a textual identifier into a user-readable text in a specified
          * locale.</p>
@@ -860,6 +1426,28 @@ namespace Model
          */
         virtual void LocalizeTextAsync(const Model::LocalizeTextRequest& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Translates a textual identifier into a user-readable text in a specified
+         * locale.</p>
+         *
+         * Returns an awaitable that starts the operation the way LocalizeTextAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::LocalizeTextRequest>
+        Aws::Utils::Threading::Awaitable<Model::LocalizeTextOutcome> LocalizeTextAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::LocalizeTextOutcome>([this, request](const std::function<void(Model::LocalizeTextOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->LocalizeTextAsync(request, [complete](const InspectorClient*, const Model::LocalizeTextRequest&, const Model::LocalizeTextOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::LocalizeTextOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Previews the agents installed on the EC2 instances that are included in the
          * application created with the specified resource group.</p>
@@ -882,6 +1470,28 @@ namespace Model
          */
         virtual void PreviewAgentsForResourceGroupAsync(const Model::PreviewAgentsForResourceGroupRequest& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Previews the agents installed on the EC2 instances that are included in the
+         * application created with the specified resource group.</p>
+         *
+         * Returns an awaitable that starts the operation the way PreviewAgentsForResourceGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PreviewAgentsForResourceGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::PreviewAgentsForResourceGroupOutcome> PreviewAgentsForResourceGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PreviewAgentsForResourceGroupOutcome>([this, request](const std::function<void(Model::PreviewAgentsForResourceGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PreviewAgentsForResourceGroupAsync(request, [complete](const InspectorClient*, const Model::PreviewAgentsForResourceGroupRequest&, const Model::PreviewAgentsForResourceGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PreviewAgentsForResourceGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Register the role that Inspector uses to list your EC2 instances during the
          * assessment.</p>
@@ -904,6 +1514,28 @@ namespace Model
          */
         virtual void RegisterCrossAccountAccessRoleAsync(const Model::RegisterCrossAccountAccessRoleRequest& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Register the role that Inspector uses to list your EC2 instances during the
+         * assessment.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterCrossAccountAccessRoleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterCrossAccountAccessRoleRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterCrossAccountAccessRoleOutcome> RegisterCrossAccountAccessRoleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterCrossAccountAccessRoleOutcome>([this, request](const std::function<void(Model::RegisterCrossAccountAccessRoleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterCrossAccountAccessRoleAsync(request, [complete](const InspectorClient*, const Model::RegisterCrossAccountAccessRoleRequest&, const Model::RegisterCrossAccountAccessRoleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterCrossAccountAccessRoleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the entire attribute (key and value pair) from the findings specified
          * by the finding ARNs where an attribute with the specified key exists.</p>
@@ -926,6 +1558,28 @@ namespace Model
          */
         virtual void RemoveAttributesFromFindingsAsync(const Model::RemoveAttributesFromFindingsRequest& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the entire attribute (key and value pair) from the findings specified
+         * by the finding ARNs where an attribute with the specified key exists.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveAttributesFromFindingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveAttributesFromFindingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveAttributesFromFindingsOutcome> RemoveAttributesFromFindingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveAttributesFromFindingsOutcome>([this, request](const std::function<void(Model::RemoveAttributesFromFindingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveAttributesFromFindingsAsync(request, [complete](const InspectorClient*, const Model::RemoveAttributesFromFindingsRequest&, const Model::RemoveAttributesFromFindingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveAttributesFromFindingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts the analysis of the application’s behavior against selected rule
          * packages for the assessment specified by the assessment ARN.</p>
@@ -948,6 +1602,28 @@ namespace Model
          */
         virtual void RunAssessmentAsync(const Model::RunAssessmentRequest& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts the analysis of the application’s behavior against selected rule
+         * packages for the assessment specified by the assessment ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way RunAssessmentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RunAssessmentRequest>
+        Aws::Utils::Threading::Awaitable<Model::RunAssessmentOutcome> RunAssessmentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RunAssessmentOutcome>([this, request](const std::function<void(Model::RunAssessmentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RunAssessmentAsync(request, [complete](const InspectorClient*, const Model::RunAssessmentRequest&, const Model::RunAssessmentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RunAssessmentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets tags (key and value pairs) to the assessment specified by the assessment
          * ARN.</p>
@@ -970,6 +1646,28 @@ namespace Model
          */
         virtual void SetTagsForResourceAsync(const Model::SetTagsForResourceRequest& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets tags (key and value pairs) to the assessment specified by the assessment
+         * ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetTagsForResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetTagsForResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetTagsForResourceOutcome> SetTagsForResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetTagsForResourceOutcome>([this, request](const std::function<void(Model::SetTagsForResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetTagsForResourceAsync(request, [complete](const InspectorClient*, const Model::SetTagsForResourceRequest&, const Model::SetTagsForResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetTagsForResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts data collection for the assessment specified by the assessment ARN.
          * For this API to function properly, you must not exceed the limit of running up
@@ -995,6 +1693,29 @@ namespace Model
          */
         virtual void StartDataCollectionAsync(const Model::StartDataCollectionRequest& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts data collection for the assessment specified by the assessment ARN.
+         * For this API to function properly, you must not exceed the limit of running up
+         * to 500 concurrent agents per AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way StartDataCollectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartDataCollectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartDataCollectionOutcome> StartDataCollectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartDataCollectionOutcome>([this, request](const std::function<void(Model::StartDataCollectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartDataCollectionAsync(request, [complete](const InspectorClient*, const Model::StartDataCollectionRequest&, const Model::StartDataCollectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartDataCollectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Stop data collection for the assessment specified by the assessment ARN.</p>
          */
@@ -1014,6 +1735,27 @@ namespace Model
          */
         virtual void StopDataCollectionAsync(const Model::StopDataCollectionRequest& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Stop data collection for the assessment specified by the assessment ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way StopDataCollectionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StopDataCollectionRequest>
+        Aws::Utils::Threading::Awaitable<Model::StopDataCollectionOutcome> StopDataCollectionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StopDataCollectionOutcome>([this, request](const std::function<void(Model::StopDataCollectionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StopDataCollectionAsync(request, [complete](const InspectorClient*, const Model::StopDataCollectionRequest&, const Model::StopDataCollectionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StopDataCollectionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates application specified by the application ARN.</p>
          */
@@ -1033,6 +1775,27 @@ namespace Model
          */
         virtual void UpdateApplicationAsync(const Model::UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates application specified by the application ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateApplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateApplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateApplicationOutcome>([this, request](const std::function<void(Model::UpdateApplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateApplicationAsync(request, [complete](const InspectorClient*, const Model::UpdateApplicationRequest&, const Model::UpdateApplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateApplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the assessment specified by the assessment ARN.</p>
          */
@@ -1052,6 +1815,27 @@ namespace Model
          */
         virtual void UpdateAssessmentAsync(const Model::UpdateAssessmentRequest& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the assessment specified by the assessment ARN.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAssessmentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAssessmentRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAssessmentOutcome> UpdateAssessmentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAssessmentOutcome>([this, request](const std::function<void(Model::UpdateAssessmentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAssessmentAsync(request, [complete](const InspectorClient*, const Model::UpdateAssessmentRequest&, const Model::UpdateAssessmentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAssessmentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
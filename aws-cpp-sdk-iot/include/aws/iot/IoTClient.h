@@ -47,6 +47,7 @@
 #include <aws/iot/model/UpdateThingResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -326,6 +327,29 @@ namespace Model
          */
         virtual void AcceptCertificateTransferAsync(const Model::AcceptCertificateTransferRequest& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Accepts a pending certificate transfer. The default state of the certificate
+         * is INACTIVE.</p> <p>To check for pending certificate transfers, call
+         * <a>ListCertificates</a> to enumerate your certificates.</p>
+         *
+         * Returns an awaitable that starts the operation the way AcceptCertificateTransferAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AcceptCertificateTransferRequest>
+        Aws::Utils::Threading::Awaitable<Model::AcceptCertificateTransferOutcome> AcceptCertificateTransferAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AcceptCertificateTransferOutcome>([this, request](const std::function<void(Model::AcceptCertificateTransferOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AcceptCertificateTransferAsync(request, [complete](const IoTClient*, const Model::AcceptCertificateTransferRequest&, const Model::AcceptCertificateTransferOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AcceptCertificateTransferOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches the specified policy to the specified principal (certificate or
          * other credential).</p>
@@ -348,6 +372,28 @@ namespace Model
          */
         virtual void AttachPrincipalPolicyAsync(const Model::AttachPrincipalPolicyRequest& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches the specified policy to the specified principal (certificate or
+         * other credential).</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachPrincipalPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachPrincipalPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachPrincipalPolicyOutcome> AttachPrincipalPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachPrincipalPolicyOutcome>([this, request](const std::function<void(Model::AttachPrincipalPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachPrincipalPolicyAsync(request, [complete](const IoTClient*, const Model::AttachPrincipalPolicyRequest&, const Model::AttachPrincipalPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachPrincipalPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches the specified principal to the specified thing.</p>
          */
@@ -367,6 +413,27 @@ namespace Model
          */
         virtual void AttachThingPrincipalAsync(const Model::AttachThingPrincipalRequest& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches the specified principal to the specified thing.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachThingPrincipalAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachThingPrincipalRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachThingPrincipalOutcome> AttachThingPrincipalAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachThingPrincipalOutcome>([this, request](const std::function<void(Model::AttachThingPrincipalOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachThingPrincipalAsync(request, [complete](const IoTClient*, const Model::AttachThingPrincipalRequest&, const Model::AttachThingPrincipalOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachThingPrincipalOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Cancels a pending transfer for the specified certificate.</p> <p><b>Note</b>
          * Only the transfer source account can use this operation to cancel a transfer.
@@ -404,6 +471,33 @@ namespace Model
          */
         virtual void CancelCertificateTransferAsync(const Model::CancelCertificateTransferRequest& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels a pending transfer for the specified certificate.</p> <p><b>Note</b>
+         * Only the transfer source account can use this operation to cancel a transfer.
+         * (Transfer destinations can use <a>RejectCertificateTransfer</a> instead.) After
+         * transfer, AWS IoT returns the certificate to the source account in the INACTIVE
+         * state. After the destination account has accepted the transfer, the transfer
+         * cannot be cancelled.</p> <p>After a certificate transfer is cancelled, the
+         * status of the certificate changes from PENDING_TRANSFER to INACTIVE.</p>
+         *
+         * Returns an awaitable that starts the operation the way CancelCertificateTransferAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelCertificateTransferRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelCertificateTransferOutcome> CancelCertificateTransferAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelCertificateTransferOutcome>([this, request](const std::function<void(Model::CancelCertificateTransferOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelCertificateTransferAsync(request, [complete](const IoTClient*, const Model::CancelCertificateTransferRequest&, const Model::CancelCertificateTransferOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelCertificateTransferOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an X.509 certificate using the specified certificate signing
          * request.</p> <p><b>Note</b> Reusing the same certificate signing request (CSR)
@@ -489,6 +583,49 @@ namespace Model
          */
         virtual void CreateCertificateFromCsrAsync(const Model::CreateCertificateFromCsrRequest& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an X.509 certificate using the specified certificate signing
+         * request.</p> <p><b>Note</b> Reusing the same certificate signing request (CSR)
+         * results in a distinct certificate.</p> <p>You can create multiple certificates
+         * in a batch by creating a directory, copying multiple .csr files into that
+         * directory, and then specifying that directory on the command line. The following
+         * commands show how to create a batch of certificates given a batch of CSRs. </p>
+         * <p>Assuming a set of CSRs are located inside of the directory
+         * my-csr-directory:</p>&gt; <p>On Linux and OS X, the command is:</p> <p>$ ls
+         * my-csr-directory/ | xargs -I {} aws iot create-certificate-from-csr
+         * --certificate-signing-request file://my-csr-directory/{}</p> <p> This command
+         * lists all of the CSRs in my-csr-directory and pipes each CSR file name to the
+         * aws iot create-certificate-from-csr AWS CLI command to create a certificate for
+         * the corresponding CSR. </p> <p> The aws iot create-certificate-from-csr part of
+         * the command can also be run in parallel to speed up the certificate creation
+         * process: </p> <p> $ ls my-csr-directory/ | xargs -P 10 -I {} aws iot
+         * create-certificate-from-csr --certificate-signing-request
+         * file://my-csr-directory/{} </p> <p> On Windows PowerShell, the command to create
+         * certificates for all CSRs in my-csr-directory is: </p> <p> &gt; ls -Name
+         * my-csr-directory | %{aws iot create-certificate-from-csr
+         * --certificate-signing-request file://my-csr-directory/$_} </p> <p> On a Windows
+         * command prompt, the command to create certificates for all CSRs in
+         * my-csr-directory is: </p> <p> &gt; forfiles /p my-csr-directory /c "cmd /c aws
+         * iot create-certificate-from-csr --certificate-signing-request file://@path"</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateCertificateFromCsrAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateCertificateFromCsrRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateCertificateFromCsrOutcome> CreateCertificateFromCsrAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateCertificateFromCsrOutcome>([this, request](const std::function<void(Model::CreateCertificateFromCsrOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateCertificateFromCsrAsync(request, [complete](const IoTClient*, const Model::CreateCertificateFromCsrRequest&, const Model::CreateCertificateFromCsrOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateCertificateFromCsrOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a 2048-bit RSA key pair and issues an X.509 certificate using the
          * issued public key.</p> <p><b>Note</b> This is the only time AWS IoT issues the
@@ -517,6 +654,30 @@ namespace Model
          */
         virtual void CreateKeysAndCertificateAsync(const Model::CreateKeysAndCertificateRequest& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a 2048-bit RSA key pair and issues an X.509 certificate using the
+         * issued public key.</p> <p><b>Note</b> This is the only time AWS IoT issues the
+         * private key for this certificate, so it is important to keep it in a secure
+         * location.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateKeysAndCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateKeysAndCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateKeysAndCertificateOutcome> CreateKeysAndCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateKeysAndCertificateOutcome>([this, request](const std::function<void(Model::CreateKeysAndCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateKeysAndCertificateAsync(request, [complete](const IoTClient*, const Model::CreateKeysAndCertificateRequest&, const Model::CreateKeysAndCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateKeysAndCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an AWS IoT policy.</p> <p>The created policy is the default version
          * for the policy. This operation creates a policy version with a version
@@ -542,6 +703,29 @@ namespace Model
          */
         virtual void CreatePolicyAsync(const Model::CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an AWS IoT policy.</p> <p>The created policy is the default version
+         * for the policy. This operation creates a policy version with a version
+         * identifier of <b>1</b> and sets <b>1</b> as the policy's default version.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePolicyOutcome> CreatePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePolicyOutcome>([this, request](const std::function<void(Model::CreatePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePolicyAsync(request, [complete](const IoTClient*, const Model::CreatePolicyRequest&, const Model::CreatePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new version of the specified AWS IoT policy. To update a policy,
          * create a new policy version. A managed policy can have up to five versions. If
@@ -579,6 +763,33 @@ namespace Model
          */
         virtual void CreatePolicyVersionAsync(const Model::CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new version of the specified AWS IoT policy. To update a policy,
+         * create a new policy version. A managed policy can have up to five versions. If
+         * the policy has five versions, you must use <a>DeletePolicyVersion</a> to delete
+         * an existing version before you create a new one.</p> <p>Optionally, you can set
+         * the new version as the policy's default version. The default version is the
+         * operative version (that is, the version that is in effect for the certificates
+         * to which the policy is attached).</p>
+         *
+         * Returns an awaitable that starts the operation the way CreatePolicyVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreatePolicyVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreatePolicyVersionOutcome> CreatePolicyVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreatePolicyVersionOutcome>([this, request](const std::function<void(Model::CreatePolicyVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreatePolicyVersionAsync(request, [complete](const IoTClient*, const Model::CreatePolicyVersionRequest&, const Model::CreatePolicyVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreatePolicyVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a thing in the Thing Registry.</p>
          */
@@ -598,6 +809,27 @@ namespace Model
          */
         virtual void CreateThingAsync(const Model::CreateThingRequest& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a thing in the Thing Registry.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateThingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateThingRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateThingOutcome> CreateThingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateThingOutcome>([this, request](const std::function<void(Model::CreateThingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateThingAsync(request, [complete](const IoTClient*, const Model::CreateThingRequest&, const Model::CreateThingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateThingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a rule. Creating rules is an administrator-level action. Any user who
          * has permission to create rules will be able to access data processed by the
@@ -623,6 +855,29 @@ namespace Model
          */
         virtual void CreateTopicRuleAsync(const Model::CreateTopicRuleRequest& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a rule. Creating rules is an administrator-level action. Any user who
+         * has permission to create rules will be able to access data processed by the
+         * rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateTopicRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTopicRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTopicRuleOutcome> CreateTopicRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTopicRuleOutcome>([this, request](const std::function<void(Model::CreateTopicRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTopicRuleAsync(request, [complete](const IoTClient*, const Model::CreateTopicRuleRequest&, const Model::CreateTopicRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTopicRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified certificate.</p> <p>A certificate cannot be deleted if
          * it has a policy attached to it or if its status is set to ACTIVE. To delete a
@@ -654,6 +909,31 @@ namespace Model
          */
         virtual void DeleteCertificateAsync(const Model::DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified certificate.</p> <p>A certificate cannot be deleted if
+         * it has a policy attached to it or if its status is set to ACTIVE. To delete a
+         * certificate, first use the <a>DetachPrincipalPolicy</a> API to detach all
+         * policies. Next, use the <a>UpdateCertificate</a> API to set the certificate to
+         * the INACTIVE status.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteCertificateOutcome> DeleteCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteCertificateOutcome>([this, request](const std::function<void(Model::DeleteCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteCertificateAsync(request, [complete](const IoTClient*, const Model::DeleteCertificateRequest&, const Model::DeleteCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified policy.</p> <p>A policy cannot be deleted if it has
          * non-default versions or it is attached to any certificate.</p> <p>To delete a
@@ -691,6 +971,33 @@ namespace Model
          */
         virtual void DeletePolicyAsync(const Model::DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified policy.</p> <p>A policy cannot be deleted if it has
+         * non-default versions or it is attached to any certificate.</p> <p>To delete a
+         * policy, use the DeletePolicyVersion API to delete all non-default versions of
+         * the policy; use the DetachPrincipalPolicy API to detach the policy from any
+         * certificate; and then use the DeletePolicy API to delete the policy.</p> <p>When
+         * a policy is deleted using DeletePolicy, its default version is deleted with
+         * it.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeletePolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeletePolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeletePolicyOutcome> DeletePolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeletePolicyOutcome>([this, request](const std::function<void(Model::DeletePolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeletePolicyAsync(request, [complete](const IoTClient*, const Model::DeletePolicyRequest&, const Model::DeletePolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeletePolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified version of the specified policy. You cannot delete the
          * default version of a policy using this API. To delete the default version of a
@@ -719,6 +1026,30 @@ namespace Model
          */
         virtual void DeletePolicyVersionAsync(const Model::DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified version of the specified policy. You cannot delete the
+         * default version of a policy using this API. To delete the default version of a
+         * policy, use <a>DeletePolicy</a>. To find out which version of a policy is marked
+         * as the default version, use ListPolicyVersions.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeletePolicyVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeletePolicyVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeletePolicyVersionOutcome> DeletePolicyVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeletePolicyVersionOutcome>([this, request](const std::function<void(Model::DeletePolicyVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeletePolicyVersionAsync(request, [complete](const IoTClient*, const Model::DeletePolicyVersionRequest&, const Model::DeletePolicyVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeletePolicyVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified thing from the Thing Registry.</p>
          */
@@ -738,6 +1069,27 @@ namespace Model
          */
         virtual void DeleteThingAsync(const Model::DeleteThingRequest& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified thing from the Thing Registry.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteThingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteThingRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteThingOutcome> DeleteThingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteThingOutcome>([this, request](const std::function<void(Model::DeleteThingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteThingAsync(request, [complete](const IoTClient*, const Model::DeleteThingRequest&, const Model::DeleteThingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteThingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified rule.</p>
          */
@@ -757,6 +1109,27 @@ namespace Model
          */
         virtual void DeleteTopicRuleAsync(const Model::DeleteTopicRuleRequest& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTopicRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTopicRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTopicRuleOutcome> DeleteTopicRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTopicRuleOutcome>([this, request](const std::function<void(Model::DeleteTopicRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTopicRuleAsync(request, [complete](const IoTClient*, const Model::DeleteTopicRuleRequest&, const Model::DeleteTopicRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTopicRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the specified certificate.</p>
          */
@@ -776,6 +1149,27 @@ namespace Model
          */
         virtual void DescribeCertificateAsync(const Model::DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the specified certificate.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCertificateOutcome> DescribeCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCertificateOutcome>([this, request](const std::function<void(Model::DescribeCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCertificateAsync(request, [complete](const IoTClient*, const Model::DescribeCertificateRequest&, const Model::DescribeCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a unique endpoint specific to the AWS account making the call. You
          * specify the following URI when updating state information for your thing:
@@ -801,6 +1195,29 @@ namespace Model
          */
         virtual void DescribeEndpointAsync(const Model::DescribeEndpointRequest& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a unique endpoint specific to the AWS account making the call. You
+         * specify the following URI when updating state information for your thing:
+         * https://<i>endpoint</i>/things/<i>thingName</i>/shadow.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEndpointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEndpointRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEndpointOutcome> DescribeEndpointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEndpointOutcome>([this, request](const std::function<void(Model::DescribeEndpointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEndpointAsync(request, [complete](const IoTClient*, const Model::DescribeEndpointRequest&, const Model::DescribeEndpointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEndpointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the specified thing.</p>
          */
@@ -820,6 +1237,27 @@ namespace Model
          */
         virtual void DescribeThingAsync(const Model::DescribeThingRequest& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the specified thing.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeThingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeThingRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeThingOutcome> DescribeThingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeThingOutcome>([this, request](const std::function<void(Model::DescribeThingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeThingAsync(request, [complete](const IoTClient*, const Model::DescribeThingRequest&, const Model::DescribeThingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeThingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes the specified policy from the specified certificate.</p>
          */
@@ -839,6 +1277,27 @@ namespace Model
          */
         virtual void DetachPrincipalPolicyAsync(const Model::DetachPrincipalPolicyRequest& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes the specified policy from the specified certificate.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachPrincipalPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachPrincipalPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachPrincipalPolicyOutcome> DetachPrincipalPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachPrincipalPolicyOutcome>([this, request](const std::function<void(Model::DetachPrincipalPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachPrincipalPolicyAsync(request, [complete](const IoTClient*, const Model::DetachPrincipalPolicyRequest&, const Model::DetachPrincipalPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachPrincipalPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Detaches the specified principal from the specified thing.</p>
          */
@@ -858,6 +1317,27 @@ namespace Model
          */
         virtual void DetachThingPrincipalAsync(const Model::DetachThingPrincipalRequest& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Detaches the specified principal from the specified thing.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachThingPrincipalAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachThingPrincipalRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachThingPrincipalOutcome> DetachThingPrincipalAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachThingPrincipalOutcome>([this, request](const std::function<void(Model::DetachThingPrincipalOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachThingPrincipalAsync(request, [complete](const IoTClient*, const Model::DetachThingPrincipalRequest&, const Model::DetachThingPrincipalOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachThingPrincipalOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables the specified rule.</p>
          */
@@ -877,6 +1357,27 @@ namespace Model
          */
         virtual void DisableTopicRuleAsync(const Model::DisableTopicRuleRequest& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables the specified rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableTopicRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableTopicRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableTopicRuleOutcome> DisableTopicRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableTopicRuleOutcome>([this, request](const std::function<void(Model::DisableTopicRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableTopicRuleAsync(request, [complete](const IoTClient*, const Model::DisableTopicRuleRequest&, const Model::DisableTopicRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableTopicRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables the specified rule.</p>
          */
@@ -896,6 +1397,27 @@ namespace Model
          */
         virtual void EnableTopicRuleAsync(const Model::EnableTopicRuleRequest& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables the specified rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableTopicRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableTopicRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableTopicRuleOutcome> EnableTopicRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableTopicRuleOutcome>([this, request](const std::function<void(Model::EnableTopicRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableTopicRuleAsync(request, [complete](const IoTClient*, const Model::EnableTopicRuleRequest&, const Model::EnableTopicRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableTopicRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the logging options.</p>
          */
@@ -915,6 +1437,27 @@ namespace Model
          */
         virtual void GetLoggingOptionsAsync(const Model::GetLoggingOptionsRequest& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the logging options.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetLoggingOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetLoggingOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetLoggingOptionsOutcome> GetLoggingOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetLoggingOptionsOutcome>([this, request](const std::function<void(Model::GetLoggingOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetLoggingOptionsAsync(request, [complete](const IoTClient*, const Model::GetLoggingOptionsRequest&, const Model::GetLoggingOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetLoggingOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the specified policy with the policy document of the
          * default version.</p>
@@ -937,6 +1480,28 @@ namespace Model
          */
         virtual void GetPolicyAsync(const Model::GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the specified policy with the policy document of the
+         * default version.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetPolicyOutcome> GetPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetPolicyOutcome>([this, request](const std::function<void(Model::GetPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetPolicyAsync(request, [complete](const IoTClient*, const Model::GetPolicyRequest&, const Model::GetPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the specified policy version.</p>
          */
@@ -956,6 +1521,27 @@ namespace Model
          */
         virtual void GetPolicyVersionAsync(const Model::GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the specified policy version.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetPolicyVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetPolicyVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetPolicyVersionOutcome> GetPolicyVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetPolicyVersionOutcome>([this, request](const std::function<void(Model::GetPolicyVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetPolicyVersionAsync(request, [complete](const IoTClient*, const Model::GetPolicyVersionRequest&, const Model::GetPolicyVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetPolicyVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the specified rule.</p>
          */
@@ -975,6 +1561,27 @@ namespace Model
          */
         virtual void GetTopicRuleAsync(const Model::GetTopicRuleRequest& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the specified rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetTopicRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetTopicRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetTopicRuleOutcome> GetTopicRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetTopicRuleOutcome>([this, request](const std::function<void(Model::GetTopicRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetTopicRuleAsync(request, [complete](const IoTClient*, const Model::GetTopicRuleRequest&, const Model::GetTopicRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetTopicRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists your certificates.</p> <p>The results are paginated with a default page
          * size of 25. You can use the returned marker to retrieve additional results.</p>
@@ -997,6 +1604,28 @@ namespace Model
          */
         virtual void ListCertificatesAsync(const Model::ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists your certificates.</p> <p>The results are paginated with a default page
+         * size of 25. You can use the returned marker to retrieve additional results.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListCertificatesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListCertificatesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListCertificatesOutcome> ListCertificatesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListCertificatesOutcome>([this, request](const std::function<void(Model::ListCertificatesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListCertificatesAsync(request, [complete](const IoTClient*, const Model::ListCertificatesRequest&, const Model::ListCertificatesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListCertificatesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists your policies.</p>
          */
@@ -1016,6 +1645,27 @@ namespace Model
          */
         virtual void ListPoliciesAsync(const Model::ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists your policies.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPoliciesOutcome> ListPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPoliciesOutcome>([this, request](const std::function<void(Model::ListPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPoliciesAsync(request, [complete](const IoTClient*, const Model::ListPoliciesRequest&, const Model::ListPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the versions of the specified policy, and identifies the default
          * version.</p>
@@ -1038,6 +1688,28 @@ namespace Model
          */
         virtual void ListPolicyVersionsAsync(const Model::ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the versions of the specified policy, and identifies the default
+         * version.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListPolicyVersionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPolicyVersionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPolicyVersionsOutcome> ListPolicyVersionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPolicyVersionsOutcome>([this, request](const std::function<void(Model::ListPolicyVersionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPolicyVersionsAsync(request, [complete](const IoTClient*, const Model::ListPolicyVersionsRequest&, const Model::ListPolicyVersionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPolicyVersionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the policies attached to the specified principal. If you use an Cognito
          * identity, the ID must be in <a
@@ -1066,6 +1738,30 @@ namespace Model
          */
         virtual void ListPrincipalPoliciesAsync(const Model::ListPrincipalPoliciesRequest& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the policies attached to the specified principal. If you use an Cognito
+         * identity, the ID must be in <a
+         * href="http://docs.aws.amazon.com/cognitoidentity/latest/APIReference/API_GetCredentialsForIdentity.html#API_GetCredentialsForIdentity_RequestSyntax">AmazonCognito
+         * Identity format</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListPrincipalPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPrincipalPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPrincipalPoliciesOutcome> ListPrincipalPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPrincipalPoliciesOutcome>([this, request](const std::function<void(Model::ListPrincipalPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPrincipalPoliciesAsync(request, [complete](const IoTClient*, const Model::ListPrincipalPoliciesRequest&, const Model::ListPrincipalPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPrincipalPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the things associated with the specified principal.</p>
          */
@@ -1085,6 +1781,27 @@ namespace Model
          */
         virtual void ListPrincipalThingsAsync(const Model::ListPrincipalThingsRequest& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the things associated with the specified principal.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListPrincipalThingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPrincipalThingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPrincipalThingsOutcome> ListPrincipalThingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPrincipalThingsOutcome>([this, request](const std::function<void(Model::ListPrincipalThingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPrincipalThingsAsync(request, [complete](const IoTClient*, const Model::ListPrincipalThingsRequest&, const Model::ListPrincipalThingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPrincipalThingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the principals associated with the specified thing.</p>
          */
@@ -1104,6 +1821,27 @@ namespace Model
          */
         virtual void ListThingPrincipalsAsync(const Model::ListThingPrincipalsRequest& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the principals associated with the specified thing.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListThingPrincipalsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListThingPrincipalsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListThingPrincipalsOutcome> ListThingPrincipalsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListThingPrincipalsOutcome>([this, request](const std::function<void(Model::ListThingPrincipalsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListThingPrincipalsAsync(request, [complete](const IoTClient*, const Model::ListThingPrincipalsRequest&, const Model::ListThingPrincipalsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListThingPrincipalsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists your things. You can pass an AttributeName or AttributeValue to filter
          * your things (for example, "ListThings where AttributeName=Color and
@@ -1129,6 +1867,29 @@ namespace Model
          */
         virtual void ListThingsAsync(const Model::ListThingsRequest& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists your things. You can pass an AttributeName or AttributeValue to filter
+         * your things (for example, "ListThings where AttributeName=Color and
+         * AttributeValue=Red").</p>
+         *
+         * Returns an awaitable that starts the operation the way ListThingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListThingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListThingsOutcome> ListThingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListThingsOutcome>([this, request](const std::function<void(Model::ListThingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListThingsAsync(request, [complete](const IoTClient*, const Model::ListThingsRequest&, const Model::ListThingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListThingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the rules for the specific topic.</p>
          */
@@ -1148,6 +1909,27 @@ namespace Model
          */
         virtual void ListTopicRulesAsync(const Model::ListTopicRulesRequest& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the rules for the specific topic.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTopicRulesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTopicRulesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTopicRulesOutcome> ListTopicRulesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTopicRulesOutcome>([this, request](const std::function<void(Model::ListTopicRulesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTopicRulesAsync(request, [complete](const IoTClient*, const Model::ListTopicRulesRequest&, const Model::ListTopicRulesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTopicRulesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Rejects a pending certificate transfer. After AWS IoT rejects a certificate
          * transfer, the certificate status changes from <b>PENDING_TRANFER</b> to
@@ -1182,6 +1964,32 @@ namespace Model
          */
         virtual void RejectCertificateTransferAsync(const Model::RejectCertificateTransferRequest& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Rejects a pending certificate transfer. After AWS IoT rejects a certificate
+         * transfer, the certificate status changes from <b>PENDING_TRANFER</b> to
+         * <b>INACTIVE</b>.</p> <p>To check for pending certificate transfers, call
+         * <a>ListCertificates</a> to enumerate your certificates.</p> <p>This operation
+         * can only be called by the transfer destination. After it is called, the
+         * certificate will be returned to the source's account in the INACTIVE state.</p>
+         *
+         * Returns an awaitable that starts the operation the way RejectCertificateTransferAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RejectCertificateTransferRequest>
+        Aws::Utils::Threading::Awaitable<Model::RejectCertificateTransferOutcome> RejectCertificateTransferAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RejectCertificateTransferOutcome>([this, request](const std::function<void(Model::RejectCertificateTransferOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RejectCertificateTransferAsync(request, [complete](const IoTClient*, const Model::RejectCertificateTransferRequest&, const Model::RejectCertificateTransferOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RejectCertificateTransferOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Replaces the specified rule. You must specify all parameters for the new
          * rule. Creating rules is an administrator-level action. Any user who has
@@ -1210,6 +2018,30 @@ namespace Model
          */
         virtual void ReplaceTopicRuleAsync(const Model::ReplaceTopicRuleRequest& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Replaces the specified rule. You must specify all parameters for the new
+         * rule. Creating rules is an administrator-level action. Any user who has
+         * permission to create rules will be able to access data processed by the
+         * rule.</p>
+         *
+         * Returns an awaitable that starts the operation the way ReplaceTopicRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReplaceTopicRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReplaceTopicRuleOutcome> ReplaceTopicRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReplaceTopicRuleOutcome>([this, request](const std::function<void(Model::ReplaceTopicRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReplaceTopicRuleAsync(request, [complete](const IoTClient*, const Model::ReplaceTopicRuleRequest&, const Model::ReplaceTopicRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReplaceTopicRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the specified version of the specified policy as the policy's default
          * (operative) version. This action affects all certificates to which the policy is
@@ -1238,6 +2070,30 @@ namespace Model
          */
         virtual void SetDefaultPolicyVersionAsync(const Model::SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the specified version of the specified policy as the policy's default
+         * (operative) version. This action affects all certificates to which the policy is
+         * attached. To list the principals the policy is attached to, use the
+         * ListPrincipalPolicy API.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetDefaultPolicyVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetDefaultPolicyVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetDefaultPolicyVersionOutcome> SetDefaultPolicyVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetDefaultPolicyVersionOutcome>([this, request](const std::function<void(Model::SetDefaultPolicyVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetDefaultPolicyVersionAsync(request, [complete](const IoTClient*, const Model::SetDefaultPolicyVersionRequest&, const Model::SetDefaultPolicyVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetDefaultPolicyVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the logging options.</p>
          */
@@ -1257,6 +2113,27 @@ namespace Model
          */
         virtual void SetLoggingOptionsAsync(const Model::SetLoggingOptionsRequest& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the logging options.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetLoggingOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetLoggingOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetLoggingOptionsOutcome> SetLoggingOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetLoggingOptionsOutcome>([this, request](const std::function<void(Model::SetLoggingOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetLoggingOptionsAsync(request, [complete](const IoTClient*, const Model::SetLoggingOptionsRequest&, const Model::SetLoggingOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetLoggingOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Transfers the specified certificate to the specified AWS account.</p> <p>You
          * can cancel the transfer until it is acknowledged by the recipient.</p> <p>No
@@ -1294,6 +2171,33 @@ namespace Model
          */
         virtual void TransferCertificateAsync(const Model::TransferCertificateRequest& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Transfers the specified certificate to the specified AWS account.</p> <p>You
+         * can cancel the transfer until it is acknowledged by the recipient.</p> <p>No
+         * notification is sent to the transfer destination's account. It is up to the
+         * caller to notify the transfer target.</p> <p>The certificate being transferred
+         * must not be in the ACTIVE state. You can use the UpdateCertificate API to
+         * deactivate it.</p> <p>The certificate must not have any policies attached to it.
+         * You can use the DetachPrincipalPolicy API to detach them.</p>
+         *
+         * Returns an awaitable that starts the operation the way TransferCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TransferCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::TransferCertificateOutcome> TransferCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TransferCertificateOutcome>([this, request](const std::function<void(Model::TransferCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TransferCertificateAsync(request, [complete](const IoTClient*, const Model::TransferCertificateRequest&, const Model::TransferCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TransferCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the status of the specified certificate. This operation is
          * idempotent.</p> <p>Moving a certificate from the ACTIVE state (including
@@ -1325,6 +2229,31 @@ namespace Model
          */
         virtual void UpdateCertificateAsync(const Model::UpdateCertificateRequest& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the status of the specified certificate. This operation is
+         * idempotent.</p> <p>Moving a certificate from the ACTIVE state (including
+         * REVOKED) will not disconnect currently connected devices, but these devices will
+         * be unable to reconnect.</p> <p>The ACTIVE state is required to authenticate
+         * devices connecting to AWS IoT using a certificate.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateCertificateOutcome> UpdateCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateCertificateOutcome>([this, request](const std::function<void(Model::UpdateCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateCertificateAsync(request, [complete](const IoTClient*, const Model::UpdateCertificateRequest&, const Model::UpdateCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the data for a thing.</p>
          */
@@ -1344,6 +2273,27 @@ namespace Model
          */
         virtual void UpdateThingAsync(const Model::UpdateThingRequest& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the data for a thing.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateThingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateThingRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateThingOutcome> UpdateThingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateThingOutcome>([this, request](const std::function<void(Model::UpdateThingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateThingAsync(request, [complete](const IoTClient*, const Model::UpdateThingRequest&, const Model::UpdateThingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateThingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
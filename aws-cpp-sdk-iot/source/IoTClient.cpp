@@ -136,7 +136,7 @@ AcceptCertificateTransferOutcome IoTClient::AcceptCertificateTransfer(const Acce
   ss << m_uri << "/accept-certificate-transfer/";
   ss << request.GetCertificateId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "AcceptCertificateTransfer");
   if(outcome.IsSuccess())
   {
     return AcceptCertificateTransferOutcome(NoResult());
@@ -149,17 +149,43 @@ AcceptCertificateTransferOutcome IoTClient::AcceptCertificateTransfer(const Acce
 
 AcceptCertificateTransferOutcomeCallable IoTClient::AcceptCertificateTransferCallable(const AcceptCertificateTransferRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::AcceptCertificateTransfer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AcceptCertificateTransferOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AcceptCertificateTransfer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< AcceptCertificateTransferOutcome > rejected;
+    rejected.set_value(AcceptCertificateTransferOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::AcceptCertificateTransferAsync(const AcceptCertificateTransferRequest& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::AcceptCertificateTransferAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::AcceptCertificateTransferAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, AcceptCertificateTransferOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::AcceptCertificateTransferAsyncHelper(const AcceptCertificateTransferRequest& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, AcceptCertificateTransfer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/accept-certificate-transfer/";
+  ss << request.GetCertificateId();
+
+  auto sharedRequest = Aws::MakeShared<AcceptCertificateTransferRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "AcceptCertificateTransfer", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AcceptCertificateTransferOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AcceptCertificateTransferOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 AttachPrincipalPolicyOutcome IoTClient::AttachPrincipalPolicy(const AttachPrincipalPolicyRequest& request) const
@@ -168,7 +194,7 @@ AttachPrincipalPolicyOutcome IoTClient::AttachPrincipalPolicy(const AttachPrinci
   ss << m_uri << "/principal-policies/";
   ss << request.GetPolicyName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "AttachPrincipalPolicy");
   if(outcome.IsSuccess())
   {
     return AttachPrincipalPolicyOutcome(NoResult());
@@ -181,17 +207,43 @@ AttachPrincipalPolicyOutcome IoTClient::AttachPrincipalPolicy(const AttachPrinci
 
 AttachPrincipalPolicyOutcomeCallable IoTClient::AttachPrincipalPolicyCallable(const AttachPrincipalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::AttachPrincipalPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AttachPrincipalPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AttachPrincipalPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< AttachPrincipalPolicyOutcome > rejected;
+    rejected.set_value(AttachPrincipalPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::AttachPrincipalPolicyAsync(const AttachPrincipalPolicyRequest& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::AttachPrincipalPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::AttachPrincipalPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, AttachPrincipalPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::AttachPrincipalPolicyAsyncHelper(const AttachPrincipalPolicyRequest& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, AttachPrincipalPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/principal-policies/";
+  ss << request.GetPolicyName();
+
+  auto sharedRequest = Aws::MakeShared<AttachPrincipalPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "AttachPrincipalPolicy", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AttachPrincipalPolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AttachPrincipalPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 AttachThingPrincipalOutcome IoTClient::AttachThingPrincipal(const AttachThingPrincipalRequest& request) const
@@ -201,7 +253,7 @@ AttachThingPrincipalOutcome IoTClient::AttachThingPrincipal(const AttachThingPri
   ss << request.GetThingName();
   ss << "/principals";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "AttachThingPrincipal");
   if(outcome.IsSuccess())
   {
     return AttachThingPrincipalOutcome(AttachThingPrincipalResult(outcome.GetResult()));
@@ -214,17 +266,44 @@ AttachThingPrincipalOutcome IoTClient::AttachThingPrincipal(const AttachThingPri
 
 AttachThingPrincipalOutcomeCallable IoTClient::AttachThingPrincipalCallable(const AttachThingPrincipalRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::AttachThingPrincipal, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AttachThingPrincipalOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AttachThingPrincipal( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< AttachThingPrincipalOutcome > rejected;
+    rejected.set_value(AttachThingPrincipalOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::AttachThingPrincipalAsync(const AttachThingPrincipalRequest& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::AttachThingPrincipalAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::AttachThingPrincipalAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, AttachThingPrincipalOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::AttachThingPrincipalAsyncHelper(const AttachThingPrincipalRequest& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, AttachThingPrincipal(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/things/";
+  ss << request.GetThingName();
+  ss << "/principals";
+
+  auto sharedRequest = Aws::MakeShared<AttachThingPrincipalRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "AttachThingPrincipal", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AttachThingPrincipalOutcome(AttachThingPrincipalResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AttachThingPrincipalOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CancelCertificateTransferOutcome IoTClient::CancelCertificateTransfer(const CancelCertificateTransferRequest& request) const
@@ -233,7 +312,7 @@ CancelCertificateTransferOutcome IoTClient::CancelCertificateTransfer(const Canc
   ss << m_uri << "/cancel-certificate-transfer/";
   ss << request.GetCertificateId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "CancelCertificateTransfer");
   if(outcome.IsSuccess())
   {
     return CancelCertificateTransferOutcome(NoResult());
@@ -246,17 +325,43 @@ CancelCertificateTransferOutcome IoTClient::CancelCertificateTransfer(const Canc
 
 CancelCertificateTransferOutcomeCallable IoTClient::CancelCertificateTransferCallable(const CancelCertificateTransferRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CancelCertificateTransfer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CancelCertificateTransferOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CancelCertificateTransfer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CancelCertificateTransferOutcome > rejected;
+    rejected.set_value(CancelCertificateTransferOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::CancelCertificateTransferAsync(const CancelCertificateTransferRequest& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CancelCertificateTransferAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::CancelCertificateTransferAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CancelCertificateTransferOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::CancelCertificateTransferAsyncHelper(const CancelCertificateTransferRequest& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CancelCertificateTransfer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/cancel-certificate-transfer/";
+  ss << request.GetCertificateId();
+
+  auto sharedRequest = Aws::MakeShared<CancelCertificateTransferRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "CancelCertificateTransfer", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CancelCertificateTransferOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CancelCertificateTransferOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateCertificateFromCsrOutcome IoTClient::CreateCertificateFromCsr(const CreateCertificateFromCsrRequest& request) const
@@ -264,7 +369,7 @@ CreateCertificateFromCsrOutcome IoTClient::CreateCertificateFromCsr(const Create
   Aws::StringStream ss;
   ss << m_uri << "/certificates";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateCertificateFromCsr");
   if(outcome.IsSuccess())
   {
     return CreateCertificateFromCsrOutcome(CreateCertificateFromCsrResult(outcome.GetResult()));
@@ -277,17 +382,42 @@ CreateCertificateFromCsrOutcome IoTClient::CreateCertificateFromCsr(const Create
 
 CreateCertificateFromCsrOutcomeCallable IoTClient::CreateCertificateFromCsrCallable(const CreateCertificateFromCsrRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreateCertificateFromCsr, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateCertificateFromCsrOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateCertificateFromCsr( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateCertificateFromCsrOutcome > rejected;
+    rejected.set_value(CreateCertificateFromCsrOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::CreateCertificateFromCsrAsync(const CreateCertificateFromCsrRequest& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreateCertificateFromCsrAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::CreateCertificateFromCsrAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateCertificateFromCsrOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::CreateCertificateFromCsrAsyncHelper(const CreateCertificateFromCsrRequest& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateCertificateFromCsr(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/certificates";
+
+  auto sharedRequest = Aws::MakeShared<CreateCertificateFromCsrRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateCertificateFromCsr", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateCertificateFromCsrOutcome(CreateCertificateFromCsrResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateCertificateFromCsrOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateKeysAndCertificateOutcome IoTClient::CreateKeysAndCertificate(const CreateKeysAndCertificateRequest& request) const
@@ -295,7 +425,7 @@ CreateKeysAndCertificateOutcome IoTClient::CreateKeysAndCertificate(const Create
   Aws::StringStream ss;
   ss << m_uri << "/keys-and-certificate";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateKeysAndCertificate");
   if(outcome.IsSuccess())
   {
     return CreateKeysAndCertificateOutcome(CreateKeysAndCertificateResult(outcome.GetResult()));
@@ -308,17 +438,42 @@ CreateKeysAndCertificateOutcome IoTClient::CreateKeysAndCertificate(const Create
 
 CreateKeysAndCertificateOutcomeCallable IoTClient::CreateKeysAndCertificateCallable(const CreateKeysAndCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreateKeysAndCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateKeysAndCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateKeysAndCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateKeysAndCertificateOutcome > rejected;
+    rejected.set_value(CreateKeysAndCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::CreateKeysAndCertificateAsync(const CreateKeysAndCertificateRequest& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreateKeysAndCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::CreateKeysAndCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateKeysAndCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::CreateKeysAndCertificateAsyncHelper(const CreateKeysAndCertificateRequest& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateKeysAndCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/keys-and-certificate";
+
+  auto sharedRequest = Aws::MakeShared<CreateKeysAndCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateKeysAndCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateKeysAndCertificateOutcome(CreateKeysAndCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateKeysAndCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreatePolicyOutcome IoTClient::CreatePolicy(const CreatePolicyRequest& request) const
@@ -327,7 +482,7 @@ CreatePolicyOutcome IoTClient::CreatePolicy(const CreatePolicyRequest& request)
   ss << m_uri << "/policies/";
   ss << request.GetPolicyName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreatePolicy");
   if(outcome.IsSuccess())
   {
     return CreatePolicyOutcome(CreatePolicyResult(outcome.GetResult()));
@@ -340,17 +495,43 @@ CreatePolicyOutcome IoTClient::CreatePolicy(const CreatePolicyRequest& request)
 
 CreatePolicyOutcomeCallable IoTClient::CreatePolicyCallable(const CreatePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreatePolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreatePolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreatePolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreatePolicyOutcome > rejected;
+    rejected.set_value(CreatePolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::CreatePolicyAsync(const CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreatePolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::CreatePolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreatePolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::CreatePolicyAsyncHelper(const CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreatePolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/policies/";
+  ss << request.GetPolicyName();
+
+  auto sharedRequest = Aws::MakeShared<CreatePolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreatePolicy", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreatePolicyOutcome(CreatePolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreatePolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreatePolicyVersionOutcome IoTClient::CreatePolicyVersion(const CreatePolicyVersionRequest& request) const
@@ -360,7 +541,7 @@ CreatePolicyVersionOutcome IoTClient::CreatePolicyVersion(const CreatePolicyVers
   ss << request.GetPolicyName();
   ss << "/version";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreatePolicyVersion");
   if(outcome.IsSuccess())
   {
     return CreatePolicyVersionOutcome(CreatePolicyVersionResult(outcome.GetResult()));
@@ -373,17 +554,44 @@ CreatePolicyVersionOutcome IoTClient::CreatePolicyVersion(const CreatePolicyVers
 
 CreatePolicyVersionOutcomeCallable IoTClient::CreatePolicyVersionCallable(const CreatePolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreatePolicyVersion, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreatePolicyVersionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreatePolicyVersion( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreatePolicyVersionOutcome > rejected;
+    rejected.set_value(CreatePolicyVersionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::CreatePolicyVersionAsync(const CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreatePolicyVersionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::CreatePolicyVersionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreatePolicyVersionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::CreatePolicyVersionAsyncHelper(const CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreatePolicyVersion(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/policies/";
+  ss << request.GetPolicyName();
+  ss << "/version";
+
+  auto sharedRequest = Aws::MakeShared<CreatePolicyVersionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreatePolicyVersion", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreatePolicyVersionOutcome(CreatePolicyVersionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreatePolicyVersionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateThingOutcome IoTClient::CreateThing(const CreateThingRequest& request) const
@@ -392,7 +600,7 @@ CreateThingOutcome IoTClient::CreateThing(const CreateThingRequest& request) con
   ss << m_uri << "/things/";
   ss << request.GetThingName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateThing");
   if(outcome.IsSuccess())
   {
     return CreateThingOutcome(CreateThingResult(outcome.GetResult()));
@@ -405,17 +613,43 @@ CreateThingOutcome IoTClient::CreateThing(const CreateThingRequest& request) con
 
 CreateThingOutcomeCallable IoTClient::CreateThingCallable(const CreateThingRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreateThing, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateThingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateThing( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateThingOutcome > rejected;
+    rejected.set_value(CreateThingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::CreateThingAsync(const CreateThingRequest& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreateThingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::CreateThingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateThingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::CreateThingAsyncHelper(const CreateThingRequest& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateThing(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/things/";
+  ss << request.GetThingName();
+
+  auto sharedRequest = Aws::MakeShared<CreateThingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateThing", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateThingOutcome(CreateThingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateThingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateTopicRuleOutcome IoTClient::CreateTopicRule(const CreateTopicRuleRequest& request) const
@@ -424,7 +658,7 @@ CreateTopicRuleOutcome IoTClient::CreateTopicRule(const CreateTopicRuleRequest&
   ss << m_uri << "/rules/";
   ss << request.GetRuleName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateTopicRule");
   if(outcome.IsSuccess())
   {
     return CreateTopicRuleOutcome(NoResult());
@@ -437,17 +671,43 @@ CreateTopicRuleOutcome IoTClient::CreateTopicRule(const CreateTopicRuleRequest&
 
 CreateTopicRuleOutcomeCallable IoTClient::CreateTopicRuleCallable(const CreateTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreateTopicRule, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateTopicRuleOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateTopicRule( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateTopicRuleOutcome > rejected;
+    rejected.set_value(CreateTopicRuleOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::CreateTopicRuleAsync(const CreateTopicRuleRequest& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreateTopicRuleAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::CreateTopicRuleAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateTopicRuleOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::CreateTopicRuleAsyncHelper(const CreateTopicRuleRequest& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateTopicRule(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/rules/";
+  ss << request.GetRuleName();
+
+  auto sharedRequest = Aws::MakeShared<CreateTopicRuleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateTopicRule", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateTopicRuleOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateTopicRuleOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteCertificateOutcome IoTClient::DeleteCertificate(const DeleteCertificateRequest& request) const
@@ -456,7 +716,7 @@ DeleteCertificateOutcome IoTClient::DeleteCertificate(const DeleteCertificateReq
   ss << m_uri << "/certificates/";
   ss << request.GetCertificateId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteCertificate");
   if(outcome.IsSuccess())
   {
     return DeleteCertificateOutcome(NoResult());
@@ -469,17 +729,43 @@ DeleteCertificateOutcome IoTClient::DeleteCertificate(const DeleteCertificateReq
 
 DeleteCertificateOutcomeCallable IoTClient::DeleteCertificateCallable(const DeleteCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DeleteCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteCertificateOutcome > rejected;
+    rejected.set_value(DeleteCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DeleteCertificateAsync(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DeleteCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DeleteCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DeleteCertificateAsyncHelper(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/certificates/";
+  ss << request.GetCertificateId();
+
+  auto sharedRequest = Aws::MakeShared<DeleteCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeletePolicyOutcome IoTClient::DeletePolicy(const DeletePolicyRequest& request) const
@@ -488,7 +774,7 @@ DeletePolicyOutcome IoTClient::DeletePolicy(const DeletePolicyRequest& request)
   ss << m_uri << "/policies/";
   ss << request.GetPolicyName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeletePolicy");
   if(outcome.IsSuccess())
   {
     return DeletePolicyOutcome(NoResult());
@@ -501,17 +787,43 @@ DeletePolicyOutcome IoTClient::DeletePolicy(const DeletePolicyRequest& request)
 
 DeletePolicyOutcomeCallable IoTClient::DeletePolicyCallable(const DeletePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DeletePolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeletePolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeletePolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeletePolicyOutcome > rejected;
+    rejected.set_value(DeletePolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DeletePolicyAsync(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DeletePolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DeletePolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeletePolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DeletePolicyAsyncHelper(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeletePolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/policies/";
+  ss << request.GetPolicyName();
+
+  auto sharedRequest = Aws::MakeShared<DeletePolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeletePolicy", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeletePolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeletePolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeletePolicyVersionOutcome IoTClient::DeletePolicyVersion(const DeletePolicyVersionRequest& request) const
@@ -522,7 +834,7 @@ DeletePolicyVersionOutcome IoTClient::DeletePolicyVersion(const DeletePolicyVers
   ss << "/version/";
   ss << request.GetPolicyVersionId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeletePolicyVersion");
   if(outcome.IsSuccess())
   {
     return DeletePolicyVersionOutcome(NoResult());
@@ -535,17 +847,45 @@ DeletePolicyVersionOutcome IoTClient::DeletePolicyVersion(const DeletePolicyVers
 
 DeletePolicyVersionOutcomeCallable IoTClient::DeletePolicyVersionCallable(const DeletePolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DeletePolicyVersion, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeletePolicyVersionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeletePolicyVersion( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeletePolicyVersionOutcome > rejected;
+    rejected.set_value(DeletePolicyVersionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DeletePolicyVersionAsync(const DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DeletePolicyVersionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DeletePolicyVersionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeletePolicyVersionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DeletePolicyVersionAsyncHelper(const DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeletePolicyVersion(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/policies/";
+  ss << request.GetPolicyName();
+  ss << "/version/";
+  ss << request.GetPolicyVersionId();
+
+  auto sharedRequest = Aws::MakeShared<DeletePolicyVersionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeletePolicyVersion", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeletePolicyVersionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeletePolicyVersionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteThingOutcome IoTClient::DeleteThing(const DeleteThingRequest& request) const
@@ -554,7 +894,7 @@ DeleteThingOutcome IoTClient::DeleteThing(const DeleteThingRequest& request) con
   ss << m_uri << "/things/";
   ss << request.GetThingName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteThing");
   if(outcome.IsSuccess())
   {
     return DeleteThingOutcome(DeleteThingResult(outcome.GetResult()));
@@ -567,17 +907,43 @@ DeleteThingOutcome IoTClient::DeleteThing(const DeleteThingRequest& request) con
 
 DeleteThingOutcomeCallable IoTClient::DeleteThingCallable(const DeleteThingRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DeleteThing, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteThingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteThing( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteThingOutcome > rejected;
+    rejected.set_value(DeleteThingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DeleteThingAsync(const DeleteThingRequest& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DeleteThingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DeleteThingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteThingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DeleteThingAsyncHelper(const DeleteThingRequest& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteThing(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/things/";
+  ss << request.GetThingName();
+
+  auto sharedRequest = Aws::MakeShared<DeleteThingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteThing", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteThingOutcome(DeleteThingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteThingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteTopicRuleOutcome IoTClient::DeleteTopicRule(const DeleteTopicRuleRequest& request) const
@@ -586,7 +952,7 @@ DeleteTopicRuleOutcome IoTClient::DeleteTopicRule(const DeleteTopicRuleRequest&
   ss << m_uri << "/rules/";
   ss << request.GetRuleName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteTopicRule");
   if(outcome.IsSuccess())
   {
     return DeleteTopicRuleOutcome(NoResult());
@@ -599,17 +965,43 @@ DeleteTopicRuleOutcome IoTClient::DeleteTopicRule(const DeleteTopicRuleRequest&
 
 DeleteTopicRuleOutcomeCallable IoTClient::DeleteTopicRuleCallable(const DeleteTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DeleteTopicRule, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteTopicRuleOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteTopicRule( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteTopicRuleOutcome > rejected;
+    rejected.set_value(DeleteTopicRuleOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DeleteTopicRuleAsync(const DeleteTopicRuleRequest& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DeleteTopicRuleAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DeleteTopicRuleAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteTopicRuleOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DeleteTopicRuleAsyncHelper(const DeleteTopicRuleRequest& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteTopicRule(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/rules/";
+  ss << request.GetRuleName();
+
+  auto sharedRequest = Aws::MakeShared<DeleteTopicRuleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteTopicRule", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteTopicRuleOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteTopicRuleOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeCertificateOutcome IoTClient::DescribeCertificate(const DescribeCertificateRequest& request) const
@@ -618,7 +1010,7 @@ DescribeCertificateOutcome IoTClient::DescribeCertificate(const DescribeCertific
   ss << m_uri << "/certificates/";
   ss << request.GetCertificateId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "DescribeCertificate");
   if(outcome.IsSuccess())
   {
     return DescribeCertificateOutcome(DescribeCertificateResult(outcome.GetResult()));
@@ -631,17 +1023,43 @@ DescribeCertificateOutcome IoTClient::DescribeCertificate(const DescribeCertific
 
 DescribeCertificateOutcomeCallable IoTClient::DescribeCertificateCallable(const DescribeCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DescribeCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeCertificateOutcome > rejected;
+    rejected.set_value(DescribeCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DescribeCertificateAsync(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DescribeCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DescribeCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DescribeCertificateAsyncHelper(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/certificates/";
+  ss << request.GetCertificateId();
+
+  auto sharedRequest = Aws::MakeShared<DescribeCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "DescribeCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeCertificateOutcome(DescribeCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeEndpointOutcome IoTClient::DescribeEndpoint(const DescribeEndpointRequest& request) const
@@ -649,7 +1067,7 @@ DescribeEndpointOutcome IoTClient::DescribeEndpoint(const DescribeEndpointReques
   Aws::StringStream ss;
   ss << m_uri << "/endpoint";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "DescribeEndpoint");
   if(outcome.IsSuccess())
   {
     return DescribeEndpointOutcome(DescribeEndpointResult(outcome.GetResult()));
@@ -662,17 +1080,42 @@ DescribeEndpointOutcome IoTClient::DescribeEndpoint(const DescribeEndpointReques
 
 DescribeEndpointOutcomeCallable IoTClient::DescribeEndpointCallable(const DescribeEndpointRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DescribeEndpoint, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeEndpointOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeEndpoint( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeEndpointOutcome > rejected;
+    rejected.set_value(DescribeEndpointOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DescribeEndpointAsync(const DescribeEndpointRequest& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DescribeEndpointAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DescribeEndpointAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeEndpointOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DescribeEndpointAsyncHelper(const DescribeEndpointRequest& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeEndpoint(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/endpoint";
+
+  auto sharedRequest = Aws::MakeShared<DescribeEndpointRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "DescribeEndpoint", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeEndpointOutcome(DescribeEndpointResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeEndpointOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DescribeThingOutcome IoTClient::DescribeThing(const DescribeThingRequest& request) const
@@ -681,7 +1124,7 @@ DescribeThingOutcome IoTClient::DescribeThing(const DescribeThingRequest& reques
   ss << m_uri << "/things/";
   ss << request.GetThingName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "DescribeThing");
   if(outcome.IsSuccess())
   {
     return DescribeThingOutcome(DescribeThingResult(outcome.GetResult()));
@@ -694,17 +1137,43 @@ DescribeThingOutcome IoTClient::DescribeThing(const DescribeThingRequest& reques
 
 DescribeThingOutcomeCallable IoTClient::DescribeThingCallable(const DescribeThingRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DescribeThing, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DescribeThingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeThing( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DescribeThingOutcome > rejected;
+    rejected.set_value(DescribeThingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DescribeThingAsync(const DescribeThingRequest& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DescribeThingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DescribeThingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DescribeThingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DescribeThingAsyncHelper(const DescribeThingRequest& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DescribeThing(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/things/";
+  ss << request.GetThingName();
+
+  auto sharedRequest = Aws::MakeShared<DescribeThingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "DescribeThing", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DescribeThingOutcome(DescribeThingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DescribeThingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DetachPrincipalPolicyOutcome IoTClient::DetachPrincipalPolicy(const DetachPrincipalPolicyRequest& request) const
@@ -713,7 +1182,7 @@ DetachPrincipalPolicyOutcome IoTClient::DetachPrincipalPolicy(const DetachPrinci
   ss << m_uri << "/principal-policies/";
   ss << request.GetPolicyName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DetachPrincipalPolicy");
   if(outcome.IsSuccess())
   {
     return DetachPrincipalPolicyOutcome(NoResult());
@@ -726,17 +1195,43 @@ DetachPrincipalPolicyOutcome IoTClient::DetachPrincipalPolicy(const DetachPrinci
 
 DetachPrincipalPolicyOutcomeCallable IoTClient::DetachPrincipalPolicyCallable(const DetachPrincipalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DetachPrincipalPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DetachPrincipalPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DetachPrincipalPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DetachPrincipalPolicyOutcome > rejected;
+    rejected.set_value(DetachPrincipalPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DetachPrincipalPolicyAsync(const DetachPrincipalPolicyRequest& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DetachPrincipalPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DetachPrincipalPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DetachPrincipalPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DetachPrincipalPolicyAsyncHelper(const DetachPrincipalPolicyRequest& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DetachPrincipalPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/principal-policies/";
+  ss << request.GetPolicyName();
+
+  auto sharedRequest = Aws::MakeShared<DetachPrincipalPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DetachPrincipalPolicy", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DetachPrincipalPolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DetachPrincipalPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DetachThingPrincipalOutcome IoTClient::DetachThingPrincipal(const DetachThingPrincipalRequest& request) const
@@ -746,7 +1241,7 @@ DetachThingPrincipalOutcome IoTClient::DetachThingPrincipal(const DetachThingPri
   ss << request.GetThingName();
   ss << "/principals";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DetachThingPrincipal");
   if(outcome.IsSuccess())
   {
     return DetachThingPrincipalOutcome(DetachThingPrincipalResult(outcome.GetResult()));
@@ -759,17 +1254,44 @@ DetachThingPrincipalOutcome IoTClient::DetachThingPrincipal(const DetachThingPri
 
 DetachThingPrincipalOutcomeCallable IoTClient::DetachThingPrincipalCallable(const DetachThingPrincipalRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DetachThingPrincipal, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DetachThingPrincipalOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DetachThingPrincipal( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DetachThingPrincipalOutcome > rejected;
+    rejected.set_value(DetachThingPrincipalOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DetachThingPrincipalAsync(const DetachThingPrincipalRequest& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DetachThingPrincipalAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DetachThingPrincipalAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DetachThingPrincipalOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DetachThingPrincipalAsyncHelper(const DetachThingPrincipalRequest& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DetachThingPrincipal(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/things/";
+  ss << request.GetThingName();
+  ss << "/principals";
+
+  auto sharedRequest = Aws::MakeShared<DetachThingPrincipalRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DetachThingPrincipal", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DetachThingPrincipalOutcome(DetachThingPrincipalResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DetachThingPrincipalOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DisableTopicRuleOutcome IoTClient::DisableTopicRule(const DisableTopicRuleRequest& request) const
@@ -779,7 +1301,7 @@ DisableTopicRuleOutcome IoTClient::DisableTopicRule(const DisableTopicRuleReques
   ss << request.GetRuleName();
   ss << "/disable";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DisableTopicRule");
   if(outcome.IsSuccess())
   {
     return DisableTopicRuleOutcome(NoResult());
@@ -792,17 +1314,44 @@ DisableTopicRuleOutcome IoTClient::DisableTopicRule(const DisableTopicRuleReques
 
 DisableTopicRuleOutcomeCallable IoTClient::DisableTopicRuleCallable(const DisableTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DisableTopicRule, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DisableTopicRuleOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisableTopicRule( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DisableTopicRuleOutcome > rejected;
+    rejected.set_value(DisableTopicRuleOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::DisableTopicRuleAsync(const DisableTopicRuleRequest& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DisableTopicRuleAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::DisableTopicRuleAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DisableTopicRuleOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::DisableTopicRuleAsyncHelper(const DisableTopicRuleRequest& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DisableTopicRule(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/rules/";
+  ss << request.GetRuleName();
+  ss << "/disable";
+
+  auto sharedRequest = Aws::MakeShared<DisableTopicRuleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DisableTopicRule", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisableTopicRuleOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisableTopicRuleOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 EnableTopicRuleOutcome IoTClient::EnableTopicRule(const EnableTopicRuleRequest& request) const
@@ -812,7 +1361,7 @@ EnableTopicRuleOutcome IoTClient::EnableTopicRule(const EnableTopicRuleRequest&
   ss << request.GetRuleName();
   ss << "/enable";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "EnableTopicRule");
   if(outcome.IsSuccess())
   {
     return EnableTopicRuleOutcome(NoResult());
@@ -825,17 +1374,44 @@ EnableTopicRuleOutcome IoTClient::EnableTopicRule(const EnableTopicRuleRequest&
 
 EnableTopicRuleOutcomeCallable IoTClient::EnableTopicRuleCallable(const EnableTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::EnableTopicRule, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< EnableTopicRuleOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->EnableTopicRule( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< EnableTopicRuleOutcome > rejected;
+    rejected.set_value(EnableTopicRuleOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::EnableTopicRuleAsync(const EnableTopicRuleRequest& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::EnableTopicRuleAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::EnableTopicRuleAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, EnableTopicRuleOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::EnableTopicRuleAsyncHelper(const EnableTopicRuleRequest& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, EnableTopicRule(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/rules/";
+  ss << request.GetRuleName();
+  ss << "/enable";
+
+  auto sharedRequest = Aws::MakeShared<EnableTopicRuleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "EnableTopicRule", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, EnableTopicRuleOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, EnableTopicRuleOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetLoggingOptionsOutcome IoTClient::GetLoggingOptions(const GetLoggingOptionsRequest& request) const
@@ -843,7 +1419,7 @@ GetLoggingOptionsOutcome IoTClient::GetLoggingOptions(const GetLoggingOptionsReq
   Aws::StringStream ss;
   ss << m_uri << "/loggingOptions";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetLoggingOptions");
   if(outcome.IsSuccess())
   {
     return GetLoggingOptionsOutcome(GetLoggingOptionsResult(outcome.GetResult()));
@@ -856,17 +1432,42 @@ GetLoggingOptionsOutcome IoTClient::GetLoggingOptions(const GetLoggingOptionsReq
 
 GetLoggingOptionsOutcomeCallable IoTClient::GetLoggingOptionsCallable(const GetLoggingOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::GetLoggingOptions, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetLoggingOptionsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetLoggingOptions( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetLoggingOptionsOutcome > rejected;
+    rejected.set_value(GetLoggingOptionsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::GetLoggingOptionsAsync(const GetLoggingOptionsRequest& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::GetLoggingOptionsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::GetLoggingOptionsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetLoggingOptionsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::GetLoggingOptionsAsyncHelper(const GetLoggingOptionsRequest& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetLoggingOptions(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/loggingOptions";
+
+  auto sharedRequest = Aws::MakeShared<GetLoggingOptionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetLoggingOptions", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetLoggingOptionsOutcome(GetLoggingOptionsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetLoggingOptionsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetPolicyOutcome IoTClient::GetPolicy(const GetPolicyRequest& request) const
@@ -875,7 +1476,7 @@ GetPolicyOutcome IoTClient::GetPolicy(const GetPolicyRequest& request) const
   ss << m_uri << "/policies/";
   ss << request.GetPolicyName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetPolicy");
   if(outcome.IsSuccess())
   {
     return GetPolicyOutcome(GetPolicyResult(outcome.GetResult()));
@@ -888,17 +1489,43 @@ GetPolicyOutcome IoTClient::GetPolicy(const GetPolicyRequest& request) const
 
 GetPolicyOutcomeCallable IoTClient::GetPolicyCallable(const GetPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::GetPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetPolicyOutcome > rejected;
+    rejected.set_value(GetPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::GetPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::GetPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::GetPolicyAsyncHelper(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/policies/";
+  ss << request.GetPolicyName();
+
+  auto sharedRequest = Aws::MakeShared<GetPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetPolicy", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetPolicyOutcome(GetPolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetPolicyVersionOutcome IoTClient::GetPolicyVersion(const GetPolicyVersionRequest& request) const
@@ -909,7 +1536,7 @@ GetPolicyVersionOutcome IoTClient::GetPolicyVersion(const GetPolicyVersionReques
   ss << "/version/";
   ss << request.GetPolicyVersionId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetPolicyVersion");
   if(outcome.IsSuccess())
   {
     return GetPolicyVersionOutcome(GetPolicyVersionResult(outcome.GetResult()));
@@ -922,17 +1549,45 @@ GetPolicyVersionOutcome IoTClient::GetPolicyVersion(const GetPolicyVersionReques
 
 GetPolicyVersionOutcomeCallable IoTClient::GetPolicyVersionCallable(const GetPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::GetPolicyVersion, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetPolicyVersionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetPolicyVersion( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetPolicyVersionOutcome > rejected;
+    rejected.set_value(GetPolicyVersionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::GetPolicyVersionAsync(const GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::GetPolicyVersionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::GetPolicyVersionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetPolicyVersionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::GetPolicyVersionAsyncHelper(const GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetPolicyVersion(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/policies/";
+  ss << request.GetPolicyName();
+  ss << "/version/";
+  ss << request.GetPolicyVersionId();
+
+  auto sharedRequest = Aws::MakeShared<GetPolicyVersionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetPolicyVersion", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetPolicyVersionOutcome(GetPolicyVersionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetPolicyVersionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetTopicRuleOutcome IoTClient::GetTopicRule(const GetTopicRuleRequest& request) const
@@ -941,7 +1596,7 @@ GetTopicRuleOutcome IoTClient::GetTopicRule(const GetTopicRuleRequest& request)
   ss << m_uri << "/rules/";
   ss << request.GetRuleName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetTopicRule");
   if(outcome.IsSuccess())
   {
     return GetTopicRuleOutcome(GetTopicRuleResult(outcome.GetResult()));
@@ -954,17 +1609,43 @@ GetTopicRuleOutcome IoTClient::GetTopicRule(const GetTopicRuleRequest& request)
 
 GetTopicRuleOutcomeCallable IoTClient::GetTopicRuleCallable(const GetTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::GetTopicRule, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetTopicRuleOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetTopicRule( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetTopicRuleOutcome > rejected;
+    rejected.set_value(GetTopicRuleOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::GetTopicRuleAsync(const GetTopicRuleRequest& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::GetTopicRuleAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::GetTopicRuleAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetTopicRuleOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::GetTopicRuleAsyncHelper(const GetTopicRuleRequest& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetTopicRule(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/rules/";
+  ss << request.GetRuleName();
+
+  auto sharedRequest = Aws::MakeShared<GetTopicRuleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetTopicRule", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetTopicRuleOutcome(GetTopicRuleResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetTopicRuleOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListCertificatesOutcome IoTClient::ListCertificates(const ListCertificatesRequest& request) const
@@ -972,7 +1653,7 @@ ListCertificatesOutcome IoTClient::ListCertificates(const ListCertificatesReques
   Aws::StringStream ss;
   ss << m_uri << "/certificates";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListCertificates");
   if(outcome.IsSuccess())
   {
     return ListCertificatesOutcome(ListCertificatesResult(outcome.GetResult()));
@@ -985,17 +1666,42 @@ ListCertificatesOutcome IoTClient::ListCertificates(const ListCertificatesReques
 
 ListCertificatesOutcomeCallable IoTClient::ListCertificatesCallable(const ListCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListCertificates, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListCertificatesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCertificates( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListCertificatesOutcome > rejected;
+    rejected.set_value(ListCertificatesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::ListCertificatesAsync(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListCertificatesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::ListCertificatesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListCertificatesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::ListCertificatesAsyncHelper(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListCertificates(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/certificates";
+
+  auto sharedRequest = Aws::MakeShared<ListCertificatesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListCertificates", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListCertificatesOutcome(ListCertificatesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListCertificatesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListPoliciesOutcome IoTClient::ListPolicies(const ListPoliciesRequest& request) const
@@ -1003,7 +1709,7 @@ ListPoliciesOutcome IoTClient::ListPolicies(const ListPoliciesRequest& request)
   Aws::StringStream ss;
   ss << m_uri << "/policies";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListPolicies");
   if(outcome.IsSuccess())
   {
     return ListPoliciesOutcome(ListPoliciesResult(outcome.GetResult()));
@@ -1016,17 +1722,42 @@ ListPoliciesOutcome IoTClient::ListPolicies(const ListPoliciesRequest& request)
 
 ListPoliciesOutcomeCallable IoTClient::ListPoliciesCallable(const ListPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListPolicies, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListPoliciesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListPolicies( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListPoliciesOutcome > rejected;
+    rejected.set_value(ListPoliciesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::ListPoliciesAsync(const ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListPoliciesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::ListPoliciesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListPoliciesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::ListPoliciesAsyncHelper(const ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListPolicies(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/policies";
+
+  auto sharedRequest = Aws::MakeShared<ListPoliciesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListPolicies", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListPoliciesOutcome(ListPoliciesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListPoliciesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListPolicyVersionsOutcome IoTClient::ListPolicyVersions(const ListPolicyVersionsRequest& request) const
@@ -1036,7 +1767,7 @@ ListPolicyVersionsOutcome IoTClient::ListPolicyVersions(const ListPolicyVersions
   ss << request.GetPolicyName();
   ss << "/version";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListPolicyVersions");
   if(outcome.IsSuccess())
   {
     return ListPolicyVersionsOutcome(ListPolicyVersionsResult(outcome.GetResult()));
@@ -1049,17 +1780,44 @@ ListPolicyVersionsOutcome IoTClient::ListPolicyVersions(const ListPolicyVersions
 
 ListPolicyVersionsOutcomeCallable IoTClient::ListPolicyVersionsCallable(const ListPolicyVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListPolicyVersions, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListPolicyVersionsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListPolicyVersions( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListPolicyVersionsOutcome > rejected;
+    rejected.set_value(ListPolicyVersionsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::ListPolicyVersionsAsync(const ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListPolicyVersionsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::ListPolicyVersionsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListPolicyVersionsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::ListPolicyVersionsAsyncHelper(const ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListPolicyVersions(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/policies/";
+  ss << request.GetPolicyName();
+  ss << "/version";
+
+  auto sharedRequest = Aws::MakeShared<ListPolicyVersionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListPolicyVersions", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListPolicyVersionsOutcome(ListPolicyVersionsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListPolicyVersionsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListPrincipalPoliciesOutcome IoTClient::ListPrincipalPolicies(const ListPrincipalPoliciesRequest& request) const
@@ -1067,7 +1825,7 @@ ListPrincipalPoliciesOutcome IoTClient::ListPrincipalPolicies(const ListPrincipa
   Aws::StringStream ss;
   ss << m_uri << "/principal-policies";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListPrincipalPolicies");
   if(outcome.IsSuccess())
   {
     return ListPrincipalPoliciesOutcome(ListPrincipalPoliciesResult(outcome.GetResult()));
@@ -1080,17 +1838,42 @@ ListPrincipalPoliciesOutcome IoTClient::ListPrincipalPolicies(const ListPrincipa
 
 ListPrincipalPoliciesOutcomeCallable IoTClient::ListPrincipalPoliciesCallable(const ListPrincipalPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListPrincipalPolicies, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListPrincipalPoliciesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListPrincipalPolicies( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListPrincipalPoliciesOutcome > rejected;
+    rejected.set_value(ListPrincipalPoliciesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::ListPrincipalPoliciesAsync(const ListPrincipalPoliciesRequest& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListPrincipalPoliciesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::ListPrincipalPoliciesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListPrincipalPoliciesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::ListPrincipalPoliciesAsyncHelper(const ListPrincipalPoliciesRequest& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListPrincipalPolicies(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/principal-policies";
+
+  auto sharedRequest = Aws::MakeShared<ListPrincipalPoliciesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListPrincipalPolicies", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListPrincipalPoliciesOutcome(ListPrincipalPoliciesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListPrincipalPoliciesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListPrincipalThingsOutcome IoTClient::ListPrincipalThings(const ListPrincipalThingsRequest& request) const
@@ -1098,7 +1881,7 @@ ListPrincipalThingsOutcome IoTClient::ListPrincipalThings(const ListPrincipalThi
   Aws::StringStream ss;
   ss << m_uri << "/principals/things";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListPrincipalThings");
   if(outcome.IsSuccess())
   {
     return ListPrincipalThingsOutcome(ListPrincipalThingsResult(outcome.GetResult()));
@@ -1111,17 +1894,42 @@ ListPrincipalThingsOutcome IoTClient::ListPrincipalThings(const ListPrincipalThi
 
 ListPrincipalThingsOutcomeCallable IoTClient::ListPrincipalThingsCallable(const ListPrincipalThingsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListPrincipalThings, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListPrincipalThingsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListPrincipalThings( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListPrincipalThingsOutcome > rejected;
+    rejected.set_value(ListPrincipalThingsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::ListPrincipalThingsAsync(const ListPrincipalThingsRequest& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListPrincipalThingsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::ListPrincipalThingsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListPrincipalThingsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::ListPrincipalThingsAsyncHelper(const ListPrincipalThingsRequest& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListPrincipalThings(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/principals/things";
+
+  auto sharedRequest = Aws::MakeShared<ListPrincipalThingsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListPrincipalThings", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListPrincipalThingsOutcome(ListPrincipalThingsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListPrincipalThingsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListThingPrincipalsOutcome IoTClient::ListThingPrincipals(const ListThingPrincipalsRequest& request) const
@@ -1131,7 +1939,7 @@ ListThingPrincipalsOutcome IoTClient::ListThingPrincipals(const ListThingPrincip
   ss << request.GetThingName();
   ss << "/principals";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListThingPrincipals");
   if(outcome.IsSuccess())
   {
     return ListThingPrincipalsOutcome(ListThingPrincipalsResult(outcome.GetResult()));
@@ -1144,17 +1952,44 @@ ListThingPrincipalsOutcome IoTClient::ListThingPrincipals(const ListThingPrincip
 
 ListThingPrincipalsOutcomeCallable IoTClient::ListThingPrincipalsCallable(const ListThingPrincipalsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListThingPrincipals, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListThingPrincipalsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListThingPrincipals( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListThingPrincipalsOutcome > rejected;
+    rejected.set_value(ListThingPrincipalsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::ListThingPrincipalsAsync(const ListThingPrincipalsRequest& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListThingPrincipalsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::ListThingPrincipalsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListThingPrincipalsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::ListThingPrincipalsAsyncHelper(const ListThingPrincipalsRequest& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListThingPrincipals(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/things/";
+  ss << request.GetThingName();
+  ss << "/principals";
+
+  auto sharedRequest = Aws::MakeShared<ListThingPrincipalsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListThingPrincipals", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListThingPrincipalsOutcome(ListThingPrincipalsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListThingPrincipalsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListThingsOutcome IoTClient::ListThings(const ListThingsRequest& request) const
@@ -1162,7 +1997,7 @@ ListThingsOutcome IoTClient::ListThings(const ListThingsRequest& request) const
   Aws::StringStream ss;
   ss << m_uri << "/things";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListThings");
   if(outcome.IsSuccess())
   {
     return ListThingsOutcome(ListThingsResult(outcome.GetResult()));
@@ -1175,17 +2010,42 @@ ListThingsOutcome IoTClient::ListThings(const ListThingsRequest& request) const
 
 ListThingsOutcomeCallable IoTClient::ListThingsCallable(const ListThingsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListThings, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListThingsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListThings( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListThingsOutcome > rejected;
+    rejected.set_value(ListThingsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::ListThingsAsync(const ListThingsRequest& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListThingsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::ListThingsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListThingsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::ListThingsAsyncHelper(const ListThingsRequest& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListThings(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/things";
+
+  auto sharedRequest = Aws::MakeShared<ListThingsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListThings", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListThingsOutcome(ListThingsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListThingsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListTopicRulesOutcome IoTClient::ListTopicRules(const ListTopicRulesRequest& request) const
@@ -1193,7 +2053,7 @@ ListTopicRulesOutcome IoTClient::ListTopicRules(const ListTopicRulesRequest& req
   Aws::StringStream ss;
   ss << m_uri << "/rules";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListTopicRules");
   if(outcome.IsSuccess())
   {
     return ListTopicRulesOutcome(ListTopicRulesResult(outcome.GetResult()));
@@ -1206,17 +2066,42 @@ ListTopicRulesOutcome IoTClient::ListTopicRules(const ListTopicRulesRequest& req
 
 ListTopicRulesOutcomeCallable IoTClient::ListTopicRulesCallable(const ListTopicRulesRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListTopicRules, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListTopicRulesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTopicRules( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListTopicRulesOutcome > rejected;
+    rejected.set_value(ListTopicRulesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::ListTopicRulesAsync(const ListTopicRulesRequest& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListTopicRulesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::ListTopicRulesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListTopicRulesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::ListTopicRulesAsyncHelper(const ListTopicRulesRequest& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTopicRules(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/rules";
+
+  auto sharedRequest = Aws::MakeShared<ListTopicRulesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListTopicRules", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTopicRulesOutcome(ListTopicRulesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTopicRulesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 RejectCertificateTransferOutcome IoTClient::RejectCertificateTransfer(const RejectCertificateTransferRequest& request) const
@@ -1225,7 +2110,7 @@ RejectCertificateTransferOutcome IoTClient::RejectCertificateTransfer(const Reje
   ss << m_uri << "/reject-certificate-transfer/";
   ss << request.GetCertificateId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "RejectCertificateTransfer");
   if(outcome.IsSuccess())
   {
     return RejectCertificateTransferOutcome(NoResult());
@@ -1238,17 +2123,43 @@ RejectCertificateTransferOutcome IoTClient::RejectCertificateTransfer(const Reje
 
 RejectCertificateTransferOutcomeCallable IoTClient::RejectCertificateTransferCallable(const RejectCertificateTransferRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::RejectCertificateTransfer, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< RejectCertificateTransferOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RejectCertificateTransfer( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< RejectCertificateTransferOutcome > rejected;
+    rejected.set_value(RejectCertificateTransferOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::RejectCertificateTransferAsync(const RejectCertificateTransferRequest& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::RejectCertificateTransferAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::RejectCertificateTransferAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, RejectCertificateTransferOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::RejectCertificateTransferAsyncHelper(const RejectCertificateTransferRequest& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, RejectCertificateTransfer(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/reject-certificate-transfer/";
+  ss << request.GetCertificateId();
+
+  auto sharedRequest = Aws::MakeShared<RejectCertificateTransferRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "RejectCertificateTransfer", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RejectCertificateTransferOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RejectCertificateTransferOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ReplaceTopicRuleOutcome IoTClient::ReplaceTopicRule(const ReplaceTopicRuleRequest& request) const
@@ -1257,7 +2168,7 @@ ReplaceTopicRuleOutcome IoTClient::ReplaceTopicRule(const ReplaceTopicRuleReques
   ss << m_uri << "/rules/";
   ss << request.GetRuleName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "ReplaceTopicRule");
   if(outcome.IsSuccess())
   {
     return ReplaceTopicRuleOutcome(NoResult());
@@ -1270,17 +2181,43 @@ ReplaceTopicRuleOutcome IoTClient::ReplaceTopicRule(const ReplaceTopicRuleReques
 
 ReplaceTopicRuleOutcomeCallable IoTClient::ReplaceTopicRuleCallable(const ReplaceTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ReplaceTopicRule, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ReplaceTopicRuleOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ReplaceTopicRule( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ReplaceTopicRuleOutcome > rejected;
+    rejected.set_value(ReplaceTopicRuleOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::ReplaceTopicRuleAsync(const ReplaceTopicRuleRequest& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ReplaceTopicRuleAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::ReplaceTopicRuleAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ReplaceTopicRuleOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::ReplaceTopicRuleAsyncHelper(const ReplaceTopicRuleRequest& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ReplaceTopicRule(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/rules/";
+  ss << request.GetRuleName();
+
+  auto sharedRequest = Aws::MakeShared<ReplaceTopicRuleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "ReplaceTopicRule", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ReplaceTopicRuleOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ReplaceTopicRuleOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SetDefaultPolicyVersionOutcome IoTClient::SetDefaultPolicyVersion(const SetDefaultPolicyVersionRequest& request) const
@@ -1291,7 +2228,7 @@ SetDefaultPolicyVersionOutcome IoTClient::SetDefaultPolicyVersion(const SetDefau
   ss << "/version/";
   ss << request.GetPolicyVersionId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "SetDefaultPolicyVersion");
   if(outcome.IsSuccess())
   {
     return SetDefaultPolicyVersionOutcome(NoResult());
@@ -1304,17 +2241,45 @@ SetDefaultPolicyVersionOutcome IoTClient::SetDefaultPolicyVersion(const SetDefau
 
 SetDefaultPolicyVersionOutcomeCallable IoTClient::SetDefaultPolicyVersionCallable(const SetDefaultPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::SetDefaultPolicyVersion, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetDefaultPolicyVersionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetDefaultPolicyVersion( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SetDefaultPolicyVersionOutcome > rejected;
+    rejected.set_value(SetDefaultPolicyVersionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::SetDefaultPolicyVersionAsync(const SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::SetDefaultPolicyVersionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::SetDefaultPolicyVersionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SetDefaultPolicyVersionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::SetDefaultPolicyVersionAsyncHelper(const SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SetDefaultPolicyVersion(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/policies/";
+  ss << request.GetPolicyName();
+  ss << "/version/";
+  ss << request.GetPolicyVersionId();
+
+  auto sharedRequest = Aws::MakeShared<SetDefaultPolicyVersionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "SetDefaultPolicyVersion", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetDefaultPolicyVersionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetDefaultPolicyVersionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SetLoggingOptionsOutcome IoTClient::SetLoggingOptions(const SetLoggingOptionsRequest& request) const
@@ -1322,7 +2287,7 @@ SetLoggingOptionsOutcome IoTClient::SetLoggingOptions(const SetLoggingOptionsReq
   Aws::StringStream ss;
   ss << m_uri << "/loggingOptions";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "SetLoggingOptions");
   if(outcome.IsSuccess())
   {
     return SetLoggingOptionsOutcome(NoResult());
@@ -1335,17 +2300,42 @@ SetLoggingOptionsOutcome IoTClient::SetLoggingOptions(const SetLoggingOptionsReq
 
 SetLoggingOptionsOutcomeCallable IoTClient::SetLoggingOptionsCallable(const SetLoggingOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::SetLoggingOptions, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetLoggingOptionsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetLoggingOptions( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SetLoggingOptionsOutcome > rejected;
+    rejected.set_value(SetLoggingOptionsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::SetLoggingOptionsAsync(const SetLoggingOptionsRequest& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::SetLoggingOptionsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::SetLoggingOptionsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SetLoggingOptionsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::SetLoggingOptionsAsyncHelper(const SetLoggingOptionsRequest& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SetLoggingOptions(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/loggingOptions";
+
+  auto sharedRequest = Aws::MakeShared<SetLoggingOptionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "SetLoggingOptions", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetLoggingOptionsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetLoggingOptionsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 TransferCertificateOutcome IoTClient::TransferCertificate(const TransferCertificateRequest& request) const
@@ -1354,7 +2344,7 @@ TransferCertificateOutcome IoTClient::TransferCertificate(const TransferCertific
   ss << m_uri << "/transfer-certificate/";
   ss << request.GetCertificateId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "TransferCertificate");
   if(outcome.IsSuccess())
   {
     return TransferCertificateOutcome(TransferCertificateResult(outcome.GetResult()));
@@ -1367,17 +2357,43 @@ TransferCertificateOutcome IoTClient::TransferCertificate(const TransferCertific
 
 TransferCertificateOutcomeCallable IoTClient::TransferCertificateCallable(const TransferCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::TransferCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< TransferCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TransferCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< TransferCertificateOutcome > rejected;
+    rejected.set_value(TransferCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::TransferCertificateAsync(const TransferCertificateRequest& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::TransferCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::TransferCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, TransferCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::TransferCertificateAsyncHelper(const TransferCertificateRequest& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, TransferCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/transfer-certificate/";
+  ss << request.GetCertificateId();
+
+  auto sharedRequest = Aws::MakeShared<TransferCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "TransferCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, TransferCertificateOutcome(TransferCertificateResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, TransferCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateCertificateOutcome IoTClient::UpdateCertificate(const UpdateCertificateRequest& request) const
@@ -1386,7 +2402,7 @@ UpdateCertificateOutcome IoTClient::UpdateCertificate(const UpdateCertificateReq
   ss << m_uri << "/certificates/";
   ss << request.GetCertificateId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "UpdateCertificate");
   if(outcome.IsSuccess())
   {
     return UpdateCertificateOutcome(NoResult());
@@ -1399,17 +2415,43 @@ UpdateCertificateOutcome IoTClient::UpdateCertificate(const UpdateCertificateReq
 
 UpdateCertificateOutcomeCallable IoTClient::UpdateCertificateCallable(const UpdateCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::UpdateCertificate, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateCertificateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateCertificate( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateCertificateOutcome > rejected;
+    rejected.set_value(UpdateCertificateOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::UpdateCertificateAsync(const UpdateCertificateRequest& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::UpdateCertificateAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::UpdateCertificateAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateCertificateOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::UpdateCertificateAsyncHelper(const UpdateCertificateRequest& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateCertificate(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/certificates/";
+  ss << request.GetCertificateId();
+
+  auto sharedRequest = Aws::MakeShared<UpdateCertificateRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "UpdateCertificate", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateCertificateOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateCertificateOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateThingOutcome IoTClient::UpdateThing(const UpdateThingRequest& request) const
@@ -1418,7 +2460,7 @@ UpdateThingOutcome IoTClient::UpdateThing(const UpdateThingRequest& request) con
   ss << m_uri << "/things/";
   ss << request.GetThingName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PATCH, "UpdateThing");
   if(outcome.IsSuccess())
   {
     return UpdateThingOutcome(UpdateThingResult(outcome.GetResult()));
@@ -1431,16 +2473,42 @@ UpdateThingOutcome IoTClient::UpdateThing(const UpdateThingRequest& request) con
 
 UpdateThingOutcomeCallable IoTClient::UpdateThingCallable(const UpdateThingRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::UpdateThing, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateThingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateThing( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateThingOutcome > rejected;
+    rejected.set_value(UpdateThingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void IoTClient::UpdateThingAsync(const UpdateThingRequest& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::UpdateThingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&IoTClient::UpdateThingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateThingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void IoTClient::UpdateThingAsyncHelper(const UpdateThingRequest& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateThing(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/things/";
+  ss << request.GetThingName();
+
+  auto sharedRequest = Aws::MakeShared<UpdateThingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PATCH, "UpdateThing", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateThingOutcome(UpdateThingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateThingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
@@ -40,6 +40,7 @@
 #include <aws/kms/model/ScheduleKeyDeletionResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -324,6 +325,33 @@ namespace Model
          */
         virtual void CancelKeyDeletionAsync(const Model::CancelKeyDeletionRequest& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels the deletion of a customer master key (CMK). When this operation is
+         * successful, the CMK is set to the <code>Disabled</code> state. To enable a CMK,
+         * use <a>EnableKey</a>.</p> <p>For more information about scheduling and canceling
+         * deletion of a CMK, go to <a
+         * href="http://docs.aws.amazon.com/kms/latest/developerguide/deleting-keys.html">Deleting
+         * Customer Master Keys</a> in the <i>AWS Key Management Service Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CancelKeyDeletionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelKeyDeletionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelKeyDeletionOutcome> CancelKeyDeletionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelKeyDeletionOutcome>([this, request](const std::function<void(Model::CancelKeyDeletionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelKeyDeletionAsync(request, [complete](const KMSClient*, const Model::CancelKeyDeletionRequest&, const Model::CancelKeyDeletionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelKeyDeletionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a display name for a customer master key. An alias can be used to
          * identify a key and should be unique. The console enforces a one-to-one mapping
@@ -367,6 +395,35 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a display name for a customer master key. An alias can be used to
+         * identify a key and should be unique. The console enforces a one-to-one mapping
+         * between the alias and a key. An alias name can contain only alphanumeric
+         * characters, forward slashes (/), underscores (_), and dashes (-). An alias must
+         * start with the word "alias" followed by a forward slash (alias/). An alias that
+         * begins with "aws" after the forward slash (alias/aws...) is reserved by Amazon
+         * Web Services (AWS). </p> <p>The alias and the key it is mapped to must be in the
+         * same AWS account and the same region.</p> <p>To map an alias to a different key,
+         * call <a>UpdateAlias</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAliasOutcome>([this, request](const std::function<void(Model::CreateAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAliasAsync(request, [complete](const KMSClient*, const Model::CreateAliasRequest&, const Model::CreateAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds a grant to a key to specify who can use the key and under what
          * conditions. Grants are alternate permission mechanisms to key policies.</p>
@@ -398,6 +455,31 @@ namespace Model
          */
         virtual void CreateGrantAsync(const Model::CreateGrantRequest& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds a grant to a key to specify who can use the key and under what
+         * conditions. Grants are alternate permission mechanisms to key policies.</p>
+         * <p>For more information about grants, see <a
+         * href="http://docs.aws.amazon.com/kms/latest/developerguide/grants.html">Grants</a>
+         * in the <i>AWS Key Management Service Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateGrantAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateGrantRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateGrantOutcome> CreateGrantAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateGrantOutcome>([this, request](const std::function<void(Model::CreateGrantOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateGrantAsync(request, [complete](const KMSClient*, const Model::CreateGrantRequest&, const Model::CreateGrantOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateGrantOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a customer master key. Customer master keys can be used to encrypt
          * small amounts of data (less than 4K) directly, but they are most commonly used
@@ -429,6 +511,31 @@ namespace Model
          */
         virtual void CreateKeyAsync(const Model::CreateKeyRequest& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a customer master key. Customer master keys can be used to encrypt
+         * small amounts of data (less than 4K) directly, but they are most commonly used
+         * to encrypt or envelope data keys that are then used to encrypt customer data.
+         * For more information about data keys, see <a>GenerateDataKey</a> and
+         * <a>GenerateDataKeyWithoutPlaintext</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateKeyOutcome> CreateKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateKeyOutcome>([this, request](const std::function<void(Model::CreateKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateKeyAsync(request, [complete](const KMSClient*, const Model::CreateKeyRequest&, const Model::CreateKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Decrypts ciphertext. Ciphertext is plaintext that has been previously
          * encrypted by using any of the following functions: <ul>
@@ -481,6 +588,38 @@ namespace Model
          */
         virtual void DecryptAsync(const Model::DecryptRequest& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Decrypts ciphertext. Ciphertext is plaintext that has been previously
+         * encrypted by using any of the following functions: <ul>
+         * <li><a>GenerateDataKey</a></li> <li><a>GenerateDataKeyWithoutPlaintext</a></li>
+         * <li><a>Encrypt</a></li> </ul> </p> <p>Note that if a caller has been granted
+         * access permissions to all keys (through, for example, IAM user policies that
+         * grant <code>Decrypt</code> permission on all resources), then ciphertext
+         * encrypted by using keys in other accounts where the key grants access to the
+         * caller can be decrypted. To remedy this, we recommend that you do not grant
+         * <code>Decrypt</code> access in an IAM user policy. Instead grant
+         * <code>Decrypt</code> access only in key policies. If you must grant
+         * <code>Decrypt</code> access in an IAM user policy, you should scope the resource
+         * to specific keys or to specific trusted accounts. </p>
+         *
+         * Returns an awaitable that starts the operation the way DecryptAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DecryptRequest>
+        Aws::Utils::Threading::Awaitable<Model::DecryptOutcome> DecryptAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DecryptOutcome>([this, request](const std::function<void(Model::DecryptOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DecryptAsync(request, [complete](const KMSClient*, const Model::DecryptRequest&, const Model::DecryptOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DecryptOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified alias. To map an alias to a different key, call
          * <a>UpdateAlias</a>.</p>
@@ -503,6 +642,28 @@ namespace Model
          */
         virtual void DeleteAliasAsync(const Model::DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified alias. To map an alias to a different key, call
+         * <a>UpdateAlias</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAliasOutcome> DeleteAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAliasOutcome>([this, request](const std::function<void(Model::DeleteAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAliasAsync(request, [complete](const KMSClient*, const Model::DeleteAliasRequest&, const Model::DeleteAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Provides detailed information about the specified customer master key.</p>
          */
@@ -522,6 +683,27 @@ namespace Model
          */
         virtual void DescribeKeyAsync(const Model::DescribeKeyRequest& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Provides detailed information about the specified customer master key.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeKeyOutcome> DescribeKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeKeyOutcome>([this, request](const std::function<void(Model::DescribeKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeKeyAsync(request, [complete](const KMSClient*, const Model::DescribeKeyRequest&, const Model::DescribeKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the state of a master key to disabled, thereby preventing its use for
          * cryptographic operations. For more information about how key state affects the
@@ -556,6 +738,32 @@ namespace Model
          */
         virtual void DisableKeyAsync(const Model::DisableKeyRequest& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the state of a master key to disabled, thereby preventing its use for
+         * cryptographic operations. For more information about how key state affects the
+         * use of a master key, go to <a
+         * href="http://docs.aws.amazon.com/kms/latest/developerguide/key-state.html">How
+         * Key State Affects the Use of a Customer Master Key</a> in the <i>AWS Key
+         * Management Service Developer Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableKeyOutcome> DisableKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableKeyOutcome>([this, request](const std::function<void(Model::DisableKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableKeyAsync(request, [complete](const KMSClient*, const Model::DisableKeyRequest&, const Model::DisableKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables rotation of the specified key.</p>
          */
@@ -575,6 +783,27 @@ namespace Model
          */
         virtual void DisableKeyRotationAsync(const Model::DisableKeyRotationRequest& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables rotation of the specified key.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableKeyRotationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableKeyRotationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableKeyRotationOutcome> DisableKeyRotationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableKeyRotationOutcome>([this, request](const std::function<void(Model::DisableKeyRotationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableKeyRotationAsync(request, [complete](const KMSClient*, const Model::DisableKeyRotationRequest&, const Model::DisableKeyRotationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableKeyRotationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Marks a key as enabled, thereby permitting its use.</p>
          */
@@ -594,6 +823,27 @@ namespace Model
          */
         virtual void EnableKeyAsync(const Model::EnableKeyRequest& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Marks a key as enabled, thereby permitting its use.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableKeyOutcome> EnableKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableKeyOutcome>([this, request](const std::function<void(Model::EnableKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableKeyAsync(request, [complete](const KMSClient*, const Model::EnableKeyRequest&, const Model::EnableKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables rotation of the specified customer master key.</p>
          */
@@ -613,6 +863,27 @@ namespace Model
          */
         virtual void EnableKeyRotationAsync(const Model::EnableKeyRotationRequest& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables rotation of the specified customer master key.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableKeyRotationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableKeyRotationRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableKeyRotationOutcome> EnableKeyRotationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableKeyRotationOutcome>([this, request](const std::function<void(Model::EnableKeyRotationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableKeyRotationAsync(request, [complete](const KMSClient*, const Model::EnableKeyRotationRequest&, const Model::EnableKeyRotationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableKeyRotationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Encrypts plaintext into ciphertext by using a customer master key. The
          * <code>Encrypt</code> function has two primary use cases: <ul> <li>You can
@@ -677,6 +948,42 @@ namespace Model
          */
         virtual void EncryptAsync(const Model::EncryptRequest& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Encrypts plaintext into ciphertext by using a customer master key. The
+         * <code>Encrypt</code> function has two primary use cases: <ul> <li>You can
+         * encrypt up to 4 KB of arbitrary data such as an RSA key, a database password, or
+         * other sensitive customer information.</li> <li>If you are moving encrypted data
+         * from one region to another, you can use this API to encrypt in the new region
+         * the plaintext data key that was used to encrypt the data in the original region.
+         * This provides you with an encrypted copy of the data key that can be decrypted
+         * in the new region and used there to decrypt the encrypted data. </li> </ul> </p>
+         * <p>Unless you are moving encrypted data from one region to another, you don't
+         * use this function to encrypt a generated data key within a region. You retrieve
+         * data keys already encrypted by calling the <a>GenerateDataKey</a> or
+         * <a>GenerateDataKeyWithoutPlaintext</a> function. Data keys don't need to be
+         * encrypted again by calling <code>Encrypt</code>. </p> <p>If you want to encrypt
+         * data locally in your application, you can use the <code>GenerateDataKey</code>
+         * function to return a plaintext data encryption key and a copy of the key
+         * encrypted under the customer master key (CMK) of your choosing. </p>
+         *
+         * Returns an awaitable that starts the operation the way EncryptAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EncryptRequest>
+        Aws::Utils::Threading::Awaitable<Model::EncryptOutcome> EncryptAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EncryptOutcome>([this, request](const std::function<void(Model::EncryptOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EncryptAsync(request, [complete](const KMSClient*, const Model::EncryptRequest&, const Model::EncryptOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EncryptOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Generates a data key that you can use in your application to locally encrypt
          * data. This call returns a plaintext version of the key in the
@@ -780,6 +1087,55 @@ namespace Model
          */
         virtual void GenerateDataKeyAsync(const Model::GenerateDataKeyRequest& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Generates a data key that you can use in your application to locally encrypt
+         * data. This call returns a plaintext version of the key in the
+         * <code>Plaintext</code> field of the response object and an encrypted copy of the
+         * key in the <code>CiphertextBlob</code> field. The key is encrypted by using the
+         * master key specified by the <code>KeyId</code> field. To decrypt the encrypted
+         * key, pass it to the <code>Decrypt</code> API. </p> <p>We recommend that you use
+         * the following pattern to locally encrypt data: call the
+         * <code>GenerateDataKey</code> API, use the key returned in the
+         * <code>Plaintext</code> response field to locally encrypt data, and then erase
+         * the plaintext data key from memory. Store the encrypted data key (contained in
+         * the <code>CiphertextBlob</code> field) alongside of the locally encrypted data.
+         * </p> <note>You should not call the <code>Encrypt</code> function to re-encrypt
+         * your data keys within a region. <code>GenerateDataKey</code> always returns the
+         * data key encrypted and tied to the customer master key that will be used to
+         * decrypt it. There is no need to decrypt it twice. </note> <p>If you decide to
+         * use the optional <code>EncryptionContext</code> parameter, you must also store
+         * the context in full or at least store enough information along with the
+         * encrypted data to be able to reconstruct the context when submitting the
+         * ciphertext to the <code>Decrypt</code> API. It is a good practice to choose a
+         * context that you can reconstruct on the fly to better secure the ciphertext. For
+         * more information about how this parameter is used, see <a
+         * href="http://docs.aws.amazon.com/kms/latest/developerguide/encrypt-context.html">Encryption
+         * Context</a>. </p> <p>To decrypt data, pass the encrypted data key to the
+         * <code>Decrypt</code> API. <code>Decrypt</code> uses the associated master key to
+         * decrypt the encrypted data key and returns it as plaintext. Use the plaintext
+         * data key to locally decrypt your data and then erase the key from memory. You
+         * must specify the encryption context, if any, that you specified when you
+         * generated the key. The encryption context is logged by CloudTrail, and you can
+         * use this log to help track the use of particular data. </p>
+         *
+         * Returns an awaitable that starts the operation the way GenerateDataKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GenerateDataKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GenerateDataKeyOutcome> GenerateDataKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GenerateDataKeyOutcome>([this, request](const std::function<void(Model::GenerateDataKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GenerateDataKeyAsync(request, [complete](const KMSClient*, const Model::GenerateDataKeyRequest&, const Model::GenerateDataKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GenerateDataKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a data key encrypted by a customer master key without the plaintext
          * copy of that key. Otherwise, this API functions exactly like
@@ -811,6 +1167,31 @@ namespace Model
          */
         virtual void GenerateDataKeyWithoutPlaintextAsync(const Model::GenerateDataKeyWithoutPlaintextRequest& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a data key encrypted by a customer master key without the plaintext
+         * copy of that key. Otherwise, this API functions exactly like
+         * <a>GenerateDataKey</a>. You can use this API to, for example, satisfy an audit
+         * requirement that an encrypted key be made available without exposing the
+         * plaintext copy of that key. </p>
+         *
+         * Returns an awaitable that starts the operation the way GenerateDataKeyWithoutPlaintextAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GenerateDataKeyWithoutPlaintextRequest>
+        Aws::Utils::Threading::Awaitable<Model::GenerateDataKeyWithoutPlaintextOutcome> GenerateDataKeyWithoutPlaintextAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GenerateDataKeyWithoutPlaintextOutcome>([this, request](const std::function<void(Model::GenerateDataKeyWithoutPlaintextOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GenerateDataKeyWithoutPlaintextAsync(request, [complete](const KMSClient*, const Model::GenerateDataKeyWithoutPlaintextRequest&, const Model::GenerateDataKeyWithoutPlaintextOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GenerateDataKeyWithoutPlaintextOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Generates an unpredictable byte string. </p>
          */
@@ -830,6 +1211,27 @@ namespace Model
          */
         virtual void GenerateRandomAsync(const Model::GenerateRandomRequest& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Generates an unpredictable byte string. </p>
+         *
+         * Returns an awaitable that starts the operation the way GenerateRandomAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GenerateRandomRequest>
+        Aws::Utils::Threading::Awaitable<Model::GenerateRandomOutcome> GenerateRandomAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GenerateRandomOutcome>([this, request](const std::function<void(Model::GenerateRandomOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GenerateRandomAsync(request, [complete](const KMSClient*, const Model::GenerateRandomRequest&, const Model::GenerateRandomOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GenerateRandomOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves a policy attached to the specified key.</p>
          */
@@ -849,6 +1251,27 @@ namespace Model
          */
         virtual void GetKeyPolicyAsync(const Model::GetKeyPolicyRequest& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves a policy attached to the specified key.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetKeyPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetKeyPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetKeyPolicyOutcome> GetKeyPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetKeyPolicyOutcome>([this, request](const std::function<void(Model::GetKeyPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetKeyPolicyAsync(request, [complete](const KMSClient*, const Model::GetKeyPolicyRequest&, const Model::GetKeyPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetKeyPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves a Boolean value that indicates whether key rotation is enabled for
          * the specified key.</p>
@@ -871,6 +1294,28 @@ namespace Model
          */
         virtual void GetKeyRotationStatusAsync(const Model::GetKeyRotationStatusRequest& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves a Boolean value that indicates whether key rotation is enabled for
+         * the specified key.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetKeyRotationStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetKeyRotationStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetKeyRotationStatusOutcome> GetKeyRotationStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetKeyRotationStatusOutcome>([this, request](const std::function<void(Model::GetKeyRotationStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetKeyRotationStatusAsync(request, [complete](const KMSClient*, const Model::GetKeyRotationStatusRequest&, const Model::GetKeyRotationStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetKeyRotationStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all of the key aliases in the account.</p>
          */
@@ -890,6 +1335,27 @@ namespace Model
          */
         virtual void ListAliasesAsync(const Model::ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all of the key aliases in the account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListAliasesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAliasesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAliasesOutcome> ListAliasesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAliasesOutcome>([this, request](const std::function<void(Model::ListAliasesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAliasesAsync(request, [complete](const KMSClient*, const Model::ListAliasesRequest&, const Model::ListAliasesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAliasesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>List the grants for a specified key.</p>
          */
@@ -909,6 +1375,27 @@ namespace Model
          */
         virtual void ListGrantsAsync(const Model::ListGrantsRequest& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>List the grants for a specified key.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListGrantsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListGrantsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListGrantsOutcome> ListGrantsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListGrantsOutcome>([this, request](const std::function<void(Model::ListGrantsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListGrantsAsync(request, [complete](const KMSClient*, const Model::ListGrantsRequest&, const Model::ListGrantsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListGrantsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves a list of policies attached to a key.</p>
          */
@@ -928,6 +1415,27 @@ namespace Model
          */
         virtual void ListKeyPoliciesAsync(const Model::ListKeyPoliciesRequest& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves a list of policies attached to a key.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListKeyPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListKeyPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListKeyPoliciesOutcome> ListKeyPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListKeyPoliciesOutcome>([this, request](const std::function<void(Model::ListKeyPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListKeyPoliciesAsync(request, [complete](const KMSClient*, const Model::ListKeyPoliciesRequest&, const Model::ListKeyPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListKeyPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the customer master keys.</p>
          */
@@ -947,6 +1455,27 @@ namespace Model
          */
         virtual void ListKeysAsync(const Model::ListKeysRequest& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the customer master keys.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListKeysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListKeysRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListKeysOutcome> ListKeysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListKeysOutcome>([this, request](const std::function<void(Model::ListKeysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListKeysAsync(request, [complete](const KMSClient*, const Model::ListKeysRequest&, const Model::ListKeysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListKeysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of all grants for which the grant's
          * <code>RetiringPrincipal</code> matches the one specified.</p> <p>A typical use
@@ -975,6 +1504,30 @@ namespace Model
          */
         virtual void ListRetirableGrantsAsync(const Model::ListRetirableGrantsRequest& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of all grants for which the grant's
+         * <code>RetiringPrincipal</code> matches the one specified.</p> <p>A typical use
+         * is to list all grants that you are able to retire. To retire a grant, use
+         * <a>RetireGrant</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListRetirableGrantsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRetirableGrantsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRetirableGrantsOutcome> ListRetirableGrantsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRetirableGrantsOutcome>([this, request](const std::function<void(Model::ListRetirableGrantsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRetirableGrantsAsync(request, [complete](const KMSClient*, const Model::ListRetirableGrantsRequest&, const Model::ListRetirableGrantsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRetirableGrantsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches a policy to the specified key.</p>
          */
@@ -994,6 +1547,27 @@ namespace Model
          */
         virtual void PutKeyPolicyAsync(const Model::PutKeyPolicyRequest& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches a policy to the specified key.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutKeyPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutKeyPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutKeyPolicyOutcome> PutKeyPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutKeyPolicyOutcome>([this, request](const std::function<void(Model::PutKeyPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutKeyPolicyAsync(request, [complete](const KMSClient*, const Model::PutKeyPolicyRequest&, const Model::PutKeyPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutKeyPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Encrypts data on the server side with a new customer master key without
          * exposing the plaintext of the data on the client side. The data is first
@@ -1043,6 +1617,37 @@ namespace Model
          */
         virtual void ReEncryptAsync(const Model::ReEncryptRequest& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Encrypts data on the server side with a new customer master key without
+         * exposing the plaintext of the data on the client side. The data is first
+         * decrypted and then encrypted. This operation can also be used to change the
+         * encryption context of a ciphertext. </p> <p>Unlike other actions,
+         * <code>ReEncrypt</code> is authorized twice - once as <code>ReEncryptFrom</code>
+         * on the source key and once as <code>ReEncryptTo</code> on the destination key.
+         * We therefore recommend that you include the
+         * <code>"action":"kms:ReEncrypt*"</code> statement in your key policies to permit
+         * re-encryption from or to the key. The statement is included automatically when
+         * you authorize use of the key through the console but must be included manually
+         * when you set a policy by using the <a>PutKeyPolicy</a> function. </p>
+         *
+         * Returns an awaitable that starts the operation the way ReEncryptAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReEncryptRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReEncryptOutcome> ReEncryptAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReEncryptOutcome>([this, request](const std::function<void(Model::ReEncryptOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReEncryptAsync(request, [complete](const KMSClient*, const Model::ReEncryptRequest&, const Model::ReEncryptOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReEncryptOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retires a grant. You can retire a grant when you're done using it to clean
          * up. You should revoke a grant when you intend to actively deny operations that
@@ -1089,6 +1694,36 @@ namespace Model
          */
         virtual void RetireGrantAsync(const Model::RetireGrantRequest& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retires a grant. You can retire a grant when you're done using it to clean
+         * up. You should revoke a grant when you intend to actively deny operations that
+         * depend on it. The following are permitted to call this API: <ul> <li>The account
+         * that created the grant</li> <li>The <code>RetiringPrincipal</code>, if
+         * present</li> <li>The <code>GranteePrincipal</code>, if <code>RetireGrant</code>
+         * is a grantee operation</li> </ul> The grant to retire must be identified by its
+         * grant token or by a combination of the key ARN and the grant ID. A grant token
+         * is a unique variable-length base64-encoded string. A grant ID is a 64 character
+         * unique identifier of a grant. Both are returned by the <code>CreateGrant</code>
+         * function. </p>
+         *
+         * Returns an awaitable that starts the operation the way RetireGrantAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RetireGrantRequest>
+        Aws::Utils::Threading::Awaitable<Model::RetireGrantOutcome> RetireGrantAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RetireGrantOutcome>([this, request](const std::function<void(Model::RetireGrantOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RetireGrantAsync(request, [complete](const KMSClient*, const Model::RetireGrantRequest&, const Model::RetireGrantOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RetireGrantOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Revokes a grant. You can revoke a grant to actively deny operations that
          * depend on it.</p>
@@ -1111,6 +1746,28 @@ namespace Model
          */
         virtual void RevokeGrantAsync(const Model::RevokeGrantRequest& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Revokes a grant. You can revoke a grant to actively deny operations that
+         * depend on it.</p>
+         *
+         * Returns an awaitable that starts the operation the way RevokeGrantAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RevokeGrantRequest>
+        Aws::Utils::Threading::Awaitable<Model::RevokeGrantOutcome> RevokeGrantAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RevokeGrantOutcome>([this, request](const std::function<void(Model::RevokeGrantOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RevokeGrantAsync(request, [complete](const KMSClient*, const Model::RevokeGrantRequest&, const Model::RevokeGrantOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RevokeGrantOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Schedules the deletion of a customer master key (CMK). You may provide a
          * waiting period, specified in days, before deletion occurs. If you do not provide
@@ -1172,6 +1829,41 @@ namespace Model
          */
         virtual void ScheduleKeyDeletionAsync(const Model::ScheduleKeyDeletionRequest& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Schedules the deletion of a customer master key (CMK). You may provide a
+         * waiting period, specified in days, before deletion occurs. If you do not provide
+         * a waiting period, the default period of 30 days is used. When this operation is
+         * successful, the state of the CMK changes to <code>PendingDeletion</code>. Before
+         * the waiting period ends, you can use <a>CancelKeyDeletion</a> to cancel the
+         * deletion of the CMK. After the waiting period ends, AWS KMS deletes the CMK and
+         * all AWS KMS data associated with it, including all aliases that point to it.</p>
+         * <important> <p>Deleting a CMK is a destructive and potentially dangerous
+         * operation. When a CMK is deleted, all data that was encrypted under the CMK is
+         * rendered unrecoverable. To restrict the use of a CMK without deleting it, use
+         * <a>DisableKey</a>.</p> </important> <p>For more information about scheduling a
+         * CMK for deletion, go to <a
+         * href="http://docs.aws.amazon.com/kms/latest/developerguide/deleting-keys.html">Deleting
+         * Customer Master Keys</a> in the <i>AWS Key Management Service Developer
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ScheduleKeyDeletionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ScheduleKeyDeletionRequest>
+        Aws::Utils::Threading::Awaitable<Model::ScheduleKeyDeletionOutcome> ScheduleKeyDeletionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ScheduleKeyDeletionOutcome>([this, request](const std::function<void(Model::ScheduleKeyDeletionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ScheduleKeyDeletionAsync(request, [complete](const KMSClient*, const Model::ScheduleKeyDeletionRequest&, const Model::ScheduleKeyDeletionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ScheduleKeyDeletionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates an alias to map it to a different key.</p> <p>An alias is not a
          * property of a key. Therefore, an alias can be mapped to and unmapped from an
@@ -1212,6 +1904,34 @@ namespace Model
          */
         virtual void UpdateAliasAsync(const Model::UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates an alias to map it to a different key.</p> <p>An alias is not a
+         * property of a key. Therefore, an alias can be mapped to and unmapped from an
+         * existing key without changing the properties of the key. </p> <p>An alias name
+         * can contain only alphanumeric characters, forward slashes (/), underscores (_),
+         * and dashes (-). An alias must start with the word "alias" followed by a forward
+         * slash (alias/). An alias that begins with "aws" after the forward slash
+         * (alias/aws...) is reserved by Amazon Web Services (AWS). </p> <p>The alias and
+         * the key it is mapped to must be in the same AWS account and the same region.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAliasOutcome> UpdateAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAliasOutcome>([this, request](const std::function<void(Model::UpdateAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAliasAsync(request, [complete](const KMSClient*, const Model::UpdateAliasRequest&, const Model::UpdateAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the description of a key.</p>
          */
@@ -1231,6 +1951,27 @@ namespace Model
          */
         virtual void UpdateKeyDescriptionAsync(const Model::UpdateKeyDescriptionRequest& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the description of a key.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateKeyDescriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateKeyDescriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateKeyDescriptionOutcome> UpdateKeyDescriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateKeyDescriptionOutcome>([this, request](const std::function<void(Model::UpdateKeyDescriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateKeyDescriptionAsync(request, [complete](const KMSClient*, const Model::UpdateKeyDescriptionRequest&, const Model::UpdateKeyDescriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateKeyDescriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
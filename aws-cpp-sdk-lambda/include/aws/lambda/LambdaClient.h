@@ -42,6 +42,7 @@
 #include <aws/lambda/model/UpdateFunctionConfigurationResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -279,6 +280,40 @@ namespace Model
          */
         virtual void AddPermissionAsync(const Model::AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds a permission to the resource policy associated with the specified AWS
+         * Lambda function. You use resource policies to grant permissions to event sources
+         * that use <i>push</i> model. In a <i>push</i> model, event sources (such as
+         * Amazon S3 and custom applications) invoke your Lambda function. Each permission
+         * you add to the resource policy allows an event source, permission to invoke the
+         * Lambda function. </p> <p>For information about the push model, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/lambda-introduction.html">AWS
+         * Lambda: How it Works</a>. </p> <p>If you are using versioning, the permissions
+         * you add are specific to the Lambda function version or alias you specify in the
+         * <code>AddPermission</code> request via the <code>Qualifier</code> parameter. For
+         * more information about versioning, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> <p>This operation requires
+         * permission for the <code>lambda:AddPermission</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddPermissionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddPermissionRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddPermissionOutcome> AddPermissionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddPermissionOutcome>([this, request](const std::function<void(Model::AddPermissionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddPermissionAsync(request, [complete](const LambdaClient*, const Model::AddPermissionRequest&, const Model::AddPermissionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddPermissionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an alias that points to the specified Lambda function version. For
          * more information, see <a
@@ -310,6 +345,31 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an alias that points to the specified Lambda function version. For
+         * more information, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/aliases-intro.html">Introduction
+         * to AWS Lambda Aliases</a>.</p> Alias names are unique for a given function.
+         * <p>This requires permission for the lambda:CreateAlias action.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAliasOutcome>([this, request](const std::function<void(Model::CreateAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAliasAsync(request, [complete](const LambdaClient*, const Model::CreateAliasRequest&, const Model::CreateAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Identifies a stream as an event source for a Lambda function. It can be
          * either an Amazon Kinesis stream or an Amazon DynamoDB stream. AWS Lambda invokes
@@ -383,6 +443,45 @@ namespace Model
          */
         virtual void CreateEventSourceMappingAsync(const Model::CreateEventSourceMappingRequest& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Identifies a stream as an event source for a Lambda function. It can be
+         * either an Amazon Kinesis stream or an Amazon DynamoDB stream. AWS Lambda invokes
+         * the specified function when records are posted to the stream.</p> <p>This
+         * association between a stream source and a Lambda function is called the event
+         * source mapping. </p> <important>This event source mapping is relevant only in
+         * the AWS Lambda pull model, where AWS Lambda invokes the function. For more
+         * information, go to <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/lambda-introduction.html">AWS
+         * Lambda: How it Works</a> in the <i>AWS Lambda Developer Guide</i>.</important>
+         * <p> You provide mapping information (for example, which stream to read from and
+         * which Lambda function to invoke) in the request body. </p> <p> Each event
+         * source, such as an Amazon Kinesis or a DynamoDB stream, can be associated with
+         * multiple AWS Lambda function. A given Lambda function can be associated with
+         * multiple AWS event sources. </p> <p> <p>If you are using versioning, you can
+         * specify a specific function version or an alias via the function name parameter.
+         * For more information about versioning, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> </p> <p>This operation requires
+         * permission for the <code>lambda:CreateEventSourceMapping</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateEventSourceMappingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateEventSourceMappingRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateEventSourceMappingOutcome> CreateEventSourceMappingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateEventSourceMappingOutcome>([this, request](const std::function<void(Model::CreateEventSourceMappingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateEventSourceMappingAsync(request, [complete](const LambdaClient*, const Model::CreateEventSourceMappingRequest&, const Model::CreateEventSourceMappingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateEventSourceMappingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new Lambda function. The function metadata is created from the
          * request parameters, and the code for the function is provided by a .zip file in
@@ -429,6 +528,36 @@ namespace Model
          */
         virtual void CreateFunctionAsync(const Model::CreateFunctionRequest& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new Lambda function. The function metadata is created from the
+         * request parameters, and the code for the function is provided by a .zip file in
+         * the request body. If the function name already exists, the operation will fail.
+         * Note that the function name is case-sensitive. </p> <p> If you are using
+         * versioning, you can also publish a version of the Lambda function you are
+         * creating using the <code>Publish</code> parameter. For more information about
+         * versioning, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> <p>This operation requires
+         * permission for the <code>lambda:CreateFunction</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateFunctionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateFunctionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateFunctionOutcome> CreateFunctionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateFunctionOutcome>([this, request](const std::function<void(Model::CreateFunctionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateFunctionAsync(request, [complete](const LambdaClient*, const Model::CreateFunctionRequest&, const Model::CreateFunctionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateFunctionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified Lambda function alias. For more information, see <a
          * href="http://docs.aws.amazon.com/lambda/latest/dg/aliases-intro.html">Introduction
@@ -457,6 +586,30 @@ namespace Model
          */
         virtual void DeleteAliasAsync(const Model::DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified Lambda function alias. For more information, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/aliases-intro.html">Introduction
+         * to AWS Lambda Aliases</a>.</p> <p>This requires permission for the
+         * lambda:DeleteAlias action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAliasOutcome> DeleteAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAliasOutcome>([this, request](const std::function<void(Model::DeleteAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAliasAsync(request, [complete](const LambdaClient*, const Model::DeleteAliasRequest&, const Model::DeleteAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes an event source mapping. This means AWS Lambda will no longer invoke
          * the function for events in the associated source.</p> <p>This operation requires
@@ -482,6 +635,29 @@ namespace Model
          */
         virtual void DeleteEventSourceMappingAsync(const Model::DeleteEventSourceMappingRequest& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes an event source mapping. This means AWS Lambda will no longer invoke
+         * the function for events in the associated source.</p> <p>This operation requires
+         * permission for the <code>lambda:DeleteEventSourceMapping</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteEventSourceMappingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteEventSourceMappingRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteEventSourceMappingOutcome> DeleteEventSourceMappingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteEventSourceMappingOutcome>([this, request](const std::function<void(Model::DeleteEventSourceMappingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteEventSourceMappingAsync(request, [complete](const LambdaClient*, const Model::DeleteEventSourceMappingRequest&, const Model::DeleteEventSourceMappingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteEventSourceMappingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified Lambda function code and configuration.</p> <p>If you
          * are using the versioning feature and you don't specify a function version in
@@ -534,6 +710,38 @@ namespace Model
          */
         virtual void DeleteFunctionAsync(const Model::DeleteFunctionRequest& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified Lambda function code and configuration.</p> <p>If you
+         * are using the versioning feature and you don't specify a function version in
+         * your <code>DeleteFunction</code> request, AWS Lambda will delete the function,
+         * including all its versions, and any aliases pointing to the function versions.
+         * To delete a specific function version, you must provide the function version via
+         * the <code>Qualifier</code> parameter. For information about function versioning,
+         * see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> <p>When you delete a function
+         * the associated resource policy is also deleted. You will need to delete the
+         * event source mappings explicitly.</p> <p>This operation requires permission for
+         * the <code>lambda:DeleteFunction</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteFunctionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteFunctionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteFunctionOutcome> DeleteFunctionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteFunctionOutcome>([this, request](const std::function<void(Model::DeleteFunctionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteFunctionAsync(request, [complete](const LambdaClient*, const Model::DeleteFunctionRequest&, const Model::DeleteFunctionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteFunctionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the specified alias information such as the alias ARN, description,
          * and function version it is pointing to. For more information, see <a
@@ -565,6 +773,31 @@ namespace Model
          */
         virtual void GetAliasAsync(const Model::GetAliasRequest& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the specified alias information such as the alias ARN, description,
+         * and function version it is pointing to. For more information, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/aliases-intro.html">Introduction
+         * to AWS Lambda Aliases</a>.</p> <p>This requires permission for the
+         * <code>lambda:GetAlias</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAliasOutcome> GetAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAliasOutcome>([this, request](const std::function<void(Model::GetAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAliasAsync(request, [complete](const LambdaClient*, const Model::GetAliasRequest&, const Model::GetAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns configuration information for the specified event source mapping (see
          * <a>CreateEventSourceMapping</a>).</p> <p>This operation requires permission for
@@ -590,6 +823,29 @@ namespace Model
          */
         virtual void GetEventSourceMappingAsync(const Model::GetEventSourceMappingRequest& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns configuration information for the specified event source mapping (see
+         * <a>CreateEventSourceMapping</a>).</p> <p>This operation requires permission for
+         * the <code>lambda:GetEventSourceMapping</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetEventSourceMappingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetEventSourceMappingRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetEventSourceMappingOutcome> GetEventSourceMappingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetEventSourceMappingOutcome>([this, request](const std::function<void(Model::GetEventSourceMappingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetEventSourceMappingAsync(request, [complete](const LambdaClient*, const Model::GetEventSourceMappingRequest&, const Model::GetEventSourceMappingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetEventSourceMappingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the configuration information of the Lambda function and a presigned
          * URL link to the .zip file you uploaded with <a>CreateFunction</a> so you can
@@ -642,6 +898,38 @@ namespace Model
          */
         virtual void GetFunctionAsync(const Model::GetFunctionRequest& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the configuration information of the Lambda function and a presigned
+         * URL link to the .zip file you uploaded with <a>CreateFunction</a> so you can
+         * download the .zip file. Note that the URL is valid for up to 10 minutes. The
+         * configuration information is the same information you provided as parameters
+         * when uploading the function.</p> <p>Using the optional <code>Qualifier</code>
+         * parameter, you can specify a specific function version for which you want this
+         * information. If you don't specify this parameter, the API uses unqualified
+         * function ARN which return information about the <code>$LATEST</code> version of
+         * the Lambda function. For more information, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>.</p> <p>This operation requires
+         * permission for the <code>lambda:GetFunction</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetFunctionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetFunctionRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetFunctionOutcome> GetFunctionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetFunctionOutcome>([this, request](const std::function<void(Model::GetFunctionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetFunctionAsync(request, [complete](const LambdaClient*, const Model::GetFunctionRequest&, const Model::GetFunctionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetFunctionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the configuration information of the Lambda function. This the same
          * information you provided as parameters when uploading the function by using
@@ -691,6 +979,37 @@ namespace Model
          */
         virtual void GetFunctionConfigurationAsync(const Model::GetFunctionConfigurationRequest& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the configuration information of the Lambda function. This the same
+         * information you provided as parameters when uploading the function by using
+         * <a>CreateFunction</a>.</p> <p>If you are using the versioning feature, you can
+         * retrieve this information for a specific function version by using the optional
+         * <code>Qualifier</code> parameter and specifying the function version or alias
+         * that points to it. If you don't provide it, the API returns information about
+         * the $LATEST version of the function. For more information about versioning, see
+         * <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>.</p> <p>This operation requires
+         * permission for the <code>lambda:GetFunctionConfiguration</code> operation.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetFunctionConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetFunctionConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetFunctionConfigurationOutcome> GetFunctionConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetFunctionConfigurationOutcome>([this, request](const std::function<void(Model::GetFunctionConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetFunctionConfigurationAsync(request, [complete](const LambdaClient*, const Model::GetFunctionConfigurationRequest&, const Model::GetFunctionConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetFunctionConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the resource policy associated with the specified Lambda
          * function.</p> <p> If you are using the versioning feature, you can get the
@@ -734,6 +1053,35 @@ namespace Model
          */
         virtual void GetPolicyAsync(const Model::GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the resource policy associated with the specified Lambda
+         * function.</p> <p> If you are using the versioning feature, you can get the
+         * resource policy associated with the specific Lambda function version or alias by
+         * specifying the version or alias name using the <code>Qualifier</code> parameter.
+         * For more information about versioning, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> <p>For information about adding
+         * permissions, see <a>AddPermission</a>.</p> <p>You need permission for the
+         * <code>lambda:GetPolicy action.</code></p>
+         *
+         * Returns an awaitable that starts the operation the way GetPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetPolicyOutcome> GetPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetPolicyOutcome>([this, request](const std::function<void(Model::GetPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetPolicyAsync(request, [complete](const LambdaClient*, const Model::GetPolicyRequest&, const Model::GetPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Invokes a specific Lambda function. </p> <p>If you are using the versioning
          * feature, you can invoke the specific function version by providing function
@@ -777,6 +1125,35 @@ namespace Model
          */
         virtual void InvokeAsync(const Model::InvokeRequest& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Invokes a specific Lambda function. </p> <p>If you are using the versioning
+         * feature, you can invoke the specific function version by providing function
+         * version or alias name that is pointing to the function version using the
+         * <code>Qualifier</code> parameter in the request. If you don't provide the
+         * <code>Qualifier</code> parameter, the <code>$LATEST</code> version of the Lambda
+         * function is invoked. For information about the versioning feature, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> <p>This operation requires
+         * permission for the <code>lambda:InvokeFunction</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way InvokeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::InvokeRequest>
+        Aws::Utils::Threading::Awaitable<Model::InvokeOutcome> InvokeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::InvokeOutcome>([this, request](const std::function<void(Model::InvokeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->InvokeAsync(request, [complete](const LambdaClient*, const Model::InvokeRequest&, const Model::InvokeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::InvokeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns list of aliases created for a Lambda function. For each alias, the
          * response includes information such as the alias ARN, description, alias name,
@@ -811,6 +1188,32 @@ namespace Model
          */
         virtual void ListAliasesAsync(const Model::ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns list of aliases created for a Lambda function. For each alias, the
+         * response includes information such as the alias ARN, description, alias name,
+         * and the function version to which it points. For more information, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/aliases-intro.html">Introduction
+         * to AWS Lambda Aliases</a>.</p> <p>This requires permission for the
+         * lambda:ListAliases action.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListAliasesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAliasesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAliasesOutcome> ListAliasesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAliasesOutcome>([this, request](const std::function<void(Model::ListAliasesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAliasesAsync(request, [complete](const LambdaClient*, const Model::ListAliasesRequest&, const Model::ListAliasesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAliasesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of event source mappings you created using the
          * <code>CreateEventSourceMapping</code> (see <a>CreateEventSourceMapping</a>).
@@ -860,6 +1263,37 @@ namespace Model
          */
         virtual void ListEventSourceMappingsAsync(const Model::ListEventSourceMappingsRequest& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of event source mappings you created using the
+         * <code>CreateEventSourceMapping</code> (see <a>CreateEventSourceMapping</a>).
+         * </p> <p>For each mapping, the API returns configuration information. You can
+         * optionally specify filters to retrieve specific event source mappings.</p> <p>If
+         * you are using the versioning feature, you can get list of event source mappings
+         * for a specific Lambda function version or an alias as described in the
+         * <code>FunctionName</code> parameter. For information about the versioning
+         * feature, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> <p>This operation requires
+         * permission for the <code>lambda:ListEventSourceMappings</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListEventSourceMappingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListEventSourceMappingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListEventSourceMappingsOutcome> ListEventSourceMappingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListEventSourceMappingsOutcome>([this, request](const std::function<void(Model::ListEventSourceMappingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListEventSourceMappingsAsync(request, [complete](const LambdaClient*, const Model::ListEventSourceMappingsRequest&, const Model::ListEventSourceMappingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListEventSourceMappingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of your Lambda functions. For each function, the response
          * includes the function configuration information. You must use <a>GetFunction</a>
@@ -900,6 +1334,34 @@ namespace Model
          */
         virtual void ListFunctionsAsync(const Model::ListFunctionsRequest& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of your Lambda functions. For each function, the response
+         * includes the function configuration information. You must use <a>GetFunction</a>
+         * to retrieve the code for your function.</p> <p>This operation requires
+         * permission for the <code>lambda:ListFunctions</code> action.</p> <p>If you are
+         * using versioning feature, the response returns list of $LATEST versions of your
+         * functions. For information about the versioning feature, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListFunctionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListFunctionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListFunctionsOutcome> ListFunctionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListFunctionsOutcome>([this, request](const std::function<void(Model::ListFunctionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListFunctionsAsync(request, [complete](const LambdaClient*, const Model::ListFunctionsRequest&, const Model::ListFunctionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListFunctionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>List all versions of a function. For information about the versioning
          * feature, see <a
@@ -928,6 +1390,30 @@ namespace Model
          */
         virtual void ListVersionsByFunctionAsync(const Model::ListVersionsByFunctionRequest& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>List all versions of a function. For information about the versioning
+         * feature, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListVersionsByFunctionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListVersionsByFunctionRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListVersionsByFunctionOutcome> ListVersionsByFunctionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListVersionsByFunctionOutcome>([this, request](const std::function<void(Model::ListVersionsByFunctionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListVersionsByFunctionAsync(request, [complete](const LambdaClient*, const Model::ListVersionsByFunctionRequest&, const Model::ListVersionsByFunctionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListVersionsByFunctionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Publishes a version of your function from the current snapshot of $LATEST.
          * That is, AWS Lambda takes a snapshot of the function code and configuration
@@ -965,6 +1451,33 @@ namespace Model
          */
         virtual void PublishVersionAsync(const Model::PublishVersionRequest& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Publishes a version of your function from the current snapshot of $LATEST.
+         * That is, AWS Lambda takes a snapshot of the function code and configuration
+         * information from $LATEST and publishes a new version. The code and configuration
+         * cannot be modified after publication. For information about the versioning
+         * feature, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way PublishVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PublishVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::PublishVersionOutcome> PublishVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PublishVersionOutcome>([this, request](const std::function<void(Model::PublishVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PublishVersionAsync(request, [complete](const LambdaClient*, const Model::PublishVersionRequest&, const Model::PublishVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PublishVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>You can remove individual permissions from an resource policy associated with
          * a Lambda function by providing a statement ID that you provided when you added
@@ -1014,6 +1527,37 @@ namespace Model
          */
         virtual void RemovePermissionAsync(const Model::RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>You can remove individual permissions from an resource policy associated with
+         * a Lambda function by providing a statement ID that you provided when you added
+         * the permission. </p> <p>If you are using versioning, the permissions you remove
+         * are specific to the Lambda function version or alias you specify in the
+         * <code>AddPermission</code> request via the <code>Qualifier</code> parameter. For
+         * more information about versioning, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> <p>Note that removal of a
+         * permission will cause an active event source to lose permission to the function.
+         * </p> <p>You need permission for the <code>lambda:RemovePermission</code>
+         * action.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemovePermissionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemovePermissionRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemovePermissionOutcome> RemovePermissionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemovePermissionOutcome>([this, request](const std::function<void(Model::RemovePermissionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemovePermissionAsync(request, [complete](const LambdaClient*, const Model::RemovePermissionRequest&, const Model::RemovePermissionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemovePermissionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Using this API you can update the function version to which the alias points
          * and the alias description. For more information, see <a
@@ -1045,6 +1589,31 @@ namespace Model
          */
         virtual void UpdateAliasAsync(const Model::UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Using this API you can update the function version to which the alias points
+         * and the alias description. For more information, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/aliases-intro.html">Introduction
+         * to AWS Lambda Aliases</a>.</p> <p>This requires permission for the
+         * lambda:UpdateAlias action.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAliasAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAliasRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAliasOutcome> UpdateAliasAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAliasOutcome>([this, request](const std::function<void(Model::UpdateAliasOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAliasAsync(request, [complete](const LambdaClient*, const Model::UpdateAliasRequest&, const Model::UpdateAliasOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAliasOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>You can update an event source mapping. This is useful if you want to change
          * the parameters of the existing mapping without losing your position in the
@@ -1106,6 +1675,41 @@ namespace Model
          */
         virtual void UpdateEventSourceMappingAsync(const Model::UpdateEventSourceMappingRequest& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>You can update an event source mapping. This is useful if you want to change
+         * the parameters of the existing mapping without losing your position in the
+         * stream. You can change which function will receive the stream records, but to
+         * change the stream itself, you must create a new mapping. </p> <p>If you are
+         * using the versioning feature, you can update the event source mapping to map to
+         * a specific Lambda function version or alias as described in the
+         * <code>FunctionName</code> parameter. For information about the versioning
+         * feature, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> <p>If you disable the event
+         * source mapping, AWS Lambda stops polling. If you enable again, it will resume
+         * polling from the time it had stopped polling, so you don't lose processing of
+         * any records. However, if you delete event source mapping and create it again, it
+         * will reset.</p> <p>This operation requires permission for the
+         * <code>lambda:UpdateEventSourceMapping</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateEventSourceMappingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateEventSourceMappingRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateEventSourceMappingOutcome> UpdateEventSourceMappingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateEventSourceMappingOutcome>([this, request](const std::function<void(Model::UpdateEventSourceMappingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateEventSourceMappingAsync(request, [complete](const LambdaClient*, const Model::UpdateEventSourceMappingRequest&, const Model::UpdateEventSourceMappingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateEventSourceMappingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Updates the code for the specified Lambda function. This operation must only
          * be used on an existing Lambda function and cannot be used to update the function
@@ -1146,6 +1750,34 @@ namespace Model
          */
         virtual void UpdateFunctionCodeAsync(const Model::UpdateFunctionCodeRequest& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Updates the code for the specified Lambda function. This operation must only
+         * be used on an existing Lambda function and cannot be used to update the function
+         * configuration. </p> <p>If you are using the versioning feature, note this API
+         * will always update the $LATEST version of your Lambda function. For information
+         * about the versioning feature, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> <p>This operation requires
+         * permission for the <code>lambda:UpdateFunctionCode</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateFunctionCodeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateFunctionCodeRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateFunctionCodeOutcome> UpdateFunctionCodeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateFunctionCodeOutcome>([this, request](const std::function<void(Model::UpdateFunctionCodeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateFunctionCodeAsync(request, [complete](const LambdaClient*, const Model::UpdateFunctionCodeRequest&, const Model::UpdateFunctionCodeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateFunctionCodeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the configuration parameters for the specified Lambda function by
          * using the values provided in the request. You provide only the parameters you
@@ -1189,6 +1821,35 @@ namespace Model
          */
         virtual void UpdateFunctionConfigurationAsync(const Model::UpdateFunctionConfigurationRequest& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the configuration parameters for the specified Lambda function by
+         * using the values provided in the request. You provide only the parameters you
+         * want to change. This operation must only be used on an existing Lambda function
+         * and cannot be used to update the function's code. </p> <p>If you are using the
+         * versioning feature, note this API will always update the $LATEST version of your
+         * Lambda function. For information about the versioning feature, see <a
+         * href="http://docs.aws.amazon.com/lambda/latest/dg/versioning-aliases.html">AWS
+         * Lambda Function Versioning and Aliases</a>. </p> <p>This operation requires
+         * permission for the <code>lambda:UpdateFunctionConfiguration</code> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateFunctionConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateFunctionConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateFunctionConfigurationOutcome> UpdateFunctionConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateFunctionConfigurationOutcome>([this, request](const std::function<void(Model::UpdateFunctionConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateFunctionConfigurationAsync(request, [complete](const LambdaClient*, const Model::UpdateFunctionConfigurationRequest&, const Model::UpdateFunctionConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateFunctionConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
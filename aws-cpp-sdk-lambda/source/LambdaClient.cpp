@@ -119,7 +119,7 @@ AddPermissionOutcome LambdaClient::AddPermission(const AddPermissionRequest& req
   ss << request.GetFunctionName();
   ss << "/policy";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "AddPermission");
   if(outcome.IsSuccess())
   {
     return AddPermissionOutcome(AddPermissionResult(outcome.GetResult()));
@@ -132,17 +132,44 @@ AddPermissionOutcome LambdaClient::AddPermission(const AddPermissionRequest& req
 
 AddPermissionOutcomeCallable LambdaClient::AddPermissionCallable(const AddPermissionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::AddPermission, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AddPermissionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AddPermission( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< AddPermissionOutcome > rejected;
+    rejected.set_value(AddPermissionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::AddPermissionAsync(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::AddPermissionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::AddPermissionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, AddPermissionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::AddPermissionAsyncHelper(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, AddPermission(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/policy";
+
+  auto sharedRequest = Aws::MakeShared<AddPermissionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "AddPermission", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AddPermissionOutcome(AddPermissionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AddPermissionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateAliasOutcome LambdaClient::CreateAlias(const CreateAliasRequest& request) const
@@ -152,7 +179,7 @@ CreateAliasOutcome LambdaClient::CreateAlias(const CreateAliasRequest& request)
   ss << request.GetFunctionName();
   ss << "/aliases";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateAlias");
   if(outcome.IsSuccess())
   {
     return CreateAliasOutcome(CreateAliasResult(outcome.GetResult()));
@@ -165,17 +192,44 @@ CreateAliasOutcome LambdaClient::CreateAlias(const CreateAliasRequest& request)
 
 CreateAliasOutcomeCallable LambdaClient::CreateAliasCallable(const CreateAliasRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::CreateAlias, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateAliasOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateAlias( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateAliasOutcome > rejected;
+    rejected.set_value(CreateAliasOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::CreateAliasAsync(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::CreateAliasAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::CreateAliasAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateAliasOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::CreateAliasAsyncHelper(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateAlias(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/aliases";
+
+  auto sharedRequest = Aws::MakeShared<CreateAliasRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateAlias", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateAliasOutcome(CreateAliasResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateAliasOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateEventSourceMappingOutcome LambdaClient::CreateEventSourceMapping(const CreateEventSourceMappingRequest& request) const
@@ -183,7 +237,7 @@ CreateEventSourceMappingOutcome LambdaClient::CreateEventSourceMapping(const Cre
   Aws::StringStream ss;
   ss << m_uri << "/2015-03-31/event-source-mappings/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateEventSourceMapping");
   if(outcome.IsSuccess())
   {
     return CreateEventSourceMappingOutcome(CreateEventSourceMappingResult(outcome.GetResult()));
@@ -196,17 +250,42 @@ CreateEventSourceMappingOutcome LambdaClient::CreateEventSourceMapping(const Cre
 
 CreateEventSourceMappingOutcomeCallable LambdaClient::CreateEventSourceMappingCallable(const CreateEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::CreateEventSourceMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateEventSourceMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateEventSourceMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateEventSourceMappingOutcome > rejected;
+    rejected.set_value(CreateEventSourceMappingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::CreateEventSourceMappingAsync(const CreateEventSourceMappingRequest& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::CreateEventSourceMappingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::CreateEventSourceMappingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateEventSourceMappingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::CreateEventSourceMappingAsyncHelper(const CreateEventSourceMappingRequest& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateEventSourceMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/event-source-mappings/";
+
+  auto sharedRequest = Aws::MakeShared<CreateEventSourceMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateEventSourceMapping", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateEventSourceMappingOutcome(CreateEventSourceMappingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateEventSourceMappingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateFunctionOutcome LambdaClient::CreateFunction(const CreateFunctionRequest& request) const
@@ -214,7 +293,7 @@ CreateFunctionOutcome LambdaClient::CreateFunction(const CreateFunctionRequest&
   Aws::StringStream ss;
   ss << m_uri << "/2015-03-31/functions";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateFunction");
   if(outcome.IsSuccess())
   {
     return CreateFunctionOutcome(CreateFunctionResult(outcome.GetResult()));
@@ -227,17 +306,42 @@ CreateFunctionOutcome LambdaClient::CreateFunction(const CreateFunctionRequest&
 
 CreateFunctionOutcomeCallable LambdaClient::CreateFunctionCallable(const CreateFunctionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::CreateFunction, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateFunctionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateFunction( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateFunctionOutcome > rejected;
+    rejected.set_value(CreateFunctionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::CreateFunctionAsync(const CreateFunctionRequest& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::CreateFunctionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::CreateFunctionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateFunctionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::CreateFunctionAsyncHelper(const CreateFunctionRequest& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateFunction(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions";
+
+  auto sharedRequest = Aws::MakeShared<CreateFunctionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateFunction", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateFunctionOutcome(CreateFunctionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateFunctionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteAliasOutcome LambdaClient::DeleteAlias(const DeleteAliasRequest& request) const
@@ -248,7 +352,7 @@ DeleteAliasOutcome LambdaClient::DeleteAlias(const DeleteAliasRequest& request)
   ss << "/aliases/";
   ss << request.GetName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteAlias");
   if(outcome.IsSuccess())
   {
     return DeleteAliasOutcome(NoResult());
@@ -261,17 +365,45 @@ DeleteAliasOutcome LambdaClient::DeleteAlias(const DeleteAliasRequest& request)
 
 DeleteAliasOutcomeCallable LambdaClient::DeleteAliasCallable(const DeleteAliasRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::DeleteAlias, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteAliasOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteAlias( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteAliasOutcome > rejected;
+    rejected.set_value(DeleteAliasOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::DeleteAliasAsync(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::DeleteAliasAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::DeleteAliasAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteAliasOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::DeleteAliasAsyncHelper(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteAlias(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/aliases/";
+  ss << request.GetName();
+
+  auto sharedRequest = Aws::MakeShared<DeleteAliasRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteAlias", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteAliasOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteAliasOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteEventSourceMappingOutcome LambdaClient::DeleteEventSourceMapping(const DeleteEventSourceMappingRequest& request) const
@@ -280,7 +412,7 @@ DeleteEventSourceMappingOutcome LambdaClient::DeleteEventSourceMapping(const Del
   ss << m_uri << "/2015-03-31/event-source-mappings/";
   ss << request.GetUUID();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteEventSourceMapping");
   if(outcome.IsSuccess())
   {
     return DeleteEventSourceMappingOutcome(DeleteEventSourceMappingResult(outcome.GetResult()));
@@ -293,17 +425,43 @@ DeleteEventSourceMappingOutcome LambdaClient::DeleteEventSourceMapping(const Del
 
 DeleteEventSourceMappingOutcomeCallable LambdaClient::DeleteEventSourceMappingCallable(const DeleteEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::DeleteEventSourceMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteEventSourceMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteEventSourceMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteEventSourceMappingOutcome > rejected;
+    rejected.set_value(DeleteEventSourceMappingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::DeleteEventSourceMappingAsync(const DeleteEventSourceMappingRequest& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::DeleteEventSourceMappingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::DeleteEventSourceMappingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteEventSourceMappingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::DeleteEventSourceMappingAsyncHelper(const DeleteEventSourceMappingRequest& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteEventSourceMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/event-source-mappings/";
+  ss << request.GetUUID();
+
+  auto sharedRequest = Aws::MakeShared<DeleteEventSourceMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteEventSourceMapping", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteEventSourceMappingOutcome(DeleteEventSourceMappingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteEventSourceMappingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteFunctionOutcome LambdaClient::DeleteFunction(const DeleteFunctionRequest& request) const
@@ -312,7 +470,7 @@ DeleteFunctionOutcome LambdaClient::DeleteFunction(const DeleteFunctionRequest&
   ss << m_uri << "/2015-03-31/functions/";
   ss << request.GetFunctionName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteFunction");
   if(outcome.IsSuccess())
   {
     return DeleteFunctionOutcome(NoResult());
@@ -325,17 +483,43 @@ DeleteFunctionOutcome LambdaClient::DeleteFunction(const DeleteFunctionRequest&
 
 DeleteFunctionOutcomeCallable LambdaClient::DeleteFunctionCallable(const DeleteFunctionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::DeleteFunction, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteFunctionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteFunction( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteFunctionOutcome > rejected;
+    rejected.set_value(DeleteFunctionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::DeleteFunctionAsync(const DeleteFunctionRequest& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::DeleteFunctionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::DeleteFunctionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteFunctionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::DeleteFunctionAsyncHelper(const DeleteFunctionRequest& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteFunction(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+
+  auto sharedRequest = Aws::MakeShared<DeleteFunctionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteFunction", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteFunctionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteFunctionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetAliasOutcome LambdaClient::GetAlias(const GetAliasRequest& request) const
@@ -346,7 +530,7 @@ GetAliasOutcome LambdaClient::GetAlias(const GetAliasRequest& request) const
   ss << "/aliases/";
   ss << request.GetName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetAlias");
   if(outcome.IsSuccess())
   {
     return GetAliasOutcome(GetAliasResult(outcome.GetResult()));
@@ -359,17 +543,45 @@ GetAliasOutcome LambdaClient::GetAlias(const GetAliasRequest& request) const
 
 GetAliasOutcomeCallable LambdaClient::GetAliasCallable(const GetAliasRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::GetAlias, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetAliasOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetAlias( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetAliasOutcome > rejected;
+    rejected.set_value(GetAliasOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::GetAliasAsync(const GetAliasRequest& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::GetAliasAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::GetAliasAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetAliasOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::GetAliasAsyncHelper(const GetAliasRequest& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetAlias(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/aliases/";
+  ss << request.GetName();
+
+  auto sharedRequest = Aws::MakeShared<GetAliasRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetAlias", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetAliasOutcome(GetAliasResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetAliasOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetEventSourceMappingOutcome LambdaClient::GetEventSourceMapping(const GetEventSourceMappingRequest& request) const
@@ -378,7 +590,7 @@ GetEventSourceMappingOutcome LambdaClient::GetEventSourceMapping(const GetEventS
   ss << m_uri << "/2015-03-31/event-source-mappings/";
   ss << request.GetUUID();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetEventSourceMapping");
   if(outcome.IsSuccess())
   {
     return GetEventSourceMappingOutcome(GetEventSourceMappingResult(outcome.GetResult()));
@@ -391,17 +603,43 @@ GetEventSourceMappingOutcome LambdaClient::GetEventSourceMapping(const GetEventS
 
 GetEventSourceMappingOutcomeCallable LambdaClient::GetEventSourceMappingCallable(const GetEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::GetEventSourceMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetEventSourceMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetEventSourceMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetEventSourceMappingOutcome > rejected;
+    rejected.set_value(GetEventSourceMappingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::GetEventSourceMappingAsync(const GetEventSourceMappingRequest& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::GetEventSourceMappingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::GetEventSourceMappingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetEventSourceMappingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::GetEventSourceMappingAsyncHelper(const GetEventSourceMappingRequest& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetEventSourceMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/event-source-mappings/";
+  ss << request.GetUUID();
+
+  auto sharedRequest = Aws::MakeShared<GetEventSourceMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetEventSourceMapping", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetEventSourceMappingOutcome(GetEventSourceMappingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetEventSourceMappingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetFunctionOutcome LambdaClient::GetFunction(const GetFunctionRequest& request) const
@@ -410,7 +648,7 @@ GetFunctionOutcome LambdaClient::GetFunction(const GetFunctionRequest& request)
   ss << m_uri << "/2015-03-31/functions/";
   ss << request.GetFunctionName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetFunction");
   if(outcome.IsSuccess())
   {
     return GetFunctionOutcome(GetFunctionResult(outcome.GetResult()));
@@ -423,17 +661,43 @@ GetFunctionOutcome LambdaClient::GetFunction(const GetFunctionRequest& request)
 
 GetFunctionOutcomeCallable LambdaClient::GetFunctionCallable(const GetFunctionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::GetFunction, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetFunctionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetFunction( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetFunctionOutcome > rejected;
+    rejected.set_value(GetFunctionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::GetFunctionAsync(const GetFunctionRequest& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::GetFunctionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::GetFunctionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetFunctionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::GetFunctionAsyncHelper(const GetFunctionRequest& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetFunction(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+
+  auto sharedRequest = Aws::MakeShared<GetFunctionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetFunction", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetFunctionOutcome(GetFunctionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetFunctionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetFunctionConfigurationOutcome LambdaClient::GetFunctionConfiguration(const GetFunctionConfigurationRequest& request) const
@@ -443,7 +707,7 @@ GetFunctionConfigurationOutcome LambdaClient::GetFunctionConfiguration(const Get
   ss << request.GetFunctionName();
   ss << "/configuration";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetFunctionConfiguration");
   if(outcome.IsSuccess())
   {
     return GetFunctionConfigurationOutcome(GetFunctionConfigurationResult(outcome.GetResult()));
@@ -456,17 +720,44 @@ GetFunctionConfigurationOutcome LambdaClient::GetFunctionConfiguration(const Get
 
 GetFunctionConfigurationOutcomeCallable LambdaClient::GetFunctionConfigurationCallable(const GetFunctionConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::GetFunctionConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetFunctionConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetFunctionConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetFunctionConfigurationOutcome > rejected;
+    rejected.set_value(GetFunctionConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::GetFunctionConfigurationAsync(const GetFunctionConfigurationRequest& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::GetFunctionConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::GetFunctionConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetFunctionConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::GetFunctionConfigurationAsyncHelper(const GetFunctionConfigurationRequest& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetFunctionConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/configuration";
+
+  auto sharedRequest = Aws::MakeShared<GetFunctionConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetFunctionConfiguration", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetFunctionConfigurationOutcome(GetFunctionConfigurationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetFunctionConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetPolicyOutcome LambdaClient::GetPolicy(const GetPolicyRequest& request) const
@@ -476,7 +767,7 @@ GetPolicyOutcome LambdaClient::GetPolicy(const GetPolicyRequest& request) const
   ss << request.GetFunctionName();
   ss << "/policy";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetPolicy");
   if(outcome.IsSuccess())
   {
     return GetPolicyOutcome(GetPolicyResult(outcome.GetResult()));
@@ -489,17 +780,44 @@ GetPolicyOutcome LambdaClient::GetPolicy(const GetPolicyRequest& request) const
 
 GetPolicyOutcomeCallable LambdaClient::GetPolicyCallable(const GetPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::GetPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetPolicyOutcome > rejected;
+    rejected.set_value(GetPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::GetPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::GetPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::GetPolicyAsyncHelper(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/policy";
+
+  auto sharedRequest = Aws::MakeShared<GetPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetPolicy", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetPolicyOutcome(GetPolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 InvokeOutcome LambdaClient::Invoke(const InvokeRequest& request) const
@@ -509,7 +827,7 @@ InvokeOutcome LambdaClient::Invoke(const InvokeRequest& request) const
   ss << request.GetFunctionName();
   ss << "/invocations";
 
-  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_POST);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_POST, "Invoke");
   if(outcome.IsSuccess())
   {
     return InvokeOutcome(InvokeResult(outcome.GetResultWithOwnership()));
@@ -522,17 +840,44 @@ InvokeOutcome LambdaClient::Invoke(const InvokeRequest& request) const
 
 InvokeOutcomeCallable LambdaClient::InvokeCallable(const InvokeRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::Invoke, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< InvokeOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->Invoke( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< InvokeOutcome > rejected;
+    rejected.set_value(InvokeOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::InvokeAsync(const InvokeRequest& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::InvokeAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::InvokeAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, InvokeOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::InvokeAsyncHelper(const InvokeRequest& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, Invoke(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/invocations";
+
+  auto sharedRequest = Aws::MakeShared<InvokeRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "Invoke", [this, sharedRequest, handler, context](StreamOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, InvokeOutcome(InvokeResult(outcome.GetResultWithOwnership())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, InvokeOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListAliasesOutcome LambdaClient::ListAliases(const ListAliasesRequest& request) const
@@ -542,7 +887,7 @@ ListAliasesOutcome LambdaClient::ListAliases(const ListAliasesRequest& request)
   ss << request.GetFunctionName();
   ss << "/aliases";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListAliases");
   if(outcome.IsSuccess())
   {
     return ListAliasesOutcome(ListAliasesResult(outcome.GetResult()));
@@ -555,17 +900,44 @@ ListAliasesOutcome LambdaClient::ListAliases(const ListAliasesRequest& request)
 
 ListAliasesOutcomeCallable LambdaClient::ListAliasesCallable(const ListAliasesRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::ListAliases, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListAliasesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListAliases( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListAliasesOutcome > rejected;
+    rejected.set_value(ListAliasesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::ListAliasesAsync(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::ListAliasesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::ListAliasesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListAliasesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::ListAliasesAsyncHelper(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListAliases(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/aliases";
+
+  auto sharedRequest = Aws::MakeShared<ListAliasesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListAliases", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListAliasesOutcome(ListAliasesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListAliasesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListEventSourceMappingsOutcome LambdaClient::ListEventSourceMappings(const ListEventSourceMappingsRequest& request) const
@@ -573,7 +945,7 @@ ListEventSourceMappingsOutcome LambdaClient::ListEventSourceMappings(const ListE
   Aws::StringStream ss;
   ss << m_uri << "/2015-03-31/event-source-mappings/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListEventSourceMappings");
   if(outcome.IsSuccess())
   {
     return ListEventSourceMappingsOutcome(ListEventSourceMappingsResult(outcome.GetResult()));
@@ -586,17 +958,42 @@ ListEventSourceMappingsOutcome LambdaClient::ListEventSourceMappings(const ListE
 
 ListEventSourceMappingsOutcomeCallable LambdaClient::ListEventSourceMappingsCallable(const ListEventSourceMappingsRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::ListEventSourceMappings, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListEventSourceMappingsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListEventSourceMappings( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListEventSourceMappingsOutcome > rejected;
+    rejected.set_value(ListEventSourceMappingsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::ListEventSourceMappingsAsync(const ListEventSourceMappingsRequest& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::ListEventSourceMappingsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::ListEventSourceMappingsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListEventSourceMappingsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::ListEventSourceMappingsAsyncHelper(const ListEventSourceMappingsRequest& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListEventSourceMappings(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/event-source-mappings/";
+
+  auto sharedRequest = Aws::MakeShared<ListEventSourceMappingsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListEventSourceMappings", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListEventSourceMappingsOutcome(ListEventSourceMappingsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListEventSourceMappingsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListFunctionsOutcome LambdaClient::ListFunctions(const ListFunctionsRequest& request) const
@@ -604,7 +1001,7 @@ ListFunctionsOutcome LambdaClient::ListFunctions(const ListFunctionsRequest& req
   Aws::StringStream ss;
   ss << m_uri << "/2015-03-31/functions/";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListFunctions");
   if(outcome.IsSuccess())
   {
     return ListFunctionsOutcome(ListFunctionsResult(outcome.GetResult()));
@@ -617,17 +1014,42 @@ ListFunctionsOutcome LambdaClient::ListFunctions(const ListFunctionsRequest& req
 
 ListFunctionsOutcomeCallable LambdaClient::ListFunctionsCallable(const ListFunctionsRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::ListFunctions, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListFunctionsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListFunctions( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListFunctionsOutcome > rejected;
+    rejected.set_value(ListFunctionsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::ListFunctionsAsync(const ListFunctionsRequest& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::ListFunctionsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::ListFunctionsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListFunctionsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::ListFunctionsAsyncHelper(const ListFunctionsRequest& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListFunctions(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+
+  auto sharedRequest = Aws::MakeShared<ListFunctionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListFunctions", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListFunctionsOutcome(ListFunctionsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListFunctionsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListVersionsByFunctionOutcome LambdaClient::ListVersionsByFunction(const ListVersionsByFunctionRequest& request) const
@@ -637,7 +1059,7 @@ ListVersionsByFunctionOutcome LambdaClient::ListVersionsByFunction(const ListVer
   ss << request.GetFunctionName();
   ss << "/versions";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListVersionsByFunction");
   if(outcome.IsSuccess())
   {
     return ListVersionsByFunctionOutcome(ListVersionsByFunctionResult(outcome.GetResult()));
@@ -650,17 +1072,44 @@ ListVersionsByFunctionOutcome LambdaClient::ListVersionsByFunction(const ListVer
 
 ListVersionsByFunctionOutcomeCallable LambdaClient::ListVersionsByFunctionCallable(const ListVersionsByFunctionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::ListVersionsByFunction, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListVersionsByFunctionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListVersionsByFunction( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListVersionsByFunctionOutcome > rejected;
+    rejected.set_value(ListVersionsByFunctionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::ListVersionsByFunctionAsync(const ListVersionsByFunctionRequest& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::ListVersionsByFunctionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::ListVersionsByFunctionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListVersionsByFunctionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::ListVersionsByFunctionAsyncHelper(const ListVersionsByFunctionRequest& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListVersionsByFunction(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/versions";
+
+  auto sharedRequest = Aws::MakeShared<ListVersionsByFunctionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListVersionsByFunction", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListVersionsByFunctionOutcome(ListVersionsByFunctionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListVersionsByFunctionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PublishVersionOutcome LambdaClient::PublishVersion(const PublishVersionRequest& request) const
@@ -670,7 +1119,7 @@ PublishVersionOutcome LambdaClient::PublishVersion(const PublishVersionRequest&
   ss << request.GetFunctionName();
   ss << "/versions";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "PublishVersion");
   if(outcome.IsSuccess())
   {
     return PublishVersionOutcome(PublishVersionResult(outcome.GetResult()));
@@ -683,17 +1132,44 @@ PublishVersionOutcome LambdaClient::PublishVersion(const PublishVersionRequest&
 
 PublishVersionOutcomeCallable LambdaClient::PublishVersionCallable(const PublishVersionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::PublishVersion, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PublishVersionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PublishVersion( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PublishVersionOutcome > rejected;
+    rejected.set_value(PublishVersionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::PublishVersionAsync(const PublishVersionRequest& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::PublishVersionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::PublishVersionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PublishVersionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::PublishVersionAsyncHelper(const PublishVersionRequest& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PublishVersion(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/versions";
+
+  auto sharedRequest = Aws::MakeShared<PublishVersionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "PublishVersion", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PublishVersionOutcome(PublishVersionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PublishVersionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 RemovePermissionOutcome LambdaClient::RemovePermission(const RemovePermissionRequest& request) const
@@ -704,7 +1180,7 @@ RemovePermissionOutcome LambdaClient::RemovePermission(const RemovePermissionReq
   ss << "/policy/";
   ss << request.GetStatementId();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "RemovePermission");
   if(outcome.IsSuccess())
   {
     return RemovePermissionOutcome(NoResult());
@@ -717,17 +1193,45 @@ RemovePermissionOutcome LambdaClient::RemovePermission(const RemovePermissionReq
 
 RemovePermissionOutcomeCallable LambdaClient::RemovePermissionCallable(const RemovePermissionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::RemovePermission, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< RemovePermissionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RemovePermission( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< RemovePermissionOutcome > rejected;
+    rejected.set_value(RemovePermissionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::RemovePermissionAsync(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::RemovePermissionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::RemovePermissionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, RemovePermissionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::RemovePermissionAsyncHelper(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, RemovePermission(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/policy/";
+  ss << request.GetStatementId();
+
+  auto sharedRequest = Aws::MakeShared<RemovePermissionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "RemovePermission", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RemovePermissionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RemovePermissionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateAliasOutcome LambdaClient::UpdateAlias(const UpdateAliasRequest& request) const
@@ -738,7 +1242,7 @@ UpdateAliasOutcome LambdaClient::UpdateAlias(const UpdateAliasRequest& request)
   ss << "/aliases/";
   ss << request.GetName();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "UpdateAlias");
   if(outcome.IsSuccess())
   {
     return UpdateAliasOutcome(UpdateAliasResult(outcome.GetResult()));
@@ -751,17 +1255,45 @@ UpdateAliasOutcome LambdaClient::UpdateAlias(const UpdateAliasRequest& request)
 
 UpdateAliasOutcomeCallable LambdaClient::UpdateAliasCallable(const UpdateAliasRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::UpdateAlias, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateAliasOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateAlias( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateAliasOutcome > rejected;
+    rejected.set_value(UpdateAliasOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::UpdateAliasAsync(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::UpdateAliasAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::UpdateAliasAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateAliasOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::UpdateAliasAsyncHelper(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateAlias(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/aliases/";
+  ss << request.GetName();
+
+  auto sharedRequest = Aws::MakeShared<UpdateAliasRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "UpdateAlias", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateAliasOutcome(UpdateAliasResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateAliasOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateEventSourceMappingOutcome LambdaClient::UpdateEventSourceMapping(const UpdateEventSourceMappingRequest& request) const
@@ -770,7 +1302,7 @@ UpdateEventSourceMappingOutcome LambdaClient::UpdateEventSourceMapping(const Upd
   ss << m_uri << "/2015-03-31/event-source-mappings/";
   ss << request.GetUUID();
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "UpdateEventSourceMapping");
   if(outcome.IsSuccess())
   {
     return UpdateEventSourceMappingOutcome(UpdateEventSourceMappingResult(outcome.GetResult()));
@@ -783,17 +1315,43 @@ UpdateEventSourceMappingOutcome LambdaClient::UpdateEventSourceMapping(const Upd
 
 UpdateEventSourceMappingOutcomeCallable LambdaClient::UpdateEventSourceMappingCallable(const UpdateEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::UpdateEventSourceMapping, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateEventSourceMappingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateEventSourceMapping( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateEventSourceMappingOutcome > rejected;
+    rejected.set_value(UpdateEventSourceMappingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::UpdateEventSourceMappingAsync(const UpdateEventSourceMappingRequest& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::UpdateEventSourceMappingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::UpdateEventSourceMappingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateEventSourceMappingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::UpdateEventSourceMappingAsyncHelper(const UpdateEventSourceMappingRequest& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateEventSourceMapping(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/event-source-mappings/";
+  ss << request.GetUUID();
+
+  auto sharedRequest = Aws::MakeShared<UpdateEventSourceMappingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "UpdateEventSourceMapping", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateEventSourceMappingOutcome(UpdateEventSourceMappingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateEventSourceMappingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateFunctionCodeOutcome LambdaClient::UpdateFunctionCode(const UpdateFunctionCodeRequest& request) const
@@ -803,7 +1361,7 @@ UpdateFunctionCodeOutcome LambdaClient::UpdateFunctionCode(const UpdateFunctionC
   ss << request.GetFunctionName();
   ss << "/code";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "UpdateFunctionCode");
   if(outcome.IsSuccess())
   {
     return UpdateFunctionCodeOutcome(UpdateFunctionCodeResult(outcome.GetResult()));
@@ -816,17 +1374,44 @@ UpdateFunctionCodeOutcome LambdaClient::UpdateFunctionCode(const UpdateFunctionC
 
 UpdateFunctionCodeOutcomeCallable LambdaClient::UpdateFunctionCodeCallable(const UpdateFunctionCodeRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::UpdateFunctionCode, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateFunctionCodeOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateFunctionCode( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateFunctionCodeOutcome > rejected;
+    rejected.set_value(UpdateFunctionCodeOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::UpdateFunctionCodeAsync(const UpdateFunctionCodeRequest& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::UpdateFunctionCodeAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::UpdateFunctionCodeAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateFunctionCodeOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::UpdateFunctionCodeAsyncHelper(const UpdateFunctionCodeRequest& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateFunctionCode(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/code";
+
+  auto sharedRequest = Aws::MakeShared<UpdateFunctionCodeRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "UpdateFunctionCode", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateFunctionCodeOutcome(UpdateFunctionCodeResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateFunctionCodeOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateFunctionConfigurationOutcome LambdaClient::UpdateFunctionConfiguration(const UpdateFunctionConfigurationRequest& request) const
@@ -836,7 +1421,7 @@ UpdateFunctionConfigurationOutcome LambdaClient::UpdateFunctionConfiguration(con
   ss << request.GetFunctionName();
   ss << "/configuration";
 
-  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "UpdateFunctionConfiguration");
   if(outcome.IsSuccess())
   {
     return UpdateFunctionConfigurationOutcome(UpdateFunctionConfigurationResult(outcome.GetResult()));
@@ -849,16 +1434,43 @@ UpdateFunctionConfigurationOutcome LambdaClient::UpdateFunctionConfiguration(con
 
 UpdateFunctionConfigurationOutcomeCallable LambdaClient::UpdateFunctionConfigurationCallable(const UpdateFunctionConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::UpdateFunctionConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateFunctionConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateFunctionConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateFunctionConfigurationOutcome > rejected;
+    rejected.set_value(UpdateFunctionConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void LambdaClient::UpdateFunctionConfigurationAsync(const UpdateFunctionConfigurationRequest& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::UpdateFunctionConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&LambdaClient::UpdateFunctionConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateFunctionConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void LambdaClient::UpdateFunctionConfigurationAsyncHelper(const UpdateFunctionConfigurationRequest& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateFunctionConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2015-03-31/functions/";
+  ss << request.GetFunctionName();
+  ss << "/configuration";
+
+  auto sharedRequest = Aws::MakeShared<UpdateFunctionConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "UpdateFunctionConfiguration", [this, sharedRequest, handler, context](JsonOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateFunctionConfigurationOutcome(UpdateFunctionConfigurationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateFunctionConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
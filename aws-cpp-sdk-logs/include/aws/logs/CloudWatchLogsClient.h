@@ -34,6 +34,7 @@
 #include <aws/logs/model/TestMetricFilterResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -261,6 +262,28 @@ namespace Model
          */
         virtual void CancelExportTaskAsync(const Model::CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Cancels an export task if it is in <code>PENDING</code> or
+         * <code>RUNNING</code> state. </p>
+         *
+         * Returns an awaitable that starts the operation the way CancelExportTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelExportTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelExportTaskOutcome> CancelExportTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelExportTaskOutcome>([this, request](const std::function<void(Model::CancelExportTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelExportTaskAsync(request, [complete](const CloudWatchLogsClient*, const Model::CancelExportTaskRequest&, const Model::CancelExportTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelExportTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates an <code>ExportTask</code> which allows you to efficiently export
          * data from a Log Group to your Amazon S3 bucket. </p> <p> This is an asynchronous
@@ -310,6 +333,37 @@ namespace Model
          */
         virtual void CreateExportTaskAsync(const Model::CreateExportTaskRequest& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates an <code>ExportTask</code> which allows you to efficiently export
+         * data from a Log Group to your Amazon S3 bucket. </p> <p> This is an asynchronous
+         * call. If all the required information is provided, this API will initiate an
+         * export task and respond with the task Id. Once started,
+         * <code>DescribeExportTasks</code> can be used to get the status of an export
+         * task. You can only have one active (<code>RUNNING</code> or
+         * <code>PENDING</code>) export task at a time, per account. </p> <p> You can
+         * export logs from multiple log groups or multiple time ranges to the same Amazon
+         * S3 bucket. To separate out log data for each export task, you can specify a
+         * prefix that will be used as the Amazon S3 key prefix for all exported objects.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateExportTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateExportTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateExportTaskOutcome> CreateExportTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateExportTaskOutcome>([this, request](const std::function<void(Model::CreateExportTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateExportTaskAsync(request, [complete](const CloudWatchLogsClient*, const Model::CreateExportTaskRequest&, const Model::CreateExportTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateExportTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new log group with the specified name. The name of the log group
          * must be unique within a region for an AWS account. You can create up to 500 log
@@ -344,6 +398,32 @@ namespace Model
          */
         virtual void CreateLogGroupAsync(const Model::CreateLogGroupRequest& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new log group with the specified name. The name of the log group
+         * must be unique within a region for an AWS account. You can create up to 500 log
+         * groups per account. </p> <p> You must use the following guidelines when naming a
+         * log group: <ul> <li>Log group names can be between 1 and 512 characters
+         * long.</li> <li>Allowed characters are a-z, A-Z, 0-9, '_' (underscore), '-'
+         * (hyphen), '/' (forward slash), and '.' (period).</li> </ul> </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateLogGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateLogGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateLogGroupOutcome> CreateLogGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateLogGroupOutcome>([this, request](const std::function<void(Model::CreateLogGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateLogGroupAsync(request, [complete](const CloudWatchLogsClient*, const Model::CreateLogGroupRequest&, const Model::CreateLogGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateLogGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new log stream in the specified log group. The name of the log
          * stream must be unique within the log group. There is no limit on the number of
@@ -378,6 +458,32 @@ namespace Model
          */
         virtual void CreateLogStreamAsync(const Model::CreateLogStreamRequest& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new log stream in the specified log group. The name of the log
+         * stream must be unique within the log group. There is no limit on the number of
+         * log streams that can exist in a log group. </p> <p> You must use the following
+         * guidelines when naming a log stream: <ul> <li>Log stream names can be between 1
+         * and 512 characters long.</li> <li>The ':' colon character is not allowed.</li>
+         * </ul> </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateLogStreamAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateLogStreamRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateLogStreamOutcome> CreateLogStreamAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateLogStreamOutcome>([this, request](const std::function<void(Model::CreateLogStreamOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateLogStreamAsync(request, [complete](const CloudWatchLogsClient*, const Model::CreateLogStreamRequest&, const Model::CreateLogStreamOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateLogStreamOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the destination with the specified name and eventually disables all
          * the subscription filters that publish to it. This will not delete the physical
@@ -403,6 +509,29 @@ namespace Model
          */
         virtual void DeleteDestinationAsync(const Model::DeleteDestinationRequest& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the destination with the specified name and eventually disables all
+         * the subscription filters that publish to it. This will not delete the physical
+         * resource encapsulated by the destination. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDestinationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDestinationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDestinationOutcome> DeleteDestinationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDestinationOutcome>([this, request](const std::function<void(Model::DeleteDestinationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDestinationAsync(request, [complete](const CloudWatchLogsClient*, const Model::DeleteDestinationRequest&, const Model::DeleteDestinationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDestinationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the log group with the specified name and permanently deletes all
          * the archived log events associated with it. </p>
@@ -425,6 +554,28 @@ namespace Model
          */
         virtual void DeleteLogGroupAsync(const Model::DeleteLogGroupRequest& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the log group with the specified name and permanently deletes all
+         * the archived log events associated with it. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteLogGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteLogGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteLogGroupOutcome> DeleteLogGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteLogGroupOutcome>([this, request](const std::function<void(Model::DeleteLogGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteLogGroupAsync(request, [complete](const CloudWatchLogsClient*, const Model::DeleteLogGroupRequest&, const Model::DeleteLogGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteLogGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a log stream and permanently deletes all the archived log events
          * associated with it. </p>
@@ -447,6 +598,28 @@ namespace Model
          */
         virtual void DeleteLogStreamAsync(const Model::DeleteLogStreamRequest& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a log stream and permanently deletes all the archived log events
+         * associated with it. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteLogStreamAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteLogStreamRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteLogStreamOutcome> DeleteLogStreamAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteLogStreamOutcome>([this, request](const std::function<void(Model::DeleteLogStreamOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteLogStreamAsync(request, [complete](const CloudWatchLogsClient*, const Model::DeleteLogStreamRequest&, const Model::DeleteLogStreamOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteLogStreamOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a metric filter associated with the specified log group. </p>
          */
@@ -466,6 +639,27 @@ namespace Model
          */
         virtual void DeleteMetricFilterAsync(const Model::DeleteMetricFilterRequest& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a metric filter associated with the specified log group. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteMetricFilterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteMetricFilterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteMetricFilterOutcome> DeleteMetricFilterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteMetricFilterOutcome>([this, request](const std::function<void(Model::DeleteMetricFilterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteMetricFilterAsync(request, [complete](const CloudWatchLogsClient*, const Model::DeleteMetricFilterRequest&, const Model::DeleteMetricFilterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteMetricFilterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the retention policy of the specified log group. Log events would
          * not expire if they belong to log groups without a retention policy. </p>
@@ -488,6 +682,28 @@ namespace Model
          */
         virtual void DeleteRetentionPolicyAsync(const Model::DeleteRetentionPolicyRequest& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the retention policy of the specified log group. Log events would
+         * not expire if they belong to log groups without a retention policy. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRetentionPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRetentionPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRetentionPolicyOutcome> DeleteRetentionPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRetentionPolicyOutcome>([this, request](const std::function<void(Model::DeleteRetentionPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRetentionPolicyAsync(request, [complete](const CloudWatchLogsClient*, const Model::DeleteRetentionPolicyRequest&, const Model::DeleteRetentionPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRetentionPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a subscription filter associated with the specified log group. </p>
          */
@@ -507,6 +723,27 @@ namespace Model
          */
         virtual void DeleteSubscriptionFilterAsync(const Model::DeleteSubscriptionFilterRequest& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a subscription filter associated with the specified log group. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSubscriptionFilterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSubscriptionFilterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSubscriptionFilterOutcome> DeleteSubscriptionFilterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSubscriptionFilterOutcome>([this, request](const std::function<void(Model::DeleteSubscriptionFilterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSubscriptionFilterAsync(request, [complete](const CloudWatchLogsClient*, const Model::DeleteSubscriptionFilterRequest&, const Model::DeleteSubscriptionFilterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSubscriptionFilterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns all the destinations that are associated with the AWS account making
          * the request. The list returned in the response is ASCII-sorted by destination
@@ -544,6 +781,33 @@ namespace Model
          */
         virtual void DescribeDestinationsAsync(const Model::DescribeDestinationsRequest& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns all the destinations that are associated with the AWS account making
+         * the request. The list returned in the response is ASCII-sorted by destination
+         * name. </p> <p> By default, this operation returns up to 50 destinations. If
+         * there are more destinations to list, the response would contain a <code
+         * class="code">nextToken</code> value in the response body. You can also limit the
+         * number of destinations returned in the response by specifying the <code
+         * class="code">limit</code> parameter in the request. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDestinationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDestinationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDestinationsOutcome> DescribeDestinationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDestinationsOutcome>([this, request](const std::function<void(Model::DescribeDestinationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDestinationsAsync(request, [complete](const CloudWatchLogsClient*, const Model::DescribeDestinationsRequest&, const Model::DescribeDestinationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDestinationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns all the export tasks that are associated with the AWS account making
          * the request. The export tasks can be filtered based on <code>TaskId</code> or
@@ -584,6 +848,34 @@ namespace Model
          */
         virtual void DescribeExportTasksAsync(const Model::DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns all the export tasks that are associated with the AWS account making
+         * the request. The export tasks can be filtered based on <code>TaskId</code> or
+         * <code>TaskStatus</code>. </p> <p> By default, this operation returns up to 50
+         * export tasks that satisfy the specified filters. If there are more export tasks
+         * to list, the response would contain a <code class="code">nextToken</code> value
+         * in the response body. You can also limit the number of export tasks returned in
+         * the response by specifying the <code class="code">limit</code> parameter in the
+         * request. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeExportTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeExportTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeExportTasksOutcome> DescribeExportTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeExportTasksOutcome>([this, request](const std::function<void(Model::DescribeExportTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeExportTasksAsync(request, [complete](const CloudWatchLogsClient*, const Model::DescribeExportTasksRequest&, const Model::DescribeExportTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeExportTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns all the log groups that are associated with the AWS account making
          * the request. The list returned in the response is ASCII-sorted by log group
@@ -621,6 +913,33 @@ namespace Model
          */
         virtual void DescribeLogGroupsAsync(const Model::DescribeLogGroupsRequest& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns all the log groups that are associated with the AWS account making
+         * the request. The list returned in the response is ASCII-sorted by log group
+         * name. </p> <p> By default, this operation returns up to 50 log groups. If there
+         * are more log groups to list, the response would contain a <code
+         * class="code">nextToken</code> value in the response body. You can also limit the
+         * number of log groups returned in the response by specifying the <code
+         * class="code">limit</code> parameter in the request. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLogGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLogGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLogGroupsOutcome> DescribeLogGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLogGroupsOutcome>([this, request](const std::function<void(Model::DescribeLogGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLogGroupsAsync(request, [complete](const CloudWatchLogsClient*, const Model::DescribeLogGroupsRequest&, const Model::DescribeLogGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLogGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns all the log streams that are associated with the specified log
          * group. The list returned in the response is ASCII-sorted by log stream name.
@@ -661,6 +980,34 @@ namespace Model
          */
         virtual void DescribeLogStreamsAsync(const Model::DescribeLogStreamsRequest& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns all the log streams that are associated with the specified log
+         * group. The list returned in the response is ASCII-sorted by log stream name.
+         * </p> <p> By default, this operation returns up to 50 log streams. If there are
+         * more log streams to list, the response would contain a <code
+         * class="code">nextToken</code> value in the response body. You can also limit the
+         * number of log streams returned in the response by specifying the <code
+         * class="code">limit</code> parameter in the request. This operation has a limit
+         * of five transactions per second, after which transactions are throttled. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLogStreamsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLogStreamsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLogStreamsOutcome> DescribeLogStreamsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLogStreamsOutcome>([this, request](const std::function<void(Model::DescribeLogStreamsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLogStreamsAsync(request, [complete](const CloudWatchLogsClient*, const Model::DescribeLogStreamsRequest&, const Model::DescribeLogStreamsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLogStreamsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns all the metrics filters associated with the specified log group. The
          * list returned in the response is ASCII-sorted by filter name. </p> <p> By
@@ -698,6 +1045,33 @@ namespace Model
          */
         virtual void DescribeMetricFiltersAsync(const Model::DescribeMetricFiltersRequest& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns all the metrics filters associated with the specified log group. The
+         * list returned in the response is ASCII-sorted by filter name. </p> <p> By
+         * default, this operation returns up to 50 metric filters. If there are more
+         * metric filters to list, the response would contain a <code
+         * class="code">nextToken</code> value in the response body. You can also limit the
+         * number of metric filters returned in the response by specifying the <code
+         * class="code">limit</code> parameter in the request. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeMetricFiltersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeMetricFiltersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeMetricFiltersOutcome> DescribeMetricFiltersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeMetricFiltersOutcome>([this, request](const std::function<void(Model::DescribeMetricFiltersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeMetricFiltersAsync(request, [complete](const CloudWatchLogsClient*, const Model::DescribeMetricFiltersRequest&, const Model::DescribeMetricFiltersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeMetricFiltersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns all the subscription filters associated with the specified log
          * group. The list returned in the response is ASCII-sorted by filter name. </p>
@@ -735,6 +1109,33 @@ namespace Model
          */
         virtual void DescribeSubscriptionFiltersAsync(const Model::DescribeSubscriptionFiltersRequest& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns all the subscription filters associated with the specified log
+         * group. The list returned in the response is ASCII-sorted by filter name. </p>
+         * <p> By default, this operation returns up to 50 subscription filters. If there
+         * are more subscription filters to list, the response would contain a <code
+         * class="code">nextToken</code> value in the response body. You can also limit the
+         * number of subscription filters returned in the response by specifying the <code
+         * class="code">limit</code> parameter in the request. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSubscriptionFiltersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSubscriptionFiltersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSubscriptionFiltersOutcome> DescribeSubscriptionFiltersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSubscriptionFiltersOutcome>([this, request](const std::function<void(Model::DescribeSubscriptionFiltersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSubscriptionFiltersAsync(request, [complete](const CloudWatchLogsClient*, const Model::DescribeSubscriptionFiltersRequest&, const Model::DescribeSubscriptionFiltersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSubscriptionFiltersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Retrieves log events, optionally filtered by a filter pattern from the
          * specified log group. You can provide an optional time range to filter the
@@ -796,6 +1197,41 @@ namespace Model
          */
         virtual void FilterLogEventsAsync(const Model::FilterLogEventsRequest& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Retrieves log events, optionally filtered by a filter pattern from the
+         * specified log group. You can provide an optional time range to filter the
+         * results on the event <code class="code">timestamp</code>. You can limit the
+         * streams searched to an explicit list of <code
+         * class="code">logStreamNames</code>. </p> <p> By default, this operation returns
+         * as much matching log events as can fit in a response size of 1MB, up to 10,000
+         * log events, or all the events found within a time-bounded scan window. If the
+         * response includes a <code class="code">nextToken</code>, then there is more data
+         * to search, and the search can be resumed with a new request providing the
+         * nextToken. The response will contain a list of <code
+         * class="code">searchedLogStreams</code> that contains information about which
+         * streams were searched in the request and whether they have been searched
+         * completely or require further pagination. The <code class="code">limit</code>
+         * parameter in the request. can be used to specify the maximum number of events to
+         * return in a page. </p>
+         *
+         * Returns an awaitable that starts the operation the way FilterLogEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::FilterLogEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::FilterLogEventsOutcome> FilterLogEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::FilterLogEventsOutcome>([this, request](const std::function<void(Model::FilterLogEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->FilterLogEventsAsync(request, [complete](const CloudWatchLogsClient*, const Model::FilterLogEventsRequest&, const Model::FilterLogEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::FilterLogEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Retrieves log events from the specified log stream. You can provide an
          * optional time range to filter the results on the event <code
@@ -842,6 +1278,36 @@ namespace Model
          */
         virtual void GetLogEventsAsync(const Model::GetLogEventsRequest& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Retrieves log events from the specified log stream. You can provide an
+         * optional time range to filter the results on the event <code
+         * class="code">timestamp</code>. </p> <p> By default, this operation returns as
+         * much log events as can fit in a response size of 1MB, up to 10,000 log events.
+         * The response will always include a <code class="code">nextForwardToken</code>
+         * and a <code class="code">nextBackwardToken</code> in the response body. You can
+         * use any of these tokens in subsequent <code class="code">GetLogEvents</code>
+         * requests to paginate through events in either forward or backward direction. You
+         * can also limit the number of log events returned in the response by specifying
+         * the <code class="code">limit</code> parameter in the request. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetLogEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetLogEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetLogEventsOutcome> GetLogEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetLogEventsOutcome>([this, request](const std::function<void(Model::GetLogEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetLogEventsAsync(request, [complete](const CloudWatchLogsClient*, const Model::GetLogEventsRequest&, const Model::GetLogEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetLogEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates or updates a <code>Destination</code>. A destination encapsulates a
          * physical resource (such as a Kinesis stream) and allows you to subscribe to a
@@ -891,6 +1357,37 @@ namespace Model
          */
         virtual void PutDestinationAsync(const Model::PutDestinationRequest& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates or updates a <code>Destination</code>. A destination encapsulates a
+         * physical resource (such as a Kinesis stream) and allows you to subscribe to a
+         * real-time stream of log events of a different account, ingested through <code
+         * class="code">PutLogEvents</code> requests. Currently, the only supported
+         * physical resource is a Amazon Kinesis stream belonging to the same account as
+         * the destination. </p> <p> A destination controls what is written to its Amazon
+         * Kinesis stream through an access policy. By default, PutDestination does not set
+         * any access policy with the destination, which means a cross-account user will
+         * not be able to call <code>PutSubscriptionFilter</code> against this destination.
+         * To enable that, the destination owner must call
+         * <code>PutDestinationPolicy</code> after PutDestination. </p>
+         *
+         * Returns an awaitable that starts the operation the way PutDestinationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutDestinationRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutDestinationOutcome> PutDestinationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutDestinationOutcome>([this, request](const std::function<void(Model::PutDestinationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutDestinationAsync(request, [complete](const CloudWatchLogsClient*, const Model::PutDestinationRequest&, const Model::PutDestinationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutDestinationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates or updates an access policy associated with an existing
          * <code>Destination</code>. An access policy is an <a
@@ -922,6 +1419,31 @@ namespace Model
          */
         virtual void PutDestinationPolicyAsync(const Model::PutDestinationPolicyRequest& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates or updates an access policy associated with an existing
+         * <code>Destination</code>. An access policy is an <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/policies_overview.html">IAM
+         * policy document</a> that is used to authorize claims to register a subscription
+         * filter against a given destination. </p>
+         *
+         * Returns an awaitable that starts the operation the way PutDestinationPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutDestinationPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutDestinationPolicyOutcome> PutDestinationPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutDestinationPolicyOutcome>([this, request](const std::function<void(Model::PutDestinationPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutDestinationPolicyAsync(request, [complete](const CloudWatchLogsClient*, const Model::PutDestinationPolicyRequest&, const Model::PutDestinationPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutDestinationPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Uploads a batch of log events to the specified log stream. </p> <p> Every
          * PutLogEvents request must include the <code class="code">sequenceToken</code>
@@ -980,6 +1502,40 @@ namespace Model
          */
         virtual void PutLogEventsAsync(const Model::PutLogEventsRequest& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Uploads a batch of log events to the specified log stream. </p> <p> Every
+         * PutLogEvents request must include the <code class="code">sequenceToken</code>
+         * obtained from the response of the previous request. An upload in a newly created
+         * log stream does not require a <code class="code">sequenceToken</code>. </p> <p>
+         * The batch of events must satisfy the following constraints: <ul> <li>The maximum
+         * batch size is 1,048,576 bytes, and this size is calculated as the sum of all
+         * event messages in UTF-8, plus 26 bytes for each log event.</li> <li>None of the
+         * log events in the batch can be more than 2 hours in the future.</li> <li>None of
+         * the log events in the batch can be older than 14 days or the retention period of
+         * the log group.</li> <li>The log events in the batch must be in chronological
+         * ordered by their <code class="code">timestamp</code>.</li> <li>The maximum
+         * number of log events in a batch is 10,000.</li> <li>A batch of log events in a
+         * single PutLogEvents request cannot span more than 24 hours. Otherwise, the
+         * PutLogEvents operation will fail.</li> </ul> </p>
+         *
+         * Returns an awaitable that starts the operation the way PutLogEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutLogEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutLogEventsOutcome> PutLogEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutLogEventsOutcome>([this, request](const std::function<void(Model::PutLogEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutLogEventsAsync(request, [complete](const CloudWatchLogsClient*, const Model::PutLogEventsRequest&, const Model::PutLogEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutLogEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates or updates a metric filter and associates it with the specified log
          * group. Metric filters allow you to configure rules to extract metric data from
@@ -1011,6 +1567,31 @@ namespace Model
          */
         virtual void PutMetricFilterAsync(const Model::PutMetricFilterRequest& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates or updates a metric filter and associates it with the specified log
+         * group. Metric filters allow you to configure rules to extract metric data from
+         * log events ingested through <code class="code">PutLogEvents</code> requests.
+         * </p> <p> The maximum number of metric filters that can be associated with a log
+         * group is 100. </p>
+         *
+         * Returns an awaitable that starts the operation the way PutMetricFilterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutMetricFilterRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutMetricFilterOutcome> PutMetricFilterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutMetricFilterOutcome>([this, request](const std::function<void(Model::PutMetricFilterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutMetricFilterAsync(request, [complete](const CloudWatchLogsClient*, const Model::PutMetricFilterRequest&, const Model::PutMetricFilterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutMetricFilterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Sets the retention of the specified log group. A retention policy allows you
          * to configure the number of days you want to retain log events in the specified
@@ -1036,6 +1617,29 @@ namespace Model
          */
         virtual void PutRetentionPolicyAsync(const Model::PutRetentionPolicyRequest& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Sets the retention of the specified log group. A retention policy allows you
+         * to configure the number of days you want to retain log events in the specified
+         * log group. </p>
+         *
+         * Returns an awaitable that starts the operation the way PutRetentionPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutRetentionPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutRetentionPolicyOutcome> PutRetentionPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutRetentionPolicyOutcome>([this, request](const std::function<void(Model::PutRetentionPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutRetentionPolicyAsync(request, [complete](const CloudWatchLogsClient*, const Model::PutRetentionPolicyRequest&, const Model::PutRetentionPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutRetentionPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates or updates a subscription filter and associates it with the
          * specified log group. Subscription filters allow you to subscribe to a real-time
@@ -1091,6 +1695,39 @@ namespace Model
          */
         virtual void PutSubscriptionFilterAsync(const Model::PutSubscriptionFilterRequest& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates or updates a subscription filter and associates it with the
+         * specified log group. Subscription filters allow you to subscribe to a real-time
+         * stream of log events ingested through <code class="code">PutLogEvents</code>
+         * requests and have them delivered to a specific destination. Currently, the
+         * supported destinations are: <ul> <li> An Amazon Kinesis stream belonging to the
+         * same account as the subscription filter, for same-account delivery. </li> <li> A
+         * logical destination (used via an ARN of <code>Destination</code>) belonging to a
+         * different account, for cross-account delivery. </li> <li> An Amazon Kinesis
+         * Firehose stream belonging to the same account as the subscription filter, for
+         * same-account delivery. </li> <li> An AWS Lambda function belonging to the same
+         * account as the subscription filter, for same-account delivery. </li> </ul> </p>
+         * <p> Currently there can only be one subscription filter associated with a log
+         * group. </p>
+         *
+         * Returns an awaitable that starts the operation the way PutSubscriptionFilterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutSubscriptionFilterRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutSubscriptionFilterOutcome> PutSubscriptionFilterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutSubscriptionFilterOutcome>([this, request](const std::function<void(Model::PutSubscriptionFilterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutSubscriptionFilterAsync(request, [complete](const CloudWatchLogsClient*, const Model::PutSubscriptionFilterRequest&, const Model::PutSubscriptionFilterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutSubscriptionFilterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Tests the filter pattern of a metric filter against a sample of log event
          * messages. You can use this operation to validate the correctness of a metric
@@ -1116,6 +1753,29 @@ namespace Model
          */
         virtual void TestMetricFilterAsync(const Model::TestMetricFilterRequest& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Tests the filter pattern of a metric filter against a sample of log event
+         * messages. You can use this operation to validate the correctness of a metric
+         * filter pattern. </p>
+         *
+         * Returns an awaitable that starts the operation the way TestMetricFilterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TestMetricFilterRequest>
+        Aws::Utils::Threading::Awaitable<Model::TestMetricFilterOutcome> TestMetricFilterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TestMetricFilterOutcome>([this, request](const std::function<void(Model::TestMetricFilterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TestMetricFilterAsync(request, [complete](const CloudWatchLogsClient*, const Model::TestMetricFilterRequest&, const Model::TestMetricFilterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TestMetricFilterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -46,6 +46,7 @@
 #include <aws/machinelearning/model/UpdateEvaluationResult.h>
 #include <aws/machinelearning/model/UpdateMLModelResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -285,6 +286,40 @@ namespace Model
          */
         virtual void CreateBatchPredictionAsync(const Model::CreateBatchPredictionRequest& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Generates predictions for a group of observations. The observations to
+         * process exist in one or more data files referenced by a <code>DataSource</code>.
+         * This operation creates a new <code>BatchPrediction</code>, and uses an
+         * <code>MLModel</code> and the data files referenced by the
+         * <code>DataSource</code> as information sources. </p>
+         * <p><code>CreateBatchPrediction</code> is an asynchronous operation. In response
+         * to <code>CreateBatchPrediction</code>, Amazon Machine Learning (Amazon ML)
+         * immediately returns and sets the <code>BatchPrediction</code> status to
+         * <code>PENDING</code>. After the <code>BatchPrediction</code> completes, Amazon
+         * ML sets the status to <code>COMPLETED</code>. </p> <p>You can poll for status
+         * updates by using the <a>GetBatchPrediction</a> operation and checking the
+         * <code>Status</code> parameter of the result. After the <code>COMPLETED</code>
+         * status appears, the results are available in the location specified by the
+         * <code>OutputUri</code> parameter.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateBatchPredictionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateBatchPredictionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateBatchPredictionOutcome> CreateBatchPredictionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateBatchPredictionOutcome>([this, request](const std::function<void(Model::CreateBatchPredictionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateBatchPredictionAsync(request, [complete](const MachineLearningClient*, const Model::CreateBatchPredictionRequest&, const Model::CreateBatchPredictionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateBatchPredictionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a <code>DataSource</code> object from an <a
          * href="http://aws.amazon.com/rds/"> Amazon Relational Database Service</a>
@@ -349,6 +384,42 @@ namespace Model
          */
         virtual void CreateDataSourceFromRDSAsync(const Model::CreateDataSourceFromRDSRequest& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a <code>DataSource</code> object from an <a
+         * href="http://aws.amazon.com/rds/"> Amazon Relational Database Service</a>
+         * (Amazon RDS). A <code>DataSource</code> references data that can be used to
+         * perform <a>CreateMLModel</a>, <a>CreateEvaluation</a>, or
+         * <a>CreateBatchPrediction</a> operations.</p>
+         * <p><code>CreateDataSourceFromRDS</code> is an asynchronous operation. In
+         * response to <code>CreateDataSourceFromRDS</code>, Amazon Machine Learning
+         * (Amazon ML) immediately returns and sets the <code>DataSource</code> status to
+         * <code>PENDING</code>. After the <code>DataSource</code> is created and ready for
+         * use, Amazon ML sets the <code>Status</code> parameter to <code>COMPLETED</code>.
+         * <code>DataSource</code> in <code>COMPLETED</code> or <code>PENDING</code> status
+         * can only be used to perform <a>CreateMLModel</a>, <a>CreateEvaluation</a>, or
+         * <a>CreateBatchPrediction</a> operations. </p> <p> If Amazon ML cannot accept the
+         * input source, it sets the <code>Status</code> parameter to <code>FAILED</code>
+         * and includes an error message in the <code>Message</code> attribute of the
+         * <a>GetDataSource</a> operation response. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDataSourceFromRDSAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDataSourceFromRDSRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDataSourceFromRDSOutcome> CreateDataSourceFromRDSAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDataSourceFromRDSOutcome>([this, request](const std::function<void(Model::CreateDataSourceFromRDSOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDataSourceFromRDSAsync(request, [complete](const MachineLearningClient*, const Model::CreateDataSourceFromRDSRequest&, const Model::CreateDataSourceFromRDSOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDataSourceFromRDSOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a <code>DataSource</code> from <a
          * href="http://aws.amazon.com/redshift/">Amazon Redshift</a>. A
@@ -458,6 +529,57 @@ namespace Model
          */
         virtual void CreateDataSourceFromRedshiftAsync(const Model::CreateDataSourceFromRedshiftRequest& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a <code>DataSource</code> from <a
+         * href="http://aws.amazon.com/redshift/">Amazon Redshift</a>. A
+         * <code>DataSource</code> references data that can be used to perform either
+         * <a>CreateMLModel</a>, <a>CreateEvaluation</a> or <a>CreateBatchPrediction</a>
+         * operations.</p> <p><code>CreateDataSourceFromRedshift</code> is an asynchronous
+         * operation. In response to <code>CreateDataSourceFromRedshift</code>, Amazon
+         * Machine Learning (Amazon ML) immediately returns and sets the
+         * <code>DataSource</code> status to <code>PENDING</code>. After the
+         * <code>DataSource</code> is created and ready for use, Amazon ML sets the
+         * <code>Status</code> parameter to <code>COMPLETED</code>. <code>DataSource</code>
+         * in <code>COMPLETED</code> or <code>PENDING</code> status can only be used to
+         * perform <a>CreateMLModel</a>, <a>CreateEvaluation</a>, or
+         * <a>CreateBatchPrediction</a> operations. </p> <p> If Amazon ML cannot accept the
+         * input source, it sets the <code>Status</code> parameter to <code>FAILED</code>
+         * and includes an error message in the <code>Message</code> attribute of the
+         * <a>GetDataSource</a> operation response. </p> <p>The observations should exist
+         * in the database hosted on an Amazon Redshift cluster and should be specified by
+         * a <code>SelectSqlQuery</code>. Amazon ML executes <a
+         * href="http://docs.aws.amazon.com/redshift/latest/dg/t_Unloading_tables.html">
+         * Unload</a> command in Amazon Redshift to transfer the result set of
+         * <code>SelectSqlQuery</code> to <code>S3StagingLocation.</code> </p> <p>After the
+         * <code>DataSource</code> is created, it's ready for use in evaluations and batch
+         * predictions. If you plan to use the <code>DataSource</code> to train an
+         * <code>MLModel</code>, the <code>DataSource</code> requires another item -- a
+         * recipe. A recipe describes the observation variables that participate in
+         * training an <code>MLModel</code>. A recipe describes how each input variable
+         * will be used in training. Will the variable be included or excluded from
+         * training? Will the variable be manipulated, for example, combined with another
+         * variable or split apart into word combinations? The recipe provides answers to
+         * these questions. For more information, see the Amazon Machine Learning Developer
+         * Guide.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDataSourceFromRedshiftAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDataSourceFromRedshiftRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDataSourceFromRedshiftOutcome> CreateDataSourceFromRedshiftAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDataSourceFromRedshiftOutcome>([this, request](const std::function<void(Model::CreateDataSourceFromRedshiftOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDataSourceFromRedshiftAsync(request, [complete](const MachineLearningClient*, const Model::CreateDataSourceFromRedshiftRequest&, const Model::CreateDataSourceFromRedshiftOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDataSourceFromRedshiftOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a <code>DataSource</code> object. A <code>DataSource</code>
          * references data that can be used to perform <a>CreateMLModel</a>,
@@ -567,6 +689,57 @@ namespace Model
          */
         virtual void CreateDataSourceFromS3Async(const Model::CreateDataSourceFromS3Request& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a <code>DataSource</code> object. A <code>DataSource</code>
+         * references data that can be used to perform <a>CreateMLModel</a>,
+         * <a>CreateEvaluation</a>, or <a>CreateBatchPrediction</a> operations.</p>
+         * <p><code>CreateDataSourceFromS3</code> is an asynchronous operation. In response
+         * to <code>CreateDataSourceFromS3</code>, Amazon Machine Learning (Amazon ML)
+         * immediately returns and sets the <code>DataSource</code> status to
+         * <code>PENDING</code>. After the <code>DataSource</code> is created and ready for
+         * use, Amazon ML sets the <code>Status</code> parameter to <code>COMPLETED</code>.
+         * <code>DataSource</code> in <code>COMPLETED</code> or <code>PENDING</code> status
+         * can only be used to perform <a>CreateMLModel</a>, <a>CreateEvaluation</a> or
+         * <a>CreateBatchPrediction</a> operations. </p> <p> If Amazon ML cannot accept the
+         * input source, it sets the <code>Status</code> parameter to <code>FAILED</code>
+         * and includes an error message in the <code>Message</code> attribute of the
+         * <a>GetDataSource</a> operation response. </p> <p>The observation data used in a
+         * <code>DataSource</code> should be ready to use; that is, it should have a
+         * consistent structure, and missing data values should be kept to a minimum. The
+         * observation data must reside in one or more CSV files in an Amazon Simple
+         * Storage Service (Amazon S3) bucket, along with a schema that describes the data
+         * items by name and type. The same schema must be used for all of the data files
+         * referenced by the <code>DataSource</code>. </p> <p>After the
+         * <code>DataSource</code> has been created, it's ready to use in evaluations and
+         * batch predictions. If you plan to use the <code>DataSource</code> to train an
+         * <code>MLModel</code>, the <code>DataSource</code> requires another item: a
+         * recipe. A recipe describes the observation variables that participate in
+         * training an <code>MLModel</code>. A recipe describes how each input variable
+         * will be used in training. Will the variable be included or excluded from
+         * training? Will the variable be manipulated, for example, combined with another
+         * variable, or split apart into word combinations? The recipe provides answers to
+         * these questions. For more information, see the <a
+         * href="http://docs.aws.amazon.com/machine-learning/latest/dg">Amazon Machine
+         * Learning Developer Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDataSourceFromS3Async does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDataSourceFromS3Request>
+        Aws::Utils::Threading::Awaitable<Model::CreateDataSourceFromS3Outcome> CreateDataSourceFromS3Awaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDataSourceFromS3Outcome>([this, request](const std::function<void(Model::CreateDataSourceFromS3Outcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDataSourceFromS3Async(request, [complete](const MachineLearningClient*, const Model::CreateDataSourceFromS3Request&, const Model::CreateDataSourceFromS3Outcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDataSourceFromS3Outcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new <code>Evaluation</code> of an <code>MLModel</code>. An
          * <code>MLModel</code> is evaluated on a set of observations associated to a
@@ -634,6 +807,43 @@ namespace Model
          */
         virtual void CreateEvaluationAsync(const Model::CreateEvaluationRequest& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new <code>Evaluation</code> of an <code>MLModel</code>. An
+         * <code>MLModel</code> is evaluated on a set of observations associated to a
+         * <code>DataSource</code>. Like a <code>DataSource</code> for an
+         * <code>MLModel</code>, the <code>DataSource</code> for an <code>Evaluation</code>
+         * contains values for the Target Variable. The <code>Evaluation</code> compares
+         * the predicted result for each observation to the actual outcome and provides a
+         * summary so that you know how effective the <code>MLModel</code> functions on the
+         * test data. Evaluation generates a relevant performance metric such as BinaryAUC,
+         * RegressionRMSE or MulticlassAvgFScore based on the corresponding
+         * <code>MLModelType</code>: <code>BINARY</code>, <code>REGRESSION</code> or
+         * <code>MULTICLASS</code>. </p> <p><code>CreateEvaluation</code> is an
+         * asynchronous operation. In response to <code>CreateEvaluation</code>, Amazon
+         * Machine Learning (Amazon ML) immediately returns and sets the evaluation status
+         * to <code>PENDING</code>. After the <code>Evaluation</code> is created and ready
+         * for use, Amazon ML sets the status to <code>COMPLETED</code>. </p> <p>You can
+         * use the <a>GetEvaluation</a> operation to check progress of the evaluation
+         * during the creation operation.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateEvaluationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateEvaluationRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateEvaluationOutcome> CreateEvaluationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateEvaluationOutcome>([this, request](const std::function<void(Model::CreateEvaluationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateEvaluationAsync(request, [complete](const MachineLearningClient*, const Model::CreateEvaluationRequest&, const Model::CreateEvaluationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateEvaluationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new <code>MLModel</code> using the data files and the recipe as
          * information sources. </p> <p>An <code>MLModel</code> is nearly immutable. Users
@@ -695,6 +905,41 @@ namespace Model
          */
         virtual void CreateMLModelAsync(const Model::CreateMLModelRequest& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new <code>MLModel</code> using the data files and the recipe as
+         * information sources. </p> <p>An <code>MLModel</code> is nearly immutable. Users
+         * can only update the <code>MLModelName</code> and the <code>ScoreThreshold</code>
+         * in an <code>MLModel</code> without creating a new <code>MLModel</code>. </p>
+         * <p><code>CreateMLModel</code> is an asynchronous operation. In response to
+         * <code>CreateMLModel</code>, Amazon Machine Learning (Amazon ML) immediately
+         * returns and sets the <code>MLModel</code> status to <code>PENDING</code>. After
+         * the <code>MLModel</code> is created and ready for use, Amazon ML sets the status
+         * to <code>COMPLETED</code>. </p> <p>You can use the <a>GetMLModel</a> operation
+         * to check progress of the <code>MLModel</code> during the creation operation.</p>
+         * <p> <a>CreateMLModel</a> requires a <code>DataSource</code> with computed
+         * statistics, which can be created by setting <code>ComputeStatistics</code> to
+         * <code>true</code> in <a>CreateDataSourceFromRDS</a>,
+         * <a>CreateDataSourceFromS3</a>, or <a>CreateDataSourceFromRedshift</a>
+         * operations. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateMLModelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateMLModelRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateMLModelOutcome> CreateMLModelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateMLModelOutcome>([this, request](const std::function<void(Model::CreateMLModelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateMLModelAsync(request, [complete](const MachineLearningClient*, const Model::CreateMLModelRequest&, const Model::CreateMLModelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateMLModelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a real-time endpoint for the <code>MLModel</code>. The endpoint
          * contains the URI of the <code>MLModel</code>; that is, the location to send
@@ -720,6 +965,29 @@ namespace Model
          */
         virtual void CreateRealtimeEndpointAsync(const Model::CreateRealtimeEndpointRequest& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a real-time endpoint for the <code>MLModel</code>. The endpoint
+         * contains the URI of the <code>MLModel</code>; that is, the location to send
+         * real-time prediction requests for the specified <code>MLModel</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateRealtimeEndpointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateRealtimeEndpointRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateRealtimeEndpointOutcome> CreateRealtimeEndpointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateRealtimeEndpointOutcome>([this, request](const std::function<void(Model::CreateRealtimeEndpointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateRealtimeEndpointAsync(request, [complete](const MachineLearningClient*, const Model::CreateRealtimeEndpointRequest&, const Model::CreateRealtimeEndpointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateRealtimeEndpointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Assigns the DELETED status to a <code>BatchPrediction</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteBatchPrediction</code> operation,
@@ -751,6 +1019,31 @@ namespace Model
          */
         virtual void DeleteBatchPredictionAsync(const Model::DeleteBatchPredictionRequest& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Assigns the DELETED status to a <code>BatchPrediction</code>, rendering it
+         * unusable.</p> <p>After using the <code>DeleteBatchPrediction</code> operation,
+         * you can use the <a>GetBatchPrediction</a> operation to verify that the status of
+         * the <code>BatchPrediction</code> changed to DELETED.</p> <p><b>Caution:</b> The
+         * result of the <code>DeleteBatchPrediction</code> operation is irreversible.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteBatchPredictionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBatchPredictionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBatchPredictionOutcome> DeleteBatchPredictionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBatchPredictionOutcome>([this, request](const std::function<void(Model::DeleteBatchPredictionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBatchPredictionAsync(request, [complete](const MachineLearningClient*, const Model::DeleteBatchPredictionRequest&, const Model::DeleteBatchPredictionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBatchPredictionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Assigns the DELETED status to a <code>DataSource</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteDataSource</code> operation, you
@@ -782,6 +1075,31 @@ namespace Model
          */
         virtual void DeleteDataSourceAsync(const Model::DeleteDataSourceRequest& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Assigns the DELETED status to a <code>DataSource</code>, rendering it
+         * unusable.</p> <p>After using the <code>DeleteDataSource</code> operation, you
+         * can use the <a>GetDataSource</a> operation to verify that the status of the
+         * <code>DataSource</code> changed to DELETED.</p> <p><b>Caution:</b> The results
+         * of the <code>DeleteDataSource</code> operation are irreversible.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDataSourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDataSourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDataSourceOutcome> DeleteDataSourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDataSourceOutcome>([this, request](const std::function<void(Model::DeleteDataSourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDataSourceAsync(request, [complete](const MachineLearningClient*, const Model::DeleteDataSourceRequest&, const Model::DeleteDataSourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDataSourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Assigns the <code>DELETED</code> status to an <code>Evaluation</code>,
          * rendering it unusable.</p> <p>After invoking the <code>DeleteEvaluation</code>
@@ -816,6 +1134,32 @@ namespace Model
          */
         virtual void DeleteEvaluationAsync(const Model::DeleteEvaluationRequest& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Assigns the <code>DELETED</code> status to an <code>Evaluation</code>,
+         * rendering it unusable.</p> <p>After invoking the <code>DeleteEvaluation</code>
+         * operation, you can use the <a>GetEvaluation</a> operation to verify that the
+         * status of the <code>Evaluation</code> changed to <code>DELETED</code>.</p>
+         * <p><b>Caution:</b> The results of the <code>DeleteEvaluation</code> operation
+         * are irreversible.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteEvaluationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteEvaluationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteEvaluationOutcome> DeleteEvaluationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteEvaluationOutcome>([this, request](const std::function<void(Model::DeleteEvaluationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteEvaluationAsync(request, [complete](const MachineLearningClient*, const Model::DeleteEvaluationRequest&, const Model::DeleteEvaluationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteEvaluationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Assigns the DELETED status to an <code>MLModel</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteMLModel</code> operation, you can
@@ -847,6 +1191,31 @@ namespace Model
          */
         virtual void DeleteMLModelAsync(const Model::DeleteMLModelRequest& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Assigns the DELETED status to an <code>MLModel</code>, rendering it
+         * unusable.</p> <p>After using the <code>DeleteMLModel</code> operation, you can
+         * use the <a>GetMLModel</a> operation to verify that the status of the
+         * <code>MLModel</code> changed to DELETED.</p> <p><b>Caution:</b> The result of
+         * the <code>DeleteMLModel</code> operation is irreversible.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteMLModelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteMLModelRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteMLModelOutcome> DeleteMLModelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteMLModelOutcome>([this, request](const std::function<void(Model::DeleteMLModelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteMLModelAsync(request, [complete](const MachineLearningClient*, const Model::DeleteMLModelRequest&, const Model::DeleteMLModelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteMLModelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a real time endpoint of an <code>MLModel</code>.</p>
          */
@@ -866,6 +1235,27 @@ namespace Model
          */
         virtual void DeleteRealtimeEndpointAsync(const Model::DeleteRealtimeEndpointRequest& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a real time endpoint of an <code>MLModel</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRealtimeEndpointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRealtimeEndpointRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRealtimeEndpointOutcome> DeleteRealtimeEndpointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRealtimeEndpointOutcome>([this, request](const std::function<void(Model::DeleteRealtimeEndpointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRealtimeEndpointAsync(request, [complete](const MachineLearningClient*, const Model::DeleteRealtimeEndpointRequest&, const Model::DeleteRealtimeEndpointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRealtimeEndpointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of <code>BatchPrediction</code> operations that match the
          * search criteria in the request.</p>
@@ -888,6 +1278,28 @@ namespace Model
          */
         virtual void DescribeBatchPredictionsAsync(const Model::DescribeBatchPredictionsRequest& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of <code>BatchPrediction</code> operations that match the
+         * search criteria in the request.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeBatchPredictionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeBatchPredictionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeBatchPredictionsOutcome> DescribeBatchPredictionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeBatchPredictionsOutcome>([this, request](const std::function<void(Model::DescribeBatchPredictionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeBatchPredictionsAsync(request, [complete](const MachineLearningClient*, const Model::DescribeBatchPredictionsRequest&, const Model::DescribeBatchPredictionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeBatchPredictionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of <code>DataSource</code> that match the search criteria in
          * the request.</p>
@@ -910,6 +1322,28 @@ namespace Model
          */
         virtual void DescribeDataSourcesAsync(const Model::DescribeDataSourcesRequest& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of <code>DataSource</code> that match the search criteria in
+         * the request.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDataSourcesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDataSourcesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDataSourcesOutcome> DescribeDataSourcesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDataSourcesOutcome>([this, request](const std::function<void(Model::DescribeDataSourcesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDataSourcesAsync(request, [complete](const MachineLearningClient*, const Model::DescribeDataSourcesRequest&, const Model::DescribeDataSourcesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDataSourcesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of <code>DescribeEvaluations</code> that match the search
          * criteria in the request.</p>
@@ -932,6 +1366,28 @@ namespace Model
          */
         virtual void DescribeEvaluationsAsync(const Model::DescribeEvaluationsRequest& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of <code>DescribeEvaluations</code> that match the search
+         * criteria in the request.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEvaluationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEvaluationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEvaluationsOutcome> DescribeEvaluationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEvaluationsOutcome>([this, request](const std::function<void(Model::DescribeEvaluationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEvaluationsAsync(request, [complete](const MachineLearningClient*, const Model::DescribeEvaluationsRequest&, const Model::DescribeEvaluationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEvaluationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of <code>MLModel</code> that match the search criteria in the
          * request.</p>
@@ -954,6 +1410,28 @@ namespace Model
          */
         virtual void DescribeMLModelsAsync(const Model::DescribeMLModelsRequest& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of <code>MLModel</code> that match the search criteria in the
+         * request.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeMLModelsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeMLModelsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeMLModelsOutcome> DescribeMLModelsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeMLModelsOutcome>([this, request](const std::function<void(Model::DescribeMLModelsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeMLModelsAsync(request, [complete](const MachineLearningClient*, const Model::DescribeMLModelsRequest&, const Model::DescribeMLModelsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeMLModelsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a <code>BatchPrediction</code> that includes detailed metadata,
          * status, and data file information for a <code>Batch Prediction</code>
@@ -979,6 +1457,29 @@ namespace Model
          */
         virtual void GetBatchPredictionAsync(const Model::GetBatchPredictionRequest& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a <code>BatchPrediction</code> that includes detailed metadata,
+         * status, and data file information for a <code>Batch Prediction</code>
+         * request.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetBatchPredictionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBatchPredictionRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBatchPredictionOutcome> GetBatchPredictionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBatchPredictionOutcome>([this, request](const std::function<void(Model::GetBatchPredictionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBatchPredictionAsync(request, [complete](const MachineLearningClient*, const Model::GetBatchPredictionRequest&, const Model::GetBatchPredictionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBatchPredictionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a <code>DataSource</code> that includes metadata and data file
          * information, as well as the current status of the <code>DataSource</code>.</p>
@@ -1010,6 +1511,31 @@ namespace Model
          */
         virtual void GetDataSourceAsync(const Model::GetDataSourceRequest& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a <code>DataSource</code> that includes metadata and data file
+         * information, as well as the current status of the <code>DataSource</code>.</p>
+         * <p><code>GetDataSource</code> provides results in normal or verbose format. The
+         * verbose format adds the schema description and the list of files pointed to by
+         * the DataSource to the normal format.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDataSourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDataSourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDataSourceOutcome> GetDataSourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDataSourceOutcome>([this, request](const std::function<void(Model::GetDataSourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDataSourceAsync(request, [complete](const MachineLearningClient*, const Model::GetDataSourceRequest&, const Model::GetDataSourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDataSourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns an <code>Evaluation</code> that includes metadata as well as the
          * current status of the <code>Evaluation</code>.</p>
@@ -1032,6 +1558,28 @@ namespace Model
          */
         virtual void GetEvaluationAsync(const Model::GetEvaluationRequest& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns an <code>Evaluation</code> that includes metadata as well as the
+         * current status of the <code>Evaluation</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetEvaluationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetEvaluationRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetEvaluationOutcome> GetEvaluationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetEvaluationOutcome>([this, request](const std::function<void(Model::GetEvaluationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetEvaluationAsync(request, [complete](const MachineLearningClient*, const Model::GetEvaluationRequest&, const Model::GetEvaluationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetEvaluationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns an <code>MLModel</code> that includes detailed metadata, and data
          * source information as well as the current status of the
@@ -1060,6 +1608,30 @@ namespace Model
          */
         virtual void GetMLModelAsync(const Model::GetMLModelRequest& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns an <code>MLModel</code> that includes detailed metadata, and data
+         * source information as well as the current status of the
+         * <code>MLModel</code>.</p> <p><code>GetMLModel</code> provides results in normal
+         * or verbose format. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetMLModelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetMLModelRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetMLModelOutcome> GetMLModelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetMLModelOutcome>([this, request](const std::function<void(Model::GetMLModelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetMLModelAsync(request, [complete](const MachineLearningClient*, const Model::GetMLModelRequest&, const Model::GetMLModelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetMLModelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Generates a prediction for the observation using the specified <code>ML
          * Model</code>.</p> <note><title>Note</title> <p>Not all response parameters will
@@ -1088,6 +1660,30 @@ namespace Model
          */
         virtual void PredictAsync(const Model::PredictRequest& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Generates a prediction for the observation using the specified <code>ML
+         * Model</code>.</p> <note><title>Note</title> <p>Not all response parameters will
+         * be populated. Whether a response parameter is populated depends on the type of
+         * model requested.</p></note>
+         *
+         * Returns an awaitable that starts the operation the way PredictAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PredictRequest>
+        Aws::Utils::Threading::Awaitable<Model::PredictOutcome> PredictAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PredictOutcome>([this, request](const std::function<void(Model::PredictOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PredictAsync(request, [complete](const MachineLearningClient*, const Model::PredictRequest&, const Model::PredictOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PredictOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the <code>BatchPredictionName</code> of a
          * <code>BatchPrediction</code>.</p> <p>You can use the <a>GetBatchPrediction</a>
@@ -1113,6 +1709,29 @@ namespace Model
          */
         virtual void UpdateBatchPredictionAsync(const Model::UpdateBatchPredictionRequest& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the <code>BatchPredictionName</code> of a
+         * <code>BatchPrediction</code>.</p> <p>You can use the <a>GetBatchPrediction</a>
+         * operation to view the contents of the updated data element.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateBatchPredictionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateBatchPredictionRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateBatchPredictionOutcome> UpdateBatchPredictionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateBatchPredictionOutcome>([this, request](const std::function<void(Model::UpdateBatchPredictionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateBatchPredictionAsync(request, [complete](const MachineLearningClient*, const Model::UpdateBatchPredictionRequest&, const Model::UpdateBatchPredictionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateBatchPredictionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the <code>DataSourceName</code> of a <code>DataSource</code>.</p>
          * <p>You can use the <a>GetDataSource</a> operation to view the contents of the
@@ -1138,6 +1757,29 @@ namespace Model
          */
         virtual void UpdateDataSourceAsync(const Model::UpdateDataSourceRequest& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the <code>DataSourceName</code> of a <code>DataSource</code>.</p>
+         * <p>You can use the <a>GetDataSource</a> operation to view the contents of the
+         * updated data element.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateDataSourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDataSourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDataSourceOutcome> UpdateDataSourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDataSourceOutcome>([this, request](const std::function<void(Model::UpdateDataSourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDataSourceAsync(request, [complete](const MachineLearningClient*, const Model::UpdateDataSourceRequest&, const Model::UpdateDataSourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDataSourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the <code>EvaluationName</code> of an <code>Evaluation</code>.</p>
          * <p>You can use the <a>GetEvaluation</a> operation to view the contents of the
@@ -1163,6 +1805,29 @@ namespace Model
          */
         virtual void UpdateEvaluationAsync(const Model::UpdateEvaluationRequest& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the <code>EvaluationName</code> of an <code>Evaluation</code>.</p>
+         * <p>You can use the <a>GetEvaluation</a> operation to view the contents of the
+         * updated data element.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateEvaluationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateEvaluationRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateEvaluationOutcome> UpdateEvaluationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateEvaluationOutcome>([this, request](const std::function<void(Model::UpdateEvaluationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateEvaluationAsync(request, [complete](const MachineLearningClient*, const Model::UpdateEvaluationRequest&, const Model::UpdateEvaluationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateEvaluationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the <code>MLModelName</code> and the <code>ScoreThreshold</code> of
          * an <code>MLModel</code>.</p> <p>You can use the <a>GetMLModel</a> operation to
@@ -1188,6 +1853,29 @@ namespace Model
          */
         virtual void UpdateMLModelAsync(const Model::UpdateMLModelRequest& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the <code>MLModelName</code> and the <code>ScoreThreshold</code> of
+         * an <code>MLModel</code>.</p> <p>You can use the <a>GetMLModel</a> operation to
+         * view the contents of the updated data element.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateMLModelAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateMLModelRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateMLModelOutcome> UpdateMLModelAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateMLModelOutcome>([this, request](const std::function<void(Model::UpdateMLModelOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateMLModelAsync(request, [complete](const MachineLearningClient*, const Model::UpdateMLModelRequest&, const Model::UpdateMLModelOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateMLModelOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
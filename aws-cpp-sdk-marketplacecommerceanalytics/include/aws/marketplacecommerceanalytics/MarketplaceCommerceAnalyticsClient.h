@@ -22,6 +22,7 @@
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/marketplacecommerceanalytics/model/GenerateDataSetResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -153,6 +154,36 @@ namespace Model
          */
         virtual void GenerateDataSetAsync(const Model::GenerateDataSetRequest& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Given a data set type and data set publication date, asynchronously publishes
+         * the requested data set to the specified S3 bucket and notifies the specified SNS
+         * topic once the data is available. Returns a unique request identifier that can
+         * be used to correlate requests with notifications from the SNS topic. Data sets
+         * will be published in comma-separated values (CSV) format with the file name
+         * {data_set_type}_YYYY-MM-DD.csv. If a file with the same name already exists
+         * (e.g. if the same data set is requested twice), the original file will be
+         * overwritten by the new file. Requires a Role with an attached permissions policy
+         * providing Allow permissions for the following actions: s3:PutObject,
+         * s3:GetBucketLocation, sns:GetTopicAttributes, sns:Publish, iam:GetRolePolicy.
+         *
+         * Returns an awaitable that starts the operation the way GenerateDataSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GenerateDataSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::GenerateDataSetOutcome> GenerateDataSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GenerateDataSetOutcome>([this, request](const std::function<void(Model::GenerateDataSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GenerateDataSetAsync(request, [complete](const MarketplaceCommerceAnalyticsClient*, const Model::GenerateDataSetRequest&, const Model::GenerateDataSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GenerateDataSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
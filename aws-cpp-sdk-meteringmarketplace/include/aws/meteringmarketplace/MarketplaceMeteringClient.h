@@ -22,6 +22,7 @@
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/meteringmarketplace/model/MeterUsageResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -134,6 +135,28 @@ namespace Model
          */
         virtual void MeterUsageAsync(const Model::MeterUsageRequest& request, const MeterUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>API to emit metering records. For identical requests, the API is idempotent.
+         * It simply returns the metering record ID. </p>
+         *
+         * Returns an awaitable that starts the operation the way MeterUsageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::MeterUsageRequest>
+        Aws::Utils::Threading::Awaitable<Model::MeterUsageOutcome> MeterUsageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::MeterUsageOutcome>([this, request](const std::function<void(Model::MeterUsageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->MeterUsageAsync(request, [complete](const MarketplaceMeteringClient*, const Model::MeterUsageRequest&, const Model::MeterUsageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::MeterUsageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -27,6 +27,7 @@
 #include <aws/monitoring/model/ListMetricsResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -186,6 +187,28 @@ namespace Model
          */
         virtual void DeleteAlarmsAsync(const Model::DeleteAlarmsRequest& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes all specified alarms. In the event of an error, no alarms are
+         * deleted. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAlarmsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAlarmsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAlarmsOutcome> DeleteAlarmsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAlarmsOutcome>([this, request](const std::function<void(Model::DeleteAlarmsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAlarmsAsync(request, [complete](const CloudWatchClient*, const Model::DeleteAlarmsRequest&, const Model::DeleteAlarmsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAlarmsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Retrieves history for the specified alarm. Filter alarms by date range or
          * item type. If an alarm name is not specified, Amazon CloudWatch returns
@@ -217,6 +240,31 @@ namespace Model
          */
         virtual void DescribeAlarmHistoryAsync(const Model::DescribeAlarmHistoryRequest& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Retrieves history for the specified alarm. Filter alarms by date range or
+         * item type. If an alarm name is not specified, Amazon CloudWatch returns
+         * histories for all of the owner's alarms. </p> <note> Amazon CloudWatch retains
+         * the history of an alarm for two weeks, whether or not you delete the alarm.
+         * </note>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAlarmHistoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAlarmHistoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAlarmHistoryOutcome> DescribeAlarmHistoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAlarmHistoryOutcome>([this, request](const std::function<void(Model::DescribeAlarmHistoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAlarmHistoryAsync(request, [complete](const CloudWatchClient*, const Model::DescribeAlarmHistoryRequest&, const Model::DescribeAlarmHistoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAlarmHistoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Retrieves alarms with the specified names. If no name is specified, all
          * alarms for the user are returned. Alarms can be retrieved by using only a prefix
@@ -242,6 +290,29 @@ namespace Model
          */
         virtual void DescribeAlarmsAsync(const Model::DescribeAlarmsRequest& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Retrieves alarms with the specified names. If no name is specified, all
+         * alarms for the user are returned. Alarms can be retrieved by using only a prefix
+         * for the alarm name, the alarm state, or a prefix for any action. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAlarmsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAlarmsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAlarmsOutcome> DescribeAlarmsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAlarmsOutcome>([this, request](const std::function<void(Model::DescribeAlarmsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAlarmsAsync(request, [complete](const CloudWatchClient*, const Model::DescribeAlarmsRequest&, const Model::DescribeAlarmsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAlarmsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Retrieves all alarms for a single metric. Specify a statistic, period, or
          * unit to filter the set of alarms further. </p>
@@ -264,6 +335,28 @@ namespace Model
          */
         virtual void DescribeAlarmsForMetricAsync(const Model::DescribeAlarmsForMetricRequest& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Retrieves all alarms for a single metric. Specify a statistic, period, or
+         * unit to filter the set of alarms further. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAlarmsForMetricAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAlarmsForMetricRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAlarmsForMetricOutcome> DescribeAlarmsForMetricAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAlarmsForMetricOutcome>([this, request](const std::function<void(Model::DescribeAlarmsForMetricOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAlarmsForMetricAsync(request, [complete](const CloudWatchClient*, const Model::DescribeAlarmsForMetricRequest&, const Model::DescribeAlarmsForMetricOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAlarmsForMetricOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Disables actions for the specified alarms. When an alarm's actions are
          * disabled the alarm's state may change, but none of the alarm's actions will
@@ -289,6 +382,29 @@ namespace Model
          */
         virtual void DisableAlarmActionsAsync(const Model::DisableAlarmActionsRequest& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Disables actions for the specified alarms. When an alarm's actions are
+         * disabled the alarm's state may change, but none of the alarm's actions will
+         * execute. </p>
+         *
+         * Returns an awaitable that starts the operation the way DisableAlarmActionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableAlarmActionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableAlarmActionsOutcome> DisableAlarmActionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableAlarmActionsOutcome>([this, request](const std::function<void(Model::DisableAlarmActionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableAlarmActionsAsync(request, [complete](const CloudWatchClient*, const Model::DisableAlarmActionsRequest&, const Model::DisableAlarmActionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableAlarmActionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Enables actions for the specified alarms. </p>
          */
@@ -308,6 +424,27 @@ namespace Model
          */
         virtual void EnableAlarmActionsAsync(const Model::EnableAlarmActionsRequest& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Enables actions for the specified alarms. </p>
+         *
+         * Returns an awaitable that starts the operation the way EnableAlarmActionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableAlarmActionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableAlarmActionsOutcome> EnableAlarmActionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableAlarmActionsOutcome>([this, request](const std::function<void(Model::EnableAlarmActionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableAlarmActionsAsync(request, [complete](const CloudWatchClient*, const Model::EnableAlarmActionsRequest&, const Model::EnableAlarmActionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableAlarmActionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Gets statistics for the specified metric. </p> <p> The maximum number of
          * data points that can be queried is 50,850, whereas the maximum number of data
@@ -396,6 +533,50 @@ namespace Model
          */
         virtual void GetMetricStatisticsAsync(const Model::GetMetricStatisticsRequest& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Gets statistics for the specified metric. </p> <p> The maximum number of
+         * data points that can be queried is 50,850, whereas the maximum number of data
+         * points returned from a single <code>GetMetricStatistics</code> request is 1,440.
+         * If you make a request that generates more than 1,440 data points, Amazon
+         * CloudWatch returns an error. In such a case, you can alter the request by
+         * narrowing the specified time range or increasing the specified period.
+         * Alternatively, you can make multiple requests across adjacent time ranges.
+         * <code>GetMetricStatistics</code> does not return the data in chronological
+         * order. </p> <p> Amazon CloudWatch aggregates data points based on the length of
+         * the <code>period</code> that you specify. For example, if you request statistics
+         * with a one-minute granularity, Amazon CloudWatch aggregates data points with
+         * time stamps that fall within the same one-minute period. In such a case, the
+         * data points queried can greatly outnumber the data points returned. </p> <p> The
+         * following examples show various statistics allowed by the data point query
+         * maximum of 50,850 when you call <code>GetMetricStatistics</code> on Amazon EC2
+         * instances with detailed (one-minute) monitoring enabled: </p> <ul>
+         * <li>Statistics for up to 400 instances for a span of one hour</li>
+         * <li>Statistics for up to 35 instances over a span of 24 hours</li>
+         * <li>Statistics for up to 2 instances over a span of 2 weeks</li> </ul> <p> For
+         * information about the namespace, metric names, and dimensions that other Amazon
+         * Web Services products use to send metrics to CloudWatch, go to <a
+         * href="http://docs.aws.amazon.com/AmazonCloudWatch/latest/DeveloperGuide/CW_Support_For_AWS.html">Amazon
+         * CloudWatch Metrics, Namespaces, and Dimensions Reference</a> in the <i>Amazon
+         * CloudWatch Developer Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetMetricStatisticsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetMetricStatisticsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetMetricStatisticsOutcome> GetMetricStatisticsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetMetricStatisticsOutcome>([this, request](const std::function<void(Model::GetMetricStatisticsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetMetricStatisticsAsync(request, [complete](const CloudWatchClient*, const Model::GetMetricStatisticsRequest&, const Model::GetMetricStatisticsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetMetricStatisticsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of valid metrics stored for the AWS account owner. Returned
          * metrics can be used with <a>GetMetricStatistics</a> to obtain statistical data
@@ -439,6 +620,35 @@ namespace Model
          */
         virtual void ListMetricsAsync(const Model::ListMetricsRequest& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of valid metrics stored for the AWS account owner. Returned
+         * metrics can be used with <a>GetMetricStatistics</a> to obtain statistical data
+         * for a given metric. </p> <note> Up to 500 results are returned for any one call.
+         * To retrieve further results, use returned <code>NextToken</code> values with
+         * subsequent <code>ListMetrics</code> operations. </note> <note> If you create a
+         * metric with the <a>PutMetricData</a> action, allow up to fifteen minutes for the
+         * metric to appear in calls to the <code>ListMetrics</code> action. Statistics
+         * about the metric, however, are available sooner using
+         * <a>GetMetricStatistics</a>. </note>
+         *
+         * Returns an awaitable that starts the operation the way ListMetricsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListMetricsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListMetricsOutcome> ListMetricsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListMetricsOutcome>([this, request](const std::function<void(Model::ListMetricsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListMetricsAsync(request, [complete](const CloudWatchClient*, const Model::ListMetricsRequest&, const Model::ListMetricsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListMetricsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates or updates an alarm and associates it with the specified Amazon
          * CloudWatch metric. Optionally, this operation can associate one or more Amazon
@@ -542,6 +752,55 @@ namespace Model
          */
         virtual void PutMetricAlarmAsync(const Model::PutMetricAlarmRequest& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates or updates an alarm and associates it with the specified Amazon
+         * CloudWatch metric. Optionally, this operation can associate one or more Amazon
+         * Simple Notification Service resources with the alarm. </p> <p> When this
+         * operation creates an alarm, the alarm state is immediately set to
+         * <code>INSUFFICIENT_DATA</code>. The alarm is evaluated and its
+         * <code>StateValue</code> is set appropriately. Any actions associated with the
+         * <code>StateValue</code> is then executed. </p> <note> When updating an existing
+         * alarm, its <code>StateValue</code> is left unchanged. </note> <note> If you are
+         * using an AWS Identity and Access Management (IAM) account to create or modify an
+         * alarm, you must have the following Amazon EC2 permissions: <ul>
+         * <li><code>ec2:DescribeInstanceStatus</code> and
+         * <code>ec2:DescribeInstances</code> for all alarms on Amazon EC2 instance status
+         * metrics.</li> <li><code>ec2:StopInstances</code> for alarms with stop
+         * actions.</li> <li><code>ec2:TerminateInstances</code> for alarms with terminate
+         * actions.</li> <li><code>ec2:DescribeInstanceRecoveryAttribute</code>, and
+         * <code>ec2:RecoverInstances</code> for alarms with recover actions.</li> </ul>
+         * <p>If you have read/write permissions for Amazon CloudWatch but not for Amazon
+         * EC2, you can still create an alarm but the stop or terminate actions won't be
+         * performed on the Amazon EC2 instance. However, if you are later granted
+         * permission to use the associated Amazon EC2 APIs, the alarm actions you created
+         * earlier will be performed. For more information about IAM permissions, see <a
+         * href="http://docs.aws.amazon.com//IAM/latest/UserGuide/PermissionsAndPolicies.html">Permissions
+         * and Policies</a> in <i>Using IAM</i>.</p> <p>If you are using an IAM role (e.g.,
+         * an Amazon EC2 instance profile), you cannot stop or terminate the instance using
+         * alarm actions. However, you can still see the alarm state and perform any other
+         * actions such as Amazon SNS notifications or Auto Scaling policies.</p> <p>If you
+         * are using temporary security credentials granted using the AWS Security Token
+         * Service (AWS STS), you cannot stop or terminate an Amazon EC2 instance using
+         * alarm actions.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way PutMetricAlarmAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutMetricAlarmRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutMetricAlarmOutcome> PutMetricAlarmAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutMetricAlarmOutcome>([this, request](const std::function<void(Model::PutMetricAlarmOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutMetricAlarmAsync(request, [complete](const CloudWatchClient*, const Model::PutMetricAlarmRequest&, const Model::PutMetricAlarmOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutMetricAlarmOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Publishes metric data points to Amazon CloudWatch. Amazon CloudWatch
          * associates the data points with the specified metric. If the specified metric
@@ -600,6 +859,40 @@ namespace Model
          */
         virtual void PutMetricDataAsync(const Model::PutMetricDataRequest& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Publishes metric data points to Amazon CloudWatch. Amazon CloudWatch
+         * associates the data points with the specified metric. If the specified metric
+         * does not exist, Amazon CloudWatch creates the metric. When Amazon CloudWatch
+         * creates a metric, it can take up to fifteen minutes for the metric to appear in
+         * calls to the <a>ListMetrics</a> action. </p> <p> Each <code>PutMetricData</code>
+         * request is limited to 8 KB in size for HTTP GET requests and is limited to 40 KB
+         * in size for HTTP POST requests. </p> <important>Although the <code>Value</code>
+         * parameter accepts numbers of type <code>Double</code>, Amazon CloudWatch rejects
+         * values that are either too small or too large. Values must be in the range of
+         * 8.515920e-109 to 1.174271e+108 (Base 10) or 2e-360 to 2e360 (Base 2). In
+         * addition, special values (e.g., NaN, +Infinity, -Infinity) are not supported.
+         * </important> <p>Data that is timestamped 24 hours or more in the past may take
+         * in excess of 48 hours to become available from submission time using
+         * <code>GetMetricStatistics</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way PutMetricDataAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutMetricDataRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutMetricDataOutcome> PutMetricDataAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutMetricDataOutcome>([this, request](const std::function<void(Model::PutMetricDataOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutMetricDataAsync(request, [complete](const CloudWatchClient*, const Model::PutMetricDataRequest&, const Model::PutMetricDataOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutMetricDataOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Temporarily sets the state of an alarm. When the updated
          * <code>StateValue</code> differs from the previous value, the action configured
@@ -643,6 +936,35 @@ namespace Model
          */
         virtual void SetAlarmStateAsync(const Model::SetAlarmStateRequest& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Temporarily sets the state of an alarm. When the updated
+         * <code>StateValue</code> differs from the previous value, the action configured
+         * for the appropriate state is invoked. For example, if your alarm is configured
+         * to send an Amazon SNS message when an alarm is triggered, temporarily changing
+         * the alarm's state to <b>ALARM</b> will send an Amazon SNS message. This is not a
+         * permanent change. The next periodic alarm check (in about a minute) will set the
+         * alarm to its actual state. Because the alarm state change happens very quickly,
+         * it is typically only visibile in the alarm's <b>History</b> tab in the Amazon
+         * CloudWatch console or through <code>DescribeAlarmHistory</code>. </p>
+         *
+         * Returns an awaitable that starts the operation the way SetAlarmStateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetAlarmStateRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetAlarmStateOutcome> SetAlarmStateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetAlarmStateOutcome>([this, request](const std::function<void(Model::SetAlarmStateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetAlarmStateAsync(request, [complete](const CloudWatchClient*, const Model::SetAlarmStateRequest&, const Model::SetAlarmStateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetAlarmStateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -56,6 +56,7 @@
 #include <aws/opsworks/model/RegisterVolumeResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -497,6 +498,36 @@ namespace Model
          */
         virtual void AssignInstanceAsync(const Model::AssignInstanceRequest& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Assign a registered instance to a layer.</p> <ul> <li>You can assign
+         * registered on-premises instances to any layer type.</li> <li>You can assign
+         * registered Amazon EC2 instances only to custom layers.</li> <li>You cannot use
+         * this action with instances that were created with AWS OpsWorks.</li> </ul>
+         * <p><b>Required Permissions</b>: To use this action, an AWS Identity and Access
+         * Management (IAM) user must have a Manage permissions level for the stack or an
+         * attached policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AssignInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AssignInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::AssignInstanceOutcome> AssignInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AssignInstanceOutcome>([this, request](const std::function<void(Model::AssignInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AssignInstanceAsync(request, [complete](const OpsWorksClient*, const Model::AssignInstanceRequest&, const Model::AssignInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AssignInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Assigns one of the stack's registered Amazon EBS volumes to a specified
          * instance. The volume must first be registered with the stack by calling
@@ -549,6 +580,38 @@ namespace Model
          */
         virtual void AssignVolumeAsync(const Model::AssignVolumeRequest& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Assigns one of the stack's registered Amazon EBS volumes to a specified
+         * instance. The volume must first be registered with the stack by calling
+         * <a>RegisterVolume</a>. After you register the volume, you must call
+         * <a>UpdateVolume</a> to specify a mount point before calling
+         * <code>AssignVolume</code>. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
+         * Management</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AssignVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AssignVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::AssignVolumeOutcome> AssignVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AssignVolumeOutcome>([this, request](const std::function<void(Model::AssignVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AssignVolumeAsync(request, [complete](const OpsWorksClient*, const Model::AssignVolumeRequest&, const Model::AssignVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AssignVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Associates one of the stack's registered Elastic IP addresses with a
          * specified instance. The address must first be registered with the stack by
@@ -595,6 +658,36 @@ namespace Model
          */
         virtual void AssociateElasticIpAsync(const Model::AssociateElasticIpRequest& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Associates one of the stack's registered Elastic IP addresses with a
+         * specified instance. The address must first be registered with the stack by
+         * calling <a>RegisterElasticIp</a>. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
+         * Management</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AssociateElasticIpAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AssociateElasticIpRequest>
+        Aws::Utils::Threading::Awaitable<Model::AssociateElasticIpOutcome> AssociateElasticIpAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AssociateElasticIpOutcome>([this, request](const std::function<void(Model::AssociateElasticIpOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AssociateElasticIpAsync(request, [complete](const OpsWorksClient*, const Model::AssociateElasticIpRequest&, const Model::AssociateElasticIpOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AssociateElasticIpOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Attaches an Elastic Load Balancing load balancer to a specified layer. For
          * more information, see <a
@@ -650,6 +743,39 @@ namespace Model
          */
         virtual void AttachElasticLoadBalancerAsync(const Model::AttachElasticLoadBalancerRequest& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attaches an Elastic Load Balancing load balancer to a specified layer. For
+         * more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/load-balancer-elb.html">Elastic
+         * Load Balancing</a>.</p> <note> <p>You must create the Elastic Load Balancing
+         * instance separately, by using the Elastic Load Balancing console, API, or CLI.
+         * For more information, see <a
+         * href="http://docs.aws.amazon.com/ElasticLoadBalancing/latest/DeveloperGuide/Welcome.html">
+         * Elastic Load Balancing Developer Guide</a>.</p> </note> <p><b>Required
+         * Permissions</b>: To use this action, an IAM user must have a Manage permissions
+         * level for the stack, or an attached policy that explicitly grants permissions.
+         * For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AttachElasticLoadBalancerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AttachElasticLoadBalancerRequest>
+        Aws::Utils::Threading::Awaitable<Model::AttachElasticLoadBalancerOutcome> AttachElasticLoadBalancerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AttachElasticLoadBalancerOutcome>([this, request](const std::function<void(Model::AttachElasticLoadBalancerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AttachElasticLoadBalancerAsync(request, [complete](const OpsWorksClient*, const Model::AttachElasticLoadBalancerRequest&, const Model::AttachElasticLoadBalancerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AttachElasticLoadBalancerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a clone of a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-cloning.html">Clone
@@ -690,6 +816,34 @@ namespace Model
          */
         virtual void CloneStackAsync(const Model::CloneStackRequest& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a clone of a specified stack. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-cloning.html">Clone
+         * a Stack</a>. By default, all parameters are set to the values used by the parent
+         * stack.</p> <p><b>Required Permissions</b>: To use this action, an IAM user must
+         * have an attached policy that explicitly grants permissions. For more information
+         * on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CloneStackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CloneStackRequest>
+        Aws::Utils::Threading::Awaitable<Model::CloneStackOutcome> CloneStackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CloneStackOutcome>([this, request](const std::function<void(Model::CloneStackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CloneStackAsync(request, [complete](const OpsWorksClient*, const Model::CloneStackRequest&, const Model::CloneStackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CloneStackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an app for a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingapps-creating.html">Creating
@@ -727,6 +881,33 @@ namespace Model
          */
         virtual void CreateAppAsync(const Model::CreateAppRequest& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an app for a specified stack. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingapps-creating.html">Creating
+         * Apps</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM user
+         * must have a Manage permissions level for the stack, or an attached policy that
+         * explicitly grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateAppAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAppRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAppOutcome> CreateAppAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAppOutcome>([this, request](const std::function<void(Model::CreateAppOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAppAsync(request, [complete](const OpsWorksClient*, const Model::CreateAppRequest&, const Model::CreateAppOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAppOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Runs deployment or stack commands. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingapps-deploying.html">Deploying
@@ -773,6 +954,36 @@ namespace Model
          */
         virtual void CreateDeploymentAsync(const Model::CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Runs deployment or stack commands. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingapps-deploying.html">Deploying
+         * Apps</a> and <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-commands.html">Run
+         * Stack Commands</a>.</p> <p><b>Required Permissions</b>: To use this action, an
+         * IAM user must have a Deploy or Manage permissions level for the stack, or an
+         * attached policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDeploymentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDeploymentRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDeploymentOutcome>([this, request](const std::function<void(Model::CreateDeploymentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDeploymentAsync(request, [complete](const OpsWorksClient*, const Model::CreateDeploymentRequest&, const Model::CreateDeploymentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDeploymentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an instance in a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-add.html">Adding
@@ -813,6 +1024,34 @@ namespace Model
          */
         virtual void CreateInstanceAsync(const Model::CreateInstanceRequest& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an instance in a specified stack. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-add.html">Adding
+         * an Instance to a Layer</a>.</p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have a Manage permissions level for the stack, or an
+         * attached policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateInstanceOutcome> CreateInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateInstanceOutcome>([this, request](const std::function<void(Model::CreateInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateInstanceAsync(request, [complete](const OpsWorksClient*, const Model::CreateInstanceRequest&, const Model::CreateInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a layer. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinglayers-basics-create.html">How
@@ -868,6 +1107,39 @@ namespace Model
          */
         virtual void CreateLayerAsync(const Model::CreateLayerRequest& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a layer. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinglayers-basics-create.html">How
+         * to Create a Layer</a>.</p> <note> <p>You should use <b>CreateLayer</b> for
+         * noncustom layer types such as PHP App Server only if the stack does not have an
+         * existing layer of that type. A stack can have at most one instance of each
+         * noncustom layer; if you attempt to create a second instance, <b>CreateLayer</b>
+         * fails. A stack can have an arbitrary number of custom layers, so you can call
+         * <b>CreateLayer</b> as many times as you like for that layer type.</p> </note>
+         * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
+         * Manage permissions level for the stack, or an attached policy that explicitly
+         * grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateLayerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateLayerRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateLayerOutcome> CreateLayerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateLayerOutcome>([this, request](const std::function<void(Model::CreateLayerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateLayerAsync(request, [complete](const OpsWorksClient*, const Model::CreateLayerRequest&, const Model::CreateLayerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateLayerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-edit.html">Create
@@ -905,6 +1177,33 @@ namespace Model
          */
         virtual void CreateStackAsync(const Model::CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new stack. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-edit.html">Create
+         * a New Stack</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have an attached policy that explicitly grants permissions. For more
+         * information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateStackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateStackRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateStackOutcome> CreateStackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateStackOutcome>([this, request](const std::function<void(Model::CreateStackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateStackAsync(request, [complete](const OpsWorksClient*, const Model::CreateStackRequest&, const Model::CreateStackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateStackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new user profile.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -936,6 +1235,31 @@ namespace Model
          */
         virtual void CreateUserProfileAsync(const Model::CreateUserProfileRequest& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new user profile.</p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have an attached policy that explicitly grants
+         * permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateUserProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateUserProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateUserProfileOutcome> CreateUserProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateUserProfileOutcome>([this, request](const std::function<void(Model::CreateUserProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateUserProfileAsync(request, [complete](const OpsWorksClient*, const Model::CreateUserProfileRequest&, const Model::CreateUserProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateUserProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a specified app.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -970,6 +1294,32 @@ namespace Model
          */
         virtual void DeleteAppAsync(const Model::DeleteAppRequest& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a specified app.</p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have a Manage permissions level for the stack, or an
+         * attached policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAppAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAppRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAppOutcome> DeleteAppAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAppOutcome>([this, request](const std::function<void(Model::DeleteAppOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAppAsync(request, [complete](const OpsWorksClient*, const Model::DeleteAppRequest&, const Model::DeleteAppOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAppOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a specified instance, which terminates the associated Amazon EC2
          * instance. You must stop an instance before you can delete it.</p> <p>For more
@@ -1016,6 +1366,36 @@ namespace Model
          */
         virtual void DeleteInstanceAsync(const Model::DeleteInstanceRequest& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a specified instance, which terminates the associated Amazon EC2
+         * instance. You must stop an instance before you can delete it.</p> <p>For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-delete.html">Deleting
+         * Instances</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteInstanceOutcome> DeleteInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteInstanceOutcome>([this, request](const std::function<void(Model::DeleteInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteInstanceAsync(request, [complete](const OpsWorksClient*, const Model::DeleteInstanceRequest&, const Model::DeleteInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a specified layer. You must first stop and then delete all associated
          * instances or unassign registered instances. For more information, see <a
@@ -1059,6 +1439,35 @@ namespace Model
          */
         virtual void DeleteLayerAsync(const Model::DeleteLayerRequest& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a specified layer. You must first stop and then delete all associated
+         * instances or unassign registered instances. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinglayers-basics-delete.html">How
+         * to Delete a Layer</a>.</p> <p><b>Required Permissions</b>: To use this action,
+         * an IAM user must have a Manage permissions level for the stack, or an attached
+         * policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteLayerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteLayerRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteLayerOutcome> DeleteLayerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteLayerOutcome>([this, request](const std::function<void(Model::DeleteLayerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteLayerAsync(request, [complete](const OpsWorksClient*, const Model::DeleteLayerRequest&, const Model::DeleteLayerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteLayerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a specified stack. You must first delete all instances, layers, and
          * apps or deregister registered instances. For more information, see <a
@@ -1102,6 +1511,35 @@ namespace Model
          */
         virtual void DeleteStackAsync(const Model::DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a specified stack. You must first delete all instances, layers, and
+         * apps or deregister registered instances. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-shutting.html">Shut
+         * Down a Stack</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteStackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteStackRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteStackOutcome> DeleteStackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteStackOutcome>([this, request](const std::function<void(Model::DeleteStackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteStackAsync(request, [complete](const OpsWorksClient*, const Model::DeleteStackRequest&, const Model::DeleteStackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteStackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a user profile.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -1133,6 +1571,31 @@ namespace Model
          */
         virtual void DeleteUserProfileAsync(const Model::DeleteUserProfileRequest& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a user profile.</p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have an attached policy that explicitly grants
+         * permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteUserProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteUserProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteUserProfileOutcome> DeleteUserProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteUserProfileOutcome>([this, request](const std::function<void(Model::DeleteUserProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteUserProfileAsync(request, [complete](const OpsWorksClient*, const Model::DeleteUserProfileRequest&, const Model::DeleteUserProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteUserProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deregisters a specified Amazon ECS cluster from a stack. For more
          * information, see <a
@@ -1173,6 +1636,34 @@ namespace Model
          */
         virtual void DeregisterEcsClusterAsync(const Model::DeregisterEcsClusterRequest& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deregisters a specified Amazon ECS cluster from a stack. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinglayers-ecscluster.html#workinglayers-ecscluster-delete">
+         * Resource Management</a>.</p> <p><b>Required Permissions</b>: To use this action,
+         * an IAM user must have a Manage permissions level for the stack or an attached
+         * policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html"/>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterEcsClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterEcsClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterEcsClusterOutcome> DeregisterEcsClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterEcsClusterOutcome>([this, request](const std::function<void(Model::DeregisterEcsClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterEcsClusterAsync(request, [complete](const OpsWorksClient*, const Model::DeregisterEcsClusterRequest&, const Model::DeregisterEcsClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterEcsClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deregisters a specified Elastic IP address. The address can then be
          * registered by another stack. For more information, see <a
@@ -1216,6 +1707,35 @@ namespace Model
          */
         virtual void DeregisterElasticIpAsync(const Model::DeregisterElasticIpRequest& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deregisters a specified Elastic IP address. The address can then be
+         * registered by another stack. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
+         * Management</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterElasticIpAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterElasticIpRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterElasticIpOutcome> DeregisterElasticIpAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterElasticIpOutcome>([this, request](const std::function<void(Model::DeregisterElasticIpOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterElasticIpAsync(request, [complete](const OpsWorksClient*, const Model::DeregisterElasticIpRequest&, const Model::DeregisterElasticIpOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterElasticIpOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deregister a registered Amazon EC2 or on-premises instance. This action
          * removes the instance from the stack and returns it to your control. This action
@@ -1256,6 +1776,34 @@ namespace Model
          */
         virtual void DeregisterInstanceAsync(const Model::DeregisterInstanceRequest& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deregister a registered Amazon EC2 or on-premises instance. This action
+         * removes the instance from the stack and returns it to your control. This action
+         * can not be used with instances that were created with AWS OpsWorks.</p>
+         * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
+         * Manage permissions level for the stack or an attached policy that explicitly
+         * grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterInstanceOutcome> DeregisterInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterInstanceOutcome>([this, request](const std::function<void(Model::DeregisterInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterInstanceAsync(request, [complete](const OpsWorksClient*, const Model::DeregisterInstanceRequest&, const Model::DeregisterInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deregisters an Amazon RDS instance.</p> <p><b>Required Permissions</b>: To
          * use this action, an IAM user must have a Manage permissions level for the stack,
@@ -1290,6 +1838,32 @@ namespace Model
          */
         virtual void DeregisterRdsDbInstanceAsync(const Model::DeregisterRdsDbInstanceRequest& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deregisters an Amazon RDS instance.</p> <p><b>Required Permissions</b>: To
+         * use this action, an IAM user must have a Manage permissions level for the stack,
+         * or an attached policy that explicitly grants permissions. For more information
+         * on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterRdsDbInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterRdsDbInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterRdsDbInstanceOutcome> DeregisterRdsDbInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterRdsDbInstanceOutcome>([this, request](const std::function<void(Model::DeregisterRdsDbInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterRdsDbInstanceAsync(request, [complete](const OpsWorksClient*, const Model::DeregisterRdsDbInstanceRequest&, const Model::DeregisterRdsDbInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterRdsDbInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deregisters an Amazon EBS volume. The volume can then be registered by
          * another stack. For more information, see <a
@@ -1333,10 +1907,39 @@ namespace Model
          */
         virtual void DeregisterVolumeAsync(const Model::DeregisterVolumeRequest& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
-         * <p>Describes the available AWS OpsWorks agent versions. You must specify a stack
-         * ID or a configuration manager. <code>DescribeAgentVersions</code> returns a list
-         * of available agent versions for the specified stack or configuration
+         * <p>Deregisters an Amazon EBS volume. The volume can then be registered by
+         * another stack. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
+         * Management</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeregisterVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeregisterVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeregisterVolumeOutcome> DeregisterVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeregisterVolumeOutcome>([this, request](const std::function<void(Model::DeregisterVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeregisterVolumeAsync(request, [complete](const OpsWorksClient*, const Model::DeregisterVolumeRequest&, const Model::DeregisterVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeregisterVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
+        /**
+         * <p>Describes the available AWS OpsWorks agent versions. You must specify a stack
+         * ID or a configuration manager. <code>DescribeAgentVersions</code> returns a list
+         * of available agent versions for the specified stack or configuration
          * manager.</p>
          */
         virtual Model::DescribeAgentVersionsOutcome DescribeAgentVersions(const Model::DescribeAgentVersionsRequest& request) const;
@@ -1361,6 +1964,30 @@ namespace Model
          */
         virtual void DescribeAgentVersionsAsync(const Model::DescribeAgentVersionsRequest& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the available AWS OpsWorks agent versions. You must specify a stack
+         * ID or a configuration manager. <code>DescribeAgentVersions</code> returns a list
+         * of available agent versions for the specified stack or configuration
+         * manager.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAgentVersionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAgentVersionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAgentVersionsOutcome> DescribeAgentVersionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAgentVersionsOutcome>([this, request](const std::function<void(Model::DescribeAgentVersionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAgentVersionsAsync(request, [complete](const OpsWorksClient*, const Model::DescribeAgentVersionsRequest&, const Model::DescribeAgentVersionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAgentVersionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests a description of a specified set of apps.</p> <note> <p>You must
          * specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1398,6 +2025,33 @@ namespace Model
          */
         virtual void DescribeAppsAsync(const Model::DescribeAppsRequest& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests a description of a specified set of apps.</p> <note> <p>You must
+         * specify at least one of the parameters.</p> </note> <p><b>Required
+         * Permissions</b>: To use this action, an IAM user must have a Show, Deploy, or
+         * Manage permissions level for the stack, or an attached policy that explicitly
+         * grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAppsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAppsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAppsOutcome> DescribeAppsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAppsOutcome>([this, request](const std::function<void(Model::DescribeAppsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAppsAsync(request, [complete](const OpsWorksClient*, const Model::DescribeAppsRequest&, const Model::DescribeAppsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAppsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the results of specified commands.</p> <note> <p>You must specify
          * at least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To
@@ -1435,6 +2089,33 @@ namespace Model
          */
         virtual void DescribeCommandsAsync(const Model::DescribeCommandsRequest& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the results of specified commands.</p> <note> <p>You must specify
+         * at least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To
+         * use this action, an IAM user must have a Show, Deploy, or Manage permissions
+         * level for the stack, or an attached policy that explicitly grants permissions.
+         * For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCommandsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCommandsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCommandsOutcome> DescribeCommandsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCommandsOutcome>([this, request](const std::function<void(Model::DescribeCommandsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCommandsAsync(request, [complete](const OpsWorksClient*, const Model::DescribeCommandsRequest&, const Model::DescribeCommandsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCommandsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests a description of a specified set of deployments.</p> <note> <p>You
          * must specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1472,6 +2153,33 @@ namespace Model
          */
         virtual void DescribeDeploymentsAsync(const Model::DescribeDeploymentsRequest& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests a description of a specified set of deployments.</p> <note> <p>You
+         * must specify at least one of the parameters.</p> </note> <p><b>Required
+         * Permissions</b>: To use this action, an IAM user must have a Show, Deploy, or
+         * Manage permissions level for the stack, or an attached policy that explicitly
+         * grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDeploymentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDeploymentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDeploymentsOutcome> DescribeDeploymentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDeploymentsOutcome>([this, request](const std::function<void(Model::DescribeDeploymentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDeploymentsAsync(request, [complete](const OpsWorksClient*, const Model::DescribeDeploymentsRequest&, const Model::DescribeDeploymentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDeploymentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes Amazon ECS clusters that are registered with a stack. If you
          * specify only a stack ID, you can use the <code>MaxResults</code> and
@@ -1518,6 +2226,36 @@ namespace Model
          */
         virtual void DescribeEcsClustersAsync(const Model::DescribeEcsClustersRequest& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes Amazon ECS clusters that are registered with a stack. If you
+         * specify only a stack ID, you can use the <code>MaxResults</code> and
+         * <code>NextToken</code> parameters to paginate the response. However, AWS
+         * OpsWorks currently supports only one cluster per layer, so the result set has a
+         * maximum of one element.</p> <p><b>Required Permissions</b>: To use this action,
+         * an IAM user must have a Show, Deploy, or Manage permissions level for the stack
+         * or an attached policy that explicitly grants permission. For more information on
+         * user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEcsClustersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEcsClustersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEcsClustersOutcome> DescribeEcsClustersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEcsClustersOutcome>([this, request](const std::function<void(Model::DescribeEcsClustersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEcsClustersAsync(request, [complete](const OpsWorksClient*, const Model::DescribeEcsClustersRequest&, const Model::DescribeEcsClustersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEcsClustersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/elastic-ip-addresses-eip.html">Elastic
@@ -1561,6 +2299,35 @@ namespace Model
          */
         virtual void DescribeElasticIpsAsync(const Model::DescribeElasticIpsRequest& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/elastic-ip-addresses-eip.html">Elastic
+         * IP addresses</a>.</p> <note> <p>You must specify at least one of the
+         * parameters.</p> </note> <p><b>Required Permissions</b>: To use this action, an
+         * IAM user must have a Show, Deploy, or Manage permissions level for the stack, or
+         * an attached policy that explicitly grants permissions. For more information on
+         * user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeElasticIpsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeElasticIpsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeElasticIpsOutcome> DescribeElasticIpsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeElasticIpsOutcome>([this, request](const std::function<void(Model::DescribeElasticIpsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeElasticIpsAsync(request, [complete](const OpsWorksClient*, const Model::DescribeElasticIpsRequest&, const Model::DescribeElasticIpsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeElasticIpsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes a stack's Elastic Load Balancing instances.</p> <note> <p>You must
          * specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1598,6 +2365,33 @@ namespace Model
          */
         virtual void DescribeElasticLoadBalancersAsync(const Model::DescribeElasticLoadBalancersRequest& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes a stack's Elastic Load Balancing instances.</p> <note> <p>You must
+         * specify at least one of the parameters.</p> </note> <p><b>Required
+         * Permissions</b>: To use this action, an IAM user must have a Show, Deploy, or
+         * Manage permissions level for the stack, or an attached policy that explicitly
+         * grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeElasticLoadBalancersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeElasticLoadBalancersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeElasticLoadBalancersOutcome> DescribeElasticLoadBalancersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeElasticLoadBalancersOutcome>([this, request](const std::function<void(Model::DescribeElasticLoadBalancersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeElasticLoadBalancersAsync(request, [complete](const OpsWorksClient*, const Model::DescribeElasticLoadBalancersRequest&, const Model::DescribeElasticLoadBalancersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeElasticLoadBalancersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests a description of a set of instances.</p> <note> <p>You must specify
          * at least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To
@@ -1635,6 +2429,33 @@ namespace Model
          */
         virtual void DescribeInstancesAsync(const Model::DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests a description of a set of instances.</p> <note> <p>You must specify
+         * at least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To
+         * use this action, an IAM user must have a Show, Deploy, or Manage permissions
+         * level for the stack, or an attached policy that explicitly grants permissions.
+         * For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeInstancesOutcome> DescribeInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeInstancesOutcome>([this, request](const std::function<void(Model::DescribeInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeInstancesAsync(request, [complete](const OpsWorksClient*, const Model::DescribeInstancesRequest&, const Model::DescribeInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests a description of one or more layers in a specified stack.</p> <note>
          * <p>You must specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1672,6 +2493,33 @@ namespace Model
          */
         virtual void DescribeLayersAsync(const Model::DescribeLayersRequest& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests a description of one or more layers in a specified stack.</p> <note>
+         * <p>You must specify at least one of the parameters.</p> </note> <p><b>Required
+         * Permissions</b>: To use this action, an IAM user must have a Show, Deploy, or
+         * Manage permissions level for the stack, or an attached policy that explicitly
+         * grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLayersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLayersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLayersOutcome> DescribeLayersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLayersOutcome>([this, request](const std::function<void(Model::DescribeLayersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLayersAsync(request, [complete](const OpsWorksClient*, const Model::DescribeLayersRequest&, const Model::DescribeLayersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLayersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes load-based auto scaling configurations for specified layers.</p>
          * <note> <p>You must specify at least one of the parameters.</p> </note>
@@ -1712,6 +2560,34 @@ namespace Model
          */
         virtual void DescribeLoadBasedAutoScalingAsync(const Model::DescribeLoadBasedAutoScalingRequest& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes load-based auto scaling configurations for specified layers.</p>
+         * <note> <p>You must specify at least one of the parameters.</p> </note>
+         * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
+         * Show, Deploy, or Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLoadBasedAutoScalingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLoadBasedAutoScalingRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLoadBasedAutoScalingOutcome> DescribeLoadBasedAutoScalingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLoadBasedAutoScalingOutcome>([this, request](const std::function<void(Model::DescribeLoadBasedAutoScalingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLoadBasedAutoScalingAsync(request, [complete](const OpsWorksClient*, const Model::DescribeLoadBasedAutoScalingRequest&, const Model::DescribeLoadBasedAutoScalingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLoadBasedAutoScalingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes a user's SSH information.</p> <p><b>Required Permissions</b>: To
          * use this action, an IAM user must have self-management enabled or an attached
@@ -1745,6 +2621,31 @@ namespace Model
          * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
         virtual void DescribeMyUserProfileAsync(const DescribeMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes a user's SSH information.</p> <p><b>Required Permissions</b>: To
+         * use this action, an IAM user must have self-management enabled or an attached
+         * policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeMyUserProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        Aws::Utils::Threading::Awaitable<Model::DescribeMyUserProfileOutcome> DescribeMyUserProfileAwaitable() const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeMyUserProfileOutcome>([this](const std::function<void(Model::DescribeMyUserProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeMyUserProfileAsync([complete](const OpsWorksClient*, const Model::DescribeMyUserProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeMyUserProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
         /**
          * <p>Describes the permissions for a specified stack.</p> <p><b>Required
          * Permissions</b>: To use this action, an IAM user must have a Manage permissions
@@ -1779,6 +2680,32 @@ namespace Model
          */
         virtual void DescribePermissionsAsync(const Model::DescribePermissionsRequest& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the permissions for a specified stack.</p> <p><b>Required
+         * Permissions</b>: To use this action, an IAM user must have a Manage permissions
+         * level for the stack, or an attached policy that explicitly grants permissions.
+         * For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribePermissionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribePermissionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribePermissionsOutcome> DescribePermissionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribePermissionsOutcome>([this, request](const std::function<void(Model::DescribePermissionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribePermissionsAsync(request, [complete](const OpsWorksClient*, const Model::DescribePermissionsRequest&, const Model::DescribePermissionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribePermissionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describe an instance's RAID arrays.</p> <note> <p>You must specify at least
          * one of the parameters.</p> </note> <p><b>Required Permissions</b>: To use this
@@ -1816,6 +2743,33 @@ namespace Model
          */
         virtual void DescribeRaidArraysAsync(const Model::DescribeRaidArraysRequest& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describe an instance's RAID arrays.</p> <note> <p>You must specify at least
+         * one of the parameters.</p> </note> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have a Show, Deploy, or Manage permissions level for
+         * the stack, or an attached policy that explicitly grants permissions. For more
+         * information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeRaidArraysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeRaidArraysRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeRaidArraysOutcome> DescribeRaidArraysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeRaidArraysOutcome>([this, request](const std::function<void(Model::DescribeRaidArraysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeRaidArraysAsync(request, [complete](const OpsWorksClient*, const Model::DescribeRaidArraysRequest&, const Model::DescribeRaidArraysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeRaidArraysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes Amazon RDS instances.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have a Show, Deploy, or Manage permissions level
@@ -1850,6 +2804,32 @@ namespace Model
          */
         virtual void DescribeRdsDbInstancesAsync(const Model::DescribeRdsDbInstancesRequest& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes Amazon RDS instances.</p> <p><b>Required Permissions</b>: To use
+         * this action, an IAM user must have a Show, Deploy, or Manage permissions level
+         * for the stack, or an attached policy that explicitly grants permissions. For
+         * more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeRdsDbInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeRdsDbInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeRdsDbInstancesOutcome> DescribeRdsDbInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeRdsDbInstancesOutcome>([this, request](const std::function<void(Model::DescribeRdsDbInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeRdsDbInstancesAsync(request, [complete](const OpsWorksClient*, const Model::DescribeRdsDbInstancesRequest&, const Model::DescribeRdsDbInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeRdsDbInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes AWS OpsWorks service errors.</p> <p><b>Required Permissions</b>: To
          * use this action, an IAM user must have a Show, Deploy, or Manage permissions
@@ -1884,6 +2864,32 @@ namespace Model
          */
         virtual void DescribeServiceErrorsAsync(const Model::DescribeServiceErrorsRequest& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes AWS OpsWorks service errors.</p> <p><b>Required Permissions</b>: To
+         * use this action, an IAM user must have a Show, Deploy, or Manage permissions
+         * level for the stack, or an attached policy that explicitly grants permissions.
+         * For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeServiceErrorsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeServiceErrorsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeServiceErrorsOutcome> DescribeServiceErrorsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeServiceErrorsOutcome>([this, request](const std::function<void(Model::DescribeServiceErrorsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeServiceErrorsAsync(request, [complete](const OpsWorksClient*, const Model::DescribeServiceErrorsRequest&, const Model::DescribeServiceErrorsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeServiceErrorsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests a description of a stack's provisioning parameters.</p>
          * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
@@ -1921,6 +2927,33 @@ namespace Model
          */
         virtual void DescribeStackProvisioningParametersAsync(const Model::DescribeStackProvisioningParametersRequest& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests a description of a stack's provisioning parameters.</p>
+         * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
+         * Show, Deploy, or Manage permissions level for the stack or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeStackProvisioningParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeStackProvisioningParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeStackProvisioningParametersOutcome> DescribeStackProvisioningParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeStackProvisioningParametersOutcome>([this, request](const std::function<void(Model::DescribeStackProvisioningParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeStackProvisioningParametersAsync(request, [complete](const OpsWorksClient*, const Model::DescribeStackProvisioningParametersRequest&, const Model::DescribeStackProvisioningParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeStackProvisioningParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the number of layers and apps in a specified stack, and the number
          * of instances in each state, such as <code>running_setup</code> or
@@ -1961,6 +2994,34 @@ namespace Model
          */
         virtual void DescribeStackSummaryAsync(const Model::DescribeStackSummaryRequest& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the number of layers and apps in a specified stack, and the number
+         * of instances in each state, such as <code>running_setup</code> or
+         * <code>online</code>.</p> <p><b>Required Permissions</b>: To use this action, an
+         * IAM user must have a Show, Deploy, or Manage permissions level for the stack, or
+         * an attached policy that explicitly grants permissions. For more information on
+         * user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeStackSummaryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeStackSummaryRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeStackSummaryOutcome> DescribeStackSummaryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeStackSummaryOutcome>([this, request](const std::function<void(Model::DescribeStackSummaryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeStackSummaryAsync(request, [complete](const OpsWorksClient*, const Model::DescribeStackSummaryRequest&, const Model::DescribeStackSummaryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeStackSummaryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests a description of one or more stacks.</p> <p><b>Required
          * Permissions</b>: To use this action, an IAM user must have a Show, Deploy, or
@@ -1995,6 +3056,32 @@ namespace Model
          */
         virtual void DescribeStacksAsync(const Model::DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests a description of one or more stacks.</p> <p><b>Required
+         * Permissions</b>: To use this action, an IAM user must have a Show, Deploy, or
+         * Manage permissions level for the stack, or an attached policy that explicitly
+         * grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeStacksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeStacksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeStacksOutcome> DescribeStacksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeStacksOutcome>([this, request](const std::function<void(Model::DescribeStacksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeStacksAsync(request, [complete](const OpsWorksClient*, const Model::DescribeStacksRequest&, const Model::DescribeStacksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeStacksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes time-based auto scaling configurations for specified instances.</p>
          * <note> <p>You must specify at least one of the parameters.</p> </note>
@@ -2035,6 +3122,34 @@ namespace Model
          */
         virtual void DescribeTimeBasedAutoScalingAsync(const Model::DescribeTimeBasedAutoScalingRequest& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes time-based auto scaling configurations for specified instances.</p>
+         * <note> <p>You must specify at least one of the parameters.</p> </note>
+         * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
+         * Show, Deploy, or Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTimeBasedAutoScalingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTimeBasedAutoScalingRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTimeBasedAutoScalingOutcome> DescribeTimeBasedAutoScalingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTimeBasedAutoScalingOutcome>([this, request](const std::function<void(Model::DescribeTimeBasedAutoScalingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTimeBasedAutoScalingAsync(request, [complete](const OpsWorksClient*, const Model::DescribeTimeBasedAutoScalingRequest&, const Model::DescribeTimeBasedAutoScalingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTimeBasedAutoScalingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describe specified users.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -2066,6 +3181,31 @@ namespace Model
          */
         virtual void DescribeUserProfilesAsync(const Model::DescribeUserProfilesRequest& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describe specified users.</p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have an attached policy that explicitly grants
+         * permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeUserProfilesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeUserProfilesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeUserProfilesOutcome> DescribeUserProfilesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeUserProfilesOutcome>([this, request](const std::function<void(Model::DescribeUserProfilesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeUserProfilesAsync(request, [complete](const OpsWorksClient*, const Model::DescribeUserProfilesRequest&, const Model::DescribeUserProfilesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeUserProfilesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes an instance's Amazon EBS volumes.</p> <note> <p>You must specify at
          * least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To use
@@ -2103,6 +3243,33 @@ namespace Model
          */
         virtual void DescribeVolumesAsync(const Model::DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes an instance's Amazon EBS volumes.</p> <note> <p>You must specify at
+         * least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To use
+         * this action, an IAM user must have a Show, Deploy, or Manage permissions level
+         * for the stack, or an attached policy that explicitly grants permissions. For
+         * more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVolumesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVolumesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVolumesOutcome> DescribeVolumesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVolumesOutcome>([this, request](const std::function<void(Model::DescribeVolumesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVolumesAsync(request, [complete](const OpsWorksClient*, const Model::DescribeVolumesRequest&, const Model::DescribeVolumesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVolumesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Detaches a specified Elastic Load Balancing instance from its layer.</p>
          * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
@@ -2137,6 +3304,32 @@ namespace Model
          */
         virtual void DetachElasticLoadBalancerAsync(const Model::DetachElasticLoadBalancerRequest& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Detaches a specified Elastic Load Balancing instance from its layer.</p>
+         * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
+         * Manage permissions level for the stack, or an attached policy that explicitly
+         * grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DetachElasticLoadBalancerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DetachElasticLoadBalancerRequest>
+        Aws::Utils::Threading::Awaitable<Model::DetachElasticLoadBalancerOutcome> DetachElasticLoadBalancerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DetachElasticLoadBalancerOutcome>([this, request](const std::function<void(Model::DetachElasticLoadBalancerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DetachElasticLoadBalancerAsync(request, [complete](const OpsWorksClient*, const Model::DetachElasticLoadBalancerRequest&, const Model::DetachElasticLoadBalancerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DetachElasticLoadBalancerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disassociates an Elastic IP address from its instance. The address remains
          * registered with the stack. For more information, see <a
@@ -2180,6 +3373,35 @@ namespace Model
          */
         virtual void DisassociateElasticIpAsync(const Model::DisassociateElasticIpRequest& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disassociates an Elastic IP address from its instance. The address remains
+         * registered with the stack. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
+         * Management</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisassociateElasticIpAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisassociateElasticIpRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisassociateElasticIpOutcome> DisassociateElasticIpAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisassociateElasticIpOutcome>([this, request](const std::function<void(Model::DisassociateElasticIpOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisassociateElasticIpAsync(request, [complete](const OpsWorksClient*, const Model::DisassociateElasticIpRequest&, const Model::DisassociateElasticIpOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisassociateElasticIpOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets a generated host name for the specified layer, based on the current host
          * name theme.</p> <p><b>Required Permissions</b>: To use this action, an IAM user
@@ -2214,6 +3436,32 @@ namespace Model
          */
         virtual void GetHostnameSuggestionAsync(const Model::GetHostnameSuggestionRequest& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets a generated host name for the specified layer, based on the current host
+         * name theme.</p> <p><b>Required Permissions</b>: To use this action, an IAM user
+         * must have a Manage permissions level for the stack, or an attached policy that
+         * explicitly grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetHostnameSuggestionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetHostnameSuggestionRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetHostnameSuggestionOutcome> GetHostnameSuggestionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetHostnameSuggestionOutcome>([this, request](const std::function<void(Model::GetHostnameSuggestionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetHostnameSuggestionAsync(request, [complete](const OpsWorksClient*, const Model::GetHostnameSuggestionRequest&, const Model::GetHostnameSuggestionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetHostnameSuggestionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <note>This action can be used only with Windows stacks.</note> <p>Grants RDP
          * access to a Windows instance for a specified time period.</p>
@@ -2236,6 +3484,28 @@ namespace Model
          */
         virtual void GrantAccessAsync(const Model::GrantAccessRequest& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <note>This action can be used only with Windows stacks.</note> <p>Grants RDP
+         * access to a Windows instance for a specified time period.</p>
+         *
+         * Returns an awaitable that starts the operation the way GrantAccessAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GrantAccessRequest>
+        Aws::Utils::Threading::Awaitable<Model::GrantAccessOutcome> GrantAccessAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GrantAccessOutcome>([this, request](const std::function<void(Model::GrantAccessOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GrantAccessAsync(request, [complete](const OpsWorksClient*, const Model::GrantAccessRequest&, const Model::GrantAccessOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GrantAccessOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Reboots a specified instance. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
@@ -2276,6 +3546,34 @@ namespace Model
          */
         virtual void RebootInstanceAsync(const Model::RebootInstanceRequest& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Reboots a specified instance. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
+         * Stopping, and Rebooting Instances</a>.</p> <p><b>Required Permissions</b>: To
+         * use this action, an IAM user must have a Manage permissions level for the stack,
+         * or an attached policy that explicitly grants permissions. For more information
+         * on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RebootInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RebootInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RebootInstanceOutcome> RebootInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RebootInstanceOutcome>([this, request](const std::function<void(Model::RebootInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RebootInstanceAsync(request, [complete](const OpsWorksClient*, const Model::RebootInstanceRequest&, const Model::RebootInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RebootInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers a specified Amazon ECS cluster with a stack. You can register only
          * one cluster with a stack. A cluster can be registered with only one stack. For
@@ -2322,6 +3620,36 @@ namespace Model
          */
         virtual void RegisterEcsClusterAsync(const Model::RegisterEcsClusterRequest& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers a specified Amazon ECS cluster with a stack. You can register only
+         * one cluster with a stack. A cluster can be registered with only one stack. For
+         * more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinglayers-ecscluster.html">
+         * Resource Management</a>.</p> <p><b>Required Permissions</b>: To use this action,
+         * an IAM user must have a Manage permissions level for the stack or an attached
+         * policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">
+         * Managing User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterEcsClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterEcsClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterEcsClusterOutcome> RegisterEcsClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterEcsClusterOutcome>([this, request](const std::function<void(Model::RegisterEcsClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterEcsClusterAsync(request, [complete](const OpsWorksClient*, const Model::RegisterEcsClusterRequest&, const Model::RegisterEcsClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterEcsClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers an Elastic IP address with a specified stack. An address can be
          * registered with only one stack at a time. If the address is already registered,
@@ -2350,10 +3678,28 @@ namespace Model
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
          * User Permissions</a>.</p>
          *
-         * returns a future to the operation so that it can be executed in parallel to other requests.
+         * returns a future to the operation so that it can be executed in parallel to other requests.
+         */
+        virtual Model::RegisterElasticIpOutcomeCallable RegisterElasticIpCallable(const Model::RegisterElasticIpRequest& request) const;
+
+        /**
+         * <p>Registers an Elastic IP address with a specified stack. An address can be
+         * registered with only one stack at a time. If the address is already registered,
+         * you must first deregister it by calling <a>DeregisterElasticIp</a>. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
+         * Management</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
-        virtual Model::RegisterElasticIpOutcomeCallable RegisterElasticIpCallable(const Model::RegisterElasticIpRequest& request) const;
+        virtual void RegisterElasticIpAsync(const Model::RegisterElasticIpRequest& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
          * <p>Registers an Elastic IP address with a specified stack. An address can be
          * registered with only one stack at a time. If the address is already registered,
@@ -2367,9 +3713,22 @@ namespace Model
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
          * User Permissions</a>.</p>
          *
-         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         * Returns an awaitable that starts the operation the way RegisterElasticIpAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
          */
-        virtual void RegisterElasticIpAsync(const Model::RegisterElasticIpRequest& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        template<typename REQUEST = Model::RegisterElasticIpRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterElasticIpOutcome> RegisterElasticIpAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterElasticIpOutcome>([this, request](const std::function<void(Model::RegisterElasticIpOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterElasticIpAsync(request, [complete](const OpsWorksClient*, const Model::RegisterElasticIpRequest&, const Model::RegisterElasticIpOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterElasticIpOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Registers instances with a specified stack that were created outside of AWS
@@ -2429,6 +3788,40 @@ namespace Model
          */
         virtual void RegisterInstanceAsync(const Model::RegisterInstanceRequest& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers instances with a specified stack that were created outside of AWS
+         * OpsWorks.</p> <note>We do not recommend using this action to register instances.
+         * The complete registration operation has two primary steps, installing the AWS
+         * OpsWorks agent on the instance and registering the instance with the stack.
+         * <code>RegisterInstance</code> handles only the second step. You should instead
+         * use the AWS CLI <code>register</code> command, which performs the entire
+         * registration operation. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/registered-instances-register.html">
+         * Registering an Instance with an AWS OpsWorks Stack</a>.</note> <p><b>Required
+         * Permissions</b>: To use this action, an IAM user must have a Manage permissions
+         * level for the stack or an attached policy that explicitly grants permissions.
+         * For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterInstanceOutcome> RegisterInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterInstanceOutcome>([this, request](const std::function<void(Model::RegisterInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterInstanceAsync(request, [complete](const OpsWorksClient*, const Model::RegisterInstanceRequest&, const Model::RegisterInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers an Amazon RDS instance with a stack.</p> <p><b>Required
          * Permissions</b>: To use this action, an IAM user must have a Manage permissions
@@ -2463,6 +3856,32 @@ namespace Model
          */
         virtual void RegisterRdsDbInstanceAsync(const Model::RegisterRdsDbInstanceRequest& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers an Amazon RDS instance with a stack.</p> <p><b>Required
+         * Permissions</b>: To use this action, an IAM user must have a Manage permissions
+         * level for the stack, or an attached policy that explicitly grants permissions.
+         * For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterRdsDbInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterRdsDbInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterRdsDbInstanceOutcome> RegisterRdsDbInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterRdsDbInstanceOutcome>([this, request](const std::function<void(Model::RegisterRdsDbInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterRdsDbInstanceAsync(request, [complete](const OpsWorksClient*, const Model::RegisterRdsDbInstanceRequest&, const Model::RegisterRdsDbInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterRdsDbInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers an Amazon EBS volume with a specified stack. A volume can be
          * registered with only one stack at a time. If the volume is already registered,
@@ -2512,6 +3931,37 @@ namespace Model
          */
         virtual void RegisterVolumeAsync(const Model::RegisterVolumeRequest& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers an Amazon EBS volume with a specified stack. A volume can be
+         * registered with only one stack at a time. If the volume is already registered,
+         * you must first deregister it by calling <a>DeregisterVolume</a>. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
+         * Management</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterVolumeOutcome> RegisterVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterVolumeOutcome>([this, request](const std::function<void(Model::RegisterVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterVolumeAsync(request, [complete](const OpsWorksClient*, const Model::RegisterVolumeRequest&, const Model::RegisterVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Specify the load-based auto scaling configuration for a specified layer. For
          * more information, see <a
@@ -2567,6 +4017,39 @@ namespace Model
          */
         virtual void SetLoadBasedAutoScalingAsync(const Model::SetLoadBasedAutoScalingRequest& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Specify the load-based auto scaling configuration for a specified layer. For
+         * more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-autoscaling.html">Managing
+         * Load with Time-based and Load-based Instances</a>.</p> <note> <p>To use
+         * load-based auto scaling, you must create a set of load-based auto scaling
+         * instances. Load-based auto scaling operates only on the instances from that set,
+         * so you must ensure that you have created enough instances to handle the maximum
+         * anticipated load.</p> </note> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have a Manage permissions level for the stack, or an
+         * attached policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetLoadBasedAutoScalingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetLoadBasedAutoScalingRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetLoadBasedAutoScalingOutcome> SetLoadBasedAutoScalingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetLoadBasedAutoScalingOutcome>([this, request](const std::function<void(Model::SetLoadBasedAutoScalingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetLoadBasedAutoScalingAsync(request, [complete](const OpsWorksClient*, const Model::SetLoadBasedAutoScalingRequest&, const Model::SetLoadBasedAutoScalingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetLoadBasedAutoScalingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Specifies a user's permissions. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingsecurity.html">Security
@@ -2607,6 +4090,34 @@ namespace Model
          */
         virtual void SetPermissionAsync(const Model::SetPermissionRequest& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Specifies a user's permissions. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingsecurity.html">Security
+         * and Permissions</a>.</p> <p><b>Required Permissions</b>: To use this action, an
+         * IAM user must have a Manage permissions level for the stack, or an attached
+         * policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetPermissionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetPermissionRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetPermissionOutcome> SetPermissionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetPermissionOutcome>([this, request](const std::function<void(Model::SetPermissionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetPermissionAsync(request, [complete](const OpsWorksClient*, const Model::SetPermissionRequest&, const Model::SetPermissionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetPermissionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Specify the time-based auto scaling configuration for a specified instance.
          * For more information, see <a
@@ -2650,6 +4161,35 @@ namespace Model
          */
         virtual void SetTimeBasedAutoScalingAsync(const Model::SetTimeBasedAutoScalingRequest& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Specify the time-based auto scaling configuration for a specified instance.
+         * For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-autoscaling.html">Managing
+         * Load with Time-based and Load-based Instances</a>.</p> <p><b>Required
+         * Permissions</b>: To use this action, an IAM user must have a Manage permissions
+         * level for the stack, or an attached policy that explicitly grants permissions.
+         * For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetTimeBasedAutoScalingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetTimeBasedAutoScalingRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetTimeBasedAutoScalingOutcome> SetTimeBasedAutoScalingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetTimeBasedAutoScalingOutcome>([this, request](const std::function<void(Model::SetTimeBasedAutoScalingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetTimeBasedAutoScalingAsync(request, [complete](const OpsWorksClient*, const Model::SetTimeBasedAutoScalingRequest&, const Model::SetTimeBasedAutoScalingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetTimeBasedAutoScalingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts a specified instance. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
@@ -2690,6 +4230,34 @@ namespace Model
          */
         virtual void StartInstanceAsync(const Model::StartInstanceRequest& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts a specified instance. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
+         * Stopping, and Rebooting Instances</a>.</p> <p><b>Required Permissions</b>: To
+         * use this action, an IAM user must have a Manage permissions level for the stack,
+         * or an attached policy that explicitly grants permissions. For more information
+         * on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way StartInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartInstanceOutcome> StartInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartInstanceOutcome>([this, request](const std::function<void(Model::StartInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartInstanceAsync(request, [complete](const OpsWorksClient*, const Model::StartInstanceRequest&, const Model::StartInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts a stack's instances. </p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2724,6 +4292,32 @@ namespace Model
          */
         virtual void StartStackAsync(const Model::StartStackRequest& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts a stack's instances. </p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have a Manage permissions level for the stack, or an
+         * attached policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way StartStackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartStackRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartStackOutcome> StartStackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartStackOutcome>([this, request](const std::function<void(Model::StartStackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartStackAsync(request, [complete](const OpsWorksClient*, const Model::StartStackRequest&, const Model::StartStackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartStackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Stops a specified instance. When you stop a standard instance, the data
          * disappears and must be reinstalled when you restart the instance. You can stop
@@ -2770,6 +4364,36 @@ namespace Model
          */
         virtual void StopInstanceAsync(const Model::StopInstanceRequest& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Stops a specified instance. When you stop a standard instance, the data
+         * disappears and must be reinstalled when you restart the instance. You can stop
+         * an Amazon EBS-backed instance without losing data. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
+         * Stopping, and Rebooting Instances</a>.</p> <p><b>Required Permissions</b>: To
+         * use this action, an IAM user must have a Manage permissions level for the stack,
+         * or an attached policy that explicitly grants permissions. For more information
+         * on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way StopInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StopInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::StopInstanceOutcome> StopInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StopInstanceOutcome>([this, request](const std::function<void(Model::StopInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StopInstanceAsync(request, [complete](const OpsWorksClient*, const Model::StopInstanceRequest&, const Model::StopInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StopInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Stops a specified stack.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2804,6 +4428,32 @@ namespace Model
          */
         virtual void StopStackAsync(const Model::StopStackRequest& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Stops a specified stack.</p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have a Manage permissions level for the stack, or an
+         * attached policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way StopStackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StopStackRequest>
+        Aws::Utils::Threading::Awaitable<Model::StopStackOutcome> StopStackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StopStackOutcome>([this, request](const std::function<void(Model::StopStackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StopStackAsync(request, [complete](const OpsWorksClient*, const Model::StopStackRequest&, const Model::StopStackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StopStackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Unassigns a registered instance from all of it's layers. The instance remains
          * in the stack as an unassigned instance and can be assigned to another layer, as
@@ -2844,6 +4494,34 @@ namespace Model
          */
         virtual void UnassignInstanceAsync(const Model::UnassignInstanceRequest& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Unassigns a registered instance from all of it's layers. The instance remains
+         * in the stack as an unassigned instance and can be assigned to another layer, as
+         * needed. You cannot use this action with instances that were created with AWS
+         * OpsWorks.</p> <p><b>Required Permissions</b>: To use this action, an IAM user
+         * must have a Manage permissions level for the stack or an attached policy that
+         * explicitly grants permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UnassignInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UnassignInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::UnassignInstanceOutcome> UnassignInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UnassignInstanceOutcome>([this, request](const std::function<void(Model::UnassignInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UnassignInstanceAsync(request, [complete](const OpsWorksClient*, const Model::UnassignInstanceRequest&, const Model::UnassignInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UnassignInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Unassigns an assigned Amazon EBS volume. The volume remains registered with
          * the stack. For more information, see <a
@@ -2887,6 +4565,35 @@ namespace Model
          */
         virtual void UnassignVolumeAsync(const Model::UnassignVolumeRequest& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Unassigns an assigned Amazon EBS volume. The volume remains registered with
+         * the stack. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
+         * Management</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UnassignVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UnassignVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::UnassignVolumeOutcome> UnassignVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UnassignVolumeOutcome>([this, request](const std::function<void(Model::UnassignVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UnassignVolumeAsync(request, [complete](const OpsWorksClient*, const Model::UnassignVolumeRequest&, const Model::UnassignVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UnassignVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a specified app.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Deploy or Manage permissions level for the
@@ -2921,6 +4628,32 @@ namespace Model
          */
         virtual void UpdateAppAsync(const Model::UpdateAppRequest& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a specified app.</p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have a Deploy or Manage permissions level for the
+         * stack, or an attached policy that explicitly grants permissions. For more
+         * information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAppAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAppRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAppOutcome> UpdateAppAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAppOutcome>([this, request](const std::function<void(Model::UpdateAppOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAppAsync(request, [complete](const OpsWorksClient*, const Model::UpdateAppRequest&, const Model::UpdateAppOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAppOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a registered Elastic IP address's name. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
@@ -2961,6 +4694,34 @@ namespace Model
          */
         virtual void UpdateElasticIpAsync(const Model::UpdateElasticIpRequest& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a registered Elastic IP address's name. For more information, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
+         * Management</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateElasticIpAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateElasticIpRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateElasticIpOutcome> UpdateElasticIpAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateElasticIpOutcome>([this, request](const std::function<void(Model::UpdateElasticIpOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateElasticIpAsync(request, [complete](const OpsWorksClient*, const Model::UpdateElasticIpRequest&, const Model::UpdateElasticIpOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateElasticIpOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a specified instance.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2995,6 +4756,32 @@ namespace Model
          */
         virtual void UpdateInstanceAsync(const Model::UpdateInstanceRequest& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a specified instance.</p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have a Manage permissions level for the stack, or an
+         * attached policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateInstanceOutcome> UpdateInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateInstanceOutcome>([this, request](const std::function<void(Model::UpdateInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateInstanceAsync(request, [complete](const OpsWorksClient*, const Model::UpdateInstanceRequest&, const Model::UpdateInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a specified layer.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -3029,6 +4816,32 @@ namespace Model
          */
         virtual void UpdateLayerAsync(const Model::UpdateLayerRequest& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a specified layer.</p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have a Manage permissions level for the stack, or an
+         * attached policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateLayerAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateLayerRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateLayerOutcome> UpdateLayerAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateLayerOutcome>([this, request](const std::function<void(Model::UpdateLayerOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateLayerAsync(request, [complete](const OpsWorksClient*, const Model::UpdateLayerRequest&, const Model::UpdateLayerOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateLayerOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a user's SSH public key.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have self-management enabled or an attached policy
@@ -3063,6 +4876,32 @@ namespace Model
          */
         virtual void UpdateMyUserProfileAsync(const Model::UpdateMyUserProfileRequest& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a user's SSH public key.</p> <p><b>Required Permissions</b>: To use
+         * this action, an IAM user must have self-management enabled or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateMyUserProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateMyUserProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateMyUserProfileOutcome> UpdateMyUserProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateMyUserProfileOutcome>([this, request](const std::function<void(Model::UpdateMyUserProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateMyUserProfileAsync(request, [complete](const OpsWorksClient*, const Model::UpdateMyUserProfileRequest&, const Model::UpdateMyUserProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateMyUserProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates an Amazon RDS instance.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have a Manage permissions level for the stack, or
@@ -3097,6 +4936,32 @@ namespace Model
          */
         virtual void UpdateRdsDbInstanceAsync(const Model::UpdateRdsDbInstanceRequest& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates an Amazon RDS instance.</p> <p><b>Required Permissions</b>: To use
+         * this action, an IAM user must have a Manage permissions level for the stack, or
+         * an attached policy that explicitly grants permissions. For more information on
+         * user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateRdsDbInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateRdsDbInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateRdsDbInstanceOutcome> UpdateRdsDbInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateRdsDbInstanceOutcome>([this, request](const std::function<void(Model::UpdateRdsDbInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateRdsDbInstanceAsync(request, [complete](const OpsWorksClient*, const Model::UpdateRdsDbInstanceRequest&, const Model::UpdateRdsDbInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateRdsDbInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a specified stack.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -3131,6 +4996,32 @@ namespace Model
          */
         virtual void UpdateStackAsync(const Model::UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a specified stack.</p> <p><b>Required Permissions</b>: To use this
+         * action, an IAM user must have a Manage permissions level for the stack, or an
+         * attached policy that explicitly grants permissions. For more information on user
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateStackAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateStackRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateStackOutcome> UpdateStackAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateStackOutcome>([this, request](const std::function<void(Model::UpdateStackOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateStackAsync(request, [complete](const OpsWorksClient*, const Model::UpdateStackRequest&, const Model::UpdateStackOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateStackOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a specified user profile.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have an attached policy that explicitly grants
@@ -3162,6 +5053,31 @@ namespace Model
          */
         virtual void UpdateUserProfileAsync(const Model::UpdateUserProfileRequest& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a specified user profile.</p> <p><b>Required Permissions</b>: To use
+         * this action, an IAM user must have an attached policy that explicitly grants
+         * permissions. For more information on user permissions, see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateUserProfileAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateUserProfileRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateUserProfileOutcome> UpdateUserProfileAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateUserProfileOutcome>([this, request](const std::function<void(Model::UpdateUserProfileOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateUserProfileAsync(request, [complete](const OpsWorksClient*, const Model::UpdateUserProfileRequest&, const Model::UpdateUserProfileOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateUserProfileOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates an Amazon EBS volume's name or mount point. For more information, see
          * <a
@@ -3205,6 +5121,35 @@ namespace Model
          */
         virtual void UpdateVolumeAsync(const Model::UpdateVolumeRequest& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates an Amazon EBS volume's name or mount point. For more information, see
+         * <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
+         * Management</a>.</p> <p><b>Required Permissions</b>: To use this action, an IAM
+         * user must have a Manage permissions level for the stack, or an attached policy
+         * that explicitly grants permissions. For more information on user permissions,
+         * see <a
+         * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
+         * User Permissions</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateVolumeOutcome> UpdateVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateVolumeOutcome>([this, request](const std::function<void(Model::UpdateVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateVolumeAsync(request, [complete](const OpsWorksClient*, const Model::UpdateVolumeRequest&, const Model::UpdateVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -93,6 +93,7 @@
 #include <aws/rds/model/RevokeDBSecurityGroupIngressResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -545,6 +546,28 @@ namespace Model
          */
         virtual void AddSourceIdentifierToSubscriptionAsync(const Model::AddSourceIdentifierToSubscriptionRequest& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds a source identifier to an existing RDS event notification
+         * subscription.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddSourceIdentifierToSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddSourceIdentifierToSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddSourceIdentifierToSubscriptionOutcome> AddSourceIdentifierToSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddSourceIdentifierToSubscriptionOutcome>([this, request](const std::function<void(Model::AddSourceIdentifierToSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddSourceIdentifierToSubscriptionAsync(request, [complete](const RDSClient*, const Model::AddSourceIdentifierToSubscriptionRequest&, const Model::AddSourceIdentifierToSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddSourceIdentifierToSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Adds metadata tags to an Amazon RDS resource. These tags can also be used
          * with cost allocation reporting to track cost associated with Amazon RDS
@@ -579,6 +602,32 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Adds metadata tags to an Amazon RDS resource. These tags can also be used
+         * with cost allocation reporting to track cost associated with Amazon RDS
+         * resources, or used in a Condition statement in an IAM policy for Amazon RDS.</p>
+         * <p>For an overview on tagging Amazon RDS resources, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/Overview.Tagging.html">Tagging
+         * Amazon RDS Resources</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsToResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsToResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsToResourceOutcome>([this, request](const std::function<void(Model::AddTagsToResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsToResourceAsync(request, [complete](const RDSClient*, const Model::AddTagsToResourceRequest&, const Model::AddTagsToResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsToResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Applies a pending maintenance action to a resource (for example, to a DB
          * instance).</p>
@@ -601,6 +650,28 @@ namespace Model
          */
         virtual void ApplyPendingMaintenanceActionAsync(const Model::ApplyPendingMaintenanceActionRequest& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Applies a pending maintenance action to a resource (for example, to a DB
+         * instance).</p>
+         *
+         * Returns an awaitable that starts the operation the way ApplyPendingMaintenanceActionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ApplyPendingMaintenanceActionRequest>
+        Aws::Utils::Threading::Awaitable<Model::ApplyPendingMaintenanceActionOutcome> ApplyPendingMaintenanceActionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ApplyPendingMaintenanceActionOutcome>([this, request](const std::function<void(Model::ApplyPendingMaintenanceActionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ApplyPendingMaintenanceActionAsync(request, [complete](const RDSClient*, const Model::ApplyPendingMaintenanceActionRequest&, const Model::ApplyPendingMaintenanceActionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ApplyPendingMaintenanceActionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Enables ingress to a DBSecurityGroup using one of two forms of
          * authorization. First, EC2 or VPC security groups can be added to the
@@ -656,6 +727,39 @@ namespace Model
          */
         virtual void AuthorizeDBSecurityGroupIngressAsync(const Model::AuthorizeDBSecurityGroupIngressRequest& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Enables ingress to a DBSecurityGroup using one of two forms of
+         * authorization. First, EC2 or VPC security groups can be added to the
+         * DBSecurityGroup if the application using the database is running on EC2 or VPC
+         * instances. Second, IP ranges are available if the application accessing your
+         * database is running on the Internet. Required parameters for this API are one of
+         * CIDR range, EC2SecurityGroupId for VPC, or (EC2SecurityGroupOwnerId and either
+         * EC2SecurityGroupName or EC2SecurityGroupId for non-VPC). </p> <note> <p>You
+         * cannot authorize ingress from an EC2 security group in one region to an Amazon
+         * RDS DB instance in another. You cannot authorize ingress from a VPC security
+         * group in one VPC to an Amazon RDS DB instance in another. </p> </note> <p>For an
+         * overview of CIDR ranges, go to the <a
+         * href="http://en.wikipedia.org/wiki/Classless_Inter-Domain_Routing">Wikipedia
+         * Tutorial</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way AuthorizeDBSecurityGroupIngressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AuthorizeDBSecurityGroupIngressRequest>
+        Aws::Utils::Threading::Awaitable<Model::AuthorizeDBSecurityGroupIngressOutcome> AuthorizeDBSecurityGroupIngressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AuthorizeDBSecurityGroupIngressOutcome>([this, request](const std::function<void(Model::AuthorizeDBSecurityGroupIngressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AuthorizeDBSecurityGroupIngressAsync(request, [complete](const RDSClient*, const Model::AuthorizeDBSecurityGroupIngressRequest&, const Model::AuthorizeDBSecurityGroupIngressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AuthorizeDBSecurityGroupIngressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a snapshot of a DB cluster. For more information on Amazon Aurora,
          * see <a
@@ -684,6 +788,30 @@ namespace Model
          */
         virtual void CopyDBClusterSnapshotAsync(const Model::CopyDBClusterSnapshotRequest& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a snapshot of a DB cluster. For more information on Amazon Aurora,
+         * see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way CopyDBClusterSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CopyDBClusterSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CopyDBClusterSnapshotOutcome> CopyDBClusterSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CopyDBClusterSnapshotOutcome>([this, request](const std::function<void(Model::CopyDBClusterSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CopyDBClusterSnapshotAsync(request, [complete](const RDSClient*, const Model::CopyDBClusterSnapshotRequest&, const Model::CopyDBClusterSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CopyDBClusterSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Copies the specified DB parameter group. </p>
          */
@@ -703,6 +831,27 @@ namespace Model
          */
         virtual void CopyDBParameterGroupAsync(const Model::CopyDBParameterGroupRequest& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Copies the specified DB parameter group. </p>
+         *
+         * Returns an awaitable that starts the operation the way CopyDBParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CopyDBParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CopyDBParameterGroupOutcome> CopyDBParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CopyDBParameterGroupOutcome>([this, request](const std::function<void(Model::CopyDBParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CopyDBParameterGroupAsync(request, [complete](const RDSClient*, const Model::CopyDBParameterGroupRequest&, const Model::CopyDBParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CopyDBParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Copies the specified DB snapshot. The source DB snapshot must be in the
          * "available" state. </p> <p>If you are copying from a shared manual DB snapshot,
@@ -731,6 +880,30 @@ namespace Model
          */
         virtual void CopyDBSnapshotAsync(const Model::CopyDBSnapshotRequest& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Copies the specified DB snapshot. The source DB snapshot must be in the
+         * "available" state. </p> <p>If you are copying from a shared manual DB snapshot,
+         * the <code>SourceDBSnapshotIdentifier</code> must be the ARN of the shared DB
+         * snapshot.</p>
+         *
+         * Returns an awaitable that starts the operation the way CopyDBSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CopyDBSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CopyDBSnapshotOutcome> CopyDBSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CopyDBSnapshotOutcome>([this, request](const std::function<void(Model::CopyDBSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CopyDBSnapshotAsync(request, [complete](const RDSClient*, const Model::CopyDBSnapshotRequest&, const Model::CopyDBSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CopyDBSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Copies the specified option group. </p>
          */
@@ -750,6 +923,27 @@ namespace Model
          */
         virtual void CopyOptionGroupAsync(const Model::CopyOptionGroupRequest& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Copies the specified option group. </p>
+         *
+         * Returns an awaitable that starts the operation the way CopyOptionGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CopyOptionGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CopyOptionGroupOutcome> CopyOptionGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CopyOptionGroupOutcome>([this, request](const std::function<void(Model::CopyOptionGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CopyOptionGroupAsync(request, [complete](const RDSClient*, const Model::CopyOptionGroupRequest&, const Model::CopyOptionGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CopyOptionGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new Amazon Aurora DB cluster. For more information on Amazon
          * Aurora, see <a
@@ -778,6 +972,30 @@ namespace Model
          */
         virtual void CreateDBClusterAsync(const Model::CreateDBClusterRequest& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new Amazon Aurora DB cluster. For more information on Amazon
+         * Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDBClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDBClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDBClusterOutcome> CreateDBClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDBClusterOutcome>([this, request](const std::function<void(Model::CreateDBClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDBClusterAsync(request, [complete](const RDSClient*, const Model::CreateDBClusterRequest&, const Model::CreateDBClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDBClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new DB cluster parameter group. </p> <p> Parameters in a DB
          * cluster parameter group apply to all of the instances in a DB cluster. </p> <p>
@@ -866,6 +1084,50 @@ namespace Model
          */
         virtual void CreateDBClusterParameterGroupAsync(const Model::CreateDBClusterParameterGroupRequest& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new DB cluster parameter group. </p> <p> Parameters in a DB
+         * cluster parameter group apply to all of the instances in a DB cluster. </p> <p>
+         * A DB cluster parameter group is initially created with the default parameters
+         * for the database engine used by instances in the DB cluster. To provide custom
+         * values for any of the parameters, you must modify the group after creating it
+         * using <a>ModifyDBClusterParameterGroup</a>. Once you've created a DB cluster
+         * parameter group, you need to associate it with your DB cluster using
+         * <a>ModifyDBCluster</a>. When you associate a new DB cluster parameter group with
+         * a running DB cluster, you need to reboot the DB instances in the DB cluster
+         * without failover for the new DB cluster parameter group and associated settings
+         * to take effect. </p> <important> <p>After you create a DB cluster parameter
+         * group, you should wait at least 5 minutes before creating your first DB cluster
+         * that uses that DB cluster parameter group as the default parameter group. This
+         * allows Amazon RDS to fully complete the create action before the DB cluster
+         * parameter group is used as the default for a new DB cluster. This is especially
+         * important for parameters that are critical when creating the default database
+         * for a DB cluster, such as the character set for the default database defined by
+         * the <code>character_set_database</code> parameter. You can use the <i>Parameter
+         * Groups</i> option of the <a href="https://console.aws.amazon.com/rds/">Amazon
+         * RDS console</a> or the <a>DescribeDBClusterParameters</a> command to verify that
+         * your DB cluster parameter group has been created or modified.</p> </important>
+         * <p>For more information on Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDBClusterParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDBClusterParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDBClusterParameterGroupOutcome> CreateDBClusterParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDBClusterParameterGroupOutcome>([this, request](const std::function<void(Model::CreateDBClusterParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDBClusterParameterGroupAsync(request, [complete](const RDSClient*, const Model::CreateDBClusterParameterGroupRequest&, const Model::CreateDBClusterParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDBClusterParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a snapshot of a DB cluster. For more information on Amazon Aurora,
          * see <a
@@ -894,6 +1156,30 @@ namespace Model
          */
         virtual void CreateDBClusterSnapshotAsync(const Model::CreateDBClusterSnapshotRequest& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a snapshot of a DB cluster. For more information on Amazon Aurora,
+         * see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDBClusterSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDBClusterSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDBClusterSnapshotOutcome> CreateDBClusterSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDBClusterSnapshotOutcome>([this, request](const std::function<void(Model::CreateDBClusterSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDBClusterSnapshotAsync(request, [complete](const RDSClient*, const Model::CreateDBClusterSnapshotRequest&, const Model::CreateDBClusterSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDBClusterSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new DB instance. </p>
          */
@@ -913,6 +1199,27 @@ namespace Model
          */
         virtual void CreateDBInstanceAsync(const Model::CreateDBInstanceRequest& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new DB instance. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDBInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDBInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDBInstanceOutcome> CreateDBInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDBInstanceOutcome>([this, request](const std::function<void(Model::CreateDBInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDBInstanceAsync(request, [complete](const RDSClient*, const Model::CreateDBInstanceRequest&, const Model::CreateDBInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDBInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a DB instance for a DB instance running MySQL, MariaDB, or
          * PostgreSQL that acts as a Read Replica of a source DB instance. </p> <p> All
@@ -950,6 +1257,33 @@ namespace Model
          */
         virtual void CreateDBInstanceReadReplicaAsync(const Model::CreateDBInstanceReadReplicaRequest& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a DB instance for a DB instance running MySQL, MariaDB, or
+         * PostgreSQL that acts as a Read Replica of a source DB instance. </p> <p> All
+         * Read Replica DB instances are created as Single-AZ deployments with backups
+         * disabled. All other DB instance attributes (including DB security groups and DB
+         * parameter groups) are inherited from the source DB instance, except as specified
+         * below. </p> <important> <p> The source DB instance must have backup retention
+         * enabled. </p> </important>
+         *
+         * Returns an awaitable that starts the operation the way CreateDBInstanceReadReplicaAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDBInstanceReadReplicaRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDBInstanceReadReplicaOutcome> CreateDBInstanceReadReplicaAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDBInstanceReadReplicaOutcome>([this, request](const std::function<void(Model::CreateDBInstanceReadReplicaOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDBInstanceReadReplicaAsync(request, [complete](const RDSClient*, const Model::CreateDBInstanceReadReplicaRequest&, const Model::CreateDBInstanceReadReplicaOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDBInstanceReadReplicaOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new DB parameter group. </p> <p> A DB parameter group is initially
          * created with the default parameters for the database engine used by the DB
@@ -1023,6 +1357,45 @@ namespace Model
          */
         virtual void CreateDBParameterGroupAsync(const Model::CreateDBParameterGroupRequest& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new DB parameter group. </p> <p> A DB parameter group is initially
+         * created with the default parameters for the database engine used by the DB
+         * instance. To provide custom values for any of the parameters, you must modify
+         * the group after creating it using <i>ModifyDBParameterGroup</i>. Once you've
+         * created a DB parameter group, you need to associate it with your DB instance
+         * using <i>ModifyDBInstance</i>. When you associate a new DB parameter group with
+         * a running DB instance, you need to reboot the DB instance without failover for
+         * the new DB parameter group and associated settings to take effect. </p>
+         * <important> <p>After you create a DB parameter group, you should wait at least 5
+         * minutes before creating your first DB instance that uses that DB parameter group
+         * as the default parameter group. This allows Amazon RDS to fully complete the
+         * create action before the parameter group is used as the default for a new DB
+         * instance. This is especially important for parameters that are critical when
+         * creating the default database for a DB instance, such as the character set for
+         * the default database defined by the <code>character_set_database</code>
+         * parameter. You can use the <i>Parameter Groups</i> option of the <a
+         * href="https://console.aws.amazon.com/rds/">Amazon RDS console</a> or the
+         * <i>DescribeDBParameters</i> command to verify that your DB parameter group has
+         * been created or modified.</p> </important>
+         *
+         * Returns an awaitable that starts the operation the way CreateDBParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDBParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDBParameterGroupOutcome> CreateDBParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDBParameterGroupOutcome>([this, request](const std::function<void(Model::CreateDBParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDBParameterGroupAsync(request, [complete](const RDSClient*, const Model::CreateDBParameterGroupRequest&, const Model::CreateDBParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDBParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new DB security group. DB security groups control access to a DB
          * instance. </p>
@@ -1045,6 +1418,28 @@ namespace Model
          */
         virtual void CreateDBSecurityGroupAsync(const Model::CreateDBSecurityGroupRequest& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new DB security group. DB security groups control access to a DB
+         * instance. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDBSecurityGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDBSecurityGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDBSecurityGroupOutcome> CreateDBSecurityGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDBSecurityGroupOutcome>([this, request](const std::function<void(Model::CreateDBSecurityGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDBSecurityGroupAsync(request, [complete](const RDSClient*, const Model::CreateDBSecurityGroupRequest&, const Model::CreateDBSecurityGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDBSecurityGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a DBSnapshot. The source DBInstance must be in "available" state.
          * </p>
@@ -1067,6 +1462,28 @@ namespace Model
          */
         virtual void CreateDBSnapshotAsync(const Model::CreateDBSnapshotRequest& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a DBSnapshot. The source DBInstance must be in "available" state.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDBSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDBSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDBSnapshotOutcome> CreateDBSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDBSnapshotOutcome>([this, request](const std::function<void(Model::CreateDBSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDBSnapshotAsync(request, [complete](const RDSClient*, const Model::CreateDBSnapshotRequest&, const Model::CreateDBSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDBSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new DB subnet group. DB subnet groups must contain at least one
          * subnet in at least two AZs in the region. </p>
@@ -1089,6 +1506,28 @@ namespace Model
          */
         virtual void CreateDBSubnetGroupAsync(const Model::CreateDBSubnetGroupRequest& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new DB subnet group. DB subnet groups must contain at least one
+         * subnet in at least two AZs in the region. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDBSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDBSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDBSubnetGroupOutcome> CreateDBSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDBSubnetGroupOutcome>([this, request](const std::function<void(Model::CreateDBSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDBSubnetGroupAsync(request, [complete](const RDSClient*, const Model::CreateDBSubnetGroupRequest&, const Model::CreateDBSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDBSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an RDS event notification subscription. This action requires a topic
          * ARN (Amazon Resource Name) created by either the RDS console, the SNS console,
@@ -1153,6 +1592,42 @@ namespace Model
          */
         virtual void CreateEventSubscriptionAsync(const Model::CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an RDS event notification subscription. This action requires a topic
+         * ARN (Amazon Resource Name) created by either the RDS console, the SNS console,
+         * or the SNS API. To obtain an ARN with SNS, you must create a topic in Amazon SNS
+         * and subscribe to the topic. The ARN is displayed in the SNS console.</p> <p>You
+         * can specify the type of source (SourceType) you want to be notified of, provide
+         * a list of RDS sources (SourceIds) that triggers the events, and provide a list
+         * of event categories (EventCategories) for events you want to be notified of. For
+         * example, you can specify SourceType = db-instance, SourceIds = mydbinstance1,
+         * mydbinstance2 and EventCategories = Availability, Backup.</p> <p>If you specify
+         * both the SourceType and SourceIds, such as SourceType = db-instance and
+         * SourceIdentifier = myDBInstance1, you will be notified of all the db-instance
+         * events for the specified source. If you specify a SourceType but do not specify
+         * a SourceIdentifier, you will receive notice of the events for that source type
+         * for all your RDS sources. If you do not specify either the SourceType nor the
+         * SourceIdentifier, you will be notified of events generated from all RDS sources
+         * belonging to your customer account.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateEventSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateEventSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateEventSubscriptionOutcome> CreateEventSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateEventSubscriptionOutcome>([this, request](const std::function<void(Model::CreateEventSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateEventSubscriptionAsync(request, [complete](const RDSClient*, const Model::CreateEventSubscriptionRequest&, const Model::CreateEventSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateEventSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new option group. You can create up to 20 option groups. </p>
          */
@@ -1172,6 +1647,27 @@ namespace Model
          */
         virtual void CreateOptionGroupAsync(const Model::CreateOptionGroupRequest& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new option group. You can create up to 20 option groups. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateOptionGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateOptionGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateOptionGroupOutcome> CreateOptionGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateOptionGroupOutcome>([this, request](const std::function<void(Model::CreateOptionGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateOptionGroupAsync(request, [complete](const RDSClient*, const Model::CreateOptionGroupRequest&, const Model::CreateOptionGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateOptionGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>The DeleteDBCluster action deletes a previously provisioned DB cluster. A
          * successful response from the web service indicates the request was received
@@ -1212,6 +1708,34 @@ namespace Model
          */
         virtual void DeleteDBClusterAsync(const Model::DeleteDBClusterRequest& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>The DeleteDBCluster action deletes a previously provisioned DB cluster. A
+         * successful response from the web service indicates the request was received
+         * correctly. When you delete a DB cluster, all automated backups for that DB
+         * cluster are deleted and cannot be recovered. Manual DB cluster snapshots of the
+         * DB cluster to be deleted are not deleted. </p> <p>For more information on Amazon
+         * Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDBClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDBClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDBClusterOutcome> DeleteDBClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDBClusterOutcome>([this, request](const std::function<void(Model::DeleteDBClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDBClusterAsync(request, [complete](const RDSClient*, const Model::DeleteDBClusterRequest&, const Model::DeleteDBClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDBClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a specified DB cluster parameter group. The DB cluster parameter
          * group to be deleted cannot be associated with any DB clusters. </p> <p>For more
@@ -1243,6 +1767,31 @@ namespace Model
          */
         virtual void DeleteDBClusterParameterGroupAsync(const Model::DeleteDBClusterParameterGroupRequest& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a specified DB cluster parameter group. The DB cluster parameter
+         * group to be deleted cannot be associated with any DB clusters. </p> <p>For more
+         * information on Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDBClusterParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDBClusterParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDBClusterParameterGroupOutcome> DeleteDBClusterParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDBClusterParameterGroupOutcome>([this, request](const std::function<void(Model::DeleteDBClusterParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDBClusterParameterGroupAsync(request, [complete](const RDSClient*, const Model::DeleteDBClusterParameterGroupRequest&, const Model::DeleteDBClusterParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDBClusterParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a DB cluster snapshot. If the snapshot is being copied, the copy
          * operation is terminated. </p> <note>The DB cluster snapshot must be in the
@@ -1277,6 +1826,32 @@ namespace Model
          */
         virtual void DeleteDBClusterSnapshotAsync(const Model::DeleteDBClusterSnapshotRequest& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a DB cluster snapshot. If the snapshot is being copied, the copy
+         * operation is terminated. </p> <note>The DB cluster snapshot must be in the
+         * <code>available</code> state to be deleted.</note> <p>For more information on
+         * Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDBClusterSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDBClusterSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDBClusterSnapshotOutcome> DeleteDBClusterSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDBClusterSnapshotOutcome>([this, request](const std::function<void(Model::DeleteDBClusterSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDBClusterSnapshotAsync(request, [complete](const RDSClient*, const Model::DeleteDBClusterSnapshotRequest&, const Model::DeleteDBClusterSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDBClusterSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> The DeleteDBInstance action deletes a previously provisioned DB instance. A
          * successful response from the web service indicates the request was received
@@ -1326,6 +1901,37 @@ namespace Model
          */
         virtual void DeleteDBInstanceAsync(const Model::DeleteDBInstanceRequest& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> The DeleteDBInstance action deletes a previously provisioned DB instance. A
+         * successful response from the web service indicates the request was received
+         * correctly. When you delete a DB instance, all automated backups for that
+         * instance are deleted and cannot be recovered. Manual DB snapshots of the DB
+         * instance to be deleted are not deleted. </p> <p> If a final DB snapshot is
+         * requested the status of the RDS instance will be "deleting" until the DB
+         * snapshot is created. The API action <code>DescribeDBInstance</code> is used to
+         * monitor the status of this operation. The action cannot be canceled or reverted
+         * once submitted. </p> <p>Note that when a DB instance is in a failure state and
+         * has a status of 'failed', 'incompatible-restore', or 'incompatible-network', it
+         * can only be deleted when the SkipFinalSnapshot parameter is set to "true".</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDBInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDBInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDBInstanceOutcome> DeleteDBInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDBInstanceOutcome>([this, request](const std::function<void(Model::DeleteDBInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDBInstanceAsync(request, [complete](const RDSClient*, const Model::DeleteDBInstanceRequest&, const Model::DeleteDBInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDBInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a specified DBParameterGroup. The DBParameterGroup to be deleted
          * cannot be associated with any DB instances. </p>
@@ -1348,6 +1954,28 @@ namespace Model
          */
         virtual void DeleteDBParameterGroupAsync(const Model::DeleteDBParameterGroupRequest& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a specified DBParameterGroup. The DBParameterGroup to be deleted
+         * cannot be associated with any DB instances. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDBParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDBParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDBParameterGroupOutcome> DeleteDBParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDBParameterGroupOutcome>([this, request](const std::function<void(Model::DeleteDBParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDBParameterGroupAsync(request, [complete](const RDSClient*, const Model::DeleteDBParameterGroupRequest&, const Model::DeleteDBParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDBParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a DB security group. </p> <note>The specified DB security group must
          * not be associated with any DB instances.</note>
@@ -1370,6 +1998,28 @@ namespace Model
          */
         virtual void DeleteDBSecurityGroupAsync(const Model::DeleteDBSecurityGroupRequest& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a DB security group. </p> <note>The specified DB security group must
+         * not be associated with any DB instances.</note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDBSecurityGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDBSecurityGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDBSecurityGroupOutcome> DeleteDBSecurityGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDBSecurityGroupOutcome>([this, request](const std::function<void(Model::DeleteDBSecurityGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDBSecurityGroupAsync(request, [complete](const RDSClient*, const Model::DeleteDBSecurityGroupRequest&, const Model::DeleteDBSecurityGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDBSecurityGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a DBSnapshot. If the snapshot is being copied, the copy operation is
          * terminated. </p> <note>The DBSnapshot must be in the <code>available</code>
@@ -1395,6 +2045,29 @@ namespace Model
          */
         virtual void DeleteDBSnapshotAsync(const Model::DeleteDBSnapshotRequest& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a DBSnapshot. If the snapshot is being copied, the copy operation is
+         * terminated. </p> <note>The DBSnapshot must be in the <code>available</code>
+         * state to be deleted.</note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDBSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDBSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDBSnapshotOutcome> DeleteDBSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDBSnapshotOutcome>([this, request](const std::function<void(Model::DeleteDBSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDBSnapshotAsync(request, [complete](const RDSClient*, const Model::DeleteDBSnapshotRequest&, const Model::DeleteDBSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDBSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a DB subnet group. </p> <note>The specified database subnet group
          * must not be associated with any DB instances.</note>
@@ -1417,6 +2090,28 @@ namespace Model
          */
         virtual void DeleteDBSubnetGroupAsync(const Model::DeleteDBSubnetGroupRequest& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a DB subnet group. </p> <note>The specified database subnet group
+         * must not be associated with any DB instances.</note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDBSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDBSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDBSubnetGroupOutcome> DeleteDBSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDBSubnetGroupOutcome>([this, request](const std::function<void(Model::DeleteDBSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDBSubnetGroupAsync(request, [complete](const RDSClient*, const Model::DeleteDBSubnetGroupRequest&, const Model::DeleteDBSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDBSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes an RDS event notification subscription.</p>
          */
@@ -1436,6 +2131,27 @@ namespace Model
          */
         virtual void DeleteEventSubscriptionAsync(const Model::DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes an RDS event notification subscription.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteEventSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteEventSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteEventSubscriptionOutcome> DeleteEventSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteEventSubscriptionOutcome>([this, request](const std::function<void(Model::DeleteEventSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteEventSubscriptionAsync(request, [complete](const RDSClient*, const Model::DeleteEventSubscriptionRequest&, const Model::DeleteEventSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteEventSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes an existing option group. </p>
          */
@@ -1455,6 +2171,27 @@ namespace Model
          */
         virtual void DeleteOptionGroupAsync(const Model::DeleteOptionGroupRequest& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes an existing option group. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteOptionGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteOptionGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteOptionGroupOutcome> DeleteOptionGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteOptionGroupOutcome>([this, request](const std::function<void(Model::DeleteOptionGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteOptionGroupAsync(request, [complete](const RDSClient*, const Model::DeleteOptionGroupRequest&, const Model::DeleteOptionGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteOptionGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all of the attributes for a customer account. The attributes include
          * Amazon RDS quotas for the account, such as the number of DB instances allowed.
@@ -1486,6 +2223,31 @@ namespace Model
          */
         virtual void DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all of the attributes for a customer account. The attributes include
+         * Amazon RDS quotas for the account, such as the number of DB instances allowed.
+         * The description for a quota includes the quota name, current usage toward that
+         * quota, and the quota's maximum value. </p> <p>This command does not take any
+         * parameters.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAccountAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAccountAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAccountAttributesOutcome> DescribeAccountAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAccountAttributesOutcome>([this, request](const std::function<void(Model::DescribeAccountAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAccountAttributesAsync(request, [complete](const RDSClient*, const Model::DescribeAccountAttributesRequest&, const Model::DescribeAccountAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAccountAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Lists the set of CA certificates provided by Amazon RDS for this AWS
          * account. </p>
@@ -1508,6 +2270,28 @@ namespace Model
          */
         virtual void DescribeCertificatesAsync(const Model::DescribeCertificatesRequest& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Lists the set of CA certificates provided by Amazon RDS for this AWS
+         * account. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCertificatesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCertificatesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCertificatesOutcome> DescribeCertificatesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCertificatesOutcome>([this, request](const std::function<void(Model::DescribeCertificatesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCertificatesAsync(request, [complete](const RDSClient*, const Model::DescribeCertificatesRequest&, const Model::DescribeCertificatesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCertificatesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of <code>DBClusterParameterGroup</code> descriptions. If a
          * <code>DBClusterParameterGroupName</code> parameter is specified, the list will
@@ -1542,6 +2326,32 @@ namespace Model
          */
         virtual void DescribeDBClusterParameterGroupsAsync(const Model::DescribeDBClusterParameterGroupsRequest& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of <code>DBClusterParameterGroup</code> descriptions. If a
+         * <code>DBClusterParameterGroupName</code> parameter is specified, the list will
+         * contain only the description of the specified DB cluster parameter group. </p>
+         * <p>For more information on Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBClusterParameterGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBClusterParameterGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBClusterParameterGroupsOutcome> DescribeDBClusterParameterGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBClusterParameterGroupsOutcome>([this, request](const std::function<void(Model::DescribeDBClusterParameterGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBClusterParameterGroupsAsync(request, [complete](const RDSClient*, const Model::DescribeDBClusterParameterGroupsRequest&, const Model::DescribeDBClusterParameterGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBClusterParameterGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns the detailed parameter list for a particular DB cluster parameter
          * group. </p> <p>For more information on Amazon Aurora, see <a
@@ -1570,6 +2380,30 @@ namespace Model
          */
         virtual void DescribeDBClusterParametersAsync(const Model::DescribeDBClusterParametersRequest& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns the detailed parameter list for a particular DB cluster parameter
+         * group. </p> <p>For more information on Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBClusterParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBClusterParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBClusterParametersOutcome> DescribeDBClusterParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBClusterParametersOutcome>([this, request](const std::function<void(Model::DescribeDBClusterParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBClusterParametersAsync(request, [complete](const RDSClient*, const Model::DescribeDBClusterParametersRequest&, const Model::DescribeDBClusterParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBClusterParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about DB cluster snapshots. This API supports pagination.
          * </p> <p>For more information on Amazon Aurora, see <a
@@ -1598,6 +2432,30 @@ namespace Model
          */
         virtual void DescribeDBClusterSnapshotsAsync(const Model::DescribeDBClusterSnapshotsRequest& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about DB cluster snapshots. This API supports pagination.
+         * </p> <p>For more information on Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBClusterSnapshotsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBClusterSnapshotsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBClusterSnapshotsOutcome> DescribeDBClusterSnapshotsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBClusterSnapshotsOutcome>([this, request](const std::function<void(Model::DescribeDBClusterSnapshotsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBClusterSnapshotsAsync(request, [complete](const RDSClient*, const Model::DescribeDBClusterSnapshotsRequest&, const Model::DescribeDBClusterSnapshotsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBClusterSnapshotsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about provisioned Aurora DB clusters. This API supports
          * pagination. </p> <p>For more information on Amazon Aurora, see <a
@@ -1626,6 +2484,30 @@ namespace Model
          */
         virtual void DescribeDBClustersAsync(const Model::DescribeDBClustersRequest& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about provisioned Aurora DB clusters. This API supports
+         * pagination. </p> <p>For more information on Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBClustersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBClustersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBClustersOutcome> DescribeDBClustersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBClustersOutcome>([this, request](const std::function<void(Model::DescribeDBClustersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBClustersAsync(request, [complete](const RDSClient*, const Model::DescribeDBClustersRequest&, const Model::DescribeDBClustersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBClustersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of the available DB engines. </p>
          */
@@ -1645,6 +2527,27 @@ namespace Model
          */
         virtual void DescribeDBEngineVersionsAsync(const Model::DescribeDBEngineVersionsRequest& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of the available DB engines. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBEngineVersionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBEngineVersionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBEngineVersionsOutcome> DescribeDBEngineVersionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBEngineVersionsOutcome>([this, request](const std::function<void(Model::DescribeDBEngineVersionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBEngineVersionsAsync(request, [complete](const RDSClient*, const Model::DescribeDBEngineVersionsRequest&, const Model::DescribeDBEngineVersionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBEngineVersionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns information about provisioned RDS instances. This API supports
          * pagination. </p>
@@ -1667,6 +2570,28 @@ namespace Model
          */
         virtual void DescribeDBInstancesAsync(const Model::DescribeDBInstancesRequest& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns information about provisioned RDS instances. This API supports
+         * pagination. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBInstancesOutcome> DescribeDBInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBInstancesOutcome>([this, request](const std::function<void(Model::DescribeDBInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBInstancesAsync(request, [complete](const RDSClient*, const Model::DescribeDBInstancesRequest&, const Model::DescribeDBInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of DB log files for the DB instance. </p>
          */
@@ -1686,6 +2611,27 @@ namespace Model
          */
         virtual void DescribeDBLogFilesAsync(const Model::DescribeDBLogFilesRequest& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of DB log files for the DB instance. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBLogFilesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBLogFilesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBLogFilesOutcome> DescribeDBLogFilesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBLogFilesOutcome>([this, request](const std::function<void(Model::DescribeDBLogFilesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBLogFilesAsync(request, [complete](const RDSClient*, const Model::DescribeDBLogFilesRequest&, const Model::DescribeDBLogFilesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBLogFilesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of <code>DBParameterGroup</code> descriptions. If a
          * <code>DBParameterGroupName</code> is specified, the list will contain only the
@@ -1711,6 +2657,29 @@ namespace Model
          */
         virtual void DescribeDBParameterGroupsAsync(const Model::DescribeDBParameterGroupsRequest& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of <code>DBParameterGroup</code> descriptions. If a
+         * <code>DBParameterGroupName</code> is specified, the list will contain only the
+         * description of the specified DB parameter group. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBParameterGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBParameterGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBParameterGroupsOutcome> DescribeDBParameterGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBParameterGroupsOutcome>([this, request](const std::function<void(Model::DescribeDBParameterGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBParameterGroupsAsync(request, [complete](const RDSClient*, const Model::DescribeDBParameterGroupsRequest&, const Model::DescribeDBParameterGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBParameterGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns the detailed parameter list for a particular DB parameter group.
          * </p>
@@ -1733,6 +2702,28 @@ namespace Model
          */
         virtual void DescribeDBParametersAsync(const Model::DescribeDBParametersRequest& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns the detailed parameter list for a particular DB parameter group.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBParametersOutcome> DescribeDBParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBParametersOutcome>([this, request](const std::function<void(Model::DescribeDBParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBParametersAsync(request, [complete](const RDSClient*, const Model::DescribeDBParametersRequest&, const Model::DescribeDBParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of <code>DBSecurityGroup</code> descriptions. If a
          * <code>DBSecurityGroupName</code> is specified, the list will contain only the
@@ -1758,6 +2749,29 @@ namespace Model
          */
         virtual void DescribeDBSecurityGroupsAsync(const Model::DescribeDBSecurityGroupsRequest& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of <code>DBSecurityGroup</code> descriptions. If a
+         * <code>DBSecurityGroupName</code> is specified, the list will contain only the
+         * descriptions of the specified DB security group. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBSecurityGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBSecurityGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBSecurityGroupsOutcome> DescribeDBSecurityGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBSecurityGroupsOutcome>([this, request](const std::function<void(Model::DescribeDBSecurityGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBSecurityGroupsAsync(request, [complete](const RDSClient*, const Model::DescribeDBSecurityGroupsRequest&, const Model::DescribeDBSecurityGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBSecurityGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of DB snapshot attribute names and values for a manual DB
          * snapshot.</p> <p>When sharing snapshots with other AWS accounts,
@@ -1804,6 +2818,36 @@ namespace Model
          */
         virtual void DescribeDBSnapshotAttributesAsync(const Model::DescribeDBSnapshotAttributesRequest& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of DB snapshot attribute names and values for a manual DB
+         * snapshot.</p> <p>When sharing snapshots with other AWS accounts,
+         * <code>DescribeDBSnapshotAttributes</code> returns the <code>restore</code>
+         * attribute and a list of the AWS account ids that are authorized to copy or
+         * restore the manual DB snapshot. If <code>all</code> is included in the list of
+         * values for the <code>restore</code> attribute, then the manual DB snapshot is
+         * public and can be copied or restored by all AWS accounts.</p> <p>To add or
+         * remove access for an AWS account to copy or restore a manual DB snapshot, or to
+         * make the manual DB snapshot public or private, use the
+         * <a>ModifyDBSnapshotAttribute</a> API.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBSnapshotAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBSnapshotAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBSnapshotAttributesOutcome> DescribeDBSnapshotAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBSnapshotAttributesOutcome>([this, request](const std::function<void(Model::DescribeDBSnapshotAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBSnapshotAttributesAsync(request, [complete](const RDSClient*, const Model::DescribeDBSnapshotAttributesRequest&, const Model::DescribeDBSnapshotAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBSnapshotAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns information about DB snapshots. This API supports pagination. </p>
          */
@@ -1823,6 +2867,27 @@ namespace Model
          */
         virtual void DescribeDBSnapshotsAsync(const Model::DescribeDBSnapshotsRequest& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns information about DB snapshots. This API supports pagination. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBSnapshotsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBSnapshotsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBSnapshotsOutcome> DescribeDBSnapshotsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBSnapshotsOutcome>([this, request](const std::function<void(Model::DescribeDBSnapshotsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBSnapshotsAsync(request, [complete](const RDSClient*, const Model::DescribeDBSnapshotsRequest&, const Model::DescribeDBSnapshotsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBSnapshotsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of DBSubnetGroup descriptions. If a DBSubnetGroupName is
          * specified, the list will contain only the descriptions of the specified
@@ -1854,6 +2919,31 @@ namespace Model
          */
         virtual void DescribeDBSubnetGroupsAsync(const Model::DescribeDBSubnetGroupsRequest& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of DBSubnetGroup descriptions. If a DBSubnetGroupName is
+         * specified, the list will contain only the descriptions of the specified
+         * DBSubnetGroup. </p> <p>For an overview of CIDR ranges, go to the <a
+         * href="http://en.wikipedia.org/wiki/Classless_Inter-Domain_Routing">Wikipedia
+         * Tutorial</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDBSubnetGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDBSubnetGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDBSubnetGroupsOutcome> DescribeDBSubnetGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDBSubnetGroupsOutcome>([this, request](const std::function<void(Model::DescribeDBSubnetGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDBSubnetGroupsAsync(request, [complete](const RDSClient*, const Model::DescribeDBSubnetGroupsRequest&, const Model::DescribeDBSubnetGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDBSubnetGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns the default engine and system parameter information for the cluster
          * database engine. </p> <p>For more information on Amazon Aurora, see <a
@@ -1882,6 +2972,30 @@ namespace Model
          */
         virtual void DescribeEngineDefaultClusterParametersAsync(const Model::DescribeEngineDefaultClusterParametersRequest& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns the default engine and system parameter information for the cluster
+         * database engine. </p> <p>For more information on Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEngineDefaultClusterParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEngineDefaultClusterParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEngineDefaultClusterParametersOutcome> DescribeEngineDefaultClusterParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEngineDefaultClusterParametersOutcome>([this, request](const std::function<void(Model::DescribeEngineDefaultClusterParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEngineDefaultClusterParametersAsync(request, [complete](const RDSClient*, const Model::DescribeEngineDefaultClusterParametersRequest&, const Model::DescribeEngineDefaultClusterParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEngineDefaultClusterParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns the default engine and system parameter information for the
          * specified database engine. </p>
@@ -1904,6 +3018,28 @@ namespace Model
          */
         virtual void DescribeEngineDefaultParametersAsync(const Model::DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns the default engine and system parameter information for the
+         * specified database engine. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEngineDefaultParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEngineDefaultParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEngineDefaultParametersOutcome> DescribeEngineDefaultParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEngineDefaultParametersOutcome>([this, request](const std::function<void(Model::DescribeEngineDefaultParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEngineDefaultParametersAsync(request, [complete](const RDSClient*, const Model::DescribeEngineDefaultParametersRequest&, const Model::DescribeEngineDefaultParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEngineDefaultParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Displays a list of categories for all event source types, or, if specified,
          * for a specified source type. You can see a list of the event categories and
@@ -1935,6 +3071,31 @@ namespace Model
          */
         virtual void DescribeEventCategoriesAsync(const Model::DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Displays a list of categories for all event source types, or, if specified,
+         * for a specified source type. You can see a list of the event categories and
+         * source types in the <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/USER_Events.html">
+         * Events</a> topic in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEventCategoriesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEventCategoriesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEventCategoriesOutcome> DescribeEventCategoriesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEventCategoriesOutcome>([this, request](const std::function<void(Model::DescribeEventCategoriesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEventCategoriesAsync(request, [complete](const RDSClient*, const Model::DescribeEventCategoriesRequest&, const Model::DescribeEventCategoriesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEventCategoriesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all the subscription descriptions for a customer account. The
          * description for a subscription includes SubscriptionName, SNSTopicARN,
@@ -1963,6 +3124,30 @@ namespace Model
          */
         virtual void DescribeEventSubscriptionsAsync(const Model::DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all the subscription descriptions for a customer account. The
+         * description for a subscription includes SubscriptionName, SNSTopicARN,
+         * CustomerID, SourceType, SourceID, CreationTime, and Status. </p> <p>If you
+         * specify a SubscriptionName, lists the description for that subscription.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEventSubscriptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEventSubscriptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEventSubscriptionsOutcome> DescribeEventSubscriptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEventSubscriptionsOutcome>([this, request](const std::function<void(Model::DescribeEventSubscriptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEventSubscriptionsAsync(request, [complete](const RDSClient*, const Model::DescribeEventSubscriptionsRequest&, const Model::DescribeEventSubscriptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEventSubscriptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns events related to DB instances, DB security groups, DB snapshots,
          * and DB parameter groups for the past 14 days. Events specific to a particular DB
@@ -1994,6 +3179,31 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns events related to DB instances, DB security groups, DB snapshots,
+         * and DB parameter groups for the past 14 days. Events specific to a particular DB
+         * instance, DB security group, database snapshot, or DB parameter group can be
+         * obtained by providing the name as a parameter. By default, the past hour of
+         * events are returned. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEventsOutcome>([this, request](const std::function<void(Model::DescribeEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEventsAsync(request, [complete](const RDSClient*, const Model::DescribeEventsRequest&, const Model::DescribeEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Describes all available options. </p>
          */
@@ -2013,6 +3223,27 @@ namespace Model
          */
         virtual void DescribeOptionGroupOptionsAsync(const Model::DescribeOptionGroupOptionsRequest& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Describes all available options. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeOptionGroupOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeOptionGroupOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeOptionGroupOptionsOutcome> DescribeOptionGroupOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeOptionGroupOptionsOutcome>([this, request](const std::function<void(Model::DescribeOptionGroupOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeOptionGroupOptionsAsync(request, [complete](const RDSClient*, const Model::DescribeOptionGroupOptionsRequest&, const Model::DescribeOptionGroupOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeOptionGroupOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Describes the available option groups. </p>
          */
@@ -2032,6 +3263,27 @@ namespace Model
          */
         virtual void DescribeOptionGroupsAsync(const Model::DescribeOptionGroupsRequest& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Describes the available option groups. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeOptionGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeOptionGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeOptionGroupsOutcome> DescribeOptionGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeOptionGroupsOutcome>([this, request](const std::function<void(Model::DescribeOptionGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeOptionGroupsAsync(request, [complete](const RDSClient*, const Model::DescribeOptionGroupsRequest&, const Model::DescribeOptionGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeOptionGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of orderable DB instance options for the specified engine.
          * </p>
@@ -2054,6 +3306,28 @@ namespace Model
          */
         virtual void DescribeOrderableDBInstanceOptionsAsync(const Model::DescribeOrderableDBInstanceOptionsRequest& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of orderable DB instance options for the specified engine.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeOrderableDBInstanceOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeOrderableDBInstanceOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeOrderableDBInstanceOptionsOutcome> DescribeOrderableDBInstanceOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeOrderableDBInstanceOptionsOutcome>([this, request](const std::function<void(Model::DescribeOrderableDBInstanceOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeOrderableDBInstanceOptionsAsync(request, [complete](const RDSClient*, const Model::DescribeOrderableDBInstanceOptionsRequest&, const Model::DescribeOrderableDBInstanceOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeOrderableDBInstanceOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of resources (for example, DB instances) that have at least
          * one pending maintenance action.</p>
@@ -2076,6 +3350,28 @@ namespace Model
          */
         virtual void DescribePendingMaintenanceActionsAsync(const Model::DescribePendingMaintenanceActionsRequest& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of resources (for example, DB instances) that have at least
+         * one pending maintenance action.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribePendingMaintenanceActionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribePendingMaintenanceActionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribePendingMaintenanceActionsOutcome> DescribePendingMaintenanceActionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribePendingMaintenanceActionsOutcome>([this, request](const std::function<void(Model::DescribePendingMaintenanceActionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribePendingMaintenanceActionsAsync(request, [complete](const RDSClient*, const Model::DescribePendingMaintenanceActionsRequest&, const Model::DescribePendingMaintenanceActionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribePendingMaintenanceActionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns information about reserved DB instances for this account, or about a
          * specified reserved DB instance. </p>
@@ -2098,6 +3394,28 @@ namespace Model
          */
         virtual void DescribeReservedDBInstancesAsync(const Model::DescribeReservedDBInstancesRequest& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns information about reserved DB instances for this account, or about a
+         * specified reserved DB instance. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReservedDBInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReservedDBInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReservedDBInstancesOutcome> DescribeReservedDBInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReservedDBInstancesOutcome>([this, request](const std::function<void(Model::DescribeReservedDBInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReservedDBInstancesAsync(request, [complete](const RDSClient*, const Model::DescribeReservedDBInstancesRequest&, const Model::DescribeReservedDBInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReservedDBInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Lists available reserved DB instance offerings. </p>
          */
@@ -2117,6 +3435,27 @@ namespace Model
          */
         virtual void DescribeReservedDBInstancesOfferingsAsync(const Model::DescribeReservedDBInstancesOfferingsRequest& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Lists available reserved DB instance offerings. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReservedDBInstancesOfferingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReservedDBInstancesOfferingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReservedDBInstancesOfferingsOutcome> DescribeReservedDBInstancesOfferingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReservedDBInstancesOfferingsOutcome>([this, request](const std::function<void(Model::DescribeReservedDBInstancesOfferingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReservedDBInstancesOfferingsAsync(request, [complete](const RDSClient*, const Model::DescribeReservedDBInstancesOfferingsRequest&, const Model::DescribeReservedDBInstancesOfferingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReservedDBInstancesOfferingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Downloads all or a portion of the specified log file, up to 1 MB in size.
          * </p>
@@ -2139,6 +3478,28 @@ namespace Model
          */
         virtual void DownloadDBLogFilePortionAsync(const Model::DownloadDBLogFilePortionRequest& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Downloads all or a portion of the specified log file, up to 1 MB in size.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way DownloadDBLogFilePortionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DownloadDBLogFilePortionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DownloadDBLogFilePortionOutcome> DownloadDBLogFilePortionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DownloadDBLogFilePortionOutcome>([this, request](const std::function<void(Model::DownloadDBLogFilePortionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DownloadDBLogFilePortionAsync(request, [complete](const RDSClient*, const Model::DownloadDBLogFilePortionRequest&, const Model::DownloadDBLogFilePortionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DownloadDBLogFilePortionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Forces a failover for a DB cluster.</p> <p>A failover for a DB cluster
          * promotes one of the read-only instances in the DB cluster to the master DB
@@ -2188,6 +3549,37 @@ namespace Model
          */
         virtual void FailoverDBClusterAsync(const Model::FailoverDBClusterRequest& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Forces a failover for a DB cluster.</p> <p>A failover for a DB cluster
+         * promotes one of the read-only instances in the DB cluster to the master DB
+         * instance (the cluster writer) and deletes the current primary instance.</p>
+         * <p>Amazon Aurora will automatically fail over to a read-only instance, if one
+         * exists, when the primary instance fails. You can force a failover when you want
+         * to simulate a failure of a DB instance for testing. Because each instance in a
+         * DB cluster has its own endpoint address, you will need to clean up and
+         * re-establish any existing connections that use those endpoint addresses when the
+         * failover is complete.</p> <p>For more information on Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way FailoverDBClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::FailoverDBClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::FailoverDBClusterOutcome> FailoverDBClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::FailoverDBClusterOutcome>([this, request](const std::function<void(Model::FailoverDBClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->FailoverDBClusterAsync(request, [complete](const RDSClient*, const Model::FailoverDBClusterRequest&, const Model::FailoverDBClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::FailoverDBClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists all tags on an Amazon RDS resource.</p> <p>For an overview on tagging
          * an Amazon RDS resource, see <a
@@ -2216,6 +3608,30 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists all tags on an Amazon RDS resource.</p> <p>For an overview on tagging
+         * an Amazon RDS resource, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/Overview.Tagging.html">Tagging
+         * Amazon RDS Resources</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTagsForResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsForResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome>([this, request](const std::function<void(Model::ListTagsForResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsForResourceAsync(request, [complete](const RDSClient*, const Model::ListTagsForResourceRequest&, const Model::ListTagsForResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsForResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modify a setting for an Amazon Aurora DB cluster. You can change one or more
          * database configuration parameters by specifying these parameters and the new
@@ -2247,6 +3663,31 @@ namespace Model
          */
         virtual void ModifyDBClusterAsync(const Model::ModifyDBClusterRequest& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modify a setting for an Amazon Aurora DB cluster. You can change one or more
+         * database configuration parameters by specifying these parameters and the new
+         * values in the request. For more information on Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyDBClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyDBClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyDBClusterOutcome> ModifyDBClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyDBClusterOutcome>([this, request](const std::function<void(Model::ModifyDBClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyDBClusterAsync(request, [complete](const RDSClient*, const Model::ModifyDBClusterRequest&, const Model::ModifyDBClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyDBClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies the parameters of a DB cluster parameter group. To modify more than
          * one parameter, submit a list of the following: <code>ParameterName</code>,
@@ -2326,6 +3767,47 @@ namespace Model
          */
         virtual void ModifyDBClusterParameterGroupAsync(const Model::ModifyDBClusterParameterGroupRequest& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies the parameters of a DB cluster parameter group. To modify more than
+         * one parameter, submit a list of the following: <code>ParameterName</code>,
+         * <code>ParameterValue</code>, and <code>ApplyMethod</code>. A maximum of 20
+         * parameters can be modified in a single request. </p> <p>For more information on
+         * Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p> <note> <p> Changes to
+         * dynamic parameters are applied immediately. Changes to static parameters require
+         * a reboot without failover to the DB cluster associated with the parameter group
+         * before the change can take effect. </p> </note> <important> <p>After you create
+         * a DB cluster parameter group, you should wait at least 5 minutes before creating
+         * your first DB cluster that uses that DB cluster parameter group as the default
+         * parameter group. This allows Amazon RDS to fully complete the create action
+         * before the parameter group is used as the default for a new DB cluster. This is
+         * especially important for parameters that are critical when creating the default
+         * database for a DB cluster, such as the character set for the default database
+         * defined by the <code>character_set_database</code> parameter. You can use the
+         * <i>Parameter Groups</i> option of the <a
+         * href="https://console.aws.amazon.com/rds/">Amazon RDS console</a> or the
+         * <a>DescribeDBClusterParameters</a> command to verify that your DB cluster
+         * parameter group has been created or modified.</p> </important>
+         *
+         * Returns an awaitable that starts the operation the way ModifyDBClusterParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyDBClusterParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyDBClusterParameterGroupOutcome> ModifyDBClusterParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyDBClusterParameterGroupOutcome>([this, request](const std::function<void(Model::ModifyDBClusterParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyDBClusterParameterGroupAsync(request, [complete](const RDSClient*, const Model::ModifyDBClusterParameterGroupRequest&, const Model::ModifyDBClusterParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyDBClusterParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modify settings for a DB instance. You can change one or more database
          * configuration parameters by specifying these parameters and the new values in
@@ -2351,6 +3833,29 @@ namespace Model
          */
         virtual void ModifyDBInstanceAsync(const Model::ModifyDBInstanceRequest& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modify settings for a DB instance. You can change one or more database
+         * configuration parameters by specifying these parameters and the new values in
+         * the request. </p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyDBInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyDBInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyDBInstanceOutcome> ModifyDBInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyDBInstanceOutcome>([this, request](const std::function<void(Model::ModifyDBInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyDBInstanceAsync(request, [complete](const RDSClient*, const Model::ModifyDBInstanceRequest&, const Model::ModifyDBInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyDBInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies the parameters of a DB parameter group. To modify more than one
          * parameter, submit a list of the following: <code>ParameterName</code>,
@@ -2418,6 +3923,43 @@ namespace Model
          */
         virtual void ModifyDBParameterGroupAsync(const Model::ModifyDBParameterGroupRequest& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies the parameters of a DB parameter group. To modify more than one
+         * parameter, submit a list of the following: <code>ParameterName</code>,
+         * <code>ParameterValue</code>, and <code>ApplyMethod</code>. A maximum of 20
+         * parameters can be modified in a single request. </p> <note> <p> Changes to
+         * dynamic parameters are applied immediately. Changes to static parameters require
+         * a reboot without failover to the DB instance associated with the parameter group
+         * before the change can take effect. </p> </note> <important> <p>After you modify
+         * a DB parameter group, you should wait at least 5 minutes before creating your
+         * first DB instance that uses that DB parameter group as the default parameter
+         * group. This allows Amazon RDS to fully complete the modify action before the
+         * parameter group is used as the default for a new DB instance. This is especially
+         * important for parameters that are critical when creating the default database
+         * for a DB instance, such as the character set for the default database defined by
+         * the <code>character_set_database</code> parameter. You can use the <i>Parameter
+         * Groups</i> option of the <a href="https://console.aws.amazon.com/rds/">Amazon
+         * RDS console</a> or the <i>DescribeDBParameters</i> command to verify that your
+         * DB parameter group has been created or modified.</p> </important>
+         *
+         * Returns an awaitable that starts the operation the way ModifyDBParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyDBParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyDBParameterGroupOutcome> ModifyDBParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyDBParameterGroupOutcome>([this, request](const std::function<void(Model::ModifyDBParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyDBParameterGroupAsync(request, [complete](const RDSClient*, const Model::ModifyDBParameterGroupRequest&, const Model::ModifyDBParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyDBParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds an attribute and values to, or removes an attribute and values from a
          * manual DB snapshot.</p> <p>To share a manual DB snapshot with other AWS
@@ -2470,6 +4012,38 @@ namespace Model
          */
         virtual void ModifyDBSnapshotAttributeAsync(const Model::ModifyDBSnapshotAttributeRequest& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds an attribute and values to, or removes an attribute and values from a
+         * manual DB snapshot.</p> <p>To share a manual DB snapshot with other AWS
+         * accounts, specify <code>restore</code> as the <code>AttributeName</code> and use
+         * the <code>ValuesToAdd</code> parameter to add a list of the AWS account ids that
+         * are authorized to restore the manual DB snapshot. Uses the value
+         * <code>all</code> to make the manual DB snapshot public and can by copied or
+         * restored by all AWS accounts. Do not add the <code>all</code> value for any
+         * manual DB snapshots that contain private information that you do not want to be
+         * available to all AWS accounts.</p> <p>To view which AWS accounts have access to
+         * copy or restore a manual DB snapshot, or whether a manual DB snapshot public or
+         * private, use the <a>DescribeDBSnapshotAttributes</a> API.</p> <p>If the manual
+         * DB snapshot is encrypted, it cannot be shared.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyDBSnapshotAttributeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyDBSnapshotAttributeRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyDBSnapshotAttributeOutcome> ModifyDBSnapshotAttributeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyDBSnapshotAttributeOutcome>([this, request](const std::function<void(Model::ModifyDBSnapshotAttributeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyDBSnapshotAttributeAsync(request, [complete](const RDSClient*, const Model::ModifyDBSnapshotAttributeRequest&, const Model::ModifyDBSnapshotAttributeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyDBSnapshotAttributeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies an existing DB subnet group. DB subnet groups must contain at least
          * one subnet in at least two AZs in the region. </p>
@@ -2492,6 +4066,28 @@ namespace Model
          */
         virtual void ModifyDBSubnetGroupAsync(const Model::ModifyDBSubnetGroupRequest& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies an existing DB subnet group. DB subnet groups must contain at least
+         * one subnet in at least two AZs in the region. </p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyDBSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyDBSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyDBSubnetGroupOutcome> ModifyDBSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyDBSubnetGroupOutcome>([this, request](const std::function<void(Model::ModifyDBSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyDBSubnetGroupAsync(request, [complete](const RDSClient*, const Model::ModifyDBSubnetGroupRequest&, const Model::ModifyDBSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyDBSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Modifies an existing RDS event notification subscription. Note that you
          * cannot modify the source identifiers using this call; to change source
@@ -2532,6 +4128,34 @@ namespace Model
          */
         virtual void ModifyEventSubscriptionAsync(const Model::ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Modifies an existing RDS event notification subscription. Note that you
+         * cannot modify the source identifiers using this call; to change source
+         * identifiers for a subscription, use the <a>AddSourceIdentifierToSubscription</a>
+         * and <a>RemoveSourceIdentifierFromSubscription</a> calls.</p> <p>You can see a
+         * list of the event categories for a given SourceType in the <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/USER_Events.html">Events</a>
+         * topic in the Amazon RDS User Guide or by using the
+         * <b>DescribeEventCategories</b> action.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyEventSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyEventSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyEventSubscriptionOutcome> ModifyEventSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyEventSubscriptionOutcome>([this, request](const std::function<void(Model::ModifyEventSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyEventSubscriptionAsync(request, [complete](const RDSClient*, const Model::ModifyEventSubscriptionRequest&, const Model::ModifyEventSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyEventSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies an existing option group. </p>
          */
@@ -2551,6 +4175,27 @@ namespace Model
          */
         virtual void ModifyOptionGroupAsync(const Model::ModifyOptionGroupRequest& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies an existing option group. </p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyOptionGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyOptionGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyOptionGroupOutcome> ModifyOptionGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyOptionGroupOutcome>([this, request](const std::function<void(Model::ModifyOptionGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyOptionGroupAsync(request, [complete](const RDSClient*, const Model::ModifyOptionGroupRequest&, const Model::ModifyOptionGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyOptionGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Promotes a Read Replica DB instance to a standalone DB instance. </p> <note>
          * <p>We recommend that you enable automated backups on your Read Replica before
@@ -2582,6 +4227,31 @@ namespace Model
          */
         virtual void PromoteReadReplicaAsync(const Model::PromoteReadReplicaRequest& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Promotes a Read Replica DB instance to a standalone DB instance. </p> <note>
+         * <p>We recommend that you enable automated backups on your Read Replica before
+         * promoting the Read Replica. This ensures that no backup is taken during the
+         * promotion process. Once the instance is promoted to a primary instance, backups
+         * are taken based on your backup settings.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way PromoteReadReplicaAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PromoteReadReplicaRequest>
+        Aws::Utils::Threading::Awaitable<Model::PromoteReadReplicaOutcome> PromoteReadReplicaAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PromoteReadReplicaOutcome>([this, request](const std::function<void(Model::PromoteReadReplicaOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PromoteReadReplicaAsync(request, [complete](const RDSClient*, const Model::PromoteReadReplicaRequest&, const Model::PromoteReadReplicaOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PromoteReadReplicaOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Purchases a reserved DB instance offering. </p>
          */
@@ -2601,6 +4271,27 @@ namespace Model
          */
         virtual void PurchaseReservedDBInstancesOfferingAsync(const Model::PurchaseReservedDBInstancesOfferingRequest& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Purchases a reserved DB instance offering. </p>
+         *
+         * Returns an awaitable that starts the operation the way PurchaseReservedDBInstancesOfferingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PurchaseReservedDBInstancesOfferingRequest>
+        Aws::Utils::Threading::Awaitable<Model::PurchaseReservedDBInstancesOfferingOutcome> PurchaseReservedDBInstancesOfferingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PurchaseReservedDBInstancesOfferingOutcome>([this, request](const std::function<void(Model::PurchaseReservedDBInstancesOfferingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PurchaseReservedDBInstancesOfferingAsync(request, [complete](const RDSClient*, const Model::PurchaseReservedDBInstancesOfferingRequest&, const Model::PurchaseReservedDBInstancesOfferingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PurchaseReservedDBInstancesOfferingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Rebooting a DB instance restarts the database engine service. A reboot also
          * applies to the DB instance any modifications to the associated DB parameter
@@ -2659,6 +4350,40 @@ namespace Model
          */
         virtual void RebootDBInstanceAsync(const Model::RebootDBInstanceRequest& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Rebooting a DB instance restarts the database engine service. A reboot also
+         * applies to the DB instance any modifications to the associated DB parameter
+         * group that were pending. Rebooting a DB instance results in a momentary outage
+         * of the instance, during which the DB instance status is set to rebooting. If the
+         * RDS instance is configured for MultiAZ, it is possible that the reboot will be
+         * conducted through a failover. An Amazon RDS event is created when the reboot is
+         * completed. </p> <p> If your DB instance is deployed in multiple Availability
+         * Zones, you can force a failover from one AZ to the other during the reboot. You
+         * might force a failover to test the availability of your DB instance deployment
+         * or to restore operations to the original AZ after a failover occurs. </p> <p>
+         * The time required to reboot is a function of the specific database engine's
+         * crash recovery process. To improve the reboot time, we recommend that you reduce
+         * database activities as much as possible during the reboot process to reduce
+         * rollback activity for in-transit transactions. </p>
+         *
+         * Returns an awaitable that starts the operation the way RebootDBInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RebootDBInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RebootDBInstanceOutcome> RebootDBInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RebootDBInstanceOutcome>([this, request](const std::function<void(Model::RebootDBInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RebootDBInstanceAsync(request, [complete](const RDSClient*, const Model::RebootDBInstanceRequest&, const Model::RebootDBInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RebootDBInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes a source identifier from an existing RDS event notification
          * subscription.</p>
@@ -2681,6 +4406,28 @@ namespace Model
          */
         virtual void RemoveSourceIdentifierFromSubscriptionAsync(const Model::RemoveSourceIdentifierFromSubscriptionRequest& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes a source identifier from an existing RDS event notification
+         * subscription.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveSourceIdentifierFromSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveSourceIdentifierFromSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveSourceIdentifierFromSubscriptionOutcome> RemoveSourceIdentifierFromSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveSourceIdentifierFromSubscriptionOutcome>([this, request](const std::function<void(Model::RemoveSourceIdentifierFromSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveSourceIdentifierFromSubscriptionAsync(request, [complete](const RDSClient*, const Model::RemoveSourceIdentifierFromSubscriptionRequest&, const Model::RemoveSourceIdentifierFromSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveSourceIdentifierFromSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Removes metadata tags from an Amazon RDS resource.</p> <p>For an overview on
          * tagging an Amazon RDS resource, see <a
@@ -2709,6 +4456,30 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Removes metadata tags from an Amazon RDS resource.</p> <p>For an overview on
+         * tagging an Amazon RDS resource, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/Overview.Tagging.html">Tagging
+         * Amazon RDS Resources</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsFromResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsFromResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromResourceOutcome>([this, request](const std::function<void(Model::RemoveTagsFromResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsFromResourceAsync(request, [complete](const RDSClient*, const Model::RemoveTagsFromResourceRequest&, const Model::RemoveTagsFromResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsFromResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies the parameters of a DB cluster parameter group to the default
          * value. To reset specific parameters submit a list of the following:
@@ -2764,6 +4535,39 @@ namespace Model
          */
         virtual void ResetDBClusterParameterGroupAsync(const Model::ResetDBClusterParameterGroupRequest& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies the parameters of a DB cluster parameter group to the default
+         * value. To reset specific parameters submit a list of the following:
+         * <code>ParameterName</code> and <code>ApplyMethod</code>. To reset the entire DB
+         * cluster parameter group, specify the <code>DBClusterParameterGroupName</code>
+         * and <code>ResetAllParameters</code> parameters. </p> <p> When resetting the
+         * entire group, dynamic parameters are updated immediately and static parameters
+         * are set to <code>pending-reboot</code> to take effect on the next DB instance
+         * restart or <a>RebootDBInstance</a> request. You must call
+         * <a>RebootDBInstance</a> for every DB instance in your DB cluster that you want
+         * the updated static parameter to apply to.</p> <p>For more information on Amazon
+         * Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way ResetDBClusterParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResetDBClusterParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResetDBClusterParameterGroupOutcome> ResetDBClusterParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResetDBClusterParameterGroupOutcome>([this, request](const std::function<void(Model::ResetDBClusterParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResetDBClusterParameterGroupAsync(request, [complete](const RDSClient*, const Model::ResetDBClusterParameterGroupRequest&, const Model::ResetDBClusterParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResetDBClusterParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies the parameters of a DB parameter group to the engine/system default
          * value. To reset specific parameters submit a list of the following:
@@ -2804,6 +4608,34 @@ namespace Model
          */
         virtual void ResetDBParameterGroupAsync(const Model::ResetDBParameterGroupRequest& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies the parameters of a DB parameter group to the engine/system default
+         * value. To reset specific parameters submit a list of the following:
+         * <code>ParameterName</code> and <code>ApplyMethod</code>. To reset the entire DB
+         * parameter group, specify the <code>DBParameterGroup</code> name and
+         * <code>ResetAllParameters</code> parameters. When resetting the entire group,
+         * dynamic parameters are updated immediately and static parameters are set to
+         * <code>pending-reboot</code> to take effect on the next DB instance restart or
+         * <code>RebootDBInstance</code> request. </p>
+         *
+         * Returns an awaitable that starts the operation the way ResetDBParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResetDBParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResetDBParameterGroupOutcome> ResetDBParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResetDBParameterGroupOutcome>([this, request](const std::function<void(Model::ResetDBParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResetDBParameterGroupAsync(request, [complete](const RDSClient*, const Model::ResetDBParameterGroupRequest&, const Model::ResetDBParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResetDBParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new DB cluster from a DB cluster snapshot. The target DB cluster is
          * created from the source DB cluster restore point with the same configuration as
@@ -2841,6 +4673,33 @@ namespace Model
          */
         virtual void RestoreDBClusterFromSnapshotAsync(const Model::RestoreDBClusterFromSnapshotRequest& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new DB cluster from a DB cluster snapshot. The target DB cluster is
+         * created from the source DB cluster restore point with the same configuration as
+         * the original source DB cluster, except that the new DB cluster is created with
+         * the default security group. </p> <p>For more information on Amazon Aurora, see
+         * <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way RestoreDBClusterFromSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RestoreDBClusterFromSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::RestoreDBClusterFromSnapshotOutcome> RestoreDBClusterFromSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RestoreDBClusterFromSnapshotOutcome>([this, request](const std::function<void(Model::RestoreDBClusterFromSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RestoreDBClusterFromSnapshotAsync(request, [complete](const RDSClient*, const Model::RestoreDBClusterFromSnapshotRequest&, const Model::RestoreDBClusterFromSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RestoreDBClusterFromSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Restores a DB cluster to an arbitrary point in time. Users can restore to
          * any point in time before <code>LatestRestorableTime</code> for up to
@@ -2881,6 +4740,34 @@ namespace Model
          */
         virtual void RestoreDBClusterToPointInTimeAsync(const Model::RestoreDBClusterToPointInTimeRequest& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Restores a DB cluster to an arbitrary point in time. Users can restore to
+         * any point in time before <code>LatestRestorableTime</code> for up to
+         * <code>BackupRetentionPeriod</code> days. The target DB cluster is created from
+         * the source DB cluster with the same configuration as the original DB cluster,
+         * except that the new DB cluster is created with the default DB security group.
+         * </p> <p>For more information on Amazon Aurora, see <a
+         * href="http://docs.aws.amazon.com/AmazonRDS/latest/UserGuide/CHAP_Aurora.html">Aurora
+         * on Amazon RDS</a> in the <i>Amazon RDS User Guide.</i></p>
+         *
+         * Returns an awaitable that starts the operation the way RestoreDBClusterToPointInTimeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RestoreDBClusterToPointInTimeRequest>
+        Aws::Utils::Threading::Awaitable<Model::RestoreDBClusterToPointInTimeOutcome> RestoreDBClusterToPointInTimeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RestoreDBClusterToPointInTimeOutcome>([this, request](const std::function<void(Model::RestoreDBClusterToPointInTimeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RestoreDBClusterToPointInTimeAsync(request, [complete](const RDSClient*, const Model::RestoreDBClusterToPointInTimeRequest&, const Model::RestoreDBClusterToPointInTimeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RestoreDBClusterToPointInTimeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new DB instance from a DB snapshot. The target database is created
          * from the source database restore point with the most of original configuration
@@ -2945,6 +4832,42 @@ namespace Model
          */
         virtual void RestoreDBInstanceFromDBSnapshotAsync(const Model::RestoreDBInstanceFromDBSnapshotRequest& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new DB instance from a DB snapshot. The target database is created
+         * from the source database restore point with the most of original configuration
+         * with the default security group and the default DB parameter group. By default,
+         * the new DB instance is created as a single-AZ deployment except when the
+         * instance is a SQL Server instance that has an option group that is associated
+         * with mirroring; in this case, the instance becomes a mirrored AZ deployment and
+         * not a single-AZ deployment. </p> <p>If your intent is to replace your original
+         * DB instance with the new, restored DB instance, then rename your original DB
+         * instance before you call the RestoreDBInstanceFromDBSnapshot action. RDS does
+         * not allow two DB instances with the same name. Once you have renamed your
+         * original DB instance with a different identifier, then you can pass the original
+         * name of the DB instance as the DBInstanceIdentifier in the call to the
+         * RestoreDBInstanceFromDBSnapshot action. The result is that you will replace the
+         * original DB instance with the DB instance created from the snapshot.</p> <p>If
+         * you are restoring from a shared manual DB snapshot, the
+         * <code>DBSnapshotIdentifier</code> must be the ARN of the shared DB snapshot.</p>
+         *
+         * Returns an awaitable that starts the operation the way RestoreDBInstanceFromDBSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RestoreDBInstanceFromDBSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::RestoreDBInstanceFromDBSnapshotOutcome> RestoreDBInstanceFromDBSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RestoreDBInstanceFromDBSnapshotOutcome>([this, request](const std::function<void(Model::RestoreDBInstanceFromDBSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RestoreDBInstanceFromDBSnapshotAsync(request, [complete](const RDSClient*, const Model::RestoreDBInstanceFromDBSnapshotRequest&, const Model::RestoreDBInstanceFromDBSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RestoreDBInstanceFromDBSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Restores a DB instance to an arbitrary point in time. You can restore to any
          * point in time before the time identified by the LatestRestorableTime property.
@@ -2991,6 +4914,36 @@ namespace Model
          */
         virtual void RestoreDBInstanceToPointInTimeAsync(const Model::RestoreDBInstanceToPointInTimeRequest& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Restores a DB instance to an arbitrary point in time. You can restore to any
+         * point in time before the time identified by the LatestRestorableTime property.
+         * You can restore to a point up to the number of days specified by the
+         * BackupRetentionPeriod property.</p> <p> The target database is created with most
+         * of the original configuration, but in a system-selected availability zone, with
+         * the default security group, the default subnet group, and the default DB
+         * parameter group. By default, the new DB instance is created as a single-AZ
+         * deployment except when the instance is a SQL Server instance that has an option
+         * group that is associated with mirroring; in this case, the instance becomes a
+         * mirrored deployment and not a single-AZ deployment. </p>
+         *
+         * Returns an awaitable that starts the operation the way RestoreDBInstanceToPointInTimeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RestoreDBInstanceToPointInTimeRequest>
+        Aws::Utils::Threading::Awaitable<Model::RestoreDBInstanceToPointInTimeOutcome> RestoreDBInstanceToPointInTimeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RestoreDBInstanceToPointInTimeOutcome>([this, request](const std::function<void(Model::RestoreDBInstanceToPointInTimeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RestoreDBInstanceToPointInTimeAsync(request, [complete](const RDSClient*, const Model::RestoreDBInstanceToPointInTimeRequest&, const Model::RestoreDBInstanceToPointInTimeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RestoreDBInstanceToPointInTimeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Revokes ingress from a DBSecurityGroup for previously authorized IP ranges
          * or EC2 or VPC Security Groups. Required parameters for this API are one of
@@ -3019,6 +4972,30 @@ namespace Model
          */
         virtual void RevokeDBSecurityGroupIngressAsync(const Model::RevokeDBSecurityGroupIngressRequest& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Revokes ingress from a DBSecurityGroup for previously authorized IP ranges
+         * or EC2 or VPC Security Groups. Required parameters for this API are one of
+         * CIDRIP, EC2SecurityGroupId for VPC, or (EC2SecurityGroupOwnerId and either
+         * EC2SecurityGroupName or EC2SecurityGroupId). </p>
+         *
+         * Returns an awaitable that starts the operation the way RevokeDBSecurityGroupIngressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RevokeDBSecurityGroupIngressRequest>
+        Aws::Utils::Threading::Awaitable<Model::RevokeDBSecurityGroupIngressOutcome> RevokeDBSecurityGroupIngressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RevokeDBSecurityGroupIngressOutcome>([this, request](const std::function<void(Model::RevokeDBSecurityGroupIngressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RevokeDBSecurityGroupIngressAsync(request, [complete](const RDSClient*, const Model::RevokeDBSecurityGroupIngressRequest&, const Model::RevokeDBSecurityGroupIngressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RevokeDBSecurityGroupIngressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
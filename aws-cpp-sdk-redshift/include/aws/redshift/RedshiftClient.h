@@ -74,6 +74,7 @@
 #include <aws/redshift/model/RotateEncryptionKeyResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -493,6 +494,45 @@ namespace Model
          */
         virtual void AuthorizeClusterSecurityGroupIngressAsync(const Model::AuthorizeClusterSecurityGroupIngressRequest& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Adds an inbound (ingress) rule to an Amazon Redshift security group.
+         * Depending on whether the application accessing your cluster is running on the
+         * Internet or an Amazon EC2 instance, you can authorize inbound access to either a
+         * Classless Interdomain Routing (CIDR)/Internet Protocol (IP) range or to an
+         * Amazon EC2 security group. You can add as many as 20 ingress rules to an Amazon
+         * Redshift security group. </p> <p>If you authorize access to an Amazon EC2
+         * security group, specify <i>EC2SecurityGroupName</i> and
+         * <i>EC2SecurityGroupOwnerId</i>. The Amazon EC2 security group and Amazon
+         * Redshift cluster must be in the same AWS region. </p> <p> If you authorize
+         * access to a CIDR/IP address range, specify <i>CIDRIP</i>. For an overview of
+         * CIDR blocks, see the Wikipedia article on <a
+         * href="http://en.wikipedia.org/wiki/Classless_Inter-Domain_Routing">Classless
+         * Inter-Domain Routing</a>. </p> <p> You must also associate the security group
+         * with a cluster so that clients running on these IP addresses or the EC2 instance
+         * are authorized to connect to the cluster. For information about managing
+         * security groups, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-security-groups.html">Working
+         * with Security Groups</a> in the <i>Amazon Redshift Cluster Management
+         * Guide</i>.</p>
+         *
+         * Returns an awaitable that starts the operation the way AuthorizeClusterSecurityGroupIngressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AuthorizeClusterSecurityGroupIngressRequest>
+        Aws::Utils::Threading::Awaitable<Model::AuthorizeClusterSecurityGroupIngressOutcome> AuthorizeClusterSecurityGroupIngressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AuthorizeClusterSecurityGroupIngressOutcome>([this, request](const std::function<void(Model::AuthorizeClusterSecurityGroupIngressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AuthorizeClusterSecurityGroupIngressAsync(request, [complete](const RedshiftClient*, const Model::AuthorizeClusterSecurityGroupIngressRequest&, const Model::AuthorizeClusterSecurityGroupIngressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AuthorizeClusterSecurityGroupIngressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Authorizes the specified AWS customer account to restore the specified
          * snapshot. </p> <p> For more information about working with snapshots, go to <a
@@ -524,6 +564,31 @@ namespace Model
          */
         virtual void AuthorizeSnapshotAccessAsync(const Model::AuthorizeSnapshotAccessRequest& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Authorizes the specified AWS customer account to restore the specified
+         * snapshot. </p> <p> For more information about working with snapshots, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-snapshots.html">Amazon
+         * Redshift Snapshots</a> in the <i>Amazon Redshift Cluster Management Guide</i>.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way AuthorizeSnapshotAccessAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AuthorizeSnapshotAccessRequest>
+        Aws::Utils::Threading::Awaitable<Model::AuthorizeSnapshotAccessOutcome> AuthorizeSnapshotAccessAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AuthorizeSnapshotAccessOutcome>([this, request](const std::function<void(Model::AuthorizeSnapshotAccessOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AuthorizeSnapshotAccessAsync(request, [complete](const RedshiftClient*, const Model::AuthorizeSnapshotAccessRequest&, const Model::AuthorizeSnapshotAccessOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AuthorizeSnapshotAccessOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Copies the specified automated cluster snapshot to a new manual cluster
          * snapshot. The source must be an automated snapshot and it must be in the
@@ -573,6 +638,37 @@ namespace Model
          */
         virtual void CopyClusterSnapshotAsync(const Model::CopyClusterSnapshotRequest& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Copies the specified automated cluster snapshot to a new manual cluster
+         * snapshot. The source must be an automated snapshot and it must be in the
+         * available state. </p> <p> When you delete a cluster, Amazon Redshift deletes any
+         * automated snapshots of the cluster. Also, when the retention period of the
+         * snapshot expires, Amazon Redshift automatically deletes it. If you want to keep
+         * an automated snapshot for a longer period, you can make a manual copy of the
+         * snapshot. Manual snapshots are retained until you delete them. </p> <p> For more
+         * information about working with snapshots, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-snapshots.html">Amazon
+         * Redshift Snapshots</a> in the <i>Amazon Redshift Cluster Management Guide</i>.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way CopyClusterSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CopyClusterSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CopyClusterSnapshotOutcome> CopyClusterSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CopyClusterSnapshotOutcome>([this, request](const std::function<void(Model::CopyClusterSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CopyClusterSnapshotAsync(request, [complete](const RedshiftClient*, const Model::CopyClusterSnapshotRequest&, const Model::CopyClusterSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CopyClusterSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new cluster. To create the cluster in virtual private cloud (VPC),
          * you must provide cluster subnet group name. If you don't provide a cluster
@@ -613,6 +709,34 @@ namespace Model
          */
         virtual void CreateClusterAsync(const Model::CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new cluster. To create the cluster in virtual private cloud (VPC),
+         * you must provide cluster subnet group name. If you don't provide a cluster
+         * subnet group name or the cluster security group parameter, Amazon Redshift
+         * creates a non-VPC cluster, it associates the default cluster security group with
+         * the cluster. For more information about managing clusters, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-clusters.html">Amazon
+         * Redshift Clusters</a> in the <i>Amazon Redshift Cluster Management Guide</i> .
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateClusterOutcome> CreateClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateClusterOutcome>([this, request](const std::function<void(Model::CreateClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateClusterAsync(request, [complete](const RedshiftClient*, const Model::CreateClusterRequest&, const Model::CreateClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates an Amazon Redshift parameter group. </p> <p>Creating parameter
          * groups is independent of creating clusters. You can associate a cluster with a
@@ -659,6 +783,36 @@ namespace Model
          */
         virtual void CreateClusterParameterGroupAsync(const Model::CreateClusterParameterGroupRequest& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates an Amazon Redshift parameter group. </p> <p>Creating parameter
+         * groups is independent of creating clusters. You can associate a cluster with a
+         * parameter group when you create the cluster. You can also associate an existing
+         * cluster with a parameter group after the cluster is created by using
+         * <a>ModifyCluster</a>. </p> <p> Parameters in the parameter group define specific
+         * behavior that applies to the databases you create on the cluster. For more
+         * information about parameters and parameter groups, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-parameter-groups.html">Amazon
+         * Redshift Parameter Groups</a> in the <i>Amazon Redshift Cluster Management
+         * Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateClusterParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateClusterParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateClusterParameterGroupOutcome> CreateClusterParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateClusterParameterGroupOutcome>([this, request](const std::function<void(Model::CreateClusterParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateClusterParameterGroupAsync(request, [complete](const RedshiftClient*, const Model::CreateClusterParameterGroupRequest&, const Model::CreateClusterParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateClusterParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new Amazon Redshift security group. You use security groups to
          * control access to non-VPC clusters. </p> <p> For information about managing
@@ -693,6 +847,32 @@ namespace Model
          */
         virtual void CreateClusterSecurityGroupAsync(const Model::CreateClusterSecurityGroupRequest& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new Amazon Redshift security group. You use security groups to
+         * control access to non-VPC clusters. </p> <p> For information about managing
+         * security groups, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-security-groups.html">Amazon
+         * Redshift Cluster Security Groups</a> in the <i>Amazon Redshift Cluster
+         * Management Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateClusterSecurityGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateClusterSecurityGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateClusterSecurityGroupOutcome> CreateClusterSecurityGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateClusterSecurityGroupOutcome>([this, request](const std::function<void(Model::CreateClusterSecurityGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateClusterSecurityGroupAsync(request, [complete](const RedshiftClient*, const Model::CreateClusterSecurityGroupRequest&, const Model::CreateClusterSecurityGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateClusterSecurityGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a manual snapshot of the specified cluster. The cluster must be in
          * the <code>available</code> state. </p> <p> For more information about working
@@ -727,6 +907,32 @@ namespace Model
          */
         virtual void CreateClusterSnapshotAsync(const Model::CreateClusterSnapshotRequest& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a manual snapshot of the specified cluster. The cluster must be in
+         * the <code>available</code> state. </p> <p> For more information about working
+         * with snapshots, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-snapshots.html">Amazon
+         * Redshift Snapshots</a> in the <i>Amazon Redshift Cluster Management Guide</i>.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateClusterSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateClusterSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateClusterSnapshotOutcome> CreateClusterSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateClusterSnapshotOutcome>([this, request](const std::function<void(Model::CreateClusterSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateClusterSnapshotAsync(request, [complete](const RedshiftClient*, const Model::CreateClusterSnapshotRequest&, const Model::CreateClusterSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateClusterSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new Amazon Redshift subnet group. You must provide a list of one
          * or more subnets in your existing Amazon Virtual Private Cloud (Amazon VPC) when
@@ -764,6 +970,33 @@ namespace Model
          */
         virtual void CreateClusterSubnetGroupAsync(const Model::CreateClusterSubnetGroupRequest& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new Amazon Redshift subnet group. You must provide a list of one
+         * or more subnets in your existing Amazon Virtual Private Cloud (Amazon VPC) when
+         * creating Amazon Redshift subnet group. </p> <p> For information about subnet
+         * groups, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-cluster-subnet-groups.html">Amazon
+         * Redshift Cluster Subnet Groups</a> in the <i>Amazon Redshift Cluster Management
+         * Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateClusterSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateClusterSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateClusterSubnetGroupOutcome> CreateClusterSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateClusterSubnetGroupOutcome>([this, request](const std::function<void(Model::CreateClusterSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateClusterSubnetGroupAsync(request, [complete](const RedshiftClient*, const Model::CreateClusterSubnetGroupRequest&, const Model::CreateClusterSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateClusterSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates an Amazon Redshift event notification subscription. This action
          * requires an ARN (Amazon Resource Name) of an Amazon SNS topic created by either
@@ -837,6 +1070,45 @@ namespace Model
          */
         virtual void CreateEventSubscriptionAsync(const Model::CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates an Amazon Redshift event notification subscription. This action
+         * requires an ARN (Amazon Resource Name) of an Amazon SNS topic created by either
+         * the Amazon Redshift console, the Amazon SNS console, or the Amazon SNS API. To
+         * obtain an ARN with Amazon SNS, you must create a topic in Amazon SNS and
+         * subscribe to the topic. The ARN is displayed in the SNS console. </p> <p> You
+         * can specify the source type, and lists of Amazon Redshift source IDs, event
+         * categories, and event severities. Notifications will be sent for all events you
+         * want that match those criteria. For example, you can specify source type =
+         * cluster, source ID = my-cluster-1 and mycluster2, event categories =
+         * Availability, Backup, and severity = ERROR. The subscription will only send
+         * notifications for those ERROR events in the Availability and Backup categories
+         * for the specified clusters. </p> <p> If you specify both the source type and
+         * source IDs, such as source type = cluster and source identifier = my-cluster-1,
+         * notifications will be sent for all the cluster events for my-cluster-1. If you
+         * specify a source type but do not specify a source identifier, you will receive
+         * notice of the events for the objects of that type in your AWS account. If you do
+         * not specify either the SourceType nor the SourceIdentifier, you will be notified
+         * of events generated from all Amazon Redshift sources belonging to your AWS
+         * account. You must specify a source type if you specify a source ID. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateEventSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateEventSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateEventSubscriptionOutcome> CreateEventSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateEventSubscriptionOutcome>([this, request](const std::function<void(Model::CreateEventSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateEventSubscriptionAsync(request, [complete](const RedshiftClient*, const Model::CreateEventSubscriptionRequest&, const Model::CreateEventSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateEventSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an HSM client certificate that an Amazon Redshift cluster will use to
          * connect to the client's HSM in order to store and retrieve the keys used to
@@ -880,6 +1152,35 @@ namespace Model
          */
         virtual void CreateHsmClientCertificateAsync(const Model::CreateHsmClientCertificateRequest& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an HSM client certificate that an Amazon Redshift cluster will use to
+         * connect to the client's HSM in order to store and retrieve the keys used to
+         * encrypt the cluster databases.</p> <p>The command returns a public key, which
+         * you must store in the HSM. In addition to creating the HSM certificate, you must
+         * create an Amazon Redshift HSM configuration that provides a cluster the
+         * information needed to store and use encryption keys in the HSM. For more
+         * information, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-HSM.html">Hardware
+         * Security Modules</a> in the Amazon Redshift Cluster Management Guide.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateHsmClientCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateHsmClientCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateHsmClientCertificateOutcome> CreateHsmClientCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateHsmClientCertificateOutcome>([this, request](const std::function<void(Model::CreateHsmClientCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateHsmClientCertificateAsync(request, [complete](const RedshiftClient*, const Model::CreateHsmClientCertificateRequest&, const Model::CreateHsmClientCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateHsmClientCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an HSM configuration that contains the information required by an
          * Amazon Redshift cluster to store and use database encryption keys in a Hardware
@@ -920,6 +1221,34 @@ namespace Model
          */
         virtual void CreateHsmConfigurationAsync(const Model::CreateHsmConfigurationRequest& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an HSM configuration that contains the information required by an
+         * Amazon Redshift cluster to store and use database encryption keys in a Hardware
+         * Security Module (HSM). After creating the HSM configuration, you can specify it
+         * as a parameter when creating a cluster. The cluster will then store its
+         * encryption keys in the HSM.</p> <p>In addition to creating an HSM configuration,
+         * you must also create an HSM client certificate. For more information, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-HSM.html">Hardware
+         * Security Modules</a> in the Amazon Redshift Cluster Management Guide.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateHsmConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateHsmConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateHsmConfigurationOutcome> CreateHsmConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateHsmConfigurationOutcome>([this, request](const std::function<void(Model::CreateHsmConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateHsmConfigurationAsync(request, [complete](const RedshiftClient*, const Model::CreateHsmConfigurationRequest&, const Model::CreateHsmConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateHsmConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a snapshot copy grant that permits Amazon Redshift to use a customer
          * master key (CMK) from AWS Key Management Service (AWS KMS) to encrypt copied
@@ -957,6 +1286,33 @@ namespace Model
          */
         virtual void CreateSnapshotCopyGrantAsync(const Model::CreateSnapshotCopyGrantRequest& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a snapshot copy grant that permits Amazon Redshift to use a customer
+         * master key (CMK) from AWS Key Management Service (AWS KMS) to encrypt copied
+         * snapshots in a destination region.</p> <p> For more information about managing
+         * snapshot copy grants, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-db-encryption.html">Amazon
+         * Redshift Database Encryption</a> in the <i>Amazon Redshift Cluster Management
+         * Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateSnapshotCopyGrantAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSnapshotCopyGrantRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSnapshotCopyGrantOutcome> CreateSnapshotCopyGrantAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSnapshotCopyGrantOutcome>([this, request](const std::function<void(Model::CreateSnapshotCopyGrantOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSnapshotCopyGrantAsync(request, [complete](const RedshiftClient*, const Model::CreateSnapshotCopyGrantRequest&, const Model::CreateSnapshotCopyGrantOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSnapshotCopyGrantOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Adds one or more tags to a specified resource. </p> <p> A resource can have
          * up to 10 tags. If you try to create more than 10 tags for a resource, you will
@@ -988,6 +1344,31 @@ namespace Model
          */
         virtual void CreateTagsAsync(const Model::CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Adds one or more tags to a specified resource. </p> <p> A resource can have
+         * up to 10 tags. If you try to create more than 10 tags for a resource, you will
+         * receive an error and the attempt will fail. </p> <p> If you specify a key that
+         * already exists for the resource, the value for that key will be updated with the
+         * new value. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTagsOutcome> CreateTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTagsOutcome>([this, request](const std::function<void(Model::CreateTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTagsAsync(request, [complete](const RedshiftClient*, const Model::CreateTagsRequest&, const Model::CreateTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a previously provisioned cluster. A successful response from the web
          * service indicates that the request was received correctly. Use
@@ -1055,6 +1436,43 @@ namespace Model
          */
         virtual void DeleteClusterAsync(const Model::DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a previously provisioned cluster. A successful response from the web
+         * service indicates that the request was received correctly. Use
+         * <a>DescribeClusters</a> to monitor the status of the deletion. The delete
+         * operation cannot be canceled or reverted once submitted. For more information
+         * about managing clusters, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-clusters.html">Amazon
+         * Redshift Clusters</a> in the <i>Amazon Redshift Cluster Management Guide</i> .
+         * </p> <p> If you want to shut down the cluster and retain it for future use, set
+         * <i>SkipFinalClusterSnapshot</i> to <code>false</code> and specify a name for
+         * <i>FinalClusterSnapshotIdentifier</i>. You can later restore this snapshot to
+         * resume using the cluster. If a final cluster snapshot is requested, the status
+         * of the cluster will be "final-snapshot" while the snapshot is being taken, then
+         * it's "deleting" once Amazon Redshift begins deleting the cluster. </p> <p> For
+         * more information about managing clusters, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-clusters.html">Amazon
+         * Redshift Clusters</a> in the <i>Amazon Redshift Cluster Management Guide</i> .
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteClusterOutcome> DeleteClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteClusterOutcome>([this, request](const std::function<void(Model::DeleteClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteClusterAsync(request, [complete](const RedshiftClient*, const Model::DeleteClusterRequest&, const Model::DeleteClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a specified Amazon Redshift parameter group. <note>You cannot delete
          * a parameter group if it is associated with a cluster.</note> </p>
@@ -1077,6 +1495,28 @@ namespace Model
          */
         virtual void DeleteClusterParameterGroupAsync(const Model::DeleteClusterParameterGroupRequest& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a specified Amazon Redshift parameter group. <note>You cannot delete
+         * a parameter group if it is associated with a cluster.</note> </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteClusterParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteClusterParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteClusterParameterGroupOutcome> DeleteClusterParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteClusterParameterGroupOutcome>([this, request](const std::function<void(Model::DeleteClusterParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteClusterParameterGroupAsync(request, [complete](const RedshiftClient*, const Model::DeleteClusterParameterGroupRequest&, const Model::DeleteClusterParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteClusterParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes an Amazon Redshift security group. </p> <note>You cannot delete a
          * security group that is associated with any clusters. You cannot delete the
@@ -1114,6 +1554,33 @@ namespace Model
          */
         virtual void DeleteClusterSecurityGroupAsync(const Model::DeleteClusterSecurityGroupRequest& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes an Amazon Redshift security group. </p> <note>You cannot delete a
+         * security group that is associated with any clusters. You cannot delete the
+         * default security group.</note> <p> For information about managing security
+         * groups, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-security-groups.html">Amazon
+         * Redshift Cluster Security Groups</a> in the <i>Amazon Redshift Cluster
+         * Management Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteClusterSecurityGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteClusterSecurityGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteClusterSecurityGroupOutcome> DeleteClusterSecurityGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteClusterSecurityGroupOutcome>([this, request](const std::function<void(Model::DeleteClusterSecurityGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteClusterSecurityGroupAsync(request, [complete](const RedshiftClient*, const Model::DeleteClusterSecurityGroupRequest&, const Model::DeleteClusterSecurityGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteClusterSecurityGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the specified manual snapshot. The snapshot must be in the
          * <code>available</code> state, with no other users authorized to access the
@@ -1151,6 +1618,33 @@ namespace Model
          */
         virtual void DeleteClusterSnapshotAsync(const Model::DeleteClusterSnapshotRequest& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the specified manual snapshot. The snapshot must be in the
+         * <code>available</code> state, with no other users authorized to access the
+         * snapshot. </p> <p> Unlike automated snapshots, manual snapshots are retained
+         * even after you delete your cluster. Amazon Redshift does not delete your manual
+         * snapshots. You must delete manual snapshot explicitly to avoid getting charged.
+         * If other accounts are authorized to access the snapshot, you must revoke all of
+         * the authorizations before you can delete the snapshot. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteClusterSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteClusterSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteClusterSnapshotOutcome> DeleteClusterSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteClusterSnapshotOutcome>([this, request](const std::function<void(Model::DeleteClusterSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteClusterSnapshotAsync(request, [complete](const RedshiftClient*, const Model::DeleteClusterSnapshotRequest&, const Model::DeleteClusterSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteClusterSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the specified cluster subnet group. </p>
          */
@@ -1170,6 +1664,27 @@ namespace Model
          */
         virtual void DeleteClusterSubnetGroupAsync(const Model::DeleteClusterSubnetGroupRequest& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the specified cluster subnet group. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteClusterSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteClusterSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteClusterSubnetGroupOutcome> DeleteClusterSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteClusterSubnetGroupOutcome>([this, request](const std::function<void(Model::DeleteClusterSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteClusterSubnetGroupAsync(request, [complete](const RedshiftClient*, const Model::DeleteClusterSubnetGroupRequest&, const Model::DeleteClusterSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteClusterSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes an Amazon Redshift event notification subscription. </p>
          */
@@ -1189,6 +1704,27 @@ namespace Model
          */
         virtual void DeleteEventSubscriptionAsync(const Model::DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes an Amazon Redshift event notification subscription. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteEventSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteEventSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteEventSubscriptionOutcome> DeleteEventSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteEventSubscriptionOutcome>([this, request](const std::function<void(Model::DeleteEventSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteEventSubscriptionAsync(request, [complete](const RedshiftClient*, const Model::DeleteEventSubscriptionRequest&, const Model::DeleteEventSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteEventSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified HSM client certificate.</p>
          */
@@ -1208,6 +1744,27 @@ namespace Model
          */
         virtual void DeleteHsmClientCertificateAsync(const Model::DeleteHsmClientCertificateRequest& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified HSM client certificate.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteHsmClientCertificateAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteHsmClientCertificateRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteHsmClientCertificateOutcome> DeleteHsmClientCertificateAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteHsmClientCertificateOutcome>([this, request](const std::function<void(Model::DeleteHsmClientCertificateOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteHsmClientCertificateAsync(request, [complete](const RedshiftClient*, const Model::DeleteHsmClientCertificateRequest&, const Model::DeleteHsmClientCertificateOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteHsmClientCertificateOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified Amazon Redshift HSM configuration.</p>
          */
@@ -1227,6 +1784,27 @@ namespace Model
          */
         virtual void DeleteHsmConfigurationAsync(const Model::DeleteHsmConfigurationRequest& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified Amazon Redshift HSM configuration.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteHsmConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteHsmConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteHsmConfigurationOutcome> DeleteHsmConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteHsmConfigurationOutcome>([this, request](const std::function<void(Model::DeleteHsmConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteHsmConfigurationAsync(request, [complete](const RedshiftClient*, const Model::DeleteHsmConfigurationRequest&, const Model::DeleteHsmConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteHsmConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified snapshot copy grant.</p>
          */
@@ -1246,6 +1824,27 @@ namespace Model
          */
         virtual void DeleteSnapshotCopyGrantAsync(const Model::DeleteSnapshotCopyGrantRequest& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified snapshot copy grant.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSnapshotCopyGrantAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSnapshotCopyGrantRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSnapshotCopyGrantOutcome> DeleteSnapshotCopyGrantAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSnapshotCopyGrantOutcome>([this, request](const std::function<void(Model::DeleteSnapshotCopyGrantOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSnapshotCopyGrantAsync(request, [complete](const RedshiftClient*, const Model::DeleteSnapshotCopyGrantRequest&, const Model::DeleteSnapshotCopyGrantOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSnapshotCopyGrantOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes a tag or tags from a resource. You must provide the ARN of the
          * resource from which you want to delete the tag or tags.</p>
@@ -1268,6 +1867,28 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes a tag or tags from a resource. You must provide the ARN of the
+         * resource from which you want to delete the tag or tags.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTagsOutcome>([this, request](const std::function<void(Model::DeleteTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTagsAsync(request, [complete](const RedshiftClient*, const Model::DeleteTagsRequest&, const Model::DeleteTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of Amazon Redshift parameter groups, including parameter
          * groups you created and the default parameter group. For each parameter group,
@@ -1332,6 +1953,42 @@ namespace Model
          */
         virtual void DescribeClusterParameterGroupsAsync(const Model::DescribeClusterParameterGroupsRequest& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of Amazon Redshift parameter groups, including parameter
+         * groups you created and the default parameter group. For each parameter group,
+         * the response includes the parameter group name, description, and parameter group
+         * family name. You can optionally specify a name to retrieve the description of a
+         * specific parameter group. </p> <p> For more information about parameters and
+         * parameter groups, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-parameter-groups.html">Amazon
+         * Redshift Parameter Groups</a> in the <i>Amazon Redshift Cluster Management
+         * Guide</i>. </p> <p>If you specify both tag keys and tag values in the same
+         * request, Amazon Redshift returns all parameter groups that match any combination
+         * of the specified keys and values. For example, if you have <code>owner</code>
+         * and <code>environment</code> for tag keys, and <code>admin</code> and
+         * <code>test</code> for tag values, all parameter groups that have any combination
+         * of those values are returned.</p> <p>If both tag keys and values are omitted
+         * from the request, parameter groups are returned regardless of whether they have
+         * tag keys or values associated with them.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeClusterParameterGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeClusterParameterGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeClusterParameterGroupsOutcome> DescribeClusterParameterGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeClusterParameterGroupsOutcome>([this, request](const std::function<void(Model::DescribeClusterParameterGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeClusterParameterGroupsAsync(request, [complete](const RedshiftClient*, const Model::DescribeClusterParameterGroupsRequest&, const Model::DescribeClusterParameterGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeClusterParameterGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a detailed list of parameters contained within the specified Amazon
          * Redshift parameter group. For each parameter the response includes information
@@ -1384,6 +2041,38 @@ namespace Model
          */
         virtual void DescribeClusterParametersAsync(const Model::DescribeClusterParametersRequest& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a detailed list of parameters contained within the specified Amazon
+         * Redshift parameter group. For each parameter the response includes information
+         * such as parameter name, description, data type, value, whether the parameter
+         * value is modifiable, and so on. </p> <p>You can specify <i>source</i> filter to
+         * retrieve parameters of only specific type. For example, to retrieve parameters
+         * that were modified by a user action such as from
+         * <a>ModifyClusterParameterGroup</a>, you can specify <i>source</i> equal to
+         * <i>user</i>.</p> <p> For more information about parameters and parameter groups,
+         * go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-parameter-groups.html">Amazon
+         * Redshift Parameter Groups</a> in the <i>Amazon Redshift Cluster Management
+         * Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeClusterParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeClusterParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeClusterParametersOutcome> DescribeClusterParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeClusterParametersOutcome>([this, request](const std::function<void(Model::DescribeClusterParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeClusterParametersAsync(request, [complete](const RedshiftClient*, const Model::DescribeClusterParametersRequest&, const Model::DescribeClusterParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeClusterParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns information about Amazon Redshift security groups. If the name of a
          * security group is specified, the response will contain only information about
@@ -1442,6 +2131,40 @@ namespace Model
          */
         virtual void DescribeClusterSecurityGroupsAsync(const Model::DescribeClusterSecurityGroupsRequest& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns information about Amazon Redshift security groups. If the name of a
+         * security group is specified, the response will contain only information about
+         * only that security group. </p> <p> For information about managing security
+         * groups, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-security-groups.html">Amazon
+         * Redshift Cluster Security Groups</a> in the <i>Amazon Redshift Cluster
+         * Management Guide</i>. </p> <p>If you specify both tag keys and tag values in the
+         * same request, Amazon Redshift returns all security groups that match any
+         * combination of the specified keys and values. For example, if you have
+         * <code>owner</code> and <code>environment</code> for tag keys, and
+         * <code>admin</code> and <code>test</code> for tag values, all security groups
+         * that have any combination of those values are returned.</p> <p>If both tag keys
+         * and values are omitted from the request, security groups are returned regardless
+         * of whether they have tag keys or values associated with them.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeClusterSecurityGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeClusterSecurityGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeClusterSecurityGroupsOutcome> DescribeClusterSecurityGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeClusterSecurityGroupsOutcome>([this, request](const std::function<void(Model::DescribeClusterSecurityGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeClusterSecurityGroupsAsync(request, [complete](const RedshiftClient*, const Model::DescribeClusterSecurityGroupsRequest&, const Model::DescribeClusterSecurityGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeClusterSecurityGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns one or more snapshot objects, which contain metadata about your
          * cluster snapshots. By default, this operation returns information about all
@@ -1500,6 +2223,40 @@ namespace Model
          */
         virtual void DescribeClusterSnapshotsAsync(const Model::DescribeClusterSnapshotsRequest& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns one or more snapshot objects, which contain metadata about your
+         * cluster snapshots. By default, this operation returns information about all
+         * snapshots of all clusters that are owned by you AWS customer account. No
+         * information is returned for snapshots owned by inactive AWS customer accounts.
+         * </p> <p>If you specify both tag keys and tag values in the same request, Amazon
+         * Redshift returns all snapshots that match any combination of the specified keys
+         * and values. For example, if you have <code>owner</code> and
+         * <code>environment</code> for tag keys, and <code>admin</code> and
+         * <code>test</code> for tag values, all snapshots that have any combination of
+         * those values are returned. Only snapshots that you own are returned in the
+         * response; shared snapshots are not returned with the tag key and tag value
+         * request parameters.</p> <p>If both tag keys and values are omitted from the
+         * request, snapshots are returned regardless of whether they have tag keys or
+         * values associated with them.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeClusterSnapshotsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeClusterSnapshotsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeClusterSnapshotsOutcome> DescribeClusterSnapshotsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeClusterSnapshotsOutcome>([this, request](const std::function<void(Model::DescribeClusterSnapshotsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeClusterSnapshotsAsync(request, [complete](const RedshiftClient*, const Model::DescribeClusterSnapshotsRequest&, const Model::DescribeClusterSnapshotsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeClusterSnapshotsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns one or more cluster subnet group objects, which contain metadata
          * about your cluster subnet groups. By default, this operation returns information
@@ -1549,6 +2306,37 @@ namespace Model
          */
         virtual void DescribeClusterSubnetGroupsAsync(const Model::DescribeClusterSubnetGroupsRequest& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns one or more cluster subnet group objects, which contain metadata
+         * about your cluster subnet groups. By default, this operation returns information
+         * about all cluster subnet groups that are defined in you AWS account. </p> <p>If
+         * you specify both tag keys and tag values in the same request, Amazon Redshift
+         * returns all subnet groups that match any combination of the specified keys and
+         * values. For example, if you have <code>owner</code> and <code>environment</code>
+         * for tag keys, and <code>admin</code> and <code>test</code> for tag values, all
+         * subnet groups that have any combination of those values are returned.</p> <p>If
+         * both tag keys and values are omitted from the request, subnet groups are
+         * returned regardless of whether they have tag keys or values associated with
+         * them.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeClusterSubnetGroupsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeClusterSubnetGroupsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeClusterSubnetGroupsOutcome> DescribeClusterSubnetGroupsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeClusterSubnetGroupsOutcome>([this, request](const std::function<void(Model::DescribeClusterSubnetGroupsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeClusterSubnetGroupsAsync(request, [complete](const RedshiftClient*, const Model::DescribeClusterSubnetGroupsRequest&, const Model::DescribeClusterSubnetGroupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeClusterSubnetGroupsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns descriptions of the available Amazon Redshift cluster versions. You
          * can call this operation even before creating any clusters to learn more about
@@ -1586,6 +2374,33 @@ namespace Model
          */
         virtual void DescribeClusterVersionsAsync(const Model::DescribeClusterVersionsRequest& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns descriptions of the available Amazon Redshift cluster versions. You
+         * can call this operation even before creating any clusters to learn more about
+         * the Amazon Redshift versions. For more information about managing clusters, go
+         * to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-clusters.html">Amazon
+         * Redshift Clusters</a> in the <i>Amazon Redshift Cluster Management Guide</i>
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeClusterVersionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeClusterVersionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeClusterVersionsOutcome> DescribeClusterVersionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeClusterVersionsOutcome>([this, request](const std::function<void(Model::DescribeClusterVersionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeClusterVersionsAsync(request, [complete](const RedshiftClient*, const Model::DescribeClusterVersionsRequest&, const Model::DescribeClusterVersionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeClusterVersionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns properties of provisioned clusters including general cluster
          * properties, cluster database properties, maintenance and backup properties, and
@@ -1644,6 +2459,40 @@ namespace Model
          */
         virtual void DescribeClustersAsync(const Model::DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns properties of provisioned clusters including general cluster
+         * properties, cluster database properties, maintenance and backup properties, and
+         * security and access properties. This operation supports pagination. For more
+         * information about managing clusters, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-clusters.html">Amazon
+         * Redshift Clusters</a> in the <i>Amazon Redshift Cluster Management Guide</i> .
+         * </p> <p>If you specify both tag keys and tag values in the same request, Amazon
+         * Redshift returns all clusters that match any combination of the specified keys
+         * and values. For example, if you have <code>owner</code> and
+         * <code>environment</code> for tag keys, and <code>admin</code> and
+         * <code>test</code> for tag values, all clusters that have any combination of
+         * those values are returned.</p> <p>If both tag keys and values are omitted from
+         * the request, clusters are returned regardless of whether they have tag keys or
+         * values associated with them.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeClustersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeClustersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeClustersOutcome> DescribeClustersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeClustersOutcome>([this, request](const std::function<void(Model::DescribeClustersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeClustersAsync(request, [complete](const RedshiftClient*, const Model::DescribeClustersRequest&, const Model::DescribeClustersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeClustersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of parameter settings for the specified parameter group
          * family. </p> <p> For more information about parameters and parameter groups, go
@@ -1678,6 +2527,32 @@ namespace Model
          */
         virtual void DescribeDefaultClusterParametersAsync(const Model::DescribeDefaultClusterParametersRequest& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of parameter settings for the specified parameter group
+         * family. </p> <p> For more information about parameters and parameter groups, go
+         * to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-parameter-groups.html">Amazon
+         * Redshift Parameter Groups</a> in the <i>Amazon Redshift Cluster Management
+         * Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDefaultClusterParametersAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDefaultClusterParametersRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDefaultClusterParametersOutcome> DescribeDefaultClusterParametersAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDefaultClusterParametersOutcome>([this, request](const std::function<void(Model::DescribeDefaultClusterParametersOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDefaultClusterParametersAsync(request, [complete](const RedshiftClient*, const Model::DescribeDefaultClusterParametersRequest&, const Model::DescribeDefaultClusterParametersOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDefaultClusterParametersOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Displays a list of event categories for all event source types, or for a
          * specified source type. For a list of the event categories and source types, go
@@ -1709,6 +2584,31 @@ namespace Model
          */
         virtual void DescribeEventCategoriesAsync(const Model::DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Displays a list of event categories for all event source types, or for a
+         * specified source type. For a list of the event categories and source types, go
+         * to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-event-notifications.html">Amazon
+         * Redshift Event Notifications</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEventCategoriesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEventCategoriesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEventCategoriesOutcome> DescribeEventCategoriesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEventCategoriesOutcome>([this, request](const std::function<void(Model::DescribeEventCategoriesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEventCategoriesAsync(request, [complete](const RedshiftClient*, const Model::DescribeEventCategoriesRequest&, const Model::DescribeEventCategoriesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEventCategoriesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Lists descriptions of all the Amazon Redshift event notifications
          * subscription for a customer account. If you specify a subscription name, lists
@@ -1734,6 +2634,29 @@ namespace Model
          */
         virtual void DescribeEventSubscriptionsAsync(const Model::DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Lists descriptions of all the Amazon Redshift event notifications
+         * subscription for a customer account. If you specify a subscription name, lists
+         * the description for that subscription. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEventSubscriptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEventSubscriptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEventSubscriptionsOutcome> DescribeEventSubscriptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEventSubscriptionsOutcome>([this, request](const std::function<void(Model::DescribeEventSubscriptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEventSubscriptionsAsync(request, [complete](const RedshiftClient*, const Model::DescribeEventSubscriptionsRequest&, const Model::DescribeEventSubscriptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEventSubscriptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns events related to clusters, security groups, snapshots, and
          * parameter groups for the past 14 days. Events specific to a particular cluster,
@@ -1762,6 +2685,30 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns events related to clusters, security groups, snapshots, and
+         * parameter groups for the past 14 days. Events specific to a particular cluster,
+         * security group, snapshot or parameter group can be obtained by providing the
+         * name as a parameter. By default, the past hour of events are returned. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeEventsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeEventsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeEventsOutcome>([this, request](const std::function<void(Model::DescribeEventsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeEventsAsync(request, [complete](const RedshiftClient*, const Model::DescribeEventsRequest&, const Model::DescribeEventsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeEventsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the specified HSM client certificate. If no
          * certificate ID is specified, returns information about all the HSM certificates
@@ -1811,6 +2758,37 @@ namespace Model
          */
         virtual void DescribeHsmClientCertificatesAsync(const Model::DescribeHsmClientCertificatesRequest& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the specified HSM client certificate. If no
+         * certificate ID is specified, returns information about all the HSM certificates
+         * owned by your AWS customer account.</p> <p>If you specify both tag keys and tag
+         * values in the same request, Amazon Redshift returns all HSM client certificates
+         * that match any combination of the specified keys and values. For example, if you
+         * have <code>owner</code> and <code>environment</code> for tag keys, and
+         * <code>admin</code> and <code>test</code> for tag values, all HSM client
+         * certificates that have any combination of those values are returned.</p> <p>If
+         * both tag keys and values are omitted from the request, HSM client certificates
+         * are returned regardless of whether they have tag keys or values associated with
+         * them.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeHsmClientCertificatesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeHsmClientCertificatesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeHsmClientCertificatesOutcome> DescribeHsmClientCertificatesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeHsmClientCertificatesOutcome>([this, request](const std::function<void(Model::DescribeHsmClientCertificatesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeHsmClientCertificatesAsync(request, [complete](const RedshiftClient*, const Model::DescribeHsmClientCertificatesRequest&, const Model::DescribeHsmClientCertificatesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeHsmClientCertificatesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the specified Amazon Redshift HSM configuration. If
          * no configuration ID is specified, returns information about all the HSM
@@ -1860,6 +2838,37 @@ namespace Model
          */
         virtual void DescribeHsmConfigurationsAsync(const Model::DescribeHsmConfigurationsRequest& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the specified Amazon Redshift HSM configuration. If
+         * no configuration ID is specified, returns information about all the HSM
+         * configurations owned by your AWS customer account.</p> <p>If you specify both
+         * tag keys and tag values in the same request, Amazon Redshift returns all HSM
+         * connections that match any combination of the specified keys and values. For
+         * example, if you have <code>owner</code> and <code>environment</code> for tag
+         * keys, and <code>admin</code> and <code>test</code> for tag values, all HSM
+         * connections that have any combination of those values are returned.</p> <p>If
+         * both tag keys and values are omitted from the request, HSM connections are
+         * returned regardless of whether they have tag keys or values associated with
+         * them.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeHsmConfigurationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeHsmConfigurationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeHsmConfigurationsOutcome> DescribeHsmConfigurationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeHsmConfigurationsOutcome>([this, request](const std::function<void(Model::DescribeHsmConfigurationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeHsmConfigurationsAsync(request, [complete](const RedshiftClient*, const Model::DescribeHsmConfigurationsRequest&, const Model::DescribeHsmConfigurationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeHsmConfigurationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes whether information, such as queries and connection attempts, is
          * being logged for the specified Amazon Redshift cluster.</p>
@@ -1882,6 +2891,28 @@ namespace Model
          */
         virtual void DescribeLoggingStatusAsync(const Model::DescribeLoggingStatusRequest& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes whether information, such as queries and connection attempts, is
+         * being logged for the specified Amazon Redshift cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeLoggingStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeLoggingStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeLoggingStatusOutcome> DescribeLoggingStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeLoggingStatusOutcome>([this, request](const std::function<void(Model::DescribeLoggingStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeLoggingStatusAsync(request, [complete](const RedshiftClient*, const Model::DescribeLoggingStatusRequest&, const Model::DescribeLoggingStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeLoggingStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of orderable cluster options. Before you create a new cluster
          * you can use this operation to find what options are available, such as the EC2
@@ -1928,6 +2959,36 @@ namespace Model
          */
         virtual void DescribeOrderableClusterOptionsAsync(const Model::DescribeOrderableClusterOptionsRequest& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of orderable cluster options. Before you create a new cluster
+         * you can use this operation to find what options are available, such as the EC2
+         * Availability Zones (AZ) in the specific AWS region that you can specify, and the
+         * node types you can request. The node types differ by available storage, memory,
+         * CPU and price. With the cost involved you might want to obtain a list of cluster
+         * options in the specific region and specify values when creating a cluster. For
+         * more information about managing clusters, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-clusters.html">Amazon
+         * Redshift Clusters</a> in the <i>Amazon Redshift Cluster Management Guide</i>
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeOrderableClusterOptionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeOrderableClusterOptionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeOrderableClusterOptionsOutcome> DescribeOrderableClusterOptionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeOrderableClusterOptionsOutcome>([this, request](const std::function<void(Model::DescribeOrderableClusterOptionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeOrderableClusterOptionsAsync(request, [complete](const RedshiftClient*, const Model::DescribeOrderableClusterOptionsRequest&, const Model::DescribeOrderableClusterOptionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeOrderableClusterOptionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of the available reserved node offerings by Amazon Redshift
          * with their descriptions including the node type, the fixed and recurring costs
@@ -1974,6 +3035,36 @@ namespace Model
          */
         virtual void DescribeReservedNodeOfferingsAsync(const Model::DescribeReservedNodeOfferingsRequest& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of the available reserved node offerings by Amazon Redshift
+         * with their descriptions including the node type, the fixed and recurring costs
+         * of reserving the node and duration the node will be reserved for you. These
+         * descriptions help you determine which reserve node offering you want to
+         * purchase. You then use the unique offering ID in you call to
+         * <a>PurchaseReservedNodeOffering</a> to reserve one or more nodes for your Amazon
+         * Redshift cluster. </p> <p> For more information about reserved node offerings,
+         * go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/purchase-reserved-node-instance.html">Purchasing
+         * Reserved Nodes</a> in the <i>Amazon Redshift Cluster Management Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReservedNodeOfferingsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReservedNodeOfferingsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReservedNodeOfferingsOutcome> DescribeReservedNodeOfferingsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReservedNodeOfferingsOutcome>([this, request](const std::function<void(Model::DescribeReservedNodeOfferingsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReservedNodeOfferingsAsync(request, [complete](const RedshiftClient*, const Model::DescribeReservedNodeOfferingsRequest&, const Model::DescribeReservedNodeOfferingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReservedNodeOfferingsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns the descriptions of the reserved nodes. </p>
          */
@@ -1993,6 +3084,27 @@ namespace Model
          */
         virtual void DescribeReservedNodesAsync(const Model::DescribeReservedNodesRequest& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns the descriptions of the reserved nodes. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeReservedNodesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeReservedNodesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeReservedNodesOutcome> DescribeReservedNodesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeReservedNodesOutcome>([this, request](const std::function<void(Model::DescribeReservedNodesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeReservedNodesAsync(request, [complete](const RedshiftClient*, const Model::DescribeReservedNodesRequest&, const Model::DescribeReservedNodesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeReservedNodesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns information about the last resize operation for the specified
          * cluster. If no resize operation has ever been initiated for the specified
@@ -2030,6 +3142,33 @@ namespace Model
          */
         virtual void DescribeResizeAsync(const Model::DescribeResizeRequest& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns information about the last resize operation for the specified
+         * cluster. If no resize operation has ever been initiated for the specified
+         * cluster, a <code>HTTP 404</code> error is returned. If a resize operation was
+         * initiated and completed, the status of the resize remains as
+         * <code>SUCCEEDED</code> until the next resize. </p> <p> A resize operation can be
+         * requested using <a>ModifyCluster</a> and specifying a different number or type
+         * of nodes for the cluster. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeResizeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeResizeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeResizeOutcome> DescribeResizeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeResizeOutcome>([this, request](const std::function<void(Model::DescribeResizeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeResizeAsync(request, [complete](const RedshiftClient*, const Model::DescribeResizeRequest&, const Model::DescribeResizeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeResizeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of snapshot copy grants owned by the AWS account in the
          * destination region.</p> <p> For more information about managing snapshot copy
@@ -2064,6 +3203,32 @@ namespace Model
          */
         virtual void DescribeSnapshotCopyGrantsAsync(const Model::DescribeSnapshotCopyGrantsRequest& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of snapshot copy grants owned by the AWS account in the
+         * destination region.</p> <p> For more information about managing snapshot copy
+         * grants, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-db-encryption.html">Amazon
+         * Redshift Database Encryption</a> in the <i>Amazon Redshift Cluster Management
+         * Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSnapshotCopyGrantsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSnapshotCopyGrantsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotCopyGrantsOutcome> DescribeSnapshotCopyGrantsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotCopyGrantsOutcome>([this, request](const std::function<void(Model::DescribeSnapshotCopyGrantsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSnapshotCopyGrantsAsync(request, [complete](const RedshiftClient*, const Model::DescribeSnapshotCopyGrantsRequest&, const Model::DescribeSnapshotCopyGrantsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSnapshotCopyGrantsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the status of one or more table restore requests made using the
          * <a>RestoreTableFromClusterSnapshot</a> API action. If you don't specify a value
@@ -2101,6 +3266,33 @@ namespace Model
          */
         virtual void DescribeTableRestoreStatusAsync(const Model::DescribeTableRestoreStatusRequest& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the status of one or more table restore requests made using the
+         * <a>RestoreTableFromClusterSnapshot</a> API action. If you don't specify a value
+         * for the <code>TableRestoreRequestId</code> parameter, then
+         * <code>DescribeTableRestoreStatus</code> returns the status of all in-progress
+         * table restore requests. Otherwise <code>DescribeTableRestoreStatus</code>
+         * returns the status of the table specified by
+         * <code>TableRestoreRequestId</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTableRestoreStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTableRestoreStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTableRestoreStatusOutcome> DescribeTableRestoreStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTableRestoreStatusOutcome>([this, request](const std::function<void(Model::DescribeTableRestoreStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTableRestoreStatusAsync(request, [complete](const RedshiftClient*, const Model::DescribeTableRestoreStatusRequest&, const Model::DescribeTableRestoreStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTableRestoreStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns a list of tags. You can return tags from a specific resource by
          * specifying an ARN, or you can return all tags for a given type of resource, such
@@ -2162,6 +3354,41 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns a list of tags. You can return tags from a specific resource by
+         * specifying an ARN, or you can return all tags for a given type of resource, such
+         * as clusters, snapshots, and so on.</p> <p> The following are limitations for
+         * <code>DescribeTags</code>: <ul> <li>You cannot specify an ARN and a
+         * resource-type value together in the same request.</li> <li>You cannot use the
+         * <code>MaxRecords</code> and <code>Marker</code> parameters together with the ARN
+         * parameter.</li> <li>The <code>MaxRecords</code> parameter can be a range from 10
+         * to 50 results to return in a request.</li> </ul> </p> <p>If you specify both tag
+         * keys and tag values in the same request, Amazon Redshift returns all resources
+         * that match any combination of the specified keys and values. For example, if you
+         * have <code>owner</code> and <code>environment</code> for tag keys, and
+         * <code>admin</code> and <code>test</code> for tag values, all resources that have
+         * any combination of those values are returned.</p> <p>If both tag keys and values
+         * are omitted from the request, resources are returned regardless of whether they
+         * have tag keys or values associated with them.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTagsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTagsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTagsOutcome>([this, request](const std::function<void(Model::DescribeTagsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTagsAsync(request, [complete](const RedshiftClient*, const Model::DescribeTagsRequest&, const Model::DescribeTagsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTagsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Stops logging information, such as queries and connection attempts, for the
          * specified Amazon Redshift cluster.</p>
@@ -2184,6 +3411,28 @@ namespace Model
          */
         virtual void DisableLoggingAsync(const Model::DisableLoggingRequest& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Stops logging information, such as queries and connection attempts, for the
+         * specified Amazon Redshift cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableLoggingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableLoggingRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableLoggingOutcome> DisableLoggingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableLoggingOutcome>([this, request](const std::function<void(Model::DisableLoggingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableLoggingAsync(request, [complete](const RedshiftClient*, const Model::DisableLoggingRequest&, const Model::DisableLoggingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableLoggingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables the automatic copying of snapshots from one region to another region
          * for a specified cluster.</p> <p>If your cluster and its snapshots are encrypted
@@ -2215,6 +3464,31 @@ namespace Model
          */
         virtual void DisableSnapshotCopyAsync(const Model::DisableSnapshotCopyRequest& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables the automatic copying of snapshots from one region to another region
+         * for a specified cluster.</p> <p>If your cluster and its snapshots are encrypted
+         * using a customer master key (CMK) from AWS KMS, use
+         * <a>DeleteSnapshotCopyGrant</a> to delete the grant that grants Amazon Redshift
+         * permission to the CMK in the destination region. </p>
+         *
+         * Returns an awaitable that starts the operation the way DisableSnapshotCopyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableSnapshotCopyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableSnapshotCopyOutcome> DisableSnapshotCopyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableSnapshotCopyOutcome>([this, request](const std::function<void(Model::DisableSnapshotCopyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableSnapshotCopyAsync(request, [complete](const RedshiftClient*, const Model::DisableSnapshotCopyRequest&, const Model::DisableSnapshotCopyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableSnapshotCopyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts logging information, such as queries and connection attempts, for the
          * specified Amazon Redshift cluster.</p>
@@ -2237,6 +3511,28 @@ namespace Model
          */
         virtual void EnableLoggingAsync(const Model::EnableLoggingRequest& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts logging information, such as queries and connection attempts, for the
+         * specified Amazon Redshift cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableLoggingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableLoggingRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableLoggingOutcome> EnableLoggingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableLoggingOutcome>([this, request](const std::function<void(Model::EnableLoggingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableLoggingAsync(request, [complete](const RedshiftClient*, const Model::EnableLoggingRequest&, const Model::EnableLoggingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableLoggingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Enables the automatic copy of snapshots from one region to another region for
          * a specified cluster.</p>
@@ -2259,6 +3555,28 @@ namespace Model
          */
         virtual void EnableSnapshotCopyAsync(const Model::EnableSnapshotCopyRequest& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Enables the automatic copy of snapshots from one region to another region for
+         * a specified cluster.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableSnapshotCopyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableSnapshotCopyRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableSnapshotCopyOutcome> EnableSnapshotCopyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableSnapshotCopyOutcome>([this, request](const std::function<void(Model::EnableSnapshotCopyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableSnapshotCopyAsync(request, [complete](const RedshiftClient*, const Model::EnableSnapshotCopyRequest&, const Model::EnableSnapshotCopyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableSnapshotCopyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies the settings for a cluster. For example, you can add another
          * security or parameter group, update the preferred maintenance window, or change
@@ -2308,6 +3626,37 @@ namespace Model
          */
         virtual void ModifyClusterAsync(const Model::ModifyClusterRequest& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies the settings for a cluster. For example, you can add another
+         * security or parameter group, update the preferred maintenance window, or change
+         * the master user password. Resetting a cluster password or modifying the security
+         * groups associated with a cluster do not need a reboot. However, modifying a
+         * parameter group requires a reboot for parameters to take effect. For more
+         * information about managing clusters, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-clusters.html">Amazon
+         * Redshift Clusters</a> in the <i>Amazon Redshift Cluster Management Guide</i> .
+         * </p> <p>You can also change node type and the number of nodes to scale up or
+         * down the cluster. When resizing a cluster, you must specify both the number of
+         * nodes and the node type even if one of the parameters does not change.</p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyClusterOutcome> ModifyClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyClusterOutcome>([this, request](const std::function<void(Model::ModifyClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyClusterAsync(request, [complete](const RedshiftClient*, const Model::ModifyClusterRequest&, const Model::ModifyClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies the parameters of a parameter group. </p> <p> For more information
          * about parameters and parameter groups, go to <a
@@ -2339,6 +3688,31 @@ namespace Model
          */
         virtual void ModifyClusterParameterGroupAsync(const Model::ModifyClusterParameterGroupRequest& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies the parameters of a parameter group. </p> <p> For more information
+         * about parameters and parameter groups, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-parameter-groups.html">Amazon
+         * Redshift Parameter Groups</a> in the <i>Amazon Redshift Cluster Management
+         * Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyClusterParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyClusterParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyClusterParameterGroupOutcome> ModifyClusterParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyClusterParameterGroupOutcome>([this, request](const std::function<void(Model::ModifyClusterParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyClusterParameterGroupAsync(request, [complete](const RedshiftClient*, const Model::ModifyClusterParameterGroupRequest&, const Model::ModifyClusterParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyClusterParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies a cluster subnet group to include the specified list of VPC
          * subnets. The operation replaces the existing list of subnets with the new list
@@ -2364,6 +3738,29 @@ namespace Model
          */
         virtual void ModifyClusterSubnetGroupAsync(const Model::ModifyClusterSubnetGroupRequest& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies a cluster subnet group to include the specified list of VPC
+         * subnets. The operation replaces the existing list of subnets with the new list
+         * of subnets. </p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyClusterSubnetGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyClusterSubnetGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyClusterSubnetGroupOutcome> ModifyClusterSubnetGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyClusterSubnetGroupOutcome>([this, request](const std::function<void(Model::ModifyClusterSubnetGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyClusterSubnetGroupAsync(request, [complete](const RedshiftClient*, const Model::ModifyClusterSubnetGroupRequest&, const Model::ModifyClusterSubnetGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyClusterSubnetGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies an existing Amazon Redshift event notification subscription. </p>
          */
@@ -2383,6 +3780,27 @@ namespace Model
          */
         virtual void ModifyEventSubscriptionAsync(const Model::ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies an existing Amazon Redshift event notification subscription. </p>
+         *
+         * Returns an awaitable that starts the operation the way ModifyEventSubscriptionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifyEventSubscriptionRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifyEventSubscriptionOutcome> ModifyEventSubscriptionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifyEventSubscriptionOutcome>([this, request](const std::function<void(Model::ModifyEventSubscriptionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifyEventSubscriptionAsync(request, [complete](const RedshiftClient*, const Model::ModifyEventSubscriptionRequest&, const Model::ModifyEventSubscriptionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifyEventSubscriptionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Modifies the number of days to retain automated snapshots in the destination
          * region after they are copied from the source region. </p>
@@ -2405,6 +3823,28 @@ namespace Model
          */
         virtual void ModifySnapshotCopyRetentionPeriodAsync(const Model::ModifySnapshotCopyRetentionPeriodRequest& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Modifies the number of days to retain automated snapshots in the destination
+         * region after they are copied from the source region. </p>
+         *
+         * Returns an awaitable that starts the operation the way ModifySnapshotCopyRetentionPeriodAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ModifySnapshotCopyRetentionPeriodRequest>
+        Aws::Utils::Threading::Awaitable<Model::ModifySnapshotCopyRetentionPeriodOutcome> ModifySnapshotCopyRetentionPeriodAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ModifySnapshotCopyRetentionPeriodOutcome>([this, request](const std::function<void(Model::ModifySnapshotCopyRetentionPeriodOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ModifySnapshotCopyRetentionPeriodAsync(request, [complete](const RedshiftClient*, const Model::ModifySnapshotCopyRetentionPeriodRequest&, const Model::ModifySnapshotCopyRetentionPeriodOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ModifySnapshotCopyRetentionPeriodOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Allows you to purchase reserved nodes. Amazon Redshift offers a predefined
          * set of reserved node offerings. You can purchase one or more of the offerings.
@@ -2445,6 +3885,34 @@ namespace Model
          */
         virtual void PurchaseReservedNodeOfferingAsync(const Model::PurchaseReservedNodeOfferingRequest& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Allows you to purchase reserved nodes. Amazon Redshift offers a predefined
+         * set of reserved node offerings. You can purchase one or more of the offerings.
+         * You can call the <a>DescribeReservedNodeOfferings</a> API to obtain the
+         * available reserved node offerings. You can call this API by providing a specific
+         * reserved node offering and the number of nodes you want to reserve. </p> <p> For
+         * more information about reserved node offerings, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/purchase-reserved-node-instance.html">Purchasing
+         * Reserved Nodes</a> in the <i>Amazon Redshift Cluster Management Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way PurchaseReservedNodeOfferingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PurchaseReservedNodeOfferingRequest>
+        Aws::Utils::Threading::Awaitable<Model::PurchaseReservedNodeOfferingOutcome> PurchaseReservedNodeOfferingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PurchaseReservedNodeOfferingOutcome>([this, request](const std::function<void(Model::PurchaseReservedNodeOfferingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PurchaseReservedNodeOfferingAsync(request, [complete](const RedshiftClient*, const Model::PurchaseReservedNodeOfferingRequest&, const Model::PurchaseReservedNodeOfferingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PurchaseReservedNodeOfferingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Reboots a cluster. This action is taken as soon as possible. It results in a
          * momentary outage to the cluster, during which the cluster status is set to
@@ -2485,6 +3953,34 @@ namespace Model
          */
         virtual void RebootClusterAsync(const Model::RebootClusterRequest& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Reboots a cluster. This action is taken as soon as possible. It results in a
+         * momentary outage to the cluster, during which the cluster status is set to
+         * <code>rebooting</code>. A cluster event is created when the reboot is completed.
+         * Any pending cluster modifications (see <a>ModifyCluster</a>) are applied at this
+         * reboot. For more information about managing clusters, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-clusters.html">Amazon
+         * Redshift Clusters</a> in the <i>Amazon Redshift Cluster Management Guide</i>
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way RebootClusterAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RebootClusterRequest>
+        Aws::Utils::Threading::Awaitable<Model::RebootClusterOutcome> RebootClusterAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RebootClusterOutcome>([this, request](const std::function<void(Model::RebootClusterOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RebootClusterAsync(request, [complete](const RedshiftClient*, const Model::RebootClusterRequest&, const Model::RebootClusterOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RebootClusterOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Sets one or more parameters of the specified parameter group to their
          * default values and sets the source values of the parameters to "engine-default".
@@ -2516,6 +4012,31 @@ namespace Model
          */
         virtual void ResetClusterParameterGroupAsync(const Model::ResetClusterParameterGroupRequest& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Sets one or more parameters of the specified parameter group to their
+         * default values and sets the source values of the parameters to "engine-default".
+         * To reset the entire parameter group specify the <i>ResetAllParameters</i>
+         * parameter. For parameter changes to take effect you must reboot any associated
+         * clusters. </p>
+         *
+         * Returns an awaitable that starts the operation the way ResetClusterParameterGroupAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResetClusterParameterGroupRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResetClusterParameterGroupOutcome> ResetClusterParameterGroupAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResetClusterParameterGroupOutcome>([this, request](const std::function<void(Model::ResetClusterParameterGroupOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResetClusterParameterGroupAsync(request, [complete](const RedshiftClient*, const Model::ResetClusterParameterGroupRequest&, const Model::ResetClusterParameterGroupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResetClusterParameterGroupOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Creates a new cluster from a snapshot. By default, Amazon Redshift creates
          * the resulting cluster with the same configuration as the original cluster from
@@ -2571,6 +4092,39 @@ namespace Model
          */
         virtual void RestoreFromClusterSnapshotAsync(const Model::RestoreFromClusterSnapshotRequest& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Creates a new cluster from a snapshot. By default, Amazon Redshift creates
+         * the resulting cluster with the same configuration as the original cluster from
+         * which the snapshot was created, except that the new cluster is created with the
+         * default cluster security and parameter groups. After Amazon Redshift creates the
+         * cluster, you can use the <a>ModifyCluster</a> API to associate a different
+         * security group and different parameter group with the restored cluster. If you
+         * are using a DS node type, you can also choose to change to another DS node type
+         * of the same size during restore.</p> <p> If you restore a cluster into a VPC,
+         * you must provide a cluster subnet group where you want the cluster restored.
+         * </p> <p> For more information about working with snapshots, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-snapshots.html">Amazon
+         * Redshift Snapshots</a> in the <i>Amazon Redshift Cluster Management Guide</i>.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way RestoreFromClusterSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RestoreFromClusterSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::RestoreFromClusterSnapshotOutcome> RestoreFromClusterSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RestoreFromClusterSnapshotOutcome>([this, request](const std::function<void(Model::RestoreFromClusterSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RestoreFromClusterSnapshotAsync(request, [complete](const RedshiftClient*, const Model::RestoreFromClusterSnapshotRequest&, const Model::RestoreFromClusterSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RestoreFromClusterSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new table from a table in an Amazon Redshift cluster snapshot. You
          * must create the new table within the Amazon Redshift cluster that the snapshot
@@ -2623,6 +4177,38 @@ namespace Model
          */
         virtual void RestoreTableFromClusterSnapshotAsync(const Model::RestoreTableFromClusterSnapshotRequest& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new table from a table in an Amazon Redshift cluster snapshot. You
+         * must create the new table within the Amazon Redshift cluster that the snapshot
+         * was taken from.</p> <p>You cannot use
+         * <code>RestoreTableFromClusterSnapshot</code> to restore a table with the same
+         * name as an existing table in an Amazon Redshift cluster. That is, you cannot
+         * overwrite an existing table in a cluster with a restored table. If you want to
+         * replace your original table with a new, restored table, then rename or drop your
+         * original table before you call <code>RestoreTableFromClusterSnapshot</code>.
+         * When you have renamed your original table, then you can pass the original name
+         * of the table as the <code>NewTableName</code> parameter value in the call to
+         * <code>RestoreTableFromClusterSnapshot</code>. This way, you can replace the
+         * original table with the table created from the snapshot.</p>
+         *
+         * Returns an awaitable that starts the operation the way RestoreTableFromClusterSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RestoreTableFromClusterSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::RestoreTableFromClusterSnapshotOutcome> RestoreTableFromClusterSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RestoreTableFromClusterSnapshotOutcome>([this, request](const std::function<void(Model::RestoreTableFromClusterSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RestoreTableFromClusterSnapshotAsync(request, [complete](const RedshiftClient*, const Model::RestoreTableFromClusterSnapshotRequest&, const Model::RestoreTableFromClusterSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RestoreTableFromClusterSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Revokes an ingress rule in an Amazon Redshift security group for a
          * previously authorized IP range or Amazon EC2 security group. To add an ingress
@@ -2660,6 +4246,33 @@ namespace Model
          */
         virtual void RevokeClusterSecurityGroupIngressAsync(const Model::RevokeClusterSecurityGroupIngressRequest& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Revokes an ingress rule in an Amazon Redshift security group for a
+         * previously authorized IP range or Amazon EC2 security group. To add an ingress
+         * rule, see <a>AuthorizeClusterSecurityGroupIngress</a>. For information about
+         * managing security groups, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-security-groups.html">Amazon
+         * Redshift Cluster Security Groups</a> in the <i>Amazon Redshift Cluster
+         * Management Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way RevokeClusterSecurityGroupIngressAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RevokeClusterSecurityGroupIngressRequest>
+        Aws::Utils::Threading::Awaitable<Model::RevokeClusterSecurityGroupIngressOutcome> RevokeClusterSecurityGroupIngressAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RevokeClusterSecurityGroupIngressOutcome>([this, request](const std::function<void(Model::RevokeClusterSecurityGroupIngressOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RevokeClusterSecurityGroupIngressAsync(request, [complete](const RedshiftClient*, const Model::RevokeClusterSecurityGroupIngressRequest&, const Model::RevokeClusterSecurityGroupIngressOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RevokeClusterSecurityGroupIngressOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Removes the ability of the specified AWS customer account to restore the
          * specified snapshot. If the account is currently restoring the snapshot, the
@@ -2697,6 +4310,33 @@ namespace Model
          */
         virtual void RevokeSnapshotAccessAsync(const Model::RevokeSnapshotAccessRequest& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Removes the ability of the specified AWS customer account to restore the
+         * specified snapshot. If the account is currently restoring the snapshot, the
+         * restore will run to completion. </p> <p> For more information about working with
+         * snapshots, go to <a
+         * href="http://docs.aws.amazon.com/redshift/latest/mgmt/working-with-snapshots.html">Amazon
+         * Redshift Snapshots</a> in the <i>Amazon Redshift Cluster Management Guide</i>.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way RevokeSnapshotAccessAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RevokeSnapshotAccessRequest>
+        Aws::Utils::Threading::Awaitable<Model::RevokeSnapshotAccessOutcome> RevokeSnapshotAccessAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RevokeSnapshotAccessOutcome>([this, request](const std::function<void(Model::RevokeSnapshotAccessOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RevokeSnapshotAccessAsync(request, [complete](const RedshiftClient*, const Model::RevokeSnapshotAccessRequest&, const Model::RevokeSnapshotAccessOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RevokeSnapshotAccessOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Rotates the encryption keys for a cluster. </p>
          */
@@ -2716,6 +4356,27 @@ namespace Model
          */
         virtual void RotateEncryptionKeyAsync(const Model::RotateEncryptionKeyRequest& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Rotates the encryption keys for a cluster. </p>
+         *
+         * Returns an awaitable that starts the operation the way RotateEncryptionKeyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RotateEncryptionKeyRequest>
+        Aws::Utils::Threading::Awaitable<Model::RotateEncryptionKeyOutcome> RotateEncryptionKeyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RotateEncryptionKeyOutcome>([this, request](const std::function<void(Model::RotateEncryptionKeyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RotateEncryptionKeyAsync(request, [complete](const RedshiftClient*, const Model::RotateEncryptionKeyRequest&, const Model::RotateEncryptionKeyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RotateEncryptionKeyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -66,6 +66,7 @@
 #include <aws/route53/model/UpdateTrafficPolicyCommentResult.h>
 #include <aws/route53/model/UpdateTrafficPolicyInstanceResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -370,6 +371,36 @@ namespace Model
          */
         virtual void AssociateVPCWithHostedZoneAsync(const Model::AssociateVPCWithHostedZoneRequest& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This action associates a VPC with an hosted zone. </p> <p>To associate a VPC
+         * with an hosted zone, send a <code>POST</code> request to the <code>/<i>Route 53
+         * API version</i>/hostedzone/<i>hosted zone ID</i>/associatevpc</code> resource.
+         * The request body must include a document with a
+         * <code>AssociateVPCWithHostedZoneRequest</code> element. The response returns the
+         * <code>AssociateVPCWithHostedZoneResponse</code> element that contains
+         * <code>ChangeInfo</code> for you to track the progress of the
+         * <code>AssociateVPCWithHostedZoneRequest</code> you made. See
+         * <code>GetChange</code> operation for how to track the progress of your
+         * change.</p>
+         *
+         * Returns an awaitable that starts the operation the way AssociateVPCWithHostedZoneAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AssociateVPCWithHostedZoneRequest>
+        Aws::Utils::Threading::Awaitable<Model::AssociateVPCWithHostedZoneOutcome> AssociateVPCWithHostedZoneAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AssociateVPCWithHostedZoneOutcome>([this, request](const std::function<void(Model::AssociateVPCWithHostedZoneOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AssociateVPCWithHostedZoneAsync(request, [complete](const Route53Client*, const Model::AssociateVPCWithHostedZoneRequest&, const Model::AssociateVPCWithHostedZoneOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AssociateVPCWithHostedZoneOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Use this action to create or change your authoritative DNS information. To
          * use this action, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -455,6 +486,49 @@ namespace Model
          */
         virtual void ChangeResourceRecordSetsAsync(const Model::ChangeResourceRecordSetsRequest& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Use this action to create or change your authoritative DNS information. To
+         * use this action, send a <code>POST</code> request to the <code>/<i>Route 53 API
+         * version</i>/hostedzone/<i>hosted Zone ID</i>/rrset</code> resource. The request
+         * body must include a document with a <code>ChangeResourceRecordSetsRequest</code>
+         * element.</p> <p>Changes are a list of change items and are considered
+         * transactional. For more information on transactional changes, also known as
+         * change batches, see <a
+         * href="http://docs.aws.amazon.com/Route53/latest/APIReference/API_ChangeResourceRecordSets.html">POST
+         * ChangeResourceRecordSets</a> in the <i>Amazon Route 53 API Reference</i>.</p>
+         * <important>Due to the nature of transactional changes, you cannot delete the
+         * same resource record set more than once in a single change batch. If you attempt
+         * to delete the same change batch more than once, Amazon Route 53 returns an
+         * <code>InvalidChangeBatch</code> error.</important> <p>In response to a
+         * <code>ChangeResourceRecordSets</code> request, your DNS data is changed on all
+         * Amazon Route 53 DNS servers. Initially, the status of a change is
+         * <code>PENDING</code>. This means the change has not yet propagated to all the
+         * authoritative Amazon Route 53 DNS servers. When the change is propagated to all
+         * hosts, the change returns a status of <code>INSYNC</code>.</p> <p>Note the
+         * following limitations on a <code>ChangeResourceRecordSets</code> request:</p>
+         * <ul> <li>A request cannot contain more than 100 Change elements.</li> <li> A
+         * request cannot contain more than 1000 ResourceRecord elements.</li> <li>The sum
+         * of the number of characters (including spaces) in all <code>Value</code>
+         * elements in a request cannot exceed 32,000 characters.</li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way ChangeResourceRecordSetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ChangeResourceRecordSetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ChangeResourceRecordSetsOutcome> ChangeResourceRecordSetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ChangeResourceRecordSetsOutcome>([this, request](const std::function<void(Model::ChangeResourceRecordSetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ChangeResourceRecordSetsAsync(request, [complete](const Route53Client*, const Model::ChangeResourceRecordSetsRequest&, const Model::ChangeResourceRecordSetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ChangeResourceRecordSetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -474,6 +548,27 @@ namespace Model
          */
         virtual void ChangeTagsForResourceAsync(const Model::ChangeTagsForResourceRequest& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way ChangeTagsForResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ChangeTagsForResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ChangeTagsForResourceOutcome> ChangeTagsForResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ChangeTagsForResourceOutcome>([this, request](const std::function<void(Model::ChangeTagsForResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ChangeTagsForResourceAsync(request, [complete](const Route53Client*, const Model::ChangeTagsForResourceRequest&, const Model::ChangeTagsForResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ChangeTagsForResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This action creates a new health check.</p> <p>To create a new health check,
          * send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -508,6 +603,32 @@ namespace Model
          */
         virtual void CreateHealthCheckAsync(const Model::CreateHealthCheckRequest& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This action creates a new health check.</p> <p>To create a new health check,
+         * send a <code>POST</code> request to the <code>/<i>Route 53 API
+         * version</i>/healthcheck</code> resource. The request body must include a
+         * document with a <code>CreateHealthCheckRequest</code> element. The response
+         * returns the <code>CreateHealthCheckResponse</code> element that contains
+         * metadata about the health check.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateHealthCheckAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateHealthCheckRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateHealthCheckOutcome> CreateHealthCheckAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateHealthCheckOutcome>([this, request](const std::function<void(Model::CreateHealthCheckOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateHealthCheckAsync(request, [complete](const Route53Client*, const Model::CreateHealthCheckRequest&, const Model::CreateHealthCheckOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateHealthCheckOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This action creates a new hosted zone.</p> <p>To create a new hosted zone,
          * send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -578,6 +699,44 @@ namespace Model
          */
         virtual void CreateHostedZoneAsync(const Model::CreateHostedZoneRequest& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This action creates a new hosted zone.</p> <p>To create a new hosted zone,
+         * send a <code>POST</code> request to the <code>/<i>Route 53 API
+         * version</i>/hostedzone</code> resource. The request body must include a document
+         * with a <code>CreateHostedZoneRequest</code> element. The response returns the
+         * <code>CreateHostedZoneResponse</code> element that contains metadata about the
+         * hosted zone.</p> <p>Amazon Route 53 automatically creates a default SOA record
+         * and four NS records for the zone. The NS records in the hosted zone are the name
+         * servers you give your registrar to delegate your domain to. For more information
+         * about SOA and NS records, see <a
+         * href="http://docs.aws.amazon.com/Route53/latest/DeveloperGuide/SOA-NSrecords.html">NS
+         * and SOA Records that Amazon Route 53 Creates for a Hosted Zone</a> in the
+         * <i>Amazon Route 53 Developer Guide</i>.</p> <p>When you create a zone, its
+         * initial status is <code>PENDING</code>. This means that it is not yet available
+         * on all DNS servers. The status of the zone changes to <code>INSYNC</code> when
+         * the NS and SOA records are available on all Amazon Route 53 DNS servers. </p>
+         * <p>When trying to create a hosted zone using a reusable delegation set, you
+         * could specify an optional DelegationSetId, and Route53 would assign those 4 NS
+         * records for the zone, instead of alloting a new one.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateHostedZoneAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateHostedZoneRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateHostedZoneOutcome> CreateHostedZoneAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateHostedZoneOutcome>([this, request](const std::function<void(Model::CreateHostedZoneOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateHostedZoneAsync(request, [complete](const Route53Client*, const Model::CreateHostedZoneRequest&, const Model::CreateHostedZoneOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateHostedZoneOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This action creates a reusable delegationSet.</p> <p>To create a new reusable
          * delegationSet, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -618,6 +777,34 @@ namespace Model
          */
         virtual void CreateReusableDelegationSetAsync(const Model::CreateReusableDelegationSetRequest& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This action creates a reusable delegationSet.</p> <p>To create a new reusable
+         * delegationSet, send a <code>POST</code> request to the <code>/<i>Route 53 API
+         * version</i>/delegationset</code> resource. The request body must include a
+         * document with a <code>CreateReusableDelegationSetRequest</code> element. The
+         * response returns the <code>CreateReusableDelegationSetResponse</code> element
+         * that contains metadata about the delegationSet. </p> <p>If the optional
+         * parameter HostedZoneId is specified, it marks the delegationSet associated with
+         * that particular hosted zone as reusable. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateReusableDelegationSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateReusableDelegationSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateReusableDelegationSetOutcome> CreateReusableDelegationSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateReusableDelegationSetOutcome>([this, request](const std::function<void(Model::CreateReusableDelegationSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateReusableDelegationSetAsync(request, [complete](const Route53Client*, const Model::CreateReusableDelegationSetRequest&, const Model::CreateReusableDelegationSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateReusableDelegationSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a traffic policy, which you use to create multiple DNS resource
          * record sets for one domain name (such as example.com) or one subdomain name
@@ -658,6 +845,34 @@ namespace Model
          */
         virtual void CreateTrafficPolicyAsync(const Model::CreateTrafficPolicyRequest& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a traffic policy, which you use to create multiple DNS resource
+         * record sets for one domain name (such as example.com) or one subdomain name
+         * (such as www.example.com).</p> <p>To create a traffic policy, send a
+         * <code>POST</code> request to the <code>/<i>Route 53 API
+         * version</i>/trafficpolicy</code> resource. The request body must include a
+         * document with a <code>CreateTrafficPolicyRequest</code> element. The response
+         * includes the <code>CreateTrafficPolicyResponse</code> element, which contains
+         * information about the new traffic policy.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateTrafficPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTrafficPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTrafficPolicyOutcome> CreateTrafficPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTrafficPolicyOutcome>([this, request](const std::function<void(Model::CreateTrafficPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTrafficPolicyAsync(request, [complete](const Route53Client*, const Model::CreateTrafficPolicyRequest&, const Model::CreateTrafficPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTrafficPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates resource record sets in a specified hosted zone based on the settings
          * in a specified traffic policy version. In addition,
@@ -710,6 +925,38 @@ namespace Model
          */
         virtual void CreateTrafficPolicyInstanceAsync(const Model::CreateTrafficPolicyInstanceRequest& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates resource record sets in a specified hosted zone based on the settings
+         * in a specified traffic policy version. In addition,
+         * <code>CreateTrafficPolicyInstance</code> associates the resource record sets
+         * with a specified domain name (such as example.com) or subdomain name (such as
+         * www.example.com). Amazon Route 53 responds to DNS queries for the domain or
+         * subdomain name by using the resource record sets that
+         * <code>CreateTrafficPolicyInstance</code> created.</p> <p>To create a traffic
+         * policy instance, send a <code>POST</code> request to the <code>/<i>Route 53 API
+         * version</i>/trafficpolicyinstance</code> resource. The request body must include
+         * a document with a <code>CreateTrafficPolicyRequest</code> element. The response
+         * returns the <code>CreateTrafficPolicyInstanceResponse</code> element, which
+         * contains information about the traffic policy instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateTrafficPolicyInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTrafficPolicyInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTrafficPolicyInstanceOutcome> CreateTrafficPolicyInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTrafficPolicyInstanceOutcome>([this, request](const std::function<void(Model::CreateTrafficPolicyInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTrafficPolicyInstanceAsync(request, [complete](const Route53Client*, const Model::CreateTrafficPolicyInstanceRequest&, const Model::CreateTrafficPolicyInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTrafficPolicyInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new version of an existing traffic policy. When you create a new
          * version of a traffic policy, you specify the ID of the traffic policy that you
@@ -759,6 +1006,37 @@ namespace Model
          */
         virtual void CreateTrafficPolicyVersionAsync(const Model::CreateTrafficPolicyVersionRequest& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new version of an existing traffic policy. When you create a new
+         * version of a traffic policy, you specify the ID of the traffic policy that you
+         * want to update and a JSON-formatted document that describes the new version.</p>
+         * <p>You use traffic policies to create multiple DNS resource record sets for one
+         * domain name (such as example.com) or one subdomain name (such as
+         * www.example.com).</p> <p>To create a new version, send a <code>POST</code>
+         * request to the <code>/<i>Route 53 API version</i>/trafficpolicy/</code>
+         * resource. The request body includes a document with a
+         * <code>CreateTrafficPolicyVersionRequest</code> element. The response returns the
+         * <code>CreateTrafficPolicyVersionResponse</code> element, which contains
+         * information about the new version of the traffic policy.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateTrafficPolicyVersionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTrafficPolicyVersionRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTrafficPolicyVersionOutcome> CreateTrafficPolicyVersionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTrafficPolicyVersionOutcome>([this, request](const std::function<void(Model::CreateTrafficPolicyVersionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTrafficPolicyVersionAsync(request, [complete](const Route53Client*, const Model::CreateTrafficPolicyVersionRequest&, const Model::CreateTrafficPolicyVersionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTrafficPolicyVersionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This action deletes a health check. To delete a health check, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -805,6 +1083,36 @@ namespace Model
          */
         virtual void DeleteHealthCheckAsync(const Model::DeleteHealthCheckRequest& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This action deletes a health check. To delete a health check, send a
+         * <code>DELETE</code> request to the <code>/<i>Route 53 API
+         * version</i>/healthcheck/<i>health check ID</i></code> resource.</p> <important>
+         * You can delete a health check only if there are no resource record sets
+         * associated with this health check. If resource record sets are associated with
+         * this health check, you must disassociate them before you can delete your health
+         * check. If you try to delete a health check that is associated with resource
+         * record sets, Amazon Route 53 will deny your request with a
+         * <code>HealthCheckInUse</code> error. For information about disassociating the
+         * records from your health check, see <a>ChangeResourceRecordSets</a>.</important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteHealthCheckAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteHealthCheckRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteHealthCheckOutcome> DeleteHealthCheckAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteHealthCheckOutcome>([this, request](const std::function<void(Model::DeleteHealthCheckOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteHealthCheckAsync(request, [complete](const Route53Client*, const Model::DeleteHealthCheckRequest&, const Model::DeleteHealthCheckOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteHealthCheckOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This action deletes a hosted zone. To delete a hosted zone, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -860,6 +1168,39 @@ namespace Model
          */
         virtual void DeleteHostedZoneAsync(const Model::DeleteHostedZoneRequest& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This action deletes a hosted zone. To delete a hosted zone, send a
+         * <code>DELETE</code> request to the <code>/<i>Route 53 API
+         * version</i>/hostedzone/<i>hosted zone ID</i></code> resource.</p> <p>For more
+         * information about deleting a hosted zone, see <a
+         * href="http://docs.aws.amazon.com/Route53/latest/DeveloperGuide/DeleteHostedZone.html">Deleting
+         * a Hosted Zone</a> in the <i>Amazon Route 53 Developer Guide</i>.</p> <important>
+         * You can delete a hosted zone only if there are no resource record sets other
+         * than the default SOA record and NS resource record sets. If your hosted zone
+         * contains other resource record sets, you must delete them before you can delete
+         * your hosted zone. If you try to delete a hosted zone that contains other
+         * resource record sets, Amazon Route 53 will deny your request with a
+         * <code>HostedZoneNotEmpty</code> error. For information about deleting records
+         * from your hosted zone, see <a>ChangeResourceRecordSets</a>.</important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteHostedZoneAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteHostedZoneRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteHostedZoneOutcome> DeleteHostedZoneAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteHostedZoneOutcome>([this, request](const std::function<void(Model::DeleteHostedZoneOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteHostedZoneAsync(request, [complete](const Route53Client*, const Model::DeleteHostedZoneRequest&, const Model::DeleteHostedZoneOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteHostedZoneOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This action deletes a reusable delegation set. To delete a reusable
          * delegation set, send a <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -903,6 +1244,35 @@ namespace Model
          */
         virtual void DeleteReusableDelegationSetAsync(const Model::DeleteReusableDelegationSetRequest& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This action deletes a reusable delegation set. To delete a reusable
+         * delegation set, send a <code>DELETE</code> request to the <code>/<i>Route 53 API
+         * version</i>/delegationset/<i>delegation set ID</i></code> resource.</p>
+         * <important> You can delete a reusable delegation set only if there are no
+         * associated hosted zones. If your reusable delegation set contains associated
+         * hosted zones, you must delete them before you can delete your reusable
+         * delegation set. If you try to delete a reusable delegation set that contains
+         * associated hosted zones, Amazon Route 53 will deny your request with a
+         * <code>DelegationSetInUse</code> error.</important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteReusableDelegationSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteReusableDelegationSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteReusableDelegationSetOutcome> DeleteReusableDelegationSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteReusableDelegationSetOutcome>([this, request](const std::function<void(Model::DeleteReusableDelegationSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteReusableDelegationSetAsync(request, [complete](const Route53Client*, const Model::DeleteReusableDelegationSetRequest&, const Model::DeleteReusableDelegationSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteReusableDelegationSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a traffic policy. To delete a traffic policy, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -928,6 +1298,29 @@ namespace Model
          */
         virtual void DeleteTrafficPolicyAsync(const Model::DeleteTrafficPolicyRequest& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a traffic policy. To delete a traffic policy, send a
+         * <code>DELETE</code> request to the <code>/<i>Route 53 API
+         * version</i>/trafficpolicy</code> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTrafficPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTrafficPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTrafficPolicyOutcome> DeleteTrafficPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTrafficPolicyOutcome>([this, request](const std::function<void(Model::DeleteTrafficPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTrafficPolicyAsync(request, [complete](const Route53Client*, const Model::DeleteTrafficPolicyRequest&, const Model::DeleteTrafficPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTrafficPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a traffic policy instance and all of the resource record sets that
          * Amazon Route 53 created when you created the instance.</p> <p>To delete a
@@ -965,6 +1358,33 @@ namespace Model
          */
         virtual void DeleteTrafficPolicyInstanceAsync(const Model::DeleteTrafficPolicyInstanceRequest& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a traffic policy instance and all of the resource record sets that
+         * Amazon Route 53 created when you created the instance.</p> <p>To delete a
+         * traffic policy instance, send a <code>DELETE</code> request to the
+         * <code>/<i>Route 53 API version</i>/trafficpolicy/<i>traffic policy instance
+         * ID</i></code> resource.</p> <important>When you delete a traffic policy
+         * instance, Amazon Route 53 also deletes all of the resource record sets that were
+         * created when you created the traffic policy instance.</important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTrafficPolicyInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTrafficPolicyInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTrafficPolicyInstanceOutcome> DeleteTrafficPolicyInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTrafficPolicyInstanceOutcome>([this, request](const std::function<void(Model::DeleteTrafficPolicyInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTrafficPolicyInstanceAsync(request, [complete](const Route53Client*, const Model::DeleteTrafficPolicyInstanceRequest&, const Model::DeleteTrafficPolicyInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTrafficPolicyInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This action disassociates a VPC from an hosted zone. </p> <p>To disassociate
          * a VPC to a hosted zone, send a <code>POST</code> request to the <code>/<i>Route
@@ -1011,6 +1431,36 @@ namespace Model
          */
         virtual void DisassociateVPCFromHostedZoneAsync(const Model::DisassociateVPCFromHostedZoneRequest& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This action disassociates a VPC from an hosted zone. </p> <p>To disassociate
+         * a VPC to a hosted zone, send a <code>POST</code> request to the <code>/<i>Route
+         * 53 API version</i>/hostedzone/<i>hosted zone ID</i>/disassociatevpc</code>
+         * resource. The request body must include a document with a
+         * <code>DisassociateVPCFromHostedZoneRequest</code> element. The response returns
+         * the <code>DisassociateVPCFromHostedZoneResponse</code> element that contains
+         * <code>ChangeInfo</code> for you to track the progress of the
+         * <code>DisassociateVPCFromHostedZoneRequest</code> you made. See
+         * <code>GetChange</code> operation for how to track the progress of your
+         * change.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisassociateVPCFromHostedZoneAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisassociateVPCFromHostedZoneRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisassociateVPCFromHostedZoneOutcome> DisassociateVPCFromHostedZoneAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisassociateVPCFromHostedZoneOutcome>([this, request](const std::function<void(Model::DisassociateVPCFromHostedZoneOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisassociateVPCFromHostedZoneAsync(request, [complete](const Route53Client*, const Model::DisassociateVPCFromHostedZoneRequest&, const Model::DisassociateVPCFromHostedZoneOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisassociateVPCFromHostedZoneOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This action returns the current status of a change batch request. The status
          * is one of the following values:</p> <p>- <code>PENDING</code> indicates that the
@@ -1045,6 +1495,32 @@ namespace Model
          */
         virtual void GetChangeAsync(const Model::GetChangeRequest& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This action returns the current status of a change batch request. The status
+         * is one of the following values:</p> <p>- <code>PENDING</code> indicates that the
+         * changes in this request have not replicated to all Amazon Route 53 DNS servers.
+         * This is the initial status of all change batch requests.</p> <p>-
+         * <code>INSYNC</code> indicates that the changes have replicated to all Amazon
+         * Route 53 DNS servers. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetChangeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetChangeRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetChangeOutcome> GetChangeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetChangeOutcome>([this, request](const std::function<void(Model::GetChangeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetChangeAsync(request, [complete](const Route53Client*, const Model::GetChangeRequest&, const Model::GetChangeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetChangeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve a list of the IP ranges used by Amazon Route 53 health checkers
          * to check the health of your resources, send a <code>GET</code> request to the
@@ -1076,6 +1552,31 @@ namespace Model
          */
         virtual void GetCheckerIpRangesAsync(const Model::GetCheckerIpRangesRequest& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve a list of the IP ranges used by Amazon Route 53 health checkers
+         * to check the health of your resources, send a <code>GET</code> request to the
+         * <code>/<i>Route 53 API version</i>/checkeripranges</code> resource. You can use
+         * these IP addresses to configure router and firewall rules to allow health
+         * checkers to check the health of your resources.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetCheckerIpRangesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetCheckerIpRangesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetCheckerIpRangesOutcome> GetCheckerIpRangesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetCheckerIpRangesOutcome>([this, request](const std::function<void(Model::GetCheckerIpRangesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetCheckerIpRangesAsync(request, [complete](const Route53Client*, const Model::GetCheckerIpRangesRequest&, const Model::GetCheckerIpRangesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetCheckerIpRangesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve a single geo location, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/geolocation</code> resource with one of these
@@ -1101,6 +1602,29 @@ namespace Model
          */
         virtual void GetGeoLocationAsync(const Model::GetGeoLocationRequest& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve a single geo location, send a <code>GET</code> request to the
+         * <code>/<i>Route 53 API version</i>/geolocation</code> resource with one of these
+         * options: continentcode | countrycode | countrycode and subdivisioncode.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetGeoLocationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetGeoLocationRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetGeoLocationOutcome> GetGeoLocationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetGeoLocationOutcome>([this, request](const std::function<void(Model::GetGeoLocationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetGeoLocationAsync(request, [complete](const Route53Client*, const Model::GetGeoLocationRequest&, const Model::GetGeoLocationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetGeoLocationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve the health check, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/healthcheck/<i>health check ID</i></code>
@@ -1126,6 +1650,29 @@ namespace Model
          */
         virtual void GetHealthCheckAsync(const Model::GetHealthCheckRequest& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve the health check, send a <code>GET</code> request to the
+         * <code>/<i>Route 53 API version</i>/healthcheck/<i>health check ID</i></code>
+         * resource. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetHealthCheckAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetHealthCheckRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetHealthCheckOutcome> GetHealthCheckAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetHealthCheckOutcome>([this, request](const std::function<void(Model::GetHealthCheckOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetHealthCheckAsync(request, [complete](const Route53Client*, const Model::GetHealthCheckRequest&, const Model::GetHealthCheckOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetHealthCheckOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve a count of all your health checks, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/healthcheckcount</code>
@@ -1151,6 +1698,29 @@ namespace Model
          */
         virtual void GetHealthCheckCountAsync(const Model::GetHealthCheckCountRequest& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve a count of all your health checks, send a <code>GET</code>
+         * request to the <code>/<i>Route 53 API version</i>/healthcheckcount</code>
+         * resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetHealthCheckCountAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetHealthCheckCountRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetHealthCheckCountOutcome> GetHealthCheckCountAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetHealthCheckCountOutcome>([this, request](const std::function<void(Model::GetHealthCheckCountOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetHealthCheckCountAsync(request, [complete](const Route53Client*, const Model::GetHealthCheckCountRequest&, const Model::GetHealthCheckCountOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetHealthCheckCountOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>If you want to learn why a health check is currently failing or why it failed
          * most recently (if at all), you can get the failure reason for the most recent
@@ -1182,6 +1752,31 @@ namespace Model
          */
         virtual void GetHealthCheckLastFailureReasonAsync(const Model::GetHealthCheckLastFailureReasonRequest& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>If you want to learn why a health check is currently failing or why it failed
+         * most recently (if at all), you can get the failure reason for the most recent
+         * failure. Send a <code>GET</code> request to the <code>/<i>Route 53 API
+         * version</i>/healthcheck/<i>health check ID</i>/lastfailurereason</code>
+         * resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetHealthCheckLastFailureReasonAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetHealthCheckLastFailureReasonRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetHealthCheckLastFailureReasonOutcome> GetHealthCheckLastFailureReasonAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetHealthCheckLastFailureReasonOutcome>([this, request](const std::function<void(Model::GetHealthCheckLastFailureReasonOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetHealthCheckLastFailureReasonAsync(request, [complete](const Route53Client*, const Model::GetHealthCheckLastFailureReasonRequest&, const Model::GetHealthCheckLastFailureReasonOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetHealthCheckLastFailureReasonOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve the health check status, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/healthcheck/<i>health check
@@ -1210,6 +1805,30 @@ namespace Model
          */
         virtual void GetHealthCheckStatusAsync(const Model::GetHealthCheckStatusRequest& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve the health check status, send a <code>GET</code> request to the
+         * <code>/<i>Route 53 API version</i>/healthcheck/<i>health check
+         * ID</i>/status</code> resource. You can use this call to get a health check's
+         * current status. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetHealthCheckStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetHealthCheckStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetHealthCheckStatusOutcome> GetHealthCheckStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetHealthCheckStatusOutcome>([this, request](const std::function<void(Model::GetHealthCheckStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetHealthCheckStatusAsync(request, [complete](const Route53Client*, const Model::GetHealthCheckStatusRequest&, const Model::GetHealthCheckStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetHealthCheckStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve the delegation set for a hosted zone, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/hostedzone/<i>hosted zone
@@ -1238,6 +1857,30 @@ namespace Model
          */
         virtual void GetHostedZoneAsync(const Model::GetHostedZoneRequest& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve the delegation set for a hosted zone, send a <code>GET</code>
+         * request to the <code>/<i>Route 53 API version</i>/hostedzone/<i>hosted zone
+         * ID</i></code> resource. The delegation set is the four Amazon Route 53 name
+         * servers that were assigned to the hosted zone when you created it.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetHostedZoneAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetHostedZoneRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetHostedZoneOutcome> GetHostedZoneAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetHostedZoneOutcome>([this, request](const std::function<void(Model::GetHostedZoneOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetHostedZoneAsync(request, [complete](const Route53Client*, const Model::GetHostedZoneRequest&, const Model::GetHostedZoneOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetHostedZoneOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve a count of all your hosted zones, send a <code>GET</code> request
          * to the <code>/<i>Route 53 API version</i>/hostedzonecount</code> resource.</p>
@@ -1260,6 +1903,28 @@ namespace Model
          */
         virtual void GetHostedZoneCountAsync(const Model::GetHostedZoneCountRequest& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve a count of all your hosted zones, send a <code>GET</code> request
+         * to the <code>/<i>Route 53 API version</i>/hostedzonecount</code> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetHostedZoneCountAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetHostedZoneCountRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetHostedZoneCountOutcome> GetHostedZoneCountAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetHostedZoneCountOutcome>([this, request](const std::function<void(Model::GetHostedZoneCountOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetHostedZoneCountAsync(request, [complete](const Route53Client*, const Model::GetHostedZoneCountRequest&, const Model::GetHostedZoneCountOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetHostedZoneCountOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve the reusable delegation set, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/delegationset/<i>delegation set
@@ -1285,6 +1950,29 @@ namespace Model
          */
         virtual void GetReusableDelegationSetAsync(const Model::GetReusableDelegationSetRequest& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve the reusable delegation set, send a <code>GET</code> request to
+         * the <code>/<i>Route 53 API version</i>/delegationset/<i>delegation set
+         * ID</i></code> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetReusableDelegationSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetReusableDelegationSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetReusableDelegationSetOutcome> GetReusableDelegationSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetReusableDelegationSetOutcome>([this, request](const std::function<void(Model::GetReusableDelegationSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetReusableDelegationSetAsync(request, [complete](const Route53Client*, const Model::GetReusableDelegationSetRequest&, const Model::GetReusableDelegationSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetReusableDelegationSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a specific traffic policy version. To get the
          * information, send a <code>GET</code> request to the <code>/<i>Route 53 API
@@ -1310,6 +1998,29 @@ namespace Model
          */
         virtual void GetTrafficPolicyAsync(const Model::GetTrafficPolicyRequest& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a specific traffic policy version. To get the
+         * information, send a <code>GET</code> request to the <code>/<i>Route 53 API
+         * version</i>/trafficpolicy</code> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetTrafficPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetTrafficPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetTrafficPolicyOutcome> GetTrafficPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetTrafficPolicyOutcome>([this, request](const std::function<void(Model::GetTrafficPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetTrafficPolicyAsync(request, [complete](const Route53Client*, const Model::GetTrafficPolicyRequest&, const Model::GetTrafficPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetTrafficPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about a specified traffic policy instance.</p> <p>To get
          * information about the traffic policy instance, send a <code>GET</code> request
@@ -1350,6 +2061,34 @@ namespace Model
          */
         virtual void GetTrafficPolicyInstanceAsync(const Model::GetTrafficPolicyInstanceRequest& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about a specified traffic policy instance.</p> <p>To get
+         * information about the traffic policy instance, send a <code>GET</code> request
+         * to the <code>/<i>Route 53 API version</i>/trafficpolicyinstance</code>
+         * resource.</p> <note>After you submit a <code>CreateTrafficPolicyInstance</code>
+         * or an <code>UpdateTrafficPolicyInstance</code> request, there's a brief delay
+         * while Amazon Route 53 creates the resource record sets that are specified in the
+         * traffic policy definition. For more information, see the <a>State</a> response
+         * element. </note>
+         *
+         * Returns an awaitable that starts the operation the way GetTrafficPolicyInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetTrafficPolicyInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetTrafficPolicyInstanceOutcome> GetTrafficPolicyInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetTrafficPolicyInstanceOutcome>([this, request](const std::function<void(Model::GetTrafficPolicyInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetTrafficPolicyInstanceAsync(request, [complete](const Route53Client*, const Model::GetTrafficPolicyInstanceRequest&, const Model::GetTrafficPolicyInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetTrafficPolicyInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the number of traffic policy instances that are associated with the
          * current AWS account.</p> <p>To get the number of traffic policy instances, send
@@ -1378,6 +2117,30 @@ namespace Model
          */
         virtual void GetTrafficPolicyInstanceCountAsync(const Model::GetTrafficPolicyInstanceCountRequest& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the number of traffic policy instances that are associated with the
+         * current AWS account.</p> <p>To get the number of traffic policy instances, send
+         * a <code>GET</code> request to the <code>/<i>Route 53 API
+         * version</i>/trafficpolicyinstancecount</code> resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetTrafficPolicyInstanceCountAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetTrafficPolicyInstanceCountRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetTrafficPolicyInstanceCountOutcome> GetTrafficPolicyInstanceCountAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetTrafficPolicyInstanceCountOutcome>([this, request](const std::function<void(Model::GetTrafficPolicyInstanceCountOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetTrafficPolicyInstanceCountAsync(request, [complete](const Route53Client*, const Model::GetTrafficPolicyInstanceCountRequest&, const Model::GetTrafficPolicyInstanceCountOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetTrafficPolicyInstanceCountOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve a list of supported geo locations, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/geolocations</code> resource.
@@ -1433,6 +2196,39 @@ namespace Model
          */
         virtual void ListGeoLocationsAsync(const Model::ListGeoLocationsRequest& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve a list of supported geo locations, send a <code>GET</code>
+         * request to the <code>/<i>Route 53 API version</i>/geolocations</code> resource.
+         * The response to this request includes a <code>GeoLocationDetailsList</code>
+         * element with zero, one, or multiple <code>GeoLocationDetails</code> child
+         * elements. The list is sorted by country code, and then subdivision code,
+         * followed by continents at the end of the list. </p> <p>By default, the list of
+         * geo locations is displayed on a single page. You can control the length of the
+         * page that is displayed by using the <code>MaxItems</code> parameter. If the list
+         * is truncated, <code>IsTruncated</code> will be set to <i>true</i> and a
+         * combination of <code>NextContinentCode, NextCountryCode,
+         * NextSubdivisionCode</code> will be populated. You can pass these as parameters
+         * to <code>StartContinentCode, StartCountryCode, StartSubdivisionCode</code> to
+         * control the geo location that the list begins with. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListGeoLocationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListGeoLocationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListGeoLocationsOutcome> ListGeoLocationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListGeoLocationsOutcome>([this, request](const std::function<void(Model::ListGeoLocationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListGeoLocationsAsync(request, [complete](const Route53Client*, const Model::ListGeoLocationsRequest&, const Model::ListGeoLocationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListGeoLocationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve a list of your health checks, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/healthcheck</code> resource. The response
@@ -1479,6 +2275,36 @@ namespace Model
          */
         virtual void ListHealthChecksAsync(const Model::ListHealthChecksRequest& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve a list of your health checks, send a <code>GET</code> request to
+         * the <code>/<i>Route 53 API version</i>/healthcheck</code> resource. The response
+         * to this request includes a <code>HealthChecks</code> element with zero, one, or
+         * multiple <code>HealthCheck</code> child elements. By default, the list of health
+         * checks is displayed on a single page. You can control the length of the page
+         * that is displayed by using the <code>MaxItems</code> parameter. You can use the
+         * <code>Marker</code> parameter to control the health check that the list begins
+         * with. </p> <note> Amazon Route 53 returns a maximum of 100 items. If you set
+         * MaxItems to a value greater than 100, Amazon Route 53 returns only the first
+         * 100.</note>
+         *
+         * Returns an awaitable that starts the operation the way ListHealthChecksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListHealthChecksRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListHealthChecksOutcome> ListHealthChecksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListHealthChecksOutcome>([this, request](const std::function<void(Model::ListHealthChecksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListHealthChecksAsync(request, [complete](const Route53Client*, const Model::ListHealthChecksRequest&, const Model::ListHealthChecksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListHealthChecksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve a list of your hosted zones, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/hostedzone</code> resource. The response
@@ -1525,6 +2351,36 @@ namespace Model
          */
         virtual void ListHostedZonesAsync(const Model::ListHostedZonesRequest& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve a list of your hosted zones, send a <code>GET</code> request to
+         * the <code>/<i>Route 53 API version</i>/hostedzone</code> resource. The response
+         * to this request includes a <code>HostedZones</code> element with zero, one, or
+         * multiple <code>HostedZone</code> child elements. By default, the list of hosted
+         * zones is displayed on a single page. You can control the length of the page that
+         * is displayed by using the <code>MaxItems</code> parameter. You can use the
+         * <code>Marker</code> parameter to control the hosted zone that the list begins
+         * with. </p> <note> Amazon Route 53 returns a maximum of 100 items. If you set
+         * MaxItems to a value greater than 100, Amazon Route 53 returns only the first
+         * 100.</note>
+         *
+         * Returns an awaitable that starts the operation the way ListHostedZonesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListHostedZonesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListHostedZonesOutcome> ListHostedZonesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListHostedZonesOutcome>([this, request](const std::function<void(Model::ListHostedZonesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListHostedZonesAsync(request, [complete](const Route53Client*, const Model::ListHostedZonesRequest&, const Model::ListHostedZonesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListHostedZonesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To retrieve a list of your hosted zones in lexicographic order, send a
          * <code>GET</code> request to the <code>/<i>Route 53 API
@@ -1572,7 +2428,73 @@ namespace Model
          *
          * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
-        virtual void ListHostedZonesByNameAsync(const Model::ListHostedZonesByNameRequest& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        virtual void ListHostedZonesByNameAsync(const Model::ListHostedZonesByNameRequest& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve a list of your hosted zones in lexicographic order, send a
+         * <code>GET</code> request to the <code>/<i>Route 53 API
+         * version</i>/hostedzonesbyname</code> resource. The response to this request
+         * includes a <code>HostedZones</code> element with zero or more
+         * <code>HostedZone</code> child elements lexicographically ordered by DNS name. By
+         * default, the list of hosted zones is displayed on a single page. You can control
+         * the length of the page that is displayed by using the <code>MaxItems</code>
+         * parameter. You can use the <code>DNSName</code> and <code>HostedZoneId</code>
+         * parameters to control the hosted zone that the list begins with.</p> <note>
+         * Amazon Route 53 returns a maximum of 100 items. If you set MaxItems to a value
+         * greater than 100, Amazon Route 53 returns only the first 100.</note>
+         *
+         * Returns an awaitable that starts the operation the way ListHostedZonesByNameAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListHostedZonesByNameRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListHostedZonesByNameOutcome> ListHostedZonesByNameAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListHostedZonesByNameOutcome>([this, request](const std::function<void(Model::ListHostedZonesByNameOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListHostedZonesByNameAsync(request, [complete](const Route53Client*, const Model::ListHostedZonesByNameRequest&, const Model::ListHostedZonesByNameOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListHostedZonesByNameOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
+        /**
+         * <p>Imagine all the resource record sets in a zone listed out in front of you.
+         * Imagine them sorted lexicographically first by DNS name (with the labels
+         * reversed, like "com.amazon.www" for example), and secondarily, lexicographically
+         * by record type. This operation retrieves at most MaxItems resource record sets
+         * from this list, in order, starting at a position specified by the Name and Type
+         * arguments:</p> <ul> <li>If both Name and Type are omitted, this means start the
+         * results at the first RRSET in the HostedZone.</li> <li>If Name is specified but
+         * Type is omitted, this means start the results at the first RRSET in the list
+         * whose name is greater than or equal to Name. </li> <li>If both Name and Type are
+         * specified, this means start the results at the first RRSET in the list whose
+         * name is greater than or equal to Name and whose type is greater than or equal to
+         * Type.</li> <li>It is an error to specify the Type but not the Name.</li> </ul>
+         * <p>Use ListResourceRecordSets to retrieve a single known record set by
+         * specifying the record set's name and type, and setting MaxItems = 1</p> <p>To
+         * retrieve all the records in a HostedZone, first pause any processes making calls
+         * to ChangeResourceRecordSets. Initially call ListResourceRecordSets without a
+         * Name and Type to get the first page of record sets. For subsequent calls, set
+         * Name and Type to the NextName and NextType values returned by the previous
+         * response. </p> <p>In the presence of concurrent ChangeResourceRecordSets calls,
+         * there is no consistency of results across calls to ListResourceRecordSets. The
+         * only way to get a consistent multi-page snapshot of all RRSETs in a zone is to
+         * stop making changes while pagination is in progress.</p> <p>However, the results
+         * from ListResourceRecordSets are consistent within a page. If MakeChange calls
+         * are taking place concurrently, the result of each one will either be completely
+         * visible in your results or not at all. You will not see partial changes, or
+         * changes that do not ultimately succeed. (This follows from the fact that
+         * MakeChange is atomic) </p> <p>The results from ListResourceRecordSets are
+         * strongly consistent with ChangeResourceRecordSets. To be precise, if a single
+         * process makes a call to ChangeResourceRecordSets and receives a successful
+         * response, the effects of that change will be visible in a subsequent call to
+         * ListResourceRecordSets by that process.</p>
+         */
+        virtual Model::ListResourceRecordSetsOutcome ListResourceRecordSets(const Model::ListResourceRecordSetsRequest& request) const;
 
         /**
          * <p>Imagine all the resource record sets in a zone listed out in front of you.
@@ -1606,8 +2528,10 @@ namespace Model
          * process makes a call to ChangeResourceRecordSets and receives a successful
          * response, the effects of that change will be visible in a subsequent call to
          * ListResourceRecordSets by that process.</p>
+         *
+         * returns a future to the operation so that it can be executed in parallel to other requests.
          */
-        virtual Model::ListResourceRecordSetsOutcome ListResourceRecordSets(const Model::ListResourceRecordSetsRequest& request) const;
+        virtual Model::ListResourceRecordSetsOutcomeCallable ListResourceRecordSetsCallable(const Model::ListResourceRecordSetsRequest& request) const;
 
         /**
          * <p>Imagine all the resource record sets in a zone listed out in front of you.
@@ -1642,10 +2566,11 @@ namespace Model
          * response, the effects of that change will be visible in a subsequent call to
          * ListResourceRecordSets by that process.</p>
          *
-         * returns a future to the operation so that it can be executed in parallel to other requests.
+         * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
-        virtual Model::ListResourceRecordSetsOutcomeCallable ListResourceRecordSetsCallable(const Model::ListResourceRecordSetsRequest& request) const;
+        virtual void ListResourceRecordSetsAsync(const Model::ListResourceRecordSetsRequest& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
          * <p>Imagine all the resource record sets in a zone listed out in front of you.
          * Imagine them sorted lexicographically first by DNS name (with the labels
@@ -1679,9 +2604,22 @@ namespace Model
          * response, the effects of that change will be visible in a subsequent call to
          * ListResourceRecordSets by that process.</p>
          *
-         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         * Returns an awaitable that starts the operation the way ListResourceRecordSetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
          */
-        virtual void ListResourceRecordSetsAsync(const Model::ListResourceRecordSetsRequest& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        template<typename REQUEST = Model::ListResourceRecordSetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListResourceRecordSetsOutcome> ListResourceRecordSetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListResourceRecordSetsOutcome>([this, request](const std::function<void(Model::ListResourceRecordSetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListResourceRecordSetsAsync(request, [complete](const Route53Client*, const Model::ListResourceRecordSetsRequest&, const Model::ListResourceRecordSetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListResourceRecordSetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>To retrieve a list of your reusable delegation sets, send a <code>GET</code>
@@ -1729,6 +2667,36 @@ namespace Model
          */
         virtual void ListReusableDelegationSetsAsync(const Model::ListReusableDelegationSetsRequest& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To retrieve a list of your reusable delegation sets, send a <code>GET</code>
+         * request to the <code>/<i>Route 53 API version</i>/delegationset</code> resource.
+         * The response to this request includes a <code>DelegationSets</code> element with
+         * zero, one, or multiple <code>DelegationSet</code> child elements. By default,
+         * the list of delegation sets is displayed on a single page. You can control the
+         * length of the page that is displayed by using the <code>MaxItems</code>
+         * parameter. You can use the <code>Marker</code> parameter to control the
+         * delegation set that the list begins with. </p> <note> Amazon Route 53 returns a
+         * maximum of 100 items. If you set MaxItems to a value greater than 100, Amazon
+         * Route 53 returns only the first 100.</note>
+         *
+         * Returns an awaitable that starts the operation the way ListReusableDelegationSetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListReusableDelegationSetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListReusableDelegationSetsOutcome> ListReusableDelegationSetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListReusableDelegationSetsOutcome>([this, request](const std::function<void(Model::ListReusableDelegationSetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListReusableDelegationSetsAsync(request, [complete](const Route53Client*, const Model::ListReusableDelegationSetsRequest&, const Model::ListReusableDelegationSetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListReusableDelegationSetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -1748,6 +2716,27 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way ListTagsForResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsForResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome>([this, request](const std::function<void(Model::ListTagsForResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsForResourceAsync(request, [complete](const Route53Client*, const Model::ListTagsForResourceRequest&, const Model::ListTagsForResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsForResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * 
          */
@@ -1767,6 +2756,27 @@ namespace Model
          */
         virtual void ListTagsForResourcesAsync(const Model::ListTagsForResourcesRequest& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * 
+         *
+         * Returns an awaitable that starts the operation the way ListTagsForResourcesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsForResourcesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsForResourcesOutcome> ListTagsForResourcesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsForResourcesOutcome>([this, request](const std::function<void(Model::ListTagsForResourcesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsForResourcesAsync(request, [complete](const Route53Client*, const Model::ListTagsForResourcesRequest&, const Model::ListTagsForResourcesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsForResourcesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the latest version for every traffic policy that is
          * associated with the current AWS account. To get the information, send a
@@ -1855,6 +2865,50 @@ namespace Model
          */
         virtual void ListTrafficPoliciesAsync(const Model::ListTrafficPoliciesRequest& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the latest version for every traffic policy that is
+         * associated with the current AWS account. To get the information, send a
+         * <code>GET</code> request to the <code>/<i>Route 53 API
+         * version</i>/trafficpolicy</code> resource.</p> <p>Amazon Route 53 returns a
+         * maximum of 100 items in each response. If you have a lot of traffic policies,
+         * you can use the <code>maxitems</code> parameter to list them in groups of up to
+         * 100.</p> <p>The response includes three values that help you navigate from one
+         * group of <code>maxitems</code> traffic policies to the next:</p> <ul>
+         * <li><b>IsTruncated</b></li> <p>If the value of <code>IsTruncated</code> in the
+         * response is <code>true</code>, there are more traffic policies associated with
+         * the current AWS account.</p> <p>If <code>IsTruncated</code> is
+         * <code>false</code>, this response includes the last traffic policy that is
+         * associated with the current account.</p> <li><b>TrafficPolicyIdMarker</b></li>
+         * <p>If <code>IsTruncated</code> is <code>true</code>,
+         * <code>TrafficPolicyIdMarker</code> is the ID of the first traffic policy in the
+         * next group of <code>MaxItems</code> traffic policies. If you want to list more
+         * traffic policies, make another call to <code>ListTrafficPolicies</code>, and
+         * specify the value of the <code>TrafficPolicyIdMarker</code> element from the
+         * response in the <code>TrafficPolicyIdMarker</code> request parameter.</p> <p>If
+         * <code>IsTruncated</code> is <code>false</code>, the
+         * <code>TrafficPolicyIdMarker</code> element is omitted from the response.</p>
+         * <li><b>MaxItems</b></li> <p>The value that you specified for the
+         * <code>MaxItems</code> parameter in the request that produced the current
+         * response.</p> </ul>
+         *
+         * Returns an awaitable that starts the operation the way ListTrafficPoliciesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTrafficPoliciesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTrafficPoliciesOutcome> ListTrafficPoliciesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTrafficPoliciesOutcome>([this, request](const std::function<void(Model::ListTrafficPoliciesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTrafficPoliciesAsync(request, [complete](const Route53Client*, const Model::ListTrafficPoliciesRequest&, const Model::ListTrafficPoliciesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTrafficPoliciesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the traffic policy instances that you created by using
          * the current AWS account.</p> <note>After you submit an
@@ -1955,6 +3009,54 @@ namespace Model
          */
         virtual void ListTrafficPolicyInstancesAsync(const Model::ListTrafficPolicyInstancesRequest& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the traffic policy instances that you created by using
+         * the current AWS account.</p> <note>After you submit an
+         * <code>UpdateTrafficPolicyInstance</code> request, there's a brief delay while
+         * Amazon Route 53 creates the resource record sets that are specified in the
+         * traffic policy definition. For more information, see the <a>State</a> response
+         * element.</note> <p>To get information about the traffic policy instances that
+         * are associated with the current AWS account, send a <code>GET</code> request to
+         * the <code>/<i>Route 53 API version</i>/trafficpolicyinstance</code>
+         * resource.</p> <p>Amazon Route 53 returns a maximum of 100 items in each
+         * response. If you have a lot of traffic policy instances, you can use the
+         * <code>MaxItems</code> parameter to list them in groups of up to 100.</p> <p>The
+         * response includes five values that help you navigate from one group of
+         * <code>MaxItems</code> traffic policy instances to the next:</p> <ul>
+         * <li><b>IsTruncated</b></li> <p>If the value of <code>IsTruncated</code> in the
+         * response is <code>true</code>, there are more traffic policy instances
+         * associated with the current AWS account.</p> <p>If <code>IsTruncated</code> is
+         * <code>false</code>, this response includes the last traffic policy instance that
+         * is associated with the current account.</p> <li><b>MaxItems</b></li> <p>The
+         * value that you specified for the <code>MaxItems</code> parameter in the request
+         * that produced the current response.</p> <li><b>HostedZoneIdMarker</b>,
+         * <b>TrafficPolicyInstanceNameMarker</b>, and
+         * <b>TrafficPolicyInstanceTypeMarker</b></li> <p>If <code>IsTruncated</code> is
+         * <code>true</code>, these three values in the response represent the first
+         * traffic policy instance in the next group of <code>MaxItems</code> traffic
+         * policy instances. To list more traffic policy instances, make another call to
+         * <code>ListTrafficPolicyInstances</code>, and specify these values in the
+         * corresponding request parameters.</p> <p>If <code>IsTruncated</code> is
+         * <code>false</code>, all three elements are omitted from the response.</p> </ul>
+         *
+         * Returns an awaitable that starts the operation the way ListTrafficPolicyInstancesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTrafficPolicyInstancesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTrafficPolicyInstancesOutcome> ListTrafficPolicyInstancesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTrafficPolicyInstancesOutcome>([this, request](const std::function<void(Model::ListTrafficPolicyInstancesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTrafficPolicyInstancesAsync(request, [complete](const Route53Client*, const Model::ListTrafficPolicyInstancesRequest&, const Model::ListTrafficPolicyInstancesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTrafficPolicyInstancesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the traffic policy instances that you created in a
          * specified hosted zone.</p> <note>After you submit an
@@ -2055,6 +3157,54 @@ namespace Model
          */
         virtual void ListTrafficPolicyInstancesByHostedZoneAsync(const Model::ListTrafficPolicyInstancesByHostedZoneRequest& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the traffic policy instances that you created in a
+         * specified hosted zone.</p> <note>After you submit an
+         * <code>UpdateTrafficPolicyInstance</code> request, there's a brief delay while
+         * Amazon Route 53 creates the resource record sets that are specified in the
+         * traffic policy definition. For more information, see the <a>State</a> response
+         * element.</note> <p>To get information about the traffic policy instances that
+         * you created in a specified hosted zone, send a <code>GET</code> request to the
+         * <code>/<i>Route 53 API version</i>/trafficpolicyinstance</code> resource and
+         * include the ID of the hosted zone.</p> <p>Amazon Route 53 returns a maximum of
+         * 100 items in each response. If you have a lot of traffic policy instances, you
+         * can use the <code>MaxItems</code> parameter to list them in groups of up to
+         * 100.</p> <p>The response includes four values that help you navigate from one
+         * group of <code>MaxItems</code> traffic policy instances to the next:</p> <ul>
+         * <li><b>IsTruncated</b></li> <p>If the value of <code/>IsTruncated in the
+         * response is <code>true</code>, there are more traffic policy instances
+         * associated with the current AWS account.</p> <p>If <code>IsTruncated</code> is
+         * <code>false</code>, this response includes the last traffic policy instance that
+         * is associated with the current account.</p> <li><b>MaxItems</b></li> <p>The
+         * value that you specified for the <code>MaxItems</code> parameter in the request
+         * that produced the current response.</p>
+         * <li><b>TrafficPolicyInstanceNameMarker</b> and
+         * <b>TrafficPolicyInstanceTypeMarker</b></li> <p>If <code>IsTruncated</code> is
+         * <code>true</code>, these two values in the response represent the first traffic
+         * policy instance in the next group of <code>MaxItems</code> traffic policy
+         * instances. To list more traffic policy instances, make another call to
+         * <code>ListTrafficPolicyInstancesByHostedZone</code>, and specify these values in
+         * the corresponding request parameters.</p> <p>If <code>IsTruncated</code> is
+         * <code>false</code>, all three elements are omitted from the response.</p> </ul>
+         *
+         * Returns an awaitable that starts the operation the way ListTrafficPolicyInstancesByHostedZoneAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTrafficPolicyInstancesByHostedZoneRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTrafficPolicyInstancesByHostedZoneOutcome> ListTrafficPolicyInstancesByHostedZoneAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTrafficPolicyInstancesByHostedZoneOutcome>([this, request](const std::function<void(Model::ListTrafficPolicyInstancesByHostedZoneOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTrafficPolicyInstancesByHostedZoneAsync(request, [complete](const Route53Client*, const Model::ListTrafficPolicyInstancesByHostedZoneRequest&, const Model::ListTrafficPolicyInstancesByHostedZoneOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTrafficPolicyInstancesByHostedZoneOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about the traffic policy instances that you created by using
          * a specify traffic policy version.</p> <note>After you submit a
@@ -2164,6 +3314,57 @@ namespace Model
          */
         virtual void ListTrafficPolicyInstancesByPolicyAsync(const Model::ListTrafficPolicyInstancesByPolicyRequest& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about the traffic policy instances that you created by using
+         * a specify traffic policy version.</p> <note>After you submit a
+         * <code>CreateTrafficPolicyInstance</code> or an
+         * <code>UpdateTrafficPolicyInstance</code> request, there's a brief delay while
+         * Amazon Route 53 creates the resource record sets that are specified in the
+         * traffic policy definition. For more information, see the <a>State</a> response
+         * element.</note> <p>To get information about the traffic policy instances that
+         * you created by using a specify traffic policy version, send a <code>GET</code>
+         * request to the <code>/<i>Route 53 API version</i>/trafficpolicyinstance</code>
+         * resource and include the ID and version of the traffic policy.</p> <p>Amazon
+         * Route 53 returns a maximum of 100 items in each response. If you have a lot of
+         * traffic policy instances, you can use the <code>MaxItems</code> parameter to
+         * list them in groups of up to 100.</p> <p>The response includes five values that
+         * help you navigate from one group of <code>MaxItems</code> traffic policy
+         * instances to the next:</p> <ul> <li><b>IsTruncated</b> <p>If the value of
+         * <code>IsTruncated</code> in the response is <code>true</code>, there are more
+         * traffic policy instances associated with the specified traffic policy.</p> <p>If
+         * <code>IsTruncated</code> is <code>false</code>, this response includes the last
+         * traffic policy instance that is associated with the specified traffic
+         * policy.</p> </li> <li><b>MaxItems</b> <p>The value that you specified for the
+         * <code>MaxItems</code> parameter in the request that produced the current
+         * response.</p> </li> <li><b>HostedZoneIdMarker</b>,
+         * <b>TrafficPolicyInstanceNameMarker</b>, and
+         * <b>TrafficPolicyInstanceTypeMarker</b> <p>If <code>IsTruncated</code> is
+         * <code>true</code>, these values in the response represent the first traffic
+         * policy instance in the next group of <code>MaxItems</code> traffic policy
+         * instances. To list more traffic policy instances, make another call to
+         * <code>ListTrafficPolicyInstancesByPolicy</code>, and specify these values in the
+         * corresponding request parameters.</p> <p>If <code>IsTruncated</code> is
+         * <code>false</code>, all three elements are omitted from the response.</p> </li>
+         * </ul>
+         *
+         * Returns an awaitable that starts the operation the way ListTrafficPolicyInstancesByPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTrafficPolicyInstancesByPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTrafficPolicyInstancesByPolicyOutcome> ListTrafficPolicyInstancesByPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTrafficPolicyInstancesByPolicyOutcome>([this, request](const std::function<void(Model::ListTrafficPolicyInstancesByPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTrafficPolicyInstancesByPolicyAsync(request, [complete](const Route53Client*, const Model::ListTrafficPolicyInstancesByPolicyRequest&, const Model::ListTrafficPolicyInstancesByPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTrafficPolicyInstancesByPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets information about all of the versions for a specified traffic policy.
          * <code>ListTrafficPolicyVersions</code> lists only versions that have not been
@@ -2249,6 +3450,49 @@ namespace Model
          */
         virtual void ListTrafficPolicyVersionsAsync(const Model::ListTrafficPolicyVersionsRequest& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets information about all of the versions for a specified traffic policy.
+         * <code>ListTrafficPolicyVersions</code> lists only versions that have not been
+         * deleted.</p> <p>Amazon Route 53 returns a maximum of 100 items in each response.
+         * If you have a lot of traffic policies, you can use the <code>maxitems</code>
+         * parameter to list them in groups of up to 100.</p> <p>The response includes
+         * three values that help you navigate from one group of
+         * <code>maxitems</code>maxitems traffic policies to the next:</p> <ul>
+         * <li><b>IsTruncated</b></li> <p>If the value of <code>IsTruncated</code> in the
+         * response is <code>true</code>, there are more traffic policy versions associated
+         * with the specified traffic policy.</p> <p>If <code>IsTruncated</code> is
+         * <code>false</code>, this response includes the last traffic policy version that
+         * is associated with the specified traffic policy.</p>
+         * <li><b>TrafficPolicyVersionMarker</b></li> <p>The ID of the next traffic policy
+         * version that is associated with the current AWS account. If you want to list
+         * more traffic policies, make another call to
+         * <code>ListTrafficPolicyVersions</code>, and specify the value of the
+         * <code>TrafficPolicyVersionMarker</code> element in the
+         * <code>TrafficPolicyVersionMarker</code> request parameter.</p> <p>If
+         * <code>IsTruncated</code> is <code>false</code>, Amazon Route 53 omits the
+         * <code>TrafficPolicyVersionMarker</code> element from the response.</p>
+         * <li><b>MaxItems</b></li> <p>The value that you specified for the
+         * <code>MaxItems</code> parameter in the request that produced the current
+         * response.</p> </ul>
+         *
+         * Returns an awaitable that starts the operation the way ListTrafficPolicyVersionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTrafficPolicyVersionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTrafficPolicyVersionsOutcome> ListTrafficPolicyVersionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTrafficPolicyVersionsOutcome>([this, request](const std::function<void(Model::ListTrafficPolicyVersionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTrafficPolicyVersionsAsync(request, [complete](const Route53Client*, const Model::ListTrafficPolicyVersionsRequest&, const Model::ListTrafficPolicyVersionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTrafficPolicyVersionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This action updates an existing health check.</p> <p>To update a health
          * check, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -2283,6 +3527,32 @@ namespace Model
          */
         virtual void UpdateHealthCheckAsync(const Model::UpdateHealthCheckRequest& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This action updates an existing health check.</p> <p>To update a health
+         * check, send a <code>POST</code> request to the <code>/<i>Route 53 API
+         * version</i>/healthcheck/<i>health check ID</i></code> resource. The request body
+         * must include a document with an <code>UpdateHealthCheckRequest</code> element.
+         * The response returns an <code>UpdateHealthCheckResponse</code> element, which
+         * contains metadata about the health check.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateHealthCheckAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateHealthCheckRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateHealthCheckOutcome> UpdateHealthCheckAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateHealthCheckOutcome>([this, request](const std::function<void(Model::UpdateHealthCheckOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateHealthCheckAsync(request, [complete](const Route53Client*, const Model::UpdateHealthCheckRequest&, const Model::UpdateHealthCheckOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateHealthCheckOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>To update the hosted zone comment, send a <code>POST</code> request to the
          * <code>/<i>Route 53 API version</i>/hostedzone/<i>hosted zone ID</i></code>
@@ -2317,6 +3587,32 @@ namespace Model
          */
         virtual void UpdateHostedZoneCommentAsync(const Model::UpdateHostedZoneCommentRequest& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>To update the hosted zone comment, send a <code>POST</code> request to the
+         * <code>/<i>Route 53 API version</i>/hostedzone/<i>hosted zone ID</i></code>
+         * resource. The request body must include a document with a
+         * <code>UpdateHostedZoneCommentRequest</code> element. The response to this
+         * request includes the modified <code>HostedZone</code> element.</p> <note> The
+         * comment can have a maximum length of 256 characters.</note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateHostedZoneCommentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateHostedZoneCommentRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateHostedZoneCommentOutcome> UpdateHostedZoneCommentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateHostedZoneCommentOutcome>([this, request](const std::function<void(Model::UpdateHostedZoneCommentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateHostedZoneCommentAsync(request, [complete](const Route53Client*, const Model::UpdateHostedZoneCommentRequest&, const Model::UpdateHostedZoneCommentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateHostedZoneCommentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the comment for a specified traffic policy version.</p> <p>To update
          * the comment, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -2345,6 +3641,30 @@ namespace Model
          */
         virtual void UpdateTrafficPolicyCommentAsync(const Model::UpdateTrafficPolicyCommentRequest& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the comment for a specified traffic policy version.</p> <p>To update
+         * the comment, send a <code>POST</code> request to the <code>/<i>Route 53 API
+         * version</i>/trafficpolicy/</code> resource.</p> <p>The request body must include
+         * a document with an <code>UpdateTrafficPolicyCommentRequest</code> element.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateTrafficPolicyCommentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateTrafficPolicyCommentRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateTrafficPolicyCommentOutcome> UpdateTrafficPolicyCommentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateTrafficPolicyCommentOutcome>([this, request](const std::function<void(Model::UpdateTrafficPolicyCommentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateTrafficPolicyCommentAsync(request, [complete](const Route53Client*, const Model::UpdateTrafficPolicyCommentRequest&, const Model::UpdateTrafficPolicyCommentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateTrafficPolicyCommentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the resource record sets in a specified hosted zone that were created
          * based on the settings in a specified traffic policy version.</p> <important>The
@@ -2424,6 +3744,47 @@ namespace Model
          */
         virtual void UpdateTrafficPolicyInstanceAsync(const Model::UpdateTrafficPolicyInstanceRequest& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the resource record sets in a specified hosted zone that were created
+         * based on the settings in a specified traffic policy version.</p> <important>The
+         * DNS type of the resource record sets that you're updating must match the DNS
+         * type in the JSON document that is associated with the traffic policy version
+         * that you're using to update the traffic policy instance.</important> <p>When you
+         * update a traffic policy instance, Amazon Route 53 continues to respond to DNS
+         * queries for the root resource record set name (such as example.com) while it
+         * replaces one group of resource record sets with another. Amazon Route 53
+         * performs the following operations:</p> <ol> <li>Amazon Route 53 creates a new
+         * group of resource record sets based on the specified traffic policy. This is
+         * true regardless of how substantial the differences are between the existing
+         * resource record sets and the new resource record sets. </li> <li>When all of the
+         * new resource record sets have been created, Amazon Route 53 starts to respond to
+         * DNS queries for the root resource record set name (such as example.com) by using
+         * the new resource record sets.</li> <li>Amazon Route 53 deletes the old group of
+         * resource record sets that are associated with the root resource record set
+         * name.</li> </ol> <p>To update a traffic policy instance, send a
+         * <code>POST</code> request to the <code>/<i>Route 53 API
+         * version</i>/trafficpolicyinstance/<i>traffic policy ID</i></code> resource. The
+         * request body must include a document with an
+         * <code>UpdateTrafficPolicyInstanceRequest</code> element.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateTrafficPolicyInstanceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateTrafficPolicyInstanceRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateTrafficPolicyInstanceOutcome> UpdateTrafficPolicyInstanceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateTrafficPolicyInstanceOutcome>([this, request](const std::function<void(Model::UpdateTrafficPolicyInstanceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateTrafficPolicyInstanceAsync(request, [complete](const Route53Client*, const Model::UpdateTrafficPolicyInstanceRequest&, const Model::UpdateTrafficPolicyInstanceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateTrafficPolicyInstanceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -141,7 +141,7 @@ AssociateVPCWithHostedZoneOutcome Route53Client::AssociateVPCWithHostedZone(cons
   ss << m_uri << "/2013-04-01/hostedzone/";
   ss << request.GetHostedZoneId();
   ss << "/associatevpc";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "AssociateVPCWithHostedZone");
   if(outcome.IsSuccess())
   {
     return AssociateVPCWithHostedZoneOutcome(AssociateVPCWithHostedZoneResult(outcome.GetResult()));
@@ -154,17 +154,43 @@ AssociateVPCWithHostedZoneOutcome Route53Client::AssociateVPCWithHostedZone(cons
 
 AssociateVPCWithHostedZoneOutcomeCallable Route53Client::AssociateVPCWithHostedZoneCallable(const AssociateVPCWithHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::AssociateVPCWithHostedZone, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AssociateVPCWithHostedZoneOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AssociateVPCWithHostedZone( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< AssociateVPCWithHostedZoneOutcome > rejected;
+    rejected.set_value(AssociateVPCWithHostedZoneOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::AssociateVPCWithHostedZoneAsync(const AssociateVPCWithHostedZoneRequest& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::AssociateVPCWithHostedZoneAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::AssociateVPCWithHostedZoneAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, AssociateVPCWithHostedZoneOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::AssociateVPCWithHostedZoneAsyncHelper(const AssociateVPCWithHostedZoneRequest& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, AssociateVPCWithHostedZone(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzone/";
+  ss << request.GetHostedZoneId();
+  ss << "/associatevpc";
+  auto sharedRequest = Aws::MakeShared<AssociateVPCWithHostedZoneRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "AssociateVPCWithHostedZone", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AssociateVPCWithHostedZoneOutcome(AssociateVPCWithHostedZoneResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AssociateVPCWithHostedZoneOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ChangeResourceRecordSetsOutcome Route53Client::ChangeResourceRecordSets(const ChangeResourceRecordSetsRequest& request) const
@@ -173,7 +199,7 @@ ChangeResourceRecordSetsOutcome Route53Client::ChangeResourceRecordSets(const Ch
   ss << m_uri << "/2013-04-01/hostedzone/";
   ss << request.GetHostedZoneId();
   ss << "/rrset/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ChangeResourceRecordSets");
   if(outcome.IsSuccess())
   {
     return ChangeResourceRecordSetsOutcome(ChangeResourceRecordSetsResult(outcome.GetResult()));
@@ -186,17 +212,43 @@ ChangeResourceRecordSetsOutcome Route53Client::ChangeResourceRecordSets(const Ch
 
 ChangeResourceRecordSetsOutcomeCallable Route53Client::ChangeResourceRecordSetsCallable(const ChangeResourceRecordSetsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ChangeResourceRecordSets, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ChangeResourceRecordSetsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ChangeResourceRecordSets( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ChangeResourceRecordSetsOutcome > rejected;
+    rejected.set_value(ChangeResourceRecordSetsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ChangeResourceRecordSetsAsync(const ChangeResourceRecordSetsRequest& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ChangeResourceRecordSetsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ChangeResourceRecordSetsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ChangeResourceRecordSetsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ChangeResourceRecordSetsAsyncHelper(const ChangeResourceRecordSetsRequest& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ChangeResourceRecordSets(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzone/";
+  ss << request.GetHostedZoneId();
+  ss << "/rrset/";
+  auto sharedRequest = Aws::MakeShared<ChangeResourceRecordSetsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ChangeResourceRecordSets", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ChangeResourceRecordSetsOutcome(ChangeResourceRecordSetsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ChangeResourceRecordSetsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ChangeTagsForResourceOutcome Route53Client::ChangeTagsForResource(const ChangeTagsForResourceRequest& request) const
@@ -206,7 +258,7 @@ ChangeTagsForResourceOutcome Route53Client::ChangeTagsForResource(const ChangeTa
   ss << TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType());
   ss << "/";
   ss << request.GetResourceId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ChangeTagsForResource");
   if(outcome.IsSuccess())
   {
     return ChangeTagsForResourceOutcome(ChangeTagsForResourceResult(outcome.GetResult()));
@@ -219,24 +271,51 @@ ChangeTagsForResourceOutcome Route53Client::ChangeTagsForResource(const ChangeTa
 
 ChangeTagsForResourceOutcomeCallable Route53Client::ChangeTagsForResourceCallable(const ChangeTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ChangeTagsForResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ChangeTagsForResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ChangeTagsForResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ChangeTagsForResourceOutcome > rejected;
+    rejected.set_value(ChangeTagsForResourceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ChangeTagsForResourceAsync(const ChangeTagsForResourceRequest& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ChangeTagsForResourceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ChangeTagsForResourceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ChangeTagsForResourceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ChangeTagsForResourceAsyncHelper(const ChangeTagsForResourceRequest& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ChangeTagsForResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/tags/";
+  ss << TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType());
+  ss << "/";
+  ss << request.GetResourceId();
+  auto sharedRequest = Aws::MakeShared<ChangeTagsForResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ChangeTagsForResource", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ChangeTagsForResourceOutcome(ChangeTagsForResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ChangeTagsForResourceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateHealthCheckOutcome Route53Client::CreateHealthCheck(const CreateHealthCheckRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/healthcheck";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateHealthCheck");
   if(outcome.IsSuccess())
   {
     return CreateHealthCheckOutcome(CreateHealthCheckResult(outcome.GetResult()));
@@ -249,24 +328,48 @@ CreateHealthCheckOutcome Route53Client::CreateHealthCheck(const CreateHealthChec
 
 CreateHealthCheckOutcomeCallable Route53Client::CreateHealthCheckCallable(const CreateHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateHealthCheck, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateHealthCheckOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateHealthCheck( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateHealthCheckOutcome > rejected;
+    rejected.set_value(CreateHealthCheckOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::CreateHealthCheckAsync(const CreateHealthCheckRequest& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateHealthCheckAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::CreateHealthCheckAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateHealthCheckOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::CreateHealthCheckAsyncHelper(const CreateHealthCheckRequest& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateHealthCheck(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/healthcheck";
+  auto sharedRequest = Aws::MakeShared<CreateHealthCheckRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateHealthCheck", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateHealthCheckOutcome(CreateHealthCheckResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateHealthCheckOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateHostedZoneOutcome Route53Client::CreateHostedZone(const CreateHostedZoneRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/hostedzone";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateHostedZone");
   if(outcome.IsSuccess())
   {
     return CreateHostedZoneOutcome(CreateHostedZoneResult(outcome.GetResult()));
@@ -279,24 +382,48 @@ CreateHostedZoneOutcome Route53Client::CreateHostedZone(const CreateHostedZoneRe
 
 CreateHostedZoneOutcomeCallable Route53Client::CreateHostedZoneCallable(const CreateHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateHostedZone, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateHostedZoneOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateHostedZone( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateHostedZoneOutcome > rejected;
+    rejected.set_value(CreateHostedZoneOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::CreateHostedZoneAsync(const CreateHostedZoneRequest& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateHostedZoneAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::CreateHostedZoneAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateHostedZoneOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::CreateHostedZoneAsyncHelper(const CreateHostedZoneRequest& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateHostedZone(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzone";
+  auto sharedRequest = Aws::MakeShared<CreateHostedZoneRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateHostedZone", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateHostedZoneOutcome(CreateHostedZoneResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateHostedZoneOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateReusableDelegationSetOutcome Route53Client::CreateReusableDelegationSet(const CreateReusableDelegationSetRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/delegationset";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateReusableDelegationSet");
   if(outcome.IsSuccess())
   {
     return CreateReusableDelegationSetOutcome(CreateReusableDelegationSetResult(outcome.GetResult()));
@@ -309,24 +436,48 @@ CreateReusableDelegationSetOutcome Route53Client::CreateReusableDelegationSet(co
 
 CreateReusableDelegationSetOutcomeCallable Route53Client::CreateReusableDelegationSetCallable(const CreateReusableDelegationSetRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateReusableDelegationSet, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateReusableDelegationSetOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateReusableDelegationSet( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateReusableDelegationSetOutcome > rejected;
+    rejected.set_value(CreateReusableDelegationSetOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::CreateReusableDelegationSetAsync(const CreateReusableDelegationSetRequest& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateReusableDelegationSetAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::CreateReusableDelegationSetAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateReusableDelegationSetOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::CreateReusableDelegationSetAsyncHelper(const CreateReusableDelegationSetRequest& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateReusableDelegationSet(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/delegationset";
+  auto sharedRequest = Aws::MakeShared<CreateReusableDelegationSetRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateReusableDelegationSet", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateReusableDelegationSetOutcome(CreateReusableDelegationSetResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateReusableDelegationSetOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateTrafficPolicyOutcome Route53Client::CreateTrafficPolicy(const CreateTrafficPolicyRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicy";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateTrafficPolicy");
   if(outcome.IsSuccess())
   {
     return CreateTrafficPolicyOutcome(CreateTrafficPolicyResult(outcome.GetResult()));
@@ -339,24 +490,48 @@ CreateTrafficPolicyOutcome Route53Client::CreateTrafficPolicy(const CreateTraffi
 
 CreateTrafficPolicyOutcomeCallable Route53Client::CreateTrafficPolicyCallable(const CreateTrafficPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateTrafficPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateTrafficPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateTrafficPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateTrafficPolicyOutcome > rejected;
+    rejected.set_value(CreateTrafficPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::CreateTrafficPolicyAsync(const CreateTrafficPolicyRequest& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateTrafficPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::CreateTrafficPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateTrafficPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::CreateTrafficPolicyAsyncHelper(const CreateTrafficPolicyRequest& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateTrafficPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicy";
+  auto sharedRequest = Aws::MakeShared<CreateTrafficPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateTrafficPolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateTrafficPolicyOutcome(CreateTrafficPolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateTrafficPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateTrafficPolicyInstanceOutcome Route53Client::CreateTrafficPolicyInstance(const CreateTrafficPolicyInstanceRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicyinstance";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateTrafficPolicyInstance");
   if(outcome.IsSuccess())
   {
     return CreateTrafficPolicyInstanceOutcome(CreateTrafficPolicyInstanceResult(outcome.GetResult()));
@@ -369,17 +544,41 @@ CreateTrafficPolicyInstanceOutcome Route53Client::CreateTrafficPolicyInstance(co
 
 CreateTrafficPolicyInstanceOutcomeCallable Route53Client::CreateTrafficPolicyInstanceCallable(const CreateTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateTrafficPolicyInstance, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateTrafficPolicyInstanceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateTrafficPolicyInstance( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateTrafficPolicyInstanceOutcome > rejected;
+    rejected.set_value(CreateTrafficPolicyInstanceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::CreateTrafficPolicyInstanceAsync(const CreateTrafficPolicyInstanceRequest& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateTrafficPolicyInstanceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::CreateTrafficPolicyInstanceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateTrafficPolicyInstanceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::CreateTrafficPolicyInstanceAsyncHelper(const CreateTrafficPolicyInstanceRequest& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateTrafficPolicyInstance(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicyinstance";
+  auto sharedRequest = Aws::MakeShared<CreateTrafficPolicyInstanceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateTrafficPolicyInstance", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateTrafficPolicyInstanceOutcome(CreateTrafficPolicyInstanceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateTrafficPolicyInstanceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateTrafficPolicyVersionOutcome Route53Client::CreateTrafficPolicyVersion(const CreateTrafficPolicyVersionRequest& request) const
@@ -387,7 +586,7 @@ CreateTrafficPolicyVersionOutcome Route53Client::CreateTrafficPolicyVersion(cons
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicy/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateTrafficPolicyVersion");
   if(outcome.IsSuccess())
   {
     return CreateTrafficPolicyVersionOutcome(CreateTrafficPolicyVersionResult(outcome.GetResult()));
@@ -400,17 +599,42 @@ CreateTrafficPolicyVersionOutcome Route53Client::CreateTrafficPolicyVersion(cons
 
 CreateTrafficPolicyVersionOutcomeCallable Route53Client::CreateTrafficPolicyVersionCallable(const CreateTrafficPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateTrafficPolicyVersion, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateTrafficPolicyVersionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateTrafficPolicyVersion( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateTrafficPolicyVersionOutcome > rejected;
+    rejected.set_value(CreateTrafficPolicyVersionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::CreateTrafficPolicyVersionAsync(const CreateTrafficPolicyVersionRequest& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateTrafficPolicyVersionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::CreateTrafficPolicyVersionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateTrafficPolicyVersionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::CreateTrafficPolicyVersionAsyncHelper(const CreateTrafficPolicyVersionRequest& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateTrafficPolicyVersion(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicy/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<CreateTrafficPolicyVersionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateTrafficPolicyVersion", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateTrafficPolicyVersionOutcome(CreateTrafficPolicyVersionResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateTrafficPolicyVersionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteHealthCheckOutcome Route53Client::DeleteHealthCheck(const DeleteHealthCheckRequest& request) const
@@ -418,7 +642,7 @@ DeleteHealthCheckOutcome Route53Client::DeleteHealthCheck(const DeleteHealthChec
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/healthcheck/";
   ss << request.GetHealthCheckId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteHealthCheck");
   if(outcome.IsSuccess())
   {
     return DeleteHealthCheckOutcome(DeleteHealthCheckResult(outcome.GetResult()));
@@ -431,17 +655,42 @@ DeleteHealthCheckOutcome Route53Client::DeleteHealthCheck(const DeleteHealthChec
 
 DeleteHealthCheckOutcomeCallable Route53Client::DeleteHealthCheckCallable(const DeleteHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DeleteHealthCheck, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteHealthCheckOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteHealthCheck( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteHealthCheckOutcome > rejected;
+    rejected.set_value(DeleteHealthCheckOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::DeleteHealthCheckAsync(const DeleteHealthCheckRequest& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DeleteHealthCheckAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::DeleteHealthCheckAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteHealthCheckOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::DeleteHealthCheckAsyncHelper(const DeleteHealthCheckRequest& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteHealthCheck(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/healthcheck/";
+  ss << request.GetHealthCheckId();
+  auto sharedRequest = Aws::MakeShared<DeleteHealthCheckRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteHealthCheck", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteHealthCheckOutcome(DeleteHealthCheckResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteHealthCheckOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteHostedZoneOutcome Route53Client::DeleteHostedZone(const DeleteHostedZoneRequest& request) const
@@ -449,7 +698,7 @@ DeleteHostedZoneOutcome Route53Client::DeleteHostedZone(const DeleteHostedZoneRe
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/hostedzone/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteHostedZone");
   if(outcome.IsSuccess())
   {
     return DeleteHostedZoneOutcome(DeleteHostedZoneResult(outcome.GetResult()));
@@ -462,17 +711,42 @@ DeleteHostedZoneOutcome Route53Client::DeleteHostedZone(const DeleteHostedZoneRe
 
 DeleteHostedZoneOutcomeCallable Route53Client::DeleteHostedZoneCallable(const DeleteHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DeleteHostedZone, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteHostedZoneOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteHostedZone( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteHostedZoneOutcome > rejected;
+    rejected.set_value(DeleteHostedZoneOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::DeleteHostedZoneAsync(const DeleteHostedZoneRequest& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DeleteHostedZoneAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::DeleteHostedZoneAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteHostedZoneOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::DeleteHostedZoneAsyncHelper(const DeleteHostedZoneRequest& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteHostedZone(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzone/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<DeleteHostedZoneRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteHostedZone", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteHostedZoneOutcome(DeleteHostedZoneResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteHostedZoneOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteReusableDelegationSetOutcome Route53Client::DeleteReusableDelegationSet(const DeleteReusableDelegationSetRequest& request) const
@@ -480,7 +754,7 @@ DeleteReusableDelegationSetOutcome Route53Client::DeleteReusableDelegationSet(co
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/delegationset/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteReusableDelegationSet");
   if(outcome.IsSuccess())
   {
     return DeleteReusableDelegationSetOutcome(DeleteReusableDelegationSetResult(outcome.GetResult()));
@@ -493,17 +767,42 @@ DeleteReusableDelegationSetOutcome Route53Client::DeleteReusableDelegationSet(co
 
 DeleteReusableDelegationSetOutcomeCallable Route53Client::DeleteReusableDelegationSetCallable(const DeleteReusableDelegationSetRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DeleteReusableDelegationSet, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteReusableDelegationSetOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteReusableDelegationSet( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteReusableDelegationSetOutcome > rejected;
+    rejected.set_value(DeleteReusableDelegationSetOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::DeleteReusableDelegationSetAsync(const DeleteReusableDelegationSetRequest& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DeleteReusableDelegationSetAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::DeleteReusableDelegationSetAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteReusableDelegationSetOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::DeleteReusableDelegationSetAsyncHelper(const DeleteReusableDelegationSetRequest& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteReusableDelegationSet(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/delegationset/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<DeleteReusableDelegationSetRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteReusableDelegationSet", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteReusableDelegationSetOutcome(DeleteReusableDelegationSetResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteReusableDelegationSetOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteTrafficPolicyOutcome Route53Client::DeleteTrafficPolicy(const DeleteTrafficPolicyRequest& request) const
@@ -513,7 +812,7 @@ DeleteTrafficPolicyOutcome Route53Client::DeleteTrafficPolicy(const DeleteTraffi
   ss << request.GetId();
   ss << "/";
   ss << request.GetVersion();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteTrafficPolicy");
   if(outcome.IsSuccess())
   {
     return DeleteTrafficPolicyOutcome(DeleteTrafficPolicyResult(outcome.GetResult()));
@@ -526,17 +825,44 @@ DeleteTrafficPolicyOutcome Route53Client::DeleteTrafficPolicy(const DeleteTraffi
 
 DeleteTrafficPolicyOutcomeCallable Route53Client::DeleteTrafficPolicyCallable(const DeleteTrafficPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DeleteTrafficPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteTrafficPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteTrafficPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteTrafficPolicyOutcome > rejected;
+    rejected.set_value(DeleteTrafficPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::DeleteTrafficPolicyAsync(const DeleteTrafficPolicyRequest& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DeleteTrafficPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::DeleteTrafficPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteTrafficPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::DeleteTrafficPolicyAsyncHelper(const DeleteTrafficPolicyRequest& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteTrafficPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicy/";
+  ss << request.GetId();
+  ss << "/";
+  ss << request.GetVersion();
+  auto sharedRequest = Aws::MakeShared<DeleteTrafficPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteTrafficPolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteTrafficPolicyOutcome(DeleteTrafficPolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteTrafficPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteTrafficPolicyInstanceOutcome Route53Client::DeleteTrafficPolicyInstance(const DeleteTrafficPolicyInstanceRequest& request) const
@@ -544,7 +870,7 @@ DeleteTrafficPolicyInstanceOutcome Route53Client::DeleteTrafficPolicyInstance(co
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicyinstance/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteTrafficPolicyInstance");
   if(outcome.IsSuccess())
   {
     return DeleteTrafficPolicyInstanceOutcome(DeleteTrafficPolicyInstanceResult(outcome.GetResult()));
@@ -557,17 +883,42 @@ DeleteTrafficPolicyInstanceOutcome Route53Client::DeleteTrafficPolicyInstance(co
 
 DeleteTrafficPolicyInstanceOutcomeCallable Route53Client::DeleteTrafficPolicyInstanceCallable(const DeleteTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DeleteTrafficPolicyInstance, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteTrafficPolicyInstanceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteTrafficPolicyInstance( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteTrafficPolicyInstanceOutcome > rejected;
+    rejected.set_value(DeleteTrafficPolicyInstanceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::DeleteTrafficPolicyInstanceAsync(const DeleteTrafficPolicyInstanceRequest& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DeleteTrafficPolicyInstanceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::DeleteTrafficPolicyInstanceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteTrafficPolicyInstanceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::DeleteTrafficPolicyInstanceAsyncHelper(const DeleteTrafficPolicyInstanceRequest& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteTrafficPolicyInstance(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicyinstance/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<DeleteTrafficPolicyInstanceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteTrafficPolicyInstance", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteTrafficPolicyInstanceOutcome(DeleteTrafficPolicyInstanceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteTrafficPolicyInstanceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DisassociateVPCFromHostedZoneOutcome Route53Client::DisassociateVPCFromHostedZone(const DisassociateVPCFromHostedZoneRequest& request) const
@@ -576,7 +927,7 @@ DisassociateVPCFromHostedZoneOutcome Route53Client::DisassociateVPCFromHostedZon
   ss << m_uri << "/2013-04-01/hostedzone/";
   ss << request.GetHostedZoneId();
   ss << "/disassociatevpc";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DisassociateVPCFromHostedZone");
   if(outcome.IsSuccess())
   {
     return DisassociateVPCFromHostedZoneOutcome(DisassociateVPCFromHostedZoneResult(outcome.GetResult()));
@@ -589,17 +940,43 @@ DisassociateVPCFromHostedZoneOutcome Route53Client::DisassociateVPCFromHostedZon
 
 DisassociateVPCFromHostedZoneOutcomeCallable Route53Client::DisassociateVPCFromHostedZoneCallable(const DisassociateVPCFromHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DisassociateVPCFromHostedZone, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DisassociateVPCFromHostedZoneOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisassociateVPCFromHostedZone( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DisassociateVPCFromHostedZoneOutcome > rejected;
+    rejected.set_value(DisassociateVPCFromHostedZoneOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::DisassociateVPCFromHostedZoneAsync(const DisassociateVPCFromHostedZoneRequest& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DisassociateVPCFromHostedZoneAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::DisassociateVPCFromHostedZoneAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DisassociateVPCFromHostedZoneOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::DisassociateVPCFromHostedZoneAsyncHelper(const DisassociateVPCFromHostedZoneRequest& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DisassociateVPCFromHostedZone(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzone/";
+  ss << request.GetHostedZoneId();
+  ss << "/disassociatevpc";
+  auto sharedRequest = Aws::MakeShared<DisassociateVPCFromHostedZoneRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DisassociateVPCFromHostedZone", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DisassociateVPCFromHostedZoneOutcome(DisassociateVPCFromHostedZoneResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DisassociateVPCFromHostedZoneOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetChangeOutcome Route53Client::GetChange(const GetChangeRequest& request) const
@@ -607,7 +984,7 @@ GetChangeOutcome Route53Client::GetChange(const GetChangeRequest& request) const
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/change/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetChange");
   if(outcome.IsSuccess())
   {
     return GetChangeOutcome(GetChangeResult(outcome.GetResult()));
@@ -620,24 +997,49 @@ GetChangeOutcome Route53Client::GetChange(const GetChangeRequest& request) const
 
 GetChangeOutcomeCallable Route53Client::GetChangeCallable(const GetChangeRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetChange, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetChangeOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetChange( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetChangeOutcome > rejected;
+    rejected.set_value(GetChangeOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetChangeAsync(const GetChangeRequest& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetChangeAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetChangeAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetChangeOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetChangeAsyncHelper(const GetChangeRequest& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetChange(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/change/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetChangeRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetChange", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetChangeOutcome(GetChangeResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetChangeOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetCheckerIpRangesOutcome Route53Client::GetCheckerIpRanges(const GetCheckerIpRangesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/checkeripranges";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetCheckerIpRanges");
   if(outcome.IsSuccess())
   {
     return GetCheckerIpRangesOutcome(GetCheckerIpRangesResult(outcome.GetResult()));
@@ -650,24 +1052,48 @@ GetCheckerIpRangesOutcome Route53Client::GetCheckerIpRanges(const GetCheckerIpRa
 
 GetCheckerIpRangesOutcomeCallable Route53Client::GetCheckerIpRangesCallable(const GetCheckerIpRangesRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetCheckerIpRanges, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetCheckerIpRangesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCheckerIpRanges( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetCheckerIpRangesOutcome > rejected;
+    rejected.set_value(GetCheckerIpRangesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetCheckerIpRangesAsync(const GetCheckerIpRangesRequest& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetCheckerIpRangesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetCheckerIpRangesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetCheckerIpRangesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetCheckerIpRangesAsyncHelper(const GetCheckerIpRangesRequest& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetCheckerIpRanges(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/checkeripranges";
+  auto sharedRequest = Aws::MakeShared<GetCheckerIpRangesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetCheckerIpRanges", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetCheckerIpRangesOutcome(GetCheckerIpRangesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetCheckerIpRangesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetGeoLocationOutcome Route53Client::GetGeoLocation(const GetGeoLocationRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/geolocation";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetGeoLocation");
   if(outcome.IsSuccess())
   {
     return GetGeoLocationOutcome(GetGeoLocationResult(outcome.GetResult()));
@@ -680,17 +1106,41 @@ GetGeoLocationOutcome Route53Client::GetGeoLocation(const GetGeoLocationRequest&
 
 GetGeoLocationOutcomeCallable Route53Client::GetGeoLocationCallable(const GetGeoLocationRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetGeoLocation, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetGeoLocationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetGeoLocation( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetGeoLocationOutcome > rejected;
+    rejected.set_value(GetGeoLocationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetGeoLocationAsync(const GetGeoLocationRequest& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetGeoLocationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetGeoLocationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetGeoLocationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetGeoLocationAsyncHelper(const GetGeoLocationRequest& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetGeoLocation(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/geolocation";
+  auto sharedRequest = Aws::MakeShared<GetGeoLocationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetGeoLocation", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetGeoLocationOutcome(GetGeoLocationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetGeoLocationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetHealthCheckOutcome Route53Client::GetHealthCheck(const GetHealthCheckRequest& request) const
@@ -698,7 +1148,7 @@ GetHealthCheckOutcome Route53Client::GetHealthCheck(const GetHealthCheckRequest&
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/healthcheck/";
   ss << request.GetHealthCheckId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetHealthCheck");
   if(outcome.IsSuccess())
   {
     return GetHealthCheckOutcome(GetHealthCheckResult(outcome.GetResult()));
@@ -711,24 +1161,49 @@ GetHealthCheckOutcome Route53Client::GetHealthCheck(const GetHealthCheckRequest&
 
 GetHealthCheckOutcomeCallable Route53Client::GetHealthCheckCallable(const GetHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHealthCheck, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetHealthCheckOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetHealthCheck( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetHealthCheckOutcome > rejected;
+    rejected.set_value(GetHealthCheckOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetHealthCheckAsync(const GetHealthCheckRequest& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHealthCheckAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetHealthCheckAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetHealthCheckOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetHealthCheckAsyncHelper(const GetHealthCheckRequest& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetHealthCheck(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/healthcheck/";
+  ss << request.GetHealthCheckId();
+  auto sharedRequest = Aws::MakeShared<GetHealthCheckRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetHealthCheck", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetHealthCheckOutcome(GetHealthCheckResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetHealthCheckOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetHealthCheckCountOutcome Route53Client::GetHealthCheckCount(const GetHealthCheckCountRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/healthcheckcount";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetHealthCheckCount");
   if(outcome.IsSuccess())
   {
     return GetHealthCheckCountOutcome(GetHealthCheckCountResult(outcome.GetResult()));
@@ -741,17 +1216,41 @@ GetHealthCheckCountOutcome Route53Client::GetHealthCheckCount(const GetHealthChe
 
 GetHealthCheckCountOutcomeCallable Route53Client::GetHealthCheckCountCallable(const GetHealthCheckCountRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHealthCheckCount, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetHealthCheckCountOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetHealthCheckCount( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetHealthCheckCountOutcome > rejected;
+    rejected.set_value(GetHealthCheckCountOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetHealthCheckCountAsync(const GetHealthCheckCountRequest& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHealthCheckCountAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetHealthCheckCountAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetHealthCheckCountOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetHealthCheckCountAsyncHelper(const GetHealthCheckCountRequest& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetHealthCheckCount(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/healthcheckcount";
+  auto sharedRequest = Aws::MakeShared<GetHealthCheckCountRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetHealthCheckCount", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetHealthCheckCountOutcome(GetHealthCheckCountResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetHealthCheckCountOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetHealthCheckLastFailureReasonOutcome Route53Client::GetHealthCheckLastFailureReason(const GetHealthCheckLastFailureReasonRequest& request) const
@@ -760,7 +1259,7 @@ GetHealthCheckLastFailureReasonOutcome Route53Client::GetHealthCheckLastFailureR
   ss << m_uri << "/2013-04-01/healthcheck/";
   ss << request.GetHealthCheckId();
   ss << "/lastfailurereason";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetHealthCheckLastFailureReason");
   if(outcome.IsSuccess())
   {
     return GetHealthCheckLastFailureReasonOutcome(GetHealthCheckLastFailureReasonResult(outcome.GetResult()));
@@ -773,17 +1272,43 @@ GetHealthCheckLastFailureReasonOutcome Route53Client::GetHealthCheckLastFailureR
 
 GetHealthCheckLastFailureReasonOutcomeCallable Route53Client::GetHealthCheckLastFailureReasonCallable(const GetHealthCheckLastFailureReasonRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHealthCheckLastFailureReason, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetHealthCheckLastFailureReasonOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetHealthCheckLastFailureReason( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetHealthCheckLastFailureReasonOutcome > rejected;
+    rejected.set_value(GetHealthCheckLastFailureReasonOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetHealthCheckLastFailureReasonAsync(const GetHealthCheckLastFailureReasonRequest& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHealthCheckLastFailureReasonAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetHealthCheckLastFailureReasonAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetHealthCheckLastFailureReasonOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetHealthCheckLastFailureReasonAsyncHelper(const GetHealthCheckLastFailureReasonRequest& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetHealthCheckLastFailureReason(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/healthcheck/";
+  ss << request.GetHealthCheckId();
+  ss << "/lastfailurereason";
+  auto sharedRequest = Aws::MakeShared<GetHealthCheckLastFailureReasonRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetHealthCheckLastFailureReason", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetHealthCheckLastFailureReasonOutcome(GetHealthCheckLastFailureReasonResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetHealthCheckLastFailureReasonOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetHealthCheckStatusOutcome Route53Client::GetHealthCheckStatus(const GetHealthCheckStatusRequest& request) const
@@ -792,7 +1317,7 @@ GetHealthCheckStatusOutcome Route53Client::GetHealthCheckStatus(const GetHealthC
   ss << m_uri << "/2013-04-01/healthcheck/";
   ss << request.GetHealthCheckId();
   ss << "/status";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetHealthCheckStatus");
   if(outcome.IsSuccess())
   {
     return GetHealthCheckStatusOutcome(GetHealthCheckStatusResult(outcome.GetResult()));
@@ -805,17 +1330,43 @@ GetHealthCheckStatusOutcome Route53Client::GetHealthCheckStatus(const GetHealthC
 
 GetHealthCheckStatusOutcomeCallable Route53Client::GetHealthCheckStatusCallable(const GetHealthCheckStatusRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHealthCheckStatus, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetHealthCheckStatusOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetHealthCheckStatus( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetHealthCheckStatusOutcome > rejected;
+    rejected.set_value(GetHealthCheckStatusOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetHealthCheckStatusAsync(const GetHealthCheckStatusRequest& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHealthCheckStatusAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetHealthCheckStatusAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetHealthCheckStatusOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetHealthCheckStatusAsyncHelper(const GetHealthCheckStatusRequest& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetHealthCheckStatus(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/healthcheck/";
+  ss << request.GetHealthCheckId();
+  ss << "/status";
+  auto sharedRequest = Aws::MakeShared<GetHealthCheckStatusRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetHealthCheckStatus", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetHealthCheckStatusOutcome(GetHealthCheckStatusResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetHealthCheckStatusOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetHostedZoneOutcome Route53Client::GetHostedZone(const GetHostedZoneRequest& request) const
@@ -823,7 +1374,7 @@ GetHostedZoneOutcome Route53Client::GetHostedZone(const GetHostedZoneRequest& re
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/hostedzone/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetHostedZone");
   if(outcome.IsSuccess())
   {
     return GetHostedZoneOutcome(GetHostedZoneResult(outcome.GetResult()));
@@ -836,24 +1387,49 @@ GetHostedZoneOutcome Route53Client::GetHostedZone(const GetHostedZoneRequest& re
 
 GetHostedZoneOutcomeCallable Route53Client::GetHostedZoneCallable(const GetHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHostedZone, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetHostedZoneOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetHostedZone( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetHostedZoneOutcome > rejected;
+    rejected.set_value(GetHostedZoneOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetHostedZoneAsync(const GetHostedZoneRequest& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHostedZoneAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetHostedZoneAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetHostedZoneOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetHostedZoneAsyncHelper(const GetHostedZoneRequest& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetHostedZone(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzone/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetHostedZoneRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetHostedZone", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetHostedZoneOutcome(GetHostedZoneResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetHostedZoneOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetHostedZoneCountOutcome Route53Client::GetHostedZoneCount(const GetHostedZoneCountRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/hostedzonecount";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetHostedZoneCount");
   if(outcome.IsSuccess())
   {
     return GetHostedZoneCountOutcome(GetHostedZoneCountResult(outcome.GetResult()));
@@ -866,17 +1442,41 @@ GetHostedZoneCountOutcome Route53Client::GetHostedZoneCount(const GetHostedZoneC
 
 GetHostedZoneCountOutcomeCallable Route53Client::GetHostedZoneCountCallable(const GetHostedZoneCountRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHostedZoneCount, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetHostedZoneCountOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetHostedZoneCount( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetHostedZoneCountOutcome > rejected;
+    rejected.set_value(GetHostedZoneCountOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetHostedZoneCountAsync(const GetHostedZoneCountRequest& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHostedZoneCountAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetHostedZoneCountAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetHostedZoneCountOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetHostedZoneCountAsyncHelper(const GetHostedZoneCountRequest& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetHostedZoneCount(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzonecount";
+  auto sharedRequest = Aws::MakeShared<GetHostedZoneCountRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetHostedZoneCount", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetHostedZoneCountOutcome(GetHostedZoneCountResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetHostedZoneCountOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetReusableDelegationSetOutcome Route53Client::GetReusableDelegationSet(const GetReusableDelegationSetRequest& request) const
@@ -884,7 +1484,7 @@ GetReusableDelegationSetOutcome Route53Client::GetReusableDelegationSet(const Ge
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/delegationset/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetReusableDelegationSet");
   if(outcome.IsSuccess())
   {
     return GetReusableDelegationSetOutcome(GetReusableDelegationSetResult(outcome.GetResult()));
@@ -897,17 +1497,42 @@ GetReusableDelegationSetOutcome Route53Client::GetReusableDelegationSet(const Ge
 
 GetReusableDelegationSetOutcomeCallable Route53Client::GetReusableDelegationSetCallable(const GetReusableDelegationSetRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetReusableDelegationSet, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetReusableDelegationSetOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetReusableDelegationSet( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetReusableDelegationSetOutcome > rejected;
+    rejected.set_value(GetReusableDelegationSetOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetReusableDelegationSetAsync(const GetReusableDelegationSetRequest& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetReusableDelegationSetAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetReusableDelegationSetAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetReusableDelegationSetOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetReusableDelegationSetAsyncHelper(const GetReusableDelegationSetRequest& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetReusableDelegationSet(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/delegationset/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetReusableDelegationSetRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetReusableDelegationSet", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetReusableDelegationSetOutcome(GetReusableDelegationSetResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetReusableDelegationSetOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetTrafficPolicyOutcome Route53Client::GetTrafficPolicy(const GetTrafficPolicyRequest& request) const
@@ -917,7 +1542,7 @@ GetTrafficPolicyOutcome Route53Client::GetTrafficPolicy(const GetTrafficPolicyRe
   ss << request.GetId();
   ss << "/";
   ss << request.GetVersion();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetTrafficPolicy");
   if(outcome.IsSuccess())
   {
     return GetTrafficPolicyOutcome(GetTrafficPolicyResult(outcome.GetResult()));
@@ -930,17 +1555,44 @@ GetTrafficPolicyOutcome Route53Client::GetTrafficPolicy(const GetTrafficPolicyRe
 
 GetTrafficPolicyOutcomeCallable Route53Client::GetTrafficPolicyCallable(const GetTrafficPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetTrafficPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetTrafficPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetTrafficPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetTrafficPolicyOutcome > rejected;
+    rejected.set_value(GetTrafficPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetTrafficPolicyAsync(const GetTrafficPolicyRequest& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetTrafficPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetTrafficPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetTrafficPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetTrafficPolicyAsyncHelper(const GetTrafficPolicyRequest& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetTrafficPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicy/";
+  ss << request.GetId();
+  ss << "/";
+  ss << request.GetVersion();
+  auto sharedRequest = Aws::MakeShared<GetTrafficPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetTrafficPolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetTrafficPolicyOutcome(GetTrafficPolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetTrafficPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetTrafficPolicyInstanceOutcome Route53Client::GetTrafficPolicyInstance(const GetTrafficPolicyInstanceRequest& request) const
@@ -948,7 +1600,7 @@ GetTrafficPolicyInstanceOutcome Route53Client::GetTrafficPolicyInstance(const Ge
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicyinstance/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetTrafficPolicyInstance");
   if(outcome.IsSuccess())
   {
     return GetTrafficPolicyInstanceOutcome(GetTrafficPolicyInstanceResult(outcome.GetResult()));
@@ -961,24 +1613,49 @@ GetTrafficPolicyInstanceOutcome Route53Client::GetTrafficPolicyInstance(const Ge
 
 GetTrafficPolicyInstanceOutcomeCallable Route53Client::GetTrafficPolicyInstanceCallable(const GetTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetTrafficPolicyInstance, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetTrafficPolicyInstanceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetTrafficPolicyInstance( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetTrafficPolicyInstanceOutcome > rejected;
+    rejected.set_value(GetTrafficPolicyInstanceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetTrafficPolicyInstanceAsync(const GetTrafficPolicyInstanceRequest& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetTrafficPolicyInstanceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetTrafficPolicyInstanceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetTrafficPolicyInstanceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetTrafficPolicyInstanceAsyncHelper(const GetTrafficPolicyInstanceRequest& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetTrafficPolicyInstance(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicyinstance/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<GetTrafficPolicyInstanceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetTrafficPolicyInstance", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetTrafficPolicyInstanceOutcome(GetTrafficPolicyInstanceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetTrafficPolicyInstanceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetTrafficPolicyInstanceCountOutcome Route53Client::GetTrafficPolicyInstanceCount(const GetTrafficPolicyInstanceCountRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicyinstancecount";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetTrafficPolicyInstanceCount");
   if(outcome.IsSuccess())
   {
     return GetTrafficPolicyInstanceCountOutcome(GetTrafficPolicyInstanceCountResult(outcome.GetResult()));
@@ -991,24 +1668,48 @@ GetTrafficPolicyInstanceCountOutcome Route53Client::GetTrafficPolicyInstanceCoun
 
 GetTrafficPolicyInstanceCountOutcomeCallable Route53Client::GetTrafficPolicyInstanceCountCallable(const GetTrafficPolicyInstanceCountRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetTrafficPolicyInstanceCount, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetTrafficPolicyInstanceCountOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetTrafficPolicyInstanceCount( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetTrafficPolicyInstanceCountOutcome > rejected;
+    rejected.set_value(GetTrafficPolicyInstanceCountOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::GetTrafficPolicyInstanceCountAsync(const GetTrafficPolicyInstanceCountRequest& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetTrafficPolicyInstanceCountAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::GetTrafficPolicyInstanceCountAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetTrafficPolicyInstanceCountOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::GetTrafficPolicyInstanceCountAsyncHelper(const GetTrafficPolicyInstanceCountRequest& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetTrafficPolicyInstanceCount(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicyinstancecount";
+  auto sharedRequest = Aws::MakeShared<GetTrafficPolicyInstanceCountRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetTrafficPolicyInstanceCount", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetTrafficPolicyInstanceCountOutcome(GetTrafficPolicyInstanceCountResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetTrafficPolicyInstanceCountOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListGeoLocationsOutcome Route53Client::ListGeoLocations(const ListGeoLocationsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/geolocations";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListGeoLocations");
   if(outcome.IsSuccess())
   {
     return ListGeoLocationsOutcome(ListGeoLocationsResult(outcome.GetResult()));
@@ -1021,24 +1722,48 @@ ListGeoLocationsOutcome Route53Client::ListGeoLocations(const ListGeoLocationsRe
 
 ListGeoLocationsOutcomeCallable Route53Client::ListGeoLocationsCallable(const ListGeoLocationsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListGeoLocations, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListGeoLocationsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListGeoLocations( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListGeoLocationsOutcome > rejected;
+    rejected.set_value(ListGeoLocationsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListGeoLocationsAsync(const ListGeoLocationsRequest& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListGeoLocationsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListGeoLocationsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListGeoLocationsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListGeoLocationsAsyncHelper(const ListGeoLocationsRequest& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListGeoLocations(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/geolocations";
+  auto sharedRequest = Aws::MakeShared<ListGeoLocationsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListGeoLocations", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListGeoLocationsOutcome(ListGeoLocationsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListGeoLocationsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListHealthChecksOutcome Route53Client::ListHealthChecks(const ListHealthChecksRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/healthcheck";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListHealthChecks");
   if(outcome.IsSuccess())
   {
     return ListHealthChecksOutcome(ListHealthChecksResult(outcome.GetResult()));
@@ -1051,24 +1776,48 @@ ListHealthChecksOutcome Route53Client::ListHealthChecks(const ListHealthChecksRe
 
 ListHealthChecksOutcomeCallable Route53Client::ListHealthChecksCallable(const ListHealthChecksRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListHealthChecks, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListHealthChecksOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListHealthChecks( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListHealthChecksOutcome > rejected;
+    rejected.set_value(ListHealthChecksOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListHealthChecksAsync(const ListHealthChecksRequest& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListHealthChecksAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListHealthChecksAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListHealthChecksOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListHealthChecksAsyncHelper(const ListHealthChecksRequest& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListHealthChecks(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/healthcheck";
+  auto sharedRequest = Aws::MakeShared<ListHealthChecksRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListHealthChecks", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListHealthChecksOutcome(ListHealthChecksResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListHealthChecksOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListHostedZonesOutcome Route53Client::ListHostedZones(const ListHostedZonesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/hostedzone";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListHostedZones");
   if(outcome.IsSuccess())
   {
     return ListHostedZonesOutcome(ListHostedZonesResult(outcome.GetResult()));
@@ -1081,24 +1830,48 @@ ListHostedZonesOutcome Route53Client::ListHostedZones(const ListHostedZonesReque
 
 ListHostedZonesOutcomeCallable Route53Client::ListHostedZonesCallable(const ListHostedZonesRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListHostedZones, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListHostedZonesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListHostedZones( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListHostedZonesOutcome > rejected;
+    rejected.set_value(ListHostedZonesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListHostedZonesAsync(const ListHostedZonesRequest& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListHostedZonesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListHostedZonesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListHostedZonesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListHostedZonesAsyncHelper(const ListHostedZonesRequest& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListHostedZones(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzone";
+  auto sharedRequest = Aws::MakeShared<ListHostedZonesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListHostedZones", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListHostedZonesOutcome(ListHostedZonesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListHostedZonesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListHostedZonesByNameOutcome Route53Client::ListHostedZonesByName(const ListHostedZonesByNameRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/hostedzonesbyname";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListHostedZonesByName");
   if(outcome.IsSuccess())
   {
     return ListHostedZonesByNameOutcome(ListHostedZonesByNameResult(outcome.GetResult()));
@@ -1111,17 +1884,41 @@ ListHostedZonesByNameOutcome Route53Client::ListHostedZonesByName(const ListHost
 
 ListHostedZonesByNameOutcomeCallable Route53Client::ListHostedZonesByNameCallable(const ListHostedZonesByNameRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListHostedZonesByName, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListHostedZonesByNameOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListHostedZonesByName( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListHostedZonesByNameOutcome > rejected;
+    rejected.set_value(ListHostedZonesByNameOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListHostedZonesByNameAsync(const ListHostedZonesByNameRequest& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListHostedZonesByNameAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListHostedZonesByNameAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListHostedZonesByNameOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListHostedZonesByNameAsyncHelper(const ListHostedZonesByNameRequest& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListHostedZonesByName(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzonesbyname";
+  auto sharedRequest = Aws::MakeShared<ListHostedZonesByNameRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListHostedZonesByName", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListHostedZonesByNameOutcome(ListHostedZonesByNameResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListHostedZonesByNameOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListResourceRecordSetsOutcome Route53Client::ListResourceRecordSets(const ListResourceRecordSetsRequest& request) const
@@ -1130,7 +1927,7 @@ ListResourceRecordSetsOutcome Route53Client::ListResourceRecordSets(const ListRe
   ss << m_uri << "/2013-04-01/hostedzone/";
   ss << request.GetHostedZoneId();
   ss << "/rrset";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListResourceRecordSets");
   if(outcome.IsSuccess())
   {
     return ListResourceRecordSetsOutcome(ListResourceRecordSetsResult(outcome.GetResult()));
@@ -1143,24 +1940,50 @@ ListResourceRecordSetsOutcome Route53Client::ListResourceRecordSets(const ListRe
 
 ListResourceRecordSetsOutcomeCallable Route53Client::ListResourceRecordSetsCallable(const ListResourceRecordSetsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListResourceRecordSets, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListResourceRecordSetsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListResourceRecordSets( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListResourceRecordSetsOutcome > rejected;
+    rejected.set_value(ListResourceRecordSetsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListResourceRecordSetsAsync(const ListResourceRecordSetsRequest& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListResourceRecordSetsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListResourceRecordSetsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListResourceRecordSetsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListResourceRecordSetsAsyncHelper(const ListResourceRecordSetsRequest& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListResourceRecordSets(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzone/";
+  ss << request.GetHostedZoneId();
+  ss << "/rrset";
+  auto sharedRequest = Aws::MakeShared<ListResourceRecordSetsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListResourceRecordSets", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListResourceRecordSetsOutcome(ListResourceRecordSetsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListResourceRecordSetsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListReusableDelegationSetsOutcome Route53Client::ListReusableDelegationSets(const ListReusableDelegationSetsRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/delegationset";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListReusableDelegationSets");
   if(outcome.IsSuccess())
   {
     return ListReusableDelegationSetsOutcome(ListReusableDelegationSetsResult(outcome.GetResult()));
@@ -1173,17 +1996,41 @@ ListReusableDelegationSetsOutcome Route53Client::ListReusableDelegationSets(cons
 
 ListReusableDelegationSetsOutcomeCallable Route53Client::ListReusableDelegationSetsCallable(const ListReusableDelegationSetsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListReusableDelegationSets, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListReusableDelegationSetsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListReusableDelegationSets( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListReusableDelegationSetsOutcome > rejected;
+    rejected.set_value(ListReusableDelegationSetsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListReusableDelegationSetsAsync(const ListReusableDelegationSetsRequest& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListReusableDelegationSetsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListReusableDelegationSetsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListReusableDelegationSetsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListReusableDelegationSetsAsyncHelper(const ListReusableDelegationSetsRequest& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListReusableDelegationSets(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/delegationset";
+  auto sharedRequest = Aws::MakeShared<ListReusableDelegationSetsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListReusableDelegationSets", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListReusableDelegationSetsOutcome(ListReusableDelegationSetsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListReusableDelegationSetsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListTagsForResourceOutcome Route53Client::ListTagsForResource(const ListTagsForResourceRequest& request) const
@@ -1193,7 +2040,7 @@ ListTagsForResourceOutcome Route53Client::ListTagsForResource(const ListTagsForR
   ss << TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType());
   ss << "/";
   ss << request.GetResourceId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListTagsForResource");
   if(outcome.IsSuccess())
   {
     return ListTagsForResourceOutcome(ListTagsForResourceResult(outcome.GetResult()));
@@ -1206,17 +2053,44 @@ ListTagsForResourceOutcome Route53Client::ListTagsForResource(const ListTagsForR
 
 ListTagsForResourceOutcomeCallable Route53Client::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTagsForResource, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListTagsForResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTagsForResource( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListTagsForResourceOutcome > rejected;
+    rejected.set_value(ListTagsForResourceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTagsForResourceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListTagsForResourceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListTagsForResourceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTagsForResource(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/tags/";
+  ss << TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType());
+  ss << "/";
+  ss << request.GetResourceId();
+  auto sharedRequest = Aws::MakeShared<ListTagsForResourceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListTagsForResource", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTagsForResourceOutcome(ListTagsForResourceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTagsForResourceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListTagsForResourcesOutcome Route53Client::ListTagsForResources(const ListTagsForResourcesRequest& request) const
@@ -1224,7 +2098,7 @@ ListTagsForResourcesOutcome Route53Client::ListTagsForResources(const ListTagsFo
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/tags/";
   ss << TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType());
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ListTagsForResources");
   if(outcome.IsSuccess())
   {
     return ListTagsForResourcesOutcome(ListTagsForResourcesResult(outcome.GetResult()));
@@ -1237,24 +2111,49 @@ ListTagsForResourcesOutcome Route53Client::ListTagsForResources(const ListTagsFo
 
 ListTagsForResourcesOutcomeCallable Route53Client::ListTagsForResourcesCallable(const ListTagsForResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTagsForResources, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListTagsForResourcesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTagsForResources( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListTagsForResourcesOutcome > rejected;
+    rejected.set_value(ListTagsForResourcesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListTagsForResourcesAsync(const ListTagsForResourcesRequest& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTagsForResourcesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListTagsForResourcesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListTagsForResourcesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListTagsForResourcesAsyncHelper(const ListTagsForResourcesRequest& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTagsForResources(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/tags/";
+  ss << TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType());
+  auto sharedRequest = Aws::MakeShared<ListTagsForResourcesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ListTagsForResources", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTagsForResourcesOutcome(ListTagsForResourcesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTagsForResourcesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListTrafficPoliciesOutcome Route53Client::ListTrafficPolicies(const ListTrafficPoliciesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicies";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListTrafficPolicies");
   if(outcome.IsSuccess())
   {
     return ListTrafficPoliciesOutcome(ListTrafficPoliciesResult(outcome.GetResult()));
@@ -1267,24 +2166,48 @@ ListTrafficPoliciesOutcome Route53Client::ListTrafficPolicies(const ListTrafficP
 
 ListTrafficPoliciesOutcomeCallable Route53Client::ListTrafficPoliciesCallable(const ListTrafficPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTrafficPolicies, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListTrafficPoliciesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTrafficPolicies( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListTrafficPoliciesOutcome > rejected;
+    rejected.set_value(ListTrafficPoliciesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListTrafficPoliciesAsync(const ListTrafficPoliciesRequest& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTrafficPoliciesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListTrafficPoliciesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListTrafficPoliciesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListTrafficPoliciesAsyncHelper(const ListTrafficPoliciesRequest& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTrafficPolicies(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicies";
+  auto sharedRequest = Aws::MakeShared<ListTrafficPoliciesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListTrafficPolicies", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTrafficPoliciesOutcome(ListTrafficPoliciesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTrafficPoliciesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListTrafficPolicyInstancesOutcome Route53Client::ListTrafficPolicyInstances(const ListTrafficPolicyInstancesRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicyinstances";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListTrafficPolicyInstances");
   if(outcome.IsSuccess())
   {
     return ListTrafficPolicyInstancesOutcome(ListTrafficPolicyInstancesResult(outcome.GetResult()));
@@ -1297,24 +2220,48 @@ ListTrafficPolicyInstancesOutcome Route53Client::ListTrafficPolicyInstances(cons
 
 ListTrafficPolicyInstancesOutcomeCallable Route53Client::ListTrafficPolicyInstancesCallable(const ListTrafficPolicyInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTrafficPolicyInstances, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListTrafficPolicyInstancesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTrafficPolicyInstances( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListTrafficPolicyInstancesOutcome > rejected;
+    rejected.set_value(ListTrafficPolicyInstancesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListTrafficPolicyInstancesAsync(const ListTrafficPolicyInstancesRequest& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListTrafficPolicyInstancesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListTrafficPolicyInstancesAsyncHelper(const ListTrafficPolicyInstancesRequest& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTrafficPolicyInstances(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicyinstances";
+  auto sharedRequest = Aws::MakeShared<ListTrafficPolicyInstancesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListTrafficPolicyInstances", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTrafficPolicyInstancesOutcome(ListTrafficPolicyInstancesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTrafficPolicyInstancesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListTrafficPolicyInstancesByHostedZoneOutcome Route53Client::ListTrafficPolicyInstancesByHostedZone(const ListTrafficPolicyInstancesByHostedZoneRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicyinstances/hostedzone";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListTrafficPolicyInstancesByHostedZone");
   if(outcome.IsSuccess())
   {
     return ListTrafficPolicyInstancesByHostedZoneOutcome(ListTrafficPolicyInstancesByHostedZoneResult(outcome.GetResult()));
@@ -1327,24 +2274,48 @@ ListTrafficPolicyInstancesByHostedZoneOutcome Route53Client::ListTrafficPolicyIn
 
 ListTrafficPolicyInstancesByHostedZoneOutcomeCallable Route53Client::ListTrafficPolicyInstancesByHostedZoneCallable(const ListTrafficPolicyInstancesByHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTrafficPolicyInstancesByHostedZone, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListTrafficPolicyInstancesByHostedZoneOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTrafficPolicyInstancesByHostedZone( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListTrafficPolicyInstancesByHostedZoneOutcome > rejected;
+    rejected.set_value(ListTrafficPolicyInstancesByHostedZoneOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListTrafficPolicyInstancesByHostedZoneAsync(const ListTrafficPolicyInstancesByHostedZoneRequest& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesByHostedZoneAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesByHostedZoneAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListTrafficPolicyInstancesByHostedZoneOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListTrafficPolicyInstancesByHostedZoneAsyncHelper(const ListTrafficPolicyInstancesByHostedZoneRequest& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTrafficPolicyInstancesByHostedZone(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicyinstances/hostedzone";
+  auto sharedRequest = Aws::MakeShared<ListTrafficPolicyInstancesByHostedZoneRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListTrafficPolicyInstancesByHostedZone", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTrafficPolicyInstancesByHostedZoneOutcome(ListTrafficPolicyInstancesByHostedZoneResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTrafficPolicyInstancesByHostedZoneOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListTrafficPolicyInstancesByPolicyOutcome Route53Client::ListTrafficPolicyInstancesByPolicy(const ListTrafficPolicyInstancesByPolicyRequest& request) const
 {
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicyinstances/trafficpolicy";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListTrafficPolicyInstancesByPolicy");
   if(outcome.IsSuccess())
   {
     return ListTrafficPolicyInstancesByPolicyOutcome(ListTrafficPolicyInstancesByPolicyResult(outcome.GetResult()));
@@ -1357,17 +2328,41 @@ ListTrafficPolicyInstancesByPolicyOutcome Route53Client::ListTrafficPolicyInstan
 
 ListTrafficPolicyInstancesByPolicyOutcomeCallable Route53Client::ListTrafficPolicyInstancesByPolicyCallable(const ListTrafficPolicyInstancesByPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTrafficPolicyInstancesByPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListTrafficPolicyInstancesByPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTrafficPolicyInstancesByPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListTrafficPolicyInstancesByPolicyOutcome > rejected;
+    rejected.set_value(ListTrafficPolicyInstancesByPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListTrafficPolicyInstancesByPolicyAsync(const ListTrafficPolicyInstancesByPolicyRequest& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesByPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesByPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListTrafficPolicyInstancesByPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListTrafficPolicyInstancesByPolicyAsyncHelper(const ListTrafficPolicyInstancesByPolicyRequest& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTrafficPolicyInstancesByPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicyinstances/trafficpolicy";
+  auto sharedRequest = Aws::MakeShared<ListTrafficPolicyInstancesByPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListTrafficPolicyInstancesByPolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTrafficPolicyInstancesByPolicyOutcome(ListTrafficPolicyInstancesByPolicyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTrafficPolicyInstancesByPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListTrafficPolicyVersionsOutcome Route53Client::ListTrafficPolicyVersions(const ListTrafficPolicyVersionsRequest& request) const
@@ -1376,7 +2371,7 @@ ListTrafficPolicyVersionsOutcome Route53Client::ListTrafficPolicyVersions(const
   ss << m_uri << "/2013-04-01/trafficpolicies/";
   ss << request.GetId();
   ss << "/versions";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListTrafficPolicyVersions");
   if(outcome.IsSuccess())
   {
     return ListTrafficPolicyVersionsOutcome(ListTrafficPolicyVersionsResult(outcome.GetResult()));
@@ -1389,17 +2384,43 @@ ListTrafficPolicyVersionsOutcome Route53Client::ListTrafficPolicyVersions(const
 
 ListTrafficPolicyVersionsOutcomeCallable Route53Client::ListTrafficPolicyVersionsCallable(const ListTrafficPolicyVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTrafficPolicyVersions, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListTrafficPolicyVersionsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTrafficPolicyVersions( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListTrafficPolicyVersionsOutcome > rejected;
+    rejected.set_value(ListTrafficPolicyVersionsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::ListTrafficPolicyVersionsAsync(const ListTrafficPolicyVersionsRequest& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTrafficPolicyVersionsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::ListTrafficPolicyVersionsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListTrafficPolicyVersionsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::ListTrafficPolicyVersionsAsyncHelper(const ListTrafficPolicyVersionsRequest& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListTrafficPolicyVersions(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicies/";
+  ss << request.GetId();
+  ss << "/versions";
+  auto sharedRequest = Aws::MakeShared<ListTrafficPolicyVersionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListTrafficPolicyVersions", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListTrafficPolicyVersionsOutcome(ListTrafficPolicyVersionsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListTrafficPolicyVersionsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateHealthCheckOutcome Route53Client::UpdateHealthCheck(const UpdateHealthCheckRequest& request) const
@@ -1407,7 +2428,7 @@ UpdateHealthCheckOutcome Route53Client::UpdateHealthCheck(const UpdateHealthChec
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/healthcheck/";
   ss << request.GetHealthCheckId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "UpdateHealthCheck");
   if(outcome.IsSuccess())
   {
     return UpdateHealthCheckOutcome(UpdateHealthCheckResult(outcome.GetResult()));
@@ -1420,17 +2441,42 @@ UpdateHealthCheckOutcome Route53Client::UpdateHealthCheck(const UpdateHealthChec
 
 UpdateHealthCheckOutcomeCallable Route53Client::UpdateHealthCheckCallable(const UpdateHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::UpdateHealthCheck, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateHealthCheckOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateHealthCheck( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateHealthCheckOutcome > rejected;
+    rejected.set_value(UpdateHealthCheckOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::UpdateHealthCheckAsync(const UpdateHealthCheckRequest& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::UpdateHealthCheckAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::UpdateHealthCheckAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateHealthCheckOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::UpdateHealthCheckAsyncHelper(const UpdateHealthCheckRequest& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateHealthCheck(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/healthcheck/";
+  ss << request.GetHealthCheckId();
+  auto sharedRequest = Aws::MakeShared<UpdateHealthCheckRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "UpdateHealthCheck", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateHealthCheckOutcome(UpdateHealthCheckResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateHealthCheckOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateHostedZoneCommentOutcome Route53Client::UpdateHostedZoneComment(const UpdateHostedZoneCommentRequest& request) const
@@ -1438,7 +2484,7 @@ UpdateHostedZoneCommentOutcome Route53Client::UpdateHostedZoneComment(const Upda
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/hostedzone/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "UpdateHostedZoneComment");
   if(outcome.IsSuccess())
   {
     return UpdateHostedZoneCommentOutcome(UpdateHostedZoneCommentResult(outcome.GetResult()));
@@ -1451,17 +2497,42 @@ UpdateHostedZoneCommentOutcome Route53Client::UpdateHostedZoneComment(const Upda
 
 UpdateHostedZoneCommentOutcomeCallable Route53Client::UpdateHostedZoneCommentCallable(const UpdateHostedZoneCommentRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::UpdateHostedZoneComment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateHostedZoneCommentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateHostedZoneComment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateHostedZoneCommentOutcome > rejected;
+    rejected.set_value(UpdateHostedZoneCommentOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::UpdateHostedZoneCommentAsync(const UpdateHostedZoneCommentRequest& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::UpdateHostedZoneCommentAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::UpdateHostedZoneCommentAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateHostedZoneCommentOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::UpdateHostedZoneCommentAsyncHelper(const UpdateHostedZoneCommentRequest& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateHostedZoneComment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/hostedzone/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<UpdateHostedZoneCommentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "UpdateHostedZoneComment", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateHostedZoneCommentOutcome(UpdateHostedZoneCommentResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateHostedZoneCommentOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateTrafficPolicyCommentOutcome Route53Client::UpdateTrafficPolicyComment(const UpdateTrafficPolicyCommentRequest& request) const
@@ -1471,7 +2542,7 @@ UpdateTrafficPolicyCommentOutcome Route53Client::UpdateTrafficPolicyComment(cons
   ss << request.GetId();
   ss << "/";
   ss << request.GetVersion();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "UpdateTrafficPolicyComment");
   if(outcome.IsSuccess())
   {
     return UpdateTrafficPolicyCommentOutcome(UpdateTrafficPolicyCommentResult(outcome.GetResult()));
@@ -1484,17 +2555,44 @@ UpdateTrafficPolicyCommentOutcome Route53Client::UpdateTrafficPolicyComment(cons
 
 UpdateTrafficPolicyCommentOutcomeCallable Route53Client::UpdateTrafficPolicyCommentCallable(const UpdateTrafficPolicyCommentRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::UpdateTrafficPolicyComment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateTrafficPolicyCommentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateTrafficPolicyComment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateTrafficPolicyCommentOutcome > rejected;
+    rejected.set_value(UpdateTrafficPolicyCommentOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::UpdateTrafficPolicyCommentAsync(const UpdateTrafficPolicyCommentRequest& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::UpdateTrafficPolicyCommentAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::UpdateTrafficPolicyCommentAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateTrafficPolicyCommentOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::UpdateTrafficPolicyCommentAsyncHelper(const UpdateTrafficPolicyCommentRequest& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateTrafficPolicyComment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicy/";
+  ss << request.GetId();
+  ss << "/";
+  ss << request.GetVersion();
+  auto sharedRequest = Aws::MakeShared<UpdateTrafficPolicyCommentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "UpdateTrafficPolicyComment", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateTrafficPolicyCommentOutcome(UpdateTrafficPolicyCommentResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateTrafficPolicyCommentOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UpdateTrafficPolicyInstanceOutcome Route53Client::UpdateTrafficPolicyInstance(const UpdateTrafficPolicyInstanceRequest& request) const
@@ -1502,7 +2600,7 @@ UpdateTrafficPolicyInstanceOutcome Route53Client::UpdateTrafficPolicyInstance(co
   Aws::StringStream ss;
   ss << m_uri << "/2013-04-01/trafficpolicyinstance/";
   ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "UpdateTrafficPolicyInstance");
   if(outcome.IsSuccess())
   {
     return UpdateTrafficPolicyInstanceOutcome(UpdateTrafficPolicyInstanceResult(outcome.GetResult()));
@@ -1515,16 +2613,41 @@ UpdateTrafficPolicyInstanceOutcome Route53Client::UpdateTrafficPolicyInstance(co
 
 UpdateTrafficPolicyInstanceOutcomeCallable Route53Client::UpdateTrafficPolicyInstanceCallable(const UpdateTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::UpdateTrafficPolicyInstance, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UpdateTrafficPolicyInstanceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateTrafficPolicyInstance( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UpdateTrafficPolicyInstanceOutcome > rejected;
+    rejected.set_value(UpdateTrafficPolicyInstanceOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void Route53Client::UpdateTrafficPolicyInstanceAsync(const UpdateTrafficPolicyInstanceRequest& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::UpdateTrafficPolicyInstanceAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&Route53Client::UpdateTrafficPolicyInstanceAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UpdateTrafficPolicyInstanceOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void Route53Client::UpdateTrafficPolicyInstanceAsyncHelper(const UpdateTrafficPolicyInstanceRequest& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UpdateTrafficPolicyInstance(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/2013-04-01/trafficpolicyinstance/";
+  ss << request.GetId();
+  auto sharedRequest = Aws::MakeShared<UpdateTrafficPolicyInstanceRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "UpdateTrafficPolicyInstance", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UpdateTrafficPolicyInstanceOutcome(UpdateTrafficPolicyInstanceResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UpdateTrafficPolicyInstanceOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
@@ -39,6 +39,7 @@
 #include <aws/route53domains/model/UpdateDomainNameserversResult.h>
 #include <aws/route53domains/model/UpdateTagsForDomainResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -217,6 +218,30 @@ namespace Model
          */
         virtual void CheckDomainAvailabilityAsync(const Model::CheckDomainAvailabilityRequest& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation checks the availability of one domain name. You can access
+         * this API without authenticating. Note that if the availability status of a
+         * domain is pending, you must submit another request to determine the availability
+         * of the domain name.</p>
+         *
+         * Returns an awaitable that starts the operation the way CheckDomainAvailabilityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CheckDomainAvailabilityRequest>
+        Aws::Utils::Threading::Awaitable<Model::CheckDomainAvailabilityOutcome> CheckDomainAvailabilityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CheckDomainAvailabilityOutcome>([this, request](const std::function<void(Model::CheckDomainAvailabilityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CheckDomainAvailabilityAsync(request, [complete](const Route53DomainsClient*, const Model::CheckDomainAvailabilityRequest&, const Model::CheckDomainAvailabilityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CheckDomainAvailabilityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation deletes the specified tags for a domain.</p> <p>All tag
          * operations are eventually consistent; subsequent operations may not immediately
@@ -242,6 +267,29 @@ namespace Model
          */
         virtual void DeleteTagsForDomainAsync(const Model::DeleteTagsForDomainRequest& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation deletes the specified tags for a domain.</p> <p>All tag
+         * operations are eventually consistent; subsequent operations may not immediately
+         * represent all issued operations.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTagsForDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTagsForDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTagsForDomainOutcome> DeleteTagsForDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTagsForDomainOutcome>([this, request](const std::function<void(Model::DeleteTagsForDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTagsForDomainAsync(request, [complete](const Route53DomainsClient*, const Model::DeleteTagsForDomainRequest&, const Model::DeleteTagsForDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTagsForDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation disables automatic renewal of domain registration for the
          * specified domain.</p> <note>Caution! Amazon Route 53 doesn't have a manual
@@ -273,6 +321,31 @@ namespace Model
          */
         virtual void DisableDomainAutoRenewAsync(const Model::DisableDomainAutoRenewRequest& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation disables automatic renewal of domain registration for the
+         * specified domain.</p> <note>Caution! Amazon Route 53 doesn't have a manual
+         * renewal process, so if you disable automatic renewal, registration for the
+         * domain will not be renewed when the expiration date passes, and you will lose
+         * control of the domain name.</note>
+         *
+         * Returns an awaitable that starts the operation the way DisableDomainAutoRenewAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableDomainAutoRenewRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableDomainAutoRenewOutcome> DisableDomainAutoRenewAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableDomainAutoRenewOutcome>([this, request](const std::function<void(Model::DisableDomainAutoRenewOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableDomainAutoRenewAsync(request, [complete](const Route53DomainsClient*, const Model::DisableDomainAutoRenewRequest&, const Model::DisableDomainAutoRenewOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableDomainAutoRenewOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation removes the transfer lock on the domain (specifically the
          * <code>clientTransferProhibited</code> status) to allow domain transfers. We
@@ -310,6 +383,33 @@ namespace Model
          */
         virtual void DisableDomainTransferLockAsync(const Model::DisableDomainTransferLockRequest& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation removes the transfer lock on the domain (specifically the
+         * <code>clientTransferProhibited</code> status) to allow domain transfers. We
+         * recommend you refrain from performing this action unless you intend to transfer
+         * the domain to a different registrar. Successful submission returns an operation
+         * ID that you can use to track the progress and completion of the action. If the
+         * request is not completed successfully, the domain registrant will be notified by
+         * email.</p>
+         *
+         * Returns an awaitable that starts the operation the way DisableDomainTransferLockAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableDomainTransferLockRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableDomainTransferLockOutcome> DisableDomainTransferLockAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableDomainTransferLockOutcome>([this, request](const std::function<void(Model::DisableDomainTransferLockOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableDomainTransferLockAsync(request, [complete](const Route53DomainsClient*, const Model::DisableDomainTransferLockRequest&, const Model::DisableDomainTransferLockOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableDomainTransferLockOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation configures Amazon Route 53 to automatically renew the
          * specified domain before the domain registration expires. The cost of renewing
@@ -356,6 +456,36 @@ namespace Model
          */
         virtual void EnableDomainAutoRenewAsync(const Model::EnableDomainAutoRenewRequest& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation configures Amazon Route 53 to automatically renew the
+         * specified domain before the domain registration expires. The cost of renewing
+         * your domain registration is billed to your AWS account.</p> <p>The period during
+         * which you can renew a domain name varies by TLD. For a list of TLDs and their
+         * renewal policies, see <a
+         * href="http://wiki.gandi.net/en/domains/renew#renewal_restoration_and_deletion_times">"Renewal,
+         * restoration, and deletion times"</a> on the website for our registrar partner,
+         * Gandi. Route 53 requires that you renew before the end of the renewal period
+         * that is listed on the Gandi website so we can complete processing before the
+         * deadline.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableDomainAutoRenewAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableDomainAutoRenewRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableDomainAutoRenewOutcome> EnableDomainAutoRenewAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableDomainAutoRenewOutcome>([this, request](const std::function<void(Model::EnableDomainAutoRenewOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableDomainAutoRenewAsync(request, [complete](const Route53DomainsClient*, const Model::EnableDomainAutoRenewRequest&, const Model::EnableDomainAutoRenewOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableDomainAutoRenewOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation sets the transfer lock on the domain (specifically the
          * <code>clientTransferProhibited</code> status) to prevent domain transfers.
@@ -387,6 +517,31 @@ namespace Model
          */
         virtual void EnableDomainTransferLockAsync(const Model::EnableDomainTransferLockRequest& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation sets the transfer lock on the domain (specifically the
+         * <code>clientTransferProhibited</code> status) to prevent domain transfers.
+         * Successful submission returns an operation ID that you can use to track the
+         * progress and completion of the action. If the request is not completed
+         * successfully, the domain registrant will be notified by email.</p>
+         *
+         * Returns an awaitable that starts the operation the way EnableDomainTransferLockAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::EnableDomainTransferLockRequest>
+        Aws::Utils::Threading::Awaitable<Model::EnableDomainTransferLockOutcome> EnableDomainTransferLockAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::EnableDomainTransferLockOutcome>([this, request](const std::function<void(Model::EnableDomainTransferLockOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->EnableDomainTransferLockAsync(request, [complete](const Route53DomainsClient*, const Model::EnableDomainTransferLockRequest&, const Model::EnableDomainTransferLockOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::EnableDomainTransferLockOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation returns detailed information about the domain. The domain's
          * contact information is also returned as part of the output.</p>
@@ -409,6 +564,28 @@ namespace Model
          */
         virtual void GetDomainDetailAsync(const Model::GetDomainDetailRequest& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation returns detailed information about the domain. The domain's
+         * contact information is also returned as part of the output.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDomainDetailAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDomainDetailRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDomainDetailOutcome> GetDomainDetailAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDomainDetailOutcome>([this, request](const std::function<void(Model::GetDomainDetailOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDomainDetailAsync(request, [complete](const Route53DomainsClient*, const Model::GetDomainDetailRequest&, const Model::GetDomainDetailOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDomainDetailOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation returns the current status of an operation that is not
          * completed.</p>
@@ -431,6 +608,28 @@ namespace Model
          */
         virtual void GetOperationDetailAsync(const Model::GetOperationDetailRequest& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation returns the current status of an operation that is not
+         * completed.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetOperationDetailAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetOperationDetailRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetOperationDetailOutcome> GetOperationDetailAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetOperationDetailOutcome>([this, request](const std::function<void(Model::GetOperationDetailOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetOperationDetailAsync(request, [complete](const Route53DomainsClient*, const Model::GetOperationDetailRequest&, const Model::GetOperationDetailOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetOperationDetailOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation returns all the domain names registered with Amazon Route 53
          * for the current AWS account.</p>
@@ -453,6 +652,28 @@ namespace Model
          */
         virtual void ListDomainsAsync(const Model::ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation returns all the domain names registered with Amazon Route 53
+         * for the current AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDomainsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDomainsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDomainsOutcome> ListDomainsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDomainsOutcome>([this, request](const std::function<void(Model::ListDomainsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDomainsAsync(request, [complete](const Route53DomainsClient*, const Model::ListDomainsRequest&, const Model::ListDomainsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDomainsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation returns the operation IDs of operations that are not yet
          * complete.</p>
@@ -475,6 +696,28 @@ namespace Model
          */
         virtual void ListOperationsAsync(const Model::ListOperationsRequest& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation returns the operation IDs of operations that are not yet
+         * complete.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListOperationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListOperationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListOperationsOutcome> ListOperationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListOperationsOutcome>([this, request](const std::function<void(Model::ListOperationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListOperationsAsync(request, [complete](const Route53DomainsClient*, const Model::ListOperationsRequest&, const Model::ListOperationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListOperationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation returns all of the tags that are associated with the specified
          * domain.</p> <p>All tag operations are eventually consistent; subsequent
@@ -500,6 +743,29 @@ namespace Model
          */
         virtual void ListTagsForDomainAsync(const Model::ListTagsForDomainRequest& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation returns all of the tags that are associated with the specified
+         * domain.</p> <p>All tag operations are eventually consistent; subsequent
+         * operations may not immediately represent all issued operations.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListTagsForDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsForDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsForDomainOutcome> ListTagsForDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsForDomainOutcome>([this, request](const std::function<void(Model::ListTagsForDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsForDomainAsync(request, [complete](const Route53DomainsClient*, const Model::ListTagsForDomainRequest&, const Model::ListTagsForDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsForDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation registers a domain. Domains are registered by the AWS
          * registrar partner, Gandi. For some top-level domains (TLDs), this operation
@@ -570,6 +836,44 @@ namespace Model
          */
         virtual void RegisterDomainAsync(const Model::RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation registers a domain. Domains are registered by the AWS
+         * registrar partner, Gandi. For some top-level domains (TLDs), this operation
+         * requires extra parameters.</p> <p>When you register a domain, Amazon Route 53
+         * does the following:</p> <ul> <li>Creates a Amazon Route 53 hosted zone that has
+         * the same name as the domain. Amazon Route 53 assigns four name servers to your
+         * hosted zone and automatically updates your domain registration with the names of
+         * these name servers.</li> <li>Enables autorenew, so your domain registration will
+         * renew automatically each year. We'll notify you in advance of the renewal date
+         * so you can choose whether to renew the registration.</li> <li>Optionally enables
+         * privacy protection, so WHOIS queries return contact information for our
+         * registrar partner, Gandi, instead of the information you entered for registrant,
+         * admin, and tech contacts.</li> <li>If registration is successful, returns an
+         * operation ID that you can use to track the progress and completion of the
+         * action. If the request is not completed successfully, the domain registrant is
+         * notified by email.</li> <li>Charges your AWS account an amount based on the
+         * top-level domain. For more information, see <a
+         * href="http://aws.amazon.com/route53/pricing/">Amazon Route 53 Pricing</a>.</li>
+         * </ul>
+         *
+         * Returns an awaitable that starts the operation the way RegisterDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterDomainOutcome> RegisterDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterDomainOutcome>([this, request](const std::function<void(Model::RegisterDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterDomainAsync(request, [complete](const Route53DomainsClient*, const Model::RegisterDomainRequest&, const Model::RegisterDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation returns the AuthCode for the domain. To transfer a domain to
          * another registrar, you provide this value to the new registrar.</p>
@@ -592,6 +896,28 @@ namespace Model
          */
         virtual void RetrieveDomainAuthCodeAsync(const Model::RetrieveDomainAuthCodeRequest& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation returns the AuthCode for the domain. To transfer a domain to
+         * another registrar, you provide this value to the new registrar.</p>
+         *
+         * Returns an awaitable that starts the operation the way RetrieveDomainAuthCodeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RetrieveDomainAuthCodeRequest>
+        Aws::Utils::Threading::Awaitable<Model::RetrieveDomainAuthCodeOutcome> RetrieveDomainAuthCodeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RetrieveDomainAuthCodeOutcome>([this, request](const std::function<void(Model::RetrieveDomainAuthCodeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RetrieveDomainAuthCodeAsync(request, [complete](const Route53DomainsClient*, const Model::RetrieveDomainAuthCodeRequest&, const Model::RetrieveDomainAuthCodeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RetrieveDomainAuthCodeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation transfers a domain from another registrar to Amazon Route 53.
          * When the transfer is complete, the domain is registered with the AWS registrar
@@ -665,6 +991,45 @@ namespace Model
          */
         virtual void TransferDomainAsync(const Model::TransferDomainRequest& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation transfers a domain from another registrar to Amazon Route 53.
+         * When the transfer is complete, the domain is registered with the AWS registrar
+         * partner, Gandi.</p> <p>For transfer requirements, a detailed procedure, and
+         * information about viewing the status of a domain transfer, see <a
+         * href="http://docs.aws.amazon.com/Route53/latest/DeveloperGuide/domain-transfer-to-route-53.html">Transferring
+         * Registration for a Domain to Amazon Route 53</a> in the Amazon Route 53
+         * Developer Guide.</p> <p>If the registrar for your domain is also the DNS service
+         * provider for the domain, we highly recommend that you consider transferring your
+         * DNS service to Amazon Route 53 or to another DNS service provider before you
+         * transfer your registration. Some registrars provide free DNS service when you
+         * purchase a domain registration. When you transfer the registration, the previous
+         * registrar will not renew your domain registration and could end your DNS service
+         * at any time.</p> <note>Caution! If the registrar for your domain is also the DNS
+         * service provider for the domain and you don't transfer DNS service to another
+         * provider, your website, email, and the web applications associated with the
+         * domain might become unavailable.</note> <p>If the transfer is successful, this
+         * method returns an operation ID that you can use to track the progress and
+         * completion of the action. If the transfer doesn't complete successfully, the
+         * domain registrant will be notified by email.</p>
+         *
+         * Returns an awaitable that starts the operation the way TransferDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TransferDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::TransferDomainOutcome> TransferDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TransferDomainOutcome>([this, request](const std::function<void(Model::TransferDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TransferDomainAsync(request, [complete](const Route53DomainsClient*, const Model::TransferDomainRequest&, const Model::TransferDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TransferDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation updates the contact information for a particular domain.
          * Information for at least one contact (registrant, administrator, or technical)
@@ -699,6 +1064,32 @@ namespace Model
          */
         virtual void UpdateDomainContactAsync(const Model::UpdateDomainContactRequest& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation updates the contact information for a particular domain.
+         * Information for at least one contact (registrant, administrator, or technical)
+         * must be supplied for update.</p> <p>If the update is successful, this method
+         * returns an operation ID that you can use to track the progress and completion of
+         * the action. If the request is not completed successfully, the domain registrant
+         * will be notified by email.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateDomainContactAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDomainContactRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDomainContactOutcome> UpdateDomainContactAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDomainContactOutcome>([this, request](const std::function<void(Model::UpdateDomainContactOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDomainContactAsync(request, [complete](const Route53DomainsClient*, const Model::UpdateDomainContactRequest&, const Model::UpdateDomainContactOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDomainContactOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation updates the specified domain contact's privacy setting. When
          * the privacy option is enabled, personal information such as postal or email
@@ -745,6 +1136,36 @@ namespace Model
          */
         virtual void UpdateDomainContactPrivacyAsync(const Model::UpdateDomainContactPrivacyRequest& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation updates the specified domain contact's privacy setting. When
+         * the privacy option is enabled, personal information such as postal or email
+         * address is hidden from the results of a public WHOIS query. The privacy services
+         * are provided by the AWS registrar, Gandi. For more information, see the <a
+         * href="http://www.gandi.net/domain/whois/?currency=USD&amp;amp;lang=en">Gandi
+         * privacy features</a>.</p> <p>This operation only affects the privacy of the
+         * specified contact type (registrant, administrator, or tech). Successful
+         * acceptance returns an operation ID that you can use with GetOperationDetail to
+         * track the progress and completion of the action. If the request is not completed
+         * successfully, the domain registrant will be notified by email.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateDomainContactPrivacyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDomainContactPrivacyRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDomainContactPrivacyOutcome> UpdateDomainContactPrivacyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDomainContactPrivacyOutcome>([this, request](const std::function<void(Model::UpdateDomainContactPrivacyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDomainContactPrivacyAsync(request, [complete](const Route53DomainsClient*, const Model::UpdateDomainContactPrivacyRequest&, const Model::UpdateDomainContactPrivacyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDomainContactPrivacyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation replaces the current set of name servers for the domain with
          * the specified set of name servers. If you use Amazon Route 53 as your DNS
@@ -782,6 +1203,33 @@ namespace Model
          */
         virtual void UpdateDomainNameserversAsync(const Model::UpdateDomainNameserversRequest& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation replaces the current set of name servers for the domain with
+         * the specified set of name servers. If you use Amazon Route 53 as your DNS
+         * service, specify the four name servers in the delegation set for the hosted zone
+         * for the domain. </p> <p>If successful, this operation returns an operation ID
+         * that you can use to track the progress and completion of the action. If the
+         * request is not completed successfully, the domain registrant will be notified by
+         * email.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateDomainNameserversAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateDomainNameserversRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateDomainNameserversOutcome> UpdateDomainNameserversAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateDomainNameserversOutcome>([this, request](const std::function<void(Model::UpdateDomainNameserversOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateDomainNameserversAsync(request, [complete](const Route53DomainsClient*, const Model::UpdateDomainNameserversRequest&, const Model::UpdateDomainNameserversOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateDomainNameserversOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>This operation adds or updates tags for a specified domain.</p> <p>All tag
          * operations are eventually consistent; subsequent operations may not immediately
@@ -807,6 +1255,29 @@ namespace Model
          */
         virtual void UpdateTagsForDomainAsync(const Model::UpdateTagsForDomainRequest& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>This operation adds or updates tags for a specified domain.</p> <p>All tag
+         * operations are eventually consistent; subsequent operations may not immediately
+         * represent all issued operations.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateTagsForDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateTagsForDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateTagsForDomainOutcome> UpdateTagsForDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateTagsForDomainOutcome>([this, request](const std::function<void(Model::UpdateTagsForDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateTagsForDomainAsync(request, [complete](const Route53DomainsClient*, const Model::UpdateTagsForDomainRequest&, const Model::UpdateTagsForDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateTagsForDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -55,6 +55,7 @@
 #include <aws/s3/model/UploadPartCopyResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -367,6 +368,29 @@ namespace Aws
          */
         virtual void AbortMultipartUploadAsync(const Model::AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Aborts a multipart upload.</p><p>To verify that all parts have been removed,
+         * so you don't get charged for the part storage, you should call the List Parts
+         * operation and ensure the parts list is empty.</p>
+         *
+         * Returns an awaitable that starts the operation the way AbortMultipartUploadAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AbortMultipartUploadRequest>
+        Aws::Utils::Threading::Awaitable<Model::AbortMultipartUploadOutcome> AbortMultipartUploadAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AbortMultipartUploadOutcome>([this, request](const std::function<void(Model::AbortMultipartUploadOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AbortMultipartUploadAsync(request, [complete](const S3Client*, const Model::AbortMultipartUploadRequest&, const Model::AbortMultipartUploadOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AbortMultipartUploadOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Completes a multipart upload by assembling previously uploaded parts.
          */
@@ -386,6 +410,27 @@ namespace Aws
          */
         virtual void CompleteMultipartUploadAsync(const Model::CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Completes a multipart upload by assembling previously uploaded parts.
+         *
+         * Returns an awaitable that starts the operation the way CompleteMultipartUploadAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CompleteMultipartUploadRequest>
+        Aws::Utils::Threading::Awaitable<Model::CompleteMultipartUploadOutcome> CompleteMultipartUploadAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CompleteMultipartUploadOutcome>([this, request](const std::function<void(Model::CompleteMultipartUploadOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CompleteMultipartUploadAsync(request, [complete](const S3Client*, const Model::CompleteMultipartUploadRequest&, const Model::CompleteMultipartUploadOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CompleteMultipartUploadOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Creates a copy of an object that is already stored in Amazon S3.
          */
@@ -405,6 +450,27 @@ namespace Aws
          */
         virtual void CopyObjectAsync(const Model::CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Creates a copy of an object that is already stored in Amazon S3.
+         *
+         * Returns an awaitable that starts the operation the way CopyObjectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CopyObjectRequest>
+        Aws::Utils::Threading::Awaitable<Model::CopyObjectOutcome> CopyObjectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CopyObjectOutcome>([this, request](const std::function<void(Model::CopyObjectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CopyObjectAsync(request, [complete](const S3Client*, const Model::CopyObjectRequest&, const Model::CopyObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CopyObjectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Creates a new bucket.
          */
@@ -424,6 +490,27 @@ namespace Aws
          */
         virtual void CreateBucketAsync(const Model::CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Creates a new bucket.
+         *
+         * Returns an awaitable that starts the operation the way CreateBucketAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateBucketRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateBucketOutcome> CreateBucketAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateBucketOutcome>([this, request](const std::function<void(Model::CreateBucketOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateBucketAsync(request, [complete](const S3Client*, const Model::CreateBucketRequest&, const Model::CreateBucketOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateBucketOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Initiates a multipart upload and returns an upload ID.</p><p><b>Note:</b>
          * After you initiate multipart upload and upload one or more parts, you must
@@ -458,6 +545,32 @@ namespace Aws
          */
         virtual void CreateMultipartUploadAsync(const Model::CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Initiates a multipart upload and returns an upload ID.</p><p><b>Note:</b>
+         * After you initiate multipart upload and upload one or more parts, you must
+         * either complete or abort multipart upload in order to stop getting charged for
+         * storage of the uploaded parts. Only after you either complete or abort multipart
+         * upload, Amazon S3 frees up the parts storage and stops charging you for the
+         * parts storage.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateMultipartUploadAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateMultipartUploadRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateMultipartUploadOutcome> CreateMultipartUploadAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateMultipartUploadOutcome>([this, request](const std::function<void(Model::CreateMultipartUploadOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateMultipartUploadAsync(request, [complete](const S3Client*, const Model::CreateMultipartUploadRequest&, const Model::CreateMultipartUploadOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateMultipartUploadOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Deletes the bucket. All objects (including all object versions and Delete
          * Markers) in the bucket must be deleted before the bucket itself can be deleted.
@@ -480,6 +593,28 @@ namespace Aws
          */
         virtual void DeleteBucketAsync(const Model::DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Deletes the bucket. All objects (including all object versions and Delete
+         * Markers) in the bucket must be deleted before the bucket itself can be deleted.
+         *
+         * Returns an awaitable that starts the operation the way DeleteBucketAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBucketRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBucketOutcome> DeleteBucketAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBucketOutcome>([this, request](const std::function<void(Model::DeleteBucketOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBucketAsync(request, [complete](const S3Client*, const Model::DeleteBucketRequest&, const Model::DeleteBucketOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBucketOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Deletes the cors configuration information set for the bucket.
          */
@@ -499,6 +634,27 @@ namespace Aws
          */
         virtual void DeleteBucketCorsAsync(const Model::DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Deletes the cors configuration information set for the bucket.
+         *
+         * Returns an awaitable that starts the operation the way DeleteBucketCorsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBucketCorsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBucketCorsOutcome> DeleteBucketCorsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBucketCorsOutcome>([this, request](const std::function<void(Model::DeleteBucketCorsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBucketCorsAsync(request, [complete](const S3Client*, const Model::DeleteBucketCorsRequest&, const Model::DeleteBucketCorsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBucketCorsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Deletes the lifecycle configuration from the bucket.
          */
@@ -518,6 +674,27 @@ namespace Aws
          */
         virtual void DeleteBucketLifecycleAsync(const Model::DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Deletes the lifecycle configuration from the bucket.
+         *
+         * Returns an awaitable that starts the operation the way DeleteBucketLifecycleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBucketLifecycleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBucketLifecycleOutcome> DeleteBucketLifecycleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBucketLifecycleOutcome>([this, request](const std::function<void(Model::DeleteBucketLifecycleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBucketLifecycleAsync(request, [complete](const S3Client*, const Model::DeleteBucketLifecycleRequest&, const Model::DeleteBucketLifecycleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBucketLifecycleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Deletes the policy from the bucket.
          */
@@ -537,6 +714,27 @@ namespace Aws
          */
         virtual void DeleteBucketPolicyAsync(const Model::DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Deletes the policy from the bucket.
+         *
+         * Returns an awaitable that starts the operation the way DeleteBucketPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBucketPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBucketPolicyOutcome> DeleteBucketPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBucketPolicyOutcome>([this, request](const std::function<void(Model::DeleteBucketPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBucketPolicyAsync(request, [complete](const S3Client*, const Model::DeleteBucketPolicyRequest&, const Model::DeleteBucketPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBucketPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Deletes the replication configuration from the bucket.
          */
@@ -556,6 +754,27 @@ namespace Aws
          */
         virtual void DeleteBucketReplicationAsync(const Model::DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Deletes the replication configuration from the bucket.
+         *
+         * Returns an awaitable that starts the operation the way DeleteBucketReplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBucketReplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBucketReplicationOutcome> DeleteBucketReplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBucketReplicationOutcome>([this, request](const std::function<void(Model::DeleteBucketReplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBucketReplicationAsync(request, [complete](const S3Client*, const Model::DeleteBucketReplicationRequest&, const Model::DeleteBucketReplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBucketReplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Deletes the tags from the bucket.
          */
@@ -575,6 +794,27 @@ namespace Aws
          */
         virtual void DeleteBucketTaggingAsync(const Model::DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Deletes the tags from the bucket.
+         *
+         * Returns an awaitable that starts the operation the way DeleteBucketTaggingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBucketTaggingRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBucketTaggingOutcome> DeleteBucketTaggingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBucketTaggingOutcome>([this, request](const std::function<void(Model::DeleteBucketTaggingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBucketTaggingAsync(request, [complete](const S3Client*, const Model::DeleteBucketTaggingRequest&, const Model::DeleteBucketTaggingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBucketTaggingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * This operation removes the website configuration from the bucket.
          */
@@ -594,6 +834,27 @@ namespace Aws
          */
         virtual void DeleteBucketWebsiteAsync(const Model::DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * This operation removes the website configuration from the bucket.
+         *
+         * Returns an awaitable that starts the operation the way DeleteBucketWebsiteAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBucketWebsiteRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBucketWebsiteOutcome> DeleteBucketWebsiteAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBucketWebsiteOutcome>([this, request](const std::function<void(Model::DeleteBucketWebsiteOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBucketWebsiteAsync(request, [complete](const S3Client*, const Model::DeleteBucketWebsiteRequest&, const Model::DeleteBucketWebsiteOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBucketWebsiteOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Removes the null version (if there is one) of an object and inserts a delete
          * marker, which becomes the latest version of the object. If there isn't a null
@@ -619,6 +880,29 @@ namespace Aws
          */
         virtual void DeleteObjectAsync(const Model::DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Removes the null version (if there is one) of an object and inserts a delete
+         * marker, which becomes the latest version of the object. If there isn't a null
+         * version, Amazon S3 does not remove any objects.
+         *
+         * Returns an awaitable that starts the operation the way DeleteObjectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteObjectRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteObjectOutcome> DeleteObjectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteObjectOutcome>([this, request](const std::function<void(Model::DeleteObjectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteObjectAsync(request, [complete](const S3Client*, const Model::DeleteObjectRequest&, const Model::DeleteObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteObjectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * This operation enables you to delete multiple objects from a bucket using a
          * single HTTP request. You may specify up to 1000 keys.
@@ -641,6 +925,28 @@ namespace Aws
          */
         virtual void DeleteObjectsAsync(const Model::DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * This operation enables you to delete multiple objects from a bucket using a
+         * single HTTP request. You may specify up to 1000 keys.
+         *
+         * Returns an awaitable that starts the operation the way DeleteObjectsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteObjectsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteObjectsOutcome> DeleteObjectsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteObjectsOutcome>([this, request](const std::function<void(Model::DeleteObjectsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteObjectsAsync(request, [complete](const S3Client*, const Model::DeleteObjectsRequest&, const Model::DeleteObjectsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteObjectsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Gets the access control policy for the bucket.
          */
@@ -660,6 +966,27 @@ namespace Aws
          */
         virtual void GetBucketAclAsync(const Model::GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Gets the access control policy for the bucket.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketAclAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketAclRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketAclOutcome> GetBucketAclAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketAclOutcome>([this, request](const std::function<void(Model::GetBucketAclOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketAclAsync(request, [complete](const S3Client*, const Model::GetBucketAclRequest&, const Model::GetBucketAclOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketAclOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the cors configuration for the bucket.
          */
@@ -679,6 +1006,27 @@ namespace Aws
          */
         virtual void GetBucketCorsAsync(const Model::GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the cors configuration for the bucket.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketCorsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketCorsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketCorsOutcome> GetBucketCorsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketCorsOutcome>([this, request](const std::function<void(Model::GetBucketCorsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketCorsAsync(request, [complete](const S3Client*, const Model::GetBucketCorsRequest&, const Model::GetBucketCorsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketCorsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the lifecycle configuration information set on the bucket.
          */
@@ -698,6 +1046,27 @@ namespace Aws
          */
         virtual void GetBucketLifecycleConfigurationAsync(const Model::GetBucketLifecycleConfigurationRequest& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the lifecycle configuration information set on the bucket.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketLifecycleConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketLifecycleConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketLifecycleConfigurationOutcome> GetBucketLifecycleConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketLifecycleConfigurationOutcome>([this, request](const std::function<void(Model::GetBucketLifecycleConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketLifecycleConfigurationAsync(request, [complete](const S3Client*, const Model::GetBucketLifecycleConfigurationRequest&, const Model::GetBucketLifecycleConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketLifecycleConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the region the bucket resides in.
          */
@@ -717,6 +1086,27 @@ namespace Aws
          */
         virtual void GetBucketLocationAsync(const Model::GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the region the bucket resides in.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketLocationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketLocationRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketLocationOutcome> GetBucketLocationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketLocationOutcome>([this, request](const std::function<void(Model::GetBucketLocationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketLocationAsync(request, [complete](const S3Client*, const Model::GetBucketLocationRequest&, const Model::GetBucketLocationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketLocationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the logging status of a bucket and the permissions users have to view
          * and modify that status. To use GET, you must be the bucket owner.
@@ -739,6 +1129,28 @@ namespace Aws
          */
         virtual void GetBucketLoggingAsync(const Model::GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the logging status of a bucket and the permissions users have to view
+         * and modify that status. To use GET, you must be the bucket owner.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketLoggingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketLoggingRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketLoggingOutcome> GetBucketLoggingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketLoggingOutcome>([this, request](const std::function<void(Model::GetBucketLoggingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketLoggingAsync(request, [complete](const S3Client*, const Model::GetBucketLoggingRequest&, const Model::GetBucketLoggingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketLoggingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the notification configuration of a bucket.
          */
@@ -758,6 +1170,27 @@ namespace Aws
          */
         virtual void GetBucketNotificationConfigurationAsync(const Model::GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the notification configuration of a bucket.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketNotificationConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketNotificationConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketNotificationConfigurationOutcome> GetBucketNotificationConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketNotificationConfigurationOutcome>([this, request](const std::function<void(Model::GetBucketNotificationConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketNotificationConfigurationAsync(request, [complete](const S3Client*, const Model::GetBucketNotificationConfigurationRequest&, const Model::GetBucketNotificationConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketNotificationConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the policy of a specified bucket.
          */
@@ -777,6 +1210,27 @@ namespace Aws
          */
         virtual void GetBucketPolicyAsync(const Model::GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the policy of a specified bucket.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketPolicyOutcome> GetBucketPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketPolicyOutcome>([this, request](const std::function<void(Model::GetBucketPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketPolicyAsync(request, [complete](const S3Client*, const Model::GetBucketPolicyRequest&, const Model::GetBucketPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Deprecated, see the GetBucketReplicationConfiguration operation.
          */
@@ -796,6 +1250,27 @@ namespace Aws
          */
         virtual void GetBucketReplicationAsync(const Model::GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Deprecated, see the GetBucketReplicationConfiguration operation.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketReplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketReplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketReplicationOutcome> GetBucketReplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketReplicationOutcome>([this, request](const std::function<void(Model::GetBucketReplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketReplicationAsync(request, [complete](const S3Client*, const Model::GetBucketReplicationRequest&, const Model::GetBucketReplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketReplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the request payment configuration of a bucket.
          */
@@ -815,6 +1290,27 @@ namespace Aws
          */
         virtual void GetBucketRequestPaymentAsync(const Model::GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the request payment configuration of a bucket.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketRequestPaymentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketRequestPaymentRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketRequestPaymentOutcome> GetBucketRequestPaymentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketRequestPaymentOutcome>([this, request](const std::function<void(Model::GetBucketRequestPaymentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketRequestPaymentAsync(request, [complete](const S3Client*, const Model::GetBucketRequestPaymentRequest&, const Model::GetBucketRequestPaymentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketRequestPaymentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the tag set associated with the bucket.
          */
@@ -834,6 +1330,27 @@ namespace Aws
          */
         virtual void GetBucketTaggingAsync(const Model::GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the tag set associated with the bucket.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketTaggingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketTaggingRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketTaggingOutcome> GetBucketTaggingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketTaggingOutcome>([this, request](const std::function<void(Model::GetBucketTaggingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketTaggingAsync(request, [complete](const S3Client*, const Model::GetBucketTaggingRequest&, const Model::GetBucketTaggingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketTaggingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the versioning state of a bucket.
          */
@@ -853,6 +1370,27 @@ namespace Aws
          */
         virtual void GetBucketVersioningAsync(const Model::GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the versioning state of a bucket.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketVersioningAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketVersioningRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketVersioningOutcome> GetBucketVersioningAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketVersioningOutcome>([this, request](const std::function<void(Model::GetBucketVersioningOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketVersioningAsync(request, [complete](const S3Client*, const Model::GetBucketVersioningRequest&, const Model::GetBucketVersioningOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketVersioningOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the website configuration for a bucket.
          */
@@ -872,6 +1410,27 @@ namespace Aws
          */
         virtual void GetBucketWebsiteAsync(const Model::GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the website configuration for a bucket.
+         *
+         * Returns an awaitable that starts the operation the way GetBucketWebsiteAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetBucketWebsiteRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetBucketWebsiteOutcome> GetBucketWebsiteAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetBucketWebsiteOutcome>([this, request](const std::function<void(Model::GetBucketWebsiteOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetBucketWebsiteAsync(request, [complete](const S3Client*, const Model::GetBucketWebsiteRequest&, const Model::GetBucketWebsiteOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetBucketWebsiteOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Retrieves objects from Amazon S3.
          */
@@ -891,6 +1450,27 @@ namespace Aws
          */
         virtual void GetObjectAsync(const Model::GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Retrieves objects from Amazon S3.
+         *
+         * Returns an awaitable that starts the operation the way GetObjectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetObjectRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetObjectOutcome> GetObjectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetObjectOutcome>([this, request](const std::function<void(Model::GetObjectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetObjectAsync(request, [complete](const S3Client*, const Model::GetObjectRequest&, const Model::GetObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetObjectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns the access control list (ACL) of an object.
          */
@@ -910,6 +1490,27 @@ namespace Aws
          */
         virtual void GetObjectAclAsync(const Model::GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns the access control list (ACL) of an object.
+         *
+         * Returns an awaitable that starts the operation the way GetObjectAclAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetObjectAclRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetObjectAclOutcome> GetObjectAclAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetObjectAclOutcome>([this, request](const std::function<void(Model::GetObjectAclOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetObjectAclAsync(request, [complete](const S3Client*, const Model::GetObjectAclRequest&, const Model::GetObjectAclOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetObjectAclOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Return torrent files from a bucket.
          */
@@ -929,6 +1530,27 @@ namespace Aws
          */
         virtual void GetObjectTorrentAsync(const Model::GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Return torrent files from a bucket.
+         *
+         * Returns an awaitable that starts the operation the way GetObjectTorrentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetObjectTorrentRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetObjectTorrentOutcome> GetObjectTorrentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetObjectTorrentOutcome>([this, request](const std::function<void(Model::GetObjectTorrentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetObjectTorrentAsync(request, [complete](const S3Client*, const Model::GetObjectTorrentRequest&, const Model::GetObjectTorrentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetObjectTorrentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * This operation is useful to determine if a bucket exists and you have permission
          * to access it.
@@ -951,6 +1573,28 @@ namespace Aws
          */
         virtual void HeadBucketAsync(const Model::HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * This operation is useful to determine if a bucket exists and you have permission
+         * to access it.
+         *
+         * Returns an awaitable that starts the operation the way HeadBucketAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::HeadBucketRequest>
+        Aws::Utils::Threading::Awaitable<Model::HeadBucketOutcome> HeadBucketAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::HeadBucketOutcome>([this, request](const std::function<void(Model::HeadBucketOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->HeadBucketAsync(request, [complete](const S3Client*, const Model::HeadBucketRequest&, const Model::HeadBucketOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::HeadBucketOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * The HEAD operation retrieves metadata from an object without returning the
          * object itself. This operation is useful if you're only interested in an object's
@@ -976,6 +1620,29 @@ namespace Aws
          */
         virtual void HeadObjectAsync(const Model::HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * The HEAD operation retrieves metadata from an object without returning the
+         * object itself. This operation is useful if you're only interested in an object's
+         * metadata. To use HEAD, you must have READ access to the object.
+         *
+         * Returns an awaitable that starts the operation the way HeadObjectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::HeadObjectRequest>
+        Aws::Utils::Threading::Awaitable<Model::HeadObjectOutcome> HeadObjectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::HeadObjectOutcome>([this, request](const std::function<void(Model::HeadObjectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->HeadObjectAsync(request, [complete](const S3Client*, const Model::HeadObjectRequest&, const Model::HeadObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::HeadObjectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns a list of all buckets owned by the authenticated sender of the request.
          */
@@ -994,6 +1661,26 @@ namespace Aws
          * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
         virtual void ListBucketsAsync(const ListBucketsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns a list of all buckets owned by the authenticated sender of the request.
+         *
+         * Returns an awaitable that starts the operation the way ListBucketsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        Aws::Utils::Threading::Awaitable<Model::ListBucketsOutcome> ListBucketsAwaitable() const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListBucketsOutcome>([this](const std::function<void(Model::ListBucketsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListBucketsAsync([complete](const S3Client*, const Model::ListBucketsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListBucketsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
         /**
          * This operation lists in-progress multipart uploads.
          */
@@ -1013,6 +1700,27 @@ namespace Aws
          */
         virtual void ListMultipartUploadsAsync(const Model::ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * This operation lists in-progress multipart uploads.
+         *
+         * Returns an awaitable that starts the operation the way ListMultipartUploadsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListMultipartUploadsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListMultipartUploadsOutcome> ListMultipartUploadsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListMultipartUploadsOutcome>([this, request](const std::function<void(Model::ListMultipartUploadsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListMultipartUploadsAsync(request, [complete](const S3Client*, const Model::ListMultipartUploadsRequest&, const Model::ListMultipartUploadsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListMultipartUploadsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns metadata about all of the versions of objects in a bucket.
          */
@@ -1032,6 +1740,27 @@ namespace Aws
          */
         virtual void ListObjectVersionsAsync(const Model::ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns metadata about all of the versions of objects in a bucket.
+         *
+         * Returns an awaitable that starts the operation the way ListObjectVersionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListObjectVersionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListObjectVersionsOutcome> ListObjectVersionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListObjectVersionsOutcome>([this, request](const std::function<void(Model::ListObjectVersionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListObjectVersionsAsync(request, [complete](const S3Client*, const Model::ListObjectVersionsRequest&, const Model::ListObjectVersionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListObjectVersionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Returns some or all (up to 1000) of the objects in a bucket. You can use the
          * request parameters as selection criteria to return a subset of the objects in a
@@ -1057,6 +1786,29 @@ namespace Aws
          */
         virtual void ListObjectsAsync(const Model::ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Returns some or all (up to 1000) of the objects in a bucket. You can use the
+         * request parameters as selection criteria to return a subset of the objects in a
+         * bucket.
+         *
+         * Returns an awaitable that starts the operation the way ListObjectsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListObjectsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListObjectsOutcome> ListObjectsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListObjectsOutcome>([this, request](const std::function<void(Model::ListObjectsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListObjectsAsync(request, [complete](const S3Client*, const Model::ListObjectsRequest&, const Model::ListObjectsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListObjectsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Lists the parts that have been uploaded for a specific multipart upload.
          */
@@ -1076,6 +1828,27 @@ namespace Aws
          */
         virtual void ListPartsAsync(const Model::ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Lists the parts that have been uploaded for a specific multipart upload.
+         *
+         * Returns an awaitable that starts the operation the way ListPartsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListPartsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListPartsOutcome> ListPartsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListPartsOutcome>([this, request](const std::function<void(Model::ListPartsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListPartsAsync(request, [complete](const S3Client*, const Model::ListPartsRequest&, const Model::ListPartsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListPartsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Sets the permissions on a bucket using access control lists (ACL).
          */
@@ -1095,6 +1868,27 @@ namespace Aws
          */
         virtual void PutBucketAclAsync(const Model::PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Sets the permissions on a bucket using access control lists (ACL).
+         *
+         * Returns an awaitable that starts the operation the way PutBucketAclAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketAclRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketAclOutcome> PutBucketAclAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketAclOutcome>([this, request](const std::function<void(Model::PutBucketAclOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketAclAsync(request, [complete](const S3Client*, const Model::PutBucketAclRequest&, const Model::PutBucketAclOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketAclOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Sets the cors configuration for a bucket.
          */
@@ -1114,6 +1908,27 @@ namespace Aws
          */
         virtual void PutBucketCorsAsync(const Model::PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Sets the cors configuration for a bucket.
+         *
+         * Returns an awaitable that starts the operation the way PutBucketCorsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketCorsRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketCorsOutcome> PutBucketCorsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketCorsOutcome>([this, request](const std::function<void(Model::PutBucketCorsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketCorsAsync(request, [complete](const S3Client*, const Model::PutBucketCorsRequest&, const Model::PutBucketCorsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketCorsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Sets lifecycle configuration for your bucket. If a lifecycle configuration
          * exists, it replaces it.
@@ -1136,6 +1951,28 @@ namespace Aws
          */
         virtual void PutBucketLifecycleConfigurationAsync(const Model::PutBucketLifecycleConfigurationRequest& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Sets lifecycle configuration for your bucket. If a lifecycle configuration
+         * exists, it replaces it.
+         *
+         * Returns an awaitable that starts the operation the way PutBucketLifecycleConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketLifecycleConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketLifecycleConfigurationOutcome> PutBucketLifecycleConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketLifecycleConfigurationOutcome>([this, request](const std::function<void(Model::PutBucketLifecycleConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketLifecycleConfigurationAsync(request, [complete](const S3Client*, const Model::PutBucketLifecycleConfigurationRequest&, const Model::PutBucketLifecycleConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketLifecycleConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Set the logging parameters for a bucket and to specify permissions for who can
          * view and modify the logging parameters. To set the logging status of a bucket,
@@ -1161,6 +1998,29 @@ namespace Aws
          */
         virtual void PutBucketLoggingAsync(const Model::PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Set the logging parameters for a bucket and to specify permissions for who can
+         * view and modify the logging parameters. To set the logging status of a bucket,
+         * you must be the bucket owner.
+         *
+         * Returns an awaitable that starts the operation the way PutBucketLoggingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketLoggingRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketLoggingOutcome> PutBucketLoggingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketLoggingOutcome>([this, request](const std::function<void(Model::PutBucketLoggingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketLoggingAsync(request, [complete](const S3Client*, const Model::PutBucketLoggingRequest&, const Model::PutBucketLoggingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketLoggingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Enables notifications of specified events for a bucket.
          */
@@ -1180,6 +2040,27 @@ namespace Aws
          */
         virtual void PutBucketNotificationConfigurationAsync(const Model::PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Enables notifications of specified events for a bucket.
+         *
+         * Returns an awaitable that starts the operation the way PutBucketNotificationConfigurationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketNotificationConfigurationRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketNotificationConfigurationOutcome> PutBucketNotificationConfigurationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketNotificationConfigurationOutcome>([this, request](const std::function<void(Model::PutBucketNotificationConfigurationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketNotificationConfigurationAsync(request, [complete](const S3Client*, const Model::PutBucketNotificationConfigurationRequest&, const Model::PutBucketNotificationConfigurationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketNotificationConfigurationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Replaces a policy on a bucket. If the bucket already has a policy, the one in
          * this request completely replaces it.
@@ -1202,6 +2083,28 @@ namespace Aws
          */
         virtual void PutBucketPolicyAsync(const Model::PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Replaces a policy on a bucket. If the bucket already has a policy, the one in
+         * this request completely replaces it.
+         *
+         * Returns an awaitable that starts the operation the way PutBucketPolicyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketPolicyRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketPolicyOutcome> PutBucketPolicyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketPolicyOutcome>([this, request](const std::function<void(Model::PutBucketPolicyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketPolicyAsync(request, [complete](const S3Client*, const Model::PutBucketPolicyRequest&, const Model::PutBucketPolicyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketPolicyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Creates a new replication configuration (or replaces an existing one, if
          * present).
@@ -1224,6 +2127,28 @@ namespace Aws
          */
         virtual void PutBucketReplicationAsync(const Model::PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Creates a new replication configuration (or replaces an existing one, if
+         * present).
+         *
+         * Returns an awaitable that starts the operation the way PutBucketReplicationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketReplicationRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketReplicationOutcome> PutBucketReplicationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketReplicationOutcome>([this, request](const std::function<void(Model::PutBucketReplicationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketReplicationAsync(request, [complete](const S3Client*, const Model::PutBucketReplicationRequest&, const Model::PutBucketReplicationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketReplicationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Sets the request payment configuration for a bucket. By default, the bucket
          * owner pays for downloads from the bucket. This configuration parameter enables
@@ -1258,6 +2183,32 @@ namespace Aws
          */
         virtual void PutBucketRequestPaymentAsync(const Model::PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Sets the request payment configuration for a bucket. By default, the bucket
+         * owner pays for downloads from the bucket. This configuration parameter enables
+         * the bucket owner (only) to specify that the person requesting the download will
+         * be charged for the download. Documentation on requester pays buckets can be
+         * found at
+         * http://docs.aws.amazon.com/AmazonS3/latest/dev/RequesterPaysBuckets.html
+         *
+         * Returns an awaitable that starts the operation the way PutBucketRequestPaymentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketRequestPaymentRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketRequestPaymentOutcome> PutBucketRequestPaymentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketRequestPaymentOutcome>([this, request](const std::function<void(Model::PutBucketRequestPaymentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketRequestPaymentAsync(request, [complete](const S3Client*, const Model::PutBucketRequestPaymentRequest&, const Model::PutBucketRequestPaymentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketRequestPaymentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Sets the tags for a bucket.
          */
@@ -1277,6 +2228,27 @@ namespace Aws
          */
         virtual void PutBucketTaggingAsync(const Model::PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Sets the tags for a bucket.
+         *
+         * Returns an awaitable that starts the operation the way PutBucketTaggingAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketTaggingRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketTaggingOutcome> PutBucketTaggingAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketTaggingOutcome>([this, request](const std::function<void(Model::PutBucketTaggingOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketTaggingAsync(request, [complete](const S3Client*, const Model::PutBucketTaggingRequest&, const Model::PutBucketTaggingOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketTaggingOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Sets the versioning state of an existing bucket. To set the versioning state,
          * you must be the bucket owner.
@@ -1299,6 +2271,28 @@ namespace Aws
          */
         virtual void PutBucketVersioningAsync(const Model::PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Sets the versioning state of an existing bucket. To set the versioning state,
+         * you must be the bucket owner.
+         *
+         * Returns an awaitable that starts the operation the way PutBucketVersioningAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketVersioningRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketVersioningOutcome> PutBucketVersioningAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketVersioningOutcome>([this, request](const std::function<void(Model::PutBucketVersioningOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketVersioningAsync(request, [complete](const S3Client*, const Model::PutBucketVersioningRequest&, const Model::PutBucketVersioningOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketVersioningOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Set the website configuration for a bucket.
          */
@@ -1318,6 +2312,27 @@ namespace Aws
          */
         virtual void PutBucketWebsiteAsync(const Model::PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Set the website configuration for a bucket.
+         *
+         * Returns an awaitable that starts the operation the way PutBucketWebsiteAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutBucketWebsiteRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutBucketWebsiteOutcome> PutBucketWebsiteAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutBucketWebsiteOutcome>([this, request](const std::function<void(Model::PutBucketWebsiteOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutBucketWebsiteAsync(request, [complete](const S3Client*, const Model::PutBucketWebsiteRequest&, const Model::PutBucketWebsiteOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutBucketWebsiteOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Adds an object to a bucket.
          */
@@ -1337,6 +2352,27 @@ namespace Aws
          */
         virtual void PutObjectAsync(const Model::PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Adds an object to a bucket.
+         *
+         * Returns an awaitable that starts the operation the way PutObjectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutObjectRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutObjectOutcome> PutObjectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutObjectOutcome>([this, request](const std::function<void(Model::PutObjectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutObjectAsync(request, [complete](const S3Client*, const Model::PutObjectRequest&, const Model::PutObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutObjectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * uses the acl subresource to set the access control list (ACL) permissions for an
          * object that already exists in a bucket
@@ -1359,6 +2395,28 @@ namespace Aws
          */
         virtual void PutObjectAclAsync(const Model::PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * uses the acl subresource to set the access control list (ACL) permissions for an
+         * object that already exists in a bucket
+         *
+         * Returns an awaitable that starts the operation the way PutObjectAclAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutObjectAclRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutObjectAclOutcome> PutObjectAclAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutObjectAclOutcome>([this, request](const std::function<void(Model::PutObjectAclOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutObjectAclAsync(request, [complete](const S3Client*, const Model::PutObjectAclRequest&, const Model::PutObjectAclOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutObjectAclOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Restores an archived copy of an object back into Amazon S3
          */
@@ -1378,6 +2436,27 @@ namespace Aws
          */
         virtual void RestoreObjectAsync(const Model::RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Restores an archived copy of an object back into Amazon S3
+         *
+         * Returns an awaitable that starts the operation the way RestoreObjectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RestoreObjectRequest>
+        Aws::Utils::Threading::Awaitable<Model::RestoreObjectOutcome> RestoreObjectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RestoreObjectOutcome>([this, request](const std::function<void(Model::RestoreObjectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RestoreObjectAsync(request, [complete](const S3Client*, const Model::RestoreObjectRequest&, const Model::RestoreObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RestoreObjectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Uploads a part in a multipart upload.</p><p><b>Note:</b> After you initiate
          * multipart upload and upload one or more parts, you must either complete or abort
@@ -1409,6 +2488,31 @@ namespace Aws
          */
         virtual void UploadPartAsync(const Model::UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Uploads a part in a multipart upload.</p><p><b>Note:</b> After you initiate
+         * multipart upload and upload one or more parts, you must either complete or abort
+         * multipart upload in order to stop getting charged for storage of the uploaded
+         * parts. Only after you either complete or abort multipart upload, Amazon S3 frees
+         * up the parts storage and stops charging you for the parts storage.</p>
+         *
+         * Returns an awaitable that starts the operation the way UploadPartAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UploadPartRequest>
+        Aws::Utils::Threading::Awaitable<Model::UploadPartOutcome> UploadPartAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UploadPartOutcome>([this, request](const std::function<void(Model::UploadPartOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UploadPartAsync(request, [complete](const S3Client*, const Model::UploadPartRequest&, const Model::UploadPartOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UploadPartOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Uploads a part by copying data from an existing object as data source.
          */
@@ -1428,6 +2532,27 @@ namespace Aws
          */
         virtual void UploadPartCopyAsync(const Model::UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Uploads a part by copying data from an existing object as data source.
+         *
+         * Returns an awaitable that starts the operation the way UploadPartCopyAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UploadPartCopyRequest>
+        Aws::Utils::Threading::Awaitable<Model::UploadPartCopyOutcome> UploadPartCopyAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UploadPartCopyOutcome>([this, request](const std::function<void(Model::UploadPartCopyOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UploadPartCopyAsync(request, [complete](const S3Client*, const Model::UploadPartCopyRequest&, const Model::UploadPartCopyOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UploadPartCopyOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
         Aws::String GeneratePresignedUrl(const Aws::String& bucketName, const Aws::String& key, Http::HttpMethod method, long long expirationInSeconds = MAX_EXPIRATION_SECONDS);
 
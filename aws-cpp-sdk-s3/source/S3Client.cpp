@@ -93,7 +93,7 @@ static const char* ALLOCATION_TAG = "S3Client";
 S3Client::S3Client(const Client::ClientConfiguration& clientConfiguration) :
   BASECLASS(Aws::MakeShared<HttpClientFactory>(ALLOCATION_TAG), clientConfiguration,
     Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, Aws::MakeShared<DefaultAWSCredentialsProviderChain>(ALLOCATION_TAG),
-        SERVICE_NAME, clientConfiguration.authenticationRegion.empty() ? RegionMapper::GetRegionName(clientConfiguration.region) : clientConfiguration.authenticationRegion),
+        SERVICE_NAME, clientConfiguration.authenticationRegion.empty() ? RegionMapper::GetRegionName(clientConfiguration.region) : clientConfiguration.authenticationRegion, clientConfiguration.payloadSigningPolicy),
     Aws::MakeShared<S3ErrorMarshaller>(ALLOCATION_TAG)),
     m_executor(clientConfiguration.executor)
 {
@@ -103,7 +103,7 @@ S3Client::S3Client(const Client::ClientConfiguration& clientConfiguration) :
 S3Client::S3Client(const AWSCredentials& credentials, const Client::ClientConfiguration& clientConfiguration) :
   BASECLASS(Aws::MakeShared<HttpClientFactory>(ALLOCATION_TAG), clientConfiguration,
     Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, credentials),
-         SERVICE_NAME, clientConfiguration.authenticationRegion.empty() ? RegionMapper::GetRegionName(clientConfiguration.region) : clientConfiguration.authenticationRegion),
+         SERVICE_NAME, clientConfiguration.authenticationRegion.empty() ? RegionMapper::GetRegionName(clientConfiguration.region) : clientConfiguration.authenticationRegion, clientConfiguration.payloadSigningPolicy),
     Aws::MakeShared<S3ErrorMarshaller>(ALLOCATION_TAG)),
     m_executor(clientConfiguration.executor)
 {
@@ -114,7 +114,7 @@ S3Client::S3Client(const std::shared_ptr<AWSCredentialsProvider>& credentialsPro
   const Client::ClientConfiguration& clientConfiguration, const std::shared_ptr<HttpClientFactory const>& httpClientFactory) :
   BASECLASS(httpClientFactory != nullptr ? httpClientFactory : Aws::MakeShared<HttpClientFactory>(ALLOCATION_TAG), clientConfiguration,
     Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, credentialsProvider,
-         SERVICE_NAME, clientConfiguration.authenticationRegion.empty() ? RegionMapper::GetRegionName(clientConfiguration.region) : clientConfiguration.authenticationRegion),
+         SERVICE_NAME, clientConfiguration.authenticationRegion.empty() ? RegionMapper::GetRegionName(clientConfiguration.region) : clientConfiguration.authenticationRegion, clientConfiguration.payloadSigningPolicy),
     Aws::MakeShared<S3ErrorMarshaller>(ALLOCATION_TAG)),
     m_executor(clientConfiguration.executor)
 {
@@ -148,7 +148,7 @@ AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartU
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "AbortMultipartUpload");
   if(outcome.IsSuccess())
   {
     return AbortMultipartUploadOutcome(AbortMultipartUploadResult(outcome.GetResult()));
@@ -161,17 +161,44 @@ AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartU
 
 AbortMultipartUploadOutcomeCallable S3Client::AbortMultipartUploadCallable(const AbortMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::AbortMultipartUpload, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AbortMultipartUploadOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AbortMultipartUpload( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< AbortMultipartUploadOutcome > rejected;
+    rejected.set_value(AbortMultipartUploadOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::AbortMultipartUploadAsync(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::AbortMultipartUploadAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::AbortMultipartUploadAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, AbortMultipartUploadOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::AbortMultipartUploadAsyncHelper(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, AbortMultipartUpload(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto sharedRequest = Aws::MakeShared<AbortMultipartUploadRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "AbortMultipartUpload", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AbortMultipartUploadOutcome(AbortMultipartUploadResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AbortMultipartUploadOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteMultipartUploadRequest& request) const
@@ -181,7 +208,7 @@ CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteM
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CompleteMultipartUpload");
   if(outcome.IsSuccess())
   {
     return CompleteMultipartUploadOutcome(CompleteMultipartUploadResult(outcome.GetResult()));
@@ -194,17 +221,44 @@ CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteM
 
 CompleteMultipartUploadOutcomeCallable S3Client::CompleteMultipartUploadCallable(const CompleteMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::CompleteMultipartUpload, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CompleteMultipartUploadOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CompleteMultipartUpload( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CompleteMultipartUploadOutcome > rejected;
+    rejected.set_value(CompleteMultipartUploadOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::CompleteMultipartUploadAsync(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::CompleteMultipartUploadAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::CompleteMultipartUploadAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CompleteMultipartUploadOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::CompleteMultipartUploadAsyncHelper(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CompleteMultipartUpload(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto sharedRequest = Aws::MakeShared<CompleteMultipartUploadRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CompleteMultipartUpload", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CompleteMultipartUploadOutcome(CompleteMultipartUploadResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CompleteMultipartUploadOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
@@ -214,7 +268,7 @@ CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "CopyObject");
   if(outcome.IsSuccess())
   {
     return CopyObjectOutcome(CopyObjectResult(outcome.GetResult()));
@@ -227,17 +281,44 @@ CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
 
 CopyObjectOutcomeCallable S3Client::CopyObjectCallable(const CopyObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::CopyObject, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CopyObjectOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CopyObject( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CopyObjectOutcome > rejected;
+    rejected.set_value(CopyObjectOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::CopyObjectAsync(const CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::CopyObjectAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::CopyObjectAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CopyObjectOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::CopyObjectAsyncHelper(const CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CopyObject(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto sharedRequest = Aws::MakeShared<CopyObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "CopyObject", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CopyObjectOutcome(CopyObjectResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CopyObjectOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) const
@@ -245,7 +326,7 @@ CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) c
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "CreateBucket");
   if(outcome.IsSuccess())
   {
     return CreateBucketOutcome(CreateBucketResult(outcome.GetResult()));
@@ -258,17 +339,42 @@ CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) c
 
 CreateBucketOutcomeCallable S3Client::CreateBucketCallable(const CreateBucketRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::CreateBucket, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateBucketOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateBucket( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateBucketOutcome > rejected;
+    rejected.set_value(CreateBucketOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::CreateBucketAsync(const CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::CreateBucketAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::CreateBucketAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateBucketOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::CreateBucketAsyncHelper(const CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateBucket(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  auto sharedRequest = Aws::MakeShared<CreateBucketRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "CreateBucket", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateBucketOutcome(CreateBucketResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateBucketOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipartUploadRequest& request) const
@@ -279,7 +385,7 @@ CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipa
   ss << "/";
   ss << request.GetKey();
   ss << "?uploads";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateMultipartUpload");
   if(outcome.IsSuccess())
   {
     return CreateMultipartUploadOutcome(CreateMultipartUploadResult(outcome.GetResult()));
@@ -292,17 +398,45 @@ CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipa
 
 CreateMultipartUploadOutcomeCallable S3Client::CreateMultipartUploadCallable(const CreateMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::CreateMultipartUpload, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateMultipartUploadOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateMultipartUpload( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateMultipartUploadOutcome > rejected;
+    rejected.set_value(CreateMultipartUploadOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::CreateMultipartUploadAsync(const CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::CreateMultipartUploadAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::CreateMultipartUploadAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateMultipartUploadOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::CreateMultipartUploadAsyncHelper(const CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateMultipartUpload(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  ss << "?uploads";
+  auto sharedRequest = Aws::MakeShared<CreateMultipartUploadRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateMultipartUpload", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateMultipartUploadOutcome(CreateMultipartUploadResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateMultipartUploadOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) const
@@ -310,7 +444,7 @@ DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) c
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteBucket");
   if(outcome.IsSuccess())
   {
     return DeleteBucketOutcome(NoResult());
@@ -323,17 +457,42 @@ DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) c
 
 DeleteBucketOutcomeCallable S3Client::DeleteBucketCallable(const DeleteBucketRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucket, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteBucketOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBucket( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteBucketOutcome > rejected;
+    rejected.set_value(DeleteBucketOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::DeleteBucketAsync(const DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::DeleteBucketAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteBucketOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::DeleteBucketAsyncHelper(const DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucket(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  auto sharedRequest = Aws::MakeShared<DeleteBucketRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteBucket", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBucketOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBucketOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest& request) const
@@ -342,7 +501,7 @@ DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?cors";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteBucketCors");
   if(outcome.IsSuccess())
   {
     return DeleteBucketCorsOutcome(NoResult());
@@ -355,17 +514,43 @@ DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest
 
 DeleteBucketCorsOutcomeCallable S3Client::DeleteBucketCorsCallable(const DeleteBucketCorsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketCors, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteBucketCorsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBucketCors( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteBucketCorsOutcome > rejected;
+    rejected.set_value(DeleteBucketCorsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::DeleteBucketCorsAsync(const DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketCorsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::DeleteBucketCorsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteBucketCorsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::DeleteBucketCorsAsyncHelper(const DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketCors(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?cors";
+  auto sharedRequest = Aws::MakeShared<DeleteBucketCorsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteBucketCors", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBucketCorsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBucketCorsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketLifecycleRequest& request) const
@@ -374,7 +559,7 @@ DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketL
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?lifecycle";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteBucketLifecycle");
   if(outcome.IsSuccess())
   {
     return DeleteBucketLifecycleOutcome(NoResult());
@@ -387,17 +572,43 @@ DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketL
 
 DeleteBucketLifecycleOutcomeCallable S3Client::DeleteBucketLifecycleCallable(const DeleteBucketLifecycleRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketLifecycle, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteBucketLifecycleOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBucketLifecycle( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteBucketLifecycleOutcome > rejected;
+    rejected.set_value(DeleteBucketLifecycleOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::DeleteBucketLifecycleAsync(const DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketLifecycleAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::DeleteBucketLifecycleAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteBucketLifecycleOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::DeleteBucketLifecycleAsyncHelper(const DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketLifecycle(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?lifecycle";
+  auto sharedRequest = Aws::MakeShared<DeleteBucketLifecycleRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteBucketLifecycle", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBucketLifecycleOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBucketLifecycleOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyRequest& request) const
@@ -406,7 +617,7 @@ DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyR
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?policy";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteBucketPolicy");
   if(outcome.IsSuccess())
   {
     return DeleteBucketPolicyOutcome(NoResult());
@@ -419,17 +630,43 @@ DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyR
 
 DeleteBucketPolicyOutcomeCallable S3Client::DeleteBucketPolicyCallable(const DeleteBucketPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteBucketPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBucketPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteBucketPolicyOutcome > rejected;
+    rejected.set_value(DeleteBucketPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::DeleteBucketPolicyAsync(const DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::DeleteBucketPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteBucketPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::DeleteBucketPolicyAsyncHelper(const DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?policy";
+  auto sharedRequest = Aws::MakeShared<DeleteBucketPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteBucketPolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBucketPolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBucketPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBucketReplicationRequest& request) const
@@ -438,7 +675,7 @@ DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBuc
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?replication";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteBucketReplication");
   if(outcome.IsSuccess())
   {
     return DeleteBucketReplicationOutcome(NoResult());
@@ -451,17 +688,43 @@ DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBuc
 
 DeleteBucketReplicationOutcomeCallable S3Client::DeleteBucketReplicationCallable(const DeleteBucketReplicationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketReplication, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteBucketReplicationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBucketReplication( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteBucketReplicationOutcome > rejected;
+    rejected.set_value(DeleteBucketReplicationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::DeleteBucketReplicationAsync(const DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketReplicationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::DeleteBucketReplicationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteBucketReplicationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::DeleteBucketReplicationAsyncHelper(const DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketReplication(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?replication";
+  auto sharedRequest = Aws::MakeShared<DeleteBucketReplicationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteBucketReplication", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBucketReplicationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBucketReplicationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggingRequest& request) const
@@ -470,7 +733,7 @@ DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggi
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?tagging";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteBucketTagging");
   if(outcome.IsSuccess())
   {
     return DeleteBucketTaggingOutcome(NoResult());
@@ -483,17 +746,43 @@ DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggi
 
 DeleteBucketTaggingOutcomeCallable S3Client::DeleteBucketTaggingCallable(const DeleteBucketTaggingRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketTagging, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteBucketTaggingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBucketTagging( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteBucketTaggingOutcome > rejected;
+    rejected.set_value(DeleteBucketTaggingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::DeleteBucketTaggingAsync(const DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketTaggingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::DeleteBucketTaggingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteBucketTaggingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::DeleteBucketTaggingAsyncHelper(const DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketTagging(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?tagging";
+  auto sharedRequest = Aws::MakeShared<DeleteBucketTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteBucketTagging", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBucketTaggingOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBucketTaggingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsiteRequest& request) const
@@ -502,7 +791,7 @@ DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsi
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?website";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteBucketWebsite");
   if(outcome.IsSuccess())
   {
     return DeleteBucketWebsiteOutcome(NoResult());
@@ -515,17 +804,43 @@ DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsi
 
 DeleteBucketWebsiteOutcomeCallable S3Client::DeleteBucketWebsiteCallable(const DeleteBucketWebsiteRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketWebsite, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteBucketWebsiteOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBucketWebsite( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteBucketWebsiteOutcome > rejected;
+    rejected.set_value(DeleteBucketWebsiteOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::DeleteBucketWebsiteAsync(const DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketWebsiteAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::DeleteBucketWebsiteAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteBucketWebsiteOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::DeleteBucketWebsiteAsyncHelper(const DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteBucketWebsite(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?website";
+  auto sharedRequest = Aws::MakeShared<DeleteBucketWebsiteRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteBucketWebsite", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteBucketWebsiteOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteBucketWebsiteOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) const
@@ -535,7 +850,7 @@ DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) c
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE, "DeleteObject");
   if(outcome.IsSuccess())
   {
     return DeleteObjectOutcome(DeleteObjectResult(outcome.GetResult()));
@@ -548,17 +863,44 @@ DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) c
 
 DeleteObjectOutcomeCallable S3Client::DeleteObjectCallable(const DeleteObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteObject, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteObjectOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteObject( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteObjectOutcome > rejected;
+    rejected.set_value(DeleteObjectOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::DeleteObjectAsync(const DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteObjectAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::DeleteObjectAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteObjectOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::DeleteObjectAsyncHelper(const DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteObject(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto sharedRequest = Aws::MakeShared<DeleteObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_DELETE, "DeleteObject", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteObjectOutcome(DeleteObjectResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteObjectOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request) const
@@ -567,7 +909,7 @@ DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?delete";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "DeleteObjects");
   if(outcome.IsSuccess())
   {
     return DeleteObjectsOutcome(DeleteObjectsResult(outcome.GetResult()));
@@ -580,17 +922,43 @@ DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request
 
 DeleteObjectsOutcomeCallable S3Client::DeleteObjectsCallable(const DeleteObjectsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteObjects, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteObjectsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteObjects( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteObjectsOutcome > rejected;
+    rejected.set_value(DeleteObjectsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::DeleteObjectsAsync(const DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteObjectsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::DeleteObjectsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteObjectsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::DeleteObjectsAsyncHelper(const DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteObjects(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?delete";
+  auto sharedRequest = Aws::MakeShared<DeleteObjectsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "DeleteObjects", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteObjectsOutcome(DeleteObjectsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteObjectsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) const
@@ -599,7 +967,7 @@ GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) c
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?acl";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketAcl");
   if(outcome.IsSuccess())
   {
     return GetBucketAclOutcome(GetBucketAclResult(outcome.GetResult()));
@@ -612,17 +980,43 @@ GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) c
 
 GetBucketAclOutcomeCallable S3Client::GetBucketAclCallable(const GetBucketAclRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketAcl, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketAclOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketAcl( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketAclOutcome > rejected;
+    rejected.set_value(GetBucketAclOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketAclAsync(const GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketAclAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketAclAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketAclOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketAclAsyncHelper(const GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketAcl(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?acl";
+  auto sharedRequest = Aws::MakeShared<GetBucketAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketAcl", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketAclOutcome(GetBucketAclResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketAclOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request) const
@@ -631,7 +1025,7 @@ GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?cors";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketCors");
   if(outcome.IsSuccess())
   {
     return GetBucketCorsOutcome(GetBucketCorsResult(outcome.GetResult()));
@@ -644,17 +1038,43 @@ GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request
 
 GetBucketCorsOutcomeCallable S3Client::GetBucketCorsCallable(const GetBucketCorsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketCors, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketCorsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketCors( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketCorsOutcome > rejected;
+    rejected.set_value(GetBucketCorsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketCorsAsync(const GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketCorsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketCorsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketCorsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketCorsAsyncHelper(const GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketCors(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?cors";
+  auto sharedRequest = Aws::MakeShared<GetBucketCorsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketCors", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketCorsOutcome(GetBucketCorsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketCorsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketLifecycleConfigurationOutcome S3Client::GetBucketLifecycleConfiguration(const GetBucketLifecycleConfigurationRequest& request) const
@@ -663,7 +1083,7 @@ GetBucketLifecycleConfigurationOutcome S3Client::GetBucketLifecycleConfiguration
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?lifecycle";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketLifecycleConfiguration");
   if(outcome.IsSuccess())
   {
     return GetBucketLifecycleConfigurationOutcome(GetBucketLifecycleConfigurationResult(outcome.GetResult()));
@@ -676,17 +1096,43 @@ GetBucketLifecycleConfigurationOutcome S3Client::GetBucketLifecycleConfiguration
 
 GetBucketLifecycleConfigurationOutcomeCallable S3Client::GetBucketLifecycleConfigurationCallable(const GetBucketLifecycleConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketLifecycleConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketLifecycleConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketLifecycleConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketLifecycleConfigurationOutcome > rejected;
+    rejected.set_value(GetBucketLifecycleConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketLifecycleConfigurationAsync(const GetBucketLifecycleConfigurationRequest& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketLifecycleConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketLifecycleConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketLifecycleConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketLifecycleConfigurationAsyncHelper(const GetBucketLifecycleConfigurationRequest& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketLifecycleConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?lifecycle";
+  auto sharedRequest = Aws::MakeShared<GetBucketLifecycleConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketLifecycleConfiguration", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketLifecycleConfigurationOutcome(GetBucketLifecycleConfigurationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketLifecycleConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequest& request) const
@@ -695,7 +1141,7 @@ GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequ
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?location";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketLocation");
   if(outcome.IsSuccess())
   {
     return GetBucketLocationOutcome(GetBucketLocationResult(outcome.GetResult()));
@@ -708,17 +1154,43 @@ GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequ
 
 GetBucketLocationOutcomeCallable S3Client::GetBucketLocationCallable(const GetBucketLocationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketLocation, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketLocationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketLocation( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketLocationOutcome > rejected;
+    rejected.set_value(GetBucketLocationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketLocationAsync(const GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketLocationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketLocationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketLocationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketLocationAsyncHelper(const GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketLocation(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?location";
+  auto sharedRequest = Aws::MakeShared<GetBucketLocationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketLocation", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketLocationOutcome(GetBucketLocationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketLocationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest& request) const
@@ -727,7 +1199,7 @@ GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?logging";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketLogging");
   if(outcome.IsSuccess())
   {
     return GetBucketLoggingOutcome(GetBucketLoggingResult(outcome.GetResult()));
@@ -740,17 +1212,43 @@ GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest
 
 GetBucketLoggingOutcomeCallable S3Client::GetBucketLoggingCallable(const GetBucketLoggingRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketLogging, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketLoggingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketLogging( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketLoggingOutcome > rejected;
+    rejected.set_value(GetBucketLoggingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketLoggingAsync(const GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketLoggingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketLoggingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketLoggingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketLoggingAsyncHelper(const GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketLogging(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?logging";
+  auto sharedRequest = Aws::MakeShared<GetBucketLoggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketLogging", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketLoggingOutcome(GetBucketLoggingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketLoggingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfiguration(const GetBucketNotificationConfigurationRequest& request) const
@@ -759,7 +1257,7 @@ GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfigu
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?notification";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketNotificationConfiguration");
   if(outcome.IsSuccess())
   {
     return GetBucketNotificationConfigurationOutcome(GetBucketNotificationConfigurationResult(outcome.GetResult()));
@@ -772,17 +1270,43 @@ GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfigu
 
 GetBucketNotificationConfigurationOutcomeCallable S3Client::GetBucketNotificationConfigurationCallable(const GetBucketNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketNotificationConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketNotificationConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketNotificationConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketNotificationConfigurationOutcome > rejected;
+    rejected.set_value(GetBucketNotificationConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketNotificationConfigurationAsync(const GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketNotificationConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketNotificationConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketNotificationConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketNotificationConfigurationAsyncHelper(const GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketNotificationConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?notification";
+  auto sharedRequest = Aws::MakeShared<GetBucketNotificationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketNotificationConfiguration", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketNotificationConfigurationOutcome(GetBucketNotificationConfigurationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketNotificationConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketPolicyOutcome S3Client::GetBucketPolicy(const GetBucketPolicyRequest& request) const
@@ -791,7 +1315,7 @@ GetBucketPolicyOutcome S3Client::GetBucketPolicy(const GetBucketPolicyRequest& r
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?policy";
-  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketPolicy");
   if(outcome.IsSuccess())
   {
     return GetBucketPolicyOutcome(GetBucketPolicyResult(outcome.GetResultWithOwnership()));
@@ -804,17 +1328,43 @@ GetBucketPolicyOutcome S3Client::GetBucketPolicy(const GetBucketPolicyRequest& r
 
 GetBucketPolicyOutcomeCallable S3Client::GetBucketPolicyCallable(const GetBucketPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketPolicyOutcome > rejected;
+    rejected.set_value(GetBucketPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketPolicyAsync(const GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketPolicyAsyncHelper(const GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?policy";
+  auto sharedRequest = Aws::MakeShared<GetBucketPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketPolicy", [this, sharedRequest, handler, context](StreamOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketPolicyOutcome(GetBucketPolicyResult(outcome.GetResultWithOwnership())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplicationRequest& request) const
@@ -823,7 +1373,7 @@ GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplic
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?replication";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketReplication");
   if(outcome.IsSuccess())
   {
     return GetBucketReplicationOutcome(GetBucketReplicationResult(outcome.GetResult()));
@@ -836,17 +1386,43 @@ GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplic
 
 GetBucketReplicationOutcomeCallable S3Client::GetBucketReplicationCallable(const GetBucketReplicationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketReplication, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketReplicationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketReplication( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketReplicationOutcome > rejected;
+    rejected.set_value(GetBucketReplicationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketReplicationAsync(const GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketReplicationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketReplicationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketReplicationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketReplicationAsyncHelper(const GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketReplication(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?replication";
+  auto sharedRequest = Aws::MakeShared<GetBucketReplicationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketReplication", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketReplicationOutcome(GetBucketReplicationResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketReplicationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucketRequestPaymentRequest& request) const
@@ -855,7 +1431,7 @@ GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucket
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?requestPayment";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketRequestPayment");
   if(outcome.IsSuccess())
   {
     return GetBucketRequestPaymentOutcome(GetBucketRequestPaymentResult(outcome.GetResult()));
@@ -868,17 +1444,43 @@ GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucket
 
 GetBucketRequestPaymentOutcomeCallable S3Client::GetBucketRequestPaymentCallable(const GetBucketRequestPaymentRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketRequestPayment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketRequestPaymentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketRequestPayment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketRequestPaymentOutcome > rejected;
+    rejected.set_value(GetBucketRequestPaymentOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketRequestPaymentAsync(const GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketRequestPaymentAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketRequestPaymentAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketRequestPaymentOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketRequestPaymentAsyncHelper(const GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketRequestPayment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?requestPayment";
+  auto sharedRequest = Aws::MakeShared<GetBucketRequestPaymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketRequestPayment", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketRequestPaymentOutcome(GetBucketRequestPaymentResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketRequestPaymentOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest& request) const
@@ -887,7 +1489,7 @@ GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?tagging";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketTagging");
   if(outcome.IsSuccess())
   {
     return GetBucketTaggingOutcome(GetBucketTaggingResult(outcome.GetResult()));
@@ -900,17 +1502,43 @@ GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest
 
 GetBucketTaggingOutcomeCallable S3Client::GetBucketTaggingCallable(const GetBucketTaggingRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketTagging, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketTaggingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketTagging( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketTaggingOutcome > rejected;
+    rejected.set_value(GetBucketTaggingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketTaggingAsync(const GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketTaggingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketTaggingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketTaggingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketTaggingAsyncHelper(const GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketTagging(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?tagging";
+  auto sharedRequest = Aws::MakeShared<GetBucketTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketTagging", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketTaggingOutcome(GetBucketTaggingResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketTaggingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioningRequest& request) const
@@ -919,7 +1547,7 @@ GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioni
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?versioning";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketVersioning");
   if(outcome.IsSuccess())
   {
     return GetBucketVersioningOutcome(GetBucketVersioningResult(outcome.GetResult()));
@@ -932,17 +1560,43 @@ GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioni
 
 GetBucketVersioningOutcomeCallable S3Client::GetBucketVersioningCallable(const GetBucketVersioningRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketVersioning, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketVersioningOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketVersioning( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketVersioningOutcome > rejected;
+    rejected.set_value(GetBucketVersioningOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketVersioningAsync(const GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketVersioningAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketVersioningAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketVersioningOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketVersioningAsyncHelper(const GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketVersioning(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?versioning";
+  auto sharedRequest = Aws::MakeShared<GetBucketVersioningRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketVersioning", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketVersioningOutcome(GetBucketVersioningResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketVersioningOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest& request) const
@@ -951,7 +1605,7 @@ GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?website";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetBucketWebsite");
   if(outcome.IsSuccess())
   {
     return GetBucketWebsiteOutcome(GetBucketWebsiteResult(outcome.GetResult()));
@@ -964,17 +1618,43 @@ GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest
 
 GetBucketWebsiteOutcomeCallable S3Client::GetBucketWebsiteCallable(const GetBucketWebsiteRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketWebsite, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetBucketWebsiteOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetBucketWebsite( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetBucketWebsiteOutcome > rejected;
+    rejected.set_value(GetBucketWebsiteOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetBucketWebsiteAsync(const GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketWebsiteAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetBucketWebsiteAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetBucketWebsiteOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetBucketWebsiteAsyncHelper(const GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetBucketWebsite(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?website";
+  auto sharedRequest = Aws::MakeShared<GetBucketWebsiteRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetBucketWebsite", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetBucketWebsiteOutcome(GetBucketWebsiteResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetBucketWebsiteOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetObjectOutcome S3Client::GetObject(const GetObjectRequest& request) const
@@ -984,7 +1664,7 @@ GetObjectOutcome S3Client::GetObject(const GetObjectRequest& request) const
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET, "GetObject");
   if(outcome.IsSuccess())
   {
     return GetObjectOutcome(GetObjectResult(outcome.GetResultWithOwnership()));
@@ -997,17 +1677,44 @@ GetObjectOutcome S3Client::GetObject(const GetObjectRequest& request) const
 
 GetObjectOutcomeCallable S3Client::GetObjectCallable(const GetObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetObject, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetObjectOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetObject( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetObjectOutcome > rejected;
+    rejected.set_value(GetObjectOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetObjectAsync(const GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetObjectAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetObjectAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetObjectOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetObjectAsyncHelper(const GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetObject(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto sharedRequest = Aws::MakeShared<GetObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetObject", [this, sharedRequest, handler, context](StreamOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetObjectOutcome(GetObjectResult(outcome.GetResultWithOwnership())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetObjectOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) const
@@ -1018,7 +1725,7 @@ GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) c
   ss << "/";
   ss << request.GetKey();
   ss << "?acl";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "GetObjectAcl");
   if(outcome.IsSuccess())
   {
     return GetObjectAclOutcome(GetObjectAclResult(outcome.GetResult()));
@@ -1031,17 +1738,45 @@ GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) c
 
 GetObjectAclOutcomeCallable S3Client::GetObjectAclCallable(const GetObjectAclRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetObjectAcl, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetObjectAclOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetObjectAcl( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetObjectAclOutcome > rejected;
+    rejected.set_value(GetObjectAclOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetObjectAclAsync(const GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetObjectAclAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetObjectAclAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetObjectAclOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetObjectAclAsyncHelper(const GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetObjectAcl(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  ss << "?acl";
+  auto sharedRequest = Aws::MakeShared<GetObjectAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetObjectAcl", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetObjectAclOutcome(GetObjectAclResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetObjectAclOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest& request) const
@@ -1052,7 +1787,7 @@ GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest
   ss << "/";
   ss << request.GetKey();
   ss << "?torrent";
-  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET, "GetObjectTorrent");
   if(outcome.IsSuccess())
   {
     return GetObjectTorrentOutcome(GetObjectTorrentResult(outcome.GetResultWithOwnership()));
@@ -1065,17 +1800,45 @@ GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest
 
 GetObjectTorrentOutcomeCallable S3Client::GetObjectTorrentCallable(const GetObjectTorrentRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetObjectTorrent, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetObjectTorrentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetObjectTorrent( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetObjectTorrentOutcome > rejected;
+    rejected.set_value(GetObjectTorrentOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::GetObjectTorrentAsync(const GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetObjectTorrentAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::GetObjectTorrentAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetObjectTorrentOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::GetObjectTorrentAsyncHelper(const GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetObjectTorrent(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  ss << "?torrent";
+  auto sharedRequest = Aws::MakeShared<GetObjectTorrentRequest>(ALLOCATION_TAG, request);
+  MakeRequestWithUnparsedResponseAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "GetObjectTorrent", [this, sharedRequest, handler, context](StreamOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetObjectTorrentOutcome(GetObjectTorrentResult(outcome.GetResultWithOwnership())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetObjectTorrentOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
@@ -1083,7 +1846,7 @@ HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_HEAD);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_HEAD, "HeadBucket");
   if(outcome.IsSuccess())
   {
     return HeadBucketOutcome(NoResult());
@@ -1096,17 +1859,42 @@ HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
 
 HeadBucketOutcomeCallable S3Client::HeadBucketCallable(const HeadBucketRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::HeadBucket, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< HeadBucketOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->HeadBucket( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< HeadBucketOutcome > rejected;
+    rejected.set_value(HeadBucketOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::HeadBucketAsync(const HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::HeadBucketAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::HeadBucketAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, HeadBucketOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::HeadBucketAsyncHelper(const HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, HeadBucket(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  auto sharedRequest = Aws::MakeShared<HeadBucketRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_HEAD, "HeadBucket", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, HeadBucketOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, HeadBucketOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
@@ -1116,7 +1904,7 @@ HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_HEAD);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_HEAD, "HeadObject");
   if(outcome.IsSuccess())
   {
     return HeadObjectOutcome(HeadObjectResult(outcome.GetResult()));
@@ -1129,24 +1917,51 @@ HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
 
 HeadObjectOutcomeCallable S3Client::HeadObjectCallable(const HeadObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::HeadObject, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< HeadObjectOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->HeadObject( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< HeadObjectOutcome > rejected;
+    rejected.set_value(HeadObjectOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::HeadObjectAsync(const HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::HeadObjectAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::HeadObjectAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, HeadObjectOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::HeadObjectAsyncHelper(const HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, HeadObject(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto sharedRequest = Aws::MakeShared<HeadObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_HEAD, "HeadObject", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, HeadObjectOutcome(HeadObjectResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, HeadObjectOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListBucketsOutcome S3Client::ListBuckets() const
 {
   Aws::StringStream ss;
   ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), HttpMethod::HTTP_GET, "ListBuckets");
   if(outcome.IsSuccess())
   {
     return ListBucketsOutcome(ListBucketsResult(outcome.GetResult()));
@@ -1159,17 +1974,40 @@ ListBucketsOutcome S3Client::ListBuckets() const
 
 ListBucketsOutcomeCallable S3Client::ListBucketsCallable() const
 {
-  return std::async(std::launch::async, &S3Client::ListBuckets, this);
+  auto task = Aws::MakeShared< std::packaged_task< ListBucketsOutcome() > >(ALLOCATION_TAG, [this](){ return this->ListBuckets(); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListBucketsOutcome > rejected;
+    rejected.set_value(ListBucketsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::ListBucketsAsync(const ListBucketsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListBucketsAsyncHelper, this, handler, context);
+  if(!m_executor->Submit(&S3Client::ListBucketsAsyncHelper, this, handler, context))
+  {
+    handler(this, ListBucketsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::ListBucketsAsyncHelper(const ListBucketsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, ListBuckets(), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  MakeRequestAsync(ss.str(), HttpMethod::HTTP_GET, "ListBuckets", [this, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, ListBucketsOutcome(ListBucketsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, ListBucketsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListMultipartUploadsOutcome S3Client::ListMultipartUploads(const ListMultipartUploadsRequest& request) const
@@ -1178,7 +2016,7 @@ ListMultipartUploadsOutcome S3Client::ListMultipartUploads(const ListMultipartUp
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?uploads";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListMultipartUploads");
   if(outcome.IsSuccess())
   {
     return ListMultipartUploadsOutcome(ListMultipartUploadsResult(outcome.GetResult()));
@@ -1191,17 +2029,43 @@ ListMultipartUploadsOutcome S3Client::ListMultipartUploads(const ListMultipartUp
 
 ListMultipartUploadsOutcomeCallable S3Client::ListMultipartUploadsCallable(const ListMultipartUploadsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::ListMultipartUploads, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListMultipartUploadsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListMultipartUploads( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListMultipartUploadsOutcome > rejected;
+    rejected.set_value(ListMultipartUploadsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::ListMultipartUploadsAsync(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListMultipartUploadsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::ListMultipartUploadsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListMultipartUploadsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::ListMultipartUploadsAsyncHelper(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListMultipartUploads(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?uploads";
+  auto sharedRequest = Aws::MakeShared<ListMultipartUploadsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListMultipartUploads", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListMultipartUploadsOutcome(ListMultipartUploadsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListMultipartUploadsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsRequest& request) const
@@ -1210,7 +2074,7 @@ ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsR
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?versions";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListObjectVersions");
   if(outcome.IsSuccess())
   {
     return ListObjectVersionsOutcome(ListObjectVersionsResult(outcome.GetResult()));
@@ -1223,17 +2087,43 @@ ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsR
 
 ListObjectVersionsOutcomeCallable S3Client::ListObjectVersionsCallable(const ListObjectVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::ListObjectVersions, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListObjectVersionsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListObjectVersions( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListObjectVersionsOutcome > rejected;
+    rejected.set_value(ListObjectVersionsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::ListObjectVersionsAsync(const ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListObjectVersionsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::ListObjectVersionsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListObjectVersionsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::ListObjectVersionsAsyncHelper(const ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListObjectVersions(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?versions";
+  auto sharedRequest = Aws::MakeShared<ListObjectVersionsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListObjectVersions", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListObjectVersionsOutcome(ListObjectVersionsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListObjectVersionsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) const
@@ -1241,7 +2131,7 @@ ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) cons
   Aws::StringStream ss;
   ss << m_uri << "/";
   ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListObjects");
   if(outcome.IsSuccess())
   {
     return ListObjectsOutcome(ListObjectsResult(outcome.GetResult()));
@@ -1254,17 +2144,42 @@ ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) cons
 
 ListObjectsOutcomeCallable S3Client::ListObjectsCallable(const ListObjectsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::ListObjects, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListObjectsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListObjects( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListObjectsOutcome > rejected;
+    rejected.set_value(ListObjectsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::ListObjectsAsync(const ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListObjectsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::ListObjectsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListObjectsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::ListObjectsAsyncHelper(const ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListObjects(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  auto sharedRequest = Aws::MakeShared<ListObjectsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListObjects", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListObjectsOutcome(ListObjectsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListObjectsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
@@ -1274,7 +2189,7 @@ ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET, "ListParts");
   if(outcome.IsSuccess())
   {
     return ListPartsOutcome(ListPartsResult(outcome.GetResult()));
@@ -1287,17 +2202,44 @@ ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
 
 ListPartsOutcomeCallable S3Client::ListPartsCallable(const ListPartsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::ListParts, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListPartsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListParts( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListPartsOutcome > rejected;
+    rejected.set_value(ListPartsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::ListPartsAsync(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListPartsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::ListPartsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListPartsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::ListPartsAsyncHelper(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListParts(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto sharedRequest = Aws::MakeShared<ListPartsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_GET, "ListParts", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListPartsOutcome(ListPartsResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListPartsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) const
@@ -1306,7 +2248,7 @@ PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) c
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?acl";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketAcl");
   if(outcome.IsSuccess())
   {
     return PutBucketAclOutcome(NoResult());
@@ -1319,17 +2261,43 @@ PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) c
 
 PutBucketAclOutcomeCallable S3Client::PutBucketAclCallable(const PutBucketAclRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketAcl, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketAclOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketAcl( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketAclOutcome > rejected;
+    rejected.set_value(PutBucketAclOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketAclAsync(const PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketAclAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketAclAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketAclOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketAclAsyncHelper(const PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketAcl(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?acl";
+  auto sharedRequest = Aws::MakeShared<PutBucketAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketAcl", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketAclOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketAclOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request) const
@@ -1338,7 +2306,7 @@ PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?cors";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketCors");
   if(outcome.IsSuccess())
   {
     return PutBucketCorsOutcome(NoResult());
@@ -1351,17 +2319,43 @@ PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request
 
 PutBucketCorsOutcomeCallable S3Client::PutBucketCorsCallable(const PutBucketCorsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketCors, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketCorsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketCors( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketCorsOutcome > rejected;
+    rejected.set_value(PutBucketCorsOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketCorsAsync(const PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketCorsAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketCorsAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketCorsOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketCorsAsyncHelper(const PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketCors(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?cors";
+  auto sharedRequest = Aws::MakeShared<PutBucketCorsRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketCors", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketCorsOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketCorsOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketLifecycleConfigurationOutcome S3Client::PutBucketLifecycleConfiguration(const PutBucketLifecycleConfigurationRequest& request) const
@@ -1370,7 +2364,7 @@ PutBucketLifecycleConfigurationOutcome S3Client::PutBucketLifecycleConfiguration
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?lifecycle";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketLifecycleConfiguration");
   if(outcome.IsSuccess())
   {
     return PutBucketLifecycleConfigurationOutcome(NoResult());
@@ -1383,17 +2377,43 @@ PutBucketLifecycleConfigurationOutcome S3Client::PutBucketLifecycleConfiguration
 
 PutBucketLifecycleConfigurationOutcomeCallable S3Client::PutBucketLifecycleConfigurationCallable(const PutBucketLifecycleConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketLifecycleConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketLifecycleConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketLifecycleConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketLifecycleConfigurationOutcome > rejected;
+    rejected.set_value(PutBucketLifecycleConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketLifecycleConfigurationAsync(const PutBucketLifecycleConfigurationRequest& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketLifecycleConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketLifecycleConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketLifecycleConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketLifecycleConfigurationAsyncHelper(const PutBucketLifecycleConfigurationRequest& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketLifecycleConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?lifecycle";
+  auto sharedRequest = Aws::MakeShared<PutBucketLifecycleConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketLifecycleConfiguration", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketLifecycleConfigurationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketLifecycleConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest& request) const
@@ -1402,7 +2422,7 @@ PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?logging";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketLogging");
   if(outcome.IsSuccess())
   {
     return PutBucketLoggingOutcome(NoResult());
@@ -1415,17 +2435,43 @@ PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest
 
 PutBucketLoggingOutcomeCallable S3Client::PutBucketLoggingCallable(const PutBucketLoggingRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketLogging, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketLoggingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketLogging( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketLoggingOutcome > rejected;
+    rejected.set_value(PutBucketLoggingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketLoggingAsync(const PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketLoggingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketLoggingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketLoggingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketLoggingAsyncHelper(const PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketLogging(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?logging";
+  auto sharedRequest = Aws::MakeShared<PutBucketLoggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketLogging", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketLoggingOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketLoggingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfiguration(const PutBucketNotificationConfigurationRequest& request) const
@@ -1434,7 +2480,7 @@ PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfigu
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?notification";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketNotificationConfiguration");
   if(outcome.IsSuccess())
   {
     return PutBucketNotificationConfigurationOutcome(NoResult());
@@ -1447,17 +2493,43 @@ PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfigu
 
 PutBucketNotificationConfigurationOutcomeCallable S3Client::PutBucketNotificationConfigurationCallable(const PutBucketNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketNotificationConfiguration, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketNotificationConfigurationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketNotificationConfiguration( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketNotificationConfigurationOutcome > rejected;
+    rejected.set_value(PutBucketNotificationConfigurationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketNotificationConfigurationAsync(const PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketNotificationConfigurationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketNotificationConfigurationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketNotificationConfigurationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketNotificationConfigurationAsyncHelper(const PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketNotificationConfiguration(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?notification";
+  auto sharedRequest = Aws::MakeShared<PutBucketNotificationConfigurationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketNotificationConfiguration", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketNotificationConfigurationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketNotificationConfigurationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& request) const
@@ -1466,7 +2538,7 @@ PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& r
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?policy";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketPolicy");
   if(outcome.IsSuccess())
   {
     return PutBucketPolicyOutcome(NoResult());
@@ -1479,17 +2551,43 @@ PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& r
 
 PutBucketPolicyOutcomeCallable S3Client::PutBucketPolicyCallable(const PutBucketPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketPolicy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketPolicyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketPolicy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketPolicyOutcome > rejected;
+    rejected.set_value(PutBucketPolicyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketPolicyAsync(const PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketPolicyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketPolicyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketPolicyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketPolicyAsyncHelper(const PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketPolicy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?policy";
+  auto sharedRequest = Aws::MakeShared<PutBucketPolicyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketPolicy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketPolicyOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketPolicyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplicationRequest& request) const
@@ -1498,7 +2596,7 @@ PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplic
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?replication";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketReplication");
   if(outcome.IsSuccess())
   {
     return PutBucketReplicationOutcome(NoResult());
@@ -1511,17 +2609,43 @@ PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplic
 
 PutBucketReplicationOutcomeCallable S3Client::PutBucketReplicationCallable(const PutBucketReplicationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketReplication, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketReplicationOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketReplication( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketReplicationOutcome > rejected;
+    rejected.set_value(PutBucketReplicationOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketReplicationAsync(const PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketReplicationAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketReplicationAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketReplicationOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketReplicationAsyncHelper(const PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketReplication(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?replication";
+  auto sharedRequest = Aws::MakeShared<PutBucketReplicationRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketReplication", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketReplicationOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketReplicationOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucketRequestPaymentRequest& request) const
@@ -1530,7 +2654,7 @@ PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucket
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?requestPayment";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketRequestPayment");
   if(outcome.IsSuccess())
   {
     return PutBucketRequestPaymentOutcome(NoResult());
@@ -1543,17 +2667,43 @@ PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucket
 
 PutBucketRequestPaymentOutcomeCallable S3Client::PutBucketRequestPaymentCallable(const PutBucketRequestPaymentRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketRequestPayment, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketRequestPaymentOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketRequestPayment( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketRequestPaymentOutcome > rejected;
+    rejected.set_value(PutBucketRequestPaymentOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketRequestPaymentAsync(const PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketRequestPaymentAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketRequestPaymentAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketRequestPaymentOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketRequestPaymentAsyncHelper(const PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketRequestPayment(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?requestPayment";
+  auto sharedRequest = Aws::MakeShared<PutBucketRequestPaymentRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketRequestPayment", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketRequestPaymentOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketRequestPaymentOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest& request) const
@@ -1562,7 +2712,7 @@ PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?tagging";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketTagging");
   if(outcome.IsSuccess())
   {
     return PutBucketTaggingOutcome(NoResult());
@@ -1575,17 +2725,43 @@ PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest
 
 PutBucketTaggingOutcomeCallable S3Client::PutBucketTaggingCallable(const PutBucketTaggingRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketTagging, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketTaggingOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketTagging( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketTaggingOutcome > rejected;
+    rejected.set_value(PutBucketTaggingOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketTaggingAsync(const PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketTaggingAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketTaggingAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketTaggingOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketTaggingAsyncHelper(const PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketTagging(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?tagging";
+  auto sharedRequest = Aws::MakeShared<PutBucketTaggingRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketTagging", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketTaggingOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketTaggingOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioningRequest& request) const
@@ -1594,7 +2770,7 @@ PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioni
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?versioning";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketVersioning");
   if(outcome.IsSuccess())
   {
     return PutBucketVersioningOutcome(NoResult());
@@ -1607,17 +2783,43 @@ PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioni
 
 PutBucketVersioningOutcomeCallable S3Client::PutBucketVersioningCallable(const PutBucketVersioningRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketVersioning, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketVersioningOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketVersioning( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketVersioningOutcome > rejected;
+    rejected.set_value(PutBucketVersioningOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketVersioningAsync(const PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketVersioningAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketVersioningAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketVersioningOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketVersioningAsyncHelper(const PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketVersioning(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?versioning";
+  auto sharedRequest = Aws::MakeShared<PutBucketVersioningRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketVersioning", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketVersioningOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketVersioningOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest& request) const
@@ -1626,7 +2828,7 @@ PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest
   ss << m_uri << "/";
   ss << request.GetBucket();
   ss << "?website";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutBucketWebsite");
   if(outcome.IsSuccess())
   {
     return PutBucketWebsiteOutcome(NoResult());
@@ -1639,17 +2841,43 @@ PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest
 
 PutBucketWebsiteOutcomeCallable S3Client::PutBucketWebsiteCallable(const PutBucketWebsiteRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketWebsite, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutBucketWebsiteOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutBucketWebsite( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutBucketWebsiteOutcome > rejected;
+    rejected.set_value(PutBucketWebsiteOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutBucketWebsiteAsync(const PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketWebsiteAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutBucketWebsiteAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutBucketWebsiteOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutBucketWebsiteAsyncHelper(const PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutBucketWebsite(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "?website";
+  auto sharedRequest = Aws::MakeShared<PutBucketWebsiteRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutBucketWebsite", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutBucketWebsiteOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutBucketWebsiteOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
@@ -1659,7 +2887,7 @@ PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutObject");
   if(outcome.IsSuccess())
   {
     return PutObjectOutcome(PutObjectResult(outcome.GetResult()));
@@ -1672,17 +2900,44 @@ PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
 
 PutObjectOutcomeCallable S3Client::PutObjectCallable(const PutObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutObject, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutObjectOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutObject( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutObjectOutcome > rejected;
+    rejected.set_value(PutObjectOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutObjectAsync(const PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutObjectAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutObjectAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutObjectOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutObjectAsyncHelper(const PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutObject(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto sharedRequest = Aws::MakeShared<PutObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutObject", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutObjectOutcome(PutObjectResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutObjectOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) const
@@ -1693,7 +2948,7 @@ PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) c
   ss << "/";
   ss << request.GetKey();
   ss << "?acl";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "PutObjectAcl");
   if(outcome.IsSuccess())
   {
     return PutObjectAclOutcome(PutObjectAclResult(outcome.GetResult()));
@@ -1706,17 +2961,45 @@ PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) c
 
 PutObjectAclOutcomeCallable S3Client::PutObjectAclCallable(const PutObjectAclRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutObjectAcl, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PutObjectAclOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutObjectAcl( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PutObjectAclOutcome > rejected;
+    rejected.set_value(PutObjectAclOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::PutObjectAclAsync(const PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutObjectAclAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::PutObjectAclAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PutObjectAclOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::PutObjectAclAsyncHelper(const PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PutObjectAcl(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  ss << "?acl";
+  auto sharedRequest = Aws::MakeShared<PutObjectAclRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "PutObjectAcl", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PutObjectAclOutcome(PutObjectAclResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PutObjectAclOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request) const
@@ -1727,7 +3010,7 @@ RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request
   ss << "/";
   ss << request.GetKey();
   ss << "?restore";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "RestoreObject");
   if(outcome.IsSuccess())
   {
     return RestoreObjectOutcome(RestoreObjectResult(outcome.GetResult()));
@@ -1740,17 +3023,45 @@ RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request
 
 RestoreObjectOutcomeCallable S3Client::RestoreObjectCallable(const RestoreObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::RestoreObject, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< RestoreObjectOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RestoreObject( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< RestoreObjectOutcome > rejected;
+    rejected.set_value(RestoreObjectOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::RestoreObjectAsync(const RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::RestoreObjectAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::RestoreObjectAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, RestoreObjectOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::RestoreObjectAsyncHelper(const RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, RestoreObject(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  ss << "?restore";
+  auto sharedRequest = Aws::MakeShared<RestoreObjectRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "RestoreObject", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RestoreObjectOutcome(RestoreObjectResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RestoreObjectOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
@@ -1760,7 +3071,7 @@ UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "UploadPart");
   if(outcome.IsSuccess())
   {
     return UploadPartOutcome(UploadPartResult(outcome.GetResult()));
@@ -1773,17 +3084,44 @@ UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
 
 UploadPartOutcomeCallable S3Client::UploadPartCallable(const UploadPartRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::UploadPart, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UploadPartOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UploadPart( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UploadPartOutcome > rejected;
+    rejected.set_value(UploadPartOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::UploadPartAsync(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::UploadPartAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::UploadPartAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UploadPartOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::UploadPartAsyncHelper(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UploadPart(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto sharedRequest = Aws::MakeShared<UploadPartRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "UploadPart", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UploadPartOutcome(UploadPartResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UploadPartOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& request) const
@@ -1793,7 +3131,7 @@ UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& requ
   ss << request.GetBucket();
   ss << "/";
   ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT, "UploadPartCopy");
   if(outcome.IsSuccess())
   {
     return UploadPartCopyOutcome(UploadPartCopyResult(outcome.GetResult()));
@@ -1806,17 +3144,44 @@ UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& requ
 
 UploadPartCopyOutcomeCallable S3Client::UploadPartCopyCallable(const UploadPartCopyRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::UploadPartCopy, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< UploadPartCopyOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UploadPartCopy( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< UploadPartCopyOutcome > rejected;
+    rejected.set_value(UploadPartCopyOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void S3Client::UploadPartCopyAsync(const UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::UploadPartCopyAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&S3Client::UploadPartCopyAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, UploadPartCopyOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void S3Client::UploadPartCopyAsyncHelper(const UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, UploadPartCopy(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+  ss << request.GetBucket();
+  ss << "/";
+  ss << request.GetKey();
+  auto sharedRequest = Aws::MakeShared<UploadPartCopyRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_PUT, "UploadPartCopy", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, UploadPartCopyOutcome(UploadPartCopyResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, UploadPartCopyOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 
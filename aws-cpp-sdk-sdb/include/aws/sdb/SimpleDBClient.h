@@ -26,6 +26,7 @@
 #include <aws/sdb/model/SelectResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -191,6 +192,31 @@ namespace Model
          */
         virtual void BatchDeleteAttributesAsync(const Model::BatchDeleteAttributesRequest& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Performs multiple DeleteAttributes operations in a single call, which
+         * reduces round trips and latencies. This enables Amazon SimpleDB to optimize
+         * requests, which generally yields better throughput. </p> <p> The following
+         * limitations are enforced for this operation: <ul> <li>1 MB request size</li>
+         * <li>25 item limit per BatchDeleteAttributes operation</li> </ul> </p>
+         *
+         * Returns an awaitable that starts the operation the way BatchDeleteAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchDeleteAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchDeleteAttributesOutcome> BatchDeleteAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchDeleteAttributesOutcome>([this, request](const std::function<void(Model::BatchDeleteAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchDeleteAttributesAsync(request, [complete](const SimpleDBClient*, const Model::BatchDeleteAttributesRequest&, const Model::BatchDeleteAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchDeleteAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> The <code>BatchPutAttributes</code> operation creates or replaces attributes
          * within one or more items. By using this operation, the client can perform
@@ -321,6 +347,64 @@ namespace Model
          */
         virtual void BatchPutAttributesAsync(const Model::BatchPutAttributesRequest& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> The <code>BatchPutAttributes</code> operation creates or replaces attributes
+         * within one or more items. By using this operation, the client can perform
+         * multiple <a>PutAttribute</a> operation with a single call. This helps yield
+         * savings in round trips and latencies, enabling Amazon SimpleDB to optimize
+         * requests and generally produce better throughput. </p> <p> The client may
+         * specify the item name with the <code>Item.X.ItemName</code> parameter. The
+         * client may specify new attributes using a combination of the
+         * <code>Item.X.Attribute.Y.Name</code> and <code>Item.X.Attribute.Y.Value</code>
+         * parameters. The client may specify the first attribute for the first item using
+         * the parameters <code>Item.0.Attribute.0.Name</code> and
+         * <code>Item.0.Attribute.0.Value</code>, and for the second attribute for the
+         * first item by the parameters <code>Item.0.Attribute.1.Name</code> and
+         * <code>Item.0.Attribute.1.Value</code>, and so on. </p> <p> Attributes are
+         * uniquely identified within an item by their name/value combination. For example,
+         * a single item can have the attributes <code>{ "first_name", "first_value"
+         * }</code> and <code>{ "first_name", "second_value" }</code>. However, it cannot
+         * have two attribute instances where both the <code>Item.X.Attribute.Y.Name</code>
+         * and <code>Item.X.Attribute.Y.Value</code> are the same. </p> <p> Optionally, the
+         * requester can supply the <code>Replace</code> parameter for each individual
+         * value. Setting this value to <code>true</code> will cause the new attribute
+         * values to replace the existing attribute values. For example, if an item
+         * <code>I</code> has the attributes <code>{ 'a', '1' }, { 'b', '2'}</code> and
+         * <code>{ 'b', '3' }</code> and the requester does a BatchPutAttributes of
+         * <code>{'I', 'b', '4' }</code> with the Replace parameter set to true, the final
+         * attributes of the item will be <code>{ 'a', '1' }</code> and <code>{ 'b', '4'
+         * }</code>, replacing the previous values of the 'b' attribute with the new value.
+         * </p> <important> This operation is vulnerable to exceeding the maximum URL size
+         * when making a REST request using the HTTP GET method. This operation does not
+         * support conditions using <code>Expected.X.Name</code>,
+         * <code>Expected.X.Value</code>, or <code>Expected.X.Exists</code>. </important>
+         * <p> You can execute multiple <code>BatchPutAttributes</code> operations and
+         * other operations in parallel. However, large numbers of concurrent
+         * <code>BatchPutAttributes</code> calls can result in Service Unavailable (503)
+         * responses. </p> <p> The following limitations are enforced for this operation:
+         * <ul> <li>256 attribute name-value pairs per item</li> <li>1 MB request size</li>
+         * <li>1 billion attributes per domain</li> <li>10 GB of total user data storage
+         * per domain</li> <li>25 item limit per <code>BatchPutAttributes</code>
+         * operation</li> </ul> </p>
+         *
+         * Returns an awaitable that starts the operation the way BatchPutAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::BatchPutAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::BatchPutAttributesOutcome> BatchPutAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::BatchPutAttributesOutcome>([this, request](const std::function<void(Model::BatchPutAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->BatchPutAttributesAsync(request, [complete](const SimpleDBClient*, const Model::BatchPutAttributesRequest&, const Model::BatchPutAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::BatchPutAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> The <code>CreateDomain</code> operation creates a new domain. The domain
          * name should be unique among the domains associated with the Access Key ID
@@ -358,6 +442,33 @@ namespace Model
          */
         virtual void CreateDomainAsync(const Model::CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> The <code>CreateDomain</code> operation creates a new domain. The domain
+         * name should be unique among the domains associated with the Access Key ID
+         * provided in the request. The <code>CreateDomain</code> operation may take 10 or
+         * more seconds to complete. </p> <p> The client can create up to 100 domains per
+         * account. </p> <p> If the client requires additional domains, go to <a
+         * href="http://aws.amazon.com/contact-us/simpledb-limit-request/">
+         * http://aws.amazon.com/contact-us/simpledb-limit-request/</a>. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDomainOutcome> CreateDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDomainOutcome>([this, request](const std::function<void(Model::CreateDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDomainAsync(request, [complete](const SimpleDBClient*, const Model::CreateDomainRequest&, const Model::CreateDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes one or more attributes associated with an item. If all attributes of
          * the item are deleted, the item is deleted. </p> <p>
@@ -401,6 +512,35 @@ namespace Model
          */
         virtual void DeleteAttributesAsync(const Model::DeleteAttributesRequest& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes one or more attributes associated with an item. If all attributes of
+         * the item are deleted, the item is deleted. </p> <p>
+         * <code>DeleteAttributes</code> is an idempotent operation; running it multiple
+         * times on the same item or attribute does not result in an error response. </p>
+         * <p> Because Amazon SimpleDB makes multiple copies of item data and uses an
+         * eventual consistency update model, performing a <a>GetAttributes</a> or
+         * <a>Select</a> operation (read) immediately after a <code>DeleteAttributes</code>
+         * or <a>PutAttributes</a> operation (write) might not return updated item data.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAttributesOutcome> DeleteAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAttributesOutcome>([this, request](const std::function<void(Model::DeleteAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAttributesAsync(request, [complete](const SimpleDBClient*, const Model::DeleteAttributesRequest&, const Model::DeleteAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> The <code>DeleteDomain</code> operation deletes a domain. Any items (and
          * their attributes) in the domain are deleted as well. The
@@ -429,6 +569,30 @@ namespace Model
          */
         virtual void DeleteDomainAsync(const Model::DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> The <code>DeleteDomain</code> operation deletes a domain. Any items (and
+         * their attributes) in the domain are deleted as well. The
+         * <code>DeleteDomain</code> operation might take 10 or more seconds to complete.
+         * </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDomainOutcome> DeleteDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDomainOutcome>([this, request](const std::function<void(Model::DeleteDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDomainAsync(request, [complete](const SimpleDBClient*, const Model::DeleteDomainRequest&, const Model::DeleteDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns information about the domain, including when the domain was created,
          * the number of items and attributes in the domain, and the size of the attribute
@@ -454,6 +618,29 @@ namespace Model
          */
         virtual void DomainMetadataAsync(const Model::DomainMetadataRequest& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns information about the domain, including when the domain was created,
+         * the number of items and attributes in the domain, and the size of the attribute
+         * names and values. </p>
+         *
+         * Returns an awaitable that starts the operation the way DomainMetadataAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DomainMetadataRequest>
+        Aws::Utils::Threading::Awaitable<Model::DomainMetadataOutcome> DomainMetadataAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DomainMetadataOutcome>([this, request](const std::function<void(Model::DomainMetadataOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DomainMetadataAsync(request, [complete](const SimpleDBClient*, const Model::DomainMetadataRequest&, const Model::DomainMetadataOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DomainMetadataOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns all of the attributes associated with the specified item.
          * Optionally, the attributes returned can be limited to one or more attributes by
@@ -488,6 +675,32 @@ namespace Model
          */
         virtual void GetAttributesAsync(const Model::GetAttributesRequest& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns all of the attributes associated with the specified item.
+         * Optionally, the attributes returned can be limited to one or more attributes by
+         * specifying an attribute name parameter. </p> <p> If the item does not exist on
+         * the replica that was accessed for this operation, an empty set is returned. The
+         * system does not return an error as it cannot guarantee the item does not exist
+         * on other replicas. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetAttributesOutcome> GetAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetAttributesOutcome>([this, request](const std::function<void(Model::GetAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetAttributesAsync(request, [complete](const SimpleDBClient*, const Model::GetAttributesRequest&, const Model::GetAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> The <code>ListDomains</code> operation lists all domains associated with the
          * Access Key ID. It returns domain names up to the limit set by <a
@@ -528,6 +741,34 @@ namespace Model
          */
         virtual void ListDomainsAsync(const Model::ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> The <code>ListDomains</code> operation lists all domains associated with the
+         * Access Key ID. It returns domain names up to the limit set by <a
+         * href="#MaxNumberOfDomains">MaxNumberOfDomains</a>. A <a
+         * href="#NextToken">NextToken</a> is returned if there are more than
+         * <code>MaxNumberOfDomains</code> domains. Calling <code>ListDomains</code>
+         * successive times with the <code>NextToken</code> provided by the operation
+         * returns up to <code>MaxNumberOfDomains</code> more domain names with each
+         * successive operation call. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListDomainsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDomainsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDomainsOutcome> ListDomainsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDomainsOutcome>([this, request](const std::function<void(Model::ListDomainsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDomainsAsync(request, [complete](const SimpleDBClient*, const Model::ListDomainsRequest&, const Model::ListDomainsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDomainsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> The PutAttributes operation creates or replaces attributes in an item. The
          * client may specify new attributes using a combination of the
@@ -631,6 +872,55 @@ namespace Model
          */
         virtual void PutAttributesAsync(const Model::PutAttributesRequest& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> The PutAttributes operation creates or replaces attributes in an item. The
+         * client may specify new attributes using a combination of the
+         * <code>Attribute.X.Name</code> and <code>Attribute.X.Value</code> parameters. The
+         * client specifies the first attribute by the parameters
+         * <code>Attribute.0.Name</code> and <code>Attribute.0.Value</code>, the second
+         * attribute by the parameters <code>Attribute.1.Name</code> and
+         * <code>Attribute.1.Value</code>, and so on. </p> <p> Attributes are uniquely
+         * identified in an item by their name/value combination. For example, a single
+         * item can have the attributes <code>{ "first_name", "first_value" }</code> and
+         * <code>{ "first_name", second_value" }</code>. However, it cannot have two
+         * attribute instances where both the <code>Attribute.X.Name</code> and
+         * <code>Attribute.X.Value</code> are the same. </p> <p> Optionally, the requestor
+         * can supply the <code>Replace</code> parameter for each individual attribute.
+         * Setting this value to <code>true</code> causes the new attribute value to
+         * replace the existing attribute value(s). For example, if an item has the
+         * attributes <code>{ 'a', '1' }</code>, <code>{ 'b', '2'}</code> and <code>{ 'b',
+         * '3' }</code> and the requestor calls <code>PutAttributes</code> using the
+         * attributes <code>{ 'b', '4' }</code> with the <code>Replace</code> parameter set
+         * to true, the final attributes of the item are changed to <code>{ 'a', '1'
+         * }</code> and <code>{ 'b', '4' }</code>, which replaces the previous values of
+         * the 'b' attribute with the new value. </p> <p> You cannot specify an empty
+         * string as an attribute name. </p> <p> Because Amazon SimpleDB makes multiple
+         * copies of client data and uses an eventual consistency update model, an
+         * immediate <a>GetAttributes</a> or <a>Select</a> operation (read) immediately
+         * after a <a>PutAttributes</a> or <a>DeleteAttributes</a> operation (write) might
+         * not return the updated data. </p> <p> The following limitations are enforced for
+         * this operation: <ul> <li>256 total attribute name-value pairs per item</li>
+         * <li>One billion attributes per domain</li> <li>10 GB of total user data storage
+         * per domain</li> </ul> </p>
+         *
+         * Returns an awaitable that starts the operation the way PutAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PutAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::PutAttributesOutcome> PutAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PutAttributesOutcome>([this, request](const std::function<void(Model::PutAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PutAttributesAsync(request, [complete](const SimpleDBClient*, const Model::PutAttributesRequest&, const Model::PutAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PutAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> The <code>Select</code> operation returns a set of attributes for
          * <code>ItemNames</code> that match the select expression. <code>Select</code> is
@@ -677,6 +967,36 @@ namespace Model
          */
         virtual void SelectAsync(const Model::SelectRequest& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> The <code>Select</code> operation returns a set of attributes for
+         * <code>ItemNames</code> that match the select expression. <code>Select</code> is
+         * similar to the standard SQL SELECT statement. </p> <p> The total size of the
+         * response cannot exceed 1 MB in total size. Amazon SimpleDB automatically adjusts
+         * the number of items returned per page to enforce this limit. For example, if the
+         * client asks to retrieve 2500 items, but each individual item is 10 kB in size,
+         * the system returns 100 items and an appropriate <code>NextToken</code> so the
+         * client can access the next page of results. </p> <p> For information on how to
+         * construct select expressions, see Using Select to Create Amazon SimpleDB Queries
+         * in the Developer Guide. </p>
+         *
+         * Returns an awaitable that starts the operation the way SelectAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SelectRequest>
+        Aws::Utils::Threading::Awaitable<Model::SelectOutcome> SelectAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SelectOutcome>([this, request](const std::function<void(Model::SelectOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SelectAsync(request, [complete](const SimpleDBClient*, const Model::SelectRequest&, const Model::SelectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SelectOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -32,6 +32,7 @@
 #include <aws/sqs/model/SendMessageBatchResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -275,6 +276,44 @@ namespace Model
          */
         virtual void AddPermissionAsync(const Model::AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds a permission to a queue for a specific <a
+         * href="http://docs.aws.amazon.com/general/latest/gr/glos-chap.html#P">principal</a>.
+         * This allows for sharing access to the queue.</p> <p>When you create a queue, you
+         * have full control access rights for the queue. Only you (as owner of the queue)
+         * can grant or deny permissions to the queue. For more information about these
+         * permissions, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/acp-overview.html">Shared
+         * Queues</a> in the <i>Amazon SQS Developer Guide</i>.</p> <note>
+         * <p><code>AddPermission</code> writes an Amazon SQS-generated policy. If you want
+         * to write your own policy, use <a>SetQueueAttributes</a> to upload your policy.
+         * For more information about writing your own policy, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/AccessPolicyLanguage.html">Using
+         * The Access Policy Language</a> in the <i>Amazon SQS Developer Guide</i>.</p>
+         * </note> <note>Some API actions take lists of parameters. These lists are
+         * specified using the <code>param.n</code> notation. Values of <code>n</code> are
+         * integers starting from 1. For example, a parameter list with two elements looks
+         * like this: </note> <p><code>&amp;Attribute.1=this</code></p>
+         * <p><code>&amp;Attribute.2=that</code></p>
+         *
+         * Returns an awaitable that starts the operation the way AddPermissionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddPermissionRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddPermissionOutcome> AddPermissionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddPermissionOutcome>([this, request](const std::function<void(Model::AddPermissionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddPermissionAsync(request, [complete](const SQSClient*, const Model::AddPermissionRequest&, const Model::AddPermissionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddPermissionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes the visibility timeout of a specified message in a queue to a new
          * value. The maximum allowed timeout value you can set the value to is 12 hours.
@@ -375,6 +414,54 @@ namespace Model
          */
         virtual void ChangeMessageVisibilityAsync(const Model::ChangeMessageVisibilityRequest& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes the visibility timeout of a specified message in a queue to a new
+         * value. The maximum allowed timeout value you can set the value to is 12 hours.
+         * This means you can't extend the timeout of a message in an existing queue to
+         * more than a total visibility timeout of 12 hours. (For more information
+         * visibility timeout, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/AboutVT.html">Visibility
+         * Timeout</a> in the <i>Amazon SQS Developer Guide</i>.)</p> <p>For example, let's
+         * say you have a message and its default message visibility timeout is 30 minutes.
+         * You could call <code>ChangeMessageVisiblity</code> with a value of two hours and
+         * the effective timeout would be two hours and 30 minutes. When that time comes
+         * near you could again extend the time out by calling ChangeMessageVisiblity, but
+         * this time the maximum allowed timeout would be 9 hours and 30 minutes.</p>
+         * <note><p>There is a 120,000 limit for the number of inflight messages per queue.
+         * Messages are inflight after they have been received from the queue by a
+         * consuming component, but have not yet been deleted from the queue. If you reach
+         * the 120,000 limit, you will receive an OverLimit error message from Amazon SQS.
+         * To help avoid reaching the limit, you should delete the messages from the queue
+         * after they have been processed. You can also increase the number of queues you
+         * use to process the messages. </p></note> <important>If you attempt to set the
+         * <code>VisibilityTimeout</code> to an amount more than the maximum time left,
+         * Amazon SQS returns an error. It will not automatically recalculate and increase
+         * the timeout to the maximum time remaining.</important> <important>Unlike with a
+         * queue, when you change the visibility timeout for a specific message, that
+         * timeout value is applied immediately but is not saved in memory for that
+         * message. If you don't delete a message after it is received, the visibility
+         * timeout for the message the next time it is received reverts to the original
+         * timeout value, not the value you set with the
+         * <code>ChangeMessageVisibility</code> action.</important>
+         *
+         * Returns an awaitable that starts the operation the way ChangeMessageVisibilityAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ChangeMessageVisibilityRequest>
+        Aws::Utils::Threading::Awaitable<Model::ChangeMessageVisibilityOutcome> ChangeMessageVisibilityAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ChangeMessageVisibilityOutcome>([this, request](const std::function<void(Model::ChangeMessageVisibilityOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ChangeMessageVisibilityAsync(request, [complete](const SQSClient*, const Model::ChangeMessageVisibilityRequest&, const Model::ChangeMessageVisibilityOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ChangeMessageVisibilityOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Changes the visibility timeout of multiple messages. This is a batch version
          * of <a>ChangeMessageVisibility</a>. The result of the action on each message is
@@ -427,6 +514,38 @@ namespace Model
          */
         virtual void ChangeMessageVisibilityBatchAsync(const Model::ChangeMessageVisibilityBatchRequest& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Changes the visibility timeout of multiple messages. This is a batch version
+         * of <a>ChangeMessageVisibility</a>. The result of the action on each message is
+         * reported individually in the response. You can send up to 10
+         * <a>ChangeMessageVisibility</a> requests with each
+         * <code>ChangeMessageVisibilityBatch</code> action.</p> <important>Because the
+         * batch request can result in a combination of successful and unsuccessful
+         * actions, you should check for batch errors even when the call returns an HTTP
+         * status code of 200.</important> <note>Some API actions take lists of parameters.
+         * These lists are specified using the <code>param.n</code> notation. Values of
+         * <code>n</code> are integers starting from 1. For example, a parameter list with
+         * two elements looks like this: </note> <p><code>&amp;Attribute.1=this</code></p>
+         * <p><code>&amp;Attribute.2=that</code></p>
+         *
+         * Returns an awaitable that starts the operation the way ChangeMessageVisibilityBatchAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ChangeMessageVisibilityBatchRequest>
+        Aws::Utils::Threading::Awaitable<Model::ChangeMessageVisibilityBatchOutcome> ChangeMessageVisibilityBatchAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ChangeMessageVisibilityBatchOutcome>([this, request](const std::function<void(Model::ChangeMessageVisibilityBatchOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ChangeMessageVisibilityBatchAsync(request, [complete](const SQSClient*, const Model::ChangeMessageVisibilityBatchRequest&, const Model::ChangeMessageVisibilityBatchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ChangeMessageVisibilityBatchOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new queue, or returns the URL of an existing one. When you request
          * <code>CreateQueue</code>, you provide a name for the queue. To successfully
@@ -500,6 +619,45 @@ namespace Model
          */
         virtual void CreateQueueAsync(const Model::CreateQueueRequest& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new queue, or returns the URL of an existing one. When you request
+         * <code>CreateQueue</code>, you provide a name for the queue. To successfully
+         * create a new queue, you must provide a name that is unique within the scope of
+         * your own queues.</p> <note> <p>If you delete a queue, you must wait at least 60
+         * seconds before creating a queue with the same name.</p> </note> <p>You may pass
+         * one or more attributes in the request. If you do not provide a value for any
+         * attribute, the queue will have the default value for that attribute. Permitted
+         * attributes are the same that can be set using <a>SetQueueAttributes</a>.</p>
+         * <note><p>Use <a>GetQueueUrl</a> to get a queue's URL. <a>GetQueueUrl</a>
+         * requires only the <code>QueueName</code> parameter.</p></note> <p>If you provide
+         * the name of an existing queue, along with the exact names and values of all the
+         * queue's attributes, <code>CreateQueue</code> returns the queue URL for the
+         * existing queue. If the queue name, attribute names, or attribute values do not
+         * match an existing queue, <code>CreateQueue</code> returns an error.</p>
+         * <note>Some API actions take lists of parameters. These lists are specified using
+         * the <code>param.n</code> notation. Values of <code>n</code> are integers
+         * starting from 1. For example, a parameter list with two elements looks like
+         * this: </note> <p><code>&amp;Attribute.1=this</code></p>
+         * <p><code>&amp;Attribute.2=that</code></p>
+         *
+         * Returns an awaitable that starts the operation the way CreateQueueAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateQueueRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateQueueOutcome> CreateQueueAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateQueueOutcome>([this, request](const std::function<void(Model::CreateQueueOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateQueueAsync(request, [complete](const SQSClient*, const Model::CreateQueueRequest&, const Model::CreateQueueOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateQueueOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the specified message from the specified queue. You specify the
          * message by using the message's <code>receipt handle</code> and not the
@@ -570,6 +728,44 @@ namespace Model
          */
         virtual void DeleteMessageAsync(const Model::DeleteMessageRequest& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the specified message from the specified queue. You specify the
+         * message by using the message's <code>receipt handle</code> and not the
+         * <code>message ID</code> you received when you sent the message. Even if the
+         * message is locked by another reader due to the visibility timeout setting, it is
+         * still deleted from the queue. If you leave a message in the queue for longer
+         * than the queue's configured retention period, Amazon SQS automatically deletes
+         * it. </p> <note> <p> The receipt handle is associated with a specific instance of
+         * receiving the message. If you receive a message more than once, the receipt
+         * handle you get each time you receive the message is different. When you request
+         * <code>DeleteMessage</code>, if you don't provide the most recently received
+         * receipt handle for the message, the request will still succeed, but the message
+         * might not be deleted. </p> </note> <important> <p> It is possible you will
+         * receive a message even after you have deleted it. This might happen on rare
+         * occasions if one of the servers storing a copy of the message is unavailable
+         * when you request to delete the message. The copy remains on the server and might
+         * be returned to you again on a subsequent receive request. You should create your
+         * system to be idempotent so that receiving a particular message more than once is
+         * not a problem. </p> </important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteMessageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteMessageRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteMessageOutcome> DeleteMessageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteMessageOutcome>([this, request](const std::function<void(Model::DeleteMessageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteMessageAsync(request, [complete](const SQSClient*, const Model::DeleteMessageRequest&, const Model::DeleteMessageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteMessageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes up to ten messages from the specified queue. This is a batch version
          * of <a>DeleteMessage</a>. The result of the delete action on each message is
@@ -616,6 +812,36 @@ namespace Model
          */
         virtual void DeleteMessageBatchAsync(const Model::DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes up to ten messages from the specified queue. This is a batch version
+         * of <a>DeleteMessage</a>. The result of the delete action on each message is
+         * reported individually in the response.</p> <important> <p> Because the batch
+         * request can result in a combination of successful and unsuccessful actions, you
+         * should check for batch errors even when the call returns an HTTP status code of
+         * 200. </p> </important> <note>Some API actions take lists of parameters. These
+         * lists are specified using the <code>param.n</code> notation. Values of
+         * <code>n</code> are integers starting from 1. For example, a parameter list with
+         * two elements looks like this: </note> <p><code>&amp;Attribute.1=this</code></p>
+         * <p><code>&amp;Attribute.2=that</code></p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteMessageBatchAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteMessageBatchRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteMessageBatchOutcome> DeleteMessageBatchAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteMessageBatchOutcome>([this, request](const std::function<void(Model::DeleteMessageBatchOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteMessageBatchAsync(request, [complete](const SQSClient*, const Model::DeleteMessageBatchRequest&, const Model::DeleteMessageBatchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteMessageBatchOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Deletes the queue specified by the <b>queue URL</b>, regardless of whether
          * the queue is empty. If the specified queue does not exist, Amazon SQS returns a
@@ -671,6 +897,39 @@ namespace Model
          */
         virtual void DeleteQueueAsync(const Model::DeleteQueueRequest& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Deletes the queue specified by the <b>queue URL</b>, regardless of whether
+         * the queue is empty. If the specified queue does not exist, Amazon SQS returns a
+         * successful response. </p> <important> <p> Use <code>DeleteQueue</code> with
+         * care; once you delete your queue, any messages in the queue are no longer
+         * available. </p> </important> <p> When you delete a queue, the deletion process
+         * takes up to 60 seconds. Requests you send involving that queue during the 60
+         * seconds might succeed. For example, a <a>SendMessage</a> request might succeed,
+         * but after the 60 seconds, the queue and that message you sent no longer exist.
+         * Also, when you delete a queue, you must wait at least 60 seconds before creating
+         * a queue with the same name. </p> <p> We reserve the right to delete queues that
+         * have had no activity for more than 30 days. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/SQSConcepts.html">How
+         * Amazon SQS Queues Work</a> in the <i>Amazon SQS Developer Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteQueueAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteQueueRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteQueueOutcome> DeleteQueueAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteQueueOutcome>([this, request](const std::function<void(Model::DeleteQueueOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteQueueAsync(request, [complete](const SQSClient*, const Model::DeleteQueueRequest&, const Model::DeleteQueueOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteQueueOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets attributes for the specified queue. The following attributes are
          * supported: <ul> <li> <code>All</code> - returns all values.</li> <li>
@@ -810,6 +1069,67 @@ namespace Model
          */
         virtual void GetQueueAttributesAsync(const Model::GetQueueAttributesRequest& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets attributes for the specified queue. The following attributes are
+         * supported: <ul> <li> <code>All</code> - returns all values.</li> <li>
+         * <code>ApproximateNumberOfMessages</code> - returns the approximate number of
+         * visible messages in a queue. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/ApproximateNumber.html">Resources
+         * Required to Process Messages</a> in the <i>Amazon SQS Developer Guide</i>.</li>
+         * <li> <code>ApproximateNumberOfMessagesNotVisible</code> - returns the
+         * approximate number of messages that are not timed-out and not deleted. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/ApproximateNumber.html">Resources
+         * Required to Process Messages</a> in the <i>Amazon SQS Developer Guide</i>.</li>
+         * <li> <code>VisibilityTimeout</code> - returns the visibility timeout for the
+         * queue. For more information about visibility timeout, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/AboutVT.html">Visibility
+         * Timeout</a> in the <i>Amazon SQS Developer Guide</i>.</li> <li>
+         * <code>CreatedTimestamp</code> - returns the time when the queue was created
+         * (epoch time in seconds).</li> <li> <code>LastModifiedTimestamp</code> - returns
+         * the time when the queue was last changed (epoch time in seconds).</li> <li>
+         * <code>Policy</code> - returns the queue's policy.</li> <li>
+         * <code>MaximumMessageSize</code> - returns the limit of how many bytes a message
+         * can contain before Amazon SQS rejects it.</li> <li>
+         * <code>MessageRetentionPeriod</code> - returns the number of seconds Amazon SQS
+         * retains a message.</li> <li> <code>QueueArn</code> - returns the queue's Amazon
+         * resource name (ARN).</li> <li> <code>ApproximateNumberOfMessagesDelayed</code> -
+         * returns the approximate number of messages that are pending to be added to the
+         * queue.</li> <li> <code>DelaySeconds</code> - returns the default delay on the
+         * queue in seconds.</li> <li> <code>ReceiveMessageWaitTimeSeconds</code> - returns
+         * the time for which a ReceiveMessage call will wait for a message to arrive.</li>
+         * <li> <code>RedrivePolicy</code> - returns the parameters for dead letter queue
+         * functionality of the source queue. For more information about RedrivePolicy and
+         * dead letter queues, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/SQSDeadLetterQueue.html">Using
+         * Amazon SQS Dead Letter Queues</a> in the <i>Amazon SQS Developer Guide</i>.</li>
+         * </ul> </p> <note>Going forward, new attributes might be added. If you are
+         * writing code that calls this action, we recommend that you structure your code
+         * so that it can handle new attributes gracefully.</note> <note>Some API actions
+         * take lists of parameters. These lists are specified using the
+         * <code>param.n</code> notation. Values of <code>n</code> are integers starting
+         * from 1. For example, a parameter list with two elements looks like this: </note>
+         * <p><code>&amp;Attribute.1=this</code></p>
+         * <p><code>&amp;Attribute.2=that</code></p>
+         *
+         * Returns an awaitable that starts the operation the way GetQueueAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetQueueAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetQueueAttributesOutcome> GetQueueAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetQueueAttributesOutcome>([this, request](const std::function<void(Model::GetQueueAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetQueueAttributesAsync(request, [complete](const SQSClient*, const Model::GetQueueAttributesRequest&, const Model::GetQueueAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetQueueAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Returns the URL of an existing queue. This action provides a simple way to
          * retrieve the URL of an Amazon SQS queue. </p> <p> To access a queue that belongs
@@ -850,6 +1170,34 @@ namespace Model
          */
         virtual void GetQueueUrlAsync(const Model::GetQueueUrlRequest& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Returns the URL of an existing queue. This action provides a simple way to
+         * retrieve the URL of an Amazon SQS queue. </p> <p> To access a queue that belongs
+         * to another AWS account, use the <code>QueueOwnerAWSAccountId</code> parameter to
+         * specify the account ID of the queue's owner. The queue's owner must grant you
+         * permission to access the queue. For more information about shared queue access,
+         * see <a>AddPermission</a> or go to <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/acp-overview.html">Shared
+         * Queues</a> in the <i>Amazon SQS Developer Guide</i>. </p>
+         *
+         * Returns an awaitable that starts the operation the way GetQueueUrlAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetQueueUrlRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetQueueUrlOutcome> GetQueueUrlAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetQueueUrlOutcome>([this, request](const std::function<void(Model::GetQueueUrlOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetQueueUrlAsync(request, [complete](const SQSClient*, const Model::GetQueueUrlRequest&, const Model::GetQueueUrlOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetQueueUrlOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of your queues that have the RedrivePolicy queue attribute
          * configured with a dead letter queue.</p> <p>For more information about using
@@ -881,6 +1229,31 @@ namespace Model
          */
         virtual void ListDeadLetterSourceQueuesAsync(const Model::ListDeadLetterSourceQueuesRequest& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of your queues that have the RedrivePolicy queue attribute
+         * configured with a dead letter queue.</p> <p>For more information about using
+         * dead letter queues, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/SQSDeadLetterQueue.html">Using
+         * Amazon SQS Dead Letter Queues</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDeadLetterSourceQueuesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDeadLetterSourceQueuesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDeadLetterSourceQueuesOutcome> ListDeadLetterSourceQueuesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDeadLetterSourceQueuesOutcome>([this, request](const std::function<void(Model::ListDeadLetterSourceQueuesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDeadLetterSourceQueuesAsync(request, [complete](const SQSClient*, const Model::ListDeadLetterSourceQueuesRequest&, const Model::ListDeadLetterSourceQueuesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDeadLetterSourceQueuesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of your queues. The maximum number of queues that can be
          * returned is 1000. If you specify a value for the optional
@@ -909,6 +1282,30 @@ namespace Model
          */
         virtual void ListQueuesAsync(const Model::ListQueuesRequest& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of your queues. The maximum number of queues that can be
+         * returned is 1000. If you specify a value for the optional
+         * <code>QueueNamePrefix</code> parameter, only queues with a name beginning with
+         * the specified value are returned.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListQueuesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListQueuesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListQueuesOutcome> ListQueuesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListQueuesOutcome>([this, request](const std::function<void(Model::ListQueuesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListQueuesAsync(request, [complete](const SQSClient*, const Model::ListQueuesRequest&, const Model::ListQueuesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListQueuesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the messages in a queue specified by the <b>queue URL</b>.</p>
          * <important>When you use the <code>PurgeQueue</code> API, the deleted messages in
@@ -949,6 +1346,34 @@ namespace Model
          */
         virtual void PurgeQueueAsync(const Model::PurgeQueueRequest& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the messages in a queue specified by the <b>queue URL</b>.</p>
+         * <important>When you use the <code>PurgeQueue</code> API, the deleted messages in
+         * the queue cannot be retrieved.</important> <p>When you purge a queue, the
+         * message deletion process takes up to 60 seconds. All messages sent to the queue
+         * before calling <code>PurgeQueue</code> will be deleted; messages sent to the
+         * queue while it is being purged may be deleted. While the queue is being purged,
+         * messages sent to the queue before <code>PurgeQueue</code> was called may be
+         * received, but will be deleted within the next minute.</p>
+         *
+         * Returns an awaitable that starts the operation the way PurgeQueueAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PurgeQueueRequest>
+        Aws::Utils::Threading::Awaitable<Model::PurgeQueueOutcome> PurgeQueueAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PurgeQueueOutcome>([this, request](const std::function<void(Model::PurgeQueueOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PurgeQueueAsync(request, [complete](const SQSClient*, const Model::PurgeQueueRequest&, const Model::PurgeQueueOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PurgeQueueOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Retrieves one or more messages, with a maximum limit of 10 messages, from
          * the specified queue. Long poll support is enabled by using the
@@ -1061,6 +1486,58 @@ namespace Model
          */
         virtual void ReceiveMessageAsync(const Model::ReceiveMessageRequest& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Retrieves one or more messages, with a maximum limit of 10 messages, from
+         * the specified queue. Long poll support is enabled by using the
+         * <code>WaitTimeSeconds</code> parameter. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/sqs-long-polling.html">Amazon
+         * SQS Long Poll</a> in the <i>Amazon SQS Developer Guide</i>. </p> <p> Short poll
+         * is the default behavior where a weighted random set of machines is sampled on a
+         * <code>ReceiveMessage</code> call. This means only the messages on the sampled
+         * machines are returned. If the number of messages in the queue is small (less
+         * than 1000), it is likely you will get fewer messages than you requested per
+         * <code>ReceiveMessage</code> call. If the number of messages in the queue is
+         * extremely small, you might not receive any messages in a particular
+         * <code>ReceiveMessage</code> response; in which case you should repeat the
+         * request. </p> <p> For each message returned, the response includes the
+         * following: </p> <ul> <li> <p> Message body </p> </li> <li> <p> MD5 digest of the
+         * message body. For information about MD5, go to <a
+         * href="http://www.faqs.org/rfcs/rfc1321.html">http://www.faqs.org/rfcs/rfc1321.html</a>.
+         * </p> </li> <li> <p> Message ID you received when you sent the message to the
+         * queue. </p> </li> <li> <p> Receipt handle. </p> </li> <li> <p> Message
+         * attributes. </p> </li> <li> <p> MD5 digest of the message attributes. </p> </li>
+         * </ul> <p> The receipt handle is the identifier you must provide when deleting
+         * the message. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/ImportantIdentifiers.html">Queue
+         * and Message Identifiers</a> in the <i>Amazon SQS Developer Guide</i>. </p> <p>
+         * You can provide the <code>VisibilityTimeout</code> parameter in your request,
+         * which will be applied to the messages that Amazon SQS returns in the response.
+         * If you do not include the parameter, the overall visibility timeout for the
+         * queue is used for the returned messages. For more information, see <a
+         * href="http://docs.aws.amazon.com/AWSSimpleQueueService/latest/SQSDeveloperGuide/AboutVT.html">Visibility
+         * Timeout</a> in the <i>Amazon SQS Developer Guide</i>. </p> <note> <p> Going
+         * forward, new attributes might be added. If you are writing code that calls this
+         * action, we recommend that you structure your code so that it can handle new
+         * attributes gracefully. </p> </note>
+         *
+         * Returns an awaitable that starts the operation the way ReceiveMessageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ReceiveMessageRequest>
+        Aws::Utils::Threading::Awaitable<Model::ReceiveMessageOutcome> ReceiveMessageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ReceiveMessageOutcome>([this, request](const std::function<void(Model::ReceiveMessageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ReceiveMessageAsync(request, [complete](const SQSClient*, const Model::ReceiveMessageRequest&, const Model::ReceiveMessageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ReceiveMessageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Revokes any permissions in the queue policy that matches the specified
          * <code>Label</code> parameter. Only the owner of the queue can remove
@@ -1086,6 +1563,29 @@ namespace Model
          */
         virtual void RemovePermissionAsync(const Model::RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Revokes any permissions in the queue policy that matches the specified
+         * <code>Label</code> parameter. Only the owner of the queue can remove
+         * permissions.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemovePermissionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemovePermissionRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemovePermissionOutcome> RemovePermissionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemovePermissionOutcome>([this, request](const std::function<void(Model::RemovePermissionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemovePermissionAsync(request, [complete](const SQSClient*, const Model::RemovePermissionRequest&, const Model::RemovePermissionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemovePermissionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p> Delivers a message to the specified queue. With Amazon SQS, you now have the
          * ability to send large payload messages that are up to 256KB (262,144 bytes) in
@@ -1135,6 +1635,37 @@ namespace Model
          */
         virtual void SendMessageAsync(const Model::SendMessageRequest& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p> Delivers a message to the specified queue. With Amazon SQS, you now have the
+         * ability to send large payload messages that are up to 256KB (262,144 bytes) in
+         * size. To send large payloads, you must use an AWS SDK that supports SigV4
+         * signing. To verify whether SigV4 is supported for an AWS SDK, check the SDK
+         * release notes. </p> <important> <p> The following list shows the characters (in
+         * Unicode) allowed in your message, according to the W3C XML specification. For
+         * more information, go to <a
+         * href="http://www.w3.org/TR/REC-xml/#charsets">http://www.w3.org/TR/REC-xml/#charsets</a>
+         * If you send any characters not included in the list, your request will be
+         * rejected. </p> <p> #x9 | #xA | #xD | [#x20 to #xD7FF] | [#xE000 to #xFFFD] |
+         * [#x10000 to #x10FFFF] </p> </important>
+         *
+         * Returns an awaitable that starts the operation the way SendMessageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SendMessageRequest>
+        Aws::Utils::Threading::Awaitable<Model::SendMessageOutcome> SendMessageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SendMessageOutcome>([this, request](const std::function<void(Model::SendMessageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SendMessageAsync(request, [complete](const SQSClient*, const Model::SendMessageRequest&, const Model::SendMessageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SendMessageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Delivers up to ten messages to the specified queue. This is a batch version
          * of <a>SendMessage</a>. The result of the send action on each message is reported
@@ -1211,6 +1742,46 @@ namespace Model
          */
         virtual void SendMessageBatchAsync(const Model::SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Delivers up to ten messages to the specified queue. This is a batch version
+         * of <a>SendMessage</a>. The result of the send action on each message is reported
+         * individually in the response. The maximum allowed individual message size is 256
+         * KB (262,144 bytes).</p> <p>The maximum total payload size (i.e., the sum of all
+         * a batch's individual message lengths) is also 256 KB (262,144 bytes).</p> <p>If
+         * the <code>DelaySeconds</code> parameter is not specified for an entry, the
+         * default for the queue is used.</p> <important>The following list shows the
+         * characters (in Unicode) that are allowed in your message, according to the W3C
+         * XML specification. For more information, go to <a
+         * href="http://www.faqs.org/rfcs/rfc1321.html">http://www.faqs.org/rfcs/rfc1321.html</a>.
+         * If you send any characters that are not included in the list, your request will
+         * be rejected. <p>#x9 | #xA | #xD | [#x20 to #xD7FF] | [#xE000 to #xFFFD] |
+         * [#x10000 to #x10FFFF]</p> </important> <important> Because the batch request can
+         * result in a combination of successful and unsuccessful actions, you should check
+         * for batch errors even when the call returns an HTTP status code of 200.
+         * </important> <note>Some API actions take lists of parameters. These lists are
+         * specified using the <code>param.n</code> notation. Values of <code>n</code> are
+         * integers starting from 1. For example, a parameter list with two elements looks
+         * like this: </note> <p><code>&amp;Attribute.1=this</code></p>
+         * <p><code>&amp;Attribute.2=that</code></p>
+         *
+         * Returns an awaitable that starts the operation the way SendMessageBatchAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SendMessageBatchRequest>
+        Aws::Utils::Threading::Awaitable<Model::SendMessageBatchOutcome> SendMessageBatchAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SendMessageBatchOutcome>([this, request](const std::function<void(Model::SendMessageBatchOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SendMessageBatchAsync(request, [complete](const SQSClient*, const Model::SendMessageBatchRequest&, const Model::SendMessageBatchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SendMessageBatchOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the value of one or more queue attributes. When you change a queue's
          * attributes, the change can take up to 60 seconds for most of the attributes to
@@ -1248,6 +1819,33 @@ namespace Model
          */
         virtual void SetQueueAttributesAsync(const Model::SetQueueAttributesRequest& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the value of one or more queue attributes. When you change a queue's
+         * attributes, the change can take up to 60 seconds for most of the attributes to
+         * propagate throughout the SQS system. Changes made to the
+         * <code>MessageRetentionPeriod</code> attribute can take up to 15 minutes.</p>
+         * <note>Going forward, new attributes might be added. If you are writing code that
+         * calls this action, we recommend that you structure your code so that it can
+         * handle new attributes gracefully.</note>
+         *
+         * Returns an awaitable that starts the operation the way SetQueueAttributesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetQueueAttributesRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetQueueAttributesOutcome> SetQueueAttributesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetQueueAttributesOutcome>([this, request](const std::function<void(Model::SetQueueAttributesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetQueueAttributesAsync(request, [complete](const SQSClient*, const Model::SetQueueAttributesRequest&, const Model::SetQueueAttributesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetQueueAttributesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -109,7 +109,7 @@ void SQSClient::init(const ClientConfiguration& config)
 }
 AddPermissionOutcome SQSClient::AddPermission(const AddPermissionRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "AddPermission");
   if(outcome.IsSuccess())
   {
     return AddPermissionOutcome(NoResult());
@@ -122,22 +122,44 @@ AddPermissionOutcome SQSClient::AddPermission(const AddPermissionRequest& reques
 
 AddPermissionOutcomeCallable SQSClient::AddPermissionCallable(const AddPermissionRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::AddPermission, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< AddPermissionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AddPermission( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< AddPermissionOutcome > rejected;
+    rejected.set_value(AddPermissionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::AddPermissionAsync(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::AddPermissionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::AddPermissionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, AddPermissionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::AddPermissionAsyncHelper(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, AddPermission(request), context);
+  auto sharedRequest = Aws::MakeShared<AddPermissionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "AddPermission", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, AddPermissionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, AddPermissionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ChangeMessageVisibilityOutcome SQSClient::ChangeMessageVisibility(const ChangeMessageVisibilityRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "ChangeMessageVisibility");
   if(outcome.IsSuccess())
   {
     return ChangeMessageVisibilityOutcome(NoResult());
@@ -150,22 +172,44 @@ ChangeMessageVisibilityOutcome SQSClient::ChangeMessageVisibility(const ChangeMe
 
 ChangeMessageVisibilityOutcomeCallable SQSClient::ChangeMessageVisibilityCallable(const ChangeMessageVisibilityRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::ChangeMessageVisibility, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ChangeMessageVisibilityOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ChangeMessageVisibility( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ChangeMessageVisibilityOutcome > rejected;
+    rejected.set_value(ChangeMessageVisibilityOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::ChangeMessageVisibilityAsync(const ChangeMessageVisibilityRequest& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::ChangeMessageVisibilityAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::ChangeMessageVisibilityAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ChangeMessageVisibilityOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::ChangeMessageVisibilityAsyncHelper(const ChangeMessageVisibilityRequest& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ChangeMessageVisibility(request), context);
+  auto sharedRequest = Aws::MakeShared<ChangeMessageVisibilityRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "ChangeMessageVisibility", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ChangeMessageVisibilityOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ChangeMessageVisibilityOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ChangeMessageVisibilityBatchOutcome SQSClient::ChangeMessageVisibilityBatch(const ChangeMessageVisibilityBatchRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "ChangeMessageVisibilityBatch");
   if(outcome.IsSuccess())
   {
     return ChangeMessageVisibilityBatchOutcome(ChangeMessageVisibilityBatchResult(outcome.GetResult()));
@@ -178,17 +222,39 @@ ChangeMessageVisibilityBatchOutcome SQSClient::ChangeMessageVisibilityBatch(cons
 
 ChangeMessageVisibilityBatchOutcomeCallable SQSClient::ChangeMessageVisibilityBatchCallable(const ChangeMessageVisibilityBatchRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::ChangeMessageVisibilityBatch, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ChangeMessageVisibilityBatchOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ChangeMessageVisibilityBatch( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ChangeMessageVisibilityBatchOutcome > rejected;
+    rejected.set_value(ChangeMessageVisibilityBatchOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::ChangeMessageVisibilityBatchAsync(const ChangeMessageVisibilityBatchRequest& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::ChangeMessageVisibilityBatchAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::ChangeMessageVisibilityBatchAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ChangeMessageVisibilityBatchOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::ChangeMessageVisibilityBatchAsyncHelper(const ChangeMessageVisibilityBatchRequest& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ChangeMessageVisibilityBatch(request), context);
+  auto sharedRequest = Aws::MakeShared<ChangeMessageVisibilityBatchRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "ChangeMessageVisibilityBatch", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ChangeMessageVisibilityBatchOutcome(ChangeMessageVisibilityBatchResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ChangeMessageVisibilityBatchOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 CreateQueueOutcome SQSClient::CreateQueue(const CreateQueueRequest& request) const
@@ -197,7 +263,7 @@ CreateQueueOutcome SQSClient::CreateQueue(const CreateQueueRequest& request) con
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "CreateQueue");
   if(outcome.IsSuccess())
   {
     return CreateQueueOutcome(CreateQueueResult(outcome.GetResult()));
@@ -210,22 +276,47 @@ CreateQueueOutcome SQSClient::CreateQueue(const CreateQueueRequest& request) con
 
 CreateQueueOutcomeCallable SQSClient::CreateQueueCallable(const CreateQueueRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::CreateQueue, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< CreateQueueOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateQueue( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< CreateQueueOutcome > rejected;
+    rejected.set_value(CreateQueueOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::CreateQueueAsync(const CreateQueueRequest& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::CreateQueueAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::CreateQueueAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, CreateQueueOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::CreateQueueAsyncHelper(const CreateQueueRequest& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, CreateQueue(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  auto sharedRequest = Aws::MakeShared<CreateQueueRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "CreateQueue", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, CreateQueueOutcome(CreateQueueResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, CreateQueueOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteMessageOutcome SQSClient::DeleteMessage(const DeleteMessageRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "DeleteMessage");
   if(outcome.IsSuccess())
   {
     return DeleteMessageOutcome(NoResult());
@@ -238,22 +329,44 @@ DeleteMessageOutcome SQSClient::DeleteMessage(const DeleteMessageRequest& reques
 
 DeleteMessageOutcomeCallable SQSClient::DeleteMessageCallable(const DeleteMessageRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::DeleteMessage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteMessageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteMessage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteMessageOutcome > rejected;
+    rejected.set_value(DeleteMessageOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::DeleteMessageAsync(const DeleteMessageRequest& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::DeleteMessageAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::DeleteMessageAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteMessageOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::DeleteMessageAsyncHelper(const DeleteMessageRequest& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteMessage(request), context);
+  auto sharedRequest = Aws::MakeShared<DeleteMessageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "DeleteMessage", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteMessageOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteMessageOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteMessageBatchOutcome SQSClient::DeleteMessageBatch(const DeleteMessageBatchRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "DeleteMessageBatch");
   if(outcome.IsSuccess())
   {
     return DeleteMessageBatchOutcome(DeleteMessageBatchResult(outcome.GetResult()));
@@ -266,22 +379,44 @@ DeleteMessageBatchOutcome SQSClient::DeleteMessageBatch(const DeleteMessageBatch
 
 DeleteMessageBatchOutcomeCallable SQSClient::DeleteMessageBatchCallable(const DeleteMessageBatchRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::DeleteMessageBatch, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteMessageBatchOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteMessageBatch( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteMessageBatchOutcome > rejected;
+    rejected.set_value(DeleteMessageBatchOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::DeleteMessageBatchAsync(const DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::DeleteMessageBatchAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::DeleteMessageBatchAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteMessageBatchOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::DeleteMessageBatchAsyncHelper(const DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteMessageBatch(request), context);
+  auto sharedRequest = Aws::MakeShared<DeleteMessageBatchRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "DeleteMessageBatch", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteMessageBatchOutcome(DeleteMessageBatchResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteMessageBatchOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 DeleteQueueOutcome SQSClient::DeleteQueue(const DeleteQueueRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "DeleteQueue");
   if(outcome.IsSuccess())
   {
     return DeleteQueueOutcome(NoResult());
@@ -294,22 +429,44 @@ DeleteQueueOutcome SQSClient::DeleteQueue(const DeleteQueueRequest& request) con
 
 DeleteQueueOutcomeCallable SQSClient::DeleteQueueCallable(const DeleteQueueRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::DeleteQueue, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< DeleteQueueOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteQueue( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< DeleteQueueOutcome > rejected;
+    rejected.set_value(DeleteQueueOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::DeleteQueueAsync(const DeleteQueueRequest& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::DeleteQueueAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::DeleteQueueAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, DeleteQueueOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::DeleteQueueAsyncHelper(const DeleteQueueRequest& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, DeleteQueue(request), context);
+  auto sharedRequest = Aws::MakeShared<DeleteQueueRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "DeleteQueue", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, DeleteQueueOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, DeleteQueueOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetQueueAttributesOutcome SQSClient::GetQueueAttributes(const GetQueueAttributesRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "GetQueueAttributes");
   if(outcome.IsSuccess())
   {
     return GetQueueAttributesOutcome(GetQueueAttributesResult(outcome.GetResult()));
@@ -322,17 +479,39 @@ GetQueueAttributesOutcome SQSClient::GetQueueAttributes(const GetQueueAttributes
 
 GetQueueAttributesOutcomeCallable SQSClient::GetQueueAttributesCallable(const GetQueueAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::GetQueueAttributes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetQueueAttributesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetQueueAttributes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetQueueAttributesOutcome > rejected;
+    rejected.set_value(GetQueueAttributesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::GetQueueAttributesAsync(const GetQueueAttributesRequest& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::GetQueueAttributesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::GetQueueAttributesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetQueueAttributesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::GetQueueAttributesAsyncHelper(const GetQueueAttributesRequest& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetQueueAttributes(request), context);
+  auto sharedRequest = Aws::MakeShared<GetQueueAttributesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "GetQueueAttributes", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetQueueAttributesOutcome(GetQueueAttributesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetQueueAttributesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 GetQueueUrlOutcome SQSClient::GetQueueUrl(const GetQueueUrlRequest& request) const
@@ -341,7 +520,7 @@ GetQueueUrlOutcome SQSClient::GetQueueUrl(const GetQueueUrlRequest& request) con
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "GetQueueUrl");
   if(outcome.IsSuccess())
   {
     return GetQueueUrlOutcome(GetQueueUrlResult(outcome.GetResult()));
@@ -354,22 +533,47 @@ GetQueueUrlOutcome SQSClient::GetQueueUrl(const GetQueueUrlRequest& request) con
 
 GetQueueUrlOutcomeCallable SQSClient::GetQueueUrlCallable(const GetQueueUrlRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::GetQueueUrl, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< GetQueueUrlOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetQueueUrl( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< GetQueueUrlOutcome > rejected;
+    rejected.set_value(GetQueueUrlOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::GetQueueUrlAsync(const GetQueueUrlRequest& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::GetQueueUrlAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::GetQueueUrlAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, GetQueueUrlOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::GetQueueUrlAsyncHelper(const GetQueueUrlRequest& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, GetQueueUrl(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  auto sharedRequest = Aws::MakeShared<GetQueueUrlRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "GetQueueUrl", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, GetQueueUrlOutcome(GetQueueUrlResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, GetQueueUrlOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListDeadLetterSourceQueuesOutcome SQSClient::ListDeadLetterSourceQueues(const ListDeadLetterSourceQueuesRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "ListDeadLetterSourceQueues");
   if(outcome.IsSuccess())
   {
     return ListDeadLetterSourceQueuesOutcome(ListDeadLetterSourceQueuesResult(outcome.GetResult()));
@@ -382,17 +586,39 @@ ListDeadLetterSourceQueuesOutcome SQSClient::ListDeadLetterSourceQueues(const Li
 
 ListDeadLetterSourceQueuesOutcomeCallable SQSClient::ListDeadLetterSourceQueuesCallable(const ListDeadLetterSourceQueuesRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::ListDeadLetterSourceQueues, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListDeadLetterSourceQueuesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDeadLetterSourceQueues( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListDeadLetterSourceQueuesOutcome > rejected;
+    rejected.set_value(ListDeadLetterSourceQueuesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::ListDeadLetterSourceQueuesAsync(const ListDeadLetterSourceQueuesRequest& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::ListDeadLetterSourceQueuesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::ListDeadLetterSourceQueuesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListDeadLetterSourceQueuesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::ListDeadLetterSourceQueuesAsyncHelper(const ListDeadLetterSourceQueuesRequest& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListDeadLetterSourceQueues(request), context);
+  auto sharedRequest = Aws::MakeShared<ListDeadLetterSourceQueuesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "ListDeadLetterSourceQueues", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListDeadLetterSourceQueuesOutcome(ListDeadLetterSourceQueuesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListDeadLetterSourceQueuesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ListQueuesOutcome SQSClient::ListQueues(const ListQueuesRequest& request) const
@@ -401,7 +627,7 @@ ListQueuesOutcome SQSClient::ListQueues(const ListQueuesRequest& request) const
   Aws::StringStream ss;
   ss << m_uri << "/";
 
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST, "ListQueues");
   if(outcome.IsSuccess())
   {
     return ListQueuesOutcome(ListQueuesResult(outcome.GetResult()));
@@ -414,22 +640,47 @@ ListQueuesOutcome SQSClient::ListQueues(const ListQueuesRequest& request) const
 
 ListQueuesOutcomeCallable SQSClient::ListQueuesCallable(const ListQueuesRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::ListQueues, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ListQueuesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListQueues( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ListQueuesOutcome > rejected;
+    rejected.set_value(ListQueuesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::ListQueuesAsync(const ListQueuesRequest& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::ListQueuesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::ListQueuesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ListQueuesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::ListQueuesAsyncHelper(const ListQueuesRequest& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ListQueues(request), context);
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  auto sharedRequest = Aws::MakeShared<ListQueuesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(ss.str(), sharedRequest, HttpMethod::HTTP_POST, "ListQueues", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ListQueuesOutcome(ListQueuesResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ListQueuesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 PurgeQueueOutcome SQSClient::PurgeQueue(const PurgeQueueRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "PurgeQueue");
   if(outcome.IsSuccess())
   {
     return PurgeQueueOutcome(NoResult());
@@ -442,22 +693,44 @@ PurgeQueueOutcome SQSClient::PurgeQueue(const PurgeQueueRequest& request) const
 
 PurgeQueueOutcomeCallable SQSClient::PurgeQueueCallable(const PurgeQueueRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::PurgeQueue, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< PurgeQueueOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PurgeQueue( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< PurgeQueueOutcome > rejected;
+    rejected.set_value(PurgeQueueOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::PurgeQueueAsync(const PurgeQueueRequest& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::PurgeQueueAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::PurgeQueueAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, PurgeQueueOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::PurgeQueueAsyncHelper(const PurgeQueueRequest& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, PurgeQueue(request), context);
+  auto sharedRequest = Aws::MakeShared<PurgeQueueRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "PurgeQueue", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, PurgeQueueOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, PurgeQueueOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 ReceiveMessageOutcome SQSClient::ReceiveMessage(const ReceiveMessageRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "ReceiveMessage");
   if(outcome.IsSuccess())
   {
     return ReceiveMessageOutcome(ReceiveMessageResult(outcome.GetResult()));
@@ -470,22 +743,44 @@ ReceiveMessageOutcome SQSClient::ReceiveMessage(const ReceiveMessageRequest& req
 
 ReceiveMessageOutcomeCallable SQSClient::ReceiveMessageCallable(const ReceiveMessageRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::ReceiveMessage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< ReceiveMessageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ReceiveMessage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< ReceiveMessageOutcome > rejected;
+    rejected.set_value(ReceiveMessageOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::ReceiveMessageAsync(const ReceiveMessageRequest& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::ReceiveMessageAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::ReceiveMessageAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, ReceiveMessageOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::ReceiveMessageAsyncHelper(const ReceiveMessageRequest& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, ReceiveMessage(request), context);
+  auto sharedRequest = Aws::MakeShared<ReceiveMessageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "ReceiveMessage", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, ReceiveMessageOutcome(ReceiveMessageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, ReceiveMessageOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 RemovePermissionOutcome SQSClient::RemovePermission(const RemovePermissionRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "RemovePermission");
   if(outcome.IsSuccess())
   {
     return RemovePermissionOutcome(NoResult());
@@ -498,22 +793,44 @@ RemovePermissionOutcome SQSClient::RemovePermission(const RemovePermissionReques
 
 RemovePermissionOutcomeCallable SQSClient::RemovePermissionCallable(const RemovePermissionRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::RemovePermission, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< RemovePermissionOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RemovePermission( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< RemovePermissionOutcome > rejected;
+    rejected.set_value(RemovePermissionOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::RemovePermissionAsync(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::RemovePermissionAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::RemovePermissionAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, RemovePermissionOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::RemovePermissionAsyncHelper(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, RemovePermission(request), context);
+  auto sharedRequest = Aws::MakeShared<RemovePermissionRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "RemovePermission", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, RemovePermissionOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, RemovePermissionOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SendMessageOutcome SQSClient::SendMessage(const SendMessageRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "SendMessage");
   if(outcome.IsSuccess())
   {
     return SendMessageOutcome(SendMessageResult(outcome.GetResult()));
@@ -526,22 +843,44 @@ SendMessageOutcome SQSClient::SendMessage(const SendMessageRequest& request) con
 
 SendMessageOutcomeCallable SQSClient::SendMessageCallable(const SendMessageRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::SendMessage, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SendMessageOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SendMessage( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SendMessageOutcome > rejected;
+    rejected.set_value(SendMessageOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::SendMessageAsync(const SendMessageRequest& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::SendMessageAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::SendMessageAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SendMessageOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::SendMessageAsyncHelper(const SendMessageRequest& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SendMessage(request), context);
+  auto sharedRequest = Aws::MakeShared<SendMessageRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "SendMessage", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SendMessageOutcome(SendMessageResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SendMessageOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SendMessageBatchOutcome SQSClient::SendMessageBatch(const SendMessageBatchRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "SendMessageBatch");
   if(outcome.IsSuccess())
   {
     return SendMessageBatchOutcome(SendMessageBatchResult(outcome.GetResult()));
@@ -554,22 +893,44 @@ SendMessageBatchOutcome SQSClient::SendMessageBatch(const SendMessageBatchReques
 
 SendMessageBatchOutcomeCallable SQSClient::SendMessageBatchCallable(const SendMessageBatchRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::SendMessageBatch, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SendMessageBatchOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SendMessageBatch( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SendMessageBatchOutcome > rejected;
+    rejected.set_value(SendMessageBatchOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::SendMessageBatchAsync(const SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::SendMessageBatchAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::SendMessageBatchAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SendMessageBatchOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::SendMessageBatchAsyncHelper(const SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SendMessageBatch(request), context);
+  auto sharedRequest = Aws::MakeShared<SendMessageBatchRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "SendMessageBatch", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SendMessageBatchOutcome(SendMessageBatchResult(outcome.GetResult())), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SendMessageBatchOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
 SetQueueAttributesOutcome SQSClient::SetQueueAttributes(const SetQueueAttributesRequest& request) const
 {
-  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST);
+  XmlOutcome outcome = MakeRequest(request.GetQueueUrl(), request, HttpMethod::HTTP_POST, "SetQueueAttributes");
   if(outcome.IsSuccess())
   {
     return SetQueueAttributesOutcome(NoResult());
@@ -582,16 +943,38 @@ SetQueueAttributesOutcome SQSClient::SetQueueAttributes(const SetQueueAttributes
 
 SetQueueAttributesOutcomeCallable SQSClient::SetQueueAttributesCallable(const SetQueueAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::SetQueueAttributes, this, request);
+  auto task = Aws::MakeShared< std::packaged_task< SetQueueAttributesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->SetQueueAttributes( request ); } );
+  auto packagedFunction = [task]() { (*task)(); };
+  if(!m_executor->Submit(packagedFunction))
+  {
+    std::promise< SetQueueAttributesOutcome > rejected;
+    rejected.set_value(SetQueueAttributesOutcome(BuildExecutorRejectedError()));
+    return rejected.get_future();
+  }
+  return task->get_future();
 }
 
 void SQSClient::SetQueueAttributesAsync(const SetQueueAttributesRequest& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::SetQueueAttributesAsyncHelper, this, request, handler, context);
+  if(!m_executor->Submit(&SQSClient::SetQueueAttributesAsyncHelper, this, request, handler, context))
+  {
+    handler(this, request, SetQueueAttributesOutcome(BuildExecutorRejectedError()), context);
+  }
 }
 
 void SQSClient::SetQueueAttributesAsyncHelper(const SetQueueAttributesRequest& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  handler(this, request, SetQueueAttributes(request), context);
+  auto sharedRequest = Aws::MakeShared<SetQueueAttributesRequest>(ALLOCATION_TAG, request);
+  MakeRequestAsync(request.GetQueueUrl(), sharedRequest, HttpMethod::HTTP_POST, "SetQueueAttributes", [this, sharedRequest, handler, context](XmlOutcome&& outcome)
+  {
+    if(outcome.IsSuccess())
+    {
+      handler(this, *sharedRequest, SetQueueAttributesOutcome(NoResult()), context);
+    }
+    else
+    {
+      handler(this, *sharedRequest, SetQueueAttributesOutcome(outcome.GetError()), context);
+    }
+  });
 }
 
@@ -37,6 +37,7 @@
 #include <aws/ssm/model/SendCommandResult.h>
 #include <aws/ssm/model/UpdateAssociationStatusResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -283,6 +284,29 @@ namespace Model
          */
         virtual void CancelCommandAsync(const Model::CancelCommandRequest& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Attempts to cancel the command specified by the Command ID. There is no
+         * guarantee that the command will be terminated and the underlying process
+         * stopped.</p>
+         *
+         * Returns an awaitable that starts the operation the way CancelCommandAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelCommandRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelCommandOutcome> CancelCommandAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelCommandOutcome>([this, request](const std::function<void(Model::CancelCommandOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelCommandAsync(request, [complete](const SSMClient*, const Model::CancelCommandRequest&, const Model::CancelCommandOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelCommandOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Associates the specified SSM document with the specified instance.</p>
          * <p>When you associate an SSM document with an instance, the configuration agent
@@ -317,6 +341,32 @@ namespace Model
          */
         virtual void CreateAssociationAsync(const Model::CreateAssociationRequest& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Associates the specified SSM document with the specified instance.</p>
+         * <p>When you associate an SSM document with an instance, the configuration agent
+         * on the instance processes the document and configures the instance as
+         * specified.</p> <p>If you associate a document with an instance that already has
+         * an associated document, the system throws the AssociationAlreadyExists
+         * exception.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateAssociationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAssociationRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAssociationOutcome> CreateAssociationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAssociationOutcome>([this, request](const std::function<void(Model::CreateAssociationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAssociationAsync(request, [complete](const SSMClient*, const Model::CreateAssociationRequest&, const Model::CreateAssociationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAssociationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Associates the specified SSM document with the specified instances.</p>
          * <p>When you associate an SSM document with an instance, the configuration agent
@@ -351,6 +401,32 @@ namespace Model
          */
         virtual void CreateAssociationBatchAsync(const Model::CreateAssociationBatchRequest& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Associates the specified SSM document with the specified instances.</p>
+         * <p>When you associate an SSM document with an instance, the configuration agent
+         * on the instance processes the document and configures the instance as
+         * specified.</p> <p>If you associate a document with an instance that already has
+         * an associated document, the system throws the AssociationAlreadyExists
+         * exception.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateAssociationBatchAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateAssociationBatchRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateAssociationBatchOutcome> CreateAssociationBatchAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateAssociationBatchOutcome>([this, request](const std::function<void(Model::CreateAssociationBatchOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateAssociationBatchAsync(request, [complete](const SSMClient*, const Model::CreateAssociationBatchRequest&, const Model::CreateAssociationBatchOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateAssociationBatchOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an SSM document.</p> <p>After you create an SSM document, you can use
          * <a>CreateAssociation</a> to associate it with one or more running instances.</p>
@@ -373,6 +449,28 @@ namespace Model
          */
         virtual void CreateDocumentAsync(const Model::CreateDocumentRequest& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an SSM document.</p> <p>After you create an SSM document, you can use
+         * <a>CreateAssociation</a> to associate it with one or more running instances.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateDocumentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateDocumentRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateDocumentOutcome> CreateDocumentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateDocumentOutcome>([this, request](const std::function<void(Model::CreateDocumentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateDocumentAsync(request, [complete](const SSMClient*, const Model::CreateDocumentRequest&, const Model::CreateDocumentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateDocumentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disassociates the specified SSM document from the specified instance.</p>
          * <p>When you disassociate an SSM document from an instance, it does not change
@@ -404,6 +502,31 @@ namespace Model
          */
         virtual void DeleteAssociationAsync(const Model::DeleteAssociationRequest& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disassociates the specified SSM document from the specified instance.</p>
+         * <p>When you disassociate an SSM document from an instance, it does not change
+         * the configuration of the instance. To change the configuration state of an
+         * instance after you disassociate a document, you must create a new document with
+         * the desired configuration and associate it with the instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteAssociationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteAssociationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteAssociationOutcome> DeleteAssociationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteAssociationOutcome>([this, request](const std::function<void(Model::DeleteAssociationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteAssociationAsync(request, [complete](const SSMClient*, const Model::DeleteAssociationRequest&, const Model::DeleteAssociationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteAssociationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the SSM document and all instance associations to the document.</p>
          * <p>Before you delete the SSM document, we recommend that you use
@@ -432,6 +555,30 @@ namespace Model
          */
         virtual void DeleteDocumentAsync(const Model::DeleteDocumentRequest& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the SSM document and all instance associations to the document.</p>
+         * <p>Before you delete the SSM document, we recommend that you use
+         * DeleteAssociation to disassociate all instances that are associated with the
+         * document.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteDocumentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteDocumentRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteDocumentOutcome> DeleteDocumentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteDocumentOutcome>([this, request](const std::function<void(Model::DeleteDocumentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteDocumentAsync(request, [complete](const SSMClient*, const Model::DeleteDocumentRequest&, const Model::DeleteDocumentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteDocumentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the associations for the specified SSM document or instance.</p>
          */
@@ -451,6 +598,27 @@ namespace Model
          */
         virtual void DescribeAssociationAsync(const Model::DescribeAssociationRequest& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the associations for the specified SSM document or instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAssociationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAssociationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAssociationOutcome> DescribeAssociationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAssociationOutcome>([this, request](const std::function<void(Model::DescribeAssociationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAssociationAsync(request, [complete](const SSMClient*, const Model::DescribeAssociationRequest&, const Model::DescribeAssociationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAssociationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the specified SSM document.</p>
          */
@@ -470,6 +638,27 @@ namespace Model
          */
         virtual void DescribeDocumentAsync(const Model::DescribeDocumentRequest& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the specified SSM document.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDocumentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDocumentRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDocumentOutcome> DescribeDocumentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDocumentOutcome>([this, request](const std::function<void(Model::DescribeDocumentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDocumentAsync(request, [complete](const SSMClient*, const Model::DescribeDocumentRequest&, const Model::DescribeDocumentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDocumentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Describes one or more of your instances. You can use this to get information
          * about instances like the operating system platform, the SSM agent version,
@@ -504,6 +693,32 @@ namespace Model
          */
         virtual void DescribeInstanceInformationAsync(const Model::DescribeInstanceInformationRequest& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Describes one or more of your instances. You can use this to get information
+         * about instances like the operating system platform, the SSM agent version,
+         * status etc. If you specify one or more instance IDs, it returns information for
+         * those instances. If you do not specify instance IDs, it returns information for
+         * all your instances. If you specify an instance ID that is not valid or an
+         * instance that you do not own, you receive an error.
+         *
+         * Returns an awaitable that starts the operation the way DescribeInstanceInformationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeInstanceInformationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeInstanceInformationOutcome> DescribeInstanceInformationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeInstanceInformationOutcome>([this, request](const std::function<void(Model::DescribeInstanceInformationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeInstanceInformationAsync(request, [complete](const SSMClient*, const Model::DescribeInstanceInformationRequest&, const Model::DescribeInstanceInformationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeInstanceInformationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Gets the contents of the specified SSM document.</p>
          */
@@ -523,6 +738,27 @@ namespace Model
          */
         virtual void GetDocumentAsync(const Model::GetDocumentRequest& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Gets the contents of the specified SSM document.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetDocumentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetDocumentRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetDocumentOutcome> GetDocumentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetDocumentOutcome>([this, request](const std::function<void(Model::GetDocumentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetDocumentAsync(request, [complete](const SSMClient*, const Model::GetDocumentRequest&, const Model::GetDocumentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetDocumentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the associations for the specified SSM document or instance.</p>
          */
@@ -542,6 +778,27 @@ namespace Model
          */
         virtual void ListAssociationsAsync(const Model::ListAssociationsRequest& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the associations for the specified SSM document or instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListAssociationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListAssociationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListAssociationsOutcome> ListAssociationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListAssociationsOutcome>([this, request](const std::function<void(Model::ListAssociationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListAssociationsAsync(request, [complete](const SSMClient*, const Model::ListAssociationsRequest&, const Model::ListAssociationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListAssociationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * An invocation is copy of a command sent to a specific instance. A command can
          * apply to one or more instances. A command invocation applies to one instance.
@@ -573,6 +830,31 @@ namespace Model
          */
         virtual void ListCommandInvocationsAsync(const Model::ListCommandInvocationsRequest& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * An invocation is copy of a command sent to a specific instance. A command can
+         * apply to one or more instances. A command invocation applies to one instance.
+         * For example, if a user executes SendCommand against three instances, then a
+         * command invocation is created for each requested instance ID.
+         * ListCommandInvocations provide status about command execution.
+         *
+         * Returns an awaitable that starts the operation the way ListCommandInvocationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListCommandInvocationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListCommandInvocationsOutcome> ListCommandInvocationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListCommandInvocationsOutcome>([this, request](const std::function<void(Model::ListCommandInvocationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListCommandInvocationsAsync(request, [complete](const SSMClient*, const Model::ListCommandInvocationsRequest&, const Model::ListCommandInvocationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListCommandInvocationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the commands requested by users of the AWS account.</p>
          */
@@ -592,6 +874,27 @@ namespace Model
          */
         virtual void ListCommandsAsync(const Model::ListCommandsRequest& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the commands requested by users of the AWS account.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListCommandsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListCommandsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListCommandsOutcome> ListCommandsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListCommandsOutcome>([this, request](const std::function<void(Model::ListCommandsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListCommandsAsync(request, [complete](const SSMClient*, const Model::ListCommandsRequest&, const Model::ListCommandsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListCommandsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes one or more of your SSM documents.</p>
          */
@@ -611,6 +914,27 @@ namespace Model
          */
         virtual void ListDocumentsAsync(const Model::ListDocumentsRequest& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes one or more of your SSM documents.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDocumentsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDocumentsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDocumentsOutcome> ListDocumentsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDocumentsOutcome>([this, request](const std::function<void(Model::ListDocumentsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDocumentsAsync(request, [complete](const SSMClient*, const Model::ListDocumentsRequest&, const Model::ListDocumentsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDocumentsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * Executes commands on one or more remote instances.
          */
@@ -630,6 +954,27 @@ namespace Model
          */
         virtual void SendCommandAsync(const Model::SendCommandRequest& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Executes commands on one or more remote instances.
+         *
+         * Returns an awaitable that starts the operation the way SendCommandAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SendCommandRequest>
+        Aws::Utils::Threading::Awaitable<Model::SendCommandOutcome> SendCommandAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SendCommandOutcome>([this, request](const std::function<void(Model::SendCommandOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SendCommandAsync(request, [complete](const SSMClient*, const Model::SendCommandRequest&, const Model::SendCommandOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SendCommandOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the status of the SSM document associated with the specified
          * instance.</p>
@@ -652,6 +997,28 @@ namespace Model
          */
         virtual void UpdateAssociationStatusAsync(const Model::UpdateAssociationStatusRequest& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the status of the SSM document associated with the specified
+         * instance.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateAssociationStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateAssociationStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateAssociationStatusOutcome> UpdateAssociationStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateAssociationStatusOutcome>([this, request](const std::function<void(Model::UpdateAssociationStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateAssociationStatusAsync(request, [complete](const SSMClient*, const Model::UpdateAssociationStatusRequest&, const Model::UpdateAssociationStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateAssociationStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -76,6 +76,7 @@
 #include <aws/storagegateway/model/UpdateSnapshotScheduleResult.h>
 #include <aws/storagegateway/model/UpdateVTLDeviceTypeResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -451,6 +452,36 @@ namespace Model
          */
         virtual void ActivateGatewayAsync(const Model::ActivateGatewayRequest& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Activates the gateway you previously deployed on your host. For more
+         * information, see <a
+         * href="http://docs.aws.amazon.com/storagegateway/latest/userguide/GettingStartedActivateGateway-common.html">
+         * Activate the AWS Storage Gateway</a>. In the activation process, you specify
+         * information such as the you want to use for storing snapshots, the time zone for
+         * scheduled snapshots the gateway snapshot schedule window, an activation key, and
+         * a name for your gateway. The activation process also associates your gateway
+         * with your account; for more information, see
+         * <a>UpdateGatewayInformation</a>.</p> <note>You must turn on the gateway VM
+         * before you can activate your gateway.</note>
+         *
+         * Returns an awaitable that starts the operation the way ActivateGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ActivateGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::ActivateGatewayOutcome> ActivateGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ActivateGatewayOutcome>([this, request](const std::function<void(Model::ActivateGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ActivateGatewayAsync(request, [complete](const StorageGatewayClient*, const Model::ActivateGatewayRequest&, const Model::ActivateGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ActivateGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Configures one or more gateway local disks as cache for a cached-volume
          * gateway. This operation is supported only for the gateway-cached volume
@@ -488,6 +519,33 @@ namespace Model
          */
         virtual void AddCacheAsync(const Model::AddCacheRequest& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Configures one or more gateway local disks as cache for a cached-volume
+         * gateway. This operation is supported only for the gateway-cached volume
+         * architecture (see <a
+         * href="http://docs.aws.amazon.com/storagegateway/latest/userguide/StorageGatewayConcepts.html">Storage
+         * Gateway Concepts</a>).</p> <p>In the request, you specify the gateway Amazon
+         * Resource Name (ARN) to which you want to add cache, and one or more disk IDs
+         * that you want to configure as cache. </p>
+         *
+         * Returns an awaitable that starts the operation the way AddCacheAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddCacheRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddCacheOutcome> AddCacheAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddCacheOutcome>([this, request](const std::function<void(Model::AddCacheOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddCacheAsync(request, [complete](const StorageGatewayClient*, const Model::AddCacheRequest&, const Model::AddCacheOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddCacheOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds one or more tags to the specified resource. You use tags to add metadata
          * to resources, which you can use to categorize these resources. For example, you
@@ -531,6 +589,35 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds one or more tags to the specified resource. You use tags to add metadata
+         * to resources, which you can use to categorize these resources. For example, you
+         * can categorize resources by purpose, owner, environment, or team. Each tag
+         * consists of a key and a value, which you define. You can add tags to the
+         * following AWS Storage Gateway resources:</p> <ul> <li><p>Storage gateways of all
+         * types</p></li> </ul> <ul> <li><p>Storage Volumes</p></li> </ul> <ul>
+         * <li><p>Virtual Tapes</p></li> </ul> <p>You can create a maximum of 10 tags for
+         * each resource. Virtual tapes and storage volumes that are recovered to a new
+         * gateway maintain their tags.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddTagsToResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddTagsToResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddTagsToResourceOutcome>([this, request](const std::function<void(Model::AddTagsToResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddTagsToResourceAsync(request, [complete](const StorageGatewayClient*, const Model::AddTagsToResourceRequest&, const Model::AddTagsToResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddTagsToResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Configures one or more gateway local disks as upload buffer for a specified
          * gateway. This operation is supported for both the gateway-stored and
@@ -562,6 +649,31 @@ namespace Model
          */
         virtual void AddUploadBufferAsync(const Model::AddUploadBufferRequest& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Configures one or more gateway local disks as upload buffer for a specified
+         * gateway. This operation is supported for both the gateway-stored and
+         * gateway-cached volume architectures. </p> <p> In the request, you specify the
+         * gateway Amazon Resource Name (ARN) to which you want to add upload buffer, and
+         * one or more disk IDs that you want to configure as upload buffer.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddUploadBufferAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddUploadBufferRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddUploadBufferOutcome> AddUploadBufferAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddUploadBufferOutcome>([this, request](const std::function<void(Model::AddUploadBufferOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddUploadBufferAsync(request, [complete](const StorageGatewayClient*, const Model::AddUploadBufferRequest&, const Model::AddUploadBufferOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddUploadBufferOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Configures one or more gateway local disks as working storage for a gateway.
          * This operation is supported only for the gateway-stored volume architecture.
@@ -605,6 +717,35 @@ namespace Model
          */
         virtual void AddWorkingStorageAsync(const Model::AddWorkingStorageRequest& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Configures one or more gateway local disks as working storage for a gateway.
+         * This operation is supported only for the gateway-stored volume architecture.
+         * This operation is deprecated in cached-volumes API version 20120630. Use
+         * <a>AddUploadBuffer</a> instead.</p> <note><p>Working storage is also referred to
+         * as upload buffer. You can also use the <a>AddUploadBuffer</a> operation to add
+         * upload buffer to a stored-volume gateway.</p></note> <p>In the request, you
+         * specify the gateway Amazon Resource Name (ARN) to which you want to add working
+         * storage, and one or more disk IDs that you want to configure as working
+         * storage.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddWorkingStorageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddWorkingStorageRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddWorkingStorageOutcome> AddWorkingStorageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddWorkingStorageOutcome>([this, request](const std::function<void(Model::AddWorkingStorageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddWorkingStorageAsync(request, [complete](const StorageGatewayClient*, const Model::AddWorkingStorageRequest&, const Model::AddWorkingStorageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddWorkingStorageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Cancels archiving of a virtual tape to the virtual tape shelf (VTS) after the
          * archiving process is initiated. </p>
@@ -627,6 +768,28 @@ namespace Model
          */
         virtual void CancelArchivalAsync(const Model::CancelArchivalRequest& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels archiving of a virtual tape to the virtual tape shelf (VTS) after the
+         * archiving process is initiated. </p>
+         *
+         * Returns an awaitable that starts the operation the way CancelArchivalAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelArchivalRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelArchivalOutcome> CancelArchivalAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelArchivalOutcome>([this, request](const std::function<void(Model::CancelArchivalOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelArchivalAsync(request, [complete](const StorageGatewayClient*, const Model::CancelArchivalRequest&, const Model::CancelArchivalOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelArchivalOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Cancels retrieval of a virtual tape from the virtual tape shelf (VTS) to a
          * gateway after the retrieval process is initiated. The virtual tape is returned
@@ -652,6 +815,29 @@ namespace Model
          */
         virtual void CancelRetrievalAsync(const Model::CancelRetrievalRequest& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Cancels retrieval of a virtual tape from the virtual tape shelf (VTS) to a
+         * gateway after the retrieval process is initiated. The virtual tape is returned
+         * to the VTS.</p>
+         *
+         * Returns an awaitable that starts the operation the way CancelRetrievalAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CancelRetrievalRequest>
+        Aws::Utils::Threading::Awaitable<Model::CancelRetrievalOutcome> CancelRetrievalAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CancelRetrievalOutcome>([this, request](const std::function<void(Model::CancelRetrievalOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CancelRetrievalAsync(request, [complete](const StorageGatewayClient*, const Model::CancelRetrievalRequest&, const Model::CancelRetrievalOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CancelRetrievalOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a cached volume on a specified cached gateway. This operation is
          * supported only for the gateway-cached volume architecture.</p> <note>Cache
@@ -698,6 +884,36 @@ namespace Model
          */
         virtual void CreateCachediSCSIVolumeAsync(const Model::CreateCachediSCSIVolumeRequest& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a cached volume on a specified cached gateway. This operation is
+         * supported only for the gateway-cached volume architecture.</p> <note>Cache
+         * storage must be allocated to the gateway before you can create a cached volume.
+         * Use the <a>AddCache</a> operation to add cache storage to a gateway. </note>
+         * <p>In the request, you must specify the gateway, size of the volume in bytes,
+         * the iSCSI target name, an IP address on which to expose the target, and a unique
+         * client token. In response, AWS Storage Gateway creates the volume and returns
+         * information about it such as the volume Amazon Resource Name (ARN), its size,
+         * and the iSCSI target ARN that initiators can use to connect to the volume
+         * target.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateCachediSCSIVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateCachediSCSIVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateCachediSCSIVolumeOutcome> CreateCachediSCSIVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateCachediSCSIVolumeOutcome>([this, request](const std::function<void(Model::CreateCachediSCSIVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateCachediSCSIVolumeAsync(request, [complete](const StorageGatewayClient*, const Model::CreateCachediSCSIVolumeRequest&, const Model::CreateCachediSCSIVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateCachediSCSIVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Initiates a snapshot of a volume.</p> <p>AWS Storage Gateway provides the
          * ability to back up point-in-time snapshots of your data to Amazon Simple Storage
@@ -768,6 +984,44 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Initiates a snapshot of a volume.</p> <p>AWS Storage Gateway provides the
+         * ability to back up point-in-time snapshots of your data to Amazon Simple Storage
+         * (S3) for durable off-site recovery, as well as import the data to an Amazon
+         * Elastic Block Store (EBS) volume in Amazon Elastic Compute Cloud (EC2). You can
+         * take snapshots of your gateway volume on a scheduled or ad-hoc basis. This API
+         * enables you to take ad-hoc snapshot. For more information, see <a
+         * href="http://docs.aws.amazon.com/storagegateway/latest/userguide/WorkingWithSnapshots.html">Working
+         * With Snapshots in the AWS Storage Gateway Console</a>.</p> <p>In the
+         * CreateSnapshot request you identify the volume by providing its Amazon Resource
+         * Name (ARN). You must also provide description for the snapshot. When AWS Storage
+         * Gateway takes the snapshot of specified volume, the snapshot and description
+         * appears in the AWS Storage Gateway Console. In response, AWS Storage Gateway
+         * returns you a snapshot ID. You can use this snapshot ID to check the snapshot
+         * progress or later use it when you want to create a volume from a snapshot.</p>
+         * <note>To list or delete a snapshot, you must use the Amazon EC2 API. For more
+         * information, see DescribeSnapshots or DeleteSnapshot in the <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/APIReference/API_Operations.html">EC2
+         * API reference</a>.</note>
+         *
+         * Returns an awaitable that starts the operation the way CreateSnapshotAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSnapshotRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSnapshotOutcome>([this, request](const std::function<void(Model::CreateSnapshotOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSnapshotAsync(request, [complete](const StorageGatewayClient*, const Model::CreateSnapshotRequest&, const Model::CreateSnapshotOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSnapshotOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Initiates a snapshot of a gateway from a volume recovery point. This
          * operation is supported only for the gateway-cached volume architecture.</p> <p>A
@@ -829,6 +1083,41 @@ namespace Model
          */
         virtual void CreateSnapshotFromVolumeRecoveryPointAsync(const Model::CreateSnapshotFromVolumeRecoveryPointRequest& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Initiates a snapshot of a gateway from a volume recovery point. This
+         * operation is supported only for the gateway-cached volume architecture.</p> <p>A
+         * volume recovery point is a point in time at which all data of the volume is
+         * consistent and from which you can create a snapshot. To get a list of volume
+         * recovery point for gateway-cached volumes, use
+         * <a>ListVolumeRecoveryPoints</a>.</p> <p>In the
+         * <code>CreateSnapshotFromVolumeRecoveryPoint</code> request, you identify the
+         * volume by providing its Amazon Resource Name (ARN). You must also provide a
+         * description for the snapshot. When AWS Storage Gateway takes a snapshot of the
+         * specified volume, the snapshot and its description appear in the AWS Storage
+         * Gateway console. In response, AWS Storage Gateway returns you a snapshot ID. You
+         * can use this snapshot ID to check the snapshot progress or later use it when you
+         * want to create a volume from a snapshot.</p> <note> <p>To list or delete a
+         * snapshot, you must use the Amazon EC2 API. For more information, in <i>Amazon
+         * Elastic Compute Cloud API Reference</i>.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way CreateSnapshotFromVolumeRecoveryPointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSnapshotFromVolumeRecoveryPointRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSnapshotFromVolumeRecoveryPointOutcome> CreateSnapshotFromVolumeRecoveryPointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSnapshotFromVolumeRecoveryPointOutcome>([this, request](const std::function<void(Model::CreateSnapshotFromVolumeRecoveryPointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSnapshotFromVolumeRecoveryPointAsync(request, [complete](const StorageGatewayClient*, const Model::CreateSnapshotFromVolumeRecoveryPointRequest&, const Model::CreateSnapshotFromVolumeRecoveryPointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSnapshotFromVolumeRecoveryPointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a volume on a specified gateway. This operation is supported only for
          * the gateway-stored volume architecture. </p> <p>The size of the volume to create
@@ -875,6 +1164,36 @@ namespace Model
          */
         virtual void CreateStorediSCSIVolumeAsync(const Model::CreateStorediSCSIVolumeRequest& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a volume on a specified gateway. This operation is supported only for
+         * the gateway-stored volume architecture. </p> <p>The size of the volume to create
+         * is inferred from the disk size. You can choose to preserve existing data on the
+         * disk, create volume from an existing snapshot, or create an empty volume. If you
+         * choose to create an empty gateway volume, then any existing data on the disk is
+         * erased.</p> <p>In the request you must specify the gateway and the disk
+         * information on which you are creating the volume. In response, AWS Storage
+         * Gateway creates the volume and returns volume information such as the volume
+         * Amazon Resource Name (ARN), its size, and the iSCSI target ARN that initiators
+         * can use to connect to the volume target.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateStorediSCSIVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateStorediSCSIVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateStorediSCSIVolumeOutcome> CreateStorediSCSIVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateStorediSCSIVolumeOutcome>([this, request](const std::function<void(Model::CreateStorediSCSIVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateStorediSCSIVolumeAsync(request, [complete](const StorageGatewayClient*, const Model::CreateStorediSCSIVolumeRequest&, const Model::CreateStorediSCSIVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateStorediSCSIVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a virtual tape by using your own barcode. You write data to the
          * virtual tape and then archive the tape.</p> <note>Cache storage must be
@@ -903,6 +1222,30 @@ namespace Model
          */
         virtual void CreateTapeWithBarcodeAsync(const Model::CreateTapeWithBarcodeRequest& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a virtual tape by using your own barcode. You write data to the
+         * virtual tape and then archive the tape.</p> <note>Cache storage must be
+         * allocated to the gateway before you can create a virtual tape. Use the
+         * <a>AddCache</a> operation to add cache storage to a gateway.</note>
+         *
+         * Returns an awaitable that starts the operation the way CreateTapeWithBarcodeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTapeWithBarcodeRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTapeWithBarcodeOutcome> CreateTapeWithBarcodeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTapeWithBarcodeOutcome>([this, request](const std::function<void(Model::CreateTapeWithBarcodeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTapeWithBarcodeAsync(request, [complete](const StorageGatewayClient*, const Model::CreateTapeWithBarcodeRequest&, const Model::CreateTapeWithBarcodeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTapeWithBarcodeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates one or more virtual tapes. You write data to the virtual tapes and
          * then archive the tapes.</p> <note>Cache storage must be allocated to the gateway
@@ -931,6 +1274,30 @@ namespace Model
          */
         virtual void CreateTapesAsync(const Model::CreateTapesRequest& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates one or more virtual tapes. You write data to the virtual tapes and
+         * then archive the tapes.</p> <note>Cache storage must be allocated to the gateway
+         * before you can create virtual tapes. Use the <a>AddCache</a> operation to add
+         * cache storage to a gateway. </note>
+         *
+         * Returns an awaitable that starts the operation the way CreateTapesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateTapesRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateTapesOutcome> CreateTapesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateTapesOutcome>([this, request](const std::function<void(Model::CreateTapesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateTapesAsync(request, [complete](const StorageGatewayClient*, const Model::CreateTapesRequest&, const Model::CreateTapesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateTapesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the bandwidth rate limits of a gateway. You can delete either the
          * upload and download bandwidth rate limit, or you can delete both. If you delete
@@ -962,6 +1329,31 @@ namespace Model
          */
         virtual void DeleteBandwidthRateLimitAsync(const Model::DeleteBandwidthRateLimitRequest& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the bandwidth rate limits of a gateway. You can delete either the
+         * upload and download bandwidth rate limit, or you can delete both. If you delete
+         * only one of the limits, the other limit remains unchanged. To specify which
+         * gateway to work with, use the Amazon Resource Name (ARN) of the gateway in your
+         * request.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteBandwidthRateLimitAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteBandwidthRateLimitRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteBandwidthRateLimitOutcome> DeleteBandwidthRateLimitAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteBandwidthRateLimitOutcome>([this, request](const std::function<void(Model::DeleteBandwidthRateLimitOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteBandwidthRateLimitAsync(request, [complete](const StorageGatewayClient*, const Model::DeleteBandwidthRateLimitRequest&, const Model::DeleteBandwidthRateLimitOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteBandwidthRateLimitOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes Challenge-Handshake Authentication Protocol (CHAP) credentials for a
          * specified iSCSI target and initiator pair.</p>
@@ -984,6 +1376,28 @@ namespace Model
          */
         virtual void DeleteChapCredentialsAsync(const Model::DeleteChapCredentialsRequest& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes Challenge-Handshake Authentication Protocol (CHAP) credentials for a
+         * specified iSCSI target and initiator pair.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteChapCredentialsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteChapCredentialsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteChapCredentialsOutcome> DeleteChapCredentialsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteChapCredentialsOutcome>([this, request](const std::function<void(Model::DeleteChapCredentialsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteChapCredentialsAsync(request, [complete](const StorageGatewayClient*, const Model::DeleteChapCredentialsRequest&, const Model::DeleteChapCredentialsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteChapCredentialsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a gateway. To specify which gateway to delete, use the Amazon
          * Resource Name (ARN) of the gateway in your request. The operation deletes the
@@ -1045,6 +1459,41 @@ namespace Model
          */
         virtual void DeleteGatewayAsync(const Model::DeleteGatewayRequest& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a gateway. To specify which gateway to delete, use the Amazon
+         * Resource Name (ARN) of the gateway in your request. The operation deletes the
+         * gateway; however, it does not delete the gateway virtual machine (VM) from your
+         * host computer.</p> <p>After you delete a gateway, you cannot reactivate it.
+         * Completed snapshots of the gateway volumes are not deleted upon deleting the
+         * gateway, however, pending snapshots will not complete. After you delete a
+         * gateway, your next step is to remove it from your environment.</p> <important>
+         * <p>You no longer pay software charges after the gateway is deleted; however,
+         * your existing Amazon EBS snapshots persist and you will continue to be billed
+         * for these snapshots. You can choose to remove all remaining Amazon EBS snapshots
+         * by canceling your Amazon EC2 subscription.  If you prefer not to cancel your
+         * Amazon EC2 subscription, you can delete your snapshots using the Amazon EC2
+         * console. For more information, see the <a
+         * href="http://aws.amazon.com/storagegateway"> AWS Storage Gateway Detail
+         * Page</a>. </p> </important>
+         *
+         * Returns an awaitable that starts the operation the way DeleteGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteGatewayOutcome> DeleteGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteGatewayOutcome>([this, request](const std::function<void(Model::DeleteGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteGatewayAsync(request, [complete](const StorageGatewayClient*, const Model::DeleteGatewayRequest&, const Model::DeleteGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes a snapshot of a volume.</p> <p>You can take snapshots of your gateway
          * volumes on a scheduled or ad hoc basis. This API action enables you to delete a
@@ -1085,6 +1534,34 @@ namespace Model
          */
         virtual void DeleteSnapshotScheduleAsync(const Model::DeleteSnapshotScheduleRequest& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes a snapshot of a volume.</p> <p>You can take snapshots of your gateway
+         * volumes on a scheduled or ad hoc basis. This API action enables you to delete a
+         * snapshot schedule for a volume. For more information, see <a
+         * href="http://docs.aws.amazon.com/storagegateway/latest/userguide/WorkingWithSnapshots.html">Working
+         * with Snapshots</a>. In the <code>DeleteSnapshotSchedule</code> request, you
+         * identify the volume by providing its Amazon Resource Name (ARN). </p> <note>
+         * <p>To list or delete a snapshot, you must use the Amazon EC2 API. in <i>Amazon
+         * Elastic Compute Cloud API Reference</i>.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSnapshotScheduleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSnapshotScheduleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSnapshotScheduleOutcome> DeleteSnapshotScheduleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSnapshotScheduleOutcome>([this, request](const std::function<void(Model::DeleteSnapshotScheduleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSnapshotScheduleAsync(request, [complete](const StorageGatewayClient*, const Model::DeleteSnapshotScheduleRequest&, const Model::DeleteSnapshotScheduleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSnapshotScheduleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified virtual tape.</p>
          */
@@ -1104,6 +1581,27 @@ namespace Model
          */
         virtual void DeleteTapeAsync(const Model::DeleteTapeRequest& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified virtual tape.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTapeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTapeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTapeOutcome> DeleteTapeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTapeOutcome>([this, request](const std::function<void(Model::DeleteTapeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTapeAsync(request, [complete](const StorageGatewayClient*, const Model::DeleteTapeRequest&, const Model::DeleteTapeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTapeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified virtual tape from the virtual tape shelf (VTS).</p>
          */
@@ -1123,6 +1621,27 @@ namespace Model
          */
         virtual void DeleteTapeArchiveAsync(const Model::DeleteTapeArchiveRequest& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified virtual tape from the virtual tape shelf (VTS).</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteTapeArchiveAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteTapeArchiveRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteTapeArchiveOutcome> DeleteTapeArchiveAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteTapeArchiveOutcome>([this, request](const std::function<void(Model::DeleteTapeArchiveOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteTapeArchiveAsync(request, [complete](const StorageGatewayClient*, const Model::DeleteTapeArchiveRequest&, const Model::DeleteTapeArchiveOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteTapeArchiveOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deletes the specified gateway volume that you previously created using the
          * <a>CreateCachediSCSIVolume</a> or <a>CreateStorediSCSIVolume</a> API. For
@@ -1178,6 +1697,39 @@ namespace Model
          */
         virtual void DeleteVolumeAsync(const Model::DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deletes the specified gateway volume that you previously created using the
+         * <a>CreateCachediSCSIVolume</a> or <a>CreateStorediSCSIVolume</a> API. For
+         * gateway-stored volumes, the local disk that was configured as the storage volume
+         * is not deleted. You can reuse the local disk to create another storage volume.
+         * </p> <p>Before you delete a gateway volume, make sure there are no iSCSI
+         * connections to the volume you are deleting. You should also make sure there is
+         * no snapshot in progress. You can use the Amazon Elastic Compute Cloud (Amazon
+         * EC2) API to query snapshots on the volume you are deleting and check the
+         * snapshot status. For more information, go to <a
+         * href="http://docs.aws.amazon.com/AWSEC2/latest/APIReference/ApiReference-query-DescribeSnapshots.html">DescribeSnapshots</a>
+         * in the <i>Amazon Elastic Compute Cloud API Reference</i>.</p> <p>In the request,
+         * you must provide the Amazon Resource Name (ARN) of the storage volume you want
+         * to delete.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeleteVolumeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteVolumeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteVolumeOutcome> DeleteVolumeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteVolumeOutcome>([this, request](const std::function<void(Model::DeleteVolumeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteVolumeAsync(request, [complete](const StorageGatewayClient*, const Model::DeleteVolumeRequest&, const Model::DeleteVolumeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteVolumeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the bandwidth rate limits of a gateway. By default, these limits are
          * not set, which means no bandwidth rate limiting is in effect.</p> <p>This
@@ -1212,6 +1764,32 @@ namespace Model
          */
         virtual void DescribeBandwidthRateLimitAsync(const Model::DescribeBandwidthRateLimitRequest& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the bandwidth rate limits of a gateway. By default, these limits are
+         * not set, which means no bandwidth rate limiting is in effect.</p> <p>This
+         * operation only returns a value for a bandwidth rate limit only if the limit is
+         * set. If no limits are set for the gateway, then this operation returns only the
+         * gateway ARN in the response body. To specify which gateway to describe, use the
+         * Amazon Resource Name (ARN) of the gateway in your request.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeBandwidthRateLimitAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeBandwidthRateLimitRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeBandwidthRateLimitOutcome> DescribeBandwidthRateLimitAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeBandwidthRateLimitOutcome>([this, request](const std::function<void(Model::DescribeBandwidthRateLimitOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeBandwidthRateLimitAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeBandwidthRateLimitRequest&, const Model::DescribeBandwidthRateLimitOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeBandwidthRateLimitOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the cache of a gateway. This operation is supported
          * only for the gateway-cached volume architecture. </p> <p> The response includes
@@ -1240,6 +1818,30 @@ namespace Model
          */
         virtual void DescribeCacheAsync(const Model::DescribeCacheRequest& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the cache of a gateway. This operation is supported
+         * only for the gateway-cached volume architecture. </p> <p> The response includes
+         * disk IDs that are configured as cache, and it includes the amount of cache
+         * allocated and used. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCacheAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCacheRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCacheOutcome> DescribeCacheAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCacheOutcome>([this, request](const std::function<void(Model::DescribeCacheOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCacheAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeCacheRequest&, const Model::DescribeCacheOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCacheOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a description of the gateway volumes specified in the request. This
          * operation is supported only for the gateway-cached volume architecture.</p> <p>
@@ -1271,6 +1873,31 @@ namespace Model
          */
         virtual void DescribeCachediSCSIVolumesAsync(const Model::DescribeCachediSCSIVolumesRequest& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a description of the gateway volumes specified in the request. This
+         * operation is supported only for the gateway-cached volume architecture.</p> <p>
+         * The list of gateway volumes in the request must be from one gateway. In the
+         * response Amazon Storage Gateway returns volume information sorted by volume
+         * Amazon Resource Name (ARN). </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCachediSCSIVolumesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCachediSCSIVolumesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCachediSCSIVolumesOutcome> DescribeCachediSCSIVolumesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCachediSCSIVolumesOutcome>([this, request](const std::function<void(Model::DescribeCachediSCSIVolumesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCachediSCSIVolumesAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeCachediSCSIVolumesRequest&, const Model::DescribeCachediSCSIVolumesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCachediSCSIVolumesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns an array of Challenge-Handshake Authentication Protocol (CHAP)
          * credentials information for a specified iSCSI target, one for each
@@ -1296,6 +1923,29 @@ namespace Model
          */
         virtual void DescribeChapCredentialsAsync(const Model::DescribeChapCredentialsRequest& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns an array of Challenge-Handshake Authentication Protocol (CHAP)
+         * credentials information for a specified iSCSI target, one for each
+         * target-initiator pair.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeChapCredentialsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeChapCredentialsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeChapCredentialsOutcome> DescribeChapCredentialsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeChapCredentialsOutcome>([this, request](const std::function<void(Model::DescribeChapCredentialsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeChapCredentialsAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeChapCredentialsRequest&, const Model::DescribeChapCredentialsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeChapCredentialsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns metadata about a gateway such as its name, network interfaces,
          * configured time zone, and the state (whether the gateway is running or not). To
@@ -1324,6 +1974,30 @@ namespace Model
          */
         virtual void DescribeGatewayInformationAsync(const Model::DescribeGatewayInformationRequest& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns metadata about a gateway such as its name, network interfaces,
+         * configured time zone, and the state (whether the gateway is running or not). To
+         * specify which gateway to describe, use the Amazon Resource Name (ARN) of the
+         * gateway in your request.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeGatewayInformationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeGatewayInformationRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeGatewayInformationOutcome> DescribeGatewayInformationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeGatewayInformationOutcome>([this, request](const std::function<void(Model::DescribeGatewayInformationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeGatewayInformationAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeGatewayInformationRequest&, const Model::DescribeGatewayInformationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeGatewayInformationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns your gateway's weekly maintenance start time including the day and
          * time of the week. Note that values are in terms of the gateway's time zone.</p>
@@ -1346,6 +2020,28 @@ namespace Model
          */
         virtual void DescribeMaintenanceStartTimeAsync(const Model::DescribeMaintenanceStartTimeRequest& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns your gateway's weekly maintenance start time including the day and
+         * time of the week. Note that values are in terms of the gateway's time zone.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeMaintenanceStartTimeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeMaintenanceStartTimeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeMaintenanceStartTimeOutcome> DescribeMaintenanceStartTimeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeMaintenanceStartTimeOutcome>([this, request](const std::function<void(Model::DescribeMaintenanceStartTimeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeMaintenanceStartTimeAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeMaintenanceStartTimeRequest&, const Model::DescribeMaintenanceStartTimeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeMaintenanceStartTimeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Describes the snapshot schedule for the specified gateway volume. The
          * snapshot schedule information includes intervals at which snapshots are
@@ -1371,6 +2067,29 @@ namespace Model
          */
         virtual void DescribeSnapshotScheduleAsync(const Model::DescribeSnapshotScheduleRequest& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Describes the snapshot schedule for the specified gateway volume. The
+         * snapshot schedule information includes intervals at which snapshots are
+         * automatically initiated on the volume.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSnapshotScheduleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSnapshotScheduleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotScheduleOutcome> DescribeSnapshotScheduleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSnapshotScheduleOutcome>([this, request](const std::function<void(Model::DescribeSnapshotScheduleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSnapshotScheduleAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeSnapshotScheduleRequest&, const Model::DescribeSnapshotScheduleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSnapshotScheduleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the description of the gateway volumes specified in the request. The
          * list of gateway volumes in the request must be from one gateway. In the response
@@ -1396,6 +2115,29 @@ namespace Model
          */
         virtual void DescribeStorediSCSIVolumesAsync(const Model::DescribeStorediSCSIVolumesRequest& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the description of the gateway volumes specified in the request. The
+         * list of gateway volumes in the request must be from one gateway. In the response
+         * Amazon Storage Gateway returns volume information sorted by volume ARNs.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeStorediSCSIVolumesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeStorediSCSIVolumesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeStorediSCSIVolumesOutcome> DescribeStorediSCSIVolumesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeStorediSCSIVolumesOutcome>([this, request](const std::function<void(Model::DescribeStorediSCSIVolumesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeStorediSCSIVolumesAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeStorediSCSIVolumesRequest&, const Model::DescribeStorediSCSIVolumesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeStorediSCSIVolumesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a description of specified virtual tapes in the virtual tape shelf
          * (VTS). </p> <p>If a specific <code>TapeARN</code> is not specified, AWS Storage
@@ -1424,6 +2166,30 @@ namespace Model
          */
         virtual void DescribeTapeArchivesAsync(const Model::DescribeTapeArchivesRequest& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a description of specified virtual tapes in the virtual tape shelf
+         * (VTS). </p> <p>If a specific <code>TapeARN</code> is not specified, AWS Storage
+         * Gateway returns a description of all virtual tapes found in the VTS associated
+         * with your account.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTapeArchivesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTapeArchivesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTapeArchivesOutcome> DescribeTapeArchivesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTapeArchivesOutcome>([this, request](const std::function<void(Model::DescribeTapeArchivesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTapeArchivesAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeTapeArchivesRequest&, const Model::DescribeTapeArchivesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTapeArchivesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of virtual tape recovery points that are available for the
          * specified gateway-VTL.</p> <p>A recovery point is a point-in-time view of a
@@ -1455,6 +2221,31 @@ namespace Model
          */
         virtual void DescribeTapeRecoveryPointsAsync(const Model::DescribeTapeRecoveryPointsRequest& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of virtual tape recovery points that are available for the
+         * specified gateway-VTL.</p> <p>A recovery point is a point-in-time view of a
+         * virtual tape at which all the data on the virtual tape is consistent. If your
+         * gateway crashes, virtual tapes that have recovery points can be recovered to a
+         * new gateway.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTapeRecoveryPointsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTapeRecoveryPointsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTapeRecoveryPointsOutcome> DescribeTapeRecoveryPointsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTapeRecoveryPointsOutcome>([this, request](const std::function<void(Model::DescribeTapeRecoveryPointsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTapeRecoveryPointsAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeTapeRecoveryPointsRequest&, const Model::DescribeTapeRecoveryPointsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTapeRecoveryPointsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a description of the specified Amazon Resource Name (ARN) of virtual
          * tapes. If a <code>TapeARN</code> is not specified, returns a description of all
@@ -1467,18 +2258,41 @@ namespace Model
          * tapes. If a <code>TapeARN</code> is not specified, returns a description of all
          * virtual tapes associated with the specified gateway.</p>
          *
-         * returns a future to the operation so that it can be executed in parallel to other requests.
+         * returns a future to the operation so that it can be executed in parallel to other requests.
+         */
+        virtual Model::DescribeTapesOutcomeCallable DescribeTapesCallable(const Model::DescribeTapesRequest& request) const;
+
+        /**
+         * <p>Returns a description of the specified Amazon Resource Name (ARN) of virtual
+         * tapes. If a <code>TapeARN</code> is not specified, returns a description of all
+         * virtual tapes associated with the specified gateway.</p>
+         *
+         * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
-        virtual Model::DescribeTapesOutcomeCallable DescribeTapesCallable(const Model::DescribeTapesRequest& request) const;
+        virtual void DescribeTapesAsync(const Model::DescribeTapesRequest& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
          * <p>Returns a description of the specified Amazon Resource Name (ARN) of virtual
          * tapes. If a <code>TapeARN</code> is not specified, returns a description of all
          * virtual tapes associated with the specified gateway.</p>
          *
-         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         * Returns an awaitable that starts the operation the way DescribeTapesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
          */
-        virtual void DescribeTapesAsync(const Model::DescribeTapesRequest& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        template<typename REQUEST = Model::DescribeTapesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTapesOutcome> DescribeTapesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTapesOutcome>([this, request](const std::function<void(Model::DescribeTapesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTapesAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeTapesRequest&, const Model::DescribeTapesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTapesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Returns information about the upload buffer of a gateway. This operation is
@@ -1508,6 +2322,30 @@ namespace Model
          */
         virtual void DescribeUploadBufferAsync(const Model::DescribeUploadBufferRequest& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the upload buffer of a gateway. This operation is
+         * supported for both the gateway-stored and gateway-cached volume architectures.
+         * </p> <p> The response includes disk IDs that are configured as upload buffer
+         * space, and it includes the amount of upload buffer space allocated and used.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeUploadBufferAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeUploadBufferRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeUploadBufferOutcome> DescribeUploadBufferAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeUploadBufferOutcome>([this, request](const std::function<void(Model::DescribeUploadBufferOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeUploadBufferAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeUploadBufferRequest&, const Model::DescribeUploadBufferOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeUploadBufferOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a description of virtual tape library (VTL) devices for the specified
          * gateway. In the response, AWS Storage Gateway returns VTL device information.
@@ -1533,6 +2371,29 @@ namespace Model
          */
         virtual void DescribeVTLDevicesAsync(const Model::DescribeVTLDevicesRequest& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a description of virtual tape library (VTL) devices for the specified
+         * gateway. In the response, AWS Storage Gateway returns VTL device information.
+         * </p> <p>The list of VTL devices must be from one gateway.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeVTLDevicesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeVTLDevicesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeVTLDevicesOutcome> DescribeVTLDevicesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeVTLDevicesOutcome>([this, request](const std::function<void(Model::DescribeVTLDevicesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeVTLDevicesAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeVTLDevicesRequest&, const Model::DescribeVTLDevicesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeVTLDevicesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the working storage of a gateway. This operation is
          * supported only for the gateway-stored volume architecture. This operation is
@@ -1573,6 +2434,34 @@ namespace Model
          */
         virtual void DescribeWorkingStorageAsync(const Model::DescribeWorkingStorageRequest& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the working storage of a gateway. This operation is
+         * supported only for the gateway-stored volume architecture. This operation is
+         * deprecated in cached-volumes API version (20120630). Use DescribeUploadBuffer
+         * instead.</p> <note><p>Working storage is also referred to as upload buffer. You
+         * can also use the DescribeUploadBuffer operation to add upload buffer to a
+         * stored-volume gateway.</p></note> <p>The response includes disk IDs that are
+         * configured as working storage, and it includes the amount of working storage
+         * allocated and used.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeWorkingStorageAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeWorkingStorageRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeWorkingStorageOutcome> DescribeWorkingStorageAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeWorkingStorageOutcome>([this, request](const std::function<void(Model::DescribeWorkingStorageOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeWorkingStorageAsync(request, [complete](const StorageGatewayClient*, const Model::DescribeWorkingStorageRequest&, const Model::DescribeWorkingStorageOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeWorkingStorageOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Disables a gateway when the gateway is no longer functioning. For example, if
          * your gateway VM is damaged, you can disable the gateway so you can recover
@@ -1604,6 +2493,31 @@ namespace Model
          */
         virtual void DisableGatewayAsync(const Model::DisableGatewayRequest& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Disables a gateway when the gateway is no longer functioning. For example, if
+         * your gateway VM is damaged, you can disable the gateway so you can recover
+         * virtual tapes. </p> <p>Use this operation for a gateway-VTL that is not
+         * reachable or not functioning.</p> <important>Once a gateway is disabled it
+         * cannot be enabled.</important>
+         *
+         * Returns an awaitable that starts the operation the way DisableGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DisableGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::DisableGatewayOutcome> DisableGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DisableGatewayOutcome>([this, request](const std::function<void(Model::DisableGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DisableGatewayAsync(request, [complete](const StorageGatewayClient*, const Model::DisableGatewayRequest&, const Model::DisableGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DisableGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists gateways owned by an AWS account in a region specified in the request.
          * The returned list is ordered by gateway Amazon Resource Name (ARN).</p> <p>By
@@ -1644,6 +2558,34 @@ namespace Model
          */
         virtual void ListGatewaysAsync(const Model::ListGatewaysRequest& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists gateways owned by an AWS account in a region specified in the request.
+         * The returned list is ordered by gateway Amazon Resource Name (ARN).</p> <p>By
+         * default, the operation returns a maximum of 100 gateways. This operation
+         * supports pagination that allows you to optionally reduce the number of gateways
+         * returned in a response.</p> <p>If you have more gateways than are returned in a
+         * response (that is, the response returns only a truncated list of your gateways),
+         * the response contains a marker that you can specify in your next request to
+         * fetch the next page of gateways.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListGatewaysAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListGatewaysRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListGatewaysOutcome> ListGatewaysAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListGatewaysOutcome>([this, request](const std::function<void(Model::ListGatewaysOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListGatewaysAsync(request, [complete](const StorageGatewayClient*, const Model::ListGatewaysRequest&, const Model::ListGatewaysOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListGatewaysOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of the gateway's local disks. To specify which gateway to
          * describe, you use the Amazon Resource Name (ARN) of the gateway in the body of
@@ -1687,6 +2629,35 @@ namespace Model
          */
         virtual void ListLocalDisksAsync(const Model::ListLocalDisksRequest& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of the gateway's local disks. To specify which gateway to
+         * describe, you use the Amazon Resource Name (ARN) of the gateway in the body of
+         * the request.</p> <p>The request returns a list of all disks, specifying which
+         * are configured as working storage, cache storage, or stored volume or not
+         * configured at all. The response includes a <code>DiskStatus</code> field. This
+         * field can have a value of present (the disk is available to use), missing (the
+         * disk is no longer connected to the gateway), or mismatch (the disk node is
+         * occupied by a disk that has incorrect metadata or the disk content is
+         * corrupted). </p>
+         *
+         * Returns an awaitable that starts the operation the way ListLocalDisksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListLocalDisksRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListLocalDisksOutcome> ListLocalDisksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListLocalDisksOutcome>([this, request](const std::function<void(Model::ListLocalDisksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListLocalDisksAsync(request, [complete](const StorageGatewayClient*, const Model::ListLocalDisksRequest&, const Model::ListLocalDisksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListLocalDisksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the tags that have been added to the specified resource. </p>
          */
@@ -1706,6 +2677,27 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the tags that have been added to the specified resource. </p>
+         *
+         * Returns an awaitable that starts the operation the way ListTagsForResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListTagsForResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListTagsForResourceOutcome>([this, request](const std::function<void(Model::ListTagsForResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListTagsForResourceAsync(request, [complete](const StorageGatewayClient*, const Model::ListTagsForResourceRequest&, const Model::ListTagsForResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListTagsForResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists iSCSI initiators that are connected to a volume. You can use this
          * operation to determine whether a volume is being used or not.</p>
@@ -1728,6 +2720,28 @@ namespace Model
          */
         virtual void ListVolumeInitiatorsAsync(const Model::ListVolumeInitiatorsRequest& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists iSCSI initiators that are connected to a volume. You can use this
+         * operation to determine whether a volume is being used or not.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListVolumeInitiatorsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListVolumeInitiatorsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListVolumeInitiatorsOutcome> ListVolumeInitiatorsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListVolumeInitiatorsOutcome>([this, request](const std::function<void(Model::ListVolumeInitiatorsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListVolumeInitiatorsAsync(request, [complete](const StorageGatewayClient*, const Model::ListVolumeInitiatorsRequest&, const Model::ListVolumeInitiatorsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListVolumeInitiatorsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the recovery points for a specified gateway. This operation is
          * supported only for the gateway-cached volume architecture.</p> <p>Each
@@ -1762,6 +2776,32 @@ namespace Model
          */
         virtual void ListVolumeRecoveryPointsAsync(const Model::ListVolumeRecoveryPointsRequest& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the recovery points for a specified gateway. This operation is
+         * supported only for the gateway-cached volume architecture.</p> <p>Each
+         * gateway-cached volume has one recovery point. A volume recovery point is a point
+         * in time at which all data of the volume is consistent and from which you can
+         * create a snapshot. To create a snapshot from a volume recovery point use the
+         * <a>CreateSnapshotFromVolumeRecoveryPoint</a> operation.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListVolumeRecoveryPointsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListVolumeRecoveryPointsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListVolumeRecoveryPointsOutcome> ListVolumeRecoveryPointsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListVolumeRecoveryPointsOutcome>([this, request](const std::function<void(Model::ListVolumeRecoveryPointsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListVolumeRecoveryPointsAsync(request, [complete](const StorageGatewayClient*, const Model::ListVolumeRecoveryPointsRequest&, const Model::ListVolumeRecoveryPointsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListVolumeRecoveryPointsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Lists the iSCSI stored volumes of a gateway. Results are sorted by volume
          * ARN. The response includes only the volume ARNs. If you want additional volume
@@ -1805,6 +2845,35 @@ namespace Model
          */
         virtual void ListVolumesAsync(const Model::ListVolumesRequest& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Lists the iSCSI stored volumes of a gateway. Results are sorted by volume
+         * ARN. The response includes only the volume ARNs. If you want additional volume
+         * information, use the <a>DescribeStorediSCSIVolumes</a> API.</p> <p>The operation
+         * supports pagination. By default, the operation returns a maximum of up to 100
+         * volumes. You can optionally specify the <code>Limit</code> field in the body to
+         * limit the number of volumes in the response. If the number of volumes returned
+         * in the response is truncated, the response includes a Marker field. You can use
+         * this Marker value in your subsequent request to retrieve the next set of
+         * volumes.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListVolumesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListVolumesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListVolumesOutcome> ListVolumesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListVolumesOutcome>([this, request](const std::function<void(Model::ListVolumesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListVolumesAsync(request, [complete](const StorageGatewayClient*, const Model::ListVolumesRequest&, const Model::ListVolumesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListVolumesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Removes one or more tags from the specified resource.</p>
          */
@@ -1824,6 +2893,27 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Removes one or more tags from the specified resource.</p>
+         *
+         * Returns an awaitable that starts the operation the way RemoveTagsFromResourceAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RemoveTagsFromResourceRequest>
+        Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RemoveTagsFromResourceOutcome>([this, request](const std::function<void(Model::RemoveTagsFromResourceOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RemoveTagsFromResourceAsync(request, [complete](const StorageGatewayClient*, const Model::RemoveTagsFromResourceRequest&, const Model::RemoveTagsFromResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RemoveTagsFromResourceOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Resets all cache disks that have encountered a error and makes the disks
          * available for reconfiguration as cache storage. If your cache disk encounters a
@@ -1870,6 +2960,36 @@ namespace Model
          */
         virtual void ResetCacheAsync(const Model::ResetCacheRequest& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Resets all cache disks that have encountered a error and makes the disks
+         * available for reconfiguration as cache storage. If your cache disk encounters a
+         * error, the gateway prevents read and write operations on virtual tapes in the
+         * gateway. For example, an error can occur when a disk is corrupted or removed
+         * from the gateway. When a cache is reset, the gateway loses its cache storage. At
+         * this point you can reconfigure the disks as cache disks. </p> <important> <p>If
+         * the cache disk you are resetting contains data that has not been uploaded to
+         * Amazon S3 yet, that data can be lost. After you reset cache disks, there will be
+         * no configured cache disks left in the gateway, so you must configure at least
+         * one new cache disk for your gateway to function properly.</p> </important>
+         *
+         * Returns an awaitable that starts the operation the way ResetCacheAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResetCacheRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResetCacheOutcome> ResetCacheAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResetCacheOutcome>([this, request](const std::function<void(Model::ResetCacheOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResetCacheAsync(request, [complete](const StorageGatewayClient*, const Model::ResetCacheRequest&, const Model::ResetCacheOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResetCacheOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves an archived virtual tape from the virtual tape shelf (VTS) to a
          * gateway-VTL. Virtual tapes archived in the VTS are not associated with any
@@ -1904,6 +3024,32 @@ namespace Model
          */
         virtual void RetrieveTapeArchiveAsync(const Model::RetrieveTapeArchiveRequest& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves an archived virtual tape from the virtual tape shelf (VTS) to a
+         * gateway-VTL. Virtual tapes archived in the VTS are not associated with any
+         * gateway. However after a tape is retrieved, it is associated with a gateway,
+         * even though it is also listed in the VTS.</p> <p>Once a tape is successfully
+         * retrieved to a gateway, it cannot be retrieved again to another gateway. You
+         * must archive the tape again before you can retrieve it to another gateway.</p>
+         *
+         * Returns an awaitable that starts the operation the way RetrieveTapeArchiveAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RetrieveTapeArchiveRequest>
+        Aws::Utils::Threading::Awaitable<Model::RetrieveTapeArchiveOutcome> RetrieveTapeArchiveAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RetrieveTapeArchiveOutcome>([this, request](const std::function<void(Model::RetrieveTapeArchiveOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RetrieveTapeArchiveAsync(request, [complete](const StorageGatewayClient*, const Model::RetrieveTapeArchiveRequest&, const Model::RetrieveTapeArchiveOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RetrieveTapeArchiveOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves the recovery point for the specified virtual tape.</p> <p>A
          * recovery point is a point in time view of a virtual tape at which all the data
@@ -1941,6 +3087,33 @@ namespace Model
          */
         virtual void RetrieveTapeRecoveryPointAsync(const Model::RetrieveTapeRecoveryPointRequest& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves the recovery point for the specified virtual tape.</p> <p>A
+         * recovery point is a point in time view of a virtual tape at which all the data
+         * on the tape is consistent. If your gateway crashes, virtual tapes that have
+         * recovery points can be recovered to a new gateway.</p> <note>The virtual tape
+         * can be retrieved to only one gateway. The retrieved tape is read-only. The
+         * virtual tape can be retrieved to only a gateway-VTL. There is no charge for
+         * retrieving recovery points.</note>
+         *
+         * Returns an awaitable that starts the operation the way RetrieveTapeRecoveryPointAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RetrieveTapeRecoveryPointRequest>
+        Aws::Utils::Threading::Awaitable<Model::RetrieveTapeRecoveryPointOutcome> RetrieveTapeRecoveryPointAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RetrieveTapeRecoveryPointOutcome>([this, request](const std::function<void(Model::RetrieveTapeRecoveryPointOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RetrieveTapeRecoveryPointAsync(request, [complete](const StorageGatewayClient*, const Model::RetrieveTapeRecoveryPointRequest&, const Model::RetrieveTapeRecoveryPointOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RetrieveTapeRecoveryPointOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Sets the password for your VM local console. When you log in to the local
          * console for the first time, you log in to the VM with the default credentials.
@@ -1969,6 +3142,30 @@ namespace Model
          */
         virtual void SetLocalConsolePasswordAsync(const Model::SetLocalConsolePasswordRequest& request, const SetLocalConsolePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Sets the password for your VM local console. When you log in to the local
+         * console for the first time, you log in to the VM with the default credentials.
+         * We recommend that you set a new password. You don't need to know the default
+         * password to set a new password.</p>
+         *
+         * Returns an awaitable that starts the operation the way SetLocalConsolePasswordAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SetLocalConsolePasswordRequest>
+        Aws::Utils::Threading::Awaitable<Model::SetLocalConsolePasswordOutcome> SetLocalConsolePasswordAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SetLocalConsolePasswordOutcome>([this, request](const std::function<void(Model::SetLocalConsolePasswordOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SetLocalConsolePasswordAsync(request, [complete](const StorageGatewayClient*, const Model::SetLocalConsolePasswordRequest&, const Model::SetLocalConsolePasswordOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SetLocalConsolePasswordOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Shuts down a gateway. To specify which gateway to shut down, use the Amazon
          * Resource Name (ARN) of the gateway in the body of your request.</p> <p>The
@@ -2036,6 +3233,43 @@ namespace Model
          */
         virtual void ShutdownGatewayAsync(const Model::ShutdownGatewayRequest& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Shuts down a gateway. To specify which gateway to shut down, use the Amazon
+         * Resource Name (ARN) of the gateway in the body of your request.</p> <p>The
+         * operation shuts down the gateway service component running in the storage
+         * gateway's virtual machine (VM) and not the VM.</p> <note>If you want to shut
+         * down the VM, it is recommended that you first shut down the gateway component in
+         * the VM to avoid unpredictable conditions.</note> <p>After the gateway is
+         * shutdown, you cannot call any other API except <a>StartGateway</a>,
+         * <a>DescribeGatewayInformation</a>, and <a>ListGateways</a>. For more
+         * information, see <a>ActivateGateway</a>. Your applications cannot read from or
+         * write to the gateway's storage volumes, and there are no snapshots taken.</p>
+         * <note>When you make a shutdown request, you will get a <code>200 OK</code>
+         * success response immediately. However, it might take some time for the gateway
+         * to shut down. You can call the <a>DescribeGatewayInformation</a> API to check
+         * the status. For more information, see <a>ActivateGateway</a>.</note> <p>If do
+         * not intend to use the gateway again, you must delete the gateway (using
+         * <a>DeleteGateway</a>) to no longer pay software charges associated with the
+         * gateway.</p>
+         *
+         * Returns an awaitable that starts the operation the way ShutdownGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ShutdownGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::ShutdownGatewayOutcome> ShutdownGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ShutdownGatewayOutcome>([this, request](const std::function<void(Model::ShutdownGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ShutdownGatewayAsync(request, [complete](const StorageGatewayClient*, const Model::ShutdownGatewayRequest&, const Model::ShutdownGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ShutdownGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts a gateway that you previously shut down (see <a>ShutdownGateway</a>).
          * After the gateway starts, you can then make other API calls, your applications
@@ -2079,6 +3313,35 @@ namespace Model
          */
         virtual void StartGatewayAsync(const Model::StartGatewayRequest& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts a gateway that you previously shut down (see <a>ShutdownGateway</a>).
+         * After the gateway starts, you can then make other API calls, your applications
+         * can read from or write to the gateway's storage volumes and you will be able to
+         * take snapshot backups.</p> <note>When you make a request, you will get a 200 OK
+         * success response immediately. However, it might take some time for the gateway
+         * to be ready. You should call <a>DescribeGatewayInformation</a> and check the
+         * status before making any additional API calls. For more information, see
+         * <a>ActivateGateway</a>.</note> <p>To specify which gateway to start, use the
+         * Amazon Resource Name (ARN) of the gateway in your request.</p>
+         *
+         * Returns an awaitable that starts the operation the way StartGatewayAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartGatewayRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartGatewayOutcome> StartGatewayAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartGatewayOutcome>([this, request](const std::function<void(Model::StartGatewayOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartGatewayAsync(request, [complete](const StorageGatewayClient*, const Model::StartGatewayRequest&, const Model::StartGatewayOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartGatewayOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the bandwidth rate limits of a gateway. You can update both the
          * upload and download bandwidth rate limit or specify only one of the two. If you
@@ -2119,6 +3382,34 @@ namespace Model
          */
         virtual void UpdateBandwidthRateLimitAsync(const Model::UpdateBandwidthRateLimitRequest& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the bandwidth rate limits of a gateway. You can update both the
+         * upload and download bandwidth rate limit or specify only one of the two. If you
+         * don't set a bandwidth rate limit, the existing rate limit remains.</p> <p>By
+         * default, a gateway's bandwidth rate limits are not set. If you don't set any
+         * limit, the gateway does not have any limitations on its bandwidth usage and
+         * could potentially use the maximum available bandwidth.</p> <p>To specify which
+         * gateway to update, use the Amazon Resource Name (ARN) of the gateway in your
+         * request.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateBandwidthRateLimitAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateBandwidthRateLimitRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateBandwidthRateLimitOutcome> UpdateBandwidthRateLimitAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateBandwidthRateLimitOutcome>([this, request](const std::function<void(Model::UpdateBandwidthRateLimitOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateBandwidthRateLimitAsync(request, [complete](const StorageGatewayClient*, const Model::UpdateBandwidthRateLimitRequest&, const Model::UpdateBandwidthRateLimitOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateBandwidthRateLimitOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the Challenge-Handshake Authentication Protocol (CHAP) credentials
          * for a specified iSCSI target. By default, a gateway does not have CHAP enabled;
@@ -2150,6 +3441,31 @@ namespace Model
          */
         virtual void UpdateChapCredentialsAsync(const Model::UpdateChapCredentialsRequest& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the Challenge-Handshake Authentication Protocol (CHAP) credentials
+         * for a specified iSCSI target. By default, a gateway does not have CHAP enabled;
+         * however, for added security, you might use it.</p> <important> <p>When you
+         * update CHAP credentials, all existing connections on the target are closed and
+         * initiators must reconnect with the new credentials.</p> </important>
+         *
+         * Returns an awaitable that starts the operation the way UpdateChapCredentialsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateChapCredentialsRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateChapCredentialsOutcome> UpdateChapCredentialsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateChapCredentialsOutcome>([this, request](const std::function<void(Model::UpdateChapCredentialsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateChapCredentialsAsync(request, [complete](const StorageGatewayClient*, const Model::UpdateChapCredentialsRequest&, const Model::UpdateChapCredentialsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateChapCredentialsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a gateway's metadata, which includes the gateway's name and time
          * zone. To specify which gateway to update, use the Amazon Resource Name (ARN) of
@@ -2184,6 +3500,32 @@ namespace Model
          */
         virtual void UpdateGatewayInformationAsync(const Model::UpdateGatewayInformationRequest& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a gateway's metadata, which includes the gateway's name and time
+         * zone. To specify which gateway to update, use the Amazon Resource Name (ARN) of
+         * the gateway in your request.</p> <note>For Gateways activated after September 2,
+         * 2015, the gateway's ARN contains the gateway ID rather than the gateway name.
+         * However, changing the name of the gateway has no effect on the gateway's
+         * ARN.</note>
+         *
+         * Returns an awaitable that starts the operation the way UpdateGatewayInformationAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateGatewayInformationRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateGatewayInformationOutcome> UpdateGatewayInformationAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateGatewayInformationOutcome>([this, request](const std::function<void(Model::UpdateGatewayInformationOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateGatewayInformationAsync(request, [complete](const StorageGatewayClient*, const Model::UpdateGatewayInformationRequest&, const Model::UpdateGatewayInformationOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateGatewayInformationOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the gateway virtual machine (VM) software. The request immediately
          * triggers the software update. </p> <note>When you make this request, you get a
@@ -2239,6 +3581,39 @@ namespace Model
          */
         virtual void UpdateGatewaySoftwareNowAsync(const Model::UpdateGatewaySoftwareNowRequest& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the gateway virtual machine (VM) software. The request immediately
+         * triggers the software update. </p> <note>When you make this request, you get a
+         * <code>200 OK</code> success response immediately. However, it might take some
+         * time for the update to complete. You can call <a>DescribeGatewayInformation</a>
+         * to verify the gateway is in the <code>STATE_RUNNING</code> state.</note>
+         * <important>A software update forces a system restart of your gateway. You can
+         * minimize the chance of any disruption to your applications by increasing your
+         * iSCSI Initiators' timeouts. For more information about increasing iSCSI
+         * Initiator timeouts for Windows and Linux, see <a
+         * href="http://docs.aws.amazon.com/storagegateway/latest/userguide/ConfiguringiSCSIClientInitiatorWindowsClient.html#CustomizeWindowsiSCSISettings">Customizing
+         * Your Windows iSCSI Settings</a> and <a
+         * href="http://docs.aws.amazon.com/storagegateway/latest/userguide/ConfiguringiSCSIClientInitiatorRedHatClient.html#CustomizeLinuxiSCSISettings">Customizing
+         * Your Linux iSCSI Settings</a>, respectively.</important>
+         *
+         * Returns an awaitable that starts the operation the way UpdateGatewaySoftwareNowAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateGatewaySoftwareNowRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateGatewaySoftwareNowOutcome> UpdateGatewaySoftwareNowAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateGatewaySoftwareNowOutcome>([this, request](const std::function<void(Model::UpdateGatewaySoftwareNowOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateGatewaySoftwareNowAsync(request, [complete](const StorageGatewayClient*, const Model::UpdateGatewaySoftwareNowRequest&, const Model::UpdateGatewaySoftwareNowOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateGatewaySoftwareNowOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a gateway's weekly maintenance start time information, including day
          * and time of the week. The maintenance time is the time in your gateway's time
@@ -2264,6 +3639,29 @@ namespace Model
          */
         virtual void UpdateMaintenanceStartTimeAsync(const Model::UpdateMaintenanceStartTimeRequest& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a gateway's weekly maintenance start time information, including day
+         * and time of the week. The maintenance time is the time in your gateway's time
+         * zone.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateMaintenanceStartTimeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateMaintenanceStartTimeRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateMaintenanceStartTimeOutcome> UpdateMaintenanceStartTimeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateMaintenanceStartTimeOutcome>([this, request](const std::function<void(Model::UpdateMaintenanceStartTimeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateMaintenanceStartTimeAsync(request, [complete](const StorageGatewayClient*, const Model::UpdateMaintenanceStartTimeRequest&, const Model::UpdateMaintenanceStartTimeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateMaintenanceStartTimeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates a snapshot schedule configured for a gateway volume.</p> <p>The
          * default snapshot schedule for volume is once every 24 hours, starting at the
@@ -2301,6 +3699,33 @@ namespace Model
          */
         virtual void UpdateSnapshotScheduleAsync(const Model::UpdateSnapshotScheduleRequest& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates a snapshot schedule configured for a gateway volume.</p> <p>The
+         * default snapshot schedule for volume is once every 24 hours, starting at the
+         * creation time of the volume. You can use this API to change the snapshot
+         * schedule configured for the volume.</p> <p>In the request you must identify the
+         * gateway volume whose snapshot schedule you want to update, and the schedule
+         * information, including when you want the snapshot to begin on a day and the
+         * frequency (in hours) of snapshots.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateSnapshotScheduleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateSnapshotScheduleRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateSnapshotScheduleOutcome> UpdateSnapshotScheduleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateSnapshotScheduleOutcome>([this, request](const std::function<void(Model::UpdateSnapshotScheduleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateSnapshotScheduleAsync(request, [complete](const StorageGatewayClient*, const Model::UpdateSnapshotScheduleRequest&, const Model::UpdateSnapshotScheduleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateSnapshotScheduleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Updates the type of medium changer in a gateway-VTL. When you activate a
          * gateway-VTL, you select a medium changer type for the gateway-VTL. This
@@ -2329,6 +3754,30 @@ namespace Model
          */
         virtual void UpdateVTLDeviceTypeAsync(const Model::UpdateVTLDeviceTypeRequest& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Updates the type of medium changer in a gateway-VTL. When you activate a
+         * gateway-VTL, you select a medium changer type for the gateway-VTL. This
+         * operation enables you to select a different type of medium changer after a
+         * gateway-VTL is activated.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateVTLDeviceTypeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateVTLDeviceTypeRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateVTLDeviceTypeOutcome> UpdateVTLDeviceTypeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateVTLDeviceTypeOutcome>([this, request](const std::function<void(Model::UpdateVTLDeviceTypeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateVTLDeviceTypeAsync(request, [complete](const StorageGatewayClient*, const Model::UpdateVTLDeviceTypeRequest&, const Model::UpdateVTLDeviceTypeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateVTLDeviceTypeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -35,6 +35,7 @@
 #include <aws/support/model/RefreshTrustedAdvisorCheckResult.h>
 #include <aws/support/model/ResolveCaseResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -254,6 +255,36 @@ namespace Model
          */
         virtual void AddAttachmentsToSetAsync(const Model::AddAttachmentsToSetRequest& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds one or more attachments to an attachment set. If an
+         * <code>AttachmentSetId</code> is not specified, a new attachment set is created,
+         * and the ID of the set is returned in the response. If an
+         * <code>AttachmentSetId</code> is specified, the attachments are added to the
+         * specified set, if it exists.</p> <p>An attachment set is a temporary container
+         * for attachments that are to be added to a case or case communication. The set is
+         * available for one hour after it is created; the <code>ExpiryTime</code> returned
+         * in the response indicates when the set expires. The maximum number of
+         * attachments in a set is 3, and the maximum size of any attachment in the set is
+         * 5 MB.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddAttachmentsToSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddAttachmentsToSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddAttachmentsToSetOutcome> AddAttachmentsToSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddAttachmentsToSetOutcome>([this, request](const std::function<void(Model::AddAttachmentsToSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddAttachmentsToSetAsync(request, [complete](const SupportClient*, const Model::AddAttachmentsToSetRequest&, const Model::AddAttachmentsToSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddAttachmentsToSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Adds additional customer communication to an AWS Support case. You use the
          * <code>CaseId</code> value to identify the case to add communication to. You can
@@ -291,6 +322,33 @@ namespace Model
          */
         virtual void AddCommunicationToCaseAsync(const Model::AddCommunicationToCaseRequest& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Adds additional customer communication to an AWS Support case. You use the
+         * <code>CaseId</code> value to identify the case to add communication to. You can
+         * list a set of email addresses to copy on the communication using the
+         * <code>CcEmailAddresses</code> value. The <code>CommunicationBody</code> value
+         * contains the text of the communication.</p> <p>The response indicates the
+         * success or failure of the request.</p> <p>This operation implements a subset of
+         * the features of the AWS Support Center.</p>
+         *
+         * Returns an awaitable that starts the operation the way AddCommunicationToCaseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::AddCommunicationToCaseRequest>
+        Aws::Utils::Threading::Awaitable<Model::AddCommunicationToCaseOutcome> AddCommunicationToCaseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::AddCommunicationToCaseOutcome>([this, request](const std::function<void(Model::AddCommunicationToCaseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->AddCommunicationToCaseAsync(request, [complete](const SupportClient*, const Model::AddCommunicationToCaseRequest&, const Model::AddCommunicationToCaseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::AddCommunicationToCaseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a new case in the AWS Support Center. This operation is modeled on
          * the behavior of the AWS Support Center <a
@@ -412,6 +470,61 @@ namespace Model
          */
         virtual void CreateCaseAsync(const Model::CreateCaseRequest& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a new case in the AWS Support Center. This operation is modeled on
+         * the behavior of the AWS Support Center <a
+         * href="https://console.aws.amazon.com/support/home#/case/create">Create Case</a>
+         * page. Its parameters require you to specify the following information: </p> <ol>
+         * <li> <b>IssueType.</b> The type of issue for the case. You can specify either
+         * "customer-service" or "technical." If you do not indicate a value, the default
+         * is "technical." </li> <li> <b>ServiceCode.</b> The code for an AWS service. You
+         * obtain the <code>ServiceCode</code> by calling <a>DescribeServices</a>. </li>
+         * <li> <b>CategoryCode.</b> The category for the service defined for the
+         * <code>ServiceCode</code> value. You also obtain the category code for a service
+         * by calling <a>DescribeServices</a>. Each AWS service defines its own set of
+         * category codes. </li> <li> <b>SeverityCode.</b> A value that indicates the
+         * urgency of the case, which in turn determines the response time according to
+         * your service level agreement with AWS Support. You obtain the SeverityCode by
+         * calling <a>DescribeSeverityLevels</a>.</li> <li> <b>Subject.</b> The
+         * <b>Subject</b> field on the AWS Support Center <a
+         * href="https://console.aws.amazon.com/support/home#/case/create">Create Case</a>
+         * page.</li> <li> <b>CommunicationBody.</b> The <b>Description</b> field on the
+         * AWS Support Center <a
+         * href="https://console.aws.amazon.com/support/home#/case/create">Create Case</a>
+         * page.</li> <li> <b>AttachmentSetId.</b> The ID of a set of attachments that has
+         * been created by using <a>AddAttachmentsToSet</a>.</li> <li> <b>Language.</b> The
+         * human language in which AWS Support handles the case. English and Japanese are
+         * currently supported.</li> <li> <b>CcEmailAddresses.</b> The AWS Support Center
+         * <b>CC</b> field on the <a
+         * href="https://console.aws.amazon.com/support/home#/case/create">Create Case</a>
+         * page. You can list email addresses to be copied on any correspondence about the
+         * case. The account that opens the case is already identified by passing the AWS
+         * Credentials in the HTTP POST method or in a method or function call from one of
+         * the programming languages supported by an <a
+         * href="http://aws.amazon.com/tools/">AWS SDK</a>. </li> </ol> <note><p>To add
+         * additional communication or attachments to an existing case, use
+         * <a>AddCommunicationToCase</a>.</p> </note> <p>A successful <a>CreateCase</a>
+         * request returns an AWS Support case number. Case numbers are used by the
+         * <a>DescribeCases</a> operation to retrieve existing AWS Support cases. </p>
+         *
+         * Returns an awaitable that starts the operation the way CreateCaseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateCaseRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateCaseOutcome> CreateCaseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateCaseOutcome>([this, request](const std::function<void(Model::CreateCaseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateCaseAsync(request, [complete](const SupportClient*, const Model::CreateCaseRequest&, const Model::CreateCaseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateCaseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the attachment that has the specified ID. Attachment IDs are
          * generated by the case management system when you add an attachment to a case or
@@ -440,6 +553,30 @@ namespace Model
          */
         virtual void DescribeAttachmentAsync(const Model::DescribeAttachmentRequest& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the attachment that has the specified ID. Attachment IDs are
+         * generated by the case management system when you add an attachment to a case or
+         * case communication. Attachment IDs are returned in the <a>AttachmentDetails</a>
+         * objects that are returned by the <a>DescribeCommunications</a> operation.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeAttachmentAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeAttachmentRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeAttachmentOutcome> DescribeAttachmentAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeAttachmentOutcome>([this, request](const std::function<void(Model::DescribeAttachmentOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeAttachmentAsync(request, [complete](const SupportClient*, const Model::DescribeAttachmentRequest&, const Model::DescribeAttachmentOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeAttachmentOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of cases that you specify by passing one or more case IDs. In
          * addition, you can filter the cases by date by setting values for the
@@ -489,6 +626,37 @@ namespace Model
          */
         virtual void DescribeCasesAsync(const Model::DescribeCasesRequest& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of cases that you specify by passing one or more case IDs. In
+         * addition, you can filter the cases by date by setting values for the
+         * <code>AfterTime</code> and <code>BeforeTime</code> request parameters. You can
+         * set values for the <code>IncludeResolvedCases</code> and
+         * <code>IncludeCommunications</code> request parameters to control how much
+         * information is returned. </p> <p>Case data is available for 12 months after
+         * creation. If a case was created more than 12 months ago, a request for data
+         * might cause an error. </p> <p>The response returns the following in JSON
+         * format:</p> <ol> <li>One or more <a>CaseDetails</a> data types. </li> <li>One or
+         * more <code>NextToken</code> values, which specify where to paginate the returned
+         * records represented by the <code>CaseDetails</code> objects.</li> </ol>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCasesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCasesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCasesOutcome> DescribeCasesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCasesOutcome>([this, request](const std::function<void(Model::DescribeCasesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCasesAsync(request, [complete](const SupportClient*, const Model::DescribeCasesRequest&, const Model::DescribeCasesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCasesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns communications (and attachments) for one or more support cases. You
          * can use the <code>AfterTime</code> and <code>BeforeTime</code> parameters to
@@ -535,6 +703,36 @@ namespace Model
          */
         virtual void DescribeCommunicationsAsync(const Model::DescribeCommunicationsRequest& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns communications (and attachments) for one or more support cases. You
+         * can use the <code>AfterTime</code> and <code>BeforeTime</code> parameters to
+         * filter by date. You can use the <code>CaseId</code> parameter to restrict the
+         * results to a particular case.</p> <p>Case data is available for 12 months after
+         * creation. If a case was created more than 12 months ago, a request for data
+         * might cause an error. </p> <p>You can use the <code>MaxResults</code> and
+         * <code>NextToken</code> parameters to control the pagination of the result set.
+         * Set <code>MaxResults</code> to the number of cases you want displayed on each
+         * page, and use <code>NextToken</code> to specify the resumption of
+         * pagination.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeCommunicationsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeCommunicationsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeCommunicationsOutcome> DescribeCommunicationsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeCommunicationsOutcome>([this, request](const std::function<void(Model::DescribeCommunicationsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeCommunicationsAsync(request, [complete](const SupportClient*, const Model::DescribeCommunicationsRequest&, const Model::DescribeCommunicationsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeCommunicationsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the current list of AWS services and a list of service categories
          * that applies to each one. You then use service names and categories in your
@@ -587,6 +785,38 @@ namespace Model
          */
         virtual void DescribeServicesAsync(const Model::DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the current list of AWS services and a list of service categories
+         * that applies to each one. You then use service names and categories in your
+         * <a>CreateCase</a> requests. Each AWS service has its own set of categories.</p>
+         * <p>The service codes and category codes correspond to the values that are
+         * displayed in the <b>Service</b> and <b>Category</b> drop-down lists on the AWS
+         * Support Center <a
+         * href="https://console.aws.amazon.com/support/home#/case/create">Create Case</a>
+         * page. The values in those fields, however, do not necessarily match the service
+         * codes and categories returned by the <code>DescribeServices</code> request.
+         * Always use the service codes and categories obtained programmatically. This
+         * practice ensures that you always have the most recent set of service and
+         * category codes.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeServicesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeServicesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeServicesOutcome> DescribeServicesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeServicesOutcome>([this, request](const std::function<void(Model::DescribeServicesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeServicesAsync(request, [complete](const SupportClient*, const Model::DescribeServicesRequest&, const Model::DescribeServicesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeServicesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the list of severity levels that you can assign to an AWS Support
          * case. The severity level for a case is also a field in the <a>CaseDetails</a>
@@ -612,6 +842,29 @@ namespace Model
          */
         virtual void DescribeSeverityLevelsAsync(const Model::DescribeSeverityLevelsRequest& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the list of severity levels that you can assign to an AWS Support
+         * case. The severity level for a case is also a field in the <a>CaseDetails</a>
+         * data type included in any <a>CreateCase</a> request. </p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeSeverityLevelsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeSeverityLevelsRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeSeverityLevelsOutcome> DescribeSeverityLevelsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeSeverityLevelsOutcome>([this, request](const std::function<void(Model::DescribeSeverityLevelsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeSeverityLevelsAsync(request, [complete](const SupportClient*, const Model::DescribeSeverityLevelsRequest&, const Model::DescribeSeverityLevelsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeSeverityLevelsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the refresh status of the Trusted Advisor checks that have the
          * specified check IDs. Check IDs can be obtained by calling
@@ -637,6 +890,29 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorCheckRefreshStatusesAsync(const Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the refresh status of the Trusted Advisor checks that have the
+         * specified check IDs. Check IDs can be obtained by calling
+         * <a>DescribeTrustedAdvisorChecks</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTrustedAdvisorCheckRefreshStatusesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcome> DescribeTrustedAdvisorCheckRefreshStatusesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcome>([this, request](const std::function<void(Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTrustedAdvisorCheckRefreshStatusesAsync(request, [complete](const SupportClient*, const Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest&, const Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the results of the Trusted Advisor check that has the specified check
          * ID. Check IDs can be obtained by calling
@@ -686,6 +962,37 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorCheckResultAsync(const Model::DescribeTrustedAdvisorCheckResultRequest& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the results of the Trusted Advisor check that has the specified check
+         * ID. Check IDs can be obtained by calling
+         * <a>DescribeTrustedAdvisorChecks</a>.</p> <p>The response contains a
+         * <a>TrustedAdvisorCheckResult</a> object, which contains these three objects:</p>
+         * <ul> <li><a>TrustedAdvisorCategorySpecificSummary</a></li>
+         * <li><a>TrustedAdvisorResourceDetail</a></li>
+         * <li><a>TrustedAdvisorResourcesSummary</a></li> </ul> <p>In addition, the
+         * response contains these fields:</p> <ul> <li> <b>Status.</b> The alert status of
+         * the check: "ok" (green), "warning" (yellow), "error" (red), or
+         * "not_available".</li> <li> <b>Timestamp.</b> The time of the last refresh of the
+         * check.</li> <li> <b>CheckId.</b> The unique identifier for the check.</li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTrustedAdvisorCheckResultAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTrustedAdvisorCheckResultRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTrustedAdvisorCheckResultOutcome> DescribeTrustedAdvisorCheckResultAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTrustedAdvisorCheckResultOutcome>([this, request](const std::function<void(Model::DescribeTrustedAdvisorCheckResultOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTrustedAdvisorCheckResultAsync(request, [complete](const SupportClient*, const Model::DescribeTrustedAdvisorCheckResultRequest&, const Model::DescribeTrustedAdvisorCheckResultOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTrustedAdvisorCheckResultOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the summaries of the results of the Trusted Advisor checks that have
          * the specified check IDs. Check IDs can be obtained by calling
@@ -714,6 +1021,30 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorCheckSummariesAsync(const Model::DescribeTrustedAdvisorCheckSummariesRequest& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the summaries of the results of the Trusted Advisor checks that have
+         * the specified check IDs. Check IDs can be obtained by calling
+         * <a>DescribeTrustedAdvisorChecks</a>.</p> <p>The response contains an array of
+         * <a>TrustedAdvisorCheckSummary</a> objects.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTrustedAdvisorCheckSummariesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTrustedAdvisorCheckSummariesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTrustedAdvisorCheckSummariesOutcome> DescribeTrustedAdvisorCheckSummariesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTrustedAdvisorCheckSummariesOutcome>([this, request](const std::function<void(Model::DescribeTrustedAdvisorCheckSummariesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTrustedAdvisorCheckSummariesAsync(request, [complete](const SupportClient*, const Model::DescribeTrustedAdvisorCheckSummariesRequest&, const Model::DescribeTrustedAdvisorCheckSummariesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTrustedAdvisorCheckSummariesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about all available Trusted Advisor checks, including
          * name, ID, category, description, and metadata. You must specify a language code;
@@ -742,6 +1073,30 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorChecksAsync(const Model::DescribeTrustedAdvisorChecksRequest& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about all available Trusted Advisor checks, including
+         * name, ID, category, description, and metadata. You must specify a language code;
+         * English ("en") and Japanese ("ja") are currently supported. The response
+         * contains a <a>TrustedAdvisorCheckDescription</a> for each check.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeTrustedAdvisorChecksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeTrustedAdvisorChecksRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeTrustedAdvisorChecksOutcome> DescribeTrustedAdvisorChecksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeTrustedAdvisorChecksOutcome>([this, request](const std::function<void(Model::DescribeTrustedAdvisorChecksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeTrustedAdvisorChecksAsync(request, [complete](const SupportClient*, const Model::DescribeTrustedAdvisorChecksRequest&, const Model::DescribeTrustedAdvisorChecksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeTrustedAdvisorChecksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Requests a refresh of the Trusted Advisor check that has the specified check
          * ID. Check IDs can be obtained by calling
@@ -785,6 +1140,35 @@ namespace Model
          */
         virtual void RefreshTrustedAdvisorCheckAsync(const Model::RefreshTrustedAdvisorCheckRequest& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Requests a refresh of the Trusted Advisor check that has the specified check
+         * ID. Check IDs can be obtained by calling
+         * <a>DescribeTrustedAdvisorChecks</a>.</p> <p>The response contains a
+         * <a>TrustedAdvisorCheckRefreshStatus</a> object, which contains these fields:</p>
+         * <ul> <li> <b>Status.</b> The refresh status of the check: "none", "enqueued",
+         * "processing", "success", or "abandoned".</li> <li>
+         * <b>MillisUntilNextRefreshable.</b> The amount of time, in milliseconds, until
+         * the check is eligible for refresh.</li> <li> <b>CheckId.</b> The unique
+         * identifier for the check.</li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way RefreshTrustedAdvisorCheckAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RefreshTrustedAdvisorCheckRequest>
+        Aws::Utils::Threading::Awaitable<Model::RefreshTrustedAdvisorCheckOutcome> RefreshTrustedAdvisorCheckAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RefreshTrustedAdvisorCheckOutcome>([this, request](const std::function<void(Model::RefreshTrustedAdvisorCheckOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RefreshTrustedAdvisorCheckAsync(request, [complete](const SupportClient*, const Model::RefreshTrustedAdvisorCheckRequest&, const Model::RefreshTrustedAdvisorCheckOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RefreshTrustedAdvisorCheckOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Takes a <code>CaseId</code> and returns the initial state of the case along
          * with the state of the case after the call to <a>ResolveCase</a> completed.</p>
@@ -807,6 +1191,28 @@ namespace Model
          */
         virtual void ResolveCaseAsync(const Model::ResolveCaseRequest& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Takes a <code>CaseId</code> and returns the initial state of the case along
+         * with the state of the case after the call to <a>ResolveCase</a> completed.</p>
+         *
+         * Returns an awaitable that starts the operation the way ResolveCaseAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ResolveCaseRequest>
+        Aws::Utils::Threading::Awaitable<Model::ResolveCaseOutcome> ResolveCaseAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ResolveCaseOutcome>([this, request](const std::function<void(Model::ResolveCaseOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ResolveCaseAsync(request, [complete](const SupportClient*, const Model::ResolveCaseRequest&, const Model::ResolveCaseOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ResolveCaseOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
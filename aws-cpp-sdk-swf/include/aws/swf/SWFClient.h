@@ -40,6 +40,7 @@
 #include <aws/swf/model/StartWorkflowExecutionResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -333,6 +334,46 @@ namespace Model
          */
         virtual void CountClosedWorkflowExecutionsAsync(const Model::CountClosedWorkflowExecutionsRequest& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the number of closed workflow executions within the given domain that
+         * meet the specified filtering criteria.</p> <note>This operation is eventually
+         * consistent. The results are best effort and may not exactly reflect recent
+         * updates and changes.</note> <p><b>Access Control</b></p> <p>You can use IAM
+         * policies to control this action's access to Amazon SWF resources as follows:</p>
+         * <ul> <li>Use a <code>Resource</code> element with the domain name to limit the
+         * action to only specified domains.</li> <li>Use an <code>Action</code> element to
+         * allow or deny permission to call this action.</li> <li>Constrain the following
+         * parameters by using a <code>Condition</code> element with the appropriate keys.
+         * <ul> <li><code>tagFilter.tag</code>: String constraint. The key is
+         * <code>swf:tagFilter.tag</code>.</li> <li><code>typeFilter.name</code>: String
+         * constraint. The key is <code>swf:typeFilter.name</code>.</li>
+         * <li><code>typeFilter.version</code>: String constraint. The key is
+         * <code>swf:typeFilter.version</code>.</li> </ul> </li> </ul> <p>If the caller
+         * does not have sufficient permissions to invoke the action, or the parameter
+         * values fall outside the specified constraints, the action fails. The associated
+         * event attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED.
+         * For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CountClosedWorkflowExecutionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CountClosedWorkflowExecutionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::CountClosedWorkflowExecutionsOutcome> CountClosedWorkflowExecutionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CountClosedWorkflowExecutionsOutcome>([this, request](const std::function<void(Model::CountClosedWorkflowExecutionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CountClosedWorkflowExecutionsAsync(request, [complete](const SWFClient*, const Model::CountClosedWorkflowExecutionsRequest&, const Model::CountClosedWorkflowExecutionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CountClosedWorkflowExecutionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the number of open workflow executions within the given domain that
          * meet the specified filtering criteria.</p> <note>This operation is eventually
@@ -409,6 +450,46 @@ namespace Model
          */
         virtual void CountOpenWorkflowExecutionsAsync(const Model::CountOpenWorkflowExecutionsRequest& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the number of open workflow executions within the given domain that
+         * meet the specified filtering criteria.</p> <note>This operation is eventually
+         * consistent. The results are best effort and may not exactly reflect recent
+         * updates and changes.</note> <p><b>Access Control</b></p> <p>You can use IAM
+         * policies to control this action's access to Amazon SWF resources as follows:</p>
+         * <ul> <li>Use a <code>Resource</code> element with the domain name to limit the
+         * action to only specified domains.</li> <li>Use an <code>Action</code> element to
+         * allow or deny permission to call this action.</li> <li>Constrain the following
+         * parameters by using a <code>Condition</code> element with the appropriate keys.
+         * <ul> <li><code>tagFilter.tag</code>: String constraint. The key is
+         * <code>swf:tagFilter.tag</code>.</li> <li><code>typeFilter.name</code>: String
+         * constraint. The key is <code>swf:typeFilter.name</code>.</li>
+         * <li><code>typeFilter.version</code>: String constraint. The key is
+         * <code>swf:typeFilter.version</code>.</li> </ul> </li> </ul> <p>If the caller
+         * does not have sufficient permissions to invoke the action, or the parameter
+         * values fall outside the specified constraints, the action fails. The associated
+         * event attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED.
+         * For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CountOpenWorkflowExecutionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CountOpenWorkflowExecutionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::CountOpenWorkflowExecutionsOutcome> CountOpenWorkflowExecutionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CountOpenWorkflowExecutionsOutcome>([this, request](const std::function<void(Model::CountOpenWorkflowExecutionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CountOpenWorkflowExecutionsAsync(request, [complete](const SWFClient*, const Model::CountOpenWorkflowExecutionsRequest&, const Model::CountOpenWorkflowExecutionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CountOpenWorkflowExecutionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the estimated number of activity tasks in the specified task list.
          * The count returned is an approximation and is not guaranteed to be exact. If you
@@ -476,6 +557,43 @@ namespace Model
          */
         virtual void CountPendingActivityTasksAsync(const Model::CountPendingActivityTasksRequest& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the estimated number of activity tasks in the specified task list.
+         * The count returned is an approximation and is not guaranteed to be exact. If you
+         * specify a task list that no activity task was ever scheduled in then 0 will be
+         * returned.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to
+         * control this action's access to Amazon SWF resources as follows:</p> <ul>
+         * <li>Use a <code>Resource</code> element with the domain name to limit the action
+         * to only specified domains.</li> <li>Use an <code>Action</code> element to allow
+         * or deny permission to call this action.</li> <li>Constrain the
+         * <code>taskList.name</code> parameter by using a <b>Condition</b> element with
+         * the <code>swf:taskList.name</code> key to allow the action to access only
+         * certain task lists.</li> </ul> <p>If the caller does not have sufficient
+         * permissions to invoke the action, or the parameter values fall outside the
+         * specified constraints, the action fails. The associated event attribute's
+         * <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For details and
+         * example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CountPendingActivityTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CountPendingActivityTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::CountPendingActivityTasksOutcome> CountPendingActivityTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CountPendingActivityTasksOutcome>([this, request](const std::function<void(Model::CountPendingActivityTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CountPendingActivityTasksAsync(request, [complete](const SWFClient*, const Model::CountPendingActivityTasksRequest&, const Model::CountPendingActivityTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CountPendingActivityTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the estimated number of decision tasks in the specified task list.
          * The count returned is an approximation and is not guaranteed to be exact. If you
@@ -543,6 +661,43 @@ namespace Model
          */
         virtual void CountPendingDecisionTasksAsync(const Model::CountPendingDecisionTasksRequest& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the estimated number of decision tasks in the specified task list.
+         * The count returned is an approximation and is not guaranteed to be exact. If you
+         * specify a task list that no decision task was ever scheduled in then 0 will be
+         * returned.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to
+         * control this action's access to Amazon SWF resources as follows:</p> <ul>
+         * <li>Use a <code>Resource</code> element with the domain name to limit the action
+         * to only specified domains.</li> <li>Use an <code>Action</code> element to allow
+         * or deny permission to call this action.</li> <li>Constrain the
+         * <code>taskList.name</code> parameter by using a <b>Condition</b> element with
+         * the <code>swf:taskList.name</code> key to allow the action to access only
+         * certain task lists.</li> </ul> <p>If the caller does not have sufficient
+         * permissions to invoke the action, or the parameter values fall outside the
+         * specified constraints, the action fails. The associated event attribute's
+         * <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For details and
+         * example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CountPendingDecisionTasksAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CountPendingDecisionTasksRequest>
+        Aws::Utils::Threading::Awaitable<Model::CountPendingDecisionTasksOutcome> CountPendingDecisionTasksAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CountPendingDecisionTasksOutcome>([this, request](const std::function<void(Model::CountPendingDecisionTasksOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CountPendingDecisionTasksAsync(request, [complete](const SWFClient*, const Model::CountPendingDecisionTasksRequest&, const Model::CountPendingDecisionTasksOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CountPendingDecisionTasksOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deprecates the specified <i>activity type</i>. After an activity type has
          * been deprecated, you cannot create new tasks of that activity type. Tasks of
@@ -619,6 +774,46 @@ namespace Model
          */
         virtual void DeprecateActivityTypeAsync(const Model::DeprecateActivityTypeRequest& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deprecates the specified <i>activity type</i>. After an activity type has
+         * been deprecated, you cannot create new tasks of that activity type. Tasks of
+         * this type that were scheduled before the type was deprecated will continue to
+         * run.</p> <note>This operation is eventually consistent. The results are best
+         * effort and may not exactly reflect recent updates and changes.</note>
+         * <p><b>Access Control</b></p> <p>You can use IAM policies to control this
+         * action's access to Amazon SWF resources as follows:</p> <ul> <li>Use a
+         * <code>Resource</code> element with the domain name to limit the action to only
+         * specified domains.</li> <li>Use an <code>Action</code> element to allow or deny
+         * permission to call this action.</li> <li>Constrain the following parameters by
+         * using a <code>Condition</code> element with the appropriate keys. <ul>
+         * <li><code>activityType.name</code>: String constraint. The key is
+         * <code>swf:activityType.name</code>.</li> <li><code>activityType.version</code>:
+         * String constraint. The key is <code>swf:activityType.version</code>.</li> </ul>
+         * </li> </ul> <p>If the caller does not have sufficient permissions to invoke the
+         * action, or the parameter values fall outside the specified constraints, the
+         * action fails. The associated event attribute's <b>cause</b> parameter will be
+         * set to OPERATION_NOT_PERMITTED. For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeprecateActivityTypeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeprecateActivityTypeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeprecateActivityTypeOutcome> DeprecateActivityTypeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeprecateActivityTypeOutcome>([this, request](const std::function<void(Model::DeprecateActivityTypeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeprecateActivityTypeAsync(request, [complete](const SWFClient*, const Model::DeprecateActivityTypeRequest&, const Model::DeprecateActivityTypeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeprecateActivityTypeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deprecates the specified domain. After a domain has been deprecated it cannot
          * be used to create new workflow executions or register new types. However, you
@@ -692,6 +887,45 @@ namespace Model
          */
         virtual void DeprecateDomainAsync(const Model::DeprecateDomainRequest& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deprecates the specified domain. After a domain has been deprecated it cannot
+         * be used to create new workflow executions or register new types. However, you
+         * can still use visibility actions on this domain. Deprecating a domain also
+         * deprecates all activity and workflow types registered in the domain. Executions
+         * that were started before the domain was deprecated will continue to run.</p>
+         * <note>This operation is eventually consistent. The results are best effort and
+         * may not exactly reflect recent updates and changes.</note> <p><b>Access
+         * Control</b></p> <p>You can use IAM policies to control this action's access to
+         * Amazon SWF resources as follows:</p> <ul> <li>Use a <code>Resource</code>
+         * element with the domain name to limit the action to only specified domains.</li>
+         * <li>Use an <code>Action</code> element to allow or deny permission to call this
+         * action.</li> <li>You cannot use an IAM policy to constrain this action's
+         * parameters.</li> </ul> <p>If the caller does not have sufficient permissions to
+         * invoke the action, or the parameter values fall outside the specified
+         * constraints, the action fails. The associated event attribute's <b>cause</b>
+         * parameter will be set to OPERATION_NOT_PERMITTED. For details and example IAM
+         * policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeprecateDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeprecateDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeprecateDomainOutcome> DeprecateDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeprecateDomainOutcome>([this, request](const std::function<void(Model::DeprecateDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeprecateDomainAsync(request, [complete](const SWFClient*, const Model::DeprecateDomainRequest&, const Model::DeprecateDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeprecateDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Deprecates the specified <i>workflow type</i>. After a workflow type has been
          * deprecated, you cannot create new executions of that type. Executions that were
@@ -771,6 +1005,47 @@ namespace Model
          */
         virtual void DeprecateWorkflowTypeAsync(const Model::DeprecateWorkflowTypeRequest& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Deprecates the specified <i>workflow type</i>. After a workflow type has been
+         * deprecated, you cannot create new executions of that type. Executions that were
+         * started before the type was deprecated will continue to run. A deprecated
+         * workflow type may still be used when calling visibility actions.</p> <note>This
+         * operation is eventually consistent. The results are best effort and may not
+         * exactly reflect recent updates and changes.</note> <p><b>Access Control</b></p>
+         * <p>You can use IAM policies to control this action's access to Amazon SWF
+         * resources as follows:</p> <ul> <li>Use a <code>Resource</code> element with the
+         * domain name to limit the action to only specified domains.</li> <li>Use an
+         * <code>Action</code> element to allow or deny permission to call this
+         * action.</li> <li>Constrain the following parameters by using a
+         * <code>Condition</code> element with the appropriate keys. <ul>
+         * <li><code>workflowType.name</code>: String constraint. The key is
+         * <code>swf:workflowType.name</code>.</li> <li><code>workflowType.version</code>:
+         * String constraint. The key is <code>swf:workflowType.version</code>.</li> </ul>
+         * </li> </ul> <p>If the caller does not have sufficient permissions to invoke the
+         * action, or the parameter values fall outside the specified constraints, the
+         * action fails. The associated event attribute's <b>cause</b> parameter will be
+         * set to OPERATION_NOT_PERMITTED. For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DeprecateWorkflowTypeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeprecateWorkflowTypeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeprecateWorkflowTypeOutcome> DeprecateWorkflowTypeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeprecateWorkflowTypeOutcome>([this, request](const std::function<void(Model::DeprecateWorkflowTypeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeprecateWorkflowTypeAsync(request, [complete](const SWFClient*, const Model::DeprecateWorkflowTypeRequest&, const Model::DeprecateWorkflowTypeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeprecateWorkflowTypeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the specified activity type. This includes
          * configuration settings provided when the type was registered and other general
@@ -838,6 +1113,43 @@ namespace Model
          */
         virtual void DescribeActivityTypeAsync(const Model::DescribeActivityTypeRequest& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the specified activity type. This includes
+         * configuration settings provided when the type was registered and other general
+         * information about the type.</p> <p><b>Access Control</b></p> <p>You can use IAM
+         * policies to control this action's access to Amazon SWF resources as follows:</p>
+         * <ul> <li>Use a <code>Resource</code> element with the domain name to limit the
+         * action to only specified domains.</li> <li>Use an <code>Action</code> element to
+         * allow or deny permission to call this action.</li> <li>Constrain the following
+         * parameters by using a <code>Condition</code> element with the appropriate keys.
+         * <ul> <li><code>activityType.name</code>: String constraint. The key is
+         * <code>swf:activityType.name</code>.</li> <li><code>activityType.version</code>:
+         * String constraint. The key is <code>swf:activityType.version</code>.</li> </ul>
+         * </li> </ul> <p>If the caller does not have sufficient permissions to invoke the
+         * action, or the parameter values fall outside the specified constraints, the
+         * action fails. The associated event attribute's <b>cause</b> parameter will be
+         * set to OPERATION_NOT_PERMITTED. For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeActivityTypeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeActivityTypeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeActivityTypeOutcome> DescribeActivityTypeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeActivityTypeOutcome>([this, request](const std::function<void(Model::DescribeActivityTypeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeActivityTypeAsync(request, [complete](const SWFClient*, const Model::DescribeActivityTypeRequest&, const Model::DescribeActivityTypeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeActivityTypeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the specified domain, including description and
          * status.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to control
@@ -893,6 +1205,39 @@ namespace Model
          */
         virtual void DescribeDomainAsync(const Model::DescribeDomainRequest& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the specified domain, including description and
+         * status.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to control
+         * this action's access to Amazon SWF resources as follows:</p> <ul> <li>Use a
+         * <code>Resource</code> element with the domain name to limit the action to only
+         * specified domains.</li> <li>Use an <code>Action</code> element to allow or deny
+         * permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeDomainOutcome> DescribeDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeDomainOutcome>([this, request](const std::function<void(Model::DescribeDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeDomainAsync(request, [complete](const SWFClient*, const Model::DescribeDomainRequest&, const Model::DescribeDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the specified workflow execution including its type
          * and some statistics.</p> <note>This operation is eventually consistent. The
@@ -954,6 +1299,41 @@ namespace Model
          */
         virtual void DescribeWorkflowExecutionAsync(const Model::DescribeWorkflowExecutionRequest& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the specified workflow execution including its type
+         * and some statistics.</p> <note>This operation is eventually consistent. The
+         * results are best effort and may not exactly reflect recent updates and
+         * changes.</note> <p><b>Access Control</b></p> <p>You can use IAM policies to
+         * control this action's access to Amazon SWF resources as follows:</p> <ul>
+         * <li>Use a <code>Resource</code> element with the domain name to limit the action
+         * to only specified domains.</li> <li>Use an <code>Action</code> element to allow
+         * or deny permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeWorkflowExecutionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeWorkflowExecutionRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeWorkflowExecutionOutcome> DescribeWorkflowExecutionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeWorkflowExecutionOutcome>([this, request](const std::function<void(Model::DescribeWorkflowExecutionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeWorkflowExecutionAsync(request, [complete](const SWFClient*, const Model::DescribeWorkflowExecutionRequest&, const Model::DescribeWorkflowExecutionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeWorkflowExecutionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about the specified <i>workflow type</i>. This includes
          * configuration settings specified when the type was registered and other
@@ -1024,6 +1404,44 @@ namespace Model
          */
         virtual void DescribeWorkflowTypeAsync(const Model::DescribeWorkflowTypeRequest& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about the specified <i>workflow type</i>. This includes
+         * configuration settings specified when the type was registered and other
+         * information such as creation date, current status, and so on.</p> <p><b>Access
+         * Control</b></p> <p>You can use IAM policies to control this action's access to
+         * Amazon SWF resources as follows:</p> <ul> <li>Use a <code>Resource</code>
+         * element with the domain name to limit the action to only specified domains.</li>
+         * <li>Use an <code>Action</code> element to allow or deny permission to call this
+         * action.</li> <li>Constrain the following parameters by using a
+         * <code>Condition</code> element with the appropriate keys. <ul>
+         * <li><code>workflowType.name</code>: String constraint. The key is
+         * <code>swf:workflowType.name</code>.</li> <li><code>workflowType.version</code>:
+         * String constraint. The key is <code>swf:workflowType.version</code>.</li> </ul>
+         * </li> </ul> <p>If the caller does not have sufficient permissions to invoke the
+         * action, or the parameter values fall outside the specified constraints, the
+         * action fails. The associated event attribute's <b>cause</b> parameter will be
+         * set to OPERATION_NOT_PERMITTED. For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeWorkflowTypeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeWorkflowTypeRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeWorkflowTypeOutcome> DescribeWorkflowTypeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeWorkflowTypeOutcome>([this, request](const std::function<void(Model::DescribeWorkflowTypeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeWorkflowTypeAsync(request, [complete](const SWFClient*, const Model::DescribeWorkflowTypeRequest&, const Model::DescribeWorkflowTypeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeWorkflowTypeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the history of the specified workflow execution. The results may be
          * split into multiple pages. To retrieve subsequent pages, make the call again
@@ -1091,6 +1509,43 @@ namespace Model
          */
         virtual void GetWorkflowExecutionHistoryAsync(const Model::GetWorkflowExecutionHistoryRequest& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the history of the specified workflow execution. The results may be
+         * split into multiple pages. To retrieve subsequent pages, make the call again
+         * using the <code>nextPageToken</code> returned by the initial call.</p>
+         * <note>This operation is eventually consistent. The results are best effort and
+         * may not exactly reflect recent updates and changes.</note> <p><b>Access
+         * Control</b></p> <p>You can use IAM policies to control this action's access to
+         * Amazon SWF resources as follows:</p> <ul> <li>Use a <code>Resource</code>
+         * element with the domain name to limit the action to only specified domains.</li>
+         * <li>Use an <code>Action</code> element to allow or deny permission to call this
+         * action.</li> <li>You cannot use an IAM policy to constrain this action's
+         * parameters.</li> </ul> <p>If the caller does not have sufficient permissions to
+         * invoke the action, or the parameter values fall outside the specified
+         * constraints, the action fails. The associated event attribute's <b>cause</b>
+         * parameter will be set to OPERATION_NOT_PERMITTED. For details and example IAM
+         * policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetWorkflowExecutionHistoryAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetWorkflowExecutionHistoryRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetWorkflowExecutionHistoryOutcome> GetWorkflowExecutionHistoryAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetWorkflowExecutionHistoryOutcome>([this, request](const std::function<void(Model::GetWorkflowExecutionHistoryOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetWorkflowExecutionHistoryAsync(request, [complete](const SWFClient*, const Model::GetWorkflowExecutionHistoryRequest&, const Model::GetWorkflowExecutionHistoryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetWorkflowExecutionHistoryOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about all activities registered in the specified domain
          * that match the specified name and registration status. The result includes
@@ -1158,6 +1613,43 @@ namespace Model
          */
         virtual void ListActivityTypesAsync(const Model::ListActivityTypesRequest& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about all activities registered in the specified domain
+         * that match the specified name and registration status. The result includes
+         * information like creation date, current status of the activity, etc. The results
+         * may be split into multiple pages. To retrieve subsequent pages, make the call
+         * again using the <code>nextPageToken</code> returned by the initial call.</p>
+         * <p><b>Access Control</b></p> <p>You can use IAM policies to control this
+         * action's access to Amazon SWF resources as follows:</p> <ul> <li>Use a
+         * <code>Resource</code> element with the domain name to limit the action to only
+         * specified domains.</li> <li>Use an <code>Action</code> element to allow or deny
+         * permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListActivityTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListActivityTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListActivityTypesOutcome> ListActivityTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListActivityTypesOutcome>([this, request](const std::function<void(Model::ListActivityTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListActivityTypesAsync(request, [complete](const SWFClient*, const Model::ListActivityTypesRequest&, const Model::ListActivityTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListActivityTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of closed workflow executions in the specified domain that
          * meet the filtering criteria. The results may be split into multiple pages. To
@@ -1240,6 +1732,48 @@ namespace Model
          */
         virtual void ListClosedWorkflowExecutionsAsync(const Model::ListClosedWorkflowExecutionsRequest& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of closed workflow executions in the specified domain that
+         * meet the filtering criteria. The results may be split into multiple pages. To
+         * retrieve subsequent pages, make the call again using the nextPageToken returned
+         * by the initial call.</p> <note>This operation is eventually consistent. The
+         * results are best effort and may not exactly reflect recent updates and
+         * changes.</note> <p><b>Access Control</b></p> <p>You can use IAM policies to
+         * control this action's access to Amazon SWF resources as follows:</p> <ul>
+         * <li>Use a <code>Resource</code> element with the domain name to limit the action
+         * to only specified domains.</li> <li>Use an <code>Action</code> element to allow
+         * or deny permission to call this action.</li> <li>Constrain the following
+         * parameters by using a <code>Condition</code> element with the appropriate keys.
+         * <ul> <li><code>tagFilter.tag</code>: String constraint. The key is
+         * <code>swf:tagFilter.tag</code>.</li> <li><code>typeFilter.name</code>: String
+         * constraint. The key is <code>swf:typeFilter.name</code>.</li>
+         * <li><code>typeFilter.version</code>: String constraint. The key is
+         * <code>swf:typeFilter.version</code>.</li> </ul> </li> </ul> <p>If the caller
+         * does not have sufficient permissions to invoke the action, or the parameter
+         * values fall outside the specified constraints, the action fails. The associated
+         * event attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED.
+         * For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListClosedWorkflowExecutionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListClosedWorkflowExecutionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListClosedWorkflowExecutionsOutcome> ListClosedWorkflowExecutionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListClosedWorkflowExecutionsOutcome>([this, request](const std::function<void(Model::ListClosedWorkflowExecutionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListClosedWorkflowExecutionsAsync(request, [complete](const SWFClient*, const Model::ListClosedWorkflowExecutionsRequest&, const Model::ListClosedWorkflowExecutionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListClosedWorkflowExecutionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the list of domains registered in the account. The results may be
          * split into multiple pages. To retrieve subsequent pages, make the call again
@@ -1310,6 +1844,44 @@ namespace Model
          */
         virtual void ListDomainsAsync(const Model::ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the list of domains registered in the account. The results may be
+         * split into multiple pages. To retrieve subsequent pages, make the call again
+         * using the nextPageToken returned by the initial call.</p> <note> This operation
+         * is eventually consistent. The results are best effort and may not exactly
+         * reflect recent updates and changes.</note> <p><b>Access Control</b></p> <p>You
+         * can use IAM policies to control this action's access to Amazon SWF resources as
+         * follows:</p> <ul> <li>Use a <code>Resource</code> element with the domain name
+         * to limit the action to only specified domains. The element must be set to
+         * <code>arn:aws:swf::AccountID:domain/ *</code>, where <i>AccountID</i> is the
+         * account ID, with no dashes.</li> <li>Use an <code>Action</code> element to allow
+         * or deny permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListDomainsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListDomainsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListDomainsOutcome> ListDomainsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListDomainsOutcome>([this, request](const std::function<void(Model::ListDomainsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListDomainsAsync(request, [complete](const SWFClient*, const Model::ListDomainsRequest&, const Model::ListDomainsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListDomainsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns a list of open workflow executions in the specified domain that meet
          * the filtering criteria. The results may be split into multiple pages. To
@@ -1392,6 +1964,48 @@ namespace Model
          */
         virtual void ListOpenWorkflowExecutionsAsync(const Model::ListOpenWorkflowExecutionsRequest& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns a list of open workflow executions in the specified domain that meet
+         * the filtering criteria. The results may be split into multiple pages. To
+         * retrieve subsequent pages, make the call again using the nextPageToken returned
+         * by the initial call.</p> <note> This operation is eventually consistent. The
+         * results are best effort and may not exactly reflect recent updates and
+         * changes.</note> <p><b>Access Control</b></p> <p>You can use IAM policies to
+         * control this action's access to Amazon SWF resources as follows:</p> <ul>
+         * <li>Use a <code>Resource</code> element with the domain name to limit the action
+         * to only specified domains.</li> <li>Use an <code>Action</code> element to allow
+         * or deny permission to call this action.</li> <li>Constrain the following
+         * parameters by using a <code>Condition</code> element with the appropriate keys.
+         * <ul> <li><code>tagFilter.tag</code>: String constraint. The key is
+         * <code>swf:tagFilter.tag</code>.</li> <li><code>typeFilter.name</code>: String
+         * constraint. The key is <code>swf:typeFilter.name</code>.</li>
+         * <li><code>typeFilter.version</code>: String constraint. The key is
+         * <code>swf:typeFilter.version</code>.</li> </ul> </li> </ul> <p>If the caller
+         * does not have sufficient permissions to invoke the action, or the parameter
+         * values fall outside the specified constraints, the action fails. The associated
+         * event attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED.
+         * For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListOpenWorkflowExecutionsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListOpenWorkflowExecutionsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListOpenWorkflowExecutionsOutcome> ListOpenWorkflowExecutionsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListOpenWorkflowExecutionsOutcome>([this, request](const std::function<void(Model::ListOpenWorkflowExecutionsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListOpenWorkflowExecutionsAsync(request, [complete](const SWFClient*, const Model::ListOpenWorkflowExecutionsRequest&, const Model::ListOpenWorkflowExecutionsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListOpenWorkflowExecutionsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns information about workflow types in the specified domain. The results
          * may be split into multiple pages that can be retrieved by making the call
@@ -1450,6 +2064,40 @@ namespace Model
          */
         virtual void ListWorkflowTypesAsync(const Model::ListWorkflowTypesRequest& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns information about workflow types in the specified domain. The results
+         * may be split into multiple pages that can be retrieved by making the call
+         * repeatedly.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to
+         * control this action's access to Amazon SWF resources as follows:</p> <ul>
+         * <li>Use a <code>Resource</code> element with the domain name to limit the action
+         * to only specified domains.</li> <li>Use an <code>Action</code> element to allow
+         * or deny permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListWorkflowTypesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListWorkflowTypesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListWorkflowTypesOutcome> ListWorkflowTypesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListWorkflowTypesOutcome>([this, request](const std::function<void(Model::ListWorkflowTypesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListWorkflowTypesAsync(request, [complete](const SWFClient*, const Model::ListWorkflowTypesRequest&, const Model::ListWorkflowTypesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListWorkflowTypesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Used by workers to get an <a>ActivityTask</a> from the specified activity
          * <code>taskList</code>. This initiates a long poll, where the service holds the
@@ -1538,6 +2186,50 @@ namespace Model
          */
         virtual void PollForActivityTaskAsync(const Model::PollForActivityTaskRequest& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Used by workers to get an <a>ActivityTask</a> from the specified activity
+         * <code>taskList</code>. This initiates a long poll, where the service holds the
+         * HTTP connection open and responds as soon as a task becomes available. The
+         * maximum time the service holds on to the request before responding is 60
+         * seconds. If no task is available within 60 seconds, the poll will return an
+         * empty result. An empty result, in this context, means that an ActivityTask is
+         * returned, but that the value of taskToken is an empty string. If a task is
+         * returned, the worker should use its type to identify and process it
+         * correctly.</p> <important>Workers should set their client side socket timeout to
+         * at least 70 seconds (10 seconds higher than the maximum time service may hold
+         * the poll request).</important> <p><b>Access Control</b></p> <p>You can use IAM
+         * policies to control this action's access to Amazon SWF resources as follows:</p>
+         * <ul> <li>Use a <code>Resource</code> element with the domain name to limit the
+         * action to only specified domains.</li> <li>Use an <code>Action</code> element to
+         * allow or deny permission to call this action.</li> <li>Constrain the
+         * <code>taskList.name</code> parameter by using a <b>Condition</b> element with
+         * the <code>swf:taskList.name</code> key to allow the action to access only
+         * certain task lists.</li> </ul> <p>If the caller does not have sufficient
+         * permissions to invoke the action, or the parameter values fall outside the
+         * specified constraints, the action fails. The associated event attribute's
+         * <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For details and
+         * example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way PollForActivityTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PollForActivityTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::PollForActivityTaskOutcome> PollForActivityTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PollForActivityTaskOutcome>([this, request](const std::function<void(Model::PollForActivityTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PollForActivityTaskAsync(request, [complete](const SWFClient*, const Model::PollForActivityTaskRequest&, const Model::PollForActivityTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PollForActivityTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Used by deciders to get a <a>DecisionTask</a> from the specified decision
          * <code>taskList</code>. A decision task may be returned for any open workflow
@@ -1650,6 +2342,58 @@ namespace Model
          */
         virtual void PollForDecisionTaskAsync(const Model::PollForDecisionTaskRequest& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Used by deciders to get a <a>DecisionTask</a> from the specified decision
+         * <code>taskList</code>. A decision task may be returned for any open workflow
+         * execution that is using the specified task list. The task includes a paginated
+         * view of the history of the workflow execution. The decider should use the
+         * workflow type and the history to determine how to properly handle the task.</p>
+         * <p>This action initiates a long poll, where the service holds the HTTP
+         * connection open and responds as soon a task becomes available. If no decision
+         * task is available in the specified task list before the timeout of 60 seconds
+         * expires, an empty result is returned. An empty result, in this context, means
+         * that a DecisionTask is returned, but that the value of <code>taskToken</code> is
+         * an empty string.</p> <important>Deciders should set their client-side socket
+         * timeout to at least 70 seconds (10 seconds higher than the timeout).</important>
+         * <important>Because the number of workflow history events for a single workflow
+         * execution might be very large, the result returned might be split up across a
+         * number of pages. To retrieve subsequent pages, make additional calls to
+         * <code>PollForDecisionTask</code> using the <code>nextPageToken</code> returned
+         * by the initial call. Note that you do <b>not</b> call
+         * <code>GetWorkflowExecutionHistory</code> with this <code>nextPageToken</code>.
+         * Instead, call <code>PollForDecisionTask</code> again.</important> <p><b>Access
+         * Control</b></p> <p>You can use IAM policies to control this action's access to
+         * Amazon SWF resources as follows:</p> <ul> <li>Use a <code>Resource</code>
+         * element with the domain name to limit the action to only specified domains.</li>
+         * <li>Use an <code>Action</code> element to allow or deny permission to call this
+         * action.</li> <li>Constrain the <code>taskList.name</code> parameter by using a
+         * <b>Condition</b> element with the <code>swf:taskList.name</code> key to allow
+         * the action to access only certain task lists.</li> </ul> <p>If the caller does
+         * not have sufficient permissions to invoke the action, or the parameter values
+         * fall outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way PollForDecisionTaskAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::PollForDecisionTaskRequest>
+        Aws::Utils::Threading::Awaitable<Model::PollForDecisionTaskOutcome> PollForDecisionTaskAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::PollForDecisionTaskOutcome>([this, request](const std::function<void(Model::PollForDecisionTaskOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->PollForDecisionTaskAsync(request, [complete](const SWFClient*, const Model::PollForDecisionTaskRequest&, const Model::PollForDecisionTaskOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::PollForDecisionTaskOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Used by activity workers to report to the service that the
          * <a>ActivityTask</a> represented by the specified <code>taskToken</code> is still
@@ -1777,6 +2521,88 @@ namespace Model
          */
         virtual void RecordActivityTaskHeartbeatAsync(const Model::RecordActivityTaskHeartbeatRequest& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Used by activity workers to report to the service that the
+         * <a>ActivityTask</a> represented by the specified <code>taskToken</code> is still
+         * making progress. The worker can also (optionally) specify details of the
+         * progress, for example percent complete, using the <code>details</code>
+         * parameter. This action can also be used by the worker as a mechanism to check if
+         * cancellation is being requested for the activity task. If a cancellation is
+         * being attempted for the specified task, then the boolean
+         * <code>cancelRequested</code> flag returned by the service is set to
+         * <code>true</code>.</p> <p>This action resets the
+         * <code>taskHeartbeatTimeout</code> clock. The <code>taskHeartbeatTimeout</code>
+         * is specified in <a>RegisterActivityType</a>.</p> <p>This action does not in
+         * itself create an event in the workflow execution history. However, if the task
+         * times out, the workflow execution history will contain a
+         * <code>ActivityTaskTimedOut</code> event that contains the information from the
+         * last heartbeat generated by the activity worker.</p> <note>The
+         * <code>taskStartToCloseTimeout</code> of an activity type is the maximum duration
+         * of an activity task, regardless of the number of
+         * <a>RecordActivityTaskHeartbeat</a> requests received. The
+         * <code>taskStartToCloseTimeout</code> is also specified in
+         * <a>RegisterActivityType</a>.</note> <note>This operation is only useful for
+         * long-lived activities to report liveliness of the task and to determine if a
+         * cancellation is being attempted. </note> <important>If the
+         * <code>cancelRequested</code> flag returns <code>true</code>, a cancellation is
+         * being attempted. If the worker can cancel the activity, it should respond with
+         * <a>RespondActivityTaskCanceled</a>. Otherwise, it should ignore the cancellation
+         * request.</important> <p><b>Access Control</b></p> <p>You can use IAM policies to
+         * control this action's access to Amazon SWF resources as follows:</p> <ul>
+         * <li>Use a <code>Resource</code> element with the domain name to limit the action
+         * to only specified domains.</li> <li>Use an <code>Action</code> element to allow
+         * or deny permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RecordActivityTaskHeartbeatAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RecordActivityTaskHeartbeatRequest>
+        Aws::Utils::Threading::Awaitable<Model::RecordActivityTaskHeartbeatOutcome> RecordActivityTaskHeartbeatAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RecordActivityTaskHeartbeatOutcome>([this, request](const std::function<void(Model::RecordActivityTaskHeartbeatOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RecordActivityTaskHeartbeatAsync(request, [complete](const SWFClient*, const Model::RecordActivityTaskHeartbeatRequest&, const Model::RecordActivityTaskHeartbeatOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RecordActivityTaskHeartbeatOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
+        /**
+         * <p>Registers a new <i>activity type</i> along with its configuration settings in
+         * the specified domain.</p> <important>A <code>TypeAlreadyExists</code> fault is
+         * returned if the type already exists in the domain. You cannot change any
+         * configuration settings of the type after its registration, and it must be
+         * registered as a new version.</important> <p><b>Access Control</b></p> <p>You can
+         * use IAM policies to control this action's access to Amazon SWF resources as
+         * follows:</p> <ul> <li>Use a <code>Resource</code> element with the domain name
+         * to limit the action to only specified domains.</li> <li>Use an
+         * <code>Action</code> element to allow or deny permission to call this
+         * action.</li> <li>Constrain the following parameters by using a
+         * <code>Condition</code> element with the appropriate keys. <ul> <li>
+         * <code>defaultTaskList.name</code>: String constraint. The key is
+         * <code>swf:defaultTaskList.name</code>.</li> <li> <code>name</code>: String
+         * constraint. The key is <code>swf:name</code>.</li> <li> <code>version</code>:
+         * String constraint. The key is <code>swf:version</code>.</li> </ul> </li> </ul>
+         * <p>If the caller does not have sufficient permissions to invoke the action, or
+         * the parameter values fall outside the specified constraints, the action fails.
+         * The associated event attribute's <b>cause</b> parameter will be set to
+         * OPERATION_NOT_PERMITTED. For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         */
+        virtual Model::RegisterActivityTypeOutcome RegisterActivityType(const Model::RegisterActivityTypeRequest& request) const;
+
         /**
          * <p>Registers a new <i>activity type</i> along with its configuration settings in
          * the specified domain.</p> <important>A <code>TypeAlreadyExists</code> fault is
@@ -1799,8 +2625,10 @@ namespace Model
          * OPERATION_NOT_PERMITTED. For details and example IAM policies, see <a
          * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
          * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * returns a future to the operation so that it can be executed in parallel to other requests.
          */
-        virtual Model::RegisterActivityTypeOutcome RegisterActivityType(const Model::RegisterActivityTypeRequest& request) const;
+        virtual Model::RegisterActivityTypeOutcomeCallable RegisterActivityTypeCallable(const Model::RegisterActivityTypeRequest& request) const;
 
         /**
          * <p>Registers a new <i>activity type</i> along with its configuration settings in
@@ -1825,10 +2653,11 @@ namespace Model
          * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
          * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
          *
-         * returns a future to the operation so that it can be executed in parallel to other requests.
+         * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
-        virtual Model::RegisterActivityTypeOutcomeCallable RegisterActivityTypeCallable(const Model::RegisterActivityTypeRequest& request) const;
+        virtual void RegisterActivityTypeAsync(const Model::RegisterActivityTypeRequest& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
          * <p>Registers a new <i>activity type</i> along with its configuration settings in
          * the specified domain.</p> <important>A <code>TypeAlreadyExists</code> fault is
@@ -1852,9 +2681,22 @@ namespace Model
          * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
          * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
          *
-         * Queues the request into a thread executor and triggers associated callback when operation has finished.
-         */
-        virtual void RegisterActivityTypeAsync(const Model::RegisterActivityTypeRequest& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+         * Returns an awaitable that starts the operation the way RegisterActivityTypeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterActivityTypeRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterActivityTypeOutcome> RegisterActivityTypeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterActivityTypeOutcome>([this, request](const std::function<void(Model::RegisterActivityTypeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterActivityTypeAsync(request, [complete](const SWFClient*, const Model::RegisterActivityTypeRequest&, const Model::RegisterActivityTypeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterActivityTypeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Registers a new domain.</p> <p><b>Access Control</b></p> <p>You can use IAM
@@ -1911,6 +2753,39 @@ namespace Model
          */
         virtual void RegisterDomainAsync(const Model::RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers a new domain.</p> <p><b>Access Control</b></p> <p>You can use IAM
+         * policies to control this action's access to Amazon SWF resources as follows:</p>
+         * <ul> <li>You cannot use an IAM policy to control domain access for this action.
+         * The name of the domain being registered is available as the resource of this
+         * action.</li> <li>Use an <code>Action</code> element to allow or deny permission
+         * to call this action.</li> <li>You cannot use an IAM policy to constrain this
+         * action's parameters.</li> </ul> <p>If the caller does not have sufficient
+         * permissions to invoke the action, or the parameter values fall outside the
+         * specified constraints, the action fails. The associated event attribute's
+         * <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For details and
+         * example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterDomainAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterDomainRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterDomainOutcome> RegisterDomainAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterDomainOutcome>([this, request](const std::function<void(Model::RegisterDomainOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterDomainAsync(request, [complete](const SWFClient*, const Model::RegisterDomainRequest&, const Model::RegisterDomainOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterDomainOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Registers a new <i>workflow type</i> and its configuration settings in the
          * specified domain.</p> <p>The retention period for the workflow history is set by
@@ -1993,6 +2868,48 @@ namespace Model
          */
         virtual void RegisterWorkflowTypeAsync(const Model::RegisterWorkflowTypeRequest& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Registers a new <i>workflow type</i> and its configuration settings in the
+         * specified domain.</p> <p>The retention period for the workflow history is set by
+         * the <a>RegisterDomain</a> action.</p> <important>If the type already exists,
+         * then a <code>TypeAlreadyExists</code> fault is returned. You cannot change the
+         * configuration settings of a workflow type once it is registered and it must be
+         * registered as a new version.</important> <p><b>Access Control</b></p> <p>You can
+         * use IAM policies to control this action's access to Amazon SWF resources as
+         * follows:</p> <ul> <li>Use a <code>Resource</code> element with the domain name
+         * to limit the action to only specified domains.</li> <li>Use an
+         * <code>Action</code> element to allow or deny permission to call this
+         * action.</li> <li>Constrain the following parameters by using a
+         * <code>Condition</code> element with the appropriate keys. <ul> <li>
+         * <code>defaultTaskList.name</code>: String constraint. The key is
+         * <code>swf:defaultTaskList.name</code>.</li> <li> <code>name</code>: String
+         * constraint. The key is <code>swf:name</code>.</li> <li> <code>version</code>:
+         * String constraint. The key is <code>swf:version</code>.</li> </ul> </li> </ul>
+         * <p>If the caller does not have sufficient permissions to invoke the action, or
+         * the parameter values fall outside the specified constraints, the action fails.
+         * The associated event attribute's <b>cause</b> parameter will be set to
+         * OPERATION_NOT_PERMITTED. For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RegisterWorkflowTypeAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RegisterWorkflowTypeRequest>
+        Aws::Utils::Threading::Awaitable<Model::RegisterWorkflowTypeOutcome> RegisterWorkflowTypeAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RegisterWorkflowTypeOutcome>([this, request](const std::function<void(Model::RegisterWorkflowTypeOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RegisterWorkflowTypeAsync(request, [complete](const SWFClient*, const Model::RegisterWorkflowTypeRequest&, const Model::RegisterWorkflowTypeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RegisterWorkflowTypeOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Records a <code>WorkflowExecutionCancelRequested</code> event in the
          * currently running workflow execution identified by the given domain, workflowId,
@@ -2075,6 +2992,48 @@ namespace Model
          */
         virtual void RequestCancelWorkflowExecutionAsync(const Model::RequestCancelWorkflowExecutionRequest& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Records a <code>WorkflowExecutionCancelRequested</code> event in the
+         * currently running workflow execution identified by the given domain, workflowId,
+         * and runId. This logically requests the cancellation of the workflow execution as
+         * a whole. It is up to the decider to take appropriate actions when it receives an
+         * execution history with this event.</p> <note>If the runId is not specified, the
+         * <code>WorkflowExecutionCancelRequested</code> event is recorded in the history
+         * of the current open workflow execution with the specified workflowId in the
+         * domain.</note> <note>Because this action allows the workflow to properly clean
+         * up and gracefully close, it should be used instead of
+         * <a>TerminateWorkflowExecution</a> when possible.</note> <p><b>Access
+         * Control</b></p> <p>You can use IAM policies to control this action's access to
+         * Amazon SWF resources as follows:</p> <ul> <li>Use a <code>Resource</code>
+         * element with the domain name to limit the action to only specified domains.</li>
+         * <li>Use an <code>Action</code> element to allow or deny permission to call this
+         * action.</li> <li>You cannot use an IAM policy to constrain this action's
+         * parameters.</li> </ul> <p>If the caller does not have sufficient permissions to
+         * invoke the action, or the parameter values fall outside the specified
+         * constraints, the action fails. The associated event attribute's <b>cause</b>
+         * parameter will be set to OPERATION_NOT_PERMITTED. For details and example IAM
+         * policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RequestCancelWorkflowExecutionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RequestCancelWorkflowExecutionRequest>
+        Aws::Utils::Threading::Awaitable<Model::RequestCancelWorkflowExecutionOutcome> RequestCancelWorkflowExecutionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RequestCancelWorkflowExecutionOutcome>([this, request](const std::function<void(Model::RequestCancelWorkflowExecutionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RequestCancelWorkflowExecutionAsync(request, [complete](const SWFClient*, const Model::RequestCancelWorkflowExecutionRequest&, const Model::RequestCancelWorkflowExecutionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RequestCancelWorkflowExecutionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> was successfully canceled. Additional
@@ -2169,6 +3128,52 @@ namespace Model
          */
         virtual void RespondActivityTaskCanceledAsync(const Model::RespondActivityTaskCanceledRequest& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
+         * by the <code>taskToken</code> was successfully canceled. Additional
+         * <code>details</code> can be optionally provided using the <code>details</code>
+         * argument.</p> <p>These <code>details</code> (if provided) appear in the
+         * <code>ActivityTaskCanceled</code> event added to the workflow history.</p>
+         * <important>Only use this operation if the <code>canceled</code> flag of a
+         * <a>RecordActivityTaskHeartbeat</a> request returns <code>true</code> and if the
+         * activity can be safely undone or abandoned.</important> <p>A task is considered
+         * open from the time that it is scheduled until it is closed. Therefore a task is
+         * reported as open while a worker is processing it. A task is closed after it has
+         * been specified in a call to <a>RespondActivityTaskCompleted</a>,
+         * RespondActivityTaskCanceled, <a>RespondActivityTaskFailed</a>, or the task has
+         * <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dg-basic.html#swf-dev-timeout-types">timed
+         * out</a>.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to control
+         * this action's access to Amazon SWF resources as follows:</p> <ul> <li>Use a
+         * <code>Resource</code> element with the domain name to limit the action to only
+         * specified domains.</li> <li>Use an <code>Action</code> element to allow or deny
+         * permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RespondActivityTaskCanceledAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RespondActivityTaskCanceledRequest>
+        Aws::Utils::Threading::Awaitable<Model::RespondActivityTaskCanceledOutcome> RespondActivityTaskCanceledAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RespondActivityTaskCanceledOutcome>([this, request](const std::function<void(Model::RespondActivityTaskCanceledOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RespondActivityTaskCanceledAsync(request, [complete](const SWFClient*, const Model::RespondActivityTaskCanceledRequest&, const Model::RespondActivityTaskCanceledOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RespondActivityTaskCanceledOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> completed successfully with a <code>result</code>
@@ -2266,6 +3271,53 @@ namespace Model
          */
         virtual void RespondActivityTaskCompletedAsync(const Model::RespondActivityTaskCompletedRequest& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
+         * by the <code>taskToken</code> completed successfully with a <code>result</code>
+         * (if provided). The <code>result</code> appears in the
+         * <code>ActivityTaskCompleted</code> event in the workflow history.</p>
+         * <important> If the requested task does not complete successfully, use
+         * <a>RespondActivityTaskFailed</a> instead. If the worker finds that the task is
+         * canceled through the <code>canceled</code> flag returned by
+         * <a>RecordActivityTaskHeartbeat</a>, it should cancel the task, clean up and then
+         * call <a>RespondActivityTaskCanceled</a>.</important> <p>A task is considered
+         * open from the time that it is scheduled until it is closed. Therefore a task is
+         * reported as open while a worker is processing it. A task is closed after it has
+         * been specified in a call to RespondActivityTaskCompleted,
+         * <a>RespondActivityTaskCanceled</a>, <a>RespondActivityTaskFailed</a>, or the
+         * task has <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dg-basic.html#swf-dev-timeout-types">timed
+         * out</a>.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to control
+         * this action's access to Amazon SWF resources as follows:</p> <ul> <li>Use a
+         * <code>Resource</code> element with the domain name to limit the action to only
+         * specified domains.</li> <li>Use an <code>Action</code> element to allow or deny
+         * permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RespondActivityTaskCompletedAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RespondActivityTaskCompletedRequest>
+        Aws::Utils::Threading::Awaitable<Model::RespondActivityTaskCompletedOutcome> RespondActivityTaskCompletedAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RespondActivityTaskCompletedOutcome>([this, request](const std::function<void(Model::RespondActivityTaskCompletedOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RespondActivityTaskCompletedAsync(request, [complete](const SWFClient*, const Model::RespondActivityTaskCompletedRequest&, const Model::RespondActivityTaskCompletedOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RespondActivityTaskCompletedOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> has failed with <code>reason</code> (if
@@ -2348,6 +3400,48 @@ namespace Model
          */
         virtual void RespondActivityTaskFailedAsync(const Model::RespondActivityTaskFailedRequest& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
+         * by the <code>taskToken</code> has failed with <code>reason</code> (if
+         * specified). The <code>reason</code> and <code>details</code> appear in the
+         * <code>ActivityTaskFailed</code> event added to the workflow history.</p> <p>A
+         * task is considered open from the time that it is scheduled until it is closed.
+         * Therefore a task is reported as open while a worker is processing it. A task is
+         * closed after it has been specified in a call to
+         * <a>RespondActivityTaskCompleted</a>, <a>RespondActivityTaskCanceled</a>,
+         * RespondActivityTaskFailed, or the task has <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dg-basic.html#swf-dev-timeout-types">timed
+         * out</a>.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to control
+         * this action's access to Amazon SWF resources as follows:</p> <ul> <li>Use a
+         * <code>Resource</code> element with the domain name to limit the action to only
+         * specified domains.</li> <li>Use an <code>Action</code> element to allow or deny
+         * permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RespondActivityTaskFailedAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RespondActivityTaskFailedRequest>
+        Aws::Utils::Threading::Awaitable<Model::RespondActivityTaskFailedOutcome> RespondActivityTaskFailedAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RespondActivityTaskFailedOutcome>([this, request](const std::function<void(Model::RespondActivityTaskFailedOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RespondActivityTaskFailedAsync(request, [complete](const SWFClient*, const Model::RespondActivityTaskFailedRequest&, const Model::RespondActivityTaskFailedOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RespondActivityTaskFailedOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Used by deciders to tell the service that the <a>DecisionTask</a> identified
          * by the <code>taskToken</code> has successfully completed. The
@@ -2409,6 +3503,41 @@ namespace Model
          */
         virtual void RespondDecisionTaskCompletedAsync(const Model::RespondDecisionTaskCompletedRequest& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Used by deciders to tell the service that the <a>DecisionTask</a> identified
+         * by the <code>taskToken</code> has successfully completed. The
+         * <code>decisions</code> argument specifies the list of decisions made while
+         * processing the task.</p> <p>A <code>DecisionTaskCompleted</code> event is added
+         * to the workflow history. The <code>executionContext</code> specified is attached
+         * to the event in the workflow execution history.</p> <p><b>Access Control</b></p>
+         * <p>If an IAM policy grants permission to use
+         * <code>RespondDecisionTaskCompleted</code>, it can express permissions for the
+         * list of decisions in the <code>decisions</code> parameter. Each of the decisions
+         * has one or more parameters, much like a regular API call. To allow for policies
+         * to be as readable as possible, you can express permissions on decisions as if
+         * they were actual API calls, including applying conditions to some parameters.
+         * For more information, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way RespondDecisionTaskCompletedAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RespondDecisionTaskCompletedRequest>
+        Aws::Utils::Threading::Awaitable<Model::RespondDecisionTaskCompletedOutcome> RespondDecisionTaskCompletedAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RespondDecisionTaskCompletedOutcome>([this, request](const std::function<void(Model::RespondDecisionTaskCompletedOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RespondDecisionTaskCompletedAsync(request, [complete](const SWFClient*, const Model::RespondDecisionTaskCompletedRequest&, const Model::RespondDecisionTaskCompletedOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RespondDecisionTaskCompletedOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Records a <code>WorkflowExecutionSignaled</code> event in the workflow
          * execution history and creates a decision task for the workflow execution
@@ -2485,6 +3614,46 @@ namespace Model
          */
         virtual void SignalWorkflowExecutionAsync(const Model::SignalWorkflowExecutionRequest& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Records a <code>WorkflowExecutionSignaled</code> event in the workflow
+         * execution history and creates a decision task for the workflow execution
+         * identified by the given domain, workflowId and runId. The event is recorded with
+         * the specified user defined signalName and input (if provided).</p> <note> If a
+         * runId is not specified, then the <code>WorkflowExecutionSignaled</code> event is
+         * recorded in the history of the current open workflow with the matching
+         * workflowId in the domain.</note> <note> If the specified workflow execution is
+         * not open, this method fails with <code>UnknownResource</code>.</note>
+         * <p><b>Access Control</b></p> <p>You can use IAM policies to control this
+         * action's access to Amazon SWF resources as follows:</p> <ul> <li>Use a
+         * <code>Resource</code> element with the domain name to limit the action to only
+         * specified domains.</li> <li>Use an <code>Action</code> element to allow or deny
+         * permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way SignalWorkflowExecutionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::SignalWorkflowExecutionRequest>
+        Aws::Utils::Threading::Awaitable<Model::SignalWorkflowExecutionOutcome> SignalWorkflowExecutionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::SignalWorkflowExecutionOutcome>([this, request](const std::function<void(Model::SignalWorkflowExecutionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->SignalWorkflowExecutionAsync(request, [complete](const SWFClient*, const Model::SignalWorkflowExecutionRequest&, const Model::SignalWorkflowExecutionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::SignalWorkflowExecutionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Starts an execution of the workflow type in the specified domain using the
          * provided <code>workflowId</code> and input data.</p> <p>This action returns the
@@ -2582,6 +3751,53 @@ namespace Model
          */
         virtual void StartWorkflowExecutionAsync(const Model::StartWorkflowExecutionRequest& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Starts an execution of the workflow type in the specified domain using the
+         * provided <code>workflowId</code> and input data.</p> <p>This action returns the
+         * newly started workflow execution.</p> <p><b>Access Control</b></p> <p>You can
+         * use IAM policies to control this action's access to Amazon SWF resources as
+         * follows:</p> <ul> <li>Use a <code>Resource</code> element with the domain name
+         * to limit the action to only specified domains.</li> <li>Use an
+         * <code>Action</code> element to allow or deny permission to call this
+         * action.</li> <li>Constrain the following parameters by using a
+         * <code>Condition</code> element with the appropriate keys. <ul> <li>
+         * <code>tagList.member.0</code>: The key is
+         * <code>swf:tagList.member.0</code>.</li> <li> <code>tagList.member.1</code>: The
+         * key is <code>swf:tagList.member.1</code>.</li> <li>
+         * <code>tagList.member.2</code>: The key is
+         * <code>swf:tagList.member.2</code>.</li> <li> <code>tagList.member.3</code>: The
+         * key is <code>swf:tagList.member.3</code>.</li> <li>
+         * <code>tagList.member.4</code>: The key is
+         * <code>swf:tagList.member.4</code>.</li> <li><code>taskList</code>: String
+         * constraint. The key is <code>swf:taskList.name</code>.</li>
+         * <li><code>workflowType.name</code>: String constraint. The key is
+         * <code>swf:workflowType.name</code>.</li> <li><code>workflowType.version</code>:
+         * String constraint. The key is <code>swf:workflowType.version</code>.</li> </ul>
+         * </li> </ul> <p>If the caller does not have sufficient permissions to invoke the
+         * action, or the parameter values fall outside the specified constraints, the
+         * action fails. The associated event attribute's <b>cause</b> parameter will be
+         * set to OPERATION_NOT_PERMITTED. For details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way StartWorkflowExecutionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::StartWorkflowExecutionRequest>
+        Aws::Utils::Threading::Awaitable<Model::StartWorkflowExecutionOutcome> StartWorkflowExecutionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::StartWorkflowExecutionOutcome>([this, request](const std::function<void(Model::StartWorkflowExecutionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->StartWorkflowExecutionAsync(request, [complete](const SWFClient*, const Model::StartWorkflowExecutionRequest&, const Model::StartWorkflowExecutionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::StartWorkflowExecutionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Records a <code>WorkflowExecutionTerminated</code> event and forces closure
          * of the workflow execution identified by the given domain, runId, and workflowId.
@@ -2667,6 +3883,49 @@ namespace Model
          */
         virtual void TerminateWorkflowExecutionAsync(const Model::TerminateWorkflowExecutionRequest& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Records a <code>WorkflowExecutionTerminated</code> event and forces closure
+         * of the workflow execution identified by the given domain, runId, and workflowId.
+         * The child policy, registered with the workflow type or specified when starting
+         * this execution, is applied to any open child workflow executions of this
+         * workflow execution.</p> <important> If the identified workflow execution was in
+         * progress, it is terminated immediately.</important> <note> If a runId is not
+         * specified, then the <code>WorkflowExecutionTerminated</code> event is recorded
+         * in the history of the current open workflow with the matching workflowId in the
+         * domain.</note> <note> You should consider using
+         * <a>RequestCancelWorkflowExecution</a> action instead because it allows the
+         * workflow to gracefully close while <a>TerminateWorkflowExecution</a> does
+         * not.</note> <p><b>Access Control</b></p> <p>You can use IAM policies to control
+         * this action's access to Amazon SWF resources as follows:</p> <ul> <li>Use a
+         * <code>Resource</code> element with the domain name to limit the action to only
+         * specified domains.</li> <li>Use an <code>Action</code> element to allow or deny
+         * permission to call this action.</li> <li>You cannot use an IAM policy to
+         * constrain this action's parameters.</li> </ul> <p>If the caller does not have
+         * sufficient permissions to invoke the action, or the parameter values fall
+         * outside the specified constraints, the action fails. The associated event
+         * attribute's <b>cause</b> parameter will be set to OPERATION_NOT_PERMITTED. For
+         * details and example IAM policies, see <a
+         * href="http://docs.aws.amazon.com/amazonswf/latest/developerguide/swf-dev-iam.html">Using
+         * IAM to Manage Access to Amazon SWF Workflows</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way TerminateWorkflowExecutionAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TerminateWorkflowExecutionRequest>
+        Aws::Utils::Threading::Awaitable<Model::TerminateWorkflowExecutionOutcome> TerminateWorkflowExecutionAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TerminateWorkflowExecutionOutcome>([this, request](const std::function<void(Model::TerminateWorkflowExecutionOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TerminateWorkflowExecutionAsync(request, [complete](const SWFClient*, const Model::TerminateWorkflowExecutionRequest&, const Model::TerminateWorkflowExecutionOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TerminateWorkflowExecutionOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -152,7 +152,7 @@ private:
     // TransferClient uses these calls
     bool ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffer);
  
-    uint64_t ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, std::shared_ptr<Aws::IOStream>& streamBuf, uint32_t& partNum);
+    uint64_t ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, uint32_t& partNum);
 
     void AddCompletedPart(PartRequestRecord& partRequest, const Aws::String& eTag);
     void CompleteUpload();
@@ -224,7 +224,7 @@ private:
 
     // Uploads 5mb or less need to perform a single put call - attempting to do a multi part upload with these small 
     // files can cause failures in S3
-    bool DoSingleObjectUpload(std::shared_ptr<Aws::IOStream>& streamBuf, uint64_t bytesRead);
+    bool DoSingleObjectUpload(std::shared_ptr<Aws::IOStream>& streamBuf, const unsigned char* data, uint64_t bytesRead);
     
     void SendPutObjectRequest(const Aws::S3::Model::PutObjectRequest& request);
 
@@ -33,6 +33,9 @@
 #include <aws/s3/model/CompleteMultipartUploadRequest.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/MultiHash.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 
 #include <algorithm>
 
@@ -51,6 +54,27 @@ static const uint32_t PART_RETRY_MAX = 2; // How many failures on a single part
 
 static const uint32_t CONSISTENCY_RETRY_MAX = 20; // If we're checking for consistency in S3 we may need to perform HeadObject, GetObject, and ListObjects checks several times to ensure the object has propagated
 
+// Sets Content-MD5 and hands the signer the body's sha256, computing both in one pass over the body instead of one pass each.  Returns the md5.
+template<typename REQUEST>
+static ByteBuffer SetBodyDigests(REQUEST& request, const unsigned char* data, std::size_t length)
+{
+    Aws::Utils::Crypto::MultiHash multiHash(Aws::Utils::Crypto::MultiHash::MD5_ALGORITHM | Aws::Utils::Crypto::MultiHash::SHA256_ALGORITHM);
+    if (!multiHash.IsValid())
+    {
+        ByteBuffer md5 = HashingUtils::CalculateMD5(*request.GetBody());
+        request.SetContentMD5(HashingUtils::Base64Encode(md5));
+        return md5;
+    }
+
+    multiHash.Update(data, length);
+    multiHash.Finish();
+
+    ByteBuffer md5 = multiHash.GetMD5().GetResult();
+    request.SetContentMD5(HashingUtils::Base64Encode(md5));
+    request.SetPayloadSha256(multiHash.GetSha256().GetResult());
+    return md5;
+}
+
 UploadFileRequest::UploadFileRequest(const Aws::String& fileName, 
                                      const Aws::String& bucketName, 
                                      const Aws::String& keyName, 
@@ -480,10 +504,8 @@ void UploadFileRequest::CreateStreamBuffer(std::shared_ptr<Aws::IOStream>& strea
     streamBuf->seekg(0);
 }
 
-uint64_t UploadFileRequest::ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, std::shared_ptr<Aws::IOStream>& streamBuf, uint32_t& partNum)
+uint64_t UploadFileRequest::ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, uint32_t& partNum)
 {
-    // This whole call is a WIP.  Big comment below, but yeah, this has to become much simpler and more efficient.
-
     uint64_t bytesRead = 0;
     {
         std::lock_guard<std::mutex> someLock(m_fileRequestMutex);
@@ -507,15 +529,6 @@ uint64_t UploadFileRequest::ReadNextPart(const std::shared_ptr<UploadBuffer>& bu
         }
     }
 
-    // This is not ideal!  You're thinking "Wait, we got this buffer up there and now we're making a copy anyway.." You are right!
-    // This needs to be done in a better way.  pubsetbuf it turns out does not work as I'd hoped.  The buffer is still essentially acting a shared
-    // resource throttle, albeit double what is intended currently with the stream copy happening.  
-    // S3Client could be made to accept a buffer.. I'm thinking we're not doing that either.
-    // At this point this is considered a not horrible solution but one we'd like to try to revisit  
-    streamBuf->write((char*)buffer->GetUnderlyingData(), bytesRead);
-
-    streamBuf->seekg(0);
-
     return bytesRead;
 }
 
@@ -527,9 +540,8 @@ bool UploadFileRequest::ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffe
         return false;
     }
 
-    std::shared_ptr<Aws::IOStream> streamBuf = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
     uint32_t partNum = 0;
-    uint64_t bytesRead = ReadNextPart(buffer, streamBuf, partNum);
+    uint64_t bytesRead = ReadNextPart(buffer, partNum);
 
     if (!bytesRead)
     {
@@ -538,9 +550,17 @@ bool UploadFileRequest::ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffe
 
     if (IsSinglePartUpload())
     {
+        // Nothing holds on to the buffer once we return, so the single object upload gets its own copy
+        std::shared_ptr<Aws::IOStream> streamBuf = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        streamBuf->write((char*)buffer->GetUnderlyingData(), bytesRead);
+        streamBuf->seekg(0);
+
         // Don't need more than one part, do everything now
-        return DoSingleObjectUpload(streamBuf, bytesRead);
+        return DoSingleObjectUpload(streamBuf, buffer->GetUnderlyingData(), bytesRead);
     }
+
+    // The pending part record keeps the buffer from being reused until the part is done, so the body can be sent straight out of it
+    std::shared_ptr<Aws::IOStream> streamBuf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedIOStream>(ALLOCATION_TAG, buffer->GetUnderlyingData(), static_cast<std::size_t>(bytesRead));
     PartRequestRecord thisRequest(buffer);
 
     thisRequest.m_partRequest.SetBucket(GetBucketName());
@@ -548,8 +568,7 @@ bool UploadFileRequest::ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffe
     thisRequest.m_partRequest.SetPartNumber(partNum);
     thisRequest.m_partRequest.SetUploadId(GetUploadId());
     thisRequest.m_partRequest.SetBody(streamBuf);
-    thisRequest.m_partMd5 = HashingUtils::CalculateMD5(*streamBuf);
-    thisRequest.m_partRequest.SetContentMD5(HashingUtils::Base64Encode(thisRequest.m_partMd5));
+    thisRequest.m_partMd5 = SetBodyDigests(thisRequest.m_partRequest, buffer->GetUnderlyingData(), static_cast<std::size_t>(bytesRead));
     thisRequest.m_partRequest.SetContentLength(static_cast<long>(bytesRead));
 
     thisRequest.m_partRequest.SetDataSentEventHandler(std::bind(&UploadFileRequest::OnDataSent, this, std::placeholders::_1, std::placeholders::_2));
@@ -792,14 +811,14 @@ bool UploadFileRequest::IsUsingBuffer(const std::shared_ptr<UploadBuffer>& buffe
     return (result != m_pendingParts.end());
 }
 
-bool UploadFileRequest::DoSingleObjectUpload(std::shared_ptr<Aws::IOStream>& streamBuf, uint64_t bytesRead) 
+bool UploadFileRequest::DoSingleObjectUpload(std::shared_ptr<Aws::IOStream>& streamBuf, const unsigned char* data, uint64_t bytesRead) 
 {
     PutObjectRequest putObjectRequest;
     putObjectRequest.SetBucket(GetBucketName());
 
     putObjectRequest.SetBody(streamBuf);
     putObjectRequest.SetContentLength(static_cast<long>(bytesRead));
-    putObjectRequest.SetContentMD5(HashingUtils::Base64Encode(HashingUtils::CalculateMD5(*putObjectRequest.GetBody())));
+    SetBodyDigests(putObjectRequest, data, static_cast<std::size_t>(bytesRead));
     if (m_contentType.length())
     {
         putObjectRequest.SetContentType(m_contentType);
@@ -833,7 +852,7 @@ bool UploadFileRequest::HandlePutObjectOutcome(const Aws::S3::Model::PutObjectRe
 {
     //verify md5 sums between what was sent and what s3 told us they received.
     Aws::StringStream ss;
-    ss << "\"" << HashingUtils::HexEncode(HashingUtils::CalculateMD5(*request.GetBody())) << "\"";
+    ss << "\"" << HashingUtils::HexEncode(HashingUtils::Base64Decode(request.GetContentMD5())) << "\"";
 
     if (outcome.IsSuccess() && (ss.str() == outcome.GetResult().GetETag()))
     {
@@ -54,6 +54,7 @@
 #include <aws/waf/model/UpdateSqlInjectionMatchSetResult.h>
 #include <aws/waf/model/UpdateWebACLResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -348,6 +349,46 @@ namespace Model
          */
         virtual void CreateByteMatchSetAsync(const Model::CreateByteMatchSetRequest& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a <code>ByteMatchSet</code>. You then use <a>UpdateByteMatchSet</a>
+         * to identify the part of a web request that you want AWS WAF to inspect, such as
+         * the values of the <code>User-Agent</code> header or the query string. For
+         * example, you can create a <code>ByteMatchSet</code> that matches any requests
+         * with <code>User-Agent</code> headers that contain the string
+         * <code>BadBot</code>. You can then configure AWS WAF to reject those
+         * requests.</p> <p>To create and configure a <code>ByteMatchSet</code>, perform
+         * the following steps:</p> <ol> <li>Use <a>GetChangeToken</a> to get the change
+         * token that you provide in the <code>ChangeToken</code> parameter of a
+         * <code>CreateByteMatchSet</code> request.</li> <li>Submit a
+         * <code>CreateByteMatchSet</code> request.</li> <li>Use
+         * <code>GetChangeToken</code> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of an <code>UpdateByteMatchSet</code>
+         * request.</li> <li>Submit an <a>UpdateByteMatchSet</a> request to specify the
+         * part of the request that you want AWS WAF to inspect (for example, the header or
+         * the URI) and the value that you want AWS WAF to watch for.</li> </ol> <p>For
+         * more information about how to use the AWS WAF API to allow or block HTTP
+         * requests, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateByteMatchSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateByteMatchSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateByteMatchSetOutcome> CreateByteMatchSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateByteMatchSetOutcome>([this, request](const std::function<void(Model::CreateByteMatchSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateByteMatchSetAsync(request, [complete](const WAFClient*, const Model::CreateByteMatchSetRequest&, const Model::CreateByteMatchSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateByteMatchSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates an <a>IPSet</a>, which you use to specify which web requests you want
          * to allow or block based on the IP addresses that the requests originate from.
@@ -415,6 +456,43 @@ namespace Model
          */
         virtual void CreateIPSetAsync(const Model::CreateIPSetRequest& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates an <a>IPSet</a>, which you use to specify which web requests you want
+         * to allow or block based on the IP addresses that the requests originate from.
+         * For example, if you're receiving a lot of requests from one or more individual
+         * IP addresses or one or more ranges of IP addresses and you want to block the
+         * requests, you can create an <code>IPSet</code> that contains those IP addresses
+         * and then configure AWS WAF to block the requests. </p> <p>To create and
+         * configure an <code>IPSet</code>, perform the following steps:</p> <ol> <li>Use
+         * <a>GetChangeToken</a> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of a <code>CreateIPSet</code> request.</li>
+         * <li>Submit a <code>CreateIPSet</code> request.</li> <li>Use
+         * <code>GetChangeToken</code> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of an <a>UpdateIPSet</a> request.</li>
+         * <li>Submit an <code>UpdateIPSet</code> request to specify the IP addresses that
+         * you want AWS WAF to watch for.</li> </ol> <p>For more information about how to
+         * use the AWS WAF API to allow or block HTTP requests, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateIPSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateIPSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateIPSetOutcome> CreateIPSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateIPSetOutcome>([this, request](const std::function<void(Model::CreateIPSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateIPSetAsync(request, [complete](const WAFClient*, const Model::CreateIPSetRequest&, const Model::CreateIPSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateIPSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a <code>Rule</code>, which contains the <code>IPSet</code> objects,
          * <code>ByteMatchSet</code> objects, and other predicates that identify the
@@ -515,6 +593,54 @@ namespace Model
          */
         virtual void CreateRuleAsync(const Model::CreateRuleRequest& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a <code>Rule</code>, which contains the <code>IPSet</code> objects,
+         * <code>ByteMatchSet</code> objects, and other predicates that identify the
+         * requests that you want to block. If you add more than one predicate to a
+         * <code>Rule</code>, a request must match all of the specifications to be allowed
+         * or blocked. For example, suppose you add the following to a
+         * <code>Rule</code>:</p> <ul> <li>An <code>IPSet</code> that matches the IP
+         * address <code>192.0.2.44/32</code></li> <li>A <code>ByteMatchSet</code> that
+         * matches <code>BadBot</code> in the <code>User-Agent</code> header</li> </ul>
+         * <p>You then add the <code>Rule</code> to a <code>WebACL</code> and specify that
+         * you want to blocks requests that satisfy the <code>Rule</code>. For a request to
+         * be blocked, it must come from the IP address 192.0.2.44 <i>and</i> the
+         * <code>User-Agent</code> header in the request must contain the value
+         * <code>BadBot</code>.</p> <p>To create and configure a <code>Rule</code>, perform
+         * the following steps:</p> <ol> <li>Create and update the predicates that you want
+         * to include in the <code>Rule</code>. For more information, see
+         * <a>CreateByteMatchSet</a>, <a>CreateIPSet</a>, and
+         * <a>CreateSqlInjectionMatchSet</a>.</li> <li>Use <a>GetChangeToken</a> to get the
+         * change token that you provide in the <code>ChangeToken</code> parameter of a
+         * <code>CreateRule</code> request.</li> <li>Submit a <code>CreateRule</code>
+         * request.</li> <li>Use <code>GetChangeToken</code> to get the change token that
+         * you provide in the <code>ChangeToken</code> parameter of an <a>UpdateRule</a>
+         * request.</li> <li>Submit an <code>UpdateRule</code> request to specify the
+         * predicates that you want to include in the <code>Rule</code>.</li> <li>Create
+         * and update a <code>WebACL</code> that contains the <code>Rule</code>. For more
+         * information, see <a>CreateWebACL</a>.</li> </ol> <p>For more information about
+         * how to use the AWS WAF API to allow or block HTTP requests, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateRuleOutcome> CreateRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateRuleOutcome>([this, request](const std::function<void(Model::CreateRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateRuleAsync(request, [complete](const WAFClient*, const Model::CreateRuleRequest&, const Model::CreateRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a <code>SizeConstraintSet</code>. You then use
          * <a>UpdateSizeConstraintSet</a> to identify the part of a web request that you
@@ -591,6 +717,46 @@ namespace Model
          */
         virtual void CreateSizeConstraintSetAsync(const Model::CreateSizeConstraintSetRequest& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a <code>SizeConstraintSet</code>. You then use
+         * <a>UpdateSizeConstraintSet</a> to identify the part of a web request that you
+         * want AWS WAF to check for length, such as the length of the
+         * <code>User-Agent</code> header or the length of the query string. For example,
+         * you can create a <code>SizeConstraintSet</code> that matches any requests that
+         * have a query string that is longer than 100 bytes. You can then configure AWS
+         * WAF to reject those requests.</p> <p>To create and configure a
+         * <code>SizeConstraintSet</code>, perform the following steps:</p> <ol> <li>Use
+         * <a>GetChangeToken</a> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of a <code>CreateSizeConstraintSet</code>
+         * request.</li> <li>Submit a <code>CreateSizeConstraintSet</code> request.</li>
+         * <li>Use <code>GetChangeToken</code> to get the change token that you provide in
+         * the <code>ChangeToken</code> parameter of an
+         * <code>UpdateSizeConstraintSet</code> request.</li> <li>Submit an
+         * <a>UpdateSizeConstraintSet</a> request to specify the part of the request that
+         * you want AWS WAF to inspect (for example, the header or the URI) and the value
+         * that you want AWS WAF to watch for.</li> </ol> <p>For more information about how
+         * to use the AWS WAF API to allow or block HTTP requests, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateSizeConstraintSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSizeConstraintSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSizeConstraintSetOutcome> CreateSizeConstraintSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSizeConstraintSetOutcome>([this, request](const std::function<void(Model::CreateSizeConstraintSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSizeConstraintSetAsync(request, [complete](const WAFClient*, const Model::CreateSizeConstraintSetRequest&, const Model::CreateSizeConstraintSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSizeConstraintSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a <a>SqlInjectionMatchSet</a>, which you use to allow, block, or
          * count requests that contain snippets of SQL code in a specified part of web
@@ -655,6 +821,42 @@ namespace Model
          */
         virtual void CreateSqlInjectionMatchSetAsync(const Model::CreateSqlInjectionMatchSetRequest& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a <a>SqlInjectionMatchSet</a>, which you use to allow, block, or
+         * count requests that contain snippets of SQL code in a specified part of web
+         * requests. AWS WAF searches for character sequences that are likely to be
+         * malicious strings.</p> <p>To create and configure a
+         * <code>SqlInjectionMatchSet</code>, perform the following steps:</p> <ol> <li>Use
+         * <a>GetChangeToken</a> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of a <code>CreateSqlInjectionMatchSet</code>
+         * request.</li> <li>Submit a <code>CreateSqlInjectionMatchSet</code> request.</li>
+         * <li>Use <code>GetChangeToken</code> to get the change token that you provide in
+         * the <code>ChangeToken</code> parameter of an <a>UpdateSqlInjectionMatchSet</a>
+         * request.</li> <li>Submit an <a>UpdateSqlInjectionMatchSet</a> request to specify
+         * the parts of web requests in which you want to allow, block, or count malicious
+         * SQL code.</li> </ol> <p>For more information about how to use the AWS WAF API to
+         * allow or block HTTP requests, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateSqlInjectionMatchSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateSqlInjectionMatchSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateSqlInjectionMatchSetOutcome> CreateSqlInjectionMatchSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateSqlInjectionMatchSetOutcome>([this, request](const std::function<void(Model::CreateSqlInjectionMatchSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateSqlInjectionMatchSetAsync(request, [complete](const WAFClient*, const Model::CreateSqlInjectionMatchSetRequest&, const Model::CreateSqlInjectionMatchSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateSqlInjectionMatchSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Creates a <code>WebACL</code>, which contains the <code>Rules</code> that
          * identify the CloudFront web requests that you want to allow, block, or count.
@@ -749,6 +951,52 @@ namespace Model
          */
         virtual void CreateWebACLAsync(const Model::CreateWebACLRequest& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates a <code>WebACL</code>, which contains the <code>Rules</code> that
+         * identify the CloudFront web requests that you want to allow, block, or count.
+         * AWS WAF evaluates <code>Rules</code> in order based on the value of
+         * <code>Priority</code> for each <code>Rule</code>.</p> <p>You also specify a
+         * default action, either <code>ALLOW</code> or <code>BLOCK</code>. If a web
+         * request doesn't match any of the <code>Rules</code> in a <code>WebACL</code>,
+         * AWS WAF responds to the request with the default action. </p> <p>To create and
+         * configure a <code>WebACL</code>, perform the following steps:</p> <ol>
+         * <li>Create and update the <code>ByteMatchSet</code> objects and other predicates
+         * that you want to include in <code>Rules</code>. For more information, see
+         * <a>CreateByteMatchSet</a>, <a>UpdateByteMatchSet</a>, <a>CreateIPSet</a>,
+         * <a>UpdateIPSet</a>, <a>CreateSqlInjectionMatchSet</a>, and
+         * <a>UpdateSqlInjectionMatchSet</a>.</li> <li>Create and update the
+         * <code>Rules</code> that you want to include in the <code>WebACL</code>. For more
+         * information, see <a>CreateRule</a> and <a>UpdateRule</a>.</li> <li>Use
+         * <a>GetChangeToken</a> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of a <code>CreateWebACL</code> request.</li>
+         * <li>Submit a <code>CreateWebACL</code> request.</li> <li>Use
+         * <code>GetChangeToken</code> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of an <a>UpdateWebACL</a> request.</li>
+         * <li>Submit an <a>UpdateWebACL</a> request to specify the <code>Rules</code> that
+         * you want to include in the <code>WebACL</code>, to specify the default action,
+         * and to associate the <code>WebACL</code> with a CloudFront distribution.</li>
+         * </ol> <p>For more information about how to use the AWS WAF API, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way CreateWebACLAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateWebACLRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateWebACLOutcome> CreateWebACLAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateWebACLOutcome>([this, request](const std::function<void(Model::CreateWebACLOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateWebACLAsync(request, [complete](const WAFClient*, const Model::CreateWebACLRequest&, const Model::CreateWebACLOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateWebACLOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Permanently deletes a <a>ByteMatchSet</a>. You can't delete a
          * <code>ByteMatchSet</code> if it's still used in any <code>Rules</code> or if it
@@ -798,6 +1046,37 @@ namespace Model
          */
         virtual void DeleteByteMatchSetAsync(const Model::DeleteByteMatchSetRequest& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Permanently deletes a <a>ByteMatchSet</a>. You can't delete a
+         * <code>ByteMatchSet</code> if it's still used in any <code>Rules</code> or if it
+         * still includes any <a>ByteMatchTuple</a> objects (any filters).</p> <p>If you
+         * just want to remove a <code>ByteMatchSet</code> from a <code>Rule</code>, use
+         * <a>UpdateRule</a>.</p> <p>To permanently delete a <code>ByteMatchSet</code>,
+         * perform the following steps:</p> <ol> <li>Update the <code>ByteMatchSet</code>
+         * to remove filters, if any. For more information, see
+         * <a>UpdateByteMatchSet</a>.</li> <li>Use <a>GetChangeToken</a> to get the change
+         * token that you provide in the <code>ChangeToken</code> parameter of a
+         * <code>DeleteByteMatchSet</code> request.</li> <li>Submit a
+         * <code>DeleteByteMatchSet</code> request.</li> </ol>
+         *
+         * Returns an awaitable that starts the operation the way DeleteByteMatchSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteByteMatchSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteByteMatchSetOutcome> DeleteByteMatchSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteByteMatchSetOutcome>([this, request](const std::function<void(Model::DeleteByteMatchSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteByteMatchSetAsync(request, [complete](const WAFClient*, const Model::DeleteByteMatchSetRequest&, const Model::DeleteByteMatchSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteByteMatchSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Permanently deletes an <a>IPSet</a>. You can't delete an <code>IPSet</code>
          * if it's still used in any <code>Rules</code> or if it still includes any IP
@@ -844,6 +1123,36 @@ namespace Model
          */
         virtual void DeleteIPSetAsync(const Model::DeleteIPSetRequest& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Permanently deletes an <a>IPSet</a>. You can't delete an <code>IPSet</code>
+         * if it's still used in any <code>Rules</code> or if it still includes any IP
+         * addresses.</p> <p>If you just want to remove an <code>IPSet</code> from a
+         * <code>Rule</code>, use <a>UpdateRule</a>.</p> <p>To permanently delete an
+         * <code>IPSet</code> from AWS WAF, perform the following steps:</p> <ol>
+         * <li>Update the <code>IPSet</code> to remove IP address ranges, if any. For more
+         * information, see <a>UpdateIPSet</a>.</li> <li>Use <a>GetChangeToken</a> to get
+         * the change token that you provide in the <code>ChangeToken</code> parameter of a
+         * <code>DeleteIPSet</code> request.</li> <li>Submit a <code>DeleteIPSet</code>
+         * request.</li> </ol>
+         *
+         * Returns an awaitable that starts the operation the way DeleteIPSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteIPSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteIPSetOutcome> DeleteIPSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteIPSetOutcome>([this, request](const std::function<void(Model::DeleteIPSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteIPSetAsync(request, [complete](const WAFClient*, const Model::DeleteIPSetRequest&, const Model::DeleteIPSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteIPSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Permanently deletes a <a>Rule</a>. You can't delete a <code>Rule</code> if
          * it's still used in any <code>WebACL</code> objects or if it still includes any
@@ -890,6 +1199,36 @@ namespace Model
          */
         virtual void DeleteRuleAsync(const Model::DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Permanently deletes a <a>Rule</a>. You can't delete a <code>Rule</code> if
+         * it's still used in any <code>WebACL</code> objects or if it still includes any
+         * predicates, such as <code>ByteMatchSet</code> objects.</p> <p>If you just want
+         * to remove a <code>Rule</code> from a <code>WebACL</code>, use
+         * <a>UpdateWebACL</a>.</p> <p>To permanently delete a <code>Rule</code> from AWS
+         * WAF, perform the following steps:</p> <ol> <li>Update the <code>Rule</code> to
+         * remove predicates, if any. For more information, see <a>UpdateRule</a>.</li>
+         * <li>Use <a>GetChangeToken</a> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of a <code>DeleteRule</code> request.</li>
+         * <li>Submit a <code>DeleteRule</code> request.</li> </ol>
+         *
+         * Returns an awaitable that starts the operation the way DeleteRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteRuleOutcome> DeleteRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteRuleOutcome>([this, request](const std::function<void(Model::DeleteRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteRuleAsync(request, [complete](const WAFClient*, const Model::DeleteRuleRequest&, const Model::DeleteRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Permanently deletes a <a>SizeConstraintSet</a>. You can't delete a
          * <code>SizeConstraintSet</code> if it's still used in any <code>Rules</code> or
@@ -942,6 +1281,38 @@ namespace Model
          */
         virtual void DeleteSizeConstraintSetAsync(const Model::DeleteSizeConstraintSetRequest& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Permanently deletes a <a>SizeConstraintSet</a>. You can't delete a
+         * <code>SizeConstraintSet</code> if it's still used in any <code>Rules</code> or
+         * if it still includes any <a>SizeConstraint</a> objects (any filters).</p> <p>If
+         * you just want to remove a <code>SizeConstraintSet</code> from a
+         * <code>Rule</code>, use <a>UpdateRule</a>.</p> <p>To permanently delete a
+         * <code>SizeConstraintSet</code>, perform the following steps:</p> <ol> <li>Update
+         * the <code>SizeConstraintSet</code> to remove filters, if any. For more
+         * information, see <a>UpdateSizeConstraintSet</a>.</li> <li>Use
+         * <a>GetChangeToken</a> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of a <code>DeleteSizeConstraintSet</code>
+         * request.</li> <li>Submit a <code>DeleteSizeConstraintSet</code> request.</li>
+         * </ol>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSizeConstraintSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSizeConstraintSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSizeConstraintSetOutcome> DeleteSizeConstraintSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSizeConstraintSetOutcome>([this, request](const std::function<void(Model::DeleteSizeConstraintSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSizeConstraintSetAsync(request, [complete](const WAFClient*, const Model::DeleteSizeConstraintSetRequest&, const Model::DeleteSizeConstraintSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSizeConstraintSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Permanently deletes a <a>SqlInjectionMatchSet</a>. You can't delete a
          * <code>SqlInjectionMatchSet</code> if it's still used in any <code>Rules</code>
@@ -994,6 +1365,38 @@ namespace Model
          */
         virtual void DeleteSqlInjectionMatchSetAsync(const Model::DeleteSqlInjectionMatchSetRequest& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Permanently deletes a <a>SqlInjectionMatchSet</a>. You can't delete a
+         * <code>SqlInjectionMatchSet</code> if it's still used in any <code>Rules</code>
+         * or if it still contains any <a>SqlInjectionMatchTuple</a> objects.</p> <p>If you
+         * just want to remove a <code>SqlInjectionMatchSet</code> from a
+         * <code>Rule</code>, use <a>UpdateRule</a>.</p> <p>To permanently delete a
+         * <code>SqlInjectionMatchSet</code> from AWS WAF, perform the following steps:</p>
+         * <ol> <li>Update the <code>SqlInjectionMatchSet</code> to remove filters, if any.
+         * For more information, see <a>UpdateSqlInjectionMatchSet</a>.</li> <li>Use
+         * <a>GetChangeToken</a> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of a <code>DeleteSqlInjectionMatchSet</code>
+         * request.</li> <li>Submit a <code>DeleteSqlInjectionMatchSet</code> request.</li>
+         * </ol>
+         *
+         * Returns an awaitable that starts the operation the way DeleteSqlInjectionMatchSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteSqlInjectionMatchSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteSqlInjectionMatchSetOutcome> DeleteSqlInjectionMatchSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteSqlInjectionMatchSetOutcome>([this, request](const std::function<void(Model::DeleteSqlInjectionMatchSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteSqlInjectionMatchSetAsync(request, [complete](const WAFClient*, const Model::DeleteSqlInjectionMatchSetRequest&, const Model::DeleteSqlInjectionMatchSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteSqlInjectionMatchSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Permanently deletes a <a>WebACL</a>. You can't delete a <code>WebACL</code>
          * if it still contains any <code>Rules</code>.</p> <p>To delete a
@@ -1034,6 +1437,34 @@ namespace Model
          */
         virtual void DeleteWebACLAsync(const Model::DeleteWebACLRequest& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Permanently deletes a <a>WebACL</a>. You can't delete a <code>WebACL</code>
+         * if it still contains any <code>Rules</code>.</p> <p>To delete a
+         * <code>WebACL</code>, perform the following steps:</p> <ol> <li>Update the
+         * <code>WebACL</code> to remove <code>Rules</code>, if any. For more information,
+         * see <a>UpdateWebACL</a>.</li> <li>Use <a>GetChangeToken</a> to get the change
+         * token that you provide in the <code>ChangeToken</code> parameter of a
+         * <code>DeleteWebACL</code> request.</li> <li>Submit a <code>DeleteWebACL</code>
+         * request.</li> </ol>
+         *
+         * Returns an awaitable that starts the operation the way DeleteWebACLAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DeleteWebACLRequest>
+        Aws::Utils::Threading::Awaitable<Model::DeleteWebACLOutcome> DeleteWebACLAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DeleteWebACLOutcome>([this, request](const std::function<void(Model::DeleteWebACLOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DeleteWebACLAsync(request, [complete](const WAFClient*, const Model::DeleteWebACLRequest&, const Model::DeleteWebACLOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DeleteWebACLOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the <a>ByteMatchSet</a> specified by <code>ByteMatchSetId</code>.</p>
          */
@@ -1053,6 +1484,27 @@ namespace Model
          */
         virtual void GetByteMatchSetAsync(const Model::GetByteMatchSetRequest& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the <a>ByteMatchSet</a> specified by <code>ByteMatchSetId</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetByteMatchSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetByteMatchSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetByteMatchSetOutcome> GetByteMatchSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetByteMatchSetOutcome>([this, request](const std::function<void(Model::GetByteMatchSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetByteMatchSetAsync(request, [complete](const WAFClient*, const Model::GetByteMatchSetRequest&, const Model::GetByteMatchSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetByteMatchSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>When you want to create, update, or delete AWS WAF objects, get a change
          * token and include the change token in the create, update, or delete request.
@@ -1108,6 +1560,39 @@ namespace Model
          */
         virtual void GetChangeTokenAsync(const Model::GetChangeTokenRequest& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>When you want to create, update, or delete AWS WAF objects, get a change
+         * token and include the change token in the create, update, or delete request.
+         * Change tokens ensure that your application doesn't submit conflicting requests
+         * to AWS WAF.</p> <p>Each create, update, or delete request must use a unique
+         * change token. If your application submits a <code>GetChangeToken</code> request
+         * and then submits a second <code>GetChangeToken</code> request before submitting
+         * a create, update, or delete request, the second <code>GetChangeToken</code>
+         * request returns the same value as the first <code>GetChangeToken</code>
+         * request.</p> <p>When you use a change token in a create, update, or delete
+         * request, the status of the change token changes to <code>PENDING</code>, which
+         * indicates that AWS WAF is propagating the change to all AWS WAF servers. Use
+         * <code>GetChangeTokenStatus</code> to determine the status of your change
+         * token.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetChangeTokenAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetChangeTokenRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetChangeTokenOutcome> GetChangeTokenAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetChangeTokenOutcome>([this, request](const std::function<void(Model::GetChangeTokenOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetChangeTokenAsync(request, [complete](const WAFClient*, const Model::GetChangeTokenRequest&, const Model::GetChangeTokenOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetChangeTokenOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the status of a <code>ChangeToken</code> that you got by calling
          * <a>GetChangeToken</a>. <code>ChangeTokenStatus</code> is one of the following
@@ -1145,6 +1630,33 @@ namespace Model
          */
         virtual void GetChangeTokenStatusAsync(const Model::GetChangeTokenStatusRequest& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the status of a <code>ChangeToken</code> that you got by calling
+         * <a>GetChangeToken</a>. <code>ChangeTokenStatus</code> is one of the following
+         * values:</p> <ul> <li><code>PROVISIONED</code>: You requested the change token by
+         * calling <code>GetChangeToken</code>, but you haven't used it yet in a call to
+         * create, update, or delete an AWS WAF object.</li> <li><code>PENDING</code>: AWS
+         * WAF is propagating the create, update, or delete request to all AWS WAF
+         * servers.</li> <li><code>IN_SYNC</code>: Propagation is complete.</li> </ul>
+         *
+         * Returns an awaitable that starts the operation the way GetChangeTokenStatusAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetChangeTokenStatusRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetChangeTokenStatusOutcome> GetChangeTokenStatusAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetChangeTokenStatusOutcome>([this, request](const std::function<void(Model::GetChangeTokenStatusOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetChangeTokenStatusAsync(request, [complete](const WAFClient*, const Model::GetChangeTokenStatusRequest&, const Model::GetChangeTokenStatusOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetChangeTokenStatusOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the <a>IPSet</a> that is specified by <code>IPSetId</code>.</p>
          */
@@ -1164,6 +1676,27 @@ namespace Model
          */
         virtual void GetIPSetAsync(const Model::GetIPSetRequest& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the <a>IPSet</a> that is specified by <code>IPSetId</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetIPSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetIPSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetIPSetOutcome> GetIPSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetIPSetOutcome>([this, request](const std::function<void(Model::GetIPSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetIPSetAsync(request, [complete](const WAFClient*, const Model::GetIPSetRequest&, const Model::GetIPSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetIPSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the <a>Rule</a> that is specified by the <code>RuleId</code> that you
          * included in the <code>GetRule</code> request.</p>
@@ -1186,6 +1719,42 @@ namespace Model
          */
         virtual void GetRuleAsync(const Model::GetRuleRequest& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the <a>Rule</a> that is specified by the <code>RuleId</code> that you
+         * included in the <code>GetRule</code> request.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetRuleOutcome> GetRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetRuleOutcome>([this, request](const std::function<void(Model::GetRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetRuleAsync(request, [complete](const WAFClient*, const Model::GetRuleRequest&, const Model::GetRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
+        /**
+         * <p>Gets detailed information about a specified number of requests--a
+         * sample--that AWS WAF randomly selects from among the first 5,000 requests that
+         * your AWS resource received during a time range that you choose. You can specify
+         * a sample size of up to 100 requests, and you can specify any time range in the
+         * previous three hours.</p> <p><code>GetSampledRequests</code> returns a time
+         * range, which is usually the time range that you specified. However, if your
+         * resource (such as a CloudFront distribution) received 5,000 requests before the
+         * specified time range elapsed, <code>GetSampledRequests</code> returns an updated
+         * time range. This new time range indicates the actual period during which AWS WAF
+         * selected the requests in the sample.</p>
+         */
+        virtual Model::GetSampledRequestsOutcome GetSampledRequests(const Model::GetSampledRequestsRequest& request) const;
+
         /**
          * <p>Gets detailed information about a specified number of requests--a
          * sample--that AWS WAF randomly selects from among the first 5,000 requests that
@@ -1197,8 +1766,10 @@ namespace Model
          * specified time range elapsed, <code>GetSampledRequests</code> returns an updated
          * time range. This new time range indicates the actual period during which AWS WAF
          * selected the requests in the sample.</p>
+         *
+         * returns a future to the operation so that it can be executed in parallel to other requests.
          */
-        virtual Model::GetSampledRequestsOutcome GetSampledRequests(const Model::GetSampledRequestsRequest& request) const;
+        virtual Model::GetSampledRequestsOutcomeCallable GetSampledRequestsCallable(const Model::GetSampledRequestsRequest& request) const;
 
         /**
          * <p>Gets detailed information about a specified number of requests--a
@@ -1212,10 +1783,11 @@ namespace Model
          * time range. This new time range indicates the actual period during which AWS WAF
          * selected the requests in the sample.</p>
          *
-         * returns a future to the operation so that it can be executed in parallel to other requests.
+         * Queues the request into a thread executor and triggers associated callback when operation has finished.
          */
-        virtual Model::GetSampledRequestsOutcomeCallable GetSampledRequestsCallable(const Model::GetSampledRequestsRequest& request) const;
+        virtual void GetSampledRequestsAsync(const Model::GetSampledRequestsRequest& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
         /**
          * <p>Gets detailed information about a specified number of requests--a
          * sample--that AWS WAF randomly selects from among the first 5,000 requests that
@@ -1228,9 +1800,22 @@ namespace Model
          * time range. This new time range indicates the actual period during which AWS WAF
          * selected the requests in the sample.</p>
          *
-         * Queues the request into a thread executor and triggers associated callback when operation has finished.
+         * Returns an awaitable that starts the operation the way GetSampledRequestsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
          */
-        virtual void GetSampledRequestsAsync(const Model::GetSampledRequestsRequest& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        template<typename REQUEST = Model::GetSampledRequestsRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetSampledRequestsOutcome> GetSampledRequestsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetSampledRequestsOutcome>([this, request](const std::function<void(Model::GetSampledRequestsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetSampledRequestsAsync(request, [complete](const WAFClient*, const Model::GetSampledRequestsRequest&, const Model::GetSampledRequestsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetSampledRequestsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
 
         /**
          * <p>Returns the <a>SizeConstraintSet</a> specified by
@@ -1254,6 +1839,28 @@ namespace Model
          */
         virtual void GetSizeConstraintSetAsync(const Model::GetSizeConstraintSetRequest& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the <a>SizeConstraintSet</a> specified by
+         * <code>SizeConstraintSetId</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetSizeConstraintSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetSizeConstraintSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetSizeConstraintSetOutcome> GetSizeConstraintSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetSizeConstraintSetOutcome>([this, request](const std::function<void(Model::GetSizeConstraintSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetSizeConstraintSetAsync(request, [complete](const WAFClient*, const Model::GetSizeConstraintSetRequest&, const Model::GetSizeConstraintSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetSizeConstraintSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the <a>SqlInjectionMatchSet</a> that is specified by
          * <code>SqlInjectionMatchSetId</code>.</p>
@@ -1276,6 +1883,28 @@ namespace Model
          */
         virtual void GetSqlInjectionMatchSetAsync(const Model::GetSqlInjectionMatchSetRequest& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the <a>SqlInjectionMatchSet</a> that is specified by
+         * <code>SqlInjectionMatchSetId</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetSqlInjectionMatchSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetSqlInjectionMatchSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetSqlInjectionMatchSetOutcome> GetSqlInjectionMatchSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetSqlInjectionMatchSetOutcome>([this, request](const std::function<void(Model::GetSqlInjectionMatchSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetSqlInjectionMatchSetAsync(request, [complete](const WAFClient*, const Model::GetSqlInjectionMatchSetRequest&, const Model::GetSqlInjectionMatchSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetSqlInjectionMatchSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns the <a>WebACL</a> that is specified by <code>WebACLId</code>.</p>
          */
@@ -1295,6 +1924,27 @@ namespace Model
          */
         virtual void GetWebACLAsync(const Model::GetWebACLRequest& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns the <a>WebACL</a> that is specified by <code>WebACLId</code>.</p>
+         *
+         * Returns an awaitable that starts the operation the way GetWebACLAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::GetWebACLRequest>
+        Aws::Utils::Threading::Awaitable<Model::GetWebACLOutcome> GetWebACLAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::GetWebACLOutcome>([this, request](const std::function<void(Model::GetWebACLOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->GetWebACLAsync(request, [complete](const WAFClient*, const Model::GetWebACLRequest&, const Model::GetWebACLOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::GetWebACLOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns an array of <a>ByteMatchSetSummary</a> objects.</p>
          */
@@ -1314,6 +1964,27 @@ namespace Model
          */
         virtual void ListByteMatchSetsAsync(const Model::ListByteMatchSetsRequest& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns an array of <a>ByteMatchSetSummary</a> objects.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListByteMatchSetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListByteMatchSetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListByteMatchSetsOutcome> ListByteMatchSetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListByteMatchSetsOutcome>([this, request](const std::function<void(Model::ListByteMatchSetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListByteMatchSetsAsync(request, [complete](const WAFClient*, const Model::ListByteMatchSetsRequest&, const Model::ListByteMatchSetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListByteMatchSetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns an array of <a>IPSetSummary</a> objects in the response.</p>
          */
@@ -1333,6 +2004,27 @@ namespace Model
          */
         virtual void ListIPSetsAsync(const Model::ListIPSetsRequest& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns an array of <a>IPSetSummary</a> objects in the response.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListIPSetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListIPSetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListIPSetsOutcome> ListIPSetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListIPSetsOutcome>([this, request](const std::function<void(Model::ListIPSetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListIPSetsAsync(request, [complete](const WAFClient*, const Model::ListIPSetsRequest&, const Model::ListIPSetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListIPSetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns an array of <a>RuleSummary</a> objects.</p>
          */
@@ -1352,6 +2044,27 @@ namespace Model
          */
         virtual void ListRulesAsync(const Model::ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns an array of <a>RuleSummary</a> objects.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListRulesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListRulesRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListRulesOutcome> ListRulesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListRulesOutcome>([this, request](const std::function<void(Model::ListRulesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListRulesAsync(request, [complete](const WAFClient*, const Model::ListRulesRequest&, const Model::ListRulesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListRulesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns an array of <a>SizeConstraintSetSummary</a> objects.</p>
          */
@@ -1371,6 +2084,27 @@ namespace Model
          */
         virtual void ListSizeConstraintSetsAsync(const Model::ListSizeConstraintSetsRequest& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns an array of <a>SizeConstraintSetSummary</a> objects.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListSizeConstraintSetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListSizeConstraintSetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListSizeConstraintSetsOutcome> ListSizeConstraintSetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListSizeConstraintSetsOutcome>([this, request](const std::function<void(Model::ListSizeConstraintSetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListSizeConstraintSetsAsync(request, [complete](const WAFClient*, const Model::ListSizeConstraintSetsRequest&, const Model::ListSizeConstraintSetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListSizeConstraintSetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns an array of <a>SqlInjectionMatchSet</a> objects.</p>
          */
@@ -1390,6 +2124,27 @@ namespace Model
          */
         virtual void ListSqlInjectionMatchSetsAsync(const Model::ListSqlInjectionMatchSetsRequest& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns an array of <a>SqlInjectionMatchSet</a> objects.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListSqlInjectionMatchSetsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListSqlInjectionMatchSetsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListSqlInjectionMatchSetsOutcome> ListSqlInjectionMatchSetsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListSqlInjectionMatchSetsOutcome>([this, request](const std::function<void(Model::ListSqlInjectionMatchSetsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListSqlInjectionMatchSetsAsync(request, [complete](const WAFClient*, const Model::ListSqlInjectionMatchSetsRequest&, const Model::ListSqlInjectionMatchSetsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListSqlInjectionMatchSetsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Returns an array of <a>WebACLSummary</a> objects in the response.</p>
          */
@@ -1409,6 +2164,27 @@ namespace Model
          */
         virtual void ListWebACLsAsync(const Model::ListWebACLsRequest& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Returns an array of <a>WebACLSummary</a> objects in the response.</p>
+         *
+         * Returns an awaitable that starts the operation the way ListWebACLsAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::ListWebACLsRequest>
+        Aws::Utils::Threading::Awaitable<Model::ListWebACLsOutcome> ListWebACLsAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::ListWebACLsOutcome>([this, request](const std::function<void(Model::ListWebACLsOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->ListWebACLsAsync(request, [complete](const WAFClient*, const Model::ListWebACLsRequest&, const Model::ListWebACLsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::ListWebACLsOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Inserts or deletes <a>ByteMatchTuple</a> objects (filters) in a
          * <a>ByteMatchSet</a>. For each <code>ByteMatchTuple</code> object, you specify
@@ -1506,6 +2282,53 @@ namespace Model
          */
         virtual void UpdateByteMatchSetAsync(const Model::UpdateByteMatchSetRequest& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Inserts or deletes <a>ByteMatchTuple</a> objects (filters) in a
+         * <a>ByteMatchSet</a>. For each <code>ByteMatchTuple</code> object, you specify
+         * the following values: </p> <ul> <li>Whether to insert or delete the object from
+         * the array. If you want to change a <code>ByteMatchSetUpdate</code> object, you
+         * delete the existing object and add a new one.</li> <li>The part of a web request
+         * that you want AWS WAF to inspect, such as a query string or the value of the
+         * <code>User-Agent</code> header. </li> <li>The bytes (typically a string that
+         * corresponds with ASCII characters) that you want AWS WAF to look for. For more
+         * information, including how you specify the values for the AWS WAF API and the
+         * AWS CLI or SDKs, see <code>TargetString</code> in the <a>ByteMatchTuple</a> data
+         * type. </li> <li>Where to look, such as at the beginning or the end of a query
+         * string.</li> <li>Whether to perform any conversions on the request, such as
+         * converting it to lowercase, before inspecting it for the specified string.</li>
+         * </ul> <p>For example, you can add a <code>ByteMatchSetUpdate</code> object that
+         * matches web requests in which <code>User-Agent</code> headers contain the string
+         * <code>BadBot</code>. You can then configure AWS WAF to block those requests.</p>
+         * <p>To create and configure a <code>ByteMatchSet</code>, perform the following
+         * steps:</p> <ol> <li>Create a <code>ByteMatchSet.</code> For more information,
+         * see <a>CreateByteMatchSet</a>.</li> <li>Use <a>GetChangeToken</a> to get the
+         * change token that you provide in the <code>ChangeToken</code> parameter of an
+         * <code>UpdateByteMatchSet</code> request.</li> <li>Submit an
+         * <code>UpdateByteMatchSet</code> request to specify the part of the request that
+         * you want AWS WAF to inspect (for example, the header or the URI) and the value
+         * that you want AWS WAF to watch for.</li> </ol> <p>For more information about how
+         * to use the AWS WAF API to allow or block HTTP requests, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateByteMatchSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateByteMatchSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateByteMatchSetOutcome> UpdateByteMatchSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateByteMatchSetOutcome>([this, request](const std::function<void(Model::UpdateByteMatchSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateByteMatchSetAsync(request, [complete](const WAFClient*, const Model::UpdateByteMatchSetRequest&, const Model::UpdateByteMatchSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateByteMatchSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Inserts or deletes <a>IPSetDescriptor</a> objects in an <code>IPSet</code>.
          * For each <code>IPSetDescriptor</code> object, you specify the following values:
@@ -1612,6 +2435,56 @@ namespace Model
          */
         virtual void UpdateIPSetAsync(const Model::UpdateIPSetRequest& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Inserts or deletes <a>IPSetDescriptor</a> objects in an <code>IPSet</code>.
+         * For each <code>IPSetDescriptor</code> object, you specify the following values:
+         * </p> <ul> <li>Whether to insert or delete the object from the array. If you want
+         * to change an <code>IPSetDescriptor</code> object, you delete the existing object
+         * and add a new one.</li> <li>The IP address version, <code>IPv4</code>. </li>
+         * <li>The IP address in CIDR notation, for example, <code>192.0.2.0/24</code> (for
+         * the range of IP addresses from <code>192.0.2.0</code> to
+         * <code>192.0.2.255</code>) or <code>192.0.2.44/32</code> (for the individual IP
+         * address <code>192.0.2.44</code>). </li> </ul> <p>AWS WAF supports /8, /16, /24,
+         * and /32 IP address ranges. For more information about CIDR notation, see the
+         * Wikipedia entry <a
+         * href="https://en.wikipedia.org/wiki/Classless_Inter-Domain_Routing">Classless
+         * Inter-Domain Routing</a>.</p> <p>You use an <code>IPSet</code> to specify which
+         * web requests you want to allow or block based on the IP addresses that the
+         * requests originated from. For example, if you're receiving a lot of requests
+         * from one or a small number of IP addresses and you want to block the requests,
+         * you can create an <code>IPSet</code> that specifies those IP addresses, and then
+         * configure AWS WAF to block the requests. </p> <p>To create and configure an
+         * <code>IPSet</code>, perform the following steps:</p> <ol> <li>Submit a
+         * <a>CreateIPSet</a> request.</li> <li>Use <a>GetChangeToken</a> to get the change
+         * token that you provide in the <code>ChangeToken</code> parameter of an
+         * <a>UpdateIPSet</a> request.</li> <li>Submit an <code>UpdateIPSet</code> request
+         * to specify the IP addresses that you want AWS WAF to watch for.</li> </ol>
+         * <p>When you update an <code>IPSet</code>, you specify the IP addresses that you
+         * want to add and/or the IP addresses that you want to delete. If you want to
+         * change an IP address, you delete the existing IP address and add the new
+         * one.</p> <p>For more information about how to use the AWS WAF API to allow or
+         * block HTTP requests, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateIPSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateIPSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateIPSetOutcome> UpdateIPSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateIPSetOutcome>([this, request](const std::function<void(Model::UpdateIPSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateIPSetAsync(request, [complete](const WAFClient*, const Model::UpdateIPSetRequest&, const Model::UpdateIPSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateIPSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Inserts or deletes <a>Predicate</a> objects in a <code>Rule</code>. Each
          * <code>Predicate</code> object identifies a predicate, such as a
@@ -1709,6 +2582,53 @@ namespace Model
          */
         virtual void UpdateRuleAsync(const Model::UpdateRuleRequest& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Inserts or deletes <a>Predicate</a> objects in a <code>Rule</code>. Each
+         * <code>Predicate</code> object identifies a predicate, such as a
+         * <a>ByteMatchSet</a> or an <a>IPSet</a>, that specifies the web requests that you
+         * want to allow, block, or count. If you add more than one predicate to a
+         * <code>Rule</code>, a request must match all of the specifications to be allowed,
+         * blocked, or counted. For example, suppose you add the following to a
+         * <code>Rule</code>: </p> <ul> <li>A <code>ByteMatchSet</code> that matches the
+         * value <code>BadBot</code> in the <code>User-Agent</code> header</li> <li>An
+         * <code>IPSet</code> that matches the IP address <code>192.0.2.44</code></li>
+         * </ul> <p>You then add the <code>Rule</code> to a <code>WebACL</code> and specify
+         * that you want to block requests that satisfy the <code>Rule</code>. For a
+         * request to be blocked, the <code>User-Agent</code> header in the request must
+         * contain the value <code>BadBot</code> <i>and</i> the request must originate from
+         * the IP address 192.0.2.44.</p> <p>To create and configure a <code>Rule</code>,
+         * perform the following steps:</p> <ol> <li>Create and update the predicates that
+         * you want to include in the <code>Rule</code>.</li> <li>Create the
+         * <code>Rule</code>. See <a>CreateRule</a>.</li> <li>Use
+         * <code>GetChangeToken</code> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of an <a>UpdateRule</a> request.</li>
+         * <li>Submit an <code>UpdateRule</code> request to add predicates to the
+         * <code>Rule</code>.</li> <li>Create and update a <code>WebACL</code> that
+         * contains the <code>Rule</code>. See <a>CreateWebACL</a>.</li> </ol> <p>If you
+         * want to replace one <code>ByteMatchSet</code> or <code>IPSet</code> with
+         * another, you delete the existing one and add the new one.</p> <p>For more
+         * information about how to use the AWS WAF API to allow or block HTTP requests,
+         * see the <a href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF
+         * Developer Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateRuleAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateRuleRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateRuleOutcome> UpdateRuleAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateRuleOutcome>([this, request](const std::function<void(Model::UpdateRuleOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateRuleAsync(request, [complete](const WAFClient*, const Model::UpdateRuleRequest&, const Model::UpdateRuleOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateRuleOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Inserts or deletes <a>SizeConstraint</a> objects (filters) in a
          * <a>SizeConstraintSet</a>. For each <code>SizeConstraint</code> object, you
@@ -1815,6 +2735,56 @@ namespace Model
          */
         virtual void UpdateSizeConstraintSetAsync(const Model::UpdateSizeConstraintSetRequest& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Inserts or deletes <a>SizeConstraint</a> objects (filters) in a
+         * <a>SizeConstraintSet</a>. For each <code>SizeConstraint</code> object, you
+         * specify the following values: </p> <ul> <li>Whether to insert or delete the
+         * object from the array. If you want to change a
+         * <code>SizeConstraintSetUpdate</code> object, you delete the existing object and
+         * add a new one.</li> <li>The part of a web request that you want AWS WAF to
+         * evaluate, such as the length of a query string or the length of the
+         * <code>User-Agent</code> header.</li> <li>Whether to perform any transformations
+         * on the request, such as converting it to lowercase, before checking its length.
+         * Note that transformations of the request body are not supported because the AWS
+         * resource forwards only the first <code>8192</code> bytes of your request to AWS
+         * WAF.</li> <li>A <code>ComparisonOperator</code> used for evaluating the selected
+         * part of the request against the specified <code>Size</code>, such as equals,
+         * greater than, less than, and so on.</li> <li>The length, in bytes, that you want
+         * AWS WAF to watch for in selected part of the request. The length is computed
+         * after applying the transformation.</li> </ul> <p>For example, you can add a
+         * <code>SizeConstraintSetUpdate</code> object that matches web requests in which
+         * the length of the <code>User-Agent</code> header is greater than 100 bytes. You
+         * can then configure AWS WAF to block those requests.</p> <p>To create and
+         * configure a <code>SizeConstraintSet</code>, perform the following steps:</p>
+         * <ol> <li>Create a <code>SizeConstraintSet.</code> For more information, see
+         * <a>CreateSizeConstraintSet</a>.</li> <li>Use <a>GetChangeToken</a> to get the
+         * change token that you provide in the <code>ChangeToken</code> parameter of an
+         * <code>UpdateSizeConstraintSet</code> request.</li> <li>Submit an
+         * <code>UpdateSizeConstraintSet</code> request to specify the part of the request
+         * that you want AWS WAF to inspect (for example, the header or the URI) and the
+         * value that you want AWS WAF to watch for.</li> </ol> <p>For more information
+         * about how to use the AWS WAF API to allow or block HTTP requests, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateSizeConstraintSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateSizeConstraintSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateSizeConstraintSetOutcome> UpdateSizeConstraintSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateSizeConstraintSetOutcome>([this, request](const std::function<void(Model::UpdateSizeConstraintSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateSizeConstraintSetAsync(request, [complete](const WAFClient*, const Model::UpdateSizeConstraintSetRequest&, const Model::UpdateSizeConstraintSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateSizeConstraintSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Inserts or deletes <a>SqlInjectionMatchTuple</a> objects (filters) in a
          * <a>SqlInjectionMatchSet</a>. For each <code>SqlInjectionMatchTuple</code>
@@ -1906,6 +2876,51 @@ namespace Model
          */
         virtual void UpdateSqlInjectionMatchSetAsync(const Model::UpdateSqlInjectionMatchSetRequest& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Inserts or deletes <a>SqlInjectionMatchTuple</a> objects (filters) in a
+         * <a>SqlInjectionMatchSet</a>. For each <code>SqlInjectionMatchTuple</code>
+         * object, you specify the following values:</p> <ul> <li><code>Action</code>:
+         * Whether to insert the object into or delete the object from the array. To change
+         * a <code>SqlInjectionMatchTuple</code>, you delete the existing object and add a
+         * new one.</li> <li><code>FieldToMatch</code>: The part of web requests that you
+         * want AWS WAF to inspect and, if you want AWS WAF to inspect a header, the name
+         * of the header.</li> <li><code>TextTransformation</code>: Which text
+         * transformation, if any, to perform on the web request before inspecting the
+         * request for snippets of malicious SQL code.</li> </ul> <p>You use
+         * <code>SqlInjectionMatchSet</code> objects to specify which CloudFront requests
+         * you want to allow, block, or count. For example, if you're receiving requests
+         * that contain snippets of SQL code in the query string and you want to block the
+         * requests, you can create a <code>SqlInjectionMatchSet</code> with the applicable
+         * settings, and then configure AWS WAF to block the requests. </p> <p>To create
+         * and configure a <code>SqlInjectionMatchSet</code>, perform the following
+         * steps:</p> <ol> <li>Submit a <a>CreateSqlInjectionMatchSet</a> request.</li>
+         * <li>Use <a>GetChangeToken</a> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of an <a>UpdateIPSet</a> request.</li>
+         * <li>Submit an <code>UpdateSqlInjectionMatchSet</code> request to specify the
+         * parts of web requests that you want AWS WAF to inspect for snippets of SQL
+         * code.</li> </ol> <p>For more information about how to use the AWS WAF API to
+         * allow or block HTTP requests, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateSqlInjectionMatchSetAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateSqlInjectionMatchSetRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateSqlInjectionMatchSetOutcome> UpdateSqlInjectionMatchSetAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateSqlInjectionMatchSetOutcome>([this, request](const std::function<void(Model::UpdateSqlInjectionMatchSetOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateSqlInjectionMatchSetAsync(request, [complete](const WAFClient*, const Model::UpdateSqlInjectionMatchSetRequest&, const Model::UpdateSqlInjectionMatchSetOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateSqlInjectionMatchSetOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Inserts or deletes <a>ActivatedRule</a> objects in a <code>WebACL</code>.
          * Each <code>Rule</code> identifies web requests that you want to allow, block, or
@@ -2039,6 +3054,65 @@ namespace Model
          */
         virtual void UpdateWebACLAsync(const Model::UpdateWebACLRequest& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Inserts or deletes <a>ActivatedRule</a> objects in a <code>WebACL</code>.
+         * Each <code>Rule</code> identifies web requests that you want to allow, block, or
+         * count. When you update a <code>WebACL</code>, you specify the following
+         * values:</p> <ul> <li>A default action for the <code>WebACL</code>, either
+         * <code>ALLOW</code> or <code>BLOCK</code>. AWS WAF performs the default action if
+         * a request doesn't match the criteria in any of the <code>Rules</code> in a
+         * <code>WebACL</code>.</li> <li>The <code>Rules</code> that you want to add and/or
+         * delete. If you want to replace one <code>Rule</code> with another, you delete
+         * the existing <code>Rule</code> and add the new one.</li> <li>For each
+         * <code>Rule</code>, whether you want AWS WAF to allow requests, block requests,
+         * or count requests that match the conditions in the <code>Rule</code>.</li>
+         * <li>The order in which you want AWS WAF to evaluate the <code>Rules</code> in a
+         * <code>WebACL</code>. If you add more than one <code>Rule</code> to a
+         * <code>WebACL</code>, AWS WAF evaluates each request against the
+         * <code>Rules</code> in order based on the value of <code>Priority</code>. (The
+         * <code>Rule</code> that has the lowest value for <code>Priority</code> is
+         * evaluated first.) When a web request matches all of the predicates (such as
+         * <code>ByteMatchSets</code> and <code>IPSets</code>) in a <code>Rule</code>, AWS
+         * WAF immediately takes the corresponding action, allow or block, and doesn't
+         * evaluate the request against the remaining <code>Rules</code> in the
+         * <code>WebACL</code>, if any. </li> <li>The CloudFront distribution that you want
+         * to associate with the <code>WebACL</code>.</li> </ul> <p>To create and configure
+         * a <code>WebACL</code>, perform the following steps:</p> <ol> <li>Create and
+         * update the predicates that you want to include in <code>Rules</code>. For more
+         * information, see <a>CreateByteMatchSet</a>, <a>UpdateByteMatchSet</a>,
+         * <a>CreateIPSet</a>, <a>UpdateIPSet</a>, <a>CreateSqlInjectionMatchSet</a>, and
+         * <a>UpdateSqlInjectionMatchSet</a>.</li> <li>Create and update the
+         * <code>Rules</code> that you want to include in the <code>WebACL</code>. For more
+         * information, see <a>CreateRule</a> and <a>UpdateRule</a>.</li> <li>Create a
+         * <code>WebACL</code>. See <a>CreateWebACL</a>.</li> <li>Use
+         * <code>GetChangeToken</code> to get the change token that you provide in the
+         * <code>ChangeToken</code> parameter of an <a>UpdateWebACL</a> request.</li>
+         * <li>Submit an <code>UpdateWebACL</code> request to specify the
+         * <code>Rules</code> that you want to include in the <code>WebACL</code>, to
+         * specify the default action, and to associate the <code>WebACL</code> with a
+         * CloudFront distribution. </li> </ol> <p>For more information about how to use
+         * the AWS WAF API to allow or block HTTP requests, see the <a
+         * href="http://docs.aws.amazon.com/waf/latest/developerguide/">AWS WAF Developer
+         * Guide</a>.</p>
+         *
+         * Returns an awaitable that starts the operation the way UpdateWebACLAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::UpdateWebACLRequest>
+        Aws::Utils::Threading::Awaitable<Model::UpdateWebACLOutcome> UpdateWebACLAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::UpdateWebACLOutcome>([this, request](const std::function<void(Model::UpdateWebACLOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->UpdateWebACLAsync(request, [complete](const WAFClient*, const Model::UpdateWebACLRequest&, const Model::UpdateWebACLOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::UpdateWebACLOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -28,6 +28,7 @@
 #include <aws/workspaces/model/RebuildWorkspacesResult.h>
 #include <aws/workspaces/model/TerminateWorkspacesResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Awaitable.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -161,6 +162,28 @@ namespace Model
          */
         virtual void CreateWorkspacesAsync(const Model::CreateWorkspacesRequest& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Creates one or more WorkSpaces.</p> <note> <p>This operation is asynchronous
+         * and returns before the WorkSpaces are created.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way CreateWorkspacesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::CreateWorkspacesRequest>
+        Aws::Utils::Threading::Awaitable<Model::CreateWorkspacesOutcome> CreateWorkspacesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::CreateWorkspacesOutcome>([this, request](const std::function<void(Model::CreateWorkspacesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->CreateWorkspacesAsync(request, [complete](const WorkSpacesClient*, const Model::CreateWorkspacesRequest&, const Model::CreateWorkspacesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::CreateWorkspacesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Obtains information about the WorkSpace bundles that are available to your
          * account in the specified region.</p> <p>You can filter the results with either
@@ -198,6 +221,33 @@ namespace Model
          */
         virtual void DescribeWorkspaceBundlesAsync(const Model::DescribeWorkspaceBundlesRequest& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Obtains information about the WorkSpace bundles that are available to your
+         * account in the specified region.</p> <p>You can filter the results with either
+         * the <code>BundleIds</code> parameter, or the <code>Owner</code> parameter, but
+         * not both.</p> <p>This operation supports pagination with the use of the
+         * <code>NextToken</code> request and response parameters. If more results are
+         * available, the <code>NextToken</code> response member contains a token that you
+         * pass in the next call to this operation to retrieve the next set of items.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeWorkspaceBundlesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeWorkspaceBundlesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeWorkspaceBundlesOutcome> DescribeWorkspaceBundlesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeWorkspaceBundlesOutcome>([this, request](const std::function<void(Model::DescribeWorkspaceBundlesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeWorkspaceBundlesAsync(request, [complete](const WorkSpacesClient*, const Model::DescribeWorkspaceBundlesRequest&, const Model::DescribeWorkspaceBundlesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeWorkspaceBundlesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Retrieves information about the AWS Directory Service directories in the
          * region that are registered with Amazon WorkSpaces and are available to your
@@ -232,6 +282,32 @@ namespace Model
          */
         virtual void DescribeWorkspaceDirectoriesAsync(const Model::DescribeWorkspaceDirectoriesRequest& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Retrieves information about the AWS Directory Service directories in the
+         * region that are registered with Amazon WorkSpaces and are available to your
+         * account.</p> <p>This operation supports pagination with the use of the
+         * <code>NextToken</code> request and response parameters. If more results are
+         * available, the <code>NextToken</code> response member contains a token that you
+         * pass in the next call to this operation to retrieve the next set of items.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeWorkspaceDirectoriesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeWorkspaceDirectoriesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeWorkspaceDirectoriesOutcome> DescribeWorkspaceDirectoriesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeWorkspaceDirectoriesOutcome>([this, request](const std::function<void(Model::DescribeWorkspaceDirectoriesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeWorkspaceDirectoriesAsync(request, [complete](const WorkSpacesClient*, const Model::DescribeWorkspaceDirectoriesRequest&, const Model::DescribeWorkspaceDirectoriesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeWorkspaceDirectoriesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Obtains information about the specified WorkSpaces. </p> <p>Only one of the
          * filter parameters, such as <code>BundleId</code>, <code>DirectoryId</code>, or
@@ -269,6 +345,33 @@ namespace Model
          */
         virtual void DescribeWorkspacesAsync(const Model::DescribeWorkspacesRequest& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Obtains information about the specified WorkSpaces. </p> <p>Only one of the
+         * filter parameters, such as <code>BundleId</code>, <code>DirectoryId</code>, or
+         * <code>WorkspaceIds</code>, can be specified at a time.</p> <p>This operation
+         * supports pagination with the use of the <code>NextToken</code> request and
+         * response parameters. If more results are available, the <code>NextToken</code>
+         * response member contains a token that you pass in the next call to this
+         * operation to retrieve the next set of items.</p>
+         *
+         * Returns an awaitable that starts the operation the way DescribeWorkspacesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::DescribeWorkspacesRequest>
+        Aws::Utils::Threading::Awaitable<Model::DescribeWorkspacesOutcome> DescribeWorkspacesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::DescribeWorkspacesOutcome>([this, request](const std::function<void(Model::DescribeWorkspacesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->DescribeWorkspacesAsync(request, [complete](const WorkSpacesClient*, const Model::DescribeWorkspacesRequest&, const Model::DescribeWorkspacesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::DescribeWorkspacesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Reboots the specified WorkSpaces.</p> <p>To be able to reboot a WorkSpace,
          * the WorkSpace must have a <b>State</b> of <code>AVAILABLE</code>,
@@ -297,6 +400,30 @@ namespace Model
          */
         virtual void RebootWorkspacesAsync(const Model::RebootWorkspacesRequest& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Reboots the specified WorkSpaces.</p> <p>To be able to reboot a WorkSpace,
+         * the WorkSpace must have a <b>State</b> of <code>AVAILABLE</code>,
+         * <code>IMPAIRED</code>, or <code>INOPERABLE</code>.</p> <note> <p>This operation
+         * is asynchronous and will return before the WorkSpaces have rebooted.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way RebootWorkspacesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RebootWorkspacesRequest>
+        Aws::Utils::Threading::Awaitable<Model::RebootWorkspacesOutcome> RebootWorkspacesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RebootWorkspacesOutcome>([this, request](const std::function<void(Model::RebootWorkspacesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RebootWorkspacesAsync(request, [complete](const WorkSpacesClient*, const Model::RebootWorkspacesRequest&, const Model::RebootWorkspacesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RebootWorkspacesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Rebuilds the specified WorkSpaces.</p> <p>Rebuilding a WorkSpace is a
          * potentially destructive action that can result in the loss of data. Rebuilding a
@@ -352,6 +479,39 @@ namespace Model
          */
         virtual void RebuildWorkspacesAsync(const Model::RebuildWorkspacesRequest& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Rebuilds the specified WorkSpaces.</p> <p>Rebuilding a WorkSpace is a
+         * potentially destructive action that can result in the loss of data. Rebuilding a
+         * WorkSpace causes the following to occur:</p> <ul> <li>The system is restored to
+         * the image of the bundle that the WorkSpace is created from. Any applications
+         * that have been installed, or system settings that have been made since the
+         * WorkSpace was created will be lost.</li> <li>The data drive (D drive) is
+         * re-created from the last automatic snapshot taken of the data drive. The current
+         * contents of the data drive are overwritten. Automatic snapshots of the data
+         * drive are taken every 12 hours, so the snapshot can be as much as 12 hours
+         * old.</li> </ul> <p>To be able to rebuild a WorkSpace, the WorkSpace must have a
+         * <b>State</b> of <code>AVAILABLE</code> or <code>ERROR</code>.</p> <note> <p>This
+         * operation is asynchronous and will return before the WorkSpaces have been
+         * completely rebuilt.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way RebuildWorkspacesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::RebuildWorkspacesRequest>
+        Aws::Utils::Threading::Awaitable<Model::RebuildWorkspacesOutcome> RebuildWorkspacesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::RebuildWorkspacesOutcome>([this, request](const std::function<void(Model::RebuildWorkspacesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->RebuildWorkspacesAsync(request, [complete](const WorkSpacesClient*, const Model::RebuildWorkspacesRequest&, const Model::RebuildWorkspacesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::RebuildWorkspacesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
         /**
          * <p>Terminates the specified WorkSpaces.</p> <p>Terminating a WorkSpace is a
          * permanent action and cannot be undone. The user's data is not maintained and
@@ -389,6 +549,33 @@ namespace Model
          */
         virtual void TerminateWorkspacesAsync(const Model::TerminateWorkspacesRequest& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * <p>Terminates the specified WorkSpaces.</p> <p>Terminating a WorkSpace is a
+         * permanent action and cannot be undone. The user's data is not maintained and
+         * will be destroyed. If you need to archive any user data, contact Amazon Web
+         * Services before terminating the WorkSpace.</p> <p>You can terminate a WorkSpace
+         * that is in any state except <code>SUSPENDED</code>.</p> <note> <p>This operation
+         * is asynchronous and will return before the WorkSpaces have been completely
+         * terminated.</p> </note>
+         *
+         * Returns an awaitable that starts the operation the way TerminateWorkspacesAsync does; the awaiting coroutine resumes on the
+         * thread that completes the request, and with an event driven http client no thread waits on it in the meantime.
+         */
+        template<typename REQUEST = Model::TerminateWorkspacesRequest>
+        Aws::Utils::Threading::Awaitable<Model::TerminateWorkspacesOutcome> TerminateWorkspacesAwaitable(const REQUEST& request) const
+        {
+            return Aws::Utils::Threading::Awaitable<Model::TerminateWorkspacesOutcome>([this, request](const std::function<void(Model::TerminateWorkspacesOutcome&&)>& complete)
+            {
+                //the handler is always given a temporary outcome, so it is moved out; some results (streams) cannot be copied.
+                this->TerminateWorkspacesAsync(request, [complete](const WorkSpacesClient*, const Model::TerminateWorkspacesRequest&, const Model::TerminateWorkspacesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    complete(std::move(const_cast<Model::TerminateWorkspacesOutcome&>(outcome)));
+                });
+            });
+        }
+#endif
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -15,19 +15,44 @@
 
 #include <aws/core/internal/EC2MetadataClient.h>
 
+#include <chrono>
+#include <mutex>
+#include <thread>
+
 class MockEC2MetadataClient : public Aws::Internal::EC2MetadataClient
 {
 public:
+    MockEC2MetadataClient() : m_latency(0) {}
+
+    //providers call this from their refresh thread while tests change the mocked value.
     inline Aws::String GetDefaultCredentials() const
     {
-        return m_mockedValue;
+        std::chrono::milliseconds latency;
+        Aws::String value;
+        {
+            std::lock_guard<std::mutex> locker(m_mockLock);
+            latency = m_latency;
+            value = m_mockedValue;
+        }
+
+        std::this_thread::sleep_for(latency);
+        return value;
     }
 
     inline void SetMockedCredentialsValue(const Aws::String& mockValue)
     {
+        std::lock_guard<std::mutex> locker(m_mockLock);
         m_mockedValue = mockValue;
     }
 
+    inline void SetMockedLatency(std::chrono::milliseconds latency)
+    {
+        std::lock_guard<std::mutex> locker(m_mockLock);
+        m_latency = latency;
+    }
+
 private:
+    mutable std::mutex m_mockLock;
     Aws::String m_mockedValue;
+    std::chrono::milliseconds m_latency;
 };
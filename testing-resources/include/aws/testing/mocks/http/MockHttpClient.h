@@ -41,9 +41,12 @@ public:
         if (m_responsesToUse.size() > 0)
         {
             std::shared_ptr<Aws::Http::HttpResponse> responseToUse = m_responsesToUse.front();
+            request.SetTransferFailure(m_failuresToUse.front());
             m_responsesToUse.pop();
+            m_failuresToUse.pop();
             return responseToUse;
         }
+        request.SetTransferFailure(Aws::Http::HttpTransferFailure::OTHER);
         return nullptr;
     }
 
@@ -52,18 +55,32 @@ public:
 
     //these will be cleaned up by the aws client, so if you are testing an aws client, don't worry about freeing the memory
     //when you are finished.
-    void AddResponseToReturn(const std::shared_ptr<Aws::Http::HttpResponse>& response) { m_responsesToUse.push(response); }
+    void AddResponseToReturn(const std::shared_ptr<Aws::Http::HttpResponse>& response)
+    {
+        m_responsesToUse.push(response);
+        m_failuresToUse.push(response ? Aws::Http::HttpTransferFailure::NONE : Aws::Http::HttpTransferFailure::OTHER);
+    }
+
+    //makes a later request get no response, failed the way an http client would report it.
+    void AddFailureToReturn(Aws::Http::HttpTransferFailure failure)
+    {
+        m_responsesToUse.push(nullptr);
+        m_failuresToUse.push(failure);
+    }
 
     void Reset()
     {
         m_requestsMade.clear();
         Aws::Queue<std::shared_ptr<Aws::Http::HttpResponse> > empty;
         std::swap(m_responsesToUse, empty);
+        Aws::Queue<Aws::Http::HttpTransferFailure> noFailures;
+        std::swap(m_failuresToUse, noFailures);
     }
 
 private:
     mutable Aws::Vector<Aws::Http::Standard::StandardHttpRequest> m_requestsMade;
     mutable Aws::Queue< std::shared_ptr<Aws::Http::HttpResponse> > m_responsesToUse;
+    mutable Aws::Queue<Aws::Http::HttpTransferFailure> m_failuresToUse;
 };
 
 class MockHttpClientFactory : public Aws::Http::HttpClientFactory